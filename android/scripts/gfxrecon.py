@@ -68,17 +68,64 @@ def CreateReplayParser():
     parser.add_argument('--version', action='store_true', default=False, help='Print version information and exit (forwarded to replay tool)')
     parser.add_argument('--pause-frame', metavar='N', help='Pause after replaying frame number N (forwarded to replay tool)')
     parser.add_argument('--paused', action='store_true', default=False, help='Pause after replaying the first frame (same as "--pause-frame 1"; forwarded to replay tool)')
+    parser.add_argument('--fast-forward', metavar='N', help='Drop the draw, dispatch, and trace rays commands that are recorded before frame N, to reach frame N faster.  Resource creation, uploads, copies, and descriptor updates are still replayed, and frames are still presented.  Render targets, storage images, and storage buffers that are written by the dropped commands are left unwritten, so frames that read them after frame N may render incorrectly (forwarded to replay tool)')
+    parser.add_argument('--loop-frames', metavar='FIRST-LAST', help='Replay the specified frame range repeatedly and report the time of each repeat, restoring device memory contents with GPU copies before each repeat (forwarded to replay tool)')
+    parser.add_argument('--loop-count', metavar='N', help='Number of times to replay the --loop-frames range. Default is 10 (forwarded to replay tool)')
+    parser.add_argument('--loop-program', action='store_true', default=False, help='Keep the decoded API calls of the first replay of the --loop-frames range in memory and replay the following repeats from them (forwarded to replay tool)')
+    parser.add_argument('--timing-report', metavar='FILE', help='Write the CPU time, GPU time, and present-to-present interval of each frame, with percentile statistics, to the specified file on the device. The file is written as CSV when its name ends with .csv, and as JSON otherwise (forwarded to replay tool)')
+    parser.add_argument('--timing-report-frames', metavar='FIRST-LAST', help='Only report the specified range of frames, numbered from 1 for the first replayed frame (forwarded to replay tool)')
+    parser.add_argument('--pass-timing-report', metavar='FILE', help='Write the GPU time of each render pass and dispatch group of each frame, keyed by the capture IDs of its command buffer and render pass, to the specified file on the device. The file is written as CSV when its name ends with .csv, and as JSON otherwise (forwarded to replay tool)')
+    parser.add_argument('--pass-timing-frames', metavar='FIRST-LAST', help='Only time the passes of the specified range of frames, numbered from 1 for the first replayed frame (forwarded to replay tool)')
+    parser.add_argument('--memory-report', metavar='FILE', help='Log the current and peak host and device memory usage of replay for each range of frames, and append it to the specified file on the device. The file is written as CSV when its name ends with .csv, and as JSON lines otherwise (forwarded to replay tool)')
+    parser.add_argument('--memory-report-interval', metavar='N', help='Number of frames in each range of the memory report. Default is 100 (forwarded to replay tool)')
+    parser.add_argument('--thread-affinity', metavar='AFFINITY', help='Restrict the replay threads to processor cores, with auto or a list of role assignments such as replay=2,decode=3,io=4,worker=5-7. With auto, the replay, decode, and io threads each run on their own physical core, preferring the big cores of big.LITTLE processors, and the pipeline and command buffer worker threads use the rest (forwarded to replay tool)')
+    parser.add_argument('--thread-priority', metavar='PRIORITIES', help='Set the priority of the replay threads to low, normal, or high, for all roles or for each role with a list such as replay=high,decode=high (forwarded to replay tool)')
+    parser.add_argument('--huge-pages', metavar='MODE', choices=['none', 'transparent', 'explicit'], help='Back the capture file read and decompression buffers that are 2 MiB or larger with huge pages. Available modes are none, transparent, and explicit. Explicit huge pages are allocated from the reserved huge page pool, falling back to transparent huge pages (forwarded to replay tool)')
+    parser.add_argument('--profile-calls', action='store_true', default=False, help='Measure the CPU time that replay spends decoding and processing each API call, and log a table of the calls sorted by total time when replay finishes (forwarded to replay tool)')
+    parser.add_argument('--debug-labels', action='store_true', default=False, help='Insert VK_EXT_debug_utils labels for external GPU profilers, naming each queue submission with its frame and submission index, and each command buffer recording with the command buffer\'s capture ID (forwarded to replay tool)')
+    parser.add_argument('--debug-label-blocks', action='store_true', default=False, help='Same as --debug-labels, with the index of the capture file block of the submission or begin command added to each label (forwarded to replay tool)')
     parser.add_argument('--screenshot-all', action='store_true', default=False, help='Generate screenshots for all frames.  When this option is specified, --screenshots is ignored (forwarded to replay tool)')
     parser.add_argument('--screenshots', metavar='RANGES', help='Generate screenshots for the specified frames.  Target frames are specified as a comma separated list of frame ranges.  A frame range can be specified as a single value, to specify a single frame, or as two hyphenated values, to specify the first and last frames to process.  Frame ranges should be specified in ascending order and cannot overlap.  Note that frame numbering is 1-based (i.e. the first frame is frame 1).  Example: 200,301-305 will generate six screenshots (forwarded to replay tool)')
-    parser.add_argument('--screenshot-format', metavar='FORMAT', choices=['bmp'], help='Image file format to use for screenshot generation.  Available formats are: bmp (forwarded to replay tool)')
+    parser.add_argument('--screenshot-format', metavar='FORMAT', choices=['bmp', 'png', 'qoi'], help='Image file format to use for screenshot generation.  Available formats are: bmp, png, qoi.  PNG and QOI images are written without alpha and encoded by background threads (forwarded to replay tool)')
     parser.add_argument('--screenshot-dir', metavar='DIR', help='Directory to write screenshots. Default is "/sdcard" (forwarded to replay tool)')
     parser.add_argument('--screenshot-prefix', metavar='PREFIX', help='Prefix to apply to the screenshot file name.  Default is "screenshot" (forwarded to replay tool)')
+    parser.add_argument('--screenshot-downscale', metavar='N', help='Divide the screenshot width and height by N.  The image is scaled on the GPU before it is read back.  Default is 1 (forwarded to replay tool)')
+    parser.add_argument('--screenshot-hash-only', action='store_true', default=False, help='Write a 64-bit hash of each screenshot to the file <dir>/<prefix>_hashes.txt instead of writing image files (forwarded to replay tool)')
     parser.add_argument('--sfa', '--skip-failed-allocations', action='store_true', default=False, help='Skip vkAllocateMemory, vkAllocateCommandBuffers, and vkAllocateDescriptorSets calls that failed during capture (forwarded to replay tool)')
     parser.add_argument('--opcd', '--omit-pipeline-cache-data', action='store_true', default=False, help='Omit pipeline cache data from calls to vkCreatePipelineCache and skip calls to vkGetPipelineCacheData (forwarded to replay tool)')
+    parser.add_argument('--pipeline-cache', metavar='DIR', help='Keep a pipeline cache for each capture file and replay device in the device directory DIR, which is used by all pipeline creation calls and saved when the device is destroyed, so that repeated replays do not recompile the same pipelines (forwarded to replay tool)')
     parser.add_argument('--surface-index', metavar='N', help='Restrict rendering to the Nth surface object created.  Used with captures that include multiple surfaces.  Default is -1 (render to all surfaces; forwarded to replay tool)')
+    parser.add_argument('--virtual-swapchain', action='store_true', default=False, help='Back each swapchain with offscreen images that are never presented, so that replay speed is not limited by the presentation engine or display timing. Acquire and present calls are emulated, and screenshots are taken from the offscreen images (forwarded to replay tool)')
+    parser.add_argument('--present-mode', metavar='MODE', choices=['immediate', 'mailbox'], help='Present swapchain images with an unlocked present mode, so that replay speed is not limited by vertical blank.  Available modes are: immediate, mailbox.  The other mode is used when the surface does not support the requested mode (forwarded to replay tool)')
     parser.add_argument('--sync', action='store_true', default=False, help='Synchronize after each queue submission with vkQueueWaitIdle (forwarded to replay tool)')
+    parser.add_argument('--max-submits-in-flight', metavar='N', help='Wait before each queue submission until fewer than N earlier submissions to the same queue are executing, using a timeline semaphore per queue (forwarded to replay tool)')
+    parser.add_argument('--max-frames-in-flight', metavar='N', help='Wait after each present until the submissions of all but the last N-1 frames have completed, bounding the GPU queue depth without the full serialization of --sync (forwarded to replay tool)')
+    parser.add_argument('--collapse-polling', action='store_true', default=False, help='Skip vkGetFenceStatus, vkWaitForFences, and vkGetQueryPoolResults calls that were not satisfied during capture or that replay has already satisfied, waiting only once for the call that found the fences signaled or the query results available (forwarded to replay tool)')
+    parser.add_argument('--batch-submits', action='store_true', default=False, help='Merge consecutive vkQueueSubmit calls to the same queue into one call with multiple submit infos.  The merged submissions are submitted before any other call, such as a fence wait, a submission to another queue, or a present (forwarded to replay tool)')
+    parser.add_argument('--recycle-pools', action='store_true', default=False, help='Keep descriptor pools and command pools that are destroyed, after resetting them, and reuse them in place of creating pools with the same create parameters (forwarded to replay tool)')
+    parser.add_argument('--pace-cpu-timestamps', action='store_true', default=False, help='Wait before each queue submission and present until at least the CPU time that the application spent since its previous submission or present has passed, for captures made with CPU timestamps enabled (forwarded to replay tool)')
+    parser.add_argument('--skip-redundant-descriptor-updates', action='store_true', default=False, help='Skip descriptor writes and descriptor update template updates that would not change the contents of the descriptor set, by caching the last contents written to each descriptor (forwarded to replay tool)')
+    parser.add_argument('--reuse-command-buffers', action='store_true', default=False, help='Skip recordings of command buffers whose encoded commands match the previous recording of the command buffer, submitting the commands that were already recorded. Command buffers begun with the one time submit flag, and recordings that bind updated descriptor sets or execute re-recorded secondary command buffers, are recorded again (forwarded to replay tool)')
+    parser.add_argument('--persistent-mapping', action='store_true', default=False, help='Map host visible memory once when it is allocated, keeping it mapped until it is freed, so that the capture file\'s vkMapMemory and vkUnmapMemory calls do not call the driver. The rebind memory translation mode always behaves this way (forwarded to replay tool)')
     parser.add_argument('--remove-unsupported', action='store_true', default=False, help='Remove unsupported extensions and features from instance and device creation parameters (forwarded to replay tool)')
+    parser.add_argument('--remap-device-addresses', action='store_true', default=False, help='Translate the buffer and acceleration structure device addresses that were captured to the addresses of the replay device, for devices that do not support capture replay of device addresses, and replace the shader group handles of shader binding tables by the handles retrieved at replay (forwarded to replay tool)')
+    parser.add_argument('--accel-struct-cache', action='store_true', default=False, help='Store the bottom level acceleration structures that are built by replay in <file>.blas, and load them from it instead of building them in later replays of <file> on the same device and driver (forwarded to replay tool)')
+    parser.add_argument('--lazy-resource-init', action='store_true', default=False, help='Defer the upload of the buffer and image contents of a trimmed capture file\'s state snapshot until a queue submission first references the resource, reading the contents from the file at that time (forwarded to replay tool)')
+    parser.add_argument('--mmap', action='store_true', default=False, help='Read the capture file through a memory mapping, passing block data to the decoders without copying it (forwarded to replay tool)')
+    parser.add_argument('--prefetch', action='store_true', default=False, help='Read and decompress capture file blocks ahead of replay from a separate thread (forwarded to replay tool)')
+    parser.add_argument('--preload', action='store_true', default=False, help='Read and decompress all capture file blocks into memory before replay starts, so that replay timing does not depend on storage I/O. Implies --prefetch (forwarded to replay tool)')
+    parser.add_argument('--preload-frames', metavar='FIRST-LAST', help='Read and decompress the blocks of the specified frame range into memory when replay reaches the first frame of the range. Implies --prefetch (forwarded to replay tool)')
+    parser.add_argument('--preload-limit', metavar='MIB', help='Stop preloading when the preloaded blocks reach the specified size in MiB, and read the remaining blocks ahead of replay as with --prefetch. Default is 2048 (forwarded to replay tool)')
+    parser.add_argument('--decompression-threads', metavar='N', help='Decompress up to N capture file blocks concurrently, using a pool of N worker threads. Blocks are still replayed in file order. Implies --prefetch (forwarded to replay tool)')
+    parser.add_argument('--decode-thread', action='store_true', default=False, help='Read the capture file and decode API calls ahead of replay from a separate thread, so that the replay thread only maps handles and calls Vulkan (forwarded to replay tool)')
+    parser.add_argument('--replay-threads', metavar='N', help='Record the command buffers of each captured thread from one of N replay worker threads, so that command buffers that were recorded in parallel are also replayed in parallel. All other API calls are replayed in file order after the workers finish. Implies --decode-thread (forwarded to replay tool)')
+    parser.add_argument('--pipeline-threads', metavar='N', help='Create graphics and compute pipelines from a pool of N worker threads, so that replay continues while pipelines are compiled. Replay waits for a pipeline when it is first used. Cannot be combined with --decode-thread or --replay-threads (forwarded to replay tool)')
+    parser.add_argument('--pipeline-warm-up', metavar='N', help='Pre-scan the first N frames of the capture file and create their shader modules and graphics and compute pipelines from worker threads as soon as the objects that they use exist, so that the pipeline creation calls of those frames use the pipelines that were already created (forwarded to replay tool)')
     parser.add_argument('-m', '--memory-translation', metavar='MODE', choices=['none', 'remap', 'realign', 'rebind'], help='Enable memory translation for replay on GPUs with memory types that are not compatible with the capture GPU\'s memory types.  Available modes are: none, remap, realign, rebind (forwarded to replay tool)')
+    parser.add_argument('--rebind-pool-algorithm', metavar='ALGORITHM', choices=['default', 'linear', 'buddy'], help='Allocation algorithm for the rebind memory translation mode. Available algorithms are: default (VMA default pools), linear and buddy (custom pool for each memory type, using VMA\'s linear or buddy algorithm) (forwarded to replay tool)')
+    parser.add_argument('--rebind-block-size', metavar='MIB', help='Size of the device memory blocks that the rebind memory translation mode suballocates resources from (forwarded to replay tool)')
+    parser.add_argument('--device-memory-budget', metavar='MIB', help='Limit device local memory usage with the rebind memory translation mode. Resources that would exceed the budget are allocated from host memory accessible to the device (forwarded to replay tool)')
+    parser.add_argument('--no-analysis-cache', action='store_true', default=False, help='Do not read or write <file>.meta, which stores the results of the first replay pass of the realign memory translation mode so that later replays on the same devices skip it (forwarded to replay tool)')
     parser.add_argument('file', nargs='?', help='File on device to play (forwarded to replay tool)')
     return parser
 
@@ -95,6 +142,66 @@ def MakeExtrasString(args):
     if args.paused:
         arg_list.append('--paused')
 
+    if args.fast_forward:
+        arg_list.append('--fast-forward')
+        arg_list.append('{}'.format(args.fast_forward))
+
+    if args.loop_frames:
+        arg_list.append('--loop-frames')
+        arg_list.append('{}'.format(args.loop_frames))
+
+    if args.loop_count:
+        arg_list.append('--loop-count')
+        arg_list.append('{}'.format(args.loop_count))
+
+    if args.loop_program:
+        arg_list.append('--loop-program')
+
+    if args.timing_report:
+        arg_list.append('--timing-report')
+        arg_list.append('{}'.format(args.timing_report))
+
+    if args.timing_report_frames:
+        arg_list.append('--timing-report-frames')
+        arg_list.append('{}'.format(args.timing_report_frames))
+
+    if args.pass_timing_report:
+        arg_list.append('--pass-timing-report')
+        arg_list.append('{}'.format(args.pass_timing_report))
+
+    if args.pass_timing_frames:
+        arg_list.append('--pass-timing-frames')
+        arg_list.append('{}'.format(args.pass_timing_frames))
+
+    if args.memory_report:
+        arg_list.append('--memory-report')
+        arg_list.append('{}'.format(args.memory_report))
+
+    if args.memory_report_interval:
+        arg_list.append('--memory-report-interval')
+        arg_list.append('{}'.format(args.memory_report_interval))
+
+    if args.thread_affinity:
+        arg_list.append('--thread-affinity')
+        arg_list.append('{}'.format(args.thread_affinity))
+
+    if args.thread_priority:
+        arg_list.append('--thread-priority')
+        arg_list.append('{}'.format(args.thread_priority))
+
+    if args.huge_pages:
+        arg_list.append('--huge-pages')
+        arg_list.append('{}'.format(args.huge_pages))
+
+    if args.profile_calls:
+        arg_list.append('--profile-calls')
+
+    if args.debug_labels:
+        arg_list.append('--debug-labels')
+
+    if args.debug_label_blocks:
+        arg_list.append('--debug-label-blocks')
+
     if args.screenshot_all:
         arg_list.append('--screenshot-all')
     elif args.screenshots:
@@ -113,26 +220,133 @@ def MakeExtrasString(args):
         arg_list.append('--screenshot-prefix')
         arg_list.append('{}'.format(args.screenshot_prefix))
 
+    if args.screenshot_downscale:
+        arg_list.append('--screenshot-downscale')
+        arg_list.append('{}'.format(args.screenshot_downscale))
+
+    if args.screenshot_hash_only:
+        arg_list.append('--screenshot-hash-only')
+
     if args.sfa:
         arg_list.append('--sfa')
 
     if args.opcd:
         arg_list.append('--opcd')
 
+    if args.pipeline_cache:
+        arg_list.append('--pipeline-cache')
+        arg_list.append('{}'.format(args.pipeline_cache))
+
     if args.surface_index:
         arg_list.append('--surface-index')
         arg_list.append('{}'.format(args.surface_index))
 
+    if args.virtual_swapchain:
+        arg_list.append('--virtual-swapchain')
+
+    if args.present_mode:
+        arg_list.append('--present-mode')
+        arg_list.append('{}'.format(args.present_mode))
+
     if args.sync:
         arg_list.append('--sync')
 
+    if args.max_submits_in_flight:
+        arg_list.append('--max-submits-in-flight')
+        arg_list.append('{}'.format(args.max_submits_in_flight))
+
+    if args.max_frames_in_flight:
+        arg_list.append('--max-frames-in-flight')
+        arg_list.append('{}'.format(args.max_frames_in_flight))
+
+    if args.collapse_polling:
+        arg_list.append('--collapse-polling')
+
+    if args.batch_submits:
+        arg_list.append('--batch-submits')
+
+    if args.recycle_pools:
+        arg_list.append('--recycle-pools')
+
+    if args.pace_cpu_timestamps:
+        arg_list.append('--pace-cpu-timestamps')
+
+    if args.skip_redundant_descriptor_updates:
+        arg_list.append('--skip-redundant-descriptor-updates')
+
+    if args.reuse_command_buffers:
+        arg_list.append('--reuse-command-buffers')
+
+    if args.persistent_mapping:
+        arg_list.append('--persistent-mapping')
+
     if args.remove_unsupported:
         arg_list.append('--remove-unsupported')
 
+    if args.remap_device_addresses:
+        arg_list.append('--remap-device-addresses')
+
+    if args.accel_struct_cache:
+        arg_list.append('--accel-struct-cache')
+
+    if args.lazy_resource_init:
+        arg_list.append('--lazy-resource-init')
+
+    if args.mmap:
+        arg_list.append('--mmap')
+
+    if args.prefetch:
+        arg_list.append('--prefetch')
+
+    if args.preload:
+        arg_list.append('--preload')
+
+    if args.preload_frames:
+        arg_list.append('--preload-frames')
+        arg_list.append('{}'.format(args.preload_frames))
+
+    if args.preload_limit:
+        arg_list.append('--preload-limit')
+        arg_list.append('{}'.format(args.preload_limit))
+
+    if args.decompression_threads:
+        arg_list.append('--decompression-threads')
+        arg_list.append('{}'.format(args.decompression_threads))
+
+    if args.decode_thread:
+        arg_list.append('--decode-thread')
+
+    if args.replay_threads:
+        arg_list.append('--replay-threads')
+        arg_list.append('{}'.format(args.replay_threads))
+
+    if args.pipeline_threads:
+        arg_list.append('--pipeline-threads')
+        arg_list.append('{}'.format(args.pipeline_threads))
+
+    if args.pipeline_warm_up:
+        arg_list.append('--pipeline-warm-up')
+        arg_list.append('{}'.format(args.pipeline_warm_up))
+
     if args.memory_translation:
         arg_list.append('-m')
         arg_list.append('{}'.format(args.memory_translation))
 
+    if args.rebind_pool_algorithm:
+        arg_list.append('--rebind-pool-algorithm')
+        arg_list.append('{}'.format(args.rebind_pool_algorithm))
+
+    if args.rebind_block_size:
+        arg_list.append('--rebind-block-size')
+        arg_list.append('{}'.format(args.rebind_block_size))
+
+    if args.device_memory_budget:
+        arg_list.append('--device-memory-budget')
+        arg_list.append('{}'.format(args.device_memory_budget))
+
+    if args.no_analysis_cache:
+        arg_list.append('--no-analysis-cache')
+
     if args.file:
         arg_list.append(args.file)
     elif not args.version:
@@ -0,0 +1,69 @@
+###############################################################################
+# Copyright (c) 2021 LunarG, Inc.
+# All rights reserved
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+# Author: LunarG Team
+# Description: CMake performance regression test directives
+###############################################################################
+
+cmake_minimum_required(VERSION 3.4.1)
+
+set(PERF_TEST_TRACE_DIR "" CACHE PATH "Directory of capture files for the performance regression tests")
+set(PERF_TEST_BASELINE_DIR "" CACHE PATH "Directory of the performance baselines (default: PERF_TEST_TRACE_DIR)")
+set(PERF_TEST_TOLERANCE "10" CACHE STRING "Percentage by which a measurement may exceed its baseline")
+set(PERF_TEST_RUNS "1" CACHE STRING "Number of times that each capture file is measured")
+set(PERF_TEST_REPLAY_MODE "headless" CACHE STRING "Presentation mode of the performance regression test replays")
+set_property(CACHE PERF_TEST_REPLAY_MODE PROPERTY STRINGS headless virtual-swapchain)
+
+# Add a CTest test, labeled perf, that replays and benchmarks the capture files of PERF_TEST_TRACE_DIR and compares
+# the measurements with the stored baselines.  The test is only added when PERF_TEST_TRACE_DIR is set.
+#
+# This function uses target generator expressions, it must be called after the tool targets have been added.
+function(add_perf_tests)
+    if(("" STREQUAL "${PERF_TEST_TRACE_DIR}") OR (NOT TARGET gfxrecon-replay) OR (NOT TARGET gfxrecon-bench))
+        return()
+    endif()
+
+    if(CMAKE_HOST_WIN32)
+        find_program(PERF_TEST_PYTHON python.exe DOC "Python executable")
+    else()
+        find_program(PERF_TEST_PYTHON python3 DOC "Python executable")
+    endif()
+
+    set(PERF_TEST_BASELINES ${PERF_TEST_BASELINE_DIR})
+    if("" STREQUAL "${PERF_TEST_BASELINES}")
+        set(PERF_TEST_BASELINES ${PERF_TEST_TRACE_DIR})
+    endif()
+
+    enable_testing()
+    add_test(NAME gfxrecon_perf_test
+             COMMAND "${PERF_TEST_PYTHON}" ${GFXReconstruct_SOURCE_DIR}/scripts/perf_test.py
+                 --replay $<TARGET_FILE:gfxrecon-replay>
+                 --bench $<TARGET_FILE:gfxrecon-bench>
+                 --trace-dir ${PERF_TEST_TRACE_DIR}
+                 --baseline-dir ${PERF_TEST_BASELINES}
+                 --tolerance ${PERF_TEST_TOLERANCE}
+                 --runs ${PERF_TEST_RUNS}
+                 --replay-mode ${PERF_TEST_REPLAY_MODE}
+                 --summary ${CMAKE_BINARY_DIR}/perf_test_summary.json
+             WORKING_DIRECTORY ${CMAKE_BINARY_DIR})
+    set_tests_properties(gfxrecon_perf_test PROPERTIES LABELS perf TIMEOUT 0)
+endfunction()
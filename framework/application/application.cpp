@@ -23,16 +23,20 @@
 
 #include "application/application.h"
 
+#include "util/date_time.h"
 #include "util/logging.h"
 
 #include <algorithm>
 #include <cassert>
+#include <inttypes.h>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(application)
 
 Application::Application(const std::string& name) :
-    file_processor_(nullptr), running_(false), paused_(false), name_(name)
+    file_processor_(nullptr), running_(false), paused_(false), name_(name), pause_frame_(0), loop_first_frame_(0),
+    loop_last_frame_(0), loop_count_(0), loop_frames_(0), loop_offset_(0), loop_start_time_(0),
+    loop_use_program_(false), loop_program_(false)
 {}
 
 Application::~Application()
@@ -85,14 +89,50 @@ void Application::SetPaused(bool paused)
     }
 }
 
+void Application::SetFrameLoop(uint32_t                  first_frame,
+                               uint32_t                  last_frame,
+                               uint32_t                  loop_count,
+                               const FrameLoopCallbacks& callbacks)
+{
+    assert((first_frame > 0) && (first_frame <= last_frame));
+
+    loop_first_frame_ = first_frame;
+    loop_last_frame_  = last_frame;
+    loop_count_       = loop_count;
+    loop_callbacks_   = callbacks;
+    loop_frames_      = 0;
+    loop_offset_      = 0;
+    loop_program_     = false;
+    loop_times_.clear();
+}
+
 bool Application::PlaySingleFrame()
 {
     bool success = false;
 
     if (file_processor_)
     {
+        // The loop begins after the frame that precedes the looped frame range has been replayed.
+        if ((loop_count_ > 0) && (loop_offset_ == 0) &&
+            ((file_processor_->GetCurrentFrameNumber() + 1) == loop_first_frame_) && !BeginFrameLoop())
+        {
+            loop_count_ = 0;
+        }
+
         success = file_processor_->ProcessNextFrame();
 
+        if (success && (loop_count_ > 0) && (loop_offset_ != 0) &&
+            (++loop_frames_ > (loop_last_frame_ - loop_first_frame_)))
+        {
+            success = EndFrameLoopIteration();
+
+            if (!success)
+            {
+                running_ = false;
+                return success;
+            }
+        }
+
         if (success)
         {
             if (file_processor_->GetCurrentFrameNumber() == pause_frame_)
@@ -110,6 +150,12 @@ bool Application::PlaySingleFrame()
         }
         else
         {
+            if ((loop_count_ > 0) && (loop_offset_ != 0))
+            {
+                GFXRECON_LOG_WARNING("Replay ended before the last frame of the looped frame range");
+                LogFrameLoopTimes();
+            }
+
             running_ = false;
         }
     }
@@ -117,6 +163,129 @@ bool Application::PlaySingleFrame()
     return success;
 }
 
+bool Application::BeginFrameLoop()
+{
+    assert(file_processor_ != nullptr);
+
+    // A range that starts with the first frame begins after the state snapshot of a trimmed capture file, so that the
+    // snapshot is not replayed again by each repeat.
+    if ((loop_first_frame_ == 1) && !file_processor_->ProcessStateSnapshot())
+    {
+        GFXRECON_LOG_ERROR("Frame looping can only start at frame 1 for trimmed capture files with a seek index");
+        return false;
+    }
+
+    if (!loop_callbacks_.save_state || !loop_callbacks_.save_state())
+    {
+        GFXRECON_LOG_ERROR("Failed to save the replay state for frame looping; frames will not be looped");
+        return false;
+    }
+
+    GFXRECON_LOG_INFO("Looping frames %u-%u %u times", loop_first_frame_, loop_last_frame_, loop_count_);
+
+    loop_program_ = loop_use_program_ && file_processor_->BeginCallProgram();
+
+    if (loop_use_program_ && !loop_program_)
+    {
+        GFXRECON_LOG_WARNING("The looped frames will be decoded for each repeat");
+    }
+
+    loop_offset_     = file_processor_->GetNumBytesRead();
+    loop_frames_     = 0;
+    loop_start_time_ = util::datetime::GetTimestamp();
+
+    return true;
+}
+
+bool Application::EndFrameLoopIteration()
+{
+    assert(file_processor_ != nullptr);
+
+    // The program is recorded by the first replay of the range.
+    if (loop_program_)
+    {
+        file_processor_->EndCallProgram();
+    }
+
+    // Include the GPU work that was submitted by the looped frames in the iteration time.
+    if (loop_callbacks_.wait_idle)
+    {
+        loop_callbacks_.wait_idle();
+    }
+
+    int64_t loop_time = util::datetime::DiffTimestamps(loop_start_time_, util::datetime::GetTimestamp());
+    double  seconds   = util::datetime::ConvertTimestampToSeconds(loop_time);
+    double  fps       = (seconds > 0.0) ? (static_cast<double>(loop_frames_) / seconds) : 0.0;
+
+    loop_times_.push_back(loop_time);
+
+    GFXRECON_WRITE_CONSOLE("Loop %" PRIu64 ": %f fps, %f seconds, %u frames",
+                           static_cast<uint64_t>(loop_times_.size()),
+                           fps,
+                           seconds,
+                           loop_frames_);
+
+    if (loop_times_.size() >= loop_count_)
+    {
+        LogFrameLoopTimes();
+
+        if (loop_program_)
+        {
+            file_processor_->ReleaseCallProgram();
+        }
+
+        return false;
+    }
+
+    if (!loop_callbacks_.restore_state || !loop_callbacks_.restore_state())
+    {
+        GFXRECON_LOG_ERROR("Failed to restore the replay state for frame looping");
+        return false;
+    }
+
+    bool restarted =
+        loop_program_ ? file_processor_->ReplayCallProgram() : file_processor_->SeekToOffset(loop_offset_);
+
+    if (!restarted)
+    {
+        GFXRECON_LOG_ERROR("Failed to return to the start of the looped frame range");
+        return false;
+    }
+
+    loop_frames_     = 0;
+    loop_start_time_ = util::datetime::GetTimestamp();
+
+    return true;
+}
+
+void Application::LogFrameLoopTimes() const
+{
+    if (loop_times_.empty())
+    {
+        return;
+    }
+
+    std::vector<int64_t> sorted_times(loop_times_);
+    std::sort(sorted_times.begin(), sorted_times.end());
+
+    int64_t total_time = 0;
+    for (int64_t loop_time : sorted_times)
+    {
+        total_time += loop_time;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Frame loop summary for frames %u-%u, %" PRIu64 " loops:",
+                           loop_first_frame_,
+                           loop_last_frame_,
+                           static_cast<uint64_t>(sorted_times.size()));
+    GFXRECON_WRITE_CONSOLE("  Min:    %f seconds", util::datetime::ConvertTimestampToSeconds(sorted_times.front()));
+    GFXRECON_WRITE_CONSOLE("  Median: %f seconds",
+                           util::datetime::ConvertTimestampToSeconds(sorted_times[sorted_times.size() / 2]));
+    GFXRECON_WRITE_CONSOLE("  Mean:   %f seconds",
+                           util::datetime::ConvertTimestampToSeconds(total_time) / sorted_times.size());
+    GFXRECON_WRITE_CONSOLE("  Max:    %f seconds", util::datetime::ConvertTimestampToSeconds(sorted_times.back()));
+}
+
 bool Application::RegisterWindow(decode::Window* window)
 {
     assert(window != nullptr);
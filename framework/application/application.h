@@ -28,6 +28,7 @@
 #include "decode/window.h"
 #include "util/defines.h"
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -36,6 +37,15 @@ GFXRECON_BEGIN_NAMESPACE(application)
 
 class Application
 {
+  public:
+    // Callbacks that save and restore the replay state for repeats of a looped frame range.
+    struct FrameLoopCallbacks
+    {
+        std::function<bool()> save_state;
+        std::function<bool()> restore_state;
+        std::function<void()> wait_idle;
+    };
+
   public:
     Application(const std::string& name);
 
@@ -55,6 +65,18 @@ class Application
 
     void SetPauseFrame(uint32_t pause_frame) { pause_frame_ = pause_frame; }
 
+    // Replays frames first_frame through last_frame loop_count times, restoring the state that was saved before the
+    // first replay of the range before each repeat, and then stops replay.
+    void SetFrameLoop(uint32_t                  first_frame,
+                      uint32_t                  last_frame,
+                      uint32_t                  loop_count,
+                      const FrameLoopCallbacks& callbacks);
+
+    // When enabled, the first replay of the looped frame range records its decoded calls into a call program, which
+    // replays the following repeats without reading and decoding the range from the file again.  Falls back to decoding
+    // each repeat when the FileProcessor cannot record the program.
+    void SetFrameLoopProgram(bool use_program) { loop_use_program_ = use_program; }
+
     bool PlaySingleFrame();
 
     bool RegisterWindow(decode::Window* window);
@@ -63,10 +85,18 @@ class Application
 
     virtual void ProcessEvents(bool wait_for_input) = 0;
 
+    // Replaces the FileProcessor that frames are replayed from, for replaying another capture file.
+    void SetFileProcessor(decode::FileProcessor* file_processor);
+
   protected:
     void StopRunning() { running_ = false; }
 
-    void SetFileProcessor(decode::FileProcessor* file_processor);
+  private:
+    bool BeginFrameLoop();
+
+    bool EndFrameLoopIteration();
+
+    void LogFrameLoopTimes() const;
 
   private:
     // clang-format off
@@ -80,6 +110,19 @@ class Application
                                                     ///< system events.
     std::string                  name_;             ///< Application name to display in window title bar.
     uint32_t                     pause_frame_;      ///< The number for a frame that replay should pause after.
+    uint32_t                     loop_first_frame_; ///< First frame of the looped frame range.
+    uint32_t                     loop_last_frame_;  ///< Last frame of the looped frame range.
+    uint32_t                     loop_count_;       ///< Number of times to replay the looped frame range.  Looping is
+                                                    ///< disabled when zero.
+    uint32_t                     loop_frames_;      ///< Number of frames replayed by the current repeat of the range.
+    uint64_t                     loop_offset_;      ///< File offset of the first block of the looped frame range,
+                                                    ///< which is zero until the loop has begun.
+    int64_t                      loop_start_time_;  ///< Start time of the current repeat of the range.
+    std::vector<int64_t>         loop_times_;       ///< Duration of each completed repeat of the range.
+    FrameLoopCallbacks           loop_callbacks_;   ///< Callbacks that save and restore the looped replay state.
+    bool                         loop_use_program_; ///< Repeats of the range are replayed from a call program.
+    bool                         loop_program_;     ///< The call program of the current loop is being recorded
+                                                    ///< or replayed.
     // clang-format on
 };
 
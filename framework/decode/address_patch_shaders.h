@@ -0,0 +1,898 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_ADDRESS_PATCH_SHADERS_H
+#define GFXRECON_DECODE_VULKAN_ADDRESS_PATCH_SHADERS_H
+
+// Original HLSL shader source.
+#if 0
+// Remaps the 64-bit addresses stored at a fixed stride in a buffer from the capture address ranges of a range table to
+// the replay address ranges.  Each range is stored as six words, with the capture begin, capture end, and replay begin
+// addresses as pairs of low and high words.  The ranges are sorted by capture begin address.
+
+struct PatchConstants
+{
+    uint first_word;
+    uint word_stride;
+    uint address_count;
+    uint range_count;
+};
+
+[[vk::push_constant]] PatchConstants constants;
+
+[[vk::binding(0)]] RWByteAddressBuffer addresses;
+[[vk::binding(1)]] RWByteAddressBuffer ranges;
+
+bool Less(uint2 a, uint2 b)
+{
+    return (a.y < b.y) || ((a.y == b.y) && (a.x < b.x));
+}
+
+[numthreads(64, 1, 1)]
+void CSMain(uint3 id : SV_DispatchThreadID)
+{
+    if (id.x < constants.address_count)
+    {
+        uint  word    = constants.first_word + (id.x * constants.word_stride);
+        uint2 address = addresses.Load2(word * 4);
+        uint  first   = 0;
+        uint  last    = constants.range_count;
+
+        // Find the first range that begins after the address.
+        while (first < last)
+        {
+            uint middle = (first + last) >> 1;
+
+            if (Less(address, ranges.Load2(middle * 24)))
+            {
+                last = middle;
+            }
+            else
+            {
+                first = middle + 1;
+            }
+        }
+
+        if (first > 0)
+        {
+            uint  range  = (first - 1) * 24;
+            uint2 begin  = ranges.Load2(range);
+            uint2 end    = ranges.Load2(range + 8);
+            uint2 replay = ranges.Load2(range + 16);
+
+            if (Less(address, end))
+            {
+                // replay + (address - begin), with the borrow and carry of the low words.
+                uint2 offset = uint2(address.x - begin.x, address.y - begin.y - ((address.x < begin.x) ? 1 : 0));
+                uint  low    = replay.x + offset.x;
+                addresses.Store2(word * 4, uint2(low, replay.y + offset.y + ((low < replay.x) ? 1 : 0)));
+            }
+        }
+    }
+}
+#endif
+
+// Build commands.
+#if 0
+; Command: spirv-as --target-env vulkan1.0 -o address_patch_shaders.spv address_patch_shaders.spvasm
+#endif
+
+// Shader code.
+#if 0
+; SPIR-V
+; Version: 1.0
+; Generator: Khronos SPIR-V Tools Assembler; 0
+; Bound: 114
+; Schema: 0
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %CSMain "CSMain" %gl_GlobalInvocationID
+               OpExecutionMode %CSMain LocalSize 64 1 1
+               OpSource HLSL 600
+               OpName %type_PushConstant_PatchConstants "type.PushConstant.PatchConstants"
+               OpMemberName %type_PushConstant_PatchConstants 0 "first_word"
+               OpMemberName %type_PushConstant_PatchConstants 1 "word_stride"
+               OpMemberName %type_PushConstant_PatchConstants 2 "address_count"
+               OpMemberName %type_PushConstant_PatchConstants 3 "range_count"
+               OpName %constants "constants"
+               OpName %type_RWByteAddressBuffer "type.RWByteAddressBuffer"
+               OpName %addresses "addresses"
+               OpName %ranges "ranges"
+               OpName %CSMain "CSMain"
+               OpDecorate %gl_GlobalInvocationID BuiltIn GlobalInvocationId
+               OpDecorate %addresses DescriptorSet 0
+               OpDecorate %addresses Binding 0
+               OpDecorate %ranges DescriptorSet 0
+               OpDecorate %ranges Binding 1
+               OpMemberDecorate %type_PushConstant_PatchConstants 0 Offset 0
+               OpMemberDecorate %type_PushConstant_PatchConstants 1 Offset 4
+               OpMemberDecorate %type_PushConstant_PatchConstants 2 Offset 8
+               OpMemberDecorate %type_PushConstant_PatchConstants 3 Offset 12
+               OpDecorate %type_PushConstant_PatchConstants Block
+               OpDecorate %_runtimearr_uint ArrayStride 4
+               OpMemberDecorate %type_RWByteAddressBuffer 0 Offset 0
+               OpDecorate %type_RWByteAddressBuffer BufferBlock
+       %uint = OpTypeInt 32 0
+     %uint_0 = OpConstant %uint 0
+     %uint_1 = OpConstant %uint 1
+     %uint_2 = OpConstant %uint 2
+     %uint_3 = OpConstant %uint 3
+     %uint_4 = OpConstant %uint 4
+     %uint_5 = OpConstant %uint 5
+     %uint_6 = OpConstant %uint 6
+        %int = OpTypeInt 32 1
+      %int_0 = OpConstant %int 0
+      %int_1 = OpConstant %int 1
+      %int_2 = OpConstant %int 2
+      %int_3 = OpConstant %int 3
+%type_PushConstant_PatchConstants = OpTypeStruct %uint %uint %uint %uint
+%_ptr_PushConstant_type_PushConstant_PatchConstants = OpTypePointer PushConstant %type_PushConstant_PatchConstants
+%_runtimearr_uint = OpTypeRuntimeArray %uint
+%type_RWByteAddressBuffer = OpTypeStruct %_runtimearr_uint
+%_ptr_Uniform_type_RWByteAddressBuffer = OpTypePointer Uniform %type_RWByteAddressBuffer
+     %v3uint = OpTypeVector %uint 3
+%_ptr_Input_v3uint = OpTypePointer Input %v3uint
+       %void = OpTypeVoid
+  %void_func = OpTypeFunction %void
+%_ptr_PushConstant_uint = OpTypePointer PushConstant %uint
+       %bool = OpTypeBool
+%_ptr_Uniform_uint = OpTypePointer Uniform %uint
+  %constants = OpVariable %_ptr_PushConstant_type_PushConstant_PatchConstants PushConstant
+  %addresses = OpVariable %_ptr_Uniform_type_RWByteAddressBuffer Uniform
+     %ranges = OpVariable %_ptr_Uniform_type_RWByteAddressBuffer Uniform
+%gl_GlobalInvocationID = OpVariable %_ptr_Input_v3uint Input
+     %CSMain = OpFunction %void None %void_func
+      %entry = OpLabel
+%invocation_id = OpLoad %v3uint %gl_GlobalInvocationID
+      %index = OpCompositeExtract %uint %invocation_id 0
+%address_count_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_2
+%address_count = OpLoad %uint %address_count_ptr
+   %in_range = OpULessThan %bool %index %address_count
+               OpSelectionMerge %exit None
+               OpBranchConditional %in_range %load_address %exit
+%load_address = OpLabel
+%first_word_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_0
+ %first_word = OpLoad %uint %first_word_ptr
+%word_stride_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_1
+%word_stride = OpLoad %uint %word_stride_ptr
+%range_count_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_3
+%range_count = OpLoad %uint %range_count_ptr
+%index_words = OpIMul %uint %index %word_stride
+    %lo_word = OpIAdd %uint %first_word %index_words
+    %hi_word = OpIAdd %uint %lo_word %uint_1
+ %address_lo_ptr = OpAccessChain %_ptr_Uniform_uint %addresses %int_0 %lo_word
+ %address_lo = OpLoad %uint %address_lo_ptr
+ %address_hi_ptr = OpAccessChain %_ptr_Uniform_uint %addresses %int_0 %hi_word
+ %address_hi = OpLoad %uint %address_hi_ptr
+               OpBranch %search_header
+%search_header = OpLabel
+      %first = OpPhi %uint %uint_0 %load_address %next_first %search_continue
+       %last = OpPhi %uint %range_count %load_address %next_last %search_continue
+  %searching = OpULessThan %bool %first %last
+               OpLoopMerge %search_merge %search_continue None
+               OpBranchConditional %searching %search_body %search_merge
+%search_body = OpLabel
+  %first_last = OpIAdd %uint %first %last
+     %middle = OpShiftRightLogical %uint %first_last %uint_1
+%middle_word = OpIMul %uint %middle %uint_6
+%middle_word_hi = OpIAdd %uint %middle_word %uint_1
+%middle_lo_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %middle_word
+  %middle_lo = OpLoad %uint %middle_lo_ptr
+%middle_hi_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %middle_word_hi
+  %middle_hi = OpLoad %uint %middle_hi_ptr
+%below_hi = OpULessThan %bool %address_hi %middle_hi
+%equal_hi = OpIEqual %bool %address_hi %middle_hi
+%below_lo = OpULessThan %bool %address_lo %middle_lo
+%below_equal_hi = OpLogicalAnd %bool %equal_hi %below_lo
+   %below = OpLogicalOr %bool %below_hi %below_equal_hi
+%middle_next = OpIAdd %uint %middle %uint_1
+ %next_first = OpSelect %uint %below %first %middle_next
+  %next_last = OpSelect %uint %below %middle %last
+               OpBranch %search_continue
+%search_continue = OpLabel
+               OpBranch %search_header
+%search_merge = OpLabel
+  %found_any = OpINotEqual %bool %first %uint_0
+ %first_prev = OpISub %uint %first %uint_1
+  %candidate = OpSelect %uint %found_any %first_prev %uint_0
+%candidate_word = OpIMul %uint %candidate %uint_6
+%end_lo_word = OpIAdd %uint %candidate_word %uint_2
+%end_hi_word = OpIAdd %uint %candidate_word %uint_3
+ %end_lo_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %end_lo_word
+     %end_lo = OpLoad %uint %end_lo_ptr
+ %end_hi_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %end_hi_word
+     %end_hi = OpLoad %uint %end_hi_ptr
+%end_below_hi = OpULessThan %bool %address_hi %end_hi
+%end_equal_hi = OpIEqual %bool %address_hi %end_hi
+%end_below_lo = OpULessThan %bool %address_lo %end_lo
+%end_below_equal_hi = OpLogicalAnd %bool %end_equal_hi %end_below_lo
+  %below_end = OpLogicalOr %bool %end_below_hi %end_below_equal_hi
+   %contains = OpLogicalAnd %bool %found_any %below_end
+               OpSelectionMerge %patch_merge None
+               OpBranchConditional %contains %patch %patch_merge
+      %patch = OpLabel
+%begin_hi_word = OpIAdd %uint %candidate_word %uint_1
+%replay_lo_word = OpIAdd %uint %candidate_word %uint_4
+%replay_hi_word = OpIAdd %uint %candidate_word %uint_5
+%begin_lo_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %candidate_word
+   %begin_lo = OpLoad %uint %begin_lo_ptr
+%begin_hi_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %begin_hi_word
+   %begin_hi = OpLoad %uint %begin_hi_ptr
+%replay_lo_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %replay_lo_word
+  %replay_lo = OpLoad %uint %replay_lo_ptr
+%replay_hi_ptr = OpAccessChain %_ptr_Uniform_uint %ranges %int_0 %replay_hi_word
+  %replay_hi = OpLoad %uint %replay_hi_ptr
+   %offset_lo = OpISub %uint %address_lo %begin_lo
+      %borrow = OpULessThan %bool %address_lo %begin_lo
+ %borrow_word = OpSelect %uint %borrow %uint_1 %uint_0
+  %offset_hi_0 = OpISub %uint %address_hi %begin_hi
+   %offset_hi = OpISub %uint %offset_hi_0 %borrow_word
+   %patched_lo = OpIAdd %uint %replay_lo %offset_lo
+       %carry = OpULessThan %bool %patched_lo %replay_lo
+  %carry_word = OpSelect %uint %carry %uint_1 %uint_0
+%patched_hi_0 = OpIAdd %uint %replay_hi %offset_hi
+  %patched_hi = OpIAdd %uint %patched_hi_0 %carry_word
+               OpStore %address_lo_ptr %patched_lo
+               OpStore %address_hi_ptr %patched_hi
+               OpBranch %patch_merge
+%patch_merge = OpLabel
+               OpBranch %exit
+       %exit = OpLabel
+               OpReturn
+               OpFunctionEnd
+#endif
+
+const unsigned char g_CSMain[] = {
+    0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x43, 0x53, 0x4d, 0x61, 0x69,
+    0x6e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x58, 0x02, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x50,
+    0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x2e, 0x50, 0x61, 0x74, 0x63, 0x68, 0x43, 0x6f,
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x00, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x64,
+    0x65, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x72, 0x65,
+    0x73, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x09, 0x00, 0x05, 0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x52, 0x57, 0x42, 0x79, 0x74, 0x65, 0x41, 0x64,
+    0x64, 0x72, 0x65, 0x73, 0x73, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x43, 0x53, 0x4d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00,
+    0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00,
+    0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
+    0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0d, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x2b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02,
+    0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x3d,
+    0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05,
+    0x00, 0x1c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3d, 0x00,
+    0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+    0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x26, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x1c, 0x00,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x2b, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2c,
+    0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x3d, 0x00,
+    0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x34,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+    0x00, 0xf5, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x26, 0x00,
+    0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3a,
+    0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x00, 0x00,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+    0x00, 0x3b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x41, 0x00,
+    0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3f,
+    0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00,
+    0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+    0x44, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+    0x00, 0x42, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x46, 0x00,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+    0x3e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+    0x00, 0x49, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf9,
+    0x00, 0x02, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00,
+    0x00, 0x4b, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x84, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00,
+    0x00, 0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x54,
+    0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+    0x33, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00,
+    0x00, 0x33, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x57, 0x00,
+    0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x58,
+    0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00,
+    0x59, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00,
+    0x00, 0x5a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x5b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5b,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x5d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x5e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x1e,
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+    0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06,
+    0x00, 0x1e, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x5d, 0x00,
+    0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x5e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+    0x61, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+    0x00, 0x61, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x69, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x6b,
+    0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x6d, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00,
+    0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x6f, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+    0x5b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x25, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+
+// Original HLSL shader source.
+#if 0
+// Replaces the shader group handles stored at a fixed stride in a buffer, such as the records of a shader binding
+// table, with the replay handles of a hash table.  Each table slot is stored as a word that is nonzero for used slots,
+// followed by the words of the capture and replay handles.  Handles are found by linear probing from the slot selected
+// by the FNV-1a hash of their words, and the table always has unused slots.  Handles that are not in the table are
+// left unchanged.
+
+struct HandlePatchConstants
+{
+    uint first_word;
+    uint word_stride;
+    uint record_count;
+    uint slot_mask;
+    uint handle_words;
+};
+
+[[vk::push_constant]] HandlePatchConstants constants;
+
+[[vk::binding(0)]] RWByteAddressBuffer records;
+[[vk::binding(1)]] RWByteAddressBuffer table;
+
+[numthreads(64, 1, 1)]
+void PatchHandles(uint3 id : SV_DispatchThreadID)
+{
+    if (id.x < constants.record_count)
+    {
+        uint word = constants.first_word + (id.x * constants.word_stride);
+        uint hash = 2166136261;
+
+        for (uint i = 0; i < constants.handle_words; ++i)
+        {
+            hash = (hash ^ records.Load((word + i) * 4)) * 16777619;
+        }
+
+        uint slot_words = (constants.handle_words * 2) + 1;
+        uint slot       = hash & constants.slot_mask;
+        bool searching  = true;
+
+        while (searching)
+        {
+            uint base = slot * slot_words;
+
+            if (table.Load(base * 4) == 0)
+            {
+                searching = false;
+            }
+            else
+            {
+                bool match = true;
+
+                for (uint j = 0; match && (j < constants.handle_words); ++j)
+                {
+                    match = (table.Load((base + 1 + j) * 4) == records.Load((word + j) * 4));
+                }
+
+                if (match)
+                {
+                    for (uint k = 0; k < constants.handle_words; ++k)
+                    {
+                        records.Store((word + k) * 4, table.Load((base + 1 + constants.handle_words + k) * 4));
+                    }
+
+                    searching = false;
+                }
+                else
+                {
+                    slot = (slot + 1) & constants.slot_mask;
+                }
+            }
+        }
+    }
+}
+#endif
+
+// Build commands.
+#if 0
+; Command: spirv-as --target-env vulkan1.0 -o address_patch_handles.spv address_patch_handles.spvasm
+#endif
+
+// Shader code.
+#if 0
+; SPIR-V
+; Version: 1.0
+; Generator: Khronos SPIR-V Tools Assembler; 0
+; Bound: 132
+; Schema: 0
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %PatchHandles "PatchHandles" %gl_GlobalInvocationID
+               OpExecutionMode %PatchHandles LocalSize 64 1 1
+               OpSource HLSL 600
+               OpName %type_PushConstant_HandlePatchConstants "type.PushConstant.HandlePatchConstants"
+               OpMemberName %type_PushConstant_HandlePatchConstants 0 "first_word"
+               OpMemberName %type_PushConstant_HandlePatchConstants 1 "word_stride"
+               OpMemberName %type_PushConstant_HandlePatchConstants 2 "record_count"
+               OpMemberName %type_PushConstant_HandlePatchConstants 3 "slot_mask"
+               OpMemberName %type_PushConstant_HandlePatchConstants 4 "handle_words"
+               OpName %constants "constants"
+               OpName %type_RWByteAddressBuffer "type.RWByteAddressBuffer"
+               OpName %records "records"
+               OpName %table "table"
+               OpName %PatchHandles "PatchHandles"
+               OpName %hash "hash"
+               OpName %i "i"
+               OpName %slot "slot"
+               OpName %searching "searching"
+               OpName %match "match"
+               OpName %j "j"
+               OpName %k "k"
+               OpDecorate %gl_GlobalInvocationID BuiltIn GlobalInvocationId
+               OpDecorate %records DescriptorSet 0
+               OpDecorate %records Binding 0
+               OpDecorate %table DescriptorSet 0
+               OpDecorate %table Binding 1
+               OpMemberDecorate %type_PushConstant_HandlePatchConstants 0 Offset 0
+               OpMemberDecorate %type_PushConstant_HandlePatchConstants 1 Offset 4
+               OpMemberDecorate %type_PushConstant_HandlePatchConstants 2 Offset 8
+               OpMemberDecorate %type_PushConstant_HandlePatchConstants 3 Offset 12
+               OpMemberDecorate %type_PushConstant_HandlePatchConstants 4 Offset 16
+               OpDecorate %type_PushConstant_HandlePatchConstants Block
+               OpDecorate %_runtimearr_uint ArrayStride 4
+               OpMemberDecorate %type_RWByteAddressBuffer 0 Offset 0
+               OpDecorate %type_RWByteAddressBuffer BufferBlock
+       %uint = OpTypeInt 32 0
+     %uint_0 = OpConstant %uint 0
+     %uint_1 = OpConstant %uint 1
+     %uint_2 = OpConstant %uint 2
+%uint_2166136261 = OpConstant %uint 2166136261
+%uint_16777619 = OpConstant %uint 16777619
+        %int = OpTypeInt 32 1
+      %int_0 = OpConstant %int 0
+      %int_1 = OpConstant %int 1
+      %int_2 = OpConstant %int 2
+      %int_3 = OpConstant %int 3
+      %int_4 = OpConstant %int 4
+       %bool = OpTypeBool
+       %true = OpConstantTrue %bool
+      %false = OpConstantFalse %bool
+%type_PushConstant_HandlePatchConstants = OpTypeStruct %uint %uint %uint %uint %uint
+%_ptr_PushConstant_type_PushConstant_HandlePatchConstants = OpTypePointer PushConstant %type_PushConstant_HandlePatchConstants
+%_runtimearr_uint = OpTypeRuntimeArray %uint
+%type_RWByteAddressBuffer = OpTypeStruct %_runtimearr_uint
+%_ptr_Uniform_type_RWByteAddressBuffer = OpTypePointer Uniform %type_RWByteAddressBuffer
+     %v3uint = OpTypeVector %uint 3
+%_ptr_Input_v3uint = OpTypePointer Input %v3uint
+       %void = OpTypeVoid
+  %void_func = OpTypeFunction %void
+%_ptr_PushConstant_uint = OpTypePointer PushConstant %uint
+%_ptr_Uniform_uint = OpTypePointer Uniform %uint
+%_ptr_Function_uint = OpTypePointer Function %uint
+%_ptr_Function_bool = OpTypePointer Function %bool
+  %constants = OpVariable %_ptr_PushConstant_type_PushConstant_HandlePatchConstants PushConstant
+    %records = OpVariable %_ptr_Uniform_type_RWByteAddressBuffer Uniform
+      %table = OpVariable %_ptr_Uniform_type_RWByteAddressBuffer Uniform
+%gl_GlobalInvocationID = OpVariable %_ptr_Input_v3uint Input
+%PatchHandles = OpFunction %void None %void_func
+      %entry = OpLabel
+       %hash = OpVariable %_ptr_Function_uint Function
+          %i = OpVariable %_ptr_Function_uint Function
+       %slot = OpVariable %_ptr_Function_uint Function
+  %searching = OpVariable %_ptr_Function_bool Function
+      %match = OpVariable %_ptr_Function_bool Function
+          %j = OpVariable %_ptr_Function_uint Function
+          %k = OpVariable %_ptr_Function_uint Function
+%invocation_id = OpLoad %v3uint %gl_GlobalInvocationID
+      %index = OpCompositeExtract %uint %invocation_id 0
+%record_count_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_2
+%record_count = OpLoad %uint %record_count_ptr
+   %in_range = OpULessThan %bool %index %record_count
+               OpSelectionMerge %exit None
+               OpBranchConditional %in_range %load_record %exit
+%load_record = OpLabel
+%first_word_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_0
+ %first_word = OpLoad %uint %first_word_ptr
+%word_stride_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_1
+%word_stride = OpLoad %uint %word_stride_ptr
+%slot_mask_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_3
+  %slot_mask = OpLoad %uint %slot_mask_ptr
+%handle_words_ptr = OpAccessChain %_ptr_PushConstant_uint %constants %int_4
+%handle_words = OpLoad %uint %handle_words_ptr
+%index_words = OpIMul %uint %index %word_stride
+       %word = OpIAdd %uint %first_word %index_words
+               OpStore %hash %uint_2166136261
+               OpStore %i %uint_0
+               OpBranch %hash_header
+%hash_header = OpLabel
+   %i_header = OpLoad %uint %i
+    %hashing = OpULessThan %bool %i_header %handle_words
+               OpLoopMerge %hash_merge %hash_continue None
+               OpBranchConditional %hashing %hash_body %hash_merge
+  %hash_body = OpLabel
+     %i_body = OpLoad %uint %i
+%hash_record_word = OpIAdd %uint %word %i_body
+%hash_record_ptr = OpAccessChain %_ptr_Uniform_uint %records %int_0 %hash_record_word
+%hash_record = OpLoad %uint %hash_record_ptr
+  %hash_prev = OpLoad %uint %hash
+ %hash_mixed = OpBitwiseXor %uint %hash_prev %hash_record
+  %hash_next = OpIMul %uint %hash_mixed %uint_16777619
+               OpStore %hash %hash_next
+               OpBranch %hash_continue
+%hash_continue = OpLabel
+ %i_continue = OpLoad %uint %i
+     %i_next = OpIAdd %uint %i_continue %uint_1
+               OpStore %i %i_next
+               OpBranch %hash_header
+ %hash_merge = OpLabel
+%handle_words_2 = OpIMul %uint %handle_words %uint_2
+ %slot_words = OpIAdd %uint %handle_words_2 %uint_1
+ %hash_final = OpLoad %uint %hash
+ %first_slot = OpBitwiseAnd %uint %hash_final %slot_mask
+               OpStore %slot %first_slot
+               OpStore %searching %true
+               OpBranch %probe_header
+%probe_header = OpLabel
+%searching_header = OpLoad %bool %searching
+               OpLoopMerge %probe_merge %probe_continue None
+               OpBranchConditional %searching_header %probe_body %probe_merge
+ %probe_body = OpLabel
+ %slot_probe = OpLoad %uint %slot
+       %base = OpIMul %uint %slot_probe %slot_words
+   %used_ptr = OpAccessChain %_ptr_Uniform_uint %table %int_0 %base
+       %used = OpLoad %uint %used_ptr
+     %unused = OpIEqual %bool %used %uint_0
+%handle_base = OpIAdd %uint %base %uint_1
+%replay_base = OpIAdd %uint %handle_base %handle_words
+               OpSelectionMerge %probe_body_merge None
+               OpBranchConditional %unused %probe_stop %compare_start
+ %probe_stop = OpLabel
+               OpStore %searching %false
+               OpBranch %probe_body_merge
+%compare_start = OpLabel
+               OpStore %match %true
+               OpStore %j %uint_0
+               OpBranch %compare_header
+%compare_header = OpLabel
+%match_header = OpLoad %bool %match
+   %j_header = OpLoad %uint %j
+  %j_in_range = OpULessThan %bool %j_header %handle_words
+  %comparing = OpLogicalAnd %bool %match_header %j_in_range
+               OpLoopMerge %compare_merge %compare_continue None
+               OpBranchConditional %comparing %compare_body %compare_merge
+%compare_body = OpLabel
+     %j_body = OpLoad %uint %j
+%table_handle_word = OpIAdd %uint %handle_base %j_body
+%table_handle_ptr = OpAccessChain %_ptr_Uniform_uint %table %int_0 %table_handle_word
+%table_handle = OpLoad %uint %table_handle_ptr
+%record_handle_word = OpIAdd %uint %word %j_body
+%record_handle_ptr = OpAccessChain %_ptr_Uniform_uint %records %int_0 %record_handle_word
+%record_handle = OpLoad %uint %record_handle_ptr
+ %word_match = OpIEqual %bool %table_handle %record_handle
+               OpStore %match %word_match
+               OpBranch %compare_continue
+%compare_continue = OpLabel
+ %j_continue = OpLoad %uint %j
+     %j_next = OpIAdd %uint %j_continue %uint_1
+               OpStore %j %j_next
+               OpBranch %compare_header
+%compare_merge = OpLabel
+%match_final = OpLoad %bool %match
+               OpSelectionMerge %found_merge None
+               OpBranchConditional %match_final %copy_start %next_slot
+ %copy_start = OpLabel
+               OpStore %k %uint_0
+               OpBranch %copy_header
+%copy_header = OpLabel
+   %k_header = OpLoad %uint %k
+    %copying = OpULessThan %bool %k_header %handle_words
+               OpLoopMerge %copy_merge %copy_continue None
+               OpBranchConditional %copying %copy_body %copy_merge
+  %copy_body = OpLabel
+     %k_body = OpLoad %uint %k
+%table_replay_word = OpIAdd %uint %replay_base %k_body
+%table_replay_ptr = OpAccessChain %_ptr_Uniform_uint %table %int_0 %table_replay_word
+%table_replay = OpLoad %uint %table_replay_ptr
+%record_replay_word = OpIAdd %uint %word %k_body
+%record_replay_ptr = OpAccessChain %_ptr_Uniform_uint %records %int_0 %record_replay_word
+               OpStore %record_replay_ptr %table_replay
+               OpBranch %copy_continue
+%copy_continue = OpLabel
+ %k_continue = OpLoad %uint %k
+     %k_next = OpIAdd %uint %k_continue %uint_1
+               OpStore %k %k_next
+               OpBranch %copy_header
+ %copy_merge = OpLabel
+               OpStore %searching %false
+               OpBranch %found_merge
+  %next_slot = OpLabel
+  %slot_prev = OpLoad %uint %slot
+%slot_incremented = OpIAdd %uint %slot_prev %uint_1
+  %slot_next = OpBitwiseAnd %uint %slot_incremented %slot_mask
+               OpStore %slot %slot_next
+               OpBranch %found_merge
+%found_merge = OpLabel
+               OpBranch %probe_body_merge
+%probe_body_merge = OpLabel
+               OpBranch %probe_continue
+%probe_continue = OpLabel
+               OpBranch %probe_header
+%probe_merge = OpLabel
+               OpBranch %exit
+       %exit = OpLabel
+               OpReturn
+               OpFunctionEnd
+#endif
+
+const unsigned char g_PatchHandles[] = {
+    0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x61, 0x74, 0x63, 0x68,
+    0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x50, 0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+    0x2e, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x50, 0x61, 0x74, 0x63, 0x68, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x73, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x6c, 0x6f,
+    0x74, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x09, 0x00, 0x05, 0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x52, 0x57, 0x42, 0x79, 0x74, 0x65,
+    0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x73, 0x00, 0x05, 0x00, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x50, 0x61, 0x74, 0x63, 0x68, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x68, 0x61, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x6c, 0x6f, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6e,
+    0x67, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0e, 0x00,
+    0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc5,
+    0x9d, 0x1c, 0x81, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x93, 0x01, 0x00, 0x01,
+    0x15, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00,
+    0x00, 0x00, 0x2a, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x07, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x1d, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x24, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+    0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x29, 0x00,
+    0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+    0x27, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x3d, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00,
+    0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3d,
+    0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03,
+    0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x33, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x35,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x36, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x2b,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x00, 0x3e, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x3b, 0x00,
+    0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3c,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+    0x3c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3e, 0x00,
+    0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+    0x3a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+    0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x47, 0x00,
+    0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3d,
+    0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xf8, 0x00,
+    0x02, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x38,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+    0x4a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4c, 0x00,
+    0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x3e,
+    0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4e, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x02, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf8,
+    0x00, 0x02, 0x00, 0x52, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x4b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x56,
+    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x56, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x00, 0x54, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x59, 0x00,
+    0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x57, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0xf9, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x3e, 0x00,
+    0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1c, 0x00,
+    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+    0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x61, 0x00, 0x00,
+    0x00, 0x64, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00, 0x3d, 0x00,
+    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+    0x26, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x69, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00,
+    0x00, 0xaa, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x6b, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x63,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x6d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
+    0x00, 0x6d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x6e, 0x00,
+    0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x62, 0x00, 0x00, 0x00, 0x3d,
+    0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00,
+    0x00, 0x72, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x71, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0e, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x73, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x73,
+    0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0xb0, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0xf6, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00,
+    0x04, 0x00, 0x75, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x78,
+    0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00,
+    0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7b,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+    0x79, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x7c, 0x00,
+    0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x77, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x77, 0x00, 0x00, 0x00, 0x3d,
+    0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x73, 0x00, 0x00, 0x00, 0xf8, 0x00,
+    0x02, 0x00, 0x76, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xf9,
+    0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x72, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x00,
+    0x00, 0xf9, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf9, 0x00,
+    0x02, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x2f,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+
+#endif // GFXRECON_DECODE_VULKAN_ADDRESS_PATCH_SHADERS_H
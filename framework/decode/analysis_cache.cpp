@@ -0,0 +1,244 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/analysis_cache.h"
+
+#include "util/hash.h"
+#include "util/logging.h"
+#include "util/platform.h"
+#include "util/socket_input_stream.h"
+
+#include <algorithm>
+#include <cstdio>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const uint32_t kCacheFileMagic   = 0x4d584647; // 'GFXM'
+const uint32_t kCacheFileVersion = 1;
+
+// Amount of data hashed from both the start and the end of the capture file to form the key.  The start of the file
+// holds its header and the first state blocks, and the end holds the seek index and the last frame's blocks.
+const size_t kKeyDataSize = 64 * 1024;
+
+AnalysisCache::AnalysisCache() : capture_size_(0), capture_hash_(0) {}
+
+bool AnalysisCache::Initialize(const std::string& capture_filename)
+{
+    sections_.clear();
+
+    if (!ComputeKey(capture_filename, &capture_size_, &capture_hash_))
+    {
+        return false;
+    }
+
+    cache_filename_ = GetCacheFilename(capture_filename);
+
+    if (!ReadCacheFile())
+    {
+        sections_.clear();
+    }
+
+    return true;
+}
+
+const std::vector<uint8_t>* AnalysisCache::GetSection(SectionId id) const
+{
+    auto entry = sections_.find(id);
+    return (entry != sections_.end()) ? &entry->second : nullptr;
+}
+
+void AnalysisCache::SetSection(SectionId id, std::vector<uint8_t>&& data)
+{
+    sections_[id] = std::move(data);
+}
+
+bool AnalysisCache::Write() const
+{
+    if (cache_filename_.empty())
+    {
+        return false;
+    }
+
+    Writer writer;
+    writer.Write(kCacheFileMagic);
+    writer.Write(kCacheFileVersion);
+    writer.Write(capture_size_);
+    writer.Write(capture_hash_);
+    writer.Write(static_cast<uint32_t>(sections_.size()));
+
+    for (const auto& section : sections_)
+    {
+        writer.Write(section.first);
+        writer.WriteVector(section.second);
+    }
+
+    // Write to a temporary file that replaces the sidecar file once it is complete, so that a tool that reads the
+    // sidecar file while it is being written, or a write that fails part way through, does not leave it truncated.
+    const std::vector<uint8_t>& data          = writer.GetData();
+    std::string                 temp_filename = cache_filename_ + ".tmp";
+    FILE*                       file          = nullptr;
+    bool                        success       = false;
+
+    if (util::platform::FileOpen(&file, temp_filename.c_str(), "wb") == 0)
+    {
+        success = (util::platform::FileWrite(data.data(), data.size(), 1, file) == 1);
+        success = (util::platform::FileClose(file) == 0) && success;
+
+        if (success && (std::rename(temp_filename.c_str(), cache_filename_.c_str()) != 0))
+        {
+            // The rename does not replace an existing file on all platforms.
+            std::remove(cache_filename_.c_str());
+            success = (std::rename(temp_filename.c_str(), cache_filename_.c_str()) == 0);
+        }
+
+        if (!success)
+        {
+            std::remove(temp_filename.c_str());
+        }
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_WARNING("Failed to write analysis cache file %s", cache_filename_.c_str());
+    }
+
+    return success;
+}
+
+bool AnalysisCache::ComputeKey(const std::string& capture_filename, uint64_t* capture_size, uint64_t* capture_hash)
+{
+    assert((capture_size != nullptr) && (capture_hash != nullptr));
+
+    FILE* file    = nullptr;
+    bool  success = false;
+
+    if ((capture_filename == "-") || util::SocketInputStream::IsSocketAddress(capture_filename))
+    {
+        // Streamed capture data cannot be keyed.
+        return false;
+    }
+
+    if (util::platform::FileOpen(&file, capture_filename.c_str(), "rb") == 0)
+    {
+        if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+        {
+            int64_t size = util::platform::FileTell(file);
+
+            if (size > 0)
+            {
+                size_t               key_size = static_cast<size_t>(std::min<int64_t>(size, kKeyDataSize));
+                std::vector<uint8_t> head(key_size);
+                std::vector<uint8_t> tail(key_size);
+
+                success = util::platform::FileSeek(file, 0, util::platform::FileSeekSet) &&
+                          (util::platform::FileRead(head.data(), key_size, 1, file) == 1) &&
+                          util::platform::FileSeek(file, size - key_size, util::platform::FileSeekSet) &&
+                          (util::platform::FileRead(tail.data(), key_size, 1, file) == 1);
+
+                if (success)
+                {
+                    (*capture_size) = static_cast<uint64_t>(size);
+                    (*capture_hash) =
+                        util::hash::Hash64(tail.data(), key_size, util::hash::Hash64(head.data(), key_size));
+                }
+            }
+        }
+
+        util::platform::FileClose(file);
+    }
+
+    return success;
+}
+
+bool AnalysisCache::ReadCacheFile()
+{
+    FILE*                file = nullptr;
+    std::vector<uint8_t> data;
+
+    if (util::platform::FileOpen(&file, cache_filename_.c_str(), "rb") != 0)
+    {
+        // There are no results for the capture file yet.
+        return false;
+    }
+
+    bool success = false;
+
+    if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+    {
+        int64_t size = util::platform::FileTell(file);
+
+        if (size > 0)
+        {
+            data.resize(static_cast<size_t>(size));
+            success = util::platform::FileSeek(file, 0, util::platform::FileSeekSet) &&
+                      (util::platform::FileRead(data.data(), data.size(), 1, file) == 1);
+        }
+    }
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        return false;
+    }
+
+    Reader   reader(data);
+    uint32_t magic         = 0;
+    uint32_t version       = 0;
+    uint64_t capture_size  = 0;
+    uint64_t capture_hash  = 0;
+    uint32_t section_count = 0;
+
+    if (!reader.Read(&magic) || !reader.Read(&version) || !reader.Read(&capture_size) || !reader.Read(&capture_hash) ||
+        !reader.Read(&section_count) || (magic != kCacheFileMagic) || (version != kCacheFileVersion))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid analysis cache file %s", cache_filename_.c_str());
+        return false;
+    }
+
+    if ((capture_size != capture_size_) || (capture_hash != capture_hash_))
+    {
+        GFXRECON_LOG_INFO("Ignoring analysis cache file %s, which was written for a different capture file",
+                          cache_filename_.c_str());
+        return false;
+    }
+
+    for (uint32_t i = 0; i < section_count; ++i)
+    {
+        uint32_t             id = 0;
+        std::vector<uint8_t> section;
+
+        if (!reader.Read(&id) || !reader.ReadVector(&section))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid analysis cache file %s", cache_filename_.c_str());
+            return false;
+        }
+
+        sections_[id] = std::move(section);
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
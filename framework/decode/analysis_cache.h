@@ -0,0 +1,178 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_ANALYSIS_CACHE_H
+#define GFXRECON_DECODE_ANALYSIS_CACHE_H
+
+#include "util/defines.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Stores the results of the analysis passes that tools run over a capture file in a sidecar file, <capture-file>.meta,
+// so that later runs over the same capture file can skip the passes.  The sidecar file is keyed by the size of the
+// capture file and a hash of the data at its start and end, and its content is ignored when the key does not match.
+// Each pass stores its results in its own section, which is replaced without modifying the other sections.
+class AnalysisCache
+{
+  public:
+    enum SectionId : uint32_t
+    {
+        kUnreferencedResourcesSection = 1, // Unreferenced resources and unused fill memory data found by optimize.
+        kRealignMemoryLayoutSection   = 2  // Replay resource sizes and binding offsets for realign memory translation.
+    };
+
+    // Serializes section data.  Values must be trivially copyable, and are stored with the host's byte order, which is
+    // acceptable for a file that is only read back on the system that wrote it.
+    class Writer
+    {
+      public:
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Section values must be trivially copyable");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        template <typename T>
+        void WriteVector(const std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Section values must be trivially copyable");
+            Write<uint64_t>(values.size());
+            WriteBytes(values.data(), values.size() * sizeof(T));
+        }
+
+        std::vector<uint8_t>& GetData() { return data_; }
+
+      private:
+        void WriteBytes(const void* bytes, size_t size)
+        {
+            if (size > 0)
+            {
+                size_t offset = data_.size();
+                data_.resize(offset + size);
+                std::memcpy(data_.data() + offset, bytes, size);
+            }
+        }
+
+      private:
+        std::vector<uint8_t> data_;
+    };
+
+    // Deserializes section data written by Writer, failing when the data ends before a value.
+    class Reader
+    {
+      public:
+        Reader(const std::vector<uint8_t>& data) : data_(data), offset_(0) {}
+
+        template <typename T>
+        bool Read(T* value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Section values must be trivially copyable");
+            assert(value != nullptr);
+            return ReadBytes(value, sizeof(T));
+        }
+
+        template <typename T>
+        bool ReadVector(std::vector<T>* values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Section values must be trivially copyable");
+            assert(values != nullptr);
+
+            uint64_t count = 0;
+            if (!Read(&count) || (count > ((data_.size() - offset_) / sizeof(T))))
+            {
+                return false;
+            }
+
+            values->resize(static_cast<size_t>(count));
+            return ReadBytes(values->data(), values->size() * sizeof(T));
+        }
+
+        bool IsComplete() const { return offset_ == data_.size(); }
+
+      private:
+        bool ReadBytes(void* bytes, size_t size)
+        {
+            if (size > (data_.size() - offset_))
+            {
+                return false;
+            }
+
+            if (size > 0)
+            {
+                std::memcpy(bytes, data_.data() + offset_, size);
+                offset_ += size;
+            }
+
+            return true;
+        }
+
+      private:
+        const std::vector<uint8_t>& data_;
+        size_t                      offset_;
+    };
+
+  public:
+    AnalysisCache();
+
+    static std::string GetCacheFilename(const std::string& capture_filename) { return capture_filename + ".meta"; }
+
+    // Computes the key of the capture file and loads the sections of its existing sidecar file when the key matches.
+    // Returns false when the capture file cannot be keyed, such as when it is streamed from standard input or a
+    // socket, in which case the cache cannot be used.
+    bool Initialize(const std::string& capture_filename);
+
+    // Computes the key of a capture file, for other caches of results that are only valid for the same capture file.
+    // Returns false when the capture file cannot be keyed.
+    static bool ComputeKey(const std::string& capture_filename, uint64_t* capture_size, uint64_t* capture_hash);
+
+    // Returns the data of a section, or nullptr if the sidecar file did not contain the section for the capture file.
+    const std::vector<uint8_t>* GetSection(SectionId id) const;
+
+    void SetSection(SectionId id, std::vector<uint8_t>&& data);
+
+    // Writes all sections to the sidecar file, replacing it.
+    bool Write() const;
+
+  private:
+    bool ReadCacheFile();
+
+  private:
+    std::string                              cache_filename_;
+    uint64_t                                 capture_size_;
+    uint64_t                                 capture_hash_;
+    std::map<uint32_t, std::vector<uint8_t>> sections_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_ANALYSIS_CACHE_H
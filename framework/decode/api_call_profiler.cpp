@@ -0,0 +1,139 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/api_call_profiler.h"
+
+#include "format/format_util.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const uint32_t kFirstProfiledCall = format::ApiCallId::ApiCall_vkCreateInstance;
+const uint32_t kProfiledCallCount = format::ApiCallId::ApiCall_VulkanLast - kFirstProfiledCall;
+
+ApiCallProfiler::ApiCallProfiler() : call_times_(std::make_unique<CallTimes[]>(kProfiledCallCount)) {}
+
+void ApiCallProfiler::AddDecodeTime(format::ApiCallId call_id, int64_t time)
+{
+    CallTimes* call_times = GetCallTimes(call_id);
+
+    if (call_times != nullptr)
+    {
+        call_times->count.fetch_add(1, std::memory_order_relaxed);
+        call_times->decode_time.fetch_add(time, std::memory_order_relaxed);
+    }
+}
+
+void ApiCallProfiler::AddProcessTime(format::ApiCallId call_id, int64_t time)
+{
+    CallTimes* call_times = GetCallTimes(call_id);
+
+    if (call_times != nullptr)
+    {
+        call_times->process_time.fetch_add(time, std::memory_order_relaxed);
+    }
+}
+
+void ApiCallProfiler::WriteReport() const
+{
+    struct ReportEntry
+    {
+        format::ApiCallId call_id;
+        uint64_t          count;
+        int64_t           decode_time;
+        int64_t           process_time;
+    };
+
+    std::vector<ReportEntry> entries;
+    int64_t                  total_decode_time  = 0;
+    int64_t                  total_process_time = 0;
+
+    for (uint32_t i = 0; i < kProfiledCallCount; ++i)
+    {
+        const CallTimes& call_times = call_times_[i];
+        uint64_t         count      = call_times.count.load(std::memory_order_relaxed);
+
+        if (count > 0)
+        {
+            ReportEntry entry;
+            entry.call_id      = static_cast<format::ApiCallId>(kFirstProfiledCall + i);
+            entry.count        = count;
+            entry.decode_time  = call_times.decode_time.load(std::memory_order_relaxed);
+            entry.process_time = call_times.process_time.load(std::memory_order_relaxed);
+            entries.push_back(entry);
+
+            total_decode_time += entry.decode_time;
+            total_process_time += entry.process_time;
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const ReportEntry& lhs, const ReportEntry& rhs) {
+        return (lhs.decode_time + lhs.process_time) > (rhs.decode_time + rhs.process_time);
+    });
+
+    GFXRECON_WRITE_CONSOLE("API call profile (milliseconds; process time includes handle mapping, replay logic, and "
+                           "the driver call):");
+    GFXRECON_WRITE_CONSOLE("  %-48s %12s %12s %12s %12s %10s",
+                           "API call",
+                           "count",
+                           "decode",
+                           "process",
+                           "total",
+                           "avg (us)");
+
+    for (const auto& entry : entries)
+    {
+        int64_t total_time = entry.decode_time + entry.process_time;
+
+        GFXRECON_WRITE_CONSOLE("  %-48s %12" PRIu64 " %12.3f %12.3f %12.3f %10.3f",
+                               format::GetApiCallName(entry.call_id),
+                               entry.count,
+                               util::datetime::ConvertTimestampToMilliseconds(entry.decode_time),
+                               util::datetime::ConvertTimestampToMilliseconds(entry.process_time),
+                               util::datetime::ConvertTimestampToMilliseconds(total_time),
+                               util::datetime::ConvertTimestampToMilliseconds(total_time) * 1000.0 / entry.count);
+    }
+
+    GFXRECON_WRITE_CONSOLE("  %-48s %12s %12.3f %12.3f %12.3f",
+                           "Total",
+                           "",
+                           util::datetime::ConvertTimestampToMilliseconds(total_decode_time),
+                           util::datetime::ConvertTimestampToMilliseconds(total_process_time),
+                           util::datetime::ConvertTimestampToMilliseconds(total_decode_time + total_process_time));
+}
+
+ApiCallProfiler::CallTimes* ApiCallProfiler::GetCallTimes(format::ApiCallId call_id)
+{
+    // Call IDs that precede the Vulkan range wrap around to large values, failing the table size check.
+    uint32_t index = call_id - kFirstProfiledCall;
+
+    return (index < kProfiledCallCount) ? &call_times_[index] : nullptr;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
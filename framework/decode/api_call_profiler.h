@@ -0,0 +1,70 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_API_CALL_PROFILER_H
+#define GFXRECON_DECODE_API_CALL_PROFILER_H
+
+#include "format/api_call_id.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Accumulates the CPU time that replay spends on each API call, separated into the time spent decoding the call's
+// parameters and the time spent by the consumers processing the decoded call.  For replay, the processing time includes
+// handle mapping, the replay consumer's override logic, and the driver call.  Times may be added concurrently by the
+// decode thread and the replay threads.
+class ApiCallProfiler
+{
+  public:
+    ApiCallProfiler();
+
+    void AddDecodeTime(format::ApiCallId call_id, int64_t time);
+
+    void AddProcessTime(format::ApiCallId call_id, int64_t time);
+
+    // Writes a table of the profiled API calls to the console, sorted by total time.
+    void WriteReport() const;
+
+  private:
+    struct CallTimes
+    {
+        std::atomic<uint64_t> count{ 0 };
+        std::atomic<int64_t>  decode_time{ 0 };
+        std::atomic<int64_t>  process_time{ 0 };
+    };
+
+  private:
+    CallTimes* GetCallTimes(format::ApiCallId call_id);
+
+  private:
+    std::unique_ptr<CallTimes[]> call_times_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_API_CALL_PROFILER_H
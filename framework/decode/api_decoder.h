@@ -24,6 +24,7 @@
 #ifndef GFXRECON_API_DECODE_DECODER_H
 #define GFXRECON_API_DECODE_DECODER_H
 
+#include "decode/decoded_call.h"
 #include "format/api_call_id.h"
 #include "format/format.h"
 #include "util/defines.h"
@@ -35,6 +36,8 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+struct ResourceInitDataLocation;
+
 struct ApiCallInfo
 {
     format::ThreadId thread_id{ 0 };
@@ -47,11 +50,26 @@ class ApiDecoder
 
     virtual bool SupportsApiCall(format::ApiCallId id) = 0;
 
+    // When a recorder is set, the decoded calls are passed to the recorder instead of being passed to the consumers, so
+    // that they can be executed later, from another thread.  The decoded parameters must remain valid until the calls
+    // are executed, so the DecodeAllocator scope that the calls were decoded with must not be ended before then.  Set
+    // nullptr to pass the decoded calls to the consumers directly.  Returns false if the decoder does not support
+    // recording.
+    virtual bool SetCallRecorder(DecodedCallRecorder* recorder)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(recorder);
+        return false;
+    }
+
     virtual void DecodeFunctionCall(format::ApiCallId  id,
                                     const ApiCallInfo& call_info,
                                     const uint8_t*     buffer,
                                     size_t             buffer_size) = 0;
 
+    // Called before DecodeFunctionCall() with the index of the block that contains the call, counting the blocks from
+    // the first block that was processed.
+    virtual void SetCurrentBlockIndex(uint64_t block_index) { GFXRECON_UNREFERENCED_PARAMETER(block_index); }
+
     virtual void DispatchStateBeginMarker(uint64_t frame_number) = 0;
 
     virtual void DispatchStateEndMarker(uint64_t frame_number) = 0;
@@ -61,6 +79,14 @@ class ApiDecoder
     virtual void DispatchFillMemoryCommand(
         format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) = 0;
 
+    // Called before DispatchFillMemoryCommand() for a fill memory command that reuses the data of an earlier fill memory
+    // command block, with the index of that block among the file's fill memory command blocks.
+    virtual void DispatchFillMemoryFromPreviousBlockCommand(format::ThreadId thread_id, uint64_t source_index)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+        GFXRECON_UNREFERENCED_PARAMETER(source_index);
+    }
+
     virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
                                              format::HandleId surface_id,
                                              uint32_t         width,
@@ -113,6 +139,13 @@ class ApiDecoder
                                                                 size_t           data_size,
                                                                 const uint8_t*   data) = 0;
 
+    virtual void DispatchSetPipelineCacheDataCommand(format::ThreadId thread_id,
+                                                     format::HandleId device_id,
+                                                     size_t           data_size,
+                                                     const uint8_t*   data) = 0;
+
+    virtual void DispatchTimestampCommand(format::ThreadId thread_id, uint64_t timestamp) = 0;
+
     virtual void
     DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
                                           format::HandleId                                    device_id,
@@ -127,6 +160,31 @@ class ApiDecoder
 
     virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) = 0;
 
+    // Returns memory that the data of the following DispatchInitBufferCommand() call for the buffer can be read to,
+    // which is then passed to the call as its data, or nullptr if the data must be read to a separate buffer.  The
+    // memory may be write-combined, so it must only be written sequentially.
+    virtual uint8_t* GetInitBufferDataDestination(format::HandleId device_id,
+                                                  format::HandleId buffer_id,
+                                                  uint64_t         data_size)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(device_id);
+        GFXRECON_UNREFERENCED_PARAMETER(buffer_id);
+        GFXRECON_UNREFERENCED_PARAMETER(data_size);
+        return nullptr;
+    }
+
+    // Returns memory that the data of the following DispatchInitImageCommand() call for the image can be read to, with
+    // the same requirements as GetInitBufferDataDestination().
+    virtual uint8_t* GetInitImageDataDestination(format::HandleId device_id,
+                                                 format::HandleId image_id,
+                                                 uint64_t         data_size)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(device_id);
+        GFXRECON_UNREFERENCED_PARAMETER(image_id);
+        GFXRECON_UNREFERENCED_PARAMETER(data_size);
+        return nullptr;
+    }
+
     virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
                                            format::HandleId device_id,
                                            format::HandleId buffer_id,
@@ -141,6 +199,41 @@ class ApiDecoder
                                           uint32_t                     layout,
                                           const std::vector<uint64_t>& level_sizes,
                                           const uint8_t*               data) = 0;
+
+    // Called in place of DispatchInitBufferCommand() when the file processor defers reading the initialization data,
+    // which can then be read from its location with ResourceInitDataReader.
+    virtual void DispatchDeferredInitBufferCommand(format::ThreadId                thread_id,
+                                                   format::HandleId                device_id,
+                                                   format::HandleId                buffer_id,
+                                                   uint64_t                        data_size,
+                                                   const ResourceInitDataLocation& location)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+        GFXRECON_UNREFERENCED_PARAMETER(device_id);
+        GFXRECON_UNREFERENCED_PARAMETER(buffer_id);
+        GFXRECON_UNREFERENCED_PARAMETER(data_size);
+        GFXRECON_UNREFERENCED_PARAMETER(location);
+    }
+
+    // Called in place of DispatchInitImageCommand() when the file processor defers reading the initialization data.
+    virtual void DispatchDeferredInitImageCommand(format::ThreadId                thread_id,
+                                                  format::HandleId                device_id,
+                                                  format::HandleId                image_id,
+                                                  uint64_t                        data_size,
+                                                  uint32_t                        aspect,
+                                                  uint32_t                        layout,
+                                                  const std::vector<uint64_t>&    level_sizes,
+                                                  const ResourceInitDataLocation& location)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+        GFXRECON_UNREFERENCED_PARAMETER(device_id);
+        GFXRECON_UNREFERENCED_PARAMETER(image_id);
+        GFXRECON_UNREFERENCED_PARAMETER(data_size);
+        GFXRECON_UNREFERENCED_PARAMETER(aspect);
+        GFXRECON_UNREFERENCED_PARAMETER(layout);
+        GFXRECON_UNREFERENCED_PARAMETER(level_sizes);
+        GFXRECON_UNREFERENCED_PARAMETER(location);
+    }
 };
 
 GFXRECON_END_NAMESPACE(decode)
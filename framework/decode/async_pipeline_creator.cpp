@@ -0,0 +1,154 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/async_pipeline_creator.h"
+
+#include "util/thread_placement.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+PipelineCreationTask::PipelineCreationTask(uint32_t pipeline_count, CreateFunction create, CompleteFunction complete) :
+    pipelines_(pipeline_count, VK_NULL_HANDLE), create_(std::move(create)), complete_(std::move(complete)),
+    result_(VK_SUCCESS), finished_(false)
+{}
+
+void PipelineCreationTask::Wait()
+{
+    CompleteFunction complete;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_finished_.wait(lock, [this]() { return finished_; });
+
+        std::swap(complete, complete_);
+    }
+
+    if (complete)
+    {
+        complete(result_);
+    }
+}
+
+void PipelineCreationTask::Execute()
+{
+    // The function object, and any data that it retains, is released with the task.  The decoded parameters that it
+    // references may still be in use by the thread that submitted the task.
+    VkResult result = create_(pipelines_.data());
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        result_   = result;
+        finished_ = true;
+    }
+
+    task_finished_.notify_all();
+}
+
+AsyncPipelineCreator::AsyncPipelineCreator(size_t thread_count) : active_tasks_(0), shutdown_(false)
+{
+    thread_count = std::max(thread_count, static_cast<size_t>(1));
+
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads_.emplace_back(&AsyncPipelineCreator::ExecuteTasks, this);
+    }
+}
+
+AsyncPipelineCreator::~AsyncPipelineCreator()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    task_available_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+std::shared_ptr<PipelineCreationTask>
+AsyncPipelineCreator::Submit(uint32_t                               pipeline_count,
+                             PipelineCreationTask::CreateFunction   create,
+                             PipelineCreationTask::CompleteFunction complete)
+{
+    auto task = std::make_shared<PipelineCreationTask>(pipeline_count, std::move(create), std::move(complete));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(task);
+        ++active_tasks_;
+    }
+
+    task_available_.notify_one();
+
+    return task;
+}
+
+void AsyncPipelineCreator::WaitAll()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_finished_.wait(lock, [this]() { return (active_tasks_ == 0); });
+}
+
+void AsyncPipelineCreator::ExecuteTasks()
+{
+    util::thread_placement::ApplyThreadRole(util::thread_placement::kWorkerThread);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        task_available_.wait(lock, [this]() { return (!tasks_.empty() || shutdown_); });
+
+        // Tasks that are queued at shutdown are still executed, as a thread may be waiting for them.
+        if (tasks_.empty())
+        {
+            break;
+        }
+
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+
+        lock.unlock();
+        task->Execute();
+        task.reset();
+        lock.lock();
+
+        assert(active_tasks_ > 0);
+        --active_tasks_;
+
+        if (active_tasks_ == 0)
+        {
+            tasks_finished_.notify_all();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_ASYNC_PIPELINE_CREATOR_H
+#define GFXRECON_DECODE_ASYNC_PIPELINE_CREATOR_H
+
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// A pipeline creation call that is executed by a worker thread of an AsyncPipelineCreator.
+class PipelineCreationTask
+{
+  public:
+    // Creates the pipelines, writing pipeline_count handles to pipelines.
+    typedef std::function<VkResult(VkPipeline* pipelines)> CreateFunction;
+
+    // Receives the result of the creation call, from the first thread that waits for the task.
+    typedef std::function<void(VkResult result)> CompleteFunction;
+
+  public:
+    PipelineCreationTask(uint32_t pipeline_count, CreateFunction create, CompleteFunction complete);
+
+    // Waits for the creation call to finish.  The first call also passes the result to the complete function.
+    void Wait();
+
+    // Returns the result of the creation call, after Wait() has returned.
+    VkResult GetResult() const { return result_; }
+
+    // Returns the created pipeline at the specified index, after Wait() has returned.
+    VkPipeline GetPipeline(uint32_t index) const
+    {
+        return (index < pipelines_.size()) ? pipelines_[index] : VK_NULL_HANDLE;
+    }
+
+  private:
+    friend class AsyncPipelineCreator;
+
+    void Execute();
+
+  private:
+    std::vector<VkPipeline> pipelines_;
+    CreateFunction          create_;
+    CompleteFunction        complete_;
+    VkResult                result_;
+    bool                    finished_;
+    std::mutex              mutex_;
+    std::condition_variable task_finished_;
+};
+
+// Creates pipelines with a pool of worker threads, so that replay can continue while pipelines are compiled.  The
+// caller waits for a task before the first use of the pipelines that it creates.  Tasks are started in the order that
+// they are submitted.
+class AsyncPipelineCreator
+{
+  public:
+    AsyncPipelineCreator(size_t thread_count);
+
+    // Executes the tasks that have not been started and waits for the worker threads to finish.
+    ~AsyncPipelineCreator();
+
+    // Queues a creation call for execution by a worker thread.  Any data that is referenced by create must remain
+    // valid until the task has finished, and may be retained by the function object.
+    std::shared_ptr<PipelineCreationTask> Submit(uint32_t                               pipeline_count,
+                                                 PipelineCreationTask::CreateFunction   create,
+                                                 PipelineCreationTask::CompleteFunction complete);
+
+    // Waits for all submitted creation calls to finish.  Must be called before destroying any objects that are used
+    // by the calls, such as shader modules, pipeline layouts, render passes, pipeline caches, and devices.  The
+    // results are not passed to the complete functions until the tasks are waited for.
+    void WaitAll();
+
+  private:
+    void ExecuteTasks();
+
+  private:
+    std::vector<std::thread>                          threads_;
+    std::deque<std::shared_ptr<PipelineCreationTask>> tasks_;
+    size_t                                            active_tasks_; // Tasks that have been submitted but not finished.
+    bool                                              shutdown_;
+    std::mutex                                        mutex_;
+    std::condition_variable                           task_available_;
+    std::condition_variable                           tasks_finished_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_ASYNC_PIPELINE_CREATOR_H
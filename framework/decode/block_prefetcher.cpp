@@ -0,0 +1,543 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/block_prefetcher.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+#include "util/thread_placement.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const size_t BlockPrefetcher::kDefaultBlockCount;
+const size_t BlockPrefetcher::kDefaultBufferedSize;
+
+BlockPrefetcher::BlockPrefetcher(size_t block_count, size_t max_buffered_size, uint32_t worker_count) :
+    file_descriptor_(nullptr), file_offset_(0), compression_type_(format::CompressionType::kNone),
+    block_count_(std::max(block_count, static_cast<size_t>(1))), buffered_size_(0),
+    max_buffered_size_(max_buffered_size), read_offset_(0), preload_end_offset_(0), max_preload_size_(0),
+    pending_count_(0), worker_count_(worker_count), huge_page_mode_(util::HugePageBuffer::kModeNone), finished_(false),
+    error_(false), shutdown_(false)
+{}
+
+BlockPrefetcher::~BlockPrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    free_block_available_.notify_one();
+    pending_block_available_.notify_all();
+    preload_progress_.notify_all();
+
+    if (prefetch_thread_.joinable())
+    {
+        prefetch_thread_.join();
+    }
+
+    for (auto& worker_thread : worker_threads_)
+    {
+        worker_thread.join();
+    }
+
+    if (file_descriptor_ != nullptr)
+    {
+        fclose(file_descriptor_);
+    }
+}
+
+bool BlockPrefetcher::Start(const std::string& filename, uint64_t offset, format::CompressionType compression_type)
+{
+    assert(!prefetch_thread_.joinable());
+
+    int32_t result = util::platform::FileOpen(&file_descriptor_, filename.c_str(), "rb");
+
+    if ((result != 0) || (file_descriptor_ == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s for block prefetching", filename.c_str());
+        return false;
+    }
+
+    if (!util::platform::FileSeek(file_descriptor_, offset, util::platform::FileSeekSet))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to the first block of file %s for block prefetching", filename.c_str());
+        fclose(file_descriptor_);
+        file_descriptor_ = nullptr;
+        return false;
+    }
+
+    file_offset_      = offset;
+    read_offset_      = offset;
+    compression_type_ = compression_type;
+    prefetch_thread_  = std::thread(&BlockPrefetcher::ReadBlocks, this);
+
+    for (uint32_t i = 0; i < worker_count_; ++i)
+    {
+        worker_threads_.emplace_back(&BlockPrefetcher::DecompressBlocks, this);
+    }
+
+    return true;
+}
+
+BlockPrefetcher::Block* BlockPrefetcher::AcquireBlock()
+{
+    Block* block = nullptr;
+
+    {
+        // Blocks are returned in file order, so a block that is still being decompressed holds back the blocks that
+        // follow it.
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_block_available_.wait(lock, [this]() {
+            return ready_blocks_.empty() ? finished_ : !ready_blocks_.front()->pending;
+        });
+
+        if (!ready_blocks_.empty())
+        {
+            block = ready_blocks_.front();
+            ready_blocks_.pop_front();
+            buffered_size_ -= block->data_size + block->decompressed_size;
+        }
+    }
+
+    // Reading may be waiting for the buffered size to drop below the limit.
+    free_block_available_.notify_one();
+
+    return block;
+}
+
+void BlockPrefetcher::ReleaseBlock(Block* block)
+{
+    assert(block != nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        block->dictionary = nullptr;
+
+        // Blocks beyond the block count were allocated for preloading.  Their buffers are released, so that memory use
+        // returns to the read-ahead limits after the preloaded blocks have been processed.
+        if (free_blocks_.size() >= block_count_)
+        {
+            block->data.Reset();
+            std::vector<uint8_t>().swap(block->decompressed_data);
+        }
+
+        free_blocks_.push_back(block);
+    }
+
+    free_block_available_.notify_one();
+}
+
+bool BlockPrefetcher::Preload(uint64_t end_offset, size_t max_size, size_t* buffered_size)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    preload_end_offset_ = end_offset;
+    max_preload_size_   = max_size;
+
+    free_block_available_.notify_one();
+
+    preload_progress_.wait(lock, [this]() {
+        return shutdown_ || ((finished_ || !IsPreloading()) && (pending_count_ == 0));
+    });
+
+    bool complete = finished_ || (read_offset_ >= end_offset);
+
+    preload_end_offset_ = 0;
+    max_preload_size_   = 0;
+
+    if (buffered_size != nullptr)
+    {
+        (*buffered_size) = buffered_size_;
+    }
+
+    return complete;
+}
+
+bool BlockPrefetcher::IsFinished() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return finished_ && ready_blocks_.empty();
+}
+
+size_t BlockPrefetcher::GetBufferedSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffered_size_;
+}
+
+bool BlockPrefetcher::HasError() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_;
+}
+
+void BlockPrefetcher::ReadBlocks()
+{
+    util::thread_placement::ApplyThreadRole(util::thread_placement::kIoThread);
+
+    bool more_blocks = true;
+
+    while (more_blocks)
+    {
+        Block* block = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            free_block_available_.wait(lock, [this]() { return shutdown_ || CanReadBlock(); });
+
+            if (shutdown_)
+            {
+                break;
+            }
+
+            if (free_blocks_.empty())
+            {
+                blocks_.emplace_back();
+                block = &blocks_.back();
+                block->data.SetMode(huge_page_mode_);
+            }
+            else
+            {
+                block = free_blocks_.back();
+                free_blocks_.pop_back();
+            }
+        }
+
+        more_blocks = ReadBlock(block);
+
+        if (more_blocks)
+        {
+            ProcessCompressionDictionary(block);
+            FindCompressedPayload(block);
+
+            if (block->compressed_offset != 0)
+            {
+                block->dictionary = dictionary_;
+
+                if (worker_count_ == 0)
+                {
+                    DecompressBlock(block, &prefetch_context_);
+                }
+                else
+                {
+                    block->pending = true;
+                }
+            }
+        }
+
+        bool pending = block->pending;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (block->data_size > 0)
+            {
+                ready_blocks_.push_back(block);
+                buffered_size_ += block->data_size + block->decompressed_size;
+                read_offset_ = block->file_offset + block->data_size;
+
+                if (pending)
+                {
+                    pending_blocks_.push_back(block);
+                    ++pending_count_;
+                }
+            }
+            else
+            {
+                free_blocks_.push_back(block);
+            }
+
+            if (!more_blocks)
+            {
+                finished_ = true;
+                error_    = (ferror(file_descriptor_) != 0);
+            }
+        }
+
+        if (pending)
+        {
+            pending_block_available_.notify_one();
+        }
+        else
+        {
+            ready_block_available_.notify_one();
+        }
+
+        preload_progress_.notify_one();
+    }
+}
+
+void BlockPrefetcher::DecompressBlocks()
+{
+    util::thread_placement::ApplyThreadRole(util::thread_placement::kDecodeThread);
+
+    DecompressionContext context;
+
+    for (;;)
+    {
+        Block* block = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            pending_block_available_.wait(lock, [this]() { return shutdown_ || !pending_blocks_.empty(); });
+
+            if (shutdown_)
+            {
+                break;
+            }
+
+            block = pending_blocks_.front();
+            pending_blocks_.pop_front();
+        }
+
+        DecompressBlock(block, &context);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            block->pending = false;
+            buffered_size_ += block->decompressed_size;
+            --pending_count_;
+        }
+
+        // Only the consumer waits for ready blocks and preloading.
+        ready_block_available_.notify_one();
+        preload_progress_.notify_one();
+    }
+}
+
+bool BlockPrefetcher::CanReadBlock() const
+{
+    // The block count and buffered size limits do not apply to preloading.
+    if (IsPreloading())
+    {
+        return true;
+    }
+
+    // Always allow one ready block, so that blocks larger than the buffered size limit can be read.
+    return (!free_blocks_.empty() || (blocks_.size() < block_count_)) &&
+           (ready_blocks_.empty() || (buffered_size_ < max_buffered_size_));
+}
+
+bool BlockPrefetcher::ReadBlock(Block* block)
+{
+    assert(block != nullptr);
+
+    format::BlockHeader block_header;
+
+    block->file_offset         = file_offset_;
+    block->data_size           = 0;
+    block->decompressed_offset = 0;
+    block->decompressed_size   = 0;
+    block->compressed_offset   = 0;
+    block->pending             = false;
+
+    size_t bytes_read = util::platform::FileRead(&block_header, 1, sizeof(block_header), file_descriptor_);
+
+    if (bytes_read < sizeof(block_header))
+    {
+        // Keep a partial block header, so that the consumer can report the incomplete block.
+        if (block->data.GetSize() < sizeof(block_header))
+        {
+            block->data.Resize(sizeof(block_header));
+        }
+
+        util::platform::MemoryCopy(block->data.GetData(), bytes_read, &block_header, bytes_read);
+        block->data_size = bytes_read;
+        file_offset_ += bytes_read;
+        return false;
+    }
+
+    if (block_header.size > (std::numeric_limits<size_t>::max() - sizeof(block_header)))
+    {
+        GFXRECON_LOG_ERROR("Block prefetching stopped at block with invalid size %" PRIu64, block_header.size);
+        block->data_size = 0;
+        return false;
+    }
+
+    size_t block_data_size = static_cast<size_t>(block_header.size);
+    size_t block_size      = sizeof(block_header) + block_data_size;
+
+    if (block->data.GetSize() < block_size)
+    {
+        block->data.Resize(block_size);
+    }
+
+    util::platform::MemoryCopy(block->data.GetData(), sizeof(block_header), &block_header, sizeof(block_header));
+
+    bytes_read =
+        util::platform::FileRead(block->data.GetData() + sizeof(block_header), 1, block_data_size, file_descriptor_);
+
+    block->data_size = sizeof(block_header) + bytes_read;
+    file_offset_ += block->data_size;
+
+    return (bytes_read == block_data_size);
+}
+
+void BlockPrefetcher::FindCompressedPayload(Block* block)
+{
+    assert(block != nullptr);
+
+    const format::BlockHeader* block_header   = reinterpret_cast<const format::BlockHeader*>(block->data.GetData());
+    format::BlockType          base_type      = format::RemoveCompressedBlockBit(block_header->type);
+    size_t                     payload_offset = 0;
+
+    if (!format::IsBlockCompressed(block_header->type))
+    {
+        return;
+    }
+
+    // Determine the location of the compressed payload, which is preceded by its uncompressed size.
+    if ((base_type == format::BlockType::kBatchBlock) || (base_type == format::BlockType::kCompactBatchBlock))
+    {
+        payload_offset = sizeof(format::CompressedBatchBlockHeader);
+    }
+    else if (base_type == format::BlockType::kFunctionCallBlock)
+    {
+        payload_offset = sizeof(format::CompressedFunctionCallHeader);
+    }
+    else if ((base_type == format::BlockType::kMetaDataBlock) &&
+             (block->data_size >= sizeof(format::MetaDataHeader)) &&
+             (reinterpret_cast<const format::MetaDataHeader*>(block->data.GetData())->meta_data_type ==
+              format::MetaDataType::kFillMemoryCommand))
+    {
+        payload_offset = sizeof(format::FillMemoryCommandHeader);
+    }
+
+    // Other blocks are decompressed by the consumer.
+    if ((payload_offset > sizeof(uint64_t)) && (payload_offset < block->data_size))
+    {
+        block->compressed_offset = payload_offset;
+    }
+}
+
+void BlockPrefetcher::DecompressBlock(Block* block, DecompressionContext* context)
+{
+    assert((block != nullptr) && (block->compressed_offset != 0) && (context != nullptr));
+
+    const format::BlockHeader* block_header   = reinterpret_cast<const format::BlockHeader*>(block->data.GetData());
+    size_t                     payload_offset = block->compressed_offset;
+    util::Compressor*          compressor     = GetCompressor(context, block_header->type);
+
+    // The dictionary only applies to the file's compression type, matching the FileProcessor.
+    format::CompressionType compression_type = format::GetBlockCompressionType(block_header->type);
+    if ((compressor != nullptr) && (context->dictionary != block->dictionary) &&
+        ((compression_type == format::CompressionType::kNone) || (compression_type == compression_type_)))
+    {
+        compressor->SetDictionary((block->dictionary != nullptr) ? *block->dictionary : std::vector<uint8_t>());
+        context->dictionary = block->dictionary;
+    }
+
+    // Blocks that cannot be decompressed here are decompressed by the consumer.
+    if (compressor != nullptr)
+    {
+        uint64_t uncompressed_size = 0;
+        util::platform::MemoryCopy(&uncompressed_size,
+                                   sizeof(uncompressed_size),
+                                   block->data.GetData() + (payload_offset - sizeof(uncompressed_size)),
+                                   sizeof(uncompressed_size));
+
+        if ((uncompressed_size > 0) && (uncompressed_size <= std::numeric_limits<size_t>::max()))
+        {
+            size_t expected_size = static_cast<size_t>(uncompressed_size);
+
+            if (block->decompressed_data.size() < expected_size)
+            {
+                block->decompressed_data.resize(expected_size);
+            }
+
+            size_t decompressed_size = compressor->Decompress(block->data_size - payload_offset,
+                                                              block->data.GetData() + payload_offset,
+                                                              expected_size,
+                                                              &block->decompressed_data);
+
+            if (decompressed_size == expected_size)
+            {
+                block->decompressed_offset = payload_offset;
+                block->decompressed_size   = decompressed_size;
+            }
+        }
+    }
+}
+
+void BlockPrefetcher::ProcessCompressionDictionary(const Block* block)
+{
+    assert(block != nullptr);
+
+    const size_t   header_size = sizeof(format::SetCompressionDictionaryCommandHeader);
+    const uint8_t* data        = block->data.GetData();
+
+    if ((block->data_size >= header_size) &&
+        (reinterpret_cast<const format::BlockHeader*>(data)->type == format::BlockType::kMetaDataBlock) &&
+        (reinterpret_cast<const format::MetaDataHeader*>(data)->meta_data_type ==
+         format::MetaDataType::kSetCompressionDictionaryCommand))
+    {
+        // The dictionary is recorded with each of the blocks that follow it, and is applied to the compressors of the
+        // thread that decompresses them.
+        uint64_t dictionary_size = 0;
+        util::platform::MemoryCopy(&dictionary_size,
+                                   sizeof(dictionary_size),
+                                   block->data.GetData() + (header_size - sizeof(dictionary_size)),
+                                   sizeof(dictionary_size));
+
+        if (dictionary_size <= (block->data_size - header_size))
+        {
+            const uint8_t* dictionary_data = block->data.GetData() + header_size;
+            dictionary_ =
+                std::make_shared<const std::vector<uint8_t>>(dictionary_data, dictionary_data + dictionary_size);
+        }
+    }
+}
+
+util::Compressor* BlockPrefetcher::GetCompressor(DecompressionContext* context, format::BlockType block_type)
+{
+    assert(context != nullptr);
+
+    format::CompressionType compression_type = format::GetBlockCompressionType(block_type);
+
+    if (compression_type == format::CompressionType::kNone)
+    {
+        compression_type = compression_type_;
+    }
+
+    auto entry = context->compressors.find(compression_type);
+    if (entry == context->compressors.end())
+    {
+        entry = context->compressors
+                    .emplace(compression_type,
+                             std::unique_ptr<util::Compressor>(format::CreateCompressor(compression_type)))
+                    .first;
+    }
+
+    return entry->second.get();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
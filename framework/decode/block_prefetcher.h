@@ -0,0 +1,179 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_PREFETCHER_H
+#define GFXRECON_DECODE_BLOCK_PREFETCHER_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/huge_page_buffer.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Reads file blocks ahead of the FileProcessor from a dedicated thread.  Blocks are read into a fixed pool of reusable
+// buffers, and the compressed payloads of batch, function call, and fill memory blocks are decompressed by the
+// prefetch thread, so that the consumer only needs to parse the ready blocks.  When worker threads are requested, the
+// payloads of the blocks in the read-ahead window are decompressed concurrently by the workers instead of by the
+// prefetch thread.  Blocks are always returned in file order.  The read-ahead limits can be lifted temporarily with
+// Preload(), to hold a range of the file in memory before it is processed.
+class BlockPrefetcher
+{
+  public:
+    static const size_t kDefaultBlockCount   = 64;
+    static const size_t kDefaultBufferedSize = 256 * 1024 * 1024;
+
+    // The data size is less than the block size when the file ends with a partial block.  When the block's compressed
+    // payload was decompressed by the prefetch thread, decompressed_offset is the offset of the payload in data.
+    struct Block
+    {
+        uint64_t             file_offset{ 0 }; // Offset of the block header from the start of the file.
+        util::HugePageBuffer data;             // Block header and block data, as stored in the file.
+        size_t               data_size{ 0 };
+        size_t               decompressed_offset{ 0 };
+        std::vector<uint8_t> decompressed_data;
+        size_t               decompressed_size{ 0 };
+
+        // Decompression state.  The dictionary is the compression dictionary that was active when the block was read.
+        size_t                                      compressed_offset{ 0 };
+        std::shared_ptr<const std::vector<uint8_t>> dictionary;
+        bool                                        pending{ false };
+    };
+
+  public:
+    // Reading stops when block_count blocks are ready, or when the ready blocks hold more than max_buffered_size bytes.
+    // Compressed payloads are decompressed by worker_count worker threads, or by the prefetch thread when the count is
+    // zero.
+    BlockPrefetcher(size_t   block_count       = kDefaultBlockCount,
+                    size_t   max_buffered_size = kDefaultBufferedSize,
+                    uint32_t worker_count      = 0);
+
+    ~BlockPrefetcher();
+
+    // Sets the page mode of the block data buffers.  Must be called before Start().
+    void SetHugePageMode(util::HugePageBuffer::Mode mode) { huge_page_mode_ = mode; }
+
+    // Opens a separate handle to the file and starts reading blocks from the specified offset.
+    bool Start(const std::string& filename, uint64_t offset, format::CompressionType compression_type);
+
+    // Waits for the next block.  Returns nullptr when all blocks have been read.  The block must be returned with
+    // ReleaseBlock() when its data is no longer referenced.
+    Block* AcquireBlock();
+
+    void ReleaseBlock(Block* block);
+
+    // Reads and decompresses the blocks that start before end_offset ahead of the consumer, without the block count and
+    // buffered size limits, and waits for them to be ready.  Reading stops early when the ready blocks hold max_size
+    // bytes.  The normal limits apply again after the wait, so the blocks that follow are streamed.  Returns false if
+    // the size limit stopped reading before end_offset was reached.  The size of the ready blocks is returned in
+    // buffered_size.
+    bool Preload(uint64_t end_offset, size_t max_size, size_t* buffered_size);
+
+    // Returns true when all blocks have been read and acquired.
+    bool IsFinished() const;
+
+    // Returns the size of the blocks that have been read and not yet released.
+    size_t GetBufferedSize() const;
+
+    bool HasError() const;
+
+  private:
+    typedef std::unordered_map<uint32_t, std::unique_ptr<util::Compressor>> CompressorMap;
+
+    // Compressors are not thread safe, so each thread that decompresses blocks has its own compressors and tracks the
+    // dictionary that was last applied to them.
+    struct DecompressionContext
+    {
+        CompressorMap                               compressors;
+        std::shared_ptr<const std::vector<uint8_t>> dictionary;
+    };
+
+  private:
+    // Returns true when the reading thread may read another block.  Must be called with the mutex locked.
+    bool CanReadBlock() const;
+
+    bool IsPreloading() const { return (read_offset_ < preload_end_offset_) && (buffered_size_ < max_preload_size_); }
+
+    void ReadBlocks();
+
+    void DecompressBlocks();
+
+    // Returns false when the end of the file was reached or an error occurred.
+    bool ReadBlock(Block* block);
+
+    // Sets the block's compressed_offset when it has a compressed payload that can be decompressed ahead of the
+    // consumer.
+    void FindCompressedPayload(Block* block);
+
+    void DecompressBlock(Block* block, DecompressionContext* context);
+
+    void ProcessCompressionDictionary(const Block* block);
+
+    util::Compressor* GetCompressor(DecompressionContext* context, format::BlockType block_type);
+
+  private:
+    FILE*                                       file_descriptor_;
+    uint64_t                                    file_offset_;
+    format::CompressionType                     compression_type_;
+    DecompressionContext                        prefetch_context_;
+    std::shared_ptr<const std::vector<uint8_t>> dictionary_;
+    std::deque<Block>                           blocks_; // Allocated on demand, beyond block_count_ when preloading.
+    std::vector<Block*>                         free_blocks_;
+    std::deque<Block*>                          ready_blocks_;
+    std::deque<Block*>                          pending_blocks_;
+    size_t                                      block_count_;
+    size_t                                      buffered_size_;
+    size_t                                      max_buffered_size_;
+    uint64_t                                    read_offset_; // End of the last ready block.
+    uint64_t                                    preload_end_offset_;
+    size_t                                      max_preload_size_;
+    size_t                                      pending_count_; // Ready blocks waiting for a worker.
+    uint32_t                                    worker_count_;
+    util::HugePageBuffer::Mode                  huge_page_mode_;
+    bool                                        finished_;
+    bool                                        error_;
+    bool                                        shutdown_;
+    mutable std::mutex                          mutex_;
+    std::condition_variable                     free_block_available_;
+    std::condition_variable                     ready_block_available_;
+    std::condition_variable                     pending_block_available_;
+    std::condition_variable                     preload_progress_;
+    std::thread                                 prefetch_thread_;
+    std::vector<std::thread>                    worker_threads_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_PREFETCHER_H
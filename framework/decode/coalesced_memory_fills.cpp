@@ -0,0 +1,105 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/coalesced_memory_fills.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+void CoalescedMemoryFills::Add(uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    assert(data != nullptr);
+
+    uint64_t end = offset + size;
+
+    // Find the first pending range that overlaps or touches the new range.
+    auto first = ranges_.upper_bound(offset);
+    if (first != ranges_.begin())
+    {
+        auto prev = std::prev(first);
+        if ((prev->first + prev->second.size()) >= offset)
+        {
+            first = prev;
+        }
+    }
+
+    uint64_t merged_start = offset;
+    uint64_t merged_end   = end;
+    auto     last         = first;
+
+    while ((last != ranges_.end()) && (last->first <= end))
+    {
+        merged_start = std::min(merged_start, last->first);
+        merged_end   = std::max(merged_end, last->first + static_cast<uint64_t>(last->second.size()));
+        ++last;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, merged_end - merged_start);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+    if (first == last)
+    {
+        ranges_.emplace_hint(last, offset, std::vector<uint8_t>(data, data + static_cast<size_t>(size)));
+        return;
+    }
+
+    // Reuse the storage of the first range when the merged range starts with it, which is the common case of fills
+    // written in increasing offset order.
+    std::vector<uint8_t> merged;
+    auto                 copy_begin = first;
+
+    if (first->first == merged_start)
+    {
+        merged = std::move(first->second);
+        ++copy_begin;
+    }
+
+    merged.resize(static_cast<size_t>(merged_end - merged_start));
+
+    for (auto iter = copy_begin; iter != last; ++iter)
+    {
+        size_t range_offset = static_cast<size_t>(iter->first - merged_start);
+        util::platform::MemoryCopy(
+            merged.data() + range_offset, merged.size() - range_offset, iter->second.data(), iter->second.size());
+    }
+
+    size_t data_offset = static_cast<size_t>(offset - merged_start);
+    util::platform::MemoryCopy(
+        merged.data() + data_offset, merged.size() - data_offset, data, static_cast<size_t>(size));
+
+    ranges_.erase(first, last);
+    ranges_.emplace_hint(last, merged_start, std::move(merged));
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,70 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_COALESCED_MEMORY_FILLS_H
+#define GFXRECON_DECODE_COALESCED_MEMORY_FILLS_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Buffers the data from a sequence of memory fill commands for one memory object, merging ranges that overlap or are
+// adjacent so that they can be written with as few calls as possible.  Data from later fills replaces data from
+// earlier fills where they overlap.
+class CoalescedMemoryFills
+{
+  public:
+    void Add(uint64_t offset, uint64_t size, const uint8_t* data);
+
+    bool IsEmpty() const { return ranges_.empty(); }
+
+    size_t GetRangeCount() const { return ranges_.size(); }
+
+    // Calls write(offset, size, data) for each merged range, in offset order, and then clears the pending ranges.
+    template <typename WriteFunction>
+    void Apply(WriteFunction write)
+    {
+        for (const auto& entry : ranges_)
+        {
+            write(entry.first, static_cast<uint64_t>(entry.second.size()), entry.second.data());
+        }
+
+        ranges_.clear();
+    }
+
+    void Clear() { ranges_.clear(); }
+
+  private:
+    // Pending data, keyed by the offset of the range.  Ranges never overlap or touch.
+    std::map<uint64_t, std::vector<uint8_t>> ranges_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_COALESCED_MEMORY_FILLS_H
@@ -0,0 +1,162 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/command_buffer_call_executor.h"
+
+#include "decode/decode_allocator.h"
+#include "util/thread_placement.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+CommandBufferCallExecutor::CommandBufferCallExecutor(size_t max_threads) :
+    max_threads_(std::max(max_threads, static_cast<size_t>(1))), pending_calls_(0), shutdown_(false)
+{}
+
+CommandBufferCallExecutor::~CommandBufferCallExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    for (auto& worker : workers_)
+    {
+        worker->call_available.notify_one();
+        worker->thread.join();
+    }
+}
+
+void CommandBufferCallExecutor::Submit(format::ThreadId thread_id, DecodedCall* call)
+{
+    assert(call != nullptr);
+
+    Worker* worker = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto entry = thread_workers_.find(thread_id);
+        if (entry != thread_workers_.end())
+        {
+            worker = entry->second;
+        }
+        else
+        {
+            if (workers_.size() < max_threads_)
+            {
+                workers_.emplace_back(std::make_unique<Worker>());
+                worker         = workers_.back().get();
+                worker->thread = std::thread(&CommandBufferCallExecutor::ExecuteCalls, this, worker);
+            }
+            else
+            {
+                // Captured threads are distributed across the workers in the order that they are first seen.
+                worker = workers_[thread_workers_.size() % workers_.size()].get();
+            }
+
+            thread_workers_.emplace(thread_id, worker);
+        }
+
+        worker->calls.push_back(call);
+        ++pending_calls_;
+    }
+
+    worker->call_available.notify_one();
+}
+
+void CommandBufferCallExecutor::Wait()
+{
+    std::exception_ptr exception;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        calls_complete_.wait(lock, [this]() { return (pending_calls_ == 0); });
+
+        std::swap(exception, exception_);
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void CommandBufferCallExecutor::ExecuteCalls(Worker* worker)
+{
+    util::thread_placement::ApplyThreadRole(util::thread_placement::kWorkerThread);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        worker->call_available.wait(lock, [worker, this]() { return (!worker->calls.empty() || shutdown_); });
+
+        if (shutdown_)
+        {
+            break;
+        }
+
+        DecodedCall* call = worker->calls.front();
+        worker->calls.pop_front();
+
+        // Calls that follow a failed call are discarded.
+        if (!exception_)
+        {
+            lock.unlock();
+
+            std::exception_ptr exception;
+
+            DecodeAllocator::Begin();
+
+            try
+            {
+                call->Execute();
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            DecodeAllocator::End();
+
+            lock.lock();
+
+            if (exception && !exception_)
+            {
+                exception_ = exception;
+            }
+        }
+
+        --pending_calls_;
+        if (pending_calls_ == 0)
+        {
+            calls_complete_.notify_all();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
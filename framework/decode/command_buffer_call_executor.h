@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_COMMAND_BUFFER_CALL_EXECUTOR_H
+#define GFXRECON_DECODE_COMMAND_BUFFER_CALL_EXECUTOR_H
+
+#include "decode/decoded_call.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Executes decoded command buffer recording calls on worker threads, so that command buffers that were recorded in
+// parallel by the captured application are also recorded in parallel by replay.  Each captured thread is assigned to
+// one worker thread, which executes the captured thread's calls in order.  When there are more captured threads than
+// workers, a worker is shared by multiple captured threads.
+//
+// Calls that are executed by the workers must only access consumer state that is not modified by other command buffer
+// calls.  The caller synchronizes with the workers with Wait() before executing any other calls, such as command
+// buffer begin and end, queue submission, and object creation and destruction calls, which are the points where the
+// captured application synchronized its own command buffer recording threads.
+class CommandBufferCallExecutor
+{
+  public:
+    CommandBufferCallExecutor(size_t max_threads);
+
+    // Waits for the worker threads to finish the current call.  Calls that have not been started are discarded.
+    ~CommandBufferCallExecutor();
+
+    // Queues a call for execution by the worker thread that is assigned to the captured thread.  The call must remain
+    // valid until Wait() returns.
+    void Submit(format::ThreadId thread_id, DecodedCall* call);
+
+    // Waits for the worker threads to execute all of the submitted calls.  If a call raised an exception, the remaining
+    // calls are discarded and the exception is rethrown.
+    void Wait();
+
+  private:
+    struct Worker
+    {
+        std::deque<DecodedCall*> calls;
+        std::condition_variable  call_available;
+        std::thread              thread;
+    };
+
+  private:
+    void ExecuteCalls(Worker* worker);
+
+  private:
+    size_t                                        max_threads_;
+    std::vector<std::unique_ptr<Worker>>          workers_;
+    std::unordered_map<format::ThreadId, Worker*> thread_workers_; // Worker assigned to each captured thread.
+    size_t                                        pending_calls_;  // Submitted calls that have not been executed.
+    std::exception_ptr                            exception_;      // First exception raised by a call.
+    bool                                          shutdown_;
+    std::mutex                                    mutex_;
+    std::condition_variable                       calls_complete_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_COMMAND_BUFFER_CALL_EXECUTOR_H
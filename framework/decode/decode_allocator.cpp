@@ -23,16 +23,18 @@
 
 #include "decode/decode_allocator.h"
 
+#include "util/memory_block_pool.h"
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-DecodeAllocator* DecodeAllocator::instance_{ nullptr };
+thread_local std::unique_ptr<DecodeAllocator> DecodeAllocator::instance_;
 
 void DecodeAllocator::Begin()
 {
     if (instance_ == nullptr)
     {
-        instance_ = new DecodeAllocator();
+        instance_.reset(new DecodeAllocator());
     }
     assert(!instance_->can_allocate_);
     instance_->can_allocate_ = true;
@@ -49,12 +51,44 @@ void DecodeAllocator::FreeSystemMemory()
 {
     assert((instance_ != nullptr) && !instance_->can_allocate_);
     instance_->allocator_.Clear(true);
+    util::MemoryBlockPool::Trim();
 }
 
 void DecodeAllocator::DestroyInstance()
 {
-    delete instance_;
-    instance_ = nullptr;
+    instance_.reset();
+}
+
+std::unique_ptr<DecodeAllocator> DecodeAllocator::ExchangeInstance(std::unique_ptr<DecodeAllocator> instance)
+{
+    std::swap(instance_, instance);
+    return instance;
+}
+
+std::unique_ptr<DecodeAllocator> DecodeAllocator::DetachInstance()
+{
+    assert((instance_ != nullptr) && instance_->can_allocate_);
+    std::unique_ptr<DecodeAllocator> instance = std::move(instance_);
+    Begin();
+    return instance;
+}
+
+size_t DecodeAllocator::GetAllocatedSize()
+{
+    return (instance_ != nullptr) ? instance_->allocator_.GetAllocatedSize() : 0;
+}
+
+bool DecodeAllocator::GetStatistics(util::MonotonicAllocator::Statistics* statistics)
+{
+    assert(statistics != nullptr);
+
+    if (instance_ != nullptr)
+    {
+        *statistics = instance_->allocator_.GetStatistics();
+        return true;
+    }
+
+    return false;
 }
 
 GFXRECON_END_NAMESPACE(decode)
@@ -27,9 +27,15 @@
 #include "util/defines.h"
 #include "util/monotonic_allocator.h"
 
+#include <memory>
+#include <utility>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Each thread that decodes API calls has its own allocator instance, which is created by the thread's first call to
+// Begin and destroyed by DestroyInstance or when the thread exits.  Instances acquire their system memory from the
+// thread's util::MemoryBlockPool, so the blocks of a destroyed instance are recycled by the next instance.
 class DecodeAllocator
 {
   public:
@@ -44,22 +50,49 @@ class DecodeAllocator
         return instance_->can_allocate_ ? instance_->allocator_.Allocate<T>(count, initialize) : nullptr;
     }
 
-    // End must be called to release any allocations made since last call to Begin. Currently allocated system memory
-    // is re-used for future allocations.
+    // Allocates and constructs a single object with the specified arguments. The object is destroyed by End.
+    template <typename T, typename... Args>
+    static T* Construct(Args&&... args)
+    {
+        assert((instance_ != nullptr) && instance_->can_allocate_);
+        return instance_->can_allocate_ ? instance_->allocator_.Construct<T>(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // End must be called to release any allocations made since last call to Begin. Currently allocated system memory,
+    // including the largest oversized allocations, is re-used for future allocations.
     static void End();
 
-    // Free system memory blocks. Must not be called between Begin and End
+    // Free system memory blocks, including the free blocks of the thread's block pool. Must not be called between Begin
+    // and End
     static void FreeSystemMemory();
 
     // Destroy the allocator instance. This will also frees all allocated memory.
     static void DestroyInstance();
 
+    // Replaces the calling thread's allocator instance with the specified instance, which may be nullptr, and returns
+    // the previous instance.  Allows a thread to keep the allocations of several Begin/End scopes alive at the same
+    // time, by decoding each scope with its own instance.  An exchanged instance retains its Begin/End state.
+    static std::unique_ptr<DecodeAllocator> ExchangeInstance(std::unique_ptr<DecodeAllocator> instance);
+
+    // Removes the calling thread's allocator instance, which must be between Begin and End, and begins a new scope with
+    // a new instance.  The allocations of the current scope remain valid until the returned instance is destroyed,
+    // which may be done from any thread, while the caller's matching call to End releases the new scope instead.
+    static std::unique_ptr<DecodeAllocator> DetachInstance();
+
+    // Returns the number of bytes allocated by the calling thread's allocator instance since the last call to Begin.
+    static size_t GetAllocatedSize();
+
+    // Returns the statistics of the calling thread's allocator instance, or false if the thread has no instance.
+    static bool GetStatistics(util::MonotonicAllocator::Statistics* statistics);
+
   private:
-    DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false) {}
+    DecodeAllocator() : allocator_(kAllocatorBlockSize, kMaxRetainedOversized, true), can_allocate_(false) {}
 
   private:
-    static const size_t     kAllocatorBlockSize{ 64 * 1024 };
-    static DecodeAllocator* instance_;
+    static const size_t kAllocatorBlockSize{ 64 * 1024 };
+    static const size_t kMaxRetainedOversized{ 4 };
+
+    static thread_local std::unique_ptr<DecodeAllocator> instance_;
 
     util::MonotonicAllocator allocator_;
     bool                     can_allocate_;
@@ -0,0 +1,57 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/decode_context.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+thread_local const DecodeContext* DecodeContext::current_ = nullptr;
+
+void DecodeContext::SetBlobData(uint64_t blob_id, const uint8_t* data, size_t size)
+{
+    assert((data != nullptr) || (size == 0));
+
+    blobs_[blob_id].assign(data, data + size);
+}
+
+const std::vector<uint8_t>* DecodeContext::GetBlobData(uint64_t blob_id) const
+{
+    auto entry = blobs_.find(blob_id);
+
+    while ((entry == blobs_.end()) && skipped_blob_loader_ && skipped_blob_loader_())
+    {
+        entry = blobs_.find(blob_id);
+    }
+
+    if (entry != blobs_.end())
+    {
+        return &entry->second;
+    }
+
+    return nullptr;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,100 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_DECODE_CONTEXT_H
+#define GFXRECON_DECODE_DECODE_CONTEXT_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// State of a capture file that determines how its API call parameters are decoded, such as the handle ID encoding and
+// the data of the kSetBlobDataCommand blocks.  Each file processor owns a context, which it makes current for the
+// calling thread while it processes blocks, so that the decoders of several files can run on different threads of the
+// same process.
+class DecodeContext
+{
+  public:
+    // Makes a context current for the calling thread until the scope ends, when the previous context is restored.
+    class Scope
+    {
+      public:
+        Scope(const DecodeContext* context) : previous_(current_) { current_ = context; }
+
+        ~Scope() { current_ = previous_; }
+
+        Scope(const Scope&) = delete;
+
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        const DecodeContext* previous_;
+    };
+
+  public:
+    DecodeContext() : varint_handle_ids_(false) {}
+
+    // Returns the context of the file that the calling thread is decoding, or nullptr when no file is being decoded.
+    static const DecodeContext* GetCurrent() { return current_; }
+
+    // Selects the handle ID encoding of the file, from its kHandleIdEncoding file option.
+    void SetHandleIdEncoding(format::HandleIdEncoding handle_id_encoding)
+    {
+        varint_handle_ids_ = (handle_id_encoding == format::HandleIdEncoding::kVarintHandleIds);
+    }
+
+    bool IsVarintHandleIds() const { return varint_handle_ids_; }
+
+    // Stores the data of a kSetBlobDataCommand block, for the arrays that are encoded with the blob ID in place of
+    // their data.  Replaces the data of a blob with the same ID.
+    void SetBlobData(uint64_t blob_id, const uint8_t* data, size_t size);
+
+    // Returns the data of a blob, or nullptr when the blob has not been read from the file.
+    const std::vector<uint8_t>* GetBlobData(uint64_t blob_id) const;
+
+    // Sets the function that loads the blobs of the next batch that a seek skipped, which GetBlobData() calls until the
+    // blob is found or the function returns false.
+    void SetSkippedBlobLoader(std::function<bool()> loader) { skipped_blob_loader_ = std::move(loader); }
+
+    void Clear() { blobs_.clear(); }
+
+  private:
+    static thread_local const DecodeContext* current_;
+
+    bool                                               varint_handle_ids_;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> blobs_;
+    std::function<bool()>                              skipped_blob_loader_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_DECODE_CONTEXT_H
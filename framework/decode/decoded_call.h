@@ -0,0 +1,61 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_DECODED_CALL_H
+#define GFXRECON_DECODE_DECODED_CALL_H
+
+#include "util/defines.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// An API call or meta-data command whose parameters have already been decoded, waiting to be passed to the consumers.
+// Calls are constructed with DecodeAllocator::Construct, so the call and its decoded parameters are released together
+// when the allocator that they were decoded with is cleared.
+class DecodedCall
+{
+  public:
+    virtual ~DecodedCall() {}
+
+    // Passes the decoded parameters to the consumers.  Calls are executed once, unless they are kept by a
+    // DecodedCallProgram, which executes them again with the same decoded parameters.
+    virtual void Execute() = 0;
+};
+
+// Receives the decoded calls from a decoder that has been set to record calls instead of passing them to the consumers
+// as they are decoded.  The calls are received in decode order.
+class DecodedCallRecorder
+{
+  public:
+    virtual ~DecodedCallRecorder() {}
+
+    virtual void Record(DecodedCall* call) = 0;
+
+    // Receives a call that only records commands to a command buffer.  Recorders may execute these calls concurrently
+    // with the command buffer calls of other captured threads.
+    virtual void RecordCommandBufferCall(DecodedCall* call) { Record(call); }
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_DECODED_CALL_H
@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/decoded_call_program.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+DecodedCallProgram::DecodedCallProgram() : decoded_size_(0), recording_(false) {}
+
+DecodedCallProgram::~DecodedCallProgram()
+{
+    if (recording_)
+    {
+        EndRecording();
+    }
+}
+
+void DecodedCallProgram::BeginRecording()
+{
+    assert(!recording_ && calls_.empty());
+
+    // The program's instance is created by Begin.
+    allocator_ = DecodeAllocator::ExchangeInstance(nullptr);
+    DecodeAllocator::Begin();
+
+    recording_ = true;
+}
+
+void DecodedCallProgram::Record(DecodedCall* call)
+{
+    assert(recording_ && (call != nullptr));
+
+    calls_.push_back(call);
+
+    auto program_allocator = DecodeAllocator::ExchangeInstance(std::move(allocator_));
+
+    DecodeAllocator::Begin();
+    call->Execute();
+    DecodeAllocator::End();
+
+    allocator_ = DecodeAllocator::ExchangeInstance(std::move(program_allocator));
+}
+
+void DecodedCallProgram::EndRecording()
+{
+    assert(recording_);
+
+    decoded_size_ = DecodeAllocator::GetAllocatedSize();
+    allocator_    = DecodeAllocator::ExchangeInstance(std::move(allocator_));
+    recording_    = false;
+
+    calls_.resize(frame_ends_.empty() ? 0 : frame_ends_.back());
+}
+
+void DecodedCallProgram::ExecuteFrame(size_t frame_index)
+{
+    assert(!recording_ && (frame_index < frame_ends_.size()));
+
+    size_t first_call = (frame_index > 0) ? frame_ends_[frame_index - 1] : 0;
+    size_t end_call   = frame_ends_[frame_index];
+
+    for (size_t i = first_call; i < end_call; ++i)
+    {
+        DecodeAllocator::Begin();
+        calls_[i]->Execute();
+        DecodeAllocator::End();
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,86 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_DECODED_CALL_PROGRAM_H
+#define GFXRECON_DECODE_DECODED_CALL_PROGRAM_H
+
+#include "decode/decode_allocator.h"
+#include "decode/decoded_call.h"
+#include "util/defines.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Keeps the decoded calls of a range of frames, so that the range can be executed again without reading and decoding
+// it from the file.  Calls are executed as they are recorded, and are decoded with the program's own DecodeAllocator
+// instance, which holds the decoded parameters until the program is destroyed.  Each execution of a call, including
+// the execution when it is recorded, is made within its own allocation scope of the calling thread's instance, so the
+// output data that the consumers allocate for a call is released after each execution.
+class DecodedCallProgram : public DecodedCallRecorder
+{
+  public:
+    DecodedCallProgram();
+
+    ~DecodedCallProgram();
+
+    // Replaces the calling thread's DecodeAllocator instance with the program's instance and begins the allocation
+    // scope that holds the recorded calls, which lasts until the program is destroyed.  Calls must be decoded without
+    // their own allocation scopes until EndRecording() is called.
+    void BeginRecording();
+
+    // Executes the call within an allocation scope of the recording thread's DecodeAllocator instance, and appends it
+    // to the current frame of the program.
+    virtual void Record(DecodedCall* call) override;
+
+    // Ends the current frame of the program.
+    void EndFrame() { frame_ends_.push_back(calls_.size()); }
+
+    // Restores the calling thread's DecodeAllocator instance.  Calls recorded after the last call to EndFrame() are
+    // discarded.
+    void EndRecording();
+
+    bool IsRecording() const { return recording_; }
+
+    size_t GetFrameCount() const { return frame_ends_.size(); }
+
+    // Returns the number of bytes that hold the decoded calls of the program.
+    size_t GetDecodedSize() const { return decoded_size_; }
+
+    // Executes the calls of a recorded frame again, in the order that they were recorded.  Frames are numbered from 0.
+    void ExecuteFrame(size_t frame_index);
+
+  private:
+    std::unique_ptr<DecodeAllocator> allocator_; // Exchanged with the recording thread's instance while recording.
+    std::vector<DecodedCall*>        calls_;
+    std::vector<size_t>              frame_ends_; // Index of the call that follows the last call of each frame.
+    size_t                           decoded_size_;
+    bool                             recording_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_DECODED_CALL_PROGRAM_H
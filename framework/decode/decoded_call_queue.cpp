@@ -0,0 +1,260 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/decoded_call_queue.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const size_t DecodedCallQueue::kDefaultBatchCount;
+const size_t DecodedCallQueue::kDefaultBatchCallCount;
+const size_t DecodedCallQueue::kDefaultBatchSize;
+
+DecodedCallQueue::DecodedCallQueue(size_t batch_count, size_t max_batch_calls, size_t max_batch_size) :
+    batches_(std::max(batch_count, static_cast<size_t>(1))), current_batch_(nullptr),
+    max_batch_calls_(std::max(max_batch_calls, static_cast<size_t>(1))), max_batch_size_(max_batch_size),
+    thread_id_(0), finished_(false), stopped_(false)
+{
+    for (auto& batch : batches_)
+    {
+        free_batches_.push_back(&batch);
+    }
+}
+
+DecodedCallQueue::~DecodedCallQueue()
+{
+    Stop();
+}
+
+void DecodedCallQueue::BeginBatch()
+{
+    assert(current_batch_ == nullptr);
+
+    Batch* batch = nullptr;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        free_batch_available_.wait(lock, [this]() { return (!free_batches_.empty() || stopped_); });
+
+        if (!stopped_)
+        {
+            batch = free_batches_.back();
+            free_batches_.pop_back();
+        }
+    }
+
+    if (batch != nullptr)
+    {
+        decode_allocator_ = DecodeAllocator::ExchangeInstance(std::move(batch->allocator));
+
+        if (batch->allocator_active)
+        {
+            // Release the calls of the batch's previous use, which have been executed.
+            DecodeAllocator::End();
+            batch->allocator_active = false;
+        }
+
+        batch->calls.clear();
+        current_batch_ = batch;
+    }
+
+    // When the queue has been stopped, the calls are decoded with the thread's own allocator and discarded.
+    DecodeAllocator::Begin();
+}
+
+void DecodedCallQueue::Record(DecodedCall* call)
+{
+    AddCall(call, false);
+}
+
+void DecodedCallQueue::RecordCommandBufferCall(DecodedCall* call)
+{
+    AddCall(call, true);
+}
+
+void DecodedCallQueue::AddCall(DecodedCall* call, bool command_buffer_call)
+{
+    assert(call != nullptr);
+
+    if (current_batch_ != nullptr)
+    {
+        current_batch_->calls.push_back({ call, thread_id_, command_buffer_call });
+
+        if ((current_batch_->calls.size() >= max_batch_calls_) ||
+            (DecodeAllocator::GetAllocatedSize() >= max_batch_size_))
+        {
+            SendBatch(nullptr);
+            BeginBatch();
+        }
+    }
+}
+
+void DecodedCallQueue::EndBatch(const FrameState* frame_state)
+{
+    if (current_batch_ != nullptr)
+    {
+        SendBatch(frame_state);
+    }
+    else
+    {
+        DecodeAllocator::End();
+    }
+}
+
+bool DecodedCallQueue::ExecuteFrame(FrameState* frame_state)
+{
+    assert(frame_state != nullptr);
+
+    bool frame_end = false;
+
+    while (!frame_end)
+    {
+        Batch* batch = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_batch_available_.wait(lock, [this]() { return (!ready_batches_.empty() || finished_ || stopped_); });
+
+            if (stopped_ || ready_batches_.empty())
+            {
+                return false;
+            }
+
+            batch = ready_batches_.front();
+            ready_batches_.pop_front();
+        }
+
+        auto executor = command_buffer_call_executor_.get();
+
+        for (const auto& entry : batch->calls)
+        {
+            if (entry.command_buffer_call && (executor != nullptr))
+            {
+                executor->Submit(entry.thread_id, entry.call);
+            }
+            else
+            {
+                if (executor != nullptr)
+                {
+                    executor->Wait();
+                }
+
+                DecodeAllocator::Begin();
+                entry.call->Execute();
+                DecodeAllocator::End();
+            }
+        }
+
+        // The batch's calls must not be released while they are being executed by the workers.
+        if (executor != nullptr)
+        {
+            executor->Wait();
+        }
+
+        // The calls are destroyed by the decode thread, when it reuses the batch.
+        batch->calls.clear();
+
+        frame_end = batch->frame_end;
+        if (frame_end)
+        {
+            *frame_state = batch->frame_state;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_batches_.push_back(batch);
+        }
+
+        free_batch_available_.notify_one();
+    }
+
+    return true;
+}
+
+void DecodedCallQueue::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+
+        // Batches that have not been executed are released for reuse by a decode thread that is waiting for a batch.
+        for (auto batch : ready_batches_)
+        {
+            batch->calls.clear();
+            free_batches_.push_back(batch);
+        }
+
+        ready_batches_.clear();
+    }
+
+    free_batch_available_.notify_all();
+    ready_batch_available_.notify_all();
+
+    // Waits for the workers to finish their current calls, so that the consumers can be destroyed after the queue has
+    // been stopped.
+    command_buffer_call_executor_.reset();
+}
+
+void DecodedCallQueue::SendBatch(const FrameState* frame_state)
+{
+    assert(current_batch_ != nullptr);
+
+    Batch* batch = current_batch_;
+
+    batch->frame_end = (frame_state != nullptr);
+    if (batch->frame_end)
+    {
+        batch->frame_state = *frame_state;
+    }
+
+    // The batch's allocator keeps the scope that the calls were decoded with until the batch is reused.
+    batch->allocator        = DecodeAllocator::ExchangeInstance(std::move(decode_allocator_));
+    batch->allocator_active = true;
+    current_batch_          = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (stopped_)
+        {
+            batch->calls.clear();
+            free_batches_.push_back(batch);
+        }
+        else
+        {
+            ready_batches_.push_back(batch);
+
+            if (batch->frame_end && !batch->frame_state.more_frames)
+            {
+                finished_ = true;
+            }
+        }
+    }
+
+    ready_batch_available_.notify_one();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
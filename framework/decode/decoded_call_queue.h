@@ -0,0 +1,163 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_DECODED_CALL_QUEUE_H
+#define GFXRECON_DECODE_DECODED_CALL_QUEUE_H
+
+#include "decode/command_buffer_call_executor.h"
+#include "decode/decode_allocator.h"
+#include "decode/decoded_call.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Passes decoded calls from a decode thread to the thread that executes them.  Calls are recorded into a fixed pool of
+// batches, where each batch has its own DecodeAllocator instance that holds the decoded parameters of the batch's
+// calls until the batch has been executed.  The decode thread waits for a batch to be executed when all of the batches
+// are in use, and a batch is sent to the execute thread when it reaches the end of a frame or exceeds its call count
+// or decoded size limit.  Batches are executed in the order that they were recorded.
+//
+// When a command buffer call executor has been set, command buffer recording calls are passed to the executor, to be
+// executed by the worker thread of the captured thread that the call was decoded for.  The execute thread waits for the
+// workers to finish before executing any other call, and before releasing a batch.
+class DecodedCallQueue : public DecodedCallRecorder
+{
+  public:
+    static const size_t kDefaultBatchCount     = 4;
+    static const size_t kDefaultBatchCallCount = 1024;
+    static const size_t kDefaultBatchSize      = 16 * 1024 * 1024;
+
+    // Processing state of the decode thread at the end of a frame, sent to the execute thread with the frame's last
+    // batch.
+    struct FrameState
+    {
+        bool     more_frames{ false }; // False when the frame was the last frame or processing failed.
+        uint32_t frame_number{ 0 };
+        uint64_t bytes_read{ 0 };
+        int32_t  error_state{ 0 };
+    };
+
+  public:
+    // A batch is sent to the execute thread when it contains max_batch_calls calls, or when the parameters that were
+    // decoded for it occupy more than max_batch_size bytes.
+    DecodedCallQueue(size_t batch_count     = kDefaultBatchCount,
+                     size_t max_batch_calls = kDefaultBatchCallCount,
+                     size_t max_batch_size  = kDefaultBatchSize);
+
+    ~DecodedCallQueue();
+
+    // Sets the executor for command buffer recording calls.  Must be called before the first call to ExecuteFrame().
+    void SetCommandBufferCallExecutor(std::unique_ptr<CommandBufferCallExecutor> executor)
+    {
+        command_buffer_call_executor_ = std::move(executor);
+    }
+
+    // Called from the decode thread to start recording a batch, waiting for a batch to be released by the execute
+    // thread when all batches are in use.  Replaces the calling thread's DecodeAllocator instance with the batch's
+    // instance and begins an allocation scope, which lasts until EndBatch() is called.  When the queue has been
+    // stopped, the calls that are recorded up to the call to EndBatch() are discarded.
+    void BeginBatch();
+
+    // Called from the decode thread to record a decoded call, which must have been constructed with the DecodeAllocator
+    // instance of the current batch.  Sends the current batch and begins a new batch when the current batch is full.
+    virtual void Record(DecodedCall* call) override;
+
+    // Called from the decode thread to record a decoded command buffer recording call for the captured thread that was
+    // set by the last call to SetThreadId().
+    virtual void RecordCommandBufferCall(DecodedCall* call) override;
+
+    // Called from the decode thread to set the captured thread of the calls that are recorded next.
+    void SetThreadId(format::ThreadId thread_id) { thread_id_ = thread_id; }
+
+    // Called from the decode thread to send the current batch to the execute thread and restore the calling thread's
+    // DecodeAllocator instance.  The frame state is provided when the batch completes a frame, and is nullptr
+    // otherwise.
+    void EndBatch(const FrameState* frame_state);
+
+    // Called from the execute thread to execute the recorded calls up to the end of the next frame, waiting for the
+    // batches to be decoded.  Each call is executed within its own allocation scope of the calling thread's
+    // DecodeAllocator instance.  Returns false without setting frame_state if the queue was stopped or all frames have
+    // already been executed.
+    bool ExecuteFrame(FrameState* frame_state);
+
+    // Wakes both threads and discards the batches that have not been executed.  After the queue has been stopped,
+    // ExecuteFrame() returns false and recorded calls are discarded.  When a command buffer call executor has been set,
+    // the executor is destroyed, so the queue must then be stopped from the execute thread.
+    void Stop();
+
+    bool IsStopped() const { return stopped_; }
+
+  private:
+    struct RecordedCall
+    {
+        DecodedCall*     call;
+        format::ThreadId thread_id;
+        bool             command_buffer_call;
+    };
+
+    struct Batch
+    {
+        std::unique_ptr<DecodeAllocator> allocator;
+        bool                             allocator_active{ false }; // The allocator holds the previous batch's calls.
+        std::vector<RecordedCall>        calls;
+        bool                             frame_end{ false };
+        FrameState                       frame_state;
+    };
+
+  private:
+    void AddCall(DecodedCall* call, bool command_buffer_call);
+
+    void SendBatch(const FrameState* frame_state);
+
+  private:
+    std::vector<Batch>               batches_;
+    std::vector<Batch*>              free_batches_;
+    std::deque<Batch*>               ready_batches_;
+    Batch*                           current_batch_;    // Batch that is being recorded by the decode thread.
+    std::unique_ptr<DecodeAllocator> decode_allocator_; // Decode thread's allocator instance while a batch is active.
+    size_t                           max_batch_calls_;
+    size_t                           max_batch_size_;
+    format::ThreadId                 thread_id_;
+    bool                             finished_;          // The last frame has been sent to the execute thread.
+    std::atomic<bool>                stopped_;
+    std::mutex                       mutex_;
+    std::condition_variable          free_batch_available_;
+    std::condition_variable          ready_batch_available_;
+
+    // Declared after the batches, so that the workers are stopped before the calls that they execute are destroyed.
+    std::unique_ptr<CommandBufferCallExecutor> command_buffer_call_executor_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_DECODED_CALL_QUEUE_H
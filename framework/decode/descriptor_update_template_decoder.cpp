@@ -35,6 +35,20 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// The template handles are encoded as individual values rather than as a handle ID array, which differ when handle IDs
+// are varint encoded.
+static size_t DecodeHandleIdValues(const uint8_t* buffer, size_t buffer_size, format::HandleId* ids, size_t count)
+{
+    size_t bytes_read = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        bytes_read += ValueDecoder::DecodeHandleIdValue((buffer + bytes_read), (buffer_size - bytes_read), &ids[i]);
+    }
+
+    return bytes_read;
+}
+
 DescriptorUpdateTemplateDecoder::DescriptorUpdateTemplateDecoder() :
     template_memory_(nullptr), decoded_image_info_(nullptr), decoded_buffer_info_(nullptr),
     decoded_texel_buffer_view_handle_ids_(nullptr), image_info_count_(0), buffer_info_count_(0),
@@ -101,10 +115,10 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
             decoded_texel_buffer_view_handle_ids_ =
                 DecodeAllocator::Allocate<format::HandleId>(texel_buffer_view_count_);
 
-            bytes_read += ValueDecoder::DecodeHandleIdArray((buffer + bytes_read),
-                                                            (buffer_size - bytes_read),
-                                                            decoded_texel_buffer_view_handle_ids_,
-                                                            texel_buffer_view_count_);
+            bytes_read += DecodeHandleIdValues((buffer + bytes_read),
+                                               (buffer_size - bytes_read),
+                                               decoded_texel_buffer_view_handle_ids_,
+                                               texel_buffer_view_count_);
         }
 
         // While there are remaining unread bytes in the buffer, decode the descriptor types which are optional in the
@@ -139,10 +153,10 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
                     decoded_acceleration_structure_khr_handle_ids_ =
                         DecodeAllocator::Allocate<format::HandleId>(acceleration_structure_khr_count_);
 
-                    bytes_read += ValueDecoder::DecodeHandleIdArray((buffer + bytes_read),
-                                                                    (buffer_size - bytes_read),
-                                                                    decoded_acceleration_structure_khr_handle_ids_,
-                                                                    acceleration_structure_khr_count_);
+                    bytes_read += DecodeHandleIdValues((buffer + bytes_read),
+                                                       (buffer_size - bytes_read),
+                                                       decoded_acceleration_structure_khr_handle_ids_,
+                                                       acceleration_structure_khr_count_);
                 }
                 else
                 {
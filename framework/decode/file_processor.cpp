@@ -24,45 +24,121 @@
 #include "decode/file_processor.h"
 
 #include "decode/decode_allocator.h"
+#include "decode/pnext_node.h"
+#include "decode/resource_init_data_reader.h"
+#include "decode/seek_index.h"
 #include "format/format_util.h"
 #include "util/compressor.h"
+#include "util/file_input_stream.h"
+#include "util/instrumentation.h"
 #include "util/logging.h"
+#include "util/memory_block_pool.h"
 #include "util/platform.h"
+#include "util/read_ahead_input_stream.h"
+#include "util/socket_input_stream.h"
+#include "util/thread_placement.h"
 
 #include <cassert>
+#include <cinttypes>
+#include <cstring>
+#include <limits>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Smallest resource initialization data that is read directly to memory provided by the decoder.
+const size_t kMinDestinationReadSize = 1024 * 1024;
+
+// Amount of processed memory mapped file data that accumulates before its pages are released.
+const uint64_t kMappedFileReleaseSize = 32 * 1024 * 1024;
+
 FileProcessor::FileProcessor() :
-    file_header_{}, file_descriptor_(nullptr), current_frame_number_(0), bytes_read_(0),
-    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), compressor_(nullptr)
-{}
+    file_header_{}, stream_input_(false), current_frame_number_(0), bytes_read_(0), block_count_(0),
+    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), compressor_(nullptr),
+    block_compressor_(nullptr), batch_size_(0), batch_read_offset_(0), batch_file_offset_(0), previous_batch_size_(0),
+    previous_batch_file_offset_(0), use_mapped_file_(false), mapped_release_offset_(0), use_prefetch_thread_(false),
+    decompression_threads_(0), huge_page_mode_(util::HugePageBuffer::kModeNone), preload_first_frame_(0),
+    preload_last_frame_(0), max_preload_size_(0), prefetch_block_(nullptr), prefetch_block_offset_(0),
+    parameter_data_(nullptr), seek_index_loaded_(false), block_limit_offset_(0),
+    use_decode_thread_(false), command_buffer_threads_(0), defer_resource_init_data_(false), memory_report_(nullptr),
+    call_program_frame_(0), call_program_first_frame_(0)
+{
+    decode_context_.SetSkippedBlobLoader([this]() { return LoadSkippedBatch(); });
+}
 
 FileProcessor::~FileProcessor()
 {
+    // Stop the decode and prefetch threads before releasing the compressors and files.
+    JoinDecodeThread();
+    prefetcher_.reset();
+    call_program_.reset();
+
     if (nullptr != compressor_)
     {
         delete compressor_;
         compressor_ = nullptr;
     }
 
-    if (file_descriptor_)
+    input_stream_.reset();
+
+    util::MonotonicAllocator::Statistics allocator_statistics;
+    if (DecodeAllocator::GetStatistics(&allocator_statistics))
     {
-        fclose(file_descriptor_);
+        GFXRECON_LOG_DEBUG("Decode allocator high-water mark: %" PRIuPTR " bytes, with %" PRIuPTR
+                           " bytes of system memory (%" PRIu64 " system allocations)",
+                           allocator_statistics.high_water_mark,
+                           allocator_statistics.max_system_memory_size,
+                           allocator_statistics.system_allocation_count);
     }
 
     DecodeAllocator::DestroyInstance();
+
+    util::MemoryBlockPool::Statistics pool_statistics;
+    if (util::MemoryBlockPool::GetStatistics(&pool_statistics) && (pool_statistics.acquire_count > 0))
+    {
+        GFXRECON_LOG_DEBUG("Memory block pool recycled %" PRIu64 " of %" PRIu64
+                           " block acquisitions, retaining up to %" PRIuPTR " bytes",
+                           pool_statistics.reuse_count,
+                           pool_statistics.acquire_count,
+                           pool_statistics.max_retained_size);
+    }
+}
+
+void FileProcessor::SetHugePageMode(util::HugePageBuffer::Mode mode)
+{
+    huge_page_mode_ = mode;
+    parameter_buffer_.SetMode(mode);
+    compressed_parameter_buffer_.SetMode(mode);
 }
 
 bool FileProcessor::Initialize(const std::string& filename)
 {
     bool success = false;
 
-    int32_t result = util::platform::FileOpen(&file_descriptor_, filename.c_str(), "rb");
+    stream_input_ = (filename == "-") || util::SocketInputStream::IsSocketAddress(filename);
+
+    if (use_mapped_file_ && stream_input_)
+    {
+        GFXRECON_LOG_WARNING("Streamed input cannot be memory mapped; falling back to buffered reads");
+    }
+    else if (use_mapped_file_)
+    {
+        mapped_file_ = std::make_unique<util::MappedFile>();
+
+        if (!mapped_file_->Open(filename))
+        {
+            GFXRECON_LOG_WARNING("Failed to memory map file %s; falling back to buffered file reads", filename.c_str());
+            mapped_file_.reset();
+        }
+    }
+
+    if (mapped_file_ == nullptr)
+    {
+        input_stream_ = OpenInputStream(filename);
+    }
 
-    if ((result == 0) && (file_descriptor_ != nullptr))
+    if (IsFileOpen())
     {
         success = ProcessFileHeader();
 
@@ -70,11 +146,41 @@ bool FileProcessor::Initialize(const std::string& filename)
         {
             filename_    = filename;
             error_state_ = kErrorNone;
+            fill_memory_blocks_.clear();
+            skipped_batches_.clear();
+
+            batch_size_                 = 0;
+            batch_read_offset_          = 0;
+            batch_file_offset_          = 0;
+            previous_batch_size_        = 0;
+            previous_batch_file_offset_ = 0;
+            seek_index_loaded_          = false;
+            block_limit_offset_         = 0;
+
+            seek_index_.clear();
+
+            bool prefetch = use_prefetch_thread_ || (decompression_threads_ > 0) || IsPreloadEnabled();
+
+            if (prefetch && stream_input_)
+            {
+                GFXRECON_LOG_INFO("Block prefetching is not available for streamed input, which is read ahead instead");
+            }
+            else if (prefetch && !StartPrefetcher(bytes_read_))
+            {
+                GFXRECON_LOG_WARNING("Failed to start block prefetching; blocks will be read by the processing thread");
+            }
+            else if (prefetch)
+            {
+                PreloadFrames();
+            }
+        }
+        else if (mapped_file_ != nullptr)
+        {
+            mapped_file_.reset();
         }
         else
         {
-            fclose(file_descriptor_);
-            file_descriptor_ = nullptr;
+            input_stream_.reset();
         }
     }
     else
@@ -87,6 +193,50 @@ bool FileProcessor::Initialize(const std::string& filename)
 }
 
 bool FileProcessor::ProcessNextFrame()
+{
+    if (IsCallProgramReplaying())
+    {
+        call_program_->ExecuteFrame(call_program_frame_++);
+        ++current_frame_number_;
+        return true;
+    }
+
+    // The state snapshot is processed up to its block limit before the decode thread is started, and the decoders
+    // cannot record calls for both the decode thread and a call program.
+    if (use_decode_thread_ && !IsDecodeThreadActive() && (block_limit_offset_ == 0) && (call_program_ == nullptr))
+    {
+        StartDecodeThread();
+    }
+
+    if (IsDecodeThreadActive())
+    {
+        return ProcessDecodedFrame();
+    }
+
+    bool success = ReadNextFrame();
+
+    if (success && IsCallProgramRecording())
+    {
+        call_program_->EndFrame();
+    }
+
+    return success;
+}
+
+void FileProcessor::StopDecodeThread()
+{
+    JoinDecodeThread();
+
+    if (IsDecodeThreadActive())
+    {
+        for (auto decoder : decoders_)
+        {
+            decoder->SetCallRecorder(nullptr);
+        }
+    }
+}
+
+bool FileProcessor::ReadNextFrame()
 {
     bool success = IsFileValid();
 
@@ -97,11 +247,11 @@ bool FileProcessor::ProcessNextFrame()
     else
     {
         // If not EOF, determine reason for invalid state.
-        if (file_descriptor_ == nullptr)
+        if (!IsFileOpen())
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
-        else if (ferror(file_descriptor_))
+        else if (HasFileError())
         {
             error_state_ = kErrorReadingFile;
         }
@@ -119,102 +269,147 @@ bool FileProcessor::ProcessAllFrames()
         success = ProcessNextFrame();
     }
 
-    return (error_state_ == kErrorNone);
+    return (GetErrorState() == kErrorNone);
 }
 
-bool FileProcessor::ProcessFileHeader()
+bool FileProcessor::SeekToOffset(uint64_t offset)
 {
-    bool success = false;
+    if (IsDecodeThreadActive())
+    {
+        GFXRECON_LOG_ERROR("The read position cannot be changed after the decode thread has started");
+        return false;
+    }
 
-    if (ReadBytes(&file_header_, sizeof(file_header_)))
+    if (!IsFileOpen())
     {
-        success = format::ValidateFileHeader(file_header_);
+        error_state_ = kErrorInvalidFileDescriptor;
+        return false;
+    }
 
-        if (success)
+    if ((mapped_file_ != nullptr) && (offset > mapped_file_->GetSize()))
+    {
+        GFXRECON_LOG_ERROR("Seek offset %" PRIu64 " is beyond the end of the file", offset);
+        return false;
+    }
+
+    bool restart_prefetcher = (prefetcher_ != nullptr);
+
+    if (restart_prefetcher)
+    {
+        if (prefetch_block_ != nullptr)
         {
-            file_options_.resize(file_header_.num_options);
+            prefetcher_->ReleaseBlock(prefetch_block_);
+            prefetch_block_ = nullptr;
+        }
 
-            size_t option_data_size = file_header_.num_options * sizeof(format::FileOptionPair);
+        // The prefetch thread is restarted at the new position.  Until then, the skipped blocks are scanned from the
+        // file opened by Initialize(), which is not positioned by the prefetch thread.
+        prefetcher_.reset();
 
-            success = ReadBytes(file_options_.data(), option_data_size);
+        if (!input_stream_->Seek(bytes_read_))
+        {
+            GFXRECON_LOG_ERROR("Failed to seek to file offset %" PRIu64, bytes_read_);
+            error_state_ = kErrorSeekingFile;
+            return false;
+        }
+    }
 
-            if (success)
-            {
-                for (const auto& option : file_options_)
-                {
-                    switch (option.key)
-                    {
-                        case format::FileOption::kCompressionType:
-                            enabled_options_.compression_type = static_cast<format::CompressionType>(option.value);
-                            break;
-                        default:
-                            GFXRECON_LOG_WARNING("Ignoring unrecognized file header option %u", option.key);
-                            break;
-                    }
-                }
+    if ((offset > bytes_read_) && !ScanSkippedBlocks(offset))
+    {
+        GFXRECON_LOG_ERROR("Failed to read the blocks that are skipped by the seek to file offset %" PRIu64, offset);
 
-                compressor_ = format::CreateCompressor(enabled_options_.compression_type);
+        if (error_state_ == kErrorNone)
+        {
+            error_state_ = kErrorSeekingFile;
+        }
 
-                if ((compressor_ == nullptr) && (enabled_options_.compression_type != format::CompressionType::kNone))
-                {
-                    GFXRECON_LOG_ERROR("Failed to initialized file compression module (type = %u); replay of "
-                                       "compressed data will not be possible",
-                                       enabled_options_.compression_type);
-                    success      = false;
-                    error_state_ = kErrorUnsupportedCompressionType;
-                }
-            }
+        return false;
+    }
+
+    // The fill memory blocks and skipped batches at or after the new position are recorded again when they are read.
+    while (!skipped_batches_.empty())
+    {
+        SkippedBatchInfo& skipped_batch = skipped_batches_.back();
+
+        TruncateFillMemoryBlocks(&skipped_batch.next_blocks, offset);
+
+        if (!skipped_batch.next_blocks.empty() || (skipped_batch.offset < offset))
+        {
+            break;
         }
-        else
+
+        skipped_batches_.pop_back();
+    }
+
+    TruncateFillMemoryBlocks(&fill_memory_blocks_, offset);
+
+    // Discard any remaining batch data, as the new position is outside of the batch.
+    batch_size_        = 0;
+    batch_read_offset_ = 0;
+    batch_file_offset_ = 0;
+
+    if (restart_prefetcher)
+    {
+        if (!StartPrefetcher(offset))
         {
-            GFXRECON_LOG_ERROR("File header contains invalid four character code");
-            error_state_ = kErrorInvalidFourCC;
+            GFXRECON_LOG_ERROR("Failed to restart block prefetching at offset %" PRIu64, offset);
+            error_state_ = kErrorSeekingFile;
+            return false;
         }
     }
-    else
+    else if (mapped_file_ == nullptr)
     {
-        GFXRECON_LOG_ERROR("Failed to read file header");
-        error_state_ = kErrorReadingFileHeader;
+        // Streams that are not seekable can only be moved forward.
+        bool seeked = input_stream_->IsSeekable()
+                          ? input_stream_->Seek(offset)
+                          : ((offset >= bytes_read_) && input_stream_->Skip(static_cast<size_t>(offset - bytes_read_)));
+
+        if (!seeked)
+        {
+            GFXRECON_LOG_ERROR("Failed to seek to file offset %" PRIu64, offset);
+            error_state_ = kErrorSeekingFile;
+            return false;
+        }
     }
 
-    return success;
+    bytes_read_            = offset;
+    mapped_release_offset_ = offset;
+
+    return true;
 }
 
-bool FileProcessor::ProcessBlocks()
+bool FileProcessor::ScanSkippedBlocks(uint64_t offset)
 {
-    format::BlockHeader block_header;
-    bool                success = true;
+    // The block index that is reported to the decoders only counts the processed blocks.
+    uint64_t block_count = block_count_;
+    bool     success     = true;
 
-    while (success)
+    while (success && (IsBatchActive() || (bytes_read_ < offset)))
     {
+        format::BlockHeader block_header;
+
         success = ReadBlockHeader(&block_header);
 
         if (success)
         {
-            if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock)
-            {
-                format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
 
-                success = ReadBytes(&api_call_id, sizeof(api_call_id));
-
-                if (success)
+            if (format::IsCompressedBatchBlock(block_header.type))
+            {
+                if ((mapped_file_ != nullptr) || input_stream_->IsSeekable())
                 {
-                    success = ProcessFunctionCall(block_header, api_call_id);
-
-                    // Break from loop on frame delimiter.
-                    if (IsFrameDelimiter(api_call_id))
-                    {
-                        // Make sure to increment the frame number on the way out.
-                        ++current_frame_number_;
-                        break;
-                    }
+                    // The batch is decompressed by LoadSkippedBatch() if the blocks that follow the seek reference it.
+                    skipped_batches_.push_back({ bytes_read_ - sizeof(block_header), {} });
+                    success = SkipBytes(static_cast<size_t>(block_header.size));
                 }
                 else
                 {
-                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read function call block header");
+                    // The blocks of the batch are scanned by the following iterations.
+                    success = ProcessCompressedBatch(block_header);
                 }
             }
-            else if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock)
+            else if ((format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock) &&
+                     (block_header.size >= sizeof(format::MetaDataType)))
             {
                 format::MetaDataType meta_type = format::MetaDataType::kUnknownMetaDataType;
 
@@ -222,68 +417,709 @@ bool FileProcessor::ProcessBlocks()
 
                 if (success)
                 {
-                    success = ProcessMetaData(block_header, meta_type);
-                }
-                else
-                {
-                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
-                }
-            }
-            else if (block_header.type == format::BlockType::kStateMarkerBlock)
-            {
-                format::MarkerType marker_type  = format::MarkerType::kUnknownMarker;
-                uint64_t           frame_number = 0;
-
-                success = ReadBytes(&marker_type, sizeof(marker_type));
-
-                if (success)
-                {
-                    success = ProcessStateMarker(block_header, marker_type);
-                }
-                else
-                {
-                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
-                }
-            }
-            else if (block_header.type == format::BlockType::kAnnotation)
-            {
-                if (annotation_handler_ != nullptr)
-                {
-                    format::AnnotationType annotation_type = format::AnnotationType::kUnknown;
-
-                    success = ReadBytes(&annotation_type, sizeof(annotation_type));
-
-                    if (success)
+                    if (meta_type == format::MetaDataType::kFillMemoryCommand)
                     {
-                        success = ProcessAnnotation(block_header, annotation_type);
+                        // The fill memory from previous block commands that follow the seek may reference the block.
+                        success = SkipFillMemoryCommand(block_header, meta_type);
+                    }
+                    else if ((meta_type == format::MetaDataType::kSetBlobDataCommand) ||
+                             (meta_type == format::MetaDataType::kSetCompressionDictionaryCommand))
+                    {
+                        // The blocks that follow the seek may reference the blob or depend on the dictionary.
+                        success = ProcessMetaData(block_header, meta_type);
                     }
                     else
                     {
-                        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read annotation block header");
+                        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_type));
                     }
                 }
-                else
-                {
-                    // If there is no annotation handler to process the annotation, we can skip the annotation block.
-                    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
-                    success = SkipBytes(static_cast<size_t>(block_header.size));
-                }
             }
             else
             {
-                // Unrecognized block type.
-                GFXRECON_LOG_WARNING("Skipping unrecognized file block with type %u", block_header.type);
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
                 success = SkipBytes(static_cast<size_t>(block_header.size));
             }
         }
+    }
+
+    block_count_ = block_count;
+
+    return success;
+}
+
+bool FileProcessor::SkipFillMemoryCommand(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+{
+    format::FillMemoryCommandHeader header;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+    success      = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+    success      = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
+
+        // The block information matches the information that ProcessMetaData() records for the block.
+        size_t data_size = static_cast<size_t>(block_header.size) - sizeof(meta_type) - sizeof(header.thread_id) -
+                           sizeof(header.memory_id) - sizeof(header.memory_offset) - sizeof(header.memory_size);
+
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            AddFillMemoryBlockInfo(data_size, block_compressor_);
+        }
         else
         {
-            if (!feof(file_descriptor_))
+            AddFillMemoryBlockInfo(static_cast<size_t>(header.memory_size), nullptr);
+        }
+
+        success = SkipBytes(data_size);
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+    }
+
+    return success;
+}
+
+bool FileProcessor::SeekToFrame(uint32_t frame_number)
+{
+    if (IsDecodeThreadActive())
+    {
+        GFXRECON_LOG_ERROR("The read position cannot be changed after the decode thread has started");
+        return false;
+    }
+
+    if (!LoadSeekIndex())
+    {
+        return false;
+    }
+
+    uint64_t offset = GetFrameOffset(frame_number);
+
+    if (offset == 0)
+    {
+        GFXRECON_LOG_ERROR("Frame %u is not in the seek index of file %s", frame_number, filename_.c_str());
+        return false;
+    }
+
+    if (!SeekToOffset(offset))
+    {
+        return false;
+    }
+
+    current_frame_number_ = frame_number;
+
+    PreloadFrames();
+
+    return true;
+}
+
+bool FileProcessor::GetIndexedFrameCount(uint32_t* frame_count)
+{
+    assert(frame_count != nullptr);
+
+    if (!LoadSeekIndex())
+    {
+        return false;
+    }
+
+    // Index entries are written at the start of the file and after each frame delimiter, and record capture frame
+    // numbers, which start from the first frame of a trimmed capture.
+    bool     found       = false;
+    uint64_t first_frame = 0;
+    uint64_t last_frame  = 0;
+
+    for (const auto& entry : seek_index_)
+    {
+        if (entry.type == format::kFrameSeekIndexEntry)
+        {
+            if (!found)
             {
-                // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
-                // assumes that the block header has been successfully read and will print an incomplete block at end
-                // of file warning when the file is at EOF without an error. For this case (the normal EOF case) we
+                first_frame = entry.frame_number;
+                found       = true;
+            }
+
+            last_frame = entry.frame_number;
+        }
+    }
+
+    if (found)
+    {
+        *frame_count = static_cast<uint32_t>(last_frame - first_frame);
+    }
+
+    return found;
+}
+
+bool FileProcessor::ProcessStateSnapshot()
+{
+    if (IsDecodeThreadActive())
+    {
+        GFXRECON_LOG_ERROR("The state snapshot cannot be processed after the decode thread has started");
+        return false;
+    }
+
+    if (!LoadSeekIndex())
+    {
+        return false;
+    }
+
+    uint64_t state_end_offset = 0;
+
+    for (const auto& entry : seek_index_)
+    {
+        if ((entry.type == format::kStateEndSeekIndexEntry) && (entry.offset > bytes_read_))
+        {
+            state_end_offset = entry.offset;
+            break;
+        }
+    }
+
+    if (state_end_offset == 0)
+    {
+        return false;
+    }
+
+    bool success = true;
+
+    block_limit_offset_ = state_end_offset;
+
+    while (success && (bytes_read_ < state_end_offset))
+    {
+        success = ProcessNextFrame();
+    }
+
+    block_limit_offset_ = 0;
+
+    return (error_state_ == kErrorNone);
+}
+
+std::unique_ptr<util::InputStream> FileProcessor::OpenInputStream(const std::string& filename)
+{
+    std::unique_ptr<util::InputStream> input_stream;
+
+    if (filename == "-")
+    {
+        input_stream = util::FileInputStream::OpenStandardInput();
+    }
+    else if (util::SocketInputStream::IsSocketAddress(filename))
+    {
+        input_stream = std::make_unique<util::SocketInputStream>(filename);
+    }
+    else
+    {
+        input_stream = std::make_unique<util::FileInputStream>(filename);
+    }
+
+    if (!input_stream->IsValid())
+    {
+        return nullptr;
+    }
+
+    // Buffer data from pipes and network connections while the processing thread is busy.
+    if (!input_stream->IsSeekable())
+    {
+        input_stream = std::make_unique<util::ReadAheadInputStream>(std::move(input_stream));
+    }
+
+    return input_stream;
+}
+
+bool FileProcessor::BeginCallProgram()
+{
+    if (IsDecodeThreadActive())
+    {
+        GFXRECON_LOG_WARNING("A call program cannot be recorded after the decode thread has started");
+        return false;
+    }
+
+    // Lazily decoded pNext structs reference the block data, which is not retained after the block is processed.
+    if (PNextNode::IsLazyDecodingEnabled())
+    {
+        GFXRECON_LOG_WARNING("A call program cannot be recorded with lazy pNext decoding");
+        return false;
+    }
+
+    auto call_program = std::make_unique<DecodedCallProgram>();
+
+    for (auto decoder : decoders_)
+    {
+        if (!decoder->SetCallRecorder(call_program.get()))
+        {
+            GFXRECON_LOG_WARNING("A decoder does not support recording a call program");
+
+            for (auto recording_decoder : decoders_)
+            {
+                recording_decoder->SetCallRecorder(nullptr);
+            }
+
+            return false;
+        }
+    }
+
+    call_program->BeginRecording();
+
+    call_program_             = std::move(call_program);
+    call_program_frame_       = 0;
+    call_program_first_frame_ = current_frame_number_;
+
+    return true;
+}
+
+void FileProcessor::EndCallProgram()
+{
+    if (IsCallProgramRecording())
+    {
+        for (auto decoder : decoders_)
+        {
+            decoder->SetCallRecorder(nullptr);
+        }
+
+        call_program_->EndRecording();
+        call_program_frame_ = call_program_->GetFrameCount();
+
+        GFXRECON_LOG_INFO("Recorded a call program of %" PRIuPTR " frames with %" PRIuPTR " bytes of decoded calls",
+                          call_program_->GetFrameCount(),
+                          call_program_->GetDecodedSize());
+    }
+}
+
+bool FileProcessor::ReplayCallProgram()
+{
+    if ((call_program_ == nullptr) || call_program_->IsRecording())
+    {
+        return false;
+    }
+
+    call_program_frame_   = 0;
+    current_frame_number_ = call_program_first_frame_;
+
+    return true;
+}
+
+void FileProcessor::ReleaseCallProgram()
+{
+    EndCallProgram();
+    call_program_.reset();
+}
+
+bool FileProcessor::StartPrefetcher(uint64_t offset)
+{
+    // Blocks are read by the prefetch thread.  The file opened by Initialize() is only used to read data referenced by
+    // fill memory from previous block commands.
+    prefetcher_ = std::make_unique<BlockPrefetcher>(
+        BlockPrefetcher::kDefaultBlockCount, BlockPrefetcher::kDefaultBufferedSize, decompression_threads_);
+    prefetcher_->SetHugePageMode(huge_page_mode_);
+
+    if (!prefetcher_->Start(filename_, offset, enabled_options_.compression_type))
+    {
+        prefetcher_.reset();
+        return false;
+    }
+
+    prefetch_block_offset_ = 0;
+
+    return true;
+}
+
+void FileProcessor::PreloadFrames()
+{
+    if ((prefetcher_ == nullptr) || !IsPreloadEnabled() || ((current_frame_number_ + 1) != preload_first_frame_))
+    {
+        return;
+    }
+
+    // The range ends at the start of the frame that follows it, which is also the end of the file when the last frame
+    // is not in the seek index.
+    uint64_t end_offset = std::numeric_limits<uint64_t>::max();
+
+    if (preload_last_frame_ > 0)
+    {
+        uint64_t next_frame_offset = LoadSeekIndex() ? GetFrameOffset(preload_last_frame_) : 0;
+
+        if (next_frame_offset != 0)
+        {
+            end_offset = next_frame_offset;
+        }
+        else if (seek_index_.empty())
+        {
+            GFXRECON_LOG_INFO("File %s does not have a seek index; preloading frames until the preload size limit is "
+                              "reached",
+                              filename_.c_str());
+        }
+    }
+
+    size_t buffered_size = 0;
+    bool   complete      = prefetcher_->Preload(end_offset, max_preload_size_, &buffered_size);
+
+    if (complete)
+    {
+        GFXRECON_LOG_INFO("Preloaded %" PRIu64 " MiB of capture file blocks",
+                          static_cast<uint64_t>(buffered_size >> 20));
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Preloading stopped at the %" PRIu64 " MiB size limit; the remaining blocks will be "
+                             "streamed",
+                             static_cast<uint64_t>(max_preload_size_ >> 20));
+    }
+}
+
+uint64_t FileProcessor::GetFrameOffset(uint64_t frame_number)
+{
+    // Index entries record capture frame numbers, which start from the first frame of a trimmed capture.
+    for (const auto& entry : seek_index_)
+    {
+        if (entry.type == format::kFrameSeekIndexEntry)
+        {
+            return FindFrameOffset(seek_index_, entry.frame_number + frame_number);
+        }
+    }
+
+    return 0;
+}
+
+bool FileProcessor::StartDecodeThread()
+{
+    // Only one attempt is made to start the thread.
+    use_decode_thread_ = false;
+
+    // Lazily decoded pNext structs reference the block data, which is not retained after the block is processed.
+    if (PNextNode::IsLazyDecodingEnabled())
+    {
+        GFXRECON_LOG_WARNING("The decode thread is not supported with lazy pNext decoding; API calls will be decoded "
+                             "by the processing thread");
+        return false;
+    }
+
+    auto decoded_call_queue = std::make_unique<DecodedCallQueue>();
+
+    for (auto decoder : decoders_)
+    {
+        if (!decoder->SetCallRecorder(decoded_call_queue.get()))
+        {
+            GFXRECON_LOG_WARNING("A decoder does not support decoding from a separate thread; API calls will be "
+                                 "decoded by the processing thread");
+
+            for (auto recording_decoder : decoders_)
+            {
+                recording_decoder->SetCallRecorder(nullptr);
+            }
+
+            return false;
+        }
+    }
+
+    if (command_buffer_threads_ > 0)
+    {
+        decoded_call_queue->SetCommandBufferCallExecutor(
+            std::make_unique<CommandBufferCallExecutor>(command_buffer_threads_));
+    }
+
+    decoded_frame_state_.more_frames  = true;
+    decoded_frame_state_.frame_number = current_frame_number_;
+    decoded_frame_state_.bytes_read   = bytes_read_;
+    decoded_frame_state_.error_state  = error_state_;
+
+    decoded_call_queue_ = std::move(decoded_call_queue);
+    decode_thread_      = std::thread(&FileProcessor::DecodeFrames, this);
+
+    return true;
+}
+
+void FileProcessor::DecodeFrames()
+{
+    util::thread_placement::ApplyThreadRole(util::thread_placement::kDecodeThread);
+
+    bool more_frames = true;
+
+    while (more_frames && !decoded_call_queue_->IsStopped())
+    {
+        decoded_call_queue_->BeginBatch();
+
+        more_frames = ReadNextFrame();
+
+        DecodedCallQueue::FrameState frame_state;
+        frame_state.more_frames  = more_frames;
+        frame_state.frame_number = current_frame_number_;
+        frame_state.bytes_read   = bytes_read_;
+        frame_state.error_state  = error_state_;
+
+        decoded_call_queue_->EndBatch(&frame_state);
+    }
+}
+
+bool FileProcessor::ProcessDecodedFrame()
+{
+    DecodedCallQueue::FrameState frame_state;
+
+    try
+    {
+        if (!decoded_call_queue_->ExecuteFrame(&frame_state))
+        {
+            return false;
+        }
+    }
+    catch (...)
+    {
+        // A consumer failed, so the decoders may be destroyed while the exception is handled.
+        StopDecodeThread();
+        throw;
+    }
+
+    decoded_frame_state_ = frame_state;
+
+    return decoded_frame_state_.more_frames;
+}
+
+void FileProcessor::JoinDecodeThread()
+{
+    if (decode_thread_.joinable())
+    {
+        decoded_call_queue_->Stop();
+        decode_thread_.join();
+    }
+}
+
+bool FileProcessor::LoadSeekIndex()
+{
+    // The seek index is read from the end of the file, which is not available to streamed input.
+    if (!seek_index_loaded_ && stream_input_)
+    {
+        seek_index_loaded_ = true;
+    }
+    else if (!seek_index_loaded_)
+    {
+        seek_index_loaded_ = true;
+
+        if (!ReadSeekIndex(filename_, &seek_index_))
+        {
+            GFXRECON_LOG_WARNING("File %s does not have a seek index", filename_.c_str());
+            seek_index_.clear();
+        }
+    }
+
+    return !seek_index_.empty();
+}
+
+bool FileProcessor::ProcessFileHeader()
+{
+    bool success = false;
+
+    if (ReadBytes(&file_header_, sizeof(file_header_)))
+    {
+        success = format::ValidateFileHeader(file_header_);
+
+        if (success)
+        {
+            file_options_.resize(file_header_.num_options);
+
+            size_t option_data_size = file_header_.num_options * sizeof(format::FileOptionPair);
+
+            success = ReadBytes(file_options_.data(), option_data_size);
+
+            if (success)
+            {
+                for (const auto& option : file_options_)
+                {
+                    switch (option.key)
+                    {
+                        case format::FileOption::kCompressionType:
+                            enabled_options_.compression_type = static_cast<format::CompressionType>(option.value);
+                            break;
+                        case format::FileOption::kHandleIdEncoding:
+                            enabled_options_.handle_id_encoding = static_cast<format::HandleIdEncoding>(option.value);
+                            break;
+                        case format::FileOption::kBlockAlignment:
+                            enabled_options_.block_alignment = option.value;
+                            break;
+                        case format::FileOption::kFillMemoryReuse:
+                            enabled_options_.fill_memory_reuse = (option.value != 0);
+                            break;
+                        default:
+                            GFXRECON_LOG_WARNING("Ignoring unrecognized file header option %u", option.key);
+                            break;
+                    }
+                }
+
+                decode_context_.SetHandleIdEncoding(enabled_options_.handle_id_encoding);
+                decode_context_.Clear();
+
+                if (enabled_options_.fill_memory_reuse && (mapped_file_ == nullptr) && !input_stream_->IsSeekable())
+                {
+                    // The data of the fill memory commands that are referenced by later commands cannot be read again.
+                    GFXRECON_LOG_ERROR("Capture files that were captured with memory deduplication cannot be read from "
+                                       "streamed input; copy the file to disk to read it");
+                    success      = false;
+                    error_state_ = kErrorUnsupportedStreamInput;
+                }
+
+                compressor_ = format::CreateCompressor(enabled_options_.compression_type);
+
+                if ((compressor_ == nullptr) && (enabled_options_.compression_type != format::CompressionType::kNone))
+                {
+                    GFXRECON_LOG_ERROR("Failed to initialized file compression module (type = %u); replay of "
+                                       "compressed data will not be possible",
+                                       enabled_options_.compression_type);
+                    success      = false;
+                    error_state_ = kErrorUnsupportedCompressionType;
+                }
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("File header contains invalid four character code");
+            error_state_ = kErrorInvalidFourCC;
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to read file header");
+        error_state_ = kErrorReadingFileHeader;
+    }
+
+    return success;
+}
+
+bool FileProcessor::ProcessBlocks()
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    // The decoders read the handle IDs and blob references of the API calls with the state of this file.
+    DecodeContext::Scope context_scope(&decode_context_);
+
+    format::BlockHeader block_header;
+    bool                success = true;
+
+    while (success)
+    {
+        if ((block_limit_offset_ != 0) && (bytes_read_ >= block_limit_offset_) && !IsBatchActive())
+        {
+            break;
+        }
+
+        if (IsDecodeThreadActive() && decoded_call_queue_->IsStopped())
+        {
+            break;
+        }
+
+        success = ReadBlockHeader(&block_header);
+
+        if (success)
+        {
+            if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock)
+            {
+                format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
+
+                success = ReadBytes(&api_call_id, sizeof(api_call_id));
+
+                if (success)
+                {
+                    // The buffer usage is reported before the frame delimiter is processed, so that it is included in
+                    // the usage of the frame that the delimiter ends.
+                    if ((memory_report_ != nullptr) && IsFrameDelimiter(api_call_id))
+                    {
+                        memory_report_->SetHostUsage(graphics::MemoryUsageReport::kDecodeBuffers,
+                                                     GetDecodeBufferSize());
+                    }
+
+                    success = ProcessFunctionCall(block_header, api_call_id);
+
+                    // Break from loop on frame delimiter.
+                    if (IsFrameDelimiter(api_call_id))
+                    {
+                        // Make sure to increment the frame number on the way out.
+                        ++current_frame_number_;
+                        PreloadFrames();
+                        break;
+                    }
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read function call block header");
+                }
+            }
+            else if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock)
+            {
+                format::MetaDataType meta_type = format::MetaDataType::kUnknownMetaDataType;
+
+                success = ReadBytes(&meta_type, sizeof(meta_type));
+
+                if (success)
+                {
+                    success = ProcessMetaData(block_header, meta_type);
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
+                }
+            }
+            else if (block_header.type == format::BlockType::kStateMarkerBlock)
+            {
+                format::MarkerType marker_type  = format::MarkerType::kUnknownMarker;
+                uint64_t           frame_number = 0;
+
+                success = ReadBytes(&marker_type, sizeof(marker_type));
+
+                if (success)
+                {
+                    success = ProcessStateMarker(block_header, marker_type);
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
+                }
+            }
+            else if (block_header.type == format::BlockType::kAnnotation)
+            {
+                if (annotation_handler_ != nullptr)
+                {
+                    format::AnnotationType annotation_type = format::AnnotationType::kUnknown;
+
+                    success = ReadBytes(&annotation_type, sizeof(annotation_type));
+
+                    if (success)
+                    {
+                        success = ProcessAnnotation(block_header, annotation_type);
+                    }
+                    else
+                    {
+                        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read annotation block header");
+                    }
+                }
+                else
+                {
+                    // If there is no annotation handler to process the annotation, we can skip the annotation block.
+                    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+                    success = SkipBytes(static_cast<size_t>(block_header.size));
+                }
+            }
+            else if (format::IsCompressedBatchBlock(block_header.type))
+            {
+                success = ProcessCompressedBatch(block_header);
+            }
+            else if (block_header.type == format::BlockType::kPaddingBlock)
+            {
+                // Padding that aligns the data of the next block in the file.
+                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+                success = SkipBytes(static_cast<size_t>(block_header.size));
+            }
+            else
+            {
+                // Unrecognized block type.
+                GFXRECON_LOG_WARNING("Skipping unrecognized file block with type %u", block_header.type);
+                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+                success = SkipBytes(static_cast<size_t>(block_header.size));
+            }
+        }
+        else
+        {
+            if (!IsFileAtEnd())
+            {
+                // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
+                // assumes that the block header has been successfully read and will print an incomplete block at end
+                // of file warning when the file is at EOF without an error. For this case (the normal EOF case) we
                 // print nothing at EOF, or print an error message and set the error code directly when not at EOF.
                 GFXRECON_LOG_ERROR("Failed to read block header");
                 error_state_ = kErrorReadingBlockHeader;
@@ -294,75 +1130,975 @@ bool FileProcessor::ProcessBlocks()
     return success;
 }
 
-bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
+bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
+{
+    assert(block_header != nullptr);
+
+    bool success = false;
+
+    if (ReadBytes(block_header, sizeof(*block_header)))
+    {
+        block_compressor_ = GetBlockCompressor(block_header->type);
+        success           = true;
+        ++block_count_;
+    }
+
+    return success;
+}
+
+util::Compressor* FileProcessor::GetBlockCompressor(format::BlockType block_type)
+{
+    util::Compressor*       compressor       = compressor_;
+    format::CompressionType compression_type = format::GetBlockCompressionType(block_type);
+
+    if ((compression_type != format::CompressionType::kNone) &&
+        (compression_type != enabled_options_.compression_type))
+    {
+        auto entry = tagged_compressors_.find(compression_type);
+        if (entry != tagged_compressors_.end())
+        {
+            compressor = entry->second.get();
+        }
+        else
+        {
+            compressor = format::CreateCompressor(compression_type);
+            tagged_compressors_.emplace(compression_type, std::unique_ptr<util::Compressor>(compressor));
+        }
+    }
+
+    return compressor;
+}
+
+bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
+{
+    bool success = false;
+
+    if (CanReadInPlace())
+    {
+        success = ReadBytesInPlace(buffer_size, &parameter_data_);
+    }
+    else
+    {
+        if (buffer_size > parameter_buffer_.GetSize())
+        {
+            parameter_buffer_.Resize(buffer_size);
+        }
+
+        success         = ReadFileBytes(parameter_buffer_.GetData(), buffer_size);
+        parameter_data_ = parameter_buffer_.GetData();
+    }
+
+    return success;
+}
+
+bool FileProcessor::CanReadToDestination(uint64_t data_size) const
+{
+    return !CanReadInPlace() && (data_size >= kMinDestinationReadSize) && (decoders_.size() == 1);
+}
+
+bool FileProcessor::ReadParameterBuffer(size_t buffer_size, uint8_t* destination)
+{
+    if (destination == nullptr)
+    {
+        return ReadParameterBuffer(buffer_size);
+    }
+
+    parameter_data_ = destination;
+
+    return ReadFileBytes(destination, buffer_size);
+}
+
+bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
+                                                  size_t  expected_uncompressed_size,
+                                                  size_t* uncompressed_buffer_size)
+{
+    // This is null if the block's compression type is not supported.
+    if (block_compressor_ == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Unsupported compression type for compressed block");
+        return false;
+    }
+
+    if (ReadPrefetchedDecompressedData(compressed_buffer_size, expected_uncompressed_size))
+    {
+        *uncompressed_buffer_size = expected_uncompressed_size;
+        parameter_data_           = prefetch_block_->decompressed_data.data();
+        return true;
+    }
+
+    const uint8_t* compressed_data = nullptr;
+
+    if (ReadCompressedData(compressed_buffer_size, &compressed_data))
+    {
+        if (parameter_buffer_.GetSize() < expected_uncompressed_size)
+        {
+            parameter_buffer_.Resize(expected_uncompressed_size);
+        }
+
+        size_t uncompressed_size = block_compressor_->Decompress(
+            compressed_buffer_size, compressed_data, expected_uncompressed_size, parameter_buffer_.GetData());
+        if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
+        {
+            *uncompressed_buffer_size = uncompressed_size;
+            parameter_data_           = parameter_buffer_.GetData();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FileProcessor::ReadPatternParameterBuffer(size_t pattern_size, size_t buffer_size)
+{
+    if ((pattern_size == 0) || (pattern_size > buffer_size))
+    {
+        GFXRECON_LOG_ERROR("Invalid pattern size for resource initialization pattern block");
+        return false;
+    }
+
+    if (parameter_buffer_.GetSize() < buffer_size)
+    {
+        parameter_buffer_.Resize(buffer_size);
+    }
+
+    uint8_t* data = parameter_buffer_.GetData();
+
+    if (!ReadBytes(data, pattern_size))
+    {
+        return false;
+    }
+
+    // Each copy doubles the repeated content, which is already a whole number of patterns.
+    size_t filled_size = pattern_size;
+    while (filled_size < buffer_size)
+    {
+        size_t copy_size = std::min(filled_size, buffer_size - filled_size);
+        memcpy(data + filled_size, data, copy_size);
+        filled_size += copy_size;
+    }
+
+    parameter_data_ = data;
+    return true;
+}
+
+bool FileProcessor::GetDeferredInitDataLocation(const format::BlockHeader& block_header,
+                                                bool                       pattern,
+                                                uint64_t                   data_size,
+                                                size_t                     stored_size,
+                                                ResourceInitDataLocation*  location)
+{
+    assert(location != nullptr);
+
+    // Data in a batch is only stored in compressed form with the other blocks of the batch, and streams cannot be read
+    // again.
+    if (!defer_resource_init_data_ || (data_size == 0) || IsBatchActive() || stream_input_)
+    {
+        return false;
+    }
+
+    format::CompressionType compression_type = format::CompressionType::kNone;
+
+    if (format::IsBlockCompressed(block_header.type) && !pattern)
+    {
+        // Blocks with an unsupported compression type are left to report their error when they are read.
+        if (GetBlockCompressor(block_header.type) == nullptr)
+        {
+            return false;
+        }
+
+        compression_type = format::GetBlockCompressionType(block_header.type);
+        if (compression_type == format::CompressionType::kNone)
+        {
+            compression_type = enabled_options_.compression_type;
+        }
+    }
+    else if (!pattern && (stored_size != data_size))
+    {
+        return false;
+    }
+
+    // Outside of a batch, the read position is the file offset of the data.
+    location->offset           = bytes_read_;
+    location->stored_size      = stored_size;
+    location->compression_type = compression_type;
+    location->pattern          = pattern;
+
+    return true;
+}
+
+bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
+{
+    bool success = false;
+
+    if (IsBatchActive())
+    {
+        // Blocks are not split across batch boundaries, so all of the data must be read from the current batch.
+        if (buffer_size <= (batch_size_ - batch_read_offset_))
+        {
+            util::platform::MemoryCopy(buffer, buffer_size, batch_buffer_.data() + batch_read_offset_, buffer_size);
+            batch_read_offset_ += buffer_size;
+            success = true;
+        }
+    }
+    else
+    {
+        success = ReadFileBytes(buffer, buffer_size);
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadCompressedData(size_t compressed_size, const uint8_t** compressed_data)
+{
+    assert(compressed_data != nullptr);
+
+    bool success = false;
+
+    if (CanReadInPlace())
+    {
+        // Decompress directly from the batch buffer, the prefetched block, or the file mapping.
+        success = ReadBytesInPlace(compressed_size, compressed_data);
+    }
+    else
+    {
+        if (compressed_size > compressed_parameter_buffer_.GetSize())
+        {
+            compressed_parameter_buffer_.Resize(compressed_size);
+        }
+
+        success            = ReadFileBytes(compressed_parameter_buffer_.GetData(), compressed_size);
+        (*compressed_data) = compressed_parameter_buffer_.GetData();
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadPrefetchedDecompressedData(size_t compressed_size, size_t expected_uncompressed_size)
+{
+    bool success = false;
+
+    // The prefetch thread decompresses the payload that ends the block, so the read position must be at the start of
+    // the payload and all of the remaining block data must be requested.
+    if (!IsBatchActive() && (prefetch_block_ != nullptr) && (prefetch_block_->decompressed_offset != 0) &&
+        (prefetch_block_->decompressed_offset == prefetch_block_offset_) &&
+        (prefetch_block_->decompressed_size == expected_uncompressed_size) &&
+        (compressed_size == (prefetch_block_->data_size - prefetch_block_offset_)))
+    {
+        prefetch_block_offset_ += compressed_size;
+        bytes_read_ += compressed_size;
+        success = true;
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadBytesInPlace(size_t buffer_size, const uint8_t** data)
+{
+    assert(data != nullptr);
+    assert(CanReadInPlace());
+
+    bool success = false;
+
+    if (IsBatchActive())
+    {
+        // Blocks are not split across batch boundaries, so all of the data must be read from the current batch.
+        if (buffer_size <= (batch_size_ - batch_read_offset_))
+        {
+            (*data) = batch_buffer_.data() + batch_read_offset_;
+            batch_read_offset_ += buffer_size;
+            success = true;
+        }
+    }
+    else if (prefetcher_ != nullptr)
+    {
+        // Blocks are not split across prefetched blocks, so all of the data must be read from the current block.  The
+        // next block is only acquired when data is requested, keeping zero sized reads at the end of the file valid.
+        if (((buffer_size == 0) || HasPrefetchedData()) && (prefetch_block_ != nullptr) &&
+            (buffer_size <= (prefetch_block_->data_size - prefetch_block_offset_)))
+        {
+            (*data) = prefetch_block_->data.GetData() + prefetch_block_offset_;
+            prefetch_block_offset_ += buffer_size;
+            bytes_read_ += buffer_size;
+            success = true;
+        }
+        else
+        {
+            // Match the behavior of a short read, which consumes the rest of the data.
+            ReadPrefetchedBytes(nullptr, buffer_size);
+        }
+    }
+    else
+    {
+        (*data) = ReadMappedFileBytes(buffer_size);
+        success = ((*data) != nullptr);
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadFileBytes(void* buffer, size_t buffer_size)
+{
+    if (prefetcher_ != nullptr)
+    {
+        return (ReadPrefetchedBytes(reinterpret_cast<uint8_t*>(buffer), buffer_size) == buffer_size);
+    }
+
+    if (mapped_file_ != nullptr)
+    {
+        const uint8_t* data = ReadMappedFileBytes(buffer_size);
+
+        if (data != nullptr)
+        {
+            util::platform::MemoryCopy(buffer, buffer_size, data, buffer_size);
+            return true;
+        }
+
+        return false;
+    }
+
+    size_t bytes_read = input_stream_->Read(buffer, buffer_size);
+    bytes_read_ += bytes_read;
+    return (bytes_read == buffer_size);
+}
+
+const uint8_t* FileProcessor::ReadMappedFileBytes(size_t buffer_size)
+{
+    assert(mapped_file_ != nullptr);
+
+    const uint8_t* data      = nullptr;
+    size_t         file_size = mapped_file_->GetSize();
+
+    // The data before the current read position has been processed, so its pages can be released to limit the
+    // resident memory of large files.  Data that is accessed again after it is released is read from the file.
+    if ((bytes_read_ > mapped_release_offset_) && ((bytes_read_ - mapped_release_offset_) >= kMappedFileReleaseSize))
+    {
+        mapped_file_->Release(static_cast<size_t>(mapped_release_offset_),
+                              static_cast<size_t>(bytes_read_ - mapped_release_offset_));
+        mapped_release_offset_ = bytes_read_;
+    }
+
+    if ((bytes_read_ <= file_size) && (buffer_size <= (file_size - bytes_read_)))
+    {
+        data = mapped_file_->GetData() + bytes_read_;
+        bytes_read_ += buffer_size;
+    }
+    else
+    {
+        // Match the behavior of a short fread(), which consumes the rest of the file and sets the EOF indicator.
+        bytes_read_ = file_size;
+    }
+
+    return data;
+}
+
+bool FileProcessor::ReadFileDataAt(uint64_t offset, size_t data_size, const uint8_t** data)
+{
+    assert(data != nullptr);
+
+    bool success = false;
+
+    if (mapped_file_ != nullptr)
+    {
+        size_t file_size = mapped_file_->GetSize();
+
+        if ((offset <= file_size) && (data_size <= (file_size - static_cast<size_t>(offset))))
+        {
+            (*data) = mapped_file_->GetData() + offset;
+            success = true;
+        }
+    }
+    else if (input_stream_->IsSeekable())
+    {
+        if (data_size > compressed_parameter_buffer_.GetSize())
+        {
+            compressed_parameter_buffer_.Resize(data_size);
+        }
+
+        success = input_stream_->Seek(offset) &&
+                  (input_stream_->Read(compressed_parameter_buffer_.GetData(), data_size) == data_size);
+
+        // Return to the current read position.  When blocks are prefetched, the prefetch thread reads from its own
+        // file handle and the position of input_stream_ is not otherwise used.
+        if (!input_stream_->Seek(bytes_read_))
+        {
+            success = false;
+        }
+
+        (*data) = compressed_parameter_buffer_.GetData();
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Data from an earlier location in the file cannot be read from streamed input");
+    }
+
+    return success;
+}
+
+size_t FileProcessor::ReadPrefetchedBytes(uint8_t* buffer, size_t buffer_size)
+{
+    assert(prefetcher_ != nullptr);
+
+    size_t bytes_read = 0;
+
+    while ((bytes_read < buffer_size) && HasPrefetchedData())
+    {
+        size_t copy_size = std::min(buffer_size - bytes_read, prefetch_block_->data_size - prefetch_block_offset_);
+
+        if (buffer != nullptr)
+        {
+            util::platform::MemoryCopy(
+                buffer + bytes_read, copy_size, prefetch_block_->data.GetData() + prefetch_block_offset_, copy_size);
+        }
+
+        prefetch_block_offset_ += copy_size;
+        bytes_read += copy_size;
+    }
+
+    bytes_read_ += bytes_read;
+
+    return bytes_read;
+}
+
+bool FileProcessor::HasPrefetchedData()
+{
+    assert(prefetcher_ != nullptr);
+
+    if ((prefetch_block_ != nullptr) && (prefetch_block_offset_ < prefetch_block_->data_size))
+    {
+        return true;
+    }
+
+    // The current block has been consumed, so decoders no longer reference its data.
+    if (prefetch_block_ != nullptr)
+    {
+        prefetcher_->ReleaseBlock(prefetch_block_);
+    }
+
+    prefetch_block_        = prefetcher_->AcquireBlock();
+    prefetch_block_offset_ = 0;
+
+    return (prefetch_block_ != nullptr);
+}
+
+bool FileProcessor::IsFileAtEnd() const
+{
+    if (prefetcher_ != nullptr)
+    {
+        return ((prefetch_block_ == nullptr) || (prefetch_block_offset_ >= prefetch_block_->data_size)) &&
+               prefetcher_->IsFinished();
+    }
+
+    if (mapped_file_ != nullptr)
+    {
+        return (bytes_read_ >= mapped_file_->GetSize());
+    }
+
+    return input_stream_->IsEof();
+}
+
+bool FileProcessor::HasFileError() const
+{
+    if (prefetcher_ != nullptr)
+    {
+        return prefetcher_->HasError();
+    }
+
+    // Reads from a file mapping do not report errors; out of range reads are treated as reads past the end of file.
+    return (mapped_file_ == nullptr) && input_stream_->HasError();
+}
+
+bool FileProcessor::SkipBytes(size_t skip_size)
+{
+    bool success = false;
+
+    if (IsBatchActive())
+    {
+        if (skip_size <= (batch_size_ - batch_read_offset_))
+        {
+            batch_read_offset_ += skip_size;
+            success = true;
+        }
+    }
+    else if (prefetcher_ != nullptr)
+    {
+        success = (ReadPrefetchedBytes(nullptr, skip_size) == skip_size);
+    }
+    else if (mapped_file_ != nullptr)
+    {
+        success = (ReadMappedFileBytes(skip_size) != nullptr);
+    }
+    else
+    {
+        success = input_stream_->Skip(skip_size);
+
+        if (success)
+        {
+            // These technically count as bytes read/processed.
+            bytes_read_ += skip_size;
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadCompressedBatch(const format::BlockHeader& block_header,
+                                        util::Compressor*          compressor,
+                                        std::vector<uint8_t>*      batch_buffer,
+                                        size_t*                    batch_size)
+{
+    assert((batch_buffer != nullptr) && (batch_size != nullptr));
+
+    bool     success           = false;
+    uint64_t uncompressed_size = 0;
+
+    if ((block_header.size > sizeof(uncompressed_size)) && ReadFileBytes(&uncompressed_size, sizeof(uncompressed_size)))
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        size_t         compressed_size = static_cast<size_t>(block_header.size) - sizeof(uncompressed_size);
+        const uint8_t* compressed_data = nullptr;
+
+        if (ReadPrefetchedDecompressedData(compressed_size, static_cast<size_t>(uncompressed_size)))
+        {
+            // Take the batch decompressed by the prefetch thread, which reuses the old batch buffer for a later block.
+            std::swap(*batch_buffer, prefetch_block_->decompressed_data);
+            prefetch_block_->decompressed_size = 0;
+
+            *batch_size = static_cast<size_t>(uncompressed_size);
+            success     = true;
+        }
+        else if (ReadCompressedData(compressed_size, &compressed_data))
+        {
+            success = DecompressBatch(
+                compressor, compressed_data, compressed_size, uncompressed_size, batch_buffer, batch_size);
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::DecompressBatch(util::Compressor*     compressor,
+                                    const uint8_t*        compressed_data,
+                                    size_t                compressed_size,
+                                    uint64_t              uncompressed_size,
+                                    std::vector<uint8_t>* batch_buffer,
+                                    size_t*               batch_size)
+{
+    assert((batch_buffer != nullptr) && (batch_size != nullptr));
+
+    bool success = false;
+
+    if (compressor != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        if (batch_buffer->size() < uncompressed_size)
+        {
+            batch_buffer->resize(static_cast<size_t>(uncompressed_size));
+        }
+
+        size_t decompressed_size = compressor->Decompress(
+            compressed_size, compressed_data, static_cast<size_t>(uncompressed_size), batch_buffer);
+
+        if ((0 < decompressed_size) && (decompressed_size == uncompressed_size))
+        {
+            *batch_size = decompressed_size;
+            success     = true;
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::ProcessCompressedBatch(const format::BlockHeader& block_header)
+{
+    bool success = false;
+
+    if (IsBatchActive())
+    {
+        HandleBlockReadError(kErrorReadingCompressedBlockData, "Compressed batch blocks cannot be nested");
+    }
+    else
+    {
+        uint64_t batch_offset = bytes_read_ - sizeof(block_header);
+
+        batch_size_        = 0;
+        batch_read_offset_ = 0;
+
+        success = ReadCompressedBatch(block_header, block_compressor_, &batch_buffer_, &batch_size_);
+
+        if (success && (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kCompactBatchBlock))
+        {
+            success = ExpandCompactBatch(&batch_buffer_, &batch_size_);
+        }
+
+        if (success)
+        {
+            batch_file_offset_ = batch_offset;
+        }
+        else
+        {
+            batch_size_        = 0;
+            batch_file_offset_ = 0;
+            HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read compressed batch block");
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::ExpandCompactBatch(std::vector<uint8_t>* batch_buffer, size_t* batch_size)
+{
+    assert((batch_buffer != nullptr) && (batch_size != nullptr));
+
+    if (format::DecodeCompactRecords(batch_buffer->data(), *batch_size, &compact_batch_buffer_))
+    {
+        std::swap(*batch_buffer, compact_batch_buffer_);
+        *batch_size = batch_buffer->size();
+        return true;
+    }
+
+    GFXRECON_LOG_ERROR("Compact batch block contains invalid records");
+    return false;
+}
+
+bool FileProcessor::LoadSkippedBatch()
+{
+    if (skipped_batches_.empty())
+    {
+        return false;
+    }
+
+    SkippedBatchInfo skipped_batch = std::move(skipped_batches_.front());
+    skipped_batches_.pop_front();
+
+    const std::vector<uint8_t>* batch_buffer = nullptr;
+    size_t                      batch_size   = 0;
+    size_t                      block_offset = 0;
+
+    bool success = LoadBatch(skipped_batch.offset, &batch_buffer, &batch_size);
+
+    while (success && (block_offset < batch_size))
+    {
+        format::BlockHeader block_header;
+
+        success = ((batch_size - block_offset) >= sizeof(block_header));
+
+        if (success)
+        {
+            util::platform::MemoryCopy(
+                &block_header, sizeof(block_header), batch_buffer->data() + block_offset, sizeof(block_header));
+            block_offset += sizeof(block_header);
+
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+            success = (block_header.size <= (batch_size - block_offset));
+        }
+
+        if (success && (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock) &&
+            (block_header.size >= sizeof(format::MetaDataType)))
+        {
+            const uint8_t*       block_data = batch_buffer->data() + block_offset;
+            size_t               block_size = static_cast<size_t>(block_header.size);
+            format::MetaDataType meta_type  = format::MetaDataType::kUnknownMetaDataType;
+
+            util::platform::MemoryCopy(&meta_type, sizeof(meta_type), block_data, sizeof(meta_type));
+
+            if (meta_type == format::MetaDataType::kFillMemoryCommand)
+            {
+                format::FillMemoryCommandHeader header;
+                size_t header_size = sizeof(meta_type) + sizeof(header.thread_id) + sizeof(header.memory_id) +
+                                     sizeof(header.memory_offset) + sizeof(header.memory_size);
+
+                success = (block_size >= header_size);
+
+                if (success)
+                {
+                    // The memory size is the last field of the header.
+                    util::platform::MemoryCopy(&header.memory_size,
+                                               sizeof(header.memory_size),
+                                               block_data + header_size - sizeof(header.memory_size),
+                                               sizeof(header.memory_size));
+                    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
+
+                    // The block information matches the information that ProcessMetaData() records for the block.
+                    if (format::IsBlockCompressed(block_header.type))
+                    {
+                        fill_memory_blocks_.push_back({ block_offset + header_size,
+                                                        block_size - header_size,
+                                                        GetBlockCompressor(block_header.type),
+                                                        skipped_batch.offset });
+                    }
+                    else
+                    {
+                        fill_memory_blocks_.push_back({ block_offset + header_size,
+                                                        static_cast<size_t>(header.memory_size),
+                                                        nullptr,
+                                                        skipped_batch.offset });
+                    }
+                }
+            }
+            else if (meta_type == format::MetaDataType::kSetBlobDataCommand)
+            {
+                format::SetBlobDataCommandHeader header;
+                size_t header_size = sizeof(meta_type) + sizeof(header.thread_id) + sizeof(header.blob_id) +
+                                     sizeof(header.data_size);
+
+                success = (block_size >= header_size);
+
+                if (success)
+                {
+                    const uint8_t* field_data = block_data + sizeof(meta_type) + sizeof(header.thread_id);
+
+                    util::platform::MemoryCopy(
+                        &header.blob_id, sizeof(header.blob_id), field_data, sizeof(header.blob_id));
+                    util::platform::MemoryCopy(&header.data_size,
+                                               sizeof(header.data_size),
+                                               field_data + sizeof(header.blob_id),
+                                               sizeof(header.data_size));
+                    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+                    const uint8_t* stored_data = block_data + header_size;
+                    size_t         stored_size = block_size - header_size;
+                    size_t         data_size   = static_cast<size_t>(header.data_size);
+
+                    // Blob IDs are content hashes, so a blob that is stored again after the seek has the same data.
+                    if (format::IsBlockCompressed(block_header.type))
+                    {
+                        util::Compressor*    compressor = GetBlockCompressor(block_header.type);
+                        std::vector<uint8_t> blob_data;
+
+                        success =
+                            (compressor != nullptr) &&
+                            (compressor->Decompress(stored_size, stored_data, data_size, &blob_data) == data_size);
+
+                        if (success)
+                        {
+                            decode_context_.SetBlobData(header.blob_id, blob_data.data(), data_size);
+                        }
+                    }
+                    else
+                    {
+                        success = (stored_size >= data_size);
+
+                        if (success)
+                        {
+                            decode_context_.SetBlobData(header.blob_id, stored_data, data_size);
+                        }
+                    }
+                }
+            }
+        }
+
+        block_offset += static_cast<size_t>(block_header.size);
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to read the compressed batch at file offset %" PRIu64 " that was skipped by a seek",
+                           skipped_batch.offset);
+    }
+
+    // The fill memory blocks that follow the batch are indexed after the blocks that it contains.
+    fill_memory_blocks_.insert(
+        fill_memory_blocks_.end(), skipped_batch.next_blocks.begin(), skipped_batch.next_blocks.end());
+
+    return success;
+}
+
+void FileProcessor::TruncateFillMemoryBlocks(std::vector<FillMemoryBlockInfo>* blocks, uint64_t offset)
+{
+    assert(blocks != nullptr);
+
+    while (!blocks->empty())
+    {
+        const FillMemoryBlockInfo& info = blocks->back();
+
+        if (((info.batch_offset != 0) ? info.batch_offset : info.data_offset) < offset)
+        {
+            break;
+        }
+
+        blocks->pop_back();
+    }
+}
+
+void FileProcessor::AddFillMemoryBlockInfo(size_t data_size, util::Compressor* compressor)
+{
+    FillMemoryBlockInfo info = { bytes_read_, data_size, compressor, 0 };
+
+    if (IsBatchActive())
+    {
+        info.data_offset  = batch_read_offset_;
+        info.batch_offset = batch_file_offset_;
+    }
+
+    // The blocks of the skipped batches are indexed before the blocks that follow them.
+    if (skipped_batches_.empty())
+    {
+        fill_memory_blocks_.push_back(info);
+    }
+    else
+    {
+        skipped_batches_.back().next_blocks.push_back(info);
+    }
+}
+
+const std::vector<ApiDecoder*>& FileProcessor::GetCallDecoders(format::ApiCallId call_id)
+{
+    auto entry = call_decoders_.find(call_id);
+
+    if (entry == call_decoders_.end())
+    {
+        std::vector<ApiDecoder*> call_decoders;
+
+        for (auto decoder : decoders_)
+        {
+            if (decoder->SupportsApiCall(call_id))
+            {
+                call_decoders.push_back(decoder);
+            }
+        }
+
+        entry = call_decoders_.emplace(call_id, std::move(call_decoders)).first;
+    }
+
+    return entry->second;
+}
+
+bool FileProcessor::LoadBatch(uint64_t batch_offset, const std::vector<uint8_t>** batch_buffer, size_t* batch_size)
+{
+    assert((batch_buffer != nullptr) && (batch_size != nullptr));
+
+    bool success = true;
+
+    if (batch_offset == batch_file_offset_)
+    {
+        (*batch_buffer) = &batch_buffer_;
+        (*batch_size)   = batch_size_;
+    }
+    else
+    {
+        if (batch_offset != previous_batch_file_offset_)
+        {
+            format::CompressedBatchBlockHeader batch_header;
+            const uint8_t*                     data = nullptr;
+
+            previous_batch_size_        = 0;
+            previous_batch_file_offset_ = 0;
+
+            success = ReadFileDataAt(batch_offset, sizeof(batch_header), &data);
+
+            if (success)
+            {
+                util::platform::MemoryCopy(&batch_header, sizeof(batch_header), data, sizeof(batch_header));
+
+                const format::BlockHeader& block_header = batch_header.block_header;
+                uint64_t                   data_offset  = batch_offset + sizeof(batch_header);
+
+                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+                success = format::IsCompressedBatchBlock(block_header.type) &&
+                          (block_header.size > sizeof(batch_header.uncompressed_size));
+
+                if (success)
+                {
+                    size_t compressed_size =
+                        static_cast<size_t>(block_header.size) - sizeof(batch_header.uncompressed_size);
+
+                    success = ReadFileDataAt(data_offset, compressed_size, &data) &&
+                              DecompressBatch(GetBlockCompressor(block_header.type),
+                                              data,
+                                              compressed_size,
+                                              batch_header.uncompressed_size,
+                                              &previous_batch_buffer_,
+                                              &previous_batch_size_);
+
+                    if (success && (format::RemoveCompressedBlockBit(block_header.type) ==
+                                    format::BlockType::kCompactBatchBlock))
+                    {
+                        success = ExpandCompactBatch(&previous_batch_buffer_, &previous_batch_size_);
+                    }
+                }
+            }
+
+            if (success)
+            {
+                previous_batch_file_offset_ = batch_offset;
+            }
+        }
+
+        (*batch_buffer) = &previous_batch_buffer_;
+        (*batch_size)   = previous_batch_size_;
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadPreviousFillMemoryData(uint64_t source_index, size_t expected_size)
 {
-    assert(block_header != nullptr);
+    bool located = true;
 
-    bool success = false;
-
-    if (ReadBytes(block_header, sizeof(*block_header)))
+    // The batches that a seek skipped are loaded until the referenced block has been located.
+    while (located && (source_index >= fill_memory_blocks_.size()) && !skipped_batches_.empty())
     {
-        success = true;
+        located = LoadSkippedBatch();
     }
 
-    return success;
-}
+    bool success = false;
 
-bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
-{
-    if (buffer_size > parameter_buffer_.size())
+    if (located && (source_index < fill_memory_blocks_.size()))
     {
-        parameter_buffer_.resize(buffer_size);
-    }
-
-    return ReadBytes(parameter_buffer_.data(), buffer_size);
-}
+        const FillMemoryBlockInfo& info        = fill_memory_blocks_[static_cast<size_t>(source_index)];
+        const uint8_t*             stored_data = nullptr;
 
-bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
-                                                  size_t  expected_uncompressed_size,
-                                                  size_t* uncompressed_buffer_size)
-{
-    // This should only be null if initialization failed.
-    assert(compressor_ != nullptr);
+        if (info.batch_offset == 0)
+        {
+            // The stored data may be compressed.
+            success = ReadFileDataAt(info.data_offset, info.data_size, &stored_data);
+        }
+        else
+        {
+            const std::vector<uint8_t>* batch_buffer = nullptr;
+            size_t                      batch_size   = 0;
 
-    if (compressed_buffer_size > compressed_parameter_buffer_.size())
-    {
-        compressed_parameter_buffer_.resize(compressed_buffer_size);
-    }
+            success = LoadBatch(info.batch_offset, &batch_buffer, &batch_size) &&
+                      ((info.data_offset + info.data_size) <= batch_size);
 
-    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
-    {
-        if (parameter_buffer_.size() < expected_uncompressed_size)
-        {
-            parameter_buffer_.resize(expected_uncompressed_size);
+            if (success)
+            {
+                stored_data = batch_buffer->data() + info.data_offset;
+            }
         }
 
-        size_t uncompressed_size = compressor_->Decompress(
-            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
-        if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
+        if (success)
         {
-            *uncompressed_buffer_size = uncompressed_size;
-            return true;
+            if (info.compressor != nullptr)
+            {
+                if (parameter_buffer_.GetSize() < expected_size)
+                {
+                    parameter_buffer_.Resize(expected_size);
+                }
+
+                size_t uncompressed_size = info.compressor->Decompress(
+                    info.data_size, stored_data, expected_size, parameter_buffer_.GetData());
+                success         = (uncompressed_size == expected_size);
+                parameter_data_ = parameter_buffer_.GetData();
+            }
+            else if (info.data_size == expected_size)
+            {
+                // The stored data remains valid until the next read, so it is passed to the decoders without a copy.
+                parameter_data_ = stored_data;
+            }
+            else
+            {
+                success = false;
+            }
         }
     }
-    return false;
-}
-
-bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
-{
-    size_t bytes_read = util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
-    bytes_read_ += bytes_read;
-    return (bytes_read == buffer_size);
-}
-
-bool FileProcessor::SkipBytes(size_t skip_size)
-{
-    bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
-
-    if (success)
+    else
     {
-        // These technically count as bytes read/processed.
-        bytes_read_ += skip_size;
+        GFXRECON_LOG_ERROR("Fill memory from previous block references an invalid block index %" PRIu64,
+                           source_index);
     }
 
     return success;
@@ -371,7 +2107,7 @@ bool FileProcessor::SkipBytes(size_t skip_size)
 void FileProcessor::HandleBlockReadError(Error error_code, const char* error_message)
 {
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
-    if (feof(file_descriptor_) && !ferror(file_descriptor_))
+    if (IsFileAtEnd() && !HasFileError())
     {
         GFXRECON_LOG_WARNING("Incomplete block at end of file");
     }
@@ -394,6 +2130,19 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     {
         parameter_buffer_size -= sizeof(call_info.thread_id);
 
+        if (GetCallDecoders(call_id).empty())
+        {
+            // The parameter data is skipped without being read or decompressed when no decoder processes the call.
+            success = SkipBytes(parameter_buffer_size);
+
+            if (!success)
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to skip function call block data");
+            }
+
+            return success;
+        }
+
         if (format::IsBlockCompressed(block_header.type))
         {
             parameter_buffer_size -= sizeof(uncompressed_size);
@@ -436,12 +2185,30 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
 
         if (success)
         {
-            for (auto decoder : decoders_)
+            // The decode thread decodes calls within the allocation scope of the current decoded call batch, and a call
+            // program is recorded within the scope of the program.
+            bool decode_scope = !IsDecodeThreadActive() && !IsCallProgramRecording();
+
+            if (IsDecodeThreadActive())
+            {
+                decoded_call_queue_->SetThreadId(call_info.thread_id);
+            }
+
+            for (auto decoder : GetCallDecoders(call_id))
             {
-                if (decoder->SupportsApiCall(call_id))
+                GFXRECON_INSTRUMENT_ZONE("DecodeFunctionCall");
+
+                if (decode_scope)
                 {
                     DecodeAllocator::Begin();
-                    decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                }
+
+                decoder->SetCurrentBlockIndex(block_count_ - 1);
+
+                decoder->DecodeFunctionCall(call_id, call_info, parameter_data_, parameter_buffer_size);
+
+                if (decode_scope)
+                {
                     DecodeAllocator::End();
                 }
             }
@@ -479,11 +2246,15 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                          sizeof(header.thread_id) - sizeof(header.memory_id) -
                                          sizeof(header.memory_offset) - sizeof(header.memory_size);
 
+                AddFillMemoryBlockInfo(compressed_size, block_compressor_);
+
                 success = ReadCompressedParameterBuffer(
                     compressed_size, static_cast<size_t>(header.memory_size), &uncompressed_size);
             }
             else
             {
+                AddFillMemoryBlockInfo(static_cast<size_t>(header.memory_size), nullptr);
+
                 success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
             }
 
@@ -495,7 +2266,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                        header.memory_id,
                                                        header.memory_offset,
                                                        header.memory_size,
-                                                       parameter_buffer_.data());
+                                                       parameter_data_);
                 }
             }
             else
@@ -516,6 +2287,135 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         }
     }
+    else if (meta_type == format::MetaDataType::kFillMemoryFromPreviousBlockCommand)
+    {
+        // This command does not support compression.
+        assert(block_header.type != format::BlockType::kCompressedMetaDataBlock);
+
+        format::FillMemoryFromPreviousBlockCommand command;
+
+        success = ReadBytes(&command.thread_id, sizeof(command.thread_id));
+        success = success && ReadBytes(&command.memory_id, sizeof(command.memory_id));
+        success = success && ReadBytes(&command.memory_offset, sizeof(command.memory_offset));
+        success = success && ReadBytes(&command.memory_size, sizeof(command.memory_size));
+        success = success && ReadBytes(&command.source_index, sizeof(command.source_index));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, command.memory_size);
+
+            if (ReadPreviousFillMemoryData(command.source_index, static_cast<size_t>(command.memory_size)))
+            {
+                for (auto decoder : decoders_)
+                {
+                    decoder->DispatchFillMemoryFromPreviousBlockCommand(command.thread_id, command.source_index);
+                    decoder->DispatchFillMemoryCommand(command.thread_id,
+                                                       command.memory_id,
+                                                       command.memory_offset,
+                                                       command.memory_size,
+                                                       parameter_data_);
+                }
+            }
+            else
+            {
+                success = false;
+                HandleBlockReadError(kErrorReadingBlockData,
+                                     "Failed to read the data referenced by fill memory from previous block meta-data "
+                                     "block");
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader,
+                                 "Failed to read fill memory from previous block meta-data block header");
+        }
+    }
+    else if (meta_type == format::MetaDataType::kSetBlobDataCommand)
+    {
+        format::SetBlobDataCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.blob_id, sizeof(header.blob_id));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t uncompressed_size = 0;
+                size_t compressed_size   = static_cast<size_t>(block_header.size) - sizeof(meta_type) -
+                                         sizeof(header.thread_id) - sizeof(header.blob_id) - sizeof(header.data_size);
+
+                success = ReadCompressedParameterBuffer(
+                    compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+            }
+            else
+            {
+                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+            }
+
+            if (success)
+            {
+                // The blob is resolved by the pointer decoders of the arrays that reference it.
+                decode_context_.SetBlobData(header.blob_id, parameter_data_, static_cast<size_t>(header.data_size));
+            }
+            else
+            {
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read blob data meta-data block");
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockData, "Failed to read blob data meta-data block");
+                }
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read blob data meta-data block header");
+        }
+    }
+    else if (meta_type == format::MetaDataType::kSetCompressionDictionaryCommand)
+    {
+        // This command does not support compression.
+        assert(block_header.type != format::BlockType::kCompressedMetaDataBlock);
+
+        format::SetCompressionDictionaryCommandHeader header;
+
+        success = ReadBytes(&header.dictionary_size, sizeof(header.dictionary_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.dictionary_size);
+
+            std::vector<uint8_t> dictionary(static_cast<size_t>(header.dictionary_size));
+
+            success = ReadBytes(dictionary.data(), dictionary.size());
+
+            if (success)
+            {
+                if ((compressor_ == nullptr) || !compressor_->SetDictionary(dictionary))
+                {
+                    GFXRECON_LOG_ERROR("The file's compression type does not support the compression dictionary "
+                                       "specified by the file; compressed data will not be readable");
+                    error_state_ = kErrorUnsupportedCompressionType;
+                    success      = false;
+                }
+            }
+            else
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read compression dictionary meta-data block");
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader,
+                                 "Failed to read compression dictionary meta-data block header");
+        }
+    }
     else if (meta_type == format::MetaDataType::kResizeWindowCommand)
     {
         // This command does not support compression.
@@ -586,8 +2486,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
             if (success)
             {
-                auto        message_start = parameter_buffer_.begin();
-                std::string message(message_start, std::next(message_start, static_cast<size_t>(message_size)));
+                std::string message(reinterpret_cast<const char*>(parameter_data_), static_cast<size_t>(message_size));
 
                 for (auto decoder : decoders_)
                 {
@@ -853,7 +2752,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             for (auto decoder : decoders_)
             {
                 decoder->DispatchSetRayTracingShaderGroupHandlesCommand(
-                    header.thread_id, header.device_id, header.pipeline_id, header.data_size, parameter_buffer_.data());
+                    header.thread_id, header.device_id, header.pipeline_id, header.data_size, parameter_data_);
             }
         }
         else
@@ -862,6 +2761,55 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                  "Failed to read set ray tracing shader group handles meta-data block header");
         }
     }
+    else if (meta_type == format::MetaDataType::kSetPipelineCacheDataCommand)
+    {
+        // This command does not support compression.
+        assert(block_header.type != format::BlockType::kCompressedMetaDataBlock);
+
+        format::SetPipelineCacheDataCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.device_id, sizeof(header.device_id));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        // Read variable size pipeline cache data into parameter_buffer_.
+        success = success && ReadParameterBuffer(static_cast<size_t>(header.data_size));
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                decoder->DispatchSetPipelineCacheDataCommand(
+                    header.thread_id, header.device_id, static_cast<size_t>(header.data_size), parameter_data_);
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read set pipeline cache data meta-data block");
+        }
+    }
+    else if (meta_type == format::MetaDataType::kTimestampCommand)
+    {
+        // This command does not support compression.
+        assert(block_header.type != format::BlockType::kCompressedMetaDataBlock);
+
+        format::TimestampCommand header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.timestamp, sizeof(header.timestamp));
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                decoder->DispatchTimestampCommand(header.thread_id, header.timestamp);
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read timestamp meta-data block");
+        }
+    }
     else if (meta_type == format::MetaDataType::kSetSwapchainImageStateCommand)
     {
         // This command does not support compression.
@@ -959,8 +2907,10 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read end resource init meta-data block header");
         }
     }
-    else if (meta_type == format::MetaDataType::kInitBufferCommand)
+    else if ((meta_type == format::MetaDataType::kInitBufferCommand) ||
+             (meta_type == format::MetaDataType::kInitBufferPatternCommand))
     {
+        // Pattern blocks are expanded to the content of a kInitBufferCommand block.
         format::InitBufferCommandHeader header;
 
         success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
@@ -972,7 +2922,27 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
 
-            if (format::IsBlockCompressed(block_header.type))
+            ResourceInitDataLocation location;
+            size_t                   stored_size =
+                static_cast<size_t>(block_header.size) - (sizeof(header) - sizeof(header.meta_header.block_header));
+            bool deferred = GetDeferredInitDataLocation(block_header,
+                                                        (meta_type == format::MetaDataType::kInitBufferPatternCommand),
+                                                        header.data_size,
+                                                        stored_size,
+                                                        &location);
+
+            if (deferred)
+            {
+                success = SkipBytes(stored_size);
+            }
+            else if (meta_type == format::MetaDataType::kInitBufferPatternCommand)
+            {
+                size_t pattern_size =
+                    static_cast<size_t>(block_header.size) - (sizeof(header) - sizeof(header.meta_header.block_header));
+
+                success = ReadPatternParameterBuffer(pattern_size, static_cast<size_t>(header.data_size));
+            }
+            else if (format::IsBlockCompressed(block_header.type))
             {
                 size_t uncompressed_size = 0;
                 size_t compressed_size =
@@ -983,18 +2953,34 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                uint8_t* destination = nullptr;
+
+                if (CanReadToDestination(header.data_size))
+                {
+                    destination = decoders_[0]->GetInitBufferDataDestination(
+                        header.device_id, header.buffer_id, header.data_size);
+                }
+
+                success = ReadParameterBuffer(static_cast<size_t>(header.data_size), destination);
             }
 
             if (success)
             {
                 for (auto decoder : decoders_)
                 {
-                    decoder->DispatchInitBufferCommand(header.thread_id,
-                                                       header.device_id,
-                                                       header.buffer_id,
-                                                       header.data_size,
-                                                       parameter_buffer_.data());
+                    if (deferred)
+                    {
+                        decoder->DispatchDeferredInitBufferCommand(
+                            header.thread_id, header.device_id, header.buffer_id, header.data_size, location);
+                    }
+                    else
+                    {
+                        decoder->DispatchInitBufferCommand(header.thread_id,
+                                                           header.device_id,
+                                                           header.buffer_id,
+                                                           header.data_size,
+                                                           parameter_data_);
+                    }
                 }
             }
             else
@@ -1015,10 +3001,14 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init buffer data meta-data block header");
         }
     }
-    else if (meta_type == format::MetaDataType::kInitImageCommand)
+    else if ((meta_type == format::MetaDataType::kInitImageCommand) ||
+             (meta_type == format::MetaDataType::kInitImagePatternCommand))
     {
+        // Pattern blocks are expanded to the content of a kInitImageCommand block.
         format::InitImageCommandHeader header;
         std::vector<uint64_t>          level_sizes;
+        ResourceInitDataLocation       location;
+        bool                           deferred = false;
 
         success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
         success = success && ReadBytes(&header.device_id, sizeof(header.device_id));
@@ -1039,7 +3029,29 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             assert(header.data_size == std::accumulate(level_sizes.begin(), level_sizes.end(), 0ull));
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
 
-            if (format::IsBlockCompressed(block_header.type))
+            size_t stored_size = static_cast<size_t>(block_header.size) -
+                                 (sizeof(header) - sizeof(header.meta_header.block_header)) -
+                                 (level_sizes.size() * sizeof(level_sizes[0]));
+
+            deferred = GetDeferredInitDataLocation(block_header,
+                                                   (meta_type == format::MetaDataType::kInitImagePatternCommand),
+                                                   header.data_size,
+                                                   stored_size,
+                                                   &location);
+
+            if (deferred)
+            {
+                success = SkipBytes(stored_size);
+            }
+            else if (meta_type == format::MetaDataType::kInitImagePatternCommand)
+            {
+                size_t pattern_size = static_cast<size_t>(block_header.size) -
+                                      (sizeof(header) - sizeof(header.meta_header.block_header)) -
+                                      (level_sizes.size() * sizeof(level_sizes[0]));
+
+                success = ReadPatternParameterBuffer(pattern_size, static_cast<size_t>(header.data_size));
+            }
+            else if (format::IsBlockCompressed(block_header.type))
             {
                 size_t uncompressed_size = 0;
                 size_t compressed_size   = static_cast<size_t>(block_header.size) -
@@ -1051,7 +3063,15 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                uint8_t* destination = nullptr;
+
+                if (CanReadToDestination(header.data_size))
+                {
+                    destination = decoders_[0]->GetInitImageDataDestination(
+                        header.device_id, header.image_id, header.data_size);
+                }
+
+                success = ReadParameterBuffer(static_cast<size_t>(header.data_size), destination);
             }
         }
 
@@ -1059,14 +3079,28 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             for (auto decoder : decoders_)
             {
-                decoder->DispatchInitImageCommand(header.thread_id,
-                                                  header.device_id,
-                                                  header.image_id,
-                                                  header.data_size,
-                                                  header.aspect,
-                                                  header.layout,
-                                                  level_sizes,
-                                                  parameter_buffer_.data());
+                if (deferred)
+                {
+                    decoder->DispatchDeferredInitImageCommand(header.thread_id,
+                                                              header.device_id,
+                                                              header.image_id,
+                                                              header.data_size,
+                                                              header.aspect,
+                                                              header.layout,
+                                                              level_sizes,
+                                                              location);
+                }
+                else
+                {
+                    decoder->DispatchInitImageCommand(header.thread_id,
+                                                      header.device_id,
+                                                      header.image_id,
+                                                      header.data_size,
+                                                      header.aspect,
+                                                      header.layout,
+                                                      level_sizes,
+                                                      parameter_data_);
+                }
             }
         }
         else
@@ -1082,6 +3116,15 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             }
         }
     }
+    else if ((meta_type == format::MetaDataType::kSeekIndexCommand) ||
+             (meta_type == format::MetaDataType::kSeekIndexFooterCommand))
+    {
+        // The seek index is read directly from the end of the file by tools that locate frames without processing the
+        // file, so it is not needed for sequential processing.
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_type));
+    }
     else
     {
         // Unrecognized metadata type.
@@ -1147,14 +3190,12 @@ bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, f
             {
                 if (label_length > 0)
                 {
-                    auto label_start = parameter_buffer_.begin();
-                    label.assign(label_start, std::next(label_start, label_length));
+                    label.assign(reinterpret_cast<const char*>(parameter_data_), label_length);
                 }
 
                 if (data_length > 0)
                 {
-                    auto data_start = std::next(parameter_buffer_.begin(), label_length);
-                    data.assign(data_start, std::next(data_start, data_length));
+                    data.assign(reinterpret_cast<const char*>(parameter_data_) + label_length, data_length);
                 }
 
                 assert(annotation_handler_ != nullptr);
@@ -1181,5 +3222,18 @@ bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
     return (call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR);
 }
 
+size_t FileProcessor::GetDecodeBufferSize() const
+{
+    size_t size = parameter_buffer_.GetCapacity() + compressed_parameter_buffer_.GetCapacity() +
+                  batch_buffer_.capacity() + compact_batch_buffer_.capacity() + previous_batch_buffer_.capacity();
+
+    if (prefetcher_ != nullptr)
+    {
+        size += prefetcher_->GetBufferedSize();
+    }
+
+    return size;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
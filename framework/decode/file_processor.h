@@ -28,12 +28,24 @@
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "decode/block_prefetcher.h"
+#include "decode/decode_context.h"
+#include "decode/decoded_call_program.h"
+#include "decode/decoded_call_queue.h"
+#include "graphics/memory_usage_report.h"
 #include "util/compressor.h"
 #include "util/defines.h"
+#include "util/huge_page_buffer.h"
+#include "util/input_stream.h"
+#include "util/mapped_file.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <deque>
+#include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -54,7 +66,9 @@ class FileProcessor
         kErrorReadingBlockData             = -7,
         kErrorReadingCompressedBlockData   = -8,
         kErrorInvalidFourCC                = -9,
-        kErrorUnsupportedCompressionType   = -10
+        kErrorUnsupportedCompressionType   = -10,
+        kErrorSeekingFile                  = -11,
+        kErrorUnsupportedStreamInput       = -12
     };
 
   public:
@@ -64,13 +78,85 @@ class FileProcessor
 
     void SetAnnotationProcessor(AnnotationHandler* handler) { annotation_handler_ = handler; }
 
-    void AddDecoder(ApiDecoder* decoder) { decoders_.push_back(decoder); }
+    // Each decoder decodes the parameters of the API calls that it supports.  To process the API calls of a file with
+    // multiple consumers, add the consumers to a single decoder so that the parameters are only decoded once.
+    void AddDecoder(ApiDecoder* decoder)
+    {
+        decoders_.push_back(decoder);
+        call_decoders_.clear();
+    }
 
     void RemoveDecoder(ApiDecoder* decoder)
     {
         decoders_.erase(std::remove(decoders_.begin(), decoders_.end(), decoder), decoders_.end());
+        call_decoders_.clear();
+    }
+
+    // When enabled, Initialize() memory maps the file and block data is passed to the decoders directly from the file
+    // mapping, falling back to buffered reads if the file cannot be mapped.  Must be set before Initialize() is called.
+    void SetUseMappedFile(bool use_mapped_file) { use_mapped_file_ = use_mapped_file; }
+
+    // When enabled, Initialize() starts a thread that reads and decompresses blocks ahead of ProcessNextFrame(), moving
+    // file I/O and decompression off of the processing thread.  Must be set before Initialize() is called.
+    void SetUsePrefetchThread(bool use_prefetch_thread) { use_prefetch_thread_ = use_prefetch_thread; }
+
+    // When non-zero, the compressed blocks read by the prefetch thread are decompressed concurrently by a pool of
+    // worker threads, while blocks are still processed in file order.  Implies SetUsePrefetchThread(true).  Must be set
+    // before Initialize() is called.
+    void SetDecompressionThreads(uint32_t decompression_threads) { decompression_threads_ = decompression_threads; }
+
+    // Backs the buffers that large blocks are read and decompressed into with huge pages.  The buffers retain their
+    // memory across blocks.  Must be set before Initialize() is called.
+    void SetHugePageMode(util::HugePageBuffer::Mode mode);
+
+    // When enabled, the prefetch thread reads and decompresses the blocks of frames first_frame through last_frame
+    // into memory before the first of the frames is processed, so that file I/O does not affect the processing time of
+    // the frames.  Frames are numbered from 1, and a last_frame of 0 preloads to the end of the file.  Preloading stops
+    // when the blocks in memory reach max_size bytes, and the remaining blocks are read ahead of processing as usual.
+    // The end of the frame range is found with the seek index, and preloading continues to the size limit for files
+    // without an index.  Implies SetUsePrefetchThread(true).  Must be set before Initialize() is called.
+    void SetPreloadFrames(uint32_t first_frame, uint32_t last_frame, size_t max_size)
+    {
+        preload_first_frame_ = first_frame;
+        preload_last_frame_  = last_frame;
+        max_preload_size_    = max_size;
     }
 
+    // When enabled, the first call to ProcessNextFrame() starts a thread that reads the file and decodes the API calls
+    // ahead of the processing thread, which only passes the decoded calls to the consumers.  Consumers are still called
+    // from the processing thread, in file order, while the annotation handler is called from the decode thread.  Falls
+    // back to decoding from the processing thread if a decoder does not support recording decoded calls, or if lazy
+    // pNext decoding is enabled.  After the decode thread has started, decoders must not be added or removed, and the
+    // read position can no longer be changed.
+    void SetUseDecodeThread(bool use_decode_thread) { use_decode_thread_ = use_decode_thread; }
+
+    // When greater than 0, the command buffer recording calls of each captured thread are executed by one of up to
+    // command_buffer_threads worker threads, in parallel with the recording calls of other captured threads.  All other
+    // calls are executed by the processing thread after the workers have finished, which reproduces the
+    // synchronization of the captured application's recording threads at command buffer begin and end, queue
+    // submission, and object creation and destruction.  Consumers must support concurrent command buffer calls for
+    // different command buffers.  Only used with the decode thread.
+    void SetCommandBufferThreads(uint32_t command_buffer_threads) { command_buffer_threads_ = command_buffer_threads; }
+
+    // When enabled, the data of buffer and image initialization blocks is skipped instead of read, and the location of
+    // the data is passed to the decoders with DispatchDeferredInitBufferCommand() and
+    // DispatchDeferredInitImageCommand(), so that the data can be read with ResourceInitDataReader when it is needed.
+    // Blocks that are read from a compressed batch, standard input, or a network connection are read as usual.
+    void SetDeferResourceInitData(bool defer) { defer_resource_init_data_ = defer; }
+
+    // Reports the memory used by the block read, decompression, and prefetch buffers at the end of each frame.
+    void SetMemoryUsageReport(graphics::MemoryUsageReport* memory_report) { memory_report_ = memory_report; }
+
+    // Stops the decode thread, discarding the calls that have been decoded but not processed, and detaches the
+    // decoders from it.  Must be called before the decoders are destroyed when the file processor outlives them.
+    // Processing cannot be resumed after the decode thread has been stopped.
+    void StopDecodeThread();
+
+    // The filename may also be "-", to read the file from standard input, or a socket address of the form
+    // "tcp://host:port" or "tcp://:port", to read the file from a network connection as it is received.  Data from a
+    // pipe or network connection is buffered by a read-ahead thread.  Such streams can only be read forward, so they
+    // cannot be memory mapped, do not provide a seek index, and do not support fill memory from previous block
+    // commands.
     bool Initialize(const std::string& filename);
 
     // Returns true if there are more frames to process, false if all frames have been processed or an error has
@@ -80,33 +166,249 @@ class FileProcessor
     // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
     bool ProcessAllFrames();
 
+    // Moves the read position to the block at the specified offset from the start of the file, which must be the start
+    // of a block.  The blocks between the current position and the offset are not processed, so the decoders do not
+    // receive any state that those blocks contain.  The blob data, compression dictionaries, and fill memory block
+    // locations of the skipped blocks are loaded, as the blocks that follow the seek may depend on them.  Skipped
+    // compressed batches are only decompressed when a block that follows the seek references their contents.  Must be
+    // called between frames.
+    bool SeekToOffset(uint64_t offset);
+
+    // Moves the read position to the first block of the specified frame, using the seek index at the end of the file.
+    // Frames are numbered from 0, so GetCurrentFrameNumber() returns frame_number after the seek.  Returns false if the
+    // file does not have a seek index or the frame is not in the index.
+    bool SeekToFrame(uint32_t frame_number);
+
+    // Gets the number of frame delimiters in the file from the seek index at the end of the file, without processing
+    // the file.  Returns false if the file does not have a seek index.
+    bool GetIndexedFrameCount(uint32_t* frame_count);
+
+    // Records the calls that are processed by the following calls to ProcessNextFrame() into a call program, which
+    // keeps the decoded calls of each completed frame in memory so that the frames can be replayed again by
+    // ReplayCallProgram() without reading and decoding them from the file.  The calls are passed to the consumers as
+    // they are recorded, and annotations are not recorded.  Returns false if the decode thread is active, lazy pNext
+    // decoding is enabled, or a decoder does not support recording decoded calls.
+    bool BeginCallProgram();
+
+    // Stops recording the call program.  The recorded calls are kept until ReleaseCallProgram() is called.
+    void EndCallProgram();
+
+    // Makes the following calls to ProcessNextFrame() pass the frames of the call program to the consumers again, one
+    // frame for each call, before processing continues from the current read position.  The current frame number
+    // returns to the number of the frame that preceded the recorded frames.  Returns false if a call program has not
+    // been recorded.
+    bool ReplayCallProgram();
+
+    void ReleaseCallProgram();
+
+    // Processes the state snapshot of a trimmed capture file, stopping at the first block of the frame that follows the
+    // snapshot, so that the state can be provided to the decoders before seeking to a later frame.  Returns false if
+    // the seek index does not contain a state snapshot that ends after the current read position.
+    bool ProcessStateSnapshot();
+
     const format::FileHeader& GetFileHeader() const { return file_header_; }
 
     const std::vector<format::FileOptionPair>& GetFileOptions() const { return file_options_; }
 
-    uint32_t GetCurrentFrameNumber() const { return current_frame_number_; }
+    // When the decode thread is active, the processing state is the state at the end of the last frame that was passed
+    // to the consumers.
+    uint32_t GetCurrentFrameNumber() const
+    {
+        return IsDecodeThreadActive() ? decoded_frame_state_.frame_number : current_frame_number_;
+    }
 
-    uint64_t GetNumBytesRead() const { return bytes_read_; }
+    uint64_t GetNumBytesRead() const { return IsDecodeThreadActive() ? decoded_frame_state_.bytes_read : bytes_read_; }
 
-    Error GetErrorState() const { return error_state_; }
+    // Number of block headers that have been read, which is ahead of the processed blocks when the decode thread is
+    // active.
+    uint64_t GetBlockCount() const { return block_count_; }
+
+    Error GetErrorState() const
+    {
+        return IsDecodeThreadActive() ? static_cast<Error>(decoded_frame_state_.error_state) : error_state_;
+    }
+
+  private:
+    typedef std::unordered_map<uint32_t, std::unique_ptr<util::Compressor>> CompressorMap;
+    typedef std::unordered_map<uint32_t, std::vector<ApiDecoder*>>          CallDecoderMap;
+
+    // Location of the data for a fill memory command, which may be referenced by a subsequent fill memory from previous
+    // block command.
+    struct FillMemoryBlockInfo
+    {
+        uint64_t          data_offset; // Offset from the start of the file, or from the start of the batch.
+        size_t            data_size;
+        util::Compressor* compressor;   // Compressor for the data, or nullptr when the data is not compressed.
+        uint64_t          batch_offset; // File offset of the batch block containing the data, or 0 when not in a batch.
+    };
+
+    // Compressed batch that a seek skipped without decompressing it.  The batch is decompressed when a block that
+    // follows the seek references one of its fill memory or blob blocks.
+    struct SkippedBatchInfo
+    {
+        uint64_t                         offset;      // File offset of the batch block.
+        std::vector<FillMemoryBlockInfo> next_blocks; // Fill memory blocks between the batch and the next one.
+    };
 
   private:
     bool ProcessFileHeader();
 
+    // Reads and decodes the blocks of the next frame.
+    bool ReadNextFrame();
+
     bool ProcessBlocks();
 
+    bool StartDecodeThread();
+
+    // Entry point of the decode thread, which reads and decodes frames until the end of the file.
+    void DecodeFrames();
+
+    // Passes the calls of the next frame decoded by the decode thread to the consumers.
+    bool ProcessDecodedFrame();
+
+    bool IsDecodeThreadActive() const { return (decoded_call_queue_ != nullptr); }
+
+    bool IsCallProgramRecording() const { return (call_program_ != nullptr) && call_program_->IsRecording(); }
+
+    bool IsCallProgramReplaying() const
+    {
+        return (call_program_ != nullptr) && (call_program_frame_ < call_program_->GetFrameCount());
+    }
+
+    void JoinDecodeThread();
+
+    bool StartPrefetcher(uint64_t offset);
+
+    bool IsPreloadEnabled() const { return (preload_first_frame_ > 0); }
+
+    // Preloads the requested frame range when the next frame to be processed is the first frame of the range.
+    void PreloadFrames();
+
+    // Returns the offset of the first block of a frame, numbered from 0, or 0 if the frame is not in the seek index.
+    uint64_t GetFrameOffset(uint64_t frame_number);
+
+    // Reads the seek index from the end of the file on first use.  Returns false if the file does not have an index.
+    bool LoadSeekIndex();
+
+    // Opens a file, standard input, or socket stream, adding read-ahead buffering to streams that are not seekable.
+    std::unique_ptr<util::InputStream> OpenInputStream(const std::string& filename);
+
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
+    // Get the compressor for a block, which is the file's compressor unless the block type is tagged with a different
+    // compression type.  Returns nullptr if the compression type is not supported.
+    util::Compressor* GetBlockCompressor(format::BlockType block_type);
+
+    // Reads block data and sets parameter_data_ to point to it.  The data is read in place when it is available from
+    // the current batch or the file mapping, and is otherwise read into parameter_buffer_.
     bool ReadParameterBuffer(size_t buffer_size);
 
+    // Returns true when the uncompressed data of a large resource initialization block would be read to
+    // parameter_buffer_ and then copied by the consumer, so that it should be read to memory provided by the decoder.
+    bool CanReadToDestination(uint64_t data_size) const;
+
+    // Reads block data to destination, which was provided by the decoder, and sets parameter_data_ to it.  Calls
+    // ReadParameterBuffer() when destination is nullptr.
+    bool ReadParameterBuffer(size_t buffer_size, uint8_t* destination);
+
     bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
                                        size_t  expected_uncompressed_size,
                                        size_t* uncompressed_buffer_size);
 
+    // Reads the pattern of a resource initialization pattern block and repeats it to fill buffer_size bytes of
+    // parameter_buffer_.
+    bool ReadPatternParameterBuffer(size_t pattern_size, size_t buffer_size);
+
+    // Returns true when the stored data of the current resource initialization block should be skipped and passed to
+    // the decoders by location, which is returned through location.
+    bool GetDeferredInitDataLocation(const format::BlockHeader& block_header,
+                                     bool                       pattern,
+                                     uint64_t                   data_size,
+                                     size_t                     stored_size,
+                                     ResourceInitDataLocation*  location);
+
+    // Reads from the current compressed batch when one is active, otherwise reads from the file.
     bool ReadBytes(void* buffer, size_t buffer_size);
 
+    // Reads compressed block data in place when possible, and otherwise into compressed_parameter_buffer_.
+    bool ReadCompressedData(size_t compressed_size, const uint8_t** compressed_data);
+
+    // Returns true and skips the compressed data when the prefetch thread has already decompressed it.  The data is
+    // available from prefetch_block_->decompressed_data.
+    bool ReadPrefetchedDecompressedData(size_t compressed_size, size_t expected_uncompressed_size);
+
+    bool CanReadInPlace() const { return (IsBatchActive() || (prefetcher_ != nullptr) || (mapped_file_ != nullptr)); }
+
+    // Returns a pointer to the data in the current batch, the current prefetched block, or the file mapping without
+    // copying it.  Must only be called when CanReadInPlace() returns true.
+    bool ReadBytesInPlace(size_t buffer_size, const uint8_t** data);
+
+    bool ReadFileBytes(void* buffer, size_t buffer_size);
+
+    // Returns nullptr if the mapped file does not contain buffer_size bytes at the current file offset.
+    const uint8_t* ReadMappedFileBytes(size_t buffer_size);
+
+    // Reads data from an earlier location in the file, without changing the current read position.  The data is
+    // either read in place from the file mapping or read into compressed_parameter_buffer_.
+    bool ReadFileDataAt(uint64_t offset, size_t data_size, const uint8_t** data);
+
+    // Returns the number of bytes read from the prefetched blocks.  Data is skipped when buffer is nullptr.
+    size_t ReadPrefetchedBytes(uint8_t* buffer, size_t buffer_size);
+
+    // Acquires the next prefetched block when the current block has been consumed.  Returns false at end of file.
+    bool HasPrefetchedData();
+
     bool SkipBytes(size_t skip_size);
 
+    // Read and decompress the batch block data that follows the batch block header.  The batch is taken from the
+    // prefetched block when the prefetch thread has already decompressed it.
+    bool ReadCompressedBatch(const format::BlockHeader& block_header,
+                             util::Compressor*          compressor,
+                             std::vector<uint8_t>*      batch_buffer,
+                             size_t*                    batch_size);
+
+    bool DecompressBatch(util::Compressor*     compressor,
+                         const uint8_t*        compressed_data,
+                         size_t                compressed_size,
+                         uint64_t              uncompressed_size,
+                         std::vector<uint8_t>* batch_buffer,
+                         size_t*               batch_size);
+
+    bool ProcessCompressedBatch(const format::BlockHeader& block_header);
+
+    // Reads the block headers from the current position to a seek offset, skipping the block data except for the
+    // blocks that are referenced by the blocks that follow the offset.  Compressed batches are only decompressed when
+    // the file cannot be read again, and are otherwise recorded for LoadSkippedBatch().
+    bool ScanSkippedBlocks(uint64_t offset);
+
+    // Decompresses the first batch that a seek skipped, recording the locations of its fill memory blocks and storing
+    // its blobs.  Returns false when no skipped batch remains or the batch could not be read.
+    bool LoadSkippedBatch();
+
+    // Removes the fill memory blocks at or after a file offset from the end of a list.
+    static void TruncateFillMemoryBlocks(std::vector<FillMemoryBlockInfo>* blocks, uint64_t offset);
+
+    // Records the location of the data of a kFillMemoryCommand block that is skipped by a seek, and skips the data.
+    bool SkipFillMemoryCommand(const format::BlockHeader& block_header, format::MetaDataType meta_type);
+
+    // Replaces the compact records of a decompressed kCompactBatchBlock with the blocks that they encode.
+    bool ExpandCompactBatch(std::vector<uint8_t>* batch_buffer, size_t* batch_size);
+
+    bool IsBatchActive() const { return (batch_read_offset_ < batch_size_); }
+
+    void AddFillMemoryBlockInfo(size_t data_size, util::Compressor* compressor);
+
+    // Returns the decoders that support the API call.  The result of the SupportsApiCall() queries is cached for each
+    // call ID, until the decoder list is modified.
+    const std::vector<ApiDecoder*>& GetCallDecoders(format::ApiCallId call_id);
+
+    // Get the decompressed data for the batch located at the specified file offset.
+    bool LoadBatch(uint64_t batch_offset, const std::vector<uint8_t>** batch_buffer, size_t* batch_size);
+
+    // Read the data for a previous fill memory command into the parameter buffer, restoring the current file position
+    // after the data has been read.
+    bool ReadPreviousFillMemoryData(uint64_t source_index, size_t expected_size);
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id);
@@ -119,24 +421,74 @@ class FileProcessor
 
     bool IsFrameDelimiter(format::ApiCallId call_id) const;
 
+    size_t GetDecodeBufferSize() const;
+
     bool IsFileHeaderValid() const { return (file_header_.fourcc == GFXRECON_FOURCC); }
 
-    bool IsFileValid() const { return (file_descriptor_ && !feof(file_descriptor_) && !ferror(file_descriptor_)); }
+    bool IsFileOpen() const { return ((input_stream_ != nullptr) || (mapped_file_ != nullptr)); }
+
+    bool IsFileAtEnd() const;
+
+    bool HasFileError() const;
+
+    bool IsFileValid() const { return (IsFileOpen() && !HasFileError() && (!IsFileAtEnd() || IsBatchActive())); }
 
   private:
-    FILE*                               file_descriptor_;
+    std::unique_ptr<util::InputStream>  input_stream_; // Non-null when the file is not read through a memory mapping.
+    bool                                stream_input_; // The file is read from standard input or a socket.
     std::string                         filename_;
     format::FileHeader                  file_header_;
     std::vector<format::FileOptionPair> file_options_;
     format::EnabledOptions              enabled_options_;
     uint32_t                            current_frame_number_;
     uint64_t                            bytes_read_;
+    uint64_t                            block_count_; // Block headers read, for the index of the current block.
     Error                               error_state_;
     AnnotationHandler*                  annotation_handler_;
     std::vector<ApiDecoder*>            decoders_;
-    std::vector<uint8_t>                parameter_buffer_;
-    std::vector<uint8_t>                compressed_parameter_buffer_;
+    CallDecoderMap                      call_decoders_;
+    util::HugePageBuffer                parameter_buffer_;
+    util::HugePageBuffer                compressed_parameter_buffer_;
     util::Compressor*                   compressor_;
+    util::Compressor*                   block_compressor_; // Compressor for the current block.
+    CompressorMap                       tagged_compressors_; // Compressors for block compression type tags.
+    std::vector<FillMemoryBlockInfo>    fill_memory_blocks_;
+    std::deque<SkippedBatchInfo>        skipped_batches_; // Batches skipped by seeks, in file order.
+    DecodeContext                       decode_context_;
+    std::vector<uint8_t>                batch_buffer_;
+    size_t                              batch_size_;
+    size_t                              batch_read_offset_;
+    uint64_t                            batch_file_offset_;
+    std::vector<uint8_t>                compact_batch_buffer_; // Compact records of the batch being expanded.
+    std::vector<uint8_t>                previous_batch_buffer_; // Batch referenced by a fill memory command.
+    size_t                              previous_batch_size_;
+    uint64_t                            previous_batch_file_offset_;
+    bool                                use_mapped_file_;
+    std::unique_ptr<util::MappedFile>   mapped_file_; // Non-null when the file is read through a memory mapping.
+    uint64_t                            mapped_release_offset_; // Start of the mapped data that has not been released.
+    bool                                use_prefetch_thread_;
+    uint32_t                            decompression_threads_;
+    util::HugePageBuffer::Mode          huge_page_mode_;
+    uint32_t                            preload_first_frame_; // Preloading is disabled when 0.
+    uint32_t                            preload_last_frame_;
+    size_t                              max_preload_size_;
+    std::unique_ptr<BlockPrefetcher>    prefetcher_;  // Non-null when blocks are read by the prefetch thread.
+    BlockPrefetcher::Block*             prefetch_block_;
+    size_t                              prefetch_block_offset_;
+    const uint8_t*                      parameter_data_; // Data for the current block, from ReadParameterBuffer().
+    std::vector<format::SeekIndexEntry> seek_index_;
+    bool                                seek_index_loaded_;
+    uint64_t                            block_limit_offset_; // Block processing stops at this offset when non-zero.
+    bool                                use_decode_thread_;
+    uint32_t                            command_buffer_threads_;
+    bool                                defer_resource_init_data_;
+    graphics::MemoryUsageReport*        memory_report_;
+    std::unique_ptr<DecodedCallQueue>   decoded_call_queue_; // Non-null after the decode thread has started.
+    DecodedCallQueue::FrameState        decoded_frame_state_;
+    std::thread                         decode_thread_;
+    std::unique_ptr<DecodedCallProgram> call_program_;
+    size_t                              call_program_frame_; // Next frame of the call program to replay.
+    uint32_t                            call_program_first_frame_; // Frame number when the program was recorded.
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -23,45 +23,104 @@
 #include "file_transformer.h"
 
 #include "format/format_util.h"
+#include "util/file_output_stream.h"
 #include "util/logging.h"
 #include "util/platform.h"
+#include "util/uring_output_stream.h"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <utility>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Smallest copy that starts a kernel copy.  Smaller copies are only deferred when they extend a pending copy, as the
+// data of small blocks is usually already in the input file's read buffer.
+const uint64_t kMinKernelCopySize      = 64 * 1024;
+const size_t   kDeferredCopyBufferSize = 1024 * 1024;
+const uint64_t kNoFileOffset           = std::numeric_limits<uint64_t>::max();
+const size_t   kSkipBufferSize         = 1024 * 1024;
+
 FileTransformer::FileTransformer() :
-    file_header_{}, input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0),
-    error_state_(kErrorInvalidFileDescriptor), loading_state_(false)
+    file_header_{}, input_file_(nullptr), stream_input_(false), output_error_(false), use_io_uring_(false),
+    append_output_(false), bytes_read_(0), bytes_written_(0), error_state_(kErrorInvalidFileDescriptor),
+    loading_state_(false), block_compressor_(nullptr), batch_size_(0), batch_read_offset_(0), decompression_threads_(0),
+    prefetch_block_(nullptr), prefetch_block_offset_(0), input_file_size_(0), block_file_offset_(kNoFileOffset),
+    use_kernel_copy_(true), deferred_copy_offset_(0), deferred_copy_size_(0)
 {}
 
 FileTransformer::~FileTransformer()
 {
-    if (input_file_ != nullptr)
-    {
-        fclose(input_file_);
-    }
+    // Stop the prefetch threads before closing the file.
+    prefetcher_.reset();
 
-    if (output_file_ != nullptr)
+    if ((input_file_ != nullptr) && !stream_input_)
     {
-        fclose(output_file_);
+        fclose(input_file_);
     }
 }
 
 bool FileTransformer::Initialize(const std::string& input_filename, const std::string& output_filename)
 {
-    bool success = false;
+    bool    success = false;
+    int32_t result  = 0;
 
-    int32_t result = util::platform::FileOpen(&input_file_, input_filename.c_str(), "rb");
+    stream_input_ = (input_filename == "-");
+
+    if (stream_input_)
+    {
+        input_file_ = stdin;
+
+        if (!util::platform::SetFileBinaryMode(input_file_))
+        {
+            GFXRECON_LOG_WARNING("Failed to set standard input to binary mode");
+        }
+    }
+    else
+    {
+        result = util::platform::FileOpen(&input_file_, input_filename.c_str(), "rb");
+    }
 
     if ((result == 0) && (input_file_ != nullptr))
     {
-        result = util::platform::FileOpen(&output_file_, output_filename.c_str(), "wb");
+        // The size limits kernel copies to complete blocks, so that a truncated block is reported when it is read.
+        // Standard input is only read forward, so its size remains 0 and its blocks are not copied by the kernel.
+        if (!stream_input_)
+        {
+            if (util::platform::FileSeek(input_file_, 0, util::platform::FileSeekEnd))
+            {
+                input_file_size_ =
+                    static_cast<uint64_t>(std::max(util::platform::FileTell(input_file_), int64_t{ 0 }));
+            }
 
-        if ((result == 0) && (output_file_ != nullptr))
+            util::platform::FileSeek(input_file_, 0, util::platform::FileSeekSet);
+        }
+
+        if (CreateOutputStream(output_filename))
         {
             success = ProcessFileHeader();
+
+            if (success && (decompression_threads_ > 0) && stream_input_)
+            {
+                // The prefetch thread reads the input file from its own file handle.
+                GFXRECON_LOG_WARNING("Decompression threads are not supported when reading from standard input");
+            }
+            else if (success && (decompression_threads_ > 0))
+            {
+                // Blocks following the file header are read by the prefetch thread.
+                prefetcher_ = std::make_unique<BlockPrefetcher>(BlockPrefetcher::kDefaultBlockCount,
+                                                                BlockPrefetcher::kDefaultBufferedSize,
+                                                                decompression_threads_);
+
+                if (!prefetcher_->Start(input_filename, bytes_read_, enabled_options_.compression_type))
+                {
+                    GFXRECON_LOG_WARNING("Failed to start block prefetching; blocks will be read by the processing "
+                                         "thread");
+                    prefetcher_.reset();
+                }
+            }
         }
         else
         {
@@ -81,20 +140,71 @@ bool FileTransformer::Initialize(const std::string& input_filename, const std::s
     }
     else
     {
-        if (input_file_ != nullptr)
+        if ((input_file_ != nullptr) && !stream_input_)
         {
             fclose(input_file_);
-            input_file_ = nullptr;
         }
 
-        if (output_file_ != nullptr)
+        input_file_ = nullptr;
+
+        output_stream_ = nullptr;
+    }
+
+    return success;
+}
+
+bool FileTransformer::CreateOutputStream(const std::string& output_filename)
+{
+    if (output_filename == "-")
+    {
+        output_stream_ = util::FileOutputStream::OpenStandardOutput();
+        return true;
+    }
+
+    // The io_uring writer always creates a new file, so appending uses standard file writes.
+    if (use_io_uring_ && !append_output_)
+    {
+        output_stream_ = std::make_unique<util::UringOutputStream>(output_filename);
+
+        if (!output_stream_->IsValid())
         {
-            fclose(output_file_);
-            output_file_ = nullptr;
+            GFXRECON_LOG_WARNING("Failed to create io_uring file writer; using standard file writes");
+            output_stream_ = nullptr;
         }
     }
 
-    return success;
+    if (output_stream_ == nullptr)
+    {
+        FILE*   output_file = nullptr;
+        int32_t result = util::platform::FileOpen(&output_file, output_filename.c_str(), append_output_ ? "ab" : "wb");
+
+        if ((result == 0) && (output_file != nullptr))
+        {
+            output_stream_ = std::make_unique<util::FileOutputStream>(output_file, true);
+        }
+    }
+
+    return (output_stream_ != nullptr);
+}
+
+bool FileTransformer::OpenOutputFile(const std::string& output_filename)
+{
+    if (!FlushDeferredCopy())
+    {
+        return false;
+    }
+
+    // Destroying the current stream flushes and closes the current output file.
+    output_stream_ = nullptr;
+
+    if (!CreateOutputStream(output_filename))
+    {
+        GFXRECON_LOG_ERROR("Failed to open output file %s", output_filename.c_str());
+        error_state_ = kErrorOpeningFile;
+        return false;
+    }
+
+    return WriteFileHeader(file_header_, file_options_);
 }
 
 // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
@@ -107,18 +217,24 @@ bool FileTransformer::Process()
         success = ProcessNextBlock();
     }
 
+    if (error_state_ == kErrorNone)
+    {
+        WriteDeferredBlocks();
+        FlushDeferredCopy();
+    }
+
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
-        if ((input_file_ == nullptr) || (output_file_ == nullptr))
+        if ((input_file_ == nullptr) || (output_stream_ == nullptr))
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
-        else if (ferror(input_file_))
+        else if (HasFileError())
         {
             error_state_ = kErrorReadingFile;
         }
-        else if (ferror(output_file_))
+        else if (output_error_)
         {
             error_state_ = kErrorWritingFile;
         }
@@ -137,6 +253,12 @@ bool FileTransformer::ProcessFileHeader()
 
         if (success)
         {
+            // Compact batches are expanded to blocks with standard headers, so the output uses the base format version.
+            if (file_header_.minor_version == format::kCompactHeadersFileMinorVersion)
+            {
+                file_header_.minor_version = format::kFileMinorVersion;
+            }
+
             file_options_.resize(file_header_.num_options);
 
             size_t option_data_size = file_header_.num_options * sizeof(format::FileOptionPair);
@@ -152,16 +274,34 @@ bool FileTransformer::ProcessFileHeader()
                         case format::FileOption::kCompressionType:
                             enabled_options_.compression_type = static_cast<format::CompressionType>(option.value);
                             break;
+                        case format::FileOption::kHandleIdEncoding:
+                            enabled_options_.handle_id_encoding = static_cast<format::HandleIdEncoding>(option.value);
+                            break;
+                        case format::FileOption::kBlockAlignment:
+                            enabled_options_.block_alignment = option.value;
+                            break;
+                        case format::FileOption::kFillMemoryReuse:
+                            enabled_options_.fill_memory_reuse = (option.value != 0);
+                            break;
                         default:
                             GFXRECON_LOG_WARNING("Ignoring unrecognized file header option %u", option.key);
                             break;
                     }
                 }
 
+                // Blocks are written to the output file without padding blocks, so the output file is not aligned.
+                file_options_.erase(std::remove_if(file_options_.begin(),
+                                                   file_options_.end(),
+                                                   [](const format::FileOptionPair& option) {
+                                                       return option.key == format::FileOption::kBlockAlignment;
+                                                   }),
+                                    file_options_.end());
+                file_header_.num_options = static_cast<uint32_t>(file_options_.size());
+
                 success = CreateCompressor(enabled_options_.compression_type, &compressor_);
             }
 
-            if (success)
+            if (success && !append_output_)
             {
                 // Write header to output file.
                 success = WriteFileHeader(file_header_, file_options_);
@@ -237,26 +377,43 @@ bool FileTransformer::ProcessNextBlock()
                 HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
             }
         }
+        else if (format::IsCompressedBatchBlock(block_header.type))
+        {
+            success = ProcessCompressedBatch(block_header);
+        }
+        else if (block_header.type == format::BlockType::kPaddingBlock)
+        {
+            success = SkipBytes(block_header.size);
+        }
         else
         {
             // Copy the block to the output file.
-            success = WriteBlockHeader(block_header);
+            success = WriteDeferredBlocks();
 
-            if (success)
+            if (success && CanPassThroughBlock(block_header))
+            {
+                success = PassThroughBlock(block_header);
+            }
+            else
             {
-                success = CopyBytes(block_header.size);
+                success = success && WriteBlockHeader(block_header);
 
-                if (!success)
+                if (success)
                 {
-                    GFXRECON_LOG_ERROR("Failed to write block data");
-                    error_state_ = kErrorWritingBlockData;
+                    success = CopyBytes(block_header.size);
+
+                    if (!success)
+                    {
+                        GFXRECON_LOG_ERROR("Failed to write block data");
+                        error_state_ = kErrorWritingBlockData;
+                    }
                 }
             }
         }
     }
     else
     {
-        if (!feof(input_file_))
+        if (!IsFileAtEnd())
         {
             // If we have not hit a normal EOF condition, report an error reading the block header.
             GFXRECON_LOG_ERROR("Failed to read block header");
@@ -271,8 +428,11 @@ bool FileTransformer::ReadBlockHeader(format::BlockHeader* block_header)
 {
     assert(block_header != nullptr);
 
+    block_file_offset_ = IsBatchActive() ? kNoFileOffset : bytes_read_;
+
     if (ReadBytes(block_header, sizeof(*block_header)))
     {
+        block_compressor_ = GetBlockCompressor(block_header->type);
         return true;
     }
 
@@ -305,8 +465,21 @@ bool FileTransformer::ReadCompressedParameterBuffer(size_t  compressed_buffer_si
                                                     size_t  expected_uncompressed_size,
                                                     size_t* uncompressed_buffer_size)
 {
-    // This should only be null if initialization failed.
-    assert(compressor_ != nullptr);
+    // This is null if the block's compression type is not supported.
+    if (block_compressor_ == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Unsupported compression type for compressed block");
+        return false;
+    }
+
+    if (ReadPrefetchedDecompressedData(compressed_buffer_size, expected_uncompressed_size))
+    {
+        // Take the data decompressed by the worker threads, which reuses the old parameter buffer for a later block.
+        std::swap(parameter_buffer_, prefetch_block_->decompressed_data);
+        prefetch_block_->decompressed_size = 0;
+        *uncompressed_buffer_size          = expected_uncompressed_size;
+        return true;
+    }
 
     if (compressed_buffer_size > compressed_parameter_buffer_.size())
     {
@@ -320,8 +493,10 @@ bool FileTransformer::ReadCompressedParameterBuffer(size_t  compressed_buffer_si
             parameter_buffer_.resize(expected_uncompressed_size);
         }
 
-        size_t uncompressed_size = compressor_->Decompress(
-            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
+        size_t uncompressed_size = block_compressor_->Decompress(compressed_buffer_size,
+                                                                 compressed_parameter_buffer_.data(),
+                                                                 expected_uncompressed_size,
+                                                                 &parameter_buffer_);
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
         {
             *uncompressed_buffer_size = uncompressed_size;
@@ -334,26 +509,268 @@ bool FileTransformer::ReadCompressedParameterBuffer(size_t  compressed_buffer_si
 
 bool FileTransformer::ReadBytes(void* buffer, size_t buffer_size)
 {
-    size_t bytes_read = util::platform::FileRead(buffer, 1, buffer_size, input_file_);
-    bytes_read_ += bytes_read;
+    bool success = false;
+
+    if (IsBatchActive())
+    {
+        // Blocks are not split across batch boundaries, so all of the data must be read from the current batch.
+        if (buffer_size <= (batch_size_ - batch_read_offset_))
+        {
+            util::platform::MemoryCopy(buffer, buffer_size, batch_buffer_.data() + batch_read_offset_, buffer_size);
+            batch_read_offset_ += buffer_size;
+            success = true;
+        }
+    }
+    else
+    {
+        success = ReadFileBytes(buffer, buffer_size);
+    }
+
+    return success;
+}
+
+bool FileTransformer::ReadFileBytes(void* buffer, size_t buffer_size)
+{
+    size_t bytes_read = 0;
+
+    if (prefetcher_ != nullptr)
+    {
+        bytes_read = ReadPrefetchedBytes(reinterpret_cast<uint8_t*>(buffer), buffer_size);
+    }
+    else
+    {
+        bytes_read = util::platform::FileRead(buffer, 1, buffer_size, input_file_);
+        bytes_read_ += bytes_read;
+    }
+
     return (bytes_read == buffer_size);
 }
 
+bool FileTransformer::ReadPrefetchedDecompressedData(size_t compressed_size, size_t expected_uncompressed_size)
+{
+    bool success = false;
+
+    // The worker threads decompress the payload that ends the block, so the read position must be at the start of the
+    // payload, and the payload must extend to the end of the block.
+    if (!IsBatchActive() && (prefetch_block_ != nullptr) && (prefetch_block_->decompressed_offset != 0) &&
+        (prefetch_block_->decompressed_offset == prefetch_block_offset_) &&
+        (prefetch_block_->decompressed_size == expected_uncompressed_size) &&
+        (compressed_size == (prefetch_block_->data_size - prefetch_block_offset_)))
+    {
+        prefetch_block_offset_ += compressed_size;
+        bytes_read_ += compressed_size;
+        success = true;
+    }
+
+    return success;
+}
+
+size_t FileTransformer::ReadPrefetchedBytes(uint8_t* buffer, size_t buffer_size)
+{
+    assert(prefetcher_ != nullptr);
+
+    size_t bytes_read = 0;
+
+    while ((bytes_read < buffer_size) && HasPrefetchedData())
+    {
+        size_t copy_size = std::min(buffer_size - bytes_read, prefetch_block_->data_size - prefetch_block_offset_);
+
+        if (buffer != nullptr)
+        {
+            util::platform::MemoryCopy(
+                buffer + bytes_read, copy_size, prefetch_block_->data.GetData() + prefetch_block_offset_, copy_size);
+        }
+
+        prefetch_block_offset_ += copy_size;
+        bytes_read += copy_size;
+    }
+
+    bytes_read_ += bytes_read;
+
+    return bytes_read;
+}
+
+bool FileTransformer::HasPrefetchedData()
+{
+    assert(prefetcher_ != nullptr);
+
+    if ((prefetch_block_ != nullptr) && (prefetch_block_offset_ < prefetch_block_->data_size))
+    {
+        return true;
+    }
+
+    if (prefetch_block_ != nullptr)
+    {
+        prefetcher_->ReleaseBlock(prefetch_block_);
+    }
+
+    prefetch_block_        = prefetcher_->AcquireBlock();
+    prefetch_block_offset_ = 0;
+
+    return (prefetch_block_ != nullptr);
+}
+
+bool FileTransformer::IsFileAtEnd() const
+{
+    if (prefetcher_ != nullptr)
+    {
+        return ((prefetch_block_ == nullptr) || (prefetch_block_offset_ >= prefetch_block_->data_size)) &&
+               prefetcher_->IsFinished();
+    }
+
+    return (feof(input_file_) != 0);
+}
+
+bool FileTransformer::HasFileError() const
+{
+    if (prefetcher_ != nullptr)
+    {
+        return prefetcher_->HasError();
+    }
+
+    return (ferror(input_file_) != 0);
+}
+
 bool FileTransformer::WriteBytes(const void* buffer, size_t buffer_size)
 {
-    size_t bytes_written = util::platform::FileWrite(buffer, 1, buffer_size, output_file_);
+    if (!FlushDeferredCopy())
+    {
+        return false;
+    }
+
+    size_t bytes_written = output_stream_->Write(buffer, buffer_size);
     bytes_written_ += bytes_written;
-    return (bytes_written == buffer_size);
+
+    if (bytes_written != buffer_size)
+    {
+        output_error_ = true;
+    }
+
+    return !output_error_;
 }
 
 bool FileTransformer::SkipBytes(uint64_t skip_size)
 {
-    bool success = util::platform::FileSeek(input_file_, skip_size, util::platform::FileSeekCurrent);
+    bool success = false;
 
-    if (success)
+    if (IsBatchActive())
+    {
+        if (skip_size <= (batch_size_ - batch_read_offset_))
+        {
+            batch_read_offset_ += static_cast<size_t>(skip_size);
+            success = true;
+        }
+    }
+    else if (prefetcher_ != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, skip_size);
+        success = (ReadPrefetchedBytes(nullptr, static_cast<size_t>(skip_size)) == skip_size);
+    }
+    else if (stream_input_)
+    {
+        // Standard input cannot seek, so the skipped data is read and discarded.
+        skip_buffer_.resize(static_cast<size_t>(std::min<uint64_t>(skip_size, kSkipBufferSize)));
+        success = true;
+
+        while (success && (skip_size > 0))
+        {
+            size_t chunk_size = static_cast<size_t>(std::min<uint64_t>(skip_size, skip_buffer_.size()));
+            success           = ReadFileBytes(skip_buffer_.data(), chunk_size);
+            skip_size -= chunk_size;
+        }
+    }
+    else
     {
-        // These technically count as bytes read/processed.
-        bytes_read_ += skip_size;
+        success = util::platform::FileSeek(input_file_, skip_size, util::platform::FileSeekCurrent);
+
+        if (success)
+        {
+            // These technically count as bytes read/processed.
+            bytes_read_ += skip_size;
+        }
+    }
+
+    return success;
+}
+
+bool FileTransformer::ProcessCompressedBatch(const format::BlockHeader& block_header)
+{
+    bool     success           = false;
+    uint64_t uncompressed_size = 0;
+
+    if (IsBatchActive())
+    {
+        HandleBlockReadError(kErrorReadingCompressedBlockData, "Compressed batch blocks cannot be nested");
+    }
+    else if ((block_compressor_ != nullptr) && (block_header.size > sizeof(uncompressed_size)) &&
+             ReadFileBytes(&uncompressed_size, sizeof(uncompressed_size)))
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        size_t compressed_size = static_cast<size_t>(block_header.size) - sizeof(uncompressed_size);
+
+        if (ReadPrefetchedDecompressedData(compressed_size, static_cast<size_t>(uncompressed_size)))
+        {
+            // Take the batch decompressed by the worker threads, which reuses the old batch buffer for a later block.
+            std::swap(batch_buffer_, prefetch_block_->decompressed_data);
+            prefetch_block_->decompressed_size = 0;
+            batch_size_                        = static_cast<size_t>(uncompressed_size);
+            batch_read_offset_                 = 0;
+            success                            = true;
+        }
+        else
+        {
+            if (compressed_size > compressed_parameter_buffer_.size())
+            {
+                compressed_parameter_buffer_.resize(compressed_size);
+            }
+
+            if (ReadFileBytes(compressed_parameter_buffer_.data(), compressed_size))
+            {
+                if (batch_buffer_.size() < uncompressed_size)
+                {
+                    batch_buffer_.resize(static_cast<size_t>(uncompressed_size));
+                }
+
+                size_t decompressed_size = block_compressor_->Decompress(compressed_size,
+                                                                         compressed_parameter_buffer_.data(),
+                                                                         static_cast<size_t>(uncompressed_size),
+                                                                         &batch_buffer_);
+
+                if ((0 < decompressed_size) && (decompressed_size == uncompressed_size))
+                {
+                    batch_size_        = decompressed_size;
+                    batch_read_offset_ = 0;
+                    success            = true;
+                }
+            }
+        }
+
+        if (success && (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kCompactBatchBlock))
+        {
+            // Restore the standard headers of the blocks, which are written to the output file individually.
+            success = format::DecodeCompactRecords(batch_buffer_.data(), batch_size_, &compact_batch_buffer_);
+
+            if (success)
+            {
+                std::swap(batch_buffer_, compact_batch_buffer_);
+                batch_size_ = batch_buffer_.size();
+            }
+            else
+            {
+                batch_size_ = 0;
+            }
+        }
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read compressed batch block");
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingCompressedBlockHeader, "Failed to read compressed batch block header");
     }
 
     return success;
@@ -361,6 +778,11 @@ bool FileTransformer::SkipBytes(uint64_t skip_size)
 
 bool FileTransformer::CopyBytes(uint64_t copy_size)
 {
+    if (!IsBatchActive() && (block_file_offset_ != kNoFileOffset) && CanDeferCopy(bytes_read_, copy_size))
+    {
+        return DeferCopy(bytes_read_, copy_size);
+    }
+
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, copy_size);
     if (ReadParameterBuffer(static_cast<size_t>(copy_size)))
     {
@@ -373,10 +795,123 @@ bool FileTransformer::CopyBytes(uint64_t copy_size)
     return false;
 }
 
+bool FileTransformer::CanPassThroughBlock(const format::BlockHeader& block_header) const
+{
+    return (block_file_offset_ != kNoFileOffset) &&
+           CanDeferCopy(block_file_offset_, sizeof(block_header) + block_header.size);
+}
+
+bool FileTransformer::PassThroughBlock(const format::BlockHeader& block_header)
+{
+    assert(CanPassThroughBlock(block_header));
+
+    if (!DeferCopy(block_file_offset_, sizeof(block_header) + block_header.size))
+    {
+        HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy block data");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileTransformer::CanDeferCopy(uint64_t offset, uint64_t size) const
+{
+    // Prefetched blocks have already been read to user space buffers by the prefetch thread.
+    if (!use_kernel_copy_ || (prefetcher_ != nullptr) || (size == 0) || ((offset + size) > input_file_size_))
+    {
+        return false;
+    }
+
+    return (size >= kMinKernelCopySize) ||
+           ((deferred_copy_size_ > 0) && ((deferred_copy_offset_ + deferred_copy_size_) == offset));
+}
+
+bool FileTransformer::DeferCopy(uint64_t offset, uint64_t size)
+{
+    assert((offset <= bytes_read_) && ((offset + size) >= bytes_read_));
+
+    if ((deferred_copy_size_ > 0) && ((deferred_copy_offset_ + deferred_copy_size_) == offset))
+    {
+        deferred_copy_size_ += size;
+    }
+    else
+    {
+        // Data was skipped since the pending copy, which must be written first.
+        if (!FlushDeferredCopy())
+        {
+            return false;
+        }
+
+        deferred_copy_offset_ = offset;
+        deferred_copy_size_   = size;
+    }
+
+    // The data is counted when it is deferred so that derived classes can track output file offsets.
+    bytes_written_ += size;
+
+    return SkipBytes((offset + size) - bytes_read_);
+}
+
+bool FileTransformer::FlushDeferredCopy()
+{
+    if (deferred_copy_size_ == 0)
+    {
+        return true;
+    }
+
+    uint64_t offset = deferred_copy_offset_;
+    uint64_t size   = deferred_copy_size_;
+
+    deferred_copy_size_ = 0;
+
+    uint64_t copied = output_stream_->CopyFromFile(input_file_, offset, size);
+
+    if (copied < size)
+    {
+        // The output stream or file system does not support kernel copies, so the remainder of the range is read
+        // back from the input file and later copies are not deferred.
+        use_kernel_copy_ = false;
+        bytes_written_ -= (size - copied);
+
+        bool success = util::platform::FileSeek(
+            input_file_, static_cast<int64_t>(offset + copied), util::platform::FileSeekSet);
+
+        deferred_copy_buffer_.resize(kDeferredCopyBufferSize);
+
+        while (success && (copied < size))
+        {
+            size_t chunk_size = static_cast<size_t>(std::min<uint64_t>(size - copied, kDeferredCopyBufferSize));
+
+            success = (util::platform::FileRead(deferred_copy_buffer_.data(), 1, chunk_size, input_file_) ==
+                       chunk_size) &&
+                      WriteBytes(deferred_copy_buffer_.data(), chunk_size);
+
+            copied += chunk_size;
+        }
+
+        // Return to the read position, which follows the range.
+        success = util::platform::FileSeek(
+                      input_file_, static_cast<int64_t>(bytes_read_), util::platform::FileSeekSet) &&
+                  success;
+
+        deferred_copy_buffer_.clear();
+        deferred_copy_buffer_.shrink_to_fit();
+
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Failed to copy block data");
+            error_state_ = kErrorCopyingBlockData;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void FileTransformer::HandleBlockReadError(Error error_code, const char* error_message)
 {
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
-    if (feof(input_file_) && !ferror(input_file_))
+    if (IsFileAtEnd() && !HasFileError())
     {
         GFXRECON_LOG_WARNING("Incomplete block at end of file");
     }
@@ -395,7 +930,7 @@ void FileTransformer::HandleBlockWriteError(Error error_code, const char* error_
 
 void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_message)
 {
-    if (ferror(output_file_))
+    if (output_error_)
     {
         HandleBlockWriteError(error_code, error_message);
     }
@@ -405,13 +940,15 @@ void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_m
     }
 }
 
-bool FileTransformer::CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor)
+bool FileTransformer::CreateCompressor(format::CompressionType            type,
+                                       std::unique_ptr<util::Compressor>* compressor,
+                                       const format::CompressorOptions&   options)
 {
     assert(compressor != nullptr);
 
     if (type != format::CompressionType::kNone)
     {
-        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type));
+        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type, options));
 
         if ((*compressor) == nullptr)
         {
@@ -426,6 +963,84 @@ bool FileTransformer::CreateCompressor(format::CompressionType type, std::unique
     return true;
 }
 
+util::Compressor* FileTransformer::GetBlockCompressor(format::BlockType block_type)
+{
+    util::Compressor*       compressor       = compressor_.get();
+    format::CompressionType compression_type = format::GetBlockCompressionType(block_type);
+
+    if ((compression_type != format::CompressionType::kNone) &&
+        (compression_type != enabled_options_.compression_type))
+    {
+        auto entry = tagged_compressors_.find(compression_type);
+        if (entry != tagged_compressors_.end())
+        {
+            compressor = entry->second.get();
+        }
+        else
+        {
+            compressor = format::CreateCompressor(compression_type);
+            tagged_compressors_.emplace(compression_type, std::unique_ptr<util::Compressor>(compressor));
+        }
+    }
+
+    return compressor;
+}
+
+bool FileTransformer::ReadCompressionDictionary(const format::BlockHeader& block_header)
+{
+    uint64_t dictionary_size = 0;
+
+    if (!ReadBytes(&dictionary_size, sizeof(dictionary_size)))
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read compression dictionary meta-data block header");
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, dictionary_size);
+    compression_dictionary_.resize(static_cast<size_t>(dictionary_size));
+
+    if (!ReadBytes(compression_dictionary_.data(), compression_dictionary_.size()))
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read compression dictionary meta-data block");
+        return false;
+    }
+
+    if ((compressor_ == nullptr) || !compressor_->SetDictionary(compression_dictionary_))
+    {
+        GFXRECON_LOG_ERROR("The file's compression type does not support the compression dictionary specified by the "
+                           "file");
+        error_state_ = kErrorUnsupportedCompressionType;
+        return false;
+    }
+
+    return true;
+}
+
+bool FileTransformer::WriteCompressionDictionary(const std::vector<uint8_t>& dictionary)
+{
+    format::SetCompressionDictionaryCommandHeader dictionary_cmd;
+
+    dictionary_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    dictionary_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(dictionary_cmd) + dictionary.size();
+    dictionary_cmd.meta_header.meta_data_type    = format::MetaDataType::kSetCompressionDictionaryCommand;
+    dictionary_cmd.dictionary_size               = dictionary.size();
+
+    if (!WriteBytes(&dictionary_cmd, sizeof(dictionary_cmd)))
+    {
+        HandleBlockWriteError(kErrorWritingBlockHeader,
+                              "Failed to write compression dictionary meta-data block header");
+        return false;
+    }
+
+    if (!WriteBytes(dictionary.data(), dictionary.size()))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write compression dictionary meta-data block");
+        return false;
+    }
+
+    return true;
+}
+
 bool FileTransformer::WriteFileHeader(const format::FileHeader&                  header,
                                       const std::vector<format::FileOptionPair>& options)
 {
@@ -443,6 +1058,11 @@ bool FileTransformer::WriteFileHeader(const format::FileHeader&
 
 bool FileTransformer::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
 {
+    if (CanPassThroughBlock(block_header))
+    {
+        return PassThroughBlock(block_header);
+    }
+
     // Copy block data from old file to new file.
     if (!WriteBlockHeader(block_header))
     {
@@ -466,6 +1086,30 @@ bool FileTransformer::ProcessFunctionCall(const format::BlockHeader& block_heade
 
 bool FileTransformer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
 {
+    if (meta_type == format::MetaDataType::kSetCompressionDictionaryCommand)
+    {
+        // The dictionary is needed to read the compressed blocks that follow, which are copied to the new file with the
+        // dictionary.
+        return ReadCompressionDictionary(block_header) && WriteCompressionDictionary(compression_dictionary_);
+    }
+    else if ((meta_type == format::MetaDataType::kSeekIndexCommand) ||
+             (meta_type == format::MetaDataType::kSeekIndexFooterCommand))
+    {
+        // The file offsets in the seek index do not apply to the new file, so the index is not copied.
+        if (!SkipBytes(block_header.size - sizeof(meta_type)))
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to read seek index meta-data block");
+            return false;
+        }
+
+        return true;
+    }
+
+    if (CanPassThroughBlock(block_header))
+    {
+        return PassThroughBlock(block_header);
+    }
+
     // Copy block data from old file to new file.
     if (!WriteBlockHeader(block_header))
     {
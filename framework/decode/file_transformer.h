@@ -23,13 +23,17 @@
 #ifndef GFXRECON_DECODE_FILE_TRANSFORMER_H
 #define GFXRECON_DECODE_FILE_TRANSFORMER_H
 
+#include "decode/block_prefetcher.h"
 #include "format/format.h"
+#include "format/format_util.h"
 #include "util/defines.h"
 #include "util/compressor.h"
+#include "util/output_stream.h"
 
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -67,6 +71,21 @@ class FileTransformer
 
     virtual ~FileTransformer();
 
+    // Write the output file with io_uring, when supported.  Must be set before Initialize() is called.
+    void SetUseIoUring(bool use_io_uring) { use_io_uring_ = use_io_uring; }
+
+    // When non-zero, input file blocks are read ahead of processing by a separate thread and their compressed payloads
+    // are decompressed concurrently by a pool of worker threads.  Blocks are still processed in file order.  Must be set
+    // before Initialize() is called.
+    void SetDecompressionThreads(uint32_t decompression_threads) { decompression_threads_ = decompression_threads; }
+
+    // Append the blocks of the input file to an existing output file, without writing a file header.  Must be set
+    // before Initialize() is called.
+    void SetAppendOutput(bool append_output) { append_output_ = append_output; }
+
+    // The input filename may be "-" to read the input file from standard input, which is only read forward, and the
+    // output filename may be "-" to write the output file to standard output.  Decompression threads and kernel copies
+    // are not used for standard input.
     bool Initialize(const std::string& input_filename, const std::string& output_filename);
 
     // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
@@ -89,6 +108,8 @@ class FileTransformer
 
     bool IsLoadingState() const { return loading_state_; }
 
+    const format::EnabledOptions& GetEnabledOptions() const { return enabled_options_; }
+
     std::vector<uint8_t>& GetParameterBuffer() { return parameter_buffer_; }
 
     const std::vector<uint8_t>& GetParameterBuffer() const { return parameter_buffer_; }
@@ -109,21 +130,50 @@ class FileTransformer
                                        size_t  expected_uncompressed_size,
                                        size_t* uncompressed_buffer_size);
 
+    // Reads from the current compressed batch when one is active, otherwise reads from the input file.
     bool ReadBytes(void* buffer, size_t buffer_size);
 
     bool WriteBytes(const void* buffer, size_t buffer_size);
 
     bool SkipBytes(uint64_t skip_size);
 
+    // Copies data from the input file to the output file.  Large copies from the input file are deferred and merged
+    // with the copies that follow them, and are then copied by the kernel when the output stream supports it.
     bool CopyBytes(uint64_t copy_size);
 
+    // Returns true when the current block, including its header, can be copied from the input file by
+    // PassThroughBlock().  The block must have been read from the input file, not from a compressed batch.
+    bool CanPassThroughBlock(const format::BlockHeader& block_header) const;
+
+    // Copies the current block to the output file as it was read from the input file, skipping its unread data.  Runs
+    // of blocks that are passed through are merged into a single kernel copy.
+    bool PassThroughBlock(const format::BlockHeader& block_header);
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     void HandleBlockWriteError(Error error_code, const char* error_message);
 
     void HandleBlockCopyError(Error error_code, const char* error_message);
 
-    bool CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor);
+    bool CreateCompressor(format::CompressionType            type,
+                          std::unique_ptr<util::Compressor>* compressor,
+                          const format::CompressorOptions&   options = format::CompressorOptions());
+
+    // Get the compressor for an input file block, which is the input file's compressor unless the block type is tagged
+    // with a different compression type.  Returns nullptr if the compression type is not supported.
+    util::Compressor* GetBlockCompressor(format::BlockType block_type);
+
+    // Read the dictionary from a kSetCompressionDictionaryCommand block and load it into the compressor that is used to
+    // read the input file.
+    bool ReadCompressionDictionary(const format::BlockHeader& block_header);
+
+    bool WriteCompressionDictionary(const std::vector<uint8_t>& dictionary);
+
+    // Closes the current output file and continues writing to a new output file, which starts with the file header
+    // written by WriteFileHeader().
+    bool OpenOutputFile(const std::string& output_filename);
+
+    const std::vector<uint8_t>& GetCompressionDictionary() const { return compression_dictionary_; }
 
     virtual bool WriteFileHeader(const format::FileHeader& header, const std::vector<format::FileOptionPair>& options);
 
@@ -133,16 +183,59 @@ class FileTransformer
 
     virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
+    // Called before a block that is not passed to one of the Process functions is copied to the output file, and after
+    // the last block has been processed, so that derived classes that defer writing blocks can write them in order.
+    virtual bool WriteDeferredBlocks() { return true; }
+
   private:
+    bool CreateOutputStream(const std::string& output_filename);
+
     bool ProcessFileHeader();
 
     bool ProcessNextBlock();
 
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
+    bool ReadFileBytes(void* buffer, size_t buffer_size);
+
+    // Returns true and skips the compressed data when a decompression thread has already decompressed it.  The data is
+    // available from prefetch_block_->decompressed_data.
+    bool ReadPrefetchedDecompressedData(size_t compressed_size, size_t expected_uncompressed_size);
+
+    // Returns the number of bytes read from the prefetched blocks.  Data is skipped when buffer is nullptr.
+    size_t ReadPrefetchedBytes(uint8_t* buffer, size_t buffer_size);
+
+    // Acquires the next prefetched block when the current block has been consumed.  Returns false at end of file.
+    bool HasPrefetchedData();
+
+    bool IsFileAtEnd() const;
+
+    bool HasFileError() const;
+
+    // Decompress a batch block so that subsequent reads process the blocks that it contains.  The blocks are written to
+    // the output file individually.
+    bool ProcessCompressedBatch(const format::BlockHeader& block_header);
+
+    bool IsBatchActive() const { return (batch_read_offset_ < batch_size_); }
+
+    bool CanDeferCopy(uint64_t offset, uint64_t size) const;
+
+    // Skips the input file to the end of the range, which is merged with the pending copy when they are adjacent.
+    bool DeferCopy(uint64_t offset, uint64_t size);
+
+    // Writes the pending copy to the output file.  Called before any other data is written to the output file.
+    bool FlushDeferredCopy();
+
+  private:
+    typedef std::unordered_map<uint32_t, std::unique_ptr<util::Compressor>> CompressorMap;
+
   private:
     FILE*                               input_file_;
-    FILE*                               output_file_;
+    bool                                stream_input_; // The input file is read from standard input.
+    std::unique_ptr<util::OutputStream> output_stream_;
+    bool                                output_error_;
+    bool                                use_io_uring_;
+    bool                                append_output_;
     format::FileHeader                  file_header_;
     std::vector<format::FileOptionPair> file_options_;
     format::EnabledOptions              enabled_options_;
@@ -153,6 +246,24 @@ class FileTransformer
     std::vector<uint8_t>                parameter_buffer_;
     std::vector<uint8_t>                compressed_parameter_buffer_;
     std::unique_ptr<util::Compressor>   compressor_;
+    util::Compressor*                   block_compressor_; // Compressor for the current block.
+    CompressorMap                       tagged_compressors_; // Compressors for block compression type tags.
+    std::vector<uint8_t>                compression_dictionary_;
+    std::vector<uint8_t>                batch_buffer_;
+    size_t                              batch_size_;
+    size_t                              batch_read_offset_;
+    std::vector<uint8_t>                compact_batch_buffer_; // Compact records of the batch being expanded.
+    uint32_t                            decompression_threads_;
+    std::unique_ptr<BlockPrefetcher>    prefetcher_; // Non-null when blocks are read by the prefetch thread.
+    BlockPrefetcher::Block*             prefetch_block_;
+    size_t                              prefetch_block_offset_;
+    uint64_t                            input_file_size_;
+    uint64_t                            block_file_offset_; // Input file offset of the current block's header.
+    bool                                use_kernel_copy_;
+    uint64_t                            deferred_copy_offset_;
+    uint64_t                            deferred_copy_size_;
+    std::vector<uint8_t>                deferred_copy_buffer_; // Used when the output stream does not copy the data.
+    std::vector<uint8_t>                skip_buffer_;          // Data that is skipped when reading standard input.
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/frame_range_util.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+bool ParseFrameRange(const std::string& value_input, uint32_t* first_frame, uint32_t* last_frame)
+{
+    assert((first_frame != nullptr) && (last_frame != nullptr));
+
+    bool valid = true;
+
+    *first_frame = 1;
+    *last_frame  = std::numeric_limits<uint32_t>::max();
+
+    if (!value_input.empty())
+    {
+        size_t      separator   = value_input.find('-');
+        std::string first_value = value_input.substr(0, separator);
+        std::string last_value  = (separator != std::string::npos) ? value_input.substr(separator + 1) : "";
+
+        if ((first_value.empty() || (first_value.find_first_not_of("0123456789") != std::string::npos)) ||
+            ((separator != std::string::npos) &&
+             (last_value.empty() || (last_value.find_first_not_of("0123456789") != std::string::npos))))
+        {
+            valid = false;
+        }
+        else
+        {
+            *first_frame = static_cast<uint32_t>(std::strtoul(first_value.c_str(), nullptr, 10));
+
+            if (!last_value.empty())
+            {
+                *last_frame = static_cast<uint32_t>(std::strtoul(last_value.c_str(), nullptr, 10));
+            }
+
+            valid = (*first_frame > 0) && (*last_frame >= *first_frame);
+        }
+
+        if (!valid)
+        {
+            GFXRECON_LOG_ERROR("Ignoring invalid frame range \"%s\"", value_input.c_str());
+            *first_frame = 1;
+            *last_frame  = std::numeric_limits<uint32_t>::max();
+        }
+    }
+
+    return valid;
+}
+
+void SkipToFrame(FileProcessor* file_processor, uint32_t first_frame)
+{
+    assert(file_processor != nullptr);
+
+    if ((first_frame > 1) && !file_processor->SeekToFrame(first_frame - 1))
+    {
+        GFXRECON_LOG_INFO("Processing the frames that precede frame %u", first_frame);
+
+        while ((file_processor->GetCurrentFrameNumber() < (first_frame - 1)) && file_processor->ProcessNextFrame())
+        {
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,47 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_FRAME_RANGE_UTIL_H
+#define GFXRECON_DECODE_FRAME_RANGE_UTIL_H
+
+#include "decode/file_processor.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Parses the value of a --frames argument, which specifies a frame range as <first>[-<last>] with frames numbered from
+// 1.  An empty value selects all frames.  Returns false and selects all frames when the range is invalid.
+bool ParseFrameRange(const std::string& value_input, uint32_t* first_frame, uint32_t* last_frame);
+
+// Moves the file processor to the start of a frame.  The seek index allows the preceding frames to be skipped without
+// decoding.  Files without an index are processed up to the frame, so the decoders should not be attached until this
+// returns.
+void SkipToFrame(FileProcessor* file_processor, uint32_t first_frame);
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_FRAME_RANGE_UTIL_H
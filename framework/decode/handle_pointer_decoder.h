@@ -75,6 +75,10 @@ class HandlePointerDecoder
     {
         handle_data_len_ = len;
 
+        // Consumer data is allocated in the allocation scope of the call's execution, which is released before a call
+        // that is kept by a DecodedCallProgram is executed again.
+        consumer_data_ = nullptr;
+
         if (!is_memory_external_)
         {
             handle_data_ = decoder_.AllocateOutputData(len);
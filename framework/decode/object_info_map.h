@@ -0,0 +1,218 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_OBJECT_INFO_MAP_H
+#define GFXRECON_DECODE_OBJECT_INFO_MAP_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <array>
+#include <cassert>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Map from capture ID to object info, optimized for the IDs produced by the capture layer's monotonically increasing
+// handle ID counter.  IDs below kMaxPagedId index a paged array of entries, which are allocated as IDs in their range
+// are added, so that lookups do not need to hash the ID or probe a hash table.  Larger IDs are stored in a hash map.
+// As with std::unordered_map, pointers to entries remain valid until the entry is erased.
+template <typename T>
+class ObjectInfoMap
+{
+  public:
+    static const format::HandleId kMaxPagedId = 1ull << 24;
+
+  public:
+    // Returns a pointer to the new entry and true if the ID was added, or a pointer to the existing entry and false if
+    // the ID was already present.
+    std::pair<T*, bool> Emplace(format::HandleId id, T&& info)
+    {
+        std::unique_ptr<T>* slot     = AcquireSlot(id);
+        bool                inserted = false;
+
+        if (*slot == nullptr)
+        {
+            *slot    = std::make_unique<T>(std::forward<T>(info));
+            inserted = true;
+            ++entry_count_;
+        }
+
+        return std::make_pair(slot->get(), inserted);
+    }
+
+    T* Find(format::HandleId id)
+    {
+        const std::unique_ptr<T>* slot = FindSlot(id);
+        return (slot != nullptr) ? slot->get() : nullptr;
+    }
+
+    const T* Find(format::HandleId id) const
+    {
+        const std::unique_ptr<T>* slot = FindSlot(id);
+        return (slot != nullptr) ? slot->get() : nullptr;
+    }
+
+    void Erase(format::HandleId id)
+    {
+        if (id < kMaxPagedId)
+        {
+            size_t page_index = static_cast<size_t>(id >> kPageShift);
+
+            if ((page_index < pages_.size()) && (pages_[page_index] != nullptr))
+            {
+                std::unique_ptr<T>& slot = (*pages_[page_index])[id & kPageMask];
+
+                if (slot != nullptr)
+                {
+                    slot.reset();
+                    --entry_count_;
+                }
+            }
+        }
+        else if (overflow_map_.erase(id) > 0)
+        {
+            --entry_count_;
+        }
+    }
+
+    size_t GetCount() const { return entry_count_; }
+
+    // Returns the approximate host memory used by the map and its entries, not including the memory that is owned by
+    // the members of the entries.
+    size_t GetMemorySize() const
+    {
+        return (pages_.capacity() * sizeof(std::unique_ptr<Page>)) + (page_count_ * sizeof(Page)) +
+               (entry_count_ * sizeof(T)) + (overflow_map_.bucket_count() * sizeof(void*)) +
+               (overflow_map_.size() * (sizeof(typename OverflowMap::value_type) + sizeof(void*)));
+    }
+
+    // Entries in the paged array are visited in ID order, followed by the entries of the hash map.
+    template <typename Visitor>
+    void Visit(Visitor visitor)
+    {
+        VisitEntries<T>(visitor);
+    }
+
+    template <typename Visitor>
+    void Visit(Visitor visitor) const
+    {
+        VisitEntries<const T>(visitor);
+    }
+
+  private:
+    static const size_t kPageShift = 8;
+    static const size_t kPageSize  = 1 << kPageShift;
+    static const size_t kPageMask  = kPageSize - 1;
+
+    typedef std::array<std::unique_ptr<T>, kPageSize> Page;
+
+    typedef std::unordered_map<format::HandleId, std::unique_ptr<T>> OverflowMap;
+
+  private:
+    const std::unique_ptr<T>* FindSlot(format::HandleId id) const
+    {
+        const std::unique_ptr<T>* slot = nullptr;
+
+        if (id < kMaxPagedId)
+        {
+            size_t page_index = static_cast<size_t>(id >> kPageShift);
+
+            if ((page_index < pages_.size()) && (pages_[page_index] != nullptr))
+            {
+                slot = &(*pages_[page_index])[id & kPageMask];
+            }
+        }
+        else
+        {
+            auto entry = overflow_map_.find(id);
+
+            if (entry != overflow_map_.end())
+            {
+                slot = &entry->second;
+            }
+        }
+
+        return slot;
+    }
+
+    template <typename U, typename Visitor>
+    void VisitEntries(Visitor visitor) const
+    {
+        for (const auto& page : pages_)
+        {
+            if (page != nullptr)
+            {
+                for (const auto& slot : *page)
+                {
+                    if (slot != nullptr)
+                    {
+                        visitor(static_cast<U*>(slot.get()));
+                    }
+                }
+            }
+        }
+
+        for (const auto& entry : overflow_map_)
+        {
+            visitor(static_cast<U*>(entry.second.get()));
+        }
+    }
+
+    std::unique_ptr<T>* AcquireSlot(format::HandleId id)
+    {
+        if (id < kMaxPagedId)
+        {
+            size_t page_index = static_cast<size_t>(id >> kPageShift);
+
+            if (page_index >= pages_.size())
+            {
+                pages_.resize(page_index + 1);
+            }
+
+            if (pages_[page_index] == nullptr)
+            {
+                pages_[page_index] = std::make_unique<Page>();
+                ++page_count_;
+            }
+
+            return &(*pages_[page_index])[id & kPageMask];
+        }
+
+        return &overflow_map_[id];
+    }
+
+  private:
+    std::vector<std::unique_ptr<Page>> pages_;
+    OverflowMap                        overflow_map_;
+    size_t                             page_count_{ 0 };
+    size_t                             entry_count_{ 0 }; // Non-null entries of the pages and the hash map.
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_OBJECT_INFO_MAP_H
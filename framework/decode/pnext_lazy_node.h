@@ -0,0 +1,191 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_PNEXT_LAZY_NODE_H
+#define GFXRECON_DECODE_PNEXT_LAZY_NODE_H
+
+#include "decode/decode_allocator.h"
+#include "decode/pnext_node.h"
+#include "decode/struct_pointer_decoder.h"
+#include "decode/value_decoder.h"
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/platform.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+size_t DecodePNextStruct(const uint8_t* buffer, size_t buffer_size, PNextNode** pNext);
+
+// pNext node that records the location of an encoded struct and defers decoding until the decoded struct is accessed
+// through GetMetaStructPointer().  The encoded size of the struct members, excluding the sType and pNext members, is
+// specified by EncodedSize, which allows the struct to be skipped without decoding it.  EncodedSize counts handle IDs
+// with their fixed size encoding, so the node is not used for files that encode handle IDs as varints.  Decoding is
+// performed with the parameter buffer that was provided to Decode(), which must remain valid until the node is no
+// longer accessed.
+//
+// Until the node has been decoded, the struct memory returned by GetPointer() only contains the sType and pNext
+// values.  The pNext chain that Decode() decodes is reused by the deferred decode, which only decodes the remaining
+// members.
+template <typename T, size_t EncodedSize>
+class PNextLazyNode : public PNextNode
+{
+  public:
+    PNextLazyNode() :
+        buffer_(nullptr), buffer_size_(0), attrib_(format::PointerAttributes::kIsNull), address_(0),
+        struct_memory_(nullptr), next_(nullptr), header_size_(0), members_offset_(0), is_decoded_(false)
+    {}
+
+    virtual ~PNextLazyNode() override {}
+
+    virtual uint32_t GetAttributeMask() const override { return attrib_; }
+
+    virtual uint64_t GetAddress() const override { return address_; }
+
+    virtual void* GetPointer() override { return struct_memory_; }
+
+    virtual const void* GetPointer() const override { return struct_memory_; }
+
+    virtual void* GetMetaStructPointer() override
+    {
+        DecodeDeferred();
+        return struct_pointer_.GetMetaStructPointer();
+    }
+
+    virtual const void* GetMetaStructPointer() const override
+    {
+        DecodeDeferred();
+        return struct_pointer_.GetMetaStructPointer();
+    }
+
+    virtual size_t Decode(const uint8_t* buffer, size_t buffer_size) override
+    {
+        assert(buffer_ == nullptr);
+
+        size_t bytes_read = ValueDecoder::DecodeUInt32Value(buffer, buffer_size, &attrib_);
+
+        if ((attrib_ & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
+        {
+            if ((attrib_ & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
+            {
+                bytes_read += ValueDecoder::DecodeAddress((buffer + bytes_read), (buffer_size - bytes_read), &address_);
+            }
+
+            struct_memory_ = DecodeAllocator::Allocate<typename T::struct_type>();
+
+            if ((attrib_ & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
+            {
+                PNextNode* next = nullptr;
+
+                // The pNext chain is the only member with a variable encoded size, so only the sType and pNext members
+                // are decoded to find the end of the struct.  The remaining members are decoded when accessed.
+                bytes_read += ValueDecoder::DecodeEnumValue(
+                    (buffer + bytes_read), (buffer_size - bytes_read), &struct_memory_->sType);
+                header_size_ = bytes_read;
+
+                bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), &next);
+                members_offset_ = bytes_read;
+                bytes_read += EncodedSize;
+
+                next_                 = next;
+                struct_memory_->pNext = (next != nullptr) ? next->GetPointer() : nullptr;
+            }
+
+            buffer_      = buffer;
+            buffer_size_ = buffer_size;
+
+            if (bytes_read > buffer_size)
+            {
+                // The buffer does not contain the complete struct, so it is decoded now, including its pNext chain, to
+                // report the size of the data that could be decoded.
+                is_decoded_ = true;
+                struct_pointer_.SetExternalMemory(struct_memory_, 1);
+                bytes_read = struct_pointer_.Decode(buffer, buffer_size);
+            }
+        }
+
+        return bytes_read;
+    }
+
+  private:
+    // Encoded size of the pointer attributes, address, and sType that precede the pNext chain.
+    static const size_t kMaxHeaderSize =
+        sizeof(uint32_t) + sizeof(format::AddressEncodeType) + sizeof(format::EnumEncodeType);
+
+    void DecodeDeferred() const
+    {
+        if (!is_decoded_ && (buffer_ != nullptr))
+        {
+            is_decoded_ = true;
+            struct_pointer_.SetExternalMemory(struct_memory_, 1);
+
+            if (members_offset_ == 0)
+            {
+                // The struct has no data.
+                struct_pointer_.Decode(buffer_, buffer_size_);
+            }
+            else
+            {
+                // The struct is decoded from a copy of its encoding with a null pNext pointer in place of the chain
+                // that Decode() has already decoded, which is then attached to the decoded struct.
+                const uint32_t null_attrib = format::PointerAttributes::kIsNull;
+                uint8_t        encoded[kMaxHeaderSize + sizeof(null_attrib) + EncodedSize];
+                size_t         encoded_size = 0;
+
+                assert(header_size_ <= kMaxHeaderSize);
+
+                util::platform::MemoryCopy(encoded, sizeof(encoded), buffer_, header_size_);
+                encoded_size += header_size_;
+                util::platform::MemoryCopy(
+                    encoded + encoded_size, sizeof(encoded) - encoded_size, &null_attrib, sizeof(null_attrib));
+                encoded_size += sizeof(null_attrib);
+                util::platform::MemoryCopy(
+                    encoded + encoded_size, sizeof(encoded) - encoded_size, buffer_ + members_offset_, EncodedSize);
+                encoded_size += EncodedSize;
+
+                struct_pointer_.Decode(encoded, encoded_size);
+
+                struct_pointer_.GetMetaStructPointer()->pNext = next_;
+                struct_memory_->pNext                         = (next_ != nullptr) ? next_->GetPointer() : nullptr;
+            }
+        }
+    }
+
+  private:
+    const uint8_t*                  buffer_;         ///< Start of the encoded struct in the parameter buffer.
+    size_t                          buffer_size_;    ///< Size of the parameter buffer, starting at #buffer_.
+    uint32_t                        attrib_;
+    uint64_t                        address_;
+    typename T::struct_type*        struct_memory_;  ///< Decoded struct, populated by DecodeDeferred().
+    PNextNode*                      next_;           ///< pNext chain decoded by Decode().
+    size_t                          header_size_;    ///< Encoded size of the data that precedes the pNext chain.
+    size_t                          members_offset_; ///< Offset of the members that follow the pNext chain, or 0.
+    mutable bool                    is_decoded_;
+    mutable StructPointerDecoder<T> struct_pointer_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_PNEXT_LAZY_NODE_H
@@ -52,6 +52,17 @@ class PNextNode
     virtual const void* GetMetaStructPointer() const = 0;
 
     virtual size_t Decode(const uint8_t* buffer, size_t buffer_size) = 0;
+
+    // When enabled, pNext structs that can be skipped without decoding are recorded as references to the encoded data
+    // and are only decoded when GetMetaStructPointer() is called.  Intended for consumers that do not use the Vulkan
+    // struct pNext chains, as the struct data referenced from a parent struct's pNext value is not populated until
+    // the node has been decoded.
+    static void SetLazyDecoding(bool enable) { lazy_decoding_ = enable; }
+
+    static bool IsLazyDecodingEnabled() { return lazy_decoding_; }
+
+  private:
+    static bool lazy_decoding_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -26,11 +26,13 @@
 
 #include "decode/pointer_decoder_base.h"
 #include "decode/decode_allocator.h"
+#include "decode/decode_context.h"
 #include "decode/value_decoder.h"
 #include "format/format.h"
 #include "util/defines.h"
 #include "util/logging.h"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -130,13 +132,77 @@ class PointerDecoder : public PointerDecoderBase
     size_t DecodeEnum(const uint8_t* buffer, size_t buffer_size)         { return DecodeFrom<format::EnumEncodeType>(buffer, buffer_size); }
     size_t DecodeFlags(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<format::FlagsEncodeType>(buffer, buffer_size); }
     size_t DecodeVkSampleMask(const uint8_t* buffer, size_t buffer_size) { return DecodeFrom<format::SampleMaskEncodeType>(buffer, buffer_size); }
-    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size)     { return DecodeFrom<format::HandleEncodeType>(buffer, buffer_size); }
+    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size)     { return DecodeHandleIdFrom(buffer, buffer_size); }
     size_t DecodeVkDeviceSize(const uint8_t* buffer, size_t buffer_size) { return DecodeFrom<format::DeviceSizeEncodeType>(buffer, buffer_size); }
     size_t DecodeVkDeviceAddress(const uint8_t* buffer, size_t buffer_size) { return DecodeFrom<format::DeviceAddressEncodeType>(buffer, buffer_size); }
     size_t DecodeSizeT(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<format::SizeTEncodeType>(buffer, buffer_size); }
     // clang-format on
 
   private:
+    size_t DecodeHandleIdFrom(const uint8_t* buffer, size_t buffer_size)
+    {
+        if (!ValueDecoder::IsVarintHandleIds())
+        {
+            return DecodeFrom<format::HandleEncodeType>(buffer, buffer_size);
+        }
+
+        // Varint handle IDs have a variable size, so the data is decoded in place of the fixed size DecodeArrayFrom()
+        // and the number of bytes read is taken from the decoder.
+        size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+
+        if (!IsNull())
+        {
+            size_t len = GetLength();
+
+            if (!is_memory_external_)
+            {
+                assert(data_ == nullptr);
+
+                data_ = DecodeAllocator::Allocate<T>(len, !HasData());
+
+                if (HasData())
+                {
+                    bytes_read += DecodeHandleIds((buffer + bytes_read), (buffer_size - bytes_read), data_, len);
+                }
+            }
+            else if (HasData())
+            {
+                assert(data_ != nullptr);
+
+                if (len <= capacity_)
+                {
+                    bytes_read += DecodeHandleIds((buffer + bytes_read), (buffer_size - bytes_read), data_, len);
+                }
+                else
+                {
+                    // Array elements are relative to the previous element, so the full array is decoded to find the
+                    // end of its data.
+                    T* ids = DecodeAllocator::Allocate<T>(len, false);
+                    bytes_read += DecodeHandleIds((buffer + bytes_read), (buffer_size - bytes_read), ids, len);
+                    std::copy(ids, ids + capacity_, data_);
+
+                    GFXRECON_LOG_WARNING("Pointer decoder's external memory capacity (%" PRIuPTR
+                                         ") is smaller than the decoded array size (%" PRIuPTR
+                                         "); data will be truncated",
+                                         capacity_,
+                                         len);
+                }
+            }
+        }
+
+        return bytes_read;
+    }
+
+    size_t DecodeHandleIds(const uint8_t* buffer, size_t buffer_size, format::HandleId* ids, size_t len)
+    {
+        if ((GetAttributeMask() & format::PointerAttributes::kIsArray) == format::PointerAttributes::kIsArray)
+        {
+            return ValueDecoder::DecodeHandleIdArray(buffer, buffer_size, ids, len);
+        }
+
+        return ValueDecoder::DecodeHandleIdValue(buffer, buffer_size, ids);
+    }
+
     template <typename SrcT>
     size_t DecodeFrom(const uint8_t* buffer, size_t buffer_size)
     {
@@ -149,7 +215,11 @@ class PointerDecoder : public PointerDecoderBase
                (format::PointerAttributes::kIsWString | format::PointerAttributes::kIsArray));
         assert((GetAttributeMask() & format::PointerAttributes::kIsStruct) != format::PointerAttributes::kIsStruct);
 
-        if (!IsNull())
+        if ((GetAttributeMask() & format::PointerAttributes::kHasBlobId) == format::PointerAttributes::kHasBlobId)
+        {
+            bytes_read += DecodeBlob<SrcT>((buffer + bytes_read), (buffer_size - bytes_read));
+        }
+        else if (!IsNull())
         {
             if (!is_memory_external_)
             {
@@ -164,6 +234,39 @@ class PointerDecoder : public PointerDecoderBase
         return bytes_read;
     }
 
+    // Decodes the ID of a blob that was encoded in place of the array data, and copies the data of the blob, which was
+    // read from an earlier kSetBlobDataCommand block, to the array.
+    template <typename SrcT>
+    size_t DecodeBlob(const uint8_t* buffer, size_t buffer_size)
+    {
+        uint64_t blob_id    = 0;
+        size_t   bytes_read = ValueDecoder::DecodeUInt64Value(buffer, buffer_size, &blob_id);
+        size_t   len        = GetLength();
+
+        if (!is_memory_external_)
+        {
+            assert(data_ == nullptr);
+            data_ = DecodeAllocator::Allocate<T>(len);
+        }
+
+        const DecodeContext*        context = DecodeContext::GetCurrent();
+        const std::vector<uint8_t>* blob    = (context != nullptr) ? context->GetBlobData(blob_id) : nullptr;
+
+        if ((blob != nullptr) && (sizeof(SrcT) == sizeof(T)) && (blob->size() == (len * sizeof(SrcT))))
+        {
+            size_t copy_len = is_memory_external_ ? std::min(len, capacity_) : len;
+            memcpy(data_, blob->data(), copy_len * sizeof(T));
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to find the data of blob 0x%" PRIx64 " for an array of %" PRIuPTR " elements",
+                               blob_id,
+                               len);
+        }
+
+        return bytes_read;
+    }
+
     template <typename SrcT>
     size_t DecodeInternal(const uint8_t* buffer, size_t buffer_size)
     {
@@ -22,16 +22,75 @@
 
 #include "decode/referenced_resource_table.h"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+const uint32_t kInvalidIndex             = std::numeric_limits<uint32_t>::max();
+const size_t   kMinDeduplicationSize     = 16;
+const uint64_t kMemorySampleInterval     = 256;
+const size_t   kHashNodeOverhead         = 2 * sizeof(void*);
+const uint32_t kContainerGenerationShift = 32;
+
+static uint64_t PackBindingKey(uint32_t binding, uint32_t element)
+{
+    return (static_cast<uint64_t>(binding) << 32) | element;
+}
+
+// Appends a value to a list that is allowed to hold duplicates until it has grown to twice its size after the previous
+// duplicate removal, which bounds the list to twice the number of unique values with an amortized constant cost for
+// each append.
+template <typename T>
+static void AppendUnique(T value, std::vector<T>* values, size_t* unique_count)
+{
+    assert((values != nullptr) && (unique_count != nullptr));
+
+    if (values->empty() || (values->back() != value))
+    {
+        values->push_back(value);
+
+        if (values->size() >= std::max(*unique_count * 2, kMinDeduplicationSize))
+        {
+            std::sort(values->begin(), values->end());
+            values->erase(std::unique(values->begin(), values->end()), values->end());
+            *unique_count = values->size();
+        }
+    }
+}
+
+template <typename T>
+static size_t GetVectorMemoryUsage(const std::vector<T>& values)
+{
+    return values.capacity() * sizeof(T);
+}
+
+static size_t GetVectorMemoryUsage(const std::vector<bool>& values)
+{
+    return values.capacity() / 8;
+}
+
+template <typename Map>
+static size_t GetMapMemoryUsage(const Map& map)
+{
+    return (map.size() * (sizeof(typename Map::value_type) + kHashNodeOverhead)) + (map.bucket_count() * sizeof(void*));
+}
+
 void ReferencedResourceTable::AddResource(format::HandleId resource_id)
 {
-    if (resource_id != format::kNullHandleId)
+    if ((resource_id != format::kNullHandleId) && (resource_indices_.find(resource_id) == resource_indices_.end()))
     {
-        resources_.emplace(resource_id, std::make_shared<ResourceInfo>());
+        resource_indices_.emplace(resource_id, static_cast<uint32_t>(resource_ids_.size()));
+        resource_ids_.push_back(resource_id);
+        resource_used_.push_back(false);
+        resource_is_child_.push_back(false);
+
+        if (collect_first_uses_)
+        {
+            resource_parents_.emplace_back();
+        }
     }
 }
 
@@ -39,28 +98,33 @@ void ReferencedResourceTable::AddResource(format::HandleId parent_id, format::Ha
 {
     if ((parent_id != format::kNullHandleId) && (resource_id != format::kNullHandleId))
     {
-        auto parent_entry = resources_.find(parent_id);
+        uint32_t parent_index = GetResourceIndex(parent_id);
 
-        if (parent_entry != resources_.end())
+        if (parent_index != kInvalidIndex)
         {
-            auto& parent_info = parent_entry->second;
-            assert(parent_info != nullptr);
-
-            auto resource_entry = resources_.find(resource_id);
-            if (resource_entry == resources_.end())
+            uint32_t resource_index = GetResourceIndex(resource_id);
+            if (resource_index == kInvalidIndex)
             {
-                // The resource is not in the table, so add it to both the table and to the parent's child list.
-                auto resource_info      = std::make_shared<ResourceInfo>();
-                resource_info->is_child = true;
-
-                parent_info->child_infos.emplace_back(std::weak_ptr<ResourceInfo>{ resource_info });
-                resources_.emplace(resource_id, resource_info);
+                // The resource is not in the table, so add it to the table as a child.
+                resource_index = static_cast<uint32_t>(resource_ids_.size());
+                resource_indices_.emplace(resource_id, resource_index);
+                resource_ids_.push_back(resource_id);
+                resource_used_.push_back(false);
+                resource_is_child_.push_back(true);
+
+                if (collect_first_uses_)
+                {
+                    resource_parents_.emplace_back();
+                }
             }
-            else
+
+            // A resource that has already been added to the table may have multiple parent objects (e.g. a framebuffer
+            // is created from multiple image views), so an edge is added for each parent.
+            resource_edges_.push_back({ resource_index, parent_index });
+
+            if (collect_first_uses_)
             {
-                // The resource has already been added to the table, but has multiple parent objects (e.g. a framebuffer
-                // is created from multiple image views), so we add it to the parent's child list.
-                parent_info->child_infos.emplace_back(std::weak_ptr<ResourceInfo>{ resource_entry->second });
+                resource_parents_[resource_index].push_back(parent_index);
             }
         }
     }
@@ -86,19 +150,20 @@ void ReferencedResourceTable::AddResourceToContainer(format::HandleId container_
 {
     if ((container_id != format::kNullHandleId) && (resource_id != format::kNullHandleId))
     {
-        auto container_entry = containers_.find(container_id);
-        if (container_entry != containers_.end())
+        auto container_info = GetContainerInfo(container_id);
+        if (container_info != nullptr)
         {
-            auto& container_info = container_entry->second;
-            auto  resource_entry = resources_.find(resource_id);
-
-            if (resource_entry != resources_.end())
+            uint32_t resource_index = GetResourceIndex(resource_id);
+            if (resource_index != kInvalidIndex)
             {
-                auto& resource_info = resource_entry->second;
-                assert((container_info != nullptr) && (resource_info != nullptr));
+                // Resources that have already been used do not need to be tracked for later submissions.
+                if (!resource_used_[resource_index])
+                {
+                    AppendUnique(
+                        resource_index, &container_info->pending_resources, &container_info->unique_resource_count);
+                }
 
-                container_info->resource_infos.emplace(resource_id, std::weak_ptr<ResourceInfo>{ resource_info });
-                container_info->resource_bindings[binding].insert(std::make_pair(element, resource_id));
+                container_info->resource_bindings[PackBindingKey(binding, element)] = resource_index;
             }
         }
     }
@@ -111,15 +176,12 @@ void ReferencedResourceTable::AddResourceToUser(format::HandleId user_id, format
         auto user_entry = users_.find(user_id);
         if (user_entry != users_.end())
         {
-            auto& user_info      = user_entry->second;
-            auto  resource_entry = resources_.find(resource_id);
+            auto&    user_info      = user_entry->second;
+            uint32_t resource_index = GetResourceIndex(resource_id);
 
-            if (resource_entry != resources_.end())
+            if ((resource_index != kInvalidIndex) && !resource_used_[resource_index])
             {
-                auto& resource_info = resource_entry->second;
-                assert((user_info != nullptr) && (resource_info != nullptr));
-
-                user_info->resource_infos.emplace(resource_id, std::weak_ptr<ResourceInfo>{ resource_info });
+                AppendUnique(resource_index, &user_info.pending_resources, &user_info.unique_resource_count);
             }
         }
     }
@@ -133,15 +195,16 @@ void ReferencedResourceTable::AddContainerToUser(format::HandleId user_id, forma
         if (user_entry != users_.end())
         {
             auto& user_info       = user_entry->second;
-            auto  container_entry = containers_.find(container_id);
+            auto  container_entry = container_indices_.find(container_id);
 
-            if (container_entry != containers_.end())
+            if (container_entry != container_indices_.end())
             {
-                auto& container_info = container_entry->second;
-                assert((user_info != nullptr) && (container_info != nullptr));
+                uint32_t     container_index = container_entry->second;
+                ContainerRef container_ref =
+                    (static_cast<uint64_t>(containers_[container_index].generation) << kContainerGenerationShift) |
+                    container_index;
 
-                user_info->container_infos.emplace(container_id,
-                                                   std::weak_ptr<ResourceContainerInfo>{ container_info });
+                AppendUnique(container_ref, &user_info.containers, &user_info.unique_container_count);
             }
         }
     }
@@ -149,7 +212,7 @@ void ReferencedResourceTable::AddContainerToUser(format::HandleId user_id, forma
 
 void ReferencedResourceTable::AddUserToUser(format::HandleId user_id, format::HandleId source_user_id)
 {
-    if ((user_id != format::kNullHandleId) && (source_user_id != format::kNullHandleId))
+    if ((user_id != format::kNullHandleId) && (source_user_id != format::kNullHandleId) && (user_id != source_user_id))
     {
         auto user_entry = users_.find(user_id);
         if (user_entry != users_.end())
@@ -159,28 +222,22 @@ void ReferencedResourceTable::AddUserToUser(format::HandleId user_id, format::Ha
 
             if (source_user_entry != users_.end())
             {
-                auto& source_user_info = source_user_entry->second;
-                assert((user_info != nullptr) && (source_user_info != nullptr));
+                const auto& source_user_info = source_user_entry->second;
 
                 // Copy resource and container info from source user to destination user.
-                auto&       resource_infos         = user_info->resource_infos;
-                auto&       container_infos        = user_info->container_infos;
-                const auto& source_resource_infos  = source_user_info->resource_infos;
-                const auto& source_container_infos = source_user_info->container_infos;
-
-                for (auto& source_resource_info : source_resource_infos)
+                for (auto resource_index : source_user_info.pending_resources)
                 {
-                    if (!source_resource_info.second.expired())
+                    if (!resource_used_[resource_index])
                     {
-                        resource_infos.insert(source_resource_info);
+                        AppendUnique(resource_index, &user_info.pending_resources, &user_info.unique_resource_count);
                     }
                 }
 
-                for (auto& source_container_info : source_container_infos)
+                for (auto container_ref : source_user_info.containers)
                 {
-                    if (!source_container_info.second.expired())
+                    if (GetReferencedContainerInfo(container_ref) != nullptr)
                     {
-                        container_infos.insert(source_container_info);
+                        AppendUnique(container_ref, &user_info.containers, &user_info.unique_container_count);
                     }
                 }
             }
@@ -192,9 +249,25 @@ void ReferencedResourceTable::AddContainer(format::HandleId pool_id, format::Han
 {
     if ((pool_id != format::kNullHandleId) && (container_id != format::kNullHandleId))
     {
-        auto container_info     = std::make_shared<ResourceContainerInfo>();
-        container_info->pool_id = pool_id;
-        containers_.emplace(container_id, std::move(container_info));
+        if (container_indices_.find(container_id) == container_indices_.end())
+        {
+            uint32_t container_index = 0;
+
+            if (!free_container_indices_.empty())
+            {
+                container_index = free_container_indices_.back();
+                free_container_indices_.pop_back();
+            }
+            else
+            {
+                container_index = static_cast<uint32_t>(containers_.size());
+                containers_.emplace_back();
+            }
+
+            containers_[container_index].pool_id = pool_id;
+            container_indices_.emplace(container_id, container_index);
+        }
+
         container_pool_handles_[pool_id].insert(container_id);
     }
 }
@@ -203,8 +276,8 @@ void ReferencedResourceTable::AddUser(format::HandleId pool_id, format::HandleId
 {
     if ((pool_id != format::kNullHandleId) && (user_id != format::kNullHandleId))
     {
-        auto user_info     = std::make_shared<ResourceUserInfo>();
-        user_info->pool_id = pool_id;
+        ResourceUserInfo user_info;
+        user_info.pool_id = pool_id;
         users_.emplace(user_id, std::move(user_info));
         user_pool_handles_[pool_id].insert(user_id);
     }
@@ -214,14 +287,14 @@ void ReferencedResourceTable::RemoveContainer(format::HandleId container_id)
 {
     if (container_id != format::kNullHandleId)
     {
-        auto container_entry = containers_.find(container_id);
-        if (container_entry != containers_.end())
+        auto container_entry = container_indices_.find(container_id);
+        if (container_entry != container_indices_.end())
         {
-            auto& container_info = container_entry->second;
-            assert(container_info != nullptr);
+            uint32_t container_index = container_entry->second;
 
-            container_pool_handles_[container_info->pool_id].erase(container_id);
-            containers_.erase(container_entry);
+            container_pool_handles_[containers_[container_index].pool_id].erase(container_id);
+            container_indices_.erase(container_entry);
+            ReleaseContainer(container_index);
         }
     }
 }
@@ -233,10 +306,7 @@ void ReferencedResourceTable::RemoveUser(format::HandleId user_id)
         auto user_entry = users_.find(user_id);
         if (user_entry != users_.end())
         {
-            auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
-
-            user_pool_handles_[user_info->pool_id].erase(user_id);
+            user_pool_handles_[user_entry->second.pool_id].erase(user_id);
             users_.erase(user_entry);
         }
     }
@@ -246,13 +316,11 @@ void ReferencedResourceTable::ResetContainer(format::HandleId container_id)
 {
     if (container_id != format::kNullHandleId)
     {
-        auto container_entry = containers_.find(container_id);
-        if (container_entry != containers_.end())
+        auto container_info = GetContainerInfo(container_id);
+        if (container_info != nullptr)
         {
-            auto& container_info = container_entry->second;
-            assert(container_info != nullptr);
-
-            container_info->resource_infos.clear();
+            container_info->pending_resources.clear();
+            container_info->unique_resource_count = 0;
             container_info->resource_bindings.clear();
         }
     }
@@ -266,10 +334,11 @@ void ReferencedResourceTable::ResetUser(format::HandleId user_id)
         if (user_entry != users_.end())
         {
             auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
 
-            user_info->resource_infos.clear();
-            user_info->container_infos.clear();
+            user_info.pending_resources.clear();
+            user_info.unique_resource_count = 0;
+            user_info.containers.clear();
+            user_info.unique_container_count = 0;
         }
     }
 }
@@ -305,7 +374,12 @@ void ReferencedResourceTable::ClearContainers(format::HandleId pool_id)
         auto& container_ids = container_pool_handles_[pool_id];
         for (auto container_id : container_ids)
         {
-            containers_.erase(container_id);
+            auto container_entry = container_indices_.find(container_id);
+            if (container_entry != container_indices_.end())
+            {
+                ReleaseContainer(container_entry->second);
+                container_indices_.erase(container_entry);
+            }
         }
 
         container_ids.clear();
@@ -335,20 +409,17 @@ void ReferencedResourceTable::CopyContainerEntry(format::HandleId source_contain
 {
     if (source_container_id != format::kNullHandleId)
     {
-        const auto container_entry = containers_.find(source_container_id);
-        if (container_entry != containers_.end())
+        const auto container_info = GetContainerInfo(source_container_id);
+        if (container_info != nullptr)
         {
-            const auto& container_info = container_entry->second;
-            const auto  binding_entry  = container_info->resource_bindings.find(source_binding);
-            if (binding_entry != container_info->resource_bindings.end())
+            const auto element_entry =
+                container_info->resource_bindings.find(PackBindingKey(source_binding, source_element));
+            if (element_entry != container_info->resource_bindings.end())
             {
-                const auto& binding_elements = binding_entry->second;
-                const auto  element_entry    = binding_elements.find(source_element);
-                if (element_entry != binding_elements.end())
-                {
-                    AddResourceToContainer(
-                        destination_container_id, element_entry->second, destination_binding, destination_element);
-                }
+                AddResourceToContainer(destination_container_id,
+                                       resource_ids_[element_entry->second],
+                                       destination_binding,
+                                       destination_element);
             }
         }
     }
@@ -362,35 +433,32 @@ void ReferencedResourceTable::ProcessUserSubmission(format::HandleId user_id)
         if (user_entry != users_.end())
         {
             auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
 
-            auto& resource_infos  = user_info->resource_infos;
-            auto& container_infos = user_info->container_infos;
+            // Only the resources that were added since the user or its containers were last submitted are pending, so
+            // the cost of a submission is proportional to the new references instead of to the full size of the user.
+            MarkResourcesUsed(&user_info.pending_resources, &user_info.unique_resource_count);
 
-            for (auto& resource_info : resource_infos)
-            {
-                if (!resource_info.second.expired())
-                {
-                    auto resource_info_ptr  = resource_info.second.lock();
-                    resource_info_ptr->used = true;
-                }
-            }
+            // References to destroyed containers are dropped while marking the resources of the valid containers.
+            auto&  containers  = user_info.containers;
+            size_t valid_count = 0;
 
-            for (auto& container_info : container_infos)
+            for (auto container_ref : containers)
             {
-                if (!container_info.second.expired())
+                auto container_info = GetReferencedContainerInfo(container_ref);
+                if (container_info != nullptr)
                 {
-                    auto container_info_ptr = container_info.second.lock();
-                    for (auto& resource_info : container_info_ptr->resource_infos)
-                    {
-                        if (!resource_info.second.expired())
-                        {
-                            auto resource_info_ptr  = resource_info.second.lock();
-                            resource_info_ptr->used = true;
-                        }
-                    }
+                    MarkResourcesUsed(&container_info->pending_resources, &container_info->unique_resource_count);
+                    containers[valid_count++] = container_ref;
                 }
             }
+
+            containers.resize(valid_count);
+            user_info.unique_container_count = std::min(user_info.unique_container_count, valid_count);
+        }
+
+        if ((++submission_count_ % kMemorySampleInterval) == 0)
+        {
+            memory_high_water_mark_ = std::max(memory_high_water_mark_, GetMemoryUsage());
         }
     }
 }
@@ -398,51 +466,169 @@ void ReferencedResourceTable::ProcessUserSubmission(format::HandleId user_id)
 void ReferencedResourceTable::GetReferencedResourceIds(std::unordered_set<format::HandleId>* referenced_ids,
                                                        std::unordered_set<format::HandleId>* unreferenced_ids) const
 {
-    for (auto resource_entry : resources_)
+    // A resource that was not used directly is used indirectly when one of its children was used.  Children are
+    // normally created after their parents, so visiting the edges from the most recently created child propagates the
+    // use through a chain of descendants in a single pass.  Passes are repeated until nothing changes to handle any
+    // other creation order.
+    std::vector<bool>         used  = resource_used_;
+    std::vector<ResourceEdge> edges = resource_edges_;
+
+    std::stable_sort(edges.begin(), edges.end(), [](const ResourceEdge& lhs, const ResourceEdge& rhs) {
+        return lhs.child_index > rhs.child_index;
+    });
+
+    bool changed = true;
+    while (changed)
     {
-        auto& resource_info = resource_entry.second;
+        changed = false;
 
-        if (!resource_info->is_child)
+        for (const auto& edge : edges)
         {
-            bool used = IsUsed(resource_info.get());
+            if (used[edge.child_index] && !used[edge.parent_index])
+            {
+                used[edge.parent_index] = true;
+                changed                 = true;
+            }
+        }
+    }
 
-            if (used && (referenced_ids != nullptr))
+    for (size_t i = 0; i < resource_ids_.size(); ++i)
+    {
+        if (!resource_is_child_[i])
+        {
+            if (used[i] && (referenced_ids != nullptr))
             {
-                referenced_ids->insert(resource_entry.first);
+                referenced_ids->insert(resource_ids_[i]);
             }
-            else if (!used && (unreferenced_ids != nullptr))
+            else if (!used[i] && (unreferenced_ids != nullptr))
             {
-                unreferenced_ids->insert(resource_entry.first);
+                unreferenced_ids->insert(resource_ids_[i]);
             }
         }
     }
 }
 
-bool ReferencedResourceTable::IsUsed(const ResourceInfo* resource_info) const
+size_t ReferencedResourceTable::GetMemoryHighWaterMark() const
+{
+    return std::max(memory_high_water_mark_, GetMemoryUsage());
+}
+
+uint32_t ReferencedResourceTable::GetResourceIndex(format::HandleId resource_id) const
+{
+    auto resource_entry = resource_indices_.find(resource_id);
+    return (resource_entry != resource_indices_.end()) ? resource_entry->second : kInvalidIndex;
+}
+
+ReferencedResourceTable::ResourceContainerInfo* ReferencedResourceTable::GetContainerInfo(format::HandleId container_id)
+{
+    auto container_entry = container_indices_.find(container_id);
+    return (container_entry != container_indices_.end()) ? &containers_[container_entry->second] : nullptr;
+}
+
+ReferencedResourceTable::ResourceContainerInfo*
+ReferencedResourceTable::GetReferencedContainerInfo(ContainerRef container_ref)
 {
-    assert(resource_info != nullptr);
+    uint32_t container_index = static_cast<uint32_t>(container_ref);
+    uint32_t generation      = static_cast<uint32_t>(container_ref >> kContainerGenerationShift);
+
+    assert(container_index < containers_.size());
+
+    auto& container_info = containers_[container_index];
+    return (container_info.generation == generation) ? &container_info : nullptr;
+}
 
-    if (resource_info->used)
+void ReferencedResourceTable::MarkResourcesUsed(std::vector<uint32_t>* resources, size_t* unique_count)
+{
+    assert((resources != nullptr) && (unique_count != nullptr));
+
+    for (auto resource_index : *resources)
     {
-        return true;
+        MarkResourceUsed(resource_index);
     }
-    else
+
+    resources->clear();
+    *unique_count = 0;
+}
+
+void ReferencedResourceTable::MarkResourceUsed(uint32_t resource_index)
+{
+    if (!collect_first_uses_ || resource_used_[resource_index])
     {
-        // If the resource was not used directly, check to see if it was used indirectly through a child.
-        for (const auto& child_info : resource_info->child_infos)
+        resource_used_[resource_index] = true;
+        return;
+    }
+
+    // Parents are marked with the child, so that the resource whose data is initialized (e.g. the image of an image
+    // view) is reported when only the child is referenced.
+    std::vector<uint32_t> pending_indices(1, resource_index);
+
+    while (!pending_indices.empty())
+    {
+        uint32_t index = pending_indices.back();
+        pending_indices.pop_back();
+
+        if (!resource_used_[index])
         {
-            if (!child_info.expired())
-            {
-                const auto child_info_ptr = child_info.lock();
-                if (IsUsed(child_info_ptr.get()))
-                {
-                    return true;
-                }
-            }
+            resource_used_[index] = true;
+            first_used_ids_.push_back(resource_ids_[index]);
+            pending_indices.insert(
+                pending_indices.end(), resource_parents_[index].begin(), resource_parents_[index].end());
         }
     }
+}
+
+void ReferencedResourceTable::ReleaseContainer(uint32_t container_index)
+{
+    assert(container_index < containers_.size());
+
+    // Advance the generation so that user references to the destroyed container are ignored after the slot is reused,
+    // and release the container's storage.
+    auto& container_info = containers_[container_index];
+    ++container_info.generation;
+    container_info.pool_id = format::kNullHandleId;
+    std::vector<uint32_t>().swap(container_info.pending_resources);
+    container_info.unique_resource_count = 0;
+    std::unordered_map<uint64_t, uint32_t>().swap(container_info.resource_bindings);
+
+    free_container_indices_.push_back(container_index);
+}
+
+size_t ReferencedResourceTable::GetMemoryUsage() const
+{
+    size_t usage = GetMapMemoryUsage(resource_indices_) + GetVectorMemoryUsage(resource_ids_) +
+                   GetVectorMemoryUsage(resource_used_) + GetVectorMemoryUsage(resource_is_child_) +
+                   GetVectorMemoryUsage(resource_edges_);
+
+    usage += GetMapMemoryUsage(container_indices_) + GetVectorMemoryUsage(containers_) +
+             GetVectorMemoryUsage(free_container_indices_);
+
+    for (const auto& container_info : containers_)
+    {
+        usage += GetVectorMemoryUsage(container_info.pending_resources) +
+                 GetMapMemoryUsage(container_info.resource_bindings);
+    }
+
+    usage += GetMapMemoryUsage(users_);
+
+    for (const auto& user_entry : users_)
+    {
+        usage += GetVectorMemoryUsage(user_entry.second.pending_resources) +
+                 GetVectorMemoryUsage(user_entry.second.containers);
+    }
+
+    usage += GetMapMemoryUsage(container_pool_handles_) + GetMapMemoryUsage(user_pool_handles_);
+
+    for (const auto& pool_entry : container_pool_handles_)
+    {
+        usage += GetMapMemoryUsage(pool_entry.second);
+    }
+
+    for (const auto& pool_entry : user_pool_handles_)
+    {
+        usage += GetMapMemoryUsage(pool_entry.second);
+    }
 
-    return false;
+    return usage;
 }
 
 GFXRECON_END_NAMESPACE(decode)
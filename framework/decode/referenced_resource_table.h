@@ -28,7 +28,6 @@
 
 #include "vulkan/vulkan.h"
 
-#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -88,45 +87,95 @@ class ReferencedResourceTable
     void GetReferencedResourceIds(std::unordered_set<format::HandleId>* referenced_ids,
                                   std::unordered_set<format::HandleId>* unreferenced_ids) const;
 
+    // Returns the largest amount of memory, in bytes, that was sampled for the table's data during analysis.
+    size_t GetMemoryHighWaterMark() const;
+
+    // Enables the collection of the resources that are used for the first time by a submission, including the parents
+    // of a used child resource.  Must be set before resources are added to the table.
+    void SetCollectFirstUses(bool collect) { collect_first_uses_ = collect; }
+
+    const std::vector<format::HandleId>& GetFirstUsedResourceIds() const { return first_used_ids_; }
+
+    void ClearFirstUsedResourceIds() { first_used_ids_.clear(); }
+
   private:
-    // Track the referenced/used state of a resource (buffer, image, view, framebuffer).
-    struct ResourceInfo
-    {
-        bool                                     used{ false };
-        bool                                     is_child{ false };
-        std::vector<std::weak_ptr<ResourceInfo>> child_infos;
-    };
+    // Reference to a container slot, combining the slot index with the generation of the container that occupied the
+    // slot when the reference was made, so that references to destroyed containers can be detected when the slot is
+    // reused.
+    typedef uint64_t ContainerRef;
 
-    // Track the referenced/used state of a resource container (descriptor set).
+    // Track the state of a resource container (descriptor set).  Only the resources that have not been marked as used
+    // are kept in the pending list, which is emptied when a user that references the container is submitted.
     struct ResourceContainerInfo
     {
-        format::HandleId                                                  pool_id{ format::kNullHandleId };
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceInfo>> resource_infos;
+        format::HandleId      pool_id{ format::kNullHandleId };
+        uint32_t              generation{ 0 };
+        std::vector<uint32_t> pending_resources;
+        size_t                unique_resource_count{ 0 };
 
-        // Table mapping a container binding to a handle.  Each binding contains a table of handles keyed by array
-        // element index.
-        std::unordered_map<uint32_t, std::unordered_map<uint32_t, format::HandleId>> resource_bindings;
+        // Table mapping a container binding and array element, packed into a single key, to a resource index.
+        std::unordered_map<uint64_t, uint32_t> resource_bindings;
     };
 
     // Track the state of a resource user (command buffer).
     struct ResourceUserInfo
     {
-        format::HandleId                                                           pool_id{ format::kNullHandleId };
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceInfo>>          resource_infos;
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceContainerInfo>> container_infos;
+        format::HandleId          pool_id{ format::kNullHandleId };
+        std::vector<uint32_t>     pending_resources;
+        size_t                    unique_resource_count{ 0 };
+        std::vector<ContainerRef> containers;
+        size_t                    unique_container_count{ 0 };
+    };
+
+    // Parent/child relationship between two resources (e.g. an image and an image view).
+    struct ResourceEdge
+    {
+        uint32_t child_index;
+        uint32_t parent_index;
     };
 
     typedef std::unordered_set<format::HandleId> PoolHandles;
 
   private:
-    bool IsUsed(const ResourceInfo* resource_info) const;
+    uint32_t GetResourceIndex(format::HandleId resource_id) const;
+
+    ResourceContainerInfo* GetContainerInfo(format::HandleId container_id);
+
+    // Returns the referenced container, or nullptr if the container has been destroyed.
+    ResourceContainerInfo* GetReferencedContainerInfo(ContainerRef container_ref);
+
+    void MarkResourcesUsed(std::vector<uint32_t>* resources, size_t* unique_count);
+
+    void MarkResourceUsed(uint32_t resource_index);
+
+    void ReleaseContainer(uint32_t container_index);
+
+    size_t GetMemoryUsage() const;
 
   private:
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceInfo>>          resources_;
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceContainerInfo>> containers_;
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceUserInfo>>      users_;
-    std::unordered_map<format::HandleId, PoolHandles>                            container_pool_handles_;
-    std::unordered_map<format::HandleId, PoolHandles>                            user_pool_handles_;
+    // Resources are never removed from the table, so they are identified by the dense index that is assigned when they
+    // are added, with their state stored in arrays indexed by that value.
+    std::unordered_map<format::HandleId, uint32_t> resource_indices_;
+    std::vector<format::HandleId>                  resource_ids_;
+    std::vector<bool>                              resource_used_;
+    std::vector<bool>                              resource_is_child_;
+    std::vector<ResourceEdge>                      resource_edges_;
+
+    // Parents of each resource, only stored when first uses are collected, to mark the parents when a child is used.
+    std::vector<std::vector<uint32_t>> resource_parents_;
+    std::vector<format::HandleId>      first_used_ids_;
+    bool                               collect_first_uses_{ false };
+
+    // Containers are stored in slots that are reused after the container is destroyed.
+    std::unordered_map<format::HandleId, uint32_t> container_indices_;
+    std::vector<ResourceContainerInfo>             containers_;
+    std::vector<uint32_t>                          free_container_indices_;
+
+    std::unordered_map<format::HandleId, ResourceUserInfo> users_;
+    std::unordered_map<format::HandleId, PoolHandles>      container_pool_handles_;
+    std::unordered_map<format::HandleId, PoolHandles>      user_pool_handles_;
+    uint64_t                                               submission_count_{ 0 };
+    size_t                                                 memory_high_water_mark_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(decode)
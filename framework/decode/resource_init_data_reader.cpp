@@ -0,0 +1,133 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/resource_init_data_reader.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+ResourceInitDataReader::ResourceInitDataReader(const std::string& filename) :
+    input_stream_(std::make_unique<util::FileInputStream>(filename))
+{}
+
+const uint8_t* ResourceInitDataReader::ReadData(const ResourceInitDataLocation& location, uint64_t data_size)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, location.stored_size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+
+    size_t stored_size = static_cast<size_t>(location.stored_size);
+    size_t size        = static_cast<size_t>(data_size);
+
+    if (!IsValid())
+    {
+        GFXRECON_LOG_ERROR("Deferred resource initialization data cannot be read from a file that is not seekable");
+        return nullptr;
+    }
+
+    // Uncompressed data is read directly to the output buffer.
+    bool                  stored_is_data = (location.compression_type == format::CompressionType::kNone) &&
+                                          !location.pattern && (stored_size == size);
+    std::vector<uint8_t>& stored_buffer  = stored_is_data ? data_ : stored_data_;
+
+    if (stored_buffer.size() < stored_size)
+    {
+        stored_buffer.resize(stored_size);
+    }
+
+    if (!input_stream_->Seek(location.offset) ||
+        (input_stream_->Read(stored_buffer.data(), stored_size) != stored_size))
+    {
+        GFXRECON_LOG_ERROR("Failed to read deferred resource initialization data at file offset %" PRIu64,
+                           location.offset);
+        return nullptr;
+    }
+
+    if (stored_is_data)
+    {
+        return data_.data();
+    }
+
+    if (data_.size() < size)
+    {
+        data_.resize(size);
+    }
+
+    if (location.pattern)
+    {
+        if ((stored_size == 0) || (stored_size > size))
+        {
+            GFXRECON_LOG_ERROR("Invalid pattern size for deferred resource initialization data");
+            return nullptr;
+        }
+
+        // Each copy doubles the repeated content, which is already a whole number of patterns.
+        memcpy(data_.data(), stored_data_.data(), stored_size);
+
+        size_t filled_size = stored_size;
+        while (filled_size < size)
+        {
+            size_t copy_size = std::min(filled_size, size - filled_size);
+            memcpy(data_.data() + filled_size, data_.data(), copy_size);
+            filled_size += copy_size;
+        }
+    }
+    else
+    {
+        util::Compressor* compressor = GetCompressor(location.compression_type);
+
+        if ((compressor == nullptr) ||
+            (compressor->Decompress(stored_size, stored_data_.data(), size, data_.data()) != size))
+        {
+            GFXRECON_LOG_ERROR("Failed to decompress deferred resource initialization data at file offset %" PRIu64,
+                               location.offset);
+            return nullptr;
+        }
+    }
+
+    return data_.data();
+}
+
+util::Compressor* ResourceInitDataReader::GetCompressor(format::CompressionType compression_type)
+{
+    auto entry = compressors_.find(compression_type);
+
+    if (entry == compressors_.end())
+    {
+        entry = compressors_
+                    .emplace(compression_type,
+                             std::unique_ptr<util::Compressor>(format::CreateCompressor(compression_type)))
+                    .first;
+    }
+
+    return entry->second.get();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
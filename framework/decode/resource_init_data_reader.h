@@ -0,0 +1,77 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_RESOURCE_INIT_DATA_READER_H
+#define GFXRECON_DECODE_RESOURCE_INIT_DATA_READER_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/file_input_stream.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Location of the data of a buffer or image initialization block in the capture file, which is recorded when the file
+// processor defers reading the data until the resource is used.
+struct ResourceInitDataLocation
+{
+    uint64_t                offset{ 0 };      // Offset of the block's data from the start of the file.
+    uint64_t                stored_size{ 0 }; // Size of the data in the file, which is compressed or a pattern.
+    format::CompressionType compression_type{ format::CompressionType::kNone };
+    bool                    pattern{ false }; // The data is a pattern that is repeated to fill the resource data.
+};
+
+// Reads the deferred initialization data of resources from a capture file.  The file is opened separately from the file
+// processor that is processing it, so that the data can be read from the thread that replays the API calls while the
+// decode thread reads ahead.
+class ResourceInitDataReader
+{
+  public:
+    ResourceInitDataReader(const std::string& filename);
+
+    bool IsValid() const { return input_stream_->IsValid() && input_stream_->IsSeekable(); }
+
+    // Reads data_size bytes of resource data from a location recorded by the file processor, returning a pointer to the
+    // data, which remains valid until the next read, or nullptr if the data could not be read.
+    const uint8_t* ReadData(const ResourceInitDataLocation& location, uint64_t data_size);
+
+  private:
+    util::Compressor* GetCompressor(format::CompressionType compression_type);
+
+  private:
+    std::unique_ptr<util::FileInputStream>                          input_stream_;
+    std::vector<uint8_t>                                            stored_data_;
+    std::vector<uint8_t>                                            data_;
+    std::unordered_map<uint32_t, std::unique_ptr<util::Compressor>> compressors_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_RESOURCE_INIT_DATA_READER_H
@@ -25,11 +25,40 @@
 #include "util/platform.h"
 
 #include <algorithm>
+#include <cstring>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 GFXRECON_BEGIN_NAMESPACE(resource)
 
+// Copies rows that are known to fit in both the source and destination, without the per-row size checks of
+// util::platform::MemoryCopy.  Four rows are copied per iteration so that the row addresses are computed
+// independently, which lets the library memcpy for consecutive rows overlap for the narrow rows of small images.
+static void
+CopyRows(uint8_t* dst, size_t dst_row_pitch, const uint8_t* src, size_t src_row_pitch, size_t row_size, size_t rows)
+{
+    size_t row = 0;
+
+    for (; (row + 4) <= rows; row += 4)
+    {
+        std::memcpy(dst, src, row_size);
+        std::memcpy(dst + dst_row_pitch, src + src_row_pitch, row_size);
+        std::memcpy(dst + (2 * dst_row_pitch), src + (2 * src_row_pitch), row_size);
+        std::memcpy(dst + (3 * dst_row_pitch), src + (3 * src_row_pitch), row_size);
+
+        dst += 4 * dst_row_pitch;
+        src += 4 * src_row_pitch;
+    }
+
+    for (; row < rows; ++row)
+    {
+        std::memcpy(dst, src, row_size);
+
+        dst += dst_row_pitch;
+        src += src_row_pitch;
+    }
+}
+
 void CopyImageSubresourceMemory(uint8_t*       dst,
                                 const uint8_t* src,
                                 size_t         offset,
@@ -101,14 +130,10 @@ void CopyImageSubresourceMemory(uint8_t*       dst,
             }
 
             // First process the complete rows.
-            for (size_t i = 0; i < total_rows; ++i)
-            {
-                size_t copy_size = copy_row_pitch;
-                util::platform::MemoryCopy(copy_dst, copy_size, copy_src, copy_size);
+            CopyRows(copy_dst, dst_row_pitch, copy_src, src_row_pitch, copy_row_pitch, total_rows);
 
-                copy_src += src_row_pitch;
-                copy_dst += dst_row_pitch;
-            }
+            copy_src += total_rows * src_row_pitch;
+            copy_dst += total_rows * dst_row_pitch;
 
             // Process a partial end row.
             if (row_remainder != 0)
@@ -22,10 +22,14 @@
 
 #include "decode/screenshot_handler.h"
 
+#include "util/hash.h"
 #include "util/image_writer.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
 #include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -34,25 +38,70 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 const uint32_t kDefaultQueueFamilyIndex = 0;
 const uint32_t kDefaultQueueIndex       = 0;
 
+// Number of screenshot copies that can be in flight for each device, in addition to the copies being written by the
+// background threads, before replay waits for the oldest one to be written.
+const size_t kExtraCopyResourceCount = 2;
+
+// Maximum number of background threads that encode compressed image files.
+const size_t kMaxEncodeThreadCount = 4;
+
 const size_t kUnormIndex = 0;
 const size_t kSrgbIndex  = 1;
 
 const VkFormat kImageFormats[][2] = {
     // Vulkan image formats for ScreenshotFormat::kBmp
+    { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB },
+    // Vulkan image formats for ScreenshotFormat::kPng
+    { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB },
+    // Vulkan image formats for ScreenshotFormat::kQoi
     { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB }
 };
 
+const char* const kImageFileExtensions[] = { ".bmp", ".png", ".qoi" };
+
+const size_t kBgraPixelSize = 4;
+
 ScreenshotHandler::ScreenshotHandler(ScreenshotFormat                    screenshot_format,
-                                     const std::vector<ScreenshotRange>& screenshot_ranges) :
+                                     const std::vector<ScreenshotRange>& screenshot_ranges,
+                                     uint32_t                            downscale,
+                                     const std::string&                  hash_file_name) :
     current_frame_number_(1),
-    screenshot_format_(screenshot_format), screenshot_ranges_(screenshot_ranges), current_range_index_(0)
-{}
+    screenshot_format_(screenshot_format), screenshot_ranges_(screenshot_ranges), current_range_index_(0),
+    downscale_(std::max(downscale, 1u)), hash_file_(nullptr), shutdown_(false)
+{
+    Initialize(hash_file_name);
+}
 
 ScreenshotHandler::ScreenshotHandler(ScreenshotFormat               screenshot_format,
-                                     std::vector<ScreenshotRange>&& screenshot_ranges) :
+                                     std::vector<ScreenshotRange>&& screenshot_ranges,
+                                     uint32_t                       downscale,
+                                     const std::string&             hash_file_name) :
     current_frame_number_(1),
-    screenshot_format_(screenshot_format), screenshot_ranges_(std::move(screenshot_ranges)), current_range_index_(0)
-{}
+    screenshot_format_(screenshot_format), screenshot_ranges_(std::move(screenshot_ranges)), current_range_index_(0),
+    downscale_(std::max(downscale, 1u)), hash_file_(nullptr), shutdown_(false)
+{
+    Initialize(hash_file_name);
+}
+
+ScreenshotHandler::~ScreenshotHandler()
+{
+    {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        shutdown_ = true;
+    }
+
+    write_available_.notify_all();
+
+    for (auto& thread : write_threads_)
+    {
+        thread.join();
+    }
+
+    if (hash_file_ != nullptr)
+    {
+        util::platform::FileClose(hash_file_);
+    }
+}
 
 void ScreenshotHandler::EndFrame()
 {
@@ -90,7 +139,9 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                                    VkImage                                 image,
                                    VkFormat                                format,
                                    uint32_t                                width,
-                                   uint32_t                                height)
+                                   uint32_t                                height,
+                                   uint32_t                                wait_semaphore_count,
+                                   const VkSemaphore*                      wait_semaphores)
 {
     if ((device_table == nullptr) || (allocator == nullptr))
     {
@@ -102,47 +153,44 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
     // TODO: Improved queue selection; ensure queue supports transfer operations.
 
-    // Get a command pool for the device.
-    auto copy_resource_entry = copy_resources_.find(device);
-    if (copy_resource_entry == copy_resources_.end())
+    // Get the copy resources for the device.
+    DeviceResources* device_resources = GetDeviceResources(device, device_table, allocator);
+    if (device_resources == nullptr)
     {
-        VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
-        create_info.pNext                   = nullptr;
-        create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
-        create_info.queueFamilyIndex        = kDefaultQueueFamilyIndex;
-
-        VkCommandPool command_pool = VK_NULL_HANDLE;
-        result                     = device_table->CreateCommandPool(device, &create_info, nullptr, &command_pool);
-
-        if (result == VK_SUCCESS)
-        {
-            CopyResource copy_resource = {};
-            copy_resource.command_pool = command_pool;
-            copy_resource.allocator    = allocator;
-
-            auto pair           = copy_resources_.emplace(device, std::move(copy_resource));
-            copy_resource_entry = pair.first;
-        }
+        result = VK_ERROR_INITIALIZATION_FAILED;
     }
 
     if (result == VK_SUCCESS)
     {
-        auto&   copy_resource = copy_resource_entry->second;
+        auto&   copy_resource = device_resources->copy_resources[device_resources->next_copy_resource];
         auto    copy_format   = GetConversionFormat(format);
         VkQueue queue         = VK_NULL_HANDLE;
 
+        device_resources->next_copy_resource =
+            (device_resources->next_copy_resource + 1) % device_resources->copy_resources.size();
+
+        // The resource may still be in use by the oldest screenshot in the ring.
+        WaitForPendingWrite(&copy_resource);
+
         // Get a queue.
         device_table->GetDeviceQueue(device, kDefaultQueueFamilyIndex, kDefaultQueueIndex, &queue);
 
+        // The image is downscaled by the blit that converts its format, which is also performed for images that do
+        // not need a format conversion.
+        uint32_t copy_width    = std::max(width / downscale_, 1u);
+        uint32_t copy_height   = std::max(height / downscale_, 1u);
+        bool     scale         = (copy_width != width) || (copy_height != height);
+        bool     needs_convert = scale || (format != copy_format);
+
         // Get a buffer size.
         VkDeviceSize buffer_size     = copy_resource.buffer_size;
         bool         create_resource = false;
 
         // If the copy resource is not initialized, or the image properties have changed, recompute the copy size.
-        if ((buffer_size == 0) || (copy_resource.width != width) || (copy_resource.height != height) ||
-            (copy_resource.format != copy_format))
+        if ((buffer_size == 0) || (copy_resource.width != copy_width) || (copy_resource.height != copy_height) ||
+            (copy_resource.format != copy_format) || ((copy_resource.convert_image != VK_NULL_HANDLE) != needs_convert))
         {
-            buffer_size     = GetCopyBufferSize(device, device_table, copy_format, width, height);
+            buffer_size     = GetCopyBufferSize(device, device_table, copy_format, copy_width, copy_height);
             create_resource = true;
         }
 
@@ -155,10 +203,10 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                                         device_table,
                                         memory_properties,
                                         buffer_size,
-                                        format,
+                                        needs_convert,
                                         copy_format,
-                                        width,
-                                        height,
+                                        copy_width,
+                                        copy_height,
                                         &copy_resource);
         }
         else if (buffer_size == 0)
@@ -169,32 +217,22 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
         if (result == VK_SUCCESS)
         {
-            // Get a command buffer.
-            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+            VkCommandBuffer command_buffer = copy_resource.command_buffer;
 
-            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
-            allocate_info.pNext                       = nullptr;
-            allocate_info.commandPool                 = copy_resource.command_pool;
-            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-            allocate_info.commandBufferCount          = 1;
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.pNext                    = nullptr;
+            begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            begin_info.pInheritanceInfo         = nullptr;
 
-            result = device_table->AllocateCommandBuffers(device, &allocate_info, &command_buffer);
-            if (result == VK_SUCCESS)
-            {
-                VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-                begin_info.pNext                    = nullptr;
-                begin_info.flags                    = 0;
-                begin_info.pInheritanceInfo         = nullptr;
-
-                result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
-            }
+            result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
 
             if (result == VK_SUCCESS)
             {
-                // Transition source image to target to the TRANSFER_DST layout.
+                // Transition source image to target to the TRANSFER_DST layout.  Rendering from other queues is
+                // ordered by the semaphore waits, and rendering from the same queue by the ALL_COMMANDS source stage.
                 VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
                 image_barrier.pNext                           = nullptr;
-                image_barrier.srcAccessMask                   = 0;
+                image_barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
                 image_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
                 image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
                 image_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
@@ -208,7 +246,7 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                 image_barrier.subresourceRange.levelCount     = 1;
 
                 device_table->CmdPipelineBarrier(command_buffer,
-                                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                                 VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
                                                  0,
                                                  0,
@@ -270,8 +308,8 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                     blit_region.dstOffsets[0].x               = 0;
                     blit_region.dstOffsets[0].y               = 0;
                     blit_region.dstOffsets[0].z               = 0;
-                    blit_region.dstOffsets[1].x               = width;
-                    blit_region.dstOffsets[1].y               = height;
+                    blit_region.dstOffsets[1].x               = copy_width;
+                    blit_region.dstOffsets[1].y               = copy_height;
                     blit_region.dstOffsets[1].z               = 1;
 
                     device_table->CmdBlitImage(command_buffer,
@@ -281,7 +319,7 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                                                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                                1,
                                                &blit_region,
-                                               VK_FILTER_NEAREST);
+                                               scale ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
 
                     // Transition blit target from the TRANSFER_DST layout to TRANSFER_SRC layout for the image to
                     // buffer copy.
@@ -311,7 +349,7 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                 copy_region.imageSubresource.baseArrayLayer = 0;
                 copy_region.imageSubresource.layerCount     = 1;
                 copy_region.imageOffset                     = { 0, 0, 0 };
-                copy_region.imageExtent                     = { width, height, 1 };
+                copy_region.imageExtent                     = { copy_width, copy_height, 1 };
 
                 device_table->CmdCopyImageToBuffer(command_buffer,
                                                    copy_image,
@@ -341,68 +379,50 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
                 device_table->EndCommandBuffer(command_buffer);
 
-                // Make sure any pending work is finished, as we are not waiting on any semaphores from previous
-                // submissions.
-                result = device_table->DeviceWaitIdle(device);
+                std::vector<VkPipelineStageFlags> wait_stages(wait_semaphore_count,
+                                                              VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
 
-                if (result == VK_SUCCESS)
+                if (wait_semaphore_count == 0)
                 {
-                    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
-                    submit_info.waitSemaphoreCount   = 0;
-                    submit_info.pWaitSemaphores      = nullptr;
-                    submit_info.pWaitDstStageMask    = nullptr;
-                    submit_info.commandBufferCount   = 1;
-                    submit_info.pCommandBuffers      = &command_buffer;
-                    submit_info.signalSemaphoreCount = 0;
-                    submit_info.pSignalSemaphores    = nullptr;
+                    // Make sure any pending work is finished, as there are no semaphores from previous submissions
+                    // to wait on.
+                    result = device_table->DeviceWaitIdle(device);
+                }
 
-                    result = device_table->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+                if (result == VK_SUCCESS)
+                {
+                    result = device_table->ResetFences(device, 1, &copy_resource.fence);
                 }
 
                 if (result == VK_SUCCESS)
                 {
-                    result = device_table->QueueWaitIdle(queue);
+                    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                    submit_info.waitSemaphoreCount   = wait_semaphore_count;
+                    submit_info.pWaitSemaphores      = wait_semaphores;
+                    submit_info.pWaitDstStageMask    = wait_stages.data();
+                    submit_info.commandBufferCount   = 1;
+                    submit_info.pCommandBuffers      = &command_buffer;
+                    submit_info.signalSemaphoreCount = wait_semaphore_count;
+                    submit_info.pSignalSemaphores    = wait_semaphores;
+
+                    result = device_table->QueueSubmit(queue, 1, &submit_info, copy_resource.fence);
                 }
 
                 if (result == VK_SUCCESS)
                 {
-                    void* data = nullptr;
-                    result     = allocator->MapResourceMemoryDirect(
-                        copy_resource.buffer_size, 0, &data, copy_resource.buffer_data);
+                    copy_resource.filename = filename_prefix;
 
-                    if (result == VK_SUCCESS)
+                    if (hash_file_ == nullptr)
                     {
-                        if ((copy_resource.memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
-                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
-                        {
-                            VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
-                            invalidate_range.pNext               = nullptr;
-                            invalidate_range.memory              = copy_resource.buffer_memory;
-                            invalidate_range.offset              = 0;
-                            invalidate_range.size                = copy_resource.buffer_size;
-
-                            allocator->InvalidateMappedMemoryRangesDirect(
-                                1, &invalidate_range, &copy_resource.buffer_memory_data);
-                        }
-
-                        std::string filename = filename_prefix;
-                        filename += ".bmp";
-
-                        if (!util::imagewriter::WriteBmpImage(filename, width, height, copy_resource.buffer_size, data))
-                        {
-                            GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write file %s",
-                                               filename.c_str());
-                        }
-
-                        allocator->UnmapResourceMemoryDirect(copy_resource.buffer_data);
+                        copy_resource.filename += kImageFileExtensions[static_cast<size_t>(screenshot_format_)];
                     }
+
+                    QueueWrite(device, device_table, &copy_resource);
                 }
                 else
                 {
                     GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
                 }
-
-                device_table->FreeCommandBuffers(device, copy_resource.command_pool, 1, &command_buffer);
             }
         }
         else
@@ -414,20 +434,45 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
 void ScreenshotHandler::DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table)
 {
-    auto entry = copy_resources_.find(device);
-    if (entry != copy_resources_.end())
+    auto entry = device_resources_.find(device);
+    if (entry != device_resources_.end())
     {
-        auto& copy_resource = entry->second;
+        auto& device_resources = entry->second;
+
+        for (auto& copy_resource : device_resources.copy_resources)
+        {
+            WaitForPendingWrite(&copy_resource);
+
+            if (device_table != nullptr)
+            {
+                device_table->DestroyFence(device, copy_resource.fence, nullptr);
+            }
+
+            DestroyCopyResource(device, &copy_resource);
+        }
 
         if (device_table != nullptr)
         {
-            device_table->DestroyCommandPool(entry->first, copy_resource.command_pool, nullptr);
+            device_table->DestroyCommandPool(device, device_resources.command_pool, nullptr);
         }
 
-        DestroyCopyResource(device, &copy_resource);
+        device_resources_.erase(entry);
+    }
+}
 
-        copy_resources_.erase(entry);
+VkDeviceSize ScreenshotHandler::GetBufferMemorySize() const
+{
+    VkDeviceSize size = 0;
+
+    for (const auto& entry : device_resources_)
+    {
+        for (const auto& copy_resource : entry.second.copy_resources)
+        {
+            size += copy_resource.buffer_size;
+        }
     }
+
+    return size;
 }
 
 bool ScreenshotHandler::IsSrgbFormat(VkFormat image_format) const
@@ -544,7 +589,7 @@ VkResult ScreenshotHandler::CreateCopyResource(VkDevice
                                                const encode::DeviceTable*              device_table,
                                                const VkPhysicalDeviceMemoryProperties& memory_properties,
                                                VkDeviceSize                            buffer_size,
-                                               VkFormat                                image_format,
+                                               bool                                    needs_convert,
                                                VkFormat                                screenshot_format,
                                                uint32_t                                width,
                                                uint32_t                                height,
@@ -611,10 +656,10 @@ VkResult ScreenshotHandler::CreateCopyResource(VkDevice
                                                    &copy_resource->memory_property_flags);
     }
 
-    if ((result == VK_SUCCESS) && (image_format != screenshot_format))
+    if ((result == VK_SUCCESS) && needs_convert)
     {
-        // The source image format does not match the image file format and requires a format conversion.  Create an
-        // image to serve as the tranfer destination of a blit based color conversion.
+        // The source image format does not match the image file format and requires a format conversion, or the image
+        // is downscaled.  Create an image to serve as the tranfer destination of a blit based color conversion.
         VkImageCreateInfo image_create_info     = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
         image_create_info.pNext                 = nullptr;
         image_create_info.flags                 = 0;
@@ -668,6 +713,14 @@ VkResult ScreenshotHandler::CreateCopyResource(VkDevice
         }
     }
 
+    if (result == VK_SUCCESS)
+    {
+        // The buffer remains mapped, so that the background thread can read it without calling the allocator to map
+        // it.
+        result = allocator->MapResourceMemoryDirect(
+            buffer_size, 0, &copy_resource->buffer_mapped_data, copy_resource->buffer_data);
+    }
+
     if (result == VK_SUCCESS)
     {
         // Resource creation succeeded.
@@ -688,6 +741,12 @@ void ScreenshotHandler::DestroyCopyResource(VkDevice device, CopyResource* copy_
 {
     if (copy_resource != nullptr)
     {
+        if (copy_resource->buffer_mapped_data != nullptr)
+        {
+            copy_resource->allocator->UnmapResourceMemoryDirect(copy_resource->buffer_data);
+            copy_resource->buffer_mapped_data = nullptr;
+        }
+
         if (copy_resource->buffer != VK_NULL_HANDLE)
         {
             copy_resource->allocator->DestroyBufferDirect(copy_resource->buffer, nullptr, copy_resource->buffer_data);
@@ -722,5 +781,223 @@ void ScreenshotHandler::DestroyCopyResource(VkDevice device, CopyResource* copy_
     }
 }
 
+void ScreenshotHandler::Initialize(const std::string& hash_file_name)
+{
+    if (!hash_file_name.empty())
+    {
+        int32_t result = util::platform::FileOpen(&hash_file_, hash_file_name.c_str(), "w");
+        if ((result != 0) || (hash_file_ == nullptr))
+        {
+            GFXRECON_LOG_ERROR("Failed to open screenshot hash file %s", hash_file_name.c_str());
+            hash_file_ = nullptr;
+        }
+    }
+
+    // BMP files are written without encoding, so a single thread is enough to keep up with replay.  Hashes are also
+    // written by a single thread, so that they are written in frame order.
+    size_t thread_count = 1;
+
+    if ((screenshot_format_ != ScreenshotFormat::kBmp) && hash_file_name.empty())
+    {
+        size_t half_cpu_count = static_cast<size_t>(std::thread::hardware_concurrency()) / 2;
+        thread_count          = std::max(std::min(half_cpu_count, kMaxEncodeThreadCount), thread_count);
+    }
+
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        write_threads_.emplace_back(&ScreenshotHandler::WriteFiles, this);
+    }
+}
+
+ScreenshotHandler::DeviceResources* ScreenshotHandler::GetDeviceResources(VkDevice                   device,
+                                                                         const encode::DeviceTable* device_table,
+                                                                         VulkanResourceAllocator*   allocator)
+{
+    auto entry = device_resources_.find(device);
+    if (entry != device_resources_.end())
+    {
+        return &entry->second;
+    }
+
+    // The command buffer of each copy resource is recorded again for every screenshot.
+    VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    create_info.pNext                   = nullptr;
+    create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    create_info.queueFamilyIndex        = kDefaultQueueFamilyIndex;
+
+    DeviceResources device_resources;
+    device_resources.copy_resources.resize(write_threads_.size() + kExtraCopyResourceCount);
+
+    VkResult result = device_table->CreateCommandPool(device, &create_info, nullptr, &device_resources.command_pool);
+
+    for (auto& copy_resource : device_resources.copy_resources)
+    {
+        copy_resource.allocator = allocator;
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.pNext                       = nullptr;
+            allocate_info.commandPool                 = device_resources.command_pool;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = 1;
+
+            result = device_table->AllocateCommandBuffers(device, &allocate_info, &copy_resource.command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_create_info.pNext             = nullptr;
+            fence_create_info.flags             = 0;
+
+            result = device_table->CreateFence(device, &fence_create_info, nullptr, &copy_resource.fence);
+        }
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        for (auto& copy_resource : device_resources.copy_resources)
+        {
+            device_table->DestroyFence(device, copy_resource.fence, nullptr);
+        }
+
+        device_table->DestroyCommandPool(device, device_resources.command_pool, nullptr);
+
+        return nullptr;
+    }
+
+    auto pair = device_resources_.emplace(device, std::move(device_resources));
+    return &pair.first->second;
+}
+
+void ScreenshotHandler::WaitForPendingWrite(const CopyResource* copy_resource)
+{
+    assert(copy_resource != nullptr);
+
+    std::unique_lock<std::mutex> lock(write_mutex_);
+    write_finished_.wait(lock, [copy_resource]() { return !copy_resource->pending_write; });
+}
+
+void ScreenshotHandler::QueueWrite(VkDevice                   device,
+                                   const encode::DeviceTable* device_table,
+                                   CopyResource*              copy_resource)
+{
+    assert(copy_resource != nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+
+        WriteTask task;
+        task.device        = device;
+        task.device_table  = device_table;
+        task.copy_resource = copy_resource;
+
+        copy_resource->pending_write = true;
+        write_tasks_.push_back(task);
+    }
+
+    write_available_.notify_one();
+}
+
+void ScreenshotHandler::WriteFiles()
+{
+    std::unique_lock<std::mutex> lock(write_mutex_);
+
+    for (;;)
+    {
+        write_available_.wait(lock, [this]() { return shutdown_ || !write_tasks_.empty(); });
+
+        // Tasks that are queued at shutdown are still written.
+        if (write_tasks_.empty())
+        {
+            break;
+        }
+
+        WriteTask task = write_tasks_.front();
+        write_tasks_.pop_front();
+
+        // The resource is not modified by the replay thread while the write is pending.
+        lock.unlock();
+        WriteFile(task.device, task.device_table, task.copy_resource);
+        lock.lock();
+
+        task.copy_resource->pending_write = false;
+        write_finished_.notify_all();
+    }
+}
+
+void ScreenshotHandler::WriteFile(VkDevice                   device,
+                                  const encode::DeviceTable* device_table,
+                                  const CopyResource*        copy_resource) const
+{
+    VkResult result =
+        device_table->WaitForFences(device, 1, &copy_resource->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+    if (result == VK_SUCCESS)
+    {
+        if ((copy_resource->memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
+            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        {
+            VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+            invalidate_range.pNext               = nullptr;
+            invalidate_range.memory              = copy_resource->buffer_memory;
+            invalidate_range.offset              = 0;
+            invalidate_range.size                = copy_resource->buffer_size;
+
+            copy_resource->allocator->InvalidateMappedMemoryRangesDirect(
+                1, &invalidate_range, &copy_resource->buffer_memory_data);
+        }
+
+        bool success = false;
+
+        if (hash_file_ != nullptr)
+        {
+            // Only write a hash of the image data, which is tightly packed by the image to buffer copy.
+            size_t   image_size = static_cast<size_t>(copy_resource->width) * copy_resource->height * kBgraPixelSize;
+            uint64_t hash       = util::hash::Hash64(copy_resource->buffer_mapped_data, image_size);
+
+            success = (fprintf(hash_file_, "%s %016" PRIx64 "\n", copy_resource->filename.c_str(), hash) > 0);
+        }
+        else
+        {
+            switch (screenshot_format_)
+            {
+                case ScreenshotFormat::kPng:
+                    success = util::imagewriter::WritePngImage(copy_resource->filename,
+                                                               copy_resource->width,
+                                                               copy_resource->height,
+                                                               copy_resource->buffer_size,
+                                                               copy_resource->buffer_mapped_data);
+                    break;
+                case ScreenshotFormat::kQoi:
+                    success = util::imagewriter::WriteQoiImage(copy_resource->filename,
+                                                               copy_resource->width,
+                                                               copy_resource->height,
+                                                               copy_resource->buffer_size,
+                                                               copy_resource->buffer_mapped_data);
+                    break;
+                default:
+                    success = util::imagewriter::WriteBmpImage(copy_resource->filename,
+                                                               copy_resource->width,
+                                                               copy_resource->height,
+                                                               copy_resource->buffer_size,
+                                                               copy_resource->buffer_mapped_data);
+                    break;
+            }
+        }
+
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write file %s",
+                               copy_resource->filename.c_str());
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
+    }
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
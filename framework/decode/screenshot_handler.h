@@ -30,19 +30,38 @@
 
 #include "vulkan/vulkan.h"
 
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Copies swapchain images to host visible buffers and writes them to image files.  Each device has a ring of copy
+// resources, so that the copy for one screenshot can execute while replay continues.  The files are written by
+// background threads, which wait for each copy to complete.  Compressed formats are encoded by several threads.
 class ScreenshotHandler
 {
   public:
-    ScreenshotHandler(ScreenshotFormat screenshot_format, const std::vector<ScreenshotRange>& screenshot_ranges);
+    // Screenshots are downscaled on the GPU, dividing their width and height by downscale.  When hash_file_name is not
+    // empty, a 64-bit hash of each screenshot is written to the file in place of the image file.
+    ScreenshotHandler(ScreenshotFormat                    screenshot_format,
+                      const std::vector<ScreenshotRange>& screenshot_ranges,
+                      uint32_t                            downscale,
+                      const std::string&                  hash_file_name);
 
-    ScreenshotHandler(ScreenshotFormat screenshot_format, std::vector<ScreenshotRange>&& screenshot_ranges);
+    ScreenshotHandler(ScreenshotFormat               screenshot_format,
+                      std::vector<ScreenshotRange>&& screenshot_ranges,
+                      uint32_t                       downscale,
+                      const std::string&             hash_file_name);
+
+    // Writes the screenshots that are still pending and stops the background thread.
+    ~ScreenshotHandler();
 
     uint32_t GetCurrentFrame() const { return current_frame_number_; }
 
@@ -50,6 +69,9 @@ class ScreenshotHandler
 
     bool IsScreenshotFrame() const;
 
+    // Submits a copy of the image to a host visible buffer and queues the image file write.  The copy waits for the
+    // specified semaphores and then signals them again, so that the present that follows still waits for the
+    // rendering of the image.  When there are no semaphores to wait for, the device is idled before the copy.
     void WriteImage(const std::string&                      filename_prefix,
                     VkDevice                                device,
                     const encode::DeviceTable*              device_table,
@@ -58,14 +80,19 @@ class ScreenshotHandler
                     VkImage                                 image,
                     VkFormat                                format,
                     uint32_t                                width,
-                    uint32_t                                height);
+                    uint32_t                                height,
+                    uint32_t                                wait_semaphore_count,
+                    const VkSemaphore*                      wait_semaphores);
 
+    // Waits for the device's pending screenshots to be written before destroying its copy resources.
     void DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table);
 
+    // Returns the size of the host visible buffers that screenshots are copied to, for all devices.
+    VkDeviceSize GetBufferMemorySize() const;
+
   private:
     struct CopyResource
     {
-        VkCommandPool                         command_pool{ VK_NULL_HANDLE };
         VulkanResourceAllocator*              allocator{ nullptr };
         VkDeviceSize                          buffer_size{ 0 };
         VkDeviceMemory                        buffer_memory{ VK_NULL_HANDLE };
@@ -80,9 +107,28 @@ class ScreenshotHandler
         uint32_t                              width{ 0 };
         uint32_t                              height{ 0 };
         VkMemoryPropertyFlags                 memory_property_flags{ 0 };
+        void*                                 buffer_mapped_data{ nullptr };
+        VkCommandBuffer                       command_buffer{ VK_NULL_HANDLE };
+        VkFence                               fence{ VK_NULL_HANDLE };
+        std::string                           filename;
+        bool                                  pending_write{ false }; // Guarded by write_mutex_.
+    };
+
+    struct DeviceResources
+    {
+        VkCommandPool             command_pool{ VK_NULL_HANDLE };
+        std::vector<CopyResource> copy_resources;
+        size_t                    next_copy_resource{ 0 };
+    };
+
+    struct WriteTask
+    {
+        VkDevice                   device{ VK_NULL_HANDLE };
+        const encode::DeviceTable* device_table{ nullptr };
+        CopyResource*              copy_resource{ nullptr };
     };
 
-    typedef std::unordered_map<VkDevice, CopyResource> CommandPools;
+    typedef std::unordered_map<VkDevice, DeviceResources> DeviceResourceMap;
 
   private:
     bool IsSrgbFormat(VkFormat image_format) const;
@@ -103,7 +149,7 @@ class ScreenshotHandler
                                 const encode::DeviceTable*              device_table,
                                 const VkPhysicalDeviceMemoryProperties& memory_properties,
                                 VkDeviceSize                            buffer_size,
-                                VkFormat                                image_format,
+                                bool                                    needs_convert,
                                 VkFormat                                screenshot_format,
                                 uint32_t                                width,
                                 uint32_t                                height,
@@ -111,12 +157,35 @@ class ScreenshotHandler
 
     void DestroyCopyResource(VkDevice device, CopyResource* copy_resource) const;
 
+    void Initialize(const std::string& hash_file_name);
+
+    DeviceResources* GetDeviceResources(VkDevice                   device,
+                                        const encode::DeviceTable* device_table,
+                                        VulkanResourceAllocator*   allocator);
+
+    // Waits for the background thread to finish writing the file for a previous copy with the resource.
+    void WaitForPendingWrite(const CopyResource* copy_resource);
+
+    void QueueWrite(VkDevice device, const encode::DeviceTable* device_table, CopyResource* copy_resource);
+
+    void WriteFiles();
+
+    void WriteFile(VkDevice device, const encode::DeviceTable* device_table, const CopyResource* copy_resource) const;
+
   private:
     uint32_t                     current_frame_number_;
-    CommandPools                 copy_resources_;
+    DeviceResourceMap            device_resources_;
     ScreenshotFormat             screenshot_format_;
     std::vector<ScreenshotRange> screenshot_ranges_;
     size_t                       current_range_index_;
+    uint32_t                     downscale_;
+    FILE*                        hash_file_;
+    std::vector<std::thread>     write_threads_;
+    std::deque<WriteTask>        write_tasks_;
+    bool                         shutdown_;
+    std::mutex                   write_mutex_;
+    std::condition_variable      write_available_;
+    std::condition_variable      write_finished_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,515 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/seek_index.h"
+
+#include "format/api_call_id.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const char     kSeekIndexFileExtension[] = ".idx";
+const uint64_t kFirstFrameNumber         = 1; // Number of the first frame of a capture that was not trimmed.
+
+// State of the scan of a capture file by BuildSeekIndex().
+struct SeekIndexScan
+{
+    std::vector<format::SeekIndexEntry>*                            entries{ nullptr };
+    uint64_t                                                        first_block_offset{ 0 };
+    uint64_t                                                        frame_number{ kFirstFrameNumber };
+    bool                                                            first_frame_pending{ true };
+    format::CompressionType                                         compression_type{ format::kNone };
+    std::unordered_map<uint32_t, std::unique_ptr<util::Compressor>> compressors;
+    std::vector<uint8_t>                                            compressed_buffer;
+    std::vector<uint8_t>                                            batch_buffer;
+    std::vector<uint8_t>                                            compact_batch_buffer;
+};
+
+static bool ReadSeekIndexBlocks(FILE* file, std::vector<format::SeekIndexEntry>* entries)
+{
+    format::SeekIndexFooterCommand footer;
+
+    if (!util::platform::FileSeek(file, -static_cast<int64_t>(sizeof(footer)), util::platform::FileSeekEnd) ||
+        (util::platform::FileRead(&footer, sizeof(footer), 1, file) != 1))
+    {
+        return false;
+    }
+
+    if ((footer.meta_header.block_header.type != format::BlockType::kMetaDataBlock) ||
+        (footer.meta_header.block_header.size != format::GetMetaDataBlockBaseSize(footer)) ||
+        (footer.meta_header.meta_data_type != format::MetaDataType::kSeekIndexFooterCommand) ||
+        (footer.fourcc != GFXRECON_SEEK_INDEX_FOURCC))
+    {
+        return false;
+    }
+
+    format::SeekIndexCommandHeader index_header;
+
+    if (!util::platform::FileSeek(file, static_cast<int64_t>(footer.index_offset), util::platform::FileSeekSet) ||
+        (util::platform::FileRead(&index_header, sizeof(index_header), 1, file) != 1))
+    {
+        return false;
+    }
+
+    if ((index_header.meta_header.block_header.type != format::BlockType::kMetaDataBlock) ||
+        (index_header.meta_header.meta_data_type != format::MetaDataType::kSeekIndexCommand) ||
+        (index_header.meta_header.block_header.size !=
+         (format::GetMetaDataBlockBaseSize(index_header) + index_header.entry_count * sizeof(format::SeekIndexEntry))))
+    {
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, index_header.entry_count);
+
+    entries->resize(static_cast<size_t>(index_header.entry_count));
+
+    return entries->empty() ||
+           (util::platform::FileRead(entries->data(), sizeof(format::SeekIndexEntry), entries->size(), file) ==
+            entries->size());
+}
+
+static void
+AddSeekIndexEntry(SeekIndexScan* scan, uint64_t offset, uint64_t frame_number, format::SeekIndexEntryType type)
+{
+    format::SeekIndexEntry entry;
+    entry.offset       = offset;
+    entry.frame_number = frame_number;
+    entry.type         = type;
+
+    scan->entries->push_back(entry);
+}
+
+// Adds the entry for the first frame, which starts at the first block unless the file starts with a state snapshot.
+static void AddFirstFrameEntry(SeekIndexScan* scan)
+{
+    if (scan->first_frame_pending)
+    {
+        scan->first_frame_pending = false;
+        AddSeekIndexEntry(scan, scan->first_block_offset, kFirstFrameNumber, format::kFrameSeekIndexEntry);
+    }
+}
+
+// Adds the entries for a block, which starts at block_offset and ends at block_end in the file, from the start of its
+// data.  Blocks read from a batch have the offsets of the batch, which is the closest location that can be seeked to.
+static void ScanBlock(SeekIndexScan*             scan,
+                      const format::BlockHeader& block_header,
+                      const uint8_t*             data,
+                      size_t                     data_size,
+                      uint64_t                   block_offset,
+                      uint64_t                   block_end)
+{
+    if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock)
+    {
+        format::ApiCallId call_id = format::ApiCallId::ApiCall_Unknown;
+
+        if (data_size >= sizeof(call_id))
+        {
+            std::memcpy(&call_id, data, sizeof(call_id));
+        }
+
+        // The same frame delimiter that is used by the file processor.
+        if (call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR)
+        {
+            AddFirstFrameEntry(scan);
+
+            ++scan->frame_number;
+            AddSeekIndexEntry(scan, block_end, scan->frame_number, format::kFrameSeekIndexEntry);
+        }
+    }
+    else if ((block_header.type == format::BlockType::kStateMarkerBlock) &&
+             (data_size >= (sizeof(format::MarkerType) + sizeof(uint64_t))))
+    {
+        format::MarkerType marker_type  = format::MarkerType::kUnknownMarker;
+        uint64_t           frame_number = 0;
+
+        std::memcpy(&marker_type, data, sizeof(marker_type));
+        std::memcpy(&frame_number, data + sizeof(marker_type), sizeof(frame_number));
+
+        if (marker_type == format::MarkerType::kBeginMarker)
+        {
+            // The frames of a trimmed capture start after the state snapshot.
+            scan->first_frame_pending = false;
+            AddSeekIndexEntry(scan, block_offset, frame_number, format::kStateBeginSeekIndexEntry);
+        }
+        else if (marker_type == format::MarkerType::kEndMarker)
+        {
+            scan->frame_number = frame_number;
+            AddSeekIndexEntry(scan, block_end, frame_number, format::kStateEndSeekIndexEntry);
+            AddSeekIndexEntry(scan, block_end, frame_number, format::kFrameSeekIndexEntry);
+        }
+    }
+}
+
+static util::Compressor* GetScanCompressor(SeekIndexScan* scan, format::BlockType block_type)
+{
+    format::CompressionType compression_type = format::GetBlockCompressionType(block_type);
+
+    if (compression_type == format::CompressionType::kNone)
+    {
+        compression_type = scan->compression_type;
+    }
+
+    auto entry = scan->compressors.find(compression_type);
+    if (entry == scan->compressors.end())
+    {
+        entry = scan->compressors
+                    .emplace(compression_type,
+                             std::unique_ptr<util::Compressor>(format::CreateCompressor(compression_type)))
+                    .first;
+    }
+
+    return entry->second.get();
+}
+
+// Decompresses a batch block and scans the blocks that it contains.
+static bool ScanCompressedBatch(SeekIndexScan*             scan,
+                                FILE*                      file,
+                                const format::BlockHeader& block_header,
+                                uint64_t                   block_offset,
+                                uint64_t                   block_end)
+{
+    uint64_t          uncompressed_size = 0;
+    util::Compressor* compressor        = GetScanCompressor(scan, block_header.type);
+
+    if ((compressor == nullptr) || (block_header.size <= sizeof(uncompressed_size)) ||
+        (util::platform::FileRead(&uncompressed_size, sizeof(uncompressed_size), 1, file) != 1))
+    {
+        GFXRECON_LOG_ERROR("Failed to read the compressed batch block at offset %" PRIu64, block_offset);
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+    size_t compressed_size = static_cast<size_t>(block_header.size) - sizeof(uncompressed_size);
+    size_t batch_size      = static_cast<size_t>(uncompressed_size);
+
+    scan->compressed_buffer.resize(compressed_size);
+
+    if (scan->batch_buffer.size() < batch_size)
+    {
+        scan->batch_buffer.resize(batch_size);
+    }
+
+    if ((util::platform::FileRead(scan->compressed_buffer.data(), 1, compressed_size, file) != compressed_size) ||
+        (compressor->Decompress(compressed_size, scan->compressed_buffer.data(), batch_size, &scan->batch_buffer) !=
+         batch_size))
+    {
+        GFXRECON_LOG_ERROR("Failed to decompress the batch block at offset %" PRIu64, block_offset);
+        return false;
+    }
+
+    const std::vector<uint8_t>* blocks = &scan->batch_buffer;
+
+    if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kCompactBatchBlock)
+    {
+        if (!format::DecodeCompactRecords(scan->batch_buffer.data(), batch_size, &scan->compact_batch_buffer))
+        {
+            GFXRECON_LOG_ERROR("Compact batch block at offset %" PRIu64 " contains invalid records", block_offset);
+            return false;
+        }
+
+        blocks     = &scan->compact_batch_buffer;
+        batch_size = scan->compact_batch_buffer.size();
+    }
+
+    size_t offset = 0;
+
+    while ((batch_size - offset) >= sizeof(format::BlockHeader))
+    {
+        format::BlockHeader batch_block_header;
+        std::memcpy(&batch_block_header, blocks->data() + offset, sizeof(batch_block_header));
+        offset += sizeof(batch_block_header);
+
+        if (batch_block_header.size > (batch_size - offset))
+        {
+            GFXRECON_LOG_ERROR("Batch block at offset %" PRIu64 " contains an incomplete block", block_offset);
+            return false;
+        }
+
+        size_t data_size = static_cast<size_t>(batch_block_header.size);
+        ScanBlock(scan, batch_block_header, blocks->data() + offset, data_size, block_offset, block_end);
+        offset += data_size;
+    }
+
+    return true;
+}
+
+// Loads the compression dictionary that is needed to decompress the batch blocks that follow it.
+static bool ScanCompressionDictionary(SeekIndexScan* scan, FILE* file, const format::BlockHeader& block_header)
+{
+    format::SetCompressionDictionaryCommandHeader header;
+
+    if ((block_header.size < (sizeof(header.meta_header.meta_data_type) + sizeof(header.dictionary_size))) ||
+        (util::platform::FileRead(&header.dictionary_size, sizeof(header.dictionary_size), 1, file) != 1))
+    {
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.dictionary_size);
+
+    std::vector<uint8_t> dictionary(static_cast<size_t>(header.dictionary_size));
+    util::Compressor*    compressor = GetScanCompressor(scan, format::BlockType::kMetaDataBlock);
+
+    return (util::platform::FileRead(dictionary.data(), 1, dictionary.size(), file) == dictionary.size()) &&
+           (compressor != nullptr) && compressor->SetDictionary(dictionary);
+}
+
+std::string GetSeekIndexFilename(const std::string& capture_filename)
+{
+    return capture_filename + kSeekIndexFileExtension;
+}
+
+bool ReadSeekIndex(const std::string& filename, std::vector<format::SeekIndexEntry>* entries)
+{
+    assert(entries != nullptr);
+
+    FILE* file    = nullptr;
+    bool  success = false;
+
+    if (util::platform::FileOpen(&file, filename.c_str(), "rb") == 0)
+    {
+        success = ReadSeekIndexBlocks(file, entries);
+        util::platform::FileClose(file);
+
+        if (!success && (util::platform::FileOpen(&file, GetSeekIndexFilename(filename).c_str(), "rb") == 0))
+        {
+            // The index of a capture file that was indexed after it was written may be in a separate file.
+            success = ReadSeekIndexBlocks(file, entries);
+            util::platform::FileClose(file);
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", filename.c_str());
+    }
+
+    if (!success)
+    {
+        entries->clear();
+    }
+
+    return success;
+}
+
+bool BuildSeekIndex(const std::string& filename, std::vector<format::SeekIndexEntry>* entries)
+{
+    assert(entries != nullptr);
+
+    FILE* file = nullptr;
+
+    entries->clear();
+
+    if (util::platform::FileOpen(&file, filename.c_str(), "rb") != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", filename.c_str());
+        return false;
+    }
+
+    // The file size is needed to detect an incomplete block, because seeking past the end of the file succeeds.
+    uint64_t file_size = 0;
+    if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+    {
+        file_size = static_cast<uint64_t>(std::max(util::platform::FileTell(file), int64_t{ 0 }));
+    }
+
+    util::platform::FileSeek(file, 0, util::platform::FileSeekSet);
+
+    SeekIndexScan                       scan;
+    format::FileHeader                  file_header;
+    std::vector<format::FileOptionPair> file_options;
+    bool                                success = false;
+
+    scan.entries = entries;
+
+    if ((util::platform::FileRead(&file_header, sizeof(file_header), 1, file) == 1) &&
+        format::ValidateFileHeader(file_header))
+    {
+        file_options.resize(file_header.num_options);
+
+        size_t option_count = file_options.size();
+
+        success = (option_count == 0) ||
+                  (util::platform::FileRead(file_options.data(), sizeof(format::FileOptionPair), option_count, file) ==
+                   option_count);
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to read the file header of %s", filename.c_str());
+    }
+
+    for (const auto& option : file_options)
+    {
+        if (option.key == format::FileOption::kCompressionType)
+        {
+            scan.compression_type = static_cast<format::CompressionType>(option.value);
+        }
+    }
+
+    uint64_t offset         = sizeof(file_header) + (file_options.size() * sizeof(format::FileOptionPair));
+    scan.first_block_offset = offset;
+
+    while (success && (offset < file_size))
+    {
+        format::BlockHeader block_header;
+
+        if (((file_size - offset) < sizeof(block_header)) ||
+            (util::platform::FileRead(&block_header, sizeof(block_header), 1, file) != 1) ||
+            (block_header.size > (file_size - offset - sizeof(block_header))))
+        {
+            GFXRECON_LOG_ERROR("File %s ends with an incomplete block at offset %" PRIu64, filename.c_str(), offset);
+            success = false;
+            break;
+        }
+
+        uint64_t block_end = offset + sizeof(block_header) + block_header.size;
+
+        if (format::IsCompressedBatchBlock(block_header.type))
+        {
+            success = ScanCompressedBatch(&scan, file, block_header, offset, block_end);
+        }
+        else if ((format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock) ||
+                 (block_header.type == format::BlockType::kStateMarkerBlock))
+        {
+            // Only the API call ID, or the marker type and frame number, are read from the block.
+            uint8_t data[sizeof(format::MarkerType) + sizeof(uint64_t)];
+            size_t  data_size = static_cast<size_t>(std::min(block_header.size, static_cast<uint64_t>(sizeof(data))));
+
+            success = (util::platform::FileRead(data, 1, data_size, file) == data_size);
+
+            if (success)
+            {
+                ScanBlock(&scan, block_header, data, data_size, offset, block_end);
+            }
+        }
+        else if (block_header.type == format::BlockType::kMetaDataBlock)
+        {
+            format::MetaDataType meta_data_type = format::MetaDataType::kUnknownMetaDataType;
+
+            success = (block_header.size >= sizeof(meta_data_type)) &&
+                      (util::platform::FileRead(&meta_data_type, sizeof(meta_data_type), 1, file) == 1);
+
+            if (success && (meta_data_type == format::MetaDataType::kSetCompressionDictionaryCommand))
+            {
+                success = ScanCompressionDictionary(&scan, file, block_header);
+
+                if (!success)
+                {
+                    GFXRECON_LOG_ERROR("Failed to load the compression dictionary at offset %" PRIu64, offset);
+                }
+            }
+        }
+
+        // The remainder of the block is skipped without being read.
+        success =
+            success && util::platform::FileSeek(file, static_cast<int64_t>(block_end), util::platform::FileSeekSet);
+        offset = block_end;
+    }
+
+    util::platform::FileClose(file);
+
+    if (success)
+    {
+        // A file without frame delimiters or a state snapshot still has an entry for its first frame.
+        AddFirstFrameEntry(&scan);
+    }
+    else
+    {
+        entries->clear();
+    }
+
+    return success;
+}
+
+bool WriteSeekIndex(const std::string& filename, const std::vector<format::SeekIndexEntry>& entries)
+{
+    FILE* file = nullptr;
+
+    if (util::platform::FileOpen(&file, filename.c_str(), "ab") != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", filename.c_str());
+        return false;
+    }
+
+    bool    success      = util::platform::FileSeek(file, 0, util::platform::FileSeekEnd);
+    int64_t index_offset = util::platform::FileTell(file);
+
+    format::SeekIndexCommandHeader index_header;
+    size_t                         entries_size = entries.size() * sizeof(format::SeekIndexEntry);
+
+    index_header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(index_header) + entries_size;
+    index_header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    index_header.meta_header.meta_data_type    = format::MetaDataType::kSeekIndexCommand;
+    index_header.thread_id                     = 0;
+    index_header.entry_count                   = entries.size();
+
+    format::SeekIndexFooterCommand footer;
+    footer.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(footer);
+    footer.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    footer.meta_header.meta_data_type    = format::MetaDataType::kSeekIndexFooterCommand;
+    footer.index_offset                  = static_cast<uint64_t>(index_offset);
+    footer.fourcc                        = GFXRECON_SEEK_INDEX_FOURCC;
+
+    success = success && (index_offset >= 0) &&
+              (util::platform::FileWrite(&index_header, sizeof(index_header), 1, file) == 1) &&
+              (entries.empty() ||
+               (util::platform::FileWrite(entries.data(), sizeof(format::SeekIndexEntry), entries.size(), file) ==
+                entries.size())) &&
+              (util::platform::FileWrite(&footer, sizeof(footer), 1, file) == 1);
+
+    success = (util::platform::FileClose(file) == 0) && success;
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write the seek index to %s", filename.c_str());
+    }
+
+    return success;
+}
+
+uint64_t FindFrameOffset(const std::vector<format::SeekIndexEntry>& entries, uint64_t frame_number)
+{
+    for (const auto& entry : entries)
+    {
+        if ((entry.type == format::kFrameSeekIndexEntry) && (entry.frame_number == frame_number))
+        {
+            return entry.offset;
+        }
+    }
+
+    return 0;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,60 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_SEEK_INDEX_H
+#define GFXRECON_DECODE_SEEK_INDEX_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Returns the name of the file that holds the seek index of a capture file that was indexed after it was written,
+// when the index was not appended to the capture file.
+std::string GetSeekIndexFilename(const std::string& capture_filename);
+
+// Reads the seek index from the end of a capture file, without processing the blocks that precede it.  When the
+// capture file does not end with a seek index, the index is read from the file named by GetSeekIndexFilename(), when
+// it exists.  Returns false if the file cannot be read or an index is not found.
+bool ReadSeekIndex(const std::string& filename, std::vector<format::SeekIndexEntry>* entries);
+
+// Builds the seek index of a capture file that was written without one, with the entries that the capture layer writes
+// for frames and state snapshots.  Only the block headers are read, except for compressed batch blocks, which must be
+// decompressed to find the frame delimiters and state markers that they contain.  Returns false if the file cannot be
+// read or ends with an incomplete block.
+bool BuildSeekIndex(const std::string& filename, std::vector<format::SeekIndexEntry>* entries);
+
+// Appends the seek index blocks to the end of a file, which is either the capture file or a new file named by
+// GetSeekIndexFilename().
+bool WriteSeekIndex(const std::string& filename, const std::vector<format::SeekIndexEntry>& entries);
+
+// Returns the offset of the first block of the specified frame, or 0 if the frame is not in the index.
+uint64_t FindFrameOffset(const std::vector<format::SeekIndexEntry>& entries, uint64_t frame_number);
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_SEEK_INDEX_H
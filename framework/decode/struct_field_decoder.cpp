@@ -0,0 +1,181 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/struct_field_decoder.h"
+
+#include "decode/pnext_node.h"
+#include "decode/value_decoder.h"
+#include "format/format.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+size_t DecodePNextStruct(const uint8_t* buffer, size_t buffer_size, PNextNode** pNext);
+
+// Stores a decoded value in a struct member, converting it to the size of the member when the encoded size differs,
+// such as for size_t members on 32-bit platforms.
+template <typename T>
+static void StoreValue(T value, uint8_t* member, size_t member_size)
+{
+    if (member_size == sizeof(T))
+    {
+        memcpy(member, &value, sizeof(T));
+    }
+    else if (member_size == sizeof(uint32_t))
+    {
+        uint32_t converted = static_cast<uint32_t>(value);
+        memcpy(member, &converted, sizeof(converted));
+    }
+    else if (member_size == sizeof(uint64_t))
+    {
+        uint64_t converted = static_cast<uint64_t>(value);
+        memcpy(member, &converted, sizeof(converted));
+    }
+    else
+    {
+        assert(false);
+    }
+}
+
+// Decodes a value with the type that it was encoded with and stores it in a struct member.
+template <typename T>
+static size_t DecodeValueField(const uint8_t* buffer, size_t buffer_size, uint8_t* member, size_t member_size)
+{
+    T      value      = 0;
+    size_t bytes_read = ValueDecoder::DecodeArrayFrom<T>(buffer, buffer_size, &value, 1);
+
+    if (bytes_read > 0)
+    {
+        StoreValue(value, member, member_size);
+    }
+
+    return bytes_read;
+}
+
+size_t DecodeStructFields(const uint8_t*     buffer,
+                          size_t             buffer_size,
+                          void*              value,
+                          void*              wrapper,
+                          const StructField* fields,
+                          size_t             field_count)
+{
+    assert((value != nullptr) && (wrapper != nullptr) && (fields != nullptr));
+
+    uint8_t* value_bytes   = static_cast<uint8_t*>(value);
+    uint8_t* wrapper_bytes = static_cast<uint8_t*>(wrapper);
+    size_t   bytes_read    = 0;
+
+    for (size_t i = 0; i < field_count; ++i)
+    {
+        const StructField& field     = fields[i];
+        const uint8_t*     src       = buffer + bytes_read;
+        size_t             remaining = buffer_size - bytes_read;
+        uint8_t*           member    = value_bytes + field.value_offset;
+
+        switch (field.type)
+        {
+            case FieldType::kUInt8:
+                bytes_read += DecodeValueField<uint8_t>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kUInt16:
+                bytes_read += DecodeValueField<uint16_t>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kInt32:
+                bytes_read += DecodeValueField<int32_t>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kUInt32:
+                bytes_read += DecodeValueField<uint32_t>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kInt64:
+                bytes_read += DecodeValueField<int64_t>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kUInt64:
+                bytes_read += DecodeValueField<uint64_t>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kFloat:
+                bytes_read += DecodeValueField<float>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kVkBool32:
+                bytes_read += DecodeValueField<uint32_t>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kVkSampleMask:
+                bytes_read += DecodeValueField<format::SampleMaskEncodeType>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kVkDeviceSize:
+                bytes_read += DecodeValueField<format::DeviceSizeEncodeType>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kVkDeviceAddress:
+                bytes_read +=
+                    DecodeValueField<format::DeviceAddressEncodeType>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kSizeT:
+                bytes_read += DecodeValueField<format::SizeTEncodeType>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kEnum:
+                bytes_read += DecodeValueField<format::EnumEncodeType>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kFlags:
+                bytes_read += DecodeValueField<format::FlagsEncodeType>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kFlags64:
+                bytes_read += DecodeValueField<format::Flags64EncodeType>(src, remaining, member, field.value_size);
+                break;
+            case FieldType::kHandleId:
+                bytes_read += ValueDecoder::DecodeHandleIdValue(
+                    src, remaining, reinterpret_cast<format::HandleId*>(wrapper_bytes + field.wrapper_offset));
+                memset(member, 0, field.value_size);
+                break;
+            case FieldType::kAddress:
+                bytes_read += ValueDecoder::DecodeAddress(
+                    src, remaining, reinterpret_cast<uint64_t*>(wrapper_bytes + field.wrapper_offset));
+                memset(member, 0, field.value_size);
+                break;
+            case FieldType::kPNext:
+            {
+                auto        node    = reinterpret_cast<PNextNode**>(wrapper_bytes + field.wrapper_offset);
+                const void* pointer = nullptr;
+
+                bytes_read += DecodePNextStruct(src, remaining, node);
+
+                if (*node != nullptr)
+                {
+                    pointer = (*node)->GetPointer();
+                }
+
+                memcpy(member, &pointer, sizeof(pointer));
+                break;
+            }
+            default:
+                assert(false);
+                break;
+        }
+    }
+
+    return bytes_read;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,82 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_STRUCT_FIELD_DECODER_H
+#define GFXRECON_DECODE_STRUCT_FIELD_DECODER_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Encoded types of the struct members that are decoded from field tables.
+enum class FieldType : uint8_t
+{
+    kUInt8,
+    kUInt16,
+    kInt32,
+    kUInt32,
+    kInt64,
+    kUInt64,
+    kFloat,
+    kVkBool32,
+    kVkSampleMask,
+    kVkDeviceSize,
+    kVkDeviceAddress,
+    kSizeT,
+    kEnum,
+    kFlags,
+    kFlags64,
+    kHandleId, // Capture ID stored by the wrapper, with the struct member set to VK_NULL_HANDLE.
+    kAddress,  // Function or object pointer stored by the wrapper as a 64-bit ID, with the struct member set to null.
+    kPNext     // PNextNode pointer stored by the wrapper, with the struct member pointing to the decoded pNext chain.
+};
+
+// Describes a struct member for decoding from a field table.  The wrapper offset is only used by the field types that
+// store a value in the decoded struct wrapper.
+struct StructField
+{
+    FieldType type;
+    uint16_t  value_offset;
+    uint16_t  value_size;
+    uint16_t  wrapper_offset;
+};
+
+// Decodes the members of a struct that are described by a field table, which the struct decoder generator emits in
+// place of a decoding function for structs that only contain values, handles, and a pNext chain, when it is run with
+// compact struct decoding enabled.  Decoding the rarely used structs with this function keeps their decoding code out
+// of the replay binary.
+size_t DecodeStructFields(const uint8_t*     buffer,
+                          size_t             buffer_size,
+                          void*              value,
+                          void*              wrapper,
+                          const StructField* fields,
+                          size_t             field_count);
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_STRUCT_FIELD_DECODER_H
@@ -33,7 +33,9 @@
 #include "util/defines.h"
 
 #include <cassert>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -135,15 +137,8 @@ class StructPointerDecoder : public PointerDecoderBase
 
             if (HasData())
             {
-                for (size_t i = 0; i < len; ++i)
-                {
-                    decoded_structs_[i].decoded_value = &struct_memory_[i];
-
-                    // Note: We only expect this class to be used with structs that have a decode_struct function.
-                    //       If an error is encoutered here due to a new struct type, the struct decoders need to be
-                    //       updated to support the new type.
-                    bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_structs_[i]);
-                }
+                bytes_read +=
+                    DecodeStructs((buffer + bytes_read), (buffer_size - bytes_read), len, IsLayoutCompatible<T>());
             }
         }
 
@@ -151,6 +146,45 @@ class StructPointerDecoder : public PointerDecoderBase
     }
 
   private:
+    size_t DecodeStructs(const uint8_t* buffer, size_t buffer_size, size_t len, std::false_type)
+    {
+        size_t bytes_read = 0;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            decoded_structs_[i].decoded_value = &struct_memory_[i];
+
+            // Note: We only expect this class to be used with structs that have a decode_struct function.
+            //       If an error is encoutered here due to a new struct type, the struct decoders need to be
+            //       updated to support the new type.
+            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_structs_[i]);
+        }
+
+        return bytes_read;
+    }
+
+    // The encoded struct layout matches the host layout, so the array is copied directly from the buffer.  Members of
+    // the decoded wrapper that reference nested structs are not initialized, because the nested structs do not
+    // contain handles that require the wrappers for mapping.
+    size_t DecodeStructs(const uint8_t* buffer, size_t buffer_size, size_t len, std::true_type)
+    {
+        size_t data_size = len * sizeof(typename T::struct_type);
+
+        if (!kTrustedDecode && (data_size > buffer_size))
+        {
+            return 0;
+        }
+
+        memcpy(struct_memory_, buffer, data_size);
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            decoded_structs_[i].decoded_value = &struct_memory_[i];
+        }
+
+        return data_size;
+    }
+
     /// Memory to hold decoded data. Points to an internal allocation when #is_memory_external_ is false and
     /// to an externally provided allocation when #is_memory_external_ is true.
     T*                       decoded_structs_;
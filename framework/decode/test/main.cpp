@@ -26,14 +26,34 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
 
+#include "decode/analysis_cache.h"
+#include "decode/async_pipeline_creator.h"
+#include "decode/coalesced_memory_fills.h"
+#include "decode/command_buffer_call_executor.h"
+#include "decode/decode_context.h"
+#include "decode/decoded_call_program.h"
+#include "decode/decoded_call_queue.h"
+#include "decode/frame_range_util.h"
+#include "decode/object_info_map.h"
+#include "decode/pointer_decoder.h"
+#include "decode/resource_util.h"
+#include "decode/struct_field_decoder.h"
+#include "decode/struct_pointer_decoder.h"
 #include "decode/vulkan_handle_mapping_util.h"
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_object_info_table.h"
 #include "format/format.h"
 #include "format/format_util.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "generated/generated_vulkan_struct_decoders.h"
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 const VkBuffer                   kBufferHandles[] = { gfxrecon::format::FromHandleId<VkBuffer>(0xabcd),
@@ -70,13 +90,14 @@ TEST_CASE("handle IDs need to be mapped to valid handles", "[wrapper]")
             &gfxrecon::decode::VulkanObjectInfoTable::AddBufferInfo);
 
         // Array add with info and different ID/handle counts.
+        gfxrecon::decode::BufferInfo buffer_infos[1];
         gfxrecon::decode::handle_mapping::AddHandleArray<gfxrecon::decode::BufferInfo>(
             kDeviceId,
             &kBufferIds[2],
             1,
             &kBufferHandles[2],
             2,
-            std::vector<gfxrecon::decode::BufferInfo>(1),
+            buffer_infos,
             &info_table,
             &gfxrecon::decode::VulkanObjectInfoTable::AddBufferInfo);
 
@@ -137,6 +158,37 @@ TEST_CASE("handle IDs need to be mapped to valid handles", "[wrapper]")
         REQUIRE(buffer == VK_NULL_HANDLE);
     }
 
+    SECTION("A buffer ID outside of the paged ID range maps to a valid buffer handle")
+    {
+        const gfxrecon::format::HandleId kLargeBufferId =
+            gfxrecon::decode::ObjectInfoMap<gfxrecon::decode::BufferInfo>::kMaxPagedId + 12;
+
+        gfxrecon::decode::handle_mapping::AddHandle<gfxrecon::decode::BufferInfo>(
+            kDeviceId,
+            kLargeBufferId,
+            kBufferHandles[1],
+            &info_table,
+            &gfxrecon::decode::VulkanObjectInfoTable::AddBufferInfo);
+
+        auto buffer = gfxrecon::decode::handle_mapping::MapHandle<gfxrecon::decode::BufferInfo>(
+            kLargeBufferId, info_table, &gfxrecon::decode::VulkanObjectInfoTable::GetBufferInfo);
+
+        REQUIRE(buffer == kBufferHandles[1]);
+
+        std::vector<const gfxrecon::decode::BufferInfo*> buffers;
+        info_table.VisitBufferInfo([&buffers](const gfxrecon::decode::BufferInfo* info) { buffers.push_back(info); });
+
+        REQUIRE(buffers.size() == 2);
+
+        gfxrecon::decode::handle_mapping::RemoveHandle(
+            kLargeBufferId, &info_table, &gfxrecon::decode::VulkanObjectInfoTable::RemoveBufferInfo);
+
+        buffer = gfxrecon::decode::handle_mapping::MapHandle<gfxrecon::decode::BufferInfo>(
+            kLargeBufferId, info_table, &gfxrecon::decode::VulkanObjectInfoTable::GetBufferInfo);
+
+        REQUIRE(buffer == VK_NULL_HANDLE);
+    }
+
     SECTION("An integer ID with value 12 and type VK_OBJECT_TYPE_BUFFER maps to a valid buffer handle represented as "
             "an integer")
     {
@@ -147,3 +199,732 @@ TEST_CASE("handle IDs need to be mapped to valid handles", "[wrapper]")
 
     gfxrecon::util::Log::Release();
 }
+
+TEST_CASE("arrays of layout compatible structs are decoded with a single copy", "[decode]")
+{
+    const VkRect2D kRects[] = { { { 1, -2 }, { 3, 4 } }, { { -5, 6 }, { 7, 8 } } };
+
+    REQUIRE(gfxrecon::decode::IsLayoutCompatible<gfxrecon::decode::Decoded_VkRect2D>::value);
+
+    // Encoded pointer attributes, address, array length, and struct data.
+    const uint32_t kAttributes = gfxrecon::format::PointerAttributes::kIsArray |
+                                 gfxrecon::format::PointerAttributes::kIsStruct |
+                                 gfxrecon::format::PointerAttributes::kHasAddress |
+                                 gfxrecon::format::PointerAttributes::kHasData;
+    const uint64_t kAddress = 0x1000;
+    const uint64_t kLength  = 2;
+
+    std::vector<uint8_t> buffer(sizeof(kAttributes) + sizeof(kAddress) + sizeof(kLength) + sizeof(kRects));
+    uint8_t*             data = buffer.data();
+    memcpy(data, &kAttributes, sizeof(kAttributes));
+    data += sizeof(kAttributes);
+    memcpy(data, &kAddress, sizeof(kAddress));
+    data += sizeof(kAddress);
+    memcpy(data, &kLength, sizeof(kLength));
+    data += sizeof(kLength);
+    memcpy(data, kRects, sizeof(kRects));
+
+    gfxrecon::decode::DecodeAllocator::Begin();
+
+    gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkRect2D> decoder;
+
+    REQUIRE(decoder.Decode(buffer.data(), buffer.size()) == buffer.size());
+    REQUIRE(decoder.GetLength() == 2);
+    REQUIRE(memcmp(decoder.GetPointer(), kRects, sizeof(kRects)) == 0);
+    REQUIRE(decoder.GetMetaStructPointer()[1].decoded_value == &decoder.GetPointer()[1]);
+
+    gfxrecon::decode::DecodeAllocator::End();
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+}
+
+typedef gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks> AllocatorDecoder;
+
+class DestroyFenceConsumer : public gfxrecon::decode::VulkanConsumer
+{
+  public:
+    virtual void Process_vkDestroyFence(gfxrecon::format::HandleId device,
+                                        gfxrecon::format::HandleId fence,
+                                        AllocatorDecoder*          pAllocator) override
+    {
+        fences.push_back(fence);
+        allocators.push_back(pAllocator);
+    }
+
+    std::vector<gfxrecon::format::HandleId> fences;
+    std::vector<AllocatorDecoder*>          allocators;
+};
+
+// Encoded device ID, fence ID, and NULL allocation callbacks.
+static std::vector<uint8_t> EncodeDestroyFence(gfxrecon::format::HandleId fence_id)
+{
+    std::vector<uint8_t> buffer(sizeof(kDeviceId) + sizeof(fence_id) + sizeof(uint32_t));
+    uint8_t*             data = buffer.data();
+    memcpy(data, &kDeviceId, sizeof(kDeviceId));
+    data += sizeof(kDeviceId);
+    memcpy(data, &fence_id, sizeof(fence_id));
+    data += sizeof(fence_id);
+    const uint32_t kNullAttributes = gfxrecon::format::PointerAttributes::kIsNull;
+    memcpy(data, &kNullAttributes, sizeof(kNullAttributes));
+    return buffer;
+}
+
+TEST_CASE("API call parameters are decoded once for all consumers of a decoder", "[decode]")
+{
+    const gfxrecon::format::HandleId kFenceId = 42;
+    std::vector<uint8_t>             buffer   = EncodeDestroyFence(kFenceId);
+
+    gfxrecon::decode::VulkanDecoder decoder;
+    DestroyFenceConsumer            consumers[2];
+    decoder.AddConsumer(&consumers[0]);
+    decoder.AddConsumer(&consumers[1]);
+
+    // Adding a consumer more than once has no effect.
+    decoder.AddConsumer(&consumers[1]);
+
+    gfxrecon::decode::DecodeAllocator::Begin();
+    decoder.DecodeFunctionCall(gfxrecon::format::ApiCallId::ApiCall_vkDestroyFence,
+                               gfxrecon::decode::ApiCallInfo{},
+                               buffer.data(),
+                               buffer.size());
+    gfxrecon::decode::DecodeAllocator::End();
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+
+    REQUIRE(consumers[0].fences.size() == 1);
+    REQUIRE(consumers[1].fences.size() == 1);
+    REQUIRE(consumers[0].fences[0] == kFenceId);
+    REQUIRE(consumers[1].fences[0] == kFenceId);
+
+    // Both consumers received the same decoded parameter.
+    REQUIRE(consumers[0].allocators[0] == consumers[1].allocators[0]);
+}
+
+TEST_CASE("recorded API calls are passed to the consumers when they are executed", "[decode]")
+{
+    const gfxrecon::format::HandleId kFenceIds[] = { 7, 8 };
+
+    gfxrecon::decode::VulkanDecoder    decoder;
+    gfxrecon::decode::DecodedCallQueue queue;
+    DestroyFenceConsumer               consumer;
+    decoder.AddConsumer(&consumer);
+    REQUIRE(decoder.SetCallRecorder(&queue));
+
+    queue.BeginBatch();
+    for (auto fence_id : kFenceIds)
+    {
+        std::vector<uint8_t> buffer = EncodeDestroyFence(fence_id);
+        decoder.DecodeFunctionCall(gfxrecon::format::ApiCallId::ApiCall_vkDestroyFence,
+                                   gfxrecon::decode::ApiCallInfo{},
+                                   buffer.data(),
+                                   buffer.size());
+    }
+
+    gfxrecon::decode::DecodedCallQueue::FrameState frame_state;
+    frame_state.frame_number = 1;
+    queue.EndBatch(&frame_state);
+
+    // The calls were decoded without being passed to the consumer.
+    REQUIRE(consumer.fences.empty());
+
+    frame_state.frame_number = 0;
+    REQUIRE(queue.ExecuteFrame(&frame_state));
+    REQUIRE(frame_state.frame_number == 1);
+    REQUIRE(!frame_state.more_frames);
+    REQUIRE(consumer.fences.size() == 2);
+    REQUIRE(consumer.fences[0] == kFenceIds[0]);
+    REQUIRE(consumer.fences[1] == kFenceIds[1]);
+
+    // All frames have been executed.
+    REQUIRE(!queue.ExecuteFrame(&frame_state));
+
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+}
+
+class AppendCall : public gfxrecon::decode::DecodedCall
+{
+  public:
+    AppendCall(std::vector<int>* values, int value) : values_(values), value_(value) {}
+
+    virtual void Execute() override
+    {
+        if (value_ < 0)
+        {
+            throw std::runtime_error("call failed");
+        }
+
+        values_->push_back(value_);
+    }
+
+  private:
+    std::vector<int>* values_;
+    int               value_;
+};
+
+TEST_CASE("command buffer calls of each captured thread are executed in order", "[decode]")
+{
+    const size_t kCallCount = 100;
+
+    // Three captured threads, sharing two workers.
+    gfxrecon::decode::CommandBufferCallExecutor executor(2);
+    std::vector<int>                            values[3];
+    std::vector<AppendCall>                     calls;
+
+    calls.reserve(kCallCount * 3);
+    for (size_t i = 0; i < kCallCount; ++i)
+    {
+        for (size_t thread = 0; thread < 3; ++thread)
+        {
+            calls.emplace_back(&values[thread], static_cast<int>(i));
+            executor.Submit(thread, &calls.back());
+        }
+    }
+
+    executor.Wait();
+
+    for (size_t thread = 0; thread < 3; ++thread)
+    {
+        REQUIRE(values[thread].size() == kCallCount);
+
+        for (size_t i = 0; i < kCallCount; ++i)
+        {
+            REQUIRE(values[thread][i] == static_cast<int>(i));
+        }
+    }
+
+    // Exceptions raised by the workers are rethrown by Wait(), and the failed thread's remaining calls are discarded.
+    AppendCall failed_call(&values[0], -1);
+    AppendCall discarded_call(&values[0], 0);
+    executor.Submit(0, &failed_call);
+    executor.Submit(0, &discarded_call);
+    REQUIRE_THROWS_AS(executor.Wait(), std::runtime_error);
+    REQUIRE(values[0].size() == kCallCount);
+}
+
+TEST_CASE("call programs execute the calls of their recorded frames again", "[decode]")
+{
+    std::vector<int> values;
+
+    {
+        gfxrecon::decode::DecodedCallProgram program;
+
+        program.BeginRecording();
+        program.Record(gfxrecon::decode::DecodeAllocator::Construct<AppendCall>(&values, 1));
+        program.Record(gfxrecon::decode::DecodeAllocator::Construct<AppendCall>(&values, 2));
+        program.EndFrame();
+        program.Record(gfxrecon::decode::DecodeAllocator::Construct<AppendCall>(&values, 3));
+        program.EndFrame();
+
+        // Calls that follow the last completed frame are not kept.
+        program.Record(gfxrecon::decode::DecodeAllocator::Construct<AppendCall>(&values, 4));
+        program.EndRecording();
+
+        // Calls are executed as they are recorded.
+        REQUIRE(values == std::vector<int>{ 1, 2, 3, 4 });
+        REQUIRE(program.GetFrameCount() == 2);
+        REQUIRE(program.GetDecodedSize() > 0);
+
+        values.clear();
+        program.ExecuteFrame(1);
+        program.ExecuteFrame(0);
+        program.ExecuteFrame(1);
+        REQUIRE(values == std::vector<int>{ 3, 1, 2, 3 });
+    }
+
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+}
+
+TEST_CASE("asynchronously created pipelines are available after waiting for their task", "[decode]")
+{
+    const uint32_t kTaskCount     = 16;
+    const uint32_t kPipelineCount = 4;
+
+    gfxrecon::decode::AsyncPipelineCreator                               creator(4);
+    std::vector<std::shared_ptr<gfxrecon::decode::PipelineCreationTask>> tasks;
+    std::vector<VkResult>                                                results(kTaskCount, VK_NOT_READY);
+
+    for (uint32_t i = 0; i < kTaskCount; ++i)
+    {
+        VkResult result = (i == 0) ? VK_ERROR_OUT_OF_HOST_MEMORY : VK_SUCCESS;
+
+        tasks.push_back(creator.Submit(
+            kPipelineCount,
+            [i, result](VkPipeline* pipelines) {
+                for (uint32_t j = 0; j < kPipelineCount; ++j)
+                {
+                    pipelines[j] = gfxrecon::format::FromHandleId<VkPipeline>((i * kPipelineCount) + j + 1);
+                }
+                return result;
+            },
+            [&results, i](VkResult result) { results[i] = result; }));
+    }
+
+    // Results are only reported to the thread that waits for a task.
+    creator.WaitAll();
+    REQUIRE(results[0] == VK_NOT_READY);
+
+    for (uint32_t i = 0; i < kTaskCount; ++i)
+    {
+        tasks[i]->Wait();
+        REQUIRE(results[i] == ((i == 0) ? VK_ERROR_OUT_OF_HOST_MEMORY : VK_SUCCESS));
+
+        for (uint32_t j = 0; j < kPipelineCount; ++j)
+        {
+            REQUIRE(tasks[i]->GetPipeline(j) ==
+                    gfxrecon::format::FromHandleId<VkPipeline>((i * kPipelineCount) + j + 1));
+        }
+
+        REQUIRE(tasks[i]->GetPipeline(kPipelineCount) == VK_NULL_HANDLE);
+    }
+}
+
+TEST_CASE("object info map counts the entries of pages and the overflow map", "[decode]")
+{
+    const gfxrecon::format::HandleId kOverflowId = gfxrecon::decode::ObjectInfoMap<int>::kMaxPagedId + 1;
+
+    gfxrecon::decode::ObjectInfoMap<int> map;
+    size_t                               empty_size = map.GetMemorySize();
+
+    REQUIRE(map.Emplace(1, 10).second);
+    REQUIRE(!map.Emplace(1, 11).second);
+    REQUIRE(map.Emplace(kOverflowId, 20).second);
+    REQUIRE(map.GetCount() == 2);
+    REQUIRE(map.GetMemorySize() > empty_size);
+
+    // Erasing an ID that is not in the map does not change the count.
+    map.Erase(2);
+    map.Erase(kOverflowId + 1);
+    REQUIRE(map.GetCount() == 2);
+
+    size_t size = map.GetMemorySize();
+
+    map.Erase(1);
+    map.Erase(kOverflowId);
+    REQUIRE(map.GetCount() == 0);
+    REQUIRE(map.GetMemorySize() < size);
+    REQUIRE(map.Find(1) == nullptr);
+}
+
+TEST_CASE("command object info cache evicts the least recently used entry", "[decode]")
+{
+    typedef gfxrecon::decode::CommandObjectInfoCache Cache;
+
+    const void* buffer_key = Cache::GetTypeKey<gfxrecon::decode::BufferInfo>();
+    const void* image_key  = Cache::GetTypeKey<gfxrecon::decode::ImageInfo>();
+    REQUIRE(buffer_key != image_key);
+
+    Cache                        cache;
+    gfxrecon::decode::BufferInfo infos[Cache::kEntryCount + 1];
+
+    for (size_t i = 0; i < Cache::kEntryCount; ++i)
+    {
+        cache.Insert(i + 1, buffer_key, &infos[i]);
+    }
+
+    // Entries are matched by both ID and type.
+    REQUIRE(cache.Find(1, buffer_key) == &infos[0]);
+    REQUIRE(cache.Find(1, image_key) == nullptr);
+
+    // The first entry was used most recently, so the second entry is evicted.
+    cache.Insert(Cache::kEntryCount + 1, buffer_key, &infos[Cache::kEntryCount]);
+    REQUIRE(cache.Find(2, buffer_key) == nullptr);
+    REQUIRE(cache.Find(1, buffer_key) == &infos[0]);
+    REQUIRE(cache.Find(Cache::kEntryCount + 1, buffer_key) == &infos[Cache::kEntryCount]);
+
+    cache.Reset(1);
+    REQUIRE(cache.generation == 1);
+    REQUIRE(cache.Find(1, buffer_key) == nullptr);
+}
+
+TEST_CASE("object info table generation changes when infos are removed", "[decode]")
+{
+    gfxrecon::decode::VulkanObjectInfoTable info_table;
+    gfxrecon::decode::BufferInfo            info;
+
+    info.handle     = kBufferHandles[0];
+    info.capture_id = kBufferIds[0];
+    info_table.AddBufferInfo(std::move(info));
+
+    uint64_t generation = info_table.GetGeneration();
+    info_table.RemoveBufferInfo(kBufferIds[0]);
+    REQUIRE(info_table.GetGeneration() != generation);
+}
+
+TEST_CASE("overlapping and adjacent memory fills are merged with later data taking precedence", "[decode]")
+{
+    gfxrecon::decode::CoalescedMemoryFills fills;
+
+    std::vector<uint8_t> a(16, 0xaa);
+    std::vector<uint8_t> b(16, 0xbb);
+    std::vector<uint8_t> c(8, 0xcc);
+
+    fills.Add(0, a.size(), a.data());
+    fills.Add(16, b.size(), b.data());
+    fills.Add(64, a.size(), a.data());
+    REQUIRE(fills.GetRangeCount() == 2);
+
+    // Overwrite the end of the first range and the start of the second, then bridge the gap between them.
+    fills.Add(12, c.size(), c.data());
+    fills.Add(32, 32, std::vector<uint8_t>(32, 0xdd).data());
+    REQUIRE(fills.GetRangeCount() == 1);
+
+    std::vector<uint8_t> expected(80, 0xdd);
+    std::fill(expected.begin(), expected.begin() + 12, 0xaa);
+    std::fill(expected.begin() + 12, expected.begin() + 20, 0xcc);
+    std::fill(expected.begin() + 20, expected.begin() + 32, 0xbb);
+    std::fill(expected.begin() + 64, expected.end(), 0xaa);
+
+    uint32_t write_count = 0;
+    fills.Apply([&](uint64_t offset, uint64_t size, const uint8_t* data) {
+        REQUIRE(offset == 0);
+        REQUIRE(std::vector<uint8_t>(data, data + size) == expected);
+        ++write_count;
+    });
+
+    REQUIRE(write_count == 1);
+    REQUIRE(fills.IsEmpty());
+}
+
+TEST_CASE("blob references are resolved from the decode context of the calling thread", "[decode]")
+{
+    const uint64_t              kBlobId = 0x1234;
+    const std::vector<uint32_t> first   = { 1, 2, 3, 4 };
+    const std::vector<uint32_t> second  = { 5, 6, 7, 8 };
+
+    gfxrecon::decode::DecodeContext first_context;
+    gfxrecon::decode::DecodeContext second_context;
+    first_context.SetBlobData(
+        kBlobId, reinterpret_cast<const uint8_t*>(first.data()), first.size() * sizeof(uint32_t));
+    second_context.SetBlobData(
+        kBlobId, reinterpret_cast<const uint8_t*>(second.data()), second.size() * sizeof(uint32_t));
+
+    // Pointer attributes, array length, and blob ID of an array that was encoded with the kHasBlobId attribute.
+    uint32_t attrib = gfxrecon::format::PointerAttributes::kIsArray | gfxrecon::format::PointerAttributes::kHasBlobId;
+    uint64_t length = first.size();
+
+    std::vector<uint8_t> buffer(sizeof(attrib) + sizeof(length) + sizeof(kBlobId));
+    memcpy(buffer.data(), &attrib, sizeof(attrib));
+    memcpy(buffer.data() + sizeof(attrib), &length, sizeof(length));
+    memcpy(buffer.data() + sizeof(attrib) + sizeof(length), &kBlobId, sizeof(kBlobId));
+
+    auto decode = [&buffer]() {
+        gfxrecon::decode::PointerDecoder<uint32_t> decoder;
+        REQUIRE(decoder.DecodeUInt32(buffer.data(), buffer.size()) == buffer.size());
+        return std::vector<uint32_t>(decoder.GetPointer(), decoder.GetPointer() + decoder.GetLength());
+    };
+
+    gfxrecon::decode::DecodeAllocator::Begin();
+
+    REQUIRE(gfxrecon::decode::DecodeContext::GetCurrent() == nullptr);
+
+    {
+        gfxrecon::decode::DecodeContext::Scope first_scope(&first_context);
+        REQUIRE(decode() == first);
+
+        {
+            gfxrecon::decode::DecodeContext::Scope second_scope(&second_context);
+            REQUIRE(decode() == second);
+        }
+
+        REQUIRE(decode() == first);
+    }
+
+    REQUIRE(gfxrecon::decode::DecodeContext::GetCurrent() == nullptr);
+
+    gfxrecon::decode::DecodeAllocator::End();
+}
+
+TEST_CASE("handle IDs are decoded with the encoding of the current decode context", "[decode]")
+{
+    const uint8_t  kVarintId[] = { 0xac, 0x02 };
+    const uint64_t kFixedId    = 300;
+
+    gfxrecon::decode::DecodeContext varint_context;
+    varint_context.SetHandleIdEncoding(gfxrecon::format::HandleIdEncoding::kVarintHandleIds);
+
+    gfxrecon::format::HandleId id = 0;
+    REQUIRE(gfxrecon::decode::ValueDecoder::DecodeHandleIdValue(
+                reinterpret_cast<const uint8_t*>(&kFixedId), sizeof(kFixedId), &id) == sizeof(kFixedId));
+    REQUIRE(id == 300);
+
+    {
+        gfxrecon::decode::DecodeContext::Scope varint_scope(&varint_context);
+
+        id = 0;
+        REQUIRE(gfxrecon::decode::ValueDecoder::DecodeHandleIdValue(kVarintId, sizeof(kVarintId), &id) ==
+                sizeof(kVarintId));
+        REQUIRE(id == 300);
+
+        // A context with the default encoding reads fixed size handle IDs while it is current.
+        gfxrecon::decode::DecodeContext        fixed_context;
+        gfxrecon::decode::DecodeContext::Scope fixed_scope(&fixed_context);
+
+        id = 0;
+        REQUIRE(gfxrecon::decode::ValueDecoder::DecodeHandleIdValue(
+                    reinterpret_cast<const uint8_t*>(&kFixedId), sizeof(kFixedId), &id) == sizeof(kFixedId));
+        REQUIRE(id == 300);
+    }
+
+    REQUIRE_FALSE(gfxrecon::decode::ValueDecoder::IsVarintHandleIds());
+}
+
+TEST_CASE("pNext structs with varint handle IDs are decoded when lazy decoding is enabled", "[decode]")
+{
+    const uint32_t kStructAttributes = gfxrecon::format::PointerAttributes::kIsSingle |
+                                       gfxrecon::format::PointerAttributes::kIsStruct |
+                                       gfxrecon::format::PointerAttributes::kHasAddress |
+                                       gfxrecon::format::PointerAttributes::kHasData;
+    const uint32_t kNullAttributes = gfxrecon::format::PointerAttributes::kIsNull;
+    const uint64_t kAddress        = 0x1000;
+    const uint32_t kAllocateType   = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    const uint32_t kDedicatedType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    const uint64_t kSize           = 4096;
+    const uint32_t kTypeIndex      = 3;
+
+    // VkMemoryAllocateInfo with a VkMemoryDedicatedAllocateInfo pNext struct, with the varint encoded image ID 300 and
+    // buffer ID 5, which are smaller than the fixed size encoding of the handle IDs.
+    const uint8_t kHandleIds[] = { 0xac, 0x02, 0x05 };
+
+    std::vector<uint8_t> buffer;
+
+    auto append = [&buffer](const void* data, size_t size) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+
+    append(&kStructAttributes, sizeof(kStructAttributes));
+    append(&kAddress, sizeof(kAddress));
+    append(&kAllocateType, sizeof(kAllocateType));
+    append(&kStructAttributes, sizeof(kStructAttributes));
+    append(&kAddress, sizeof(kAddress));
+    append(&kDedicatedType, sizeof(kDedicatedType));
+    append(&kNullAttributes, sizeof(kNullAttributes));
+    append(kHandleIds, sizeof(kHandleIds));
+    append(&kSize, sizeof(kSize));
+    append(&kTypeIndex, sizeof(kTypeIndex));
+
+    gfxrecon::decode::DecodeContext context;
+    context.SetHandleIdEncoding(gfxrecon::format::HandleIdEncoding::kVarintHandleIds);
+
+    gfxrecon::decode::DecodeContext::Scope scope(&context);
+    gfxrecon::decode::PNextNode::SetLazyDecoding(true);
+    gfxrecon::decode::DecodeAllocator::Begin();
+
+    gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryAllocateInfo> decoder;
+    REQUIRE(decoder.Decode(buffer.data(), buffer.size()) == buffer.size());
+
+    const VkMemoryAllocateInfo* allocate_info = decoder.GetPointer();
+    REQUIRE(allocate_info->allocationSize == kSize);
+    REQUIRE(allocate_info->memoryTypeIndex == kTypeIndex);
+
+    const auto* dedicated_info = reinterpret_cast<const gfxrecon::decode::Decoded_VkMemoryDedicatedAllocateInfo*>(
+        decoder.GetMetaStructPointer()->pNext->GetMetaStructPointer());
+    REQUIRE(dedicated_info->image == 300);
+    REQUIRE(dedicated_info->buffer == 5);
+
+    gfxrecon::decode::DecodeAllocator::End();
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+    gfxrecon::decode::PNextNode::SetLazyDecoding(false);
+}
+
+TEST_CASE("lazily decoded pNext structs reuse their decoded pNext chain", "[decode]")
+{
+    const uint32_t kStructAttributes = gfxrecon::format::PointerAttributes::kIsSingle |
+                                       gfxrecon::format::PointerAttributes::kIsStruct |
+                                       gfxrecon::format::PointerAttributes::kHasAddress |
+                                       gfxrecon::format::PointerAttributes::kHasData;
+    const uint32_t kNullAttributes = gfxrecon::format::PointerAttributes::kIsNull;
+    const uint64_t kAddress        = 0x1000;
+    const uint32_t kAllocateType   = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    const uint32_t kFlagsType      = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+    const uint32_t kDedicatedType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    const uint32_t kFlags          = VK_MEMORY_ALLOCATE_DEVICE_MASK_BIT;
+    const uint32_t kDeviceMask     = 0x3;
+    const uint64_t kImageId        = 300;
+    const uint64_t kBufferId       = 5;
+    const uint64_t kSize           = 4096;
+    const uint32_t kTypeIndex      = 3;
+
+    // VkMemoryAllocateInfo -> VkMemoryAllocateFlagsInfo -> VkMemoryDedicatedAllocateInfo, with fixed size handle IDs.
+    std::vector<uint8_t> buffer;
+
+    auto append = [&buffer](const void* data, size_t size) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+
+    append(&kStructAttributes, sizeof(kStructAttributes));
+    append(&kAddress, sizeof(kAddress));
+    append(&kAllocateType, sizeof(kAllocateType));
+    append(&kStructAttributes, sizeof(kStructAttributes));
+    append(&kAddress, sizeof(kAddress));
+    append(&kFlagsType, sizeof(kFlagsType));
+    append(&kStructAttributes, sizeof(kStructAttributes));
+    append(&kAddress, sizeof(kAddress));
+    append(&kDedicatedType, sizeof(kDedicatedType));
+    append(&kNullAttributes, sizeof(kNullAttributes));
+    append(&kImageId, sizeof(kImageId));
+    append(&kBufferId, sizeof(kBufferId));
+    append(&kFlags, sizeof(kFlags));
+    append(&kDeviceMask, sizeof(kDeviceMask));
+    append(&kSize, sizeof(kSize));
+    append(&kTypeIndex, sizeof(kTypeIndex));
+
+    gfxrecon::decode::PNextNode::SetLazyDecoding(true);
+    gfxrecon::decode::DecodeAllocator::Begin();
+
+    gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryAllocateInfo> decoder;
+    REQUIRE(decoder.Decode(buffer.data(), buffer.size()) == buffer.size());
+
+    const VkMemoryAllocateInfo* allocate_info = decoder.GetPointer();
+    REQUIRE(allocate_info->allocationSize == kSize);
+    REQUIRE(allocate_info->memoryTypeIndex == kTypeIndex);
+
+    gfxrecon::decode::PNextNode* flags_node = decoder.GetMetaStructPointer()->pNext;
+    REQUIRE(flags_node != nullptr);
+
+    const auto* flags_info = reinterpret_cast<const VkMemoryAllocateFlagsInfo*>(flags_node->GetPointer());
+    const void* chain      = flags_info->pNext;
+    REQUIRE(chain != nullptr);
+
+    const auto* flags_meta = reinterpret_cast<const gfxrecon::decode::Decoded_VkMemoryAllocateFlagsInfo*>(
+        flags_node->GetMetaStructPointer());
+    REQUIRE(flags_info->flags == kFlags);
+    REQUIRE(flags_info->deviceMask == kDeviceMask);
+    REQUIRE(flags_info->pNext == chain);
+    REQUIRE(flags_meta->pNext != nullptr);
+    REQUIRE(flags_meta->pNext->GetPointer() == chain);
+
+    const auto* dedicated_info = reinterpret_cast<const gfxrecon::decode::Decoded_VkMemoryDedicatedAllocateInfo*>(
+        flags_meta->pNext->GetMetaStructPointer());
+    REQUIRE(dedicated_info->image == kImageId);
+    REQUIRE(dedicated_info->buffer == kBufferId);
+
+    gfxrecon::decode::DecodeAllocator::End();
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+    gfxrecon::decode::PNextNode::SetLazyDecoding(false);
+}
+
+TEST_CASE("image memory is copied between different row pitches", "[decode]")
+{
+    const size_t   kSrcRowPitch = 12;
+    const size_t   kDstRowPitch = 8;
+    const uint32_t kHeight      = 7;
+
+    std::vector<uint8_t> src(kSrcRowPitch * kHeight);
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = static_cast<uint8_t>(i);
+    }
+
+    // Start part way through the first row, so that the partial first row, the complete rows, and the partial last
+    // row are all copied.
+    const size_t kOffset = 4;
+    const size_t kSize   = src.size() - kOffset - 6;
+
+    std::vector<uint8_t> dst(kDstRowPitch * kHeight, 0xff);
+    gfxrecon::decode::resource::CopyImageSubresourceMemory(
+        dst.data(), src.data() + kOffset, kOffset, kSize, kDstRowPitch, kSrcRowPitch, kHeight);
+
+    std::vector<uint8_t> expected(dst.size(), 0xff);
+    for (size_t row = 0; row < kHeight; ++row)
+    {
+        for (size_t column = 0; column < kDstRowPitch; ++column)
+        {
+            size_t src_offset = (row * kSrcRowPitch) + column;
+            if ((src_offset >= kOffset) && (src_offset < (kOffset + kSize)))
+            {
+                expected[(row * kDstRowPitch) + column] = src[src_offset];
+            }
+        }
+    }
+
+    REQUIRE(dst == expected);
+}
+
+TEST_CASE("analysis cache sections are read back and truncated sections are rejected", "[decode]")
+{
+    std::vector<uint32_t> ids = { 7, 11, 13 };
+
+    gfxrecon::decode::AnalysisCache::Writer writer;
+    writer.Write<uint64_t>(42);
+    writer.WriteVector(ids);
+
+    uint64_t                                value = 0;
+    std::vector<uint32_t>                   read_ids;
+    gfxrecon::decode::AnalysisCache::Reader reader(writer.GetData());
+    REQUIRE(reader.Read(&value));
+    REQUIRE(reader.ReadVector(&read_ids));
+    REQUIRE(reader.IsComplete());
+    REQUIRE(value == 42);
+    REQUIRE(read_ids == ids);
+
+    std::vector<uint8_t> truncated = writer.GetData();
+    truncated.pop_back();
+
+    gfxrecon::decode::AnalysisCache::Reader truncated_reader(truncated);
+    REQUIRE(truncated_reader.Read(&value));
+    REQUIRE(!truncated_reader.ReadVector(&read_ids));
+}
+
+TEST_CASE("struct field tables decode the same values as the generated struct decoders", "[decode]")
+{
+    const gfxrecon::decode::StructField kFields[] = {
+        { gfxrecon::decode::FieldType::kHandleId,
+          offsetof(VkDescriptorBufferInfo, buffer),
+          sizeof(VkBuffer),
+          offsetof(gfxrecon::decode::Decoded_VkDescriptorBufferInfo, buffer) },
+        { gfxrecon::decode::FieldType::kVkDeviceSize,
+          offsetof(VkDescriptorBufferInfo, offset),
+          sizeof(VkDeviceSize),
+          0 },
+        { gfxrecon::decode::FieldType::kVkDeviceSize, offsetof(VkDescriptorBufferInfo, range), sizeof(VkDeviceSize), 0 }
+    };
+
+    const uint64_t       encoded[] = { 42, 256, 1024 };
+    std::vector<uint8_t> buffer(sizeof(encoded));
+    memcpy(buffer.data(), encoded, sizeof(encoded));
+
+    VkDescriptorBufferInfo                           value{};
+    gfxrecon::decode::Decoded_VkDescriptorBufferInfo wrapper;
+    wrapper.decoded_value = &value;
+
+    size_t bytes_read =
+        gfxrecon::decode::DecodeStructFields(buffer.data(), buffer.size(), &value, &wrapper, kFields, 3);
+
+    VkDescriptorBufferInfo                           expected_value{};
+    gfxrecon::decode::Decoded_VkDescriptorBufferInfo expected_wrapper;
+    expected_wrapper.decoded_value = &expected_value;
+
+    size_t expected_bytes_read = gfxrecon::decode::DecodeStruct(buffer.data(), buffer.size(), &expected_wrapper);
+
+    REQUIRE(bytes_read == expected_bytes_read);
+    REQUIRE(wrapper.buffer == expected_wrapper.buffer);
+    REQUIRE(value.buffer == VK_NULL_HANDLE);
+    REQUIRE(value.offset == expected_value.offset);
+    REQUIRE(value.range == expected_value.range);
+    REQUIRE(value.range == 1024);
+}
+
+TEST_CASE("frame ranges select all frames when they are empty or invalid", "[decode]")
+{
+    uint32_t first_frame = 0;
+    uint32_t last_frame  = 0;
+
+    REQUIRE(gfxrecon::decode::ParseFrameRange("3-7", &first_frame, &last_frame));
+    REQUIRE(first_frame == 3);
+    REQUIRE(last_frame == 7);
+
+    REQUIRE(gfxrecon::decode::ParseFrameRange("5", &first_frame, &last_frame));
+    REQUIRE(first_frame == 5);
+    REQUIRE(last_frame == std::numeric_limits<uint32_t>::max());
+
+    REQUIRE(gfxrecon::decode::ParseFrameRange("", &first_frame, &last_frame));
+    REQUIRE(first_frame == 1);
+    REQUIRE(last_frame == std::numeric_limits<uint32_t>::max());
+
+    for (const char* range : { "0-2", "7-3", "2-", "-4", "a-b" })
+    {
+        REQUIRE_FALSE(gfxrecon::decode::ParseFrameRange(range, &first_frame, &last_frame));
+        REQUIRE(first_frame == 1);
+        REQUIRE(last_frame == std::numeric_limits<uint32_t>::max());
+    }
+}
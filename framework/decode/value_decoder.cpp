@@ -0,0 +1,85 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/value_decoder.h"
+
+#include <algorithm>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Maximum number of bytes in the LEB128 encoding of a 64-bit value.
+const size_t kMaxVarintSize = 10;
+
+size_t ValueDecoder::DecodeVarintHandleId(const uint8_t* buffer, size_t buffer_size, format::HandleId* value)
+{
+    assert(value != nullptr);
+
+    uint64_t result     = 0;
+    size_t   bytes_read = 0;
+    size_t   max_size   = std::min(buffer_size, kMaxVarintSize);
+
+    while (bytes_read < max_size)
+    {
+        uint8_t byte = buffer[bytes_read];
+        result |= static_cast<uint64_t>(byte & 0x7f) << (7 * bytes_read);
+        ++bytes_read;
+
+        if ((byte & 0x80) == 0)
+        {
+            (*value) = result;
+            return bytes_read;
+        }
+    }
+
+    // The value is truncated or is longer than a 64-bit value.
+    return 0;
+}
+
+size_t
+ValueDecoder::DecodeVarintHandleIdArray(const uint8_t* buffer, size_t buffer_size, format::HandleId* arr, size_t len)
+{
+    assert(arr != nullptr);
+
+    size_t           bytes_read = 0;
+    format::HandleId previous   = format::kNullHandleId;
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        uint64_t zigzag = 0;
+        size_t   size   = DecodeVarintHandleId((buffer + bytes_read), (buffer_size - bytes_read), &zigzag);
+
+        if (size == 0)
+        {
+            return 0;
+        }
+
+        bytes_read += size;
+        previous += (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+        arr[i] = previous;
+    }
+
+    return bytes_read;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
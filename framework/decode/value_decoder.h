@@ -24,6 +24,7 @@
 #ifndef GFXRECON_DECODE_VALUE_DECODER_H
 #define GFXRECON_DECODE_VALUE_DECODER_H
 
+#include "decode/decode_context.h"
 #include "format/format.h"
 #include "util/defines.h"
 
@@ -36,6 +37,14 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Builds with the TRUSTED_DECODE option decode values without checking that they fit in the remaining buffer, for
+// capture files that are known to be well formed, such as files that have been checked with gfxrecon-info --validate.
+#if defined(GFXRECON_TRUSTED_DECODE)
+constexpr bool kTrustedDecode = true;
+#else
+constexpr bool kTrustedDecode = false;
+#endif
+
 class ValueDecoder
 {
   public:
@@ -69,7 +78,7 @@ class ValueDecoder
     static size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                         { return DecodeAddress(buffer, buffer_size, value); }
     static size_t DecodeFunctionPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                     { return DecodeAddress(buffer, buffer_size, value); }
 
-    static size_t DecodeHandleIdValue(const uint8_t* buffer, size_t buffer_size, format::HandleId* value)           { return DecodeValueFrom<format::HandleEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeHandleIdValue(const uint8_t* buffer, size_t buffer_size, format::HandleId* value)           { return IsVarintHandleIds() ? DecodeVarintHandleId(buffer, buffer_size, value) : DecodeValueFrom<format::HandleEncodeType>(buffer, buffer_size, value); }
     template<typename T>
     static size_t DecodeEnumValue(const uint8_t* buffer, size_t buffer_size, T* value)                              { return DecodeValueFrom<format::EnumEncodeType>(buffer, buffer_size, value); }
     template<typename T>
@@ -93,7 +102,7 @@ class ValueDecoder
     static size_t DecodeUInt8Array(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
     static size_t DecodeVoidArray(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                 { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
 
-    static size_t DecodeHandleIdArray(const uint8_t* buffer, size_t buffer_size, format::HandleId* arr, size_t len) { return DecodeArrayFrom<format::HandleEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeHandleIdArray(const uint8_t* buffer, size_t buffer_size, format::HandleId* arr, size_t len) { return IsVarintHandleIds() ? DecodeVarintHandleIdArray(buffer, buffer_size, arr, len) : DecodeArrayFrom<format::HandleEncodeType>(buffer, buffer_size, arr, len); }
     template<typename T>
     static size_t DecodeEnumArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                    { return DecodeArrayFrom<format::EnumEncodeType>(buffer, buffer_size, arr, len); }
     template<typename T>
@@ -103,6 +112,14 @@ class ValueDecoder
 
     // clang-format on
 
+    // Returns true when the file that the calling thread is decoding encodes handle IDs as varints.  Handle IDs have a
+    // fixed size when no file is being decoded.
+    static bool IsVarintHandleIds()
+    {
+        const DecodeContext* context = DecodeContext::GetCurrent();
+        return (context != nullptr) && context->IsVarintHandleIds();
+    }
+
     // Perform a type conversion for array elements when the original type has a size that is not equal to the target
     // type for conversion.
     template <typename SrcT, typename DstT>
@@ -114,7 +131,7 @@ class ValueDecoder
         size_t bytes_read = 0;
         size_t data_size  = len * sizeof(SrcT);
 
-        if (buffer_size >= data_size)
+        if (kTrustedDecode || (buffer_size >= data_size))
         {
             for (size_t i = 0; i < len; ++i)
             {
@@ -137,6 +154,12 @@ class ValueDecoder
     }
 
   private:
+    static size_t DecodeVarintHandleId(const uint8_t* buffer, size_t buffer_size, format::HandleId* value);
+
+    // Decodes handle ID array elements, which are stored as the zigzag encoded difference from the previous element.
+    static size_t
+    DecodeVarintHandleIdArray(const uint8_t* buffer, size_t buffer_size, format::HandleId* arr, size_t len);
+
     template <typename DstT, typename SrcT>
     static typename std::enable_if<!std::is_pointer<SrcT>::value && !std::is_pointer<DstT>::value, DstT>::type
     TypeCast(SrcT value)
@@ -159,7 +182,7 @@ class ValueDecoder
         size_t bytes_read = 0;
         size_t data_size  = sizeof(T);
 
-        if (buffer_size >= data_size)
+        if (kTrustedDecode || (buffer_size >= data_size))
         {
             bytes_read = data_size;
             memcpy(value, buffer, data_size);
@@ -176,7 +199,7 @@ class ValueDecoder
         size_t bytes_read = 0;
         size_t data_size  = sizeof(SrcT);
 
-        if (buffer_size >= data_size)
+        if (kTrustedDecode || (buffer_size >= data_size))
         {
             SrcT from_type = 0;
             bytes_read     = data_size;
@@ -195,7 +218,7 @@ class ValueDecoder
         size_t bytes_read = 0;
         size_t data_size  = len * sizeof(T);
 
-        if (buffer_size >= data_size)
+        if (kTrustedDecode || (buffer_size >= data_size))
         {
             bytes_read = data_size;
             memcpy(arr, buffer, data_size);
@@ -0,0 +1,955 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_accel_struct_cache.h"
+
+#include "decode/analysis_cache.h"
+#include "util/hash.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+struct CacheFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capture_size;
+    uint64_t capture_hash;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t  pipeline_cache_uuid[VK_UUID_SIZE];
+};
+
+struct CacheEntryHeader
+{
+    uint64_t key;
+    uint64_t size;
+    uint64_t hash;
+};
+
+const uint32_t kCacheFileMagic   = 0x42584647; // 'GFXB'
+const uint32_t kCacheFileVersion = 1;
+
+// Serialized acceleration structures start with the driver and compatibility UUIDs, followed by the serialized size,
+// the deserialized size, and the number of acceleration structure handles that follow, which is 0 for bottom level
+// acceleration structures.
+const size_t kSerializedVersionSize     = 2 * VK_UUID_SIZE;
+const size_t kSerializedHandleCountSize = sizeof(uint64_t);
+const size_t kSerializedHeaderSize      = kSerializedVersionSize + (3 * sizeof(uint64_t));
+
+// Alignment required for the device addresses of serialized acceleration structures.
+const VkDeviceSize kSerializedDataAlignment = 256;
+
+// Limit for the size of the buffer that serialized acceleration structures are read back through.
+const VkDeviceSize kMaxReadbackSize = 256 * 1024 * 1024;
+
+const VkBufferUsageFlags kSerializedDataUsage =
+    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+    VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR;
+
+template <typename T>
+static uint64_t HashValue(const T& value, uint64_t seed)
+{
+    return util::hash::Hash64(&value, sizeof(value), seed);
+}
+
+static VkDeviceSize AlignSize(VkDeviceSize size)
+{
+    return (size + kSerializedDataAlignment - 1) & ~(kSerializedDataAlignment - 1);
+}
+
+static void InitCacheFileHeader(const VkPhysicalDeviceProperties& properties,
+                                uint64_t                          capture_size,
+                                uint64_t                          capture_hash,
+                                CacheFileHeader*                  header)
+{
+    assert(header != nullptr);
+
+    // The header is compared with memcmp, so its padding is cleared.
+    std::memset(header, 0, sizeof(CacheFileHeader));
+    header->magic          = kCacheFileMagic;
+    header->version        = kCacheFileVersion;
+    header->capture_size   = capture_size;
+    header->capture_hash   = capture_hash;
+    header->vendor_id      = properties.vendorID;
+    header->device_id      = properties.deviceID;
+    header->driver_version = properties.driverVersion;
+    std::memcpy(header->pipeline_cache_uuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+VulkanAccelStructCache::VulkanAccelStructCache(VkDevice                                device,
+                                               const encode::DeviceTable*              device_table,
+                                               const VkPhysicalDeviceProperties&       properties,
+                                               const VkPhysicalDeviceMemoryProperties& memory_properties,
+                                               VulkanResourceAllocator*                allocator,
+                                               PFN_vkGetBufferDeviceAddress            get_buffer_device_address) :
+    device_(device),
+    device_table_(device_table), properties_(properties), memory_properties_(memory_properties),
+    allocator_(allocator), get_buffer_device_address_(get_buffer_device_address), cache_file_(nullptr),
+    append_offset_(0), write_failed_(false)
+{
+    assert((device_ != VK_NULL_HANDLE) && (device_table_ != nullptr) && (allocator_ != nullptr) &&
+           (get_buffer_device_address_ != nullptr));
+}
+
+VulkanAccelStructCache::~VulkanAccelStructCache()
+{
+    for (auto& entry : command_buffers_)
+    {
+        for (auto& source : entry.second.sources)
+        {
+            DestroyBuffer(&source);
+        }
+    }
+
+    for (auto& entry : families_)
+    {
+        QueueFamily& family = entry.second;
+
+        if (family.fence != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyFence(device_, family.fence, nullptr);
+        }
+
+        if (family.command_pool != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyCommandPool(device_, family.command_pool, nullptr);
+        }
+    }
+
+    if (cache_file_ != nullptr)
+    {
+        util::platform::FileClose(cache_file_);
+    }
+}
+
+bool VulkanAccelStructCache::Initialize(const std::string& capture_filename)
+{
+    uint64_t capture_size = 0;
+    uint64_t capture_hash = 0;
+
+    if (!AnalysisCache::ComputeKey(capture_filename, &capture_size, &capture_hash))
+    {
+        return false;
+    }
+
+    cache_filename_ = GetCacheFilename(capture_filename);
+
+    if (util::platform::FileOpen(&cache_file_, cache_filename_.c_str(), "r+b") == 0)
+    {
+        if (ReadCacheFile(capture_size, capture_hash))
+        {
+            GFXRECON_LOG_INFO(
+                "Loaded %" PRIuPTR " cached acceleration structures from %s", entries_.size(), cache_filename_.c_str());
+            return true;
+        }
+
+        util::platform::FileClose(cache_file_);
+    }
+
+    // The cache file does not exist yet, or was written for a different capture file or device, and is replaced.
+    cache_file_ = nullptr;
+    entries_.clear();
+
+    if ((util::platform::FileOpen(&cache_file_, cache_filename_.c_str(), "w+b") != 0) ||
+        !WriteCacheHeader(capture_size, capture_hash))
+    {
+        GFXRECON_LOG_WARNING("Failed to create acceleration structure cache file %s", cache_filename_.c_str());
+
+        if (cache_file_ != nullptr)
+        {
+            util::platform::FileClose(cache_file_);
+            cache_file_ = nullptr;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanAccelStructCache::AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, VkQueueFlags queue_flags)
+{
+    // Acceleration structures are built and serialized by queues with compute support.
+    if ((queue_flags & VK_QUEUE_COMPUTE_BIT) == 0)
+    {
+        return;
+    }
+
+    QueueFamily& family = families_[queue_family_index];
+
+    for (uint32_t i = 0; i < queue_count; ++i)
+    {
+        VkQueue queue = VK_NULL_HANDLE;
+        device_table_->GetDeviceQueue(device_, queue_family_index, i, &queue);
+
+        if (queue != VK_NULL_HANDLE)
+        {
+            queue_families_[queue] = &family;
+        }
+    }
+
+    if (family.command_pool == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        pool_create_info.pNext                   = nullptr;
+        pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_create_info.queueFamilyIndex        = queue_family_index;
+
+        VkResult result = device_table_->CreateCommandPool(device_, &pool_create_info, nullptr, &family.command_pool);
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.pNext                       = nullptr;
+            allocate_info.commandPool                 = family.command_pool;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = 1;
+
+            result = device_table_->AllocateCommandBuffers(device_, &allocate_info, &family.command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_create_info.pNext             = nullptr;
+            fence_create_info.flags             = 0;
+
+            result = device_table_->CreateFence(device_, &fence_create_info, nullptr, &family.fence);
+        }
+
+        if ((result != VK_SUCCESS) && (family.command_pool != VK_NULL_HANDLE))
+        {
+            device_table_->DestroyCommandPool(device_, family.command_pool, nullptr);
+            family.command_pool   = VK_NULL_HANDLE;
+            family.command_buffer = VK_NULL_HANDLE;
+        }
+    }
+}
+
+void VulkanAccelStructCache::RecordBuilds(VkCommandBuffer                                        command_buffer,
+                                          uint32_t                                               info_count,
+                                          const VkAccelerationStructureBuildGeometryInfoKHR*     infos,
+                                          const VkAccelerationStructureBuildRangeInfoKHR* const* range_infos,
+                                          const format::HandleId*                                dst_ids,
+                                          std::vector<bool>*                                     replaced)
+{
+    assert(replaced != nullptr);
+
+    replaced->assign(info_count, false);
+
+    if ((cache_file_ == nullptr) || (infos == nullptr) || (range_infos == nullptr) || (dst_ids == nullptr))
+    {
+        return;
+    }
+
+    CommandBufferBuilds& builds = command_buffers_[command_buffer];
+    std::vector<uint8_t> data;
+
+    for (uint32_t i = 0; i < info_count; ++i)
+    {
+        const VkAccelerationStructureBuildGeometryInfoKHR& info         = infos[i];
+        VkAccelerationStructureKHR                         accel_struct = info.dstAccelerationStructure;
+        uint32_t                                           build_index  = build_counts_[dst_ids[i]]++;
+        uint64_t                                           key          = 0;
+
+        // A build replaces the result of an earlier build of the command buffer, which is no longer serialized.
+        builds.pending.erase(std::remove_if(builds.pending.begin(),
+                                            builds.pending.end(),
+                                            [accel_struct](const PendingBuild& pending) {
+                                                return pending.accel_struct == accel_struct;
+                                            }),
+                             builds.pending.end());
+        builds.written.push_back(accel_struct);
+
+        if (!GetBuildKey(dst_ids[i], build_index, info, range_infos[i], &key))
+        {
+            continue;
+        }
+
+        auto entry = entries_.find(key);
+
+        if (entry != entries_.end())
+        {
+            BufferAllocation source;
+
+            if (ReadEntry(entry->second, &data) && IsCompatible(data) &&
+                (CreateBuffer(data.size() + kSerializedDataAlignment, &source) == VK_SUCCESS))
+            {
+                VkDeviceSize offset = AlignSize(source.address) - source.address;
+                std::memcpy(static_cast<uint8_t*>(source.mapped_data) + offset, data.data(), data.size());
+
+                // The deserialization is performed by the acceleration structure build stage, so the barriers that
+                // the application recorded for the build also apply to it.
+                VkCopyMemoryToAccelerationStructureInfoKHR copy_info = {
+                    VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR
+                };
+                copy_info.pNext             = nullptr;
+                copy_info.src.deviceAddress = source.address + offset;
+                copy_info.dst               = accel_struct;
+                copy_info.mode              = VK_COPY_ACCELERATION_STRUCTURE_MODE_DESERIALIZE_KHR;
+
+                device_table_->CmdCopyMemoryToAccelerationStructureKHR(command_buffer, &copy_info);
+
+                builds.sources.push_back(source);
+                (*replaced)[i] = true;
+                continue;
+            }
+
+            // The entry cannot be used, and is replaced by the result of the build.
+            GFXRECON_LOG_WARNING_ONCE("Ignoring acceleration structures from cache file %s that cannot be read or "
+                                      "were serialized by an incompatible driver",
+                                      cache_filename_.c_str());
+            entries_.erase(entry);
+        }
+
+        builds.pending.push_back({ key, accel_struct });
+    }
+}
+
+void VulkanAccelStructCache::ResetCommandBuffer(VkCommandBuffer command_buffer)
+{
+    auto entry = command_buffers_.find(command_buffer);
+
+    if (entry != command_buffers_.end())
+    {
+        // The command buffer is not pending, so the deserialization data is no longer in use.
+        for (auto& source : entry->second.sources)
+        {
+            DestroyBuffer(&source);
+        }
+
+        command_buffers_.erase(entry);
+    }
+}
+
+VkResult VulkanAccelStructCache::StoreSubmission(VkQueue queue, uint32_t submit_count, const VkSubmitInfo* submits)
+{
+    if (command_buffers_.empty() || (submits == nullptr) || (cache_file_ == nullptr) || write_failed_)
+    {
+        return VK_SUCCESS;
+    }
+
+    // Builds are serialized after the whole submission, so a build of a later command buffer replaces the result of
+    // an earlier build of the same acceleration structure.  Builds are only serialized for the first submission of
+    // their command buffer.
+    std::vector<PendingBuild> pending;
+
+    for (uint32_t i = 0; i < submit_count; ++i)
+    {
+        for (uint32_t j = 0; j < submits[i].commandBufferCount; ++j)
+        {
+            auto entry = command_buffers_.find(submits[i].pCommandBuffers[j]);
+
+            if (entry != command_buffers_.end())
+            {
+                for (VkAccelerationStructureKHR accel_struct : entry->second.written)
+                {
+                    pending.erase(std::remove_if(pending.begin(),
+                                                 pending.end(),
+                                                 [accel_struct](const PendingBuild& build) {
+                                                     return build.accel_struct == accel_struct;
+                                                 }),
+                                  pending.end());
+                }
+
+                pending.insert(pending.end(), entry->second.pending.begin(), entry->second.pending.end());
+                entry->second.pending.clear();
+            }
+        }
+    }
+
+    if (pending.empty())
+    {
+        return VK_SUCCESS;
+    }
+
+    auto family_entry = queue_families_.find(queue);
+
+    if ((family_entry == queue_families_.end()) || (family_entry->second->command_buffer == VK_NULL_HANDLE))
+    {
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
+    QueueFamily*                            family = family_entry->second;
+    uint32_t                                count  = static_cast<uint32_t>(pending.size());
+    std::vector<VkAccelerationStructureKHR> accel_structs(count);
+    std::vector<uint64_t>                   sizes(count);
+    VkQueryPool                             query_pool = VK_NULL_HANDLE;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        accel_structs[i] = pending[i].accel_struct;
+    }
+
+    VkResult result = device_table_->QueueWaitIdle(queue);
+
+    if (result == VK_SUCCESS)
+    {
+        VkQueryPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+        create_info.pNext                 = nullptr;
+        create_info.flags                 = 0;
+        create_info.queryType             = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR;
+        create_info.queryCount            = count;
+        create_info.pipelineStatistics    = 0;
+
+        result = device_table_->CreateQueryPool(device_, &create_info, nullptr, &query_pool);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = SubmitAndWait(queue, family, [&](VkCommandBuffer command_buffer) {
+            RecordBuildBarrier(command_buffer, VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR);
+            device_table_->CmdResetQueryPool(command_buffer, query_pool, 0, count);
+            device_table_->CmdWriteAccelerationStructuresPropertiesKHR(
+                command_buffer,
+                count,
+                accel_structs.data(),
+                VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR,
+                query_pool,
+                0);
+        });
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table_->GetQueryPoolResults(device_,
+                                                    query_pool,
+                                                    0,
+                                                    count,
+                                                    count * sizeof(uint64_t),
+                                                    sizes.data(),
+                                                    sizeof(uint64_t),
+                                                    VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    }
+
+    if (query_pool != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyQueryPool(device_, query_pool, nullptr);
+    }
+
+    // The acceleration structures are read back in batches, to limit the size of the readback buffer.
+    size_t first = 0;
+
+    while ((result == VK_SUCCESS) && (first < pending.size()))
+    {
+        size_t       batch_count = 1;
+        VkDeviceSize batch_size  = AlignSize(sizes[first]);
+
+        while (((first + batch_count) < pending.size()) &&
+               ((batch_size + AlignSize(sizes[first + batch_count])) <= kMaxReadbackSize))
+        {
+            batch_size += AlignSize(sizes[first + batch_count]);
+            ++batch_count;
+        }
+
+        result = SerializeBatch(queue, family, pending, sizes, first, batch_count);
+        first += batch_count;
+    }
+
+    return result;
+}
+
+bool VulkanAccelStructCache::GetBuildKey(format::HandleId                                   dst_id,
+                                         uint32_t                                           build_index,
+                                         const VkAccelerationStructureBuildGeometryInfoKHR& info,
+                                         const VkAccelerationStructureBuildRangeInfoKHR*    range_infos,
+                                         uint64_t*                                          key)
+{
+    assert(key != nullptr);
+
+    if ((info.type != VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR) ||
+        (info.mode != VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR) || (info.pNext != nullptr) ||
+        ((info.geometryCount > 0) && ((range_infos == nullptr) || ((info.pGeometries == nullptr) &&
+                                                                    (info.ppGeometries == nullptr)))))
+    {
+        return false;
+    }
+
+    uint64_t hash = HashValue(dst_id, 0);
+    hash          = HashValue(build_index, hash);
+    hash          = HashValue(info.flags, hash);
+    hash          = HashValue(info.geometryCount, hash);
+
+    for (uint32_t i = 0; i < info.geometryCount; ++i)
+    {
+        const VkAccelerationStructureGeometryKHR* geometry =
+            (info.pGeometries != nullptr) ? &info.pGeometries[i] : info.ppGeometries[i];
+
+        if ((geometry == nullptr) || (geometry->pNext != nullptr))
+        {
+            return false;
+        }
+
+        hash = HashValue(geometry->geometryType, hash);
+        hash = HashValue(geometry->flags, hash);
+
+        if (geometry->geometryType == VK_GEOMETRY_TYPE_TRIANGLES_KHR)
+        {
+            const VkAccelerationStructureGeometryTrianglesDataKHR& triangles = geometry->geometry.triangles;
+
+            // Extension structures, such as opacity micromaps, reference data that is not part of the key.
+            if (triangles.pNext != nullptr)
+            {
+                return false;
+            }
+
+            hash = HashValue(triangles.vertexFormat, hash);
+            hash = HashValue(triangles.vertexData.deviceAddress, hash);
+            hash = HashValue(triangles.vertexStride, hash);
+            hash = HashValue(triangles.maxVertex, hash);
+            hash = HashValue(triangles.indexType, hash);
+            hash = HashValue(triangles.indexData.deviceAddress, hash);
+            hash = HashValue(triangles.transformData.deviceAddress, hash);
+        }
+        else if (geometry->geometryType == VK_GEOMETRY_TYPE_AABBS_KHR)
+        {
+            const VkAccelerationStructureGeometryAabbsDataKHR& aabbs = geometry->geometry.aabbs;
+
+            if (aabbs.pNext != nullptr)
+            {
+                return false;
+            }
+
+            hash = HashValue(aabbs.data.deviceAddress, hash);
+            hash = HashValue(aabbs.stride, hash);
+        }
+        else
+        {
+            return false;
+        }
+
+        hash = HashValue(range_infos[i].primitiveCount, hash);
+        hash = HashValue(range_infos[i].primitiveOffset, hash);
+        hash = HashValue(range_infos[i].firstVertex, hash);
+        hash = HashValue(range_infos[i].transformOffset, hash);
+    }
+
+    (*key) = hash;
+
+    return true;
+}
+
+bool VulkanAccelStructCache::ReadEntry(const Entry& entry, std::vector<uint8_t>* data)
+{
+    assert(data != nullptr);
+
+    data->resize(static_cast<size_t>(entry.size));
+
+    return util::platform::FileSeek(cache_file_, entry.offset, util::platform::FileSeekSet) &&
+           (util::platform::FileRead(data->data(), data->size(), 1, cache_file_) == 1) &&
+           (util::hash::Hash64(data->data(), data->size()) == entry.hash);
+}
+
+bool VulkanAccelStructCache::IsCompatible(const std::vector<uint8_t>& data) const
+{
+    uint64_t handle_count = 0;
+
+    if (data.size() < kSerializedHeaderSize)
+    {
+        return false;
+    }
+
+    std::memcpy(&handle_count, data.data() + kSerializedHeaderSize - kSerializedHandleCountSize, sizeof(handle_count));
+
+    VkAccelerationStructureVersionInfoKHR version_info = { VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR };
+    version_info.pNext                                 = nullptr;
+    version_info.pVersionData                          = data.data();
+
+    VkAccelerationStructureCompatibilityKHR compatibility = VK_ACCELERATION_STRUCTURE_COMPATIBILITY_INCOMPATIBLE_KHR;
+    device_table_->GetDeviceAccelerationStructureCompatibilityKHR(device_, &version_info, &compatibility);
+
+    return (handle_count == 0) && (compatibility == VK_ACCELERATION_STRUCTURE_COMPATIBILITY_COMPATIBLE_KHR);
+}
+
+bool VulkanAccelStructCache::WriteEntry(uint64_t key, const uint8_t* data, uint64_t size)
+{
+    CacheEntryHeader header = { key, size, util::hash::Hash64(data, static_cast<size_t>(size)) };
+
+    // Entries are appended after the last complete entry, replacing any data from an interrupted write.
+    bool success = util::platform::FileSeek(cache_file_, append_offset_, util::platform::FileSeekSet) &&
+                   (util::platform::FileWrite(&header, sizeof(header), 1, cache_file_) == 1) &&
+                   (util::platform::FileWrite(data, static_cast<size_t>(size), 1, cache_file_) == 1) &&
+                   (util::platform::FileFlush(cache_file_) == 0);
+
+    if (success)
+    {
+        Entry& entry = entries_[key];
+        entry.offset = append_offset_ + sizeof(header);
+        entry.size   = size;
+        entry.hash   = header.hash;
+
+        append_offset_ = entry.offset + static_cast<int64_t>(size);
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to write acceleration structure cache file %s", cache_filename_.c_str());
+        write_failed_ = true;
+    }
+
+    return success;
+}
+
+bool VulkanAccelStructCache::ReadCacheFile(uint64_t capture_size, uint64_t capture_hash)
+{
+    CacheFileHeader expected;
+    CacheFileHeader header;
+    InitCacheFileHeader(properties_, capture_size, capture_hash, &expected);
+
+    if (!util::platform::FileSeek(cache_file_, 0, util::platform::FileSeekEnd))
+    {
+        return false;
+    }
+
+    int64_t file_size = util::platform::FileTell(cache_file_);
+
+    if ((file_size < static_cast<int64_t>(sizeof(header))) ||
+        !util::platform::FileSeek(cache_file_, 0, util::platform::FileSeekSet) ||
+        (util::platform::FileRead(&header, sizeof(header), 1, cache_file_) != 1) ||
+        (std::memcmp(&header, &expected, sizeof(header)) != 0))
+    {
+        GFXRECON_LOG_INFO("Replacing acceleration structure cache file %s, which was written for a different capture "
+                          "file or device",
+                          cache_filename_.c_str());
+        return false;
+    }
+
+    int64_t offset = sizeof(header);
+
+    while ((file_size - offset) >= static_cast<int64_t>(sizeof(CacheEntryHeader)))
+    {
+        CacheEntryHeader entry_header;
+
+        if (!util::platform::FileSeek(cache_file_, offset, util::platform::FileSeekSet) ||
+            (util::platform::FileRead(&entry_header, sizeof(entry_header), 1, cache_file_) != 1))
+        {
+            break;
+        }
+
+        int64_t data_offset = offset + sizeof(entry_header);
+
+        // The data of the last entry is incomplete if a write was interrupted.
+        if (entry_header.size > static_cast<uint64_t>(file_size - data_offset))
+        {
+            break;
+        }
+
+        // An entry that is written again after its data could not be used replaces the earlier entry.
+        Entry& entry = entries_[entry_header.key];
+        entry.offset = data_offset;
+        entry.size   = entry_header.size;
+        entry.hash   = entry_header.hash;
+
+        offset = data_offset + static_cast<int64_t>(entry_header.size);
+    }
+
+    append_offset_ = offset;
+
+    return true;
+}
+
+bool VulkanAccelStructCache::WriteCacheHeader(uint64_t capture_size, uint64_t capture_hash)
+{
+    CacheFileHeader header;
+    InitCacheFileHeader(properties_, capture_size, capture_hash, &header);
+
+    if ((util::platform::FileWrite(&header, sizeof(header), 1, cache_file_) != 1) ||
+        (util::platform::FileFlush(cache_file_) != 0))
+    {
+        return false;
+    }
+
+    append_offset_ = sizeof(header);
+
+    return true;
+}
+
+VkResult VulkanAccelStructCache::SerializeBatch(VkQueue                          queue,
+                                                QueueFamily*                     family,
+                                                const std::vector<PendingBuild>& builds,
+                                                const std::vector<uint64_t>&     sizes,
+                                                size_t                           first,
+                                                size_t                           count)
+{
+    assert((family != nullptr) && ((first + count) <= builds.size()) && (builds.size() == sizes.size()));
+
+    std::vector<VkDeviceSize> offsets(count);
+    VkDeviceSize              total_size = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        offsets[i] = total_size;
+        total_size += AlignSize(sizes[first + i]);
+    }
+
+    BufferAllocation readback;
+    VkResult         result = CreateBuffer(total_size + kSerializedDataAlignment, &readback);
+
+    if (result == VK_SUCCESS)
+    {
+        VkDeviceAddress base_address = AlignSize(readback.address);
+
+        result = SubmitAndWait(queue, family, [&](VkCommandBuffer command_buffer) {
+            RecordBuildBarrier(command_buffer, VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                VkCopyAccelerationStructureToMemoryInfoKHR copy_info = {
+                    VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR
+                };
+                copy_info.pNext             = nullptr;
+                copy_info.src               = builds[first + i].accel_struct;
+                copy_info.dst.deviceAddress = base_address + offsets[i];
+                copy_info.mode              = VK_COPY_ACCELERATION_STRUCTURE_MODE_SERIALIZE_KHR;
+
+                device_table_->CmdCopyAccelerationStructureToMemoryKHR(command_buffer, &copy_info);
+            }
+
+            VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_HOST_READ_BIT;
+
+            device_table_->CmdPipelineBarrier(command_buffer,
+                                              VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                                              VK_PIPELINE_STAGE_HOST_BIT,
+                                              0,
+                                              1,
+                                              &barrier,
+                                              0,
+                                              nullptr,
+                                              0,
+                                              nullptr);
+        });
+
+        if (result == VK_SUCCESS)
+        {
+            const uint8_t* data =
+                static_cast<const uint8_t*>(readback.mapped_data) + (base_address - readback.address);
+
+            for (size_t i = 0; (i < count) && !write_failed_; ++i)
+            {
+                WriteEntry(builds[first + i].key, data + offsets[i], sizes[first + i]);
+            }
+        }
+
+        DestroyBuffer(&readback);
+    }
+
+    return result;
+}
+
+VkResult VulkanAccelStructCache::SubmitAndWait(VkQueue                                     queue,
+                                               QueueFamily*                                family,
+                                               const std::function<void(VkCommandBuffer)>& record)
+{
+    assert(family != nullptr);
+
+    VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin_info.pNext                    = nullptr;
+    begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    begin_info.pInheritanceInfo         = nullptr;
+
+    VkResult result = device_table_->BeginCommandBuffer(family->command_buffer, &begin_info);
+
+    if (result == VK_SUCCESS)
+    {
+        record(family->command_buffer);
+        result = device_table_->EndCommandBuffer(family->command_buffer);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = 0;
+        submit_info.pWaitSemaphores      = nullptr;
+        submit_info.pWaitDstStageMask    = nullptr;
+        submit_info.commandBufferCount   = 1;
+        submit_info.pCommandBuffers      = &family->command_buffer;
+        submit_info.signalSemaphoreCount = 0;
+        submit_info.pSignalSemaphores    = nullptr;
+
+        result = device_table_->QueueSubmit(queue, 1, &submit_info, family->fence);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result =
+            device_table_->WaitForFences(device_, 1, &family->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table_->ResetFences(device_, 1, &family->fence);
+        }
+    }
+
+    return result;
+}
+
+void VulkanAccelStructCache::RecordBuildBarrier(VkCommandBuffer command_buffer, VkAccessFlags dst_access_mask)
+{
+    // Orders the commands with the builds of the completed submission on the same queue.
+    VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+    barrier.pNext           = nullptr;
+    barrier.srcAccessMask   = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+    barrier.dstAccessMask   = dst_access_mask;
+
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                                      VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                                      0,
+                                      1,
+                                      &barrier,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr);
+}
+
+VkResult VulkanAccelStructCache::CreateBuffer(VkDeviceSize size, BufferAllocation* allocation)
+{
+    assert(allocation != nullptr);
+
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = size;
+    create_info.usage                 = kSerializedDataUsage;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
+
+    VkResult result =
+        allocator_->CreateBufferDirect(&create_info, nullptr, &allocation->buffer, &allocation->buffer_data);
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements requirements;
+        device_table_->GetBufferMemoryRequirements(device_, allocation->buffer, &requirements);
+
+        uint32_t memory_type_index = GetMemoryTypeIndex(
+            requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        if (memory_type_index == std::numeric_limits<uint32_t>::max())
+        {
+            result = VK_ERROR_FEATURE_NOT_PRESENT;
+        }
+        else
+        {
+            VkMemoryAllocateFlagsInfo allocate_flags_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO };
+            allocate_flags_info.pNext                     = nullptr;
+            allocate_flags_info.flags                     = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+            allocate_flags_info.deviceMask                = 0;
+
+            VkMemoryAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+            allocate_info.pNext                = &allocate_flags_info;
+            allocate_info.allocationSize       = requirements.size;
+            allocate_info.memoryTypeIndex      = memory_type_index;
+
+            result = allocator_->AllocateMemoryDirect(
+                &allocate_info, nullptr, &allocation->memory, &allocation->memory_data);
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryPropertyFlags flags = 0;
+
+        result = allocator_->BindBufferMemoryDirect(
+            allocation->buffer, allocation->memory, 0, allocation->buffer_data, allocation->memory_data, &flags);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = allocator_->MapResourceMemoryDirect(size, 0, &allocation->mapped_data, allocation->buffer_data);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkBufferDeviceAddressInfo address_info = { VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
+        address_info.pNext                     = nullptr;
+        address_info.buffer                    = allocation->buffer;
+
+        allocation->address = get_buffer_device_address_(device_, &address_info);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        DestroyBuffer(allocation);
+    }
+
+    return result;
+}
+
+void VulkanAccelStructCache::DestroyBuffer(BufferAllocation* allocation)
+{
+    assert(allocation != nullptr);
+
+    if (allocation->mapped_data != nullptr)
+    {
+        allocator_->UnmapResourceMemoryDirect(allocation->buffer_data);
+        allocation->mapped_data = nullptr;
+    }
+
+    if (allocation->buffer != VK_NULL_HANDLE)
+    {
+        allocator_->DestroyBufferDirect(allocation->buffer, nullptr, allocation->buffer_data);
+        allocation->buffer = VK_NULL_HANDLE;
+    }
+
+    if (allocation->memory != VK_NULL_HANDLE)
+    {
+        allocator_->FreeMemoryDirect(allocation->memory, nullptr, allocation->memory_data);
+        allocation->memory = VK_NULL_HANDLE;
+    }
+
+    allocation->address = 0;
+}
+
+uint32_t VulkanAccelStructCache::GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags) const
+{
+    uint32_t memory_type_index = std::numeric_limits<uint32_t>::max();
+
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i)
+    {
+        if ((type_bits & (1 << i)) &&
+            ((memory_properties_.memoryTypes[i].propertyFlags & property_flags) == property_flags))
+        {
+            memory_type_index = i;
+            break;
+        }
+    }
+
+    return memory_type_index;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,184 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_ACCEL_STRUCT_CACHE_H
+#define GFXRECON_DECODE_VULKAN_ACCEL_STRUCT_CACHE_H
+
+#include "decode/vulkan_resource_allocator.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Stores the bottom level acceleration structures that are built during replay in a file, <capture-file>.blas, so that
+// later replays of the same capture file on the same device deserialize them to the destinations of their builds
+// instead of building them.  The geometry that a build reads is only resident on the device when the build is
+// recorded, so builds are keyed by their recorded parameters, which determine the geometry for a given capture file:
+// the destination, the number of earlier builds of the destination, and the geometry descriptions, addresses, and
+// ranges.  The file is keyed by the capture file and the device, and its entries are discarded when either differs.
+// Acceleration structures are serialized when the submission of the command buffer that built them completes.
+class VulkanAccelStructCache
+{
+  public:
+    VulkanAccelStructCache(VkDevice                                device,
+                           const encode::DeviceTable*              device_table,
+                           const VkPhysicalDeviceProperties&       properties,
+                           const VkPhysicalDeviceMemoryProperties& memory_properties,
+                           VulkanResourceAllocator*                allocator,
+                           PFN_vkGetBufferDeviceAddress            get_buffer_device_address);
+
+    ~VulkanAccelStructCache();
+
+    static std::string GetCacheFilename(const std::string& capture_filename) { return capture_filename + ".blas"; }
+
+    // Opens the cache file of the capture file, indexing its entries if it was written for the same capture file and
+    // device, and replacing it otherwise.  Returns false when the capture file cannot be keyed or the cache file
+    // cannot be opened.
+    bool Initialize(const std::string& capture_filename);
+
+    // Retrieves the queues of a family that can serialize acceleration structures.
+    void AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, VkQueueFlags queue_flags);
+
+    // Records the deserialization of the cached builds to their destinations, setting the elements of replaced for
+    // the builds that no longer need to be recorded.  The builds that are not cached are serialized after their
+    // submission.  The infos must contain the captured addresses, and dst_ids the capture IDs of the destinations.
+    void RecordBuilds(VkCommandBuffer                                        command_buffer,
+                      uint32_t                                               info_count,
+                      const VkAccelerationStructureBuildGeometryInfoKHR*     infos,
+                      const VkAccelerationStructureBuildRangeInfoKHR* const* range_infos,
+                      const format::HandleId*                                dst_ids,
+                      std::vector<bool>*                                     replaced);
+
+    // Releases the deserialization data of a command buffer that is being recorded again.
+    void ResetCommandBuffer(VkCommandBuffer command_buffer);
+
+    // Waits for a submission that built acceleration structures that are not cached, and writes them to the cache.
+    VkResult StoreSubmission(VkQueue queue, uint32_t submit_count, const VkSubmitInfo* submits);
+
+  private:
+    struct BufferAllocation
+    {
+        VkBuffer                              buffer{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::ResourceData buffer_data{ 0 };
+        VkDeviceMemory                        memory{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::MemoryData   memory_data{ 0 };
+        void*                                 mapped_data{ nullptr };
+        VkDeviceAddress                       address{ 0 };
+    };
+
+    // Location of a serialized acceleration structure in the cache file.
+    struct Entry
+    {
+        int64_t  offset{ 0 };
+        uint64_t size{ 0 };
+        uint64_t hash{ 0 };
+    };
+
+    struct PendingBuild
+    {
+        uint64_t                   key{ 0 };
+        VkAccelerationStructureKHR accel_struct{ VK_NULL_HANDLE };
+    };
+
+    struct CommandBufferBuilds
+    {
+        std::vector<BufferAllocation>           sources; // Serialized data read by the recorded deserializations.
+        std::vector<PendingBuild>               pending; // Builds to serialize after the submission.
+        std::vector<VkAccelerationStructureKHR> written; // Destinations of all builds, which replace earlier builds.
+    };
+
+    struct QueueFamily
+    {
+        VkCommandPool   command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer command_buffer{ VK_NULL_HANDLE };
+        VkFence         fence{ VK_NULL_HANDLE };
+    };
+
+  private:
+    // Returns false for builds that cannot be cached, such as updates and builds with extension structures.
+    static bool GetBuildKey(format::HandleId                                   dst_id,
+                            uint32_t                                           build_index,
+                            const VkAccelerationStructureBuildGeometryInfoKHR& info,
+                            const VkAccelerationStructureBuildRangeInfoKHR*    range_infos,
+                            uint64_t*                                          key);
+
+    bool ReadEntry(const Entry& entry, std::vector<uint8_t>* data);
+
+    // Checks that serialized data was written by a compatible device and driver.
+    bool IsCompatible(const std::vector<uint8_t>& data) const;
+
+    bool WriteEntry(uint64_t key, const uint8_t* data, uint64_t size);
+
+    bool ReadCacheFile(uint64_t capture_size, uint64_t capture_hash);
+
+    bool WriteCacheHeader(uint64_t capture_size, uint64_t capture_hash);
+
+    VkResult SerializeBatch(VkQueue                          queue,
+                            QueueFamily*                     family,
+                            const std::vector<PendingBuild>& builds,
+                            const std::vector<uint64_t>&     sizes,
+                            size_t                           first,
+                            size_t                           count);
+
+    VkResult SubmitAndWait(VkQueue queue, QueueFamily* family, const std::function<void(VkCommandBuffer)>& record);
+
+    void RecordBuildBarrier(VkCommandBuffer command_buffer, VkAccessFlags dst_access_mask);
+
+    VkResult CreateBuffer(VkDeviceSize size, BufferAllocation* allocation);
+
+    void DestroyBuffer(BufferAllocation* allocation);
+
+    uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags) const;
+
+  private:
+    VkDevice                                                 device_;
+    const encode::DeviceTable*                               device_table_;
+    VkPhysicalDeviceProperties                               properties_;
+    VkPhysicalDeviceMemoryProperties                         memory_properties_;
+    VulkanResourceAllocator*                                 allocator_;
+    PFN_vkGetBufferDeviceAddress                             get_buffer_device_address_;
+    std::string                                              cache_filename_;
+    FILE*                                                    cache_file_;
+    int64_t                                                  append_offset_;
+    std::unordered_map<uint64_t, Entry>                      entries_;
+    std::unordered_map<format::HandleId, uint32_t>           build_counts_;
+    std::unordered_map<VkCommandBuffer, CommandBufferBuilds> command_buffers_;
+    std::map<uint32_t, QueueFamily>                          families_;
+    std::unordered_map<VkQueue, QueueFamily*>                queue_families_;
+    bool                                                     write_failed_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_ACCEL_STRUCT_CACHE_H
@@ -0,0 +1,1380 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_address_patcher.h"
+
+#include "decode/address_patch_shaders.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Layout of the patching shader's push constants, in 32-bit words.
+struct PatchConstants
+{
+    uint32_t first_word;
+    uint32_t word_stride;
+    uint32_t address_count;
+    uint32_t range_count;
+};
+
+// Layout of the handle patching shader's push constants, in 32-bit words.
+struct HandlePatchConstants
+{
+    uint32_t first_word;
+    uint32_t word_stride;
+    uint32_t record_count;
+    uint32_t slot_mask;
+    uint32_t handle_words;
+};
+
+const uint32_t kPatchGroupSize      = 64;
+const uint32_t kMaxPatchGroupCount  = 65535;
+const uint32_t kRangeTableWords     = 6; // Capture begin, capture end, and replay begin, as pairs of 32-bit words.
+const uint32_t kHandleHashBasis     = 2166136261; // FNV-1a offset basis and prime, as used by the patching shader.
+const uint32_t kHandleHashPrime     = 16777619;
+const size_t   kMinHandleTableSlots = 16;
+const uint32_t kPushConstantsSize   = std::max(sizeof(PatchConstants), sizeof(HandlePatchConstants));
+const uint32_t kInstanceWords       = sizeof(VkAccelerationStructureInstanceKHR) / sizeof(uint32_t);
+const uint32_t kInstanceReferenceWord =
+    offsetof(VkAccelerationStructureInstanceKHR, accelerationStructureReference) / sizeof(uint32_t);
+
+// Alignment of shader binding table copies, which is a multiple of the shaderGroupBaseAlignment limit of any device.
+const VkDeviceSize kShaderBindingTableAlignment = 256;
+
+const VkBufferUsageFlags kInstanceCopyUsage =
+    VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+    VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR;
+
+const VkBufferUsageFlags kTableCopyUsage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                           VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+                                           VK_BUFFER_USAGE_SHADER_BINDING_TABLE_BIT_KHR;
+
+VulkanAddressPatcher::VulkanAddressPatcher(VkDevice                                device,
+                                           const encode::DeviceTable*              device_table,
+                                           const VkPhysicalDeviceMemoryProperties& memory_properties,
+                                           VulkanResourceAllocator*                allocator,
+                                           PFN_vkGetBufferDeviceAddress            get_buffer_device_address) :
+    device_(device),
+    device_table_(device_table), memory_properties_(memory_properties), allocator_(allocator),
+    get_buffer_device_address_(get_buffer_device_address), remapped_accel_struct_count_(0),
+    range_table_dirty_(false), descriptor_set_layout_(VK_NULL_HANDLE), pipeline_layout_(VK_NULL_HANDLE),
+    pipeline_(VK_NULL_HANDLE), handle_pipeline_(VK_NULL_HANDLE), descriptor_pool_(VK_NULL_HANDLE),
+    descriptor_pool_size_(0), pipeline_failed_(false)
+{
+    assert((device_ != VK_NULL_HANDLE) && (device_table_ != nullptr) && (allocator_ != nullptr) &&
+           (get_buffer_device_address_ != nullptr));
+}
+
+VulkanAddressPatcher::~VulkanAddressPatcher()
+{
+    for (auto& entry : families_)
+    {
+        QueueFamily& family = entry.second;
+
+        if (family.pending)
+        {
+            device_table_->WaitForFences(device_, 1, &family.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        }
+
+        if (family.fence != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyFence(device_, family.fence, nullptr);
+        }
+
+        if (family.command_pool != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyCommandPool(device_, family.command_pool, nullptr);
+        }
+    }
+
+    for (auto& entry : patch_copies_)
+    {
+        for (auto& patch_copy : entry.second)
+        {
+            DestroyBuffer(&patch_copy.copy);
+        }
+    }
+
+    for (auto& allocation : free_copies_)
+    {
+        DestroyBuffer(&allocation);
+    }
+
+    for (auto& entry : handle_tables_)
+    {
+        DestroyBuffer(&entry.second.buffer);
+    }
+
+    DestroyBuffer(&range_table_);
+
+    if (descriptor_pool_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyDescriptorPool(device_, descriptor_pool_, nullptr);
+    }
+
+    if (pipeline_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyPipeline(device_, pipeline_, nullptr);
+    }
+
+    if (handle_pipeline_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyPipeline(device_, handle_pipeline_, nullptr);
+    }
+
+    if (pipeline_layout_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyPipelineLayout(device_, pipeline_layout_, nullptr);
+    }
+
+    if (descriptor_set_layout_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyDescriptorSetLayout(device_, descriptor_set_layout_, nullptr);
+    }
+}
+
+void VulkanAddressPatcher::AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, VkQueueFlags queue_flags)
+{
+    // Acceleration structures are built by queues with compute support, which can also run the patching shader.
+    if ((queue_flags & VK_QUEUE_COMPUTE_BIT) == 0)
+    {
+        return;
+    }
+
+    QueueFamily& family = families_[queue_family_index];
+
+    for (uint32_t i = 0; i < queue_count; ++i)
+    {
+        VkQueue queue = VK_NULL_HANDLE;
+        device_table_->GetDeviceQueue(device_, queue_family_index, i, &queue);
+
+        if (queue != VK_NULL_HANDLE)
+        {
+            queue_families_[queue] = &family;
+        }
+    }
+
+    if (family.command_pool == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        pool_create_info.pNext                   = nullptr;
+        pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_create_info.queueFamilyIndex        = queue_family_index;
+
+        VkResult result = device_table_->CreateCommandPool(device_, &pool_create_info, nullptr, &family.command_pool);
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.pNext                       = nullptr;
+            allocate_info.commandPool                 = family.command_pool;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = 1;
+
+            result = device_table_->AllocateCommandBuffers(device_, &allocate_info, &family.command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_create_info.pNext             = nullptr;
+            fence_create_info.flags             = 0;
+
+            result = device_table_->CreateFence(device_, &fence_create_info, nullptr, &family.fence);
+        }
+
+        if ((result != VK_SUCCESS) && (family.command_pool != VK_NULL_HANDLE))
+        {
+            device_table_->DestroyCommandPool(device_, family.command_pool, nullptr);
+            family.command_pool   = VK_NULL_HANDLE;
+            family.command_buffer = VK_NULL_HANDLE;
+        }
+    }
+}
+
+void VulkanAddressPatcher::AddBufferAddress(VkBuffer        buffer,
+                                            VkDeviceSize    size,
+                                            VkDeviceAddress capture_address,
+                                            VkDeviceAddress replay_address)
+{
+    if ((size == 0) || (capture_address == 0))
+    {
+        return;
+    }
+
+    RemoveBuffer(buffer);
+
+    // Ranges that overlap the new range belong to buffers that were destroyed at capture.
+    EraseOverlappingRanges(&buffer_ranges_, capture_address, capture_address + size);
+
+    AddressRange& range  = buffer_ranges_[capture_address];
+    range.end            = capture_address + size;
+    range.replay_address = replay_address;
+    range.buffer         = buffer;
+
+    buffer_capture_addresses_[buffer] = capture_address;
+}
+
+void VulkanAddressPatcher::RemoveBuffer(VkBuffer buffer)
+{
+    auto entry = buffer_capture_addresses_.find(buffer);
+
+    if (entry != buffer_capture_addresses_.end())
+    {
+        auto range = buffer_ranges_.find(entry->second);
+
+        if ((range != buffer_ranges_.end()) && (range->second.buffer == buffer))
+        {
+            buffer_ranges_.erase(range);
+        }
+
+        buffer_capture_addresses_.erase(entry);
+    }
+}
+
+void VulkanAddressPatcher::AddAccelerationStructureAddress(VkDeviceAddress capture_address,
+                                                           VkDeviceAddress replay_address)
+{
+    if (capture_address == 0)
+    {
+        return;
+    }
+
+    // Instances reference the exact address of an acceleration structure, so each range holds a single address.
+    EraseOverlappingRanges(&accel_struct_ranges_, capture_address, capture_address + 1);
+
+    AddressRange& range  = accel_struct_ranges_[capture_address];
+    range.end            = capture_address + 1;
+    range.replay_address = replay_address;
+
+    range_table_dirty_ = true;
+
+    UpdateRemappedCount();
+}
+
+VkDeviceAddress VulkanAddressPatcher::RemapBufferAddress(VkDeviceAddress capture_address) const
+{
+    auto range = FindRange(buffer_ranges_, capture_address);
+
+    if (range != buffer_ranges_.end())
+    {
+        return range->second.replay_address + (capture_address - range->first);
+    }
+
+    return capture_address;
+}
+
+void VulkanAddressPatcher::RemapStridedRegion(VkStridedDeviceAddressRegionKHR* region) const
+{
+    if (region != nullptr)
+    {
+        region->deviceAddress = RemapBufferAddress(region->deviceAddress);
+    }
+}
+
+void VulkanAddressPatcher::AddShaderGroupHandles(format::HandleId pipeline_id,
+                                                 uint32_t         group_count,
+                                                 size_t           data_size,
+                                                 const uint8_t*   capture_data,
+                                                 const uint8_t*   replay_data)
+{
+    if ((group_count == 0) || (capture_data == nullptr) || (replay_data == nullptr))
+    {
+        return;
+    }
+
+    size_t handle_size = data_size / group_count;
+
+    if ((handle_size == 0) || ((handle_size % sizeof(uint32_t)) != 0))
+    {
+        GFXRECON_LOG_WARNING_ONCE("Shader group handles with a size that is not a multiple of 4 bytes are not patched "
+                                  "in shader binding tables");
+        return;
+    }
+
+    uint32_t              handle_words = static_cast<uint32_t>(handle_size / sizeof(uint32_t));
+    std::vector<uint32_t> capture_handle(handle_words);
+    std::vector<uint32_t> replay_handle(handle_words);
+
+    for (uint32_t i = 0; i < group_count; ++i)
+    {
+        const uint8_t* capture_group = capture_data + (i * handle_size);
+        const uint8_t* replay_group  = replay_data + (i * handle_size);
+
+        // Only the handles that were not reproduced by replay need to be patched.
+        if (memcmp(capture_group, replay_group, handle_size) != 0)
+        {
+            HandleTable& table = handle_tables_[pipeline_id];
+
+            if (table.handle_words != handle_words)
+            {
+                table.handle_words = handle_words;
+                table.handle_count = 0;
+                table.slots.clear();
+            }
+
+            memcpy(capture_handle.data(), capture_group, handle_size);
+            memcpy(replay_handle.data(), replay_group, handle_size);
+
+            InsertHandle(&table, capture_handle.data(), replay_handle.data());
+        }
+    }
+}
+
+void VulkanAddressPatcher::BindPipeline(VkCommandBuffer     command_buffer,
+                                        VkPipelineBindPoint bind_point,
+                                        format::HandleId    pipeline_id)
+{
+    if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR)
+    {
+        std::lock_guard<std::mutex> lock(command_buffer_mutex_);
+        bound_pipelines_[command_buffer] = pipeline_id;
+    }
+}
+
+void VulkanAddressPatcher::RemapShaderBindingTable(VkCommandBuffer                  command_buffer,
+                                                   VkStridedDeviceAddressRegionKHR* region)
+{
+    if ((region == nullptr) || (region->size == 0))
+    {
+        RemapStridedRegion(region);
+        return;
+    }
+
+    // Replay threads record the trace rays commands of different command buffers concurrently.
+    std::lock_guard<std::mutex> lock(command_buffer_mutex_);
+
+    HandleTable* table    = nullptr;
+    auto         pipeline = bound_pipelines_.find(command_buffer);
+
+    if (pipeline != bound_pipelines_.end())
+    {
+        auto entry = handle_tables_.find(pipeline->second);
+
+        if (entry != handle_tables_.end())
+        {
+            table = &entry->second;
+        }
+    }
+
+    if (table == nullptr)
+    {
+        RemapStridedRegion(region);
+        return;
+    }
+
+    VkDeviceSize handle_size = table->handle_words * sizeof(uint32_t);
+    auto         range       = FindRange(buffer_ranges_, region->deviceAddress);
+
+    if ((region->size < handle_size) || ((region->stride % sizeof(uint32_t)) != 0) || (range == buffer_ranges_.end()) ||
+        ((range->second.end - region->deviceAddress) < region->size))
+    {
+        GFXRECON_LOG_WARNING_ONCE("Shader binding tables that are not contained by a buffer with a known device "
+                                  "address are not patched with replay shader group handles");
+        RemapStridedRegion(region);
+        return;
+    }
+
+    PatchCopy table_copy;
+    table_copy.source_buffer = range->second.buffer;
+    table_copy.source_offset = region->deviceAddress - range->first;
+    table_copy.data_size     = region->size;
+    table_copy.word_stride   = static_cast<uint32_t>(region->stride / sizeof(uint32_t));
+    table_copy.patch_count =
+        (region->stride == 0) ? 1 : static_cast<uint32_t>(((region->size - handle_size) / region->stride) + 1);
+    table_copy.handle_table = table;
+
+    std::vector<PatchCopy>& copies = patch_copies_[command_buffer];
+
+    // The trace rays commands of a command buffer that read the same region share its copy.
+    auto shared_copy = std::find_if(copies.begin(), copies.end(), [&table_copy](const PatchCopy& patch_copy) {
+        return (patch_copy.handle_table == table_copy.handle_table) &&
+               (patch_copy.source_buffer == table_copy.source_buffer) &&
+               (patch_copy.source_offset == table_copy.source_offset) &&
+               (patch_copy.data_size == table_copy.data_size) && (patch_copy.word_stride == table_copy.word_stride);
+    });
+
+    if (shared_copy != copies.end())
+    {
+        region->deviceAddress = shared_copy->copy.address + shared_copy->data_offset;
+        return;
+    }
+
+    // The copy is padded to place the data at the alignment of shader binding table regions.
+    if (AcquireCopy(region->size + kShaderBindingTableAlignment, kTableCopyUsage, &table_copy.copy) != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to create a buffer for patching a shader binding table with replay shader group "
+                           "handles");
+        RemapStridedRegion(region);
+        return;
+    }
+
+    VkDeviceAddress data_address =
+        (table_copy.copy.address + kShaderBindingTableAlignment - 1) & ~(kShaderBindingTableAlignment - 1);
+
+    table_copy.data_offset = data_address - table_copy.copy.address;
+    table_copy.first_word  = static_cast<uint32_t>(table_copy.data_offset / sizeof(uint32_t));
+    region->deviceAddress  = data_address;
+
+    copies.push_back(table_copy);
+}
+
+void VulkanAddressPatcher::RemapBuildGeometry(
+    VkCommandBuffer                                               command_buffer,
+    uint32_t                                                      info_count,
+    const VkAccelerationStructureBuildGeometryInfoKHR*            infos,
+    const VkAccelerationStructureBuildRangeInfoKHR* const*        range_infos,
+    std::vector<VkAccelerationStructureBuildGeometryInfoKHR>*     build_infos,
+    std::vector<std::vector<VkAccelerationStructureGeometryKHR>>* geometry)
+{
+    assert((infos != nullptr) && (build_infos != nullptr) && (geometry != nullptr));
+
+    build_infos->assign(infos, std::next(infos, info_count));
+    geometry->resize(info_count);
+
+    for (uint32_t i = 0; i < info_count; ++i)
+    {
+        VkAccelerationStructureBuildGeometryInfoKHR&     build_info     = (*build_infos)[i];
+        std::vector<VkAccelerationStructureGeometryKHR>& build_geometry = (*geometry)[i];
+
+        build_geometry.clear();
+
+        for (uint32_t j = 0; j < build_info.geometryCount; ++j)
+        {
+            build_geometry.push_back((build_info.pGeometries != nullptr) ? build_info.pGeometries[j]
+                                                                         : *build_info.ppGeometries[j]);
+
+            VkAccelerationStructureGeometryDataKHR& data = build_geometry.back().geometry;
+
+            switch (build_geometry.back().geometryType)
+            {
+                case VK_GEOMETRY_TYPE_TRIANGLES_KHR:
+                {
+                    VkAccelerationStructureGeometryTrianglesDataKHR& triangles = data.triangles;
+
+                    triangles.vertexData.deviceAddress    = RemapBufferAddress(triangles.vertexData.deviceAddress);
+                    triangles.indexData.deviceAddress     = RemapBufferAddress(triangles.indexData.deviceAddress);
+                    triangles.transformData.deviceAddress = RemapBufferAddress(triangles.transformData.deviceAddress);
+                    break;
+                }
+                case VK_GEOMETRY_TYPE_AABBS_KHR:
+                    data.aabbs.data.deviceAddress = RemapBufferAddress(data.aabbs.data.deviceAddress);
+                    break;
+                case VK_GEOMETRY_TYPE_INSTANCES_KHR:
+                {
+                    VkDeviceAddress copy_address = 0;
+
+                    if (data.instances.arrayOfPointers)
+                    {
+                        GFXRECON_LOG_WARNING_ONCE("Acceleration structure builds with arrays of instance pointers "
+                                                  "reference instances that are not patched with replay addresses");
+                    }
+                    else if ((remapped_accel_struct_count_ > 0) && (range_infos != nullptr) &&
+                             AddInstanceCopy(command_buffer,
+                                             data.instances.data.deviceAddress,
+                                             range_infos[i][j].primitiveOffset,
+                                             range_infos[i][j].primitiveCount,
+                                             &copy_address))
+                    {
+                        data.instances.data.deviceAddress = copy_address;
+                        break;
+                    }
+
+                    data.instances.data.deviceAddress = RemapBufferAddress(data.instances.data.deviceAddress);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        build_info.pGeometries              = build_geometry.data();
+        build_info.ppGeometries             = nullptr;
+        build_info.scratchData.deviceAddress = RemapBufferAddress(build_info.scratchData.deviceAddress);
+    }
+}
+
+void VulkanAddressPatcher::ResetCommandBuffer(VkCommandBuffer command_buffer)
+{
+    std::lock_guard<std::mutex> lock(command_buffer_mutex_);
+
+    auto entry = patch_copies_.find(command_buffer);
+
+    if (entry != patch_copies_.end())
+    {
+        // The command buffer is not pending, so the copies are not in use and can be reused by the next recording.
+        for (const auto& patch_copy : entry->second)
+        {
+            free_copies_.push_back(patch_copy.copy);
+        }
+
+        patch_copies_.erase(entry);
+    }
+
+    bound_pipelines_.erase(command_buffer);
+}
+
+VkResult VulkanAddressPatcher::PatchSubmission(VkQueue queue, uint32_t submit_count, const VkSubmitInfo* submits)
+{
+    if (patch_copies_.empty() || (submits == nullptr))
+    {
+        return VK_SUCCESS;
+    }
+
+    std::vector<const PatchCopy*> copies;
+
+    for (uint32_t i = 0; i < submit_count; ++i)
+    {
+        for (uint32_t j = 0; j < submits[i].commandBufferCount; ++j)
+        {
+            auto entry = patch_copies_.find(submits[i].pCommandBuffers[j]);
+
+            if (entry != patch_copies_.end())
+            {
+                for (const auto& patch_copy : entry->second)
+                {
+                    copies.push_back(&patch_copy);
+                }
+            }
+        }
+    }
+
+    if (copies.empty())
+    {
+        return VK_SUCCESS;
+    }
+
+    auto family_entry = queue_families_.find(queue);
+
+    // Queues without compute support cannot run the patching shader.
+    if ((family_entry == queue_families_.end()) || (family_entry->second->command_buffer == VK_NULL_HANDLE))
+    {
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
+    QueueFamily& family = *family_entry->second;
+    VkResult     result = VK_SUCCESS;
+
+    // The range and handle tables and descriptor sets are shared by the queue families, so all earlier patching must
+    // complete before they are updated.
+    for (auto& entry : families_)
+    {
+        QueueFamily& pending_family = entry.second;
+
+        if (pending_family.pending)
+        {
+            result = device_table_->WaitForFences(
+                device_, 1, &pending_family.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+            if (result == VK_SUCCESS)
+            {
+                result = device_table_->ResetFences(device_, 1, &pending_family.fence);
+            }
+
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+
+            pending_family.pending = false;
+        }
+    }
+
+    bool patch = false;
+
+    if (!pipeline_failed_ && (pipeline_ == VK_NULL_HANDLE))
+    {
+        if (CreatePipeline() != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to create the compute pipelines that patch acceleration structure instances "
+                               "and shader binding tables for replay");
+            pipeline_failed_ = true;
+        }
+    }
+
+    if (!pipeline_failed_ && (UpdateRangeTable() == VK_SUCCESS) && (UpdateHandleTables(copies) == VK_SUCCESS) &&
+        (UpdateDescriptorSets(copies) == VK_SUCCESS))
+    {
+        patch = true;
+    }
+
+    VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin_info.pNext                    = nullptr;
+    begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    begin_info.pInheritanceInfo         = nullptr;
+
+    result = device_table_->BeginCommandBuffer(family.command_buffer, &begin_info);
+
+    if (result == VK_SUCCESS)
+    {
+        // Copy the data after the replayed work that wrote it, and patch the copies after they are written.
+        VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        device_table_->CmdPipelineBarrier(family.command_buffer,
+                                          VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          1,
+                                          &barrier,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr);
+
+        for (const PatchCopy* patch_copy : copies)
+        {
+            VkBufferCopy region = { patch_copy->source_offset, patch_copy->data_offset, patch_copy->data_size };
+
+            device_table_->CmdCopyBuffer(
+                family.command_buffer, patch_copy->source_buffer, patch_copy->copy.buffer, 1, &region);
+        }
+
+        VkPipelineStageFlags src_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+        if (patch)
+        {
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+            device_table_->CmdPipelineBarrier(family.command_buffer,
+                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                              VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                              0,
+                                              1,
+                                              &barrier,
+                                              0,
+                                              nullptr,
+                                              0,
+                                              nullptr);
+
+            RecordPatchCommands(family.command_buffer, copies);
+
+            src_stage             = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        }
+
+        // The barrier orders the commands of the submission that follows on the same queue with the patching.
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+
+        device_table_->CmdPipelineBarrier(family.command_buffer,
+                                          src_stage,
+                                          VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                          0,
+                                          1,
+                                          &barrier,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr);
+
+        result = device_table_->EndCommandBuffer(family.command_buffer);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = 0;
+        submit_info.pWaitSemaphores      = nullptr;
+        submit_info.pWaitDstStageMask    = nullptr;
+        submit_info.commandBufferCount   = 1;
+        submit_info.pCommandBuffers      = &family.command_buffer;
+        submit_info.signalSemaphoreCount = 0;
+        submit_info.pSignalSemaphores    = nullptr;
+
+        result = device_table_->QueueSubmit(queue, 1, &submit_info, family.fence);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        family.pending = true;
+    }
+
+    return result;
+}
+
+void VulkanAddressPatcher::EraseOverlappingRanges(AddressRangeMap* ranges, VkDeviceAddress begin, VkDeviceAddress end)
+{
+    assert(ranges != nullptr);
+
+    auto entry = ranges->lower_bound(begin);
+
+    if ((entry != ranges->begin()) && (std::prev(entry)->second.end > begin))
+    {
+        --entry;
+    }
+
+    while ((entry != ranges->end()) && (entry->first < end))
+    {
+        entry = ranges->erase(entry);
+    }
+}
+
+VulkanAddressPatcher::AddressRangeMap::const_iterator VulkanAddressPatcher::FindRange(const AddressRangeMap& ranges,
+                                                                                      VkDeviceAddress        address)
+{
+    auto entry = ranges.upper_bound(address);
+
+    if (entry != ranges.begin())
+    {
+        --entry;
+
+        if (address < entry->second.end)
+        {
+            return entry;
+        }
+    }
+
+    return ranges.end();
+}
+
+VkResult VulkanAddressPatcher::CreateBuffer(VkDeviceSize       size,
+                                            VkBufferUsageFlags usage,
+                                            bool               host_visible,
+                                            BufferAllocation*  allocation)
+{
+    assert(allocation != nullptr);
+
+    allocation->size  = size;
+    allocation->usage = usage;
+
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = size;
+    create_info.usage                 = usage;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
+
+    VkResult result =
+        allocator_->CreateBufferDirect(&create_info, nullptr, &allocation->buffer, &allocation->buffer_data);
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements requirements;
+        device_table_->GetBufferMemoryRequirements(device_, allocation->buffer, &requirements);
+
+        VkMemoryPropertyFlags property_flags = host_visible
+                                                   ? (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+                                                   : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        uint32_t memory_type_index = GetMemoryTypeIndex(requirements.memoryTypeBits, property_flags);
+
+        if ((memory_type_index == std::numeric_limits<uint32_t>::max()) && !host_visible)
+        {
+            memory_type_index = GetMemoryTypeIndex(requirements.memoryTypeBits, 0);
+        }
+
+        if (memory_type_index == std::numeric_limits<uint32_t>::max())
+        {
+            result = VK_ERROR_FEATURE_NOT_PRESENT;
+        }
+        else
+        {
+            VkMemoryAllocateFlagsInfo allocate_flags_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO };
+            allocate_flags_info.pNext                     = nullptr;
+            allocate_flags_info.flags                     = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+            allocate_flags_info.deviceMask                = 0;
+
+            VkMemoryAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+            allocate_info.pNext                = ((usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) != 0)
+                                                     ? &allocate_flags_info
+                                                     : nullptr;
+            allocate_info.allocationSize       = requirements.size;
+            allocate_info.memoryTypeIndex      = memory_type_index;
+
+            result = allocator_->AllocateMemoryDirect(
+                &allocate_info, nullptr, &allocation->memory, &allocation->memory_data);
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryPropertyFlags flags = 0;
+
+        result = allocator_->BindBufferMemoryDirect(
+            allocation->buffer, allocation->memory, 0, allocation->buffer_data, allocation->memory_data, &flags);
+    }
+
+    if ((result == VK_SUCCESS) && host_visible)
+    {
+        result = allocator_->MapResourceMemoryDirect(size, 0, &allocation->mapped_data, allocation->buffer_data);
+    }
+
+    if ((result == VK_SUCCESS) && ((usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) != 0))
+    {
+        VkBufferDeviceAddressInfo address_info = { VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
+        address_info.pNext                     = nullptr;
+        address_info.buffer                    = allocation->buffer;
+
+        allocation->address = get_buffer_device_address_(device_, &address_info);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        DestroyBuffer(allocation);
+    }
+
+    return result;
+}
+
+void VulkanAddressPatcher::DestroyBuffer(BufferAllocation* allocation)
+{
+    assert(allocation != nullptr);
+
+    if (allocation->mapped_data != nullptr)
+    {
+        allocator_->UnmapResourceMemoryDirect(allocation->buffer_data);
+        allocation->mapped_data = nullptr;
+    }
+
+    if (allocation->buffer != VK_NULL_HANDLE)
+    {
+        allocator_->DestroyBufferDirect(allocation->buffer, nullptr, allocation->buffer_data);
+        allocation->buffer = VK_NULL_HANDLE;
+    }
+
+    if (allocation->memory != VK_NULL_HANDLE)
+    {
+        allocator_->FreeMemoryDirect(allocation->memory, nullptr, allocation->memory_data);
+        allocation->memory = VK_NULL_HANDLE;
+    }
+
+    allocation->size    = 0;
+    allocation->address = 0;
+    allocation->usage   = 0;
+}
+
+uint32_t VulkanAddressPatcher::GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags) const
+{
+    uint32_t memory_type_index = std::numeric_limits<uint32_t>::max();
+
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i)
+    {
+        if ((type_bits & (1 << i)) &&
+            ((memory_properties_.memoryTypes[i].propertyFlags & property_flags) == property_flags))
+        {
+            memory_type_index = i;
+            break;
+        }
+    }
+
+    return memory_type_index;
+}
+
+bool VulkanAddressPatcher::AddInstanceCopy(VkCommandBuffer  command_buffer,
+                                           VkDeviceAddress  capture_address,
+                                           uint32_t         primitive_offset,
+                                           uint32_t         primitive_count,
+                                           VkDeviceAddress* copy_address)
+{
+    assert(copy_address != nullptr);
+
+    if (primitive_count == 0)
+    {
+        return false;
+    }
+
+    VkDeviceSize data_size = static_cast<VkDeviceSize>(primitive_count) * sizeof(VkAccelerationStructureInstanceKHR);
+    auto         range     = FindRange(buffer_ranges_, capture_address);
+
+    if ((range == buffer_ranges_.end()) ||
+        ((range->second.end - capture_address) < (static_cast<VkDeviceSize>(primitive_offset) + data_size)))
+    {
+        GFXRECON_LOG_WARNING_ONCE("Acceleration structure instances that are not contained by a buffer with a known "
+                                  "device address are not patched with replay addresses");
+        return false;
+    }
+
+    PatchCopy instance_copy;
+    instance_copy.source_buffer = range->second.buffer;
+    instance_copy.source_offset = (capture_address - range->first) + primitive_offset;
+    instance_copy.data_offset   = primitive_offset;
+    instance_copy.data_size     = data_size;
+    instance_copy.first_word    = static_cast<uint32_t>(primitive_offset / sizeof(uint32_t)) + kInstanceReferenceWord;
+    instance_copy.word_stride   = kInstanceWords;
+    instance_copy.patch_count   = primitive_count;
+
+    // Replay threads record the acceleration structure builds of different command buffers concurrently.
+    std::lock_guard<std::mutex> lock(command_buffer_mutex_);
+
+    if (AcquireCopy(primitive_offset + data_size, kInstanceCopyUsage, &instance_copy.copy) != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to create a buffer for patching acceleration structure instances with replay "
+                           "addresses");
+        return false;
+    }
+
+    (*copy_address) = instance_copy.copy.address;
+    patch_copies_[command_buffer].push_back(instance_copy);
+
+    return true;
+}
+
+VkResult VulkanAddressPatcher::AcquireCopy(VkDeviceSize size, VkBufferUsageFlags usage, BufferAllocation* allocation)
+{
+    assert(allocation != nullptr);
+
+    auto free_copy = std::find_if(free_copies_.begin(), free_copies_.end(), [size, usage](const auto& copy) {
+        return (copy.usage == usage) && (copy.size >= size);
+    });
+
+    if (free_copy != free_copies_.end())
+    {
+        (*allocation) = *free_copy;
+        free_copies_.erase(free_copy);
+
+        return VK_SUCCESS;
+    }
+
+    return CreateBuffer(size, usage, false, allocation);
+}
+
+uint32_t VulkanAddressPatcher::HashHandle(const uint32_t* handle, uint32_t handle_words)
+{
+    assert(handle != nullptr);
+
+    uint32_t hash = kHandleHashBasis;
+
+    for (uint32_t i = 0; i < handle_words; ++i)
+    {
+        hash = (hash ^ handle[i]) * kHandleHashPrime;
+    }
+
+    return hash;
+}
+
+void VulkanAddressPatcher::InsertHandle(HandleTable*    table,
+                                        const uint32_t* capture_handle,
+                                        const uint32_t* replay_handle)
+{
+    assert((table != nullptr) && (capture_handle != nullptr) && (replay_handle != nullptr));
+
+    const uint32_t handle_words = table->handle_words;
+    const size_t   slot_words   = (handle_words * 2) + 1;
+    size_t         slot_count   = table->slots.size() / slot_words;
+
+    // The table is kept at most half full, so that the probing of the patching shader always finds an unused slot.
+    if (((table->handle_count + 1) * 2) > slot_count)
+    {
+        size_t                new_slot_count = std::max(slot_count * 2, kMinHandleTableSlots);
+        std::vector<uint32_t> slots(new_slot_count * slot_words, 0);
+
+        std::swap(slots, table->slots);
+        table->handle_count = 0;
+
+        for (size_t i = 0; i < slot_count; ++i)
+        {
+            const uint32_t* slot = &slots[i * slot_words];
+
+            if (slot[0] != 0)
+            {
+                InsertHandle(table, slot + 1, slot + 1 + handle_words);
+            }
+        }
+
+        slot_count = new_slot_count;
+    }
+
+    size_t    slot_mask = slot_count - 1;
+    size_t    index     = HashHandle(capture_handle, handle_words) & slot_mask;
+    uint32_t* slot      = &table->slots[index * slot_words];
+
+    while ((slot[0] != 0) && !std::equal(capture_handle, capture_handle + handle_words, slot + 1))
+    {
+        index = (index + 1) & slot_mask;
+        slot  = &table->slots[index * slot_words];
+    }
+
+    if (slot[0] == 0)
+    {
+        slot[0] = 1;
+        std::copy(capture_handle, capture_handle + handle_words, slot + 1);
+        ++table->handle_count;
+    }
+
+    std::copy(replay_handle, replay_handle + handle_words, slot + 1 + handle_words);
+    table->dirty = true;
+}
+
+void VulkanAddressPatcher::UpdateRemappedCount()
+{
+    remapped_accel_struct_count_ = 0;
+
+    for (const auto& entry : accel_struct_ranges_)
+    {
+        if (entry.first != entry.second.replay_address)
+        {
+            ++remapped_accel_struct_count_;
+        }
+    }
+}
+
+VkResult VulkanAddressPatcher::CreatePipeline()
+{
+    VkDescriptorSetLayoutBinding bindings[2];
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        bindings[i].binding            = i;
+        bindings[i].descriptorType     = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount    = 1;
+        bindings[i].stageFlags         = VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings[i].pImmutableSamplers = nullptr;
+    }
+
+    VkDescriptorSetLayoutCreateInfo layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    layout_info.pNext                           = nullptr;
+    layout_info.flags                           = 0;
+    layout_info.bindingCount                    = 2;
+    layout_info.pBindings                       = bindings;
+
+    VkResult result = device_table_->CreateDescriptorSetLayout(device_, &layout_info, nullptr, &descriptor_set_layout_);
+
+    if (result == VK_SUCCESS)
+    {
+        // The patching shaders share the pipeline layout, with the push constant range of the larger constants.
+        VkPushConstantRange push_constant_range = { VK_SHADER_STAGE_COMPUTE_BIT, 0, kPushConstantsSize };
+
+        VkPipelineLayoutCreateInfo pipeline_layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        pipeline_layout_info.pNext                      = nullptr;
+        pipeline_layout_info.flags                      = 0;
+        pipeline_layout_info.setLayoutCount             = 1;
+        pipeline_layout_info.pSetLayouts                = &descriptor_set_layout_;
+        pipeline_layout_info.pushConstantRangeCount     = 1;
+        pipeline_layout_info.pPushConstantRanges        = &push_constant_range;
+
+        result = device_table_->CreatePipelineLayout(device_, &pipeline_layout_info, nullptr, &pipeline_layout_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = CreateComputePipeline(
+            reinterpret_cast<const uint32_t*>(g_CSMain), sizeof(g_CSMain), "CSMain", &pipeline_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = CreateComputePipeline(reinterpret_cast<const uint32_t*>(g_PatchHandles),
+                                       sizeof(g_PatchHandles),
+                                       "PatchHandles",
+                                       &handle_pipeline_);
+    }
+
+    return result;
+}
+
+VkResult VulkanAddressPatcher::CreateComputePipeline(const uint32_t* code,
+                                                     size_t          code_size,
+                                                     const char*     entry_point,
+                                                     VkPipeline*     pipeline)
+{
+    assert((code != nullptr) && ((code_size % 4) == 0) && (entry_point != nullptr) && (pipeline != nullptr));
+
+    VkShaderModule module = VK_NULL_HANDLE;
+
+    VkShaderModuleCreateInfo module_info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+    module_info.pNext                    = nullptr;
+    module_info.flags                    = 0;
+    module_info.codeSize                 = code_size;
+    module_info.pCode                    = code;
+
+    VkResult result = device_table_->CreateShaderModule(device_, &module_info, nullptr, &module);
+
+    if (result == VK_SUCCESS)
+    {
+        VkComputePipelineCreateInfo pipeline_info = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+        pipeline_info.pNext                       = nullptr;
+        pipeline_info.flags                       = 0;
+        pipeline_info.stage.sType                 = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipeline_info.stage.pNext                 = nullptr;
+        pipeline_info.stage.flags                 = 0;
+        pipeline_info.stage.stage                 = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_info.stage.module                = module;
+        pipeline_info.stage.pName                 = entry_point;
+        pipeline_info.stage.pSpecializationInfo   = nullptr;
+        pipeline_info.layout                      = pipeline_layout_;
+        pipeline_info.basePipelineHandle          = VK_NULL_HANDLE;
+        pipeline_info.basePipelineIndex           = -1;
+
+        result = device_table_->CreateComputePipelines(device_, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, pipeline);
+    }
+
+    if (module != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyShaderModule(device_, module, nullptr);
+    }
+
+    return result;
+}
+
+VkResult VulkanAddressPatcher::UpdateRangeTable()
+{
+    if (!range_table_dirty_ && (range_table_.buffer != VK_NULL_HANDLE))
+    {
+        return VK_SUCCESS;
+    }
+
+    // The table is never empty, so that it can always be bound to the patching shader.
+    VkDeviceSize table_size =
+        std::max<size_t>(accel_struct_ranges_.size(), 1) * kRangeTableWords * sizeof(uint32_t);
+
+    if (range_table_.size < table_size)
+    {
+        DestroyBuffer(&range_table_);
+
+        VkResult result = CreateBuffer(table_size * 2, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, true, &range_table_);
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to create the device address range table for patching acceleration structure "
+                               "instances with replay addresses");
+            return result;
+        }
+    }
+
+    // The ranges are sorted by capture address for the binary search of the patching shader.
+    auto table = reinterpret_cast<uint32_t*>(range_table_.mapped_data);
+
+    for (const auto& entry : accel_struct_ranges_)
+    {
+        const VkDeviceAddress values[] = { entry.first, entry.second.end, entry.second.replay_address };
+
+        for (VkDeviceAddress value : values)
+        {
+            *(table++) = static_cast<uint32_t>(value);
+            *(table++) = static_cast<uint32_t>(value >> 32);
+        }
+    }
+
+    range_table_dirty_ = false;
+
+    return VK_SUCCESS;
+}
+
+VkResult VulkanAddressPatcher::UpdateHandleTables(const std::vector<const PatchCopy*>& copies)
+{
+    for (const PatchCopy* patch_copy : copies)
+    {
+        HandleTable* table = patch_copy->handle_table;
+
+        if ((table != nullptr) && table->dirty)
+        {
+            VkDeviceSize table_size = table->slots.size() * sizeof(uint32_t);
+
+            if (table->buffer.size < table_size)
+            {
+                DestroyBuffer(&table->buffer);
+
+                VkResult result = CreateBuffer(table_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, true, &table->buffer);
+
+                if (result != VK_SUCCESS)
+                {
+                    GFXRECON_LOG_ERROR("Failed to create the shader group handle table for patching shader binding "
+                                       "tables with replay handles");
+                    return result;
+                }
+            }
+
+            memcpy(table->buffer.mapped_data, table->slots.data(), static_cast<size_t>(table_size));
+            table->dirty = false;
+        }
+    }
+
+    return VK_SUCCESS;
+}
+
+VkResult VulkanAddressPatcher::UpdateDescriptorSets(const std::vector<const PatchCopy*>& copies)
+{
+    VkResult result    = VK_SUCCESS;
+    uint32_t set_count = static_cast<uint32_t>(copies.size());
+
+    if (descriptor_pool_size_ < set_count)
+    {
+        uint32_t pool_size = std::max(set_count, descriptor_pool_size_ * 2);
+
+        if (descriptor_pool_ != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyDescriptorPool(device_, descriptor_pool_, nullptr);
+            descriptor_pool_      = VK_NULL_HANDLE;
+            descriptor_pool_size_ = 0;
+        }
+
+        VkDescriptorPoolSize type_size = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, pool_size * 2 };
+
+        VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+        pool_info.pNext                      = nullptr;
+        pool_info.flags                      = 0;
+        pool_info.maxSets                    = pool_size;
+        pool_info.poolSizeCount              = 1;
+        pool_info.pPoolSizes                 = &type_size;
+
+        result = device_table_->CreateDescriptorPool(device_, &pool_info, nullptr, &descriptor_pool_);
+
+        if (result == VK_SUCCESS)
+        {
+            descriptor_pool_size_ = pool_size;
+        }
+    }
+    else
+    {
+        result = device_table_->ResetDescriptorPool(device_, descriptor_pool_, 0);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        std::vector<VkDescriptorSetLayout> layouts(set_count, descriptor_set_layout_);
+
+        descriptor_sets_.resize(set_count);
+
+        VkDescriptorSetAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+        allocate_info.pNext                       = nullptr;
+        allocate_info.descriptorPool              = descriptor_pool_;
+        allocate_info.descriptorSetCount          = set_count;
+        allocate_info.pSetLayouts                 = layouts.data();
+
+        result = device_table_->AllocateDescriptorSets(device_, &allocate_info, descriptor_sets_.data());
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        std::vector<VkDescriptorBufferInfo> buffer_infos;
+        std::vector<VkWriteDescriptorSet>   writes;
+
+        buffer_infos.reserve(set_count * 2);
+        writes.reserve(set_count);
+
+        for (uint32_t i = 0; i < set_count; ++i)
+        {
+            // Instance data copies are patched with the range table, and shader binding table copies with the
+            // handle table of their pipeline.
+            const HandleTable* table = copies[i]->handle_table;
+
+            buffer_infos.push_back({ copies[i]->copy.buffer, 0, VK_WHOLE_SIZE });
+            buffer_infos.push_back(
+                { (table != nullptr) ? table->buffer.buffer : range_table_.buffer, 0, VK_WHOLE_SIZE });
+
+            VkWriteDescriptorSet write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+            write.pNext                = nullptr;
+            write.dstSet               = descriptor_sets_[i];
+            write.dstBinding           = 0;
+            write.dstArrayElement      = 0;
+            write.descriptorCount      = 2;
+            write.descriptorType       = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            write.pImageInfo           = nullptr;
+            write.pBufferInfo          = &buffer_infos[i * 2];
+            write.pTexelBufferView     = nullptr;
+
+            writes.push_back(write);
+        }
+
+        device_table_->UpdateDescriptorSets(device_, set_count, writes.data(), 0, nullptr);
+    }
+
+    return result;
+}
+
+void VulkanAddressPatcher::RecordPatchCommands(VkCommandBuffer                      command_buffer,
+                                               const std::vector<const PatchCopy*>& copies)
+{
+    const uint32_t max_dispatch_count = kPatchGroupSize * kMaxPatchGroupCount;
+    VkPipeline     bound_pipeline     = VK_NULL_HANDLE;
+
+    for (size_t i = 0; i < copies.size(); ++i)
+    {
+        const PatchCopy*   patch_copy = copies[i];
+        const HandleTable* table      = patch_copy->handle_table;
+        VkPipeline         pipeline   = (table != nullptr) ? handle_pipeline_ : pipeline_;
+
+        if (pipeline != bound_pipeline)
+        {
+            device_table_->CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+            bound_pipeline = pipeline;
+        }
+
+        device_table_->CmdBindDescriptorSets(command_buffer,
+                                             VK_PIPELINE_BIND_POINT_COMPUTE,
+                                             pipeline_layout_,
+                                             0,
+                                             1,
+                                             &descriptor_sets_[i],
+                                             0,
+                                             nullptr);
+
+        // Dispatches are split to stay within the minimum work group count limit.
+        for (uint32_t first = 0; first < patch_copy->patch_count; first += max_dispatch_count)
+        {
+            uint32_t first_word  = patch_copy->first_word + (first * patch_copy->word_stride);
+            uint32_t patch_count = std::min(patch_copy->patch_count - first, max_dispatch_count);
+
+            if (table != nullptr)
+            {
+                uint32_t slot_count = static_cast<uint32_t>(table->slots.size() / ((table->handle_words * 2) + 1));
+
+                HandlePatchConstants constants;
+                constants.first_word   = first_word;
+                constants.word_stride  = patch_copy->word_stride;
+                constants.record_count = patch_count;
+                constants.slot_mask    = slot_count - 1;
+                constants.handle_words = table->handle_words;
+
+                device_table_->CmdPushConstants(command_buffer,
+                                                pipeline_layout_,
+                                                VK_SHADER_STAGE_COMPUTE_BIT,
+                                                0,
+                                                sizeof(constants),
+                                                &constants);
+            }
+            else
+            {
+                PatchConstants constants;
+                constants.first_word    = first_word;
+                constants.word_stride   = patch_copy->word_stride;
+                constants.address_count = patch_count;
+                constants.range_count   = static_cast<uint32_t>(accel_struct_ranges_.size());
+
+                device_table_->CmdPushConstants(command_buffer,
+                                                pipeline_layout_,
+                                                VK_SHADER_STAGE_COMPUTE_BIT,
+                                                0,
+                                                sizeof(constants),
+                                                &constants);
+            }
+
+            device_table_->CmdDispatch(command_buffer, (patch_count + kPatchGroupSize - 1) / kPatchGroupSize, 1, 1);
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
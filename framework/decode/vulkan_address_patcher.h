@@ -0,0 +1,239 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_ADDRESS_PATCHER_H
+#define GFXRECON_DECODE_VULKAN_ADDRESS_PATCHER_H
+
+#include "decode/vulkan_resource_allocator.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Translates the buffer and acceleration structure device addresses that were retrieved at capture to the addresses
+// retrieved for the same objects during replay, for replay devices that do not reproduce the captured addresses.
+// Addresses that are command parameters are remapped on the CPU when the command is recorded.  The acceleration
+// structure references in the instance data of acceleration structure builds are remapped by a compute shader, which
+// patches a copy of the instance data before each submission of the command buffer that records the build.  The
+// shader group handles in the shader binding tables of ray tracing commands are similarly replaced by the replay
+// handles of the bound pipeline, which are found in a hash table of the handles that differ from the capture handles.
+class VulkanAddressPatcher
+{
+  public:
+    VulkanAddressPatcher(VkDevice                                device,
+                         const encode::DeviceTable*              device_table,
+                         const VkPhysicalDeviceMemoryProperties& memory_properties,
+                         VulkanResourceAllocator*                allocator,
+                         PFN_vkGetBufferDeviceAddress            get_buffer_device_address);
+
+    ~VulkanAddressPatcher();
+
+    // Retrieves the queues of a family that can execute the patching shader.
+    void AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, VkQueueFlags queue_flags);
+
+    // Adds the capture and replay addresses of a buffer, replacing the ranges of destroyed buffers that overlap it.
+    void AddBufferAddress(VkBuffer        buffer,
+                          VkDeviceSize    size,
+                          VkDeviceAddress capture_address,
+                          VkDeviceAddress replay_address);
+
+    void RemoveBuffer(VkBuffer buffer);
+
+    void AddAccelerationStructureAddress(VkDeviceAddress capture_address, VkDeviceAddress replay_address);
+
+    // Returns the replay address of a captured buffer address, or the captured address if it is not contained by a
+    // buffer with a known address.
+    VkDeviceAddress RemapBufferAddress(VkDeviceAddress capture_address) const;
+
+    void RemapStridedRegion(VkStridedDeviceAddressRegionKHR* region) const;
+
+    // Adds the capture and replay shader group handles of a ray tracing pipeline, for the handles that differ.
+    void AddShaderGroupHandles(format::HandleId pipeline_id,
+                               uint32_t         group_count,
+                               size_t           data_size,
+                               const uint8_t*   capture_data,
+                               const uint8_t*   replay_data);
+
+    // Tracks the ray tracing pipeline that is bound to a command buffer, for the shader binding tables of its trace
+    // rays commands.  The command buffer recording functions may be called concurrently for different command buffers.
+    void BindPipeline(VkCommandBuffer command_buffer, VkPipelineBindPoint bind_point, format::HandleId pipeline_id);
+
+    // Remaps the address of a shader binding table region.  When the pipeline bound to the command buffer has replay
+    // shader group handles that differ from the capture handles, the region is redirected to a copy that is patched
+    // with the replay handles by PatchSubmission().
+    void RemapShaderBindingTable(VkCommandBuffer command_buffer, VkStridedDeviceAddressRegionKHR* region);
+
+    // Copies the build infos and their geometry to build_infos and geometry, remapping their addresses.  The instance
+    // data of top level builds is redirected to copies that are patched by PatchSubmission().
+    void RemapBuildGeometry(VkCommandBuffer                                               command_buffer,
+                            uint32_t                                                      info_count,
+                            const VkAccelerationStructureBuildGeometryInfoKHR*            infos,
+                            const VkAccelerationStructureBuildRangeInfoKHR* const*        range_infos,
+                            std::vector<VkAccelerationStructureBuildGeometryInfoKHR>*     build_infos,
+                            std::vector<std::vector<VkAccelerationStructureGeometryKHR>>* geometry);
+
+    // Releases the instance data and shader binding table copies of a command buffer that is being recorded again.
+    void ResetCommandBuffer(VkCommandBuffer command_buffer);
+
+    // Copies and patches the instance data and shader binding tables for the commands recorded by the command buffers
+    // of the submission, ahead of the submission on the same queue.
+    VkResult PatchSubmission(VkQueue queue, uint32_t submit_count, const VkSubmitInfo* submits);
+
+  private:
+    struct AddressRange
+    {
+        VkDeviceAddress end{ 0 };
+        VkDeviceAddress replay_address{ 0 };
+        VkBuffer        buffer{ VK_NULL_HANDLE };
+    };
+
+    typedef std::map<VkDeviceAddress, AddressRange> AddressRangeMap;
+
+    struct BufferAllocation
+    {
+        VkDeviceSize                          size{ 0 };
+        VkBuffer                              buffer{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::ResourceData buffer_data{ 0 };
+        VkDeviceMemory                        memory{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::MemoryData   memory_data{ 0 };
+        void*                                 mapped_data{ nullptr };
+        VkDeviceAddress                       address{ 0 };
+        VkBufferUsageFlags                    usage{ 0 };
+    };
+
+    // Open addressing hash table of the capture and replay shader group handles of a pipeline, with the slot layout
+    // that is searched by the handle patching shader.
+    struct HandleTable
+    {
+        uint32_t              handle_words{ 0 };
+        uint32_t              handle_count{ 0 };
+        std::vector<uint32_t> slots;
+        bool                  dirty{ false };
+        BufferAllocation      buffer;
+    };
+
+    // Instance data of a build or shader binding table region of a trace rays command, with the copy that the command
+    // reads in its place.
+    struct PatchCopy
+    {
+        VkBuffer         source_buffer{ VK_NULL_HANDLE };
+        VkDeviceSize     source_offset{ 0 };
+        VkDeviceSize     data_offset{ 0 }; // Offset of the data in the copy, which is kept from the build range.
+        VkDeviceSize     data_size{ 0 };
+        uint32_t         first_word{ 0 }; // First patched word of the copy.
+        uint32_t         word_stride{ 0 };
+        uint32_t         patch_count{ 0 };
+        HandleTable*     handle_table{ nullptr }; // Table for shader binding table copies, or null for instance data.
+        BufferAllocation copy;
+    };
+
+    struct QueueFamily
+    {
+        VkCommandPool   command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer command_buffer{ VK_NULL_HANDLE };
+        VkFence         fence{ VK_NULL_HANDLE };
+        bool            pending{ false };
+    };
+
+  private:
+    static void EraseOverlappingRanges(AddressRangeMap* ranges, VkDeviceAddress begin, VkDeviceAddress end);
+
+    // Returns the range containing the address, or the end of the map.
+    static AddressRangeMap::const_iterator FindRange(const AddressRangeMap& ranges, VkDeviceAddress address);
+
+    VkResult CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, bool host_visible, BufferAllocation* allocation);
+
+    void DestroyBuffer(BufferAllocation* allocation);
+
+    uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags) const;
+
+    bool AddInstanceCopy(VkCommandBuffer  command_buffer,
+                         VkDeviceAddress  capture_address,
+                         uint32_t         primitive_offset,
+                         uint32_t         primitive_count,
+                         VkDeviceAddress* copy_address);
+
+    // Acquires a released copy with the size and usage, or creates a new copy.  Must be called with the command buffer
+    // mutex locked.
+    VkResult AcquireCopy(VkDeviceSize size, VkBufferUsageFlags usage, BufferAllocation* allocation);
+
+    static uint32_t HashHandle(const uint32_t* handle, uint32_t handle_words);
+
+    static void InsertHandle(HandleTable* table, const uint32_t* capture_handle, const uint32_t* replay_handle);
+
+    void UpdateRemappedCount();
+
+    VkResult CreatePipeline();
+
+    VkResult
+    CreateComputePipeline(const uint32_t* code, size_t code_size, const char* entry_point, VkPipeline* pipeline);
+
+    VkResult UpdateRangeTable();
+
+    VkResult UpdateHandleTables(const std::vector<const PatchCopy*>& copies);
+
+    VkResult UpdateDescriptorSets(const std::vector<const PatchCopy*>& copies);
+
+    void RecordPatchCommands(VkCommandBuffer command_buffer, const std::vector<const PatchCopy*>& copies);
+
+  private:
+    VkDevice                                                    device_;
+    const encode::DeviceTable*                                  device_table_;
+    VkPhysicalDeviceMemoryProperties                            memory_properties_;
+    VulkanResourceAllocator*                                    allocator_;
+    PFN_vkGetBufferDeviceAddress                                get_buffer_device_address_;
+    AddressRangeMap                                             buffer_ranges_;
+    std::unordered_map<VkBuffer, VkDeviceAddress>               buffer_capture_addresses_;
+    AddressRangeMap                                             accel_struct_ranges_;
+    size_t                                                      remapped_accel_struct_count_;
+    bool                                                        range_table_dirty_;
+    BufferAllocation                                            range_table_;
+    std::unordered_map<format::HandleId, HandleTable>           handle_tables_;
+    std::mutex                                                  command_buffer_mutex_; // Guards the recording state.
+    std::unordered_map<VkCommandBuffer, format::HandleId>       bound_pipelines_;
+    std::unordered_map<VkCommandBuffer, std::vector<PatchCopy>> patch_copies_;
+    std::vector<BufferAllocation>                               free_copies_;
+    std::map<uint32_t, QueueFamily>                             families_;
+    std::unordered_map<VkQueue, QueueFamily*>                   queue_families_;
+    VkDescriptorSetLayout                                       descriptor_set_layout_;
+    VkPipelineLayout                                            pipeline_layout_;
+    VkPipeline                                                  pipeline_;
+    VkPipeline                                                  handle_pipeline_;
+    VkDescriptorPool                                            descriptor_pool_;
+    uint32_t                                                    descriptor_pool_size_;
+    std::vector<VkDescriptorSet>                                descriptor_sets_;
+    bool                                                        pipeline_failed_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_ADDRESS_PATCHER_H
@@ -23,6 +23,7 @@
 
 #include "decode/vulkan_ascii_consumer_base.h"
 
+#include "util/logging.h"
 #include "util/platform.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -46,6 +47,7 @@ bool VulkanAsciiConsumerBase::Initialize(const std::string& filename)
         {
             success    = true;
             m_filename = filename;
+            m_buffer.reserve(kOutputBufferSize);
         }
     }
 
@@ -56,10 +58,36 @@ void VulkanAsciiConsumerBase::Destroy()
 {
     if (m_file != nullptr)
     {
+        Flush();
         util::platform::FileClose(m_file);
+        m_file = nullptr;
     }
 }
 
+void VulkanAsciiConsumerBase::WriteLine(const char* text, size_t length)
+{
+    if ((m_buffer.size() + length + 1) > kOutputBufferSize)
+    {
+        Flush();
+    }
+
+    m_buffer.insert(m_buffer.end(), text, text + length);
+    m_buffer.push_back('\n');
+}
+
+void VulkanAsciiConsumerBase::Flush()
+{
+    if ((m_file != nullptr) && !m_buffer.empty())
+    {
+        if (util::platform::FileWriteNoLock(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size())
+        {
+            GFXRECON_LOG_ERROR("Failed to write to file %s", m_filename.c_str());
+        }
+    }
+
+    m_buffer.clear();
+}
+
 void VulkanAsciiConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(format::HandleId device,
                                                                         format::HandleId descriptorSet,
                                                                         format::HandleId descriptorUpdateTemplate,
@@ -69,7 +97,7 @@ void VulkanAsciiConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(format::
     GFXRECON_UNREFERENCED_PARAMETER(descriptorSet);
     GFXRECON_UNREFERENCED_PARAMETER(descriptorUpdateTemplate);
     GFXRECON_UNREFERENCED_PARAMETER(pData);
-    fprintf(m_file, "%s\n", "vkUpdateDescriptorSetWithTemplate");
+    WriteLine("vkUpdateDescriptorSetWithTemplate");
 }
 
 void VulkanAsciiConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(format::HandleId commandBuffer,
@@ -83,7 +111,7 @@ void VulkanAsciiConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(form
     GFXRECON_UNREFERENCED_PARAMETER(layout);
     GFXRECON_UNREFERENCED_PARAMETER(set);
     GFXRECON_UNREFERENCED_PARAMETER(pData);
-    fprintf(m_file, "%s\n", "vkCmdPushDescriptorSetWithTemplateKHR");
+    WriteLine("vkCmdPushDescriptorSetWithTemplateKHR");
 }
 
 void VulkanAsciiConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(format::HandleId device,
@@ -95,7 +123,7 @@ void VulkanAsciiConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(forma
     GFXRECON_UNREFERENCED_PARAMETER(descriptorSet);
     GFXRECON_UNREFERENCED_PARAMETER(descriptorUpdateTemplate);
     GFXRECON_UNREFERENCED_PARAMETER(pData);
-    fprintf(m_file, "%s\n", "vkUpdateDescriptorSetWithTemplateKHR");
+    WriteLine("vkUpdateDescriptorSetWithTemplateKHR");
 }
 
 GFXRECON_END_NAMESPACE(decode)
@@ -32,6 +32,7 @@
 
 #include <cstdio>
 #include <string>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -68,11 +69,25 @@ class VulkanAsciiConsumerBase : public VulkanConsumer
                                                               DescriptorUpdateTemplateDecoder* pData) override;
 
   protected:
-    FILE* GetFile() const { return m_file; }
+    // Appends a line to the output buffer, which is written to the file when it is full.  The length of a string
+    // literal is known at compile time, so lines are written without format string parsing or length computation.
+    template <size_t N>
+    void WriteLine(const char (&text)[N])
+    {
+        WriteLine(text, N - 1);
+    }
+
+    void WriteLine(const char* text, size_t length);
+
+    void Flush();
+
+  private:
+    static const size_t kOutputBufferSize = 4 * 1024 * 1024;
 
   private:
-    FILE*       m_file;
-    std::string m_filename;
+    FILE*             m_file;
+    std::string       m_filename;
+    std::vector<char> m_buffer;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -24,6 +24,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_CONSUMER_BASE_H
 #define GFXRECON_DECODE_VULKAN_CONSUMER_BASE_H
 
+#include "format/api_call_id.h"
 #include "format/platform_types.h"
 #include "decode/custom_vulkan_struct_decoders.h"
 #include "decode/descriptor_update_template_decoder.h"
@@ -39,6 +40,8 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+struct ResourceInitDataLocation;
+
 class VulkanConsumerBase
 {
   public:
@@ -46,6 +49,14 @@ class VulkanConsumerBase
 
     virtual ~VulkanConsumerBase() {}
 
+    // Called before a call is processed with the index of the block that contains the call, when enabled with
+    // VulkanDecoderBase::SetForwardBlockIndices().
+    virtual void SetCurrentBlockIndex(uint64_t block_index) {}
+
+    // Called before a call is processed with the ID of the API call, or ApiCall_Unknown for a meta command, when
+    // enabled with VulkanDecoderBase::SetForwardCallIds().
+    virtual void SetCurrentApiCallId(format::ApiCallId call_id) {}
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) {}
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) {}
@@ -98,6 +109,12 @@ class VulkanConsumerBase
                                                                const uint8_t*   data)
     {}
 
+    virtual void
+    ProcessSetPipelineCacheDataCommand(format::HandleId device_id, size_t data_size, const uint8_t* data)
+    {}
+
+    virtual void ProcessTimestampCommand(uint64_t timestamp) {}
+
     virtual void ProcessSetSwapchainImageStateCommand(format::HandleId device_id,
                                                       format::HandleId swapchain_id,
                                                       uint32_t         last_presented_image,
@@ -110,6 +127,20 @@ class VulkanConsumerBase
 
     virtual void ProcessEndResourceInitCommand(format::HandleId device_id) {}
 
+    // Returns memory that the data of the following ProcessInitBufferCommand() call for the buffer can be written to
+    // sequentially before the call, or nullptr if the consumer does not provide the memory.
+    virtual uint8_t*
+    GetInitBufferDataDestination(format::HandleId device_id, format::HandleId buffer_id, uint64_t data_size)
+    {
+        return nullptr;
+    }
+
+    virtual uint8_t*
+    GetInitImageDataDestination(format::HandleId device_id, format::HandleId image_id, uint64_t data_size)
+    {
+        return nullptr;
+    }
+
     virtual void ProcessInitBufferCommand(format::HandleId device_id,
                                           format::HandleId buffer_id,
                                           uint64_t         data_size,
@@ -125,6 +156,29 @@ class VulkanConsumerBase
                                          const uint8_t*               data)
     {}
 
+    // Receives the location of initialization data that was not read from the file when the block was processed.
+    virtual void ProcessDeferredInitBufferCommand(format::HandleId                device_id,
+                                                  format::HandleId                buffer_id,
+                                                  uint64_t                        data_size,
+                                                  const ResourceInitDataLocation& location)
+    {}
+
+    virtual void ProcessDeferredInitImageCommand(format::HandleId                device_id,
+                                                 format::HandleId                image_id,
+                                                 uint64_t                        data_size,
+                                                 uint32_t                        aspect,
+                                                 uint32_t                        layout,
+                                                 const std::vector<uint64_t>&    level_sizes,
+                                                 const ResourceInitDataLocation& location)
+    {}
+
+    // Called when fast forwarding reaches the target frame, with the number of rendering commands that were dropped
+    // and the command buffers that were not begun again after their rendering commands were dropped.
+    virtual void ProcessFastForwardEnd(uint32_t                             frame_number,
+                                       uint64_t                             skipped_command_count,
+                                       const std::vector<format::HandleId>& incomplete_command_buffers)
+    {}
+
     virtual void Process_vkUpdateDescriptorSetWithTemplate(format::HandleId                 device,
                                                            format::HandleId                 descriptorSet,
                                                            format::HandleId                 descriptorUpdateTemplate,
@@ -24,36 +24,477 @@
 #include "decode/vulkan_decoder_base.h"
 
 #include "decode/descriptor_update_template_decoder.h"
+#include "decode/handle_pointer_decoder.h"
 #include "decode/pointer_decoder.h"
+#include "decode/resource_init_data_reader.h"
+#include "decode/struct_pointer_decoder.h"
 #include "decode/value_decoder.h"
+#include "format/format_util.h"
+#include "generated/generated_vulkan_struct_decoders.h"
+#include "util/logging.h"
+
+#include <cinttypes>
+#include <cstring>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-void VulkanDecoderBase::DispatchStateBeginMarker(uint64_t frame_number)
+constexpr uint64_t VulkanDecoderBase::kNoBlockIndex;
+
+// Commands that are dropped from command buffers while fast forwarding.
+static bool IsRenderingCommand(format::ApiCallId call_id)
 {
-    for (auto consumer : consumers_)
+    switch (call_id)
     {
-        consumer->ProcessStateBeginMarker(frame_number);
+        case format::ApiCallId::ApiCall_vkCmdDraw:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawMultiEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+        case format::ApiCallId::ApiCall_vkCmdDispatch:
+        case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBase:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
+            return true;
+        default:
+            return false;
     }
 }
 
-void VulkanDecoderBase::DispatchStateEndMarker(uint64_t frame_number)
+bool VulkanDecoderBase::SkipFastForwardCall(format::ApiCallId call_id,
+                                            const uint8_t*    parameter_buffer,
+                                            size_t            buffer_size)
 {
-    for (auto consumer : consumers_)
+    // The target frame begins with the call that follows the present of the frame before it.
+    if ((fast_forward_present_count_ + 1) >= fast_forward_frame_)
     {
-        consumer->ProcessStateEndMarker(frame_number);
+        EndFastForward();
+        return false;
+    }
+
+    if (call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR)
+    {
+        ++fast_forward_present_count_;
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkBeginCommandBuffer)
+    {
+        // Beginning a command buffer discards the commands that were previously recorded to it.
+        format::HandleId command_buffer = format::kNullHandleId;
+        ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer);
+        skipped_command_buffers_.erase(command_buffer);
+    }
+    else if (IsRenderingCommand(call_id))
+    {
+        // The command buffer is the first parameter of each rendering command.
+        format::HandleId command_buffer = format::kNullHandleId;
+        ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer);
+        skipped_command_buffers_.insert(command_buffer);
+        ++skipped_command_count_;
+        return true;
+    }
+
+    return false;
+}
+
+void VulkanDecoderBase::EndFastForward()
+{
+    uint32_t                      frame_number  = fast_forward_frame_;
+    uint64_t                      skipped_count = skipped_command_count_;
+    std::vector<format::HandleId> command_buffers(skipped_command_buffers_.begin(), skipped_command_buffers_.end());
+
+    fast_forward_frame_ = 0;
+    skipped_command_buffers_.clear();
+
+    DispatchCall([frame_number, skipped_count, command_buffers](VulkanConsumer* consumer) {
+        consumer->ProcessFastForwardEnd(frame_number, skipped_count, command_buffers);
+    });
+}
+
+static bool IsSameCommand(format::ApiCallId           call_id,
+                          const uint8_t*              parameter_buffer,
+                          size_t                      buffer_size,
+                          format::ApiCallId           stored_call_id,
+                          const std::vector<uint8_t>& stored_parameters)
+{
+    return (call_id == stored_call_id) && (buffer_size == stored_parameters.size()) &&
+           ((buffer_size == 0) || (memcmp(parameter_buffer, stored_parameters.data(), buffer_size) == 0));
+}
+
+bool VulkanDecoderBase::SkipReusedCommandBufferCall(format::ApiCallId  call_id,
+                                                    const ApiCallInfo& call_info,
+                                                    const uint8_t*     parameter_buffer,
+                                                    size_t             buffer_size)
+{
+    // Commands that are decoded again after a recording stops matching are not checked a second time.
+    if (redispatching_commands_)
+    {
+        return false;
+    }
+
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+            return BeginCommandBufferRecording(call_id, call_info, parameter_buffer, buffer_size);
+        case format::ApiCallId::ApiCall_vkResetCommandPool:
+        case format::ApiCallId::ApiCall_vkDestroyCommandPool:
+        case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
+            // The pools of the command buffers are not tracked, so recordings from every pool are discarded.
+            for (auto& entry : command_buffer_recordings_)
+            {
+                if (!entry.second.recording)
+                {
+                    InvalidateRecording(entry.first, &entry.second);
+                }
+            }
+            return false;
+        case format::ApiCallId::ApiCall_vkResetCommandBuffer:
+        {
+            format::HandleId command_buffer = format::kNullHandleId;
+            ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer);
+
+            auto entry = command_buffer_recordings_.find(command_buffer);
+            if (entry != command_buffer_recordings_.end())
+            {
+                InvalidateRecording(command_buffer, &entry->second);
+            }
+            return false;
+        }
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplate:
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplateKHR:
+        {
+            format::HandleId device         = format::kNullHandleId;
+            format::HandleId descriptor_set = format::kNullHandleId;
+            size_t           bytes_read     = ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &device);
+            ValueDecoder::DecodeHandleIdValue(
+                (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptor_set);
+
+            InvalidateDependentRecordings(descriptor_set);
+            return false;
+        }
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSets:
+        {
+            format::HandleId                                   device      = format::kNullHandleId;
+            uint32_t                                           write_count = 0;
+            uint32_t                                           copy_count  = 0;
+            StructPointerDecoder<Decoded_VkWriteDescriptorSet> writes;
+            StructPointerDecoder<Decoded_VkCopyDescriptorSet>  copies;
+
+            size_t bytes_read = ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &device);
+            bytes_read += ValueDecoder::DecodeUInt32Value(
+                (parameter_buffer + bytes_read), (buffer_size - bytes_read), &write_count);
+            bytes_read += writes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+            bytes_read += ValueDecoder::DecodeUInt32Value(
+                (parameter_buffer + bytes_read), (buffer_size - bytes_read), &copy_count);
+            copies.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+            const Decoded_VkWriteDescriptorSet* write_meta = writes.GetMetaStructPointer();
+            for (size_t i = 0; (write_meta != nullptr) && (i < writes.GetLength()); ++i)
+            {
+                InvalidateDependentRecordings(write_meta[i].dstSet);
+            }
+
+            const Decoded_VkCopyDescriptorSet* copy_meta = copies.GetMetaStructPointer();
+            for (size_t i = 0; (copy_meta != nullptr) && (i < copies.GetLength()); ++i)
+            {
+                InvalidateDependentRecordings(copy_meta[i].dstSet);
+            }
+            return false;
+        }
+        case format::ApiCallId::ApiCall_vkEndCommandBuffer:
+            return ContinueCommandBufferRecording(call_id, call_info, parameter_buffer, buffer_size);
+        default:
+            break;
+    }
+
+    if (command_buffer_recordings_.empty() || (strncmp(format::GetApiCallName(call_id), "vkCmd", 5) != 0))
+    {
+        return false;
+    }
+
+    return ContinueCommandBufferRecording(call_id, call_info, parameter_buffer, buffer_size);
+}
+
+bool VulkanDecoderBase::BeginCommandBufferRecording(format::ApiCallId  call_id,
+                                                    const ApiCallInfo& call_info,
+                                                    const uint8_t*     parameter_buffer,
+                                                    size_t             buffer_size)
+{
+    format::HandleId                                       command_buffer = format::kNullHandleId;
+    StructPointerDecoder<Decoded_VkCommandBufferBeginInfo> begin_info;
+
+    size_t bytes_read = ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer);
+    begin_info.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+    const VkCommandBufferBeginInfo* value = begin_info.GetPointer();
+    bool one_time_submit = (value == nullptr) || ((value->flags & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) != 0);
+
+    CommandBufferRecording& recording = command_buffer_recordings_[command_buffer];
+
+    if (recording.reusable && !one_time_submit &&
+        IsSameCommand(call_id,
+                      parameter_buffer,
+                      buffer_size,
+                      recording.commands[0].call_id,
+                      recording.commands[0].parameters))
+    {
+        recording.recording   = true;
+        recording.matching    = true;
+        recording.storing     = true;
+        recording.match_count = 1;
+        return true;
+    }
+
+    // Recording the command buffer again invalidates the primary command buffers that execute it.
+    InvalidateRecording(command_buffer, &recording);
+    InvalidateDependentRecordings(command_buffer);
+
+    recording.recording = true;
+    recording.storing   = !one_time_submit;
+
+    StoreCommand(command_buffer, &recording, call_id, call_info, parameter_buffer, buffer_size);
+
+    return false;
+}
+
+bool VulkanDecoderBase::ContinueCommandBufferRecording(format::ApiCallId  call_id,
+                                                       const ApiCallInfo& call_info,
+                                                       const uint8_t*     parameter_buffer,
+                                                       size_t             buffer_size)
+{
+    // The command buffer is the first parameter of each command.
+    format::HandleId command_buffer = format::kNullHandleId;
+    ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer);
+
+    auto entry = command_buffer_recordings_.find(command_buffer);
+    if ((entry == command_buffer_recordings_.end()) || !entry->second.recording)
+    {
+        return false;
+    }
+
+    CommandBufferRecording& recording = entry->second;
+    bool                    end       = (call_id == format::ApiCallId::ApiCall_vkEndCommandBuffer);
+
+    if (recording.matching)
+    {
+        if ((recording.match_count < recording.commands.size()) &&
+            IsSameCommand(call_id,
+                          parameter_buffer,
+                          buffer_size,
+                          recording.commands[recording.match_count].call_id,
+                          recording.commands[recording.match_count].parameters))
+        {
+            ++recording.match_count;
+
+            if (end)
+            {
+                recording.recording = false;
+                recording.matching  = false;
+            }
+
+            return true;
+        }
+
+        // The previous recording has been begun again, so its primary command buffers become invalid.
+        StopMatchingRecording(command_buffer, &recording);
+        InvalidateDependentRecordings(command_buffer);
+    }
+
+    StoreCommand(command_buffer, &recording, call_id, call_info, parameter_buffer, buffer_size);
+
+    if (end)
+    {
+        recording.recording = false;
+        recording.reusable  = recording.storing;
+    }
+
+    return false;
+}
+
+void VulkanDecoderBase::StopMatchingRecording(format::HandleId command_buffer, CommandBufferRecording* recording)
+{
+    assert(recording != nullptr);
+
+    recording->matching = false;
+    recording->reusable = false;
+    recording->commands.resize(recording->match_count);
+
+    redispatching_commands_ = true;
+
+    for (const auto& command : recording->commands)
+    {
+        DecodeFunctionCall(command.call_id, command.call_info, command.parameters.data(), command.parameters.size());
+    }
+
+    redispatching_commands_ = false;
+
+    // Restore the dependencies of the commands, which may have been removed when the previous recording was reused.
+    std::vector<EncodedCommand> commands = std::move(recording->commands);
+    recording->commands.clear();
+
+    for (const auto& command : commands)
+    {
+        StoreCommand(command_buffer,
+                     recording,
+                     command.call_id,
+                     command.call_info,
+                     command.parameters.data(),
+                     command.parameters.size());
+    }
+}
+
+void VulkanDecoderBase::StoreCommand(format::HandleId        command_buffer,
+                                     CommandBufferRecording* recording,
+                                     format::ApiCallId       call_id,
+                                     const ApiCallInfo&      call_info,
+                                     const uint8_t*          parameter_buffer,
+                                     size_t                  buffer_size)
+{
+    assert(recording != nullptr);
+
+    if (!recording->storing)
+    {
+        return;
+    }
+
+    if (call_id == format::ApiCallId::ApiCall_vkCmdBindDescriptorSets)
+    {
+        format::HandleId                      command_buffer_id = format::kNullHandleId;
+        format::HandleId                      layout            = format::kNullHandleId;
+        VkPipelineBindPoint                   bind_point        = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        uint32_t                              first_set         = 0;
+        uint32_t                              set_count         = 0;
+        HandlePointerDecoder<VkDescriptorSet> descriptor_sets;
+
+        size_t bytes_read = ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer_id);
+        bytes_read +=
+            ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bind_point);
+        bytes_read +=
+            ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &layout);
+        bytes_read +=
+            ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &first_set);
+        bytes_read +=
+            ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &set_count);
+        descriptor_sets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        const format::HandleId* set_ids = descriptor_sets.GetPointer();
+        for (size_t i = 0; (set_ids != nullptr) && (i < descriptor_sets.GetLength()); ++i)
+        {
+            recording_dependents_[set_ids[i]].insert(command_buffer);
+        }
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkCmdExecuteCommands)
+    {
+        format::HandleId                      command_buffer_id = format::kNullHandleId;
+        uint32_t                              secondary_count   = 0;
+        HandlePointerDecoder<VkCommandBuffer> secondary_command_buffers;
+
+        size_t bytes_read = ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer_id);
+        bytes_read += ValueDecoder::DecodeUInt32Value(
+            (parameter_buffer + bytes_read), (buffer_size - bytes_read), &secondary_count);
+        secondary_command_buffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        const format::HandleId* secondary_ids = secondary_command_buffers.GetPointer();
+        for (size_t i = 0; (secondary_ids != nullptr) && (i < secondary_command_buffers.GetLength()); ++i)
+        {
+            recording_dependents_[secondary_ids[i]].insert(command_buffer);
+        }
+    }
+
+    EncodedCommand command;
+    command.call_id   = call_id;
+    command.call_info = call_info;
+    command.parameters.assign(parameter_buffer, parameter_buffer + buffer_size);
+
+    recording->commands.emplace_back(std::move(command));
+}
+
+void VulkanDecoderBase::InvalidateDependentRecordings(format::HandleId object_id)
+{
+    auto entry = recording_dependents_.find(object_id);
+    if (entry == recording_dependents_.end())
+    {
+        return;
+    }
+
+    std::unordered_set<format::HandleId> command_buffers = std::move(entry->second);
+    recording_dependents_.erase(entry);
+
+    for (auto command_buffer : command_buffers)
+    {
+        auto recording = command_buffer_recordings_.find(command_buffer);
+        if (recording != command_buffer_recordings_.end())
+        {
+            InvalidateRecording(command_buffer, &recording->second);
+        }
+    }
+}
+
+void VulkanDecoderBase::InvalidateRecording(format::HandleId command_buffer, CommandBufferRecording* recording)
+{
+    assert(recording != nullptr);
+
+    // A recording that is in progress is recorded to the replay command buffer from this point on, and is not reused.
+    if (recording->matching)
+    {
+        StopMatchingRecording(command_buffer, recording);
+    }
+
+    recording->storing  = false;
+    recording->reusable = false;
+    recording->commands.clear();
+}
+
+const uint8_t* VulkanDecoderBase::RetainData(const uint8_t* data, size_t size) const
+{
+    if ((call_recorder_ == nullptr) || (data == nullptr))
+    {
+        return data;
     }
+
+    uint8_t* retained_data = DecodeAllocator::Allocate<uint8_t>(size, false);
+    if (retained_data != nullptr)
+    {
+        memcpy(retained_data, data, size);
+    }
+
+    return retained_data;
+}
+
+void VulkanDecoderBase::DispatchStateBeginMarker(uint64_t frame_number)
+{
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessStateBeginMarker(frame_number);
+    });
+}
+
+void VulkanDecoderBase::DispatchStateEndMarker(uint64_t frame_number)
+{
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessStateEndMarker(frame_number);
+    });
 }
 
 void VulkanDecoderBase::DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message)
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessDisplayMessageCommand(message);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchFillMemoryCommand(
@@ -61,10 +502,11 @@ void VulkanDecoderBase::DispatchFillMemoryCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
-        consumer->ProcessFillMemoryCommand(memory_id, offset, size, data);
-    }
+    const uint8_t* retained_data = RetainData(data, static_cast<size_t>(size));
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessFillMemoryCommand(memory_id, offset, size, retained_data);
+    });
 }
 
 void VulkanDecoderBase::DispatchResizeWindowCommand(format::ThreadId thread_id,
@@ -74,10 +516,9 @@ void VulkanDecoderBase::DispatchResizeWindowCommand(format::ThreadId thread_id,
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessResizeWindowCommand(surface_id, width, height);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchResizeWindowCommand2(
@@ -85,10 +526,9 @@ void VulkanDecoderBase::DispatchResizeWindowCommand2(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessResizeWindowCommand2(surface_id, width, height, pre_transform);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchCreateHardwareBufferCommand(
@@ -105,21 +545,19 @@ void VulkanDecoderBase::DispatchCreateHardwareBufferCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessCreateHardwareBufferCommand(
             memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id)
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessDestroyHardwareBufferCommand(buffer_id);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
@@ -134,17 +572,18 @@ void VulkanDecoderBase::DispatchSetDevicePropertiesCommand(format::ThreadId   th
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    const uint8_t* retained_uuid = RetainData(pipeline_cache_uuid, format::kUuidSize);
+
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessSetDevicePropertiesCommand(physical_device_id,
                                                     api_version,
                                                     driver_version,
                                                     vendor_id,
                                                     device_id,
                                                     device_type,
-                                                    pipeline_cache_uuid,
+                                                    retained_uuid,
                                                     device_name);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchSetDeviceMemoryPropertiesCommand(
@@ -155,10 +594,9 @@ void VulkanDecoderBase::DispatchSetDeviceMemoryPropertiesCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessSetDeviceMemoryPropertiesCommand(physical_device_id, memory_types, memory_heaps);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
@@ -168,10 +606,9 @@ void VulkanDecoderBase::DispatchSetOpaqueAddressCommand(format::ThreadId thread_
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessSetOpaqueAddressCommand(device_id, object_id, address);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchSetRayTracingShaderGroupHandlesCommand(format::ThreadId thread_id,
@@ -182,10 +619,34 @@ void VulkanDecoderBase::DispatchSetRayTracingShaderGroupHandlesCommand(format::T
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
-        consumer->ProcessSetRayTracingShaderGroupHandlesCommand(device_id, pipeline_id, data_size, data);
-    }
+    const uint8_t* retained_data = RetainData(data, data_size);
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessSetRayTracingShaderGroupHandlesCommand(device_id, pipeline_id, data_size, retained_data);
+    });
+}
+
+void VulkanDecoderBase::DispatchSetPipelineCacheDataCommand(format::ThreadId thread_id,
+                                                            format::HandleId device_id,
+                                                            size_t           data_size,
+                                                            const uint8_t*   data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    const uint8_t* retained_data = RetainData(data, data_size);
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessSetPipelineCacheDataCommand(device_id, data_size, retained_data);
+    });
+}
+
+void VulkanDecoderBase::DispatchTimestampCommand(format::ThreadId thread_id, uint64_t timestamp)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessTimestampCommand(timestamp);
+    });
 }
 
 void VulkanDecoderBase::DispatchSetSwapchainImageStateCommand(
@@ -197,10 +658,9 @@ void VulkanDecoderBase::DispatchSetSwapchainImageStateCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessSetSwapchainImageStateCommand(device_id, swapchain_id, last_presented_image, image_state);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchBeginResourceInitCommand(format::ThreadId thread_id,
@@ -210,20 +670,43 @@ void VulkanDecoderBase::DispatchBeginResourceInitCommand(format::ThreadId thread
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessBeginResourceInitCommand(device_id, max_resource_size, max_copy_size);
-    }
+    });
 }
 
 void VulkanDecoderBase::DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id)
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) {
         consumer->ProcessEndResourceInitCommand(device_id);
+    });
+}
+
+uint8_t* VulkanDecoderBase::GetInitBufferDataDestination(format::HandleId device_id,
+                                                         format::HandleId buffer_id,
+                                                         uint64_t         data_size)
+{
+    // The destination can only be shared when the data is passed to a single consumer as soon as it is read.
+    if ((call_recorder_ == nullptr) && (consumers_.size() == 1))
+    {
+        return consumers_[0]->GetInitBufferDataDestination(device_id, buffer_id, data_size);
     }
+
+    return nullptr;
+}
+
+uint8_t* VulkanDecoderBase::GetInitImageDataDestination(format::HandleId device_id,
+                                                        format::HandleId image_id,
+                                                        uint64_t         data_size)
+{
+    if ((call_recorder_ == nullptr) && (consumers_.size() == 1))
+    {
+        return consumers_[0]->GetInitImageDataDestination(device_id, image_id, data_size);
+    }
+
+    return nullptr;
 }
 
 void VulkanDecoderBase::DispatchInitBufferCommand(format::ThreadId thread_id,
@@ -234,10 +717,11 @@ void VulkanDecoderBase::DispatchInitBufferCommand(format::ThreadId thread_id,
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
-        consumer->ProcessInitBufferCommand(device_id, buffer_id, data_size, data);
-    }
+    const uint8_t* retained_data = RetainData(data, static_cast<size_t>(data_size));
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessInitBufferCommand(device_id, buffer_id, data_size, retained_data);
+    });
 }
 
 void VulkanDecoderBase::DispatchInitImageCommand(format::ThreadId             thread_id,
@@ -251,10 +735,41 @@ void VulkanDecoderBase::DispatchInitImageCommand(format::ThreadId             th
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
-    {
-        consumer->ProcessInitImageCommand(device_id, image_id, data_size, aspect, layout, level_sizes, data);
-    }
+    const uint8_t* retained_data = RetainData(data, static_cast<size_t>(data_size));
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessInitImageCommand(device_id, image_id, data_size, aspect, layout, level_sizes, retained_data);
+    });
+}
+
+void VulkanDecoderBase::DispatchDeferredInitBufferCommand(format::ThreadId                thread_id,
+                                                          format::HandleId                device_id,
+                                                          format::HandleId                buffer_id,
+                                                          uint64_t                        data_size,
+                                                          const ResourceInitDataLocation& location)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessDeferredInitBufferCommand(device_id, buffer_id, data_size, location);
+    });
+}
+
+void VulkanDecoderBase::DispatchDeferredInitImageCommand(format::ThreadId                thread_id,
+                                                         format::HandleId                device_id,
+                                                         format::HandleId                image_id,
+                                                         uint64_t                        data_size,
+                                                         uint32_t                        aspect,
+                                                         uint32_t                        layout,
+                                                         const std::vector<uint64_t>&    level_sizes,
+                                                         const ResourceInitDataLocation& location)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    DispatchCall([=](VulkanConsumer* consumer) {
+        consumer->ProcessDeferredInitImageCommand(
+            device_id, image_id, data_size, aspect, layout, level_sizes, location);
+    });
 }
 
 size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplate(const uint8_t* parameter_buffer, size_t buffer_size)
@@ -274,10 +789,9 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplate(const uint8_t
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -302,11 +816,10 @@ size_t VulkanDecoderBase::Decode_vkCmdPushDescriptorSetWithTemplateKHR(const uin
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &set);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdPushDescriptorSetWithTemplateKHR(
             commandBuffer, descriptorUpdateTemplate, layout, set, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -329,10 +842,9 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplateKHR(const uint
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : consumers_)
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -344,20 +856,37 @@ void VulkanDecoderBase::DecodeFunctionCall(format::ApiCallId  call_id,
 {
     GFXRECON_UNREFERENCED_PARAMETER(call_info);
 
+    size_t bytes_read = 0;
+
     switch (call_id)
     {
         case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplate:
-            Decode_vkUpdateDescriptorSetWithTemplate(parameter_buffer, buffer_size);
+            bytes_read = Decode_vkUpdateDescriptorSetWithTemplate(parameter_buffer, buffer_size);
             break;
         case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplateKHR:
-            Decode_vkCmdPushDescriptorSetWithTemplateKHR(parameter_buffer, buffer_size);
+            bytes_read = Decode_vkCmdPushDescriptorSetWithTemplateKHR(parameter_buffer, buffer_size);
             break;
         case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplateKHR:
-            Decode_vkUpdateDescriptorSetWithTemplateKHR(parameter_buffer, buffer_size);
+            bytes_read = Decode_vkUpdateDescriptorSetWithTemplateKHR(parameter_buffer, buffer_size);
             break;
         default:
-            break;
+            return;
     }
+
+    if (validate_call_sizes_ && (bytes_read != buffer_size))
+    {
+        ReportInvalidCallSize(call_id, bytes_read, buffer_size);
+    }
+}
+
+void VulkanDecoderBase::ReportInvalidCallSize(format::ApiCallId call_id, size_t bytes_read, size_t buffer_size)
+{
+    ++invalid_call_count_;
+
+    GFXRECON_LOG_ERROR("Decoding %s read %" PRIuPTR " bytes of %" PRIuPTR " bytes of parameter data",
+                       format::GetApiCallName(call_id),
+                       bytes_read,
+                       buffer_size);
 }
 
 GFXRECON_END_NAMESPACE(decode)
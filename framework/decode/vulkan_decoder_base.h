@@ -24,16 +24,25 @@
 #ifndef GFXRECON_DECODE_VULKAN_DECODER_BASE_H
 #define GFXRECON_DECODE_VULKAN_DECODER_BASE_H
 
+#include "decode/api_call_profiler.h"
 #include "decode/api_decoder.h"
+#include "decode/decode_allocator.h"
+#include "decode/decoded_call.h"
 #include "format/api_call_id.h"
 #include "format/format.h"
 #include "format/platform_types.h"
 #include "generated/generated_vulkan_consumer.h"
+#include "util/date_time.h"
 #include "util/defines.h"
 
 #include "vulkan/vulkan.h"
 
 #include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -42,15 +51,31 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class VulkanDecoderBase : public ApiDecoder
 {
   public:
-    VulkanDecoderBase() {}
+    VulkanDecoderBase() :
+        call_recorder_(nullptr), profiler_(nullptr), profile_call_id_(format::ApiCallId::ApiCall_Unknown),
+        decode_start_time_(0), fast_forward_frame_(0), fast_forward_present_count_(0), skipped_command_count_(0),
+        reuse_command_buffers_(false), redispatching_commands_(false), validate_call_sizes_(false),
+        invalid_call_count_(0), forward_block_indices_(false), block_index_(0), forward_call_ids_(false),
+        decoded_call_id_(format::ApiCallId::ApiCall_Unknown)
+    {}
 
     virtual ~VulkanDecoderBase() override {}
 
-    void AddConsumer(VulkanConsumer* consumer) { consumers_.push_back(consumer); }
+    // API call parameters are decoded once and passed to each consumer, in the order that the consumers were added.
+    // Consumers that modify the decoded parameters, such as VulkanReplayConsumer, which replaces the handle values in
+    // decoded structs with replay handles, should be added last so that the other consumers receive the values that
+    // were read from the file.
+    void AddConsumer(VulkanConsumer* consumer)
+    {
+        if (std::find(consumers_.begin(), consumers_.end(), consumer) == consumers_.end())
+        {
+            consumers_.push_back(consumer);
+        }
+    }
 
     void RemoveConsumer(VulkanConsumer* consumer)
     {
-        consumers_.erase(std::remove(consumers_.begin(), consumers_.end(), consumer));
+        consumers_.erase(std::remove(consumers_.begin(), consumers_.end(), consumer), consumers_.end());
     }
 
     virtual bool SupportsApiCall(format::ApiCallId call_id) override
@@ -59,6 +84,43 @@ class VulkanDecoderBase : public ApiDecoder
                 (call_id < format::ApiCallId::ApiCall_VulkanLast));
     }
 
+    // Recorded calls are passed to the consumers that are registered with the decoder when the calls are executed.
+    virtual bool SetCallRecorder(DecodedCallRecorder* recorder) override
+    {
+        call_recorder_ = recorder;
+        return true;
+    }
+
+    // Adds the time spent decoding each API call, and the time spent by the consumers processing it, to profiler.
+    void SetProfiler(ApiCallProfiler* profiler) { profiler_ = profiler; }
+
+    // Drops the draw, dispatch, and trace rays commands that are recorded before the target frame, which is numbered by
+    // present starting from 1, so that replay reaches the frame without rendering the frames that precede it.  All
+    // other calls are decoded, so that resources and descriptors have the expected state when the frame begins.
+    void SetFastForwardFrame(uint32_t frame_number) { fast_forward_frame_ = (frame_number > 1) ? frame_number : 0; }
+
+    // Drops command buffer recordings that repeat the encoded commands of the command buffer's previous recording, so
+    // that the replay command buffer keeps the commands that it was already recorded with.  Recordings that began with
+    // VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, or that reference descriptor sets or secondary command buffers that
+    // have since been updated, are always recorded.
+    void SetReuseCommandBuffers(bool reuse) { reuse_command_buffers_ = reuse; }
+
+    // Checks that the decoding of each API call reads all of its parameter data, reporting the calls with parameter
+    // data that is truncated or has trailing bytes.
+    void SetValidateCallSizes(bool validate) { validate_call_sizes_ = validate; }
+
+    uint64_t GetInvalidCallCount() const { return invalid_call_count_; }
+
+    // Passes the index of the block that contains each call to the consumers, with SetCurrentBlockIndex(), before the
+    // call is processed.  Command buffer recording calls, which a call recorder may execute concurrently, are excluded.
+    void SetForwardBlockIndices(bool forward) { forward_block_indices_ = forward; }
+
+    // Passes the ID of each call to the consumers, with SetCurrentApiCallId(), before the call is processed.  Command
+    // buffer recording calls are excluded, as with SetForwardBlockIndices().
+    void SetForwardCallIds(bool forward) { forward_call_ids_ = forward; }
+
+    virtual void SetCurrentBlockIndex(uint64_t block_index) override { block_index_ = block_index; }
+
     virtual void DecodeFunctionCall(format::ApiCallId  call_id,
                                     const ApiCallInfo& call_options,
                                     const uint8_t*     parameter_buffer,
@@ -125,6 +187,13 @@ class VulkanDecoderBase : public ApiDecoder
                                                                 size_t           data_size,
                                                                 const uint8_t*   data) override;
 
+    virtual void DispatchSetPipelineCacheDataCommand(format::ThreadId thread_id,
+                                                     format::HandleId device_id,
+                                                     size_t           data_size,
+                                                     const uint8_t*   data) override;
+
+    virtual void DispatchTimestampCommand(format::ThreadId thread_id, uint64_t timestamp) override;
+
     virtual void
     DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
                                           format::HandleId                                    device_id,
@@ -139,6 +208,14 @@ class VulkanDecoderBase : public ApiDecoder
 
     virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override;
 
+    virtual uint8_t* GetInitBufferDataDestination(format::HandleId device_id,
+                                                  format::HandleId buffer_id,
+                                                  uint64_t         data_size) override;
+
+    virtual uint8_t* GetInitImageDataDestination(format::HandleId device_id,
+                                                 format::HandleId image_id,
+                                                 uint64_t         data_size) override;
+
     virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
                                            format::HandleId device_id,
                                            format::HandleId buffer_id,
@@ -154,9 +231,237 @@ class VulkanDecoderBase : public ApiDecoder
                                           const std::vector<uint64_t>& level_sizes,
                                           const uint8_t*               data) override;
 
+    virtual void DispatchDeferredInitBufferCommand(format::ThreadId                thread_id,
+                                                   format::HandleId                device_id,
+                                                   format::HandleId                buffer_id,
+                                                   uint64_t                        data_size,
+                                                   const ResourceInitDataLocation& location) override;
+
+    virtual void DispatchDeferredInitImageCommand(format::ThreadId                thread_id,
+                                                  format::HandleId                device_id,
+                                                  format::HandleId                image_id,
+                                                  uint64_t                        data_size,
+                                                  uint32_t                        aspect,
+                                                  uint32_t                        layout,
+                                                  const std::vector<uint64_t>&    level_sizes,
+                                                  const ResourceInitDataLocation& location) override;
+
   protected:
     const std::vector<VulkanConsumer*>& GetConsumers() const { return consumers_; }
 
+    bool IsFastForwarding() const { return (fast_forward_frame_ != 0); }
+
+    // Returns true if the call is a rendering command that is dropped while fast forwarding, and ends fast forwarding
+    // when the target frame is reached.
+    bool SkipFastForwardCall(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    bool IsReusingCommandBuffers() const { return reuse_command_buffers_; }
+
+    bool IsValidatingCallSizes() const { return validate_call_sizes_; }
+
+    void ReportInvalidCallSize(format::ApiCallId call_id, size_t bytes_read, size_t buffer_size);
+
+    // Returns true if the call belongs to a command buffer recording that matches the previous recording of the command
+    // buffer so far.  When a recording stops matching, the commands that were dropped are decoded before the call.
+    bool SkipReusedCommandBufferCall(format::ApiCallId  call_id,
+                                     const ApiCallInfo& call_info,
+                                     const uint8_t*     parameter_buffer,
+                                     size_t             buffer_size);
+
+    // Starts measuring the decode time of an API call, which ends when the call is dispatched.  The call's ID is kept
+    // to forward to the consumers.
+    void BeginCallProfile(format::ApiCallId call_id)
+    {
+        decoded_call_id_ = call_id;
+
+        if (profiler_ != nullptr)
+        {
+            profile_call_id_   = call_id;
+            decode_start_time_ = util::datetime::GetTimestamp();
+        }
+    }
+
+    // Invokes call for each consumer, or records the call to be invoked for each consumer when it is executed if a call
+    // recorder has been set.  A recorded call keeps its own copy of call, so call must capture the decoded parameters
+    // by value.
+    template <typename Call>
+    void DispatchCall(Call&& call)
+    {
+        format::ApiCallId call_id         = EndDecodeProfile();
+        format::ApiCallId decoded_call_id = EndDecodedCall();
+
+        if (call_recorder_ == nullptr)
+        {
+            ProcessCall(call, call_id, block_index_, decoded_call_id);
+        }
+        else
+        {
+            call_recorder_->Record(DecodeAllocator::Construct<ConsumerCall<std::decay_t<Call>>>(
+                this, call_id, block_index_, decoded_call_id, std::forward<Call>(call)));
+        }
+    }
+
+    // Dispatches a call that only records commands to a command buffer, which a call recorder may execute concurrently
+    // with the command buffer calls of other captured threads.
+    template <typename Call>
+    void DispatchCommandBufferCall(Call&& call)
+    {
+        format::ApiCallId call_id         = EndDecodeProfile();
+        format::ApiCallId decoded_call_id = EndDecodedCall();
+
+        if (call_recorder_ == nullptr)
+        {
+            ProcessCall(call, call_id, kNoBlockIndex, decoded_call_id);
+        }
+        else
+        {
+            call_recorder_->RecordCommandBufferCall(DecodeAllocator::Construct<ConsumerCall<std::decay_t<Call>>>(
+                this, call_id, kNoBlockIndex, decoded_call_id, std::forward<Call>(call)));
+        }
+    }
+
+    // Returns data when calls are not being recorded.  Otherwise, returns a copy of data that remains valid until the
+    // recorded call is executed, for data that is owned by the caller of a dispatch function.
+    const uint8_t* RetainData(const uint8_t* data, size_t size) const;
+
+  private:
+    struct EncodedCommand
+    {
+        format::ApiCallId    call_id{ format::ApiCallId::ApiCall_Unknown };
+        ApiCallInfo          call_info;
+        std::vector<uint8_t> parameters;
+    };
+
+    struct CommandBufferRecording
+    {
+        std::vector<EncodedCommand> commands; // Commands of the last recording, from begin to end.
+        size_t                      match_count{ 0 };
+        bool                        recording{ false };
+        bool                        matching{ false }; // Set while the current recording matches the commands.
+        bool                        storing{ false };  // Set while the current recording can be reused.
+        bool                        reusable{ false }; // Set when the replay command buffer holds the commands.
+    };
+
+  private:
+    // Block index of the calls that do not forward their block index to the consumers.
+    static constexpr uint64_t kNoBlockIndex = std::numeric_limits<uint64_t>::max();
+
+    template <typename Call>
+    class ConsumerCall : public DecodedCall
+    {
+      public:
+        template <typename T>
+        ConsumerCall(const VulkanDecoderBase* decoder,
+                     format::ApiCallId        call_id,
+                     uint64_t                 block_index,
+                     format::ApiCallId        decoded_call_id,
+                     T&&                      call) :
+            decoder_(decoder), call_id_(call_id), block_index_(block_index), decoded_call_id_(decoded_call_id),
+            call_(std::forward<T>(call))
+        {}
+
+        virtual void Execute() override { decoder_->ProcessCall(call_, call_id_, block_index_, decoded_call_id_); }
+
+      private:
+        const VulkanDecoderBase* decoder_;
+        format::ApiCallId        call_id_;
+        uint64_t                 block_index_;
+        format::ApiCallId        decoded_call_id_;
+        Call                     call_;
+    };
+
+  private:
+    // Adds the decode time of the API call that is being dispatched to the profiler, returning the call's ID, or
+    // ApiCall_Unknown if the call is not profiled.
+    format::ApiCallId EndDecodeProfile()
+    {
+        format::ApiCallId call_id = profile_call_id_;
+
+        if (call_id != format::ApiCallId::ApiCall_Unknown)
+        {
+            profiler_->AddDecodeTime(call_id, util::datetime::GetTimestamp() - decode_start_time_);
+            profile_call_id_ = format::ApiCallId::ApiCall_Unknown;
+        }
+
+        return call_id;
+    }
+
+    // Returns the ID of the API call that is being dispatched, or ApiCall_Unknown for a meta command, which is
+    // dispatched without decoding an API call.
+    format::ApiCallId EndDecodedCall()
+    {
+        format::ApiCallId call_id = decoded_call_id_;
+        decoded_call_id_          = format::ApiCallId::ApiCall_Unknown;
+        return call_id;
+    }
+
+    template <typename Call>
+    void
+    ProcessCall(Call& call, format::ApiCallId call_id, uint64_t block_index, format::ApiCallId decoded_call_id) const
+    {
+        if (forward_block_indices_ && (block_index != kNoBlockIndex))
+        {
+            for (auto consumer : consumers_)
+            {
+                consumer->SetCurrentBlockIndex(block_index);
+            }
+        }
+
+        if (forward_call_ids_ && (block_index != kNoBlockIndex))
+        {
+            for (auto consumer : consumers_)
+            {
+                consumer->SetCurrentApiCallId(decoded_call_id);
+            }
+        }
+
+        if (call_id == format::ApiCallId::ApiCall_Unknown)
+        {
+            for (auto consumer : consumers_)
+            {
+                call(consumer);
+            }
+        }
+        else
+        {
+            int64_t start_time = util::datetime::GetTimestamp();
+
+            for (auto consumer : consumers_)
+            {
+                call(consumer);
+            }
+
+            profiler_->AddProcessTime(call_id, util::datetime::GetTimestamp() - start_time);
+        }
+    }
+
+    void EndFastForward();
+
+    bool BeginCommandBufferRecording(format::ApiCallId  call_id,
+                                     const ApiCallInfo& call_info,
+                                     const uint8_t*     parameter_buffer,
+                                     size_t             buffer_size);
+
+    bool ContinueCommandBufferRecording(format::ApiCallId  call_id,
+                                        const ApiCallInfo& call_info,
+                                        const uint8_t*     parameter_buffer,
+                                        size_t             buffer_size);
+
+    // Decodes the commands of the previous recording that the current recording matched, which were dropped.
+    void StopMatchingRecording(format::HandleId command_buffer, CommandBufferRecording* recording);
+
+    void StoreCommand(format::HandleId        command_buffer,
+                      CommandBufferRecording* recording,
+                      format::ApiCallId       call_id,
+                      const ApiCallInfo&      call_info,
+                      const uint8_t*          parameter_buffer,
+                      size_t                  buffer_size);
+
+    // Prevents the reuse of recordings that bind a descriptor set or execute a command buffer that has been updated.
+    void InvalidateDependentRecordings(format::HandleId object_id);
+
+    void InvalidateRecording(format::HandleId command_buffer, CommandBufferRecording* recording);
+
   private:
     size_t Decode_vkUpdateDescriptorSetWithTemplate(const uint8_t* parameter_buffer, size_t buffer_size);
 
@@ -166,6 +471,27 @@ class VulkanDecoderBase : public ApiDecoder
 
   private:
     std::vector<VulkanConsumer*> consumers_;
+    DecodedCallRecorder*         call_recorder_;
+    ApiCallProfiler*             profiler_;
+    format::ApiCallId            profile_call_id_;
+    int64_t                      decode_start_time_;
+    uint32_t                     fast_forward_frame_;
+    uint32_t                     fast_forward_present_count_;
+    uint64_t                     skipped_command_count_;
+
+    // Command buffers with recorded commands that were dropped by fast forwarding, which have not been begun again.
+    std::unordered_set<format::HandleId> skipped_command_buffers_;
+
+    bool                                                                       reuse_command_buffers_;
+    bool                                                                       redispatching_commands_;
+    std::unordered_map<format::HandleId, CommandBufferRecording>               command_buffer_recordings_;
+    std::unordered_map<format::HandleId, std::unordered_set<format::HandleId>> recording_dependents_;
+    bool                                                                       validate_call_sizes_;
+    uint64_t                                                                   invalid_call_count_;
+    bool                                                                       forward_block_indices_;
+    uint64_t                                                                   block_index_;
+    bool                                                                       forward_call_ids_;
+    format::ApiCallId                                                          decoded_call_id_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
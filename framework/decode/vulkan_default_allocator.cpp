@@ -23,6 +23,7 @@
 #include "decode/vulkan_default_allocator.h"
 
 #include "decode/custom_vulkan_struct_decoders.h"
+#include "decode/vulkan_enum_util.h"
 #include "decode/vulkan_object_info.h"
 #include "generated/generated_vulkan_struct_decoders.h"
 #include "util/platform.h"
@@ -32,14 +33,18 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-VulkanDefaultAllocator::VulkanDefaultAllocator() : device_(VK_NULL_HANDLE), memory_properties_{} {}
+VulkanDefaultAllocator::VulkanDefaultAllocator() :
+    device_(VK_NULL_HANDLE), memory_properties_{}, persistent_mapping_(false), heap_usage_{}
+{}
 
 VulkanDefaultAllocator::VulkanDefaultAllocator(const std::string& custom_error_string) :
-    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(custom_error_string)
+    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(custom_error_string),
+    persistent_mapping_(false), heap_usage_{}
 {}
 
 VulkanDefaultAllocator::VulkanDefaultAllocator(std::string&& custom_error_string) :
-    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(std::move(custom_error_string))
+    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(std::move(custom_error_string)),
+    persistent_mapping_(false), heap_usage_{}
 {}
 
 VkResult VulkanDefaultAllocator::Initialize(uint32_t                                api_version,
@@ -173,6 +178,10 @@ void VulkanDefaultAllocator::FreeMemory(VkDeviceMemory               memory,
     if (allocator_data != 0)
     {
         auto memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
+
+        heap_usage_[memory_properties_.memoryTypes[memory_alloc_info->memory_type_index].heapIndex] -=
+            memory_alloc_info->allocation_size;
+
         delete memory_alloc_info;
     }
     else if (memory != VK_NULL_HANDLE)
@@ -355,6 +364,16 @@ VkResult VulkanDefaultAllocator::MapMemory(VkDeviceMemory   memory,
 
     if (data != nullptr)
     {
+        auto memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
+
+        if ((memory_alloc_info != nullptr) && (memory_alloc_info->persistent_pointer != nullptr))
+        {
+            // The memory was mapped when it was allocated, so only the offset of the captured mapping is applied.
+            memory_alloc_info->mapped_pointer = memory_alloc_info->persistent_pointer + offset;
+            (*data)                           = memory_alloc_info->mapped_pointer;
+            return VK_SUCCESS;
+        }
+
         result = functions_.map_memory(device_, memory, offset, size, flags, data);
 
         if (result >= 0)
@@ -380,6 +399,12 @@ void VulkanDefaultAllocator::UnmapMemory(VkDeviceMemory memory, MemoryData alloc
     {
         auto memory_alloc_info            = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
         memory_alloc_info->mapped_pointer = nullptr;
+
+        if (memory_alloc_info->persistent_pointer != nullptr)
+        {
+            // Persistently mapped memory stays mapped until it is freed.
+            return;
+        }
     }
 
     functions_.unmap_memory(device_, memory);
@@ -578,6 +603,13 @@ void VulkanDefaultAllocator::UnmapResourceMemoryDirect(ResourceData allocator_da
     }
 }
 
+void VulkanDefaultAllocator::GetHeapUsage(std::vector<VkDeviceSize>* heap_usage)
+{
+    assert(heap_usage != nullptr);
+
+    heap_usage->assign(heap_usage_, heap_usage_ + memory_properties_.memoryHeapCount);
+}
+
 VkResult VulkanDefaultAllocator::Allocate(const VkMemoryAllocateInfo*  allocate_info,
                                           const VkAllocationCallbacks* allocation_callbacks,
                                           format::HandleId             capture_id,
@@ -595,9 +627,36 @@ VkResult VulkanDefaultAllocator::Allocate(const VkMemoryAllocateInfo*  allocate_
         auto memory_alloc_info               = new MemoryAllocInfo;
         memory_alloc_info->capture_id        = capture_id;
         memory_alloc_info->memory_type_index = allocate_info->memoryTypeIndex;
+        memory_alloc_info->allocation_size   = allocate_info->allocationSize;
         memory_alloc_info->property_flags =
             memory_properties_.memoryTypes[allocate_info->memoryTypeIndex].propertyFlags;
         (*allocator_data) = reinterpret_cast<MemoryData>(memory_alloc_info);
+
+        heap_usage_[memory_properties_.memoryTypes[allocate_info->memoryTypeIndex].heapIndex] +=
+            allocate_info->allocationSize;
+
+        // Allocations made directly by replay, which have no capture ID, are mapped on demand by
+        // MapResourceMemoryDirect.
+        if (persistent_mapping_ && (capture_id != format::kNullHandleId) &&
+            ((memory_alloc_info->property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) ==
+             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+        {
+            void*    persistent_pointer = nullptr;
+            VkResult map_result = functions_.map_memory(device_, *memory, 0, VK_WHOLE_SIZE, 0, &persistent_pointer);
+
+            if (map_result == VK_SUCCESS)
+            {
+                memory_alloc_info->persistent_pointer = static_cast<uint8_t*>(persistent_pointer);
+            }
+            else
+            {
+                // Fall back to mapping the memory when the capture file maps it.
+                GFXRECON_LOG_DEBUG("VulkanDefaultAllocator failed to persistently map VkDeviceMemory object (ID = "
+                                   "%" PRIu64 "): vkMapMemory returned %s",
+                                   capture_id,
+                                   enumutil::GetResultValueString(map_result));
+            }
+        }
     }
 
     return result;
@@ -251,6 +251,14 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
 
     virtual bool SupportsOpaqueDeviceAddresses() override { return true; }
 
+    virtual void GetHeapUsage(std::vector<VkDeviceSize>* heap_usage) override;
+
+    virtual size_t GetHostCopySize() override { return 0; }
+
+    // When enabled, host visible memory is mapped once when it is allocated and remains mapped until it is freed, so
+    // that vkMapMemory and vkUnmapMemory calls from the capture file do not call the driver.
+    void SetPersistentMapping(bool enable) { persistent_mapping_ = enable; }
+
   protected:
     struct ResourceAllocInfo
     {
@@ -263,8 +271,10 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
     {
         format::HandleId      capture_id{ format::kNullHandleId };
         uint32_t              memory_type_index{ std::numeric_limits<uint32_t>::max() };
+        VkDeviceSize          allocation_size{ 0 };
         VkMemoryPropertyFlags property_flags{ 0 };
         uint8_t*              mapped_pointer{ nullptr };
+        uint8_t*              persistent_pointer{ nullptr }; // Start of the allocation when persistently mapped.
     };
 
   protected:
@@ -294,6 +304,8 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
     Functions                        functions_;
     VkPhysicalDeviceMemoryProperties memory_properties_;
     std::string                      custom_error_string_;
+    bool                             persistent_mapping_;
+    VkDeviceSize                     heap_usage_[VK_MAX_MEMORY_HEAPS];
 };
 
 GFXRECON_END_NAMESPACE(decode)
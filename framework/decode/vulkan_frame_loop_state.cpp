@@ -0,0 +1,363 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_frame_loop_state.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanFrameLoopState::VulkanFrameLoopState(VkDevice                                device,
+                                           const encode::DeviceTable*              device_table,
+                                           const VkPhysicalDeviceMemoryProperties& memory_properties,
+                                           VulkanResourceAllocator*                allocator,
+                                           uint32_t                                queue_family_index) :
+    device_(device),
+    device_table_(device_table), memory_properties_(memory_properties), allocator_(allocator),
+    queue_family_index_(queue_family_index), queue_(VK_NULL_HANDLE), command_pool_(VK_NULL_HANDLE),
+    command_buffer_(VK_NULL_HANDLE), backup_size_(0)
+{
+    assert((device_ != VK_NULL_HANDLE) && (device_table_ != nullptr) && (allocator_ != nullptr));
+
+    device_table_->GetDeviceQueue(device_, queue_family_index_, 0, &queue_);
+}
+
+VulkanFrameLoopState::~VulkanFrameLoopState()
+{
+    for (auto& entry : backups_)
+    {
+        DestroyBackup(&entry.second);
+    }
+
+    if (command_pool_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyCommandPool(device_, command_pool_, nullptr);
+    }
+}
+
+bool VulkanFrameLoopState::AddMemory(VkDeviceMemory                      memory,
+                                     VulkanResourceAllocator::MemoryData memory_data,
+                                     VkDeviceSize                        allocation_size,
+                                     uint32_t                            memory_type_index)
+{
+    assert(backups_.find(memory) == backups_.end());
+
+    if ((allocation_size == 0) || (memory_type_index >= memory_properties_.memoryTypeCount) ||
+        ((memory_properties_.memoryTypes[memory_type_index].propertyFlags &
+          (VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT | VK_MEMORY_PROPERTY_PROTECTED_BIT)) != 0))
+    {
+        return false;
+    }
+
+    MemoryBackup backup;
+    backup.size = allocation_size;
+
+    VkResult result = CreateBuffer(backup.size, &backup.alias_buffer, &backup.alias_buffer_data);
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements requirements;
+        device_table_->GetBufferMemoryRequirements(device_, backup.alias_buffer, &requirements);
+
+        if ((requirements.size > allocation_size) && (requirements.size < (allocation_size * 2)))
+        {
+            // The buffer size was padded past the end of the allocation, so leave the padded tail of the allocation
+            // out of the backup.
+            allocator_->DestroyBufferDirect(backup.alias_buffer, nullptr, backup.alias_buffer_data);
+
+            backup.size         = allocation_size - (requirements.size - allocation_size);
+            backup.alias_buffer = VK_NULL_HANDLE;
+
+            result = CreateBuffer(backup.size, &backup.alias_buffer, &backup.alias_buffer_data);
+
+            if (result == VK_SUCCESS)
+            {
+                device_table_->GetBufferMemoryRequirements(device_, backup.alias_buffer, &requirements);
+            }
+        }
+
+        if ((result == VK_SUCCESS) &&
+            (((requirements.memoryTypeBits & (1 << memory_type_index)) == 0) || (requirements.size > allocation_size)))
+        {
+            result = VK_ERROR_FEATURE_NOT_PRESENT;
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryPropertyFlags flags = 0;
+
+        result = allocator_->BindBufferMemoryDirect(
+            backup.alias_buffer, memory, 0, backup.alias_buffer_data, memory_data, &flags);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = CreateBuffer(backup.size, &backup.backup_buffer, &backup.backup_buffer_data);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements requirements;
+        device_table_->GetBufferMemoryRequirements(device_, backup.backup_buffer, &requirements);
+
+        uint32_t backup_type_index =
+            GetMemoryTypeIndex(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        if (backup_type_index == std::numeric_limits<uint32_t>::max())
+        {
+            backup_type_index = GetMemoryTypeIndex(requirements.memoryTypeBits, 0);
+        }
+
+        assert(backup_type_index != std::numeric_limits<uint32_t>::max());
+
+        VkMemoryAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        allocate_info.pNext                = nullptr;
+        allocate_info.allocationSize       = requirements.size;
+        allocate_info.memoryTypeIndex      = backup_type_index;
+
+        result = allocator_->AllocateMemoryDirect(
+            &allocate_info, nullptr, &backup.backup_memory, &backup.backup_memory_data);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryPropertyFlags flags = 0;
+
+        result = allocator_->BindBufferMemoryDirect(backup.backup_buffer,
+                                                    backup.backup_memory,
+                                                    0,
+                                                    backup.backup_buffer_data,
+                                                    backup.backup_memory_data,
+                                                    &flags);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        DestroyBackup(&backup);
+        return false;
+    }
+
+    backup_size_ += backup.size;
+    backups_.emplace(memory, backup);
+
+    return true;
+}
+
+VkResult VulkanFrameLoopState::CopyToBackups()
+{
+    return CopyBackups(false, nullptr);
+}
+
+VkResult VulkanFrameLoopState::CopyFromBackups(const std::unordered_set<VkDeviceMemory>& live_memory)
+{
+    return CopyBackups(true, &live_memory);
+}
+
+VkResult VulkanFrameLoopState::CreateBuffer(VkDeviceSize                           size,
+                                            VkBuffer*                              buffer,
+                                            VulkanResourceAllocator::ResourceData* buffer_data)
+{
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = size;
+    create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
+
+    return allocator_->CreateBufferDirect(&create_info, nullptr, buffer, buffer_data);
+}
+
+uint32_t VulkanFrameLoopState::GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags) const
+{
+    uint32_t memory_type_index = std::numeric_limits<uint32_t>::max();
+
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i)
+    {
+        if ((type_bits & (1 << i)) &&
+            ((memory_properties_.memoryTypes[i].propertyFlags & property_flags) == property_flags))
+        {
+            memory_type_index = i;
+            break;
+        }
+    }
+
+    return memory_type_index;
+}
+
+void VulkanFrameLoopState::DestroyBackup(MemoryBackup* backup)
+{
+    assert(backup != nullptr);
+
+    if (backup->alias_buffer != VK_NULL_HANDLE)
+    {
+        allocator_->DestroyBufferDirect(backup->alias_buffer, nullptr, backup->alias_buffer_data);
+        backup->alias_buffer = VK_NULL_HANDLE;
+    }
+
+    if (backup->backup_buffer != VK_NULL_HANDLE)
+    {
+        allocator_->DestroyBufferDirect(backup->backup_buffer, nullptr, backup->backup_buffer_data);
+        backup->backup_buffer = VK_NULL_HANDLE;
+    }
+
+    if (backup->backup_memory != VK_NULL_HANDLE)
+    {
+        allocator_->FreeMemoryDirect(backup->backup_memory, nullptr, backup->backup_memory_data);
+        backup->backup_memory = VK_NULL_HANDLE;
+    }
+}
+
+VkResult VulkanFrameLoopState::CopyBackups(bool restore, const std::unordered_set<VkDeviceMemory>* live_memory)
+{
+    VkResult result = VK_SUCCESS;
+
+    if (command_pool_ == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        pool_create_info.pNext                   = nullptr;
+        pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_create_info.queueFamilyIndex        = queue_family_index_;
+
+        result = device_table_->CreateCommandPool(device_, &pool_create_info, nullptr, &command_pool_);
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.pNext                       = nullptr;
+            allocate_info.commandPool                 = command_pool_;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = 1;
+
+            result = device_table_->AllocateCommandBuffers(device_, &allocate_info, &command_buffer_);
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.pNext                    = nullptr;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        begin_info.pInheritanceInfo         = nullptr;
+
+        result = device_table_->BeginCommandBuffer(command_buffer_, &begin_info);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        // Order the copies with the replayed work that wrote the memory, and the replayed work that follows with the
+        // copies.
+        VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        device_table_->CmdPipelineBarrier(command_buffer_,
+                                          VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          1,
+                                          &barrier,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr);
+
+        auto entry = backups_.begin();
+        while (entry != backups_.end())
+        {
+            auto& backup = entry->second;
+
+            if ((live_memory != nullptr) && (live_memory->find(entry->first) == live_memory->end()))
+            {
+                // The memory was freed by the looped frames, and a new allocation with the same handle would not be
+                // bound to the alias buffer.
+                GFXRECON_LOG_WARNING_ONCE("Memory that was freed by the looped frame range will not be restored");
+
+                backup_size_ -= backup.size;
+                DestroyBackup(&backup);
+                entry = backups_.erase(entry);
+                continue;
+            }
+
+            VkBufferCopy region = { 0, 0, backup.size };
+
+            if (restore)
+            {
+                device_table_->CmdCopyBuffer(command_buffer_, backup.backup_buffer, backup.alias_buffer, 1, &region);
+            }
+            else
+            {
+                device_table_->CmdCopyBuffer(command_buffer_, backup.alias_buffer, backup.backup_buffer, 1, &region);
+            }
+
+            ++entry;
+        }
+
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+        device_table_->CmdPipelineBarrier(command_buffer_,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                          0,
+                                          1,
+                                          &barrier,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr);
+
+        result = device_table_->EndCommandBuffer(command_buffer_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = 0;
+        submit_info.pWaitSemaphores      = nullptr;
+        submit_info.pWaitDstStageMask    = nullptr;
+        submit_info.commandBufferCount   = 1;
+        submit_info.pCommandBuffers      = &command_buffer_;
+        submit_info.signalSemaphoreCount = 0;
+        submit_info.pSignalSemaphores    = nullptr;
+
+        result = device_table_->QueueSubmit(queue_, 1, &submit_info, VK_NULL_HANDLE);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table_->QueueWaitIdle(queue_);
+    }
+
+    return result;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
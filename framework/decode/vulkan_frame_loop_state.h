@@ -0,0 +1,106 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_FRAME_LOOP_STATE_H
+#define GFXRECON_DECODE_VULKAN_FRAME_LOOP_STATE_H
+
+#include "decode/vulkan_resource_allocator.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Saves the contents of a device's memory allocations before the first replay of a looped frame range, and restores
+// them before each repeat of the range.  The memory is accessed through buffers that alias each allocation, so the
+// contents of buffers and images bound to the memory are copied together, without tracking image layouts.
+class VulkanFrameLoopState
+{
+  public:
+    VulkanFrameLoopState(VkDevice                                device,
+                         const encode::DeviceTable*              device_table,
+                         const VkPhysicalDeviceMemoryProperties& memory_properties,
+                         VulkanResourceAllocator*                allocator,
+                         uint32_t                                queue_family_index);
+
+    ~VulkanFrameLoopState();
+
+    // Creates a backup of the memory allocation, which is copied by the next call to CopyToBackups().  Returns false
+    // if the memory cannot be aliased by a buffer.
+    bool AddMemory(VkDeviceMemory                      memory,
+                   VulkanResourceAllocator::MemoryData memory_data,
+                   VkDeviceSize                        allocation_size,
+                   uint32_t                            memory_type_index);
+
+    VkResult CopyToBackups();
+
+    // Restores the backups of the allocations in live_memory.  Backups of allocations that have been freed are
+    // destroyed.
+    VkResult CopyFromBackups(const std::unordered_set<VkDeviceMemory>& live_memory);
+
+    size_t GetMemoryCount() const { return backups_.size(); }
+
+    VkDeviceSize GetBackupSize() const { return backup_size_; }
+
+  private:
+    struct MemoryBackup
+    {
+        VkDeviceSize                          size{ 0 };
+        VkBuffer                              alias_buffer{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::ResourceData alias_buffer_data{ 0 };
+        VkBuffer                              backup_buffer{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::ResourceData backup_buffer_data{ 0 };
+        VkDeviceMemory                        backup_memory{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::MemoryData   backup_memory_data{ 0 };
+    };
+
+  private:
+    VkResult CreateBuffer(VkDeviceSize size, VkBuffer* buffer, VulkanResourceAllocator::ResourceData* buffer_data);
+
+    uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags) const;
+
+    void DestroyBackup(MemoryBackup* backup);
+
+    VkResult CopyBackups(bool restore, const std::unordered_set<VkDeviceMemory>* live_memory);
+
+  private:
+    VkDevice                                         device_;
+    const encode::DeviceTable*                       device_table_;
+    VkPhysicalDeviceMemoryProperties                 memory_properties_;
+    VulkanResourceAllocator*                         allocator_;
+    uint32_t                                         queue_family_index_;
+    VkQueue                                          queue_;
+    VkCommandPool                                    command_pool_;
+    VkCommandBuffer                                  command_buffer_;
+    std::unordered_map<VkDeviceMemory, MemoryBackup> backups_;
+    VkDeviceSize                                     backup_size_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_FRAME_LOOP_STATE_H
@@ -27,6 +27,7 @@
 #include "format/format.h"
 #include "generated/generated_vulkan_struct_decoders.h"
 #include "util/defines.h"
+#include "util/instrumentation.h"
 #include "util/logging.h"
 
 #include "vulkan/vulkan.h"
@@ -71,6 +72,8 @@ static typename T::HandleType* MapHandleArray(HandlePointerDecoder<typename T::H
                                               const VulkanObjectInfoTable&                  object_info_table,
                                               const T* (VulkanObjectInfoTable::*GetInfoFunc)(format::HandleId) const)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert(handles_pointer != nullptr);
 
     typename T::HandleType* handles = nullptr;
@@ -84,18 +87,23 @@ static typename T::HandleType* MapHandleArray(HandlePointerDecoder<typename T::H
 
         handles = handles_pointer->GetHandlePointer();
 
+        // Gather the handles without branching on each lookup result, then report the IDs that were not found, which
+        // is only needed when a lookup has failed.  Null IDs are mapped to null handles without a lookup.
+        bool missing = false;
+
         for (size_t i = 0; i < len; ++i)
         {
-            if (ids[i] != format::kNullHandleId)
+            const T* info = (ids[i] != format::kNullHandleId) ? (object_info_table.*GetInfoFunc)(ids[i]) : nullptr;
+            handles[i]    = (info != nullptr) ? info->handle : VK_NULL_HANDLE;
+            missing |= ((info == nullptr) && (ids[i] != format::kNullHandleId));
+        }
+
+        if (missing)
+        {
+            for (size_t i = 0; i < len; ++i)
             {
-                const T* info = (object_info_table.*GetInfoFunc)(ids[i]);
-                if (info != nullptr)
-                {
-                    handles[i] = info->handle;
-                }
-                else
+                if ((ids[i] != format::kNullHandleId) && ((object_info_table.*GetInfoFunc)(ids[i]) == nullptr))
                 {
-                    handles[i] = VK_NULL_HANDLE;
                     GFXRECON_LOG_WARNING("Failed to map handle for object id %" PRIu64, ids[i]);
                 }
             }
@@ -143,7 +151,7 @@ static void AddHandleArray(format::HandleId              parent_id,
                            size_t                        ids_len,
                            const typename T::HandleType* handles,
                            size_t                        handles_len,
-                           std::vector<T>&&              initial_infos,
+                           T*                            initial_infos,
                            VulkanObjectInfoTable*        object_info_table,
                            void (VulkanObjectInfoTable::*AddFunc)(T&&))
 {
@@ -153,15 +161,15 @@ static void AddHandleArray(format::HandleId              parent_id,
     {
         size_t len = std::min(ids_len, handles_len);
 
-        assert(len <= initial_infos.size());
+        assert(initial_infos != nullptr);
 
         for (size_t i = 0; i < len; ++i)
         {
-            auto info_iter        = std::next(initial_infos.begin(), i);
-            info_iter->handle     = handles[i];
-            info_iter->capture_id = ids[i];
-            info_iter->parent_id  = parent_id;
-            (object_info_table->*AddFunc)(std::move(*info_iter));
+            T* info          = &initial_infos[i];
+            info->handle     = handles[i];
+            info->capture_id = ids[i];
+            info->parent_id  = parent_id;
+            (object_info_table->*AddFunc)(std::move(*info));
         }
     }
 }
@@ -198,7 +206,7 @@ static void AddHandleArray(format::HandleId              parent_id,
                            size_t                        ids_len,
                            const typename T::HandleType* handles,
                            size_t                        handles_len,
-                           std::vector<T>&&              initial_infos,
+                           T*                            initial_infos,
                            VulkanObjectInfoTable*        object_info_table,
                            S* (VulkanObjectInfoTable::*GetPoolInfoFunc)(format::HandleId),
                            void (VulkanObjectInfoTable::*AddFunc)(T&&))
@@ -211,7 +219,7 @@ static void AddHandleArray(format::HandleId              parent_id,
 
         size_t len = std::min(ids_len, handles_len);
 
-        assert(len <= initial_infos.size());
+        assert(initial_infos != nullptr);
 
         for (size_t i = 0; i < len; ++i)
         {
@@ -224,12 +232,12 @@ static void AddHandleArray(format::HandleId              parent_id,
                     pool_info->child_ids.insert(ids[i]);
                 }
 
-                auto info_iter        = std::next(initial_infos.begin(), i);
-                info_iter->handle     = handles[i];
-                info_iter->capture_id = ids[i];
-                info_iter->parent_id  = parent_id;
-                info_iter->pool_id    = pool_id;
-                (object_info_table->*AddFunc)(std::move(*info_iter));
+                T* info          = &initial_infos[i];
+                info->handle     = handles[i];
+                info->capture_id = ids[i];
+                info->parent_id  = parent_id;
+                info->pool_id    = pool_id;
+                (object_info_table->*AddFunc)(std::move(*info));
             }
         }
     }
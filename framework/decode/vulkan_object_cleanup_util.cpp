@@ -155,7 +155,9 @@ void FreeAllLiveObjects(VulkanObjectInfoTable*
                         bool                                                     remove_entries,
                         bool                                                     report_leaks,
                         std::function<const encode::InstanceTable*(const void*)> get_instance_table,
-                        std::function<const encode::DeviceTable*(const void*)>   get_device_table)
+                        std::function<const encode::DeviceTable*(const void*)>   get_device_table,
+                        std::function<bool(const DeviceInfo*)>                   retain_device,
+                        std::function<bool(const InstanceInfo*)>                 retain_instance)
 {
     FreeChildObjects<DeviceInfo, EventInfo>(
         table,
@@ -680,8 +682,11 @@ void FreeAllLiveObjects(VulkanObjectInfoTable*
                                   [&](const DeviceInfo* object_info) {
                                       assert(object_info != nullptr);
                                       object_info->allocator->Destroy();
-                                      auto table = get_device_table(object_info->handle);
-                                      table->DestroyDevice(object_info->handle, nullptr);
+                                      if (!retain_device || !retain_device(object_info))
+                                      {
+                                          auto table = get_device_table(object_info->handle);
+                                          table->DestroyDevice(object_info->handle, nullptr);
+                                      }
                                   });
 
     FreeParentObjects<InstanceInfo>(table,
@@ -690,8 +695,11 @@ void FreeAllLiveObjects(VulkanObjectInfoTable*
                                     &VulkanObjectInfoTable::RemoveInstanceInfo,
                                     [&](const InstanceInfo* object_info) {
                                         assert(object_info != nullptr);
-                                        auto table = get_instance_table(object_info->handle);
-                                        table->DestroyInstance(object_info->handle, nullptr);
+                                        if (!retain_instance || !retain_instance(object_info))
+                                        {
+                                            auto table = get_instance_table(object_info->handle);
+                                            table->DestroyInstance(object_info->handle, nullptr);
+                                        }
                                     });
 
     // Remove the objects that are not destroyed from the table.
@@ -33,11 +33,15 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 GFXRECON_BEGIN_NAMESPACE(object_cleanup)
 
+// Destroys the objects of the table, children before parents.  Devices and instances are not destroyed when the
+// optional retain functions return true for them, after the device allocators have been destroyed.
 void FreeAllLiveObjects(VulkanObjectInfoTable*                                   table,
                         bool                                                     remove_entries,
                         bool                                                     report_leaks,
                         std::function<const encode::InstanceTable*(const void*)> get_instance_table,
-                        std::function<const encode::DeviceTable*(const void*)>   get_device_table);
+                        std::function<const encode::DeviceTable*(const void*)>   get_device_table,
+                        std::function<bool(const DeviceInfo*)>                   retain_device   = nullptr,
+                        std::function<bool(const InstanceInfo*)>                 retain_instance = nullptr);
 
 GFXRECON_END_NAMESPACE(object_cleanup)
 GFXRECON_END_NAMESPACE(decode)
@@ -23,6 +23,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_OBJECT_INFO_H
 #define GFXRECON_DECODE_VULKAN_OBJECT_INFO_H
 
+#include "decode/async_pipeline_creator.h"
 #include "decode/vulkan_resource_allocator.h"
 #include "decode/vulkan_resource_initializer.h"
 #include "decode/window.h"
@@ -33,6 +34,8 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -174,7 +177,6 @@ struct VulkanPoolObjectInfo : public VulkanObjectInfo<T>
 // Declarations for Vulkan objects without additional replay state info.
 //
 
-typedef VulkanPoolObjectInfo<VkCommandBuffer>             CommandBufferInfo;
 typedef VulkanObjectInfo<VkEvent>                         EventInfo;
 typedef VulkanObjectInfo<VkQueryPool>                     QueryPoolInfo;
 typedef VulkanObjectInfo<VkBufferView>                    BufferViewInfo;
@@ -182,11 +184,8 @@ typedef VulkanObjectInfo<VkImageView>                     ImageViewInfo;
 typedef VulkanObjectInfo<VkShaderModule>                  ShaderModuleInfo;
 typedef VulkanObjectInfo<VkPipelineLayout>                PipelineLayoutInfo;
 typedef VulkanObjectInfo<VkRenderPass>                    RenderPassInfo;
-typedef VulkanObjectInfo<VkDescriptorSetLayout>           DescriptorSetLayoutInfo;
 typedef VulkanObjectInfo<VkSampler>                       SamplerInfo;
-typedef VulkanPoolObjectInfo<VkDescriptorSet>             DescriptorSetInfo;
 typedef VulkanObjectInfo<VkFramebuffer>                   FramebufferInfo;
-typedef VulkanPoolInfo<VkCommandPool>                     CommandPoolInfo;
 typedef VulkanObjectInfo<VkSamplerYcbcrConversion>        SamplerYcbcrConversionInfo;
 typedef VulkanObjectInfo<VkDisplayModeKHR>                DisplayModeKHRInfo;
 typedef VulkanObjectInfo<VkDebugReportCallbackEXT>        DebugReportCallbackEXTInfo;
@@ -251,9 +250,19 @@ struct DeviceInfo : public VulkanObjectInfo<VkDevice>
     // The following values are only used when loading the initial state for trimmed files.
     std::vector<std::string>                   extensions;
     std::unique_ptr<VulkanResourceInitializer> resource_initializer;
+    uint32_t                                   transfer_queue_family_index{ VK_QUEUE_FAMILY_IGNORED };
+
+    // Queue families that the device was created with.
+    std::vector<uint32_t> queue_family_indices;
 
     // Physical device property & feature state at device creation
     graphics::VulkanDevicePropertyFeatureInfo property_feature_info;
+
+    // Pipeline cache that is maintained by replay and persisted across replay runs, with the file that it is loaded
+    // from and saved to, and the data that it was loaded with.
+    VkPipelineCache      replay_pipeline_cache{ VK_NULL_HANDLE };
+    std::string          replay_pipeline_cache_file;
+    std::vector<uint8_t> replay_pipeline_cache_data;
 };
 
 struct QueueInfo : public VulkanObjectInfo<VkQueue>
@@ -278,12 +287,21 @@ struct FenceInfo : public VulkanObjectInfo<VkFence>
     // If a null-swapchain/surface interacts with a fence, replay needs to to shadow signal it until a future call waits
     // on it.
     bool shadow_signaled{ false };
+
+    // Set when replay has already observed the fence in the signaled state, so that redundant status queries and waits
+    // can be skipped until the fence is reset.
+    bool replay_signaled{ false };
 };
 
 struct DeviceMemoryInfo : public VulkanObjectInfo<VkDeviceMemory>
 {
     VulkanResourceAllocator*            allocator{ nullptr };
     VulkanResourceAllocator::MemoryData allocator_data{ 0 };
+
+    // The following values are only used to save and restore memory contents for frame range looping.
+    VkDeviceSize allocation_size{ 0 };
+    uint32_t     memory_type_index{ 0 };
+    bool         is_dedicated{ false }; // Dedicated and imported allocations cannot be aliased by another buffer.
 };
 
 struct BufferInfo : public VulkanObjectInfo<VkBuffer>
@@ -291,10 +309,18 @@ struct BufferInfo : public VulkanObjectInfo<VkBuffer>
     // The following values are only used for memory portability.
     VulkanResourceAllocator::ResourceData allocator_data{ 0 };
 
+    // Used to remap the device addresses of the buffer when --remap-device-addresses is specified.
+    VkDeviceSize size{ 0 };
+
     // The following values are only used when loading the initial state for trimmed files.
     VkMemoryPropertyFlags               memory_property_flags{ 0 };
     VkBufferUsageFlags                  usage{ 0 };
+    VkSharingMode                       sharing_mode{ VK_SHARING_MODE_EXCLUSIVE };
     uint32_t                            queue_family_index{ 0 };
+
+    // Capture ID of and offset into the bound memory, used to detect aliasing for --lazy-resource-init.
+    format::HandleId bound_memory_id{ format::kNullHandleId };
+    VkDeviceSize     bound_memory_offset{ 0 };
 };
 
 struct ImageInfo : public VulkanObjectInfo<VkImage>
@@ -320,7 +346,12 @@ struct ImageInfo : public VulkanObjectInfo<VkImage>
     VkImageLayout                       initial_layout{};
     uint32_t                            layer_count{ 0 };
     uint32_t                            level_count{ 0 };
+    VkSharingMode                       sharing_mode{ VK_SHARING_MODE_EXCLUSIVE };
     uint32_t                            queue_family_index{ 0 };
+
+    // Capture ID of and offset into the bound memory, used to detect aliasing for --lazy-resource-init.
+    format::HandleId bound_memory_id{ format::kNullHandleId };
+    VkDeviceSize     bound_memory_offset{ 0 };
 };
 
 struct PipelineCacheInfo : public VulkanObjectInfo<VkPipelineCache>
@@ -331,6 +362,11 @@ struct PipelineCacheInfo : public VulkanObjectInfo<VkPipelineCache>
 struct PipelineInfo : public VulkanObjectInfo<VkPipeline>
 {
     std::unordered_map<uint32_t, size_t> array_counts;
+
+    // Set while the pipeline is created asynchronously.  The handle is set from the task's result when the pipeline's
+    // info is first retrieved from the object info table, which waits for the task to finish.
+    std::shared_ptr<PipelineCreationTask> creation_task;
+    uint32_t                              creation_index{ 0 }; // Index of the pipeline in the task's results.
 };
 
 struct DescriptorPoolInfo : public VulkanPoolInfo<VkDescriptorPool>
@@ -340,6 +376,86 @@ struct DescriptorPoolInfo : public VulkanPoolInfo<VkDescriptorPool>
     uint32_t                          max_inline_uniform_block_bindings{ 0 }; // For VK_EXT_inline_uniform_block.
     std::vector<VkDescriptorPoolSize> pool_sizes;
     std::vector<VkDescriptorPool>     retired_pools;
+    std::string                       recycle_key; // Key to keep the pool for reuse when it is destroyed, or empty.
+};
+
+struct CommandPoolInfo : public VulkanPoolInfo<VkCommandPool>
+{
+    std::string recycle_key; // Key to keep the pool for reuse when it is destroyed, or empty.
+};
+
+// Most recently used cache of the infos of the objects that are referenced by the commands recorded to a command
+// buffer, which mostly reference the same few pipelines, layouts, descriptor sets and buffers.  Entries are keyed by
+// capture ID and info type, and are invalidated when the generation of the object info table changes.
+struct CommandObjectInfoCache
+{
+    static const size_t kEntryCount = 8;
+
+    // Returns a key that identifies the info type of an entry.
+    template <typename T>
+    static const void* GetTypeKey()
+    {
+        static const char key = 0;
+        return &key;
+    }
+
+    void* Find(format::HandleId id, const void* type_key)
+    {
+        for (size_t i = 0; i < kEntryCount; ++i)
+        {
+            if ((ids[i] == id) && (type_keys[i] == type_key))
+            {
+                void* info = infos[i];
+
+                // Move the entry to the front, so that the least recently used entry is the last entry.
+                for (; i > 0; --i)
+                {
+                    ids[i]       = ids[i - 1];
+                    type_keys[i] = type_keys[i - 1];
+                    infos[i]     = infos[i - 1];
+                }
+
+                ids[0]       = id;
+                type_keys[0] = type_key;
+                infos[0]     = info;
+
+                return info;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Adds an entry at the front, replacing the least recently used entry.
+    void Insert(format::HandleId id, const void* type_key, void* info)
+    {
+        for (size_t i = kEntryCount - 1; i > 0; --i)
+        {
+            ids[i]       = ids[i - 1];
+            type_keys[i] = type_keys[i - 1];
+            infos[i]     = infos[i - 1];
+        }
+
+        ids[0]       = id;
+        type_keys[0] = type_key;
+        infos[0]     = info;
+    }
+
+    void Reset(uint64_t table_generation)
+    {
+        std::fill(ids, ids + kEntryCount, format::kNullHandleId);
+        generation = table_generation;
+    }
+
+    format::HandleId ids[kEntryCount]{};
+    const void*      type_keys[kEntryCount]{};
+    void*            infos[kEntryCount]{};
+    uint64_t         generation{ 0 };
+};
+
+struct CommandBufferInfo : public VulkanPoolObjectInfo<VkCommandBuffer>
+{
+    CommandObjectInfoCache object_cache;
 };
 
 struct DescriptorUpdateTemplateInfo : public VulkanObjectInfo<VkDescriptorUpdateTemplate>
@@ -347,6 +463,34 @@ struct DescriptorUpdateTemplateInfo : public VulkanObjectInfo<VkDescriptorUpdate
     std::vector<VkDescriptorType> descriptor_image_types;
 };
 
+struct DescriptorSetLayoutInfo : public VulkanObjectInfo<VkDescriptorSetLayout>
+{
+    // Descriptor count of each binding, sorted by binding number.  Only used to skip redundant descriptor updates.
+    std::map<uint32_t, uint32_t> binding_counts;
+};
+
+// Contents of a descriptor written by vkUpdateDescriptorSets, identified by the capture IDs of the objects that it
+// references, so that handle values reused by the replay driver for new objects are not mistaken for the old ones.
+struct DescriptorContents
+{
+    VkDescriptorType type{ VK_DESCRIPTOR_TYPE_MAX_ENUM }; // VK_DESCRIPTOR_TYPE_MAX_ENUM when the contents are unknown.
+    format::HandleId sampler_id{ format::kNullHandleId };
+    format::HandleId object_id{ format::kNullHandleId }; // Image view, buffer, or buffer view.
+    VkImageLayout    image_layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+    VkDeviceSize     offset{ 0 };
+    VkDeviceSize     range{ 0 };
+};
+
+struct DescriptorSetInfo : public VulkanPoolObjectInfo<VkDescriptorSet>
+{
+    // The following values are only used to skip redundant descriptor updates.  The descriptors of each binding are
+    // sorted by binding number, for writes that continue into the next binding.  The last template update is kept
+    // until the set is updated by any other call.
+    std::map<uint32_t, std::vector<DescriptorContents>> descriptors;
+    format::HandleId                                    update_template_id{ format::kNullHandleId };
+    std::vector<uint64_t>                               update_template_data;
+};
+
 struct DisplayKHRInfo : public VulkanObjectInfo<VkDisplayKHR>
 {
     std::unordered_map<uint32_t, size_t> array_counts;
@@ -381,6 +525,9 @@ struct SwapchainKHRInfo : public VulkanObjectInfo<VkSwapchainKHR>
     uint32_t                  image_array_layers;
     VkImageUsageFlags         image_usage;
     VkSharingMode             image_sharing_mode;
+
+    // Swapchain that presents copies of the backing images, when the present mode is overridden.
+    VkSwapchainKHR present_swapchain{ VK_NULL_HANDLE };
 };
 
 struct ValidationCacheEXTInfo : public VulkanObjectInfo<VkValidationCacheEXT>
@@ -24,6 +24,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_H
 #define GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_H
 
+#include "decode/object_info_map.h"
 #include "decode/vulkan_object_info.h"
 #include "format/format.h"
 #include "util/defines.h"
@@ -32,7 +33,6 @@
 
 #include <cassert>
 #include <functional>
-#include <unordered_map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -82,46 +82,46 @@ class VulkanObjectInfoTable
     void AddDeferredOperationKHRInfo(DeferredOperationKHRInfo&& info)                   { AddObjectInfo(std::move(info), &deferred_operation_khr_map_); }
     void AddPrivateDataSlotEXTInfo(PrivateDataSlotEXTInfo&& info)                       { AddObjectInfo(std::move(info), &private_data_slot_ext_map_); }
 
-    void RemoveInstanceInfo(format::HandleId id)                      { instance_map_.erase(id); }
-    void RemovePhysicalDeviceInfo(format::HandleId id)                { physical_device_map_.erase(id); }
-    void RemoveDeviceInfo(format::HandleId id)                        { device_map_.erase(id); }
-    void RemoveQueueInfo(format::HandleId id)                         { queue_map_.erase(id); }
-    void RemoveSemaphoreInfo(format::HandleId id)                     { semaphore_map_.erase(id); }
-    void RemoveCommandBufferInfo(format::HandleId id)                 { command_buffer_map_.erase(id); }
-    void RemoveFenceInfo(format::HandleId id)                         { fence_map_.erase(id); }
-    void RemoveDeviceMemoryInfo(format::HandleId id)                  { device_memory_map_.erase(id); }
-    void RemoveBufferInfo(format::HandleId id)                        { buffer_map_.erase(id); }
-    void RemoveImageInfo(format::HandleId id)                         { image_map_.erase(id); }
-    void RemoveEventInfo(format::HandleId id)                         { event_map_.erase(id); }
-    void RemoveQueryPoolInfo(format::HandleId id)                     { query_pool_map_.erase(id); }
-    void RemoveBufferViewInfo(format::HandleId id)                    { buffer_view_map_.erase(id); }
-    void RemoveImageViewInfo(format::HandleId id)                     { image_view_map_.erase(id); }
-    void RemoveShaderModuleInfo(format::HandleId id)                  { shader_module_map_.erase(id); }
-    void RemovePipelineCacheInfo(format::HandleId id)                 { pipeline_cache_map_.erase(id); }
-    void RemovePipelineLayoutInfo(format::HandleId id)                { pipeline_layout_map_.erase(id); }
-    void RemoveRenderPassInfo(format::HandleId id)                    { render_pass_map_.erase(id); }
-    void RemovePipelineInfo(format::HandleId id)                      { pipeline_map_.erase(id); }
-    void RemoveDescriptorSetLayoutInfo(format::HandleId id)           { descriptor_set_layout_map_.erase(id); }
-    void RemoveSamplerInfo(format::HandleId id)                       { sampler_map_.erase(id); }
-    void RemoveDescriptorPoolInfo(format::HandleId id)                { descriptor_pool_map_.erase(id); }
-    void RemoveDescriptorSetInfo(format::HandleId id)                 { descriptor_set_map_.erase(id); }
-    void RemoveFramebufferInfo(format::HandleId id)                   { framebuffer_map_.erase(id); }
-    void RemoveCommandPoolInfo(format::HandleId id)                   { command_pool_map_.erase(id); }
-    void RemoveSamplerYcbcrConversionInfo(format::HandleId id)        { sampler_ycbcr_conversion_map_.erase(id); }
-    void RemoveDescriptorUpdateTemplateInfo(format::HandleId id)      { descriptor_update_template_map_.erase(id); }
-    void RemoveSurfaceKHRInfo(format::HandleId id)                    { surface_khr_map_.erase(id); }
-    void RemoveSwapchainKHRInfo(format::HandleId id)                  { swapchain_khr_map_.erase(id); }
-    void RemoveDisplayKHRInfo(format::HandleId id)                    { display_khr_map_.erase(id); }
-    void RemoveDisplayModeKHRInfo(format::HandleId id)                { display_mode_khr_map_.erase(id); }
-    void RemoveDebugReportCallbackEXTInfo(format::HandleId id)        { debug_report_callback_ext_map_.erase(id); }
-    void RemoveIndirectCommandsLayoutNVInfo(format::HandleId id)      { indirect_commands_layout_nv_map_.erase(id); }
-    void RemoveDebugUtilsMessengerEXTInfo(format::HandleId id)        { debug_utils_messenger_ext_map_.erase(id); }
-    void RemoveValidationCacheEXTInfo(format::HandleId id)            { validation_cache_ext_map_.erase(id); }
-    void RemoveAccelerationStructureKHRInfo(format::HandleId id)      { acceleration_structure_khr_map_.erase(id); }
-    void RemoveAccelerationStructureNVInfo(format::HandleId id)       { acceleration_structure_nv_map_.erase(id); }
-    void RemovePerformanceConfigurationINTELInfo(format::HandleId id) { performance_configuration_intel_map_.erase(id); }
-    void RemoveDeferredOperationKHRInfo(format::HandleId id)          { deferred_operation_khr_map_.erase(id); }
-    void RemovePrivateDataSlotEXTInfo(format::HandleId id)            { private_data_slot_ext_map_.erase(id); }
+    void RemoveInstanceInfo(format::HandleId id)                      { RemoveObjectInfo(id, &instance_map_); }
+    void RemovePhysicalDeviceInfo(format::HandleId id)                { RemoveObjectInfo(id, &physical_device_map_); }
+    void RemoveDeviceInfo(format::HandleId id)                        { RemoveObjectInfo(id, &device_map_); }
+    void RemoveQueueInfo(format::HandleId id)                         { RemoveObjectInfo(id, &queue_map_); }
+    void RemoveSemaphoreInfo(format::HandleId id)                     { RemoveObjectInfo(id, &semaphore_map_); }
+    void RemoveCommandBufferInfo(format::HandleId id)                 { RemoveObjectInfo(id, &command_buffer_map_); }
+    void RemoveFenceInfo(format::HandleId id)                         { RemoveObjectInfo(id, &fence_map_); }
+    void RemoveDeviceMemoryInfo(format::HandleId id)                  { RemoveObjectInfo(id, &device_memory_map_); }
+    void RemoveBufferInfo(format::HandleId id)                        { RemoveObjectInfo(id, &buffer_map_); }
+    void RemoveImageInfo(format::HandleId id)                         { RemoveObjectInfo(id, &image_map_); }
+    void RemoveEventInfo(format::HandleId id)                         { RemoveObjectInfo(id, &event_map_); }
+    void RemoveQueryPoolInfo(format::HandleId id)                     { RemoveObjectInfo(id, &query_pool_map_); }
+    void RemoveBufferViewInfo(format::HandleId id)                    { RemoveObjectInfo(id, &buffer_view_map_); }
+    void RemoveImageViewInfo(format::HandleId id)                     { RemoveObjectInfo(id, &image_view_map_); }
+    void RemoveShaderModuleInfo(format::HandleId id)                  { RemoveObjectInfo(id, &shader_module_map_); }
+    void RemovePipelineCacheInfo(format::HandleId id)                 { RemoveObjectInfo(id, &pipeline_cache_map_); }
+    void RemovePipelineLayoutInfo(format::HandleId id)                { RemoveObjectInfo(id, &pipeline_layout_map_); }
+    void RemoveRenderPassInfo(format::HandleId id)                    { RemoveObjectInfo(id, &render_pass_map_); }
+    void RemovePipelineInfo(format::HandleId id)                      { RemoveObjectInfo(id, &pipeline_map_); }
+    void RemoveDescriptorSetLayoutInfo(format::HandleId id)           { RemoveObjectInfo(id, &descriptor_set_layout_map_); }
+    void RemoveSamplerInfo(format::HandleId id)                       { RemoveObjectInfo(id, &sampler_map_); }
+    void RemoveDescriptorPoolInfo(format::HandleId id)                { RemoveObjectInfo(id, &descriptor_pool_map_); }
+    void RemoveDescriptorSetInfo(format::HandleId id)                 { RemoveObjectInfo(id, &descriptor_set_map_); }
+    void RemoveFramebufferInfo(format::HandleId id)                   { RemoveObjectInfo(id, &framebuffer_map_); }
+    void RemoveCommandPoolInfo(format::HandleId id)                   { RemoveObjectInfo(id, &command_pool_map_); }
+    void RemoveSamplerYcbcrConversionInfo(format::HandleId id)        { RemoveObjectInfo(id, &sampler_ycbcr_conversion_map_); }
+    void RemoveDescriptorUpdateTemplateInfo(format::HandleId id)      { RemoveObjectInfo(id, &descriptor_update_template_map_); }
+    void RemoveSurfaceKHRInfo(format::HandleId id)                    { RemoveObjectInfo(id, &surface_khr_map_); }
+    void RemoveSwapchainKHRInfo(format::HandleId id)                  { RemoveObjectInfo(id, &swapchain_khr_map_); }
+    void RemoveDisplayKHRInfo(format::HandleId id)                    { RemoveObjectInfo(id, &display_khr_map_); }
+    void RemoveDisplayModeKHRInfo(format::HandleId id)                { RemoveObjectInfo(id, &display_mode_khr_map_); }
+    void RemoveDebugReportCallbackEXTInfo(format::HandleId id)        { RemoveObjectInfo(id, &debug_report_callback_ext_map_); }
+    void RemoveIndirectCommandsLayoutNVInfo(format::HandleId id)      { RemoveObjectInfo(id, &indirect_commands_layout_nv_map_); }
+    void RemoveDebugUtilsMessengerEXTInfo(format::HandleId id)        { RemoveObjectInfo(id, &debug_utils_messenger_ext_map_); }
+    void RemoveValidationCacheEXTInfo(format::HandleId id)            { RemoveObjectInfo(id, &validation_cache_ext_map_); }
+    void RemoveAccelerationStructureKHRInfo(format::HandleId id)      { RemoveObjectInfo(id, &acceleration_structure_khr_map_); }
+    void RemoveAccelerationStructureNVInfo(format::HandleId id)       { RemoveObjectInfo(id, &acceleration_structure_nv_map_); }
+    void RemovePerformanceConfigurationINTELInfo(format::HandleId id) { RemoveObjectInfo(id, &performance_configuration_intel_map_); }
+    void RemoveDeferredOperationKHRInfo(format::HandleId id)          { RemoveObjectInfo(id, &deferred_operation_khr_map_); }
+    void RemovePrivateDataSlotEXTInfo(format::HandleId id)            { RemoveObjectInfo(id, &private_data_slot_ext_map_); }
 
     const InstanceInfo*                      GetInstanceInfo(format::HandleId id) const                       { return GetObjectInfo<InstanceInfo>(id, &instance_map_); }
     const PhysicalDeviceInfo*                GetPhysicalDeviceInfo(format::HandleId id) const                 { return GetObjectInfo<PhysicalDeviceInfo>(id, &physical_device_map_); }
@@ -141,7 +141,7 @@ class VulkanObjectInfoTable
     const PipelineCacheInfo*                 GetPipelineCacheInfo(format::HandleId id) const                  { return GetObjectInfo<PipelineCacheInfo>(id, &pipeline_cache_map_); }
     const PipelineLayoutInfo*                GetPipelineLayoutInfo(format::HandleId id) const                 { return GetObjectInfo<PipelineLayoutInfo>(id, &pipeline_layout_map_); }
     const RenderPassInfo*                    GetRenderPassInfo(format::HandleId id) const                     { return GetObjectInfo<RenderPassInfo>(id, &render_pass_map_); }
-    const PipelineInfo*                      GetPipelineInfo(format::HandleId id) const                       { return GetObjectInfo<PipelineInfo>(id, &pipeline_map_); }
+    const PipelineInfo*                      GetPipelineInfo(format::HandleId id) const                       { return GetCreatedPipelineInfo(GetObjectInfo<PipelineInfo>(id, &pipeline_map_)); }
     const DescriptorSetLayoutInfo*           GetDescriptorSetLayoutInfo(format::HandleId id) const            { return GetObjectInfo<DescriptorSetLayoutInfo>(id, &descriptor_set_layout_map_); }
     const SamplerInfo*                       GetSamplerInfo(format::HandleId id) const                        { return GetObjectInfo<SamplerInfo>(id, &sampler_map_); }
     const DescriptorPoolInfo*                GetDescriptorPoolInfo(format::HandleId id) const                 { return GetObjectInfo<DescriptorPoolInfo>(id, &descriptor_pool_map_); }
@@ -182,7 +182,7 @@ class VulkanObjectInfoTable
     PipelineCacheInfo*                 GetPipelineCacheInfo(format::HandleId id)                  { return GetObjectInfo<PipelineCacheInfo>(id, &pipeline_cache_map_); }
     PipelineLayoutInfo*                GetPipelineLayoutInfo(format::HandleId id)                 { return GetObjectInfo<PipelineLayoutInfo>(id, &pipeline_layout_map_); }
     RenderPassInfo*                    GetRenderPassInfo(format::HandleId id)                     { return GetObjectInfo<RenderPassInfo>(id, &render_pass_map_); }
-    PipelineInfo*                      GetPipelineInfo(format::HandleId id)                       { return GetObjectInfo<PipelineInfo>(id, &pipeline_map_); }
+    PipelineInfo*                      GetPipelineInfo(format::HandleId id)                       { return GetCreatedPipelineInfo(GetObjectInfo<PipelineInfo>(id, &pipeline_map_)); }
     DescriptorSetLayoutInfo*           GetDescriptorSetLayoutInfo(format::HandleId id)            { return GetObjectInfo<DescriptorSetLayoutInfo>(id, &descriptor_set_layout_map_); }
     SamplerInfo*                       GetSamplerInfo(format::HandleId id)                        { return GetObjectInfo<SamplerInfo>(id, &sampler_map_); }
     DescriptorPoolInfo*                GetDescriptorPoolInfo(format::HandleId id)                 { return GetObjectInfo<DescriptorPoolInfo>(id, &descriptor_pool_map_); }
@@ -205,81 +205,109 @@ class VulkanObjectInfoTable
     DeferredOperationKHRInfo*          GetDeferredOperationKHRInfo(format::HandleId id)           { return GetObjectInfo<DeferredOperationKHRInfo>(id, &deferred_operation_khr_map_); }
     PrivateDataSlotEXTInfo*            GetPrivateDataSlotEXTInfo(format::HandleId id)             { return GetObjectInfo<PrivateDataSlotEXTInfo>(id, &private_data_slot_ext_map_); }
 
-    void VisitInstanceInfo(std::function<void(const InstanceInfo*)> visitor) const                                           { for (const auto& entry : instance_map_) { visitor(&entry.second); } }
-    void VisitPhysicalDeviceInfo(std::function<void(const PhysicalDeviceInfo*)> visitor) const                               { for (const auto& entry : physical_device_map_) { visitor(&entry.second); } }
-    void VisitDeviceInfo(std::function<void(const DeviceInfo*)> visitor) const                                               { for (const auto& entry : device_map_) { visitor(&entry.second); } }
-    void VisitQueueInfo(std::function<void(const QueueInfo*)> visitor) const                                                 { for (const auto& entry : queue_map_) { visitor(&entry.second); } }
-    void VisitSemaphoreInfo(std::function<void(const SemaphoreInfo*)> visitor) const                                         { for (const auto& entry : semaphore_map_) { visitor(&entry.second); } }
-    void VisitCommandBufferInfo(std::function<void(const CommandBufferInfo*)> visitor) const                                 { for (const auto& entry : command_buffer_map_) { visitor(&entry.second); } }
-    void VisitFenceInfo(std::function<void(const FenceInfo*)> visitor) const                                                 { for (const auto& entry : fence_map_) { visitor(&entry.second); } }
-    void VisitDeviceMemoryInfo(std::function<void(const DeviceMemoryInfo*)> visitor) const                                   { for (const auto& entry : device_memory_map_) { visitor(&entry.second); } }
-    void VisitBufferInfo(std::function<void(const BufferInfo*)> visitor) const                                               { for (const auto& entry : buffer_map_) { visitor(&entry.second); } }
-    void VisitImageInfo(std::function<void(const ImageInfo*)> visitor) const                                                 { for (const auto& entry : image_map_) { visitor(&entry.second); } }
-    void VisitEventInfo(std::function<void(const EventInfo*)> visitor) const                                                 { for (const auto& entry : event_map_) { visitor(&entry.second); } }
-    void VisitQueryPoolInfo(std::function<void(const QueryPoolInfo*)> visitor) const                                         { for (const auto& entry : query_pool_map_) { visitor(&entry.second); } }
-    void VisitBufferViewInfo(std::function<void(const BufferViewInfo*)> visitor) const                                       { for (const auto& entry : buffer_view_map_) { visitor(&entry.second); } }
-    void VisitImageViewInfo(std::function<void(const ImageViewInfo*)> visitor) const                                         { for (const auto& entry : image_view_map_) { visitor(&entry.second); } }
-    void VisitShaderModuleInfo(std::function<void(const ShaderModuleInfo*)> visitor) const                                   { for (const auto& entry : shader_module_map_) { visitor(&entry.second); } }
-    void VisitPipelineCacheInfo(std::function<void(const PipelineCacheInfo*)> visitor) const                                 { for (const auto& entry : pipeline_cache_map_) { visitor(&entry.second); } }
-    void VisitPipelineLayoutInfo(std::function<void(const PipelineLayoutInfo*)> visitor) const                               { for (const auto& entry : pipeline_layout_map_) { visitor(&entry.second); } }
-    void VisitRenderPassInfo(std::function<void(const RenderPassInfo*)> visitor) const                                       { for (const auto& entry : render_pass_map_) { visitor(&entry.second); } }
-    void VisitPipelineInfo(std::function<void(const PipelineInfo*)> visitor) const                                           { for (const auto& entry : pipeline_map_) { visitor(&entry.second); } }
-    void VisitDescriptorSetLayoutInfo(std::function<void(const DescriptorSetLayoutInfo*)> visitor) const                     { for (const auto& entry : descriptor_set_layout_map_) { visitor(&entry.second); } }
-    void VisitSamplerInfo(std::function<void(const SamplerInfo*)> visitor) const                                             { for (const auto& entry : sampler_map_) { visitor(&entry.second); } }
-    void VisitDescriptorPoolInfo(std::function<void(const DescriptorPoolInfo*)> visitor) const                               { for (const auto& entry : descriptor_pool_map_) { visitor(&entry.second); } }
-    void VisitDescriptorSetInfo(std::function<void(const DescriptorSetInfo*)> visitor) const                                 { for (const auto& entry : descriptor_set_map_) { visitor(&entry.second); } }
-    void VisitFramebufferInfo(std::function<void(const FramebufferInfo*)> visitor) const                                     { for (const auto& entry : framebuffer_map_) { visitor(&entry.second); } }
-    void VisitCommandPoolInfo(std::function<void(const CommandPoolInfo*)> visitor) const                                     { for (const auto& entry : command_pool_map_) { visitor(&entry.second); } }
-    void VisitSamplerYcbcrConversionInfo(std::function<void(const SamplerYcbcrConversionInfo*)> visitor) const               { for (const auto& entry : sampler_ycbcr_conversion_map_) { visitor(&entry.second); } }
-    void VisitDescriptorUpdateTemplateInfo(std::function<void(const DescriptorUpdateTemplateInfo*)> visitor) const           { for (const auto& entry : descriptor_update_template_map_) { visitor(&entry.second); } }
-    void VisitSurfaceKHRInfo(std::function<void(const SurfaceKHRInfo*)> visitor) const                                       { for (const auto& entry : surface_khr_map_) { visitor(&entry.second); } }
-    void VisitSwapchainKHRInfo(std::function<void(const SwapchainKHRInfo*)> visitor) const                                   { for (const auto& entry : swapchain_khr_map_) { visitor(&entry.second); } }
-    void VisitDisplayKHRInfo(std::function<void(const DisplayKHRInfo*)> visitor) const                                       { for (const auto& entry : display_khr_map_) { visitor(&entry.second); } }
-    void VisitDisplayModeKHRInfo(std::function<void(const DisplayModeKHRInfo*)> visitor) const                               { for (const auto& entry : display_mode_khr_map_) { visitor(&entry.second); } }
-    void VisitDebugReportCallbackEXTInfo(std::function<void(const DebugReportCallbackEXTInfo*)> visitor) const               { for (const auto& entry : debug_report_callback_ext_map_) { visitor(&entry.second); } }
-    void VisitIndirectCommandsLayoutNVInfo(std::function<void(const IndirectCommandsLayoutNVInfo*)> visitor) const           { for (const auto& entry : indirect_commands_layout_nv_map_) { visitor(&entry.second); } }
-    void VisitDebugUtilsMessengerEXTInfo(std::function<void(const DebugUtilsMessengerEXTInfo*)> visitor) const               { for (const auto& entry : debug_utils_messenger_ext_map_) { visitor(&entry.second); } }
-    void VisitValidationCacheEXTInfo(std::function<void(const ValidationCacheEXTInfo*)> visitor) const                       { for (const auto& entry : validation_cache_ext_map_) { visitor(&entry.second); } }
-    void VisitAccelerationStructureKHRInfo(std::function<void(const AccelerationStructureKHRInfo*)> visitor) const           { for (const auto& entry : acceleration_structure_khr_map_) { visitor(&entry.second); } }
-    void VisitAccelerationStructureNVInfo(std::function<void(const AccelerationStructureNVInfo*)> visitor) const             { for (const auto& entry : acceleration_structure_nv_map_) { visitor(&entry.second); } }
-    void VisitPerformanceConfigurationINTELInfo(std::function<void(const PerformanceConfigurationINTELInfo*)> visitor) const { for (const auto& entry : performance_configuration_intel_map_) { visitor(&entry.second); } }
-    void VisitDeferredOperationKHRInfo(std::function<void(const DeferredOperationKHRInfo*)> visitor) const                   { for (const auto& entry : deferred_operation_khr_map_) { visitor(&entry.second); } }
-    void VisitPrivateDataSlotEXTInfo(std::function<void(const PrivateDataSlotEXTInfo*)> visitor) const                       { for (const auto& entry : private_data_slot_ext_map_) { visitor(&entry.second); } }
+    void VisitInstanceInfo(std::function<void(const InstanceInfo*)> visitor) const                                           { instance_map_.Visit(visitor); }
+    void VisitPhysicalDeviceInfo(std::function<void(const PhysicalDeviceInfo*)> visitor) const                               { physical_device_map_.Visit(visitor); }
+    void VisitDeviceInfo(std::function<void(const DeviceInfo*)> visitor) const                                               { device_map_.Visit(visitor); }
+    void VisitQueueInfo(std::function<void(const QueueInfo*)> visitor) const                                                 { queue_map_.Visit(visitor); }
+    void VisitSemaphoreInfo(std::function<void(const SemaphoreInfo*)> visitor) const                                         { semaphore_map_.Visit(visitor); }
+    void VisitCommandBufferInfo(std::function<void(const CommandBufferInfo*)> visitor) const                                 { command_buffer_map_.Visit(visitor); }
+    void VisitFenceInfo(std::function<void(const FenceInfo*)> visitor) const                                                 { fence_map_.Visit(visitor); }
+    void VisitDeviceMemoryInfo(std::function<void(const DeviceMemoryInfo*)> visitor) const                                   { device_memory_map_.Visit(visitor); }
+    void VisitBufferInfo(std::function<void(const BufferInfo*)> visitor) const                                               { buffer_map_.Visit(visitor); }
+    void VisitImageInfo(std::function<void(const ImageInfo*)> visitor) const                                                 { image_map_.Visit(visitor); }
+    void VisitEventInfo(std::function<void(const EventInfo*)> visitor) const                                                 { event_map_.Visit(visitor); }
+    void VisitQueryPoolInfo(std::function<void(const QueryPoolInfo*)> visitor) const                                         { query_pool_map_.Visit(visitor); }
+    void VisitBufferViewInfo(std::function<void(const BufferViewInfo*)> visitor) const                                       { buffer_view_map_.Visit(visitor); }
+    void VisitImageViewInfo(std::function<void(const ImageViewInfo*)> visitor) const                                         { image_view_map_.Visit(visitor); }
+    void VisitShaderModuleInfo(std::function<void(const ShaderModuleInfo*)> visitor) const                                   { shader_module_map_.Visit(visitor); }
+    void VisitPipelineCacheInfo(std::function<void(const PipelineCacheInfo*)> visitor) const                                 { pipeline_cache_map_.Visit(visitor); }
+    void VisitPipelineLayoutInfo(std::function<void(const PipelineLayoutInfo*)> visitor) const                               { pipeline_layout_map_.Visit(visitor); }
+    void VisitRenderPassInfo(std::function<void(const RenderPassInfo*)> visitor) const                                       { render_pass_map_.Visit(visitor); }
+    void VisitPipelineInfo(std::function<void(const PipelineInfo*)> visitor) const                                           { pipeline_map_.Visit([&](const PipelineInfo* info) { visitor(FinishPipelineCreation(info)); }); }
+    void VisitDescriptorSetLayoutInfo(std::function<void(const DescriptorSetLayoutInfo*)> visitor) const                     { descriptor_set_layout_map_.Visit(visitor); }
+    void VisitSamplerInfo(std::function<void(const SamplerInfo*)> visitor) const                                             { sampler_map_.Visit(visitor); }
+    void VisitDescriptorPoolInfo(std::function<void(const DescriptorPoolInfo*)> visitor) const                               { descriptor_pool_map_.Visit(visitor); }
+    void VisitDescriptorSetInfo(std::function<void(const DescriptorSetInfo*)> visitor) const                                 { descriptor_set_map_.Visit(visitor); }
+    void VisitFramebufferInfo(std::function<void(const FramebufferInfo*)> visitor) const                                     { framebuffer_map_.Visit(visitor); }
+    void VisitCommandPoolInfo(std::function<void(const CommandPoolInfo*)> visitor) const                                     { command_pool_map_.Visit(visitor); }
+    void VisitSamplerYcbcrConversionInfo(std::function<void(const SamplerYcbcrConversionInfo*)> visitor) const               { sampler_ycbcr_conversion_map_.Visit(visitor); }
+    void VisitDescriptorUpdateTemplateInfo(std::function<void(const DescriptorUpdateTemplateInfo*)> visitor) const           { descriptor_update_template_map_.Visit(visitor); }
+    void VisitSurfaceKHRInfo(std::function<void(const SurfaceKHRInfo*)> visitor) const                                       { surface_khr_map_.Visit(visitor); }
+    void VisitSwapchainKHRInfo(std::function<void(const SwapchainKHRInfo*)> visitor) const                                   { swapchain_khr_map_.Visit(visitor); }
+    void VisitDisplayKHRInfo(std::function<void(const DisplayKHRInfo*)> visitor) const                                       { display_khr_map_.Visit(visitor); }
+    void VisitDisplayModeKHRInfo(std::function<void(const DisplayModeKHRInfo*)> visitor) const                               { display_mode_khr_map_.Visit(visitor); }
+    void VisitDebugReportCallbackEXTInfo(std::function<void(const DebugReportCallbackEXTInfo*)> visitor) const               { debug_report_callback_ext_map_.Visit(visitor); }
+    void VisitIndirectCommandsLayoutNVInfo(std::function<void(const IndirectCommandsLayoutNVInfo*)> visitor) const           { indirect_commands_layout_nv_map_.Visit(visitor); }
+    void VisitDebugUtilsMessengerEXTInfo(std::function<void(const DebugUtilsMessengerEXTInfo*)> visitor) const               { debug_utils_messenger_ext_map_.Visit(visitor); }
+    void VisitValidationCacheEXTInfo(std::function<void(const ValidationCacheEXTInfo*)> visitor) const                       { validation_cache_ext_map_.Visit(visitor); }
+    void VisitAccelerationStructureKHRInfo(std::function<void(const AccelerationStructureKHRInfo*)> visitor) const           { acceleration_structure_khr_map_.Visit(visitor); }
+    void VisitAccelerationStructureNVInfo(std::function<void(const AccelerationStructureNVInfo*)> visitor) const             { acceleration_structure_nv_map_.Visit(visitor); }
+    void VisitPerformanceConfigurationINTELInfo(std::function<void(const PerformanceConfigurationINTELInfo*)> visitor) const { performance_configuration_intel_map_.Visit(visitor); }
+    void VisitDeferredOperationKHRInfo(std::function<void(const DeferredOperationKHRInfo*)> visitor) const                   { deferred_operation_khr_map_.Visit(visitor); }
+    void VisitPrivateDataSlotEXTInfo(std::function<void(const PrivateDataSlotEXTInfo*)> visitor) const                       { private_data_slot_ext_map_.Visit(visitor); }
     // clang-format on
 
     void ReplaceSemaphore(VkSemaphore target, VkSemaphore replacement)
     {
-        for (auto& entry : semaphore_map_)
-        {
-            if (entry.second.handle == target)
+        bool replaced = false;
+        semaphore_map_.Visit([&](SemaphoreInfo* info) {
+            if (!replaced && (info->handle == target))
             {
-                entry.second.handle = replacement;
-                break;
+                info->handle = replacement;
+                replaced     = true;
             }
-        }
+        });
     }
 
     void ReplaceFence(VkFence target, VkFence replacement)
     {
-        for (auto& entry : fence_map_)
-        {
-            if (entry.second.handle == target)
+        bool replaced = false;
+        fence_map_.Visit([&](FenceInfo* info) {
+            if (!replaced && (info->handle == target))
             {
-                entry.second.handle = replacement;
-                break;
+                info->handle = replacement;
+                replaced     = true;
             }
-        }
+        });
+    }
+
+    // Returns a value that changes when an info is removed or replaced, invalidating the pointers to infos that were
+    // retrieved before the change.
+    uint64_t GetGeneration() const { return generation_; }
+
+    // Returns the approximate host memory used by the tables, not including the memory that is owned by the members of
+    // the info structures.
+    size_t GetMemorySize() const
+    {
+        return instance_map_.GetMemorySize() + physical_device_map_.GetMemorySize() + device_map_.GetMemorySize() +
+               queue_map_.GetMemorySize() + semaphore_map_.GetMemorySize() + command_buffer_map_.GetMemorySize() +
+               fence_map_.GetMemorySize() + device_memory_map_.GetMemorySize() + buffer_map_.GetMemorySize() +
+               image_map_.GetMemorySize() + event_map_.GetMemorySize() + query_pool_map_.GetMemorySize() +
+               buffer_view_map_.GetMemorySize() + image_view_map_.GetMemorySize() + shader_module_map_.GetMemorySize() +
+               pipeline_cache_map_.GetMemorySize() + pipeline_layout_map_.GetMemorySize() +
+               render_pass_map_.GetMemorySize() + pipeline_map_.GetMemorySize() +
+               descriptor_set_layout_map_.GetMemorySize() + sampler_map_.GetMemorySize() +
+               descriptor_pool_map_.GetMemorySize() + descriptor_set_map_.GetMemorySize() +
+               framebuffer_map_.GetMemorySize() + command_pool_map_.GetMemorySize() +
+               sampler_ycbcr_conversion_map_.GetMemorySize() + descriptor_update_template_map_.GetMemorySize() +
+               surface_khr_map_.GetMemorySize() + swapchain_khr_map_.GetMemorySize() +
+               display_khr_map_.GetMemorySize() + display_mode_khr_map_.GetMemorySize() +
+               debug_report_callback_ext_map_.GetMemorySize() + indirect_commands_layout_nv_map_.GetMemorySize() +
+               debug_utils_messenger_ext_map_.GetMemorySize() + validation_cache_ext_map_.GetMemorySize() +
+               acceleration_structure_khr_map_.GetMemorySize() + acceleration_structure_nv_map_.GetMemorySize() +
+               performance_configuration_intel_map_.GetMemorySize() + deferred_operation_khr_map_.GetMemorySize() +
+               private_data_slot_ext_map_.GetMemorySize();
     }
 
   private:
     template <typename T>
-    void AddObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
+    void AddObjectInfo(T&& info, ObjectInfoMap<T>* map)
     {
         assert(map != nullptr);
 
-        if ((info.capture_id != 0) && (info.handle != VK_NULL_HANDLE))
+        if ((info.capture_id != 0) && ((info.handle != VK_NULL_HANDLE) || IsPendingCreation(info)))
         {
-            auto result = map->emplace(info.capture_id, std::forward<T>(info));
+            auto result = map->Emplace(info.capture_id, std::forward<T>(info));
 
             if (!result.second)
             {
@@ -291,96 +319,121 @@ class VulkanObjectInfoTable
                 // temporary objects created during the trimmed file state setup. IDs may be reused when creating these
                 // temporary objects, creating a case where we have a new handle that is not a duplicate of the existing
                 // map entry. In this case, the map entry needs to be updated with the new object's info.
-                auto iter = result.first;
-                if (iter->second.handle != info.handle)
+                auto existing_info = result.first;
+                if ((existing_info->handle != info.handle) || IsPendingCreation(info))
                 {
-                    iter->second = std::forward<T>(info);
+                    *existing_info = std::forward<T>(info);
+                    ++generation_;
                 }
             }
         }
     }
 
     template <typename T>
-    const T* GetObjectInfo(format::HandleId id, const std::unordered_map<format::HandleId, T>* map) const
+    void RemoveObjectInfo(format::HandleId id, ObjectInfoMap<T>* map)
     {
         assert(map != nullptr);
 
-        const T* object_info = nullptr;
+        map->Erase(id);
+        ++generation_;
+    }
 
-        if (id != 0)
-        {
-            const auto entry = map->find(id);
+    template <typename T>
+    static bool IsPendingCreation(const T& info)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(info);
+        return false;
+    }
 
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
+    static bool IsPendingCreation(const PipelineInfo& info) { return (info.creation_task != nullptr); }
+
+    // Waits for an asynchronously created pipeline and sets its handle.  Completing the creation does not change the
+    // object that the info describes, so it is also done for const lookups.
+    static const PipelineInfo* FinishPipelineCreation(const PipelineInfo* info)
+    {
+        if ((info != nullptr) && (info->creation_task != nullptr))
+        {
+            auto pending_info = const_cast<PipelineInfo*>(info);
+            pending_info->creation_task->Wait();
+            pending_info->handle = pending_info->creation_task->GetPipeline(pending_info->creation_index);
+            pending_info->creation_task.reset();
         }
 
-        return object_info;
+        return info;
+    }
+
+    // Pipelines that failed to be created asynchronously are not returned, matching pipelines that failed to be created
+    // synchronously, which are not added to the table.
+    static PipelineInfo* GetCreatedPipelineInfo(PipelineInfo* info)
+    {
+        FinishPipelineCreation(info);
+        return ((info != nullptr) && (info->handle != VK_NULL_HANDLE)) ? info : nullptr;
+    }
+
+    static const PipelineInfo* GetCreatedPipelineInfo(const PipelineInfo* info)
+    {
+        FinishPipelineCreation(info);
+        return ((info != nullptr) && (info->handle != VK_NULL_HANDLE)) ? info : nullptr;
     }
 
     template <typename T>
-    T* GetObjectInfo(format::HandleId id, std::unordered_map<format::HandleId, T>* map)
+    const T* GetObjectInfo(format::HandleId id, const ObjectInfoMap<T>* map) const
     {
         assert(map != nullptr);
 
-        T* object_info = nullptr;
-
-        if (id != 0)
-        {
-            auto entry = map->find(id);
+        return (id != 0) ? map->Find(id) : nullptr;
+    }
 
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
-        }
+    template <typename T>
+    T* GetObjectInfo(format::HandleId id, ObjectInfoMap<T>* map)
+    {
+        assert(map != nullptr);
 
-        return object_info;
+        return (id != 0) ? map->Find(id) : nullptr;
     }
 
   private:
-    std::unordered_map<format::HandleId, InstanceInfo>                      instance_map_;
-    std::unordered_map<format::HandleId, PhysicalDeviceInfo>                physical_device_map_;
-    std::unordered_map<format::HandleId, DeviceInfo>                        device_map_;
-    std::unordered_map<format::HandleId, QueueInfo>                         queue_map_;
-    std::unordered_map<format::HandleId, SemaphoreInfo>                     semaphore_map_;
-    std::unordered_map<format::HandleId, CommandBufferInfo>                 command_buffer_map_;
-    std::unordered_map<format::HandleId, FenceInfo>                         fence_map_;
-    std::unordered_map<format::HandleId, DeviceMemoryInfo>                  device_memory_map_;
-    std::unordered_map<format::HandleId, BufferInfo>                        buffer_map_;
-    std::unordered_map<format::HandleId, ImageInfo>                         image_map_;
-    std::unordered_map<format::HandleId, EventInfo>                         event_map_;
-    std::unordered_map<format::HandleId, QueryPoolInfo>                     query_pool_map_;
-    std::unordered_map<format::HandleId, BufferViewInfo>                    buffer_view_map_;
-    std::unordered_map<format::HandleId, ImageViewInfo>                     image_view_map_;
-    std::unordered_map<format::HandleId, ShaderModuleInfo>                  shader_module_map_;
-    std::unordered_map<format::HandleId, PipelineCacheInfo>                 pipeline_cache_map_;
-    std::unordered_map<format::HandleId, PipelineLayoutInfo>                pipeline_layout_map_;
-    std::unordered_map<format::HandleId, RenderPassInfo>                    render_pass_map_;
-    std::unordered_map<format::HandleId, PipelineInfo>                      pipeline_map_;
-    std::unordered_map<format::HandleId, DescriptorSetLayoutInfo>           descriptor_set_layout_map_;
-    std::unordered_map<format::HandleId, SamplerInfo>                       sampler_map_;
-    std::unordered_map<format::HandleId, DescriptorPoolInfo>                descriptor_pool_map_;
-    std::unordered_map<format::HandleId, DescriptorSetInfo>                 descriptor_set_map_;
-    std::unordered_map<format::HandleId, FramebufferInfo>                   framebuffer_map_;
-    std::unordered_map<format::HandleId, CommandPoolInfo>                   command_pool_map_;
-    std::unordered_map<format::HandleId, SamplerYcbcrConversionInfo>        sampler_ycbcr_conversion_map_;
-    std::unordered_map<format::HandleId, DescriptorUpdateTemplateInfo>      descriptor_update_template_map_;
-    std::unordered_map<format::HandleId, SurfaceKHRInfo>                    surface_khr_map_;
-    std::unordered_map<format::HandleId, SwapchainKHRInfo>                  swapchain_khr_map_;
-    std::unordered_map<format::HandleId, DisplayKHRInfo>                    display_khr_map_;
-    std::unordered_map<format::HandleId, DisplayModeKHRInfo>                display_mode_khr_map_;
-    std::unordered_map<format::HandleId, DebugReportCallbackEXTInfo>        debug_report_callback_ext_map_;
-    std::unordered_map<format::HandleId, IndirectCommandsLayoutNVInfo>      indirect_commands_layout_nv_map_;
-    std::unordered_map<format::HandleId, DebugUtilsMessengerEXTInfo>        debug_utils_messenger_ext_map_;
-    std::unordered_map<format::HandleId, ValidationCacheEXTInfo>            validation_cache_ext_map_;
-    std::unordered_map<format::HandleId, AccelerationStructureKHRInfo>      acceleration_structure_khr_map_;
-    std::unordered_map<format::HandleId, AccelerationStructureNVInfo>       acceleration_structure_nv_map_;
-    std::unordered_map<format::HandleId, PerformanceConfigurationINTELInfo> performance_configuration_intel_map_;
-    std::unordered_map<format::HandleId, DeferredOperationKHRInfo>          deferred_operation_khr_map_;
-    std::unordered_map<format::HandleId, PrivateDataSlotEXTInfo>            private_data_slot_ext_map_;
+    ObjectInfoMap<InstanceInfo>                      instance_map_;
+    ObjectInfoMap<PhysicalDeviceInfo>                physical_device_map_;
+    ObjectInfoMap<DeviceInfo>                        device_map_;
+    ObjectInfoMap<QueueInfo>                         queue_map_;
+    ObjectInfoMap<SemaphoreInfo>                     semaphore_map_;
+    ObjectInfoMap<CommandBufferInfo>                 command_buffer_map_;
+    ObjectInfoMap<FenceInfo>                         fence_map_;
+    ObjectInfoMap<DeviceMemoryInfo>                  device_memory_map_;
+    ObjectInfoMap<BufferInfo>                        buffer_map_;
+    ObjectInfoMap<ImageInfo>                         image_map_;
+    ObjectInfoMap<EventInfo>                         event_map_;
+    ObjectInfoMap<QueryPoolInfo>                     query_pool_map_;
+    ObjectInfoMap<BufferViewInfo>                    buffer_view_map_;
+    ObjectInfoMap<ImageViewInfo>                     image_view_map_;
+    ObjectInfoMap<ShaderModuleInfo>                  shader_module_map_;
+    ObjectInfoMap<PipelineCacheInfo>                 pipeline_cache_map_;
+    ObjectInfoMap<PipelineLayoutInfo>                pipeline_layout_map_;
+    ObjectInfoMap<RenderPassInfo>                    render_pass_map_;
+    ObjectInfoMap<PipelineInfo>                      pipeline_map_;
+    ObjectInfoMap<DescriptorSetLayoutInfo>           descriptor_set_layout_map_;
+    ObjectInfoMap<SamplerInfo>                       sampler_map_;
+    ObjectInfoMap<DescriptorPoolInfo>                descriptor_pool_map_;
+    ObjectInfoMap<DescriptorSetInfo>                 descriptor_set_map_;
+    ObjectInfoMap<FramebufferInfo>                   framebuffer_map_;
+    ObjectInfoMap<CommandPoolInfo>                   command_pool_map_;
+    ObjectInfoMap<SamplerYcbcrConversionInfo>        sampler_ycbcr_conversion_map_;
+    ObjectInfoMap<DescriptorUpdateTemplateInfo>      descriptor_update_template_map_;
+    ObjectInfoMap<SurfaceKHRInfo>                    surface_khr_map_;
+    ObjectInfoMap<SwapchainKHRInfo>                  swapchain_khr_map_;
+    ObjectInfoMap<DisplayKHRInfo>                    display_khr_map_;
+    ObjectInfoMap<DisplayModeKHRInfo>                display_mode_khr_map_;
+    ObjectInfoMap<DebugReportCallbackEXTInfo>        debug_report_callback_ext_map_;
+    ObjectInfoMap<IndirectCommandsLayoutNVInfo>      indirect_commands_layout_nv_map_;
+    ObjectInfoMap<DebugUtilsMessengerEXTInfo>        debug_utils_messenger_ext_map_;
+    ObjectInfoMap<ValidationCacheEXTInfo>            validation_cache_ext_map_;
+    ObjectInfoMap<AccelerationStructureKHRInfo>      acceleration_structure_khr_map_;
+    ObjectInfoMap<AccelerationStructureNVInfo>       acceleration_structure_nv_map_;
+    ObjectInfoMap<PerformanceConfigurationINTELInfo> performance_configuration_intel_map_;
+    ObjectInfoMap<DeferredOperationKHRInfo>          deferred_operation_khr_map_;
+    ObjectInfoMap<PrivateDataSlotEXTInfo>            private_data_slot_ext_map_;
+    uint64_t                                         generation_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(decode)
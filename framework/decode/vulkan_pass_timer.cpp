@@ -0,0 +1,437 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_pass_timer.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Query pools are created as they are needed, up to a fixed number of pools.  Each pass uses a pair of queries.
+const uint32_t kPassQueryPoolSize = 1024;
+const uint32_t kMaxPassQueryPools = 16;
+
+VulkanPassTimer::VulkanPassTimer(VkDevice device, const encode::DeviceTable* device_table, float timestamp_period) :
+    device_(device), device_table_(device_table), timestamp_period_(timestamp_period), query_pools_exhausted_(false)
+{
+    assert((device_ != VK_NULL_HANDLE) && (device_table_ != nullptr));
+}
+
+VulkanPassTimer::~VulkanPassTimer()
+{
+    for (VkQueryPool query_pool : query_pools_)
+    {
+        device_table_->DestroyQueryPool(device_, query_pool, nullptr);
+    }
+}
+
+void VulkanPassTimer::AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, uint32_t timestamp_valid_bits)
+{
+    uint64_t timestamp_mask = 0;
+
+    if (timestamp_valid_bits > 0)
+    {
+        timestamp_mask =
+            (timestamp_valid_bits < 64) ? ((1ull << timestamp_valid_bits) - 1) : std::numeric_limits<uint64_t>::max();
+    }
+
+    for (uint32_t i = 0; i < queue_count; ++i)
+    {
+        VkQueue queue = VK_NULL_HANDLE;
+        device_table_->GetDeviceQueue(device_, queue_family_index, i, &queue);
+
+        if (queue != VK_NULL_HANDLE)
+        {
+            timestamp_masks_[queue] = timestamp_mask;
+        }
+    }
+}
+
+void VulkanPassTimer::BeginCommandBuffer(VkCommandBuffer command_buffer, format::HandleId command_buffer_id, bool timed)
+{
+    auto entry = command_buffers_.find(command_buffer);
+
+    if (entry != command_buffers_.end())
+    {
+        // The queries of the previous recording are only reused after its results have been read.
+        if (entry->second.pending_submits > 0)
+        {
+            ReadResults(false, command_buffer);
+        }
+
+        ReleaseQueryPairs(&entry->second);
+    }
+    else if (!timed)
+    {
+        return;
+    }
+
+    CommandBufferPasses& passes = command_buffers_[command_buffer];
+    passes.command_buffer_id    = command_buffer_id;
+    passes.timed                = timed;
+    passes.incomplete           = false;
+    passes.render_pass_open     = false;
+    passes.dispatch_group_open  = false;
+    passes.pass_count           = 0;
+}
+
+void VulkanPassTimer::EndCommandBuffer(VkCommandBuffer command_buffer)
+{
+    CommandBufferPasses* passes = GetTimedPasses(command_buffer);
+
+    if ((passes != nullptr) && passes->dispatch_group_open)
+    {
+        EndPass(command_buffer, passes);
+        passes->dispatch_group_open = false;
+    }
+}
+
+void VulkanPassTimer::BeginRenderPass(VkCommandBuffer  command_buffer,
+                                      format::HandleId render_pass_id,
+                                      format::HandleId framebuffer_id)
+{
+    CommandBufferPasses* passes = GetTimedPasses(command_buffer);
+
+    if (passes != nullptr)
+    {
+        if (passes->dispatch_group_open)
+        {
+            EndPass(command_buffer, passes);
+            passes->dispatch_group_open = false;
+        }
+
+        passes->render_pass_open = BeginPass(command_buffer, passes, false, render_pass_id, framebuffer_id);
+    }
+}
+
+void VulkanPassTimer::EndRenderPass(VkCommandBuffer command_buffer)
+{
+    CommandBufferPasses* passes = GetTimedPasses(command_buffer);
+
+    if ((passes != nullptr) && passes->render_pass_open)
+    {
+        EndPass(command_buffer, passes);
+        passes->render_pass_open = false;
+    }
+}
+
+void VulkanPassTimer::Dispatch(VkCommandBuffer command_buffer)
+{
+    CommandBufferPasses* passes = GetTimedPasses(command_buffer);
+
+    if ((passes != nullptr) && !passes->dispatch_group_open)
+    {
+        passes->dispatch_group_open =
+            BeginPass(command_buffer, passes, true, format::kNullHandleId, format::kNullHandleId);
+    }
+}
+
+void VulkanPassTimer::Submit(VkQueue queue, uint32_t submit_count, const VkSubmitInfo* submits, uint64_t frame_number)
+{
+    assert((submit_count == 0) || (submits != nullptr));
+
+    auto     mask_entry     = timestamp_masks_.find(queue);
+    uint64_t timestamp_mask = (mask_entry != timestamp_masks_.end()) ? mask_entry->second : 0;
+
+    for (uint32_t i = 0; i < submit_count; ++i)
+    {
+        for (uint32_t j = 0; j < submits[i].commandBufferCount; ++j)
+        {
+            VkCommandBuffer command_buffer = submits[i].pCommandBuffers[j];
+            auto            entry          = command_buffers_.find(command_buffer);
+
+            if ((entry == command_buffers_.end()) || !entry->second.timed)
+            {
+                continue;
+            }
+
+            CommandBufferPasses& passes = entry->second;
+
+            // The queries of a command buffer that is submitted again are overwritten, so the results of its earlier
+            // submissions must be read first.
+            if (passes.pending_submits > 0)
+            {
+                ReadResults(false, command_buffer);
+            }
+
+            if (passes.incomplete)
+            {
+                PassTime pass_time;
+                pass_time.frame_number      = frame_number;
+                pass_time.command_buffer_id = passes.command_buffer_id;
+                pass_time.available         = false;
+                completed_passes_.push_back(pass_time);
+            }
+
+            if (!passes.passes.empty())
+            {
+                PendingSubmit submit;
+                submit.frame_number   = frame_number;
+                submit.command_buffer = command_buffer;
+                submit.passes         = &passes;
+                submit.timestamp_mask = timestamp_mask;
+                pending_submits_.push_back(submit);
+
+                ++passes.pending_submits;
+            }
+        }
+    }
+}
+
+void VulkanPassTimer::GetPassTimes(bool wait, std::vector<PassTime>* pass_times)
+{
+    assert(pass_times != nullptr);
+
+    ReadResults(wait, VK_NULL_HANDLE);
+
+    pass_times->insert(pass_times->end(), completed_passes_.begin(), completed_passes_.end());
+    completed_passes_.clear();
+}
+
+VulkanPassTimer::CommandBufferPasses* VulkanPassTimer::GetTimedPasses(VkCommandBuffer command_buffer)
+{
+    // The map is only modified when command buffers are begun, which is not concurrent with command recording.
+    auto entry = command_buffers_.find(command_buffer);
+
+    if ((entry != command_buffers_.end()) && entry->second.timed)
+    {
+        return &entry->second;
+    }
+
+    return nullptr;
+}
+
+bool VulkanPassTimer::BeginPass(VkCommandBuffer      command_buffer,
+                                CommandBufferPasses* passes,
+                                bool                 dispatch_group,
+                                format::HandleId     render_pass_id,
+                                format::HandleId     framebuffer_id)
+{
+    assert(passes != nullptr);
+
+    Pass pass;
+    pass.pass_index     = passes->pass_count++;
+    pass.dispatch_group = dispatch_group;
+    pass.render_pass_id = render_pass_id;
+    pass.framebuffer_id = framebuffer_id;
+
+    if (!AcquireQueryPair(&pass.queries))
+    {
+        passes->incomplete = true;
+        return false;
+    }
+
+    // The queries are reset by the command buffer, so that they are reset again each time it is submitted.
+    device_table_->CmdResetQueryPool(command_buffer, pass.queries.query_pool, pass.queries.first_query, 2);
+    device_table_->CmdWriteTimestamp(
+        command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pass.queries.query_pool, pass.queries.first_query);
+
+    passes->passes.push_back(pass);
+
+    return true;
+}
+
+void VulkanPassTimer::EndPass(VkCommandBuffer command_buffer, const CommandBufferPasses* passes)
+{
+    assert((passes != nullptr) && !passes->passes.empty());
+
+    const QueryPair& queries = passes->passes.back().queries;
+    device_table_->CmdWriteTimestamp(
+        command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queries.query_pool, queries.first_query + 1);
+}
+
+bool VulkanPassTimer::AcquireQueryPair(QueryPair* query_pair)
+{
+    assert(query_pair != nullptr);
+
+    std::lock_guard<std::mutex> lock(query_mutex_);
+
+    if (free_query_pairs_.empty() && (query_pools_.size() < kMaxPassQueryPools))
+    {
+        VkQueryPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+        create_info.pNext                 = nullptr;
+        create_info.flags                 = 0;
+        create_info.queryType             = VK_QUERY_TYPE_TIMESTAMP;
+        create_info.queryCount            = kPassQueryPoolSize;
+        create_info.pipelineStatistics    = 0;
+
+        VkQueryPool query_pool = VK_NULL_HANDLE;
+
+        if (device_table_->CreateQueryPool(device_, &create_info, nullptr, &query_pool) == VK_SUCCESS)
+        {
+            query_pools_.push_back(query_pool);
+
+            // Pairs are acquired from the back of the list, in query order.
+            for (uint32_t query = kPassQueryPoolSize; query > 0; query -= 2)
+            {
+                QueryPair pair;
+                pair.query_pool  = query_pool;
+                pair.first_query = query - 2;
+                free_query_pairs_.push_back(pair);
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING_ONCE(
+                "Failed to create a timestamp query pool for GPU pass timing; some passes will not be reported");
+        }
+    }
+
+    if (free_query_pairs_.empty())
+    {
+        if (!query_pools_exhausted_)
+        {
+            GFXRECON_LOG_WARNING("All %u timestamp queries for GPU pass timing are in use by recorded command buffers; "
+                                 "some passes will not be reported",
+                                 kMaxPassQueryPools * kPassQueryPoolSize);
+            query_pools_exhausted_ = true;
+        }
+
+        return false;
+    }
+
+    (*query_pair) = free_query_pairs_.back();
+    free_query_pairs_.pop_back();
+
+    return true;
+}
+
+void VulkanPassTimer::ReleaseQueryPairs(CommandBufferPasses* passes)
+{
+    assert((passes != nullptr) && (passes->pending_submits == 0));
+
+    std::lock_guard<std::mutex> lock(query_mutex_);
+
+    for (const Pass& pass : passes->passes)
+    {
+        free_query_pairs_.push_back(pass.queries);
+    }
+
+    passes->passes.clear();
+}
+
+void VulkanPassTimer::ReadResults(bool wait, VkCommandBuffer discard_command_buffer)
+{
+    VkQueryResultFlags flags = VK_QUERY_RESULT_64_BIT;
+
+    if (wait)
+    {
+        flags |= VK_QUERY_RESULT_WAIT_BIT;
+    }
+
+    size_t pending_count = 0;
+
+    for (PendingSubmit& submit : pending_submits_)
+    {
+        const std::vector<Pass>& passes   = submit.passes->passes;
+        bool                     complete = true;
+
+        while (submit.next_pass < passes.size())
+        {
+            PassTime pass_time;
+
+            if (!ReadPass(submit, passes[submit.next_pass], flags, &pass_time))
+            {
+                complete = false;
+                break;
+            }
+
+            completed_passes_.push_back(pass_time);
+            ++submit.next_pass;
+        }
+
+        // A command buffer that is submitted or begun again while a submission is pending was submitted for
+        // simultaneous use, or was never executed, and the passes that were not read are reported as unavailable.
+        if (!complete && (submit.command_buffer == discard_command_buffer))
+        {
+            PassTime pass_time;
+            pass_time.frame_number      = submit.frame_number;
+            pass_time.command_buffer_id = submit.passes->command_buffer_id;
+            pass_time.available         = false;
+            completed_passes_.push_back(pass_time);
+
+            complete = true;
+        }
+
+        if (complete)
+        {
+            --submit.passes->pending_submits;
+        }
+        else
+        {
+            pending_submits_[pending_count++] = submit;
+        }
+    }
+
+    pending_submits_.resize(pending_count);
+}
+
+bool VulkanPassTimer::ReadPass(const PendingSubmit& submit,
+                               const Pass&          pass,
+                               VkQueryResultFlags   flags,
+                               PassTime*            pass_time)
+{
+    assert(pass_time != nullptr);
+
+    uint64_t timestamps[2] = { 0, 0 };
+
+    VkResult result = device_table_->GetQueryPoolResults(device_,
+                                                         pass.queries.query_pool,
+                                                         pass.queries.first_query,
+                                                         2,
+                                                         sizeof(timestamps),
+                                                         timestamps,
+                                                         sizeof(timestamps[0]),
+                                                         flags);
+
+    if (result == VK_NOT_READY)
+    {
+        return false;
+    }
+
+    pass_time->frame_number      = submit.frame_number;
+    pass_time->command_buffer_id = submit.passes->command_buffer_id;
+    pass_time->pass_index        = pass.pass_index;
+    pass_time->dispatch_group    = pass.dispatch_group;
+    pass_time->render_pass_id    = pass.render_pass_id;
+    pass_time->framebuffer_id    = pass.framebuffer_id;
+
+    if ((result == VK_SUCCESS) && (submit.timestamp_mask != 0))
+    {
+        uint64_t ticks              = (timestamps[1] - timestamps[0]) & submit.timestamp_mask;
+        pass_time->gpu_milliseconds = (static_cast<double>(ticks) * timestamp_period_) / 1000000.0;
+    }
+    else
+    {
+        pass_time->available = false;
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
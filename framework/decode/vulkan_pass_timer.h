@@ -0,0 +1,177 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_PASS_TIMER_H
+#define GFXRECON_DECODE_VULKAN_PASS_TIMER_H
+
+#include "format/format.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Measures the GPU time of the render passes and dispatch groups of a device's primary command buffers, with timestamp
+// queries that the command buffers write before and after each pass.  A dispatch group spans the commands from a
+// dispatch that is recorded outside of a render pass to the next render pass or the end of the command buffer.  The
+// command buffers reset their own queries before writing them, so a command buffer keeps its queries when it is
+// submitted again, and returns them to the device's ring of query pools when it is begun again.  Results are read
+// without waiting when later submissions are made, so reading them does not stall replay.
+//
+// Commands may be recorded to different command buffers concurrently, but command buffer begin and end, and queue
+// submission, must not be concurrent with any other calls.
+class VulkanPassTimer
+{
+  public:
+    struct PassTime
+    {
+        uint64_t         frame_number{ 0 };
+        format::HandleId command_buffer_id{ format::kNullHandleId };
+        uint32_t         pass_index{ 0 };
+        bool             dispatch_group{ false };
+        format::HandleId render_pass_id{ format::kNullHandleId };
+        format::HandleId framebuffer_id{ format::kNullHandleId };
+        double           gpu_milliseconds{ 0.0 };
+        bool             available{ true };
+    };
+
+  public:
+    VulkanPassTimer(VkDevice device, const encode::DeviceTable* device_table, float timestamp_period);
+
+    ~VulkanPassTimer();
+
+    // Adds the queues that were created for a queue family, for the timestamp valid bits of their submissions.
+    void AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, uint32_t timestamp_valid_bits);
+
+    // Releases the queries of the previous recording of the command buffer.  The passes of the new recording are only
+    // timed when timed is true.
+    void BeginCommandBuffer(VkCommandBuffer command_buffer, format::HandleId command_buffer_id, bool timed);
+
+    // Closes the open dispatch group of the command buffer.
+    void EndCommandBuffer(VkCommandBuffer command_buffer);
+
+    // Writes the start timestamp of a render pass, which must be called before the render pass begin command is
+    // recorded.
+    void BeginRenderPass(VkCommandBuffer  command_buffer,
+                         format::HandleId render_pass_id,
+                         format::HandleId framebuffer_id);
+
+    // Writes the end timestamp of a render pass, which must be called after the render pass end command is recorded.
+    void EndRenderPass(VkCommandBuffer command_buffer);
+
+    // Opens a dispatch group when the command buffer does not have an open dispatch group, which must be called before
+    // the dispatch command is recorded.
+    void Dispatch(VkCommandBuffer command_buffer);
+
+    // Tracks the passes of the primary command buffers of a successful submission, which are reported for the frame.
+    void Submit(VkQueue queue, uint32_t submit_count, const VkSubmitInfo* submits, uint64_t frame_number);
+
+    // Retrieves the GPU times of the passes of completed submissions, optionally waiting for the submissions to
+    // complete.
+    void GetPassTimes(bool wait, std::vector<PassTime>* pass_times);
+
+  private:
+    struct QueryPair
+    {
+        VkQueryPool query_pool{ VK_NULL_HANDLE };
+        uint32_t    first_query{ 0 }; // The start timestamp's query, which is followed by the end timestamp's query.
+    };
+
+    struct Pass
+    {
+        QueryPair        queries;
+        uint32_t         pass_index{ 0 };
+        bool             dispatch_group{ false };
+        format::HandleId render_pass_id{ format::kNullHandleId };
+        format::HandleId framebuffer_id{ format::kNullHandleId };
+    };
+
+    struct CommandBufferPasses
+    {
+        format::HandleId  command_buffer_id{ format::kNullHandleId };
+        bool              timed{ false };
+        bool              incomplete{ false }; // Set when a pass could not be timed.
+        bool              render_pass_open{ false };
+        bool              dispatch_group_open{ false };
+        uint32_t          pass_count{ 0 }; // Number of passes recorded, including the passes that are not timed.
+        std::vector<Pass> passes;
+        uint32_t          pending_submits{ 0 };
+    };
+
+    struct PendingSubmit
+    {
+        uint64_t             frame_number{ 0 };
+        VkCommandBuffer      command_buffer{ VK_NULL_HANDLE };
+        CommandBufferPasses* passes{ nullptr }; // Passes are not recorded again while the submission is pending.
+        size_t               next_pass{ 0 };
+        uint64_t             timestamp_mask{ 0 };
+    };
+
+  private:
+    CommandBufferPasses* GetTimedPasses(VkCommandBuffer command_buffer);
+
+    // Writes the start timestamp of a new pass.  Returns false when all of the query pools are in use.
+    bool BeginPass(VkCommandBuffer      command_buffer,
+                   CommandBufferPasses* passes,
+                   bool                 dispatch_group,
+                   format::HandleId     render_pass_id,
+                   format::HandleId     framebuffer_id);
+
+    void EndPass(VkCommandBuffer command_buffer, const CommandBufferPasses* passes);
+
+    bool AcquireQueryPair(QueryPair* query_pair);
+
+    void ReleaseQueryPairs(CommandBufferPasses* passes);
+
+    // Reads the results of the pending submissions, and reports the passes of the pending submissions of the command
+    // buffer that are not complete as unavailable, for a command buffer that is submitted or begun again.
+    void ReadResults(bool wait, VkCommandBuffer discard_command_buffer);
+
+    // Returns false when the results of the pass are not ready.
+    bool ReadPass(const PendingSubmit& submit, const Pass& pass, VkQueryResultFlags flags, PassTime* pass_time);
+
+  private:
+    VkDevice                                                 device_;
+    const encode::DeviceTable*                               device_table_;
+    double                                                   timestamp_period_;
+    std::unordered_map<VkQueue, uint64_t>                    timestamp_masks_;
+    std::unordered_map<VkCommandBuffer, CommandBufferPasses> command_buffers_;
+    std::vector<PendingSubmit>                               pending_submits_;
+    std::vector<PassTime>                                    completed_passes_;
+    std::mutex                                               query_mutex_;
+    std::vector<VkQueryPool>                                 query_pools_;
+    std::vector<QueryPair>                                   free_query_pairs_;
+    bool                                                     query_pools_exhausted_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PASS_TIMER_H
@@ -0,0 +1,127 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_pipeline_prescan_consumer.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+void VulkanPipelinePrescanConsumer::Process_vkCreateShaderModule(
+    VkResult                                                returnValue,
+    format::HandleId                                        device,
+    StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
+    HandlePointerDecoder<VkShaderModule>*                   pShaderModule)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    assert((pCreateInfo != nullptr) && (pShaderModule != nullptr));
+
+    const VkShaderModuleCreateInfo* create_info = pCreateInfo->GetPointer();
+    const format::HandleId*         ids         = pShaderModule->GetPointer();
+
+    if ((returnValue == VK_SUCCESS) && (create_info != nullptr) && (create_info->pCode != nullptr) && (ids != nullptr))
+    {
+        PrescannedShaderModule shader_module;
+        shader_module.device_id        = device;
+        shader_module.shader_module_id = ids[0];
+        shader_module.flags            = create_info->flags;
+        shader_module.code.assign(create_info->pCode, create_info->pCode + (create_info->codeSize / sizeof(uint32_t)));
+
+        data_->shader_modules.emplace_back(std::move(shader_module));
+    }
+}
+
+void VulkanPipelinePrescanConsumer::Process_vkCreateGraphicsPipelines(
+    VkResult                                                    returnValue,
+    format::HandleId                                            device,
+    format::HandleId                                            pipelineCache,
+    uint32_t                                                    createInfoCount,
+    StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+    HandlePointerDecoder<VkPipeline>*                           pPipelines)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    assert(pCreateInfos != nullptr);
+
+    PrescannedPipelines prescanned;
+    prescanned.graphics_create_infos = pCreateInfos->GetMetaStructPointer();
+
+    if ((returnValue == VK_SUCCESS) && (prescanned.graphics_create_infos != nullptr) &&
+        AddPipelines(device, pipelineCache, createInfoCount, pPipelines, &prescanned))
+    {
+        data_->pipelines.emplace_back(std::move(prescanned));
+    }
+}
+
+void VulkanPipelinePrescanConsumer::Process_vkCreateComputePipelines(
+    VkResult                                                   returnValue,
+    format::HandleId                                           device,
+    format::HandleId                                           pipelineCache,
+    uint32_t                                                   createInfoCount,
+    StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+    HandlePointerDecoder<VkPipeline>*                          pPipelines)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    assert(pCreateInfos != nullptr);
+
+    PrescannedPipelines prescanned;
+    prescanned.compute_create_infos = pCreateInfos->GetMetaStructPointer();
+
+    if ((returnValue == VK_SUCCESS) && (prescanned.compute_create_infos != nullptr) &&
+        AddPipelines(device, pipelineCache, createInfoCount, pPipelines, &prescanned))
+    {
+        data_->pipelines.emplace_back(std::move(prescanned));
+    }
+}
+
+bool VulkanPipelinePrescanConsumer::AddPipelines(format::HandleId                  device,
+                                                 format::HandleId                  pipeline_cache,
+                                                 uint32_t                          create_info_count,
+                                                 HandlePointerDecoder<VkPipeline>* pipelines,
+                                                 PrescannedPipelines*              prescanned)
+{
+    assert(prescanned != nullptr);
+
+    if ((create_info_count == 0) || (pipelines == nullptr) || (pipelines->GetPointer() == nullptr) ||
+        (pipelines->GetLength() < create_info_count))
+    {
+        return false;
+    }
+
+    prescanned->device_id         = device;
+    prescanned->pipeline_cache_id = pipeline_cache;
+    prescanned->pipeline_ids.assign(pipelines->GetPointer(), pipelines->GetPointer() + create_info_count);
+
+    // Keep the decoded create infos, which are released by the file processor at the end of the call.
+    prescanned->decoded_data = std::shared_ptr<DecodeAllocator>(DecodeAllocator::DetachInstance());
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
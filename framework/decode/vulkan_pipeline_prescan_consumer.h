@@ -0,0 +1,115 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_PIPELINE_PRESCAN_CONSUMER_H
+#define GFXRECON_DECODE_VULKAN_PIPELINE_PRESCAN_CONSUMER_H
+
+#include "decode/decode_allocator.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+struct PrescannedShaderModule
+{
+    format::HandleId          device_id{ format::kNullHandleId };
+    format::HandleId          shader_module_id{ format::kNullHandleId };
+    VkShaderModuleCreateFlags flags{ 0 };
+    std::vector<uint32_t>     code;
+};
+
+// A graphics or compute pipeline creation call, with the create infos as decoded from the capture file.  The handle
+// IDs of the create infos have not been mapped.
+struct PrescannedPipelines
+{
+    format::HandleId                      device_id{ format::kNullHandleId };
+    format::HandleId                      pipeline_cache_id{ format::kNullHandleId };
+    std::vector<format::HandleId>         pipeline_ids;
+    Decoded_VkGraphicsPipelineCreateInfo* graphics_create_infos{ nullptr };
+    Decoded_VkComputePipelineCreateInfo*  compute_create_infos{ nullptr };
+    std::shared_ptr<DecodeAllocator>      decoded_data; // Owns the memory of the decoded create infos.
+};
+
+struct PrescannedPipelineData
+{
+    std::vector<PrescannedShaderModule> shader_modules;
+    std::vector<PrescannedPipelines>    pipelines;
+};
+
+// Collects the shader module and pipeline creation calls of a capture file, so that replay can create the pipelines
+// ahead of the calls.  Only calls that succeeded during capture are collected.  Must not be used with lazy pNext
+// decoding, as the create infos are retained after the pNext structures would have been decoded.
+class VulkanPipelinePrescanConsumer : public VulkanConsumer
+{
+  public:
+    VulkanPipelinePrescanConsumer() : data_(std::make_shared<PrescannedPipelineData>()) {}
+
+    virtual ~VulkanPipelinePrescanConsumer() override {}
+
+    const std::shared_ptr<PrescannedPipelineData>& GetData() const { return data_; }
+
+    virtual void Process_vkCreateShaderModule(VkResult                                                returnValue,
+                                              format::HandleId                                        device,
+                                              StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+                                              StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
+                                              HandlePointerDecoder<VkShaderModule>* pShaderModule) override;
+
+    virtual void
+    Process_vkCreateGraphicsPipelines(VkResult                                                    returnValue,
+                                      format::HandleId                                            device,
+                                      format::HandleId                                            pipelineCache,
+                                      uint32_t                                                    createInfoCount,
+                                      StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+                                      StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+                                      HandlePointerDecoder<VkPipeline>*                           pPipelines) override;
+
+    virtual void
+    Process_vkCreateComputePipelines(VkResult                                                   returnValue,
+                                     format::HandleId                                           device,
+                                     format::HandleId                                           pipelineCache,
+                                     uint32_t                                                   createInfoCount,
+                                     StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+                                     StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+                                     HandlePointerDecoder<VkPipeline>*                          pPipelines) override;
+
+  private:
+    bool AddPipelines(format::HandleId                  device,
+                      format::HandleId                  pipeline_cache,
+                      uint32_t                          create_info_count,
+                      HandlePointerDecoder<VkPipeline>* pipelines,
+                      PrescannedPipelines*              prescanned);
+
+  private:
+    std::shared_ptr<PrescannedPipelineData> data_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PIPELINE_PRESCAN_CONSUMER_H
@@ -0,0 +1,193 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_pool_cache.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Limit on the pools that are kept with the same key, which bounds the memory held by pools that are destroyed in bulk
+// and never created again.
+const size_t kMaxPoolsPerKey = 16;
+
+template <typename T>
+static void AppendKeyValue(const T& value, std::string* key)
+{
+    key->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename Handle>
+static Handle AcquirePool(const std::string& key, std::unordered_multimap<std::string, Handle>* pools)
+{
+    Handle pool  = VK_NULL_HANDLE;
+    auto   entry = pools->find(key);
+
+    if (entry != pools->end())
+    {
+        pool = entry->second;
+        pools->erase(entry);
+    }
+
+    return pool;
+}
+
+VulkanPoolCache::VulkanPoolCache(VkDevice device, const encode::DeviceTable* device_table) :
+    device_(device), device_table_(device_table), reuse_count_(0)
+{
+    assert((device != VK_NULL_HANDLE) && (device_table != nullptr));
+}
+
+VulkanPoolCache::~VulkanPoolCache()
+{
+    for (const auto& entry : descriptor_pools_)
+    {
+        device_table_->DestroyDescriptorPool(device_, entry.second, nullptr);
+    }
+
+    for (const auto& entry : command_pools_)
+    {
+        device_table_->DestroyCommandPool(device_, entry.second, nullptr);
+    }
+}
+
+bool VulkanPoolCache::GetDescriptorPoolKey(const VkDescriptorPoolCreateInfo* create_info, std::string* key)
+{
+    assert((create_info != nullptr) && (key != nullptr));
+
+    uint32_t max_inline_uniform_block_bindings = 0;
+
+    auto next = reinterpret_cast<const VkBaseInStructure*>(create_info->pNext);
+    while (next != nullptr)
+    {
+        if (next->sType != VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT)
+        {
+            return false;
+        }
+
+        max_inline_uniform_block_bindings =
+            reinterpret_cast<const VkDescriptorPoolInlineUniformBlockCreateInfoEXT*>(next)
+                ->maxInlineUniformBlockBindings;
+        next = next->pNext;
+    }
+
+    key->clear();
+    AppendKeyValue(create_info->flags, key);
+    AppendKeyValue(create_info->maxSets, key);
+    AppendKeyValue(max_inline_uniform_block_bindings, key);
+    AppendKeyValue(create_info->poolSizeCount, key);
+
+    for (uint32_t i = 0; i < create_info->poolSizeCount; ++i)
+    {
+        AppendKeyValue(create_info->pPoolSizes[i].type, key);
+        AppendKeyValue(create_info->pPoolSizes[i].descriptorCount, key);
+    }
+
+    return true;
+}
+
+bool VulkanPoolCache::GetCommandPoolKey(const VkCommandPoolCreateInfo* create_info, std::string* key)
+{
+    assert((create_info != nullptr) && (key != nullptr));
+
+    if (create_info->pNext != nullptr)
+    {
+        return false;
+    }
+
+    key->clear();
+    AppendKeyValue(create_info->flags, key);
+    AppendKeyValue(create_info->queueFamilyIndex, key);
+
+    return true;
+}
+
+bool VulkanPoolCache::RetainDescriptorPool(const std::string& key, VkDescriptorPool pool)
+{
+    if (descriptor_pools_.count(key) >= kMaxPoolsPerKey)
+    {
+        return false;
+    }
+
+    // The descriptor sets allocated from a pool that is being destroyed are no longer in use, so they can be freed by a
+    // reset of the pool.
+    if (device_table_->ResetDescriptorPool(device_, pool, 0) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    descriptor_pools_.emplace(key, pool);
+    return true;
+}
+
+VkDescriptorPool VulkanPoolCache::AcquireDescriptorPool(const std::string& key)
+{
+    VkDescriptorPool pool = AcquirePool(key, &descriptor_pools_);
+
+    if (pool != VK_NULL_HANDLE)
+    {
+        ++reuse_count_;
+    }
+
+    return pool;
+}
+
+bool VulkanPoolCache::RetainCommandPool(const std::string&                  key,
+                                        VkCommandPool                       pool,
+                                        const std::vector<VkCommandBuffer>& buffers)
+{
+    if (command_pools_.count(key) >= kMaxPoolsPerKey)
+    {
+        return false;
+    }
+
+    // The command buffers that were implicitly freed by the destroy are freed explicitly, so that a reused pool only
+    // contains the command buffers that are allocated after it is reused.
+    if (!buffers.empty())
+    {
+        device_table_->FreeCommandBuffers(device_, pool, static_cast<uint32_t>(buffers.size()), buffers.data());
+    }
+
+    if (device_table_->ResetCommandPool(device_, pool, VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    command_pools_.emplace(key, pool);
+    return true;
+}
+
+VkCommandPool VulkanPoolCache::AcquireCommandPool(const std::string& key)
+{
+    VkCommandPool pool = AcquirePool(key, &command_pools_);
+
+    if (pool != VK_NULL_HANDLE)
+    {
+        ++reuse_count_;
+    }
+
+    return pool;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
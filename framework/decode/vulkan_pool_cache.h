@@ -0,0 +1,85 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_POOL_CACHE_H
+#define GFXRECON_DECODE_VULKAN_POOL_CACHE_H
+
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Keeps the descriptor and command pools of a device that replay would destroy, so that a later create with the same
+// create parameters can reuse a reset pool in place of creating a new pool.  Pools are matched by a key that is built
+// from their create info, and the pools that are not reused are destroyed with the cache.
+class VulkanPoolCache
+{
+  public:
+    VulkanPoolCache(VkDevice device, const encode::DeviceTable* device_table);
+
+    ~VulkanPoolCache();
+
+    // Builds the key that matches descriptor pools with the same create parameters.  Returns false when the create
+    // info has extension structures that prevent the pool from being reused.
+    static bool GetDescriptorPoolKey(const VkDescriptorPoolCreateInfo* create_info, std::string* key);
+
+    // Builds the key that matches command pools with the same create parameters.  Returns false when the create info
+    // has extension structures that prevent the pool from being reused.
+    static bool GetCommandPoolKey(const VkCommandPoolCreateInfo* create_info, std::string* key);
+
+    // Resets a descriptor pool and keeps it for reuse.  Returns false if the pool was not kept, in which case the
+    // caller must destroy it.
+    bool RetainDescriptorPool(const std::string& key, VkDescriptorPool pool);
+
+    // Removes and returns a kept descriptor pool with the key, or VK_NULL_HANDLE when there is no match.
+    VkDescriptorPool AcquireDescriptorPool(const std::string& key);
+
+    // Frees the command buffers that remain allocated from a command pool, resets the pool, releasing its resources,
+    // and keeps it for reuse.  Returns false if the pool was not kept, in which case the caller must destroy it.
+    bool RetainCommandPool(const std::string& key, VkCommandPool pool, const std::vector<VkCommandBuffer>& buffers);
+
+    // Removes and returns a kept command pool with the key, or VK_NULL_HANDLE when there is no match.
+    VkCommandPool AcquireCommandPool(const std::string& key);
+
+    // Returns the number of creates that reused a kept pool.
+    uint64_t GetReuseCount() const { return reuse_count_; }
+
+  private:
+    VkDevice                                               device_;
+    const encode::DeviceTable*                             device_table_;
+    std::unordered_multimap<std::string, VkDescriptorPool> descriptor_pools_;
+    std::unordered_multimap<std::string, VkCommandPool>    command_pools_;
+    uint64_t                                               reuse_count_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_POOL_CACHE_H
@@ -0,0 +1,461 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_present_image_copier.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Number of presents that each queue family can have in flight.
+const uint32_t kCopySlotCount = 8;
+
+VulkanPresentImageCopier::VulkanPresentImageCopier(VkDevice device, const encode::DeviceTable* device_table) :
+    device_(device), device_table_(device_table)
+{
+    assert((device_ != VK_NULL_HANDLE) && (device_table_ != nullptr));
+}
+
+VulkanPresentImageCopier::~VulkanPresentImageCopier()
+{
+    WaitForCopies();
+
+    for (auto& entry : families_)
+    {
+        QueueFamily& family = entry.second;
+
+        if (family.command_pool != VK_NULL_HANDLE)
+        {
+            for (CopySlot& slot : family.slots)
+            {
+                DestroySlot(family.command_pool, &slot);
+            }
+
+            device_table_->DestroyCommandPool(device_, family.command_pool, nullptr);
+        }
+    }
+}
+
+void VulkanPresentImageCopier::AddQueueFamily(uint32_t     queue_family_index,
+                                              uint32_t     queue_count,
+                                              VkQueueFlags queue_flags)
+{
+    QueueFamily& family = families_[queue_family_index];
+
+    // Graphics and compute queues support transfer commands without reporting the transfer flag.
+    const VkQueueFlags transfer_flags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+
+    if (((queue_flags & transfer_flags) != 0) && (family.command_pool == VK_NULL_HANDLE))
+    {
+        VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        create_info.pNext                   = nullptr;
+        create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        create_info.queueFamilyIndex        = queue_family_index;
+
+        if (device_table_->CreateCommandPool(device_, &create_info, nullptr, &family.command_pool) == VK_SUCCESS)
+        {
+            family.slots.resize(kCopySlotCount);
+        }
+        else
+        {
+            family.command_pool = VK_NULL_HANDLE;
+        }
+    }
+
+    for (uint32_t i = 0; i < queue_count; ++i)
+    {
+        VkQueue queue = VK_NULL_HANDLE;
+        device_table_->GetDeviceQueue(device_, queue_family_index, i, &queue);
+
+        if (queue != VK_NULL_HANDLE)
+        {
+            queue_families_[queue] = &family;
+        }
+    }
+}
+
+VkResult VulkanPresentImageCopier::AddSwapchain(VkSwapchainKHR swapchain)
+{
+    uint32_t count  = 0;
+    VkResult result = device_table_->GetSwapchainImagesKHR(device_, swapchain, &count, nullptr);
+
+    if (result == VK_SUCCESS)
+    {
+        std::vector<VkImage> images(count, VK_NULL_HANDLE);
+        result = device_table_->GetSwapchainImagesKHR(device_, swapchain, &count, images.data());
+
+        if (result == VK_SUCCESS)
+        {
+            images.resize(count);
+            swapchain_images_[swapchain] = std::move(images);
+        }
+    }
+
+    return result;
+}
+
+void VulkanPresentImageCopier::RemoveSwapchain(VkSwapchainKHR swapchain)
+{
+    if (swapchain_images_.erase(swapchain) > 0)
+    {
+        WaitForCopies();
+    }
+}
+
+VkResult VulkanPresentImageCopier::Present(VkQueue                  queue,
+                                           uint32_t                 wait_semaphore_count,
+                                           const VkSemaphore*       wait_semaphores,
+                                           const std::vector<Copy>& copies)
+{
+    auto entry = queue_families_.find(queue);
+
+    if ((entry == queue_families_.end()) || (entry->second->command_pool == VK_NULL_HANDLE))
+    {
+        GFXRECON_LOG_WARNING_ONCE("Presents to a queue that does not support transfer commands cannot be replayed with "
+                                  "the overridden present mode");
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
+    QueueFamily* family = entry->second;
+    CopySlot*    slot   = &family->slots[family->next_slot];
+    family->next_slot   = (family->next_slot + 1) % kCopySlotCount;
+
+    VkResult result = PrepareSlot(family, slot, copies.size());
+
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    std::vector<VkSemaphore>          semaphores(wait_semaphores, wait_semaphores + wait_semaphore_count);
+    std::vector<VkPipelineStageFlags> stages(wait_semaphore_count, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    std::vector<VkSwapchainKHR>       swapchains;
+    std::vector<uint32_t>             image_indices;
+
+    VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin_info.pNext                    = nullptr;
+    begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    begin_info.pInheritanceInfo         = nullptr;
+
+    result = device_table_->BeginCommandBuffer(slot->command_buffer, &begin_info);
+
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    for (size_t i = 0; i < copies.size(); ++i)
+    {
+        const Copy& copy   = copies[i];
+        auto        images = swapchain_images_.find(copy.swapchain);
+
+        if (images == swapchain_images_.end())
+        {
+            continue;
+        }
+
+        uint32_t image_index    = 0;
+        VkResult acquire_result = device_table_->AcquireNextImageKHR(device_,
+                                                                     copy.swapchain,
+                                                                     std::numeric_limits<uint64_t>::max(),
+                                                                     slot->acquire_semaphores[i],
+                                                                     VK_NULL_HANDLE,
+                                                                     &image_index);
+
+        if (((acquire_result == VK_SUCCESS) || (acquire_result == VK_SUBOPTIMAL_KHR)) &&
+            (image_index < images->second.size()))
+        {
+            RecordCopy(slot->command_buffer, copy, images->second[image_index]);
+
+            semaphores.push_back(slot->acquire_semaphores[i]);
+            stages.push_back(VK_PIPELINE_STAGE_TRANSFER_BIT);
+            swapchains.push_back(copy.swapchain);
+            image_indices.push_back(image_index);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Failed to acquire a swapchain image for present with the overridden present mode "
+                                 "(error = %d); the frame will not be presented",
+                                 acquire_result);
+            result = acquire_result;
+        }
+    }
+
+    VkResult end_result = device_table_->EndCommandBuffer(slot->command_buffer);
+
+    if (end_result != VK_SUCCESS)
+    {
+        return end_result;
+    }
+
+    // The present semaphore is only signaled when it will be waited on by a present.
+    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit_info.pNext                = nullptr;
+    submit_info.waitSemaphoreCount   = static_cast<uint32_t>(semaphores.size());
+    submit_info.pWaitSemaphores      = semaphores.data();
+    submit_info.pWaitDstStageMask    = stages.data();
+    submit_info.commandBufferCount   = 1;
+    submit_info.pCommandBuffers      = &slot->command_buffer;
+    submit_info.signalSemaphoreCount = swapchains.empty() ? 0 : 1;
+    submit_info.pSignalSemaphores    = &slot->present_semaphore;
+
+    VkResult submit_result = device_table_->QueueSubmit(queue, 1, &submit_info, slot->fence);
+
+    if (submit_result != VK_SUCCESS)
+    {
+        return submit_result;
+    }
+
+    slot->pending = true;
+
+    if (!swapchains.empty())
+    {
+        VkPresentInfoKHR present_info   = { VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
+        present_info.pNext              = nullptr;
+        present_info.waitSemaphoreCount = 1;
+        present_info.pWaitSemaphores    = &slot->present_semaphore;
+        present_info.swapchainCount     = static_cast<uint32_t>(swapchains.size());
+        present_info.pSwapchains        = swapchains.data();
+        present_info.pImageIndices      = image_indices.data();
+        present_info.pResults           = nullptr;
+
+        VkResult present_result = device_table_->QueuePresentKHR(queue, &present_info);
+
+        // Suboptimal presents are expected when the present mode differs from the mode the window was created for.
+        if ((present_result != VK_SUCCESS) && (present_result != VK_SUBOPTIMAL_KHR))
+        {
+            result = present_result;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanPresentImageCopier::PrepareSlot(QueueFamily* family, CopySlot* slot, size_t copy_count)
+{
+    assert((family != nullptr) && (slot != nullptr));
+
+    VkResult result = VK_SUCCESS;
+
+    if (slot->command_buffer == VK_NULL_HANDLE)
+    {
+        VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        allocate_info.pNext                       = nullptr;
+        allocate_info.commandPool                 = family->command_pool;
+        allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocate_info.commandBufferCount          = 1;
+
+        VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        fence_create_info.pNext             = nullptr;
+        fence_create_info.flags             = 0;
+
+        VkSemaphoreCreateInfo semaphore_create_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+        semaphore_create_info.pNext                 = nullptr;
+        semaphore_create_info.flags                 = 0;
+
+        result = device_table_->AllocateCommandBuffers(device_, &allocate_info, &slot->command_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table_->CreateFence(device_, &fence_create_info, nullptr, &slot->fence);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table_->CreateSemaphore(device_, &semaphore_create_info, nullptr, &slot->present_semaphore);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            DestroySlot(family->command_pool, slot);
+        }
+    }
+    else if (slot->pending)
+    {
+        result = device_table_->WaitForFences(device_, 1, &slot->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table_->ResetFences(device_, 1, &slot->fence);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            slot->pending = false;
+        }
+    }
+
+    while ((result == VK_SUCCESS) && (slot->acquire_semaphores.size() < copy_count))
+    {
+        VkSemaphoreCreateInfo semaphore_create_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+        semaphore_create_info.pNext                 = nullptr;
+        semaphore_create_info.flags                 = 0;
+
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        result                = device_table_->CreateSemaphore(device_, &semaphore_create_info, nullptr, &semaphore);
+
+        if (result == VK_SUCCESS)
+        {
+            slot->acquire_semaphores.push_back(semaphore);
+        }
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_WARNING_ONCE("Failed to create the resources to present with the overridden present mode");
+    }
+
+    return result;
+}
+
+void VulkanPresentImageCopier::RecordCopy(VkCommandBuffer command_buffer, const Copy& copy, VkImage destination)
+{
+    VkImageSubresourceRange range;
+    range.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    range.baseMipLevel   = 0;
+    range.levelCount     = 1;
+    range.baseArrayLayer = 0;
+    range.layerCount     = copy.layer_count;
+
+    VkImageMemoryBarrier barriers[2];
+    barriers[0]                     = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    barriers[0].pNext               = nullptr;
+    barriers[0].srcAccessMask       = 0;
+    barriers[0].dstAccessMask       = VK_ACCESS_TRANSFER_READ_BIT;
+    barriers[0].oldLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    barriers[0].newLayout           = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barriers[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barriers[0].image               = copy.source;
+    barriers[0].subresourceRange    = range;
+
+    // The previous contents of the acquired image are discarded.
+    barriers[1]               = barriers[0];
+    barriers[1].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].oldLayout     = VK_IMAGE_LAYOUT_UNDEFINED;
+    barriers[1].newLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[1].image         = destination;
+
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      2,
+                                      barriers);
+
+    VkImageCopy region;
+    region.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.srcSubresource.mipLevel       = 0;
+    region.srcSubresource.baseArrayLayer = 0;
+    region.srcSubresource.layerCount     = copy.layer_count;
+    region.srcOffset                     = { 0, 0, 0 };
+    region.dstSubresource                = region.srcSubresource;
+    region.dstOffset                     = { 0, 0, 0 };
+    region.extent                        = { copy.width, copy.height, 1 };
+
+    device_table_->CmdCopyImage(command_buffer,
+                                copy.source,
+                                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                destination,
+                                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                1,
+                                &region);
+
+    // The virtual image is returned to the layout that replay left it in, for the next present of the same image.
+    barriers[0].srcAccessMask = 0;
+    barriers[0].dstAccessMask = 0;
+    barriers[0].oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].newLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    barriers[1].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].dstAccessMask = 0;
+    barriers[1].oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[1].newLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      2,
+                                      barriers);
+}
+
+void VulkanPresentImageCopier::WaitForCopies()
+{
+    for (auto& entry : families_)
+    {
+        for (CopySlot& slot : entry.second.slots)
+        {
+            if (slot.pending)
+            {
+                device_table_->WaitForFences(device_, 1, &slot.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+                device_table_->ResetFences(device_, 1, &slot.fence);
+                slot.pending = false;
+            }
+        }
+    }
+}
+
+void VulkanPresentImageCopier::DestroySlot(VkCommandPool command_pool, CopySlot* slot)
+{
+    assert(slot != nullptr);
+
+    if (slot->command_buffer != VK_NULL_HANDLE)
+    {
+        device_table_->FreeCommandBuffers(device_, command_pool, 1, &slot->command_buffer);
+        slot->command_buffer = VK_NULL_HANDLE;
+    }
+
+    if (slot->fence != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyFence(device_, slot->fence, nullptr);
+        slot->fence = VK_NULL_HANDLE;
+    }
+
+    if (slot->present_semaphore != VK_NULL_HANDLE)
+    {
+        device_table_->DestroySemaphore(device_, slot->present_semaphore, nullptr);
+        slot->present_semaphore = VK_NULL_HANDLE;
+    }
+
+    for (VkSemaphore semaphore : slot->acquire_semaphores)
+    {
+        device_table_->DestroySemaphore(device_, semaphore, nullptr);
+    }
+
+    slot->acquire_semaphores.clear();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
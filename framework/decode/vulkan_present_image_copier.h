@@ -0,0 +1,116 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_PRESENT_IMAGE_COPIER_H
+#define GFXRECON_DECODE_VULKAN_PRESENT_IMAGE_COPIER_H
+
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Presents the images of virtual swapchains through swapchains that were created with a different present mode.  The
+// acquire order of a swapchain with an unlocked present mode is unrelated to the captured acquire order, so replay
+// renders to the images of a virtual swapchain, which are indexed by the captured image indices, and each present
+// acquires an image from the replay swapchain and copies the virtual image to it before presenting it.  The copies are
+// recorded to command buffers from a fixed size ring, which are reused after their previous submission has completed.
+class VulkanPresentImageCopier
+{
+  public:
+    struct Copy
+    {
+        VkSwapchainKHR swapchain{ VK_NULL_HANDLE }; // Replay swapchain to present the image with.
+        VkImage        source{ VK_NULL_HANDLE };    // Virtual swapchain image, in the present source layout.
+        uint32_t       width{ 0 };
+        uint32_t       height{ 0 };
+        uint32_t       layer_count{ 1 };
+    };
+
+  public:
+    VulkanPresentImageCopier(VkDevice device, const encode::DeviceTable* device_table);
+
+    ~VulkanPresentImageCopier();
+
+    // Adds the queues that were created for a queue family, which can present copies when the family supports
+    // transfer commands.
+    void AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, VkQueueFlags queue_flags);
+
+    // Retrieves the images of a replay swapchain that presents copies.
+    VkResult AddSwapchain(VkSwapchainKHR swapchain);
+
+    // Waits for the pending copies to the images of a replay swapchain, which is being destroyed.
+    void RemoveSwapchain(VkSwapchainKHR swapchain);
+
+    // Acquires an image from the replay swapchain of each copy and copies the virtual image to it, with a submission
+    // that waits on the present's wait semaphores, and then presents the acquired images.  The wait semaphores are
+    // unsignaled by the submission even when no image could be acquired.
+    VkResult Present(VkQueue                  queue,
+                     uint32_t                 wait_semaphore_count,
+                     const VkSemaphore*       wait_semaphores,
+                     const std::vector<Copy>& copies);
+
+  private:
+    struct CopySlot
+    {
+        VkCommandBuffer          command_buffer{ VK_NULL_HANDLE };
+        VkFence                  fence{ VK_NULL_HANDLE };
+        VkSemaphore              present_semaphore{ VK_NULL_HANDLE };
+        std::vector<VkSemaphore> acquire_semaphores;
+        bool                     pending{ false };
+    };
+
+    struct QueueFamily
+    {
+        VkCommandPool         command_pool{ VK_NULL_HANDLE };
+        std::vector<CopySlot> slots;
+        uint32_t              next_slot{ 0 };
+    };
+
+  private:
+    // Waits for the previous submission of a slot and creates the synchronization objects for its next submission.
+    VkResult PrepareSlot(QueueFamily* family, CopySlot* slot, size_t copy_count);
+
+    void RecordCopy(VkCommandBuffer command_buffer, const Copy& copy, VkImage destination);
+
+    void WaitForCopies();
+
+    void DestroySlot(VkCommandPool command_pool, CopySlot* slot);
+
+  private:
+    VkDevice                                                 device_;
+    const encode::DeviceTable*                               device_table_;
+    std::unordered_map<VkQueue, QueueFamily*>                queue_families_;
+    std::unordered_map<uint32_t, QueueFamily>                families_;
+    std::unordered_map<VkSwapchainKHR, std::vector<VkImage>> swapchain_images_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PRESENT_IMAGE_COPIER_H
@@ -82,11 +82,29 @@ VkResult VulkanRealignAllocator::AllocateMemory(const VkMemoryAllocateInfo*  all
 
         result = VulkanDefaultAllocator::AllocateMemory(
             &realign_allocate_info, allocation_callbacks, capture_id, memory, allocator_data);
+
+        if (result == VK_SUCCESS)
+        {
+            CreateBoundResourceRanges(capture_id);
+        }
     }
 
     return result;
 }
 
+void VulkanRealignAllocator::FreeMemory(VkDeviceMemory               memory,
+                                        const VkAllocationCallbacks* allocation_callbacks,
+                                        MemoryData                   allocator_data)
+{
+    auto memory_info = GetMemoryAllocInfo(allocator_data);
+    if (memory_info != nullptr)
+    {
+        bound_resource_ranges_.erase(memory_info->capture_id);
+    }
+
+    VulkanDefaultAllocator::FreeMemory(memory, allocation_callbacks, allocator_data);
+}
+
 VkResult VulkanRealignAllocator::BindBufferMemory(VkBuffer               buffer,
                                                   VkDeviceMemory         memory,
                                                   VkDeviceSize           memory_offset,
@@ -230,7 +248,7 @@ VkResult VulkanRealignAllocator::MapMemory(VkDeviceMemory   memory,
         }
 
         // Update map memory offset.
-        realign_offset = FindMatchingResourceOffset(tracked_memory_info, offset);
+        realign_offset = FindMatchingResourceOffset(memory_info->capture_id, offset);
     }
 
     return VulkanDefaultAllocator::MapMemory(memory, realign_offset, size, flags, data, allocator_data);
@@ -280,24 +298,72 @@ VkResult VulkanRealignAllocator::WriteMappedMemoryRange(MemoryData     allocator
     return result;
 }
 
-// Util function to find the matching offset with the resources offsets.
-VkDeviceSize VulkanRealignAllocator::FindMatchingResourceOffset(const TrackedDeviceMemoryInfo* tracked_memory_info,
-                                                                VkDeviceSize                   offset) const
+void VulkanRealignAllocator::CreateBoundResourceRanges(format::HandleId capture_id)
 {
+    auto tracked_memory_info = tracked_object_table_->GetTrackedDeviceMemoryInfo(capture_id);
     assert(tracked_memory_info != nullptr);
 
     auto tracked_bound_resources = tracked_memory_info->GetBoundResourcesList();
     assert(tracked_bound_resources != nullptr);
 
-    for (auto entry : (*tracked_bound_resources))
+    if (!tracked_bound_resources->empty())
+    {
+        BoundResourceRanges& ranges = bound_resource_ranges_[capture_id];
+        ranges.reserve(tracked_bound_resources->size());
+
+        for (auto entry : (*tracked_bound_resources))
+        {
+            assert(entry != nullptr);
+
+            VkDeviceSize trace_begin = entry->GetTraceBindOffset();
+            VkDeviceSize trace_end   = trace_begin + entry->GetReplayResourceSize();
+
+            ranges.push_back(
+                { trace_begin, trace_end, trace_end, entry->GetReplayBindOffset(), entry->GetImageFlag() });
+        }
+
+        // Resource tracking sorts the bound resources by offset, so this is normally a no-op.
+        std::stable_sort(ranges.begin(), ranges.end(), [](const BoundResourceRange& a, const BoundResourceRange& b) {
+            return a.trace_begin < b.trace_begin;
+        });
+
+        for (size_t i = 1; i < ranges.size(); ++i)
+        {
+            ranges[i].max_trace_end = std::max(ranges[i].trace_end, ranges[i - 1].max_trace_end);
+        }
+    }
+}
+
+const VulkanRealignAllocator::BoundResourceRanges*
+VulkanRealignAllocator::GetBoundResourceRanges(format::HandleId capture_id) const
+{
+    auto entry = bound_resource_ranges_.find(capture_id);
+    if (entry != bound_resource_ranges_.end())
+    {
+        return &entry->second;
+    }
+
+    return nullptr;
+}
+
+// Util function to find the matching offset with the resources offsets.
+VkDeviceSize VulkanRealignAllocator::FindMatchingResourceOffset(format::HandleId capture_id, VkDeviceSize offset) const
+{
+    auto ranges = GetBoundResourceRanges(capture_id);
+
+    if (ranges != nullptr)
     {
-        assert(entry != nullptr);
+        // Skip the ranges that end before the offset; max_trace_end is non-decreasing.
+        auto range = std::partition_point(ranges->begin(), ranges->end(), [offset](const BoundResourceRange& entry) {
+            return entry.max_trace_end < offset;
+        });
 
-        if ((offset > entry->GetTraceBindOffset()) &&
-            (offset <= (entry->GetTraceBindOffset() + entry->GetReplayResourceSize())))
+        for (; (range != ranges->end()) && (range->trace_begin < offset); ++range)
         {
-            int64_t offset_diff = entry->GetReplayBindOffset() - entry->GetTraceBindOffset();
-            offset += offset_diff;
+            if (offset <= range->trace_end)
+            {
+                return offset + (range->replay_offset - range->trace_begin);
+            }
         }
     }
 
@@ -308,79 +374,44 @@ VkResult VulkanRealignAllocator::UpdateResourceData(
     format::HandleId capture_id, MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data)
 {
     // Find the corresponding resources offset and update fill memory to new offset.
-    auto tracked_memory_info = tracked_object_table_->GetTrackedDeviceMemoryInfo(capture_id);
+    auto     ranges          = GetBoundResourceRanges(capture_id);
+    uint64_t copy_data_start = offset;
+    uint64_t copy_data_end   = offset + size;
+    VkResult result          = VK_ERROR_INITIALIZATION_FAILED;
 
-    auto         tracked_bound_resources = tracked_memory_info->GetBoundResourcesList();
-    VkDeviceSize mapped_memory_offset    = offset;
-    VkDeviceSize data_offset             = 0;
-    uint64_t     copy_size               = 0;
-    VkResult     result                  = VK_ERROR_INITIALIZATION_FAILED;
+    if (ranges == nullptr)
+    {
+        return result;
+    }
+
+    // Skip the ranges that end before the copy range, then split the copy between the resources that overlap it in
+    // a single pass.
+    auto range =
+        std::partition_point(ranges->begin(), ranges->end(), [copy_data_start](const BoundResourceRange& entry) {
+            return entry.max_trace_end <= copy_data_start;
+        });
 
-    // Loop through all the bound resources in the memory objects and update the mapped memory offset, data offset and
-    // data size.
-    for (auto entry : (*tracked_bound_resources))
+    for (; (range != ranges->end()) && (range->trace_begin < copy_data_end); ++range)
     {
-        assert(entry != nullptr);
+        // Ignore the resource that is outside the copy range.
+        if (range->trace_end <= copy_data_start)
+        {
+            continue;
+        }
 
-        if (entry->GetImageFlag() == false)
+        if (range->is_image == false)
         {
-            VkDeviceSize resource_start  = entry->GetTraceBindOffset();
-            VkDeviceSize resource_end    = entry->GetTraceBindOffset() + entry->GetReplayResourceSize();
-            uint64_t     copy_data_start = offset;
-            uint64_t     copy_data_end   = offset + size;
+            VkDeviceSize write_start  = std::max(range->trace_begin, copy_data_start);
+            VkDeviceSize write_end    = std::min(range->trace_end, copy_data_end);
+            VkDeviceSize write_offset = range->replay_offset + (write_start - range->trace_begin);
 
-            // Ignore the resource that is outside the copy range.
-            if ((copy_data_start >= resource_end) || (resource_start >= copy_data_end))
-            {
-                continue;
-            }
+            VkResult write_result = VulkanDefaultAllocator::WriteMappedMemoryRange(
+                allocator_data, write_offset, write_end - write_start, data + (write_start - copy_data_start));
 
-            // below are the condition checks for resource is within the
-            // copy data range or overlap with the copy data range,
-            // if resource is within the copy data range,
-            // update the copy offset, data offset and data size
-            // which will be used later in memcpy
-            else if ((resource_start >= copy_data_start) && (resource_end <= copy_data_end))
-            {
-                mapped_memory_offset = entry->GetReplayBindOffset();
-                data_offset          = resource_start - copy_data_start;
-                copy_size            = entry->GetReplayResourceSize();
-            }
-            else if ((copy_data_start > resource_start) && (copy_data_end > resource_end))
-            {
-                copy_size            = resource_end - copy_data_start;
-                mapped_memory_offset = entry->GetReplayBindOffset() + (copy_data_start - resource_start);
-            }
-            else if ((resource_start > copy_data_start) && (resource_end > copy_data_end))
-            {
-                data_offset          = resource_start - copy_data_start;
-                copy_size            = (copy_data_end)-resource_start;
-                mapped_memory_offset = entry->GetReplayBindOffset();
-            }
-            else if ((resource_start <= copy_data_start) && (resource_end >= copy_data_end))
-            {
-                copy_size            = size;
-                mapped_memory_offset = entry->GetReplayBindOffset() + (copy_data_start - resource_start);
-            }
-            else if ((copy_data_start < resource_start) && (copy_data_end < resource_end))
+            if ((result == VK_ERROR_INITIALIZATION_FAILED) || (write_result != VK_SUCCESS))
             {
-                data_offset          = resource_start - resource_start;
-                copy_size            = resource_end - resource_start;
-                mapped_memory_offset = entry->GetReplayBindOffset();
+                result = write_result;
             }
-            else if ((resource_start < copy_data_start) && (resource_end < copy_data_end))
-            {
-                copy_size            = (resource_end)-copy_data_start;
-                mapped_memory_offset = entry->GetReplayBindOffset() + (copy_data_start - resource_start);
-            }
-            else
-            {
-                // Fail to determine if the resource is within the copy range.
-                GFXRECON_LOG_FATAL("Fill memory offset translation failed!");
-            }
-
-            result = VulkanDefaultAllocator::WriteMappedMemoryRange(
-                allocator_data, mapped_memory_offset, copy_size, data + data_offset);
         }
         else
         {
@@ -411,15 +442,9 @@ std::unique_ptr<VkMappedMemoryRange[]> VulkanRealignAllocator::UpdateMappedMemor
 
             if (memory_info != nullptr)
             {
-                // Update map memory size to new allocated memory size.
-                auto tracked_memory_info = tracked_object_table_->GetTrackedDeviceMemoryInfo(memory_info->capture_id);
-
-                if (tracked_memory_info != nullptr)
-                {
-                    // Update map memory offset.
-                    realign_memory_ranges[i].offset =
-                        FindMatchingResourceOffset(tracked_memory_info, memory_ranges[i].offset);
-                }
+                // Update map memory offset.
+                realign_memory_ranges[i].offset =
+                    FindMatchingResourceOffset(memory_info->capture_id, memory_ranges[i].offset);
             }
         }
     }
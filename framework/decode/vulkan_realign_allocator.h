@@ -28,6 +28,7 @@
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "util/defines.h"
 
+#include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -49,6 +50,10 @@ class VulkanRealignAllocator : public VulkanDefaultAllocator
                                     VkDeviceMemory*              memory,
                                     MemoryData*                  allocator_data) override;
 
+    virtual void FreeMemory(VkDeviceMemory               memory,
+                            const VkAllocationCallbacks* allocation_callbacks,
+                            MemoryData                   allocator_data) override;
+
     virtual VkResult BindBufferMemory(VkBuffer               buffer,
                                       VkDeviceMemory         memory,
                                       VkDeviceSize           memory_offset,
@@ -94,9 +99,28 @@ class VulkanRealignAllocator : public VulkanDefaultAllocator
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
   private:
+    // Capture and replay offsets of a resource bound to a memory object.  The ranges of a memory object are sorted by
+    // trace_begin, and max_trace_end is the largest trace_end of the range and the ranges that precede it, which allows
+    // the ranges that overlap an offset to be found with a binary search when bound resources alias.
+    struct BoundResourceRange
+    {
+        VkDeviceSize trace_begin;
+        VkDeviceSize trace_end;
+        VkDeviceSize max_trace_end;
+        VkDeviceSize replay_offset;
+        bool         is_image;
+    };
+
+    typedef std::vector<BoundResourceRange> BoundResourceRanges;
+
+  private:
+    // Builds the offset translation table for a memory object from the bound resources recorded by resource tracking.
+    void CreateBoundResourceRanges(format::HandleId capture_id);
+
+    const BoundResourceRanges* GetBoundResourceRanges(format::HandleId capture_id) const;
+
     // Util function to find the matching offset with the resources offsets.
-    VkDeviceSize FindMatchingResourceOffset(const TrackedDeviceMemoryInfo* tracked_memory_info,
-                                            VkDeviceSize                   original_offset) const;
+    VkDeviceSize FindMatchingResourceOffset(format::HandleId capture_id, VkDeviceSize original_offset) const;
 
     // Util function to update the resource data (memcpy to mapped memory).
     VkResult UpdateResourceData(
@@ -107,7 +131,8 @@ class VulkanRealignAllocator : public VulkanDefaultAllocator
                                                                      const MemoryData*          allocator_datas) const;
 
   private:
-    const VulkanTrackedObjectInfoTable* tracked_object_table_;
+    const VulkanTrackedObjectInfoTable*                       tracked_object_table_;
+    std::unordered_map<format::HandleId, BoundResourceRanges> bound_resource_ranges_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -36,6 +36,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cinttypes>
+#include <iterator>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -45,7 +47,15 @@ const uintptr_t        kPlaceholderAddress  = static_cast<uintptr_t>(~0);
 
 VulkanRebindAllocator::VulkanRebindAllocator() :
     device_(VK_NULL_HANDLE), allocator_(VK_NULL_HANDLE), vma_functions_{},
-    capture_device_type_(VK_PHYSICAL_DEVICE_TYPE_OTHER), capture_memory_properties_{}, replay_memory_properties_{}
+    capture_device_type_(VK_PHYSICAL_DEVICE_TYPE_OTHER), capture_memory_properties_{}, replay_memory_properties_{},
+    use_dedicated_requirements_(false), device_memory_budget_(0), budget_exceeded_(false), host_copy_size_(0)
+{}
+
+VulkanRebindAllocator::VulkanRebindAllocator(const PoolSettings& pool_settings) :
+    device_(VK_NULL_HANDLE), allocator_(VK_NULL_HANDLE), vma_functions_{},
+    capture_device_type_(VK_PHYSICAL_DEVICE_TYPE_OTHER), capture_memory_properties_{}, replay_memory_properties_{},
+    pool_settings_(pool_settings), use_dedicated_requirements_(false), device_memory_budget_(0),
+    budget_exceeded_(false), host_copy_size_(0)
 {}
 
 VulkanRebindAllocator::~VulkanRebindAllocator() {}
@@ -106,6 +116,9 @@ VkResult VulkanRebindAllocator::Initialize(uint32_t
         create_info.instance         = instance;
         create_info.vulkanApiVersion = api_version;
 
+        // Block size for the default pools, which is also used by the custom pools.
+        create_info.preferredLargeHeapBlockSize = pool_settings_.block_size;
+
         // Select creation flags from enabled extensions.
         bool have_memory_reqs2         = false;
         bool have_dedicated_allocation = false;
@@ -141,6 +154,9 @@ VkResult VulkanRebindAllocator::Initialize(uint32_t
             create_info.flags |= VMA_ALLOCATOR_CREATE_KHR_DEDICATED_ALLOCATION_BIT;
         }
 
+        use_dedicated_requirements_ =
+            (have_memory_reqs2 && have_dedicated_allocation) || (api_version >= VK_API_VERSION_1_1);
+
         result = vmaCreateAllocator(&create_info, &allocator_);
     }
 
@@ -151,6 +167,16 @@ void VulkanRebindAllocator::Destroy()
 {
     if (allocator_ != VK_NULL_HANDLE)
     {
+        for (const auto& entry : memory_pools_)
+        {
+            if (entry.second != VK_NULL_HANDLE)
+            {
+                vmaDestroyPool(allocator_, entry.second);
+            }
+        }
+
+        memory_pools_.clear();
+
         vmaDestroyAllocator(allocator_);
         allocator_ = VK_NULL_HANDLE;
     }
@@ -205,7 +231,7 @@ void VulkanRebindAllocator::DestroyBuffer(VkBuffer                     buffer,
 
         if (memory_alloc_info != nullptr)
         {
-            memory_alloc_info->original_buffers.erase(buffer);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -268,7 +294,7 @@ void VulkanRebindAllocator::DestroyImage(VkImage                      image,
 
         if (memory_alloc_info != nullptr)
         {
-            memory_alloc_info->original_images.erase(image);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -329,9 +355,9 @@ VkResult VulkanRebindAllocator::AllocateMemory(const VkMemoryAllocateInfo*  allo
     if ((allocate_info != nullptr) && (memory != nullptr) && (allocator_data != nullptr))
     {
         // With rebinding, memory allocations are managed by VMA.  We just store the size and memory type index for the
-        // VkDeviceMemory object here.  If the VkDeviceMemory object is mapped, the size will be used to create a system
-        // memory allocation that will be used to reconstruct the content of the original memory object.  The
-        // reconstructed data will be used to populate the memory allocations created by VMA.
+        // VkDeviceMemory object here.  Mapped memory writes are copied to the memory allocations created by VMA for
+        // the resources bound to the written range, and only the data written to ranges without a bound resource is
+        // kept in system memory, to populate the allocations of resources that are bound to the range later.
         auto memory_alloc_info             = new MemoryAllocInfo;
         memory_alloc_info->allocation_size = allocate_info->allocationSize;
         memory_alloc_info->original_index  = allocate_info->memoryTypeIndex;
@@ -356,14 +382,14 @@ void VulkanRebindAllocator::FreeMemory(VkDeviceMemory               memory,
         // Clear references from resources to the allocation info and cleanup allocation info memory.
         auto memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
 
-        for (const auto& entry : memory_alloc_info->original_buffers)
+        for (const auto& entry : memory_alloc_info->bound_resources)
         {
             entry.second->memory_info = nullptr;
         }
 
-        for (const auto& entry : memory_alloc_info->original_images)
+        for (const auto& entry : memory_alloc_info->unbound_content)
         {
-            entry.second->memory_info = nullptr;
+            host_copy_size_ -= entry.second.size();
         }
 
         delete memory_alloc_info;
@@ -414,7 +440,7 @@ VkResult VulkanRebindAllocator::BindBufferMemory(VkBuffer               buffer,
         create_info.pUserData      = nullptr;
 
         VmaAllocationInfo allocation_info;
-        result = vmaAllocateMemoryForBuffer(allocator_, buffer, &create_info, &allocation, &allocation_info);
+        result = AllocateMemoryForBuffer(buffer, requirements, &create_info, &allocation, &allocation_info);
 
         if (result >= 0)
         {
@@ -437,18 +463,7 @@ VkResult VulkanRebindAllocator::BindBufferMemory(VkBuffer               buffer,
                     resource_alloc_info->is_host_visible = true;
                 }
 
-                if (memory_alloc_info->original_content != nullptr)
-                {
-                    // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                    // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
-                }
-
-                memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                 (*bind_memory_properties) = property_flags;
             }
@@ -497,7 +512,7 @@ VkResult VulkanRebindAllocator::BindBufferMemory2(uint32_t
                 create_info.pUserData      = nullptr;
 
                 VmaAllocationInfo allocation_info;
-                result = vmaAllocateMemoryForBuffer(allocator_, buffer, &create_info, &allocation, &allocation_info);
+                result = AllocateMemoryForBuffer(buffer, requirements, &create_info, &allocation, &allocation_info);
 
                 if (result >= 0)
                 {
@@ -523,18 +538,7 @@ VkResult VulkanRebindAllocator::BindBufferMemory2(uint32_t
                             resource_alloc_info->is_host_visible = true;
                         }
 
-                        if (memory_alloc_info->original_content != nullptr)
-                        {
-                            // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                            // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
-                        }
-
-                        memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -581,7 +585,7 @@ VkResult VulkanRebindAllocator::BindImageMemory(VkImage                image,
         create_info.pUserData      = nullptr;
 
         VmaAllocationInfo allocation_info;
-        result = vmaAllocateMemoryForImage(allocator_, image, &create_info, &allocation, &allocation_info);
+        result = AllocateMemoryForImage(image, requirements, &create_info, &allocation, &allocation_info);
 
         if (result >= 0)
         {
@@ -604,18 +608,7 @@ VkResult VulkanRebindAllocator::BindImageMemory(VkImage                image,
                     resource_alloc_info->is_host_visible = true;
                 }
 
-                if (memory_alloc_info->original_content != nullptr)
-                {
-                    // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                    // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
-                }
-
-                memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                 (*bind_memory_properties) = property_flags;
             }
@@ -665,7 +658,7 @@ VkResult VulkanRebindAllocator::BindImageMemory2(uint32_t                     bi
                 create_info.pUserData      = nullptr;
 
                 VmaAllocationInfo allocation_info;
-                result = vmaAllocateMemoryForImage(allocator_, image, &create_info, &allocation, &allocation_info);
+                result = AllocateMemoryForImage(image, requirements, &create_info, &allocation, &allocation_info);
 
                 if (result >= 0)
                 {
@@ -691,18 +684,7 @@ VkResult VulkanRebindAllocator::BindImageMemory2(uint32_t                     bi
                             resource_alloc_info->is_host_visible = true;
                         }
 
-                        if (memory_alloc_info->original_content != nullptr)
-                        {
-                            // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                            // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
-                        }
-
-                        memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -778,36 +760,21 @@ VkResult VulkanRebindAllocator::WriteMappedMemoryRange(MemoryData     allocator_
 
         if (memory_alloc_info->is_mapped)
         {
-            if (memory_alloc_info->original_content == nullptr)
-            {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, memory_alloc_info->allocation_size);
-                size_t allocation_size = static_cast<size_t>(memory_alloc_info->allocation_size);
-
-                memory_alloc_info->original_content = std::make_unique<uint8_t[]>(allocation_size);
-            }
-
-            // Update the reconstructed memory, which is written to memory allocations created at resource bind to
-            // ensure they contain the correct data.
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
-            size_t   copy_size = static_cast<size_t>(size);
-            uint8_t* copy_dst  = memory_alloc_info->original_content.get() + memory_alloc_info->mapped_offset + offset;
-
-            util::platform::MemoryCopy(copy_dst, copy_size, data, copy_size);
-
             VkDeviceSize write_start = memory_alloc_info->mapped_offset + offset;
             VkDeviceSize write_end   = write_start + size;
 
             // Copy to the resources that were bound to this range at capture.
-            for (const auto& entry : memory_alloc_info->original_buffers)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
+            std::vector<ResourceAllocInfo*> resource_alloc_infos;
+            GetBoundResources(memory_alloc_info, write_start, write_end, &resource_alloc_infos);
 
-            for (const auto& entry : memory_alloc_info->original_images)
+            for (auto resource_alloc_info : resource_alloc_infos)
             {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
+                UpdateBoundResource(resource_alloc_info, write_start, write_end, data);
             }
 
+            // Keep the data for the parts of the range that are not bound to a resource yet.
+            StoreUnboundContent(memory_alloc_info, write_start, write_end, data, resource_alloc_infos);
+
             result = VK_SUCCESS;
         }
         else
@@ -868,6 +835,227 @@ void VulkanRebindAllocator::ReportBindImage2Incompatibility(uint32_t
     ReportBindIncompatibility(allocator_resource_datas, bind_info_count);
 }
 
+void VulkanRebindAllocator::GetHeapUsage(std::vector<VkDeviceSize>* heap_usage)
+{
+    assert(heap_usage != nullptr);
+
+    heap_usage->assign(replay_memory_properties_.memoryHeapCount, 0);
+
+    if (allocator_ != VK_NULL_HANDLE)
+    {
+        VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+        vmaGetBudget(allocator_, budgets);
+
+        // The block sizes are the memory that VMA has allocated from the heaps, which includes unused pool memory.
+        for (uint32_t i = 0; i < replay_memory_properties_.memoryHeapCount; ++i)
+        {
+            (*heap_usage)[i] = budgets[i].blockBytes;
+        }
+    }
+}
+
+VkResult VulkanRebindAllocator::AllocateMemoryForBuffer(VkBuffer                    buffer,
+                                                        const VkMemoryRequirements& requirements,
+                                                        VmaAllocationCreateInfo*    create_info,
+                                                        VmaAllocation*              allocation,
+                                                        VmaAllocationInfo*          allocation_info)
+{
+    assert(create_info != nullptr);
+
+    bool                            dedicated         = false;
+    VkMemoryDedicatedRequirements   dedicated_reqs    = { VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS };
+    VkMemoryRequirements2           requirements2     = { VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2 };
+    VkBufferMemoryRequirementsInfo2 requirements_info = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2 };
+
+    if ((pool_settings_.algorithm != PoolAlgorithm::kDefault) && use_dedicated_requirements_ &&
+        (functions_.get_buffer_memory_requirements2 != nullptr))
+    {
+        requirements2.pNext      = &dedicated_reqs;
+        requirements_info.buffer = buffer;
+        functions_.get_buffer_memory_requirements2(device_, &requirements_info, &requirements2);
+
+        dedicated = (dedicated_reqs.requiresDedicatedAllocation == VK_TRUE) ||
+                    (dedicated_reqs.prefersDedicatedAllocation == VK_TRUE);
+    }
+
+    VkResult result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+
+    ApplyDeviceMemoryBudget(requirements, create_info);
+
+    if (!dedicated)
+    {
+        create_info->pool = GetMemoryPool(requirements, *create_info);
+    }
+
+    if (create_info->pool != VK_NULL_HANDLE)
+    {
+        result = vmaAllocateMemoryForBuffer(allocator_, buffer, create_info, allocation, allocation_info);
+        create_info->pool = VK_NULL_HANDLE;
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        result = vmaAllocateMemoryForBuffer(allocator_, buffer, create_info, allocation, allocation_info);
+    }
+
+    return result;
+}
+
+VkResult VulkanRebindAllocator::AllocateMemoryForImage(VkImage                     image,
+                                                       const VkMemoryRequirements& requirements,
+                                                       VmaAllocationCreateInfo*    create_info,
+                                                       VmaAllocation*              allocation,
+                                                       VmaAllocationInfo*          allocation_info)
+{
+    assert(create_info != nullptr);
+
+    bool                           dedicated         = false;
+    VkMemoryDedicatedRequirements  dedicated_reqs    = { VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS };
+    VkMemoryRequirements2          requirements2     = { VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2 };
+    VkImageMemoryRequirementsInfo2 requirements_info = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2 };
+
+    if ((pool_settings_.algorithm != PoolAlgorithm::kDefault) && use_dedicated_requirements_ &&
+        (functions_.get_image_memory_requirements2 != nullptr))
+    {
+        requirements2.pNext     = &dedicated_reqs;
+        requirements_info.image = image;
+        functions_.get_image_memory_requirements2(device_, &requirements_info, &requirements2);
+
+        dedicated = (dedicated_reqs.requiresDedicatedAllocation == VK_TRUE) ||
+                    (dedicated_reqs.prefersDedicatedAllocation == VK_TRUE);
+    }
+
+    VkResult result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+
+    ApplyDeviceMemoryBudget(requirements, create_info);
+
+    if (!dedicated)
+    {
+        create_info->pool = GetMemoryPool(requirements, *create_info);
+    }
+
+    if (create_info->pool != VK_NULL_HANDLE)
+    {
+        result = vmaAllocateMemoryForImage(allocator_, image, create_info, allocation, allocation_info);
+        create_info->pool = VK_NULL_HANDLE;
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        result = vmaAllocateMemoryForImage(allocator_, image, create_info, allocation, allocation_info);
+    }
+
+    return result;
+}
+
+VmaPool VulkanRebindAllocator::GetMemoryPool(const VkMemoryRequirements&    requirements,
+                                             const VmaAllocationCreateInfo& create_info)
+{
+    if (pool_settings_.algorithm == PoolAlgorithm::kDefault)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    uint32_t memory_type_index = 0;
+    if (vmaFindMemoryTypeIndex(allocator_, requirements.memoryTypeBits, &create_info, &memory_type_index) != VK_SUCCESS)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    auto entry = memory_pools_.find(memory_type_index);
+    if (entry != memory_pools_.end())
+    {
+        return entry->second;
+    }
+
+    VmaPoolCreateInfo pool_info = {};
+    pool_info.memoryTypeIndex   = memory_type_index;
+    pool_info.flags             = (pool_settings_.algorithm == PoolAlgorithm::kLinear)
+                                      ? VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT
+                                      : VMA_POOL_CREATE_BUDDY_ALGORITHM_BIT;
+    pool_info.blockSize         = pool_settings_.block_size;
+
+    VmaPool  pool   = VK_NULL_HANDLE;
+    VkResult result = vmaCreatePool(allocator_, &pool_info, &pool);
+
+    if (result != VK_SUCCESS)
+    {
+        // Keep the null pool, so that creation is not attempted again for the memory type.
+        GFXRECON_LOG_WARNING("Failed to create a memory pool for memory type %u: vmaCreatePool returned %s.  The "
+                             "default pool will be used for the memory type.",
+                             memory_type_index,
+                             enumutil::GetResultValueString(result));
+        pool = VK_NULL_HANDLE;
+    }
+
+    memory_pools_.emplace(memory_type_index, pool);
+
+    return pool;
+}
+
+void VulkanRebindAllocator::ApplyDeviceMemoryBudget(const VkMemoryRequirements& requirements,
+                                                    VmaAllocationCreateInfo*    create_info)
+{
+    assert(create_info != nullptr);
+
+    if ((device_memory_budget_ == 0) || (create_info->usage == VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED))
+    {
+        return;
+    }
+
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+    vmaGetBudget(allocator_, budgets);
+
+    // Usage is reported by the driver when VK_EXT_memory_budget is enabled, and estimated by VMA otherwise.
+    VkDeviceSize device_usage = 0;
+    for (uint32_t i = 0; i < replay_memory_properties_.memoryHeapCount; ++i)
+    {
+        if ((replay_memory_properties_.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) ==
+            VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+        {
+            device_usage += budgets[i].usage;
+        }
+    }
+
+    if ((device_usage + requirements.size) <= device_memory_budget_)
+    {
+        return;
+    }
+
+    uint32_t host_memory_type_bits = 0;
+    for (uint32_t i = 0; i < replay_memory_properties_.memoryTypeCount; ++i)
+    {
+        uint32_t heap_index = replay_memory_properties_.memoryTypes[i].heapIndex;
+
+        if ((replay_memory_properties_.memoryHeaps[heap_index].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) !=
+            VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+        {
+            host_memory_type_bits |= (1u << i);
+        }
+    }
+
+    uint32_t memory_type_bits = requirements.memoryTypeBits & host_memory_type_bits;
+    if (create_info->memoryTypeBits != 0)
+    {
+        memory_type_bits &= create_info->memoryTypeBits;
+    }
+
+    // Resources that cannot be placed in host memory, such as optimally tiled images on some implementations, are
+    // still allocated from device local memory.
+    if (memory_type_bits != 0)
+    {
+        if (!budget_exceeded_)
+        {
+            GFXRECON_LOG_WARNING("Device memory budget of %" PRIu64 " bytes has been exceeded.  Resources that would "
+                                 "exceed the budget will be allocated from host memory.",
+                                 device_memory_budget_);
+            budget_exceeded_ = true;
+        }
+
+        create_info->memoryTypeBits = memory_type_bits;
+    }
+}
+
 void VulkanRebindAllocator::WriteBoundResource(ResourceAllocInfo* resource_alloc_info,
                                                VkDeviceSize       src_offset,
                                                VkDeviceSize       dst_offset,
@@ -1025,6 +1213,179 @@ void VulkanRebindAllocator::UpdateBoundResource(ResourceAllocInfo* resource_allo
     }
 }
 
+void VulkanRebindAllocator::AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    VkDeviceSize resource_start = resource_alloc_info->original_offset;
+    VkDeviceSize resource_end   = resource_start + resource_alloc_info->size;
+    auto&        content        = memory_alloc_info->unbound_content;
+
+    if (!content.empty())
+    {
+        // Memory has been mapped and written prior to bind.  Copy the unbound content to the new allocation to ensure
+        // it contains the correct data.
+        auto entry = content.lower_bound(resource_start);
+
+        if (entry != content.begin())
+        {
+            auto previous = std::prev(entry);
+
+            if ((previous->first + previous->second.size()) > resource_start)
+            {
+                entry = previous;
+            }
+        }
+
+        for (; (entry != content.end()) && (entry->first < resource_end); ++entry)
+        {
+            UpdateBoundResource(resource_alloc_info,
+                                entry->first,
+                                entry->first + entry->second.size(),
+                                entry->second.data());
+        }
+
+        EraseUnboundContent(memory_alloc_info, resource_start, resource_end);
+    }
+
+    memory_alloc_info->bound_resources.insert(std::make_pair(resource_start, resource_alloc_info));
+    memory_alloc_info->max_resource_size = std::max(memory_alloc_info->max_resource_size, resource_alloc_info->size);
+}
+
+void VulkanRebindAllocator::RemoveBoundResource(MemoryAllocInfo*   memory_alloc_info,
+                                                ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    auto range = memory_alloc_info->bound_resources.equal_range(resource_alloc_info->original_offset);
+
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        if (entry->second == resource_alloc_info)
+        {
+            memory_alloc_info->bound_resources.erase(entry);
+            break;
+        }
+    }
+}
+
+void VulkanRebindAllocator::GetBoundResources(const MemoryAllocInfo*           memory_alloc_info,
+                                              VkDeviceSize                     original_start,
+                                              VkDeviceSize                     original_end,
+                                              std::vector<ResourceAllocInfo*>* resource_alloc_infos)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_infos != nullptr));
+
+    const auto& bound_resources = memory_alloc_info->bound_resources;
+    auto        entry           = bound_resources.begin();
+
+    // Resources that start more than the largest resource size before the range cannot overlap it.
+    if (original_start > memory_alloc_info->max_resource_size)
+    {
+        entry = bound_resources.upper_bound(original_start - memory_alloc_info->max_resource_size);
+    }
+
+    for (; (entry != bound_resources.end()) && (entry->first < original_end); ++entry)
+    {
+        if ((entry->first + entry->second->size) > original_start)
+        {
+            resource_alloc_infos->push_back(entry->second);
+        }
+    }
+}
+
+void VulkanRebindAllocator::StoreUnboundContent(MemoryAllocInfo*                       memory_alloc_info,
+                                                VkDeviceSize                           write_start,
+                                                VkDeviceSize                           write_end,
+                                                const uint8_t*                         data,
+                                                const std::vector<ResourceAllocInfo*>& resource_alloc_infos)
+{
+    assert(memory_alloc_info != nullptr);
+
+    // The resources are ordered by their start offset, so the gaps between them are found in a single pass.
+    VkDeviceSize gap_start = write_start;
+    size_t       index     = 0;
+
+    while (gap_start < write_end)
+    {
+        VkDeviceSize gap_end = write_end;
+
+        for (; index < resource_alloc_infos.size(); ++index)
+        {
+            VkDeviceSize resource_start = resource_alloc_infos[index]->original_offset;
+            VkDeviceSize resource_end   = resource_start + resource_alloc_infos[index]->size;
+
+            if (resource_start > gap_start)
+            {
+                gap_end = std::min(resource_start, write_end);
+                break;
+            }
+
+            gap_start = std::max(gap_start, resource_end);
+        }
+
+        if (gap_start < gap_end)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, gap_end - gap_start);
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, gap_start - write_start);
+
+            size_t         gap_size = static_cast<size_t>(gap_end - gap_start);
+            const uint8_t* gap_data = data + static_cast<size_t>(gap_start - write_start);
+
+            EraseUnboundContent(memory_alloc_info, gap_start, gap_end);
+            memory_alloc_info->unbound_content.emplace(gap_start, std::vector<uint8_t>(gap_data, gap_data + gap_size));
+            host_copy_size_ += gap_size;
+        }
+
+        gap_start = gap_end;
+    }
+}
+
+void VulkanRebindAllocator::EraseUnboundContent(MemoryAllocInfo* memory_alloc_info,
+                                                VkDeviceSize     erase_start,
+                                                VkDeviceSize     erase_end)
+{
+    assert(memory_alloc_info != nullptr);
+
+    auto& content = memory_alloc_info->unbound_content;
+    auto  entry   = content.lower_bound(erase_start);
+
+    if (entry != content.begin())
+    {
+        auto previous = std::prev(entry);
+
+        if ((previous->first + previous->second.size()) > erase_start)
+        {
+            entry = previous;
+        }
+    }
+
+    while ((entry != content.end()) && (entry->first < erase_end))
+    {
+        VkDeviceSize         content_start = entry->first;
+        VkDeviceSize         content_end   = content_start + entry->second.size();
+        std::vector<uint8_t> data          = std::move(entry->second);
+
+        entry = content.erase(entry);
+        host_copy_size_ -= data.size();
+
+        // Keep the parts of the content that are outside of the erased range.
+        if (content_start < erase_start)
+        {
+            size_t head_size = static_cast<size_t>(erase_start - content_start);
+            content.emplace(content_start, std::vector<uint8_t>(data.begin(), data.begin() + head_size));
+            host_copy_size_ += head_size;
+        }
+
+        if (content_end > erase_end)
+        {
+            size_t tail_offset = static_cast<size_t>(erase_end - content_start);
+            content.emplace(erase_end, std::vector<uint8_t>(data.begin() + tail_offset, data.end()));
+            host_copy_size_ += data.size() - tail_offset;
+        }
+    }
+}
+
 VkResult VulkanRebindAllocator::UpdateMappedMemoryRange(
     ResourceAllocInfo* resource_alloc_info,
     VkDeviceSize       oiriginal_start,
@@ -1080,17 +1441,13 @@ VkResult VulkanRebindAllocator::UpdateMappedMemoryRanges(
                 VkDeviceSize range_start = memory_ranges[i].offset;
                 VkDeviceSize range_end   = range_start + size;
 
-                for (const auto& entry : memory_alloc_info->original_buffers)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
+                std::vector<ResourceAllocInfo*> resource_alloc_infos;
+                GetBoundResources(memory_alloc_info, range_start, range_end, &resource_alloc_infos);
 
-                for (const auto& entry : memory_alloc_info->original_images)
+                for (auto resource_alloc_info : resource_alloc_infos)
                 {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
+                    if (UpdateMappedMemoryRange(resource_alloc_info, range_start, range_end, update_func) !=
+                        VK_SUCCESS)
                     {
                         result = VK_ERROR_MEMORY_MAP_FAILED;
                     }
@@ -29,6 +29,7 @@
 #include "vk_mem_alloc.h"
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -39,11 +40,33 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 class VulkanRebindAllocator : public VulkanResourceAllocator
 {
+  public:
+    enum class PoolAlgorithm : uint32_t
+    {
+        kDefault = 0,
+        kLinear  = 1,
+        kBuddy   = 2
+    };
+
+    struct PoolSettings
+    {
+        // Allocation algorithm for resource memory.  When an algorithm other than the default is selected, resources
+        // are allocated from a custom VMA pool for each memory type.
+        PoolAlgorithm algorithm{ PoolAlgorithm::kDefault };
+        VkDeviceSize  block_size{ 0 }; // Size of VMA memory blocks, or 0 for the VMA default.
+    };
+
   public:
     VulkanRebindAllocator();
 
+    VulkanRebindAllocator(const PoolSettings& pool_settings);
+
     virtual ~VulkanRebindAllocator() override;
 
+    // Limit device local memory usage to the specified budget, in bytes, or 0 for no limit.  Resources that would
+    // exceed the budget are allocated from host memory that is accessible to the device.
+    void SetDeviceMemoryBudget(VkDeviceSize budget) { device_memory_budget_ = budget; }
+
     virtual VkResult Initialize(uint32_t                                api_version,
                                 VkInstance                              instance,
                                 VkPhysicalDevice                        physical_device,
@@ -255,6 +278,10 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
 
     virtual bool SupportsOpaqueDeviceAddresses() override { return false; }
 
+    virtual void GetHeapUsage(std::vector<VkDeviceSize>* heap_usage) override;
+
+    virtual size_t GetHostCopySize() override { return host_copy_size_; }
+
   private:
     struct MemoryAllocInfo;
 
@@ -285,18 +312,45 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
         std::vector<SubresourceLayouts> layouts;
     };
 
+    // Resources bound to a memory object, keyed by their offset in the original memory binding.
+    typedef std::multimap<VkDeviceSize, ResourceAllocInfo*> BoundResourceMap;
+
+    // Data written to mapped memory ranges that are not bound to a resource, keyed by the start of the range.  The
+    // ranges do not overlap.
+    typedef std::map<VkDeviceSize, std::vector<uint8_t>> UnboundContentMap;
+
     struct MemoryAllocInfo
     {
-        VkDeviceSize                                     allocation_size{ 0 };
-        uint32_t                                         original_index{ std::numeric_limits<uint32_t>::max() };
-        bool                                             is_mapped{ false };
-        VkDeviceSize                                     mapped_offset{ 0 };
-        std::unique_ptr<uint8_t[]>                       original_content;
-        std::unordered_map<VkBuffer, ResourceAllocInfo*> original_buffers;
-        std::unordered_map<VkImage, ResourceAllocInfo*>  original_images;
+        VkDeviceSize      allocation_size{ 0 };
+        uint32_t          original_index{ std::numeric_limits<uint32_t>::max() };
+        bool              is_mapped{ false };
+        VkDeviceSize      mapped_offset{ 0 };
+        BoundResourceMap  bound_resources;
+        VkDeviceSize      max_resource_size{ 0 }; // Largest bound resource, which limits the search for overlaps.
+        UnboundContentMap unbound_content;
     };
 
   private:
+    // Allocates memory for a resource from the custom pool for its memory type, when custom pools are enabled, falling
+    // back to the default pools when the resource requires a dedicated allocation or the pool allocation fails.
+    VkResult AllocateMemoryForBuffer(VkBuffer                    buffer,
+                                     const VkMemoryRequirements& requirements,
+                                     VmaAllocationCreateInfo*    create_info,
+                                     VmaAllocation*              allocation,
+                                     VmaAllocationInfo*          allocation_info);
+
+    VkResult AllocateMemoryForImage(VkImage                     image,
+                                    const VkMemoryRequirements& requirements,
+                                    VmaAllocationCreateInfo*    create_info,
+                                    VmaAllocation*              allocation,
+                                    VmaAllocationInfo*          allocation_info);
+
+    VmaPool GetMemoryPool(const VkMemoryRequirements& requirements, const VmaAllocationCreateInfo& create_info);
+
+    // Restrict an allocation to memory types from heaps that are not device local when allocating from a device local
+    // heap would exceed the device memory budget.
+    void ApplyDeviceMemoryBudget(const VkMemoryRequirements& requirements, VmaAllocationCreateInfo* create_info);
+
     void WriteBoundResource(ResourceAllocInfo* resource_alloc_info,
                             VkDeviceSize       src_offset,
                             VkDeviceSize       dst_offset,
@@ -319,6 +373,28 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
                              VkDeviceSize       write_end,
                              const uint8_t*     data);
 
+    // Adds a resource to the bound resources of its memory, writing the unbound content that it overlaps to the
+    // resource.  The content is then released, as later writes to the range are written directly to the resource.
+    void AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info);
+
+    void RemoveBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info);
+
+    // Retrieves the bound resources that overlap a range of the original memory, ordered by their original offset.
+    static void GetBoundResources(const MemoryAllocInfo*           memory_alloc_info,
+                                  VkDeviceSize                     original_start,
+                                  VkDeviceSize                     original_end,
+                                  std::vector<ResourceAllocInfo*>* resource_alloc_infos);
+
+    // Keeps the parts of a write that are not covered by the bound resources, which are written to resources that are
+    // bound to the range later.
+    void StoreUnboundContent(MemoryAllocInfo*                       memory_alloc_info,
+                             VkDeviceSize                           write_start,
+                             VkDeviceSize                           write_end,
+                             const uint8_t*                         data,
+                             const std::vector<ResourceAllocInfo*>& resource_alloc_infos);
+
+    void EraseUnboundContent(MemoryAllocInfo* memory_alloc_info, VkDeviceSize erase_start, VkDeviceSize erase_end);
+
     VkResult UpdateMappedMemoryRange(ResourceAllocInfo* resource_alloc_info,
                                      VkDeviceSize       oiriginal_start,
                                      VkDeviceSize       original_end,
@@ -350,6 +426,14 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
     VkPhysicalDeviceType             capture_device_type_;
     VkPhysicalDeviceMemoryProperties capture_memory_properties_;
     VkPhysicalDeviceMemoryProperties replay_memory_properties_;
+    PoolSettings                     pool_settings_;
+    bool                             use_dedicated_requirements_;
+    VkDeviceSize                     device_memory_budget_;
+    bool                             budget_exceeded_;
+    size_t                           host_copy_size_; // Size of the unbound content of mapped memory.
+
+    // Custom pools for resource memory, keyed by memory type index.
+    std::unordered_map<uint32_t, VmaPool> memory_pools_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
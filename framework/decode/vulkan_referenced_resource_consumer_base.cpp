@@ -62,6 +62,48 @@ void VulkanReferencedResourceConsumerBase::Process_vkQueueSubmit(VkResult
                 table_.ProcessUserSubmission(command_buffer_ids[j]);
             }
         }
+
+        ReportFirstUses();
+    }
+}
+
+void VulkanReferencedResourceConsumerBase::Process_vkQueueSubmit2KHR(
+    VkResult                                        returnValue,
+    format::HandleId                                queue,
+    uint32_t                                        submitCount,
+    StructPointerDecoder<Decoded_VkSubmitInfo2KHR>* pSubmits,
+    format::HandleId                                fence)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(returnValue);
+    GFXRECON_UNREFERENCED_PARAMETER(queue);
+    GFXRECON_UNREFERENCED_PARAMETER(submitCount);
+    GFXRECON_UNREFERENCED_PARAMETER(fence);
+
+    assert(pSubmits != nullptr);
+
+    if (!pSubmits->IsNull() && pSubmits->HasData())
+    {
+        size_t     submit_count = pSubmits->GetLength();
+        const auto submits      = pSubmits->GetMetaStructPointer();
+
+        for (size_t i = 0; i < submit_count; ++i)
+        {
+            const auto command_buffer_infos = submits[i].pCommandBufferInfos;
+
+            if ((command_buffer_infos != nullptr) && !command_buffer_infos->IsNull() &&
+                command_buffer_infos->HasData())
+            {
+                size_t     command_buffer_count = command_buffer_infos->GetLength();
+                const auto command_buffers      = command_buffer_infos->GetMetaStructPointer();
+
+                for (size_t j = 0; j < command_buffer_count; ++j)
+                {
+                    table_.ProcessUserSubmission(command_buffers[j].commandBuffer);
+                }
+            }
+        }
+
+        ReportFirstUses();
     }
 }
 
@@ -89,8 +131,9 @@ void VulkanReferencedResourceConsumerBase::Process_vkCreateBuffer(
     }
     else
     {
-        // Stop processing if file did not start with a state block.
-        if (!loaded_state_)
+        // Stop processing if file did not start with a state block, unless first uses are reported for replay, which
+        // does not require a state block.
+        if (!loaded_state_ && !first_use_callback_)
         {
             // There is currently no way for a consumer to indicate that file processing should terminate early, except
             // by throwing an exception.
@@ -143,8 +186,9 @@ void VulkanReferencedResourceConsumerBase::Process_vkCreateImage(
     }
     else
     {
-        // Stop processing the file if it did not start with a state block.
-        if (!loaded_state_)
+        // Stop processing the file if it did not start with a state block, unless first uses are reported for replay,
+        // which does not require a state block.
+        if (!loaded_state_ && !first_use_callback_)
         {
             // There is currently no way for a consumer to indicate that file processing should terminate early, except
             // by throwing an exception.
@@ -927,5 +971,19 @@ void VulkanReferencedResourceConsumerBase::PushDescriptorSetWithTemplate(format:
     }
 }
 
+void VulkanReferencedResourceConsumerBase::ReportFirstUses()
+{
+    if (first_use_callback_)
+    {
+        const auto& first_used_ids = table_.GetFirstUsedResourceIds();
+
+        if (!first_used_ids.empty())
+        {
+            first_use_callback_(first_used_ids);
+            table_.ClearFirstUsedResourceIds();
+        }
+    }
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
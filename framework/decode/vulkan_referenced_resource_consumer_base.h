@@ -39,15 +39,29 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 class VulkanReferencedResourceConsumerBase : public VulkanConsumer
 {
+  public:
+    // Callback receiving the IDs of the resources that are used for the first time by a queue submission.
+    typedef std::function<void(const std::vector<format::HandleId>&)> FirstUseCallback;
+
   public:
     VulkanReferencedResourceConsumerBase();
 
+    // Reports the resources that are first used by each submission to the callback, before the submission is processed
+    // by the consumers that follow this consumer.  Must be set before any resource is created.
+    void SetFirstUseCallback(FirstUseCallback callback)
+    {
+        first_use_callback_ = callback;
+        table_.SetCollectFirstUses(callback != nullptr);
+    }
+
     void GetReferencedResourceIds(std::unordered_set<format::HandleId>* referenced_ids,
                                   std::unordered_set<format::HandleId>* unreferenced_ids) const
     {
         table_.GetReferencedResourceIds(referenced_ids, unreferenced_ids);
     }
 
+    size_t GetMemoryHighWaterMark() const { return table_.GetMemoryHighWaterMark(); }
+
     virtual void ProcessStateBeginMarker(uint64_t) override { loading_state_ = true; }
 
     virtual void ProcessStateEndMarker(uint64_t) override
@@ -62,6 +76,12 @@ class VulkanReferencedResourceConsumerBase : public VulkanConsumer
                                        StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
                                        format::HandleId                            fence) override;
 
+    virtual void Process_vkQueueSubmit2KHR(VkResult                                        returnValue,
+                                           format::HandleId                                queue,
+                                           uint32_t                                        submitCount,
+                                           StructPointerDecoder<Decoded_VkSubmitInfo2KHR>* pSubmits,
+                                           format::HandleId                                fence) override;
+
     virtual void Process_vkCreateBuffer(VkResult                                             returnValue,
                                         format::HandleId                                     device,
                                         StructPointerDecoder<Decoded_VkBufferCreateInfo>*    pCreateInfo,
@@ -265,6 +285,8 @@ class VulkanReferencedResourceConsumerBase : public VulkanConsumer
                                        format::HandleId                       template_id,
                                        const DescriptorUpdateTemplateDecoder* decoder);
 
+    void ReportFirstUses();
+
   private:
     bool                    loading_state_;
     bool                    loaded_state_;
@@ -272,6 +294,7 @@ class VulkanReferencedResourceConsumerBase : public VulkanConsumer
     LayoutBindingCounts     layout_binding_counts_;
     SetLayouts              set_layouts_;
     UpdateTemplateInfos     template_infos_;
+    FirstUseCallback        first_use_callback_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
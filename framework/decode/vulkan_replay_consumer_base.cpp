@@ -24,7 +24,9 @@
 #include "decode/vulkan_replay_consumer_base.h"
 
 #include "decode/custom_vulkan_struct_handle_mappers.h"
+#include "decode/decode_allocator.h"
 #include "decode/descriptor_update_template_decoder.h"
+#include "decode/pnext_node.h"
 #include "decode/resource_util.h"
 #include "decode/vulkan_enum_util.h"
 #include "decode/vulkan_feature_util.h"
@@ -33,12 +35,17 @@
 #include "generated/generated_vulkan_struct_handle_mappers.h"
 #include "graphics/vulkan_device_util.h"
 #include "graphics/vulkan_util.h"
+#include "util/date_time.h"
 #include "util/file_path.h"
 #include "util/hash.h"
+#include "util/instrumentation.h"
 #include "util/platform.h"
 
+#include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <thread>
 #include <unordered_set>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -107,6 +114,46 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL DebugUtilsCallback(VkDebugUtilsMessageSeve
     return VK_FALSE;
 }
 
+static bool IsSameDescriptor(const DescriptorContents& lhs, const DescriptorContents& rhs)
+{
+    return (lhs.type != VK_DESCRIPTOR_TYPE_MAX_ENUM) && (lhs.type == rhs.type) && (lhs.sampler_id == rhs.sampler_id) &&
+           (lhs.object_id == rhs.object_id) && (lhs.image_layout == rhs.image_layout) && (lhs.offset == rhs.offset) &&
+           (lhs.range == rhs.range);
+}
+
+static void InvalidateCachedDescriptors(DescriptorSetInfo* set_info)
+{
+    for (auto& binding : set_info->descriptors)
+    {
+        binding.second.assign(binding.second.size(), DescriptorContents{});
+    }
+}
+
+// Copies the shader binding table regions of a trace rays command to regions, remapping their device addresses and
+// redirecting them to copies with replay shader group handles.
+static void
+RemapShaderBindingTables(VulkanAddressPatcher*                                                patcher,
+                         VkCommandBuffer                                                      command_buffer,
+                         const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* raygen,
+                         const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* miss,
+                         const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* hit,
+                         const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* callable,
+                         VkStridedDeviceAddressRegionKHR                                      regions[4])
+{
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* tables[] = { raygen, miss, hit, callable };
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        const VkStridedDeviceAddressRegionKHR* region = tables[i]->GetPointer();
+
+        if (region != nullptr)
+        {
+            regions[i] = *region;
+            patcher->RemapShaderBindingTable(command_buffer, &regions[i]);
+        }
+    }
+}
+
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
 static uint32_t GetHardwareBufferFormatBpp(uint32_t format)
 {
@@ -141,15 +188,50 @@ static uint32_t GetHardwareBufferFormatBpp(uint32_t format)
 VulkanReplayConsumerBase::VulkanReplayConsumerBase(WindowFactory* window_factory, const ReplayOptions& options) :
     loader_handle_(nullptr), get_instance_proc_addr_(nullptr), create_instance_proc_(nullptr),
     window_factory_(window_factory), options_(options), loading_trim_state_(false), have_imported_semaphores_(false),
-    create_surface_count_(0), fps_info_(nullptr)
+    create_surface_count_(0), fps_info_(nullptr), timing_frame_number_(1), frame_start_time_(0), last_present_time_(0),
+    debug_labels_enabled_(false), debug_label_frame_number_(1), debug_label_submit_index_(0), current_block_index_(0),
+    resource_init_start_time_(0), aliased_resources_found_(false), pacing_capture_time_(0), pacing_replay_time_(0)
 {
     assert(window_factory != nullptr);
     assert(options.create_resource_allocator != nullptr);
 
+    if (!options.timing_report_file.empty())
+    {
+        timing_report_ = std::make_unique<graphics::FrameTimingReport>(
+            options.timing_report_file, options.timing_report_first_frame, options.timing_report_last_frame);
+        frame_start_time_ = util::datetime::GetTimestamp();
+    }
+
+    if (!options.pass_timing_report_file.empty())
+    {
+        pass_timing_report_ = std::make_unique<graphics::PassTimingReport>(
+            options.pass_timing_report_file, options.pass_timing_first_frame, options.pass_timing_last_frame);
+    }
+
     if (!options.screenshot_ranges.empty())
     {
         InitializeScreenshotHandler();
     }
+
+    if (options.pipeline_creation_threads > 0)
+    {
+        pipeline_creator_ = std::make_unique<AsyncPipelineCreator>(options.pipeline_creation_threads);
+    }
+
+    if (options.batch_submits)
+    {
+        submit_batcher_ = std::make_unique<VulkanSubmitBatcher>();
+    }
+
+    if (options.warm_up_pipelines != nullptr)
+    {
+        warm_up_creator_ = std::make_unique<AsyncPipelineCreator>(std::thread::hardware_concurrency());
+
+        for (auto& pipelines : options_.warm_up_pipelines->pipelines)
+        {
+            pending_warm_up_pipelines_.push_back(&pipelines);
+        }
+    }
 }
 
 VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
@@ -162,6 +244,29 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
                              create_surface_count_);
     }
 
+    // Finish pipeline creation before destroying the objects that pipeline creation calls may reference.
+    WaitForAsyncPipelineCreation();
+
+    if (submit_batcher_ != nullptr)
+    {
+        FlushSubmitBatch();
+
+        GFXRECON_LOG_INFO("Merged %" PRIu64 " queue submissions into %" PRIu64 " batched submissions",
+                          submit_batcher_->GetBatchedCallCount(),
+                          submit_batcher_->GetBatchCount());
+    }
+
+    UnlockHardwareBuffers();
+
+    // Report the memory usage of the frames after the last complete frame range, before any objects are destroyed.
+    if (options_.memory_report != nullptr)
+    {
+        UpdateMemoryUsage();
+        options_.memory_report->Flush();
+    }
+
+    CompleteSwapchainImageInits(VK_NULL_HANDLE);
+
     // Idle all devices before destroying other resources, and cleanup screenshot resources before destroying device.
     object_info_table_.VisitDeviceInfo([this](const DeviceInfo* info) {
         assert(info != nullptr);
@@ -172,18 +277,69 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
 
         device_table->DeviceWaitIdle(device);
 
+        auto timer_entry = submit_timers_.find(device);
+        if (timer_entry != submit_timers_.end())
+        {
+            AddGpuFrameTimes(timer_entry->second.get(), true);
+            submit_timers_.erase(timer_entry);
+        }
+
+        auto pass_timer_entry = pass_timers_.find(device);
+        if (pass_timer_entry != pass_timers_.end())
+        {
+            AddGpuPassTimes(pass_timer_entry->second.get(), true);
+            pass_timers_.erase(pass_timer_entry);
+        }
+
+        submit_pacers_.erase(device);
+        address_patchers_.erase(device);
+        accel_struct_caches_.erase(device);
+        present_image_copiers_.erase(device);
+        pool_caches_.erase(device);
+
+        DestroyWarmUpObjects(info);
+        SaveReplayPipelineCache(info);
+
         if (screenshot_handler_ != nullptr)
         {
             screenshot_handler_->DestroyDeviceResources(device, device_table);
         }
+
+        frame_loop_states_.erase(device);
     });
 
+    if (timing_report_ != nullptr)
+    {
+        timing_report_->Write();
+    }
+
+    if (pass_timing_report_ != nullptr)
+    {
+        pass_timing_report_->Write();
+    }
+
+    // Write the startup report of a replay that did not present.
+    if ((options_.startup_report != nullptr) && !options_.startup_report->HasFirstPresent())
+    {
+        options_.startup_report->Write();
+    }
+
+    if (options_.fast_exit)
+    {
+        // The live objects, windows, and loader are left for the process exit to reclaim, which is much faster than
+        // destroying the objects one at a time for large captures.
+        GFXRECON_LOG_INFO("Skipping the destruction of live objects for fast exit");
+        return;
+    }
+
     object_cleanup::FreeAllLiveObjects(
         &object_info_table_,
         false,
         true,
         [this](const void* handle) { return GetInstanceTable(handle); },
-        [this](const void* handle) { return GetDeviceTable(handle); });
+        [this](const void* handle) { return GetDeviceTable(handle); },
+        [this](const DeviceInfo* info) { return RetainDevice(info); },
+        [this](const InstanceInfo* info) { return RetainInstance(info); });
 
     // Destroy any windows that were created for Vulkan surfaces.
     for (auto window : active_windows_)
@@ -193,7 +349,15 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
 
     if (loader_handle_ != nullptr)
     {
-        graphics::ReleaseLoader(loader_handle_);
+        if (options_.retained_objects != nullptr)
+        {
+            // Retained objects are destroyed through the loader after this consumer is destroyed.
+            options_.retained_objects->RetainLoader(loader_handle_);
+        }
+        else
+        {
+            graphics::ReleaseLoader(loader_handle_);
+        }
     }
 }
 
@@ -201,6 +365,11 @@ void VulkanReplayConsumerBase::ProcessStateBeginMarker(uint64_t frame_number)
 {
     GFXRECON_LOG_INFO("Loading state for captured frame %" PRId64, frame_number);
     loading_trim_state_ = true;
+
+    if (options_.startup_report != nullptr)
+    {
+        options_.startup_report->BeginStateLoad();
+    }
 }
 
 void VulkanReplayConsumerBase::ProcessStateEndMarker(uint64_t frame_number)
@@ -211,6 +380,31 @@ void VulkanReplayConsumerBase::ProcessStateEndMarker(uint64_t frame_number)
     {
         fps_info_->ProcessStateEndMarker(frame_number);
     }
+
+    // The swapchain images must be ready for the first frame.
+    CompleteSwapchainImageInits(VK_NULL_HANDLE);
+
+    // Exclude the time spent loading the trimmed state from the first frame's CPU time.
+    frame_start_time_ = util::datetime::GetTimestamp();
+
+    SubmitWarmUpPipelines();
+
+    if (options_.startup_report != nullptr)
+    {
+        options_.startup_report->EndStateLoad();
+    }
+}
+
+void VulkanReplayConsumerBase::ProcessFastForwardEnd(uint32_t                             frame_number,
+                                                     uint64_t                             skipped_command_count,
+                                                     const std::vector<format::HandleId>& incomplete_command_buffers)
+{
+    GFXRECON_LOG_INFO("Fast forwarded to frame %u, skipping %" PRIu64 " draw, dispatch, and trace rays commands",
+                      frame_number,
+                      skipped_command_count);
+
+    // The command buffers that still contain the dropped commands are reported if they are submitted again.
+    incomplete_command_buffers_.insert(incomplete_command_buffers.begin(), incomplete_command_buffers.end());
 }
 
 void VulkanReplayConsumerBase::ProcessDisplayMessageCommand(const std::string& message)
@@ -223,6 +417,11 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
                                                         uint64_t       size,
                                                         const uint8_t* data)
 {
+    // Memory fills that are not part of a resource initialization command block are timed separately.
+    graphics::StartupTimingReport::ScopedPhase phase(
+        (loading_trim_state_ && (resource_init_start_time_ == 0)) ? options_.startup_report.get() : nullptr,
+        graphics::StartupTimingReport::kStateResourceInitialization);
+
     VkResult result = VK_ERROR_INITIALIZATION_FAILED;
 
     // We need to find the device memory associated with this ID, and then lookup its mapped pointer.
@@ -234,7 +433,17 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
 
         if (allocator != nullptr)
         {
-            result = allocator->WriteMappedMemoryRange(memory_info->allocator_data, offset, size, data);
+            if (options_.coalesce_memory_fills)
+            {
+                // Buffer the data until the memory is used, so that consecutive fills can be merged and written to the
+                // allocator together.
+                pending_memory_fills_[memory_id].Add(offset, size, data);
+                result = VK_SUCCESS;
+            }
+            else
+            {
+                result = allocator->WriteMappedMemoryRange(memory_info->allocator_data, offset, size, data);
+            }
         }
         else
         {
@@ -251,15 +460,22 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
         {
             result = VK_SUCCESS;
 
-            void*                           buffer_data = nullptr;
-            const HardwareBufferMemoryInfo& buffer_info = entry->second;
+            HardwareBufferMemoryInfo& buffer_info = entry->second;
 
-            int lock_result = AHardwareBuffer_lock(
-                buffer_info.hardware_buffer, AHARDWAREBUFFER_USAGE_CPU_WRITE_OFTEN, -1, nullptr, &buffer_data);
+            // The buffer stays locked for consecutive fills, and is unlocked before the next queue submission.
+            int lock_result = 0;
+            if (buffer_info.locked_data == nullptr)
+            {
+                lock_result = AHardwareBuffer_lock(buffer_info.hardware_buffer,
+                                                   AHARDWAREBUFFER_USAGE_CPU_WRITE_OFTEN,
+                                                   -1,
+                                                   nullptr,
+                                                   &buffer_info.locked_data);
+            }
 
             if (lock_result == 0)
             {
-                assert(buffer_data != nullptr);
+                assert(buffer_info.locked_data != nullptr);
 
                 if (buffer_info.plane_info.size() == 1)
                 {
@@ -272,7 +488,7 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
                     size_t   replay_row_pitch  = buffer_info.plane_info[0].replay_row_pitch;
                     uint32_t height            = buffer_info.plane_info[0].height;
 
-                    resource::CopyImageSubresourceMemory(static_cast<uint8_t*>(buffer_data),
+                    resource::CopyImageSubresourceMemory(static_cast<uint8_t*>(buffer_info.locked_data),
                                                          data,
                                                          data_offset,
                                                          data_size,
@@ -288,17 +504,11 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
                                        "): support not yet implemented",
                                        memory_id);
                 }
-
-                lock_result = AHardwareBuffer_unlock(buffer_info.hardware_buffer, nullptr);
-                if (lock_result != 0)
-                {
-                    GFXRECON_LOG_ERROR("AHardwareBuffer_unlock failed for AHardwareBuffer object (Memory ID = %" PRIu64
-                                       ")",
-                                       memory_id);
-                }
             }
             else
             {
+                buffer_info.locked_data = nullptr;
+
                 GFXRECON_LOG_ERROR("AHardwareBuffer_lock failed for AHardwareBuffer object (Memory ID = %" PRIu64 ")",
                                    memory_id);
             }
@@ -318,6 +528,235 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
     }
 }
 
+void VulkanReplayConsumerBase::ApplyPendingMemoryFills(format::HandleId memory_id)
+{
+    auto entry = pending_memory_fills_.find(memory_id);
+    if (entry != pending_memory_fills_.end())
+    {
+        WritePendingMemoryFills(memory_id, &entry->second);
+        pending_memory_fills_.erase(entry);
+    }
+}
+
+void VulkanReplayConsumerBase::ApplyPendingMemoryFills()
+{
+    for (auto& entry : pending_memory_fills_)
+    {
+        WritePendingMemoryFills(entry.first, &entry.second);
+    }
+
+    pending_memory_fills_.clear();
+
+    UnlockHardwareBuffers();
+}
+
+void VulkanReplayConsumerBase::WritePendingMemoryFills(format::HandleId memory_id, CoalescedMemoryFills* fills)
+{
+    assert(fills != nullptr);
+
+    const DeviceMemoryInfo* memory_info = object_info_table_.GetDeviceMemoryInfo(memory_id);
+
+    if ((memory_info != nullptr) && (memory_info->allocator != nullptr))
+    {
+        fills->Apply([memory_id, memory_info](uint64_t offset, uint64_t size, const uint8_t* data) {
+            VkResult result =
+                memory_info->allocator->WriteMappedMemoryRange(memory_info->allocator_data, offset, size, data);
+
+            if (result == VK_ERROR_MEMORY_MAP_FAILED)
+            {
+                GFXRECON_LOG_WARNING("Skipping memory fill for VkDeviceMemory object (ID = %" PRIu64
+                                     ") that is not mapped",
+                                     memory_id);
+            }
+        });
+    }
+}
+
+void VulkanReplayConsumerBase::UnlockHardwareBuffers()
+{
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    for (auto& entry : hardware_buffer_memory_info_)
+    {
+        HardwareBufferMemoryInfo& buffer_info = entry.second;
+
+        if (buffer_info.locked_data != nullptr)
+        {
+            buffer_info.locked_data = nullptr;
+
+            if (AHardwareBuffer_unlock(buffer_info.hardware_buffer, nullptr) != 0)
+            {
+                GFXRECON_LOG_ERROR("AHardwareBuffer_unlock failed for AHardwareBuffer object (Memory ID = %" PRIu64
+                                   ")",
+                                   entry.first);
+            }
+        }
+    }
+#endif
+}
+
+bool VulkanReplayConsumerBase::SaveFrameLoopState()
+{
+    ApplyPendingMemoryFills();
+
+    // Resources that are first used by the looped frames are restored to their initialized contents.
+    if (!deferred_init_data_.empty())
+    {
+        std::vector<format::HandleId> resource_ids;
+        resource_ids.reserve(deferred_init_data_.size());
+
+        for (const auto& entry : deferred_init_data_)
+        {
+            resource_ids.push_back(entry.first);
+        }
+
+        LoadDeferredInitData(resource_ids);
+    }
+
+    WaitForDevicesIdle();
+
+    frame_loop_states_.clear();
+
+    object_info_table_.VisitDeviceInfo([this](const DeviceInfo* device_info) {
+        assert(device_info != nullptr);
+
+        VkPhysicalDevice physical_device = device_info->parent;
+        auto             instance_table  = GetInstanceTable(physical_device);
+        assert(instance_table != nullptr);
+
+        uint32_t count = 0;
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+
+        std::vector<VkQueueFamilyProperties> properties(count);
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, properties.data());
+
+        // Any queue family with graphics or compute support can also perform transfer operations.
+        uint32_t queue_family_index = VK_QUEUE_FAMILY_IGNORED;
+
+        for (uint32_t index : device_info->queue_family_indices)
+        {
+            if ((index < count) &&
+                ((properties[index].queueFlags &
+                  (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT)) != 0))
+            {
+                queue_family_index = index;
+                break;
+            }
+        }
+
+        if (queue_family_index == VK_QUEUE_FAMILY_IGNORED)
+        {
+            GFXRECON_LOG_WARNING("Memory for VkDevice object (ID = %" PRIu64
+                                 ") will not be restored for frame looping, because the device was not created with a "
+                                 "queue that supports transfer operations",
+                                 device_info->capture_id);
+            return;
+        }
+
+        VkPhysicalDeviceMemoryProperties memory_properties;
+        instance_table->GetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+
+        frame_loop_states_[device_info->handle] =
+            std::make_unique<VulkanFrameLoopState>(device_info->handle,
+                                                   GetDeviceTable(device_info->handle),
+                                                   memory_properties,
+                                                   device_info->allocator.get(),
+                                                   queue_family_index);
+    });
+
+    uint32_t skipped_count = 0;
+
+    object_info_table_.VisitDeviceMemoryInfo([this, &skipped_count](const DeviceMemoryInfo* memory_info) {
+        assert(memory_info != nullptr);
+
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(memory_info->parent_id);
+
+        if ((device_info != nullptr) && (memory_info->handle != VK_NULL_HANDLE) && !memory_info->is_dedicated)
+        {
+            auto entry = frame_loop_states_.find(device_info->handle);
+
+            if ((entry != frame_loop_states_.end()) && entry->second->AddMemory(memory_info->handle,
+                                                                                 memory_info->allocator_data,
+                                                                                 memory_info->allocation_size,
+                                                                                 memory_info->memory_type_index))
+            {
+                return;
+            }
+        }
+
+        ++skipped_count;
+    });
+
+    if (skipped_count > 0)
+    {
+        GFXRECON_LOG_WARNING("The contents of %u memory allocations cannot be restored for frame looping, and may "
+                             "differ between repeats of the looped frames",
+                             skipped_count);
+    }
+
+    bool success = true;
+
+    for (const auto& entry : frame_loop_states_)
+    {
+        VkResult result = entry.second->CopyToBackups();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to save memory contents for frame looping with error %s",
+                               enumutil::GetResultValueString(result));
+            success = false;
+        }
+        else
+        {
+            GFXRECON_LOG_INFO("Saved %" PRIu64 " bytes from %" PRIu64 " memory allocations for frame looping",
+                              static_cast<uint64_t>(entry.second->GetBackupSize()),
+                              static_cast<uint64_t>(entry.second->GetMemoryCount()));
+        }
+    }
+
+    return success;
+}
+
+bool VulkanReplayConsumerBase::RestoreFrameLoopState()
+{
+    // Fills that are still pending belong to the frames that were just replayed, and must not be written over the
+    // restored contents.
+    ApplyPendingMemoryFills();
+    WaitForDevicesIdle();
+
+    std::unordered_set<VkDeviceMemory> live_memory;
+
+    object_info_table_.VisitDeviceMemoryInfo(
+        [&live_memory](const DeviceMemoryInfo* memory_info) { live_memory.insert(memory_info->handle); });
+
+    bool success = true;
+
+    for (const auto& entry : frame_loop_states_)
+    {
+        VkResult result = entry.second->CopyFromBackups(live_memory);
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to restore memory contents for frame looping with error %s",
+                               enumutil::GetResultValueString(result));
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+void VulkanReplayConsumerBase::WaitForDevicesIdle()
+{
+    object_info_table_.VisitDeviceInfo([this](const DeviceInfo* device_info) {
+        assert(device_info != nullptr);
+
+        auto device_table = GetDeviceTable(device_info->handle);
+        assert(device_table != nullptr);
+
+        device_table->DeviceWaitIdle(device_info->handle);
+    });
+}
+
 void VulkanReplayConsumerBase::ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height)
 {
     // We need to find the surface associated with this ID, and then lookup its window.
@@ -534,8 +973,18 @@ void VulkanReplayConsumerBase::ProcessDestroyHardwareBufferCommand(uint64_t buff
     auto entry = hardware_buffers_.find(buffer_id);
     if (entry != hardware_buffers_.end())
     {
+        auto memory_entry = hardware_buffer_memory_info_.find(entry->second.memory_id);
+        if (memory_entry != hardware_buffer_memory_info_.end())
+        {
+            if (memory_entry->second.locked_data != nullptr)
+            {
+                AHardwareBuffer_unlock(memory_entry->second.hardware_buffer, nullptr);
+            }
+
+            hardware_buffer_memory_info_.erase(memory_entry);
+        }
+
         AHardwareBuffer_release(entry->second.hardware_buffer);
-        hardware_buffer_memory_info_.erase(entry->second.memory_id);
         hardware_buffers_.erase(entry);
     }
     else
@@ -632,43 +1081,170 @@ void VulkanReplayConsumerBase::ProcessSetRayTracingShaderGroupHandlesCommand(for
     }
 }
 
-void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateCommand(
-    format::HandleId                                    device_id,
-    format::HandleId                                    swapchain_id,
-    uint32_t                                            last_presented_image,
-    const std::vector<format::SwapchainImageStateInfo>& image_info)
+void VulkanReplayConsumerBase::SetCurrentApiCallId(format::ApiCallId call_id)
 {
-    const DeviceInfo* device_info    = object_info_table_.GetDeviceInfo(device_id);
-    SwapchainKHRInfo* swapchain_info = object_info_table_.GetSwapchainKHRInfo(swapchain_id);
+    // Any API call other than a queue submission may depend on the execution of the batched submissions.  Meta
+    // commands, which have no call ID, only carry data for the calls that follow them.
+    if ((submit_batcher_ != nullptr) && (call_id != format::ApiCallId::ApiCall_vkQueueSubmit) &&
+        (call_id != format::ApiCallId::ApiCall_Unknown))
+    {
+        FlushSubmitBatch();
+    }
+}
 
-    if ((device_info != nullptr) && (swapchain_info != nullptr))
+void VulkanReplayConsumerBase::ProcessTimestampCommand(uint64_t timestamp)
+{
+    if (!options_.cpu_timestamp_pacing)
     {
-        assert((device_info->handle != VK_NULL_HANDLE) && (swapchain_info->handle != VK_NULL_HANDLE));
+        return;
+    }
 
-        VkDevice       device    = device_info->handle;
-        VkSwapchainKHR swapchain = swapchain_info->handle;
+    // Each interval between captured timestamps is replayed with at least the same duration, so that replay includes
+    // the CPU time that the application spent between its queue submissions and presents.  When replay is slower than
+    // the application, the following intervals are not shortened to catch up.
+    int64_t current_time = static_cast<int64_t>(util::datetime::GetTimestamp());
 
-        VkPhysicalDevice physical_device = device_info->parent;
-        VkSurfaceKHR     surface         = swapchain_info->surface;
-        assert((physical_device != VK_NULL_HANDLE) && (surface != VK_NULL_HANDLE));
+    if ((pacing_replay_time_ != 0) && (timestamp > pacing_capture_time_))
+    {
+        int64_t target_time = pacing_replay_time_ + static_cast<int64_t>(timestamp - pacing_capture_time_);
+        if (target_time > current_time)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(target_time - current_time));
+            current_time = static_cast<int64_t>(util::datetime::GetTimestamp());
+        }
+    }
 
-        auto instance_table = GetInstanceTable(physical_device);
-        auto device_table   = GetDeviceTable(device);
-        assert((instance_table != nullptr) && (device_table != nullptr));
+    pacing_capture_time_ = timestamp;
+    pacing_replay_time_  = current_time;
+}
 
-        VkSurfaceCapabilitiesKHR surface_caps;
-        uint32_t                 image_count = 0;
+void VulkanReplayConsumerBase::ProcessSetPipelineCacheDataCommand(format::HandleId device_id,
+                                                                  size_t           data_size,
+                                                                  const uint8_t*   data)
+{
+    DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
-        VkResult result =
-            instance_table->GetPhysicalDeviceSurfaceCapabilitiesKHR(physical_device, surface, &surface_caps);
+    if ((device_info == nullptr) || (data_size == 0) || options_.omit_pipeline_cache_data)
+    {
+        return;
+    }
 
-        if (result == VK_SUCCESS)
-        {
-            result = device_table->GetSwapchainImagesKHR(device, swapchain, &image_count, nullptr);
-        }
+    VkDevice device         = device_info->handle;
+    auto     instance_table = GetInstanceTable(device_info->parent);
+    auto     device_table   = GetDeviceTable(device);
+    assert((instance_table != nullptr) && (device_table != nullptr));
 
-        if (result == VK_SUCCESS)
-        {
+    // The data is only usable by the device and driver that produced it, which is identified by the pipeline cache
+    // UUID that follows the header size, header version, vendor ID, and device ID fields of the cache header.
+    const size_t               kUuidOffset = 4 * sizeof(uint32_t);
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(device_info->parent, &properties);
+
+    if ((data_size < (kUuidOffset + VK_UUID_SIZE)) ||
+        (std::memcmp(data + kUuidOffset, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0))
+    {
+        GFXRECON_LOG_INFO("Ignoring the state snapshot pipeline cache data, which is not compatible with the replay "
+                          "device");
+        return;
+    }
+
+    VkPipelineCacheCreateInfo create_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+    create_info.pNext                     = nullptr;
+    create_info.flags                     = 0;
+    create_info.initialDataSize           = data_size;
+    create_info.pInitialData              = data;
+
+    VkPipelineCache cache  = VK_NULL_HANDLE;
+    VkResult        result = device_table->CreatePipelineCache(device, &create_info, nullptr, &cache);
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_WARNING("Failed to create a pipeline cache from the state snapshot pipeline cache data");
+        return;
+    }
+
+    // Warm the application's pipeline caches, which were created ahead of this command by the state snapshot, and
+    // the replay pipeline cache, which is used by pipeline creation calls without a cache.
+    object_info_table_.VisitPipelineCacheInfo([&](const PipelineCacheInfo* info) {
+        if ((info->parent_id == device_id) && (info->handle != VK_NULL_HANDLE))
+        {
+            device_table->MergePipelineCaches(device, info->handle, 1, &cache);
+        }
+    });
+
+    if (device_info->replay_pipeline_cache == VK_NULL_HANDLE)
+    {
+        device_info->replay_pipeline_cache = cache;
+    }
+    else
+    {
+        device_table->MergePipelineCaches(device, device_info->replay_pipeline_cache, 1, &cache);
+        device_table->DestroyPipelineCache(device, cache, nullptr);
+    }
+}
+
+void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateCommand(
+    format::HandleId                                    device_id,
+    format::HandleId                                    swapchain_id,
+    uint32_t                                            last_presented_image,
+    const std::vector<format::SwapchainImageStateInfo>& image_info)
+{
+    const DeviceInfo* device_info    = object_info_table_.GetDeviceInfo(device_id);
+    SwapchainKHRInfo* swapchain_info = object_info_table_.GetSwapchainKHRInfo(swapchain_id);
+
+    if ((device_info != nullptr) && (swapchain_info != nullptr) && (swapchain_info->surface == VK_NULL_HANDLE))
+    {
+        // Dummy swapchain images are never acquired from a presentation engine, and acquire semaphores and fences
+        // are ignored when they are waited on, so the only state to restore is which images are acquired.
+        for (const auto& entry : image_info)
+        {
+            if (entry.acquired)
+            {
+                SemaphoreInfo* semaphore_info = object_info_table_.GetSemaphoreInfo(entry.acquire_semaphore_id);
+                FenceInfo*     fence_info     = object_info_table_.GetFenceInfo(entry.acquire_fence_id);
+
+                if (semaphore_info != nullptr)
+                {
+                    semaphore_info->shadow_signaled = true;
+                    shadow_semaphores_.insert(semaphore_info->handle);
+                }
+
+                if (fence_info != nullptr)
+                {
+                    fence_info->shadow_signaled = true;
+                    shadow_fences_.insert(fence_info->handle);
+                }
+            }
+        }
+    }
+    else if ((device_info != nullptr) && (swapchain_info != nullptr))
+    {
+        assert((device_info->handle != VK_NULL_HANDLE) && (swapchain_info->handle != VK_NULL_HANDLE));
+
+        VkDevice       device    = device_info->handle;
+        VkSwapchainKHR swapchain = swapchain_info->handle;
+
+        VkPhysicalDevice physical_device = device_info->parent;
+        VkSurfaceKHR     surface         = swapchain_info->surface;
+        assert((physical_device != VK_NULL_HANDLE) && (surface != VK_NULL_HANDLE));
+
+        auto instance_table = GetInstanceTable(physical_device);
+        auto device_table   = GetDeviceTable(device);
+        assert((instance_table != nullptr) && (device_table != nullptr));
+
+        VkSurfaceCapabilitiesKHR surface_caps;
+        uint32_t                 image_count = 0;
+
+        VkResult result =
+            instance_table->GetPhysicalDeviceSurfaceCapabilitiesKHR(physical_device, surface, &surface_caps);
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table->GetSwapchainImagesKHR(device, swapchain, &image_count, nullptr);
+        }
+
+        if (result == VK_SUCCESS)
+        {
             // TODO: Handle swapchain image count mismatch on replay.
             assert(image_info.size() == image_count);
 
@@ -722,74 +1298,64 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStatePreAcquire(
     auto table = GetDeviceTable(device);
     assert(table != nullptr);
 
-    VkResult        result             = VK_SUCCESS;
-    VkQueue         transition_queue   = VK_NULL_HANDLE;
-    VkCommandPool   transition_pool    = VK_NULL_HANDLE;
-    VkCommandBuffer transition_command = VK_NULL_HANDLE;
-    VkSwapchainKHR  swapchain          = swapchain_info->handle;
-    uint32_t        queue_family_index = swapchain_info->queue_family_index;
+    VkResult                  result             = VK_SUCCESS;
+    VkQueue                   transition_queue   = VK_NULL_HANDLE;
+    VkCommandBuffer           transition_command = VK_NULL_HANDLE;
+    VkSwapchainKHR            swapchain          = swapchain_info->handle;
+    uint32_t                  queue_family_index = swapchain_info->queue_family_index;
+    PendingSwapchainImageInit pending_init;
+
+    pending_init.device = device;
 
     // TODO: Improved queue selection?
     table->GetDeviceQueue(device, queue_family_index, 0, &transition_queue);
 
     VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
     pool_create_info.pNext                   = nullptr;
-    pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_create_info.flags                   = 0;
     pool_create_info.queueFamilyIndex        = queue_family_index;
 
-    result = table->CreateCommandPool(device, &pool_create_info, nullptr, &transition_pool);
+    result = table->CreateCommandPool(device, &pool_create_info, nullptr, &pending_init.command_pool);
 
     if (result == VK_SUCCESS)
     {
         VkCommandBufferAllocateInfo command_allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
         command_allocate_info.pNext                       = nullptr;
         command_allocate_info.commandBufferCount          = 1;
-        command_allocate_info.commandPool                 = transition_pool;
+        command_allocate_info.commandPool                 = pending_init.command_pool;
         command_allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
 
-        table->AllocateCommandBuffers(device, &command_allocate_info, &transition_command);
+        result = table->AllocateCommandBuffers(device, &command_allocate_info, &transition_command);
     }
 
     if (result == VK_SUCCESS)
     {
-        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-        begin_info.pNext                    = nullptr;
-        begin_info.flags                    = 0;
-        begin_info.pInheritanceInfo         = nullptr;
+        VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        fence_create_info.pNext             = nullptr;
+        fence_create_info.flags             = 0;
 
-        VkSubmitInfo submit_info       = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
-        submit_info.pNext              = nullptr;
-        submit_info.commandBufferCount = 1;
-        submit_info.pCommandBuffers    = &transition_command;
+        result = table->CreateFence(device, &fence_create_info, nullptr, &pending_init.fence);
+    }
 
-        VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-        image_barrier.pNext                           = nullptr;
-        image_barrier.srcAccessMask                   = 0;
-        image_barrier.dstAccessMask                   = 0;
-        image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
-        image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-        image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-        image_barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-        image_barrier.subresourceRange.baseMipLevel   = 0;
-        image_barrier.subresourceRange.levelCount     = 1;
-        image_barrier.subresourceRange.baseArrayLayer = 0;
-        image_barrier.subresourceRange.layerCount     = 1;
+    if (result == VK_SUCCESS)
+    {
+        std::vector<VkFence>     acquire_fences(image_info.size(), VK_NULL_HANDLE);
+        std::vector<VkSemaphore> acquire_semaphores(image_info.size(), VK_NULL_HANDLE);
+        std::vector<bool>        image_acquired(image_info.size(), false);
+        std::vector<VkFence>     wait_fences;
 
+        // Pre-acquire all swapchain images while processing trimming state snapshot.  The images are acquired before
+        // waiting for any of them, so that the acquires complete with a single wait.
         for (size_t i = 0; i < image_info.size(); ++i)
         {
             const ImageInfo* image_entry = object_info_table_.GetImageInfo(image_info[i].image_id);
 
-            // Pre-acquire and transition swapchain images while processing trimming state snapshot.
             if (image_entry != nullptr)
             {
                 assert(image_entry->handle != VK_NULL_HANDLE);
 
-                VkImage  image       = image_entry->handle;
                 uint32_t image_index = 0;
 
-                VkFence     acquire_fence     = VK_NULL_HANDLE;
-                VkSemaphore acquire_semaphore = VK_NULL_HANDLE;
-
                 VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
                 fence_create_info.pNext             = nullptr;
                 fence_create_info.flags             = 0;
@@ -798,11 +1364,11 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStatePreAcquire(
                 semaphore_create_info.pNext                 = nullptr;
                 semaphore_create_info.flags                 = 0;
 
-                result = table->CreateFence(device, &fence_create_info, nullptr, &acquire_fence);
+                result = table->CreateFence(device, &fence_create_info, nullptr, &acquire_fences[i]);
 
                 if (result == VK_SUCCESS)
                 {
-                    result = table->CreateSemaphore(device, &semaphore_create_info, nullptr, &acquire_semaphore);
+                    result = table->CreateSemaphore(device, &semaphore_create_info, nullptr, &acquire_semaphores[i]);
                 }
 
                 if (result == VK_SUCCESS)
@@ -810,91 +1376,150 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStatePreAcquire(
                     result = table->AcquireNextImageKHR(device,
                                                         swapchain,
                                                         std::numeric_limits<uint64_t>::max(),
-                                                        acquire_semaphore,
-                                                        acquire_fence,
+                                                        acquire_semaphores[i],
+                                                        acquire_fences[i],
                                                         &image_index);
+                }
 
-                    if ((result == VK_SUCCESS) || (result == VK_SUBOPTIMAL_KHR))
-                    {
-                        // TODO: Handle case where image acquired at replay does not match image acquired at
-                        // capture.
-                        assert(image_index == i);
+                if ((result == VK_SUCCESS) || (result == VK_SUBOPTIMAL_KHR))
+                {
+                    // TODO: Handle case where image acquired at replay does not match image acquired at capture.
+                    assert(image_index == i);
 
-                        result =
-                            table->WaitForFences(device, 1, &acquire_fence, true, std::numeric_limits<uint64_t>::max());
+                    image_acquired[i] = true;
+                    wait_fences.push_back(acquire_fences[i]);
+                }
+                else
+                {
+                    GFXRECON_LOG_WARNING("Failed to acquire VkImage object (ID = %" PRIu64
+                                         ") for swapchain state initialization",
+                                         image_info[i].image_id);
 
-                        VkImageLayout image_layout = static_cast<VkImageLayout>(image_info[image_index].image_layout);
-                        if ((result == VK_SUCCESS) && (image_layout != VK_IMAGE_LAYOUT_UNDEFINED))
-                        {
-                            image_barrier.newLayout = image_layout;
-                            image_barrier.image     = image;
+                    table->DestroyFence(device, acquire_fences[i], nullptr);
+                    table->DestroySemaphore(device, acquire_semaphores[i], nullptr);
+                }
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Skipping image acquire for unrecognized VkImage object (ID = %" PRIu64 ")",
+                                     image_info[i].image_id);
+            }
+        }
 
-                            result = table->BeginCommandBuffer(transition_command, &begin_info);
+        result = VK_SUCCESS;
 
-                            if (result == VK_SUCCESS)
-                            {
-                                table->CmdPipelineBarrier(transition_command,
-                                                          VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                          0,
-                                                          0,
-                                                          nullptr,
-                                                          0,
-                                                          nullptr,
-                                                          1,
-                                                          &image_barrier);
-                                table->EndCommandBuffer(transition_command);
-
-                                result = table->ResetFences(device, 1, &acquire_fence);
-                            }
+        if (!wait_fences.empty())
+        {
+            result = table->WaitForFences(device,
+                                          static_cast<uint32_t>(wait_fences.size()),
+                                          wait_fences.data(),
+                                          VK_TRUE,
+                                          std::numeric_limits<uint64_t>::max());
+        }
 
-                            if (result == VK_SUCCESS)
-                            {
-                                result = table->QueueSubmit(transition_queue, 1, &submit_info, acquire_fence);
-                            }
+        // Transition all of the acquired images with one submission, which is completed while the rest of the trimmed
+        // state is loaded.
+        std::vector<VkImageMemoryBarrier> image_barriers;
 
-                            if (result == VK_SUCCESS)
-                            {
-                                result = table->WaitForFences(
-                                    device, 1, &acquire_fence, true, std::numeric_limits<uint64_t>::max());
-                            }
-                        }
+        for (size_t i = 0; (i < image_info.size()) && (result == VK_SUCCESS); ++i)
+        {
+            VkImageLayout image_layout = static_cast<VkImageLayout>(image_info[i].image_layout);
 
-                        if (result == VK_SUCCESS)
-                        {
-                            if (image_info[image_index].acquired)
-                            {
-                                swapchain_info->acquired_indices[i] = image_index;
-
-                                // The upcoming frames expect the image to be acquired. The synchronization objects
-                                // used to acquire the image were already set to the appropriate signaled state when
-                                // created, so the temporary objects used to acquire the image here can be
-                                // destroyed.
-                                table->DestroyFence(device, acquire_fence, nullptr);
-                                table->DestroySemaphore(device, acquire_semaphore, nullptr);
-                            }
-                            else
-                            {
-                                // The upcoming frames do not expect the image to be acquired. We will store the
-                                // image and the synchronization objects used to acquire it in a data structure.
-                                // Replay of vkAcquireNextImage will retrieve and use the stored objects.
-                                swapchain_image_tracker_.TrackPreAcquiredImage(
-                                    swapchain, image_index, acquire_semaphore, acquire_fence);
-                            }
-                        }
-                        else
-                        {
-                            GFXRECON_LOG_WARNING("Failed to acquire and transition VkImage object (ID = %" PRIu64
-                                                 ") for swapchain state initialization",
-                                                 image_info[i].image_id);
-                        }
-                    }
-                }
+            if (image_acquired[i] && (image_layout != VK_IMAGE_LAYOUT_UNDEFINED))
+            {
+                const ImageInfo* image_entry = object_info_table_.GetImageInfo(image_info[i].image_id);
+                assert(image_entry != nullptr);
+
+                VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+                image_barrier.pNext                           = nullptr;
+                image_barrier.srcAccessMask                   = 0;
+                image_barrier.dstAccessMask                   = 0;
+                image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+                image_barrier.newLayout                       = image_layout;
+                image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+                image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+                image_barrier.image                           = image_entry->handle;
+                image_barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+                image_barrier.subresourceRange.baseMipLevel   = 0;
+                image_barrier.subresourceRange.levelCount     = 1;
+                image_barrier.subresourceRange.baseArrayLayer = 0;
+                image_barrier.subresourceRange.layerCount     = 1;
+
+                image_barriers.push_back(image_barrier);
+            }
+        }
+
+        if ((result == VK_SUCCESS) && !image_barriers.empty())
+        {
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.pNext                    = nullptr;
+            begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            begin_info.pInheritanceInfo         = nullptr;
+
+            result = table->BeginCommandBuffer(transition_command, &begin_info);
+
+            if (result == VK_SUCCESS)
+            {
+                table->CmdPipelineBarrier(transition_command,
+                                          VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          static_cast<uint32_t>(image_barriers.size()),
+                                          image_barriers.data());
+
+                result = table->EndCommandBuffer(transition_command);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                VkSubmitInfo submit_info       = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.pNext              = nullptr;
+                submit_info.commandBufferCount = 1;
+                submit_info.pCommandBuffers    = &transition_command;
+
+                result = table->QueueSubmit(transition_queue, 1, &submit_info, pending_init.fence);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                pending_init.submitted = true;
             }
             else
             {
-                GFXRECON_LOG_WARNING("Skipping image acquire for unrecognized VkImage object (ID = %" PRIu64 ")",
-                                     image_info[i].image_id);
+                GFXRECON_LOG_WARNING("Failed to transition images of VkSwapchainKHR object (handle = 0x%" PRIx64
+                                     ") for swapchain state initialization",
+                                     swapchain);
+            }
+        }
+
+        for (size_t i = 0; i < image_info.size(); ++i)
+        {
+            if (image_acquired[i])
+            {
+                uint32_t image_index = static_cast<uint32_t>(i);
+
+                if (image_info[i].acquired)
+                {
+                    swapchain_info->acquired_indices[i] = image_index;
+
+                    // The upcoming frames expect the image to be acquired. The synchronization objects used to acquire
+                    // the image were already set to the appropriate signaled state when created, so the temporary
+                    // objects used to acquire the image here can be destroyed.
+                    table->DestroyFence(device, acquire_fences[i], nullptr);
+                    table->DestroySemaphore(device, acquire_semaphores[i], nullptr);
+                }
+                else
+                {
+                    // The upcoming frames do not expect the image to be acquired. We will store the image and the
+                    // synchronization objects used to acquire it in a data structure. Replay of vkAcquireNextImage
+                    // will retrieve and use the stored objects.
+                    swapchain_image_tracker_.TrackPreAcquiredImage(
+                        swapchain, image_index, acquire_semaphores[i], acquire_fences[i]);
+                }
             }
         }
     }
@@ -905,10 +1530,7 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStatePreAcquire(
             swapchain);
     }
 
-    if (transition_pool != VK_NULL_HANDLE)
-    {
-        table->DestroyCommandPool(device, transition_pool, nullptr);
-    }
+    pending_swapchain_image_inits_.push_back(std::move(pending_init));
 }
 
 void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
@@ -920,55 +1542,50 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
     auto table = GetDeviceTable(device);
     assert(table != nullptr);
 
-    VkResult        result             = VK_SUCCESS;
-    VkQueue         queue              = VK_NULL_HANDLE;
-    VkCommandPool   pool               = VK_NULL_HANDLE;
-    VkCommandBuffer command            = VK_NULL_HANDLE;
-    VkFence         wait_fence         = VK_NULL_HANDLE;
-    VkSwapchainKHR  swapchain          = swapchain_info->handle;
-    uint32_t        queue_family_index = swapchain_info->queue_family_index;
+    VkResult                     result             = VK_SUCCESS;
+    VkQueue                      queue              = VK_NULL_HANDLE;
+    VkSwapchainKHR               swapchain          = swapchain_info->handle;
+    uint32_t                     queue_family_index = swapchain_info->queue_family_index;
+    std::vector<VkCommandBuffer> commands;
+    PendingSwapchainImageInit    pending_init;
+
+    pending_init.device = device;
 
     VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
     pool_create_info.pNext                   = nullptr;
-    pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_create_info.flags                   = 0;
     pool_create_info.queueFamilyIndex        = queue_family_index;
 
     // TODO: Improved queue selection?
     table->GetDeviceQueue(device, queue_family_index, 0, &queue);
 
-    result = table->CreateCommandPool(device, &pool_create_info, nullptr, &pool);
+    pending_init.queue = queue;
+
+    result = table->CreateCommandPool(device, &pool_create_info, nullptr, &pending_init.command_pool);
 
     if (result == VK_SUCCESS)
     {
+        // Each image is transitioned by its own command buffer in each of the two passes below, as the command buffers
+        // are not waited on before the next image is processed.
+        commands.resize(image_info.size() * 2, VK_NULL_HANDLE);
+
         VkCommandBufferAllocateInfo command_allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
         command_allocate_info.pNext                       = nullptr;
-        command_allocate_info.commandBufferCount          = 1;
-        command_allocate_info.commandPool                 = pool;
+        command_allocate_info.commandBufferCount          = static_cast<uint32_t>(commands.size());
+        command_allocate_info.commandPool                 = pending_init.command_pool;
         command_allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
 
-        result = table->AllocateCommandBuffers(device, &command_allocate_info, &command);
-    }
-
-    if (result == VK_SUCCESS)
-    {
-        VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
-        fence_create_info.pNext             = nullptr;
-        fence_create_info.flags             = VK_FENCE_CREATE_SIGNALED_BIT;
-
-        result = table->CreateFence(device, &fence_create_info, nullptr, &wait_fence);
+        result = table->AllocateCommandBuffers(device, &command_allocate_info, commands.data());
     }
 
     if (result == VK_SUCCESS)
     {
         VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
         begin_info.pNext                    = nullptr;
-        begin_info.flags                    = 0;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         begin_info.pInheritanceInfo         = nullptr;
 
-        VkSubmitInfo submit_info       = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
-        submit_info.pNext              = nullptr;
-        submit_info.commandBufferCount = 1;
-        submit_info.pCommandBuffers    = &command;
+        VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
 
         VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
         image_barrier.pNext                           = nullptr;
@@ -984,13 +1601,82 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
         image_barrier.subresourceRange.baseArrayLayer = 0;
         image_barrier.subresourceRange.layerCount     = 1;
 
-        VkPresentInfoKHR present_info   = { VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
-        present_info.pNext              = nullptr;
-        present_info.waitSemaphoreCount = 0;
-        present_info.pWaitSemaphores    = nullptr;
-        present_info.swapchainCount     = 1;
-        present_info.pSwapchains        = &swapchain;
-        present_info.pResults           = nullptr;
+        VkPresentInfoKHR present_info = { VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
+        present_info.pNext            = nullptr;
+        present_info.swapchainCount   = 1;
+        present_info.pSwapchains      = &swapchain;
+        present_info.pResults         = nullptr;
+
+        // Acquires, submissions, and presents are ordered with semaphores instead of waiting for each of them to
+        // complete, with each semaphore signaled and waited on once.  The semaphores are destroyed after the queue
+        // is idle when the trimmed state load ends.
+        auto create_semaphore = [&](VkSemaphore* semaphore) {
+            VkSemaphoreCreateInfo semaphore_create_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+            semaphore_create_info.pNext                 = nullptr;
+            semaphore_create_info.flags                 = 0;
+
+            VkResult create_result = table->CreateSemaphore(device, &semaphore_create_info, nullptr, semaphore);
+
+            if (create_result == VK_SUCCESS)
+            {
+                pending_init.semaphores.push_back(*semaphore);
+            }
+
+            return create_result;
+        };
+
+        // Submits a command buffer that waits for the acquire semaphore, and optionally transitions the image and
+        // signals a semaphore for a present.
+        auto submit_commands = [&](VkSemaphore     wait_semaphore,
+                                   VkCommandBuffer command,
+                                   VkImage         image,
+                                   VkImageLayout   new_layout,
+                                   VkSemaphore     signal_semaphore) {
+            VkResult submit_result = VK_SUCCESS;
+
+            if (new_layout != VK_IMAGE_LAYOUT_UNDEFINED)
+            {
+                image_barrier.newLayout = new_layout;
+                image_barrier.image     = image;
+
+                submit_result = table->BeginCommandBuffer(command, &begin_info);
+
+                if (submit_result == VK_SUCCESS)
+                {
+                    table->CmdPipelineBarrier(command,
+                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                              0,
+                                              0,
+                                              nullptr,
+                                              0,
+                                              nullptr,
+                                              1,
+                                              &image_barrier);
+
+                    submit_result = table->EndCommandBuffer(command);
+                }
+            }
+
+            if (submit_result == VK_SUCCESS)
+            {
+                bool record = (new_layout != VK_IMAGE_LAYOUT_UNDEFINED);
+
+                VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.pNext                = nullptr;
+                submit_info.waitSemaphoreCount   = 1;
+                submit_info.pWaitSemaphores      = &wait_semaphore;
+                submit_info.pWaitDstStageMask    = &wait_stage;
+                submit_info.commandBufferCount   = record ? 1 : 0;
+                submit_info.pCommandBuffers      = record ? &command : nullptr;
+                submit_info.signalSemaphoreCount = (signal_semaphore != VK_NULL_HANDLE) ? 1 : 0;
+                submit_info.pSignalSemaphores    = (signal_semaphore != VK_NULL_HANDLE) ? &signal_semaphore : nullptr;
+
+                submit_result = table->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+            }
+
+            return submit_result;
+        };
 
         // Acquire, transition to the present source layout, and present each image.
         for (size_t i = 0; i < image_info.size(); ++i)
@@ -1001,18 +1687,24 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
             {
                 assert(image_entry->handle != VK_NULL_HANDLE);
 
-                VkImage  image       = image_entry->handle;
-                uint32_t image_index = 0;
+                uint32_t    image_index       = 0;
+                VkSemaphore acquire_semaphore = VK_NULL_HANDLE;
+                VkSemaphore present_semaphore = VK_NULL_HANDLE;
 
-                result = table->ResetFences(device, 1, &wait_fence);
+                result = create_semaphore(&acquire_semaphore);
+
+                if (result == VK_SUCCESS)
+                {
+                    result = create_semaphore(&present_semaphore);
+                }
 
                 if (result == VK_SUCCESS)
                 {
                     result = table->AcquireNextImageKHR(device,
                                                         swapchain,
                                                         std::numeric_limits<uint64_t>::max(),
+                                                        acquire_semaphore,
                                                         VK_NULL_HANDLE,
-                                                        wait_fence,
                                                         &image_index);
                 }
 
@@ -1021,56 +1713,23 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
                     // TODO: Handle case where image acquired at replay does not match image acquired at capture.
                     assert(image_index == i);
 
-                    result = table->WaitForFences(device, 1, &wait_fence, true, std::numeric_limits<uint64_t>::max());
-
-                    if (result == VK_SUCCESS)
-                    {
-                        image_barrier.image        = image;
-                        present_info.pImageIndices = &image_index;
-
-                        result = table->BeginCommandBuffer(command, &begin_info);
-                    }
-
-                    if (result == VK_SUCCESS)
-                    {
-                        table->CmdPipelineBarrier(command,
-                                                  VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                  0,
-                                                  0,
-                                                  nullptr,
-                                                  0,
-                                                  nullptr,
-                                                  1,
-                                                  &image_barrier);
-                        table->EndCommandBuffer(command);
-
-                        result = table->ResetFences(device, 1, &wait_fence);
-                    }
-
-                    if (result == VK_SUCCESS)
-                    {
-                        result = table->QueueSubmit(queue, 1, &submit_info, wait_fence);
-                    }
+                    result = submit_commands(acquire_semaphore,
+                                             commands[i],
+                                             image_entry->handle,
+                                             VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                                             present_semaphore);
 
                     if (result == VK_SUCCESS)
                     {
-                        result =
-                            table->WaitForFences(device, 1, &wait_fence, true, std::numeric_limits<uint64_t>::max());
-                    }
+                        present_info.waitSemaphoreCount = 1;
+                        present_info.pWaitSemaphores    = &present_semaphore;
+                        present_info.pImageIndices      = &image_index;
 
-                    if (result == VK_SUCCESS)
-                    {
                         result = table->QueuePresentKHR(queue, &present_info);
                     }
-
-                    if ((result == VK_SUCCESS) || (result == VK_SUBOPTIMAL_KHR))
-                    {
-                        result = table->QueueWaitIdle(queue);
-                    }
                 }
 
-                if (result != VK_SUCCESS)
+                if ((result != VK_SUCCESS) && (result != VK_SUBOPTIMAL_KHR))
                 {
                     GFXRECON_LOG_WARNING("Failed to acquire and transition VkImage object (ID = %" PRIu64
                                          ") for swapchain state initialization",
@@ -1095,18 +1754,18 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
             {
                 assert(image_entry->handle != VK_NULL_HANDLE);
 
-                VkImage  image       = image_entry->handle;
-                uint32_t image_index = 0;
+                uint32_t    image_index       = 0;
+                VkSemaphore acquire_semaphore = VK_NULL_HANDLE;
 
-                result = table->ResetFences(device, 1, &wait_fence);
+                result = create_semaphore(&acquire_semaphore);
 
                 if (result == VK_SUCCESS)
                 {
                     result = table->AcquireNextImageKHR(device,
                                                         swapchain,
                                                         std::numeric_limits<uint64_t>::max(),
+                                                        acquire_semaphore,
                                                         VK_NULL_HANDLE,
-                                                        wait_fence,
                                                         &image_index);
                 }
 
@@ -1115,70 +1774,37 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
                     // TODO: Handle case where image acquired at replay does not match image acquired at capture.
                     assert(image_index == i);
 
-                    result = table->WaitForFences(device, 1, &wait_fence, true, std::numeric_limits<uint64_t>::max());
-
-                    if (result == VK_SUCCESS)
+                    if (image_info[i].acquired)
                     {
-                        if (image_info[i].acquired)
-                        {
-                            swapchain_info->acquired_indices[i] = image_index;
-
-                            // Transition the image to the expected layout and keep it acquired.
-                            VkImageLayout image_layout = static_cast<VkImageLayout>(image_info[i].image_layout);
-                            if ((image_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                                (image_layout != VK_IMAGE_LAYOUT_PRESENT_SRC_KHR))
-                            {
-
-                                image_barrier.newLayout = image_layout;
-                                image_barrier.image     = image;
-
-                                result = table->BeginCommandBuffer(command, &begin_info);
-
-                                if (result == VK_SUCCESS)
-                                {
-                                    table->CmdPipelineBarrier(command,
-                                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                              0,
-                                                              0,
-                                                              nullptr,
-                                                              0,
-                                                              nullptr,
-                                                              1,
-                                                              &image_barrier);
-                                    table->EndCommandBuffer(command);
-
-                                    result = table->ResetFences(device, 1, &wait_fence);
-                                }
-
-                                if (result == VK_SUCCESS)
-                                {
-                                    result = table->QueueSubmit(queue, 1, &submit_info, wait_fence);
-                                }
+                        swapchain_info->acquired_indices[i] = image_index;
 
-                                if (result == VK_SUCCESS)
-                                {
-                                    result = table->WaitForFences(
-                                        device, 1, &wait_fence, true, std::numeric_limits<uint64_t>::max());
-                                }
-                            }
-                        }
-                        else
+                        // Transition the image to the expected layout and keep it acquired.  The acquire semaphore
+                        // is waited on by a submission even when there is no transition, so that the image is
+                        // available before the submissions that follow it.
+                        VkImageLayout image_layout = static_cast<VkImageLayout>(image_info[i].image_layout);
+                        if (image_layout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR)
                         {
-                            // Image is not expected to be in the acquired state, so present it.
-                            present_info.pImageIndices = &image_index;
+                            image_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+                        }
 
-                            result = table->QueuePresentKHR(queue, &present_info);
+                        result = submit_commands(acquire_semaphore,
+                                                 commands[image_info.size() + i],
+                                                 image_entry->handle,
+                                                 image_layout,
+                                                 VK_NULL_HANDLE);
+                    }
+                    else
+                    {
+                        // Image is not expected to be in the acquired state, so present it.
+                        present_info.waitSemaphoreCount = 1;
+                        present_info.pWaitSemaphores    = &acquire_semaphore;
+                        present_info.pImageIndices      = &image_index;
 
-                            if ((result == VK_SUCCESS) || (result == VK_SUBOPTIMAL_KHR))
-                            {
-                                result = table->QueueWaitIdle(queue);
-                            }
-                        }
+                        result = table->QueuePresentKHR(queue, &present_info);
                     }
                 }
 
-                if (result != VK_SUCCESS)
+                if ((result != VK_SUCCESS) && (result != VK_SUBOPTIMAL_KHR))
                 {
                     GFXRECON_LOG_WARNING("Failed to acquire and transition VkImage object (ID = %" PRIu64
                                          ") for swapchain state initialization",
@@ -1199,14 +1825,44 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateQueueSubmit(
             swapchain);
     }
 
-    if (pool != VK_NULL_HANDLE)
-    {
-        table->DestroyCommandPool(device, pool, nullptr);
-    }
+    pending_swapchain_image_inits_.push_back(std::move(pending_init));
+}
+
+void VulkanReplayConsumerBase::CompleteSwapchainImageInits(VkDevice device)
+{
+    auto iter = pending_swapchain_image_inits_.begin();
 
-    if (wait_fence != VK_NULL_HANDLE)
+    while (iter != pending_swapchain_image_inits_.end())
     {
-        table->DestroyFence(device, wait_fence, nullptr);
+        if ((device == VK_NULL_HANDLE) || (iter->device == device))
+        {
+            auto table = GetDeviceTable(iter->device);
+            assert(table != nullptr);
+
+            // Presents are not fenced, so the queue is idled for the initializations that present images.
+            if (iter->queue != VK_NULL_HANDLE)
+            {
+                table->QueueWaitIdle(iter->queue);
+            }
+            else if (iter->submitted)
+            {
+                table->WaitForFences(iter->device, 1, &iter->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+            }
+
+            for (auto semaphore : iter->semaphores)
+            {
+                table->DestroySemaphore(iter->device, semaphore, nullptr);
+            }
+
+            table->DestroyFence(iter->device, iter->fence, nullptr);
+            table->DestroyCommandPool(iter->device, iter->command_pool, nullptr);
+
+            iter = pending_swapchain_image_inits_.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
     }
 }
 
@@ -1216,55 +1872,93 @@ void VulkanReplayConsumerBase::ProcessBeginResourceInitCommand(format::HandleId
 {
     GFXRECON_UNREFERENCED_PARAMETER(max_resource_size);
 
+    if (options_.startup_report != nullptr)
+    {
+        resource_init_start_time_ = util::datetime::GetTimestamp();
+    }
+
+    // Resource initialization writes need to follow the memory fills that preceded them.
+    ApplyPendingMemoryFills();
+
     DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
     if (device_info != nullptr)
     {
-        assert(device_info->handle != VK_NULL_HANDLE);
-
-        VkResult       result = VK_SUCCESS;
-        VkDevice       device = device_info->handle;
-        VkBuffer       buffer = VK_NULL_HANDLE;
-        VkDeviceMemory memory = VK_NULL_HANDLE;
+        device_info->resource_initializer = CreateResourceInitializer(device_info, max_copy_size);
+    }
+}
 
-        auto allocator = device_info->allocator.get();
-        assert(allocator != nullptr);
+void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId device_id)
+{
+    DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
-        auto table = GetDeviceTable(device);
-        assert(table != nullptr);
+    if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
+    {
+        // Submit the batched initialization commands and wait for them to complete.
+        VkResult result = device_info->resource_initializer->Flush();
 
-        VkPhysicalDevice physical_device = device_info->parent;
-        assert(physical_device != VK_NULL_HANDLE);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("State snapshot resource initialization command submission failed for VkDevice object "
+                                 "(ID = %" PRIu64 ") with error %s",
+                                 device_id,
+                                 enumutil::GetResultValueString(result));
+        }
 
-        VkPhysicalDeviceMemoryProperties properties;
-        auto                             instance_table = GetInstanceTable(physical_device);
-        assert(instance_table != nullptr);
+        device_info->resource_initializer.reset();
+    }
 
-        instance_table->GetPhysicalDeviceMemoryProperties(physical_device, &properties);
+    if (!deferred_init_data_.empty())
+    {
+        GFXRECON_LOG_DEBUG("Deferred the state snapshot upload of %" PRIuPTR " resources until they are first used",
+                           deferred_init_data_.size());
+    }
 
-        const auto& available_extensions      = device_info->extensions;
-        bool        have_shader_stencil_write = false;
+    if (resource_init_start_time_ != 0)
+    {
+        options_.startup_report->AddPhaseTime(
+            graphics::StartupTimingReport::kStateResourceInitialization,
+            util::datetime::DiffTimestamps(resource_init_start_time_, util::datetime::GetTimestamp()));
+        resource_init_start_time_ = 0;
+    }
+}
 
-        if (std::find(available_extensions.begin(),
-                      available_extensions.end(),
-                      VK_EXT_SHADER_STENCIL_EXPORT_EXTENSION_NAME) != available_extensions.end())
-        {
-            have_shader_stencil_write = true;
-        }
+uint8_t* VulkanReplayConsumerBase::GetInitBufferDataDestination(format::HandleId device_id,
+                                                                format::HandleId buffer_id,
+                                                                uint64_t         data_size)
+{
+    DeviceInfo*       device_info = object_info_table_.GetDeviceInfo(device_id);
+    const BufferInfo* buffer_info = object_info_table_.GetBufferInfo(buffer_id);
 
-        device_info->resource_initializer = std::make_unique<VulkanResourceInitializer>(
-            device, max_copy_size, properties, have_shader_stencil_write, allocator, table);
+    // Host visible buffers are written through their own mapping by ProcessInitBufferCommand().
+    if ((device_info != nullptr) && (device_info->resource_initializer != nullptr) && (buffer_info != nullptr) &&
+        ((buffer_info->memory_property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) !=
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        return device_info->resource_initializer->ReserveStagingData(data_size);
     }
+
+    return nullptr;
 }
 
-void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId device_id)
+uint8_t* VulkanReplayConsumerBase::GetInitImageDataDestination(format::HandleId device_id,
+                                                               format::HandleId image_id,
+                                                               uint64_t         data_size)
 {
-    DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
+    DeviceInfo*      device_info = object_info_table_.GetDeviceInfo(device_id);
+    const ImageInfo* image_info  = object_info_table_.GetImageInfo(image_id);
 
-    if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
+    // Host visible linear images are written through their own mapping by ProcessInitImageCommand().
+    if ((device_info != nullptr) && (device_info->resource_initializer != nullptr) && (image_info != nullptr) &&
+        (image_info->level_count > 0) &&
+        ((image_info->tiling != VK_IMAGE_TILING_LINEAR) ||
+         ((image_info->memory_property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) !=
+          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)))
     {
-        device_info->resource_initializer.reset();
+        return device_info->resource_initializer->ReserveStagingData(data_size);
     }
+
+    return nullptr;
 }
 
 void VulkanReplayConsumerBase::ProcessInitBufferCommand(format::HandleId device_id,
@@ -1306,8 +2000,14 @@ void VulkanReplayConsumerBase::ProcessInitBufferCommand(format::HandleId device_
                 copy_region.dstOffset = 0;
                 copy_region.size      = data_size;
 
-                result = initializer->InitializeBuffer(
-                    data_size, data, buffer_info->queue_family_index, buffer, buffer_info->usage, 1, &copy_region);
+                result = initializer->InitializeBuffer(data_size,
+                                                       data,
+                                                       buffer_info->queue_family_index,
+                                                       buffer_info->sharing_mode,
+                                                       buffer,
+                                                       buffer_info->usage,
+                                                       1,
+                                                       &copy_region);
 
                 if (result != VK_SUCCESS)
                 {
@@ -1416,6 +2116,7 @@ void VulkanReplayConsumerBase::ProcessInitImageCommand(format::HandleId
                 result = initializer->InitializeImage(data_size,
                                                       data,
                                                       image_info->queue_family_index,
+                                                      image_info->sharing_mode,
                                                       image,
                                                       image_info->type,
                                                       image_info->format,
@@ -1474,6 +2175,297 @@ void VulkanReplayConsumerBase::ProcessInitImageCommand(format::HandleId
     }
 }
 
+void VulkanReplayConsumerBase::ProcessDeferredInitBufferCommand(format::HandleId                device_id,
+                                                                format::HandleId                buffer_id,
+                                                                uint64_t                        data_size,
+                                                                const ResourceInitDataLocation& location)
+{
+    DeferredInitData init_data;
+    init_data.device_id = device_id;
+    init_data.data_size = data_size;
+    init_data.location  = location;
+
+    const BufferInfo* buffer_info = object_info_table_.GetBufferInfo(buffer_id);
+
+    if ((buffer_info != nullptr) && CanDeferInitData(buffer_info))
+    {
+        deferred_init_data_[buffer_id] = std::move(init_data);
+    }
+    else
+    {
+        InitializeDeferredResource(buffer_id, init_data);
+    }
+}
+
+void VulkanReplayConsumerBase::ProcessDeferredInitImageCommand(format::HandleId                device_id,
+                                                               format::HandleId                image_id,
+                                                               uint64_t                        data_size,
+                                                               uint32_t                        aspect,
+                                                               uint32_t                        layout,
+                                                               const std::vector<uint64_t>&    level_sizes,
+                                                               const ResourceInitDataLocation& location)
+{
+    DeferredInitData init_data;
+    init_data.device_id   = device_id;
+    init_data.is_image    = true;
+    init_data.data_size   = data_size;
+    init_data.aspect      = aspect;
+    init_data.layout      = layout;
+    init_data.level_sizes = level_sizes;
+    init_data.location    = location;
+
+    const ImageInfo* image_info = object_info_table_.GetImageInfo(image_id);
+
+    if ((image_info != nullptr) && CanDeferInitData(image_info))
+    {
+        deferred_init_data_[image_id] = std::move(init_data);
+    }
+    else
+    {
+        InitializeDeferredResource(image_id, init_data);
+    }
+}
+
+void VulkanReplayConsumerBase::LoadDeferredInitData(const std::vector<format::HandleId>& resource_ids)
+{
+    if (deferred_init_data_.empty())
+    {
+        return;
+    }
+
+    // The data of each device's resources is uploaded with one batch of initialization commands.
+    std::unordered_map<format::HandleId, std::vector<format::HandleId>> device_resource_ids;
+
+    for (auto resource_id : resource_ids)
+    {
+        auto entry = deferred_init_data_.find(resource_id);
+        if (entry != deferred_init_data_.end())
+        {
+            device_resource_ids[entry->second.device_id].push_back(resource_id);
+        }
+    }
+
+    for (const auto& device_entry : device_resource_ids)
+    {
+        DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_entry.first);
+
+        if (device_info != nullptr)
+        {
+            // Resources that are used while the state snapshot is loaded are added to its initialization commands.
+            bool create_initializer = (device_info->resource_initializer == nullptr);
+
+            if (create_initializer)
+            {
+                uint64_t max_copy_size = 0;
+
+                for (auto resource_id : device_entry.second)
+                {
+                    max_copy_size = std::max(max_copy_size, deferred_init_data_[resource_id].data_size);
+                }
+
+                device_info->resource_initializer = CreateResourceInitializer(device_info, max_copy_size);
+            }
+
+            for (auto resource_id : device_entry.second)
+            {
+                InitializeDeferredResource(resource_id, deferred_init_data_[resource_id]);
+            }
+
+            if (create_initializer)
+            {
+                VkResult result = device_info->resource_initializer->Flush();
+
+                if (result != VK_SUCCESS)
+                {
+                    GFXRECON_LOG_WARNING("Deferred resource initialization command submission failed for VkDevice "
+                                         "object (ID = %" PRIu64 ") with error %s",
+                                         device_entry.first,
+                                         enumutil::GetResultValueString(result));
+                }
+
+                device_info->resource_initializer.reset();
+            }
+        }
+
+        for (auto resource_id : device_entry.second)
+        {
+            deferred_init_data_.erase(resource_id);
+        }
+    }
+}
+
+std::unique_ptr<VulkanResourceInitializer>
+VulkanReplayConsumerBase::CreateResourceInitializer(const DeviceInfo* device_info, uint64_t max_copy_size)
+{
+    assert((device_info != nullptr) && (device_info->handle != VK_NULL_HANDLE));
+
+    VkDevice device = device_info->handle;
+
+    auto allocator = device_info->allocator.get();
+    assert(allocator != nullptr);
+
+    auto table = GetDeviceTable(device);
+    assert(table != nullptr);
+
+    VkPhysicalDevice physical_device = device_info->parent;
+    assert(physical_device != VK_NULL_HANDLE);
+
+    VkPhysicalDeviceMemoryProperties properties;
+    auto                             instance_table = GetInstanceTable(physical_device);
+    assert(instance_table != nullptr);
+
+    instance_table->GetPhysicalDeviceMemoryProperties(physical_device, &properties);
+
+    const auto& available_extensions      = device_info->extensions;
+    bool        have_shader_stencil_write = false;
+
+    if (std::find(available_extensions.begin(),
+                  available_extensions.end(),
+                  VK_EXT_SHADER_STENCIL_EXPORT_EXTENSION_NAME) != available_extensions.end())
+    {
+        have_shader_stencil_write = true;
+    }
+
+    return std::make_unique<VulkanResourceInitializer>(device,
+                                                       max_copy_size,
+                                                       properties,
+                                                       have_shader_stencil_write,
+                                                       device_info->transfer_queue_family_index,
+                                                       allocator,
+                                                       table);
+}
+
+bool VulkanReplayConsumerBase::CanDeferInitData(const BufferInfo* buffer_info)
+{
+    assert(buffer_info != nullptr);
+
+    if (!aliased_resources_found_)
+    {
+        FindAliasedResources();
+    }
+
+    return (buffer_info->bound_memory_id != format::kNullHandleId) &&
+           ((buffer_info->memory_property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0) &&
+           ((buffer_info->usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) == 0) &&
+           (aliased_resource_ids_.find(buffer_info->capture_id) == aliased_resource_ids_.end());
+}
+
+bool VulkanReplayConsumerBase::CanDeferInitData(const ImageInfo* image_info)
+{
+    assert(image_info != nullptr);
+
+    if (!aliased_resources_found_)
+    {
+        FindAliasedResources();
+    }
+
+    return (image_info->bound_memory_id != format::kNullHandleId) && (image_info->level_count > 0) &&
+           ((image_info->memory_property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0) &&
+           (aliased_resource_ids_.find(image_info->capture_id) == aliased_resource_ids_.end());
+}
+
+void VulkanReplayConsumerBase::FindAliasedResources()
+{
+    struct BoundRange
+    {
+        VkDeviceSize     begin;
+        VkDeviceSize     end;
+        format::HandleId resource_id;
+    };
+
+    // The state snapshot binds all of its resources before their initialization commands, so the ranges are only
+    // collected once, for the first deferred initialization command.
+    std::unordered_map<format::HandleId, std::vector<BoundRange>> memory_ranges;
+
+    object_info_table_.VisitBufferInfo([&memory_ranges](const BufferInfo* buffer_info) {
+        if ((buffer_info->bound_memory_id != format::kNullHandleId) && (buffer_info->size > 0))
+        {
+            memory_ranges[buffer_info->bound_memory_id].push_back(
+                { buffer_info->bound_memory_offset,
+                  buffer_info->bound_memory_offset + buffer_info->size,
+                  buffer_info->capture_id });
+        }
+    });
+
+    object_info_table_.VisitImageInfo([this, &memory_ranges](const ImageInfo* image_info) {
+        if (image_info->bound_memory_id != format::kNullHandleId)
+        {
+            const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(image_info->parent_id);
+
+            if (device_info != nullptr)
+            {
+                VkMemoryRequirements memory_requirements;
+                GetDeviceTable(device_info->handle)
+                    ->GetImageMemoryRequirements(device_info->handle, image_info->handle, &memory_requirements);
+
+                memory_ranges[image_info->bound_memory_id].push_back(
+                    { image_info->bound_memory_offset,
+                      image_info->bound_memory_offset + memory_requirements.size,
+                      image_info->capture_id });
+            }
+        }
+    });
+
+    for (auto& entry : memory_ranges)
+    {
+        auto& ranges = entry.second;
+
+        std::sort(ranges.begin(), ranges.end(), [](const BoundRange& lhs, const BoundRange& rhs) {
+            return lhs.begin < rhs.begin;
+        });
+
+        // A range that begins before the end of the preceding range that extends the furthest overlaps it.
+        size_t furthest_index = 0;
+
+        for (size_t i = 1; i < ranges.size(); ++i)
+        {
+            if (ranges[i].begin < ranges[furthest_index].end)
+            {
+                aliased_resource_ids_.insert(ranges[i].resource_id);
+                aliased_resource_ids_.insert(ranges[furthest_index].resource_id);
+            }
+
+            if (ranges[i].end > ranges[furthest_index].end)
+            {
+                furthest_index = i;
+            }
+        }
+    }
+
+    aliased_resources_found_ = true;
+}
+
+void VulkanReplayConsumerBase::InitializeDeferredResource(format::HandleId        resource_id,
+                                                          const DeferredInitData& init_data)
+{
+    if (init_data_reader_ == nullptr)
+    {
+        init_data_reader_ = std::make_unique<ResourceInitDataReader>(options_.lazy_resource_init_file);
+    }
+
+    const uint8_t* data = init_data_reader_->ReadData(init_data.location, init_data.data_size);
+
+    if (data == nullptr)
+    {
+        GFXRECON_LOG_WARNING("Skipping deferred state snapshot upload for resource object (ID = %" PRIu64 ")",
+                             resource_id);
+    }
+    else if (init_data.is_image)
+    {
+        ProcessInitImageCommand(init_data.device_id,
+                                resource_id,
+                                init_data.data_size,
+                                init_data.aspect,
+                                init_data.layout,
+                                init_data.level_sizes,
+                                data);
+    }
+    else
+    {
+        ProcessInitBufferCommand(init_data.device_id, resource_id, init_data.data_size, data);
+    }
+}
+
 void VulkanReplayConsumerBase::RaiseFatalError(const char* message) const
 {
     // TODO: Should there be a default action if no error handler has been provided?
@@ -1485,6 +2477,9 @@ void VulkanReplayConsumerBase::RaiseFatalError(const char* message) const
 
 void VulkanReplayConsumerBase::InitializeLoader()
 {
+    graphics::StartupTimingReport::ScopedPhase phase(options_.startup_report.get(),
+                                                     graphics::StartupTimingReport::kInitializeLoader);
+
     loader_handle_ = graphics::InitializeLoader();
     if (loader_handle_ != nullptr)
     {
@@ -1526,6 +2521,50 @@ void VulkanReplayConsumerBase::AddDeviceTable(VkDevice device, PFN_vkGetDevicePr
     encode::LoadDeviceTable(gpa, device, &table);
 }
 
+bool VulkanReplayConsumerBase::RetainInstance(const InstanceInfo* instance_info)
+{
+    assert(instance_info != nullptr);
+
+    if (options_.retained_objects == nullptr)
+    {
+        return false;
+    }
+
+    VkInstance instance = instance_info->handle;
+    auto       entry    = instance_retain_keys_.find(instance);
+
+    if (entry == instance_retain_keys_.end())
+    {
+        // Retained devices can't outlive their instance.
+        options_.retained_objects->DestroyInstanceDevices(instance);
+        return false;
+    }
+
+    options_.retained_objects->RetainInstance(entry->second, instance, GetInstanceTable(instance)->DestroyInstance);
+    instance_retain_keys_.erase(entry);
+
+    return true;
+}
+
+bool VulkanReplayConsumerBase::RetainDevice(const DeviceInfo* device_info)
+{
+    assert(device_info != nullptr);
+
+    VkDevice device = device_info->handle;
+    auto     entry  = device_retain_keys_.find(device);
+
+    if (entry == device_retain_keys_.end())
+    {
+        return false;
+    }
+
+    options_.retained_objects->RetainDevice(
+        entry->second.first, device, entry->second.second, GetDeviceTable(device)->DestroyDevice);
+    device_retain_keys_.erase(entry);
+
+    return true;
+}
+
 PFN_vkGetDeviceProcAddr VulkanReplayConsumerBase::GetDeviceAddrProc(VkPhysicalDevice physical_device)
 {
     return get_device_proc_addrs_[encode::GetDispatchKey(physical_device)];
@@ -1972,6 +3011,42 @@ bool VulkanReplayConsumerBase::CheckTrimDeviceExtensions(VkPhysicalDevice
     return have_extensions;
 }
 
+uint32_t VulkanReplayConsumerBase::GetTransferQueueFamilyIndex(VkPhysicalDevice          physical_device,
+                                                               const VkDeviceCreateInfo* create_info)
+{
+    uint32_t transfer_queue_family_index = VK_QUEUE_FAMILY_IGNORED;
+    auto     table                       = GetInstanceTable(physical_device);
+
+    assert((create_info != nullptr) && (table != nullptr));
+
+    uint32_t count = 0;
+    table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+
+    std::vector<VkQueueFamilyProperties> properties(count);
+    table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, properties.data());
+
+    // Resource initialization can only use a queue family that the device was created with.  A transfer queue family
+    // without graphics or compute support typically corresponds to a dedicated copy engine.
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
+    {
+        uint32_t queue_family_index = create_info->pQueueCreateInfos[i].queueFamilyIndex;
+
+        if ((queue_family_index < count) && (create_info->pQueueCreateInfos[i].queueCount > 0))
+        {
+            VkQueueFlags flags = properties[queue_family_index].queueFlags;
+
+            if (((flags & VK_QUEUE_TRANSFER_BIT) == VK_QUEUE_TRANSFER_BIT) &&
+                ((flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0))
+            {
+                transfer_queue_family_index = queue_family_index;
+                break;
+            }
+        }
+    }
+
+    return transfer_queue_family_index;
+}
+
 void VulkanReplayConsumerBase::InitializeResourceAllocator(const PhysicalDeviceInfo*       physical_device_info,
                                                            VkDevice                        device,
                                                            const std::vector<std::string>& enabled_device_extensions,
@@ -2296,1147 +3371,3678 @@ void VulkanReplayConsumerBase::InitializeScreenshotHandler()
         screenshot_file_prefix_ = util::filepath::Join(options_.screenshot_dir, screenshot_file_prefix_);
     }
 
-    screenshot_handler_ = std::make_unique<ScreenshotHandler>(options_.screenshot_format, options_.screenshot_ranges);
+    std::string hash_file_name;
+    if (options_.screenshot_hash_only)
+    {
+        hash_file_name = screenshot_file_prefix_ + "_hashes.txt";
+    }
+
+    screenshot_handler_ = std::make_unique<ScreenshotHandler>(
+        options_.screenshot_format, options_.screenshot_ranges, options_.screenshot_downscale, hash_file_name);
 }
 
-void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const
+void VulkanReplayConsumerBase::CreateReplayPipelineCache(DeviceInfo* device_info)
 {
-    if ((meta_info != nullptr) && (meta_info->decoded_value != nullptr) && !meta_info->pSwapchains.IsNull())
-    {
-        auto present_info  = meta_info->decoded_value;
-        auto swapchain_ids = meta_info->pSwapchains.GetPointer();
+    assert(device_info != nullptr);
 
-        for (uint32_t i = 0; i < present_info->swapchainCount; ++i)
-        {
-            auto swapchain_info = object_info_table_.GetSwapchainKHRInfo(swapchain_ids[i]);
-            if ((swapchain_info != nullptr) && (swapchain_info->device_info != nullptr))
+    auto instance_table = GetInstanceTable(device_info->parent);
+    auto device_table   = GetDeviceTable(device_info->handle);
+    assert((instance_table != nullptr) && (device_table != nullptr));
+
+    // Pipeline cache data is only valid for the device and driver that produced it, so each combination has its own
+    // file.
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(device_info->parent, &properties);
+
+    const char  kHexDigits[] = "0123456789abcdef";
+    std::string uuid;
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+    {
+        uuid.push_back(kHexDigits[properties.pipelineCacheUUID[i] >> 4]);
+        uuid.push_back(kHexDigits[properties.pipelineCacheUUID[i] & 0xf]);
+    }
+
+    std::string file_name = options_.pipeline_cache_file_prefix;
+    file_name += "_" + std::to_string(properties.vendorID);
+    file_name += "_" + std::to_string(properties.deviceID);
+    file_name += "_" + std::to_string(properties.driverVersion);
+    file_name += "_" + uuid + ".cache";
+
+    std::vector<uint8_t> data;
+    FILE*                fp = nullptr;
+    if (util::platform::FileOpen(&fp, file_name.c_str(), "rb") == 0)
+    {
+        util::platform::FileSeek(fp, 0L, util::platform::FileSeekEnd);
+        int64_t file_size = util::platform::FileTell(fp);
+        util::platform::FileSeek(fp, 0L, util::platform::FileSeekSet);
+
+        if (file_size > 0)
+        {
+            data.resize(static_cast<size_t>(file_size));
+            if (util::platform::FileRead(data.data(), sizeof(uint8_t), data.size(), fp) != data.size())
             {
-                auto     device_info = swapchain_info->device_info;
-                uint32_t image_index = present_info->pImageIndices[i];
+                GFXRECON_LOG_WARNING("Failed to read pipeline cache file %s", file_name.c_str());
+                data.clear();
+            }
+        }
 
-                auto instance_table = GetInstanceTable(device_info->parent);
-                assert(instance_table != nullptr);
+        util::platform::FileClose(fp);
+    }
 
-                // TODO: This should be stored in the DeviceInfo structure to avoid the need for frequent queries.
-                VkPhysicalDeviceMemoryProperties memory_properties;
-                instance_table->GetPhysicalDeviceMemoryProperties(device_info->parent, &memory_properties);
+    VkPipelineCacheCreateInfo create_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+    create_info.pNext                     = nullptr;
+    create_info.flags                     = 0;
+    create_info.initialDataSize           = data.size();
+    create_info.pInitialData              = data.empty() ? nullptr : data.data();
 
-                std::string filename_prefix = screenshot_file_prefix_;
+    VkPipelineCache cache  = VK_NULL_HANDLE;
+    VkResult        result = device_table->CreatePipelineCache(device_info->handle, &create_info, nullptr, &cache);
 
-                if (present_info->swapchainCount > 1)
-                {
-                    filename_prefix += "_swapchain_";
-                    filename_prefix += std::to_string(i);
-                }
+    if ((result != VK_SUCCESS) && !data.empty())
+    {
+        GFXRECON_LOG_WARNING("Ignoring the contents of pipeline cache file %s, which were rejected by the driver",
+                             file_name.c_str());
 
-                filename_prefix += "_frame_";
-                filename_prefix += std::to_string(screenshot_handler_->GetCurrentFrame());
+        data.clear();
+        create_info.initialDataSize = 0;
+        create_info.pInitialData    = nullptr;
 
-                screenshot_handler_->WriteImage(filename_prefix,
-                                                device_info->handle,
-                                                GetDeviceTable(device_info->handle),
-                                                memory_properties,
-                                                device_info->allocator.get(),
-                                                swapchain_info->images[image_index],
-                                                swapchain_info->format,
-                                                swapchain_info->width,
-                                                swapchain_info->height);
-            }
+        result = device_table->CreatePipelineCache(device_info->handle, &create_info, nullptr, &cache);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        if (!data.empty())
+        {
+            GFXRECON_LOG_INFO("Loaded replay pipeline cache data from %s", file_name.c_str());
         }
+
+        device_info->replay_pipeline_cache      = cache;
+        device_info->replay_pipeline_cache_file = std::move(file_name);
+        device_info->replay_pipeline_cache_data = std::move(data);
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to create the replay pipeline cache; pipeline data will not be saved");
     }
 }
 
-VkResult
-VulkanReplayConsumerBase::OverrideCreateInstance(VkResult original_result,
-                                                 const StructPointerDecoder<Decoded_VkInstanceCreateInfo>*  pCreateInfo,
-                                                 const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
-                                                 HandlePointerDecoder<VkInstance>*                          pInstance)
+void VulkanReplayConsumerBase::SaveReplayPipelineCache(const DeviceInfo* device_info)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+    assert(device_info != nullptr);
 
-    assert((pInstance != nullptr) && !pInstance->IsNull() && (pInstance->GetHandlePointer() != nullptr) &&
-           (pCreateInfo != nullptr));
+    if (device_info->replay_pipeline_cache == VK_NULL_HANDLE)
+    {
+        return;
+    }
 
-    auto replay_create_info = pCreateInfo->GetPointer();
-    auto replay_instance    = pInstance->GetHandlePointer();
+    VkDevice device       = device_info->handle;
+    auto     device_table = GetDeviceTable(device);
+    assert(device_table != nullptr);
 
-    if (loader_handle_ == nullptr)
+    if (device_info->replay_pipeline_cache_file.empty())
     {
-        InitializeLoader();
+        // The cache was created for the pipeline cache data of a state snapshot, without a pipeline cache file.
+        device_table->DestroyPipelineCache(device, device_info->replay_pipeline_cache, nullptr);
+        return;
     }
 
-    // Replace WSI extension in extension list.
-    std::vector<const char*> filtered_extensions;
-    VkInstanceCreateInfo     modified_create_info{};
+    // Include the pipelines of the application's caches that have not been destroyed.
+    std::vector<VkPipelineCache> caches;
+    object_info_table_.VisitPipelineCacheInfo([&](const PipelineCacheInfo* info) {
+        if ((info->parent_id == device_info->capture_id) && (info->handle != VK_NULL_HANDLE))
+        {
+            caches.push_back(info->handle);
+        }
+    });
 
-    if (replay_create_info != nullptr)
+    if (!caches.empty())
     {
-        // If VkDebugUtilsMessengerCreateInfoEXT or VkDebugReportCallbackCreateInfoEXT are in the pNext chain, update
-        // the callback pointers.
-        ProcessCreateInstanceDebugCallbackInfo(pCreateInfo->GetMetaStructPointer());
+        device_table->MergePipelineCaches(
+            device, device_info->replay_pipeline_cache, static_cast<uint32_t>(caches.size()), caches.data());
+    }
 
-        if (replay_create_info->ppEnabledExtensionNames)
-        {
-            // Swap the surface extension supported by platform the replay is running on if different from trace
-            for (uint32_t i = 0; i < replay_create_info->enabledExtensionCount; ++i)
-            {
-                const char* current_extension = replay_create_info->ppEnabledExtensionNames[i];
-                if (kSurfaceExtensions.find(current_extension) != kSurfaceExtensions.end())
-                {
-                    filtered_extensions.push_back(window_factory_->GetSurfaceExtensionName());
-                }
-                else
-                {
-                    filtered_extensions.push_back(current_extension);
-                }
-            }
+    VkPipelineCache      cache     = device_info->replay_pipeline_cache;
+    size_t               data_size = 0;
+    std::vector<uint8_t> data;
+    VkResult             result    = device_table->GetPipelineCacheData(device, cache, &data_size, nullptr);
 
-            PFN_vkEnumerateInstanceExtensionProperties instance_extension_proc =
-                reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(
-                    get_instance_proc_addr_(nullptr, "vkEnumerateInstanceExtensionProperties"));
-            std::vector<VkExtensionProperties> properties;
-            if (feature_util::GetInstanceExtensions(instance_extension_proc, &properties) == VK_SUCCESS)
+    if ((result == VK_SUCCESS) && (data_size > 0))
+    {
+        data.resize(data_size);
+        result = device_table->GetPipelineCacheData(device, cache, &data_size, data.data());
+        data.resize(data_size);
+    }
+
+    // The file is not rewritten when replay did not add any pipelines to the cache.
+    if ((result == VK_SUCCESS) && !data.empty() && (data != device_info->replay_pipeline_cache_data))
+    {
+        const std::string& file_name = device_info->replay_pipeline_cache_file;
+        FILE*              fp        = nullptr;
+
+        if (util::platform::FileOpen(&fp, file_name.c_str(), "wb") == 0)
+        {
+            if (util::platform::FileWrite(data.data(), sizeof(uint8_t), data.size(), fp) == data.size())
             {
-                if (options_.remove_unsupported_features)
-                {
-                    // Remove enabled extensions that are not available from the replay instance.
-                    // Proc addresses that can't be used in layers so are not generated into shared dispatch table, but
-                    // are needed in the replay application.
-                    feature_util::RemoveUnsupportedExtensions(properties, &filtered_extensions);
-                }
-                else
-                {
-                    // Check that the requested extensions are present and print warnings if not.
-                    for (auto extensionIter = filtered_extensions.begin(); extensionIter != filtered_extensions.end();
-                         ++extensionIter)
-                    {
-                        if (!feature_util::IsSupportedExtension(properties, *extensionIter))
-                        {
-                            GFXRECON_LOG_WARNING("Extension %s, is not supported by the replay device.",
-                                                 *extensionIter);
-                        }
-                    }
-                }
+                GFXRECON_LOG_INFO("Saved replay pipeline cache data to %s", file_name.c_str());
             }
             else
             {
-                GFXRECON_LOG_WARNING("Failed to get instance extensions. Cannot perform sanity checks or filters for "
-                                     "extension availability.");
+                GFXRECON_LOG_WARNING("Failed to write pipeline cache file %s", file_name.c_str());
             }
-        }
 
-        modified_create_info                         = (*replay_create_info);
-        modified_create_info.enabledExtensionCount   = static_cast<uint32_t>(filtered_extensions.size());
-        modified_create_info.ppEnabledExtensionNames = filtered_extensions.data();
+            util::platform::FileClose(fp);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Failed to open pipeline cache file %s for writing", file_name.c_str());
+        }
     }
-    else
+    else if (result != VK_SUCCESS)
     {
-        GFXRECON_LOG_WARNING("The vkCreateInstance parameter pCreateInfo is NULL.");
+        GFXRECON_LOG_WARNING("Failed to retrieve the replay pipeline cache data; pipeline data will not be saved");
     }
 
-    // Disable layers; any layers needed for replay should be enabled for the replay app with the VK_INSTANCE_LAYERS
-    // environment variable or debug.vulkan.layers Android property.
-    if (modified_create_info.enabledLayerCount > 0)
+    device_table->DestroyPipelineCache(device, cache, nullptr);
+}
+
+VkPipelineCache VulkanReplayConsumerBase::GetReplayPipelineCache(const DeviceInfo*        device_info,
+                                                                 const PipelineCacheInfo* cache_info) const
+{
+    assert(device_info != nullptr);
+
+    if ((cache_info != nullptr) && (cache_info->handle != VK_NULL_HANDLE))
     {
-        GFXRECON_LOG_INFO(
-            "Replay has removed the following layers from VkInstanceCreateInfo when calling vkCreateInstance:");
+        return cache_info->handle;
+    }
 
-        for (uint32_t i = 0; i < modified_create_info.enabledLayerCount; ++i)
+    return device_info->replay_pipeline_cache;
+}
+
+bool VulkanReplayConsumerBase::UseAsyncPipelineCreation(uint32_t                                create_info_count,
+                                                        const HandlePointerDecoder<VkPipeline>* pipelines) const
+{
+    // Lazily decoded pNext structures are decoded on first access, which must not happen from a worker thread.
+    if ((pipeline_creator_ == nullptr) || PNextNode::IsLazyDecodingEnabled() || (pipelines == nullptr) ||
+        pipelines->IsNull() || (pipelines->GetHandlePointer() == nullptr))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < create_info_count; ++i)
+    {
+        if (pipelines->GetConsumerData(i) == nullptr)
         {
-            GFXRECON_LOG_INFO("\t%s", modified_create_info.ppEnabledLayerNames[i]);
+            return false;
         }
+    }
 
-        modified_create_info.enabledLayerCount   = 0;
-        modified_create_info.ppEnabledLayerNames = nullptr;
+    return true;
+}
+
+void VulkanReplayConsumerBase::CreatePipelinesAsync(const char*                          func_name,
+                                                    VkResult                             original_result,
+                                                    uint32_t                             create_info_count,
+                                                    HandlePointerDecoder<VkPipeline>*    pipelines,
+                                                    PipelineCreationTask::CreateFunction create)
+{
+    assert((pipeline_creator_ != nullptr) && (pipelines != nullptr));
+
+    // Keep the decoded parameters of the current call, which are referenced by the create function, until the task is
+    // destroyed.
+    std::shared_ptr<DecodeAllocator> decoded_data(DecodeAllocator::DetachInstance());
+
+    auto task = pipeline_creator_->Submit(
+        create_info_count,
+        [create, decoded_data](VkPipeline* created_pipelines) { return create(created_pipelines); },
+        [this, func_name, original_result](VkResult result) { CheckResult(func_name, original_result, result); });
+
+    VkPipeline* out_pipelines = pipelines->GetHandlePointer();
+
+    for (uint32_t i = 0; i < create_info_count; ++i)
+    {
+        // The handles are set by the object info table when the pipelines are first retrieved.
+        out_pipelines[i] = VK_NULL_HANDLE;
+
+        auto pipeline_info = reinterpret_cast<PipelineInfo*>(pipelines->GetConsumerData(i));
+        assert(pipeline_info != nullptr);
+
+        pipeline_info->creation_task  = task;
+        pipeline_info->creation_index = i;
     }
+}
 
-    VkResult result = create_instance_proc_(&modified_create_info, GetAllocationCallbacks(pAllocator), replay_instance);
+void VulkanReplayConsumerBase::WaitForAsyncPipelineCreation()
+{
+    if (pipeline_creator_ != nullptr)
+    {
+        pipeline_creator_->WaitAll();
+    }
 
-    if ((replay_instance != nullptr) && (result == VK_SUCCESS))
+    if (warm_up_creator_ != nullptr)
     {
-        AddInstanceTable(*replay_instance);
+        warm_up_creator_->WaitAll();
+    }
+}
 
-        if (modified_create_info.pApplicationInfo != nullptr)
+void VulkanReplayConsumerBase::CreateWarmUpShaderModules(const DeviceInfo* device_info)
+{
+    assert((device_info != nullptr) && (options_.warm_up_pipelines != nullptr));
+
+    VkDevice device       = device_info->handle;
+    auto     device_table = GetDeviceTable(device);
+    assert(device_table != nullptr);
+
+    for (const auto& shader_module : options_.warm_up_pipelines->shader_modules)
+    {
+        if ((shader_module.device_id == device_info->capture_id) && !shader_module.code.empty())
         {
-            auto instance_info = reinterpret_cast<InstanceInfo*>(pInstance->GetConsumerData(0));
-            assert(instance_info != nullptr);
+            VkShaderModuleCreateInfo create_info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+            create_info.pNext                    = nullptr;
+            create_info.flags                    = shader_module.flags;
+            create_info.codeSize                 = shader_module.code.size() * sizeof(uint32_t);
+            create_info.pCode                    = shader_module.code.data();
 
-            instance_info->api_version = modified_create_info.pApplicationInfo->apiVersion;
-            instance_info->enabled_extensions.assign(modified_create_info.ppEnabledExtensionNames,
-                                                     modified_create_info.ppEnabledExtensionNames +
-                                                         modified_create_info.enabledExtensionCount);
+            WarmUpShaderModule warm_up_module;
+            warm_up_module.device_id = shader_module.device_id;
+
+            if (device_table->CreateShaderModule(device, &create_info, nullptr, &warm_up_module.handle) == VK_SUCCESS)
+            {
+                warm_up_shader_modules_[shader_module.shader_module_id] = warm_up_module;
+            }
         }
     }
-
-    return result;
 }
 
-VkResult
-VulkanReplayConsumerBase::OverrideCreateDevice(VkResult            original_result,
-                                               PhysicalDeviceInfo* physical_device_info,
-                                               const StructPointerDecoder<Decoded_VkDeviceCreateInfo>*    pCreateInfo,
-                                               const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
-                                               HandlePointerDecoder<VkDevice>*                            pDevice)
+void VulkanReplayConsumerBase::SubmitWarmUpPipelines()
 {
-    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+    auto pending_iter = pending_warm_up_pipelines_.begin();
 
-    assert((physical_device_info != nullptr) && (pDevice != nullptr) && !pDevice->IsNull() &&
-           (pDevice->GetHandlePointer() != nullptr) && (pCreateInfo != nullptr));
+    while (pending_iter != pending_warm_up_pipelines_.end())
+    {
+        PrescannedPipelines* pipelines   = *pending_iter;
+        const DeviceInfo*    device_info = object_info_table_.GetDeviceInfo(pipelines->device_id);
 
-    SelectPhysicalDevice(physical_device_info);
+        if (device_info == nullptr)
+        {
+            ++pending_iter;
+            continue;
+        }
 
-    VkPhysicalDevice        physical_device      = physical_device_info->handle;
-    PFN_vkGetDeviceProcAddr get_device_proc_addr = GetDeviceAddrProc(physical_device);
-    PFN_vkCreateDevice      create_device_proc   = GetCreateDeviceProc(physical_device);
-    VkResult                result               = VK_ERROR_INITIALIZATION_FAILED;
+        WarmUpStatus status = GetWarmUpStatus(*pipelines);
 
-    if ((get_device_proc_addr != nullptr) && (create_device_proc != nullptr))
-    {
-        auto replay_create_info = pCreateInfo->GetPointer();
-        auto replay_device      = pDevice->GetHandlePointer();
-        assert(replay_create_info != nullptr);
-        VkDeviceCreateInfo modified_create_info = (*replay_create_info);
+        if (status == WarmUpStatus::kNotReady)
+        {
+            ++pending_iter;
+            continue;
+        }
 
-        // Make copy so list can be modified without effecting original.
-        std::vector<const char*> modified_extensions;
-        if (replay_create_info->ppEnabledExtensionNames)
+        pending_iter = pending_warm_up_pipelines_.erase(pending_iter);
+
+        // Skip the calls that have already been replayed.
+        if ((status == WarmUpStatus::kUnsupported) ||
+            (object_info_table_.GetPipelineInfo(pipelines->pipeline_ids[0]) != nullptr))
         {
-            modified_extensions.insert(
-                modified_extensions.begin(),
-                replay_create_info->ppEnabledExtensionNames,
-                std::next(replay_create_info->ppEnabledExtensionNames, replay_create_info->enabledExtensionCount));
+            continue;
         }
 
-        // Enable extensions used for loading resources during initial state setup for trimmed files.
-        std::vector<std::string> extensions;
-        if (loading_trim_state_ && CheckTrimDeviceExtensions(physical_device, &extensions))
+        format::HandleId                     cache_id     = pipelines->pipeline_cache_id;
+        const PipelineCacheInfo*             cache_info   = object_info_table_.GetPipelineCacheInfo(cache_id);
+        VkDevice                             device       = device_info->handle;
+        VkPipelineCache                      cache        = GetReplayPipelineCache(device_info, cache_info);
+        auto                                 table        = GetDeviceTable(device);
+        uint32_t                             count        = static_cast<uint32_t>(pipelines->pipeline_ids.size());
+        std::shared_ptr<DecodeAllocator>     decoded_data = pipelines->decoded_data;
+        PipelineCreationTask::CreateFunction create;
+
+        // Map the handles of the decoded create infos, using the warm-up shader modules.
+        if (pipelines->graphics_create_infos != nullptr)
         {
-            for (const auto& extension : extensions)
+            for (uint32_t i = 0; i < count; ++i)
             {
-                if (std::find(modified_extensions.begin(), modified_extensions.end(), extension) ==
-                    modified_extensions.end())
+                const Decoded_VkGraphicsPipelineCreateInfo* meta = &pipelines->graphics_create_infos[i];
+                VkGraphicsPipelineCreateInfo*               info = meta->decoded_value;
+
+                info->layout = handle_mapping::MapHandle<PipelineLayoutInfo>(
+                    meta->layout, object_info_table_, &VulkanObjectInfoTable::GetPipelineLayoutInfo);
+                info->renderPass = handle_mapping::MapHandle<RenderPassInfo>(
+                    meta->renderPass, object_info_table_, &VulkanObjectInfoTable::GetRenderPassInfo);
+                info->basePipelineHandle = handle_mapping::MapHandle<PipelineInfo>(
+                    meta->basePipelineHandle, object_info_table_, &VulkanObjectInfoTable::GetPipelineInfo);
+
+                for (uint32_t j = 0; j < info->stageCount; ++j)
                 {
-                    modified_extensions.push_back(extension.c_str());
+                    MapWarmUpShaderStage(&meta->pStages->GetMetaStructPointer()[j]);
                 }
             }
-        }
 
-        if (options_.remove_unsupported_features && (physical_device != VK_NULL_HANDLE))
+            auto create_infos = pipelines->graphics_create_infos->decoded_value;
+            auto func         = table->CreateGraphicsPipelines;
+            create            = [func, device, cache, count, create_infos, decoded_data](VkPipeline* handles) {
+                return func(device, cache, count, create_infos, nullptr, handles);
+            };
+        }
+        else
         {
-            // Remove enabled extensions that are not available from the replay device.
-            auto table = GetInstanceTable(physical_device);
-            assert(table != nullptr);
-
-            std::vector<VkExtensionProperties> properties;
-            if (feature_util::GetDeviceExtensions(
-                    physical_device, table->EnumerateDeviceExtensionProperties, &properties) == VK_SUCCESS)
+            for (uint32_t i = 0; i < count; ++i)
             {
-                feature_util::RemoveUnsupportedExtensions(properties, &modified_extensions);
+                const Decoded_VkComputePipelineCreateInfo* meta = &pipelines->compute_create_infos[i];
+                VkComputePipelineCreateInfo*               info = meta->decoded_value;
+
+                info->layout = handle_mapping::MapHandle<PipelineLayoutInfo>(
+                    meta->layout, object_info_table_, &VulkanObjectInfoTable::GetPipelineLayoutInfo);
+                info->basePipelineHandle = handle_mapping::MapHandle<PipelineInfo>(
+                    meta->basePipelineHandle, object_info_table_, &VulkanObjectInfoTable::GetPipelineInfo);
+
+                MapWarmUpShaderStage(meta->stage);
             }
 
-            // Remove enabled features that are not available from the replay device.
-            feature_util::RemoveUnsupportedFeatures(physical_device,
-                                                    table->GetPhysicalDeviceFeatures,
-                                                    table->GetPhysicalDeviceFeatures2,
-                                                    modified_create_info.pNext,
-                                                    modified_create_info.pEnabledFeatures);
+            auto create_infos = pipelines->compute_create_infos->decoded_value;
+            auto func         = table->CreateComputePipelines;
+            create            = [func, device, cache, count, create_infos, decoded_data](VkPipeline* handles) {
+                return func(device, cache, count, create_infos, nullptr, handles);
+            };
         }
 
-        modified_create_info.enabledExtensionCount   = static_cast<uint32_t>(modified_extensions.size());
-        modified_create_info.ppEnabledExtensionNames = modified_extensions.data();
+        WarmUpPipelineTask warm_up_task;
+        warm_up_task.device_id      = pipelines->device_id;
+        warm_up_task.pipeline_count = count;
+        warm_up_task.task           = warm_up_creator_->Submit(count, std::move(create), nullptr);
 
-        graphics::VulkanDeviceUtil                device_util;
-        graphics::VulkanDevicePropertyFeatureInfo property_feature_info =
-            device_util.EnableRequiredPhysicalDeviceFeatures(physical_device_info->parent_api_version,
-                                                             GetInstanceTable(physical_device),
-                                                             physical_device,
-                                                             &modified_create_info);
+        warm_up_pipeline_tasks_[pipelines->pipeline_ids[0]] = std::move(warm_up_task);
+    }
+}
 
-        result = create_device_proc(
-            physical_device, &modified_create_info, GetAllocationCallbacks(pAllocator), replay_device);
+VulkanReplayConsumerBase::WarmUpStatus
+VulkanReplayConsumerBase::GetWarmUpStatus(const PrescannedPipelines& pipelines) const
+{
+    // Pipeline libraries reference other pipelines from the pNext chain, which is not mapped for warm-up.
+    auto uses_pipeline_libraries = [](VkPipelineCreateFlags flags, const void* next) {
+        if ((flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) == VK_PIPELINE_CREATE_LIBRARY_BIT_KHR)
+        {
+            return true;
+        }
 
-        if ((replay_device != nullptr) && (result == VK_SUCCESS))
+        for (auto base = reinterpret_cast<const VkBaseInStructure*>(next); base != nullptr; base = base->pNext)
         {
-            AddDeviceTable(*replay_device, get_device_proc_addr);
+            if ((base->sType == VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR) ||
+                (base->sType == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV))
+            {
+                return true;
+            }
+        }
 
-            auto device_info = reinterpret_cast<DeviceInfo*>(pDevice->GetConsumerData(0));
-            assert(device_info != nullptr);
+        return false;
+    };
 
-            device_info->extensions = std::move(extensions);
-            device_info->parent     = physical_device;
+    auto is_shader_stage_supported = [this](const Decoded_VkPipelineShaderStageCreateInfo* stage) {
+        return (stage != nullptr) && (stage->decoded_value != nullptr) &&
+               ((stage->module == format::kNullHandleId) ||
+                (warm_up_shader_modules_.find(stage->module) != warm_up_shader_modules_.end()));
+    };
 
-            // Create the memory allocator for the selected physical device.
-            auto replay_device_info = physical_device_info->replay_device_info;
-            assert(replay_device_info != nullptr);
+    format::HandleId layout_id        = format::kNullHandleId;
+    format::HandleId render_pass_id   = format::kNullHandleId;
+    format::HandleId base_pipeline_id = format::kNullHandleId;
+    WarmUpStatus     status           = WarmUpStatus::kReady;
 
-            if (replay_device_info->memory_properties == nullptr)
-            {
-                // Memory properties weren't queried before device creation, so retrieve them now.
-                auto table = GetInstanceTable(physical_device);
-                assert(table != nullptr);
+    for (size_t i = 0; (i < pipelines.pipeline_ids.size()) && (status == WarmUpStatus::kReady); ++i)
+    {
+        if (pipelines.graphics_create_infos != nullptr)
+        {
+            const Decoded_VkGraphicsPipelineCreateInfo* meta = &pipelines.graphics_create_infos[i];
+            const VkGraphicsPipelineCreateInfo*         info = meta->decoded_value;
 
-                replay_device_info->memory_properties = std::make_unique<VkPhysicalDeviceMemoryProperties>();
-                table->GetPhysicalDeviceMemoryProperties(physical_device, replay_device_info->memory_properties.get());
+            if ((info == nullptr) || uses_pipeline_libraries(info->flags, info->pNext) ||
+                ((info->stageCount > 0) && (meta->pStages == nullptr)))
+            {
+                return WarmUpStatus::kUnsupported;
             }
 
-            auto allocator = options_.create_resource_allocator();
+            for (uint32_t j = 0; j < info->stageCount; ++j)
+            {
+                if (!is_shader_stage_supported(&meta->pStages->GetMetaStructPointer()[j]))
+                {
+                    return WarmUpStatus::kUnsupported;
+                }
+            }
 
-            std::vector<std::string> enabled_extensions(modified_create_info.ppEnabledExtensionNames,
-                                                        modified_create_info.ppEnabledExtensionNames +
-                                                            modified_create_info.enabledExtensionCount);
-            InitializeResourceAllocator(physical_device_info, *replay_device, enabled_extensions, allocator);
+            layout_id        = meta->layout;
+            render_pass_id   = meta->renderPass;
+            base_pipeline_id = meta->basePipelineHandle;
+        }
+        else
+        {
+            const Decoded_VkComputePipelineCreateInfo* meta = &pipelines.compute_create_infos[i];
+            const VkComputePipelineCreateInfo*         info = meta->decoded_value;
 
-            device_info->allocator = std::unique_ptr<VulkanResourceAllocator>(allocator);
+            if ((info == nullptr) || uses_pipeline_libraries(info->flags, info->pNext) ||
+                !is_shader_stage_supported(meta->stage))
+            {
+                return WarmUpStatus::kUnsupported;
+            }
 
-            // Track state of physical device properties and features at device creation
-            device_info->property_feature_info = property_feature_info;
+            layout_id        = meta->layout;
+            render_pass_id   = format::kNullHandleId;
+            base_pipeline_id = meta->basePipelineHandle;
         }
 
-        // Restore modified property/feature create info values to the original application values
-        device_util.RestoreModifiedPhysicalDeviceFeatures();
+        if (((layout_id != format::kNullHandleId) &&
+             (object_info_table_.GetPipelineLayoutInfo(layout_id) == nullptr)) ||
+            ((render_pass_id != format::kNullHandleId) &&
+             (object_info_table_.GetRenderPassInfo(render_pass_id) == nullptr)) ||
+            ((base_pipeline_id != format::kNullHandleId) &&
+             (object_info_table_.GetPipelineInfo(base_pipeline_id) == nullptr)))
+        {
+            status = WarmUpStatus::kNotReady;
+        }
     }
 
-    return result;
+    return status;
 }
 
-void VulkanReplayConsumerBase::OverrideDestroyDevice(
-    PFN_vkDestroyDevice                                        func,
-    const DeviceInfo*                                          device_info,
-    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+void VulkanReplayConsumerBase::MapWarmUpShaderStage(const Decoded_VkPipelineShaderStageCreateInfo* stage) const
 {
-    VkDevice device = VK_NULL_HANDLE;
-
-    if (device_info != nullptr)
-    {
-        device = device_info->handle;
-
-        if (screenshot_handler_ != nullptr)
-        {
-            screenshot_handler_->DestroyDeviceResources(device, GetDeviceTable(device));
-        }
+    assert((stage != nullptr) && (stage->decoded_value != nullptr));
 
-        device_info->allocator->Destroy();
-    }
+    auto entry = warm_up_shader_modules_.find(stage->module);
 
-    func(device, GetAllocationCallbacks(pAllocator));
+    stage->decoded_value->module = (entry != warm_up_shader_modules_.end()) ? entry->second.handle : VK_NULL_HANDLE;
 }
 
-VkResult
-VulkanReplayConsumerBase::OverrideEnumeratePhysicalDevices(PFN_vkEnumeratePhysicalDevices          func,
-                                                           VkResult                                original_result,
-                                                           InstanceInfo*                           instance_info,
-                                                           PointerDecoder<uint32_t>*               pPhysicalDeviceCount,
-                                                           HandlePointerDecoder<VkPhysicalDevice>* pPhysicalDevices)
+bool VulkanReplayConsumerBase::ClaimWarmUpPipelines(uint32_t                          create_info_count,
+                                                    HandlePointerDecoder<VkPipeline>* pipelines)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(original_result);
-
-    assert((instance_info != nullptr) && (pPhysicalDeviceCount != nullptr) && !pPhysicalDeviceCount->IsNull() &&
-           (pPhysicalDeviceCount->GetOutputPointer() != nullptr) && (pPhysicalDevices != nullptr));
-
-    VkInstance        instance                = instance_info->handle;
-    uint32_t*         replay_device_count_ptr = pPhysicalDeviceCount->GetOutputPointer();
-    VkPhysicalDevice* replay_devices          = pPhysicalDevices->GetHandlePointer();
+    if (warm_up_pipeline_tasks_.empty() || (pipelines == nullptr) || pipelines->IsNull() ||
+        (pipelines->GetPointer() == nullptr) || (pipelines->GetHandlePointer() == nullptr))
+    {
+        return false;
+    }
 
-    VkResult result = func(instance, replay_device_count_ptr, replay_devices);
+    auto entry = warm_up_pipeline_tasks_.find(pipelines->GetPointer()[0]);
 
-    if ((result >= 0) && (replay_devices != nullptr))
+    if (entry == warm_up_pipeline_tasks_.end())
     {
-        assert(!pPhysicalDevices->IsNull());
+        return false;
+    }
 
-        uint32_t                replay_device_count  = (*replay_device_count_ptr);
-        uint32_t                capture_device_count = (*pPhysicalDeviceCount->GetPointer());
-        const format::HandleId* capture_devices      = pPhysicalDevices->GetPointer();
+    WarmUpPipelineTask warm_up_task = std::move(entry->second);
+    warm_up_pipeline_tasks_.erase(entry);
 
-        SetInstancePhysicalDeviceEntries(
-            instance_info, capture_device_count, capture_devices, replay_device_count, replay_devices);
+    warm_up_task.task->Wait();
 
-        for (uint32_t i = 0; i < replay_device_count; ++i)
-        {
-            auto physical_device_info = reinterpret_cast<PhysicalDeviceInfo*>(pPhysicalDevices->GetConsumerData(i));
-            assert(physical_device_info != nullptr);
+    if ((warm_up_task.task->GetResult() == VK_SUCCESS) && (warm_up_task.pipeline_count == create_info_count))
+    {
+        VkPipeline* out_pipelines = pipelines->GetHandlePointer();
 
-            SetPhysicalDeviceInstanceInfo(instance_info, physical_device_info, replay_devices[i]);
+        for (uint32_t i = 0; i < create_info_count; ++i)
+        {
+            out_pipelines[i] = warm_up_task.task->GetPipeline(i);
         }
 
-        if ((replay_device_count > 0) && (replay_device_count < capture_device_count))
-        {
-            // Make sure all of the capture physical device IDs map to a valid replay physical device handle.
-            // The generated code will only add handle mappings for handles returned by vkEnumeratePhysicalDevices on
-            // replay, so we add mappings for the handle IDs without matching devices here.
-            VkPhysicalDevice overflow_device = replay_devices[0];
+        return true;
+    }
 
-            for (uint32_t i = replay_device_count; i < capture_device_count; ++i)
-            {
-                PhysicalDeviceInfo overflow_info;
+    // Replay the call if the pipelines could not be created ahead of time.
+    const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(warm_up_task.device_id);
 
-                overflow_info.handle     = overflow_device;
-                overflow_info.capture_id = capture_devices[i];
-                overflow_info.parent_id  = instance_info->capture_id;
-                SetPhysicalDeviceInstanceInfo(instance_info, &overflow_info, overflow_device);
+    if (device_info != nullptr)
+    {
+        for (uint32_t i = 0; i < warm_up_task.pipeline_count; ++i)
+        {
+            VkPipeline pipeline = warm_up_task.task->GetPipeline(i);
 
-                object_info_table_.AddPhysicalDeviceInfo(std::move(overflow_info));
+            if (pipeline != VK_NULL_HANDLE)
+            {
+                GetDeviceTable(device_info->handle)->DestroyPipeline(device_info->handle, pipeline, nullptr);
             }
         }
     }
 
-    return result;
+    return false;
 }
 
-VkResult VulkanReplayConsumerBase::OverrideEnumeratePhysicalDeviceGroups(
-    PFN_vkEnumeratePhysicalDeviceGroups                            func,
-    VkResult                                                       original_result,
-    InstanceInfo*                                                  instance_info,
-    PointerDecoder<uint32_t>*                                      pPhysicalDeviceGroupCount,
-    StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
+void VulkanReplayConsumerBase::DestroyWarmUpObjects(const DeviceInfo* device_info)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(original_result);
-
-    assert((instance_info != nullptr) && (pPhysicalDeviceGroupCount != nullptr) &&
-           !pPhysicalDeviceGroupCount->IsNull() && (pPhysicalDeviceGroupCount->GetOutputPointer() != nullptr) &&
-           (pPhysicalDeviceGroupProperties != nullptr));
-
-    VkInstance                       instance                      = instance_info->handle;
-    uint32_t*                        replay_device_group_count_ptr = pPhysicalDeviceGroupCount->GetOutputPointer();
-    VkPhysicalDeviceGroupProperties* replay_device_groups          = pPhysicalDeviceGroupProperties->GetOutputPointer();
-
-    VkResult result = func(instance, replay_device_group_count_ptr, replay_device_groups);
+    assert(device_info != nullptr);
 
-    if ((result >= 0) && (replay_device_groups != nullptr))
+    if (warm_up_creator_ == nullptr)
     {
-        assert(!pPhysicalDeviceGroupProperties->IsNull() &&
-               (pPhysicalDeviceGroupProperties->GetLength() == (*pPhysicalDeviceGroupCount->GetPointer())));
-
-        const Decoded_VkPhysicalDeviceGroupProperties* meta_info =
-            pPhysicalDeviceGroupProperties->GetMetaStructPointer();
-        size_t capture_device_group_count = pPhysicalDeviceGroupProperties->GetLength();
-        size_t replay_device_group_count  = (*replay_device_group_count_ptr);
+        return;
+    }
 
-        // Merge the arrays of physical device capture IDs and replay handles from the individual
-        // VkPhysicalDeviceGroupProperties array entries into a single data set.
-        std::unordered_map<format::HandleId, VkPhysicalDevice> physical_devices;
-        std::unordered_set<VkPhysicalDevice>                   overflow_replay_devices;
+    VkDevice         device       = device_info->handle;
+    format::HandleId device_id    = device_info->capture_id;
+    auto             device_table = GetDeviceTable(device);
+    assert(device_table != nullptr);
 
-        auto device_group_count = std::max(capture_device_group_count, replay_device_group_count);
+    warm_up_creator_->WaitAll();
 
-        // Build a map of captured physical device IDs to physical device handles retrieved at replay.
-        for (size_t i = 0; i < device_group_count; ++i)
+    for (auto entry = warm_up_pipeline_tasks_.begin(); entry != warm_up_pipeline_tasks_.end();)
+    {
+        if (entry->second.device_id == device_id)
         {
-            size_t                  capture_device_count = 0;
-            const format::HandleId* capture_devices      = nullptr;
-            size_t                  replay_device_count  = 0;
-            const VkPhysicalDevice* replay_devices       = nullptr;
+            entry->second.task->Wait();
 
-            if (i < capture_device_group_count)
+            for (uint32_t i = 0; i < entry->second.pipeline_count; ++i)
             {
-                capture_device_count = meta_info[i].physicalDevices.GetLength();
-                capture_devices      = meta_info[i].physicalDevices.GetPointer();
-            }
+                VkPipeline pipeline = entry->second.task->GetPipeline(i);
 
-            if (i < replay_device_group_count)
-            {
-                replay_device_count = replay_device_groups[i].physicalDeviceCount;
-                replay_devices      = replay_device_groups[i].physicalDevices;
+                if (pipeline != VK_NULL_HANDLE)
+                {
+                    device_table->DestroyPipeline(device, pipeline, nullptr);
+                }
             }
 
-            auto device_count = std::max(capture_device_count, replay_device_count);
+            entry = warm_up_pipeline_tasks_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
 
-            for (size_t j = 0; j < device_count; ++j)
-            {
-                format::HandleId capture_device = format::kNullHandleId;
-                VkPhysicalDevice replay_device  = VK_NULL_HANDLE;
+    for (auto entry = warm_up_shader_modules_.begin(); entry != warm_up_shader_modules_.end();)
+    {
+        if (entry->second.device_id == device_id)
+        {
+            device_table->DestroyShaderModule(device, entry->second.handle, nullptr);
+            entry = warm_up_shader_modules_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
 
-                if (j < capture_device_count)
-                {
-                    capture_device = capture_devices[j];
-                }
+    pending_warm_up_pipelines_.erase(std::remove_if(pending_warm_up_pipelines_.begin(),
+                                                    pending_warm_up_pipelines_.end(),
+                                                    [device_id](const PrescannedPipelines* pipelines) {
+                                                        return (pipelines->device_id == device_id);
+                                                    }),
+                                     pending_warm_up_pipelines_.end());
+}
 
-                if (j < replay_device_count)
-                {
-                    replay_device = replay_devices[j];
-                }
+void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const
+{
+    if ((meta_info != nullptr) && (meta_info->decoded_value != nullptr) && !meta_info->pSwapchains.IsNull())
+    {
+        auto present_info  = meta_info->decoded_value;
+        auto swapchain_ids = meta_info->pSwapchains.GetPointer();
 
-                if (capture_device != format::kNullHandleId)
-                {
-                    physical_devices[capture_device] = replay_device;
-                }
-                else
+        // The screenshot copies wait for the semaphores that the present will wait for, and then signal them again.
+        // Shadow and imported semaphores are omitted, as replay does not wait for them at present.
+        std::vector<VkSemaphore> wait_semaphores;
+        const format::HandleId*  semaphore_ids = meta_info->pWaitSemaphores.GetPointer();
+        if (semaphore_ids != nullptr)
+        {
+            size_t count = meta_info->pWaitSemaphores.GetLength();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const SemaphoreInfo* semaphore_info = object_info_table_.GetSemaphoreInfo(semaphore_ids[i]);
+                if ((semaphore_info != nullptr) && !semaphore_info->shadow_signaled && !semaphore_info->is_external)
                 {
-                    overflow_replay_devices.insert(replay_device);
+                    wait_semaphores.push_back(semaphore_info->handle);
                 }
             }
         }
 
-        // Build lists of capture physical device IDs and replay physical device handles, inserting ID/handle values at
-        // matching indexes at the start of the lists, with unpaired values appended to the end.
-        std::vector<format::HandleId> capture_devices;
-        std::vector<VkPhysicalDevice> replay_devices;
-
-        for (const auto& entry : physical_devices)
+        for (uint32_t i = 0; i < present_info->swapchainCount; ++i)
         {
-            capture_devices.push_back(entry.first);
-
-            if (entry.second != VK_NULL_HANDLE)
+            auto swapchain_info = object_info_table_.GetSwapchainKHRInfo(swapchain_ids[i]);
+            if ((swapchain_info != nullptr) && (swapchain_info->device_info != nullptr))
             {
-                replay_devices.push_back(entry.second);
+                auto     device_info = swapchain_info->device_info;
+                uint32_t image_index = present_info->pImageIndices[i];
 
-                // There is currently no way to provide pre-initialized info data for a newly created handle that is a
-                // member of a struct, so we insert the handle here.  The generated code will also perform a handle
-                // insertion, which will be ignored.
-                PhysicalDeviceInfo physical_device_info;
+                auto instance_table = GetInstanceTable(device_info->parent);
+                assert(instance_table != nullptr);
 
-                physical_device_info.handle     = entry.second;
-                physical_device_info.capture_id = entry.first;
-                physical_device_info.parent_id  = instance_info->capture_id;
-                SetPhysicalDeviceInstanceInfo(instance_info, &physical_device_info, entry.second);
+                // TODO: This should be stored in the DeviceInfo structure to avoid the need for frequent queries.
+                VkPhysicalDeviceMemoryProperties memory_properties;
+                instance_table->GetPhysicalDeviceMemoryProperties(device_info->parent, &memory_properties);
 
-                object_info_table_.AddPhysicalDeviceInfo(std::move(physical_device_info));
-            }
+                std::string filename_prefix = screenshot_file_prefix_;
+
+                if (present_info->swapchainCount > 1)
+                {
+                    filename_prefix += "_swapchain_";
+                    filename_prefix += std::to_string(i);
+                }
+
+                filename_prefix += "_frame_";
+                filename_prefix += std::to_string(screenshot_handler_->GetCurrentFrame());
+
+                screenshot_handler_->WriteImage(filename_prefix,
+                                                device_info->handle,
+                                                GetDeviceTable(device_info->handle),
+                                                memory_properties,
+                                                device_info->allocator.get(),
+                                                swapchain_info->images[image_index],
+                                                swapchain_info->format,
+                                                swapchain_info->width,
+                                                swapchain_info->height,
+                                                static_cast<uint32_t>(wait_semaphores.size()),
+                                                wait_semaphores.data());
+            }
         }
+    }
+}
 
-        replay_devices.insert(replay_devices.end(), overflow_replay_devices.begin(), overflow_replay_devices.end());
+void VulkanReplayConsumerBase::CreateSubmitTimer(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info)
+{
+    assert((device_info != nullptr) && (create_info != nullptr));
 
-        SetInstancePhysicalDeviceEntries(instance_info,
-                                         capture_devices.size(),
-                                         capture_devices.data(),
-                                         replay_devices.size(),
-                                         replay_devices.data());
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    assert(instance_table != nullptr);
 
-        if ((!replay_devices.empty()) && (replay_devices.size() < capture_devices.size()))
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(physical_device, &properties);
+
+    uint32_t count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+
+    std::vector<VkQueueFamilyProperties> family_properties(count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, family_properties.data());
+
+    auto timer = std::make_unique<VulkanSubmitTimer>(
+        device_info->handle, GetDeviceTable(device_info->handle), properties.limits.timestampPeriod);
+
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
+    {
+        const VkDeviceQueueCreateInfo& queue_create_info = create_info->pQueueCreateInfos[i];
+
+        // Queues that were created with flags are not retrieved by vkGetDeviceQueue, and are not timed.
+        if ((queue_create_info.flags == 0) && (queue_create_info.queueFamilyIndex < count))
         {
-            // Make sure all of the capture physical device IDs map to a valid replay physical device handle.
-            // The generated code will only add handle mappings for handles returned by vkEnumeratePhysicalDevices on
-            // replay, so we add mappings for the handle IDs without matching devices here.
-            VkPhysicalDevice overflow_device = replay_devices[0];
+            timer->AddQueueFamily(queue_create_info.queueFamilyIndex,
+                                  queue_create_info.queueCount,
+                                  family_properties[queue_create_info.queueFamilyIndex].timestampValidBits);
+        }
+    }
 
-            for (size_t i = replay_devices.size(); i < capture_devices.size(); ++i)
-            {
-                PhysicalDeviceInfo overflow_info;
+    submit_timers_[device_info->handle] = std::move(timer);
+}
 
-                overflow_info.handle     = overflow_device;
-                overflow_info.capture_id = capture_devices[i];
-                overflow_info.parent_id  = instance_info->capture_id;
-                SetPhysicalDeviceInstanceInfo(instance_info, &overflow_info, overflow_device);
+void VulkanReplayConsumerBase::CreatePassTimer(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info)
+{
+    assert((device_info != nullptr) && (create_info != nullptr));
 
-                object_info_table_.AddPhysicalDeviceInfo(std::move(overflow_info));
-            }
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    assert(instance_table != nullptr);
+
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(physical_device, &properties);
+
+    // Timestamps are written by the command buffers that record the passes, which requires timestamp support for the
+    // graphics and compute queues of any command pool.
+    if (!properties.limits.timestampComputeAndGraphics)
+    {
+        GFXRECON_LOG_WARNING("Device %s does not support timestamps on all graphics and compute queues; GPU pass times "
+                             "will not be reported",
+                             properties.deviceName);
+        return;
+    }
+
+    uint32_t count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+
+    std::vector<VkQueueFamilyProperties> family_properties(count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, family_properties.data());
+
+    auto timer = std::make_unique<VulkanPassTimer>(
+        device_info->handle, GetDeviceTable(device_info->handle), properties.limits.timestampPeriod);
+
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
+    {
+        const VkDeviceQueueCreateInfo& queue_create_info = create_info->pQueueCreateInfos[i];
+
+        // Queues that were created with flags are not retrieved by vkGetDeviceQueue, and their submissions are not
+        // reported.
+        if ((queue_create_info.flags == 0) && (queue_create_info.queueFamilyIndex < count))
+        {
+            timer->AddQueueFamily(queue_create_info.queueFamilyIndex,
+                                  queue_create_info.queueCount,
+                                  family_properties[queue_create_info.queueFamilyIndex].timestampValidBits);
         }
     }
 
-    return result;
+    pass_timers_[device_info->handle] = std::move(timer);
 }
 
-void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceProperties(
-    PFN_vkGetPhysicalDeviceProperties                         func,
-    PhysicalDeviceInfo*                                       physical_device_info,
-    StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
+VulkanPassTimer* VulkanReplayConsumerBase::GetPassTimer(format::HandleId device_id)
 {
-    assert((physical_device_info != nullptr) && (pProperties != nullptr) && !pProperties->IsNull() &&
-           (pProperties->GetOutputPointer() != nullptr));
+    if (!pass_timers_.empty())
+    {
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
-    VkPhysicalDevice physical_device   = physical_device_info->handle;
-    auto             replay_properties = pProperties->GetOutputPointer();
+        if (device_info != nullptr)
+        {
+            auto entry = pass_timers_.find(device_info->handle);
 
-    func(physical_device, replay_properties);
+            if (entry != pass_timers_.end())
+            {
+                return entry->second.get();
+            }
+        }
+    }
 
-    // This can be set by ProcessSetDevicePropertiesCommand, but older files will not contain that data.
-    SetPhysicalDeviceProperties(physical_device_info, pProperties->GetPointer(), replay_properties);
+    return nullptr;
 }
 
-void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceProperties2(
-    PFN_vkGetPhysicalDeviceProperties2                         func,
-    PhysicalDeviceInfo*                                        physical_device_info,
-    StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
+void VulkanReplayConsumerBase::AddGpuPassTimes(VulkanPassTimer* timer, bool wait)
 {
-    assert((physical_device_info != nullptr) && (pProperties != nullptr) && !pProperties->IsNull() &&
-           (pProperties->GetOutputPointer() != nullptr));
+    assert((timer != nullptr) && (pass_timing_report_ != nullptr));
 
-    VkPhysicalDevice physical_device   = physical_device_info->handle;
-    auto             replay_properties = pProperties->GetOutputPointer();
+    std::vector<VulkanPassTimer::PassTime> pass_times;
+    timer->GetPassTimes(wait, &pass_times);
 
-    func(physical_device, replay_properties);
+    for (const auto& pass_time : pass_times)
+    {
+        if (pass_time.available)
+        {
+            graphics::PassTimingReport::PassTiming timing;
+            timing.frame_number      = pass_time.frame_number;
+            timing.command_buffer_id = pass_time.command_buffer_id;
+            timing.pass_index        = pass_time.pass_index;
+            timing.type              = pass_time.dispatch_group ? graphics::PassTimingReport::kDispatchGroup
+                                                                : graphics::PassTimingReport::kRenderPass;
+            timing.render_pass_id    = pass_time.render_pass_id;
+            timing.framebuffer_id    = pass_time.framebuffer_id;
+            timing.gpu_milliseconds  = pass_time.gpu_milliseconds;
+            pass_timing_report_->AddPass(timing);
+        }
+        else
+        {
+            pass_timing_report_->SetFrameIncomplete(pass_time.frame_number);
+        }
+    }
+}
 
-    // This can be set by ProcessSetDevicePropertiesCommand, but older files will not contain that data.
-    auto capture_properties = pProperties->GetPointer();
-    SetPhysicalDeviceProperties(physical_device_info, &capture_properties->properties, &replay_properties->properties);
+void VulkanReplayConsumerBase::BeginDebugLabel(VkCommandBuffer command_buffer, std::string name)
+{
+    if (options_.debug_label_blocks)
+    {
+        name += " (block " + std::to_string(current_block_index_) + ")";
+    }
+
+    VkDebugUtilsLabelEXT label{ VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT };
+    label.pLabelName = name.c_str();
+
+    GetDeviceTable(command_buffer)->CmdBeginDebugUtilsLabelEXT(command_buffer, &label);
 }
 
-void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceMemoryProperties(
-    PFN_vkGetPhysicalDeviceMemoryProperties                         func,
-    PhysicalDeviceInfo*                                             physical_device_info,
-    StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
+void VulkanReplayConsumerBase::BeginDebugLabel(VkQueue queue, std::string name)
 {
-    assert((physical_device_info != nullptr) && (pMemoryProperties != nullptr) && !pMemoryProperties->IsNull() &&
-           (pMemoryProperties->GetOutputPointer() != nullptr));
+    if (options_.debug_label_blocks)
+    {
+        name += " (block " + std::to_string(current_block_index_) + ")";
+    }
 
-    VkPhysicalDevice physical_device   = physical_device_info->handle;
-    auto             replay_properties = pMemoryProperties->GetOutputPointer();
+    VkDebugUtilsLabelEXT label{ VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT };
+    label.pLabelName = name.c_str();
 
-    func(physical_device, replay_properties);
+    GetDeviceTable(queue)->QueueBeginDebugUtilsLabelEXT(queue, &label);
+}
 
-    // This can be set by ProcessSetDeviceMemoryPropertiesCommand, but older files will not contain that data.
-    SetPhysicalDeviceMemoryProperties(physical_device_info, pMemoryProperties->GetPointer(), replay_properties);
+void VulkanReplayConsumerBase::AddGpuFrameTimes(VulkanSubmitTimer* timer, bool wait)
+{
+    assert((timer != nullptr) && (timing_report_ != nullptr));
+
+    std::vector<VulkanSubmitTimer::FrameTime> frame_times;
+    timer->GetFrameTimes(wait, &frame_times);
+
+    for (const auto& frame_time : frame_times)
+    {
+        if (frame_time.available)
+        {
+            timing_report_->AddGpuTime(frame_time.frame_number, frame_time.gpu_milliseconds);
+        }
+        else
+        {
+            timing_report_->SetGpuTimeUnavailable(frame_time.frame_number);
+        }
+    }
 }
 
-void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceMemoryProperties2(
-    PFN_vkGetPhysicalDeviceMemoryProperties2                         func,
-    PhysicalDeviceInfo*                                              physical_device_info,
-    StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
+void VulkanReplayConsumerBase::UpdateMemoryUsage()
 {
-    assert((physical_device_info != nullptr) && (pMemoryProperties != nullptr) && !pMemoryProperties->IsNull() &&
-           (pMemoryProperties->GetOutputPointer() != nullptr));
+    graphics::MemoryUsageReport* memory_report = options_.memory_report.get();
+    assert(memory_report != nullptr);
 
-    VkPhysicalDevice physical_device   = physical_device_info->handle;
-    auto             replay_properties = pMemoryProperties->GetOutputPointer();
+    size_t                    host_copy_size = 0;
+    std::vector<VkDeviceSize> heap_usage;
 
-    func(physical_device, replay_properties);
+    object_info_table_.VisitDeviceInfo([&](const DeviceInfo* info) {
+        assert(info != nullptr);
 
-    // This can be set by ProcessSetDeviceMemoryPropertiesCommand, but older files will not contain that data.
-    auto capture_properties = pMemoryProperties->GetPointer();
-    SetPhysicalDeviceMemoryProperties(
-        physical_device_info, &capture_properties->memoryProperties, &replay_properties->memoryProperties);
+        if (info->allocator != nullptr)
+        {
+            host_copy_size += info->allocator->GetHostCopySize();
+
+            info->allocator->GetHeapUsage(&heap_usage);
+            memory_report->SetDeviceUsage(info->capture_id, heap_usage);
+        }
+    });
+
+    memory_report->SetHostUsage(graphics::MemoryUsageReport::kObjectInfoTables, object_info_table_.GetMemorySize());
+    memory_report->SetHostUsage(graphics::MemoryUsageReport::kHostCopies, host_copy_size);
+
+    if (screenshot_handler_ != nullptr)
+    {
+        memory_report->SetHostUsage(graphics::MemoryUsageReport::kScreenshotBuffers,
+                                    screenshot_handler_->GetBufferMemorySize());
+    }
 }
 
-VkResult VulkanReplayConsumerBase::OverrideWaitForFences(PFN_vkWaitForFences                  func,
-                                                         VkResult                             original_result,
-                                                         const DeviceInfo*                    device_info,
-                                                         uint32_t                             fenceCount,
-                                                         const HandlePointerDecoder<VkFence>* pFences,
-                                                         VkBool32                             waitAll,
-                                                         uint64_t                             timeout)
+bool VulkanReplayConsumerBase::EnableTimelineSemaphores(
+    const PhysicalDeviceInfo*                  physical_device_info,
+    VkDeviceCreateInfo*                        create_info,
+    std::vector<const char*>*                  extensions,
+    VkPhysicalDeviceTimelineSemaphoreFeatures* timeline_features,
+    bool*                                      use_khr_entry_points)
 {
-    assert((device_info != nullptr) && (pFences != nullptr));
+    assert((physical_device_info != nullptr) && (create_info != nullptr) && (extensions != nullptr) &&
+           (timeline_features != nullptr) && (use_khr_entry_points != nullptr));
 
-    VkResult             result               = VK_SUCCESS;
-    VkDevice             device               = device_info->handle;
-    uint32_t             modified_fence_count = fenceCount;
-    const VkFence*       modified_fences      = nullptr;
-    std::vector<VkFence> valid_fences;
+    VkPhysicalDevice physical_device = physical_device_info->handle;
+    auto             table           = GetInstanceTable(physical_device);
+    assert(table != nullptr);
 
-    // Check for fences that need to be removed.
-    if (shadow_fences_.empty())
+    VkPhysicalDeviceProperties properties;
+    table->GetPhysicalDeviceProperties(physical_device, &properties);
+
+    // Timeline semaphores are core for Vulkan 1.2, and require the extension for earlier versions.
+    bool is_core = (physical_device_info->parent_api_version >= VK_MAKE_VERSION(1, 2, 0)) &&
+                   (properties.apiVersion >= VK_MAKE_VERSION(1, 2, 0));
+
+    if (!is_core)
     {
-        modified_fences = pFences->GetHandlePointer();
+        std::vector<VkExtensionProperties> available_extensions;
+        if ((feature_util::GetDeviceExtensions(
+                 physical_device, table->EnumerateDeviceExtensionProperties, &available_extensions) != VK_SUCCESS) ||
+            !feature_util::IsSupportedExtension(available_extensions, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+        {
+            return false;
+        }
+    }
+
+    VkPhysicalDeviceTimelineSemaphoreFeatures supported_features{
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES, nullptr
+    };
+    VkPhysicalDeviceFeatures2 features2{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, &supported_features };
+
+    if (physical_device_info->parent_api_version >= VK_MAKE_VERSION(1, 1, 0))
+    {
+        table->GetPhysicalDeviceFeatures2(physical_device, &features2);
     }
     else
     {
-        const format::HandleId* fence_handles = pFences->GetPointer();
-        for (size_t i = 0; i < pFences->GetLength(); ++i)
+        const auto& instance_extensions = physical_device_info->parent_enabled_extensions;
+
+        if (std::find(instance_extensions.begin(),
+                      instance_extensions.end(),
+                      VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) == instance_extensions.end())
         {
-            FenceInfo* fence_info = object_info_table_.GetFenceInfo(fence_handles[i]);
-            if (fence_info != nullptr)
-            {
-                VkFence fence_handle = fence_info->handle;
-                if (fence_info->shadow_signaled)
-                {
-                    // If found, unsignal the fence to represent it being used.
-                    fence_info->shadow_signaled = false;
-                    shadow_fences_.erase(fence_handle);
-                }
-                else
-                {
-                    valid_fences.push_back(fence_handle);
-                }
-            }
+            return false;
         }
 
-        modified_fence_count = static_cast<uint32_t>(valid_fences.size());
-        modified_fences      = valid_fences.data();
+        table->GetPhysicalDeviceFeatures2KHR(physical_device, &features2);
     }
 
-    if (original_result == VK_SUCCESS)
+    if (!supported_features.timelineSemaphore)
     {
-        // Ensure that wait for fences waits until the fences have been signaled (or error occurs) by changing the
-        // timeout to UINT64_MAX.
-        result = func(device, modified_fence_count, modified_fences, waitAll, std::numeric_limits<uint64_t>::max());
+        return false;
     }
-    else if (original_result == VK_TIMEOUT)
+
+    // Enable the feature in the application's feature struct when there is one, as the struct cannot appear twice in
+    // the pNext chain.
+    bool enabled = false;
+    auto current = reinterpret_cast<VkBaseOutStructure*>(const_cast<void*>(create_info->pNext));
+
+    while (current != nullptr)
     {
-        // Try to get a timeout result with a 0 timeout.
-        result = func(device, modified_fence_count, modified_fences, waitAll, 0);
+        if (current->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES)
+        {
+            reinterpret_cast<VkPhysicalDeviceVulkan12Features*>(current)->timelineSemaphore = VK_TRUE;
+            enabled                                                                        = true;
+        }
+        else if (current->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES)
+        {
+            reinterpret_cast<VkPhysicalDeviceTimelineSemaphoreFeatures*>(current)->timelineSemaphore = VK_TRUE;
+            enabled                                                                                 = true;
+        }
+
+        current = current->pNext;
     }
-    else
+
+    if (!enabled)
     {
-        result = func(device, modified_fence_count, modified_fences, waitAll, timeout);
+        timeline_features->sType             = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+        timeline_features->pNext             = const_cast<void*>(create_info->pNext);
+        timeline_features->timelineSemaphore = VK_TRUE;
+        create_info->pNext                   = timeline_features;
     }
 
-    return result;
+    if (!is_core && (std::find(extensions->begin(),
+                               extensions->end(),
+                               std::string(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) == extensions->end()))
+    {
+        extensions->push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    }
+
+    (*use_khr_entry_points) = !is_core;
+
+    return true;
 }
 
-VkResult VulkanReplayConsumerBase::OverrideGetFenceStatus(PFN_vkGetFenceStatus func,
-                                                          VkResult             original_result,
-                                                          const DeviceInfo*    device_info,
-                                                          const FenceInfo*     fence_info)
+void VulkanReplayConsumerBase::CreateSubmitPacer(const DeviceInfo*         device_info,
+                                                 const VkDeviceCreateInfo* create_info,
+                                                 bool                      use_khr)
 {
-    assert((device_info != nullptr) && (fence_info != nullptr));
+    assert((device_info != nullptr) && (create_info != nullptr));
 
-    VkResult result;
-    VkDevice device = device_info->handle;
-    VkFence  fence  = fence_info->handle;
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    auto             device_table    = GetDeviceTable(device_info->handle);
+    assert((instance_table != nullptr) && (device_table != nullptr));
 
-    // If you find this loop to be infinite consider adding a limit in the same way
-    // it is done for GetEventStatus and GetQueryPoolResults.
-    do
+    uint32_t count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+
+    std::vector<VkQueueFamilyProperties> family_properties(count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, family_properties.data());
+
+    auto pacer = std::make_unique<VulkanSubmitPacer>(device_info->handle,
+                                                     device_table,
+                                                     use_khr ? device_table->WaitSemaphoresKHR
+                                                             : device_table->WaitSemaphores,
+                                                     options_.max_submits_in_flight,
+                                                     options_.max_frames_in_flight);
+
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
     {
-        result = func(device, fence);
-    } while ((original_result == VK_SUCCESS) && (result == VK_NOT_READY));
+        const VkDeviceQueueCreateInfo& queue_create_info = create_info->pQueueCreateInfos[i];
 
-    return result;
+        // Queues that were created with flags are not retrieved by vkGetDeviceQueue, and are not paced.
+        if ((queue_create_info.flags == 0) && (queue_create_info.queueFamilyIndex < count))
+        {
+            pacer->AddQueueFamily(queue_create_info.queueFamilyIndex,
+                                  queue_create_info.queueCount,
+                                  family_properties[queue_create_info.queueFamilyIndex].queueFlags);
+        }
+    }
+
+    submit_pacers_[device_info->handle] = std::move(pacer);
 }
 
-VkResult VulkanReplayConsumerBase::OverrideGetEventStatus(PFN_vkGetEventStatus func,
-                                                          VkResult             original_result,
-                                                          const DeviceInfo*    device_info,
-                                                          const EventInfo*     event_info)
+void VulkanReplayConsumerBase::CreateAddressPatcher(const DeviceInfo*         device_info,
+                                                    const VkDeviceCreateInfo* create_info)
 {
-    assert((device_info != nullptr) && (event_info != nullptr));
+    assert((device_info != nullptr) && (create_info != nullptr));
 
-    VkResult result;
-    VkDevice device = device_info->handle;
-    VkEvent  event  = event_info->handle;
-    size_t   retries = 0;
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    auto             device_table    = GetDeviceTable(device_info->handle);
+    assert((instance_table != nullptr) && (device_table != nullptr));
 
-    do
-    {
-        result = func(device, event);
-    } while ((((original_result == VK_EVENT_SET) && (result == VK_EVENT_RESET)) ||
-              ((original_result == VK_EVENT_RESET) && (result == VK_EVENT_SET))) &&
-             (++retries <= kMaxEventStatusRetries));
+    uint32_t count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
 
-    return result;
-}
+    std::vector<VkQueueFamilyProperties> family_properties(count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, family_properties.data());
 
-VkResult VulkanReplayConsumerBase::OverrideGetQueryPoolResults(PFN_vkGetQueryPoolResults func,
-                                                               VkResult                  original_result,
-                                                               const DeviceInfo*         device_info,
-                                                               const QueryPoolInfo*      query_pool_info,
-                                                               uint32_t                  firstQuery,
-                                                               uint32_t                  queryCount,
-                                                               size_t                    dataSize,
-                                                               PointerDecoder<uint8_t>*  pData,
-                                                               VkDeviceSize              stride,
-                                                               VkQueryResultFlags        flags)
-{
-    assert((device_info != nullptr) && (query_pool_info != nullptr) && (pData != nullptr) &&
-           (pData->GetOutputPointer() != nullptr));
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    instance_table->GetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
 
-    VkResult    result;
-    VkDevice    device     = device_info->handle;
-    VkQueryPool query_pool = query_pool_info->handle;
-    size_t      retries    = 0;
+    PFN_vkGetBufferDeviceAddress get_buffer_device_address = device_table->GetBufferDeviceAddress;
 
-    do
+    if (std::find(device_info->extensions.begin(),
+                  device_info->extensions.end(),
+                  VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME) != device_info->extensions.end())
     {
-        result = func(device, query_pool, firstQuery, queryCount, dataSize, pData->GetOutputPointer(), stride, flags);
-    } while ((((original_result == VK_SUCCESS) && (result == VK_NOT_READY)) ||
-              ((original_result == VK_NOT_READY) && (result == VK_SUCCESS))) &&
-             (++retries <= kMaxQueryPoolResultsRetries));
+        get_buffer_device_address = device_table->GetBufferDeviceAddressKHR;
+    }
 
-    return result;
+    auto patcher = std::make_unique<VulkanAddressPatcher>(device_info->handle,
+                                                          device_table,
+                                                          memory_properties,
+                                                          device_info->allocator.get(),
+                                                          get_buffer_device_address);
+
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
+    {
+        const VkDeviceQueueCreateInfo& queue_create_info = create_info->pQueueCreateInfos[i];
+
+        // Queues that were created with flags are not retrieved by vkGetDeviceQueue, and cannot be patched.
+        if ((queue_create_info.flags == 0) && (queue_create_info.queueFamilyIndex < count))
+        {
+            patcher->AddQueueFamily(queue_create_info.queueFamilyIndex,
+                                    queue_create_info.queueCount,
+                                    family_properties[queue_create_info.queueFamilyIndex].queueFlags);
+        }
+    }
+
+    address_patchers_[device_info->handle] = std::move(patcher);
 }
 
-VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit func,
-                                                       VkResult          original_result,
-                                                       const QueueInfo*  queue_info,
-                                                       uint32_t          submitCount,
-                                                       const StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
-                                                       const FenceInfo*                                  fence_info)
+VulkanAddressPatcher* VulkanReplayConsumerBase::GetAddressPatcher(format::HandleId device_id)
 {
-    assert((queue_info != nullptr) && (pSubmits != nullptr));
+    if (!address_patchers_.empty())
+    {
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
-    VkResult            result       = VK_SUCCESS;
-    const VkSubmitInfo* submit_infos = pSubmits->GetPointer();
-    assert(submit_infos != nullptr);
-    auto    submit_info_data = pSubmits->GetMetaStructPointer();
-    VkFence fence            = VK_NULL_HANDLE;
+        if (device_info != nullptr)
+        {
+            auto entry = address_patchers_.find(device_info->handle);
 
-    if (fence_info != nullptr)
+            if (entry != address_patchers_.end())
+            {
+                return entry->second.get();
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+void VulkanReplayConsumerBase::CreateAccelStructCache(const DeviceInfo*         device_info,
+                                                      const VkDeviceCreateInfo* create_info)
+{
+    assert((device_info != nullptr) && (create_info != nullptr));
+
+    if (std::find(device_info->extensions.begin(),
+                  device_info->extensions.end(),
+                  VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME) == device_info->extensions.end())
     {
-        fence = fence_info->handle;
+        return;
     }
 
-    // Only attempt to filter imported semaphores if we know at least one has been imported.
-    // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
-    // tracked.
-    if ((!have_imported_semaphores_) && (options_.surface_index == -1))
+    // The cache file is written by a single device.
+    if (!accel_struct_caches_.empty())
     {
-        result = func(queue_info->handle, submitCount, submit_infos, fence);
+        GFXRECON_LOG_WARNING_ONCE("Acceleration structures are only cached for the first device that supports them");
+        return;
     }
-    else
+
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    auto             device_table    = GetDeviceTable(device_info->handle);
+    assert((instance_table != nullptr) && (device_table != nullptr));
+
+    uint32_t count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+
+    std::vector<VkQueueFamilyProperties> family_properties(count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, family_properties.data());
+
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(physical_device, &properties);
+
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    instance_table->GetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+
+    PFN_vkGetBufferDeviceAddress get_buffer_device_address = device_table->GetBufferDeviceAddress;
+
+    if (std::find(device_info->extensions.begin(),
+                  device_info->extensions.end(),
+                  VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME) != device_info->extensions.end())
     {
-        // Check for imported semaphores in the current submission list, mapping the pSubmits array index to a vector of
-        // imported semaphore info structures.
-        std::unordered_map<uint32_t, std::vector<const SemaphoreInfo*>> altered_submits;
-        std::vector<const SemaphoreInfo*>                               removed_semaphores;
+        get_buffer_device_address = device_table->GetBufferDeviceAddressKHR;
+    }
 
-        if (submit_info_data != nullptr)
-        {
-            for (uint32_t i = 0; i < submitCount; i++)
-            {
-                GetImportedSemaphores(submit_info_data[i].pWaitSemaphores, &removed_semaphores);
-                GetShadowSemaphores(submit_info_data[i].pWaitSemaphores, &removed_semaphores);
+    auto cache = std::make_unique<VulkanAccelStructCache>(device_info->handle,
+                                                          device_table,
+                                                          properties,
+                                                          memory_properties,
+                                                          device_info->allocator.get(),
+                                                          get_buffer_device_address);
 
-                // If rendering is restricted to a specific surface, need to track forward progress for semaphores that
-                // have been submitted with a null-swapchain.
-                TrackSemaphoreForwardProgress(submit_info_data[i].pWaitSemaphores, &removed_semaphores);
+    if (!cache->Initialize(options_.accel_struct_cache_capture_file))
+    {
+        GFXRECON_LOG_WARNING("Acceleration structures cannot be cached for capture file %s",
+                             options_.accel_struct_cache_capture_file.c_str());
+        return;
+    }
 
-                // Remove non-forward progress of signal semaphores.
-                GetNonForwardProgress(submit_info_data[i].pSignalSemaphores, &removed_semaphores);
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
+    {
+        const VkDeviceQueueCreateInfo& queue_create_info = create_info->pQueueCreateInfos[i];
 
-                if (!removed_semaphores.empty())
-                {
-                    altered_submits[i].swap(removed_semaphores);
-                    assert(removed_semaphores.empty());
-                }
-            }
+        // Queues that were created with flags are not retrieved by vkGetDeviceQueue, and their builds are not cached.
+        if ((queue_create_info.flags == 0) && (queue_create_info.queueFamilyIndex < count))
+        {
+            cache->AddQueueFamily(queue_create_info.queueFamilyIndex,
+                                  queue_create_info.queueCount,
+                                  family_properties[queue_create_info.queueFamilyIndex].queueFlags);
         }
+    }
 
-        if (altered_submits.empty())
+    accel_struct_caches_[device_info->handle] = std::move(cache);
+}
+
+VulkanAccelStructCache* VulkanReplayConsumerBase::GetAccelStructCache(format::HandleId device_id)
+{
+    if (!accel_struct_caches_.empty())
+    {
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
+
+        if (device_info != nullptr)
         {
-            result = func(queue_info->handle, submitCount, submit_infos, fence);
+            auto entry = accel_struct_caches_.find(device_info->handle);
+
+            if (entry != accel_struct_caches_.end())
+            {
+                return entry->second.get();
+            }
         }
-        else
-        {
-            // Make shallow copies of the VkSubmit info structures and change pWaitSemaphores to reference a copy of the
-            // original semaphore array with the imported semaphores omitted.
-            std::vector<VkSubmitInfo> modified_submit_infos(submit_infos, std::next(submit_infos, submitCount));
-            std::vector<std::vector<VkSemaphore>> semaphore_memory(altered_submits.size());
+    }
 
-            std::vector<VkSemaphore> wait_semaphores;
-            std::vector<VkSemaphore> signal_semaphores;
+    return nullptr;
+}
 
-            for (const auto& submit_iter : altered_submits)
-            {
-                // Shallow copy with filtered copy of pWaitSemaphores for submission info with imported semaphores.
-                VkSubmitInfo& modified_submit_info = modified_submit_infos[submit_iter.first];
-                auto          semaphore_iter       = submit_iter.second.begin();
+void VulkanReplayConsumerBase::CreatePresentImageCopier(const DeviceInfo*         device_info,
+                                                        const VkDeviceCreateInfo* create_info)
+{
+    assert((device_info != nullptr) && (create_info != nullptr));
 
-                for (uint32_t i = 0; i < modified_submit_info.waitSemaphoreCount; ++i)
-                {
-                    VkSemaphore semaphore = modified_submit_info.pWaitSemaphores[i];
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    auto             device_table    = GetDeviceTable(device_info->handle);
+    assert((instance_table != nullptr) && (device_table != nullptr));
 
-                    if ((semaphore_iter == submit_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
-                    {
-                        wait_semaphores.push_back(semaphore);
-                    }
-                    else
-                    {
-                        // Omit the ignored semaphore from the current submission.
-                        ++semaphore_iter;
-                    }
-                }
+    uint32_t count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
 
-                for (uint32_t i = 0; i < modified_submit_info.signalSemaphoreCount; ++i)
-                {
-                    VkSemaphore semaphore = modified_submit_info.pSignalSemaphores[i];
+    std::vector<VkQueueFamilyProperties> family_properties(count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &count, family_properties.data());
 
-                    if ((semaphore_iter == submit_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
-                    {
-                        signal_semaphores.push_back(semaphore);
-                    }
-                    else
-                    {
-                        // Omit the ignored semaphore from the current submission.
-                        ++semaphore_iter;
-                    }
-                }
+    auto copier = std::make_unique<VulkanPresentImageCopier>(device_info->handle, device_table);
 
-                modified_submit_info.waitSemaphoreCount   = static_cast<uint32_t>(wait_semaphores.size());
-                modified_submit_info.pWaitSemaphores      = wait_semaphores.data();
-                modified_submit_info.signalSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size());
-                modified_submit_info.pSignalSemaphores    = signal_semaphores.data();
-            }
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
+    {
+        const VkDeviceQueueCreateInfo& queue_create_info = create_info->pQueueCreateInfos[i];
 
-            result = func(queue_info->handle,
-                          static_cast<uint32_t>(modified_submit_infos.size()),
-                          modified_submit_infos.data(),
-                          fence);
+        // Queues that were created with flags are not retrieved by vkGetDeviceQueue, and cannot present copies.
+        if ((queue_create_info.flags == 0) && (queue_create_info.queueFamilyIndex < count))
+        {
+            copier->AddQueueFamily(queue_create_info.queueFamilyIndex,
+                                   queue_create_info.queueCount,
+                                   family_properties[queue_create_info.queueFamilyIndex].queueFlags);
         }
     }
 
-    if ((options_.sync_queue_submissions) && (result == VK_SUCCESS))
+    present_image_copiers_[device_info->handle] = std::move(copier);
+}
+
+VulkanPoolCache* VulkanReplayConsumerBase::GetPoolCache(VkDevice device)
+{
+    if (!pool_caches_.empty())
     {
-        GetDeviceTable(queue_info->handle)->QueueWaitIdle(queue_info->handle);
+        auto entry = pool_caches_.find(device);
+
+        if (entry != pool_caches_.end())
+        {
+            return entry->second.get();
+        }
     }
 
-    return result;
+    return nullptr;
 }
 
-VkResult
-VulkanReplayConsumerBase::OverrideQueueBindSparse(PFN_vkQueueBindSparse                                 func,
-                                                  VkResult                                              original_result,
-                                                  const QueueInfo*                                      queue_info,
-                                                  uint32_t                                              bindInfoCount,
-                                                  const StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
-                                                  const FenceInfo*                                      fence_info)
+VkResult VulkanReplayConsumerBase::CreatePresentSwapchain(
+    const DeviceInfo*                                             device_info,
+    SwapchainKHRInfo*                                             swapchain_info,
+    const StructPointerDecoder<Decoded_VkSwapchainCreateInfoKHR>* pCreateInfo,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator)
 {
-    assert((queue_info != nullptr) && (pBindInfo != nullptr) && !pBindInfo->IsNull());
+    assert((device_info != nullptr) && (swapchain_info != nullptr) && (pCreateInfo != nullptr));
 
-    VkResult                result     = VK_SUCCESS;
-    const VkBindSparseInfo* bind_infos = pBindInfo->GetPointer();
-    VkFence                 fence      = VK_NULL_HANDLE;
+    auto copier_entry = present_image_copiers_.find(device_info->handle);
+    if (copier_entry == present_image_copiers_.end())
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
 
-    if (fence_info != nullptr)
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    auto             device_table    = GetDeviceTable(device_info->handle);
+    auto             create_info     = pCreateInfo->GetPointer();
+    auto             meta_info       = pCreateInfo->GetMetaStructPointer();
+    assert((instance_table != nullptr) && (device_table != nullptr) && (create_info != nullptr));
+
+    if (meta_info != nullptr)
     {
-        fence = fence_info->handle;
+        SetSwapchainWindowSize(meta_info);
     }
 
-    // Only attempt to filter imported semaphores if we know at least one has been imported.
-    // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
-    // tracked.
-    if ((!have_imported_semaphores_) && (options_.surface_index == -1))
+    ProcessSwapchainFullScreenExclusiveInfo(meta_info);
+
+    VkSurfaceCapabilitiesKHR surface_caps;
+    VkResult                 result =
+        instance_table->GetPhysicalDeviceSurfaceCapabilitiesKHR(physical_device, create_info->surface, &surface_caps);
+    if (result != VK_SUCCESS)
     {
-        result = func(queue_info->handle, bindInfoCount, bind_infos, fence);
+        return result;
+    }
+
+    // The images of the replay swapchain are only written by the copies.
+    if ((surface_caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to create swapchain (ID = %" PRIu64
+                           ") for the overridden present mode: the surface does not support transfer destination "
+                           "images",
+                           swapchain_info->capture_id);
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
+    uint32_t mode_count = 0;
+    instance_table->GetPhysicalDeviceSurfacePresentModesKHR(
+        physical_device, create_info->surface, &mode_count, nullptr);
+
+    std::vector<VkPresentModeKHR> present_modes(mode_count);
+    instance_table->GetPhysicalDeviceSurfacePresentModesKHR(
+        physical_device, create_info->surface, &mode_count, present_modes.data());
+
+    // Prefer the requested mode, then the other unlocked mode, and keep the captured mode when neither is supported.
+    VkPresentModeKHR requested_mode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+    VkPresentModeKHR fallback_mode  = VK_PRESENT_MODE_MAILBOX_KHR;
+    if (options_.present_mode_override == PresentModeOverride::kMailbox)
+    {
+        std::swap(requested_mode, fallback_mode);
+    }
+
+    VkSwapchainCreateInfoKHR modified_create_info = (*create_info);
+    if (std::find(present_modes.begin(), present_modes.end(), requested_mode) != present_modes.end())
+    {
+        modified_create_info.presentMode = requested_mode;
+    }
+    else if (std::find(present_modes.begin(), present_modes.end(), fallback_mode) != present_modes.end())
+    {
+        modified_create_info.presentMode = fallback_mode;
     }
     else
     {
-        // Check for imported semaphores in the current bind info list, mapping the pBindInfo array index to a vector of
-        // imported semaphore info structures.
-        std::unordered_map<uint32_t, std::vector<const SemaphoreInfo*>> altered_submits;
-        std::vector<const SemaphoreInfo*>                               removed_semaphores;
+        GFXRECON_LOG_WARNING("The surface of swapchain (ID = %" PRIu64
+                             ") does not support an unlocked present mode; the captured present mode will be used",
+                             swapchain_info->capture_id);
+    }
 
-        auto bind_info_data = pBindInfo->GetMetaStructPointer();
-        if (bind_info_data != nullptr)
+    // Mailbox replaces the queued image instead of waiting for it, which requires an image beyond the minimum for the
+    // presentation engine to hold.
+    if (modified_create_info.presentMode == VK_PRESENT_MODE_MAILBOX_KHR)
+    {
+        uint32_t image_count = std::max(create_info->minImageCount, surface_caps.minImageCount + 1);
+        if (surface_caps.maxImageCount > 0)
         {
-            for (uint32_t i = 0; i < bindInfoCount; i++)
-            {
-                GetImportedSemaphores(bind_info_data[i].pWaitSemaphores, &removed_semaphores);
-                GetShadowSemaphores(bind_info_data[i].pWaitSemaphores, &removed_semaphores);
+            image_count = std::min(image_count, surface_caps.maxImageCount);
+        }
 
-                // If rendering is restricted to a specific surface, need to track forward progress for semaphores that
-                // have been submitted with a null-swapchain.
-                TrackSemaphoreForwardProgress(bind_info_data[i].pWaitSemaphores, &removed_semaphores);
+        modified_create_info.minImageCount = image_count;
+    }
 
-                // Remove non-forward progress of signal semaphores.
-                GetNonForwardProgress(bind_info_data[i].pSignalSemaphores, &removed_semaphores);
+    modified_create_info.imageUsage   = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    modified_create_info.oldSwapchain = VK_NULL_HANDLE;
 
-                if (!removed_semaphores.empty())
-                {
-                    altered_submits[i].swap(removed_semaphores);
-                    assert(removed_semaphores.empty());
-                }
-            }
+    if (meta_info != nullptr)
+    {
+        const SwapchainKHRInfo* old_swapchain_info = object_info_table_.GetSwapchainKHRInfo(meta_info->oldSwapchain);
+        if (old_swapchain_info != nullptr)
+        {
+            modified_create_info.oldSwapchain = old_swapchain_info->present_swapchain;
         }
+    }
 
-        if (altered_submits.empty())
+    result = device_table->CreateSwapchainKHR(device_info->handle,
+                                              &modified_create_info,
+                                              GetAllocationCallbacks(pAllocator),
+                                              &swapchain_info->present_swapchain);
+
+    if (result == VK_SUCCESS)
+    {
+        result = copier_entry->second->AddSwapchain(swapchain_info->present_swapchain);
+        if (result != VK_SUCCESS)
         {
-            result = func(queue_info->handle, bindInfoCount, bind_infos, fence);
+            device_table->DestroySwapchainKHR(
+                device_info->handle, swapchain_info->present_swapchain, GetAllocationCallbacks(pAllocator));
+            swapchain_info->present_swapchain = VK_NULL_HANDLE;
         }
-        else
-        {
-            // Make shallow copies of the VkBindSparseInfo structures and change pWaitSemaphores to reference a copy of
-            // the original semaphore array with the imported semaphores omitted.
-            std::vector<VkBindSparseInfo>         modified_bind_infos(bind_infos, std::next(bind_infos, bindInfoCount));
-            std::vector<std::vector<VkSemaphore>> semaphore_memory(altered_submits.size());
+    }
 
-            std::vector<VkSemaphore> wait_semaphores;
-            std::vector<VkSemaphore> signal_semaphores;
+    return result;
+}
 
-            for (const auto& bind_iter : altered_submits)
-            {
-                // Shallow copy with filtered copy of pWaitSemaphores for bind info with imported semaphores.
-                VkBindSparseInfo& modified_bind_info = modified_bind_infos[bind_iter.first];
-                auto              semaphore_iter     = bind_iter.second.begin();
+VkResult
+VulkanReplayConsumerBase::OverrideCreateInstance(VkResult original_result,
+                                                 const StructPointerDecoder<Decoded_VkInstanceCreateInfo>*  pCreateInfo,
+                                                 const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+                                                 HandlePointerDecoder<VkInstance>*                          pInstance)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
-                for (uint32_t j = 0; j < modified_bind_info.waitSemaphoreCount; ++j)
+    assert((pInstance != nullptr) && !pInstance->IsNull() && (pInstance->GetHandlePointer() != nullptr) &&
+           (pCreateInfo != nullptr));
+
+    auto replay_create_info = pCreateInfo->GetPointer();
+    auto replay_instance    = pInstance->GetHandlePointer();
+
+    if (loader_handle_ == nullptr)
+    {
+        InitializeLoader();
+    }
+
+    // Replace WSI extension in extension list.
+    std::vector<const char*> filtered_extensions;
+    VkInstanceCreateInfo     modified_create_info{};
+
+    if (replay_create_info != nullptr)
+    {
+        // If VkDebugUtilsMessengerCreateInfoEXT or VkDebugReportCallbackCreateInfoEXT are in the pNext chain, update
+        // the callback pointers.
+        ProcessCreateInstanceDebugCallbackInfo(pCreateInfo->GetMetaStructPointer());
+
+        if (replay_create_info->ppEnabledExtensionNames)
+        {
+            // Swap the surface extension supported by platform the replay is running on if different from trace
+            for (uint32_t i = 0; i < replay_create_info->enabledExtensionCount; ++i)
+            {
+                const char* current_extension = replay_create_info->ppEnabledExtensionNames[i];
+                if (kSurfaceExtensions.find(current_extension) != kSurfaceExtensions.end())
                 {
-                    VkSemaphore semaphore = modified_bind_info.pWaitSemaphores[j];
+                    filtered_extensions.push_back(window_factory_->GetSurfaceExtensionName());
+                }
+                else
+                {
+                    filtered_extensions.push_back(current_extension);
+                }
+            }
 
-                    if ((semaphore_iter == bind_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
-                    {
-                        wait_semaphores.push_back(semaphore);
-                    }
-                    else
+            PFN_vkEnumerateInstanceExtensionProperties instance_extension_proc =
+                reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(
+                    get_instance_proc_addr_(nullptr, "vkEnumerateInstanceExtensionProperties"));
+            std::vector<VkExtensionProperties> properties;
+            if (feature_util::GetInstanceExtensions(instance_extension_proc, &properties) == VK_SUCCESS)
+            {
+                if (options_.remove_unsupported_features)
+                {
+                    // Remove enabled extensions that are not available from the replay instance.
+                    // Proc addresses that can't be used in layers so are not generated into shared dispatch table, but
+                    // are needed in the replay application.
+                    feature_util::RemoveUnsupportedExtensions(properties, &filtered_extensions);
+                }
+                else
+                {
+                    // Check that the requested extensions are present and print warnings if not.
+                    for (auto extensionIter = filtered_extensions.begin(); extensionIter != filtered_extensions.end();
+                         ++extensionIter)
                     {
-                        // Omit the ignored semaphore from the current submission.
-                        ++semaphore_iter;
+                        if (!feature_util::IsSupportedExtension(properties, *extensionIter))
+                        {
+                            GFXRECON_LOG_WARNING("Extension %s, is not supported by the replay device.",
+                                                 *extensionIter);
+                        }
                     }
                 }
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Failed to get instance extensions. Cannot perform sanity checks or filters for "
+                                     "extension availability.");
+            }
 
-                for (uint32_t j = 0; j < modified_bind_info.signalSemaphoreCount; ++j)
+            // Enable the debug utils extension for the labels that are inserted for external GPU profilers.
+            if (options_.debug_labels &&
+                feature_util::IsSupportedExtension(properties, VK_EXT_DEBUG_UTILS_EXTENSION_NAME) &&
+                (std::find_if(filtered_extensions.begin(), filtered_extensions.end(), [](const char* extension) {
+                     return (strcmp(extension, VK_EXT_DEBUG_UTILS_EXTENSION_NAME) == 0);
+                 }) == filtered_extensions.end()))
+            {
+                filtered_extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+            }
+        }
+
+        modified_create_info                         = (*replay_create_info);
+        modified_create_info.enabledExtensionCount   = static_cast<uint32_t>(filtered_extensions.size());
+        modified_create_info.ppEnabledExtensionNames = filtered_extensions.data();
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("The vkCreateInstance parameter pCreateInfo is NULL.");
+    }
+
+    // Disable layers; any layers needed for replay should be enabled for the replay app with the VK_INSTANCE_LAYERS
+    // environment variable or debug.vulkan.layers Android property.
+    if (modified_create_info.enabledLayerCount > 0)
+    {
+        GFXRECON_LOG_INFO(
+            "Replay has removed the following layers from VkInstanceCreateInfo when calling vkCreateInstance:");
+
+        for (uint32_t i = 0; i < modified_create_info.enabledLayerCount; ++i)
+        {
+            GFXRECON_LOG_INFO("\t%s", modified_create_info.ppEnabledLayerNames[i]);
+        }
+
+        modified_create_info.enabledLayerCount   = 0;
+        modified_create_info.ppEnabledLayerNames = nullptr;
+    }
+
+    // Reuse an instance with the same create parameters that was retained by the replay of a previous capture file.
+    std::string retain_key;
+    bool        retainable = (options_.retained_objects != nullptr) && (replay_create_info != nullptr) &&
+                      VulkanRetainedObjects::GetInstanceKey(&modified_create_info, &retain_key);
+
+    VkResult   result            = VK_SUCCESS;
+    VkInstance retained_instance = retainable ? options_.retained_objects->AcquireInstance(retain_key) : VK_NULL_HANDLE;
+
+    if (retained_instance != VK_NULL_HANDLE)
+    {
+        GFXRECON_LOG_INFO("Reusing the instance that was retained by the replay of a previous capture file");
+        (*replay_instance) = retained_instance;
+    }
+    else
+    {
+        graphics::StartupTimingReport::ScopedPhase phase(options_.startup_report.get(),
+                                                         graphics::StartupTimingReport::kCreateInstance);
+
+        result = create_instance_proc_(&modified_create_info, GetAllocationCallbacks(pAllocator), replay_instance);
+    }
+
+    if ((replay_instance != nullptr) && (result == VK_SUCCESS))
+    {
+        AddInstanceTable(*replay_instance);
+
+        if (retainable)
+        {
+            instance_retain_keys_[*replay_instance] = retain_key;
+        }
+
+        if (modified_create_info.pApplicationInfo != nullptr)
+        {
+            auto instance_info = reinterpret_cast<InstanceInfo*>(pInstance->GetConsumerData(0));
+            assert(instance_info != nullptr);
+
+            instance_info->api_version = modified_create_info.pApplicationInfo->apiVersion;
+            instance_info->enabled_extensions.assign(modified_create_info.ppEnabledExtensionNames,
+                                                     modified_create_info.ppEnabledExtensionNames +
+                                                         modified_create_info.enabledExtensionCount);
+        }
+
+        if (options_.debug_labels)
+        {
+            for (uint32_t i = 0; i < modified_create_info.enabledExtensionCount; ++i)
+            {
+                if (strcmp(modified_create_info.ppEnabledExtensionNames[i], VK_EXT_DEBUG_UTILS_EXTENSION_NAME) == 0)
                 {
-                    VkSemaphore semaphore = modified_bind_info.pSignalSemaphores[j];
+                    debug_labels_enabled_ = true;
+                }
+            }
 
-                    if ((semaphore_iter == bind_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
-                    {
-                        signal_semaphores.push_back(semaphore);
-                    }
-                    else
-                    {
-                        // Omit the ignored semaphore from the current submission.
-                        ++semaphore_iter;
-                    }
+            if (!debug_labels_enabled_)
+            {
+                GFXRECON_LOG_WARNING("The VK_EXT_debug_utils extension is not supported by the replay instance, so "
+                                     "debug labels will not be inserted.");
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult
+VulkanReplayConsumerBase::OverrideCreateDevice(VkResult            original_result,
+                                               PhysicalDeviceInfo* physical_device_info,
+                                               const StructPointerDecoder<Decoded_VkDeviceCreateInfo>*    pCreateInfo,
+                                               const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+                                               HandlePointerDecoder<VkDevice>*                            pDevice)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((physical_device_info != nullptr) && (pDevice != nullptr) && !pDevice->IsNull() &&
+           (pDevice->GetHandlePointer() != nullptr) && (pCreateInfo != nullptr));
+
+    SelectPhysicalDevice(physical_device_info);
+
+    VkPhysicalDevice        physical_device      = physical_device_info->handle;
+    PFN_vkGetDeviceProcAddr get_device_proc_addr = GetDeviceAddrProc(physical_device);
+    PFN_vkCreateDevice      create_device_proc   = GetCreateDeviceProc(physical_device);
+    VkResult                result               = VK_ERROR_INITIALIZATION_FAILED;
+
+    if ((get_device_proc_addr != nullptr) && (create_device_proc != nullptr))
+    {
+        auto replay_create_info = pCreateInfo->GetPointer();
+        auto replay_device      = pDevice->GetHandlePointer();
+        assert(replay_create_info != nullptr);
+        VkDeviceCreateInfo modified_create_info = (*replay_create_info);
+
+        // Make copy so list can be modified without effecting original.
+        std::vector<const char*> modified_extensions;
+        if (replay_create_info->ppEnabledExtensionNames)
+        {
+            modified_extensions.insert(
+                modified_extensions.begin(),
+                replay_create_info->ppEnabledExtensionNames,
+                std::next(replay_create_info->ppEnabledExtensionNames, replay_create_info->enabledExtensionCount));
+        }
+
+        // Enable extensions used for loading resources during initial state setup for trimmed files.
+        std::vector<std::string> extensions;
+        if (loading_trim_state_ && CheckTrimDeviceExtensions(physical_device, &extensions))
+        {
+            for (const auto& extension : extensions)
+            {
+                if (std::find(modified_extensions.begin(), modified_extensions.end(), extension) ==
+                    modified_extensions.end())
+                {
+                    modified_extensions.push_back(extension.c_str());
                 }
+            }
+        }
 
-                modified_bind_info.waitSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size());
-                modified_bind_info.pWaitSemaphores    = wait_semaphores.data();
-                modified_bind_info.waitSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size());
-                modified_bind_info.pWaitSemaphores    = signal_semaphores.data();
+        if (options_.remove_unsupported_features && (physical_device != VK_NULL_HANDLE))
+        {
+            // Remove enabled extensions that are not available from the replay device.
+            auto table = GetInstanceTable(physical_device);
+            assert(table != nullptr);
+
+            std::vector<VkExtensionProperties> properties;
+            if (feature_util::GetDeviceExtensions(
+                    physical_device, table->EnumerateDeviceExtensionProperties, &properties) == VK_SUCCESS)
+            {
+                feature_util::RemoveUnsupportedExtensions(properties, &modified_extensions);
             }
 
-            result = func(queue_info->handle,
-                          static_cast<uint32_t>(modified_bind_infos.size()),
-                          modified_bind_infos.data(),
-                          fence);
+            // Remove enabled features that are not available from the replay device.
+            feature_util::RemoveUnsupportedFeatures(physical_device,
+                                                    table->GetPhysicalDeviceFeatures,
+                                                    table->GetPhysicalDeviceFeatures2,
+                                                    modified_create_info.pNext,
+                                                    modified_create_info.pEnabledFeatures);
         }
+
+        // Submission pacing waits on timeline semaphores that are signaled after the application's submissions.
+        VkPhysicalDeviceTimelineSemaphoreFeatures timeline_features{};
+        bool                                      pace_submits     = false;
+        bool                                      use_timeline_khr = false;
+
+        if (IsSubmitPacingEnabled())
+        {
+            pace_submits = EnableTimelineSemaphores(physical_device_info,
+                                                    &modified_create_info,
+                                                    &modified_extensions,
+                                                    &timeline_features,
+                                                    &use_timeline_khr);
+
+            if (!pace_submits)
+            {
+                GFXRECON_LOG_WARNING("Timeline semaphores are not supported by the replay device; queue submissions "
+                                     "will not be paced");
+            }
+        }
+
+        modified_create_info.enabledExtensionCount   = static_cast<uint32_t>(modified_extensions.size());
+        modified_create_info.ppEnabledExtensionNames = modified_extensions.data();
+
+        graphics::VulkanDeviceUtil                device_util;
+        graphics::VulkanDevicePropertyFeatureInfo property_feature_info =
+            device_util.EnableRequiredPhysicalDeviceFeatures(physical_device_info->parent_api_version,
+                                                             GetInstanceTable(physical_device),
+                                                             physical_device,
+                                                             &modified_create_info);
+
+        // Reuse an idle device with the same create parameters that was retained by the replay of a previous capture
+        // file, which has no child objects.
+        std::string retain_key;
+        bool        retainable = (options_.retained_objects != nullptr) &&
+                          VulkanRetainedObjects::GetDeviceKey(physical_device, &modified_create_info, &retain_key);
+
+        VkDevice retained_device = retainable ? options_.retained_objects->AcquireDevice(retain_key) : VK_NULL_HANDLE;
+
+        if (retained_device != VK_NULL_HANDLE)
+        {
+            GFXRECON_LOG_INFO("Reusing the device that was retained by the replay of a previous capture file");
+            (*replay_device) = retained_device;
+            result           = VK_SUCCESS;
+        }
+        else
+        {
+            graphics::StartupTimingReport::ScopedPhase phase(options_.startup_report.get(),
+                                                             graphics::StartupTimingReport::kCreateDevice);
+
+            result = create_device_proc(
+                physical_device, &modified_create_info, GetAllocationCallbacks(pAllocator), replay_device);
+        }
+
+        if ((replay_device != nullptr) && (result == VK_SUCCESS))
+        {
+            AddDeviceTable(*replay_device, get_device_proc_addr);
+
+            if (retainable)
+            {
+                device_retain_keys_[*replay_device] = std::make_pair(retain_key, physical_device_info->parent);
+            }
+
+            auto device_info = reinterpret_cast<DeviceInfo*>(pDevice->GetConsumerData(0));
+            assert(device_info != nullptr);
+
+            device_info->extensions = std::move(extensions);
+            device_info->parent     = physical_device;
+
+            for (uint32_t i = 0; i < modified_create_info.queueCreateInfoCount; ++i)
+            {
+                device_info->queue_family_indices.push_back(
+                    modified_create_info.pQueueCreateInfos[i].queueFamilyIndex);
+            }
+
+            if (loading_trim_state_)
+            {
+                device_info->transfer_queue_family_index =
+                    GetTransferQueueFamilyIndex(physical_device, &modified_create_info);
+            }
+
+            // Create the memory allocator for the selected physical device.
+            auto replay_device_info = physical_device_info->replay_device_info;
+            assert(replay_device_info != nullptr);
+
+            if (replay_device_info->memory_properties == nullptr)
+            {
+                // Memory properties weren't queried before device creation, so retrieve them now.
+                auto table = GetInstanceTable(physical_device);
+                assert(table != nullptr);
+
+                replay_device_info->memory_properties = std::make_unique<VkPhysicalDeviceMemoryProperties>();
+                table->GetPhysicalDeviceMemoryProperties(physical_device, replay_device_info->memory_properties.get());
+            }
+
+            auto allocator = options_.create_resource_allocator();
+
+            std::vector<std::string> enabled_extensions(modified_create_info.ppEnabledExtensionNames,
+                                                        modified_create_info.ppEnabledExtensionNames +
+                                                            modified_create_info.enabledExtensionCount);
+            InitializeResourceAllocator(physical_device_info, *replay_device, enabled_extensions, allocator);
+
+            device_info->allocator = std::unique_ptr<VulkanResourceAllocator>(allocator);
+
+            // Track state of physical device properties and features at device creation
+            device_info->property_feature_info = property_feature_info;
+
+            if (!options_.pipeline_cache_file_prefix.empty())
+            {
+                CreateReplayPipelineCache(device_info);
+            }
+
+            if (options_.warm_up_pipelines != nullptr)
+            {
+                CreateWarmUpShaderModules(device_info);
+            }
+
+            if (timing_report_ != nullptr)
+            {
+                CreateSubmitTimer(device_info, &modified_create_info);
+            }
+
+            if (pass_timing_report_ != nullptr)
+            {
+                CreatePassTimer(device_info, &modified_create_info);
+            }
+
+            if (pace_submits)
+            {
+                CreateSubmitPacer(device_info, &modified_create_info, use_timeline_khr);
+            }
+
+            if (options_.remap_device_addresses)
+            {
+                CreateAddressPatcher(device_info, &modified_create_info);
+            }
+
+            if (!options_.accel_struct_cache_capture_file.empty())
+            {
+                CreateAccelStructCache(device_info, &modified_create_info);
+            }
+
+            if (options_.present_mode_override != PresentModeOverride::kNone)
+            {
+                CreatePresentImageCopier(device_info, &modified_create_info);
+            }
+
+            if (options_.recycle_pools)
+            {
+                pool_caches_[device_info->handle] =
+                    std::make_unique<VulkanPoolCache>(device_info->handle, GetDeviceTable(device_info->handle));
+            }
+        }
+
+        // Restore modified property/feature create info values to the original application values
+        device_util.RestoreModifiedPhysicalDeviceFeatures();
+    }
+
+    return result;
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyDevice(
+    PFN_vkDestroyDevice                                        func,
+    const DeviceInfo*                                          device_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    VkDevice device = VK_NULL_HANDLE;
+
+    WaitForAsyncPipelineCreation();
+
+    if (device_info != nullptr)
+    {
+        device = device_info->handle;
+
+        CompleteSwapchainImageInits(device);
+        DestroyWarmUpObjects(device_info);
+        SaveReplayPipelineCache(device_info);
+        ApplyPendingMemoryFills();
+
+        auto timer_entry = submit_timers_.find(device);
+        if (timer_entry != submit_timers_.end())
+        {
+            AddGpuFrameTimes(timer_entry->second.get(), true);
+            submit_timers_.erase(timer_entry);
+        }
+
+        auto pass_timer_entry = pass_timers_.find(device);
+        if (pass_timer_entry != pass_timers_.end())
+        {
+            AddGpuPassTimes(pass_timer_entry->second.get(), true);
+            pass_timers_.erase(pass_timer_entry);
+        }
+
+        submit_pacers_.erase(device);
+        address_patchers_.erase(device);
+        accel_struct_caches_.erase(device);
+        present_image_copiers_.erase(device);
+        pool_caches_.erase(device);
+
+        if (screenshot_handler_ != nullptr)
+        {
+            screenshot_handler_->DestroyDeviceResources(device, GetDeviceTable(device));
+        }
+
+        if (options_.memory_report != nullptr)
+        {
+            options_.memory_report->ClearDeviceUsage(device_info->capture_id);
+        }
+
+        frame_loop_states_.erase(device);
+
+        device_info->allocator->Destroy();
+
+        if (RetainDevice(device_info))
+        {
+            return;
+        }
+    }
+
+    func(device, GetAllocationCallbacks(pAllocator));
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyInstance(
+    PFN_vkDestroyInstance                                      func,
+    const InstanceInfo*                                        instance_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    VkInstance instance = VK_NULL_HANDLE;
+
+    if (instance_info != nullptr)
+    {
+        instance = instance_info->handle;
+
+        if (RetainInstance(instance_info))
+        {
+            return;
+        }
+    }
+
+    func(instance, GetAllocationCallbacks(pAllocator));
+}
+
+VkResult
+VulkanReplayConsumerBase::OverrideEnumeratePhysicalDevices(PFN_vkEnumeratePhysicalDevices          func,
+                                                           VkResult                                original_result,
+                                                           InstanceInfo*                           instance_info,
+                                                           PointerDecoder<uint32_t>*               pPhysicalDeviceCount,
+                                                           HandlePointerDecoder<VkPhysicalDevice>* pPhysicalDevices)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((instance_info != nullptr) && (pPhysicalDeviceCount != nullptr) && !pPhysicalDeviceCount->IsNull() &&
+           (pPhysicalDeviceCount->GetOutputPointer() != nullptr) && (pPhysicalDevices != nullptr));
+
+    VkInstance        instance                = instance_info->handle;
+    uint32_t*         replay_device_count_ptr = pPhysicalDeviceCount->GetOutputPointer();
+    VkPhysicalDevice* replay_devices          = pPhysicalDevices->GetHandlePointer();
+
+    VkResult result = func(instance, replay_device_count_ptr, replay_devices);
+
+    if ((result >= 0) && (replay_devices != nullptr))
+    {
+        assert(!pPhysicalDevices->IsNull());
+
+        uint32_t                replay_device_count  = (*replay_device_count_ptr);
+        uint32_t                capture_device_count = (*pPhysicalDeviceCount->GetPointer());
+        const format::HandleId* capture_devices      = pPhysicalDevices->GetPointer();
+
+        SetInstancePhysicalDeviceEntries(
+            instance_info, capture_device_count, capture_devices, replay_device_count, replay_devices);
+
+        for (uint32_t i = 0; i < replay_device_count; ++i)
+        {
+            auto physical_device_info = reinterpret_cast<PhysicalDeviceInfo*>(pPhysicalDevices->GetConsumerData(i));
+            assert(physical_device_info != nullptr);
+
+            SetPhysicalDeviceInstanceInfo(instance_info, physical_device_info, replay_devices[i]);
+        }
+
+        if ((replay_device_count > 0) && (replay_device_count < capture_device_count))
+        {
+            // Make sure all of the capture physical device IDs map to a valid replay physical device handle.
+            // The generated code will only add handle mappings for handles returned by vkEnumeratePhysicalDevices on
+            // replay, so we add mappings for the handle IDs without matching devices here.
+            VkPhysicalDevice overflow_device = replay_devices[0];
+
+            for (uint32_t i = replay_device_count; i < capture_device_count; ++i)
+            {
+                PhysicalDeviceInfo overflow_info;
+
+                overflow_info.handle     = overflow_device;
+                overflow_info.capture_id = capture_devices[i];
+                overflow_info.parent_id  = instance_info->capture_id;
+                SetPhysicalDeviceInstanceInfo(instance_info, &overflow_info, overflow_device);
+
+                object_info_table_.AddPhysicalDeviceInfo(std::move(overflow_info));
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideEnumeratePhysicalDeviceGroups(
+    PFN_vkEnumeratePhysicalDeviceGroups                            func,
+    VkResult                                                       original_result,
+    InstanceInfo*                                                  instance_info,
+    PointerDecoder<uint32_t>*                                      pPhysicalDeviceGroupCount,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((instance_info != nullptr) && (pPhysicalDeviceGroupCount != nullptr) &&
+           !pPhysicalDeviceGroupCount->IsNull() && (pPhysicalDeviceGroupCount->GetOutputPointer() != nullptr) &&
+           (pPhysicalDeviceGroupProperties != nullptr));
+
+    VkInstance                       instance                      = instance_info->handle;
+    uint32_t*                        replay_device_group_count_ptr = pPhysicalDeviceGroupCount->GetOutputPointer();
+    VkPhysicalDeviceGroupProperties* replay_device_groups          = pPhysicalDeviceGroupProperties->GetOutputPointer();
+
+    VkResult result = func(instance, replay_device_group_count_ptr, replay_device_groups);
+
+    if ((result >= 0) && (replay_device_groups != nullptr))
+    {
+        assert(!pPhysicalDeviceGroupProperties->IsNull() &&
+               (pPhysicalDeviceGroupProperties->GetLength() == (*pPhysicalDeviceGroupCount->GetPointer())));
+
+        const Decoded_VkPhysicalDeviceGroupProperties* meta_info =
+            pPhysicalDeviceGroupProperties->GetMetaStructPointer();
+        size_t capture_device_group_count = pPhysicalDeviceGroupProperties->GetLength();
+        size_t replay_device_group_count  = (*replay_device_group_count_ptr);
+
+        // Merge the arrays of physical device capture IDs and replay handles from the individual
+        // VkPhysicalDeviceGroupProperties array entries into a single data set.
+        std::unordered_map<format::HandleId, VkPhysicalDevice> physical_devices;
+        std::unordered_set<VkPhysicalDevice>                   overflow_replay_devices;
+
+        auto device_group_count = std::max(capture_device_group_count, replay_device_group_count);
+
+        // Build a map of captured physical device IDs to physical device handles retrieved at replay.
+        for (size_t i = 0; i < device_group_count; ++i)
+        {
+            size_t                  capture_device_count = 0;
+            const format::HandleId* capture_devices      = nullptr;
+            size_t                  replay_device_count  = 0;
+            const VkPhysicalDevice* replay_devices       = nullptr;
+
+            if (i < capture_device_group_count)
+            {
+                capture_device_count = meta_info[i].physicalDevices.GetLength();
+                capture_devices      = meta_info[i].physicalDevices.GetPointer();
+            }
+
+            if (i < replay_device_group_count)
+            {
+                replay_device_count = replay_device_groups[i].physicalDeviceCount;
+                replay_devices      = replay_device_groups[i].physicalDevices;
+            }
+
+            auto device_count = std::max(capture_device_count, replay_device_count);
+
+            for (size_t j = 0; j < device_count; ++j)
+            {
+                format::HandleId capture_device = format::kNullHandleId;
+                VkPhysicalDevice replay_device  = VK_NULL_HANDLE;
+
+                if (j < capture_device_count)
+                {
+                    capture_device = capture_devices[j];
+                }
+
+                if (j < replay_device_count)
+                {
+                    replay_device = replay_devices[j];
+                }
+
+                if (capture_device != format::kNullHandleId)
+                {
+                    physical_devices[capture_device] = replay_device;
+                }
+                else
+                {
+                    overflow_replay_devices.insert(replay_device);
+                }
+            }
+        }
+
+        // Build lists of capture physical device IDs and replay physical device handles, inserting ID/handle values at
+        // matching indexes at the start of the lists, with unpaired values appended to the end.
+        std::vector<format::HandleId> capture_devices;
+        std::vector<VkPhysicalDevice> replay_devices;
+
+        for (const auto& entry : physical_devices)
+        {
+            capture_devices.push_back(entry.first);
+
+            if (entry.second != VK_NULL_HANDLE)
+            {
+                replay_devices.push_back(entry.second);
+
+                // There is currently no way to provide pre-initialized info data for a newly created handle that is a
+                // member of a struct, so we insert the handle here.  The generated code will also perform a handle
+                // insertion, which will be ignored.
+                PhysicalDeviceInfo physical_device_info;
+
+                physical_device_info.handle     = entry.second;
+                physical_device_info.capture_id = entry.first;
+                physical_device_info.parent_id  = instance_info->capture_id;
+                SetPhysicalDeviceInstanceInfo(instance_info, &physical_device_info, entry.second);
+
+                object_info_table_.AddPhysicalDeviceInfo(std::move(physical_device_info));
+            }
+        }
+
+        replay_devices.insert(replay_devices.end(), overflow_replay_devices.begin(), overflow_replay_devices.end());
+
+        SetInstancePhysicalDeviceEntries(instance_info,
+                                         capture_devices.size(),
+                                         capture_devices.data(),
+                                         replay_devices.size(),
+                                         replay_devices.data());
+
+        if ((!replay_devices.empty()) && (replay_devices.size() < capture_devices.size()))
+        {
+            // Make sure all of the capture physical device IDs map to a valid replay physical device handle.
+            // The generated code will only add handle mappings for handles returned by vkEnumeratePhysicalDevices on
+            // replay, so we add mappings for the handle IDs without matching devices here.
+            VkPhysicalDevice overflow_device = replay_devices[0];
+
+            for (size_t i = replay_devices.size(); i < capture_devices.size(); ++i)
+            {
+                PhysicalDeviceInfo overflow_info;
+
+                overflow_info.handle     = overflow_device;
+                overflow_info.capture_id = capture_devices[i];
+                overflow_info.parent_id  = instance_info->capture_id;
+                SetPhysicalDeviceInstanceInfo(instance_info, &overflow_info, overflow_device);
+
+                object_info_table_.AddPhysicalDeviceInfo(std::move(overflow_info));
+            }
+        }
+    }
+
+    return result;
+}
+
+void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceProperties(
+    PFN_vkGetPhysicalDeviceProperties                         func,
+    PhysicalDeviceInfo*                                       physical_device_info,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((physical_device_info != nullptr) && (pProperties != nullptr) && !pProperties->IsNull() &&
+           (pProperties->GetOutputPointer() != nullptr));
+
+    VkPhysicalDevice physical_device   = physical_device_info->handle;
+    auto             replay_properties = pProperties->GetOutputPointer();
+
+    func(physical_device, replay_properties);
+
+    // This can be set by ProcessSetDevicePropertiesCommand, but older files will not contain that data.
+    SetPhysicalDeviceProperties(physical_device_info, pProperties->GetPointer(), replay_properties);
+}
+
+void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceProperties2(
+    PFN_vkGetPhysicalDeviceProperties2                         func,
+    PhysicalDeviceInfo*                                        physical_device_info,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((physical_device_info != nullptr) && (pProperties != nullptr) && !pProperties->IsNull() &&
+           (pProperties->GetOutputPointer() != nullptr));
+
+    VkPhysicalDevice physical_device   = physical_device_info->handle;
+    auto             replay_properties = pProperties->GetOutputPointer();
+
+    func(physical_device, replay_properties);
+
+    // This can be set by ProcessSetDevicePropertiesCommand, but older files will not contain that data.
+    auto capture_properties = pProperties->GetPointer();
+    SetPhysicalDeviceProperties(physical_device_info, &capture_properties->properties, &replay_properties->properties);
+}
+
+void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceMemoryProperties(
+    PFN_vkGetPhysicalDeviceMemoryProperties                         func,
+    PhysicalDeviceInfo*                                             physical_device_info,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((physical_device_info != nullptr) && (pMemoryProperties != nullptr) && !pMemoryProperties->IsNull() &&
+           (pMemoryProperties->GetOutputPointer() != nullptr));
+
+    VkPhysicalDevice physical_device   = physical_device_info->handle;
+    auto             replay_properties = pMemoryProperties->GetOutputPointer();
+
+    func(physical_device, replay_properties);
+
+    // This can be set by ProcessSetDeviceMemoryPropertiesCommand, but older files will not contain that data.
+    SetPhysicalDeviceMemoryProperties(physical_device_info, pMemoryProperties->GetPointer(), replay_properties);
+}
+
+void VulkanReplayConsumerBase::OverrideGetPhysicalDeviceMemoryProperties2(
+    PFN_vkGetPhysicalDeviceMemoryProperties2                         func,
+    PhysicalDeviceInfo*                                              physical_device_info,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((physical_device_info != nullptr) && (pMemoryProperties != nullptr) && !pMemoryProperties->IsNull() &&
+           (pMemoryProperties->GetOutputPointer() != nullptr));
+
+    VkPhysicalDevice physical_device   = physical_device_info->handle;
+    auto             replay_properties = pMemoryProperties->GetOutputPointer();
+
+    func(physical_device, replay_properties);
+
+    // This can be set by ProcessSetDeviceMemoryPropertiesCommand, but older files will not contain that data.
+    auto capture_properties = pMemoryProperties->GetPointer();
+    SetPhysicalDeviceMemoryProperties(
+        physical_device_info, &capture_properties->memoryProperties, &replay_properties->memoryProperties);
+}
+
+VkResult VulkanReplayConsumerBase::OverrideResetFences(PFN_vkResetFences                    func,
+                                                       VkResult                             original_result,
+                                                       const DeviceInfo*                    device_info,
+                                                       uint32_t                             fenceCount,
+                                                       const HandlePointerDecoder<VkFence>* pFences)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (pFences != nullptr));
+
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    if (options_.collapse_polling)
+    {
+        const format::HandleId* fence_handles = pFences->GetPointer();
+        for (size_t i = 0; i < pFences->GetLength(); ++i)
+        {
+            FenceInfo* fence_info = object_info_table_.GetFenceInfo(fence_handles[i]);
+            if (fence_info != nullptr)
+            {
+                fence_info->replay_signaled = false;
+            }
+        }
+    }
+
+    return func(device_info->handle, fenceCount, pFences->GetHandlePointer());
+}
+
+VkResult VulkanReplayConsumerBase::OverrideWaitForFences(PFN_vkWaitForFences                  func,
+                                                         VkResult                             original_result,
+                                                         const DeviceInfo*                    device_info,
+                                                         uint32_t                             fenceCount,
+                                                         const HandlePointerDecoder<VkFence>* pFences,
+                                                         VkBool32                             waitAll,
+                                                         uint64_t                             timeout)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (pFences != nullptr));
+
+    VkResult       result               = VK_SUCCESS;
+    VkDevice       device               = device_info->handle;
+    uint32_t       modified_fence_count = fenceCount;
+    const VkFence* modified_fences      = nullptr;
+    FenceInfo**    valid_fence_infos    = nullptr;
+    uint32_t       valid_fence_count    = 0;
+    bool           found_signaled       = false;
+
+    // Check for fences that need to be removed.
+    if (shadow_fences_.empty() && !options_.collapse_polling)
+    {
+        modified_fences = pFences->GetHandlePointer();
+    }
+    else
+    {
+        // The fences that are waited on are gathered in memory from the call's decode allocator scope, as this path is
+        // taken for every wait when polling is collapsed.
+        const format::HandleId* fence_handles = pFences->GetPointer();
+        VkFence*                valid_fences  = DecodeAllocator::Allocate<VkFence>(pFences->GetLength(), false);
+        valid_fence_infos                     = DecodeAllocator::Allocate<FenceInfo*>(pFences->GetLength(), false);
+
+        for (size_t i = 0; i < pFences->GetLength(); ++i)
+        {
+            FenceInfo* fence_info = object_info_table_.GetFenceInfo(fence_handles[i]);
+            if (fence_info != nullptr)
+            {
+                VkFence fence_handle = fence_info->handle;
+                if (fence_info->shadow_signaled)
+                {
+                    // If found, unsignal the fence to represent it being used.
+                    fence_info->shadow_signaled = false;
+                    shadow_fences_.erase(fence_handle);
+                }
+                else if (fence_info->replay_signaled)
+                {
+                    // The fence is already known to be signaled, so there is no need to wait on it again.
+                    found_signaled = true;
+                }
+                else
+                {
+                    valid_fences[valid_fence_count]      = fence_handle;
+                    valid_fence_infos[valid_fence_count] = fence_info;
+                    ++valid_fence_count;
+                }
+            }
+        }
+
+        modified_fence_count = valid_fence_count;
+        modified_fences      = valid_fences;
+    }
+
+    if (options_.collapse_polling)
+    {
+        if ((modified_fence_count == 0) || (found_signaled && (waitAll == VK_FALSE)))
+        {
+            // The wait is already satisfied by fences that replay has seen signaled.
+            return VK_SUCCESS;
+        }
+        else if (original_result == VK_TIMEOUT)
+        {
+            // The fences were not signaled when this wait timed out during capture.  Skip the poll, deferring the wait
+            // to the call that found the fences signaled during capture.
+            return VK_TIMEOUT;
+        }
+    }
+
+    if (original_result == VK_SUCCESS)
+    {
+        // Ensure that wait for fences waits until the fences have been signaled (or error occurs) by changing the
+        // timeout to UINT64_MAX.
+        result = func(device, modified_fence_count, modified_fences, waitAll, std::numeric_limits<uint64_t>::max());
+    }
+    else if (original_result == VK_TIMEOUT)
+    {
+        // Try to get a timeout result with a 0 timeout.
+        result = func(device, modified_fence_count, modified_fences, waitAll, 0);
+    }
+    else
+    {
+        result = func(device, modified_fence_count, modified_fences, waitAll, timeout);
+    }
+
+    if (options_.collapse_polling && (result == VK_SUCCESS) && ((waitAll == VK_TRUE) || (modified_fence_count == 1)))
+    {
+        for (uint32_t i = 0; i < valid_fence_count; ++i)
+        {
+            valid_fence_infos[i]->replay_signaled = true;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideGetFenceStatus(PFN_vkGetFenceStatus func,
+                                                          VkResult             original_result,
+                                                          const DeviceInfo*    device_info,
+                                                          FenceInfo*           fence_info)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (fence_info != nullptr));
+
+    VkResult result;
+    VkDevice device = device_info->handle;
+    VkFence  fence  = fence_info->handle;
+
+    if (options_.collapse_polling)
+    {
+        if (fence_info->replay_signaled)
+        {
+            return VK_SUCCESS;
+        }
+        else if (original_result == VK_NOT_READY)
+        {
+            // Skip polls that did not find the fence signaled during capture, issuing a single wait for the poll that
+            // did.
+            return VK_NOT_READY;
+        }
+        else if (original_result == VK_SUCCESS)
+        {
+            auto table = GetDeviceTable(device);
+            assert(table != nullptr);
+
+            result = table->WaitForFences(device, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+            if (result == VK_SUCCESS)
+            {
+                fence_info->replay_signaled = true;
+            }
+
+            return result;
+        }
+    }
+
+    // If you find this loop to be infinite consider adding a limit in the same way
+    // it is done for GetEventStatus and GetQueryPoolResults.
+    do
+    {
+        result = func(device, fence);
+    } while ((original_result == VK_SUCCESS) && (result == VK_NOT_READY));
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideGetEventStatus(PFN_vkGetEventStatus func,
+                                                          VkResult             original_result,
+                                                          const DeviceInfo*    device_info,
+                                                          const EventInfo*     event_info)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (event_info != nullptr));
+
+    VkResult result;
+    VkDevice device = device_info->handle;
+    VkEvent  event  = event_info->handle;
+    size_t   retries = 0;
+
+    do
+    {
+        result = func(device, event);
+    } while ((((original_result == VK_EVENT_SET) && (result == VK_EVENT_RESET)) ||
+              ((original_result == VK_EVENT_RESET) && (result == VK_EVENT_SET))) &&
+             (++retries <= kMaxEventStatusRetries));
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideGetQueryPoolResults(PFN_vkGetQueryPoolResults func,
+                                                               VkResult                  original_result,
+                                                               const DeviceInfo*         device_info,
+                                                               const QueryPoolInfo*      query_pool_info,
+                                                               uint32_t                  firstQuery,
+                                                               uint32_t                  queryCount,
+                                                               size_t                    dataSize,
+                                                               PointerDecoder<uint8_t>*  pData,
+                                                               VkDeviceSize              stride,
+                                                               VkQueryResultFlags        flags)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (query_pool_info != nullptr) && (pData != nullptr) &&
+           (pData->GetOutputPointer() != nullptr));
+
+    VkResult    result;
+    VkDevice    device     = device_info->handle;
+    VkQueryPool query_pool = query_pool_info->handle;
+    size_t      retries    = 0;
+
+    if (options_.collapse_polling && ((flags & VK_QUERY_RESULT_WAIT_BIT) != VK_QUERY_RESULT_WAIT_BIT))
+    {
+        if (original_result == VK_NOT_READY)
+        {
+            // Skip polls that did not find the results available during capture, issuing a single waiting query for
+            // the poll that did.
+            return VK_NOT_READY;
+        }
+        else if (original_result == VK_SUCCESS)
+        {
+            return func(device,
+                        query_pool,
+                        firstQuery,
+                        queryCount,
+                        dataSize,
+                        pData->GetOutputPointer(),
+                        stride,
+                        flags | VK_QUERY_RESULT_WAIT_BIT);
+        }
+    }
+
+    do
+    {
+        result = func(device, query_pool, firstQuery, queryCount, dataSize, pData->GetOutputPointer(), stride, flags);
+    } while ((((original_result == VK_SUCCESS) && (result == VK_NOT_READY)) ||
+              ((original_result == VK_NOT_READY) && (result == VK_SUCCESS))) &&
+             (++retries <= kMaxQueryPoolResultsRetries));
+
+    return result;
+}
+
+void VulkanReplayConsumerBase::CheckIncompleteCommandBuffers(
+    const HandlePointerDecoder<VkCommandBuffer>& command_buffers)
+{
+    const format::HandleId* command_buffer_ids = command_buffers.GetPointer();
+
+    if (command_buffer_ids != nullptr)
+    {
+        for (size_t i = 0; i < command_buffers.GetLength(); ++i)
+        {
+            // Each command buffer is only reported once.
+            if (incomplete_command_buffers_.erase(command_buffer_ids[i]) != 0)
+            {
+                GFXRECON_LOG_WARNING("Command buffer (ID = %" PRIu64
+                                     ") was recorded before the fast forward target frame and is submitted again "
+                                     "without its draw, dispatch, and trace rays commands",
+                                     command_buffer_ids[i]);
+            }
+        }
+    }
+}
+
+bool VulkanReplayConsumerBase::GetCachedDescriptors(DescriptorSetInfo*                set_info,
+                                                    uint32_t                          binding,
+                                                    uint32_t                          array_element,
+                                                    uint32_t                          descriptor_count,
+                                                    std::vector<DescriptorContents*>* descriptors)
+{
+    assert((set_info != nullptr) && (descriptors != nullptr));
+
+    auto entry = set_info->descriptors.find(binding);
+
+    while (descriptor_count > 0)
+    {
+        if (entry == set_info->descriptors.end())
+        {
+            return false;
+        }
+
+        // Updates that extend past the end of a binding continue with the first descriptor of the next binding.
+        // Bindings without descriptors are skipped.
+        std::vector<DescriptorContents>& binding_descriptors = entry->second;
+
+        while ((array_element < binding_descriptors.size()) && (descriptor_count > 0))
+        {
+            descriptors->push_back(&binding_descriptors[array_element]);
+            ++array_element;
+            --descriptor_count;
+        }
+
+        array_element -= static_cast<uint32_t>(binding_descriptors.size());
+        ++entry;
+    }
+
+    return true;
+}
+
+bool VulkanReplayConsumerBase::IsRedundantDescriptorWrite(const Decoded_VkWriteDescriptorSet* write)
+{
+    assert((write != nullptr) && (write->decoded_value != nullptr));
+
+    const VkWriteDescriptorSet* value    = write->decoded_value;
+    DescriptorSetInfo*          set_info = object_info_table_.GetDescriptorSetInfo(write->dstSet);
+
+    if ((set_info == nullptr) || set_info->descriptors.empty())
+    {
+        return false;
+    }
+
+    // The write replaces part of the contents of the last template update, which can no longer be repeated.
+    set_info->update_template_id = format::kNullHandleId;
+    set_info->update_template_data.clear();
+
+    std::vector<DescriptorContents*> descriptors;
+
+    if (!GetCachedDescriptors(
+            set_info, value->dstBinding, value->dstArrayElement, value->descriptorCount, &descriptors))
+    {
+        InvalidateCachedDescriptors(set_info);
+        return false;
+    }
+
+    // Only writes without extension structures are cached.  Writes of other descriptor types, such as inline uniform
+    // blocks and acceleration structures, leave the contents of their descriptors unknown.
+    std::vector<DescriptorContents> contents(descriptors.size());
+    bool                            cacheable = (write->pNext == nullptr);
+
+    switch (value->descriptorType)
+    {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            cacheable = cacheable && (write->pImageInfo != nullptr) &&
+                        (write->pImageInfo->GetLength() >= contents.size()) &&
+                        (write->pImageInfo->GetMetaStructPointer() != nullptr);
+
+            for (size_t i = 0; cacheable && (i < contents.size()); ++i)
+            {
+                const Decoded_VkDescriptorImageInfo& image_info = write->pImageInfo->GetMetaStructPointer()[i];
+
+                contents[i].sampler_id   = image_info.sampler;
+                contents[i].object_id    = image_info.imageView;
+                contents[i].image_layout = image_info.decoded_value->imageLayout;
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            cacheable = cacheable && (write->pBufferInfo != nullptr) &&
+                        (write->pBufferInfo->GetLength() >= contents.size()) &&
+                        (write->pBufferInfo->GetMetaStructPointer() != nullptr);
+
+            for (size_t i = 0; cacheable && (i < contents.size()); ++i)
+            {
+                const Decoded_VkDescriptorBufferInfo& buffer_info = write->pBufferInfo->GetMetaStructPointer()[i];
+
+                contents[i].object_id = buffer_info.buffer;
+                contents[i].offset    = buffer_info.decoded_value->offset;
+                contents[i].range     = buffer_info.decoded_value->range;
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            cacheable = cacheable && (write->pTexelBufferView.GetLength() >= contents.size()) &&
+                        (write->pTexelBufferView.GetPointer() != nullptr);
+
+            for (size_t i = 0; cacheable && (i < contents.size()); ++i)
+            {
+                contents[i].object_id = write->pTexelBufferView.GetPointer()[i];
+            }
+            break;
+        default:
+            cacheable = false;
+            break;
+    }
+
+    bool redundant = cacheable;
+
+    for (size_t i = 0; i < contents.size(); ++i)
+    {
+        if (cacheable)
+        {
+            contents[i].type = value->descriptorType;
+        }
+        else
+        {
+            contents[i] = DescriptorContents{};
+        }
+
+        redundant = redundant && IsSameDescriptor(*descriptors[i], contents[i]);
+    }
+
+    if (!redundant)
+    {
+        for (size_t i = 0; i < contents.size(); ++i)
+        {
+            (*descriptors[i]) = contents[i];
+        }
+    }
+
+    return redundant;
+}
+
+bool VulkanReplayConsumerBase::IsRedundantTemplateUpdate(format::HandleId                       descriptor_set,
+                                                         format::HandleId                       update_template,
+                                                         const DescriptorUpdateTemplateDecoder* decoder)
+{
+    assert(decoder != nullptr);
+
+    DescriptorSetInfo* set_info = object_info_table_.GetDescriptorSetInfo(descriptor_set);
+
+    if ((set_info == nullptr) || (update_template == format::kNullHandleId))
+    {
+        return false;
+    }
+
+    // The update is identified by the capture IDs of the objects that it references and the values that accompany
+    // them, in the order that they were written to the capture file.
+    std::vector<uint64_t> data;
+
+    const Decoded_VkDescriptorImageInfo* image_infos = decoder->GetImageInfoMetaStructPointer();
+    for (size_t i = 0; (image_infos != nullptr) && (i < decoder->GetImageInfoCount()); ++i)
+    {
+        data.push_back(image_infos[i].sampler);
+        data.push_back(image_infos[i].imageView);
+        data.push_back(image_infos[i].decoded_value->imageLayout);
+    }
+
+    const Decoded_VkDescriptorBufferInfo* buffer_infos = decoder->GetBufferInfoMetaStructPointer();
+    for (size_t i = 0; (buffer_infos != nullptr) && (i < decoder->GetBufferInfoCount()); ++i)
+    {
+        data.push_back(buffer_infos[i].buffer);
+        data.push_back(buffer_infos[i].decoded_value->offset);
+        data.push_back(buffer_infos[i].decoded_value->range);
+    }
+
+    const format::HandleId* texel_buffer_view_ids = decoder->GetTexelBufferViewHandleIdsPointer();
+    if (texel_buffer_view_ids != nullptr)
+    {
+        data.insert(data.end(), texel_buffer_view_ids, texel_buffer_view_ids + decoder->GetTexelBufferViewCount());
+    }
+
+    const format::HandleId* acceleration_structure_ids = decoder->GetAccelerationStructureKHRHandleIdsPointer();
+    if (acceleration_structure_ids != nullptr)
+    {
+        data.insert(data.end(),
+                    acceleration_structure_ids,
+                    acceleration_structure_ids + decoder->GetAccelerationStructureKHRCount());
+    }
+
+    if ((set_info->update_template_id == update_template) && (set_info->update_template_data == data))
+    {
+        return true;
+    }
+
+    // The descriptors written by the template are not tracked individually, so the contents cached for
+    // vkUpdateDescriptorSets are unknown after the update.
+    InvalidateCachedDescriptors(set_info);
+
+    set_info->update_template_id   = update_template;
+    set_info->update_template_data = std::move(data);
+
+    return false;
+}
+
+bool VulkanReplayConsumerBase::CanBatchSubmit(uint32_t submit_count, const VkSubmitInfo* submits) const
+{
+    return !have_imported_semaphores_ && !HasDummySwapchains() && incomplete_command_buffers_.empty() &&
+           submit_pacers_.empty() && address_patchers_.empty() && accel_struct_caches_.empty() &&
+           !debug_labels_enabled_ && !options_.sync_queue_submissions &&
+           ((timing_report_ == nullptr) || !timing_report_->IsReportFrame(timing_frame_number_)) &&
+           ((pass_timing_report_ == nullptr) || !pass_timing_report_->IsReportFrame(timing_frame_number_)) &&
+           VulkanSubmitBatcher::CanBatch(submit_count, submits);
+}
+
+void VulkanReplayConsumerBase::FlushSubmitBatch()
+{
+    if ((submit_batcher_ != nullptr) && submit_batcher_->HasPendingSubmits())
+    {
+        VkResult result = submit_batcher_->Flush();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Batched vkQueueSubmit failed (%s)", enumutil::GetResultValueString(result));
+        }
+    }
+}
+
+VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit func,
+                                                       VkResult          original_result,
+                                                       const QueueInfo*  queue_info,
+                                                       uint32_t          submitCount,
+                                                       const StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
+                                                       const FenceInfo*                                  fence_info)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((queue_info != nullptr) && (pSubmits != nullptr));
+
+    // Memory fills recorded before the submission need to be visible to its commands.
+    ApplyPendingMemoryFills();
+
+    VkResult            result       = VK_SUCCESS;
+    const VkSubmitInfo* submit_infos = pSubmits->GetPointer();
+    assert(submit_infos != nullptr);
+
+    if (submit_batcher_ != nullptr)
+    {
+        if (CanBatchSubmit(submitCount, submit_infos))
+        {
+            return submit_batcher_->Add(func,
+                                        queue_info->handle,
+                                        submitCount,
+                                        submit_infos,
+                                        (fence_info != nullptr) ? fence_info->handle : VK_NULL_HANDLE);
+        }
+
+        // Submissions that are not batched follow the submissions that were batched before them.
+        FlushSubmitBatch();
+    }
+
+    // The acceleration structure instances read by the builds of the submission are patched with replay addresses, and
+    // the shader binding tables read by its trace rays commands with replay shader group handles, ahead of the
+    // submission.
+    VulkanAddressPatcher* patcher = GetAddressPatcher(queue_info->parent_id);
+    if (patcher != nullptr)
+    {
+        VkResult patch_result = patcher->PatchSubmission(queue_info->handle, submitCount, submit_infos);
+
+        if (patch_result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR_ONCE("Failed to patch acceleration structure instances and shader binding tables for "
+                                    "replay (%s), so replay may fail.",
+                                    enumutil::GetResultValueString(patch_result));
+        }
+    }
+    auto    submit_info_data = pSubmits->GetMetaStructPointer();
+    VkFence fence            = VK_NULL_HANDLE;
+
+    if (!incomplete_command_buffers_.empty() && (submit_info_data != nullptr))
+    {
+        for (uint32_t i = 0; i < submitCount; ++i)
+        {
+            CheckIncompleteCommandBuffers(submit_info_data[i].pCommandBuffers);
+        }
+    }
+
+    if (fence_info != nullptr)
+    {
+        fence = fence_info->handle;
+    }
+
+    // Submissions that belong to a frame in the timing report are timed on the GPU.
+    VulkanSubmitTimer* submit_timer = nullptr;
+
+    if ((timing_report_ != nullptr) && timing_report_->IsReportFrame(timing_frame_number_))
+    {
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(queue_info->parent_id);
+
+        if (device_info != nullptr)
+        {
+            auto entry = submit_timers_.find(device_info->handle);
+
+            if ((entry != submit_timers_.end()) && entry->second->BeginSubmit(queue_info->handle, timing_frame_number_))
+            {
+                submit_timer = entry->second.get();
+            }
+        }
+    }
+
+    // Submissions to queues with a timeline semaphore for pacing wait for earlier submissions to complete.
+    VulkanSubmitPacer* submit_pacer = nullptr;
+
+    if (!submit_pacers_.empty())
+    {
+        const DeviceInfo* device_info = object_info_table_.GetDeviceInfo(queue_info->parent_id);
+
+        if (device_info != nullptr)
+        {
+            auto entry = submit_pacers_.find(device_info->handle);
+
+            if ((entry != submit_pacers_.end()) && entry->second->BeginSubmit(queue_info->handle))
+            {
+                submit_pacer = entry->second.get();
+            }
+        }
+    }
+
+    if (debug_labels_enabled_)
+    {
+        BeginDebugLabel(queue_info->handle,
+                        "Frame " + std::to_string(debug_label_frame_number_) + " submit " +
+                            std::to_string(debug_label_submit_index_));
+        ++debug_label_submit_index_;
+    }
+
+    // Only attempt to filter imported semaphores if we know at least one has been imported.
+    // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
+    // tracked.
+    if ((!have_imported_semaphores_) && !HasDummySwapchains())
+    {
+        result = func(queue_info->handle, submitCount, submit_infos, fence);
+    }
+    else
+    {
+        // Check for imported semaphores in the current submission list, mapping the pSubmits array index to a vector of
+        // imported semaphore info structures.
+        std::unordered_map<uint32_t, std::vector<const SemaphoreInfo*>> altered_submits;
+        std::vector<const SemaphoreInfo*>                               removed_semaphores;
+
+        if (submit_info_data != nullptr)
+        {
+            for (uint32_t i = 0; i < submitCount; i++)
+            {
+                GetImportedSemaphores(submit_info_data[i].pWaitSemaphores, &removed_semaphores);
+                GetShadowSemaphores(submit_info_data[i].pWaitSemaphores, &removed_semaphores);
+
+                // If rendering is restricted to a specific surface, need to track forward progress for semaphores that
+                // have been submitted with a null-swapchain.
+                TrackSemaphoreForwardProgress(submit_info_data[i].pWaitSemaphores, &removed_semaphores);
+
+                // Remove non-forward progress of signal semaphores.
+                GetNonForwardProgress(submit_info_data[i].pSignalSemaphores, &removed_semaphores);
+
+                if (!removed_semaphores.empty())
+                {
+                    altered_submits[i].swap(removed_semaphores);
+                    assert(removed_semaphores.empty());
+                }
+            }
+        }
+
+        if (altered_submits.empty())
+        {
+            result = func(queue_info->handle, submitCount, submit_infos, fence);
+        }
+        else
+        {
+            // Make shallow copies of the VkSubmit info structures and change pWaitSemaphores to reference a copy of the
+            // original semaphore array with the imported semaphores omitted.
+            std::vector<VkSubmitInfo> modified_submit_infos(submit_infos, std::next(submit_infos, submitCount));
+            std::vector<std::vector<VkSemaphore>> semaphore_memory(altered_submits.size());
+
+            std::vector<VkSemaphore> wait_semaphores;
+            std::vector<VkSemaphore> signal_semaphores;
+
+            for (const auto& submit_iter : altered_submits)
+            {
+                // Shallow copy with filtered copy of pWaitSemaphores for submission info with imported semaphores.
+                VkSubmitInfo& modified_submit_info = modified_submit_infos[submit_iter.first];
+                auto          semaphore_iter       = submit_iter.second.begin();
+
+                for (uint32_t i = 0; i < modified_submit_info.waitSemaphoreCount; ++i)
+                {
+                    VkSemaphore semaphore = modified_submit_info.pWaitSemaphores[i];
+
+                    if ((semaphore_iter == submit_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
+                    {
+                        wait_semaphores.push_back(semaphore);
+                    }
+                    else
+                    {
+                        // Omit the ignored semaphore from the current submission.
+                        ++semaphore_iter;
+                    }
+                }
+
+                for (uint32_t i = 0; i < modified_submit_info.signalSemaphoreCount; ++i)
+                {
+                    VkSemaphore semaphore = modified_submit_info.pSignalSemaphores[i];
+
+                    if ((semaphore_iter == submit_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
+                    {
+                        signal_semaphores.push_back(semaphore);
+                    }
+                    else
+                    {
+                        // Omit the ignored semaphore from the current submission.
+                        ++semaphore_iter;
+                    }
+                }
+
+                modified_submit_info.waitSemaphoreCount   = static_cast<uint32_t>(wait_semaphores.size());
+                modified_submit_info.pWaitSemaphores      = wait_semaphores.data();
+                modified_submit_info.signalSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size());
+                modified_submit_info.pSignalSemaphores    = signal_semaphores.data();
+            }
+
+            result = func(queue_info->handle,
+                          static_cast<uint32_t>(modified_submit_infos.size()),
+                          modified_submit_infos.data(),
+                          fence);
+        }
+    }
+
+    if (debug_labels_enabled_)
+    {
+        GetDeviceTable(queue_info->handle)->QueueEndDebugUtilsLabelEXT(queue_info->handle);
+    }
+
+    if (submit_timer != nullptr)
+    {
+        submit_timer->EndSubmit(queue_info->handle);
+    }
+
+    // The passes recorded by the submitted command buffers are reported for the frame once their results are read.
+    if ((pass_timing_report_ != nullptr) && (result == VK_SUCCESS) &&
+        pass_timing_report_->IsReportFrame(timing_frame_number_))
+    {
+        VulkanPassTimer* pass_timer = GetPassTimer(queue_info->parent_id);
+        if (pass_timer != nullptr)
+        {
+            pass_timer->Submit(queue_info->handle, submitCount, submit_infos, timing_frame_number_);
+        }
+    }
+
+    if ((submit_pacer != nullptr) && (result == VK_SUCCESS))
+    {
+        submit_pacer->EndSubmit(queue_info->handle);
+    }
+
+    // The bottom level acceleration structures built by the submission that are not cached yet are serialized once it
+    // completes.
+    VulkanAccelStructCache* accel_struct_cache = GetAccelStructCache(queue_info->parent_id);
+    if ((accel_struct_cache != nullptr) && (result == VK_SUCCESS))
+    {
+        VkResult store_result = accel_struct_cache->StoreSubmission(queue_info->handle, submitCount, submit_infos);
+
+        if (store_result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING_ONCE("Failed to write acceleration structures to the cache file (%s)",
+                                      enumutil::GetResultValueString(store_result));
+        }
+    }
+
+    if ((options_.sync_queue_submissions) && (result == VK_SUCCESS))
+    {
+        GetDeviceTable(queue_info->handle)->QueueWaitIdle(queue_info->handle);
+    }
+
+    return result;
+}
+
+VkResult
+VulkanReplayConsumerBase::OverrideQueueBindSparse(PFN_vkQueueBindSparse                                 func,
+                                                  VkResult                                              original_result,
+                                                  const QueueInfo*                                      queue_info,
+                                                  uint32_t                                              bindInfoCount,
+                                                  const StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
+                                                  const FenceInfo*                                      fence_info)
+{
+    assert((queue_info != nullptr) && (pBindInfo != nullptr) && !pBindInfo->IsNull());
+
+    ApplyPendingMemoryFills();
+
+    VkResult                result     = VK_SUCCESS;
+    const VkBindSparseInfo* bind_infos = pBindInfo->GetPointer();
+    VkFence                 fence      = VK_NULL_HANDLE;
+
+    if (fence_info != nullptr)
+    {
+        fence = fence_info->handle;
+    }
+
+    // Only attempt to filter imported semaphores if we know at least one has been imported.
+    // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
+    // tracked.
+    if ((!have_imported_semaphores_) && !HasDummySwapchains())
+    {
+        result = func(queue_info->handle, bindInfoCount, bind_infos, fence);
+    }
+    else
+    {
+        // Check for imported semaphores in the current bind info list, mapping the pBindInfo array index to a vector of
+        // imported semaphore info structures.
+        std::unordered_map<uint32_t, std::vector<const SemaphoreInfo*>> altered_submits;
+        std::vector<const SemaphoreInfo*>                               removed_semaphores;
+
+        auto bind_info_data = pBindInfo->GetMetaStructPointer();
+        if (bind_info_data != nullptr)
+        {
+            for (uint32_t i = 0; i < bindInfoCount; i++)
+            {
+                GetImportedSemaphores(bind_info_data[i].pWaitSemaphores, &removed_semaphores);
+                GetShadowSemaphores(bind_info_data[i].pWaitSemaphores, &removed_semaphores);
+
+                // If rendering is restricted to a specific surface, need to track forward progress for semaphores that
+                // have been submitted with a null-swapchain.
+                TrackSemaphoreForwardProgress(bind_info_data[i].pWaitSemaphores, &removed_semaphores);
+
+                // Remove non-forward progress of signal semaphores.
+                GetNonForwardProgress(bind_info_data[i].pSignalSemaphores, &removed_semaphores);
+
+                if (!removed_semaphores.empty())
+                {
+                    altered_submits[i].swap(removed_semaphores);
+                    assert(removed_semaphores.empty());
+                }
+            }
+        }
+
+        if (altered_submits.empty())
+        {
+            result = func(queue_info->handle, bindInfoCount, bind_infos, fence);
+        }
+        else
+        {
+            // Make shallow copies of the VkBindSparseInfo structures and change pWaitSemaphores to reference a copy of
+            // the original semaphore array with the imported semaphores omitted.
+            std::vector<VkBindSparseInfo>         modified_bind_infos(bind_infos, std::next(bind_infos, bindInfoCount));
+            std::vector<std::vector<VkSemaphore>> semaphore_memory(altered_submits.size());
+
+            std::vector<VkSemaphore> wait_semaphores;
+            std::vector<VkSemaphore> signal_semaphores;
+
+            for (const auto& bind_iter : altered_submits)
+            {
+                // Shallow copy with filtered copy of pWaitSemaphores for bind info with imported semaphores.
+                VkBindSparseInfo& modified_bind_info = modified_bind_infos[bind_iter.first];
+                auto              semaphore_iter     = bind_iter.second.begin();
+
+                for (uint32_t j = 0; j < modified_bind_info.waitSemaphoreCount; ++j)
+                {
+                    VkSemaphore semaphore = modified_bind_info.pWaitSemaphores[j];
+
+                    if ((semaphore_iter == bind_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
+                    {
+                        wait_semaphores.push_back(semaphore);
+                    }
+                    else
+                    {
+                        // Omit the ignored semaphore from the current submission.
+                        ++semaphore_iter;
+                    }
+                }
+
+                for (uint32_t j = 0; j < modified_bind_info.signalSemaphoreCount; ++j)
+                {
+                    VkSemaphore semaphore = modified_bind_info.pSignalSemaphores[j];
+
+                    if ((semaphore_iter == bind_iter.second.end()) || ((*semaphore_iter)->handle != semaphore))
+                    {
+                        signal_semaphores.push_back(semaphore);
+                    }
+                    else
+                    {
+                        // Omit the ignored semaphore from the current submission.
+                        ++semaphore_iter;
+                    }
+                }
+
+                modified_bind_info.waitSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size());
+                modified_bind_info.pWaitSemaphores    = wait_semaphores.data();
+                modified_bind_info.waitSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size());
+                modified_bind_info.pWaitSemaphores    = signal_semaphores.data();
+            }
+
+            result = func(queue_info->handle,
+                          static_cast<uint32_t>(modified_bind_infos.size()),
+                          modified_bind_infos.data(),
+                          fence);
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateDescriptorSetLayout(
+    PFN_vkCreateDescriptorSetLayout                                      func,
+    VkResult                                                             original_result,
+    const DeviceInfo*                                                    device_info,
+    const StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*           pAllocator,
+    HandlePointerDecoder<VkDescriptorSetLayout>*                         pSetLayout)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (pCreateInfo != nullptr) && (pSetLayout != nullptr) &&
+           (pSetLayout->GetHandlePointer() != nullptr));
+
+    const auto create_info = pCreateInfo->GetPointer();
+
+    VkResult result =
+        func(device_info->handle, create_info, GetAllocationCallbacks(pAllocator), pSetLayout->GetHandlePointer());
+
+    if ((result == VK_SUCCESS) && options_.skip_redundant_descriptor_updates && (create_info != nullptr))
+    {
+        auto layout_info = reinterpret_cast<DescriptorSetLayoutInfo*>(pSetLayout->GetConsumerData(0));
+        assert(layout_info != nullptr);
+
+        for (uint32_t i = 0; i < create_info->bindingCount; ++i)
+        {
+            const VkDescriptorSetLayoutBinding& binding = create_info->pBindings[i];
+
+            // The descriptor count of an inline uniform block is a size in bytes.  Writes to the block are never
+            // skipped, so its bytes do not need cache entries.
+            if (binding.descriptorType != VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT)
+            {
+                layout_info->binding_counts[binding.binding] = binding.descriptorCount;
+            }
+            else
+            {
+                layout_info->binding_counts[binding.binding] = 0;
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateDescriptorPool(
+    PFN_vkCreateDescriptorPool                                      func,
+    VkResult                                                        original_result,
+    const DeviceInfo*                                               device_info,
+    const StructPointerDecoder<Decoded_VkDescriptorPoolCreateInfo>* pCreateInfo,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*      pAllocator,
+    HandlePointerDecoder<VkDescriptorPool>*                         pDescriptorPool)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pDescriptorPool != nullptr) &&
+           !pDescriptorPool->IsNull());
+
+    auto        replay_pool = pDescriptorPool->GetHandlePointer();
+    const auto  create_info = pCreateInfo->GetPointer();
+    VkResult    result      = VK_SUCCESS;
+    std::string recycle_key;
+
+    // A pool that was kept when it was destroyed is reused in place of creating a pool with the same parameters.
+    VulkanPoolCache* pool_cache    = GetPoolCache(device_info->handle);
+    VkDescriptorPool recycled_pool = VK_NULL_HANDLE;
+
+    if ((pool_cache != nullptr) && VulkanPoolCache::GetDescriptorPoolKey(create_info, &recycle_key))
+    {
+        recycled_pool = pool_cache->AcquireDescriptorPool(recycle_key);
+    }
+
+    if (recycled_pool != VK_NULL_HANDLE)
+    {
+        (*replay_pool) = recycled_pool;
+    }
+    else
+    {
+        result = func(device_info->handle, create_info, GetAllocationCallbacks(pAllocator), replay_pool);
+    }
+
+    if (result >= 0)
+    {
+        // Due to capture and replay differences, it is possible for descriptor set allocation to fail with the
+        // descriptor pool running out of memory.  To handle this case, replay will store the pool creation info so that
+        // it can attempt to recover from an out of pool memory event by creating a new pool with the same properties.
+        auto pool_info = reinterpret_cast<DescriptorPoolInfo*>(pDescriptorPool->GetConsumerData(0));
+        assert(pool_info != nullptr);
+
+        pool_info->flags       = create_info->flags;
+        pool_info->max_sets    = create_info->maxSets;
+        pool_info->recycle_key = std::move(recycle_key);
+
+        for (uint32_t i = 0; i < create_info->poolSizeCount; i++)
+        {
+            pool_info->pool_sizes.push_back(create_info->pPoolSizes[i]);
+        }
+
+        // 'Out' struct for non-const pNext pointers.
+        if (create_info->pNext != nullptr)
+        {
+            auto meta_info = pCreateInfo->GetMetaStructPointer();
+            auto pnext     = reinterpret_cast<VkBaseOutStructure*>(meta_info->pNext->GetPointer());
+            while (pnext != nullptr)
+            {
+                if (pnext->sType == VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT)
+                {
+                    auto inline_uniform_block_info =
+                        reinterpret_cast<VkDescriptorPoolInlineUniformBlockCreateInfoEXT*>(pnext);
+                    pool_info->max_inline_uniform_block_bindings =
+                        inline_uniform_block_info->maxInlineUniformBlockBindings;
+                    break;
+                }
+                pnext = pnext->pNext;
+            }
+        }
+    }
+
+    return result;
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyDescriptorPool(
+    PFN_vkDestroyDescriptorPool                                func,
+    const DeviceInfo*                                          device_info,
+    DescriptorPoolInfo*                                        descriptor_pool_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert(device_info != nullptr);
+
+    VkDevice         device          = device_info->handle;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+
+    if (descriptor_pool_info != nullptr)
+    {
+        descriptor_pool = descriptor_pool_info->handle;
+
+        // If descriptor allocation ran out of pool memory one or more times, there will be one or more descriptor pools
+        // that need to be destroyed.
+        for (auto retired_pool : descriptor_pool_info->retired_pools)
+        {
+            func(device, retired_pool, GetAllocationCallbacks(pAllocator));
+        }
+
+        VulkanPoolCache* pool_cache = GetPoolCache(device);
+        if ((pool_cache != nullptr) && !descriptor_pool_info->recycle_key.empty() &&
+            pool_cache->RetainDescriptorPool(descriptor_pool_info->recycle_key, descriptor_pool))
+        {
+            return;
+        }
+    }
+
+    func(device, descriptor_pool, GetAllocationCallbacks(pAllocator));
+}
+
+VkResult VulkanReplayConsumerBase::OverrideAllocateDescriptorSets(
+    PFN_vkAllocateDescriptorSets                                     func,
+    VkResult                                                         original_result,
+    const DeviceInfo*                                                device_info,
+    const StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
+    HandlePointerDecoder<VkDescriptorSet>*                           pDescriptorSets)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (pAllocateInfo != nullptr) && (pDescriptorSets != nullptr) &&
+           (pDescriptorSets->GetHandlePointer() != nullptr));
+
+    VkResult result = original_result;
+
+    if ((original_result >= 0) || !options_.skip_failed_allocations)
+    {
+        result = func(device_info->handle, pAllocateInfo->GetPointer(), pDescriptorSets->GetHandlePointer());
+
+        if ((original_result >= 0) && (result == VK_ERROR_OUT_OF_POOL_MEMORY))
+        {
+            // Handle case where replay runs out of descriptor pool memory when capture did not by creating a new
+            // descriptor pool and attempting the allocation a second time.
+            VkDescriptorPool new_pool  = VK_NULL_HANDLE;
+            auto             meta_info = pAllocateInfo->GetMetaStructPointer();
+            auto             pool_info = object_info_table_.GetDescriptorPoolInfo(meta_info->descriptorPool);
+
+            VkDescriptorPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+            create_info.pNext                      = nullptr;
+            create_info.maxSets                    = pool_info->max_sets;
+            create_info.poolSizeCount              = static_cast<uint32_t>(pool_info->pool_sizes.size());
+            create_info.pPoolSizes                 = pool_info->pool_sizes.data();
+
+            VkDescriptorPoolInlineUniformBlockCreateInfoEXT inline_uniform_block = {
+                VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT,
+                nullptr,
+                pool_info->max_inline_uniform_block_bindings
+            };
+
+            if (pool_info->max_inline_uniform_block_bindings != 0)
+            {
+                create_info.pNext = &inline_uniform_block;
+            }
+
+            result = GetDeviceTable(device_info->handle)
+                         ->CreateDescriptorPool(device_info->handle, &create_info, nullptr, &new_pool);
+
+            if (result == VK_SUCCESS)
+            {
+                GFXRECON_LOG_INFO(
+                    "A new VkDescriptorPool object (handle = 0x%" PRIx64
+                    ") has been created to replace a VkDescriptorPool object (ID = %" PRIu64 ", handle = 0x%" PRIx64
+                    ") that has run our of pool memory (vkAllocateDescriptorSets returned VK_ERROR_OUT_OF_POOL_MEMORY)",
+                    new_pool,
+                    pool_info->capture_id,
+                    pool_info->handle);
+
+                // Retire old pool and swap it with the new pool.
+                pool_info->retired_pools.push_back(pool_info->handle);
+                pool_info->handle = new_pool;
+
+                // Retry descriptor set allocation.
+                VkDescriptorSetAllocateInfo modified_allocate_info = (*pAllocateInfo->GetPointer());
+                modified_allocate_info.descriptorPool              = new_pool;
+
+                result = func(device_info->handle, &modified_allocate_info, pDescriptorSets->GetHandlePointer());
+            }
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_INFO("Skipping vkAllocateDescriptorSets call that failed during capture with error %s",
+                          enumutil::GetResultValueString(original_result));
+    }
+
+    if ((result == VK_SUCCESS) && options_.skip_redundant_descriptor_updates)
+    {
+        // Create an empty cache entry for each descriptor of the new sets, from the bindings of their layouts.
+        const format::HandleId* layout_ids = pAllocateInfo->GetMetaStructPointer()->pSetLayouts.GetPointer();
+        uint32_t                set_count  = pAllocateInfo->GetPointer()->descriptorSetCount;
+
+        for (uint32_t i = 0; (layout_ids != nullptr) && (i < set_count); ++i)
+        {
+            auto set_info    = reinterpret_cast<DescriptorSetInfo*>(pDescriptorSets->GetConsumerData(i));
+            auto layout_info = object_info_table_.GetDescriptorSetLayoutInfo(layout_ids[i]);
+
+            if ((set_info != nullptr) && (layout_info != nullptr))
+            {
+                for (const auto& binding : layout_info->binding_counts)
+                {
+                    set_info->descriptors[binding.first].resize(binding.second);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+void VulkanReplayConsumerBase::OverrideUpdateDescriptorSets(
+    PFN_vkUpdateDescriptorSets                                func,
+    const DeviceInfo*                                         device_info,
+    uint32_t                                                  descriptorWriteCount,
+    const StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites,
+    uint32_t                                                  descriptorCopyCount,
+    const StructPointerDecoder<Decoded_VkCopyDescriptorSet>*  pDescriptorCopies)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (pDescriptorWrites != nullptr) && (pDescriptorCopies != nullptr));
+
+    const VkWriteDescriptorSet* writes = pDescriptorWrites->GetPointer();
+    const VkCopyDescriptorSet*  copies = pDescriptorCopies->GetPointer();
+
+    if (!options_.skip_redundant_descriptor_updates)
+    {
+        func(device_info->handle, descriptorWriteCount, writes, descriptorCopyCount, copies);
+        return;
+    }
+
+    // Writes are checked in order, so that a write is compared to the contents left by the writes that precede it.
+    std::vector<VkWriteDescriptorSet> filtered_writes;
+    auto                              write_meta = pDescriptorWrites->GetMetaStructPointer();
+
+    if (write_meta != nullptr)
+    {
+        for (uint32_t i = 0; i < descriptorWriteCount; ++i)
+        {
+            if (!IsRedundantDescriptorWrite(&write_meta[i]))
+            {
+                filtered_writes.push_back(writes[i]);
+            }
+        }
+    }
+
+    // The contents of copied descriptors are not tracked, so the copy destinations are invalidated.
+    auto copy_meta = pDescriptorCopies->GetMetaStructPointer();
+
+    for (uint32_t i = 0; (copy_meta != nullptr) && (i < descriptorCopyCount); ++i)
+    {
+        DescriptorSetInfo* set_info = object_info_table_.GetDescriptorSetInfo(copy_meta[i].dstSet);
+
+        if (set_info != nullptr)
+        {
+            const VkCopyDescriptorSet&       copy = copies[i];
+            std::vector<DescriptorContents*> descriptors;
+
+            set_info->update_template_id = format::kNullHandleId;
+            set_info->update_template_data.clear();
+
+            if (GetCachedDescriptors(
+                    set_info, copy.dstBinding, copy.dstArrayElement, copy.descriptorCount, &descriptors))
+            {
+                for (auto descriptor : descriptors)
+                {
+                    (*descriptor) = DescriptorContents{};
+                }
+            }
+            else
+            {
+                InvalidateCachedDescriptors(set_info);
+            }
+        }
+    }
+
+    if (!filtered_writes.empty() || (descriptorCopyCount > 0))
+    {
+        func(device_info->handle,
+             static_cast<uint32_t>(filtered_writes.size()),
+             filtered_writes.data(),
+             descriptorCopyCount,
+             copies);
+    }
+}
+
+VkResult VulkanReplayConsumerBase::OverrideBeginCommandBuffer(
+    PFN_vkBeginCommandBuffer                                      func,
+    VkResult                                                      original_result,
+    const CommandBufferInfo*                                      command_buffer_info,
+    const StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((command_buffer_info != nullptr) && (pBeginInfo != nullptr));
+
+    // Beginning the command buffer replaces the commands that were recorded while fast forwarding.
+    if (!incomplete_command_buffers_.empty())
+    {
+        incomplete_command_buffers_.erase(command_buffer_info->capture_id);
+    }
+
+    VulkanAddressPatcher* patcher = GetAddressPatcher(command_buffer_info->parent_id);
+    if (patcher != nullptr)
+    {
+        patcher->ResetCommandBuffer(command_buffer_info->handle);
+    }
+
+    VulkanAccelStructCache* accel_struct_cache = GetAccelStructCache(command_buffer_info->parent_id);
+    if (accel_struct_cache != nullptr)
+    {
+        accel_struct_cache->ResetCommandBuffer(command_buffer_info->handle);
+    }
+
+    const VkCommandBufferBeginInfo* begin_info = pBeginInfo->GetPointer();
+
+    // Primary command buffers, which are begun without inheritance info, are timed while the frames of the pass timing
+    // report may be recorded.
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        bool timed = (begin_info != nullptr) && (begin_info->pInheritanceInfo == nullptr) &&
+                     (timing_frame_number_ <= pass_timing_report_->GetLastFrame());
+
+        pass_timer->BeginCommandBuffer(command_buffer_info->handle, command_buffer_info->capture_id, timed);
+    }
+
+    VkResult result = func(command_buffer_info->handle, begin_info);
+
+    // The recording is labeled with the capture ID of the command buffer, and the label is ended by
+    // OverrideEndCommandBuffer().
+    if ((result == VK_SUCCESS) && debug_labels_enabled_)
+    {
+        BeginDebugLabel(command_buffer_info->handle,
+                        "Command buffer " + std::to_string(command_buffer_info->capture_id));
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideEndCommandBuffer(PFN_vkEndCommandBuffer   func,
+                                                            VkResult                 original_result,
+                                                            const CommandBufferInfo* command_buffer_info)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert(command_buffer_info != nullptr);
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        pass_timer->EndCommandBuffer(command_buffer_info->handle);
+    }
+
+    if (debug_labels_enabled_)
+    {
+        GetDeviceTable(command_buffer_info->handle)->CmdEndDebugUtilsLabelEXT(command_buffer_info->handle);
+    }
+
+    return func(command_buffer_info->handle);
+}
+
+void VulkanReplayConsumerBase::OverrideCmdBeginRenderPass(
+    PFN_vkCmdBeginRenderPass                                   func,
+    const CommandBufferInfo*                                   command_buffer_info,
+    const StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+    VkSubpassContents                                          contents)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((command_buffer_info != nullptr) && (pRenderPassBegin != nullptr));
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        auto meta_info = pRenderPassBegin->GetMetaStructPointer();
+        assert(meta_info != nullptr);
+
+        pass_timer->BeginRenderPass(command_buffer_info->handle, meta_info->renderPass, meta_info->framebuffer);
+    }
+
+    func(command_buffer_info->handle, pRenderPassBegin->GetPointer(), contents);
+}
+
+void VulkanReplayConsumerBase::OverrideCmdBeginRenderPass2(
+    PFN_vkCmdBeginRenderPass2                                  func,
+    const CommandBufferInfo*                                   command_buffer_info,
+    const StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+    const StructPointerDecoder<Decoded_VkSubpassBeginInfo>*    pSubpassBeginInfo)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((command_buffer_info != nullptr) && (pRenderPassBegin != nullptr) && (pSubpassBeginInfo != nullptr));
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        auto meta_info = pRenderPassBegin->GetMetaStructPointer();
+        assert(meta_info != nullptr);
+
+        pass_timer->BeginRenderPass(command_buffer_info->handle, meta_info->renderPass, meta_info->framebuffer);
+    }
+
+    func(command_buffer_info->handle, pRenderPassBegin->GetPointer(), pSubpassBeginInfo->GetPointer());
+}
+
+void VulkanReplayConsumerBase::OverrideCmdEndRenderPass(PFN_vkCmdEndRenderPass   func,
+                                                        const CommandBufferInfo* command_buffer_info)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert(command_buffer_info != nullptr);
+
+    func(command_buffer_info->handle);
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        pass_timer->EndRenderPass(command_buffer_info->handle);
+    }
+}
+
+void VulkanReplayConsumerBase::OverrideCmdEndRenderPass2(
+    PFN_vkCmdEndRenderPass2                               func,
+    const CommandBufferInfo*                              command_buffer_info,
+    const StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((command_buffer_info != nullptr) && (pSubpassEndInfo != nullptr));
+
+    func(command_buffer_info->handle, pSubpassEndInfo->GetPointer());
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        pass_timer->EndRenderPass(command_buffer_info->handle);
+    }
+}
+
+void VulkanReplayConsumerBase::OverrideCmdDispatch(PFN_vkCmdDispatch        func,
+                                                   const CommandBufferInfo* command_buffer_info,
+                                                   uint32_t                 groupCountX,
+                                                   uint32_t                 groupCountY,
+                                                   uint32_t                 groupCountZ)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert(command_buffer_info != nullptr);
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        pass_timer->Dispatch(command_buffer_info->handle);
+    }
+
+    func(command_buffer_info->handle, groupCountX, groupCountY, groupCountZ);
+}
+
+void VulkanReplayConsumerBase::OverrideCmdDispatchIndirect(PFN_vkCmdDispatchIndirect func,
+                                                           const CommandBufferInfo*  command_buffer_info,
+                                                           const BufferInfo*         buffer_info,
+                                                           VkDeviceSize              offset)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert(command_buffer_info != nullptr);
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        pass_timer->Dispatch(command_buffer_info->handle);
+    }
+
+    VkBuffer buffer = (buffer_info != nullptr) ? buffer_info->handle : VK_NULL_HANDLE;
+
+    func(command_buffer_info->handle, buffer, offset);
+}
+
+void VulkanReplayConsumerBase::OverrideCmdDispatchBase(PFN_vkCmdDispatchBase    func,
+                                                       const CommandBufferInfo* command_buffer_info,
+                                                       uint32_t                 baseGroupX,
+                                                       uint32_t                 baseGroupY,
+                                                       uint32_t                 baseGroupZ,
+                                                       uint32_t                 groupCountX,
+                                                       uint32_t                 groupCountY,
+                                                       uint32_t                 groupCountZ)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert(command_buffer_info != nullptr);
+
+    VulkanPassTimer* pass_timer = GetPassTimer(command_buffer_info->parent_id);
+    if (pass_timer != nullptr)
+    {
+        pass_timer->Dispatch(command_buffer_info->handle);
     }
 
-    return result;
+    func(command_buffer_info->handle, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
 }
 
-VkResult VulkanReplayConsumerBase::OverrideCreateDescriptorPool(
-    PFN_vkCreateDescriptorPool                                      func,
-    VkResult                                                        original_result,
-    const DeviceInfo*                                               device_info,
-    const StructPointerDecoder<Decoded_VkDescriptorPoolCreateInfo>* pCreateInfo,
-    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*      pAllocator,
-    HandlePointerDecoder<VkDescriptorPool>*                         pDescriptorPool)
+void VulkanReplayConsumerBase::OverrideCmdBindPipeline(PFN_vkCmdBindPipeline    func,
+                                                       const CommandBufferInfo* command_buffer_info,
+                                                       VkPipelineBindPoint      pipelineBindPoint,
+                                                       const PipelineInfo*      pipeline_info)
 {
-    assert((pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pDescriptorPool != nullptr) &&
-           !pDescriptorPool->IsNull());
+    GFXRECON_INSTRUMENT_FUNCTION();
 
-    auto       replay_pool = pDescriptorPool->GetHandlePointer();
-    const auto create_info = pCreateInfo->GetPointer();
+    assert(command_buffer_info != nullptr);
 
-    VkResult result = func(device_info->handle, create_info, GetAllocationCallbacks(pAllocator), replay_pool);
+    VkPipeline pipeline = VK_NULL_HANDLE;
 
-    if (result >= 0)
+    if (pipeline_info != nullptr)
     {
-        // Due to capture and replay differences, it is possible for descriptor set allocation to fail with the
-        // descriptor pool running out of memory.  To handle this case, replay will store the pool creation info so that
-        // it can attempt to recover from an out of pool memory event by creating a new pool with the same properties.
-        auto pool_info = reinterpret_cast<DescriptorPoolInfo*>(pDescriptorPool->GetConsumerData(0));
-        assert(pool_info != nullptr);
-
-        pool_info->flags    = create_info->flags;
-        pool_info->max_sets = create_info->maxSets;
-
-        for (uint32_t i = 0; i < create_info->poolSizeCount; i++)
-        {
-            pool_info->pool_sizes.push_back(create_info->pPoolSizes[i]);
-        }
+        pipeline = pipeline_info->handle;
 
-        // 'Out' struct for non-const pNext pointers.
-        if (create_info->pNext != nullptr)
+        // The bound ray tracing pipeline selects the shader group handles that patch the shader binding tables of
+        // the trace rays commands that follow.
+        VulkanAddressPatcher* patcher = GetAddressPatcher(command_buffer_info->parent_id);
+        if (patcher != nullptr)
         {
-            auto meta_info = pCreateInfo->GetMetaStructPointer();
-            auto pnext     = reinterpret_cast<VkBaseOutStructure*>(meta_info->pNext->GetPointer());
-            while (pnext != nullptr)
-            {
-                if (pnext->sType == VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT)
-                {
-                    auto inline_uniform_block_info =
-                        reinterpret_cast<VkDescriptorPoolInlineUniformBlockCreateInfoEXT*>(pnext);
-                    pool_info->max_inline_uniform_block_bindings =
-                        inline_uniform_block_info->maxInlineUniformBlockBindings;
-                    break;
-                }
-                pnext = pnext->pNext;
-            }
+            patcher->BindPipeline(command_buffer_info->handle, pipelineBindPoint, pipeline_info->capture_id);
         }
     }
 
-    return result;
+    func(command_buffer_info->handle, pipelineBindPoint, pipeline);
 }
 
-void VulkanReplayConsumerBase::OverrideDestroyDescriptorPool(
-    PFN_vkDestroyDescriptorPool                                func,
-    const DeviceInfo*                                          device_info,
-    DescriptorPoolInfo*                                        descriptor_pool_info,
-    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+VkResult VulkanReplayConsumerBase::OverrideCreateCommandPool(
+    PFN_vkCreateCommandPool                                      func,
+    VkResult                                                     original_result,
+    const DeviceInfo*                                            device_info,
+    const StructPointerDecoder<Decoded_VkCommandPoolCreateInfo>* pCreateInfo,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*   pAllocator,
+    HandlePointerDecoder<VkCommandPool>*                         pCommandPool)
 {
-    assert(device_info != nullptr);
+    GFXRECON_INSTRUMENT_FUNCTION();
 
-    VkDevice         device          = device_info->handle;
-    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
-    if (descriptor_pool_info != nullptr)
+    assert((device_info != nullptr) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() &&
+           (pCommandPool != nullptr) && !pCommandPool->IsNull());
+
+    auto        replay_pool = pCommandPool->GetHandlePointer();
+    const auto  create_info = pCreateInfo->GetPointer();
+    VkResult    result      = VK_SUCCESS;
+    std::string recycle_key;
+
+    // A pool that was kept when it was destroyed is reused in place of creating a pool with the same parameters.
+    VulkanPoolCache* pool_cache    = GetPoolCache(device_info->handle);
+    VkCommandPool    recycled_pool = VK_NULL_HANDLE;
+
+    if ((pool_cache != nullptr) && VulkanPoolCache::GetCommandPoolKey(create_info, &recycle_key))
     {
-        descriptor_pool = descriptor_pool_info->handle;
+        recycled_pool = pool_cache->AcquireCommandPool(recycle_key);
+    }
 
-        // If descriptor allocation ran out of pool memory one or more times, there will be one or more descriptor pools
-        // that need to be destroyed.
-        for (auto retired_pool : descriptor_pool_info->retired_pools)
-        {
-            func(device, retired_pool, GetAllocationCallbacks(pAllocator));
-        }
+    if (recycled_pool != VK_NULL_HANDLE)
+    {
+        (*replay_pool) = recycled_pool;
+    }
+    else
+    {
+        result = func(device_info->handle, create_info, GetAllocationCallbacks(pAllocator), replay_pool);
     }
 
-    func(device, descriptor_pool, GetAllocationCallbacks(pAllocator));
+    if (result == VK_SUCCESS)
+    {
+        auto pool_info = reinterpret_cast<CommandPoolInfo*>(pCommandPool->GetConsumerData(0));
+        assert(pool_info != nullptr);
+
+        pool_info->recycle_key = std::move(recycle_key);
+    }
+
+    return result;
 }
 
-VkResult VulkanReplayConsumerBase::OverrideAllocateDescriptorSets(
-    PFN_vkAllocateDescriptorSets                                     func,
-    VkResult                                                         original_result,
-    const DeviceInfo*                                                device_info,
-    const StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
-    HandlePointerDecoder<VkDescriptorSet>*                           pDescriptorSets)
+void VulkanReplayConsumerBase::OverrideDestroyCommandPool(
+    PFN_vkDestroyCommandPool                                   func,
+    const DeviceInfo*                                          device_info,
+    CommandPoolInfo*                                           command_pool_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    assert((device_info != nullptr) && (pAllocateInfo != nullptr) && (pDescriptorSets != nullptr) &&
-           (pDescriptorSets->GetHandlePointer() != nullptr));
+    GFXRECON_INSTRUMENT_FUNCTION();
 
-    VkResult result = original_result;
+    assert(device_info != nullptr);
 
-    if ((original_result >= 0) || !options_.skip_failed_allocations)
+    VkDevice      device       = device_info->handle;
+    VkCommandPool command_pool = VK_NULL_HANDLE;
+
+    if (command_pool_info != nullptr)
     {
-        result = func(device_info->handle, pAllocateInfo->GetPointer(), pDescriptorSets->GetHandlePointer());
+        command_pool = command_pool_info->handle;
 
-        if ((original_result >= 0) && (result == VK_ERROR_OUT_OF_POOL_MEMORY))
+        VulkanPoolCache* pool_cache = GetPoolCache(device);
+        if ((pool_cache != nullptr) && !command_pool_info->recycle_key.empty())
         {
-            // Handle case where replay runs out of descriptor pool memory when capture did not by creating a new
-            // descriptor pool and attempting the allocation a second time.
-            VkDescriptorPool new_pool  = VK_NULL_HANDLE;
-            auto             meta_info = pAllocateInfo->GetMetaStructPointer();
-            auto             pool_info = object_info_table_.GetDescriptorPoolInfo(meta_info->descriptorPool);
-
-            VkDescriptorPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
-            create_info.pNext                      = nullptr;
-            create_info.maxSets                    = pool_info->max_sets;
-            create_info.poolSizeCount              = static_cast<uint32_t>(pool_info->pool_sizes.size());
-            create_info.pPoolSizes                 = pool_info->pool_sizes.data();
+            std::vector<VkCommandBuffer> command_buffers;
 
-            VkDescriptorPoolInlineUniformBlockCreateInfoEXT inline_uniform_block = {
-                VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT,
-                nullptr,
-                pool_info->max_inline_uniform_block_bindings
-            };
-
-            if (pool_info->max_inline_uniform_block_bindings != 0)
+            for (auto child_id : command_pool_info->child_ids)
             {
-                create_info.pNext = &inline_uniform_block;
+                const CommandBufferInfo* command_buffer_info = object_info_table_.GetCommandBufferInfo(child_id);
+                if ((command_buffer_info != nullptr) && (command_buffer_info->handle != VK_NULL_HANDLE))
+                {
+                    command_buffers.push_back(command_buffer_info->handle);
+                }
             }
 
-            result = GetDeviceTable(device_info->handle)
-                         ->CreateDescriptorPool(device_info->handle, &create_info, nullptr, &new_pool);
-
-            if (result == VK_SUCCESS)
+            if (pool_cache->RetainCommandPool(command_pool_info->recycle_key, command_pool, command_buffers))
             {
-                GFXRECON_LOG_INFO(
-                    "A new VkDescriptorPool object (handle = 0x%" PRIx64
-                    ") has been created to replace a VkDescriptorPool object (ID = %" PRIu64 ", handle = 0x%" PRIx64
-                    ") that has run our of pool memory (vkAllocateDescriptorSets returned VK_ERROR_OUT_OF_POOL_MEMORY)",
-                    new_pool,
-                    pool_info->capture_id,
-                    pool_info->handle);
-
-                // Retire old pool and swap it with the new pool.
-                pool_info->retired_pools.push_back(pool_info->handle);
-                pool_info->handle = new_pool;
-
-                // Retry descriptor set allocation.
-                VkDescriptorSetAllocateInfo modified_allocate_info = (*pAllocateInfo->GetPointer());
-                modified_allocate_info.descriptorPool              = new_pool;
-
-                result = func(device_info->handle, &modified_allocate_info, pDescriptorSets->GetHandlePointer());
+                return;
             }
         }
     }
-    else
-    {
-        GFXRECON_LOG_INFO("Skipping vkAllocateDescriptorSets call that failed during capture with error %s",
-                          enumutil::GetResultValueString(original_result));
-    }
 
-    return result;
+    func(device, command_pool, GetAllocationCallbacks(pAllocator));
 }
 
 VkResult VulkanReplayConsumerBase::OverrideAllocateCommandBuffers(
@@ -3446,6 +7052,8 @@ VkResult VulkanReplayConsumerBase::OverrideAllocateCommandBuffers(
     const StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkCommandBuffer>*                           pCommandBuffers)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert((device_info != nullptr) && (pAllocateInfo != nullptr) && (pCommandBuffers != nullptr) &&
            (pCommandBuffers->GetHandlePointer() != nullptr));
 
@@ -3472,6 +7080,8 @@ VkResult VulkanReplayConsumerBase::OverrideAllocateMemory(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeviceMemory>*                      pMemory)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert((device_info != nullptr) && (pAllocateInfo != nullptr) && (pMemory != nullptr) && !pMemory->IsNull() &&
@@ -3549,8 +7159,33 @@ VkResult VulkanReplayConsumerBase::OverrideAllocateMemory(
             auto memory_info = reinterpret_cast<DeviceMemoryInfo*>(pMemory->GetConsumerData(0));
             assert(memory_info != nullptr);
 
-            memory_info->allocator      = allocator;
-            memory_info->allocator_data = allocator_data;
+            memory_info->allocator         = allocator;
+            memory_info->allocator_data    = allocator_data;
+            memory_info->allocation_size   = replay_allocate_info->allocationSize;
+            memory_info->memory_type_index = replay_allocate_info->memoryTypeIndex;
+
+            auto next = reinterpret_cast<const VkBaseInStructure*>(replay_allocate_info->pNext);
+            while (next != nullptr)
+            {
+                switch (next->sType)
+                {
+                    case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+                    case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+                    case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT:
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+                    case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
+#endif
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+                    case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID:
+#endif
+                        memory_info->is_dedicated = true;
+                        break;
+                    default:
+                        break;
+                }
+
+                next = next->pNext;
+            }
         }
         else if (original_result == VK_SUCCESS)
         {
@@ -3577,6 +7212,8 @@ VkResult VulkanReplayConsumerBase::OverrideMapMemory(PFN_vkMapMemory   func,
                                                      VkMemoryMapFlags  flags,
                                                      void**            ppData)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
@@ -3585,6 +7222,8 @@ VkResult VulkanReplayConsumerBase::OverrideMapMemory(PFN_vkMapMemory   func,
     auto allocator = device_info->allocator.get();
     assert(allocator != nullptr);
 
+    ApplyPendingMemoryFills(memory_info->capture_id);
+
     return allocator->MapMemory(memory_info->handle, offset, size, flags, ppData, memory_info->allocator_data);
 }
 
@@ -3592,6 +7231,8 @@ void VulkanReplayConsumerBase::OverrideUnmapMemory(PFN_vkUnmapMemory func,
                                                    const DeviceInfo* device_info,
                                                    DeviceMemoryInfo* memory_info)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert((device_info != nullptr) && (memory_info != nullptr));
@@ -3599,6 +7240,8 @@ void VulkanReplayConsumerBase::OverrideUnmapMemory(PFN_vkUnmapMemory func,
     auto allocator = device_info->allocator.get();
     assert(allocator != nullptr);
 
+    ApplyPendingMemoryFills(memory_info->capture_id);
+
     allocator->UnmapMemory(memory_info->handle, memory_info->allocator_data);
 }
 
@@ -3609,6 +7252,8 @@ VkResult VulkanReplayConsumerBase::OverrideFlushMappedMemoryRanges(
     uint32_t                                                 memoryRangeCount,
     const StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert((device_info != nullptr) && (pMemoryRanges != nullptr));
@@ -3616,7 +7261,7 @@ VkResult VulkanReplayConsumerBase::OverrideFlushMappedMemoryRanges(
     auto replay_range_meta_datas = pMemoryRanges->GetMetaStructPointer();
     assert(replay_range_meta_datas != nullptr);
 
-    std::vector<VulkanResourceAllocator::MemoryData> allocator_datas(memoryRangeCount, 0);
+    auto allocator_datas = DecodeAllocator::Allocate<VulkanResourceAllocator::MemoryData>(memoryRangeCount);
 
     for (uint32_t i = 0; i < memoryRangeCount; ++i)
     {
@@ -3625,13 +7270,15 @@ VkResult VulkanReplayConsumerBase::OverrideFlushMappedMemoryRanges(
         if (memory_info != nullptr)
         {
             allocator_datas[i] = memory_info->allocator_data;
+
+            ApplyPendingMemoryFills(memory_info->capture_id);
         }
     }
 
     auto allocator = device_info->allocator.get();
     assert(allocator != nullptr);
 
-    return allocator->FlushMappedMemoryRanges(memoryRangeCount, pMemoryRanges->GetPointer(), allocator_datas.data());
+    return allocator->FlushMappedMemoryRanges(memoryRangeCount, pMemoryRanges->GetPointer(), allocator_datas);
 }
 
 VkResult VulkanReplayConsumerBase::OverrideInvalidateMappedMemoryRanges(
@@ -3641,56 +7288,226 @@ VkResult VulkanReplayConsumerBase::OverrideInvalidateMappedMemoryRanges(
     uint32_t                                                 memoryRangeCount,
     const StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert((device_info != nullptr) && (pMemoryRanges != nullptr));
 
-    auto replay_range_meta_datas = pMemoryRanges->GetMetaStructPointer();
-    assert(replay_range_meta_datas != nullptr);
+    auto replay_range_meta_datas = pMemoryRanges->GetMetaStructPointer();
+    assert(replay_range_meta_datas != nullptr);
+
+    auto allocator_datas = DecodeAllocator::Allocate<VulkanResourceAllocator::MemoryData>(memoryRangeCount);
+
+    for (uint32_t i = 0; i < memoryRangeCount; ++i)
+    {
+        auto memory_info = object_info_table_.GetDeviceMemoryInfo(replay_range_meta_datas[i].memory);
+
+        if (memory_info != nullptr)
+        {
+            allocator_datas[i] = memory_info->allocator_data;
+
+            ApplyPendingMemoryFills(memory_info->capture_id);
+        }
+    }
+
+    auto allocator = device_info->allocator.get();
+    assert(allocator != nullptr);
+
+    return allocator->InvalidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges->GetPointer(), allocator_datas);
+}
+
+void VulkanReplayConsumerBase::OverrideFreeMemory(PFN_vkFreeMemory  func,
+                                                  const DeviceInfo* device_info,
+                                                  DeviceMemoryInfo* memory_info,
+                                                  const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    GFXRECON_UNREFERENCED_PARAMETER(func);
+
+    assert(device_info != nullptr);
+
+    auto allocator = device_info->allocator.get();
+    assert(allocator != nullptr);
+
+    VkDeviceMemory                        memory         = VK_NULL_HANDLE;
+    VulkanResourceAllocator::ResourceData allocator_data = 0;
+
+    if (memory_info != nullptr)
+    {
+        ApplyPendingMemoryFills(memory_info->capture_id);
+
+        memory         = memory_info->handle;
+        allocator_data = memory_info->allocator_data;
+
+        memory_info->allocator_data = 0;
+    }
+
+    allocator->FreeMemory(memory, GetAllocationCallbacks(pAllocator), allocator_data);
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyShaderModule(
+    PFN_vkDestroyShaderModule                                  func,
+    const DeviceInfo*                                          device_info,
+    const ShaderModuleInfo*                                    shader_module_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert(device_info != nullptr);
+
+    WaitForAsyncPipelineCreation();
+
+    VkShaderModule shader_module = (shader_module_info != nullptr) ? shader_module_info->handle : VK_NULL_HANDLE;
+
+    func(device_info->handle, shader_module, GetAllocationCallbacks(pAllocator));
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyPipelineCache(
+    PFN_vkDestroyPipelineCache                                 func,
+    const DeviceInfo*                                          device_info,
+    const PipelineCacheInfo*                                   cache_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert(device_info != nullptr);
+
+    WaitForAsyncPipelineCreation();
+
+    VkPipelineCache cache = (cache_info != nullptr) ? cache_info->handle : VK_NULL_HANDLE;
+
+    if ((device_info->replay_pipeline_cache != VK_NULL_HANDLE) && (cache != VK_NULL_HANDLE))
+    {
+        // Keep the pipelines of the destroyed cache for future replays.
+        GetDeviceTable(device_info->handle)
+            ->MergePipelineCaches(device_info->handle, device_info->replay_pipeline_cache, 1, &cache);
+    }
+
+    func(device_info->handle, cache, GetAllocationCallbacks(pAllocator));
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
+    PFN_vkCreateGraphicsPipelines                                     func,
+    VkResult                                                          original_result,
+    const DeviceInfo*                                                 device_info,
+    const PipelineCacheInfo*                                          cache_info,
+    uint32_t                                                          createInfoCount,
+    const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                 pPipelines)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr));
+
+    VkDevice                            device       = device_info->handle;
+    VkPipelineCache                     cache        = GetReplayPipelineCache(device_info, cache_info);
+    const VkGraphicsPipelineCreateInfo* create_infos = pCreateInfos->GetPointer();
+    const VkAllocationCallbacks*        allocator    = GetAllocationCallbacks(pAllocator);
+
+    if (ClaimWarmUpPipelines(createInfoCount, pPipelines))
+    {
+        return VK_SUCCESS;
+    }
+
+    graphics::StartupTimingReport::ScopedPhase phase(loading_trim_state_ ? options_.startup_report.get() : nullptr,
+                                                     graphics::StartupTimingReport::kStatePipelineCreation);
+
+    if (!UseAsyncPipelineCreation(createInfoCount, pPipelines))
+    {
+        return func(device, cache, createInfoCount, create_infos, allocator, pPipelines->GetHandlePointer());
+    }
+
+    CreatePipelinesAsync("vkCreateGraphicsPipelines",
+                         original_result,
+                         createInfoCount,
+                         pPipelines,
+                         [func, device, cache, createInfoCount, create_infos, allocator](VkPipeline* pipelines) {
+                             return func(device, cache, createInfoCount, create_infos, allocator, pipelines);
+                         });
+
+    // The replay result is checked when the pipelines are first used.
+    return original_result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateComputePipelines(
+    PFN_vkCreateComputePipelines                                     func,
+    VkResult                                                         original_result,
+    const DeviceInfo*                                                device_info,
+    const PipelineCacheInfo*                                         cache_info,
+    uint32_t                                                         createInfoCount,
+    const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                pPipelines)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr));
 
-    std::vector<VulkanResourceAllocator::MemoryData> allocator_datas(memoryRangeCount, 0);
+    VkDevice                           device       = device_info->handle;
+    VkPipelineCache                    cache        = GetReplayPipelineCache(device_info, cache_info);
+    const VkComputePipelineCreateInfo* create_infos = pCreateInfos->GetPointer();
+    const VkAllocationCallbacks*       allocator    = GetAllocationCallbacks(pAllocator);
 
-    for (uint32_t i = 0; i < memoryRangeCount; ++i)
+    if (ClaimWarmUpPipelines(createInfoCount, pPipelines))
     {
-        auto memory_info = object_info_table_.GetDeviceMemoryInfo(replay_range_meta_datas[i].memory);
+        return VK_SUCCESS;
+    }
 
-        if (memory_info != nullptr)
-        {
-            allocator_datas[i] = memory_info->allocator_data;
-        }
+    graphics::StartupTimingReport::ScopedPhase phase(loading_trim_state_ ? options_.startup_report.get() : nullptr,
+                                                     graphics::StartupTimingReport::kStatePipelineCreation);
+
+    if (!UseAsyncPipelineCreation(createInfoCount, pPipelines))
+    {
+        return func(device, cache, createInfoCount, create_infos, allocator, pPipelines->GetHandlePointer());
     }
 
-    auto allocator = device_info->allocator.get();
-    assert(allocator != nullptr);
+    CreatePipelinesAsync("vkCreateComputePipelines",
+                         original_result,
+                         createInfoCount,
+                         pPipelines,
+                         [func, device, cache, createInfoCount, create_infos, allocator](VkPipeline* pipelines) {
+                             return func(device, cache, createInfoCount, create_infos, allocator, pipelines);
+                         });
 
-    return allocator->InvalidateMappedMemoryRanges(
-        memoryRangeCount, pMemoryRanges->GetPointer(), allocator_datas.data());
+    // The replay result is checked when the pipelines are first used.
+    return original_result;
 }
 
-void VulkanReplayConsumerBase::OverrideFreeMemory(PFN_vkFreeMemory  func,
-                                                  const DeviceInfo* device_info,
-                                                  DeviceMemoryInfo* memory_info,
-                                                  const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+void VulkanReplayConsumerBase::OverrideDestroyPipelineLayout(
+    PFN_vkDestroyPipelineLayout                                func,
+    const DeviceInfo*                                          device_info,
+    const PipelineLayoutInfo*                                  pipeline_layout_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(func);
+    GFXRECON_INSTRUMENT_FUNCTION();
 
     assert(device_info != nullptr);
 
-    auto allocator = device_info->allocator.get();
-    assert(allocator != nullptr);
+    WaitForAsyncPipelineCreation();
 
-    VkDeviceMemory                        memory         = VK_NULL_HANDLE;
-    VulkanResourceAllocator::ResourceData allocator_data = 0;
+    VkPipelineLayout layout = (pipeline_layout_info != nullptr) ? pipeline_layout_info->handle : VK_NULL_HANDLE;
 
-    if (memory_info != nullptr)
-    {
-        memory         = memory_info->handle;
-        allocator_data = memory_info->allocator_data;
+    func(device_info->handle, layout, GetAllocationCallbacks(pAllocator));
+}
 
-        memory_info->allocator_data = 0;
-    }
+void VulkanReplayConsumerBase::OverrideDestroyRenderPass(
+    PFN_vkDestroyRenderPass                                    func,
+    const DeviceInfo*                                          device_info,
+    const RenderPassInfo*                                      render_pass_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
 
-    allocator->FreeMemory(memory, GetAllocationCallbacks(pAllocator), allocator_data);
+    assert(device_info != nullptr);
+
+    WaitForAsyncPipelineCreation();
+
+    VkRenderPass render_pass = (render_pass_info != nullptr) ? render_pass_info->handle : VK_NULL_HANDLE;
+
+    func(device_info->handle, render_pass, GetAllocationCallbacks(pAllocator));
 }
 
 VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory(PFN_vkBindBufferMemory func,
@@ -3700,6 +7517,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory(PFN_vkBindBufferMemo
                                                             DeviceMemoryInfo*      memory_info,
                                                             VkDeviceSize           memoryOffset)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
@@ -3708,6 +7527,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory(PFN_vkBindBufferMemo
     auto allocator = device_info->allocator.get();
     assert(allocator != nullptr);
 
+    ApplyPendingMemoryFills(memory_info->capture_id);
+
     VkResult result = allocator->BindBufferMemory(buffer_info->handle,
                                                   memory_info->handle,
                                                   memoryOffset,
@@ -3715,7 +7536,12 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory(PFN_vkBindBufferMemo
                                                   memory_info->allocator_data,
                                                   &buffer_info->memory_property_flags);
 
-    if ((result != VK_SUCCESS) && (original_result == VK_SUCCESS))
+    if (result == VK_SUCCESS)
+    {
+        buffer_info->bound_memory_id     = memory_info->capture_id;
+        buffer_info->bound_memory_offset = memoryOffset;
+    }
+    else if (original_result == VK_SUCCESS)
     {
         // When bind fails at replay, but succeeded at capture, check for memory incompatibilities and recommend
         // enabling memory translation.
@@ -3733,6 +7559,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory2(
     uint32_t                                                    bindInfoCount,
     const StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
@@ -3766,6 +7594,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory2(
         if (memory_info != nullptr)
         {
             allocator_memory_datas[i] = memory_info->allocator_data;
+
+            ApplyPendingMemoryFills(memory_info->capture_id);
         }
     }
 
@@ -3787,6 +7617,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory2(
             if (buffer_info != nullptr)
             {
                 buffer_info->memory_property_flags = memory_property_flags[i];
+                buffer_info->bound_memory_id       = replay_bind_meta_infos[i].memory;
+                buffer_info->bound_memory_offset   = replay_bind_infos[i].memoryOffset;
             }
         }
     }
@@ -3808,6 +7640,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory(PFN_vkBindImageMemory
                                                            DeviceMemoryInfo*     memory_info,
                                                            VkDeviceSize          memoryOffset)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
@@ -3816,6 +7650,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory(PFN_vkBindImageMemory
     auto allocator = device_info->allocator.get();
     assert(allocator != nullptr);
 
+    ApplyPendingMemoryFills(memory_info->capture_id);
+
     VkResult result = allocator->BindImageMemory(image_info->handle,
                                                  memory_info->handle,
                                                  memoryOffset,
@@ -3823,7 +7659,12 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory(PFN_vkBindImageMemory
                                                  memory_info->allocator_data,
                                                  &image_info->memory_property_flags);
 
-    if ((result != VK_SUCCESS) && (original_result == VK_SUCCESS))
+    if (result == VK_SUCCESS)
+    {
+        image_info->bound_memory_id     = memory_info->capture_id;
+        image_info->bound_memory_offset = memoryOffset;
+    }
+    else if (original_result == VK_SUCCESS)
     {
         // When bind fails at replay, but succeeded at capture, check for memory incompatibilities and recommend
         // enabling memory translation.
@@ -3841,6 +7682,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory2(
     uint32_t                                                   bindInfoCount,
     const StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
@@ -3874,6 +7717,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory2(
         if (memory_info != nullptr)
         {
             allocator_memory_datas[i] = memory_info->allocator_data;
+
+            ApplyPendingMemoryFills(memory_info->capture_id);
         }
     }
 
@@ -3896,6 +7741,8 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory2(
             if (image_info != nullptr)
             {
                 image_info->memory_property_flags = memory_property_flags[i];
+                image_info->bound_memory_id       = replay_bind_meta_infos[i].memory;
+                image_info->bound_memory_offset   = replay_bind_infos[i].memoryOffset;
             }
         }
     }
@@ -3996,7 +7843,9 @@ VulkanReplayConsumerBase::OverrideCreateBuffer(PFN_vkCreateBuffer
         assert(buffer_info != nullptr);
 
         buffer_info->allocator_data = allocator_data;
+        buffer_info->size           = replay_create_info->size;
         buffer_info->usage          = replay_create_info->usage;
+        buffer_info->sharing_mode   = replay_create_info->sharingMode;
 
         if ((replay_create_info->sharingMode == VK_SHARING_MODE_CONCURRENT) &&
             (replay_create_info->queueFamilyIndexCount > 0) && (replay_create_info->pQueueFamilyIndices != nullptr))
@@ -4018,6 +7867,8 @@ void VulkanReplayConsumerBase::OverrideDestroyBuffer(
     BufferInfo*                                                buffer_info,
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert(device_info != nullptr);
@@ -4034,6 +7885,12 @@ void VulkanReplayConsumerBase::OverrideDestroyBuffer(
         allocator_data = buffer_info->allocator_data;
 
         buffer_info->allocator_data = 0;
+
+        VulkanAddressPatcher* patcher = GetAddressPatcher(buffer_info->parent_id);
+        if (patcher != nullptr)
+        {
+            patcher->RemoveBuffer(buffer);
+        }
     }
 
     allocator->DestroyBuffer(buffer, GetAllocationCallbacks(pAllocator), allocator_data);
@@ -4079,6 +7936,7 @@ VulkanReplayConsumerBase::OverrideCreateImage(PFN_vkCreateImage
         image_info->initial_layout = replay_create_info->initialLayout;
         image_info->layer_count    = replay_create_info->arrayLayers;
         image_info->level_count    = replay_create_info->mipLevels;
+        image_info->sharing_mode   = replay_create_info->sharingMode;
 
         if ((replay_create_info->sharingMode == VK_SHARING_MODE_CONCURRENT) &&
             (replay_create_info->queueFamilyIndexCount > 0) && (replay_create_info->pQueueFamilyIndices != nullptr))
@@ -4100,6 +7958,8 @@ void VulkanReplayConsumerBase::OverrideDestroyImage(
     ImageInfo*                                                 image_info,
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert(device_info != nullptr);
@@ -4128,6 +7988,8 @@ void VulkanReplayConsumerBase::OverrideGetImageSubresourceLayout(
     const StructPointerDecoder<Decoded_VkImageSubresource>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout>*      pLayout)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert((device_info != nullptr) && (image_info != nullptr) && (pSubresource != nullptr) &&
@@ -4152,6 +8014,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateDescriptorUpdateTemplate(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*                pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>*                         pDescriptorUpdateTemplate)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (pCreateInfo != nullptr) && (pDescriptorUpdateTemplate != nullptr) &&
@@ -4290,6 +8154,8 @@ void VulkanReplayConsumerBase::OverrideDestroyDescriptorUpdateTemplate(
     const DescriptorUpdateTemplateInfo*                        descriptor_update_template_info,
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert(device_info != nullptr);
 
     VkDevice                   device                     = device_info->handle;
@@ -4311,6 +8177,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateShaderModule(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
     HandlePointerDecoder<VkShaderModule>*                         pShaderModule)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() &&
@@ -4358,6 +8226,8 @@ VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelin
                                                                 PointerDecoder<size_t>*    pDataSize,
                                                                 PointerDecoder<uint8_t>*   pData)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     if (options_.omit_pipeline_cache_data)
     {
         return original_result;
@@ -4377,6 +8247,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*     pAllocator,
     HandlePointerDecoder<VkPipelineCache>*                         pPipelineCache)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (pCreateInfo != nullptr) && (pPipelineCache != nullptr) &&
@@ -4384,7 +8256,20 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
 
     auto replay_create_info = pCreateInfo->GetPointer();
 
-    if (options_.omit_pipeline_cache_data && (replay_create_info != nullptr))
+    if (!device_info->replay_pipeline_cache_data.empty() && (replay_create_info != nullptr))
+    {
+        // Replace the captured cache data with the data that was saved by a previous replay on the same device and
+        // driver.
+        VkPipelineCacheCreateInfo override_create_info = (*replay_create_info);
+        override_create_info.initialDataSize           = device_info->replay_pipeline_cache_data.size();
+        override_create_info.pInitialData              = device_info->replay_pipeline_cache_data.data();
+
+        return func(device_info->handle,
+                    &override_create_info,
+                    GetAllocationCallbacks(pAllocator),
+                    pPipelineCache->GetHandlePointer());
+    }
+    else if (options_.omit_pipeline_cache_data && (replay_create_info != nullptr))
     {
         // Make a shallow copy of the create info structure and clear the cache data.
         VkPipelineCacheCreateInfo override_create_info = (*replay_create_info);
@@ -4411,6 +8296,8 @@ VkResult VulkanReplayConsumerBase::OverrideResetDescriptorPool(PFN_vkResetDescri
                                                                DescriptorPoolInfo*        pool_info,
                                                                VkDescriptorPoolResetFlags flags)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (pool_info != nullptr));
@@ -4434,6 +8321,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateDebugReportCallbackEXT(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*              pAllocator,
     HandlePointerDecoder<VkDebugReportCallbackEXT>*                         pCallback)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((instance_info != nullptr) && (pCreateInfo != nullptr) && (pCallback != nullptr) &&
@@ -4465,6 +8354,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateDebugUtilsMessengerEXT(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*              pAllocator,
     HandlePointerDecoder<VkDebugUtilsMessengerEXT>*                         pMessenger)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((instance_info != nullptr) && (pCreateInfo != nullptr) && (pMessenger != nullptr) &&
@@ -4495,6 +8386,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateSwapchainKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*                         pSwapchain)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pSwapchain != nullptr) &&
@@ -4506,8 +8399,9 @@ VkResult VulkanReplayConsumerBase::OverrideCreateSwapchainKHR(
     auto     swapchain_info     = reinterpret_cast<SwapchainKHRInfo*>(pSwapchain->GetConsumerData(0));
     assert(swapchain_info != nullptr);
 
-    // Ignore swapchain creation if surface creation was skipped when rendering is restricted to a specific surface.
-    if (replay_create_info->surface != VK_NULL_HANDLE)
+    // Ignore swapchain creation if surface creation was skipped when rendering is restricted to a specific surface, or
+    // if swapchains are being emulated with offscreen images.
+    if ((replay_create_info->surface != VK_NULL_HANDLE) && !UseVirtualSwapchains())
     {
         // Ensure that the window has been resized properly.  For Android, this ensures that we will set the proper
         // screen orientation when the swapchain pre-transform specifies a 90 or 270 degree rotation for older files
@@ -4536,8 +8430,27 @@ VkResult VulkanReplayConsumerBase::OverrideCreateSwapchainKHR(
     }
     else
     {
-        GFXRECON_LOG_INFO("Skipping creation for swapchain (ID = %" PRIu64 "), which is backed by a disabled surface",
-                          swapchain_info->capture_id);
+        if (options_.virtual_swapchain)
+        {
+            GFXRECON_LOG_INFO("Creating virtual swapchain (ID = %" PRIu64 "), which will not be presented",
+                              swapchain_info->capture_id);
+        }
+        else if (replay_create_info->surface != VK_NULL_HANDLE)
+        {
+            // The present mode is overridden, so the backing images are copied to a swapchain that is created with
+            // the replacement present mode.
+            result = CreatePresentSwapchain(device_info, swapchain_info, pCreateInfo, pAllocator);
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_INFO("Skipping creation for swapchain (ID = %" PRIu64
+                              "), which is backed by a disabled surface",
+                              swapchain_info->capture_id);
+        }
 
         // Set fax handle data to find uncreated swapchain later.
         // Possible colision of handles from driver, but should not occur starting with uint max.
@@ -4550,6 +8463,13 @@ VkResult VulkanReplayConsumerBase::OverrideCreateSwapchainKHR(
         swapchain_info->image_array_layers = replay_create_info->imageArrayLayers;
         swapchain_info->image_usage        = replay_create_info->imageUsage;
         swapchain_info->image_sharing_mode = replay_create_info->imageSharingMode;
+
+        if ((screenshot_handler_ != nullptr) || (swapchain_info->present_swapchain != VK_NULL_HANDLE))
+        {
+            // Screenshots or present copies are active, so ensure that the backing images can be used as a transfer
+            // source.
+            swapchain_info->image_usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        }
     }
 
     if ((result == VK_SUCCESS) && (replay_create_info != nullptr) && ((*replay_swapchain) != VK_NULL_HANDLE))
@@ -4564,7 +8484,11 @@ VkResult VulkanReplayConsumerBase::OverrideCreateSwapchainKHR(
             swapchain_info->queue_family_index = 0;
         }
 
-        swapchain_info->surface     = replay_create_info->surface;
+        if (!UseVirtualSwapchains())
+        {
+            swapchain_info->surface = replay_create_info->surface;
+        }
+
         swapchain_info->device_info = device_info;
         swapchain_info->width       = replay_create_info->imageExtent.width;
         swapchain_info->height      = replay_create_info->imageExtent.height;
@@ -4580,6 +8504,8 @@ void VulkanReplayConsumerBase::OverrideDestroySwapchainKHR(
     const SwapchainKHRInfo*                                    swapchain_info,
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert(device_info != nullptr);
 
     VkDevice       device    = device_info->handle;
@@ -4592,12 +8518,30 @@ void VulkanReplayConsumerBase::OverrideDestroySwapchainKHR(
         surface   = swapchain_info->surface;
     }
 
+    // The swapchain images may still be used by a state initialization when a trimmed state load destroys a swapchain.
+    if (!pending_swapchain_image_inits_.empty())
+    {
+        CompleteSwapchainImageInits(device);
+    }
+
     // Delete backed images of dummy swapchain.
     if ((swapchain_info != nullptr) && (surface == VK_NULL_HANDLE))
     {
         auto allocator = device_info->allocator.get();
         assert(allocator != nullptr);
 
+        // Wait for the copies from the backing images before destroying the swapchain that presents them.
+        if (swapchain_info->present_swapchain != VK_NULL_HANDLE)
+        {
+            auto copier_entry = present_image_copiers_.find(device);
+            if (copier_entry != present_image_copiers_.end())
+            {
+                copier_entry->second->RemoveSwapchain(swapchain_info->present_swapchain);
+            }
+
+            func(device, swapchain_info->present_swapchain, GetAllocationCallbacks(pAllocator));
+        }
+
         for (const ImageInfo& image_info : swapchain_info->image_infos)
         {
             allocator->DestroyImageDirect(image_info.handle, nullptr, image_info.allocator_data);
@@ -4617,6 +8561,8 @@ VkResult VulkanReplayConsumerBase::OverrideGetSwapchainImagesKHR(PFN_vkGetSwapch
                                                                  PointerDecoder<uint32_t>*      pSwapchainImageCount,
                                                                  HandlePointerDecoder<VkImage>* pSwapchainImages)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (swapchain_info != nullptr) && (pSwapchainImageCount != nullptr) &&
@@ -4686,6 +8632,13 @@ VkResult VulkanReplayConsumerBase::OverrideGetSwapchainImagesKHR(PFN_vkGetSwapch
 
                 // Create a copy of the image info to use for image cleanup when the swapchain is destroyed.
                 swapchain_info->image_infos.push_back(*image_info);
+
+                // Store image handles for screenshot generation.  The backing images are never reordered by an
+                // acquire, so the captured image index can be used directly.
+                if (screenshot_handler_ != nullptr)
+                {
+                    swapchain_info->images.push_back(*replay_image);
+                }
             }
         }
     }
@@ -4737,6 +8690,8 @@ VkResult VulkanReplayConsumerBase::OverrideAcquireNextImageKHR(PFN_vkAcquireNext
                                                                FenceInfo*                fence_info,
                                                                PointerDecoder<uint32_t>* pImageIndex)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert(swapchain_info != nullptr);
 
     VkResult result = VK_SUCCESS;
@@ -4829,6 +8784,8 @@ VkResult VulkanReplayConsumerBase::OverrideAcquireNextImage2KHR(
     const StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
     PointerDecoder<uint32_t>*                                      pImageIndex)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert((pAcquireInfo != nullptr) && !pAcquireInfo->IsNull());
 
     VkResult          result            = VK_SUCCESS;
@@ -4948,6 +8905,15 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
     std::vector<VkPresentTimeGOOGLE>  modified_times;
     std::vector<const SemaphoreInfo*> removed_semaphores;
     std::unordered_set<uint32_t>      removed_swapchain_indices;
+    int64_t                           present_start_time = 0;
+
+    std::vector<VulkanPresentImageCopier::Copy> present_copies;
+    VulkanPresentImageCopier*                   present_copier = nullptr;
+
+    if (timing_report_ != nullptr)
+    {
+        present_start_time = util::datetime::GetTimestamp();
+    }
 
     if ((screenshot_handler_ != nullptr) && (screenshot_handler_->IsScreenshotFrame()))
     {
@@ -4957,8 +8923,9 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
         WriteScreenshots(meta_info);
     }
 
-    // If rendering is restricted to a specific surface, need to check for dummy swapchains at present.
-    if (options_.surface_index != -1)
+    // If rendering is restricted to a specific surface, or swapchains are virtual, need to check for dummy swapchains
+    // at present.
+    if (HasDummySwapchains())
     {
         const auto swapchain_ids = present_info_data->pSwapchains.GetPointer();
         for (uint32_t i = 0; i < present_info->swapchainCount; ++i)
@@ -4974,6 +8941,25 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
             else
             {
                 removed_swapchain_indices.insert(i);
+
+                // Virtual swapchains of an overridden present mode are presented by copying the backing image for the
+                // captured image index to a swapchain that was created with the replacement present mode.
+                uint32_t image_index = present_info->pImageIndices[i];
+                if ((swapchain_info != nullptr) && (swapchain_info->present_swapchain != VK_NULL_HANDLE) &&
+                    (image_index < swapchain_info->image_infos.size()))
+                {
+                    auto copier_entry = present_image_copiers_.find(swapchain_info->device_info->handle);
+                    assert(copier_entry != present_image_copiers_.end());
+                    present_copier = copier_entry->second.get();
+
+                    VulkanPresentImageCopier::Copy copy;
+                    copy.swapchain   = swapchain_info->present_swapchain;
+                    copy.source      = swapchain_info->image_infos[image_index].handle;
+                    copy.width       = swapchain_info->width;
+                    copy.height      = swapchain_info->height;
+                    copy.layer_count = swapchain_info->image_array_layers;
+                    present_copies.push_back(copy);
+                }
             }
         }
 
@@ -5097,6 +9083,31 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
     {
         result = func(queue_info->handle, &modified_present_info);
     }
+    else if ((modified_present_info.swapchainCount == 0) && (present_copier != nullptr))
+    {
+        // The copy submission waits on the present's semaphores, except for the semaphores that were only signaled by
+        // the emulated acquire or that were imported.
+        GetImportedSemaphores(present_info_data->pWaitSemaphores, &removed_semaphores);
+        GetShadowSemaphores(present_info_data->pWaitSemaphores, &removed_semaphores);
+
+        std::vector<VkSemaphore> wait_semaphores;
+        for (uint32_t i = 0; i < present_info->waitSemaphoreCount; ++i)
+        {
+            VkSemaphore semaphore = present_info->pWaitSemaphores[i];
+            if (std::find_if(removed_semaphores.begin(),
+                             removed_semaphores.end(),
+                             [semaphore](const SemaphoreInfo* info) { return info->handle == semaphore; }) ==
+                removed_semaphores.end())
+            {
+                wait_semaphores.push_back(semaphore);
+            }
+        }
+
+        result = present_copier->Present(queue_info->handle,
+                                         static_cast<uint32_t>(wait_semaphores.size()),
+                                         wait_semaphores.data(),
+                                         present_copies);
+    }
     else if (modified_present_info.swapchainCount == 0)
     {
         // No need to progress farther if there is no valid swapchain to present.
@@ -5146,8 +9157,8 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
         }
     }
 
-    // If running with surface-index on, need to track forward progress of semaphore that have been submitted
-    if (options_.surface_index != -1)
+    // If running with dummy swapchains, need to track forward progress of semaphore that have been submitted
+    if (HasDummySwapchains())
     {
         if (dispatched_command)
         {
@@ -5177,6 +9188,68 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
         screenshot_handler_->EndFrame();
     }
 
+    for (const auto& entry : submit_pacers_)
+    {
+        entry.second->EndFrame();
+    }
+
+    if (timing_report_ != nullptr)
+    {
+        int64_t present_end_time = util::datetime::GetTimestamp();
+
+        if (timing_report_->IsReportFrame(timing_frame_number_))
+        {
+            // The present interval is not known for the first presented frame.
+            int64_t present_interval =
+                (last_present_time_ != 0) ? util::datetime::DiffTimestamps(last_present_time_, present_end_time) : 0;
+
+            timing_report_->AddFrame(timing_frame_number_,
+                                     util::datetime::DiffTimestamps(frame_start_time_, present_start_time),
+                                     present_interval);
+
+            for (const auto& entry : submit_timers_)
+            {
+                entry.second->EndFrame(timing_frame_number_);
+                AddGpuFrameTimes(entry.second.get(), false);
+            }
+        }
+
+        frame_start_time_  = present_end_time;
+        last_present_time_ = present_end_time;
+    }
+
+    if (pass_timing_report_ != nullptr)
+    {
+        for (const auto& entry : pass_timers_)
+        {
+            AddGpuPassTimes(entry.second.get(), false);
+        }
+    }
+
+    if (options_.memory_report != nullptr)
+    {
+        UpdateMemoryUsage();
+        options_.memory_report->EndFrame(timing_frame_number_);
+    }
+
+    if ((timing_report_ != nullptr) || (pass_timing_report_ != nullptr) || (options_.memory_report != nullptr))
+    {
+        ++timing_frame_number_;
+    }
+
+    ++debug_label_frame_number_;
+    debug_label_submit_index_ = 0;
+
+    if ((options_.startup_report != nullptr) && !options_.startup_report->HasFirstPresent())
+    {
+        options_.startup_report->SetFirstPresent();
+        options_.startup_report->Write();
+    }
+
+    // Pipelines that are created ahead of replay are started at frame boundaries, when the objects that they use are
+    // most likely to have been created.
+    SubmitWarmUpPipelines();
+
     return result;
 }
 
@@ -5186,6 +9259,8 @@ VkResult VulkanReplayConsumerBase::OverrideImportSemaphoreFdKHR(
     const DeviceInfo*                                               device_info,
     const StructPointerDecoder<Decoded_VkImportSemaphoreFdInfoKHR>* pImportSemaphoreFdInfo)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     // Skip external semaphore import.  There is no actual file descriptor backing it in replay.
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(device_info);
@@ -5217,6 +9292,8 @@ VkResult VulkanReplayConsumerBase::OverrideGetSemaphoreFdKHR(
     const StructPointerDecoder<Decoded_VkSemaphoreGetFdInfoKHR>* pGetFdInfo,
     const PointerDecoder<int>*                                   pFd)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     // Skip external semaphore file descriptor acquire so that replay is not responsible for closing the file
     // descriptor.
     // From spec:
@@ -5235,6 +9312,8 @@ VkResult VulkanReplayConsumerBase::OverrideImportSemaphoreWin32HandleKHR(
     const DeviceInfo*                                                        device_info,
     const StructPointerDecoder<Decoded_VkImportSemaphoreWin32HandleInfoKHR>* pImportSemaphoreWin32HandleInfo)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     // Skip external semaphore import.  There is no actual OS resource backing it in replay.
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(device_info);
@@ -5266,6 +9345,8 @@ VkResult VulkanReplayConsumerBase::OverrideGetSemaphoreWin32HandleKHR(
     const StructPointerDecoder<Decoded_VkSemaphoreGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     const PointerDecoder<uint64_t, void*>*                                pHandle)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     // Skip external semaphore handle acquire so that replay is not responsible for closing the handle.
     // From spec:
     //      To avoid leaking resources, the application must release ownership
@@ -5284,6 +9365,8 @@ VkResult VulkanReplayConsumerBase::OverrideGetRandROutputDisplayEXT(PFN_vkGetRan
                                                                     RROutput                            rrOutput,
                                                                     HandlePointerDecoder<VkDisplayKHR>* pDisplay)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(physicalDevice);
     GFXRECON_UNREFERENCED_PARAMETER(dpy);
@@ -5300,6 +9383,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateAndroidSurfaceKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*         pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*                                pSurface)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
     GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
@@ -5321,6 +9406,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateWin32SurfaceKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*                              pSurface)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
     GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
@@ -5339,6 +9426,8 @@ VkBool32 VulkanReplayConsumerBase::OverrideGetPhysicalDeviceWin32PresentationSup
     const PhysicalDeviceInfo*                          physical_device_info,
     uint32_t                                           queueFamilyIndex)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
 
     assert(physical_device_info != nullptr);
@@ -5357,6 +9446,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateXcbSurfaceKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*     pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*                            pSurface)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
     GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
@@ -5377,6 +9468,8 @@ VkBool32 VulkanReplayConsumerBase::OverrideGetPhysicalDeviceXcbPresentationSuppo
     xcb_connection_t*                                connection,
     xcb_visualid_t                                   visual_id)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(connection);
     GFXRECON_UNREFERENCED_PARAMETER(visual_id);
@@ -5397,6 +9490,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateXlibSurfaceKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*      pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*                             pSurface)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
     GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
@@ -5417,6 +9512,8 @@ VkBool32 VulkanReplayConsumerBase::OverrideGetPhysicalDeviceXlibPresentationSupp
     Display*                                          dpy,
     VisualID                                          visualID)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(dpy);
     GFXRECON_UNREFERENCED_PARAMETER(visualID);
@@ -5437,6 +9534,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateWaylandSurfaceKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*         pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*                                pSurface)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
     GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
@@ -5456,6 +9555,8 @@ VkBool32 VulkanReplayConsumerBase::OverrideGetPhysicalDeviceWaylandPresentationS
     uint32_t                                             queueFamilyIndex,
     struct wl_display*                                   display)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(func);
     GFXRECON_UNREFERENCED_PARAMETER(display);
 
@@ -5473,6 +9574,8 @@ void VulkanReplayConsumerBase::OverrideDestroySurfaceKHR(
     const SurfaceKHRInfo*                                      surface_info,
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert(instance_info != nullptr);
 
     VkInstance   instance = instance_info->handle;
@@ -5505,6 +9608,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateAccelerationStructureKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*                pAllocator,
     HandlePointerDecoder<VkAccelerationStructureKHR>*                         pAccelerationStructureKHR)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (pCreateInfo != nullptr) && (pAccelerationStructureKHR != nullptr) &&
@@ -5558,6 +9663,8 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesKHR(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*             pAllocator,
     HandlePointerDecoder<VkPipeline>*                                      pPipelines)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     GFXRECON_UNREFERENCED_PARAMETER(original_result);
 
     assert((device_info != nullptr) && (pCreateInfos != nullptr) && (pAllocator != nullptr) &&
@@ -5571,7 +9678,10 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesKHR(
     VkPipeline*                              out_pPipelines  = pPipelines->GetHandlePointer();
     VkDeferredOperationKHR                   in_deferredOperation =
         (deferred_operation_info != nullptr) ? deferred_operation_info->handle : VK_NULL_HANDLE;
-    VkPipelineCache in_pipelineCache = (pipeline_cache_info != nullptr) ? pipeline_cache_info->handle : VK_NULL_HANDLE;
+    VkPipelineCache in_pipelineCache = GetReplayPipelineCache(device_info, pipeline_cache_info);
+
+    graphics::StartupTimingReport::ScopedPhase phase(loading_trim_state_ ? options_.startup_report.get() : nullptr,
+                                                     graphics::StartupTimingReport::kStatePipelineCreation);
 
     if (device_info->property_feature_info.feature_rayTracingPipelineShaderGroupHandleCaptureReplay)
     {
@@ -5653,12 +9763,22 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesKHR(
 
 VkDeviceAddress VulkanReplayConsumerBase::OverrideGetBufferDeviceAddress(
     PFN_vkGetBufferDeviceAddress                                   func,
+    VkDeviceAddress                                                original_result,
     const DeviceInfo*                                              device_info,
     const StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert((device_info != nullptr) && (pInfo != nullptr) && !pInfo->IsNull() && (pInfo->GetPointer() != nullptr));
 
-    if (!device_info->property_feature_info.feature_bufferDeviceAddressCaptureReplay)
+    VulkanAddressPatcher* patcher = GetAddressPatcher(device_info->capture_id);
+
+    if (patcher != nullptr)
+    {
+        GFXRECON_LOG_INFO_ONCE("The captured application used vkGetBufferDeviceAddress. Captured device addresses "
+                               "will be remapped to replay device addresses.");
+    }
+    else if (!device_info->property_feature_info.feature_bufferDeviceAddressCaptureReplay)
     {
         GFXRECON_LOG_ERROR_ONCE("The captured application used vkGetBufferDeviceAddress, which requires the "
                                 "bufferDeviceAddressCaptureReplay feature for accurate capture and replay. The "
@@ -5675,17 +9795,34 @@ VkDeviceAddress VulkanReplayConsumerBase::OverrideGetBufferDeviceAddress(
     VkDevice                         device       = device_info->handle;
     const VkBufferDeviceAddressInfo* address_info = pInfo->GetPointer();
 
-    return func(device, address_info);
+    VkDeviceAddress result = func(device, address_info);
+
+    if (patcher != nullptr)
+    {
+        const BufferInfo* buffer_info = object_info_table_.GetBufferInfo(pInfo->GetMetaStructPointer()->buffer);
+
+        if (buffer_info != nullptr)
+        {
+            patcher->AddBufferAddress(buffer_info->handle, buffer_info->size, original_result, result);
+        }
+    }
+
+    return result;
 }
 
-void VulkanReplayConsumerBase::OverrideGetAccelerationStructureDeviceAddressKHR(
+VkDeviceAddress VulkanReplayConsumerBase::OverrideGetAccelerationStructureDeviceAddressKHR(
     PFN_vkGetAccelerationStructureDeviceAddressKHR                                   func,
+    VkDeviceAddress                                                                  original_result,
     const DeviceInfo*                                                                device_info,
     const StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     assert((device_info != nullptr) && (pInfo != nullptr) && !pInfo->IsNull() && (pInfo->GetPointer() != nullptr));
 
-    if (!device_info->property_feature_info.feature_accelerationStructureCaptureReplay)
+    VulkanAddressPatcher* patcher = GetAddressPatcher(device_info->capture_id);
+
+    if ((patcher == nullptr) && !device_info->property_feature_info.feature_accelerationStructureCaptureReplay)
     {
         GFXRECON_LOG_WARNING_ONCE("The captured application used vkGetAccelerationStructureDeviceAddressKHR, which may "
                                   "require the accelerationStructureCaptureReplay feature for accurate capture and "
@@ -5702,7 +9839,14 @@ void VulkanReplayConsumerBase::OverrideGetAccelerationStructureDeviceAddressKHR(
     VkDevice                                           device       = device_info->handle;
     const VkAccelerationStructureDeviceAddressInfoKHR* address_info = pInfo->GetPointer();
 
-    func(device, address_info);
+    VkDeviceAddress result = func(device, address_info);
+
+    if (patcher != nullptr)
+    {
+        patcher->AddAccelerationStructureAddress(original_result, result);
+    }
+
+    return result;
 }
 
 VkResult
@@ -5730,7 +9874,184 @@ VulkanReplayConsumerBase::OverrideGetRayTracingShaderGroupHandlesKHR(PFN_vkGetRa
     VkPipeline pipeline    = pipeline_info->handle;
     uint8_t*   output_data = pData->GetOutputPointer();
 
-    return func(device, pipeline, firstGroup, groupCount, dataSize, output_data);
+    VkResult result = func(device, pipeline, firstGroup, groupCount, dataSize, output_data);
+
+    // Handles that differ from the captured handles are replaced in the shader binding tables of trace rays commands.
+    VulkanAddressPatcher* patcher = GetAddressPatcher(device_info->capture_id);
+    if ((patcher != nullptr) && (result == VK_SUCCESS))
+    {
+        patcher->AddShaderGroupHandles(
+            pipeline_info->capture_id, groupCount, dataSize, pData->GetPointer(), output_data);
+    }
+
+    return result;
+}
+
+void VulkanReplayConsumerBase::OverrideCmdBuildAccelerationStructuresKHR(
+    PFN_vkCmdBuildAccelerationStructuresKHR                                          func,
+    const CommandBufferInfo*                                                         command_buffer_info,
+    uint32_t                                                                         infoCount,
+    const StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
+    const StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>*   ppBuildRangeInfos)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((command_buffer_info != nullptr) && (pInfos != nullptr) && (ppBuildRangeInfos != nullptr));
+
+    VkCommandBuffer                                        command_buffer    = command_buffer_info->handle;
+    const VkAccelerationStructureBuildGeometryInfoKHR*     build_infos       = pInfos->GetPointer();
+    const VkAccelerationStructureBuildRangeInfoKHR* const* build_range_infos = ppBuildRangeInfos->GetPointer();
+    VulkanAddressPatcher*                                  patcher = GetAddressPatcher(command_buffer_info->parent_id);
+
+    VulkanAccelStructCache* accel_struct_cache = GetAccelStructCache(command_buffer_info->parent_id);
+    std::vector<bool>       replaced;
+
+    // The cache is keyed by the captured build parameters, so it is consulted before the addresses are remapped.
+    if ((accel_struct_cache != nullptr) && (build_infos != nullptr))
+    {
+        const Decoded_VkAccelerationStructureBuildGeometryInfoKHR* build_infos_meta = pInfos->GetMetaStructPointer();
+        std::vector<format::HandleId>                              dst_ids(infoCount, format::kNullHandleId);
+
+        for (uint32_t i = 0; (i < infoCount) && (build_infos_meta != nullptr); ++i)
+        {
+            dst_ids[i] = build_infos_meta[i].dstAccelerationStructure;
+        }
+
+        accel_struct_cache->RecordBuilds(
+            command_buffer, infoCount, build_infos, build_range_infos, dst_ids.data(), &replaced);
+    }
+
+    std::vector<VkAccelerationStructureBuildGeometryInfoKHR>     remapped_infos;
+    std::vector<std::vector<VkAccelerationStructureGeometryKHR>> remapped_geometry;
+
+    if ((patcher != nullptr) && (build_infos != nullptr))
+    {
+        patcher->RemapBuildGeometry(
+            command_buffer, infoCount, build_infos, build_range_infos, &remapped_infos, &remapped_geometry);
+
+        build_infos = remapped_infos.data();
+    }
+
+    if (std::find(replaced.begin(), replaced.end(), true) != replaced.end())
+    {
+        // Omit the builds that were replaced by the deserialization of cached acceleration structures.
+        std::vector<VkAccelerationStructureBuildGeometryInfoKHR>     remaining_infos;
+        std::vector<const VkAccelerationStructureBuildRangeInfoKHR*> remaining_range_infos;
+
+        for (uint32_t i = 0; i < infoCount; ++i)
+        {
+            if (!replaced[i])
+            {
+                remaining_infos.push_back(build_infos[i]);
+                remaining_range_infos.push_back(build_range_infos[i]);
+            }
+        }
+
+        if (!remaining_infos.empty())
+        {
+            func(command_buffer,
+                 static_cast<uint32_t>(remaining_infos.size()),
+                 remaining_infos.data(),
+                 remaining_range_infos.data());
+        }
+    }
+    else
+    {
+        func(command_buffer, infoCount, build_infos, build_range_infos);
+    }
+}
+
+void VulkanReplayConsumerBase::OverrideCmdTraceRaysKHR(
+    PFN_vkCmdTraceRaysKHR                                                func,
+    const CommandBufferInfo*                                             command_buffer_info,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pRaygenShaderBindingTable,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pMissShaderBindingTable,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pHitShaderBindingTable,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
+    uint32_t                                                             width,
+    uint32_t                                                             height,
+    uint32_t                                                             depth)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((command_buffer_info != nullptr) && (pRaygenShaderBindingTable != nullptr) &&
+           (pMissShaderBindingTable != nullptr) && (pHitShaderBindingTable != nullptr) &&
+           (pCallableShaderBindingTable != nullptr));
+
+    VkCommandBuffer       command_buffer = command_buffer_info->handle;
+    VulkanAddressPatcher* patcher        = GetAddressPatcher(command_buffer_info->parent_id);
+
+    if (patcher != nullptr)
+    {
+        VkStridedDeviceAddressRegionKHR regions[4] = {};
+        RemapShaderBindingTables(patcher,
+                                 command_buffer,
+                                 pRaygenShaderBindingTable,
+                                 pMissShaderBindingTable,
+                                 pHitShaderBindingTable,
+                                 pCallableShaderBindingTable,
+                                 regions);
+
+        func(command_buffer, &regions[0], &regions[1], &regions[2], &regions[3], width, height, depth);
+    }
+    else
+    {
+        func(command_buffer,
+             pRaygenShaderBindingTable->GetPointer(),
+             pMissShaderBindingTable->GetPointer(),
+             pHitShaderBindingTable->GetPointer(),
+             pCallableShaderBindingTable->GetPointer(),
+             width,
+             height,
+             depth);
+    }
+}
+
+void VulkanReplayConsumerBase::OverrideCmdTraceRaysIndirectKHR(
+    PFN_vkCmdTraceRaysIndirectKHR                                        func,
+    const CommandBufferInfo*                                             command_buffer_info,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pRaygenShaderBindingTable,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pMissShaderBindingTable,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pHitShaderBindingTable,
+    const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
+    VkDeviceAddress                                                      indirectDeviceAddress)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    assert((command_buffer_info != nullptr) && (pRaygenShaderBindingTable != nullptr) &&
+           (pMissShaderBindingTable != nullptr) && (pHitShaderBindingTable != nullptr) &&
+           (pCallableShaderBindingTable != nullptr));
+
+    VkCommandBuffer       command_buffer = command_buffer_info->handle;
+    VulkanAddressPatcher* patcher        = GetAddressPatcher(command_buffer_info->parent_id);
+
+    if (patcher != nullptr)
+    {
+        VkStridedDeviceAddressRegionKHR regions[4] = {};
+        RemapShaderBindingTables(patcher,
+                                 command_buffer,
+                                 pRaygenShaderBindingTable,
+                                 pMissShaderBindingTable,
+                                 pHitShaderBindingTable,
+                                 pCallableShaderBindingTable,
+                                 regions);
+
+        func(command_buffer,
+             &regions[0],
+             &regions[1],
+             &regions[2],
+             &regions[3],
+             patcher->RemapBufferAddress(indirectDeviceAddress));
+    }
+    else
+    {
+        func(command_buffer,
+             pRaygenShaderBindingTable->GetPointer(),
+             pMissShaderBindingTable->GetPointer(),
+             pHitShaderBindingTable->GetPointer(),
+             pCallableShaderBindingTable->GetPointer(),
+             indirectDeviceAddress);
+    }
 }
 
 void VulkanReplayConsumerBase::MapDescriptorUpdateTemplateHandles(
@@ -6012,6 +10333,12 @@ void VulkanReplayConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(format:
         in_descriptorUpdateTemplate = update_template_info->handle;
     }
 
+    if (options_.skip_redundant_descriptor_updates &&
+        IsRedundantTemplateUpdate(descriptorSet, descriptorUpdateTemplate, pData))
+    {
+        return;
+    }
+
     GetDeviceTable(in_device)->UpdateDescriptorSetWithTemplate(
         in_device, in_descriptorSet, in_descriptorUpdateTemplate, pData->GetPointer());
 }
@@ -6062,6 +10389,12 @@ void VulkanReplayConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(form
         in_descriptorUpdateTemplate = update_template_info->handle;
     }
 
+    if (options_.skip_redundant_descriptor_updates &&
+        IsRedundantTemplateUpdate(descriptorSet, descriptorUpdateTemplate, pData))
+    {
+        return;
+    }
+
     GetDeviceTable(in_device)->UpdateDescriptorSetWithTemplateKHR(
         in_device, in_descriptorSet, in_descriptorUpdateTemplate, pData->GetPointer());
 }
@@ -24,23 +24,39 @@
 #ifndef GFXRECON_DECODE_VULKAN_REPLAY_CONSUMER_BASE_H
 #define GFXRECON_DECODE_VULKAN_REPLAY_CONSUMER_BASE_H
 
+#include "decode/async_pipeline_creator.h"
+#include "decode/coalesced_memory_fills.h"
 #include "decode/handle_pointer_decoder.h"
 #include "decode/pointer_decoder.h"
 #include "decode/screenshot_handler.h"
 #include "decode/swapchain_image_tracker.h"
+#include "decode/vulkan_accel_struct_cache.h"
+#include "decode/vulkan_address_patcher.h"
+#include "decode/vulkan_frame_loop_state.h"
 #include "decode/vulkan_handle_mapping_util.h"
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_object_info_table.h"
+#include "decode/vulkan_pass_timer.h"
+#include "decode/vulkan_pipeline_prescan_consumer.h"
+#include "decode/resource_init_data_reader.h"
+#include "decode/vulkan_pool_cache.h"
+#include "decode/vulkan_present_image_copier.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_resource_allocator.h"
 #include "decode/vulkan_resource_tracking_consumer.h"
 #include "decode/vulkan_resource_initializer.h"
+#include "decode/vulkan_retained_objects.h"
+#include "decode/vulkan_submit_batcher.h"
+#include "decode/vulkan_submit_pacer.h"
+#include "decode/vulkan_submit_timer.h"
 #include "decode/window.h"
 #include "format/api_call_id.h"
 #include "format/platform_types.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "generated/generated_vulkan_consumer.h"
 #include "graphics/fps_info.h"
+#include "graphics/frame_timing_report.h"
+#include "graphics/pass_timing_report.h"
 #include "util/defines.h"
 #include "util/logging.h"
 
@@ -74,10 +90,30 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
 
+    // Saves the contents of device memory before the first replay of a looped frame range, and restores the saved
+    // contents before each repeat of the range.
+    bool SaveFrameLoopState();
+
+    bool RestoreFrameLoopState();
+
+    void WaitForDevicesIdle();
+
+    // Uploads the deferred initialization data of the resources, for --lazy-resource-init.  Called with the resources
+    // that are first referenced by a queue submission, before the submission is replayed.
+    void LoadDeferredInitData(const std::vector<format::HandleId>& resource_ids);
+
+    virtual void SetCurrentBlockIndex(uint64_t block_index) override { current_block_index_ = block_index; }
+
+    virtual void SetCurrentApiCallId(format::ApiCallId call_id) override;
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) override;
 
+    virtual void ProcessFastForwardEnd(uint32_t                             frame_number,
+                                       uint64_t                             skipped_command_count,
+                                       const std::vector<format::HandleId>& incomplete_command_buffers) override;
+
     virtual void ProcessDisplayMessageCommand(const std::string& message) override;
 
     virtual void
@@ -125,6 +161,11 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                                                size_t           data_size,
                                                                const uint8_t*   data) override;
 
+    virtual void
+    ProcessSetPipelineCacheDataCommand(format::HandleId device_id, size_t data_size, const uint8_t* data) override;
+
+    virtual void ProcessTimestampCommand(uint64_t timestamp) override;
+
     virtual void
     ProcessSetSwapchainImageStateCommand(format::HandleId                                    device_id,
                                          format::HandleId                                    swapchain_id,
@@ -137,6 +178,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     virtual void ProcessEndResourceInitCommand(format::HandleId device_id) override;
 
+    virtual uint8_t*
+    GetInitBufferDataDestination(format::HandleId device_id, format::HandleId buffer_id, uint64_t data_size) override;
+
+    virtual uint8_t*
+    GetInitImageDataDestination(format::HandleId device_id, format::HandleId image_id, uint64_t data_size) override;
+
     virtual void ProcessInitBufferCommand(format::HandleId device_id,
                                           format::HandleId buffer_id,
                                           uint64_t         data_size,
@@ -150,6 +197,19 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                          const std::vector<uint64_t>& level_sizes,
                                          const uint8_t*               data) override;
 
+    virtual void ProcessDeferredInitBufferCommand(format::HandleId                device_id,
+                                                  format::HandleId                buffer_id,
+                                                  uint64_t                        data_size,
+                                                  const ResourceInitDataLocation& location) override;
+
+    virtual void ProcessDeferredInitImageCommand(format::HandleId                device_id,
+                                                 format::HandleId                image_id,
+                                                 uint64_t                        data_size,
+                                                 uint32_t                        aspect,
+                                                 uint32_t                        layout,
+                                                 const std::vector<uint64_t>&    level_sizes,
+                                                 const ResourceInitDataLocation& location) override;
+
     virtual void Process_vkUpdateDescriptorSetWithTemplate(format::HandleId                 device,
                                                            format::HandleId                 descriptorSet,
                                                            format::HandleId                 descriptorUpdateTemplate,
@@ -223,6 +283,114 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         return handles;
     }
 
+    // Retrieves the info of an object that is referenced by a command that is recorded to a command buffer, from the
+    // command buffer's cache of the most recently referenced objects when possible.
+    template <typename T>
+    T* GetCommandObjectInfo(CommandBufferInfo* command_buffer_info,
+                            format::HandleId   id,
+                            T* (VulkanObjectInfoTable::*GetInfoFunc)(format::HandleId))
+    {
+        if ((command_buffer_info == nullptr) || (id == format::kNullHandleId))
+        {
+            return (object_info_table_.*GetInfoFunc)(id);
+        }
+
+        CommandObjectInfoCache* cache = &command_buffer_info->object_cache;
+
+        if (cache->generation != object_info_table_.GetGeneration())
+        {
+            cache->Reset(object_info_table_.GetGeneration());
+        }
+
+        const void* type_key = CommandObjectInfoCache::GetTypeKey<T>();
+        T*          info     = static_cast<T*>(cache->Find(id, type_key));
+
+        if (info == nullptr)
+        {
+            info = (object_info_table_.*GetInfoFunc)(id);
+
+            if (info != nullptr)
+            {
+                cache->Insert(id, type_key, info);
+            }
+        }
+
+        return info;
+    }
+
+    template <typename T>
+    typename T::HandleType MapCommandHandle(CommandBufferInfo* command_buffer_info,
+                                            format::HandleId   id,
+                                            T* (VulkanObjectInfoTable::*GetInfoFunc)(format::HandleId))
+    {
+        typename T::HandleType handle = VK_NULL_HANDLE;
+
+        if (id != format::kNullHandleId)
+        {
+            const T* info = GetCommandObjectInfo(command_buffer_info, id, GetInfoFunc);
+
+            if (info != nullptr)
+            {
+                handle = info->handle;
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Failed to map handle for object id %" PRIu64, id);
+            }
+        }
+
+        return handle;
+    }
+
+    template <typename T>
+    typename T::HandleType* MapCommandHandles(CommandBufferInfo*                            command_buffer_info,
+                                              HandlePointerDecoder<typename T::HandleType>* handles_pointer,
+                                              size_t                                        handles_len,
+                                              T* (VulkanObjectInfoTable::*GetInfoFunc)(format::HandleId))
+    {
+        // This parameter is only referenced by debug builds.
+        GFXRECON_UNREFERENCED_PARAMETER(handles_len);
+
+        typename T::HandleType* handles = nullptr;
+
+        if ((handles_pointer != nullptr) && !handles_pointer->IsNull())
+        {
+            // The handle and ID array sizes are expected to be the same for mapping operations.
+            assert(handles_len == handles_pointer->GetLength());
+
+            size_t                  len = handles_pointer->GetLength();
+            const format::HandleId* ids = handles_pointer->GetPointer();
+
+            handles_pointer->SetHandleLength(len);
+            handles = handles_pointer->GetHandlePointer();
+
+            for (size_t i = 0; i < len; ++i)
+            {
+                handles[i] = MapCommandHandle(command_buffer_info, ids[i], GetInfoFunc);
+            }
+        }
+
+        return handles;
+    }
+
+    // Returns the handle of an info that was retrieved for an ID, reporting the IDs that could not be mapped.
+    template <typename T>
+    typename T::HandleType MapHandle(format::HandleId id, const T* info) const
+    {
+        typename T::HandleType handle = VK_NULL_HANDLE;
+
+        if (info != nullptr)
+        {
+            handle = info->handle;
+        }
+        else if (id != format::kNullHandleId)
+        {
+            GFXRECON_LOG_WARNING("Failed to map handle for object id %" PRIu64, id);
+        }
+
+        return handle;
+    }
+
     template <typename T>
     void AddHandle(format::HandleId              parent_id,
                    const format::HandleId*       id,
@@ -249,17 +417,19 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         }
     }
 
+    // The initial infos are moved to the object info table, and are expected to be allocated with DecodeAllocator so
+    // that adding the handles of a call does not allocate memory outside of the call's allocator scope.
     template <typename T>
     void AddHandles(format::HandleId              parent_id,
                     const format::HandleId*       ids,
                     size_t                        ids_len,
                     const typename T::HandleType* handles,
                     size_t                        handles_len,
-                    std::vector<T>&&              initial_infos,
+                    T*                            initial_infos,
                     void (VulkanObjectInfoTable::*AddFunc)(T&&))
     {
         handle_mapping::AddHandleArray(
-            parent_id, ids, ids_len, handles, handles_len, std::move(initial_infos), &object_info_table_, AddFunc);
+            parent_id, ids, ids_len, handles, handles_len, initial_infos, &object_info_table_, AddFunc);
     }
 
     template <typename T>
@@ -280,7 +450,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                         size_t                        ids_len,
                         const typename T::HandleType* handles,
                         size_t                        handles_len,
-                        std::vector<T>&&              initial_infos,
+                        T*                            initial_infos,
                         S* (VulkanObjectInfoTable::*GetPoolInfoFunc)(format::HandleId),
                         void (VulkanObjectInfoTable::*AddFunc)(T&&))
     {
@@ -290,7 +460,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                        ids_len,
                                        handles,
                                        handles_len,
-                                       std::move(initial_infos),
+                                       initial_infos,
                                        &object_info_table_,
                                        GetPoolInfoFunc,
                                        AddFunc);
@@ -414,6 +584,10 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                   const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
                                   HandlePointerDecoder<VkDevice>*                            pDevice);
 
+    void OverrideDestroyInstance(PFN_vkDestroyInstance                                      func,
+                                 const InstanceInfo*                                        instance_info,
+                                 const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
     void OverrideDestroyDevice(PFN_vkDestroyDevice                                        func,
                                const DeviceInfo*                                          device_info,
                                const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
@@ -449,6 +623,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         PhysicalDeviceInfo*                                              physical_device_info,
         StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties);
 
+    VkResult OverrideResetFences(PFN_vkResetFences                    func,
+                                 VkResult                             original_result,
+                                 const DeviceInfo*                    device_info,
+                                 uint32_t                             fenceCount,
+                                 const HandlePointerDecoder<VkFence>* pFences);
+
     VkResult OverrideWaitForFences(PFN_vkWaitForFences                  func,
                                    VkResult                             original_result,
                                    const DeviceInfo*                    device_info,
@@ -460,7 +640,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     VkResult OverrideGetFenceStatus(PFN_vkGetFenceStatus func,
                                     VkResult             original_result,
                                     const DeviceInfo*    device_info,
-                                    const FenceInfo*     fence_info);
+                                    FenceInfo*           fence_info);
 
     VkResult OverrideGetEventStatus(PFN_vkGetEventStatus func,
                                     VkResult             original_result,
@@ -492,6 +672,14 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                      const StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
                                      const FenceInfo*                                      fence_info);
 
+    VkResult OverrideCreateDescriptorSetLayout(
+        PFN_vkCreateDescriptorSetLayout                                      func,
+        VkResult                                                             original_result,
+        const DeviceInfo*                                                    device_info,
+        const StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*           pAllocator,
+        HandlePointerDecoder<VkDescriptorSetLayout>*                         pSetLayout);
+
     VkResult OverrideCreateDescriptorPool(PFN_vkCreateDescriptorPool func,
                                           VkResult                   original_result,
                                           const DeviceInfo*          device_info,
@@ -511,6 +699,76 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                    const StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
                                    HandlePointerDecoder<VkDescriptorSet>*                           pDescriptorSets);
 
+    void OverrideUpdateDescriptorSets(PFN_vkUpdateDescriptorSets                                func,
+                                      const DeviceInfo*                                         device_info,
+                                      uint32_t                                                  descriptorWriteCount,
+                                      const StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites,
+                                      uint32_t                                                  descriptorCopyCount,
+                                      const StructPointerDecoder<Decoded_VkCopyDescriptorSet>*  pDescriptorCopies);
+
+    VkResult
+    OverrideBeginCommandBuffer(PFN_vkBeginCommandBuffer                                      func,
+                               VkResult                                                      original_result,
+                               const CommandBufferInfo*                                      command_buffer_info,
+                               const StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo);
+
+    VkResult OverrideEndCommandBuffer(PFN_vkEndCommandBuffer   func,
+                                      VkResult                 original_result,
+                                      const CommandBufferInfo* command_buffer_info);
+
+    void OverrideCmdBeginRenderPass(PFN_vkCmdBeginRenderPass                                   func,
+                                    const CommandBufferInfo*                                   command_buffer_info,
+                                    const StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+                                    VkSubpassContents                                          contents);
+
+    void OverrideCmdBeginRenderPass2(PFN_vkCmdBeginRenderPass2                                  func,
+                                     const CommandBufferInfo*                                   command_buffer_info,
+                                     const StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+                                     const StructPointerDecoder<Decoded_VkSubpassBeginInfo>*    pSubpassBeginInfo);
+
+    void OverrideCmdEndRenderPass(PFN_vkCmdEndRenderPass func, const CommandBufferInfo* command_buffer_info);
+
+    void OverrideCmdEndRenderPass2(PFN_vkCmdEndRenderPass2                               func,
+                                   const CommandBufferInfo*                              command_buffer_info,
+                                   const StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo);
+
+    void OverrideCmdDispatch(PFN_vkCmdDispatch        func,
+                             const CommandBufferInfo* command_buffer_info,
+                             uint32_t                 groupCountX,
+                             uint32_t                 groupCountY,
+                             uint32_t                 groupCountZ);
+
+    void OverrideCmdDispatchIndirect(PFN_vkCmdDispatchIndirect func,
+                                     const CommandBufferInfo*  command_buffer_info,
+                                     const BufferInfo*         buffer_info,
+                                     VkDeviceSize              offset);
+
+    void OverrideCmdDispatchBase(PFN_vkCmdDispatchBase    func,
+                                 const CommandBufferInfo* command_buffer_info,
+                                 uint32_t                 baseGroupX,
+                                 uint32_t                 baseGroupY,
+                                 uint32_t                 baseGroupZ,
+                                 uint32_t                 groupCountX,
+                                 uint32_t                 groupCountY,
+                                 uint32_t                 groupCountZ);
+
+    void OverrideCmdBindPipeline(PFN_vkCmdBindPipeline    func,
+                                 const CommandBufferInfo* command_buffer_info,
+                                 VkPipelineBindPoint      pipelineBindPoint,
+                                 const PipelineInfo*      pipeline_info);
+
+    VkResult OverrideCreateCommandPool(PFN_vkCreateCommandPool                                      func,
+                                       VkResult                                                     original_result,
+                                       const DeviceInfo*                                            device_info,
+                                       const StructPointerDecoder<Decoded_VkCommandPoolCreateInfo>* pCreateInfo,
+                                       const StructPointerDecoder<Decoded_VkAllocationCallbacks>*   pAllocator,
+                                       HandlePointerDecoder<VkCommandPool>*                         pCommandPool);
+
+    void OverrideDestroyCommandPool(PFN_vkDestroyCommandPool                                   func,
+                                    const DeviceInfo*                                          device_info,
+                                    CommandPoolInfo*                                           command_pool_info,
+                                    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
     VkResult
     OverrideAllocateCommandBuffers(PFN_vkAllocateCommandBuffers                                     func,
                                    VkResult                                                         original_result,
@@ -554,6 +812,46 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                             DeviceMemoryInfo*                                          memory_info,
                             const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
 
+    void OverrideDestroyShaderModule(PFN_vkDestroyShaderModule                                  func,
+                                     const DeviceInfo*                                          device_info,
+                                     const ShaderModuleInfo*                                    shader_module_info,
+                                     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    void OverrideDestroyPipelineCache(PFN_vkDestroyPipelineCache                                 func,
+                                      const DeviceInfo*                                          device_info,
+                                      const PipelineCacheInfo*                                   cache_info,
+                                      const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    VkResult
+    OverrideCreateGraphicsPipelines(PFN_vkCreateGraphicsPipelines                                     func,
+                                    VkResult                                                          original_result,
+                                    const DeviceInfo*                                                 device_info,
+                                    const PipelineCacheInfo*                                          cache_info,
+                                    uint32_t                                                          createInfoCount,
+                                    const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+                                    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+                                    HandlePointerDecoder<VkPipeline>*                                 pPipelines);
+
+    VkResult
+    OverrideCreateComputePipelines(PFN_vkCreateComputePipelines                                     func,
+                                   VkResult                                                         original_result,
+                                   const DeviceInfo*                                                device_info,
+                                   const PipelineCacheInfo*                                         cache_info,
+                                   uint32_t                                                         createInfoCount,
+                                   const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+                                   const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+                                   HandlePointerDecoder<VkPipeline>*                                pPipelines);
+
+    void OverrideDestroyPipelineLayout(PFN_vkDestroyPipelineLayout                                func,
+                                       const DeviceInfo*                                          device_info,
+                                       const PipelineLayoutInfo*                                  pipeline_layout_info,
+                                       const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    void OverrideDestroyRenderPass(PFN_vkDestroyRenderPass                                    func,
+                                   const DeviceInfo*                                          device_info,
+                                   const RenderPassInfo*                                      render_pass_info,
+                                   const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
     VkResult OverrideBindBufferMemory(PFN_vkBindBufferMemory func,
                                       VkResult               original_result,
                                       const DeviceInfo*      device_info,
@@ -633,7 +931,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     VkResult OverrideGetPipelineCacheData(PFN_vkGetPipelineCacheData func,
                                           VkResult                   original_result,
                                           const DeviceInfo*          device_info,
-                                          const PipelineCacheInfo*   pipeline_cache_info,
+                                          const PipelineCacheInfo*   cache_info,
                                           PointerDecoder<size_t>*    pDataSize,
                                           PointerDecoder<uint8_t>*   pData);
 
@@ -817,7 +1115,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         VkResult                                                               original_result,
         const DeviceInfo*                                                      device_info,
         const DeferredOperationKHRInfo*                                        deferred_operation_info,
-        const PipelineCacheInfo*                                               pipeline_cache_info,
+        const PipelineCacheInfo*                                               cache_info,
         uint32_t                                                               createInfoCount,
         const StructPointerDecoder<Decoded_VkRayTracingPipelineCreateInfoKHR>* pCreateInfos,
         const StructPointerDecoder<Decoded_VkAllocationCallbacks>*             pAllocator,
@@ -825,11 +1123,13 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     VkDeviceAddress
     OverrideGetBufferDeviceAddress(PFN_vkGetBufferDeviceAddress                                   func,
+                                   VkDeviceAddress                                                original_result,
                                    const DeviceInfo*                                              device_info,
                                    const StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo);
 
-    void OverrideGetAccelerationStructureDeviceAddressKHR(
+    VkDeviceAddress OverrideGetAccelerationStructureDeviceAddressKHR(
         PFN_vkGetAccelerationStructureDeviceAddressKHR                                   func,
+        VkDeviceAddress                                                                  original_result,
         const DeviceInfo*                                                                device_info,
         const StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo);
 
@@ -842,6 +1142,46 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                                         size_t                                   dataSize,
                                                         PointerDecoder<uint8_t>*                 pData);
 
+    void OverrideCmdBuildAccelerationStructuresKHR(
+        PFN_vkCmdBuildAccelerationStructuresKHR                                          func,
+        const CommandBufferInfo*                                                         command_buffer_info,
+        uint32_t                                                                         infoCount,
+        const StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
+        const StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>*   ppBuildRangeInfos);
+
+    void OverrideCmdTraceRaysKHR(
+        PFN_vkCmdTraceRaysKHR                                                func,
+        const CommandBufferInfo*                                             command_buffer_info,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pRaygenShaderBindingTable,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pMissShaderBindingTable,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pHitShaderBindingTable,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
+        uint32_t                                                             width,
+        uint32_t                                                             height,
+        uint32_t                                                             depth);
+
+    void OverrideCmdTraceRaysIndirectKHR(
+        PFN_vkCmdTraceRaysIndirectKHR                                        func,
+        const CommandBufferInfo*                                             command_buffer_info,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pRaygenShaderBindingTable,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pMissShaderBindingTable,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pHitShaderBindingTable,
+        const StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
+        VkDeviceAddress                                                      indirectDeviceAddress);
+
+  private:
+    // Initialization command of a resource whose data is uploaded when the resource is first used.
+    struct DeferredInitData
+    {
+        format::HandleId         device_id{ format::kNullHandleId };
+        bool                     is_image{ false };
+        uint64_t                 data_size{ 0 };
+        uint32_t                 aspect{ 0 };
+        uint32_t                 layout{ 0 };
+        std::vector<uint64_t>    level_sizes;
+        ResourceInitDataLocation location;
+    };
+
   private:
     void RaiseFatalError(const char* message) const;
 
@@ -851,6 +1191,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void AddDeviceTable(VkDevice device, PFN_vkGetDeviceProcAddr gpa);
 
+    // Passes an instance or device that is being destroyed to the retained objects for reuse by the replay of a later
+    // capture file.  Returns false when the object can't be reused and must be destroyed.
+    bool RetainInstance(const InstanceInfo* instance_info);
+
+    bool RetainDevice(const DeviceInfo* device_info);
+
     PFN_vkGetDeviceProcAddr GetDeviceAddrProc(VkPhysicalDevice physical_device);
 
     PFN_vkCreateDevice GetCreateDeviceProc(VkPhysicalDevice physical_device);
@@ -887,6 +1233,8 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     bool CheckTrimDeviceExtensions(VkPhysicalDevice physical_device, std::vector<std::string>* extensions);
 
+    uint32_t GetTransferQueueFamilyIndex(VkPhysicalDevice physical_device, const VkDeviceCreateInfo* create_info);
+
     void InitializeResourceAllocator(const PhysicalDeviceInfo*       physical_device_info,
                                      VkDevice                        device,
                                      const std::vector<std::string>& enabled_device_extensions,
@@ -915,19 +1263,23 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                   ImageInfo*               image_info);
 
     // When processing swapchain image state for the trimming state setup, acquire all swapchain images to transition to
-    // the expected layout and keep them acquired until first use.
+    // the expected layout and keep them acquired until first use.  The images are transitioned by one submission.
     void ProcessSetSwapchainImageStatePreAcquire(VkDevice                                            device,
                                                  SwapchainKHRInfo*                                   swapchain_info,
                                                  const std::vector<format::SwapchainImageStateInfo>& image_info);
 
     // When processing swapchain image state for the trimming state setup, acquire an image, transition it to
     // the expected layout, and then call queue present if the image is not expected to be in the acquired state so that
-    // no more than one image is acquired at a time.
+    // no more than one image is acquired at a time.  The acquires, submissions, and presents are ordered by semaphores.
     void ProcessSetSwapchainImageStateQueueSubmit(VkDevice          device,
                                                   SwapchainKHRInfo* swapchain_info,
                                                   uint32_t          last_presented_image,
                                                   const std::vector<format::SwapchainImageStateInfo>& image_info);
 
+    // Waits for the swapchain image state initializations of a device, or of all devices when device is
+    // VK_NULL_HANDLE, and destroys their objects.
+    void CompleteSwapchainImageInits(VkDevice device);
+
     void ProcessCreateInstanceDebugCallbackInfo(const Decoded_VkInstanceCreateInfo* instance_info);
 
     void ProcessSwapchainFullScreenExclusiveInfo(const Decoded_VkSwapchainCreateInfoKHR* swapchain_info);
@@ -938,8 +1290,190 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void InitializeScreenshotHandler();
 
+    // Creates the replay pipeline cache for a device, initialized with the data that was saved by a previous replay
+    // with the same device, driver, and capture file.
+    void CreateReplayPipelineCache(DeviceInfo* device_info);
+
+    // Merges the device's pipeline caches into the replay pipeline cache, writes its data to the pipeline cache file,
+    // and destroys it.  A replay pipeline cache that was only created for state snapshot pipeline cache data is
+    // destroyed without being saved.
+    void SaveReplayPipelineCache(const DeviceInfo* device_info);
+
+    // Returns the pipeline cache to use for a pipeline creation call.  Calls without a pipeline cache use the replay
+    // pipeline cache.
+    VkPipelineCache GetReplayPipelineCache(const DeviceInfo* device_info, const PipelineCacheInfo* cache_info) const;
+
+    // Creates shader modules for the pre-scanned shader module creation calls of a device, which are used by the
+    // pre-scanned pipeline creation calls instead of the shader modules that are created by the application.
+    void CreateWarmUpShaderModules(const DeviceInfo* device_info);
+
+    // Starts creating the pre-scanned pipelines whose pipeline layouts, render passes, and base pipelines have been
+    // created by replay, from the worker threads of the warm-up pipeline creator.
+    void SubmitWarmUpPipelines();
+
+    enum class WarmUpStatus
+    {
+        kReady,
+        kNotReady,
+        kUnsupported
+    };
+
+    WarmUpStatus GetWarmUpStatus(const PrescannedPipelines& pipelines) const;
+
+    void MapWarmUpShaderStage(const Decoded_VkPipelineShaderStageCreateInfo* stage) const;
+
+    // Retrieves the pipelines that were created for a pipeline creation call ahead of replay.  Returns false if the
+    // pipelines were not created, in which case the call needs to be replayed.
+    bool ClaimWarmUpPipelines(uint32_t create_info_count, HandlePointerDecoder<VkPipeline>* pipelines);
+
+    // Destroys the unclaimed pipelines and the shader modules that were created ahead of replay for a device.
+    void DestroyWarmUpObjects(const DeviceInfo* device_info);
+
+    // Writes the buffered memory fill data for a memory object, or for all memory objects, to the resource allocator.
+    void ApplyPendingMemoryFills(format::HandleId memory_id);
+
+    void ApplyPendingMemoryFills();
+
+    void WritePendingMemoryFills(format::HandleId memory_id, CoalescedMemoryFills* fills);
+
+    std::unique_ptr<VulkanResourceInitializer> CreateResourceInitializer(const DeviceInfo* device_info,
+                                                                         uint64_t          max_copy_size);
+
+    // Resources that can be written by the host, that can be accessed through a device address, or that share memory
+    // with other resources may be accessed without a reference that is tracked, so their data is uploaded with the
+    // state snapshot.
+    bool CanDeferInitData(const BufferInfo* buffer_info);
+
+    bool CanDeferInitData(const ImageInfo* image_info);
+
+    // Finds the buffers and images whose bound memory ranges overlap.
+    void FindAliasedResources();
+
+    // Reads a resource's deferred initialization data from the capture file and uploads it.
+    void InitializeDeferredResource(format::HandleId resource_id, const DeferredInitData& init_data);
+
+    // Unlocks the hardware buffers that were left locked by memory fills, so that the writes are visible to the device.
+    void UnlockHardwareBuffers();
+
+    // Warns about submitted command buffers whose rendering commands were dropped by fast forwarding.
+    void CheckIncompleteCommandBuffers(const HandlePointerDecoder<VkCommandBuffer>& command_buffers);
+
+    // Gets the cached contents of the descriptors updated by a write or copy, which continue into the following
+    // bindings when the count exceeds the remaining descriptors of a binding.  Returns false if the set has no cached
+    // contents or the update does not fit in the set.
+    bool GetCachedDescriptors(DescriptorSetInfo*                set_info,
+                              uint32_t                          binding,
+                              uint32_t                          array_element,
+                              uint32_t                          descriptor_count,
+                              std::vector<DescriptorContents*>* descriptors);
+
+    // Returns true when a descriptor write does not change the cached contents of the set, and otherwise updates the
+    // cached contents to match the write.
+    bool IsRedundantDescriptorWrite(const Decoded_VkWriteDescriptorSet* write);
+
+    // Returns true when a template update repeats the last update of the set, and otherwise caches the update.
+    bool IsRedundantTemplateUpdate(format::HandleId                       descriptor_set,
+                                   format::HandleId                       update_template,
+                                   const DescriptorUpdateTemplateDecoder* decoder);
+
+    // Returns true when the pipelines of a creation call can be created by the asynchronous pipeline creator.
+    bool UseAsyncPipelineCreation(uint32_t create_info_count, const HandlePointerDecoder<VkPipeline>* pipelines) const;
+
+    // Queues a pipeline creation call for execution by a worker thread, retaining the decoded parameters of the current
+    // API call until the pipelines have been created.  The pipeline infos that were provided as consumer data for the
+    // pipeline handles receive the creation task, which is waited on when a pipeline is first retrieved from the object
+    // info table.
+    void CreatePipelinesAsync(const char*                          func_name,
+                              VkResult                             original_result,
+                              uint32_t                             create_info_count,
+                              HandlePointerDecoder<VkPipeline>*    pipelines,
+                              PipelineCreationTask::CreateFunction create);
+
+    // Waits for the pipeline creation calls that are executing asynchronously, before objects that they may use are
+    // destroyed.
+    void WaitForAsyncPipelineCreation();
+
     void WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const;
 
+    // Returns true when swapchains are backed by plain images, either because virtual swapchains were requested or
+    // because the images are copied to a swapchain with an overridden present mode.
+    bool UseVirtualSwapchains() const
+    {
+        return options_.virtual_swapchain || (options_.present_mode_override != PresentModeOverride::kNone);
+    }
+
+    // Returns true when some swapchains may be backed by plain images instead of a real swapchain, either because
+    // rendering is restricted to a specific surface or because virtual swapchains are used.
+    bool HasDummySwapchains() const { return (options_.surface_index != -1) || UseVirtualSwapchains(); }
+
+    void CreateSubmitTimer(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info);
+
+    // Returns true when a submission can be merged with the adjacent submissions to the same queue, which requires
+    // that replay does not modify, time, or track the submission.
+    bool CanBatchSubmit(uint32_t submit_count, const VkSubmitInfo* submits) const;
+
+    void FlushSubmitBatch();
+
+    bool IsSubmitPacingEnabled() const
+    {
+        return (options_.max_submits_in_flight > 0) || (options_.max_frames_in_flight > 0);
+    }
+
+    // Enables the timeline semaphore feature that is required for submission pacing, adding VK_KHR_timeline_semaphore
+    // to the device extensions when the feature is not core.  timeline_features provides storage for a feature struct
+    // that is added to the create info's pNext chain.  Returns false if timeline semaphores are not supported.
+    bool EnableTimelineSemaphores(const PhysicalDeviceInfo*                  physical_device_info,
+                                  VkDeviceCreateInfo*                        create_info,
+                                  std::vector<const char*>*                  extensions,
+                                  VkPhysicalDeviceTimelineSemaphoreFeatures* timeline_features,
+                                  bool*                                      use_khr_entry_points);
+
+    void CreateSubmitPacer(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info, bool use_khr);
+
+    void CreateAddressPatcher(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info);
+
+    // Returns the address patcher of a device, or nullptr when device addresses are not remapped.
+    VulkanAddressPatcher* GetAddressPatcher(format::HandleId device_id);
+
+    void CreateAccelStructCache(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info);
+
+    // Returns the acceleration structure cache of a device, or nullptr when acceleration structures are not cached.
+    VulkanAccelStructCache* GetAccelStructCache(format::HandleId device_id);
+
+    void CreatePresentImageCopier(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info);
+
+    // Returns the pool cache of a device, or nullptr when pools are not recycled.
+    VulkanPoolCache* GetPoolCache(VkDevice device);
+
+    // Creates the swapchain that presents copies of a virtual swapchain's images with the overridden present mode.
+    VkResult CreatePresentSwapchain(const DeviceInfo*                                             device_info,
+                                    SwapchainKHRInfo*                                             swapchain_info,
+                                    const StructPointerDecoder<Decoded_VkSwapchainCreateInfoKHR>* pCreateInfo,
+                                    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator);
+
+    // Adds the GPU times of the frames with completed submissions to the timing report, optionally waiting for the
+    // submissions to complete.
+    void AddGpuFrameTimes(VulkanSubmitTimer* timer, bool wait);
+
+    void CreatePassTimer(const DeviceInfo* device_info, const VkDeviceCreateInfo* create_info);
+
+    // Returns the pass timer of a device, or nullptr when passes are not timed.
+    VulkanPassTimer* GetPassTimer(format::HandleId device_id);
+
+    // Adds the GPU times of the passes of completed submissions to the pass timing report, optionally waiting for the
+    // submissions to complete.
+    void AddGpuPassTimes(VulkanPassTimer* timer, bool wait);
+
+    // Begins a debug utils label for external GPU profilers, with the index of the block of the current call appended
+    // to the label name for --debug-label-blocks.
+    void BeginDebugLabel(VkCommandBuffer command_buffer, std::string name);
+
+    void BeginDebugLabel(VkQueue queue, std::string name);
+
+    // Sets the current host memory usage of the replay object tables, allocators, and screenshot buffers, and the
+    // device memory usage of each device, in the memory usage report.
+    void UpdateMemoryUsage();
+
   private:
     typedef std::unordered_set<Window*> ActiveWindows;
 
@@ -963,6 +1497,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         AHardwareBuffer*                     hardware_buffer;
         bool                                 compatible_strides;
         std::vector<HardwareBufferPlaneInfo> plane_info;
+        void*                                locked_data{ nullptr }; // Remains locked from a fill to the next submit.
     };
 
     typedef std::unordered_map<uint64_t, HardwareBufferInfo>               HardwareBufferMap;
@@ -990,10 +1525,112 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     std::string                                                      screenshot_file_prefix_;
     int32_t                                                          create_surface_count_;
     graphics::FpsInfo*                                               fps_info_;
+    std::unique_ptr<AsyncPipelineCreator>                            pipeline_creator_;
+
+    struct WarmUpShaderModule
+    {
+        format::HandleId device_id{ format::kNullHandleId };
+        VkShaderModule   handle{ VK_NULL_HANDLE };
+    };
+
+    struct WarmUpPipelineTask
+    {
+        format::HandleId                      device_id{ format::kNullHandleId };
+        uint32_t                              pipeline_count{ 0 };
+        std::shared_ptr<PipelineCreationTask> task;
+    };
+
+    // Pipeline creation calls that are performed ahead of replay, with the task for each call keyed by the capture ID
+    // of the call's first pipeline, and the pre-scanned calls that have not been started.
+    std::unique_ptr<AsyncPipelineCreator>                    warm_up_creator_;
+    std::unordered_map<format::HandleId, WarmUpShaderModule> warm_up_shader_modules_;
+    std::unordered_map<format::HandleId, WarmUpPipelineTask> warm_up_pipeline_tasks_;
+    std::vector<PrescannedPipelines*>                        pending_warm_up_pipelines_;
+
+    // Objects of a swapchain image state initialization, which are destroyed when the initialization completes.  The
+    // initialization is not waited on until the trimmed state load ends, so that it executes while the rest of the
+    // state is loaded.
+    struct PendingSwapchainImageInit
+    {
+        VkDevice                 device{ VK_NULL_HANDLE };
+        VkQueue                  queue{ VK_NULL_HANDLE }; // Waited on for initializations that present images.
+        VkCommandPool            command_pool{ VK_NULL_HANDLE };
+        VkFence                  fence{ VK_NULL_HANDLE };
+        bool                     submitted{ false };
+        std::vector<VkSemaphore> semaphores;
+    };
+
+    std::vector<PendingSwapchainImageInit> pending_swapchain_image_inits_;
+
+    // Memory fill data that has not been written to the resource allocator, keyed by memory object capture ID.
+    std::unordered_map<format::HandleId, CoalescedMemoryFills> pending_memory_fills_;
+
+    // Saved device memory contents that are restored before each repeat of a looped frame range.
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanFrameLoopState>> frame_loop_states_;
+
+    // Per-frame timing for the replay timing report, with the GPU timers of each device.  Frames are numbered by
+    // present, starting from 1 for the first replayed frame.
+    std::unique_ptr<graphics::FrameTimingReport>                     timing_report_;
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanSubmitTimer>> submit_timers_;
+    uint64_t                                                         timing_frame_number_;
+    int64_t                                                          frame_start_time_;
+    int64_t                                                          last_present_time_;
+
+    // GPU timing of the render passes and dispatch groups of each frame, with the pass timers of each device.  Frames
+    // are numbered with the timing report's frame numbers.
+    std::unique_ptr<graphics::PassTimingReport>                    pass_timing_report_;
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanPassTimer>> pass_timers_;
+
+    // Debug utils labels of the replayed frames, submissions, and command buffers, for --debug-labels.  Labels are only
+    // inserted when the replay instance has the VK_EXT_debug_utils extension.  Frames are numbered by present, starting
+    // from 1, and submissions by their order in the frame, starting from 0.
+    bool     debug_labels_enabled_;
+    uint64_t debug_label_frame_number_;
+    uint32_t debug_label_submit_index_;
+    uint64_t current_block_index_;
+
+    // Start of the resource initialization command block that is being processed, for the startup timing report.
+    int64_t resource_init_start_time_;
+
+    // Initialization data of the resources that have not been used yet, for --lazy-resource-init.
+    std::unique_ptr<ResourceInitDataReader>                init_data_reader_;
+    std::unordered_map<format::HandleId, DeferredInitData> deferred_init_data_;
+    std::unordered_set<format::HandleId>                   aliased_resource_ids_;
+    bool                                                   aliased_resources_found_;
+
+    // Last captured CPU timestamp and the replay time when it was processed, for --pace-cpu-timestamps.
+    uint64_t pacing_capture_time_;
+    int64_t  pacing_replay_time_;
+
+    // Limits the queue submissions and frames in flight on each device.
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanSubmitPacer>> submit_pacers_;
+
+    // Merges consecutive queue submissions, for --batch-submits.
+    std::unique_ptr<VulkanSubmitBatcher> submit_batcher_;
+
+    // Remaps captured device addresses to replay device addresses on each device, for --remap-device-addresses.
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanAddressPatcher>> address_patchers_;
+
+    // Caches the bottom level acceleration structures built by replay, for --accel-struct-cache.
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanAccelStructCache>> accel_struct_caches_;
+
+    // Presents copies of virtual swapchain images on each device, for --present-mode.
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanPresentImageCopier>> present_image_copiers_;
+
+    // Keeps destroyed descriptor and command pools for reuse on each device, for --recycle-pools.
+    std::unordered_map<VkDevice, std::unique_ptr<VulkanPoolCache>> pool_caches_;
+
+    // Keys of the instances and devices that can be retained for the replay of a later capture file, with the instance
+    // of each device.
+    std::unordered_map<VkInstance, std::string>                      instance_retain_keys_;
+    std::unordered_map<VkDevice, std::pair<std::string, VkInstance>> device_retain_keys_;
 
     // Used to track if any shadow sync objects are active to avoid checking if not needed
     std::unordered_set<VkSemaphore> shadow_semaphores_;
     std::unordered_set<VkFence>     shadow_fences_;
+
+    // Command buffers with rendering commands that were dropped by fast forwarding, which have not been begun again.
+    std::unordered_set<format::HandleId> incomplete_command_buffers_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
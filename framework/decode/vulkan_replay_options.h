@@ -25,15 +25,22 @@
 #define GFXRECON_DECODE_VULKAN_REPLAY_OPTIONS_H
 
 #include "decode/vulkan_resource_allocator.h"
+#include "graphics/memory_usage_report.h"
+#include "graphics/startup_timing_report.h"
 #include "util/defines.h"
 
 #include <functional>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+struct PrescannedPipelineData;
+class VulkanRetainedObjects;
+
 typedef std::function<VulkanResourceAllocator*()> CreateResourceAllocator;
 
 // Default log level to use prior to loading settings.
@@ -43,7 +50,17 @@ const char kDefaultScreenshotFilePrefix[] = "screenshot";
 
 enum class ScreenshotFormat : uint32_t
 {
-    kBmp = 0
+    kBmp = 0,
+    kPng = 1,
+    kQoi = 2
+};
+
+// Present mode that replaces the captured present mode of swapchains, to present without waiting for vertical blank.
+enum class PresentModeOverride : uint32_t
+{
+    kNone      = 0,
+    kImmediate = 1,
+    kMailbox   = 2
 };
 
 struct ScreenshotRange
@@ -55,17 +72,56 @@ struct ScreenshotRange
 struct ReplayOptions
 {
     bool                         sync_queue_submissions{ false };
+    bool                         batch_submits{ false }; // Merge consecutive submissions to a queue into one call.
+    uint32_t                     max_submits_in_flight{ 0 }; // Per-queue submission limit, 0 for no limit.
+    uint32_t                     max_frames_in_flight{ 0 };  // Presented frame limit, 0 for no limit.
+    bool                         collapse_polling{ false };      // Skip redundant fence and query status polling calls.
+    bool                         cpu_timestamp_pacing{ false };  // Wait for the captured CPU time between submissions.
+    bool                         coalesce_memory_fills{ false }; // Merge memory fills until the memory is used.
+    // Skip descriptor set updates that do not change the contents of the set.
+    bool                         skip_redundant_descriptor_updates{ false };
     bool                         skip_failed_allocations{ false };
+    bool                         recycle_pools{ false }; // Reuse destroyed descriptor and command pools.
     bool                         omit_pipeline_cache_data{ false };
     bool                         remove_unsupported_features{ false };
+    bool                         remap_device_addresses{ false }; // Translate captured buffer and AS addresses.
+    std::string                  accel_struct_cache_capture_file; // Capture file to cache BLAS builds for, or empty.
+    std::string                  lazy_resource_init_file; // Capture file to read deferred resource init data from.
     int32_t                      override_gpu_index{ -1 };
     int32_t                      surface_index{ -1 };
+    bool                         virtual_swapchain{ false }; // Back swapchains with images that are never presented.
+    PresentModeOverride          present_mode_override{ PresentModeOverride::kNone };
+    bool                         fast_exit{ false }; // Leave live objects for process exit to reclaim when replay ends.
+    bool                         debug_labels{ false };       // Label frames, submissions, and command buffers.
+    bool                         debug_label_blocks{ false }; // Add the capture file block index to the labels.
     CreateResourceAllocator      create_resource_allocator;
     ScreenshotFormat             screenshot_format{ ScreenshotFormat::kBmp };
     std::vector<ScreenshotRange> screenshot_ranges;
     std::string                  screenshot_dir;
     std::string                  screenshot_file_prefix{ kDefaultScreenshotFilePrefix };
+    uint32_t                     screenshot_downscale{ 1 };     // Divisor for the screenshot width and height.
+    bool                         screenshot_hash_only{ false }; // Write image hashes instead of image files.
     std::string                  replace_dir;
+    uint32_t                     pipeline_creation_threads{ 0 };
+    std::string                  pipeline_cache_file_prefix; // Prefix of replay pipeline cache files, or empty.
+    std::string                  timing_report_file;         // File to write per-frame timing to, or empty.
+    uint32_t                     timing_report_first_frame{ 1 };
+    uint32_t                     timing_report_last_frame{ std::numeric_limits<uint32_t>::max() };
+    std::string                  pass_timing_report_file; // File to write per-pass GPU timing to, or empty.
+    uint32_t                     pass_timing_first_frame{ 1 };
+    uint32_t                     pass_timing_last_frame{ std::numeric_limits<uint32_t>::max() };
+
+    // Pipeline creation calls to perform ahead of replay, from a pre-scan of the capture file, or null.
+    std::shared_ptr<PrescannedPipelineData> warm_up_pipelines;
+
+    // Instances and devices that are kept from the replay of previous capture files for reuse, or null.
+    std::shared_ptr<VulkanRetainedObjects> retained_objects;
+
+    // Wall time of the replay startup phases, from the start of the replay of the capture file, or null.
+    std::shared_ptr<graphics::StartupTimingReport> startup_report;
+
+    // Host and device memory usage of replay, which is also reported by the file processor, or null.
+    std::shared_ptr<graphics::MemoryUsageReport> memory_report;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -254,6 +254,12 @@ class VulkanResourceAllocator
                                                         const MemoryData*          allocator_datas) = 0;
 
     virtual bool SupportsOpaqueDeviceAddresses() = 0;
+
+    // Retrieves the device memory that has been allocated from each memory heap of the replay device, indexed by heap.
+    virtual void GetHeapUsage(std::vector<VkDeviceSize>* heap_usage) = 0;
+
+    // Returns the host memory that is used for copies of mapped memory content.
+    virtual size_t GetHostCopySize() = 0;
 };
 
 GFXRECON_END_NAMESPACE(decode)
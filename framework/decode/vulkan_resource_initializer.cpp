@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <thread>
+#include <utility>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -36,12 +38,17 @@ VulkanResourceInitializer::VulkanResourceInitializer(VkDevice
                                                      VkDeviceSize                            max_copy_size,
                                                      const VkPhysicalDeviceMemoryProperties& memory_properties,
                                                      bool                                    have_shader_stencil_write,
+                                                     uint32_t                                transfer_family_index,
                                                      VulkanResourceAllocator*                resource_allocator,
                                                      const encode::DeviceTable*              device_table) :
-    device_(device),
-    staging_memory_(VK_NULL_HANDLE), staging_memory_data_(0), staging_buffer_(VK_NULL_HANDLE), staging_buffer_data_(0),
+    device_(device), staging_block_index_(0),
+    staging_block_size_((max_copy_size > kMinStagingBufferSize) ? max_copy_size : kMinStagingBufferSize),
+    reserved_data_(nullptr), reserved_offset_(0), reserved_size_(0),
     draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
-    draw_set_(VK_NULL_HANDLE), max_copy_size_(max_copy_size), have_shader_stencil_write_(have_shader_stencil_write),
+    draw_pipeline_layout_(VK_NULL_HANDLE), draw_set_index_(0), draw_staging_size_(0), max_copy_size_(max_copy_size),
+    have_shader_stencil_write_(have_shader_stencil_write),
+    transfer_queue_family_index_(transfer_family_index),
+    copy_thread_count_(std::thread::hardware_concurrency()),
     resource_allocator_(resource_allocator), device_table_(device_table)
 {
     assert((device != VK_NULL_HANDLE) && (memory_properties.memoryTypeCount > 0) &&
@@ -55,25 +62,49 @@ VulkanResourceInitializer::VulkanResourceInitializer(VkDevice
 
     util::platform::MemoryCopy(&memory_properties_.memoryTypes, type_size, &memory_properties.memoryTypes, type_size);
     util::platform::MemoryCopy(&memory_properties_.memoryHeaps, heap_size, &memory_properties.memoryHeaps, heap_size);
+
+    if (copy_thread_count_ == 0)
+    {
+        copy_thread_count_ = 1;
+    }
+    else if (copy_thread_count_ > kMaxParallelCopyThreads)
+    {
+        copy_thread_count_ = kMaxParallelCopyThreads;
+    }
+
+    // The blocks are created on first use, so the ring is only extended for loads that fill the first block.
+    size_t block_count = static_cast<size_t>(
+        std::min(static_cast<VkDeviceSize>(kStagingBlockCount), kMaxStagingPoolSize / staging_block_size_));
+    staging_blocks_.resize(std::max(block_count, static_cast<size_t>(1)));
 }
 
 VulkanResourceInitializer::~VulkanResourceInitializer()
 {
+    // Complete any work that was not flushed by the end of resource initialization.
+    Flush();
+
     for (const auto& entry : command_exec_objects_)
     {
         device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
+        device_table_->DestroySemaphore(device_, entry.second.acquire_semaphore, nullptr);
+
+        for (auto fence : entry.second.fences)
+        {
+            device_table_->DestroyFence(device_, fence, nullptr);
+        }
     }
 
-    if (staging_buffer_ != VK_NULL_HANDLE)
+    for (auto& block : staging_blocks_)
     {
-        resource_allocator_->DestroyBufferDirect(staging_buffer_, nullptr, staging_buffer_data_);
+        DestroyStagingBlock(&block);
     }
 
-    if (staging_memory_ != VK_NULL_HANDLE)
+    for (const auto& draw_objects : draw_objects_)
     {
-        resource_allocator_->FreeMemoryDirect(staging_memory_, nullptr, staging_memory_data_);
+        DestroyDrawObjects(draw_objects.pass, draw_objects.pipeline);
     }
 
+    device_table_->DestroyPipelineLayout(device_, draw_pipeline_layout_, nullptr);
     device_table_->DestroySampler(device_, draw_sampler_, nullptr);
     device_table_->DestroyDescriptorPool(device_, draw_pool_, nullptr);
     device_table_->DestroyDescriptorSetLayout(device_, draw_set_layout_, nullptr);
@@ -89,17 +120,52 @@ VkResult VulkanResourceInitializer::LoadData(VkDeviceSize
     if (result == VK_SUCCESS)
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
-        size_t copy_size = static_cast<size_t>(size);
-        util::platform::MemoryCopy(mapped_memory, copy_size, data, copy_size);
+        CopyData(reinterpret_cast<uint8_t*>(mapped_memory), data, static_cast<size_t>(size));
         resource_allocator_->UnmapResourceMemoryDirect(allocator_data);
     }
 
     return result;
 }
 
+uint8_t* VulkanResourceInitializer::ReserveStagingData(VkDeviceSize size)
+{
+    reserved_data_ = nullptr;
+
+    if ((size == 0) || (size > staging_block_size_))
+    {
+        return nullptr;
+    }
+
+    VkDeviceMemory                        memory      = VK_NULL_HANDLE;
+    VkBuffer                              buffer      = VK_NULL_HANDLE;
+    VkDeviceSize                          offset      = 0;
+    VulkanResourceAllocator::MemoryData   memory_data = 0;
+    VulkanResourceAllocator::ResourceData buffer_data = 0;
+
+    if (AcquireStagingBuffer(&memory, &buffer, &offset, size, &memory_data, &buffer_data) == VK_SUCCESS)
+    {
+        const StagingBlock& block = staging_blocks_[staging_block_index_];
+
+        if (buffer == block.buffer)
+        {
+            reserved_data_   = block.data + offset;
+            reserved_offset_ = offset;
+            reserved_size_   = size;
+        }
+        else
+        {
+            // The staging block could not be created, so a temporary buffer was acquired instead.
+            ReleaseStagingBuffer(memory, buffer, memory_data, buffer_data);
+        }
+    }
+
+    return reserved_data_;
+}
+
 VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_size,
                                                      const uint8_t*      data,
                                                      uint32_t            queue_family_index,
+                                                     VkSharingMode       sharing_mode,
                                                      VkBuffer            buffer,
                                                      VkBufferUsageFlags  usage,
                                                      uint32_t            region_count,
@@ -108,33 +174,51 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
     // TODO: handle usage cases without TRANSFER_DST.
     GFXRECON_UNREFERENCED_PARAMETER(usage);
 
-    VkQueue                               queue               = VK_NULL_HANDLE;
-    VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
     VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
     VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+    VkDeviceSize                          staging_offset      = 0;
     VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
     VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = AcquireInitializedStagingBuffer(data_size,
+                                                      data,
+                                                      &staging_memory,
+                                                      &staging_buffer,
+                                                      &staging_offset,
+                                                      &staging_memory_data,
+                                                      &staging_buffer_data);
 
     if (result == VK_SUCCESS)
     {
-        result = AcquireInitializedStagingBuffer(
-            data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        VkCommandBuffer command_buffer          = VK_NULL_HANDLE;
+        uint32_t        copy_queue_family_index = GetCopyQueueFamilyIndex(queue_family_index, sharing_mode);
+
+        result = GetRecordingCommandBuffer(copy_queue_family_index, &command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            result = BeginCommandBuffer(command_buffer);
+            // Region offsets are relative to the start of the resource data, which has been placed at staging_offset.
+            std::vector<VkBufferCopy> staging_regions(regions, regions + region_count);
 
-            if (result == VK_SUCCESS)
+            for (auto& region : staging_regions)
             {
-                device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
-                device_table_->EndCommandBuffer(command_buffer);
+                region.srcOffset += staging_offset;
+            }
+
+            device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, staging_regions.data());
 
-                result = ExecuteCommandBuffer(queue, command_buffer);
+            if (copy_queue_family_index != queue_family_index)
+            {
+                result = TransferBufferOwnership(copy_queue_family_index, queue_family_index, buffer);
             }
+        }
 
+        VkResult release_result =
             ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+
+        if (result == VK_SUCCESS)
+        {
+            result = release_result;
         }
     }
 
@@ -144,6 +228,7 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
 VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             data_size,
                                                     const uint8_t*           data,
                                                     uint32_t                 queue_family_index,
+                                                    VkSharingMode            sharing_mode,
                                                     VkImage                  image,
                                                     VkImageType              type,
                                                     VkFormat                 format,
@@ -159,63 +244,86 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
 {
     VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
     VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+    VkDeviceSize                          staging_offset      = 0;
     VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
     VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
 
-    VkResult result = AcquireInitializedStagingBuffer(
-        data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+    VkResult result = AcquireInitializedStagingBuffer(data_size,
+                                                      data,
+                                                      &staging_memory,
+                                                      &staging_buffer,
+                                                      &staging_offset,
+                                                      &staging_memory_data,
+                                                      &staging_buffer_data);
 
     if (result == VK_SUCCESS)
     {
-        result = LoadData(data_size, data, staging_buffer_data);
+        // Level copy offsets are relative to the start of the resource data, which has been placed at staging_offset.
+        std::vector<VkBufferImageCopy> staging_copies(level_copies, level_copies + level_count);
 
-        if (result == VK_SUCCESS)
+        for (auto& copy : staging_copies)
         {
-            bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
-                                (sample_count == VK_SAMPLE_COUNT_1_BIT);
-            bool use_color_write =
-                ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
-                (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
-            bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                   (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
-            bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                     (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
-
-            if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) &&
-                (type == VK_IMAGE_TYPE_2D))
-            {
-                result = PixelShaderImageCopy(queue_family_index,
-                                              staging_buffer,
-                                              image,
-                                              type,
-                                              format,
-                                              extent,
-                                              aspect,
-                                              sample_count,
-                                              initial_layout,
-                                              final_layout,
-                                              layer_count,
-                                              level_count,
-                                              level_copies);
-            }
-            else
+            copy.bufferOffset += staging_offset;
+        }
+
+        bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
+                            (sample_count == VK_SAMPLE_COUNT_1_BIT);
+        bool use_color_write = ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
+                               (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
+        bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
+                                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+                               (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
+        bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
+                                  VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+                                 (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
+
+        if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) && (type == VK_IMAGE_TYPE_2D))
+        {
+            result = PixelShaderImageCopy(queue_family_index,
+                                          staging_buffer,
+                                          image,
+                                          type,
+                                          format,
+                                          extent,
+                                          aspect,
+                                          sample_count,
+                                          initial_layout,
+                                          final_layout,
+                                          layer_count,
+                                          level_count,
+                                          staging_copies.data());
+        }
+        else
+        {
+            // Combined depth-stencil images are initialized one aspect at a time with transitions that cover both
+            // aspects, so they are not transferred between queue families.
+            uint32_t copy_queue_family_index = queue_family_index;
+
+            if (GetImageTransitionAspect(format, aspect, nullptr) == static_cast<VkImageAspectFlags>(aspect))
             {
-                result = BufferToImageCopy(queue_family_index,
-                                           staging_buffer,
-                                           image,
-                                           format,
-                                           aspect,
-                                           initial_layout,
-                                           final_layout,
-                                           layer_count,
-                                           level_count,
-                                           level_copies);
+                copy_queue_family_index = GetCopyQueueFamilyIndex(queue_family_index, sharing_mode);
             }
+
+            result = BufferToImageCopy(queue_family_index,
+                                       copy_queue_family_index,
+                                       staging_buffer,
+                                       image,
+                                       format,
+                                       aspect,
+                                       initial_layout,
+                                       final_layout,
+                                       layer_count,
+                                       level_count,
+                                       staging_copies.data());
         }
 
-        ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+        VkResult release_result =
+            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+
+        if (result == VK_SUCCESS)
+        {
+            result = release_result;
+        }
     }
 
     return result;
@@ -230,49 +338,319 @@ VkResult VulkanResourceInitializer::TransitionImage(uint32_t              queue_
                                                     uint32_t              layer_count,
                                                     uint32_t              level_count)
 {
-    VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = GetRecordingCommandBuffer(queue_family_index, &command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        VkImageLayout      old_layout        = initial_layout;
+        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+        VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        memory_barrier.pNext                           = nullptr;
+        memory_barrier.srcAccessMask                   = 0;
+        memory_barrier.dstAccessMask                   = 0;
+        memory_barrier.oldLayout                       = old_layout;
+        memory_barrier.newLayout                       = final_layout;
+        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.image                           = image;
+        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+        memory_barrier.subresourceRange.baseMipLevel   = 0;
+        memory_barrier.subresourceRange.levelCount     = level_count;
+        memory_barrier.subresourceRange.baseArrayLayer = 0;
+        memory_barrier.subresourceRange.layerCount     = layer_count;
+
+        // Transfer stages are used for the barrier so that it is ordered with the other batched commands.
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::Flush()
+{
+    VkResult result = SubmitCommands();
+
+    // The commands that were submitted for the other staging blocks are also waited for, so that all initialization is
+    // complete when the flush returns.
+    for (auto& block : staging_blocks_)
+    {
+        VkResult wait_result = WaitForStagingBlock(&block);
+
+        if (wait_result != VK_SUCCESS)
+        {
+            result = wait_result;
+        }
+    }
+
+    // The space of the other staging blocks is reclaimed.  The current block keeps its space, which is referenced by
+    // the reserved staging data and by the draws that are recorded after a flush for the image being initialized.
+    for (size_t i = 0; i < staging_blocks_.size(); ++i)
+    {
+        if (i != staging_block_index_)
+        {
+            staging_blocks_[i].offset = 0;
+        }
+    }
+
+    ReleaseDrawResources();
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::SubmitCommands()
+{
+    VkResult      result             = VK_SUCCESS;
+    bool          transfer_submitted = false;
+    StagingBlock& block              = staging_blocks_[staging_block_index_];
+
+    // Each queue family signals its own fence for the staging block, as the fence of a submission can only be signaled
+    // by one queue.
+    auto get_fence = [this](CommandExecObjects* exec_objects, VkFence* fence) {
+        VkResult fence_result = VK_SUCCESS;
+
+        if (exec_objects->fences.size() <= staging_block_index_)
+        {
+            exec_objects->fences.resize(staging_block_index_ + 1, VK_NULL_HANDLE);
+        }
+
+        if (exec_objects->fences[staging_block_index_] == VK_NULL_HANDLE)
+        {
+            VkFenceCreateInfo create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            create_info.pNext             = nullptr;
+            create_info.flags             = 0;
+
+            fence_result =
+                device_table_->CreateFence(device_, &create_info, nullptr, &exec_objects->fences[staging_block_index_]);
+        }
+
+        (*fence) = exec_objects->fences[staging_block_index_];
+
+        return fence_result;
+    };
+
+    // The transfer queue command buffer is submitted first, signaling the semaphores that are waited on by the
+    // command buffers that acquire ownership of the resources it initialized.
+    auto transfer_entry = command_exec_objects_.find(transfer_queue_family_index_);
+
+    if ((transfer_entry != command_exec_objects_.end()) && transfer_entry->second.recording)
+    {
+        CommandExecObjects&      exec_objects   = transfer_entry->second;
+        VkCommandBuffer          command_buffer = exec_objects.command_buffers[staging_block_index_];
+        VkFence                  fence          = VK_NULL_HANDLE;
+        std::vector<VkSemaphore> signal_semaphores;
+
+        for (const auto& entry : command_exec_objects_)
+        {
+            if (entry.second.pending_acquire)
+            {
+                signal_semaphores.push_back(entry.second.acquire_semaphore);
+            }
+        }
+
+        exec_objects.recording = false;
+
+        VkResult submit_result = device_table_->EndCommandBuffer(command_buffer);
+
+        if (submit_result == VK_SUCCESS)
+        {
+            submit_result = get_fence(&exec_objects, &fence);
+        }
+
+        if (submit_result == VK_SUCCESS)
+        {
+            VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            submit_info.pNext                = nullptr;
+            submit_info.waitSemaphoreCount   = 0;
+            submit_info.pWaitSemaphores      = nullptr;
+            submit_info.pWaitDstStageMask    = nullptr;
+            submit_info.commandBufferCount   = 1;
+            submit_info.pCommandBuffers      = &command_buffer;
+            submit_info.signalSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size());
+            submit_info.pSignalSemaphores    = signal_semaphores.data();
+
+            submit_result = device_table_->QueueSubmit(exec_objects.queue, 1, &submit_info, fence);
+        }
+
+        if (submit_result == VK_SUCCESS)
+        {
+            block.pending_fences.push_back(fence);
+            transfer_submitted = true;
+        }
+        else
+        {
+            result = submit_result;
+        }
+    }
+
+    for (auto& entry : command_exec_objects_)
+    {
+        CommandExecObjects& exec_objects = entry.second;
+
+        if (exec_objects.recording)
+        {
+            VkCommandBuffer      command_buffer = exec_objects.command_buffers[staging_block_index_];
+            VkFence              fence          = VK_NULL_HANDLE;
+            VkPipelineStageFlags wait_stage     = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            bool                 wait           = exec_objects.pending_acquire && transfer_submitted;
+
+            exec_objects.recording = false;
+
+            VkResult submit_result = device_table_->EndCommandBuffer(command_buffer);
+
+            if (submit_result == VK_SUCCESS)
+            {
+                submit_result = get_fence(&exec_objects, &fence);
+            }
+
+            if (submit_result == VK_SUCCESS)
+            {
+                VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.pNext                = nullptr;
+                submit_info.waitSemaphoreCount   = wait ? 1 : 0;
+                submit_info.pWaitSemaphores      = wait ? &exec_objects.acquire_semaphore : nullptr;
+                submit_info.pWaitDstStageMask    = wait ? &wait_stage : nullptr;
+                submit_info.commandBufferCount   = 1;
+                submit_info.pCommandBuffers      = &command_buffer;
+                submit_info.signalSemaphoreCount = 0;
+                submit_info.pSignalSemaphores    = nullptr;
+
+                submit_result = device_table_->QueueSubmit(exec_objects.queue, 1, &submit_info, fence);
+            }
+
+            if (submit_result == VK_SUCCESS)
+            {
+                block.pending_fences.push_back(fence);
+            }
+            else
+            {
+                result = submit_result;
+            }
+        }
+
+        exec_objects.pending_acquire = false;
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::WaitForStagingBlock(StagingBlock* block)
+{
+    assert(block != nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    if (!block->pending_fences.empty())
+    {
+        uint32_t fence_count = static_cast<uint32_t>(block->pending_fences.size());
+
+        result = device_table_->WaitForFences(
+            device_, fence_count, block->pending_fences.data(), VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table_->ResetFences(device_, fence_count, block->pending_fences.data());
+        }
+
+        block->pending_fences.clear();
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::CreateStagingBlock(StagingBlock* block)
+{
+    assert((block != nullptr) && (block->buffer == VK_NULL_HANDLE));
+
+    VkResult result = CreateStagingBuffer(
+        staging_block_size_, &block->memory, &block->buffer, &block->memory_data, &block->buffer_data);
 
     if (result == VK_SUCCESS)
     {
-        result = BeginCommandBuffer(command_buffer);
+        void* mapped_memory = nullptr;
+        result =
+            resource_allocator_->MapResourceMemoryDirect(staging_block_size_, 0, &mapped_memory, block->buffer_data);
 
         if (result == VK_SUCCESS)
         {
-            VkImageLayout      old_layout        = initial_layout;
-            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = 0;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = final_layout;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = image;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
+            block->data   = reinterpret_cast<uint8_t*>(mapped_memory);
+            block->offset = 0;
+        }
+        else
+        {
+            DestroyStagingBlock(block);
+        }
+    }
 
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
+    return result;
+}
+
+void VulkanResourceInitializer::DestroyStagingBlock(StagingBlock* block)
+{
+    assert(block != nullptr);
 
-            device_table_->EndCommandBuffer(command_buffer);
+    if (block->buffer != VK_NULL_HANDLE)
+    {
+        if (block->data != nullptr)
+        {
+            resource_allocator_->UnmapResourceMemoryDirect(block->buffer_data);
+        }
+
+        resource_allocator_->DestroyBufferDirect(block->buffer, nullptr, block->buffer_data);
+    }
+
+    if (block->memory != VK_NULL_HANDLE)
+    {
+        resource_allocator_->FreeMemoryDirect(block->memory, nullptr, block->memory_data);
+    }
+
+    block->memory      = VK_NULL_HANDLE;
+    block->memory_data = 0;
+    block->buffer      = VK_NULL_HANDLE;
+    block->buffer_data = 0;
+    block->data        = nullptr;
+    block->offset      = 0;
+}
+
+VkResult VulkanResourceInitializer::AdvanceStagingBlock()
+{
+    VkResult result = SubmitCommands();
 
-            result = ExecuteCommandBuffer(queue, command_buffer);
+    if (result == VK_SUCCESS)
+    {
+        size_t        next_index = (staging_block_index_ + 1) % staging_blocks_.size();
+        StagingBlock& next_block = staging_blocks_[next_index];
+
+        result = WaitForStagingBlock(&next_block);
+
+        if ((result == VK_SUCCESS) && (next_block.data == nullptr))
+        {
+            if (CreateStagingBlock(&next_block) != VK_SUCCESS)
+            {
+                // Continue with the current block, after the commands that read from it have completed.
+                result = Flush();
+
+                staging_blocks_[staging_block_index_].offset = 0;
+
+                return result;
+            }
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            next_block.offset    = 0;
+            staging_block_index_ = next_index;
         }
     }
 
@@ -288,12 +666,7 @@ VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue
     VkResult result = VK_SUCCESS;
     auto     iter   = command_exec_objects_.find(queue_family_index);
 
-    if (iter != command_exec_objects_.end())
-    {
-        (*queue)          = iter->second.queue;
-        (*command_buffer) = iter->second.command_buffer;
-    }
-    else
+    if (iter == command_exec_objects_.end())
     {
         VkCommandPool command_pool = VK_NULL_HANDLE;
 
@@ -304,168 +677,397 @@ VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue
 
         result = device_table_->CreateCommandPool(device_, &create_info, nullptr, &command_pool);
 
-        if (result == VK_SUCCESS)
+        if (result != VK_SUCCESS)
         {
-            VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
-            alloc_info.pNext                       = nullptr;
-            alloc_info.commandPool                 = command_pool;
-            alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-            alloc_info.commandBufferCount          = 1;
+            return result;
+        }
+
+        CommandExecObjects exec_objects;
+        exec_objects.command_pool = command_pool;
+        exec_objects.command_buffers.resize(staging_blocks_.size(), VK_NULL_HANDLE);
+        device_table_->GetDeviceQueue(device_, queue_family_index, 0, &exec_objects.queue);
+
+        iter = command_exec_objects_.emplace(queue_family_index, std::move(exec_objects)).first;
+    }
+
+    CommandExecObjects& exec_objects = iter->second;
 
-            result = device_table_->AllocateCommandBuffers(device_, &alloc_info, command_buffer);
+    // Each staging block has its own command buffer, which is recorded while the commands of the other blocks execute.
+    if (exec_objects.command_buffers[staging_block_index_] == VK_NULL_HANDLE)
+    {
+        VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        alloc_info.pNext                       = nullptr;
+        alloc_info.commandPool                 = exec_objects.command_pool;
+        alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount          = 1;
+
+        result = device_table_->AllocateCommandBuffers(
+            device_, &alloc_info, &exec_objects.command_buffers[staging_block_index_]);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        (*queue)          = exec_objects.queue;
+        (*command_buffer) = exec_objects.command_buffers[staging_block_index_];
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::GetRecordingCommandBuffer(uint32_t         queue_family_index,
+                                                              VkCommandBuffer* command_buffer)
+{
+    assert(command_buffer != nullptr);
+
+    VkQueue  queue  = VK_NULL_HANDLE;
+    VkResult result = GetCommandExecObjects(queue_family_index, &queue, command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        auto& exec_objects = command_exec_objects_[queue_family_index];
+
+        // The command buffer remains in the recording state until the next flush, accumulating the commands for all
+        // resources initialized on the queue family.
+        if (!exec_objects.recording)
+        {
+            result = BeginCommandBuffer(*command_buffer);
 
             if (result == VK_SUCCESS)
             {
-                device_table_->GetDeviceQueue(device_, queue_family_index, 0, queue);
+                exec_objects.recording = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::GetAcquireCommandBuffer(uint32_t         queue_family_index,
+                                                            VkCommandBuffer* command_buffer)
+{
+    VkResult result = GetRecordingCommandBuffer(queue_family_index, command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        auto& exec_objects = command_exec_objects_[queue_family_index];
+
+        // The command buffer will wait for the transfer queue command buffer that releases ownership to complete.
+        if (exec_objects.acquire_semaphore == VK_NULL_HANDLE)
+        {
+            VkSemaphoreCreateInfo create_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+            create_info.pNext                 = nullptr;
+            create_info.flags                 = 0;
+
+            result = device_table_->CreateSemaphore(device_, &create_info, nullptr, &exec_objects.acquire_semaphore);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            exec_objects.pending_acquire = true;
+        }
+    }
+
+    return result;
+}
+
+uint32_t VulkanResourceInitializer::GetCopyQueueFamilyIndex(uint32_t queue_family_index, VkSharingMode sharing_mode)
+{
+    // Copies are performed on the dedicated transfer queue family when one is available, with ownership transferred to
+    // the resource's queue family after the copy.  Ownership transfers are not performed for concurrent resources, so
+    // they are copied on their own queue family.
+    if ((transfer_queue_family_index_ != VK_QUEUE_FAMILY_IGNORED) && (sharing_mode == VK_SHARING_MODE_EXCLUSIVE))
+    {
+        return transfer_queue_family_index_;
+    }
+
+    return queue_family_index;
+}
+
+VkResult VulkanResourceInitializer::TransferBufferOwnership(uint32_t src_queue_family_index,
+                                                            uint32_t dst_queue_family_index,
+                                                            VkBuffer buffer)
+{
+    VkCommandBuffer release_command_buffer = VK_NULL_HANDLE;
+    VkCommandBuffer acquire_command_buffer = VK_NULL_HANDLE;
+
+    VkResult result = GetRecordingCommandBuffer(src_queue_family_index, &release_command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        result = GetAcquireCommandBuffer(dst_queue_family_index, &acquire_command_buffer);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkBufferMemoryBarrier memory_barrier = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+        memory_barrier.pNext                 = nullptr;
+        memory_barrier.srcAccessMask         = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.dstAccessMask         = 0;
+        memory_barrier.srcQueueFamilyIndex   = src_queue_family_index;
+        memory_barrier.dstQueueFamilyIndex   = dst_queue_family_index;
+        memory_barrier.buffer                = buffer;
+        memory_barrier.offset                = 0;
+        memory_barrier.size                  = VK_WHOLE_SIZE;
+
+        device_table_->CmdPipelineBarrier(release_command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier,
+                                          0,
+                                          nullptr);
+
+        memory_barrier.srcAccessMask = 0;
+
+        device_table_->CmdPipelineBarrier(acquire_command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier,
+                                          0,
+                                          nullptr);
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::GetDrawDescriptorObjects(VkSampler*        sampler,
+                                                             VkPipelineLayout* pipeline_layout,
+                                                             VkDescriptorSet*  set)
+{
+    assert((sampler != nullptr) && (pipeline_layout != nullptr) && (set != nullptr));
+
+    VkResult result = VK_SUCCESS;
+
+    if (draw_sets_.empty())
+    {
+        result = CreateDrawDescriptorObjects();
+    }
+    else if (draw_set_index_ == draw_sets_.size())
+    {
+        // Each descriptor set is referenced by a recorded draw, so the draws must complete before a set is updated.
+        result = Flush();
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        assert((draw_sampler_ != VK_NULL_HANDLE) && (draw_pipeline_layout_ != VK_NULL_HANDLE) &&
+               (draw_set_index_ < draw_sets_.size()));
 
-                command_exec_objects_.emplace(queue_family_index,
-                                              CommandExecObjects{ *queue, command_pool, *command_buffer });
-            }
-            else
-            {
-                device_table_->DestroyCommandPool(device_, command_pool, nullptr);
-            }
-        }
+        (*sampler)         = draw_sampler_;
+        (*pipeline_layout) = draw_pipeline_layout_;
+        (*set)             = draw_sets_[draw_set_index_++];
     }
 
     return result;
 }
 
-VkResult VulkanResourceInitializer::GetDrawDescriptorObjects(VkSampler*             sampler,
-                                                             VkDescriptorSetLayout* set_layout,
-                                                             VkDescriptorSet*       set)
+VkResult VulkanResourceInitializer::CreateDrawDescriptorObjects()
 {
-    assert((sampler != nullptr) && (set_layout != nullptr) && (set != nullptr));
+    VkSamplerCreateInfo sampler_info     = { VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+    sampler_info.pNext                   = nullptr;
+    sampler_info.flags                   = 0;
+    sampler_info.magFilter               = VK_FILTER_NEAREST;
+    sampler_info.minFilter               = VK_FILTER_NEAREST;
+    sampler_info.mipmapMode              = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    sampler_info.addressModeU            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    sampler_info.addressModeV            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    sampler_info.addressModeW            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    sampler_info.mipLodBias              = 0.0f;
+    sampler_info.anisotropyEnable        = VK_FALSE;
+    sampler_info.maxAnisotropy           = 0.0f;
+    sampler_info.compareEnable           = VK_FALSE;
+    sampler_info.compareOp               = VK_COMPARE_OP_NEVER;
+    sampler_info.minLod                  = 0.0f;
+    sampler_info.maxLod                  = 0.0f;
+    sampler_info.borderColor             = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+    sampler_info.unnormalizedCoordinates = VK_FALSE;
+
+    VkResult result = device_table_->CreateSampler(device_, &sampler_info, nullptr, &draw_sampler_);
 
-    VkResult result = VK_SUCCESS;
+    if (result == VK_SUCCESS)
+    {
+        VkDescriptorPoolSize pool_size[2];
+        pool_size[0].type            = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        pool_size[0].descriptorCount = kDrawSetCount;
+        pool_size[1].type            = VK_DESCRIPTOR_TYPE_SAMPLER;
+        pool_size[1].descriptorCount = kDrawSetCount;
+
+        VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+        pool_info.pNext                      = nullptr;
+        pool_info.flags                      = 0;
+        pool_info.maxSets                    = kDrawSetCount;
+        pool_info.poolSizeCount              = 2;
+        pool_info.pPoolSizes                 = pool_size;
+
+        result = device_table_->CreateDescriptorPool(device_, &pool_info, nullptr, &draw_pool_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkDescriptorSetLayoutBinding set_binding[2];
+        set_binding[0].binding            = 0;
+        set_binding[0].descriptorType     = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        set_binding[0].descriptorCount    = 1;
+        set_binding[0].stageFlags         = VK_SHADER_STAGE_FRAGMENT_BIT;
+        set_binding[0].pImmutableSamplers = nullptr;
+        set_binding[1].binding            = 1;
+        set_binding[1].descriptorType     = VK_DESCRIPTOR_TYPE_SAMPLER;
+        set_binding[1].descriptorCount    = 1;
+        set_binding[1].stageFlags         = VK_SHADER_STAGE_FRAGMENT_BIT;
+        set_binding[1].pImmutableSamplers = nullptr;
+
+        VkDescriptorSetLayoutCreateInfo set_layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+        set_layout_info.pNext                           = nullptr;
+        set_layout_info.flags                           = 0;
+        set_layout_info.bindingCount                    = 2;
+        set_layout_info.pBindings                       = set_binding;
+
+        result = device_table_->CreateDescriptorSetLayout(device_, &set_layout_info, nullptr, &draw_set_layout_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkPipelineLayoutCreateInfo pipeline_layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        pipeline_layout_info.pNext                      = nullptr;
+        pipeline_layout_info.flags                      = 0;
+        pipeline_layout_info.setLayoutCount             = 1;
+        pipeline_layout_info.pSetLayouts                = &draw_set_layout_;
+        pipeline_layout_info.pushConstantRangeCount     = 0;
+        pipeline_layout_info.pPushConstantRanges        = nullptr;
+
+        result = device_table_->CreatePipelineLayout(device_, &pipeline_layout_info, nullptr, &draw_pipeline_layout_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        // A descriptor set is allocated for each draw that can be recorded between flushes, so that the draws for
+        // many images and subresources can be submitted together.
+        std::vector<VkDescriptorSetLayout> set_layouts(kDrawSetCount, draw_set_layout_);
+        std::vector<VkDescriptorSet>       sets(kDrawSetCount, VK_NULL_HANDLE);
 
-    if (draw_set_ == VK_NULL_HANDLE)
-    {
-        VkSamplerCreateInfo sampler_info     = { VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
-        sampler_info.pNext                   = nullptr;
-        sampler_info.flags                   = 0;
-        sampler_info.magFilter               = VK_FILTER_NEAREST;
-        sampler_info.minFilter               = VK_FILTER_NEAREST;
-        sampler_info.mipmapMode              = VK_SAMPLER_MIPMAP_MODE_NEAREST;
-        sampler_info.addressModeU            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        sampler_info.addressModeV            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        sampler_info.addressModeW            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        sampler_info.mipLodBias              = 0.0f;
-        sampler_info.anisotropyEnable        = VK_FALSE;
-        sampler_info.maxAnisotropy           = 0.0f;
-        sampler_info.compareEnable           = VK_FALSE;
-        sampler_info.compareOp               = VK_COMPARE_OP_NEVER;
-        sampler_info.minLod                  = 0.0f;
-        sampler_info.maxLod                  = 0.0f;
-        sampler_info.borderColor             = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
-        sampler_info.unnormalizedCoordinates = VK_FALSE;
-
-        result = device_table_->CreateSampler(device_, &sampler_info, nullptr, &draw_sampler_);
+        VkDescriptorSetAllocateInfo set_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+        set_info.pNext                       = nullptr;
+        set_info.descriptorPool              = draw_pool_;
+        set_info.descriptorSetCount          = kDrawSetCount;
+        set_info.pSetLayouts                 = set_layouts.data();
+
+        result = device_table_->AllocateDescriptorSets(device_, &set_info, sets.data());
 
         if (result == VK_SUCCESS)
         {
-            VkDescriptorPoolSize pool_size[2];
-            pool_size[0].type            = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-            pool_size[0].descriptorCount = 1;
-            pool_size[1].type            = VK_DESCRIPTOR_TYPE_SAMPLER;
-            pool_size[1].descriptorCount = 1;
-
-            VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
-            pool_info.pNext                      = nullptr;
-            pool_info.flags                      = 0;
-            pool_info.maxSets                    = 1;
-            pool_info.poolSizeCount              = 2;
-            pool_info.pPoolSizes                 = pool_size;
-
-            result = device_table_->CreateDescriptorPool(device_, &pool_info, nullptr, &draw_pool_);
+            draw_sets_ = std::move(sets);
         }
+    }
 
-        if (result == VK_SUCCESS)
+    if (result != VK_SUCCESS)
+    {
+        if (draw_sampler_ != VK_NULL_HANDLE)
         {
-            VkDescriptorSetLayoutBinding set_binding[2];
-            set_binding[0].binding            = 0;
-            set_binding[0].descriptorType     = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-            set_binding[0].descriptorCount    = 1;
-            set_binding[0].stageFlags         = VK_SHADER_STAGE_FRAGMENT_BIT;
-            set_binding[0].pImmutableSamplers = nullptr;
-            set_binding[1].binding            = 1;
-            set_binding[1].descriptorType     = VK_DESCRIPTOR_TYPE_SAMPLER;
-            set_binding[1].descriptorCount    = 1;
-            set_binding[1].stageFlags         = VK_SHADER_STAGE_FRAGMENT_BIT;
-            set_binding[1].pImmutableSamplers = nullptr;
-
-            VkDescriptorSetLayoutCreateInfo set_layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
-            set_layout_info.pNext                           = nullptr;
-            set_layout_info.flags                           = 0;
-            set_layout_info.bindingCount                    = 2;
-            set_layout_info.pBindings                       = set_binding;
-
-            result = device_table_->CreateDescriptorSetLayout(device_, &set_layout_info, nullptr, &draw_set_layout_);
+            device_table_->DestroySampler(device_, draw_sampler_, nullptr);
+            draw_sampler_ = VK_NULL_HANDLE;
         }
 
-        if (result == VK_SUCCESS)
+        if (draw_pool_ != VK_NULL_HANDLE)
         {
-            VkDescriptorSetAllocateInfo set_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
-            set_info.pNext                       = nullptr;
-            set_info.descriptorPool              = draw_pool_;
-            set_info.descriptorSetCount          = 1;
-            set_info.pSetLayouts                 = &draw_set_layout_;
+            device_table_->DestroyDescriptorPool(device_, draw_pool_, nullptr);
+            draw_pool_ = VK_NULL_HANDLE;
+        }
 
-            result = device_table_->AllocateDescriptorSets(device_, &set_info, &draw_set_);
+        if (draw_set_layout_ != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyDescriptorSetLayout(device_, draw_set_layout_, nullptr);
+            draw_set_layout_ = VK_NULL_HANDLE;
         }
 
-        if (result != VK_SUCCESS)
+        if (draw_pipeline_layout_ != VK_NULL_HANDLE)
         {
-            if (draw_sampler_ != VK_NULL_HANDLE)
-            {
-                device_table_->DestroySampler(device_, draw_sampler_, nullptr);
-                draw_sampler_ = VK_NULL_HANDLE;
-            }
+            device_table_->DestroyPipelineLayout(device_, draw_pipeline_layout_, nullptr);
+            draw_pipeline_layout_ = VK_NULL_HANDLE;
+        }
+    }
 
-            if (draw_pool_ != VK_NULL_HANDLE)
-            {
-                device_table_->DestroyDescriptorPool(device_, draw_pool_, nullptr);
-                draw_pool_ = VK_NULL_HANDLE;
-            }
+    return result;
+}
 
-            if (draw_set_layout_ != VK_NULL_HANDLE)
-            {
-                device_table_->DestroyDescriptorSetLayout(device_, draw_set_layout_, nullptr);
-                draw_set_layout_ = VK_NULL_HANDLE;
-            }
+VkResult VulkanResourceInitializer::GetDrawObjects(VkFormat              format,
+                                                   VkImageAspectFlagBits aspect,
+                                                   VkSampleCountFlagBits sample_count,
+                                                   VkImageLayout         initial_layout,
+                                                   VkImageLayout         final_layout,
+                                                   VkRenderPass*         pass,
+                                                   VkPipeline*           pipeline)
+{
+    assert((pass != nullptr) && (pipeline != nullptr));
+
+    for (const auto& draw_objects : draw_objects_)
+    {
+        if ((draw_objects.format == format) && (draw_objects.aspect == aspect) &&
+            (draw_objects.sample_count == sample_count) && (draw_objects.initial_layout == initial_layout) &&
+            (draw_objects.final_layout == final_layout))
+        {
+            (*pass)     = draw_objects.pass;
+            (*pipeline) = draw_objects.pipeline;
+            return VK_SUCCESS;
         }
     }
 
+    VkResult result = VK_SUCCESS;
+
+    if (draw_sets_.empty())
+    {
+        result = CreateDrawDescriptorObjects();
+    }
+
     if (result == VK_SUCCESS)
     {
-        assert((draw_sampler_ != VK_NULL_HANDLE) && (draw_set_layout_ != VK_NULL_HANDLE) &&
-               (draw_set_ != VK_NULL_HANDLE));
+        DrawObjects draw_objects    = {};
+        draw_objects.format         = format;
+        draw_objects.aspect         = aspect;
+        draw_objects.sample_count   = sample_count;
+        draw_objects.initial_layout = initial_layout;
+        draw_objects.final_layout   = final_layout;
+
+        result = CreateDrawObjects(format,
+                                   aspect,
+                                   sample_count,
+                                   initial_layout,
+                                   final_layout,
+                                   draw_pipeline_layout_,
+                                   &draw_objects.pass,
+                                   &draw_objects.pipeline);
+
+        if (result == VK_SUCCESS)
+        {
+            draw_objects_.push_back(draw_objects);
 
-        (*sampler)    = draw_sampler_;
-        (*set_layout) = draw_set_layout_;
-        (*set)        = draw_set_;
+            (*pass)     = draw_objects.pass;
+            (*pipeline) = draw_objects.pipeline;
+        }
     }
 
     return result;
 }
 
 VkResult VulkanResourceInitializer::CreateDrawObjects(VkFormat              format,
-                                                      const VkExtent3D&     extent,
                                                       VkImageAspectFlagBits aspect,
                                                       VkSampleCountFlagBits sample_count,
                                                       VkImageLayout         initial_layout,
                                                       VkImageLayout         final_layout,
-                                                      VkDescriptorSetLayout set_layout,
+                                                      VkPipelineLayout      pipeline_layout,
                                                       VkRenderPass*         pass,
-                                                      VkPipelineLayout*     pipeline_layout,
                                                       VkPipeline*           pipeline)
 {
-    assert((set_layout != VK_NULL_HANDLE) && (pass != nullptr) && (pipeline_layout != nullptr) &&
-           (pipeline != nullptr));
+    assert((pipeline_layout != VK_NULL_HANDLE) && (pass != nullptr) && (pipeline != nullptr));
 
-    VkRenderPass     draw_pass            = VK_NULL_HANDLE;
-    VkPipelineLayout draw_pipeline_layout = VK_NULL_HANDLE;
-    VkPipeline       draw_pipeline        = VK_NULL_HANDLE;
+    VkRenderPass draw_pass     = VK_NULL_HANDLE;
+    VkPipeline   draw_pipeline = VK_NULL_HANDLE;
 
     VkAttachmentDescription attachment;
     attachment.flags   = 0;
@@ -526,6 +1128,33 @@ VkResult VulkanResourceInitializer::CreateDrawObjects(VkFormat              form
     subpass.preserveAttachmentCount = 0;
     subpass.pPreserveAttachments    = nullptr;
 
+    // Draws are batched with the other initialization commands, so the render pass is ordered with the transfers that
+    // write the staging images and with the transfers and draws that access the attachment before and after it.
+    const VkPipelineStageFlags attachment_stages = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                                                   VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+                                                   VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    const VkAccessFlags attachment_writes =
+        VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    const VkAccessFlags attachment_accesses = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+                                              VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | attachment_writes;
+
+    VkSubpassDependency dependencies[2];
+    dependencies[0].srcSubpass      = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass      = 0;
+    dependencies[0].srcStageMask    = VK_PIPELINE_STAGE_TRANSFER_BIT | attachment_stages;
+    dependencies[0].dstStageMask    = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | attachment_stages;
+    dependencies[0].srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT | attachment_writes;
+    dependencies[0].dstAccessMask   = VK_ACCESS_SHADER_READ_BIT | attachment_accesses;
+    dependencies[0].dependencyFlags = 0;
+    dependencies[1].srcSubpass      = 0;
+    dependencies[1].dstSubpass      = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask    = attachment_stages;
+    dependencies[1].dstStageMask    = VK_PIPELINE_STAGE_TRANSFER_BIT | attachment_stages;
+    dependencies[1].srcAccessMask   = attachment_writes;
+    dependencies[1].dstAccessMask =
+        VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | attachment_accesses;
+    dependencies[1].dependencyFlags = 0;
+
     VkRenderPassCreateInfo render_pass_info = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
     render_pass_info.pNext                  = nullptr;
     render_pass_info.flags                  = 0;
@@ -533,8 +1162,8 @@ VkResult VulkanResourceInitializer::CreateDrawObjects(VkFormat              form
     render_pass_info.pAttachments           = &attachment;
     render_pass_info.subpassCount           = 1;
     render_pass_info.pSubpasses             = &subpass;
-    render_pass_info.dependencyCount        = 0;
-    render_pass_info.pDependencies          = nullptr;
+    render_pass_info.dependencyCount        = 2;
+    render_pass_info.pDependencies          = dependencies;
 
     VkResult result = device_table_->CreateRenderPass(device_, &render_pass_info, nullptr, &draw_pass);
 
@@ -590,20 +1219,6 @@ VkResult VulkanResourceInitializer::CreateDrawObjects(VkFormat              form
             result = device_table_->CreateShaderModule(device_, &ps_info, nullptr, &ps_module);
         }
 
-        if (result == VK_SUCCESS)
-        {
-            VkPipelineLayoutCreateInfo pipeline_layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
-            pipeline_layout_info.pNext                      = nullptr;
-            pipeline_layout_info.flags                      = 0;
-            pipeline_layout_info.setLayoutCount             = 1;
-            pipeline_layout_info.pSetLayouts                = &set_layout;
-            pipeline_layout_info.pushConstantRangeCount     = 0;
-            pipeline_layout_info.pPushConstantRanges        = nullptr;
-
-            result =
-                device_table_->CreatePipelineLayout(device_, &pipeline_layout_info, nullptr, &draw_pipeline_layout);
-        }
-
         if (result == VK_SUCCESS)
         {
             VkPipelineShaderStageCreateInfo stage_infos[2];
@@ -640,17 +1255,14 @@ VkResult VulkanResourceInitializer::CreateDrawObjects(VkFormat              form
             input_assembly_info.topology               = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
             input_assembly_info.primitiveRestartEnable = VK_FALSE;
 
-            VkViewport viewport     = { 0.0f, 0.0f, static_cast<float>(extent.width), static_cast<float>(extent.height),
-                                    0.0f, 1.0f };
-            VkRect2D   scissor_rect = { { 0, 0 }, { extent.width, extent.height } };
-
+            // The viewport and scissor are dynamic, so that the pipeline can draw to attachments of any size.
             VkPipelineViewportStateCreateInfo viewport_info = { VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
             viewport_info.pNext                             = nullptr;
             viewport_info.flags                             = 0;
             viewport_info.viewportCount                     = 1;
-            viewport_info.pViewports                        = &viewport;
+            viewport_info.pViewports                        = nullptr;
             viewport_info.scissorCount                      = 1;
-            viewport_info.pScissors                         = &scissor_rect;
+            viewport_info.pScissors                         = nullptr;
 
             VkPipelineRasterizationStateCreateInfo rs_info = {
                 VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO
@@ -749,7 +1361,7 @@ VkResult VulkanResourceInitializer::CreateDrawObjects(VkFormat              form
             pipeline_info.pDepthStencilState           = &ds_info;
             pipeline_info.pColorBlendState             = &bs_info;
             pipeline_info.pDynamicState                = &dyn_info;
-            pipeline_info.layout                       = draw_pipeline_layout;
+            pipeline_info.layout                       = pipeline_layout;
             pipeline_info.renderPass                   = draw_pass;
             pipeline_info.subpass                      = 0;
             pipeline_info.basePipelineHandle           = VK_NULL_HANDLE;
@@ -765,35 +1377,57 @@ VkResult VulkanResourceInitializer::CreateDrawObjects(VkFormat              form
 
     if (result == VK_SUCCESS)
     {
-        (*pass)            = draw_pass;
-        (*pipeline_layout) = draw_pipeline_layout;
-        (*pipeline)        = draw_pipeline;
+        (*pass)     = draw_pass;
+        (*pipeline) = draw_pipeline;
     }
     else
     {
-        DestroyDrawObjects(draw_pass, draw_pipeline_layout, draw_pipeline);
+        DestroyDrawObjects(draw_pass, draw_pipeline);
     }
 
     return result;
 }
 
-void VulkanResourceInitializer::DestroyDrawObjects(VkRenderPass     pass,
-                                                   VkPipelineLayout pipeline_layout,
-                                                   VkPipeline       pipeline)
+void VulkanResourceInitializer::DestroyDrawObjects(VkRenderPass pass, VkPipeline pipeline)
 {
     device_table_->DestroyPipeline(device_, pipeline, nullptr);
-    device_table_->DestroyPipelineLayout(device_, pipeline_layout, nullptr);
     device_table_->DestroyRenderPass(device_, pass, nullptr);
 }
 
+void VulkanResourceInitializer::ReleaseDrawResources()
+{
+    for (auto framebuffer : draw_framebuffers_)
+    {
+        device_table_->DestroyFramebuffer(device_, framebuffer, nullptr);
+    }
+
+    for (auto view : draw_views_)
+    {
+        device_table_->DestroyImageView(device_, view, nullptr);
+    }
+
+    for (const auto& staging_image : draw_staging_images_)
+    {
+        DestroyStagingImage(
+            staging_image.memory, staging_image.image, staging_image.memory_data, staging_image.image_data);
+    }
+
+    draw_framebuffers_.clear();
+    draw_views_.clear();
+    draw_staging_images_.clear();
+    draw_staging_size_ = 0;
+    draw_set_index_    = 0;
+}
+
 VkResult VulkanResourceInitializer::CreateStagingImage(const VkImageCreateInfo*               image_create_info,
                                                        VkDeviceMemory*                        memory,
                                                        VkImage*                               image,
                                                        VulkanResourceAllocator::MemoryData*   allocator_memory_data,
-                                                       VulkanResourceAllocator::ResourceData* allocator_image_data)
+                                                       VulkanResourceAllocator::ResourceData* allocator_image_data,
+                                                       VkDeviceSize*                          allocation_size)
 {
     assert((memory != nullptr) && (image != nullptr) && (allocator_memory_data != nullptr) &&
-           (allocator_image_data != nullptr));
+           (allocator_image_data != nullptr) && (allocation_size != nullptr));
 
     VkImage                               staging_image      = VK_NULL_HANDLE;
     VulkanResourceAllocator::ResourceData staging_image_data = 0;
@@ -834,6 +1468,7 @@ VkResult VulkanResourceInitializer::CreateStagingImage(const VkImageCreateInfo*
             (*image)                 = staging_image;
             (*allocator_memory_data) = staging_memory_data;
             (*allocator_image_data)  = staging_image_data;
+            (*allocation_size)       = memory_reqs.size;
         }
         else
         {
@@ -899,103 +1534,133 @@ VkResult VulkanResourceInitializer::CreateFramebufferResources(const VkImageView
     return result;
 }
 
-void VulkanResourceInitializer::DestroyFramebufferResources(VkImageView view, VkFramebuffer framebuffer)
-{
-    device_table_->DestroyFramebuffer(device_, framebuffer, nullptr);
-    device_table_->DestroyImageView(device_, view, nullptr);
-}
-
-VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
-                                                         VkBuffer*                              buffer,
-                                                         VkDeviceSize                           size,
-                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
-                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+VkResult VulkanResourceInitializer::CreateStagingBuffer(VkDeviceSize                           size,
+                                                        VkDeviceMemory*                        memory,
+                                                        VkBuffer*                              buffer,
+                                                        VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                        VulkanResourceAllocator::ResourceData* allocator_buffer_data)
 {
     assert((memory != nullptr) && (buffer != nullptr) && (size > 0) && (allocator_memory_data != nullptr) &&
            (allocator_buffer_data != nullptr));
 
-    VkResult result = VK_SUCCESS;
+    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
 
-    // Create the reusable staging_buffer_ object, with size equal to max_copy_size_, on first acquire, if the requested
-    // size is less than or equal to max_copy_size_.  It the requested size is larger than max_copy_size_, create a
-    // temporary staging buffer that will be destroyed on release.
-    if ((staging_buffer_ == VK_NULL_HANDLE) || (size > max_copy_size_))
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = size;
+    create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
+
+    VkResult result =
+        resource_allocator_->CreateBufferDirect(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
+
+    if (result == VK_SUCCESS)
     {
-        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+        VkMemoryRequirements memory_requirements;
+        device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
+
+        uint32_t memory_type_index =
+            GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+        assert(memory_type_index != std::numeric_limits<uint32_t>::max());
 
-        VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
-        create_info.pNext                 = nullptr;
-        create_info.flags                 = 0;
-        create_info.size                  = std::max(size, max_copy_size_);
-        create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        create_info.queueFamilyIndexCount = 0;
-        create_info.pQueueFamilyIndices   = nullptr;
+        // Allocate the memory for the buffer.
+        VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData staging_memory_data = 0;
+
+        VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        alloc_info.pNext                = nullptr;
+        alloc_info.allocationSize       = memory_requirements.size;
+        alloc_info.memoryTypeIndex      = memory_type_index;
 
-        result = resource_allocator_->CreateBufferDirect(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
+        result = resource_allocator_->AllocateMemoryDirect(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
 
         if (result == VK_SUCCESS)
         {
-            VkMemoryRequirements memory_requirements;
-            device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
+            VkMemoryPropertyFlags flags;
+            result = resource_allocator_->BindBufferMemoryDirect(
+                staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, &flags);
+        }
 
-            uint32_t memory_type_index =
-                GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        if (result == VK_SUCCESS)
+        {
+            (*memory)                = staging_memory;
+            (*buffer)                = staging_buffer;
+            (*allocator_memory_data) = staging_memory_data;
+            (*allocator_buffer_data) = staging_buffer_data;
+        }
+        else
+        {
+            resource_allocator_->DestroyBufferDirect(staging_buffer, nullptr, staging_buffer_data);
 
-            assert(memory_type_index != std::numeric_limits<uint32_t>::max());
+            if (staging_memory != VK_NULL_HANDLE)
+            {
+                resource_allocator_->FreeMemoryDirect(staging_memory, nullptr, staging_memory_data);
+            }
+        }
+    }
 
-            // Allocate the memory for the buffer.
-            VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
-            VulkanResourceAllocator::MemoryData staging_memory_data = 0;
+    return result;
+}
 
-            VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
-            alloc_info.pNext                = nullptr;
-            alloc_info.allocationSize       = memory_requirements.size;
-            alloc_info.memoryTypeIndex      = memory_type_index;
+VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
+                                                         VkBuffer*                              buffer,
+                                                         VkDeviceSize*                          offset,
+                                                         VkDeviceSize                           size,
+                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+{
+    assert((memory != nullptr) && (buffer != nullptr) && (offset != nullptr) && (size > 0) &&
+           (allocator_memory_data != nullptr) && (allocator_buffer_data != nullptr));
 
-            result =
-                resource_allocator_->AllocateMemoryDirect(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
+    VkResult      result = VK_SUCCESS;
+    StagingBlock* block  = &staging_blocks_[staging_block_index_];
 
-            if (result == VK_SUCCESS)
-            {
-                VkMemoryPropertyFlags flags;
-                result = resource_allocator_->BindBufferMemoryDirect(
-                    staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, &flags);
-            }
+    // Create the current staging block, which is persistently mapped and sub-allocated for each upload, on first
+    // acquire.  When the requested size does not fit in the space that remains, the next block of the ring is made
+    // current.  If the requested size is larger than a block, create a temporary staging buffer that will be destroyed
+    // by the next flush.
+    if (block->buffer == VK_NULL_HANDLE)
+    {
+        // Uploads will use temporary staging buffers when the staging block is not available.
+        CreateStagingBlock(block);
+    }
 
-            if (result == VK_SUCCESS)
-            {
-                (*memory)                = staging_memory;
-                (*buffer)                = staging_buffer;
-                (*allocator_memory_data) = staging_memory_data;
-                (*allocator_buffer_data) = staging_buffer_data;
+    if ((block->data != nullptr) && (size <= staging_block_size_))
+    {
+        VkDeviceSize aligned_offset =
+            ((block->offset + kStagingOffsetAlignment - 1) / kStagingOffsetAlignment) * kStagingOffsetAlignment;
 
-                if (size <= max_copy_size_)
-                {
-                    staging_memory_      = staging_memory;
-                    staging_buffer_      = staging_buffer;
-                    staging_memory_data_ = staging_memory_data;
-                    staging_buffer_data_ = staging_buffer_data;
-                }
-            }
-            else
-            {
-                resource_allocator_->DestroyBufferDirect(staging_buffer, nullptr, staging_buffer_data);
+        if ((aligned_offset > staging_block_size_) || (size > (staging_block_size_ - aligned_offset)))
+        {
+            result         = AdvanceStagingBlock();
+            block          = &staging_blocks_[staging_block_index_];
+            aligned_offset = 0;
+        }
 
-                if ((*memory) != VK_NULL_HANDLE)
-                {
-                    resource_allocator_->FreeMemoryDirect(staging_memory, nullptr, staging_memory_data);
-                }
-            }
+        if (result == VK_SUCCESS)
+        {
+            (*memory)                = block->memory;
+            (*buffer)                = block->buffer;
+            (*offset)                = aligned_offset;
+            (*allocator_memory_data) = block->memory_data;
+            (*allocator_buffer_data) = block->buffer_data;
+
+            block->offset = aligned_offset + size;
         }
     }
     else
     {
-        (*memory)                = staging_memory_;
-        (*buffer)                = staging_buffer_;
-        (*allocator_memory_data) = staging_memory_data_;
-        (*allocator_buffer_data) = staging_buffer_data_;
+        result = CreateStagingBuffer(size, memory, buffer, allocator_memory_data, allocator_buffer_data);
+
+        if (result == VK_SUCCESS)
+        {
+            (*offset) = 0;
+        }
     }
 
     return result;
@@ -1006,29 +1671,73 @@ VulkanResourceInitializer::AcquireInitializedStagingBuffer(VkDeviceSize
                                                            const uint8_t*                         data,
                                                            VkDeviceMemory*                        staging_memory,
                                                            VkBuffer*                              staging_buffer,
+                                                           VkDeviceSize*                          staging_offset,
                                                            VulkanResourceAllocator::MemoryData*   staging_memory_data,
                                                            VulkanResourceAllocator::ResourceData* staging_buffer_data)
 {
-    VkResult result =
-        AcquireStagingBuffer(staging_memory, staging_buffer, data_size, staging_memory_data, staging_buffer_data);
+    const StagingBlock* block = &staging_blocks_[staging_block_index_];
+
+    if ((reserved_data_ != nullptr) && (data == reserved_data_) && (data_size == reserved_size_))
+    {
+        // The data was read directly to the space that was reserved for it in the current block.
+        (*staging_memory)      = block->memory;
+        (*staging_buffer)      = block->buffer;
+        (*staging_offset)      = reserved_offset_;
+        (*staging_memory_data) = block->memory_data;
+        (*staging_buffer_data) = block->buffer_data;
+
+        reserved_data_ = nullptr;
+
+        return VK_SUCCESS;
+    }
+
+    // The space of a reservation that was not used is reclaimed when the block is reused.
+    reserved_data_ = nullptr;
+
+    VkResult result = AcquireStagingBuffer(
+        staging_memory, staging_buffer, staging_offset, data_size, staging_memory_data, staging_buffer_data);
 
     if (result == VK_SUCCESS)
     {
-        assert((staging_memory != nullptr) && (staging_memory_data != nullptr));
+        assert((staging_buffer != nullptr) && (staging_offset != nullptr) && (staging_buffer_data != nullptr));
+
+        // The acquire may have made the next block current.
+        block = &staging_blocks_[staging_block_index_];
+
+        if ((*staging_buffer) == block->buffer)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            CopyData(block->data + (*staging_offset), data, static_cast<size_t>(data_size));
+        }
+        else
+        {
+            result = LoadData(data_size, data, *staging_buffer_data);
 
-        result = LoadData(data_size, data, *staging_buffer_data);
+            if (result != VK_SUCCESS)
+            {
+                ReleaseStagingBuffer(*staging_memory, *staging_buffer, *staging_memory_data, *staging_buffer_data);
+            }
+        }
     }
 
     return result;
 }
 
-void VulkanResourceInitializer::ReleaseStagingBuffer(VkDeviceMemory                        memory,
-                                                     VkBuffer                              buffer,
-                                                     VulkanResourceAllocator::MemoryData   staging_memory_data,
-                                                     VulkanResourceAllocator::ResourceData staging_buffer_data)
+VkResult VulkanResourceInitializer::ReleaseStagingBuffer(VkDeviceMemory                        memory,
+                                                         VkBuffer                              buffer,
+                                                         VulkanResourceAllocator::MemoryData   staging_memory_data,
+                                                         VulkanResourceAllocator::ResourceData staging_buffer_data)
 {
-    if (buffer != staging_buffer_)
+    VkResult result = VK_SUCCESS;
+
+    if (std::none_of(staging_blocks_.begin(), staging_blocks_.end(), [buffer](const StagingBlock& block) {
+            return block.buffer == buffer;
+        }))
     {
+        // Temporary staging buffers may be referenced by the recorded commands, which must complete before the buffer
+        // is destroyed.
+        result = Flush();
+
         if (buffer != VK_NULL_HANDLE)
         {
             resource_allocator_->DestroyBufferDirect(buffer, nullptr, staging_buffer_data);
@@ -1039,6 +1748,37 @@ void VulkanResourceInitializer::ReleaseStagingBuffer(VkDeviceMemory
             resource_allocator_->FreeMemoryDirect(memory, nullptr, staging_memory_data);
         }
     }
+
+    return result;
+}
+
+void VulkanResourceInitializer::CopyData(uint8_t* destination, const uint8_t* source, size_t size)
+{
+    if ((copy_thread_count_ > 1) && (size > kParallelCopyThreshold))
+    {
+        // Divide large copies between threads, which write to staging memory with more bandwidth than a single thread.
+        size_t                   chunk_size = (size + copy_thread_count_ - 1) / copy_thread_count_;
+        std::vector<std::thread> threads;
+
+        for (size_t offset = chunk_size; offset < size; offset += chunk_size)
+        {
+            size_t copy_size = std::min(chunk_size, size - offset);
+            threads.emplace_back([destination, source, offset, copy_size]() {
+                util::platform::MemoryCopy(destination + offset, copy_size, source + offset, copy_size);
+            });
+        }
+
+        util::platform::MemoryCopy(destination, chunk_size, source, chunk_size);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    else
+    {
+        util::platform::MemoryCopy(destination, size, source, size);
+    }
 }
 
 void VulkanResourceInitializer::UpdateDrawDescriptorSet(VkDescriptorSet set, VkImageView view, VkSampler sampler)
@@ -1083,28 +1823,6 @@ VkResult VulkanResourceInitializer::BeginCommandBuffer(VkCommandBuffer command_b
     return device_table_->BeginCommandBuffer(command_buffer, &begin_info);
 }
 
-VkResult VulkanResourceInitializer::ExecuteCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer)
-{
-    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
-    submit_info.pNext                = nullptr;
-    submit_info.waitSemaphoreCount   = 0;
-    submit_info.pWaitSemaphores      = nullptr;
-    submit_info.pWaitDstStageMask    = nullptr;
-    submit_info.commandBufferCount   = 1;
-    submit_info.pCommandBuffers      = &command_buffer;
-    submit_info.signalSemaphoreCount = 0;
-    submit_info.pSignalSemaphores    = nullptr;
-
-    VkResult result = device_table_->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
-
-    if (result == VK_SUCCESS)
-    {
-        result = device_table_->QueueWaitIdle(queue);
-    }
-
-    return result;
-}
-
 VkImageAspectFlags VulkanResourceInitializer::GetImageTransitionAspect(VkFormat              format,
                                                                        VkImageAspectFlagBits aspect,
                                                                        VkImageLayout*        old_layout)
@@ -1150,6 +1868,7 @@ uint32_t VulkanResourceInitializer::GetMemoryTypeIndex(uint32_t type_bits, VkMem
 }
 
 VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 queue_family_index,
+                                                      uint32_t                 copy_queue_family_index,
                                                       VkBuffer                 source,
                                                       VkImage                  destination,
                                                       VkFormat                 format,
@@ -1160,57 +1879,66 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
                                                       uint32_t                 level_count,
                                                       const VkBufferImageCopy* level_copies)
 {
-    VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = GetRecordingCommandBuffer(copy_queue_family_index, &command_buffer);
 
     if (result == VK_SUCCESS)
     {
         VkImageLayout      old_layout        = initial_layout;
         VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
 
-        result = BeginCommandBuffer(command_buffer);
-
-        if (result == VK_SUCCESS)
+        VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        memory_barrier.pNext                           = nullptr;
+        memory_barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.oldLayout                       = old_layout;
+        memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.image                           = destination;
+        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+        memory_barrier.subresourceRange.baseMipLevel   = 0;
+        memory_barrier.subresourceRange.levelCount     = level_count;
+        memory_barrier.subresourceRange.baseArrayLayer = 0;
+        memory_barrier.subresourceRange.layerCount     = layer_count;
+
+        // Transfer stages are used for the barriers so that they are ordered with the other batched commands.
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+
+        device_table_->CmdCopyBufferToImage(
+            command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
+
+        bool transition_final_layout =
+            (final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+            (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED);
+
+        if (copy_queue_family_index != queue_family_index)
         {
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = destination;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
+            // Release ownership from the copy queue family and acquire it on the resource's queue family, with the
+            // final layout transition performed by the ownership transfer.
+            VkCommandBuffer acquire_command_buffer = VK_NULL_HANDLE;
 
-            device_table_->CmdCopyBufferToImage(
-                command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
+            result = GetAcquireCommandBuffer(queue_family_index, &acquire_command_buffer);
 
-            if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+            if (result == VK_SUCCESS)
             {
-                memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                memory_barrier.dstAccessMask = 0;
-                memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                memory_barrier.newLayout     = final_layout;
+                memory_barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+                memory_barrier.dstAccessMask       = 0;
+                memory_barrier.oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                memory_barrier.newLayout           = transition_final_layout ? final_layout : memory_barrier.oldLayout;
+                memory_barrier.srcQueueFamilyIndex = copy_queue_family_index;
+                memory_barrier.dstQueueFamilyIndex = queue_family_index;
 
                 device_table_->CmdPipelineBarrier(command_buffer,
                                                   VK_PIPELINE_STAGE_TRANSFER_BIT,
@@ -1222,11 +1950,38 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
                                                   nullptr,
                                                   1,
                                                   &memory_barrier);
-            }
 
-            device_table_->EndCommandBuffer(command_buffer);
+                memory_barrier.srcAccessMask = 0;
+
+                device_table_->CmdPipelineBarrier(acquire_command_buffer,
+                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                                  0,
+                                                  0,
+                                                  nullptr,
+                                                  0,
+                                                  nullptr,
+                                                  1,
+                                                  &memory_barrier);
+            }
+        }
+        else if (transition_final_layout)
+        {
+            memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            memory_barrier.dstAccessMask = 0;
+            memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            memory_barrier.newLayout     = final_layout;
 
-            result = ExecuteCommandBuffer(queue, command_buffer);
+            device_table_->CmdPipelineBarrier(command_buffer,
+                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                              0,
+                                              0,
+                                              nullptr,
+                                              0,
+                                              nullptr,
+                                              1,
+                                              &memory_barrier);
         }
     }
 
@@ -1247,183 +2002,171 @@ VkResult VulkanResourceInitializer::PixelShaderImageCopy(uint32_t
                                                          uint32_t                 level_count,
                                                          const VkBufferImageCopy* level_copies)
 {
-    VkQueue               queue          = VK_NULL_HANDLE;
-    VkCommandBuffer       command_buffer = VK_NULL_HANDLE;
-    VkSampler             sampler        = VK_NULL_HANDLE;
-    VkDescriptorSetLayout set_layout     = VK_NULL_HANDLE;
-    VkDescriptorSet       set            = VK_NULL_HANDLE;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkPipeline   pipeline    = VK_NULL_HANDLE;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result =
+        GetDrawObjects(format, aspect, sample_count, initial_layout, final_layout, &render_pass, &pipeline);
 
-    if (result == VK_SUCCESS)
+    // The staging images of draws are kept until the draws complete, which is limited by flushing when their total
+    // size is too large.
+    if ((result == VK_SUCCESS) && (draw_staging_size_ >= kMaxDrawStagingSize))
     {
-        result = GetDrawDescriptorObjects(&sampler, &set_layout, &set);
+        result = Flush();
     }
 
     if (result == VK_SUCCESS)
     {
-        VkRenderPass     render_pass     = VK_NULL_HANDLE;
-        VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
-        VkPipeline       pipeline        = VK_NULL_HANDLE;
-
-        result = CreateDrawObjects(format,
-                                   extent,
-                                   aspect,
-                                   sample_count,
-                                   initial_layout,
-                                   final_layout,
-                                   set_layout,
-                                   &render_pass,
-                                   &pipeline_layout,
-                                   &pipeline);
+        VkImageCreateInfo image_info     = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+        image_info.pNext                 = nullptr;
+        image_info.flags                 = 0;
+        image_info.imageType             = type;
+        image_info.format                = format;
+        image_info.extent                = extent;
+        image_info.mipLevels             = level_count;
+        image_info.arrayLayers           = layer_count;
+        image_info.samples               = VK_SAMPLE_COUNT_1_BIT;
+        image_info.tiling                = VK_IMAGE_TILING_OPTIMAL;
+        image_info.usage                 = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        image_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+        image_info.queueFamilyIndexCount = 0;
+        image_info.pQueueFamilyIndices   = nullptr;
+        image_info.initialLayout         = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        StagingImage staging_image;
+        VkDeviceSize staging_size = 0;
+
+        result = CreateStagingImage(&image_info,
+                                    &staging_image.memory,
+                                    &staging_image.image,
+                                    &staging_image.memory_data,
+                                    &staging_image.image_data,
+                                    &staging_size);
 
         if (result == VK_SUCCESS)
         {
-            VkImageCreateInfo image_info     = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
-            image_info.pNext                 = nullptr;
-            image_info.flags                 = 0;
-            image_info.imageType             = type;
-            image_info.format                = format;
-            image_info.extent                = extent;
-            image_info.mipLevels             = level_count;
-            image_info.arrayLayers           = layer_count;
-            image_info.samples               = VK_SAMPLE_COUNT_1_BIT;
-            image_info.tiling                = VK_IMAGE_TILING_OPTIMAL;
-            image_info.usage                 = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
-            image_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-            image_info.queueFamilyIndexCount = 0;
-            image_info.pQueueFamilyIndices   = nullptr;
-            image_info.initialLayout         = VK_IMAGE_LAYOUT_UNDEFINED;
-
-            VkImage                               staging_image       = VK_NULL_HANDLE;
-            VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-            VulkanResourceAllocator::ResourceData staging_image_data  = 0;
-            VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-
-            result = CreateStagingImage(
-                &image_info, &staging_memory, &staging_image, &staging_memory_data, &staging_image_data);
-
-            if (result == VK_SUCCESS)
+            // The staging image copy and the draws are recorded with the other initialization commands, and are
+            // ordered by the dependencies of the draw render pass.
+            result = BufferToImageCopy(queue_family_index,
+                                       queue_family_index,
+                                       source,
+                                       staging_image.image,
+                                       format,
+                                       aspect,
+                                       VK_IMAGE_LAYOUT_UNDEFINED,
+                                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                       layer_count,
+                                       level_count,
+                                       level_copies);
+
+            VkViewport viewport     = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+            VkRect2D   scissor_rect = { { 0, 0 }, { 0, 0 } };
+
+            for (uint32_t level = 0; (level < level_count) && (result == VK_SUCCESS); ++level)
             {
-                result = BufferToImageCopy(queue_family_index,
-                                           source,
-                                           staging_image,
-                                           format,
-                                           aspect,
-                                           VK_IMAGE_LAYOUT_UNDEFINED,
-                                           VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-                                           layer_count,
-                                           level_count,
-                                           level_copies);
-
-                if (result == VK_SUCCESS)
+                const VkBufferImageCopy& level_copy = level_copies[level];
+                assert((level_copy.imageSubresource.baseArrayLayer) == 0 &&
+                       (level_copy.imageSubresource.layerCount == layer_count));
+
+                viewport.width             = static_cast<float>(level_copy.imageExtent.width);
+                viewport.height            = static_cast<float>(level_copy.imageExtent.height);
+                scissor_rect.extent.width  = level_copy.imageExtent.width;
+                scissor_rect.extent.height = level_copy.imageExtent.height;
+
+                VkImageViewCreateInfo view_info         = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+                view_info.pNext                         = nullptr;
+                view_info.flags                         = 0;
+                view_info.viewType                      = VK_IMAGE_VIEW_TYPE_2D;
+                view_info.format                        = format;
+                view_info.components.r                  = VK_COMPONENT_SWIZZLE_IDENTITY;
+                view_info.components.g                  = VK_COMPONENT_SWIZZLE_IDENTITY;
+                view_info.components.b                  = VK_COMPONENT_SWIZZLE_IDENTITY;
+                view_info.components.a                  = VK_COMPONENT_SWIZZLE_IDENTITY;
+                view_info.subresourceRange.aspectMask   = aspect;
+                view_info.subresourceRange.baseMipLevel = level;
+                view_info.subresourceRange.levelCount   = 1;
+                view_info.subresourceRange.layerCount   = 1;
+
+                for (uint32_t layer = 0; (layer < layer_count) && (result == VK_SUCCESS); ++layer)
                 {
-                    VkViewport viewport     = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
-                    VkRect2D   scissor_rect = { { 0, 0 }, { 0, 0 } };
+                    VkSampler        sampler          = VK_NULL_HANDLE;
+                    VkPipelineLayout pipeline_layout  = VK_NULL_HANDLE;
+                    VkDescriptorSet  set              = VK_NULL_HANDLE;
+                    VkFramebuffer    framebuffer      = VK_NULL_HANDLE;
+                    VkImageView      destination_view = VK_NULL_HANDLE;
+                    VkImageView      staging_view     = VK_NULL_HANDLE;
+
+                    view_info.subresourceRange.baseArrayLayer = layer;
+
+                    // Acquiring a descriptor set may flush the draws that have been recorded, which does not release
+                    // this staging image until all of its draws have been recorded.
+                    result = GetDrawDescriptorObjects(&sampler, &pipeline_layout, &set);
+
+                    if (result == VK_SUCCESS)
+                    {
+                        view_info.image = staging_image.image;
+                        result          = device_table_->CreateImageView(device_, &view_info, nullptr, &staging_view);
+                    }
+
+                    if (result == VK_SUCCESS)
+                    {
+                        draw_views_.push_back(staging_view);
+
+                        UpdateDrawDescriptorSet(set, staging_view, sampler);
+
+                        view_info.image = destination;
+                        result          = CreateFramebufferResources(&view_info,
+                                                            level_copy.imageExtent.width,
+                                                            level_copy.imageExtent.height,
+                                                            render_pass,
+                                                            &destination_view,
+                                                            &framebuffer);
+                    }
 
-                    for (uint32_t level = 0; level < level_count; ++level)
+                    if (result == VK_SUCCESS)
                     {
-                        const VkBufferImageCopy& level_copy = level_copies[level];
-                        assert((level_copy.imageSubresource.baseArrayLayer) == 0 &&
-                               (level_copy.imageSubresource.layerCount == layer_count));
-
-                        viewport.width             = static_cast<float>(level_copy.imageExtent.width);
-                        viewport.height            = static_cast<float>(level_copy.imageExtent.height);
-                        scissor_rect.extent.width  = level_copy.imageExtent.width;
-                        scissor_rect.extent.height = level_copy.imageExtent.height;
-
-                        VkImageViewCreateInfo view_info         = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
-                        view_info.pNext                         = nullptr;
-                        view_info.flags                         = 0;
-                        view_info.image                         = staging_image;
-                        view_info.viewType                      = VK_IMAGE_VIEW_TYPE_2D;
-                        view_info.format                        = format;
-                        view_info.components.r                  = VK_COMPONENT_SWIZZLE_IDENTITY;
-                        view_info.components.g                  = VK_COMPONENT_SWIZZLE_IDENTITY;
-                        view_info.components.b                  = VK_COMPONENT_SWIZZLE_IDENTITY;
-                        view_info.components.a                  = VK_COMPONENT_SWIZZLE_IDENTITY;
-                        view_info.subresourceRange.aspectMask   = aspect;
-                        view_info.subresourceRange.baseMipLevel = level;
-                        view_info.subresourceRange.levelCount   = 1;
-                        view_info.subresourceRange.layerCount   = 1;
-
-                        for (uint32_t layer = 0; layer < layer_count; ++layer)
+                        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+
+                        draw_views_.push_back(destination_view);
+                        draw_framebuffers_.push_back(framebuffer);
+
+                        result = GetRecordingCommandBuffer(queue_family_index, &command_buffer);
+
+                        if (result == VK_SUCCESS)
                         {
-                            VkFramebuffer framebuffer      = VK_NULL_HANDLE;
-                            VkImageView   destination_view = VK_NULL_HANDLE;
-                            VkImageView   staging_view     = VK_NULL_HANDLE;
-
-                            view_info.subresourceRange.baseArrayLayer = layer;
-
-                            result = device_table_->CreateImageView(device_, &view_info, nullptr, &staging_view);
-
-                            if (result == VK_SUCCESS)
-                            {
-                                UpdateDrawDescriptorSet(set, staging_view, sampler);
-
-                                view_info.image = destination;
-                                result          = CreateFramebufferResources(&view_info,
-                                                                    level_copy.imageExtent.width,
-                                                                    level_copy.imageExtent.height,
-                                                                    render_pass,
-                                                                    &destination_view,
-                                                                    &framebuffer);
-                            }
-
-                            if (result == VK_SUCCESS)
-                            {
-                                result = BeginCommandBuffer(command_buffer);
-
-                                if (result == VK_SUCCESS)
-                                {
-                                    VkRenderPassBeginInfo begin_info    = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
-                                    begin_info.pNext                    = nullptr;
-                                    begin_info.renderPass               = render_pass;
-                                    begin_info.framebuffer              = framebuffer;
-                                    begin_info.renderArea.offset.x      = 0;
-                                    begin_info.renderArea.offset.y      = 0;
-                                    begin_info.renderArea.extent.width  = level_copy.imageExtent.width;
-                                    begin_info.renderArea.extent.height = level_copy.imageExtent.height;
-                                    begin_info.clearValueCount          = 0;
-                                    begin_info.pClearValues             = nullptr;
-
-                                    device_table_->CmdBeginRenderPass(
-                                        command_buffer, &begin_info, VK_SUBPASS_CONTENTS_INLINE);
-                                    device_table_->CmdBindPipeline(
-                                        command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-                                    device_table_->CmdBindDescriptorSets(command_buffer,
-                                                                         VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                                                         pipeline_layout,
-                                                                         0,
-                                                                         1,
-                                                                         &set,
-                                                                         0,
-                                                                         nullptr);
-                                    device_table_->CmdSetViewport(command_buffer, 0, 1, &viewport);
-                                    device_table_->CmdSetScissor(command_buffer, 0, 1, &scissor_rect);
-                                    device_table_->CmdDraw(command_buffer, 3, 1, 0, 0);
-                                    device_table_->CmdEndRenderPass(command_buffer);
-                                    device_table_->EndCommandBuffer(command_buffer);
-
-                                    result = ExecuteCommandBuffer(queue, command_buffer);
-                                }
-                            }
-
-                            DestroyFramebufferResources(destination_view, framebuffer);
-                            device_table_->DestroyImageView(device_, staging_view, nullptr);
-
-                            if (result != VK_SUCCESS)
-                            {
-                                break;
-                            }
+                            VkRenderPassBeginInfo begin_info    = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+                            begin_info.pNext                    = nullptr;
+                            begin_info.renderPass               = render_pass;
+                            begin_info.framebuffer              = framebuffer;
+                            begin_info.renderArea.offset.x      = 0;
+                            begin_info.renderArea.offset.y      = 0;
+                            begin_info.renderArea.extent.width  = level_copy.imageExtent.width;
+                            begin_info.renderArea.extent.height = level_copy.imageExtent.height;
+                            begin_info.clearValueCount          = 0;
+                            begin_info.pClearValues             = nullptr;
+
+                            device_table_->CmdBeginRenderPass(command_buffer, &begin_info, VK_SUBPASS_CONTENTS_INLINE);
+                            device_table_->CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+                            device_table_->CmdBindDescriptorSets(command_buffer,
+                                                                 VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                                                 pipeline_layout,
+                                                                 0,
+                                                                 1,
+                                                                 &set,
+                                                                 0,
+                                                                 nullptr);
+                            device_table_->CmdSetViewport(command_buffer, 0, 1, &viewport);
+                            device_table_->CmdSetScissor(command_buffer, 0, 1, &scissor_rect);
+                            device_table_->CmdDraw(command_buffer, 3, 1, 0, 0);
+                            device_table_->CmdEndRenderPass(command_buffer);
                         }
                     }
                 }
-
-                DestroyStagingImage(staging_memory, staging_image, staging_memory_data, staging_image_data);
             }
 
-            DestroyDrawObjects(render_pass, pipeline_layout, pipeline);
+            // The staging image is destroyed by the flush that completes its draws.
+            draw_staging_images_.push_back(staging_image);
+            draw_staging_size_ += staging_size;
         }
     }
 
@@ -42,6 +42,7 @@ class VulkanResourceInitializer
                               VkDeviceSize                            max_copy_size,
                               const VkPhysicalDeviceMemoryProperties& memory_properties,
                               bool                                    have_shader_stencil_write,
+                              uint32_t                                transfer_family_index,
                               VulkanResourceAllocator*                resource_allocator,
                               const encode::DeviceTable*              device_table);
 
@@ -49,9 +50,16 @@ class VulkanResourceInitializer
 
     VkResult LoadData(VkDeviceSize size, const uint8_t* data, VulkanResourceAllocator::ResourceData allocator_data);
 
+    // Reserves space for resource data in the current staging block, so that the data can be read directly to staging
+    // memory.  The reservation is used when the returned pointer is passed to the next InitializeBuffer() or
+    // InitializeImage() call, which does not copy the data.  Returns nullptr if the data does not fit in a staging
+    // block.
+    uint8_t* ReserveStagingData(VkDeviceSize size);
+
     VkResult InitializeBuffer(VkDeviceSize        data_size,
                               const uint8_t*      data,
                               uint32_t            queue_family_index,
+                              VkSharingMode       sharing_mode,
                               VkBuffer            buffer,
                               VkBufferUsageFlags  usage,
                               uint32_t            region_count,
@@ -60,6 +68,7 @@ class VulkanResourceInitializer
     VkResult InitializeImage(VkDeviceSize             data_size,
                              const uint8_t*           data,
                              uint32_t                 queue_family_index,
+                             VkSharingMode            sharing_mode,
                              VkImage                  image,
                              VkImageType              type,
                              VkFormat                 format,
@@ -82,29 +91,60 @@ class VulkanResourceInitializer
                              uint32_t              layer_count,
                              uint32_t              level_count);
 
+    // Submits the initialization commands that have been recorded since the last flush and waits for them, and for the
+    // commands submitted for earlier staging blocks, to complete.
+    VkResult Flush();
+
   private:
+    struct StagingBlock;
+
+    // Returns the queue and the command buffer of the current staging block for the queue family.
     VkResult GetCommandExecObjects(uint32_t queue_family_index, VkQueue* queue, VkCommandBuffer* command_buffer);
 
-    VkResult GetDrawDescriptorObjects(VkSampler* sampler, VkDescriptorSetLayout* set_layout, VkDescriptorSet* set);
+    VkResult GetRecordingCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer);
+
+    VkResult GetAcquireCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer);
+
+    uint32_t GetCopyQueueFamilyIndex(uint32_t queue_family_index, VkSharingMode sharing_mode);
+
+    VkResult TransferBufferOwnership(uint32_t src_queue_family_index, uint32_t dst_queue_family_index, VkBuffer buffer);
+
+    // Returns the shared draw sampler and pipeline layout, with a descriptor set that is not used by the draws recorded
+    // since the last flush.  The recorded commands are flushed when all of the descriptor sets are in use.
+    VkResult GetDrawDescriptorObjects(VkSampler* sampler, VkPipelineLayout* pipeline_layout, VkDescriptorSet* set);
+
+    VkResult CreateDrawDescriptorObjects();
+
+    // Returns the render pass and pipeline for drawing to an attachment with the format, aspect, sample count, and
+    // layouts, which are created on first use and kept until the resource initializer is destroyed.
+    VkResult GetDrawObjects(VkFormat              format,
+                            VkImageAspectFlagBits aspect,
+                            VkSampleCountFlagBits sample_count,
+                            VkImageLayout         initial_layout,
+                            VkImageLayout         final_layout,
+                            VkRenderPass*         pass,
+                            VkPipeline*           pipeline);
 
     VkResult CreateDrawObjects(VkFormat              format,
-                               const VkExtent3D&     extent,
                                VkImageAspectFlagBits aspect,
                                VkSampleCountFlagBits sample_count,
                                VkImageLayout         initial_layout,
                                VkImageLayout         final_layout,
-                               VkDescriptorSetLayout set_layout,
+                               VkPipelineLayout      pipeline_layout,
                                VkRenderPass*         pass,
-                               VkPipelineLayout*     pipeline_layout,
                                VkPipeline*           pipeline);
 
-    void DestroyDrawObjects(VkRenderPass pass, VkPipelineLayout pipeline_layout, VkPipeline pipeline);
+    void DestroyDrawObjects(VkRenderPass pass, VkPipeline pipeline);
+
+    // Destroys the image views, framebuffers, and staging images of the draws that were recorded before the last flush.
+    void ReleaseDrawResources();
 
     VkResult CreateStagingImage(const VkImageCreateInfo*               image_create_info,
                                 VkDeviceMemory*                        memory,
                                 VkImage*                               image,
                                 VulkanResourceAllocator::MemoryData*   allocator_memory_data,
-                                VulkanResourceAllocator::ResourceData* allocator_image_data);
+                                VulkanResourceAllocator::ResourceData* allocator_image_data,
+                                VkDeviceSize*                          allocation_size);
 
     void DestroyStagingImage(VkDeviceMemory                        memory,
                              VkImage                               image,
@@ -118,10 +158,31 @@ class VulkanResourceInitializer
                                         VkImageView*                 view,
                                         VkFramebuffer*               framebuffer);
 
-    void DestroyFramebufferResources(VkImageView view, VkFramebuffer framebuffer);
+    // Ends and submits the command buffers that are recording, with the fences of the current staging block, without
+    // waiting for them to complete.
+    VkResult SubmitCommands();
+
+    // Waits for the commands that were submitted with the staging block to complete.
+    VkResult WaitForStagingBlock(StagingBlock* block);
+
+    VkResult CreateStagingBlock(StagingBlock* block);
+
+    void DestroyStagingBlock(StagingBlock* block);
+
+    // Submits the commands recorded for the current staging block and makes the next block of the ring current, waiting
+    // for the commands of its previous use to complete.  When the next block cannot be created, the commands are
+    // flushed and the current block is reused.
+    VkResult AdvanceStagingBlock();
+
+    VkResult CreateStagingBuffer(VkDeviceSize                           size,
+                                 VkDeviceMemory*                        memory,
+                                 VkBuffer*                              buffer,
+                                 VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                 VulkanResourceAllocator::ResourceData* allocator_buffer_data);
 
     VkResult AcquireStagingBuffer(VkDeviceMemory*                        memory,
                                   VkBuffer*                              buffer,
+                                  VkDeviceSize*                          offset,
                                   VkDeviceSize                           size,
                                   VulkanResourceAllocator::MemoryData*   allocator_memory_data,
                                   VulkanResourceAllocator::ResourceData* allocator_buffer_data);
@@ -130,26 +191,28 @@ class VulkanResourceInitializer
                                              const uint8_t*                         data,
                                              VkDeviceMemory*                        staging_memory,
                                              VkBuffer*                              staging_buffer,
+                                             VkDeviceSize*                          staging_offset,
                                              VulkanResourceAllocator::MemoryData*   staging_memory_data,
                                              VulkanResourceAllocator::ResourceData* staging_buffer_data);
 
-    void ReleaseStagingBuffer(VkDeviceMemory                        memory,
-                              VkBuffer                              buffer,
-                              VulkanResourceAllocator::MemoryData   staging_memory_data,
-                              VulkanResourceAllocator::ResourceData staging_buffer_data);
+    VkResult ReleaseStagingBuffer(VkDeviceMemory                        memory,
+                                  VkBuffer                              buffer,
+                                  VulkanResourceAllocator::MemoryData   staging_memory_data,
+                                  VulkanResourceAllocator::ResourceData staging_buffer_data);
+
+    void CopyData(uint8_t* destination, const uint8_t* source, size_t size);
 
     void UpdateDrawDescriptorSet(VkDescriptorSet set, VkImageView view, VkSampler sampler);
 
     VkResult BeginCommandBuffer(VkCommandBuffer command_buffer);
 
-    VkResult ExecuteCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
-
     VkImageAspectFlags
     GetImageTransitionAspect(VkFormat format, VkImageAspectFlagBits aspect, VkImageLayout* old_layout);
 
     uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags);
 
     VkResult BufferToImageCopy(uint32_t                 queue_family_index,
+                               uint32_t                 copy_queue_family_index,
                                VkBuffer                 source,
                                VkImage                  destination,
                                VkFormat                 format,
@@ -177,28 +240,99 @@ class VulkanResourceInitializer
   private:
     struct CommandExecObjects
     {
-        VkQueue         queue;
-        VkCommandPool   command_pool;
-        VkCommandBuffer command_buffer;
+        VkQueue                      queue{ VK_NULL_HANDLE };
+        VkCommandPool                command_pool{ VK_NULL_HANDLE };
+        std::vector<VkCommandBuffer> command_buffers; // Command buffer for each staging block.
+        std::vector<VkFence>         fences;          // Fence for the submission of each staging block.
+        VkSemaphore                  acquire_semaphore{ VK_NULL_HANDLE };
+        bool                         recording{ false };
+        bool                         pending_acquire{ false };
     };
 
     // Map queue family index to command pool, command buffer, and queue objects for command processing.
     typedef std::unordered_map<uint32_t, CommandExecObjects> CommandExecObjectMap;
 
+    struct DrawObjects
+    {
+        VkFormat              format;
+        VkImageAspectFlagBits aspect;
+        VkSampleCountFlagBits sample_count;
+        VkImageLayout         initial_layout;
+        VkImageLayout         final_layout;
+        VkRenderPass          pass;
+        VkPipeline            pipeline;
+    };
+
+    // Persistently mapped staging memory that is sub-allocated for each upload.  The blocks are used as a ring, where
+    // the commands that read from a block are submitted when the next block is made current, and are only waited for
+    // when the ring returns to the block.
+    struct StagingBlock
+    {
+        VkDeviceMemory                        memory{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::MemoryData   memory_data{ 0 };
+        VkBuffer                              buffer{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::ResourceData buffer_data{ 0 };
+        uint8_t*                              data{ nullptr };
+        VkDeviceSize                          offset{ 0 };
+        std::vector<VkFence>                  pending_fences; // Fences of the submissions that read from the block.
+    };
+
+    struct StagingImage
+    {
+        VkDeviceMemory                        memory{ VK_NULL_HANDLE };
+        VkImage                               image{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::MemoryData   memory_data{ 0 };
+        VulkanResourceAllocator::ResourceData image_data{ 0 };
+    };
+
+  private:
+    // Minimum size of a staging block, which is sub-allocated for each upload until it is full, so that many small
+    // resources can be initialized with a single submission.
+    static const VkDeviceSize kMinStagingBufferSize{ 64 * 1024 * 1024 };
+
+    // Number of staging blocks in the ring, and the total size of the blocks beyond which the ring is not extended.
+    static const size_t       kStagingBlockCount{ 3 };
+    static const VkDeviceSize kMaxStagingPoolSize{ 256 * 1024 * 1024 };
+
+    // Staging buffer offsets are aligned to a multiple of every texel block size and of 4, as required for buffer to
+    // image copies.
+    static const VkDeviceSize kStagingOffsetAlignment{ 96 };
+
+    // Copies to staging memory that are larger than this size are divided between multiple threads.
+    static const size_t   kParallelCopyThreshold{ 16 * 1024 * 1024 };
+    static const uint32_t kMaxParallelCopyThreads{ 8 };
+
+    // Number of draws that can be recorded between flushes, each with its own descriptor set.
+    static const uint32_t kDrawSetCount{ 256 };
+
+    // Staging images of recorded draws are released by a flush once their total size reaches this limit.
+    static const VkDeviceSize kMaxDrawStagingSize{ 256 * 1024 * 1024 };
+
   private:
     VkDevice                              device_;
     CommandExecObjectMap                  command_exec_objects_;
-    VkDeviceMemory                        staging_memory_;
-    VulkanResourceAllocator::MemoryData   staging_memory_data_;
-    VkBuffer                              staging_buffer_;
-    VulkanResourceAllocator::ResourceData staging_buffer_data_;
+    std::vector<StagingBlock>             staging_blocks_;
+    size_t                                staging_block_index_; // Current staging block.
+    VkDeviceSize                          staging_block_size_;
+    uint8_t*                              reserved_data_; // Staging data reserved by ReserveStagingData().
+    VkDeviceSize                          reserved_offset_;
+    VkDeviceSize                          reserved_size_;
     VkSampler                             draw_sampler_;
     VkDescriptorPool                      draw_pool_;
     VkDescriptorSetLayout                 draw_set_layout_;
-    VkDescriptorSet                       draw_set_;
+    VkPipelineLayout                      draw_pipeline_layout_;
+    std::vector<VkDescriptorSet>          draw_sets_;
+    uint32_t                              draw_set_index_; // Next descriptor set that is free for a draw.
+    std::vector<DrawObjects>              draw_objects_;
+    std::vector<VkImageView>              draw_views_;        // Views that are referenced by recorded draws.
+    std::vector<VkFramebuffer>            draw_framebuffers_; // Framebuffers that are referenced by recorded draws.
+    std::vector<StagingImage>             draw_staging_images_;
+    VkDeviceSize                          draw_staging_size_;
     VkDeviceSize                          max_copy_size_;
     VkPhysicalDeviceMemoryProperties      memory_properties_;
     bool                                  have_shader_stencil_write_;
+    uint32_t                              transfer_queue_family_index_;
+    uint32_t                              copy_thread_count_;
     VulkanResourceAllocator*              resource_allocator_;
     const encode::DeviceTable*            device_table_;
 };
@@ -21,10 +21,12 @@
 */
 
 #include "decode/vulkan_resource_tracking_consumer.h"
+#include "util/hash.h"
 
 #include <algorithm>
 #include <cassert>
 #include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -124,6 +126,81 @@ const encode::DeviceTable* VulkanResourceTrackingConsumer::GetDeviceTable(const
     return (table != device_tables_.end()) ? &table->second : nullptr;
 }
 
+uint64_t VulkanResourceTrackingConsumer::GetPhysicalDeviceSignature()
+{
+    if (loader_handle_ == nullptr)
+    {
+        InitializeLoader();
+    }
+
+    if (create_instance_function_ == nullptr)
+    {
+        return 0;
+    }
+
+    VkInstanceCreateInfo create_info = { VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+    VkInstance           instance    = VK_NULL_HANDLE;
+
+    if (create_instance_function_(&create_info, nullptr, &instance) != VK_SUCCESS)
+    {
+        return 0;
+    }
+
+    auto destroy_instance =
+        reinterpret_cast<PFN_vkDestroyInstance>(get_instance_proc_addr_(instance, "vkDestroyInstance"));
+    auto enumerate_physical_devices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(
+        get_instance_proc_addr_(instance, "vkEnumeratePhysicalDevices"));
+    auto get_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(
+        get_instance_proc_addr_(instance, "vkGetPhysicalDeviceProperties"));
+    auto get_memory_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties>(
+        get_instance_proc_addr_(instance, "vkGetPhysicalDeviceMemoryProperties"));
+
+    uint64_t                      signature = 0;
+    uint32_t                      count     = 0;
+    std::vector<VkPhysicalDevice> physical_devices;
+
+    if ((enumerate_physical_devices != nullptr) && (get_properties != nullptr) && (get_memory_properties != nullptr) &&
+        (enumerate_physical_devices(instance, &count, nullptr) == VK_SUCCESS))
+    {
+        physical_devices.resize(count);
+
+        if (enumerate_physical_devices(instance, &count, physical_devices.data()) == VK_SUCCESS)
+        {
+            // The resource tracking pass maps the captured physical devices to the replay physical devices by index, so
+            // the devices are hashed in enumeration order.
+            util::hash::ContentHasher hasher;
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                VkPhysicalDeviceProperties       properties{};
+                VkPhysicalDeviceMemoryProperties memory_properties{};
+
+                get_properties(physical_devices[i], &properties);
+                get_memory_properties(physical_devices[i], &memory_properties);
+
+                hasher.Update(&properties.apiVersion, sizeof(properties.apiVersion));
+                hasher.Update(&properties.driverVersion, sizeof(properties.driverVersion));
+                hasher.Update(&properties.vendorID, sizeof(properties.vendorID));
+                hasher.Update(&properties.deviceID, sizeof(properties.deviceID));
+                hasher.Update(properties.pipelineCacheUUID, sizeof(properties.pipelineCacheUUID));
+                hasher.Update(&memory_properties.memoryTypeCount, sizeof(memory_properties.memoryTypeCount));
+                hasher.Update(memory_properties.memoryTypes,
+                              memory_properties.memoryTypeCount * sizeof(memory_properties.memoryTypes[0]));
+            }
+
+            // Zero is reserved for failure.
+            signature = std::max<uint64_t>(hasher.Digest64(), 1);
+        }
+    }
+
+    if (destroy_instance != nullptr)
+    {
+        destroy_instance(instance, nullptr);
+    }
+
+    return signature;
+}
+
 void VulkanResourceTrackingConsumer::Process_vkCreateInstance(
     VkResult                                             returnValue,
     StructPointerDecoder<Decoded_VkInstanceCreateInfo>*  pCreateInfo,
@@ -62,6 +62,10 @@ class VulkanResourceTrackingConsumer : public VulkanConsumer
 
     const encode::DeviceTable* GetDeviceTable(const void* handle) const;
 
+    // Returns a hash of the properties of the replay system's physical devices that determine the replay memory
+    // requirements of the tracked resources, or 0 if the physical devices cannot be queried.
+    uint64_t GetPhysicalDeviceSignature();
+
     virtual void Process_vkCreateInstance(VkResult                                             returnValue,
                                           StructPointerDecoder<Decoded_VkInstanceCreateInfo>*  pCreateInfo,
                                           StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
@@ -0,0 +1,321 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_retained_objects.h"
+
+#include "graphics/vulkan_util.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+struct ExtensionStructInfo
+{
+    VkStructureType type;
+    size_t          size;
+};
+
+// Device create info extension structures that only enable features, which are compared by their contents.
+const ExtensionStructInfo kDeviceFeatureStructs[] = {
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, sizeof(VkPhysicalDeviceFeatures2) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES, sizeof(VkPhysicalDeviceVulkan11Features) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES, sizeof(VkPhysicalDeviceVulkan12Features) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES, sizeof(VkPhysicalDevice16BitStorageFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES, sizeof(VkPhysicalDevice8BitStorageFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES, sizeof(VkPhysicalDeviceMultiviewFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES, sizeof(VkPhysicalDeviceVariablePointersFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES,
+      sizeof(VkPhysicalDeviceSamplerYcbcrConversionFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES,
+      sizeof(VkPhysicalDeviceShaderDrawParametersFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES,
+      sizeof(VkPhysicalDeviceShaderFloat16Int8Features) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES,
+      sizeof(VkPhysicalDeviceDescriptorIndexingFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES,
+      sizeof(VkPhysicalDeviceScalarBlockLayoutFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES,
+      sizeof(VkPhysicalDeviceImagelessFramebufferFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES,
+      sizeof(VkPhysicalDeviceUniformBufferStandardLayoutFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES,
+      sizeof(VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES,
+      sizeof(VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES, sizeof(VkPhysicalDeviceHostQueryResetFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
+      sizeof(VkPhysicalDeviceTimelineSemaphoreFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES,
+      sizeof(VkPhysicalDeviceBufferDeviceAddressFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES,
+      sizeof(VkPhysicalDeviceVulkanMemoryModelFeatures) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR,
+      sizeof(VkPhysicalDeviceAccelerationStructureFeaturesKHR) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR,
+      sizeof(VkPhysicalDeviceRayTracingPipelineFeaturesKHR) },
+    { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR, sizeof(VkPhysicalDeviceRayQueryFeaturesKHR) }
+};
+
+template <typename T>
+static void AppendKeyValue(const T& value, std::string* key)
+{
+    key->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void AppendKeyString(const char* value, std::string* key)
+{
+    if (value != nullptr)
+    {
+        key->append(value);
+    }
+
+    key->push_back('\0');
+}
+
+// Extensions are sorted so that lists with a different order of the same extensions match.
+static void AppendKeyExtensions(uint32_t count, const char* const* names, std::string* key)
+{
+    std::vector<std::string> extensions;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        extensions.emplace_back(names[i]);
+    }
+
+    std::sort(extensions.begin(), extensions.end());
+
+    AppendKeyValue(count, key);
+
+    for (const auto& extension : extensions)
+    {
+        AppendKeyString(extension.c_str(), key);
+    }
+}
+
+VulkanRetainedObjects::VulkanRetainedObjects() : loader_handle_(nullptr) {}
+
+VulkanRetainedObjects::~VulkanRetainedObjects()
+{
+    for (const auto& entry : devices_)
+    {
+        entry.destroy_device(entry.device, nullptr);
+    }
+
+    for (const auto& entry : instances_)
+    {
+        entry.destroy_instance(entry.instance, nullptr);
+    }
+
+    graphics::ReleaseLoader(loader_handle_);
+}
+
+bool VulkanRetainedObjects::GetInstanceKey(const VkInstanceCreateInfo* create_info, std::string* key)
+{
+    assert((create_info != nullptr) && (key != nullptr));
+
+    // Debug callbacks for instance creation are replaced by the replay callbacks, and do not affect the instance.
+    auto next = reinterpret_cast<const VkBaseInStructure*>(create_info->pNext);
+    while (next != nullptr)
+    {
+        if ((next->sType != VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT) &&
+            (next->sType != VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT))
+        {
+            return false;
+        }
+
+        next = next->pNext;
+    }
+
+    key->clear();
+    AppendKeyValue(create_info->flags, key);
+
+    // Application and engine names are included because drivers may select application specific behavior with them.
+    const VkApplicationInfo* app_info = create_info->pApplicationInfo;
+    if (app_info != nullptr)
+    {
+        AppendKeyString(app_info->pApplicationName, key);
+        AppendKeyValue(app_info->applicationVersion, key);
+        AppendKeyString(app_info->pEngineName, key);
+        AppendKeyValue(app_info->engineVersion, key);
+        AppendKeyValue(app_info->apiVersion, key);
+    }
+
+    AppendKeyExtensions(create_info->enabledExtensionCount, create_info->ppEnabledExtensionNames, key);
+
+    return true;
+}
+
+bool VulkanRetainedObjects::GetDeviceKey(VkPhysicalDevice          physical_device,
+                                         const VkDeviceCreateInfo* create_info,
+                                         std::string*              key)
+{
+    assert((create_info != nullptr) && (key != nullptr));
+
+    key->clear();
+    AppendKeyValue(physical_device, key);
+    AppendKeyValue(create_info->flags, key);
+    AppendKeyValue(create_info->queueCreateInfoCount, key);
+
+    for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i)
+    {
+        const VkDeviceQueueCreateInfo& queue_info = create_info->pQueueCreateInfos[i];
+
+        if (queue_info.pNext != nullptr)
+        {
+            return false;
+        }
+
+        AppendKeyValue(queue_info.flags, key);
+        AppendKeyValue(queue_info.queueFamilyIndex, key);
+        AppendKeyValue(queue_info.queueCount, key);
+        key->append(reinterpret_cast<const char*>(queue_info.pQueuePriorities),
+                    queue_info.queueCount * sizeof(queue_info.pQueuePriorities[0]));
+    }
+
+    AppendKeyExtensions(create_info->enabledExtensionCount, create_info->ppEnabledExtensionNames, key);
+
+    if (create_info->pEnabledFeatures != nullptr)
+    {
+        AppendKeyValue(*create_info->pEnabledFeatures, key);
+    }
+    else
+    {
+        key->push_back('\0');
+    }
+
+    auto next = reinterpret_cast<const VkBaseInStructure*>(create_info->pNext);
+    while (next != nullptr)
+    {
+        auto end  = std::end(kDeviceFeatureStructs);
+        auto info = std::find_if(std::begin(kDeviceFeatureStructs), end, [next](const ExtensionStructInfo& entry) {
+            return entry.type == next->sType;
+        });
+
+        if (info == end)
+        {
+            return false;
+        }
+
+        // The structure contents that follow sType and pNext are feature flags.
+        AppendKeyValue(next->sType, key);
+        key->append(reinterpret_cast<const char*>(next) + sizeof(VkBaseInStructure),
+                    info->size - sizeof(VkBaseInStructure));
+
+        next = next->pNext;
+    }
+
+    return true;
+}
+
+void VulkanRetainedObjects::RetainLoader(util::platform::LibraryHandle loader_handle)
+{
+    if (loader_handle_ == nullptr)
+    {
+        loader_handle_ = loader_handle;
+    }
+    else
+    {
+        graphics::ReleaseLoader(loader_handle);
+    }
+}
+
+void VulkanRetainedObjects::RetainInstance(const std::string&    key,
+                                           VkInstance            instance,
+                                           PFN_vkDestroyInstance destroy_instance)
+{
+    assert((instance != VK_NULL_HANDLE) && (destroy_instance != nullptr));
+
+    RetainedInstance entry;
+    entry.key              = key;
+    entry.instance         = instance;
+    entry.destroy_instance = destroy_instance;
+    instances_.emplace_back(std::move(entry));
+}
+
+VkInstance VulkanRetainedObjects::AcquireInstance(const std::string& key)
+{
+    auto entry = std::find_if(
+        instances_.begin(), instances_.end(), [&key](const RetainedInstance& retained) { return retained.key == key; });
+
+    if (entry == instances_.end())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    VkInstance instance = entry->instance;
+    instances_.erase(entry);
+
+    return instance;
+}
+
+void VulkanRetainedObjects::RetainDevice(const std::string&  key,
+                                         VkDevice            device,
+                                         VkInstance          instance,
+                                         PFN_vkDestroyDevice destroy_device)
+{
+    assert((device != VK_NULL_HANDLE) && (destroy_device != nullptr));
+
+    RetainedDevice entry;
+    entry.key            = key;
+    entry.device         = device;
+    entry.instance       = instance;
+    entry.destroy_device = destroy_device;
+    devices_.emplace_back(std::move(entry));
+}
+
+VkDevice VulkanRetainedObjects::AcquireDevice(const std::string& key)
+{
+    auto entry = std::find_if(
+        devices_.begin(), devices_.end(), [&key](const RetainedDevice& retained) { return retained.key == key; });
+
+    if (entry == devices_.end())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    VkDevice device = entry->device;
+    devices_.erase(entry);
+
+    return device;
+}
+
+void VulkanRetainedObjects::DestroyInstanceDevices(VkInstance instance)
+{
+    auto entry = devices_.begin();
+    while (entry != devices_.end())
+    {
+        if (entry->instance == instance)
+        {
+            entry->destroy_device(entry->device, nullptr);
+            entry = devices_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
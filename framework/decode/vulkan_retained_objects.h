@@ -0,0 +1,99 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_RETAINED_OBJECTS_H
+#define GFXRECON_DECODE_VULKAN_RETAINED_OBJECTS_H
+
+#include "util/defines.h"
+#include "util/platform.h"
+
+#include "vulkan/vulkan.h"
+
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Instances and devices that are kept alive when the replay of a capture file destroys them, so that the replay of a
+// later capture file in the same process can use them in place of creating an instance or device with the same create
+// parameters.  Objects are matched by a key that is built from their create parameters, and the objects that are not
+// reused are destroyed with the retained objects.
+class VulkanRetainedObjects
+{
+  public:
+    VulkanRetainedObjects();
+
+    ~VulkanRetainedObjects();
+
+    // Builds the key that matches instances with the same create parameters.  Returns false when the create info has
+    // extension structures that prevent the instance from being reused.
+    static bool GetInstanceKey(const VkInstanceCreateInfo* create_info, std::string* key);
+
+    // Builds the key that matches devices with the same physical device and create parameters.  Returns false when the
+    // create info has extension structures that are not known to only enable features.
+    static bool GetDeviceKey(VkPhysicalDevice physical_device, const VkDeviceCreateInfo* create_info, std::string* key);
+
+    // Keeps the loader loaded while there are retained objects, taking ownership of the handle.
+    void RetainLoader(util::platform::LibraryHandle loader_handle);
+
+    void RetainInstance(const std::string& key, VkInstance instance, PFN_vkDestroyInstance destroy_instance);
+
+    // Removes and returns a retained instance with the key, or VK_NULL_HANDLE when there is no match.
+    VkInstance AcquireInstance(const std::string& key);
+
+    // Retains an idle device without child objects.  The device is destroyed when its instance is destroyed with
+    // DestroyInstanceDevices().
+    void RetainDevice(const std::string& key, VkDevice device, VkInstance instance, PFN_vkDestroyDevice destroy_device);
+
+    // Removes and returns a retained device with the key, or VK_NULL_HANDLE when there is no match.
+    VkDevice AcquireDevice(const std::string& key);
+
+    // Destroys the retained devices that were created from an instance that is being destroyed.
+    void DestroyInstanceDevices(VkInstance instance);
+
+  private:
+    struct RetainedInstance
+    {
+        std::string           key;
+        VkInstance            instance{ VK_NULL_HANDLE };
+        PFN_vkDestroyInstance destroy_instance{ nullptr };
+    };
+
+    struct RetainedDevice
+    {
+        std::string         key;
+        VkDevice            device{ VK_NULL_HANDLE };
+        VkInstance          instance{ VK_NULL_HANDLE };
+        PFN_vkDestroyDevice destroy_device{ nullptr };
+    };
+
+  private:
+    util::platform::LibraryHandle loader_handle_;
+    std::vector<RetainedInstance> instances_;
+    std::vector<RetainedDevice>   devices_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_RETAINED_OBJECTS_H
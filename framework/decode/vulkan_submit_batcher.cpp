@@ -0,0 +1,145 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_submit_batcher.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanSubmitBatcher::VulkanSubmitBatcher() :
+    queue_submit_(nullptr), queue_(VK_NULL_HANDLE), call_count_(0), batch_count_(0), batched_call_count_(0)
+{}
+
+bool VulkanSubmitBatcher::CanBatch(uint32_t submit_count, const VkSubmitInfo* submits)
+{
+    for (uint32_t i = 0; i < submit_count; ++i)
+    {
+        if (submits[i].pNext != nullptr)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+VkResult VulkanSubmitBatcher::Add(PFN_vkQueueSubmit   queue_submit,
+                                  VkQueue             queue,
+                                  uint32_t            submit_count,
+                                  const VkSubmitInfo* submits,
+                                  VkFence             fence)
+{
+    assert((queue_submit != nullptr) && CanBatch(submit_count, submits));
+
+    VkResult result = VK_SUCCESS;
+
+    if ((queue_ != queue) && HasPendingSubmits())
+    {
+        result = Flush();
+    }
+
+    queue_submit_ = queue_submit;
+    queue_        = queue;
+    ++call_count_;
+
+    for (uint32_t i = 0; i < submit_count; ++i)
+    {
+        const VkSubmitInfo& submit = submits[i];
+        BatchedSubmit       batched_submit;
+
+        if (submit.waitSemaphoreCount > 0)
+        {
+            batched_submit.wait_semaphores.assign(submit.pWaitSemaphores,
+                                                  submit.pWaitSemaphores + submit.waitSemaphoreCount);
+            batched_submit.wait_dst_stage_masks.assign(submit.pWaitDstStageMask,
+                                                       submit.pWaitDstStageMask + submit.waitSemaphoreCount);
+        }
+
+        if (submit.commandBufferCount > 0)
+        {
+            batched_submit.command_buffers.assign(submit.pCommandBuffers,
+                                                  submit.pCommandBuffers + submit.commandBufferCount);
+        }
+
+        if (submit.signalSemaphoreCount > 0)
+        {
+            batched_submit.signal_semaphores.assign(submit.pSignalSemaphores,
+                                                    submit.pSignalSemaphores + submit.signalSemaphoreCount);
+        }
+
+        submits_.emplace_back(std::move(batched_submit));
+    }
+
+    // The fence is signaled when all of the submissions that precede it have completed, so it ends the batch.
+    if (fence != VK_NULL_HANDLE)
+    {
+        VkResult submit_result = Submit(fence);
+        if (result == VK_SUCCESS)
+        {
+            result = submit_result;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanSubmitBatcher::Submit(VkFence fence)
+{
+    VkResult result = VK_SUCCESS;
+
+    if (HasPendingSubmits())
+    {
+        std::vector<VkSubmitInfo> submit_infos(submits_.size(), VkSubmitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO });
+
+        for (size_t i = 0; i < submits_.size(); ++i)
+        {
+            const BatchedSubmit& batched_submit = submits_[i];
+            VkSubmitInfo&        submit_info    = submit_infos[i];
+
+            submit_info.waitSemaphoreCount   = static_cast<uint32_t>(batched_submit.wait_semaphores.size());
+            submit_info.pWaitSemaphores      = batched_submit.wait_semaphores.data();
+            submit_info.pWaitDstStageMask    = batched_submit.wait_dst_stage_masks.data();
+            submit_info.commandBufferCount   = static_cast<uint32_t>(batched_submit.command_buffers.size());
+            submit_info.pCommandBuffers      = batched_submit.command_buffers.data();
+            submit_info.signalSemaphoreCount = static_cast<uint32_t>(batched_submit.signal_semaphores.size());
+            submit_info.pSignalSemaphores    = batched_submit.signal_semaphores.data();
+        }
+
+        result = queue_submit_(queue_, static_cast<uint32_t>(submit_infos.size()), submit_infos.data(), fence);
+
+        if (call_count_ > 1)
+        {
+            ++batch_count_;
+            batched_call_count_ += call_count_;
+        }
+
+        submits_.clear();
+        call_count_ = 0;
+    }
+
+    return result;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_SUBMIT_BATCHER_H
+#define GFXRECON_DECODE_VULKAN_SUBMIT_BATCHER_H
+
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Merges consecutive queue submissions to the same queue into a single vkQueueSubmit call with multiple submit infos.
+// The submit infos are copied when they are added, and the batch is submitted when it is flushed, which must happen
+// before any call that could depend on the execution of the batched submissions, such as a fence wait, a submission to
+// another queue, a host read, or a present.  Submissions are executed in the same order, so that semaphores that are
+// signaled and waited on within the batch keep their captured dependencies.
+class VulkanSubmitBatcher
+{
+  public:
+    VulkanSubmitBatcher();
+
+    // Returns true if the submit infos can be copied to a batch, which requires that they have no extension structures.
+    static bool CanBatch(uint32_t submit_count, const VkSubmitInfo* submits);
+
+    // Adds the submit infos to the batch for the queue, flushing the batch for a different queue first.  A submission
+    // with a fence is the last submission of the batch, which is flushed immediately.  Returns the result of the
+    // vkQueueSubmit call that flushed the batch, or VK_SUCCESS if the submission was deferred.
+    VkResult Add(PFN_vkQueueSubmit   queue_submit,
+                 VkQueue             queue,
+                 uint32_t            submit_count,
+                 const VkSubmitInfo* submits,
+                 VkFence             fence);
+
+    // Submits the pending batch, returning VK_SUCCESS when there is no pending batch.
+    VkResult Flush() { return Submit(VK_NULL_HANDLE); }
+
+    bool HasPendingSubmits() const { return call_count_ > 0; }
+
+    // Returns the number of vkQueueSubmit calls that submitted more than one captured call.
+    uint64_t GetBatchCount() const { return batch_count_; }
+
+    // Returns the number of captured vkQueueSubmit calls that were submitted by batches.
+    uint64_t GetBatchedCallCount() const { return batched_call_count_; }
+
+  private:
+    struct BatchedSubmit
+    {
+        std::vector<VkSemaphore>          wait_semaphores;
+        std::vector<VkPipelineStageFlags> wait_dst_stage_masks;
+        std::vector<VkCommandBuffer>      command_buffers;
+        std::vector<VkSemaphore>          signal_semaphores;
+    };
+
+  private:
+    VkResult Submit(VkFence fence);
+
+  private:
+    PFN_vkQueueSubmit          queue_submit_;
+    VkQueue                    queue_;
+    std::vector<BatchedSubmit> submits_;
+    uint32_t                   call_count_; // Captured calls in the pending batch.
+    uint64_t                   batch_count_;
+    uint64_t                   batched_call_count_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_SUBMIT_BATCHER_H
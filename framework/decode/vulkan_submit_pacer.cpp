@@ -0,0 +1,280 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_submit_pacer.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanSubmitPacer::VulkanSubmitPacer(VkDevice                   device,
+                                     const encode::DeviceTable* device_table,
+                                     PFN_vkWaitSemaphores       wait_semaphores,
+                                     uint32_t                   max_submits_in_flight,
+                                     uint32_t                   max_frames_in_flight) :
+    device_(device), device_table_(device_table), wait_semaphores_(wait_semaphores),
+    max_submits_in_flight_(max_submits_in_flight), max_frames_in_flight_(max_frames_in_flight)
+{
+    assert((device_ != VK_NULL_HANDLE) && (device_table_ != nullptr) && (wait_semaphores_ != nullptr));
+}
+
+VulkanSubmitPacer::~VulkanSubmitPacer()
+{
+    // The semaphores cannot be destroyed while the submissions that signal them are pending.
+    for (auto& entry : timelines_)
+    {
+        Wait(&entry.second, entry.second.signaled_value);
+        device_table_->DestroySemaphore(device_, entry.second.semaphore, nullptr);
+    }
+
+    for (auto& entry : families_)
+    {
+        if (entry.second.command_pool != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
+        }
+    }
+}
+
+void VulkanSubmitPacer::AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, VkQueueFlags queue_flags)
+{
+    if ((queue_flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT)) == 0)
+    {
+        return;
+    }
+
+    QueueFamily& family = families_[queue_family_index];
+
+    if (family.command_pool == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        pool_create_info.pNext                   = nullptr;
+        pool_create_info.flags                   = 0;
+        pool_create_info.queueFamilyIndex        = queue_family_index;
+
+        VkResult result = device_table_->CreateCommandPool(device_, &pool_create_info, nullptr, &family.command_pool);
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.pNext                       = nullptr;
+            allocate_info.commandPool                 = family.command_pool;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = 1;
+
+            result = device_table_->AllocateCommandBuffers(device_, &allocate_info, &family.command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            // The command buffer is recorded once, and may be pending in any number of submissions.
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.pNext                    = nullptr;
+            begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+            begin_info.pInheritanceInfo         = nullptr;
+
+            result = device_table_->BeginCommandBuffer(family.command_buffer, &begin_info);
+
+            if (result == VK_SUCCESS)
+            {
+                device_table_->CmdPipelineBarrier(family.command_buffer,
+                                                  VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                                  VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                                  0,
+                                                  0,
+                                                  nullptr,
+                                                  0,
+                                                  nullptr,
+                                                  0,
+                                                  nullptr);
+
+                result = device_table_->EndCommandBuffer(family.command_buffer);
+            }
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("Failed to create the command buffer for submission pacing on queue family %u; "
+                                 "submissions to the queue family will not be paced",
+                                 queue_family_index);
+
+            if (family.command_pool != VK_NULL_HANDLE)
+            {
+                device_table_->DestroyCommandPool(device_, family.command_pool, nullptr);
+            }
+
+            family.command_pool   = VK_NULL_HANDLE;
+            family.command_buffer = VK_NULL_HANDLE;
+            return;
+        }
+    }
+
+    for (uint32_t i = 0; i < queue_count; ++i)
+    {
+        VkQueue queue = VK_NULL_HANDLE;
+        device_table_->GetDeviceQueue(device_, queue_family_index, i, &queue);
+
+        if ((queue != VK_NULL_HANDLE) && (timelines_.find(queue) == timelines_.end()))
+        {
+            VkSemaphoreTypeCreateInfo type_create_info = { VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO };
+            type_create_info.pNext                     = nullptr;
+            type_create_info.semaphoreType             = VK_SEMAPHORE_TYPE_TIMELINE;
+            type_create_info.initialValue              = 0;
+
+            VkSemaphoreCreateInfo create_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+            create_info.pNext                 = &type_create_info;
+            create_info.flags                 = 0;
+
+            QueueTimeline timeline;
+            timeline.family = &family;
+
+            if (device_table_->CreateSemaphore(device_, &create_info, nullptr, &timeline.semaphore) == VK_SUCCESS)
+            {
+                timelines_[queue] = timeline;
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Failed to create the timeline semaphore for submission pacing on queue family "
+                                     "%u; submissions to the queue will not be paced",
+                                     queue_family_index);
+            }
+        }
+    }
+}
+
+bool VulkanSubmitPacer::BeginSubmit(VkQueue queue)
+{
+    auto entry = timelines_.find(queue);
+
+    if (entry == timelines_.end())
+    {
+        return false;
+    }
+
+    QueueTimeline* timeline = &entry->second;
+
+    // The new submission is assigned the next semaphore value, so the submission with the value that is the limit
+    // below it must complete before it can be made.
+    if ((max_submits_in_flight_ > 0) && (timeline->signaled_value >= max_submits_in_flight_))
+    {
+        Wait(timeline, timeline->signaled_value + 1 - max_submits_in_flight_);
+    }
+
+    return true;
+}
+
+void VulkanSubmitPacer::EndSubmit(VkQueue queue)
+{
+    auto entry = timelines_.find(queue);
+    assert(entry != timelines_.end());
+
+    QueueTimeline* timeline     = &entry->second;
+    uint64_t       signal_value = timeline->signaled_value + 1;
+
+    VkTimelineSemaphoreSubmitInfo timeline_info = { VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO };
+    timeline_info.pNext                         = nullptr;
+    timeline_info.waitSemaphoreValueCount       = 0;
+    timeline_info.pWaitSemaphoreValues          = nullptr;
+    timeline_info.signalSemaphoreValueCount     = 1;
+    timeline_info.pSignalSemaphoreValues        = &signal_value;
+
+    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit_info.pNext                = &timeline_info;
+    submit_info.waitSemaphoreCount   = 0;
+    submit_info.pWaitSemaphores      = nullptr;
+    submit_info.pWaitDstStageMask    = nullptr;
+    submit_info.commandBufferCount   = 1;
+    submit_info.pCommandBuffers      = &timeline->family->command_buffer;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores    = &timeline->semaphore;
+
+    if (device_table_->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE) == VK_SUCCESS)
+    {
+        timeline->signaled_value = signal_value;
+    }
+}
+
+void VulkanSubmitPacer::EndFrame()
+{
+    if (max_frames_in_flight_ == 0)
+    {
+        return;
+    }
+
+    FrameMarker marker;
+
+    for (auto& entry : timelines_)
+    {
+        if (entry.second.signaled_value > entry.second.completed_value)
+        {
+            marker.emplace_back(&entry.second, entry.second.signaled_value);
+        }
+    }
+
+    pending_frames_.emplace_back(std::move(marker));
+
+    while (pending_frames_.size() >= max_frames_in_flight_)
+    {
+        for (const auto& value : pending_frames_.front())
+        {
+            Wait(value.first, value.second);
+        }
+
+        pending_frames_.pop_front();
+    }
+}
+
+void VulkanSubmitPacer::Wait(QueueTimeline* timeline, uint64_t value)
+{
+    assert(timeline != nullptr);
+
+    if (value > timeline->completed_value)
+    {
+        VkSemaphoreWaitInfo wait_info = { VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+        wait_info.pNext               = nullptr;
+        wait_info.flags               = 0;
+        wait_info.semaphoreCount      = 1;
+        wait_info.pSemaphores         = &timeline->semaphore;
+        wait_info.pValues             = &value;
+
+        VkResult result = wait_semaphores_(device_, &wait_info, std::numeric_limits<uint64_t>::max());
+
+        if (result == VK_SUCCESS)
+        {
+            timeline->completed_value = value;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Failed to wait for paced queue submissions to complete (error = %d)", result);
+
+            // Do not wait for the submissions again, which would fail for the same reason.
+            timeline->completed_value = timeline->signaled_value;
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,106 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_SUBMIT_PACER_H
+#define GFXRECON_DECODE_VULKAN_SUBMIT_PACER_H
+
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Limits the number of a device's queue submissions and frames that are in flight on the GPU.  Each queue has a
+// timeline semaphore, which is signaled by a separate submission to the queue after each paced submission.  The
+// separate submission contains a command buffer with an execution barrier, so that the semaphore is not signaled
+// until the commands of the earlier submissions have completed.
+class VulkanSubmitPacer
+{
+  public:
+    // A limit of zero disables pacing of submissions or frames.
+    VulkanSubmitPacer(VkDevice                   device,
+                      const encode::DeviceTable* device_table,
+                      PFN_vkWaitSemaphores       wait_semaphores,
+                      uint32_t                   max_submits_in_flight,
+                      uint32_t                   max_frames_in_flight);
+
+    ~VulkanSubmitPacer();
+
+    // Adds the queues that were created for a queue family.  Submissions to queue families without graphics, compute,
+    // or transfer support are not paced.
+    void AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, VkQueueFlags queue_flags);
+
+    // Waits for earlier submissions to the queue to complete until a new submission does not exceed the submission
+    // limit.  Returns true if the submission is paced, in which case EndSubmit() must be called after the submission
+    // has been made successfully.
+    bool BeginSubmit(VkQueue queue);
+
+    void EndSubmit(VkQueue queue);
+
+    // Marks the end of a frame at the last submission to each queue, and waits for earlier frames to complete until
+    // the frame limit is not exceeded.
+    void EndFrame();
+
+  private:
+    struct QueueFamily
+    {
+        VkCommandPool   command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer command_buffer{ VK_NULL_HANDLE };
+    };
+
+    struct QueueTimeline
+    {
+        QueueFamily* family{ nullptr };
+        VkSemaphore  semaphore{ VK_NULL_HANDLE };
+        uint64_t     signaled_value{ 0 };
+        uint64_t     completed_value{ 0 };
+    };
+
+    // The semaphore value signaled by the last submission to each queue before the end of a frame.
+    typedef std::vector<std::pair<QueueTimeline*, uint64_t>> FrameMarker;
+
+  private:
+    void Wait(QueueTimeline* timeline, uint64_t value);
+
+  private:
+    VkDevice                                   device_;
+    const encode::DeviceTable*                 device_table_;
+    PFN_vkWaitSemaphores                       wait_semaphores_;
+    uint32_t                                   max_submits_in_flight_;
+    uint32_t                                   max_frames_in_flight_;
+    std::unordered_map<uint32_t, QueueFamily>  families_;
+    std::unordered_map<VkQueue, QueueTimeline> timelines_;
+    std::deque<FrameMarker>                    pending_frames_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_SUBMIT_PACER_H
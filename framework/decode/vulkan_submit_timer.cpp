@@ -0,0 +1,333 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_submit_timer.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Each timed submission uses a pair of queries, with the start timestamp at the even index.
+const uint32_t kQueryCount     = 1024;
+const uint32_t kQueryPairCount = kQueryCount / 2;
+
+VulkanSubmitTimer::VulkanSubmitTimer(VkDevice device, const encode::DeviceTable* device_table, float timestamp_period) :
+    device_(device), device_table_(device_table), timestamp_period_(timestamp_period), query_pool_(VK_NULL_HANDLE),
+    next_query_(0), pending_query_count_(0), active_query_(0)
+{
+    assert((device_ != VK_NULL_HANDLE) && (device_table_ != nullptr));
+
+    VkQueryPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.queryType             = VK_QUERY_TYPE_TIMESTAMP;
+    create_info.queryCount            = kQueryCount;
+    create_info.pipelineStatistics    = 0;
+
+    VkResult result = device_table_->CreateQueryPool(device_, &create_info, nullptr, &query_pool_);
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_WARNING("Failed to create the timestamp query pool for GPU frame timing; GPU times will not be "
+                             "reported");
+        query_pool_ = VK_NULL_HANDLE;
+    }
+}
+
+VulkanSubmitTimer::~VulkanSubmitTimer()
+{
+    for (auto& entry : families_)
+    {
+        if (entry.second.command_pool != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
+        }
+    }
+
+    if (query_pool_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyQueryPool(device_, query_pool_, nullptr);
+    }
+}
+
+void VulkanSubmitTimer::AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, uint32_t timestamp_valid_bits)
+{
+    QueueFamily& family = families_[queue_family_index];
+
+    if ((timestamp_valid_bits > 0) && (family.command_pool == VK_NULL_HANDLE))
+    {
+        family.timestamp_mask =
+            (timestamp_valid_bits < 64) ? ((1ull << timestamp_valid_bits) - 1) : std::numeric_limits<uint64_t>::max();
+
+        VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        create_info.pNext                   = nullptr;
+        create_info.flags                   = 0;
+        create_info.queueFamilyIndex        = queue_family_index;
+
+        if (device_table_->CreateCommandPool(device_, &create_info, nullptr, &family.command_pool) == VK_SUCCESS)
+        {
+            family.command_buffers.resize(kQueryCount, VK_NULL_HANDLE);
+        }
+        else
+        {
+            family.command_pool = VK_NULL_HANDLE;
+        }
+    }
+
+    for (uint32_t i = 0; i < queue_count; ++i)
+    {
+        VkQueue queue = VK_NULL_HANDLE;
+        device_table_->GetDeviceQueue(device_, queue_family_index, i, &queue);
+
+        if (queue != VK_NULL_HANDLE)
+        {
+            queue_families_[queue] = &family;
+        }
+    }
+}
+
+bool VulkanSubmitTimer::BeginSubmit(VkQueue queue, uint64_t frame_number)
+{
+    PendingFrame* frame = GetPendingFrame(frame_number);
+    assert(frame != nullptr);
+
+    auto entry = queue_families_.find(queue);
+
+    if ((query_pool_ == VK_NULL_HANDLE) || (entry == queue_families_.end()) ||
+        (entry->second->command_pool == VK_NULL_HANDLE))
+    {
+        frame->available = false;
+        return false;
+    }
+
+    if (pending_query_count_ == kQueryPairCount)
+    {
+        ReadResults(false);
+
+        if (pending_query_count_ == kQueryPairCount)
+        {
+            frame->available = false;
+            return false;
+        }
+    }
+
+    if (!WriteTimestamp(queue, entry->second, next_query_))
+    {
+        frame->available = false;
+        return false;
+    }
+
+    PendingSubmit submit;
+    submit.query          = next_query_;
+    submit.timestamp_mask = entry->second->timestamp_mask;
+    frame->submits.push_back(submit);
+
+    active_query_ = next_query_;
+    next_query_   = (next_query_ + 2) % kQueryCount;
+    ++pending_query_count_;
+
+    return true;
+}
+
+void VulkanSubmitTimer::EndSubmit(VkQueue queue)
+{
+    assert(!pending_frames_.empty() && !pending_frames_.back().submits.empty());
+
+    auto entry = queue_families_.find(queue);
+    assert(entry != queue_families_.end());
+
+    if (!WriteTimestamp(queue, entry->second, active_query_ + 1))
+    {
+        // The end timestamp will never be written, so the start timestamp's query must not be waited on.
+        PendingFrame& frame = pending_frames_.back();
+        frame.submits.pop_back();
+        frame.available = false;
+        --pending_query_count_;
+    }
+}
+
+void VulkanSubmitTimer::EndFrame(uint64_t frame_number)
+{
+    PendingFrame* frame = GetPendingFrame(frame_number);
+    assert(frame != nullptr);
+
+    frame->ended = true;
+}
+
+void VulkanSubmitTimer::GetFrameTimes(bool wait, std::vector<FrameTime>* frame_times)
+{
+    assert(frame_times != nullptr);
+
+    ReadResults(wait);
+
+    frame_times->insert(frame_times->end(), completed_frames_.begin(), completed_frames_.end());
+    completed_frames_.clear();
+}
+
+VulkanSubmitTimer::PendingFrame* VulkanSubmitTimer::GetPendingFrame(uint64_t frame_number)
+{
+    if (pending_frames_.empty() || (pending_frames_.back().frame_number != frame_number))
+    {
+        assert(pending_frames_.empty() || (pending_frames_.back().frame_number < frame_number));
+
+        PendingFrame frame;
+        frame.frame_number = frame_number;
+        pending_frames_.emplace_back(std::move(frame));
+    }
+
+    return &pending_frames_.back();
+}
+
+bool VulkanSubmitTimer::WriteTimestamp(VkQueue queue, QueueFamily* family, uint32_t query)
+{
+    assert(family != nullptr);
+
+    VkResult         result         = VK_SUCCESS;
+    VkCommandBuffer& command_buffer = family->command_buffers[query];
+
+    // The command buffers are recorded once per query, and are reused after the query's previous results have been
+    // retrieved.
+    if (command_buffer == VK_NULL_HANDLE)
+    {
+        VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        allocate_info.pNext                       = nullptr;
+        allocate_info.commandPool                 = family->command_pool;
+        allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocate_info.commandBufferCount          = 1;
+
+        result = device_table_->AllocateCommandBuffers(device_, &allocate_info, &command_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.pNext                    = nullptr;
+            begin_info.flags                    = 0;
+            begin_info.pInheritanceInfo         = nullptr;
+
+            result = device_table_->BeginCommandBuffer(command_buffer, &begin_info);
+        }
+        else
+        {
+            command_buffer = VK_NULL_HANDLE;
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkPipelineStageFlagBits stage =
+                ((query % 2) == 0) ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+
+            device_table_->CmdResetQueryPool(command_buffer, query_pool_, query, 1);
+            device_table_->CmdWriteTimestamp(command_buffer, stage, query_pool_, query);
+
+            result = device_table_->EndCommandBuffer(command_buffer);
+        }
+
+        if ((result != VK_SUCCESS) && (command_buffer != VK_NULL_HANDLE))
+        {
+            device_table_->FreeCommandBuffers(device_, family->command_pool, 1, &command_buffer);
+            command_buffer = VK_NULL_HANDLE;
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = 0;
+        submit_info.pWaitSemaphores      = nullptr;
+        submit_info.pWaitDstStageMask    = nullptr;
+        submit_info.commandBufferCount   = 1;
+        submit_info.pCommandBuffers      = &command_buffer;
+        submit_info.signalSemaphoreCount = 0;
+        submit_info.pSignalSemaphores    = nullptr;
+
+        result = device_table_->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_WARNING_ONCE("Failed to submit a timestamp query for GPU frame timing; GPU times will not be "
+                                  "reported for the affected frames");
+    }
+
+    return (result == VK_SUCCESS);
+}
+
+void VulkanSubmitTimer::ReadResults(bool wait)
+{
+    VkQueryResultFlags flags = VK_QUERY_RESULT_64_BIT;
+
+    if (wait)
+    {
+        flags |= VK_QUERY_RESULT_WAIT_BIT;
+    }
+
+    while (!pending_frames_.empty())
+    {
+        PendingFrame& frame = pending_frames_.front();
+
+        while (!frame.submits.empty())
+        {
+            const PendingSubmit& submit        = frame.submits.front();
+            uint64_t             timestamps[2] = { 0, 0 };
+
+            VkResult result = device_table_->GetQueryPoolResults(
+                device_, query_pool_, submit.query, 2, sizeof(timestamps), timestamps, sizeof(timestamps[0]), flags);
+
+            if (result == VK_NOT_READY)
+            {
+                return;
+            }
+            else if (result == VK_SUCCESS)
+            {
+                frame.ticks += (timestamps[1] - timestamps[0]) & submit.timestamp_mask;
+            }
+            else
+            {
+                frame.available = false;
+            }
+
+            frame.submits.pop_front();
+            --pending_query_count_;
+        }
+
+        if (!frame.ended)
+        {
+            return;
+        }
+
+        FrameTime frame_time;
+        frame_time.frame_number     = frame.frame_number;
+        frame_time.gpu_milliseconds = (static_cast<double>(frame.ticks) * timestamp_period_) / 1000000.0;
+        frame_time.available        = frame.available;
+        completed_frames_.push_back(frame_time);
+
+        pending_frames_.pop_front();
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
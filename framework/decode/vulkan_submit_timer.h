@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_SUBMIT_TIMER_H
+#define GFXRECON_DECODE_VULKAN_SUBMIT_TIMER_H
+
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Measures the GPU time of a device's queue submissions with timestamp queries, which are written by separate
+// submissions to the same queue before and after each timed submission.  The timestamp queries are allocated from a
+// fixed size ring, and submissions that are made while all of the queries are waiting for results are not timed.
+class VulkanSubmitTimer
+{
+  public:
+    struct FrameTime
+    {
+        uint64_t frame_number{ 0 };
+        double   gpu_milliseconds{ 0.0 };
+        bool     available{ true };
+    };
+
+  public:
+    VulkanSubmitTimer(VkDevice device, const encode::DeviceTable* device_table, float timestamp_period);
+
+    ~VulkanSubmitTimer();
+
+    // Adds the queues that were created for a queue family.  Submissions to queue families without timestamp support
+    // are not timed.
+    void AddQueueFamily(uint32_t queue_family_index, uint32_t queue_count, uint32_t timestamp_valid_bits);
+
+    // Writes the start timestamp for a submission.  Returns true if the submission is timed, in which case EndSubmit()
+    // must be called after the submission has been made.
+    bool BeginSubmit(VkQueue queue, uint64_t frame_number);
+
+    void EndSubmit(VkQueue queue);
+
+    void EndFrame(uint64_t frame_number);
+
+    // Retrieves the GPU times of the ended frames with completed submissions, optionally waiting for the submissions
+    // to complete.
+    void GetFrameTimes(bool wait, std::vector<FrameTime>* frame_times);
+
+  private:
+    struct QueueFamily
+    {
+        uint64_t                     timestamp_mask{ 0 };
+        VkCommandPool                command_pool{ VK_NULL_HANDLE };
+        std::vector<VkCommandBuffer> command_buffers;
+    };
+
+    struct PendingSubmit
+    {
+        uint32_t query{ 0 };
+        uint64_t timestamp_mask{ 0 };
+    };
+
+    struct PendingFrame
+    {
+        uint64_t                  frame_number{ 0 };
+        std::deque<PendingSubmit> submits;
+        uint64_t                  ticks{ 0 };
+        bool                      available{ true };
+        bool                      ended{ false };
+    };
+
+  private:
+    PendingFrame* GetPendingFrame(uint64_t frame_number);
+
+    bool WriteTimestamp(VkQueue queue, QueueFamily* family, uint32_t query);
+
+    void ReadResults(bool wait);
+
+  private:
+    VkDevice                                  device_;
+    const encode::DeviceTable*                device_table_;
+    double                                    timestamp_period_;
+    VkQueryPool                               query_pool_;
+    uint32_t                                  next_query_;
+    uint32_t                                  pending_query_count_;
+    uint32_t                                  active_query_;
+    std::unordered_map<VkQueue, QueueFamily*> queue_families_;
+    std::unordered_map<uint32_t, QueueFamily> families_;
+    std::deque<PendingFrame>                  pending_frames_;
+    std::vector<FrameTime>                    completed_frames_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_SUBMIT_TIMER_H
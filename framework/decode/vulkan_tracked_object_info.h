@@ -302,7 +302,7 @@ class TrackedDeviceMemoryInfo
     void SetCaptureId(format::HandleId capture_id) { capture_id_ = capture_id; }
 
     // Get capture ID
-    format::HandleId GetCaptureId() { return capture_id_; }
+    format::HandleId GetCaptureId() const { return capture_id_; }
 
     // Set trace memory allocation size
     void SetTraceMemoryAllocationSize(VkDeviceSize memory_allocation_size);
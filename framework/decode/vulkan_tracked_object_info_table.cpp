@@ -25,6 +25,35 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Tracked resource information that is stored by WriteRealignLayout, excluding the replay handles and create info of
+// the resource tracking pass.
+struct RealignResourceInfo
+{
+    format::HandleId      capture_id;
+    format::HandleId      memory_id;
+    VkMemoryPropertyFlags memory_property_flags;
+    uint32_t              queue_family_index;
+    VkDeviceSize          trace_bind_offset;
+    VkDeviceSize          replay_bind_offset;
+    VkDeviceSize          trace_size;
+    VkDeviceSize          trace_alignment;
+    VkDeviceSize          replay_size;
+    VkDeviceSize          replay_alignment;
+    uint32_t              trace_memory_type_bits;
+    uint32_t              replay_memory_type_bits;
+    uint32_t              is_image;
+    uint32_t              reserved;
+};
+
+struct RealignDeviceMemoryInfo
+{
+    format::HandleId      capture_id;
+    VkMemoryPropertyFlags property_flags;
+    uint32_t              reserved;
+    VkDeviceSize          trace_allocation_size;
+    VkDeviceSize          replay_allocation_size;
+};
+
 // Add tracked instance information into the instances table map
 void VulkanTrackedObjectInfoTable::AddTrackedInstanceInfo(TrackedInstanceInfo&& info)
 {
@@ -114,5 +143,166 @@ VulkanTrackedObjectInfoTable::GetTrackedDeviceMemoriesInfoMap() const
     return &tracked_device_memory_map_;
 }
 
+void VulkanTrackedObjectInfoTable::WriteRealignLayout(AnalysisCache::Writer* writer) const
+{
+    assert(writer != nullptr);
+
+    std::vector<RealignResourceInfo> resources;
+    resources.reserve(tracked_resource_map_.size());
+
+    for (const auto& entry : tracked_resource_map_)
+    {
+        const TrackedResourceInfo& info = entry.second;
+        RealignResourceInfo        resource{};
+
+        resource.capture_id              = info.GetCaptureId();
+        resource.memory_id               = info.GetBoundMemoryId();
+        resource.memory_property_flags   = info.GetBoundMemoryPropertyFlags();
+        resource.queue_family_index      = info.GetQueueFamilyIndex();
+        resource.trace_bind_offset       = info.GetTraceBindOffset();
+        resource.replay_bind_offset      = info.GetReplayBindOffset();
+        resource.trace_size              = info.GetTraceResourceSize();
+        resource.trace_alignment         = info.GetTraceResourceAlignment();
+        resource.replay_size             = info.GetReplayResourceSize();
+        resource.replay_alignment        = info.GetReplayResourceAlignment();
+        resource.trace_memory_type_bits  = info.GetTraceResourceMemoryTypeBits();
+        resource.replay_memory_type_bits = info.GetReplayResourceMemoryTypeBits();
+        resource.is_image                = info.GetImageFlag() ? 1 : 0;
+
+        resources.push_back(resource);
+    }
+
+    writer->WriteVector(resources);
+    writer->Write(static_cast<uint64_t>(tracked_device_memory_map_.size()));
+
+    for (const auto& entry : tracked_device_memory_map_)
+    {
+        const TrackedDeviceMemoryInfo& info = entry.second;
+        RealignDeviceMemoryInfo        memory{};
+
+        memory.capture_id             = info.GetCaptureId();
+        memory.property_flags         = info.GetMemoryPropertyFlags();
+        memory.trace_allocation_size  = info.GetTraceMemoryAllocationSize();
+        memory.replay_allocation_size = info.GetReplayMemoryAllocationSize();
+
+        // The bound resources are stored in the order of the list, which was sorted by binding offset.
+        std::vector<format::HandleId> bound_resource_ids;
+        for (const auto bound_resource : *info.GetBoundResourcesList())
+        {
+            bound_resource_ids.push_back(bound_resource->GetCaptureId());
+        }
+
+        writer->Write(memory);
+        writer->WriteVector(info.GetMappedMemorySizesList());
+        writer->WriteVector(info.GetMappedMemoryOffsetsList());
+        writer->WriteVector(info.GetFilledMemorySizesList());
+        writer->WriteVector(info.GetFilledMemoryOffsetsList());
+        writer->WriteVector(bound_resource_ids);
+    }
+}
+
+bool VulkanTrackedObjectInfoTable::ReadRealignLayout(AnalysisCache::Reader* reader)
+{
+    assert(reader != nullptr);
+
+    std::vector<RealignResourceInfo> resources;
+    uint64_t                         memory_count = 0;
+
+    if (!reader->ReadVector(&resources) || !reader->Read(&memory_count))
+    {
+        return false;
+    }
+
+    std::unordered_map<format::HandleId, TrackedResourceInfo>     resource_map;
+    std::unordered_map<format::HandleId, TrackedDeviceMemoryInfo> memory_map;
+
+    for (const auto& resource : resources)
+    {
+        TrackedResourceInfo info;
+        info.SetCaptureId(resource.capture_id);
+        info.SetBoundMemoryId(resource.memory_id);
+        info.SetBoundMemoryPropertyFlags(resource.memory_property_flags);
+        info.SetQueueFamilyIndex(resource.queue_family_index);
+        info.SetTraceBindOffset(resource.trace_bind_offset);
+        info.SetReplayBindOffset(resource.replay_bind_offset);
+        info.SetTraceResourceSize(resource.trace_size);
+        info.SetTraceResourceAlignment(resource.trace_alignment);
+        info.SetReplayResourceSize(resource.replay_size);
+        info.SetReplayResourceAlignment(resource.replay_alignment);
+        info.SetTraceResourceMemoryTypeBits(resource.trace_memory_type_bits);
+        info.SetReplayResourceMemoryTypeBits(resource.replay_memory_type_bits);
+        info.SetImageFlag(resource.is_image != 0);
+
+        resource_map.emplace(resource.capture_id, std::move(info));
+    }
+
+    for (uint64_t i = 0; i < memory_count; ++i)
+    {
+        RealignDeviceMemoryInfo       memory;
+        std::vector<VkDeviceSize>     mapped_sizes;
+        std::vector<VkDeviceSize>     mapped_offsets;
+        std::vector<VkDeviceSize>     filled_sizes;
+        std::vector<VkDeviceSize>     filled_offsets;
+        std::vector<format::HandleId> bound_resource_ids;
+
+        if (!reader->Read(&memory) || !reader->ReadVector(&mapped_sizes) || !reader->ReadVector(&mapped_offsets) ||
+            !reader->ReadVector(&filled_sizes) || !reader->ReadVector(&filled_offsets) ||
+            !reader->ReadVector(&bound_resource_ids))
+        {
+            return false;
+        }
+
+        TrackedDeviceMemoryInfo info;
+        info.SetCaptureId(memory.capture_id);
+        info.SetMemoryPropertyFlags(memory.property_flags);
+        info.SetTraceMemoryAllocationSize(memory.trace_allocation_size);
+        info.AllocateReplayMemoryAllocationSize(memory.replay_allocation_size);
+
+        for (auto size : mapped_sizes)
+        {
+            info.InsertMappedMemorySizesList(size);
+        }
+
+        for (auto offset : mapped_offsets)
+        {
+            info.InsertMappedMemoryOffsetsList(offset);
+        }
+
+        for (auto size : filled_sizes)
+        {
+            info.InsertFilledMemorySizesList(size);
+        }
+
+        for (auto offset : filled_offsets)
+        {
+            info.InsertFilledMemoryOffsetsList(offset);
+        }
+
+        for (auto resource_id : bound_resource_ids)
+        {
+            auto resource_entry = resource_map.find(resource_id);
+            if (resource_entry == resource_map.end())
+            {
+                return false;
+            }
+
+            info.InsertBoundResourcesList(&resource_entry->second);
+        }
+
+        memory_map.emplace(memory.capture_id, std::move(info));
+    }
+
+    if (!reader->IsComplete())
+    {
+        return false;
+    }
+
+    // The bound resource lists point to the entries of resource_map, which remain valid when the map is moved.
+    tracked_resource_map_      = std::move(resource_map);
+    tracked_device_memory_map_ = std::move(memory_map);
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -23,6 +23,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_TRACKED_OBJECT_MAPPER_H
 #define GFXRECON_DECODE_VULKAN_TRACKED_OBJECT_MAPPER_H
 
+#include "decode/analysis_cache.h"
 #include "decode/vulkan_tracked_object_info.h"
 #include "util/defines.h"
 #include "util/logging.h"
@@ -83,6 +84,14 @@ class VulkanTrackedObjectInfoTable
     std::unordered_map<format::HandleId, TrackedDeviceMemoryInfo>*       GetTrackedDeviceMemoriesInfoMap();
     const std::unordered_map<format::HandleId, TrackedDeviceMemoryInfo>* GetTrackedDeviceMemoriesInfoMap() const;
 
+    // Store the tracked memory and resource information that the realign allocator uses, so that it can be loaded in
+    // place of repeating the resource tracking pass
+    void WriteRealignLayout(AnalysisCache::Writer* writer) const;
+
+    // Load the tracked memory and resource information stored by WriteRealignLayout, leaving the table unmodified if
+    // the data is not valid
+    bool ReadRealignLayout(AnalysisCache::Reader* reader);
+
   private:
     // Helper template function for updating tracked objects ID with the information
     // into the objects' table map
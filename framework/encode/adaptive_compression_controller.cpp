@@ -0,0 +1,193 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/adaptive_compression_controller.h"
+
+#include "format/format_util.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Weight of the most recent window when updating the average cost of a level.
+const double kCostSmoothingFactor = 0.25;
+
+AdaptiveCompressionController::AdaptiveCompressionController(uint32_t overhead_budget_percent) :
+    overhead_budget_percent_(overhead_budget_percent), level_count_(0), current_level_(0), block_count_(0),
+    window_start_(static_cast<int64_t>(util::datetime::GetTimestamp()))
+{}
+
+std::unique_ptr<AdaptiveCompressionController>
+AdaptiveCompressionController::Create(uint32_t                overhead_budget_percent,
+                                      format::CompressionType initial_compression_type)
+{
+    std::unique_ptr<AdaptiveCompressionController> controller(
+        new AdaptiveCompressionController(overhead_budget_percent));
+
+    controller->AddLevel(format::CompressionType::kNone);
+#if defined(ENABLE_LZ4_COMPRESSION)
+    controller->AddLevel(format::CompressionType::kLz4);
+#endif
+#if defined(ENABLE_ZSTD_COMPRESSION)
+    controller->AddLevel(format::CompressionType::kZstd);
+#elif defined(ENABLE_ZLIB_COMPRESSION)
+    controller->AddLevel(format::CompressionType::kZlib);
+#endif
+
+    size_t initial_level = controller->level_count_ - 1;
+    for (size_t i = 0; i < controller->level_count_; ++i)
+    {
+        if (controller->levels_[i].compression_type == initial_compression_type)
+        {
+            initial_level = i;
+            break;
+        }
+    }
+
+    controller->current_level_.store(initial_level);
+
+    if (controller->level_count_ == 1)
+    {
+        GFXRECON_LOG_WARNING("Adaptive compression was enabled, but no compression types are available");
+    }
+
+    return controller;
+}
+
+void AdaptiveCompressionController::AddLevel(format::CompressionType compression_type)
+{
+    assert(level_count_ < kMaxLevels);
+
+    Level& level           = levels_[level_count_];
+    level.compression_type = compression_type;
+
+    if (compression_type != format::CompressionType::kNone)
+    {
+        level.compressor = std::unique_ptr<util::Compressor>(format::CreateCompressor(compression_type));
+    }
+
+    if ((compression_type == format::CompressionType::kNone) || (level.compressor != nullptr))
+    {
+        ++level_count_;
+    }
+}
+
+size_t AdaptiveCompressionController::SelectLevel()
+{
+    uint64_t block = block_count_.fetch_add(1, std::memory_order_relaxed);
+
+    if ((block % kProbeInterval) == 0)
+    {
+        return static_cast<size_t>((block / kProbeInterval) % level_count_);
+    }
+
+    return current_level_.load(std::memory_order_relaxed);
+}
+
+void AdaptiveCompressionController::RecordBlock(size_t  level,
+                                                size_t  uncompressed_size,
+                                                int64_t start_time,
+                                                int64_t end_time)
+{
+    assert(level < level_count_);
+
+    levels_[level].window_bytes.fetch_add(uncompressed_size, std::memory_order_relaxed);
+    levels_[level].window_time.fetch_add(static_cast<uint64_t>(end_time - start_time), std::memory_order_relaxed);
+
+    if ((end_time - window_start_.load(std::memory_order_relaxed)) >= kWindowTime)
+    {
+        // Only one thread needs to update the selection; other threads continue with the current level.
+        std::unique_lock<std::mutex> lock(update_mutex_, std::try_to_lock);
+        if (lock.owns_lock() && ((end_time - window_start_.load(std::memory_order_relaxed)) >= kWindowTime))
+        {
+            UpdateLevel(end_time);
+        }
+    }
+}
+
+void AdaptiveCompressionController::UpdateLevel(int64_t current_time)
+{
+    int64_t  window_time  = current_time - window_start_.load(std::memory_order_relaxed);
+    uint64_t window_bytes = 0;
+
+    for (size_t i = 0; i < level_count_; ++i)
+    {
+        Level&   level = levels_[i];
+        uint64_t bytes = level.window_bytes.exchange(0, std::memory_order_relaxed);
+        uint64_t time  = level.window_time.exchange(0, std::memory_order_relaxed);
+
+        if (bytes > 0)
+        {
+            double cost = static_cast<double>(time) / static_cast<double>(bytes);
+            level.cost  = (level.cost == 0.0) ? cost : (level.cost + kCostSmoothingFactor * (cost - level.cost));
+        }
+
+        window_bytes += bytes;
+    }
+
+    if (window_bytes > 0)
+    {
+        double budget        = static_cast<double>(window_time) * overhead_budget_percent_ / 100.0;
+        size_t current       = current_level_.load(std::memory_order_relaxed);
+        size_t selected      = current;
+        double lowest_cost   = 0.0;
+        bool   within_budget = false;
+
+        for (size_t i = 0; i < level_count_; ++i)
+        {
+            double cost = levels_[i].cost;
+
+            if (cost > 0.0)
+            {
+                if ((cost * window_bytes) <= budget)
+                {
+                    selected      = i;
+                    within_budget = true;
+                    break;
+                }
+                else if ((lowest_cost == 0.0) || (cost < lowest_cost))
+                {
+                    selected    = i;
+                    lowest_cost = cost;
+                }
+            }
+        }
+
+        if (selected != current)
+        {
+            GFXRECON_LOG_DEBUG("Adaptive compression switching from compression type %u to %u (%s budget)",
+                               levels_[current].compression_type,
+                               levels_[selected].compression_type,
+                               within_budget ? "within" : "exceeds");
+
+            current_level_.store(selected, std::memory_order_relaxed);
+        }
+    }
+
+    window_start_.store(current_time, std::memory_order_relaxed);
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
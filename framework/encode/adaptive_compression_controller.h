@@ -0,0 +1,105 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_ADAPTIVE_COMPRESSION_CONTROLLER_H
+#define GFXRECON_ENCODE_ADAPTIVE_COMPRESSION_CONTROLLER_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Selects the compression type for each block written to the capture file, to keep the time that application threads
+// spend compressing and writing blocks within a budget, specified as a percentage of elapsed time.
+//
+// Compression levels are ordered from least to most CPU intensive: no compression, LZ4, and Zstandard (or zlib when
+// Zstandard support is not available).  The controller tracks the average cost, in compression and write time per
+// uncompressed byte, of each level and periodically selects the least CPU intensive level that is expected to stay
+// within the budget for the current output rate.  When no level is within the budget, the level with the lowest cost is
+// selected.  With fast storage, the cost of writing uncompressed data is low and compression is disabled; with slow
+// storage, the time saved by writing less data favors stronger compression.  A small fraction of blocks are written
+// with each of the other levels to keep their cost estimates current.
+//
+// Functions may be called concurrently from multiple threads.
+class AdaptiveCompressionController
+{
+  public:
+    // Select the compression level for the next block, returning an index to be passed to the other functions.
+    size_t SelectLevel();
+
+    // Returns nullptr when the level does not apply compression.
+    util::Compressor* GetCompressor(size_t level) const { return levels_[level].compressor.get(); }
+
+    // The compression type to tag compressed blocks with.
+    format::CompressionType GetCompressionType(size_t level) const { return levels_[level].compression_type; }
+
+    // Record the time spent by an application thread compressing and writing a block.  Timestamps are in nanoseconds.
+    void RecordBlock(size_t level, size_t uncompressed_size, int64_t start_time, int64_t end_time);
+
+    // The initial level is the level for the specified compression type, or the highest level when the compression
+    // type is not available.
+    static std::unique_ptr<AdaptiveCompressionController> Create(uint32_t                overhead_budget_percent,
+                                                                 format::CompressionType initial_compression_type);
+
+  private:
+    static const size_t   kMaxLevels     = 3;
+    static const uint64_t kProbeInterval = 64;        // One of every kProbeInterval blocks is used to probe a level.
+    static const int64_t  kWindowTime    = 100000000; // Level selection is updated every 100 milliseconds.
+
+    struct Level
+    {
+        format::CompressionType           compression_type{ format::CompressionType::kNone };
+        std::unique_ptr<util::Compressor> compressor;
+        std::atomic<uint64_t>             window_bytes{ 0 };
+        std::atomic<uint64_t>             window_time{ 0 };
+        double                            cost{ 0.0 }; // Average nanoseconds per uncompressed byte, or 0 if unknown.
+    };
+
+  private:
+    AdaptiveCompressionController(uint32_t overhead_budget_percent);
+
+    void AddLevel(format::CompressionType compression_type);
+
+    void UpdateLevel(int64_t current_time);
+
+  private:
+    uint32_t              overhead_budget_percent_;
+    Level                 levels_[kMaxLevels];
+    size_t                level_count_;
+    std::atomic<size_t>   current_level_;
+    std::atomic<uint64_t> block_count_;
+    std::atomic<int64_t>  window_start_;
+    std::mutex            update_mutex_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_ADAPTIVE_COMPRESSION_CONTROLLER_H
@@ -0,0 +1,159 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/api_call_statistics.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+const char kJsonExtension[] = ".json";
+
+std::atomic<uint64_t> ApiCallStatistics::next_session_id_{ 1 };
+
+ApiCallStatistics::ApiCallStatistics() : session_id_(next_session_id_.fetch_add(1)) {}
+
+ApiCallStatistics::~ApiCallStatistics() {}
+
+std::shared_ptr<ApiCallStatistics::ThreadStatistics> ApiCallStatistics::RegisterThread()
+{
+    auto thread_statistics = std::make_shared<ThreadStatistics>(session_id_);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    threads_.push_back(thread_statistics);
+
+    return thread_statistics;
+}
+
+void ApiCallStatistics::GetEntries(std::vector<Entry>* entries) const
+{
+    CounterMap combined;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (const auto& thread_statistics : threads_)
+        {
+            for (const auto& entry : thread_statistics->GetCounters())
+            {
+                Counters& counters = combined[entry.first];
+                counters.call_count += entry.second.call_count;
+                counters.encode_bytes += entry.second.encode_bytes;
+                counters.encode_time += entry.second.encode_time;
+                counters.write_time += entry.second.write_time;
+            }
+        }
+    }
+
+    for (const auto& entry : combined)
+    {
+        entries->push_back({ entry.first, entry.second });
+    }
+
+    std::sort(entries->begin(), entries->end(), [](const Entry& lhs, const Entry& rhs) {
+        return (lhs.counters.encode_time + lhs.counters.write_time) >
+               (rhs.counters.encode_time + rhs.counters.write_time);
+    });
+}
+
+bool ApiCallStatistics::WriteReport(const std::string& filename) const
+{
+    std::vector<Entry> entries;
+    GetEntries(&entries);
+
+    bool  json   = false;
+    FILE* file   = nullptr;
+    int   result = util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open API call statistics file %s (error %d)", filename.c_str(), result);
+        return false;
+    }
+
+    size_t extension_size = sizeof(kJsonExtension) - 1;
+    if ((filename.size() >= extension_size) &&
+        (util::platform::StringCompareNoCase(filename.c_str() + filename.size() - extension_size, kJsonExtension) == 0))
+    {
+        json = true;
+    }
+
+    if (json)
+    {
+        fprintf(file, "{\n  \"api_calls\": [");
+
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            const Entry& entry = entries[i];
+            fprintf(file,
+                    "%s\n    { \"api_call_id\": \"0x%08x\", \"call_count\": %" PRIu64 ", \"encode_bytes\": %" PRIu64
+                    ", \"encode_time_ns\": %" PRIu64 ", \"write_time_ns\": %" PRIu64 " }",
+                    (i == 0) ? "" : ",",
+                    entry.call_id,
+                    entry.counters.call_count,
+                    entry.counters.encode_bytes,
+                    entry.counters.encode_time,
+                    entry.counters.write_time);
+        }
+
+        fprintf(file, "\n  ]\n}\n");
+    }
+    else
+    {
+        fprintf(file, "api_call_id,call_count,encode_bytes,encode_time_ns,write_time_ns\n");
+
+        for (const Entry& entry : entries)
+        {
+            fprintf(file,
+                    "0x%08x,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+                    entry.call_id,
+                    entry.counters.call_count,
+                    entry.counters.encode_bytes,
+                    entry.counters.encode_time,
+                    entry.counters.write_time);
+        }
+    }
+
+    bool success = !ferror(file);
+
+    util::platform::FileClose(file);
+
+    if (success)
+    {
+        GFXRECON_LOG_INFO("Wrote API call statistics to %s", filename.c_str());
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to write API call statistics to %s", filename.c_str());
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,118 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_API_CALL_STATISTICS_H
+#define GFXRECON_ENCODE_API_CALL_STATISTICS_H
+
+#include "format/api_call_id.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Per-ApiCallId capture overhead counters, written as a CSV or JSON report.
+//
+// Each thread records to its own ThreadStatistics object, which is only accessed by the owning thread until the report
+// is written, so the counters are updated without atomics or locks.  ThreadStatistics objects are shared with the
+// ApiCallStatistics object, so that the counters for threads that have exited are included in the report.
+class ApiCallStatistics
+{
+  public:
+    struct Counters
+    {
+        uint64_t call_count{ 0 };
+        uint64_t encode_bytes{ 0 }; // Uncompressed parameter data size.
+        uint64_t encode_time{ 0 };  // Nanoseconds between the start of the API call trace and the call to write it.
+        uint64_t write_time{ 0 };   // Nanoseconds spent compressing and writing the parameter data.
+    };
+
+    typedef std::unordered_map<uint32_t, Counters> CounterMap;
+
+    class ThreadStatistics
+    {
+      public:
+        ThreadStatistics(uint64_t session_id) : session_id_(session_id) {}
+
+        // Identifies the ApiCallStatistics object that the counters are reported by.
+        uint64_t GetSessionId() const { return session_id_; }
+
+        void Record(format::ApiCallId call_id, size_t encode_bytes, int64_t encode_time, int64_t write_time)
+        {
+            Counters& counters = counters_[call_id];
+            ++counters.call_count;
+            counters.encode_bytes += encode_bytes;
+            counters.encode_time += static_cast<uint64_t>(encode_time);
+            counters.write_time += static_cast<uint64_t>(write_time);
+        }
+
+        const CounterMap& GetCounters() const { return counters_; }
+
+      private:
+        const uint64_t session_id_;
+        CounterMap     counters_;
+    };
+
+  public:
+    ApiCallStatistics();
+
+    ~ApiCallStatistics();
+
+    uint64_t GetSessionId() const { return session_id_; }
+
+    // Create the counters for the calling thread.
+    std::shared_ptr<ThreadStatistics> RegisterThread();
+
+    // Write the combined counters for all threads, sorted by total time.  The report is written in JSON format when the
+    // filename has a .json extension, and in CSV format otherwise.  Threads must not record while the report is
+    // written.
+    bool WriteReport(const std::string& filename) const;
+
+  private:
+    struct Entry
+    {
+        uint32_t call_id;
+        Counters counters;
+    };
+
+  private:
+    void GetEntries(std::vector<Entry>* entries) const;
+
+  private:
+    static std::atomic<uint64_t> next_session_id_;
+
+    const uint64_t                                 session_id_;
+    mutable std::mutex                             mutex_;
+    std::vector<std::shared_ptr<ThreadStatistics>> threads_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_API_CALL_STATISTICS_H
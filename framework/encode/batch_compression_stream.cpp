@@ -0,0 +1,136 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/batch_compression_stream.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+BatchCompressionStream::BatchCompressionStream(std::unique_ptr<util::OutputStream> target,
+                                               format::CompressionType             compression_type,
+                                               const format::CompressorOptions&    compressor_options,
+                                               size_t                              batch_size,
+                                               bool                                compact_headers,
+                                               CaptureTelemetry*                   telemetry) :
+    target_(std::move(target)),
+    compressor_(CaptureTelemetry::WrapCompressor(
+        std::unique_ptr<util::Compressor>(format::CreateCompressor(compression_type, compressor_options)), telemetry)),
+    batch_size_(batch_size), compact_headers_(compact_headers)
+{
+    assert(target_ != nullptr);
+
+    batch_.reserve(batch_size_);
+}
+
+BatchCompressionStream::~BatchCompressionStream()
+{
+    Flush();
+}
+
+size_t BatchCompressionStream::Write(const void* data, size_t len)
+{
+    util::OutputBuffer buffer = { data, len };
+    return WriteBuffers(&buffer, 1);
+}
+
+size_t BatchCompressionStream::WriteBuffers(const util::OutputBuffer* buffers, size_t count)
+{
+    size_t written = 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t* data = static_cast<const uint8_t*>(buffers[i].data);
+        batch_.insert(batch_.end(), data, data + buffers[i].size);
+        written += buffers[i].size;
+    }
+
+    if (batch_.size() >= batch_size_)
+    {
+        WriteBatch();
+    }
+
+    return written;
+}
+
+void BatchCompressionStream::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    WriteBatch();
+    target_->Flush();
+}
+
+void BatchCompressionStream::FlushBatch()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    WriteBatch();
+}
+
+void BatchCompressionStream::WriteBatch()
+{
+    if (!batch_.empty())
+    {
+        size_t                      header_size     = sizeof(format::CompressedBatchBlockHeader);
+        size_t                      compressed_size = 0;
+        const std::vector<uint8_t>* batch_data      = &batch_;
+        format::BlockType           batch_type      = format::BlockType::kCompressedBatchBlock;
+
+        if (compact_headers_ && format::EncodeCompactRecords(batch_.data(), batch_.size(), &compact_batch_))
+        {
+            batch_data = &compact_batch_;
+            batch_type = format::BlockType::kCompressedCompactBatchBlock;
+        }
+
+        if (compressor_ != nullptr)
+        {
+            compressed_size =
+                compressor_->Compress(batch_data->size(), batch_data->data(), &compressed_batch_, header_size);
+        }
+
+        if ((compressed_size > 0) && (compressed_size < batch_.size()))
+        {
+            auto batch_header = reinterpret_cast<format::CompressedBatchBlockHeader*>(compressed_batch_.data());
+            batch_header->block_header.type = batch_type;
+            batch_header->block_header.size = sizeof(batch_header->uncompressed_size) + compressed_size;
+            batch_header->uncompressed_size = batch_data->size();
+
+            target_->Write(compressed_batch_.data(), header_size + compressed_size);
+        }
+        else
+        {
+            // The batch contains complete blocks, which can be written to the file as they are when compression does
+            // not reduce their size.
+            target_->Write(batch_.data(), batch_.size());
+        }
+
+        batch_.clear();
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
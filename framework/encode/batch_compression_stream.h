@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_BATCH_COMPRESSION_STREAM_H
+#define GFXRECON_ENCODE_BATCH_COMPRESSION_STREAM_H
+
+#include "encode/capture_telemetry.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Output stream that packs consecutive uncompressed blocks into a single kCompressedBatchBlock.  Compressing many small
+// blocks together achieves a better compression ratio than compressing each block individually and requires far fewer
+// calls to the compressor.  A batch is written to the target stream when the size of the pending data reaches the
+// batch size, or when FlushBatch() or Flush() is called.  Data written to the stream must consist of complete blocks.
+// When compact headers are enabled, batches are written as kCompressedCompactBatchBlock blocks, which replace the
+// headers of Vulkan function call blocks with compact record headers before compression.
+class BatchCompressionStream : public util::OutputStream
+{
+  public:
+    static const size_t kDefaultBatchSize = 1024 * 1024;
+
+  public:
+    // When telemetry is not null, the sizes of the compressed batches are added to its compression counters.
+    BatchCompressionStream(std::unique_ptr<util::OutputStream> target,
+                           format::CompressionType             compression_type,
+                           const format::CompressorOptions&    compressor_options,
+                           size_t                              batch_size      = kDefaultBatchSize,
+                           bool                                compact_headers = false,
+                           CaptureTelemetry*                   telemetry       = nullptr);
+
+    // Writes the pending batch to the target stream.
+    virtual ~BatchCompressionStream() override;
+
+    virtual bool IsValid() override { return (compressor_ != nullptr) && (target_ != nullptr) && target_->IsValid(); }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual size_t WriteBuffers(const util::OutputBuffer* buffers, size_t count) override;
+
+    // Writes the pending batch to the target stream and flushes the target stream.
+    virtual void Flush() override;
+
+    // Writes the pending batch to the target stream without flushing the target stream.
+    void FlushBatch();
+
+  private:
+    void WriteBatch();
+
+  private:
+    std::unique_ptr<util::OutputStream> target_;
+    std::unique_ptr<util::Compressor>   compressor_;
+    size_t                              batch_size_;
+    bool                                compact_headers_;
+    std::vector<uint8_t>                batch_;
+    std::vector<uint8_t>                compact_batch_;
+    std::vector<uint8_t>                compressed_batch_;
+    std::mutex                          mutex_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_BATCH_COMPRESSION_STREAM_H
@@ -0,0 +1,110 @@
+/*
+** Copyright (c) 2026 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/blob_deduplicator.h"
+
+#include "util/hash.h"
+
+#include <cassert>
+#include <utility>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+BlobDeduplicator::BlobDeduplicator(WriteBlobFunction write_blob, bool retain_data) :
+    write_blob_(std::move(write_blob)), retain_data_(retain_data)
+{
+    assert(write_blob_);
+}
+
+BlobDeduplicator::~BlobDeduplicator() {}
+
+bool BlobDeduplicator::ProcessBlob(const void* data, size_t size, uint64_t* blob_id)
+{
+    assert(blob_id != nullptr);
+
+    if ((data == nullptr) || (size < kMinDataSize))
+    {
+        return false;
+    }
+
+    uint64_t hash = util::hash::ContentHash64(data, size);
+
+    // The lock is held until the blob has been written, so that other threads do not reference the blob before it is
+    // in the file.
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto entry = entries_.find(hash);
+    if (entry == entries_.end())
+    {
+        entry              = entries_.emplace(hash, Entry()).first;
+        entry->second.size = size;
+
+        if (retain_data_)
+        {
+            auto bytes = static_cast<const uint8_t*>(data);
+            entry->second.data.assign(bytes, bytes + size);
+        }
+    }
+    else if (entry->second.size != size)
+    {
+        // Hash collision with a blob of a different size; the first blob keeps the ID.
+        return false;
+    }
+
+    if (!entry->second.written)
+    {
+        write_blob_(hash, data, size);
+        entry->second.written = true;
+    }
+
+    (*blob_id) = hash;
+
+    return true;
+}
+
+void BlobDeduplicator::WriteRetainedBlobs(const WriteBlobFunction& write_blob)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& entry : entries_)
+    {
+        if (!entry.second.data.empty())
+        {
+            write_blob(entry.first, entry.second.data.data(), entry.second.data.size());
+            entry.second.written = true;
+        }
+    }
+}
+
+void BlobDeduplicator::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& entry : entries_)
+    {
+        entry.second.written = false;
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,86 @@
+/*
+** Copyright (c) 2026 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_BLOB_DEDUPLICATOR_H
+#define GFXRECON_ENCODE_BLOB_DEDUPLICATOR_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Identifies API call data, such as shader code and pipeline cache data, that has already been written to the capture
+// file.  Each unique blob of data is written once, with a kSetBlobDataCommand block identified by the content hash of
+// the data, and the API calls that pass the same data encode the blob ID in place of the data.
+//
+// The data of each blob can be retained, so that the blobs can be written again at the start of the state snapshot for
+// a new capture file, where they are referenced by the create calls that the state tracker stored the parameters for.
+class BlobDeduplicator
+{
+  public:
+    typedef std::function<void(uint64_t blob_id, const void* data, size_t size)> WriteBlobFunction;
+
+    // Blobs smaller than this are encoded with the API call, because a reference would not save enough space.
+    static const size_t kMinDataSize = 1024;
+
+  public:
+    BlobDeduplicator(WriteBlobFunction write_blob, bool retain_data);
+
+    ~BlobDeduplicator();
+
+    // Returns true and sets blob_id to the ID of the blob with the content of data, first writing the blob with the
+    // write function when it has not been written to the current capture file.  Returns false when the data must be
+    // encoded with the API call.
+    bool ProcessBlob(const void* data, size_t size, uint64_t* blob_id);
+
+    // Writes all retained blobs with the specified function, and records them as written to the current capture file.
+    void WriteRetainedBlobs(const WriteBlobFunction& write_blob);
+
+    // Records that no blobs have been written when starting a new capture file.
+    void Reset();
+
+  private:
+    struct Entry
+    {
+        size_t               size{ 0 };
+        bool                 written{ false };
+        std::vector<uint8_t> data; // Empty when the data is not retained.
+    };
+
+  private:
+    WriteBlobFunction                   write_blob_;
+    bool                                retain_data_;
+    std::unordered_map<uint64_t, Entry> entries_;
+    std::mutex                          mutex_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_BLOB_DEDUPLICATOR_H
@@ -0,0 +1,187 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/block_alignment_stream.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+BlockAlignmentStream::BlockAlignmentStream(std::unique_ptr<util::OutputStream> target,
+                                           uint64_t                            file_offset,
+                                           uint32_t                            alignment) :
+    target_(std::move(target)),
+    file_offset_(file_offset), block_remaining_(0), alignment_(alignment),
+    large_alignment_(std::max(alignment, format::kLargePayloadAlignment))
+{
+    assert(target_ != nullptr);
+    assert((alignment_ > 0) && ((alignment_ & (alignment_ - 1)) == 0));
+
+    // Padding blocks are at least the size of a block header, so the padding data is less than one alignment unit.
+    zeros_.resize(large_alignment_, 0);
+}
+
+BlockAlignmentStream::~BlockAlignmentStream() {}
+
+size_t BlockAlignmentStream::Write(const void* data, size_t len)
+{
+    util::OutputBuffer buffer = { data, len };
+    return WriteBuffers(&buffer, 1);
+}
+
+size_t BlockAlignmentStream::WriteBuffers(const util::OutputBuffer* buffers, size_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    output_buffers_.clear();
+    padding_headers_.clear();
+
+    uint64_t offset       = file_offset_;
+    size_t   padding_size = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(buffers[i].data);
+        size_t         size = buffers[i].size;
+
+        // A buffer may contain the end of one block and the start of the next.
+        while (size > 0)
+        {
+            if (block_remaining_ == 0)
+            {
+                if (size < sizeof(format::BlockHeader))
+                {
+                    GFXRECON_LOG_ERROR("Block header was split across writes; the block payload cannot be aligned");
+                    output_buffers_.push_back({ data, size });
+                    offset += size;
+                    break;
+                }
+
+                uint64_t padding = GetPaddingSize(offset, data, size);
+                if (padding > 0)
+                {
+                    padding_headers_.emplace_back();
+                    format::BlockHeader& padding_header = padding_headers_.back();
+                    padding_header.type                 = format::BlockType::kPaddingBlock;
+                    padding_header.size                 = padding - sizeof(format::BlockHeader);
+
+                    output_buffers_.push_back({ &padding_header, sizeof(padding_header) });
+                    output_buffers_.push_back({ zeros_.data(), static_cast<size_t>(padding_header.size) });
+                    offset += padding;
+                    padding_size += static_cast<size_t>(padding);
+                }
+
+                format::BlockHeader block_header;
+                std::memcpy(&block_header, data, sizeof(block_header));
+                block_remaining_ = sizeof(block_header) + block_header.size;
+            }
+
+            size_t block_size = static_cast<size_t>(std::min(static_cast<uint64_t>(size), block_remaining_));
+            output_buffers_.push_back({ data, block_size });
+            block_remaining_ -= block_size;
+            offset += block_size;
+            data += block_size;
+            size -= block_size;
+        }
+    }
+
+    size_t written = target_->WriteBuffers(output_buffers_.data(), output_buffers_.size());
+    file_offset_   = offset;
+
+    return (written > padding_size) ? (written - padding_size) : 0;
+}
+
+void BlockAlignmentStream::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    target_->Flush();
+}
+
+uint64_t BlockAlignmentStream::GetPaddingSize(uint64_t offset, const uint8_t* data, size_t size) const
+{
+    format::BlockHeader block_header;
+    std::memcpy(&block_header, data, sizeof(block_header));
+
+    uint64_t header_size   = sizeof(format::BlockHeader);
+    bool     large_payload = false;
+
+    if (block_header.type == format::BlockType::kFunctionCallBlock)
+    {
+        header_size = sizeof(format::FunctionCallHeader);
+    }
+    else if ((block_header.type == format::BlockType::kMetaDataBlock) && (size >= sizeof(format::MetaDataHeader)))
+    {
+        format::MetaDataType meta_data_type;
+        std::memcpy(&meta_data_type, data + offsetof(format::MetaDataHeader, meta_data_type), sizeof(meta_data_type));
+
+        header_size = sizeof(format::MetaDataHeader);
+
+        if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+        {
+            header_size   = sizeof(format::FillMemoryCommandHeader);
+            large_payload = true;
+        }
+        else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
+        {
+            header_size   = sizeof(format::InitBufferCommandHeader);
+            large_payload = true;
+        }
+        else if ((meta_data_type == format::MetaDataType::kInitImageCommand) &&
+                 (size >= sizeof(format::InitImageCommandHeader)))
+        {
+            // The image data follows the header and the array of 64-bit mip level sizes.
+            uint32_t level_count        = 0;
+            size_t   level_count_offset = offsetof(format::InitImageCommandHeader, level_count);
+            std::memcpy(&level_count, data + level_count_offset, sizeof(level_count));
+
+            header_size   = sizeof(format::InitImageCommandHeader) + (level_count * sizeof(uint64_t));
+            large_payload = true;
+        }
+    }
+
+    uint32_t alignment  = alignment_;
+    uint64_t block_size = sizeof(format::BlockHeader) + block_header.size;
+    if (large_payload && (block_size >= (header_size + format::kLargePayloadSize)))
+    {
+        alignment = large_alignment_;
+    }
+
+    uint64_t payload_offset = offset + header_size;
+    uint64_t padding        = (alignment - (payload_offset % alignment)) % alignment;
+
+    // Padding blocks can not be smaller than a block header.
+    while ((padding > 0) && (padding < sizeof(format::BlockHeader)))
+    {
+        padding += alignment;
+    }
+
+    return padding;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
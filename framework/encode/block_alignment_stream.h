@@ -0,0 +1,80 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_BLOCK_ALIGNMENT_STREAM_H
+#define GFXRECON_ENCODE_BLOCK_ALIGNMENT_STREAM_H
+
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Output stream that writes a kPaddingBlock ahead of each block whose payload would not be aligned in the file.  The
+// payload follows the fixed size block and command headers, and is aligned to the stream alignment, or to
+// format::kLargePayloadAlignment for fill memory and resource initialization commands with at least
+// format::kLargePayloadSize bytes of data.  Blocks may be written with multiple writes, but block headers must not be
+// split across writes.  Data written to the stream must be uncompressed.
+class BlockAlignmentStream : public util::OutputStream
+{
+  public:
+    // The file offset is the offset at which the target stream writes the first block.
+    BlockAlignmentStream(std::unique_ptr<util::OutputStream> target, uint64_t file_offset, uint32_t alignment);
+
+    virtual ~BlockAlignmentStream() override;
+
+    virtual bool IsValid() override { return (target_ != nullptr) && target_->IsValid(); }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual size_t WriteBuffers(const util::OutputBuffer* buffers, size_t count) override;
+
+    virtual void Flush() override;
+
+  private:
+    // Returns the size of the padding block to write at the file offset, ahead of the block that starts with the header
+    // data.
+    uint64_t GetPaddingSize(uint64_t offset, const uint8_t* data, size_t size) const;
+
+  private:
+    std::unique_ptr<util::OutputStream> target_;
+    uint64_t                            file_offset_;
+    uint64_t                            block_remaining_; // Bytes of the current block that are still to be written.
+    uint32_t                            alignment_;
+    uint32_t                            large_alignment_;
+    std::vector<uint8_t>                zeros_;
+    std::vector<util::OutputBuffer>     output_buffers_;
+    std::deque<format::BlockHeader>     padding_headers_;
+    std::mutex                          mutex_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_BLOCK_ALIGNMENT_STREAM_H
@@ -40,54 +40,132 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 // Available settings (upper and lower-case)
 // clang-format off
-#define CAPTURE_COMPRESSION_TYPE_LOWER      "capture_compression_type"
-#define CAPTURE_COMPRESSION_TYPE_UPPER      "CAPTURE_COMPRESSION_TYPE"
-#define CAPTURE_FILE_NAME_LOWER             "capture_file"
-#define CAPTURE_FILE_NAME_UPPER             "CAPTURE_FILE"
-#define CAPTURE_FILE_USE_TIMESTAMP_LOWER    "capture_file_timestamp"
-#define CAPTURE_FILE_USE_TIMESTAMP_UPPER    "CAPTURE_FILE_TIMESTAMP"
-#define CAPTURE_FILE_FLUSH_LOWER            "capture_file_flush"
-#define CAPTURE_FILE_FLUSH_UPPER            "CAPTURE_FILE_FLUSH"
-#define LOG_ALLOW_INDENTS_LOWER             "log_allow_indents"
-#define LOG_ALLOW_INDENTS_UPPER             "LOG_ALLOW_INDENTS"
-#define LOG_BREAK_ON_ERROR_LOWER            "log_break_on_error"
-#define LOG_BREAK_ON_ERROR_UPPER            "LOG_BREAK_ON_ERROR"
-#define LOG_ERRORS_TO_STDERR_LOWER          "log_errors_to_stderr"
-#define LOG_ERRORS_TO_STDERR_UPPER          "LOG_ERRORS_TO_STDERR"
-#define LOG_DETAILED_LOWER                  "log_detailed"
-#define LOG_DETAILED_UPPER                  "LOG_DETAILED"
-#define LOG_FILE_NAME_LOWER                 "log_file"
-#define LOG_FILE_NAME_UPPER                 "LOG_FILE"
-#define LOG_FILE_CREATE_NEW_LOWER           "log_file_create_new"
-#define LOG_FILE_CREATE_NEW_UPPER           "LOG_FILE_CREATE_NEW"
-#define LOG_FILE_FLUSH_AFTER_WRITE_LOWER    "log_file_flush_after_write"
-#define LOG_FILE_FLUSH_AFTER_WRITE_UPPER    "LOG_FILE_FLUSH_AFTER_WRITE"
-#define LOG_FILE_KEEP_OPEN_LOWER            "log_file_keep_open"
-#define LOG_FILE_KEEP_OPEN_UPPER            "LOG_FILE_KEEP_OPEN"
-#define LOG_LEVEL_LOWER                     "log_level"
-#define LOG_LEVEL_UPPER                     "LOG_LEVEL"
-#define LOG_OUTPUT_TO_CONSOLE_LOWER         "log_output_to_console"
-#define LOG_OUTPUT_TO_CONSOLE_UPPER         "LOG_OUTPUT_TO_CONSOLE"
-#define LOG_OUTPUT_TO_OS_DEBUG_STRING_LOWER "log_output_to_os_debug_string"
-#define LOG_OUTPUT_TO_OS_DEBUG_STRING_UPPER "LOG_OUTPUT_TO_OS_DEBUG_STRING"
-#define MEMORY_TRACKING_MODE_LOWER          "memory_tracking_mode"
-#define MEMORY_TRACKING_MODE_UPPER          "MEMORY_TRACKING_MODE"
-#define CAPTURE_FRAMES_LOWER                "capture_frames"
-#define CAPTURE_FRAMES_UPPER                "CAPTURE_FRAMES"
-#define CAPTURE_TRIGGER_LOWER               "capture_trigger"
-#define CAPTURE_TRIGGER_UPPER               "CAPTURE_TRIGGER"
-#define PAGE_GUARD_COPY_ON_MAP_LOWER        "page_guard_copy_on_map"
-#define PAGE_GUARD_COPY_ON_MAP_UPPER        "PAGE_GUARD_COPY_ON_MAP"
-#define PAGE_GUARD_SEPARATE_READ_LOWER      "page_guard_separate_read"
-#define PAGE_GUARD_SEPARATE_READ_UPPER      "PAGE_GUARD_SEPARATE_READ"
-#define PAGE_GUARD_PERSISTENT_MEMORY_LOWER  "page_guard_persistent_memory"
-#define PAGE_GUARD_PERSISTENT_MEMORY_UPPER  "PAGE_GUARD_PERSISTENT_MEMORY"
-#define PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER "page_guard_align_buffer_sizes"
-#define PAGE_GUARD_ALIGN_BUFFER_SIZES_UPPER "PAGE_GUARD_ALIGN_BUFFER_SIZES"
-#define PAGE_GUARD_TRACK_AHB_MEMORY_LOWER   "page_guard_track_ahb_memory"
-#define PAGE_GUARD_TRACK_AHB_MEMORY_UPPER   "PAGE_GUARD_TRACK_AHB_MEMORY"
-#define PAGE_GUARD_EXTERNAL_MEMORY_LOWER    "page_guard_external_memory"
-#define PAGE_GUARD_EXTERNAL_MEMORY_UPPER    "PAGE_GUARD_EXTERNAL_MEMORY"
+#define CAPTURE_COMPRESSION_TYPE_LOWER       "capture_compression_type"
+#define CAPTURE_COMPRESSION_TYPE_UPPER       "CAPTURE_COMPRESSION_TYPE"
+#define CAPTURE_FILE_NAME_LOWER              "capture_file"
+#define CAPTURE_FILE_NAME_UPPER              "CAPTURE_FILE"
+#define CAPTURE_FILE_USE_TIMESTAMP_LOWER     "capture_file_timestamp"
+#define CAPTURE_FILE_USE_TIMESTAMP_UPPER     "CAPTURE_FILE_TIMESTAMP"
+#define CAPTURE_FILE_FLUSH_LOWER             "capture_file_flush"
+#define CAPTURE_FILE_FLUSH_UPPER             "CAPTURE_FILE_FLUSH"
+#define LOG_ALLOW_INDENTS_LOWER              "log_allow_indents"
+#define LOG_ALLOW_INDENTS_UPPER              "LOG_ALLOW_INDENTS"
+#define LOG_ASYNC_WRITE_LOWER                "log_async_write"
+#define LOG_ASYNC_WRITE_UPPER                "LOG_ASYNC_WRITE"
+#define LOG_BREAK_ON_ERROR_LOWER             "log_break_on_error"
+#define LOG_BREAK_ON_ERROR_UPPER             "LOG_BREAK_ON_ERROR"
+#define LOG_ERRORS_TO_STDERR_LOWER           "log_errors_to_stderr"
+#define LOG_ERRORS_TO_STDERR_UPPER           "LOG_ERRORS_TO_STDERR"
+#define LOG_DETAILED_LOWER                   "log_detailed"
+#define LOG_DETAILED_UPPER                   "LOG_DETAILED"
+#define LOG_FILE_NAME_LOWER                  "log_file"
+#define LOG_FILE_NAME_UPPER                  "LOG_FILE"
+#define LOG_FILE_CREATE_NEW_LOWER            "log_file_create_new"
+#define LOG_FILE_CREATE_NEW_UPPER            "LOG_FILE_CREATE_NEW"
+#define LOG_FILE_FLUSH_AFTER_WRITE_LOWER     "log_file_flush_after_write"
+#define LOG_FILE_FLUSH_AFTER_WRITE_UPPER     "LOG_FILE_FLUSH_AFTER_WRITE"
+#define LOG_FILE_KEEP_OPEN_LOWER             "log_file_keep_open"
+#define LOG_FILE_KEEP_OPEN_UPPER             "LOG_FILE_KEEP_OPEN"
+#define LOG_LEVEL_LOWER                      "log_level"
+#define LOG_LEVEL_UPPER                      "LOG_LEVEL"
+#define LOG_OUTPUT_TO_CONSOLE_LOWER          "log_output_to_console"
+#define LOG_OUTPUT_TO_CONSOLE_UPPER          "LOG_OUTPUT_TO_CONSOLE"
+#define LOG_OUTPUT_TO_OS_DEBUG_STRING_LOWER  "log_output_to_os_debug_string"
+#define LOG_OUTPUT_TO_OS_DEBUG_STRING_UPPER  "LOG_OUTPUT_TO_OS_DEBUG_STRING"
+#define MEMORY_TRACKING_MODE_LOWER           "memory_tracking_mode"
+#define MEMORY_TRACKING_MODE_UPPER           "MEMORY_TRACKING_MODE"
+#define CAPTURE_FRAMES_LOWER                 "capture_frames"
+#define CAPTURE_FRAMES_UPPER                 "CAPTURE_FRAMES"
+#define CAPTURE_TRIGGER_LOWER                "capture_trigger"
+#define CAPTURE_TRIGGER_UPPER                "CAPTURE_TRIGGER"
+#define PAGE_GUARD_COPY_ON_MAP_LOWER         "page_guard_copy_on_map"
+#define PAGE_GUARD_COPY_ON_MAP_UPPER         "PAGE_GUARD_COPY_ON_MAP"
+#define PAGE_GUARD_SEPARATE_READ_LOWER       "page_guard_separate_read"
+#define PAGE_GUARD_SEPARATE_READ_UPPER       "PAGE_GUARD_SEPARATE_READ"
+#define PAGE_GUARD_PERSISTENT_MEMORY_LOWER   "page_guard_persistent_memory"
+#define PAGE_GUARD_PERSISTENT_MEMORY_UPPER   "PAGE_GUARD_PERSISTENT_MEMORY"
+#define PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER  "page_guard_align_buffer_sizes"
+#define PAGE_GUARD_ALIGN_BUFFER_SIZES_UPPER  "PAGE_GUARD_ALIGN_BUFFER_SIZES"
+#define PAGE_GUARD_TRACK_AHB_MEMORY_LOWER    "page_guard_track_ahb_memory"
+#define PAGE_GUARD_TRACK_AHB_MEMORY_UPPER    "PAGE_GUARD_TRACK_AHB_MEMORY"
+#define PAGE_GUARD_EXTERNAL_MEMORY_LOWER     "page_guard_external_memory"
+#define PAGE_GUARD_EXTERNAL_MEMORY_UPPER     "PAGE_GUARD_EXTERNAL_MEMORY"
+#define PAGE_GUARD_AUTO_EXTERNAL_MEMORY_LOWER "page_guard_auto_external_memory"
+#define PAGE_GUARD_AUTO_EXTERNAL_MEMORY_UPPER "PAGE_GUARD_AUTO_EXTERNAL_MEMORY"
+#define CAPTURE_FILE_ASYNC_WRITE_LOWER       "capture_file_async_write"
+#define CAPTURE_FILE_ASYNC_WRITE_UPPER       "CAPTURE_FILE_ASYNC_WRITE"
+#define CAPTURE_COMPRESSION_THREADS_LOWER    "capture_compression_threads"
+#define CAPTURE_COMPRESSION_THREADS_UPPER    "CAPTURE_COMPRESSION_THREADS"
+#define CAPTURE_FILE_MMAP_LOWER              "capture_file_mmap"
+#define CAPTURE_FILE_MMAP_UPPER              "CAPTURE_FILE_MMAP"
+#define CAPTURE_FILE_IO_URING_LOWER          "capture_file_io_uring"
+#define CAPTURE_FILE_IO_URING_UPPER          "CAPTURE_FILE_IO_URING"
+#define PAGE_GUARD_SUB_PAGE_DIFF_LOWER       "page_guard_sub_page_diff"
+#define PAGE_GUARD_SUB_PAGE_DIFF_UPPER       "PAGE_GUARD_SUB_PAGE_DIFF"
+#define PAGE_GUARD_PROCESS_THREADS_LOWER     "page_guard_process_threads"
+#define PAGE_GUARD_PROCESS_THREADS_UPPER     "PAGE_GUARD_PROCESS_THREADS"
+#define PAGE_GUARD_HUGE_PAGES_LOWER          "page_guard_huge_pages"
+#define PAGE_GUARD_HUGE_PAGES_UPPER          "PAGE_GUARD_HUGE_PAGES"
+#define CAPTURE_DEDUPLICATE_MEMORY_LOWER     "capture_deduplicate_memory"
+#define CAPTURE_DEDUPLICATE_MEMORY_UPPER     "CAPTURE_DEDUPLICATE_MEMORY"
+#define CAPTURE_COMPRESSION_BATCH_SIZE_LOWER "capture_compression_batch_size"
+#define CAPTURE_COMPRESSION_BATCH_SIZE_UPPER "CAPTURE_COMPRESSION_BATCH_SIZE"
+#define CAPTURE_COMPACT_HANDLE_IDS_LOWER     "capture_compact_handle_ids"
+#define CAPTURE_COMPACT_HANDLE_IDS_UPPER     "CAPTURE_COMPACT_HANDLE_IDS"
+#define CAPTURE_ALIGN_BLOCKS_LOWER           "capture_align_blocks"
+#define CAPTURE_ALIGN_BLOCKS_UPPER           "CAPTURE_ALIGN_BLOCKS"
+#define CAPTURE_COMPACT_HEADERS_LOWER        "capture_compact_headers"
+#define CAPTURE_COMPACT_HEADERS_UPPER        "CAPTURE_COMPACT_HEADERS"
+#define CAPTURE_COMPRESSION_BUDGET_LOWER     "capture_compression_budget"
+#define CAPTURE_COMPRESSION_BUDGET_UPPER     "CAPTURE_COMPRESSION_BUDGET"
+#define CAPTURE_COMPRESSION_LEVEL_LOWER      "capture_compression_level"
+#define CAPTURE_COMPRESSION_LEVEL_UPPER      "CAPTURE_COMPRESSION_LEVEL"
+#define CAPTURE_COMPRESSION_LONG_LOWER       "capture_compression_long"
+#define CAPTURE_COMPRESSION_LONG_UPPER       "CAPTURE_COMPRESSION_LONG"
+#define CAPTURE_COMPRESSION_WORKERS_LOWER    "capture_compression_workers"
+#define CAPTURE_COMPRESSION_WORKERS_UPPER    "CAPTURE_COMPRESSION_WORKERS"
+#define CAPTURE_CALL_STATISTICS_FILE_LOWER   "capture_call_statistics_file"
+#define CAPTURE_CALL_STATISTICS_FILE_UPPER   "CAPTURE_CALL_STATISTICS_FILE"
+#define CAPTURE_TELEMETRY_PORT_LOWER         "capture_telemetry_port"
+#define CAPTURE_TELEMETRY_PORT_UPPER         "CAPTURE_TELEMETRY_PORT"
+#define CAPTURE_TELEMETRY_INTERVAL_LOWER     "capture_telemetry_interval"
+#define CAPTURE_TELEMETRY_INTERVAL_UPPER     "CAPTURE_TELEMETRY_INTERVAL"
+#define CAPTURE_TRIM_CONTENT_CACHE_LOWER     "capture_trim_content_cache"
+#define CAPTURE_TRIM_CONTENT_CACHE_UPPER     "CAPTURE_TRIM_CONTENT_CACHE"
+#define CAPTURE_TRIM_OPTIMIZE_LOWER          "capture_trim_optimize"
+#define CAPTURE_TRIM_OPTIMIZE_UPPER          "CAPTURE_TRIM_OPTIMIZE"
+#define CAPTURE_TRIM_OPTIMIZE_BDA_LOWER      "capture_trim_optimize_bda"
+#define CAPTURE_TRIM_OPTIMIZE_BDA_UPPER      "CAPTURE_TRIM_OPTIMIZE_BDA"
+#define CAPTURE_TRIM_DORMANT_LOWER           "capture_trim_dormant"
+#define CAPTURE_TRIM_DORMANT_UPPER           "CAPTURE_TRIM_DORMANT"
+#define CAPTURE_RECORDER_FRAMES_LOWER        "capture_recorder_frames"
+#define CAPTURE_RECORDER_FRAMES_UPPER        "CAPTURE_RECORDER_FRAMES"
+#define CAPTURE_RECORDER_SIZE_LOWER          "capture_recorder_size"
+#define CAPTURE_RECORDER_SIZE_UPPER          "CAPTURE_RECORDER_SIZE"
+#define CAPTURE_RECORDER_TRIGGER_LOWER       "capture_recorder_trigger"
+#define CAPTURE_RECORDER_TRIGGER_UPPER       "CAPTURE_RECORDER_TRIGGER"
+#define CAPTURE_SEGMENT_FRAMES_LOWER         "capture_segment_frames"
+#define CAPTURE_SEGMENT_FRAMES_UPPER         "CAPTURE_SEGMENT_FRAMES"
+#define CAPTURE_SEGMENT_SIZE_LOWER           "capture_segment_size"
+#define CAPTURE_SEGMENT_SIZE_UPPER           "CAPTURE_SEGMENT_SIZE"
+#define CAPTURE_FILE_INDEX_LOWER             "capture_file_index"
+#define CAPTURE_FILE_INDEX_UPPER             "CAPTURE_FILE_INDEX"
+#define CAPTURE_COMMAND_BUFFER_STREAMS_LOWER "capture_command_buffer_streams"
+#define CAPTURE_COMMAND_BUFFER_STREAMS_UPPER "CAPTURE_COMMAND_BUFFER_STREAMS"
+#define CAPTURE_FILE_THREAD_SEGMENTS_LOWER   "capture_file_thread_segments"
+#define CAPTURE_FILE_THREAD_SEGMENTS_UPPER   "CAPTURE_FILE_THREAD_SEGMENTS"
+#define MEMORY_TRACKING_HASH_BLOCK_SIZE_LOWER "memory_tracking_hash_block_size"
+#define MEMORY_TRACKING_HASH_BLOCK_SIZE_UPPER "MEMORY_TRACKING_HASH_BLOCK_SIZE"
+#define CAPTURE_DEDUPLICATE_SHADERS_LOWER    "capture_deduplicate_shaders"
+#define CAPTURE_DEDUPLICATE_SHADERS_UPPER    "CAPTURE_DEDUPLICATE_SHADERS"
+#define CAPTURE_TRIM_PIPELINE_CACHE_LOWER    "capture_trim_pipeline_cache"
+#define CAPTURE_TRIM_PIPELINE_CACHE_UPPER    "CAPTURE_TRIM_PIPELINE_CACHE"
+#define CAPTURE_TRIM_CONSTANT_CONTENT_LOWER  "capture_trim_constant_content"
+#define CAPTURE_TRIM_CONSTANT_CONTENT_UPPER  "CAPTURE_TRIM_CONSTANT_CONTENT"
+#define CAPTURE_CPU_TIMESTAMPS_LOWER         "capture_cpu_timestamps"
+#define CAPTURE_CPU_TIMESTAMPS_UPPER         "CAPTURE_CPU_TIMESTAMPS"
+#define CAPTURE_HANDLE_SIDE_TABLES_LOWER     "capture_handle_side_tables"
+#define CAPTURE_HANDLE_SIDE_TABLES_UPPER     "CAPTURE_HANDLE_SIDE_TABLES"
 // clang-format on
 
 #if defined(__ANDROID__)
@@ -96,30 +174,69 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
-const char kCaptureCompressionTypeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
-const char kCaptureFileFlushEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
-const char kCaptureFileNameEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
-const char kCaptureFileUseTimestampEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
-const char kLogAllowIndentsEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
-const char kLogBreakOnErrorEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_BREAK_ON_ERROR_LOWER;
-const char kLogDetailedEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_DETAILED_LOWER;
-const char kLogErrorsToStderrEnvVar[]         = GFXRECON_ENV_VAR_PREFIX LOG_ERRORS_TO_STDERR_LOWER;
-const char kLogFileNameEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_FILE_NAME_LOWER;
-const char kLogFileCreateNewEnvVar[]          = GFXRECON_ENV_VAR_PREFIX LOG_FILE_CREATE_NEW_LOWER;
-const char kLogFileFlushAfterWriteEnvVar[]    = GFXRECON_ENV_VAR_PREFIX LOG_FILE_FLUSH_AFTER_WRITE_LOWER;
-const char kLogFileKeepFileOpenEnvVar[]       = GFXRECON_ENV_VAR_PREFIX LOG_FILE_KEEP_OPEN_LOWER;
-const char kLogLevelEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX LOG_LEVEL_LOWER;
-const char kLogOutputToConsoleEnvVar[]        = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_CONSOLE_LOWER;
-const char kLogOutputToOsDebugStringEnvVar[]  = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_OS_DEBUG_STRING_LOWER;
-const char kMemoryTrackingModeEnvVar[]        = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_MODE_LOWER;
-const char kCaptureFramesEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_FRAMES_LOWER;
-const char kCaptureTriggerEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_LOWER;
-const char kPageGuardCopyOnMapEnvVar[]        = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_LOWER;
-const char kPageGuardSeparateReadEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_LOWER;
-const char kPageGuardPersistentMemoryEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_LOWER;
-const char kPageGuardAlignBufferSizesEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER;
-const char kPageGuardTrackAhbMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_LOWER;
-const char kPageGuardExternalMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_LOWER;
+const char kCaptureCompressionTypeEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
+const char kCaptureFileFlushEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileNameEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
+const char kCaptureFileUseTimestampEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
+const char kLogAllowIndentsEnvVar[]             = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
+const char kLogAsyncWriteEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_ASYNC_WRITE_LOWER;
+const char kLogBreakOnErrorEnvVar[]             = GFXRECON_ENV_VAR_PREFIX LOG_BREAK_ON_ERROR_LOWER;
+const char kLogDetailedEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX LOG_DETAILED_LOWER;
+const char kLogErrorsToStderrEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ERRORS_TO_STDERR_LOWER;
+const char kLogFileNameEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX LOG_FILE_NAME_LOWER;
+const char kLogFileCreateNewEnvVar[]            = GFXRECON_ENV_VAR_PREFIX LOG_FILE_CREATE_NEW_LOWER;
+const char kLogFileFlushAfterWriteEnvVar[]      = GFXRECON_ENV_VAR_PREFIX LOG_FILE_FLUSH_AFTER_WRITE_LOWER;
+const char kLogFileKeepFileOpenEnvVar[]         = GFXRECON_ENV_VAR_PREFIX LOG_FILE_KEEP_OPEN_LOWER;
+const char kLogLevelEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX LOG_LEVEL_LOWER;
+const char kLogOutputToConsoleEnvVar[]          = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_CONSOLE_LOWER;
+const char kLogOutputToOsDebugStringEnvVar[]    = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_OS_DEBUG_STRING_LOWER;
+const char kMemoryTrackingModeEnvVar[]          = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_MODE_LOWER;
+const char kCaptureFramesEnvVar[]               = GFXRECON_ENV_VAR_PREFIX CAPTURE_FRAMES_LOWER;
+const char kCaptureTriggerEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_LOWER;
+const char kPageGuardCopyOnMapEnvVar[]          = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_LOWER;
+const char kPageGuardSeparateReadEnvVar[]       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_LOWER;
+const char kPageGuardPersistentMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_LOWER;
+const char kPageGuardAlignBufferSizesEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER;
+const char kPageGuardTrackAhbMemoryEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_LOWER;
+const char kPageGuardExternalMemoryEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_LOWER;
+const char kPageGuardAutoExternalMemoryEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_AUTO_EXTERNAL_MEMORY_LOWER;
+const char kCaptureFileAsyncWriteEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_LOWER;
+const char kCaptureCompressionThreadsEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_LOWER;
+const char kCaptureFileMmapEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_MMAP_LOWER;
+const char kCaptureFileIoUringEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_IO_URING_LOWER;
+const char kPageGuardSubPageDiffEnvVar[]        = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SUB_PAGE_DIFF_LOWER;
+const char kPageGuardProcessThreadsEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PROCESS_THREADS_LOWER;
+const char kPageGuardHugePagesEnvVar[]          = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_HUGE_PAGES_LOWER;
+const char kCaptureDeduplicateMemoryEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUPLICATE_MEMORY_LOWER;
+const char kCaptureCompressionBatchSizeEnvVar[] = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_BATCH_SIZE_LOWER;
+const char kCaptureCompactHandleIdsEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_HANDLE_IDS_LOWER;
+const char kCaptureAlignBlocksEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_ALIGN_BLOCKS_LOWER;
+const char kCaptureCompactHeadersEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_HEADERS_LOWER;
+const char kCaptureCompressionBudgetEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_BUDGET_LOWER;
+const char kCaptureCompressionLevelEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_LEVEL_LOWER;
+const char kCaptureCompressionLongEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_LONG_LOWER;
+const char kCaptureCompressionWorkersEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_WORKERS_LOWER;
+const char kCaptureCallStatisticsFileEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_CALL_STATISTICS_FILE_LOWER;
+const char kCaptureTelemetryPortEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_TELEMETRY_PORT_LOWER;
+const char kCaptureTelemetryIntervalEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_TELEMETRY_INTERVAL_LOWER;
+const char kCaptureTrimContentCacheEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_CONTENT_CACHE_LOWER;
+const char kCaptureTrimOptimizeEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_OPTIMIZE_LOWER;
+const char kCaptureTrimOptimizeBdaEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_OPTIMIZE_BDA_LOWER;
+const char kCaptureTrimDormantEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_DORMANT_LOWER;
+const char kCaptureRecorderFramesEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_RECORDER_FRAMES_LOWER;
+const char kCaptureRecorderSizeEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_RECORDER_SIZE_LOWER;
+const char kCaptureRecorderTriggerEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_RECORDER_TRIGGER_LOWER;
+const char kCaptureSegmentFramesEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_SEGMENT_FRAMES_LOWER;
+const char kCaptureSegmentSizeEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_SEGMENT_SIZE_LOWER;
+const char kCaptureFileIndexEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_INDEX_LOWER;
+const char kCaptureCommandBufferStreamsEnvVar[] = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMMAND_BUFFER_STREAMS_LOWER;
+const char kCaptureFileThreadSegmentsEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_THREAD_SEGMENTS_LOWER;
+const char kMemoryTrackingHashBlockSizeEnvVar[] = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_HASH_BLOCK_SIZE_LOWER;
+const char kCaptureDeduplicateShadersEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUPLICATE_SHADERS_LOWER;
+const char kCaptureTrimPipelineCacheEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_PIPELINE_CACHE_LOWER;
+const char kCaptureTrimConstantContentEnvVar[]  = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_CONSTANT_CONTENT_LOWER;
+const char kCaptureCpuTimestampsEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_CPU_TIMESTAMPS_LOWER;
+const char kCaptureHandleSideTablesEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_HANDLE_SIDE_TABLES_LOWER;
 
 #else
 // Desktop environment settings
@@ -127,60 +244,138 @@ const char kPageGuardExternalMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUA
 
 const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
-const char kCaptureCompressionTypeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
-const char kCaptureFileFlushEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
-const char kCaptureFileNameEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
-const char kCaptureFileUseTimestampEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
-const char kLogAllowIndentsEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
-const char kLogBreakOnErrorEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_BREAK_ON_ERROR_UPPER;
-const char kLogDetailedEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_DETAILED_UPPER;
-const char kLogErrorsToStderrEnvVar[]         = GFXRECON_ENV_VAR_PREFIX LOG_ERRORS_TO_STDERR_UPPER;
-const char kLogFileNameEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_FILE_NAME_UPPER;
-const char kLogFileCreateNewEnvVar[]          = GFXRECON_ENV_VAR_PREFIX LOG_FILE_CREATE_NEW_UPPER;
-const char kLogFileFlushAfterWriteEnvVar[]    = GFXRECON_ENV_VAR_PREFIX LOG_FILE_FLUSH_AFTER_WRITE_UPPER;
-const char kLogFileKeepFileOpenEnvVar[]       = GFXRECON_ENV_VAR_PREFIX LOG_FILE_KEEP_OPEN_UPPER;
-const char kLogLevelEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX LOG_LEVEL_UPPER;
-const char kLogOutputToConsoleEnvVar[]        = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_CONSOLE_UPPER;
-const char kLogOutputToOsDebugStringEnvVar[]  = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_OS_DEBUG_STRING_UPPER;
-const char kMemoryTrackingModeEnvVar[]        = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_MODE_UPPER;
-const char kCaptureFramesEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_FRAMES_UPPER;
-const char kPageGuardCopyOnMapEnvVar[]        = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_UPPER;
-const char kPageGuardSeparateReadEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_UPPER;
-const char kPageGuardPersistentMemoryEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_UPPER;
-const char kPageGuardAlignBufferSizesEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_UPPER;
-const char kPageGuardTrackAhbMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_UPPER;
-const char kPageGuardExternalMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_UPPER;
-const char kCaptureTriggerEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
+const char kCaptureCompressionTypeEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
+const char kCaptureFileFlushEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileNameEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
+const char kCaptureFileUseTimestampEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
+const char kLogAllowIndentsEnvVar[]             = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
+const char kLogAsyncWriteEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_ASYNC_WRITE_UPPER;
+const char kLogBreakOnErrorEnvVar[]             = GFXRECON_ENV_VAR_PREFIX LOG_BREAK_ON_ERROR_UPPER;
+const char kLogDetailedEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX LOG_DETAILED_UPPER;
+const char kLogErrorsToStderrEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ERRORS_TO_STDERR_UPPER;
+const char kLogFileNameEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX LOG_FILE_NAME_UPPER;
+const char kLogFileCreateNewEnvVar[]            = GFXRECON_ENV_VAR_PREFIX LOG_FILE_CREATE_NEW_UPPER;
+const char kLogFileFlushAfterWriteEnvVar[]      = GFXRECON_ENV_VAR_PREFIX LOG_FILE_FLUSH_AFTER_WRITE_UPPER;
+const char kLogFileKeepFileOpenEnvVar[]         = GFXRECON_ENV_VAR_PREFIX LOG_FILE_KEEP_OPEN_UPPER;
+const char kLogLevelEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX LOG_LEVEL_UPPER;
+const char kLogOutputToConsoleEnvVar[]          = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_CONSOLE_UPPER;
+const char kLogOutputToOsDebugStringEnvVar[]    = GFXRECON_ENV_VAR_PREFIX LOG_OUTPUT_TO_OS_DEBUG_STRING_UPPER;
+const char kMemoryTrackingModeEnvVar[]          = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_MODE_UPPER;
+const char kCaptureFramesEnvVar[]               = GFXRECON_ENV_VAR_PREFIX CAPTURE_FRAMES_UPPER;
+const char kPageGuardCopyOnMapEnvVar[]          = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_UPPER;
+const char kPageGuardSeparateReadEnvVar[]       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_UPPER;
+const char kPageGuardPersistentMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_UPPER;
+const char kPageGuardAlignBufferSizesEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_UPPER;
+const char kPageGuardTrackAhbMemoryEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_UPPER;
+const char kPageGuardExternalMemoryEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_UPPER;
+const char kPageGuardAutoExternalMemoryEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_AUTO_EXTERNAL_MEMORY_UPPER;
+const char kCaptureTriggerEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
+const char kCaptureFileAsyncWriteEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_UPPER;
+const char kCaptureCompressionThreadsEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_UPPER;
+const char kCaptureFileMmapEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_MMAP_UPPER;
+const char kCaptureFileIoUringEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_IO_URING_UPPER;
+const char kPageGuardSubPageDiffEnvVar[]        = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SUB_PAGE_DIFF_UPPER;
+const char kPageGuardProcessThreadsEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PROCESS_THREADS_UPPER;
+const char kPageGuardHugePagesEnvVar[]          = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_HUGE_PAGES_UPPER;
+const char kCaptureDeduplicateMemoryEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUPLICATE_MEMORY_UPPER;
+const char kCaptureCompressionBatchSizeEnvVar[] = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_BATCH_SIZE_UPPER;
+const char kCaptureCompactHandleIdsEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_HANDLE_IDS_UPPER;
+const char kCaptureAlignBlocksEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_ALIGN_BLOCKS_UPPER;
+const char kCaptureCompactHeadersEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_HEADERS_UPPER;
+const char kCaptureCompressionBudgetEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_BUDGET_UPPER;
+const char kCaptureCompressionLevelEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_LEVEL_UPPER;
+const char kCaptureCompressionLongEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_LONG_UPPER;
+const char kCaptureCompressionWorkersEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_WORKERS_UPPER;
+const char kCaptureCallStatisticsFileEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_CALL_STATISTICS_FILE_UPPER;
+const char kCaptureTelemetryPortEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_TELEMETRY_PORT_UPPER;
+const char kCaptureTelemetryIntervalEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_TELEMETRY_INTERVAL_UPPER;
+const char kCaptureTrimContentCacheEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_CONTENT_CACHE_UPPER;
+const char kCaptureTrimOptimizeEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_OPTIMIZE_UPPER;
+const char kCaptureTrimOptimizeBdaEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_OPTIMIZE_BDA_UPPER;
+const char kCaptureTrimDormantEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_DORMANT_UPPER;
+const char kCaptureRecorderFramesEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_RECORDER_FRAMES_UPPER;
+const char kCaptureRecorderSizeEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_RECORDER_SIZE_UPPER;
+const char kCaptureRecorderTriggerEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_RECORDER_TRIGGER_UPPER;
+const char kCaptureSegmentFramesEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_SEGMENT_FRAMES_UPPER;
+const char kCaptureSegmentSizeEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_SEGMENT_SIZE_UPPER;
+const char kCaptureFileIndexEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_INDEX_UPPER;
+const char kCaptureCommandBufferStreamsEnvVar[] = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMMAND_BUFFER_STREAMS_UPPER;
+const char kCaptureFileThreadSegmentsEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_THREAD_SEGMENTS_UPPER;
+const char kMemoryTrackingHashBlockSizeEnvVar[] = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_HASH_BLOCK_SIZE_UPPER;
+const char kCaptureDeduplicateShadersEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUPLICATE_SHADERS_UPPER;
+const char kCaptureTrimPipelineCacheEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_PIPELINE_CACHE_UPPER;
+const char kCaptureTrimConstantContentEnvVar[]  = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIM_CONSTANT_CONTENT_UPPER;
+const char kCaptureCpuTimestampsEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_CPU_TIMESTAMPS_UPPER;
+const char kCaptureHandleSideTablesEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_HANDLE_SIDE_TABLES_UPPER;
 #endif
 
 // Capture options for settings file.
 // clang-format off
 const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 
-const std::string kOptionKeyCaptureCompressionType    = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
-const std::string kOptionKeyCaptureFile               = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
-const std::string kOptionKeyCaptureFileForceFlush     = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
-const std::string kOptionKeyCaptureFileUseTimestamp   = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
-const std::string kOptionKeyLogAllowIndents           = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
-const std::string kOptionKeyLogBreakOnError           = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
-const std::string kOptionKeyLogDetailed               = std::string(kSettingsFilter) + std::string(LOG_DETAILED_LOWER);
-const std::string kOptionKeyLogErrorsToStderr         = std::string(kSettingsFilter) + std::string(LOG_ERRORS_TO_STDERR_LOWER);
-const std::string kOptionKeyLogFile                   = std::string(kSettingsFilter) + std::string(LOG_FILE_NAME_LOWER);
-const std::string kOptionKeyLogFileCreateNew          = std::string(kSettingsFilter) + std::string(LOG_FILE_CREATE_NEW_LOWER);
-const std::string kOptionKeyLogFileFlushAfterWrite    = std::string(kSettingsFilter) + std::string(LOG_FILE_FLUSH_AFTER_WRITE_LOWER);
-const std::string kOptionKeyLogFileKeepOpen           = std::string(kSettingsFilter) + std::string(LOG_FILE_KEEP_OPEN_LOWER);
-const std::string kOptionKeyLogLevel                  = std::string(kSettingsFilter) + std::string(LOG_LEVEL_LOWER);
-const std::string kOptionKeyLogOutputToConsole        = std::string(kSettingsFilter) + std::string(LOG_OUTPUT_TO_CONSOLE_LOWER);
-const std::string kOptionKeyLogOutputToOsDebugString  = std::string(kSettingsFilter) + std::string(LOG_OUTPUT_TO_OS_DEBUG_STRING_LOWER);
-const std::string kOptionKeyMemoryTrackingMode        = std::string(kSettingsFilter) + std::string(MEMORY_TRACKING_MODE_LOWER);
-const std::string kOptionKeyCaptureFrames             = std::string(kSettingsFilter) + std::string(CAPTURE_FRAMES_LOWER);
-const std::string kOptionKeyCaptureTrigger            = std::string(kSettingsFilter) + std::string(CAPTURE_TRIGGER_LOWER);
-const std::string kOptionKeyPageGuardCopyOnMap        = std::string(kSettingsFilter) + std::string(PAGE_GUARD_COPY_ON_MAP_LOWER);
-const std::string kOptionKeyPageGuardSeparateRead     = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SEPARATE_READ_LOWER);
-const std::string kOptionKeyPageGuardPersistentMemory = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PERSISTENT_MEMORY_LOWER);
-const std::string kOptionKeyPageGuardAlignBufferSizes = std::string(kSettingsFilter) + std::string(PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER);
-const std::string kOptionKeyPageGuardTrackAhbMemory   = std::string(kSettingsFilter) + std::string(PAGE_GUARD_TRACK_AHB_MEMORY_LOWER);
-const std::string kOptionKeyPageGuardExternalMemory   = std::string(kSettingsFilter) + std::string(PAGE_GUARD_EXTERNAL_MEMORY_LOWER);
+const std::string kOptionKeyCaptureCompressionType      = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
+const std::string kOptionKeyCaptureFile                 = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
+const std::string kOptionKeyCaptureFileForceFlush       = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileUseTimestamp     = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
+const std::string kOptionKeyLogAllowIndents             = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
+const std::string kOptionKeyLogAsyncWrite               = std::string(kSettingsFilter) + std::string(LOG_ASYNC_WRITE_LOWER);
+const std::string kOptionKeyLogBreakOnError             = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
+const std::string kOptionKeyLogDetailed                 = std::string(kSettingsFilter) + std::string(LOG_DETAILED_LOWER);
+const std::string kOptionKeyLogErrorsToStderr           = std::string(kSettingsFilter) + std::string(LOG_ERRORS_TO_STDERR_LOWER);
+const std::string kOptionKeyLogFile                     = std::string(kSettingsFilter) + std::string(LOG_FILE_NAME_LOWER);
+const std::string kOptionKeyLogFileCreateNew            = std::string(kSettingsFilter) + std::string(LOG_FILE_CREATE_NEW_LOWER);
+const std::string kOptionKeyLogFileFlushAfterWrite      = std::string(kSettingsFilter) + std::string(LOG_FILE_FLUSH_AFTER_WRITE_LOWER);
+const std::string kOptionKeyLogFileKeepOpen             = std::string(kSettingsFilter) + std::string(LOG_FILE_KEEP_OPEN_LOWER);
+const std::string kOptionKeyLogLevel                    = std::string(kSettingsFilter) + std::string(LOG_LEVEL_LOWER);
+const std::string kOptionKeyLogOutputToConsole          = std::string(kSettingsFilter) + std::string(LOG_OUTPUT_TO_CONSOLE_LOWER);
+const std::string kOptionKeyLogOutputToOsDebugString    = std::string(kSettingsFilter) + std::string(LOG_OUTPUT_TO_OS_DEBUG_STRING_LOWER);
+const std::string kOptionKeyMemoryTrackingMode          = std::string(kSettingsFilter) + std::string(MEMORY_TRACKING_MODE_LOWER);
+const std::string kOptionKeyCaptureFrames               = std::string(kSettingsFilter) + std::string(CAPTURE_FRAMES_LOWER);
+const std::string kOptionKeyCaptureTrigger              = std::string(kSettingsFilter) + std::string(CAPTURE_TRIGGER_LOWER);
+const std::string kOptionKeyPageGuardCopyOnMap          = std::string(kSettingsFilter) + std::string(PAGE_GUARD_COPY_ON_MAP_LOWER);
+const std::string kOptionKeyPageGuardSeparateRead       = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SEPARATE_READ_LOWER);
+const std::string kOptionKeyPageGuardPersistentMemory   = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PERSISTENT_MEMORY_LOWER);
+const std::string kOptionKeyPageGuardAlignBufferSizes   = std::string(kSettingsFilter) + std::string(PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER);
+const std::string kOptionKeyPageGuardTrackAhbMemory     = std::string(kSettingsFilter) + std::string(PAGE_GUARD_TRACK_AHB_MEMORY_LOWER);
+const std::string kOptionKeyPageGuardExternalMemory     = std::string(kSettingsFilter) + std::string(PAGE_GUARD_EXTERNAL_MEMORY_LOWER);
+const std::string kOptionKeyPageGuardAutoExternalMemory = std::string(kSettingsFilter) + std::string(PAGE_GUARD_AUTO_EXTERNAL_MEMORY_LOWER);
+const std::string kOptionKeyCaptureFileAsyncWrite       = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_ASYNC_WRITE_LOWER);
+const std::string kOptionKeyCaptureCompressionThreads   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_THREADS_LOWER);
+const std::string kOptionKeyCaptureFileMmap             = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_MMAP_LOWER);
+const std::string kOptionKeyCaptureFileIoUring          = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_IO_URING_LOWER);
+const std::string kOptionKeyPageGuardSubPageDiff        = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SUB_PAGE_DIFF_LOWER);
+const std::string kOptionKeyPageGuardProcessThreads     = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PROCESS_THREADS_LOWER);
+const std::string kOptionKeyPageGuardHugePages          = std::string(kSettingsFilter) + std::string(PAGE_GUARD_HUGE_PAGES_LOWER);
+const std::string kOptionKeyCaptureDeduplicateMemory    = std::string(kSettingsFilter) + std::string(CAPTURE_DEDUPLICATE_MEMORY_LOWER);
+const std::string kOptionKeyCaptureCompressionBatchSize = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_BATCH_SIZE_LOWER);
+const std::string kOptionKeyCaptureCompactHandleIds     = std::string(kSettingsFilter) + std::string(CAPTURE_COMPACT_HANDLE_IDS_LOWER);
+const std::string kOptionKeyCaptureAlignBlocks          = std::string(kSettingsFilter) + std::string(CAPTURE_ALIGN_BLOCKS_LOWER);
+const std::string kOptionKeyCaptureCompactHeaders       = std::string(kSettingsFilter) + std::string(CAPTURE_COMPACT_HEADERS_LOWER);
+const std::string kOptionKeyCaptureCompressionBudget    = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_BUDGET_LOWER);
+const std::string kOptionKeyCaptureCompressionLevel     = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_LEVEL_LOWER);
+const std::string kOptionKeyCaptureCompressionLong      = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_LONG_LOWER);
+const std::string kOptionKeyCaptureCompressionWorkers   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_WORKERS_LOWER);
+const std::string kOptionKeyCaptureCallStatisticsFile   = std::string(kSettingsFilter) + std::string(CAPTURE_CALL_STATISTICS_FILE_LOWER);
+const std::string kOptionKeyCaptureTelemetryPort        = std::string(kSettingsFilter) + std::string(CAPTURE_TELEMETRY_PORT_LOWER);
+const std::string kOptionKeyCaptureTelemetryInterval    = std::string(kSettingsFilter) + std::string(CAPTURE_TELEMETRY_INTERVAL_LOWER);
+const std::string kOptionKeyCaptureTrimContentCache     = std::string(kSettingsFilter) + std::string(CAPTURE_TRIM_CONTENT_CACHE_LOWER);
+const std::string kOptionKeyCaptureTrimOptimize         = std::string(kSettingsFilter) + std::string(CAPTURE_TRIM_OPTIMIZE_LOWER);
+const std::string kOptionKeyCaptureTrimOptimizeBda      = std::string(kSettingsFilter) + std::string(CAPTURE_TRIM_OPTIMIZE_BDA_LOWER);
+const std::string kOptionKeyCaptureTrimDormant          = std::string(kSettingsFilter) + std::string(CAPTURE_TRIM_DORMANT_LOWER);
+const std::string kOptionKeyCaptureRecorderFrames       = std::string(kSettingsFilter) + std::string(CAPTURE_RECORDER_FRAMES_LOWER);
+const std::string kOptionKeyCaptureRecorderSize         = std::string(kSettingsFilter) + std::string(CAPTURE_RECORDER_SIZE_LOWER);
+const std::string kOptionKeyCaptureRecorderTrigger      = std::string(kSettingsFilter) + std::string(CAPTURE_RECORDER_TRIGGER_LOWER);
+const std::string kOptionKeyCaptureSegmentFrames        = std::string(kSettingsFilter) + std::string(CAPTURE_SEGMENT_FRAMES_LOWER);
+const std::string kOptionKeyCaptureSegmentSize          = std::string(kSettingsFilter) + std::string(CAPTURE_SEGMENT_SIZE_LOWER);
+const std::string kOptionKeyCaptureFileIndex            = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_INDEX_LOWER);
+const std::string kOptionKeyCaptureCommandBufferStreams = std::string(kSettingsFilter) + std::string(CAPTURE_COMMAND_BUFFER_STREAMS_LOWER);
+const std::string kOptionKeyCaptureFileThreadSegments   = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_THREAD_SEGMENTS_LOWER);
+const std::string kOptionKeyMemoryTrackingHashBlockSize = std::string(kSettingsFilter) + std::string(MEMORY_TRACKING_HASH_BLOCK_SIZE_LOWER);
+const std::string kOptionKeyCaptureDeduplicateShaders   = std::string(kSettingsFilter) + std::string(CAPTURE_DEDUPLICATE_SHADERS_LOWER);
+const std::string kOptionKeyCaptureTrimPipelineCache    = std::string(kSettingsFilter) + std::string(CAPTURE_TRIM_PIPELINE_CACHE_LOWER);
+const std::string kOptionKeyCaptureTrimConstantContent  = std::string(kSettingsFilter) + std::string(CAPTURE_TRIM_CONSTANT_CONTENT_LOWER);
+const std::string kOptionKeyCaptureCpuTimestamps        = std::string(kSettingsFilter) + std::string(CAPTURE_CPU_TIMESTAMPS_LOWER);
+const std::string kOptionKeyCaptureHandleSideTables     = std::string(kSettingsFilter) + std::string(CAPTURE_HANDLE_SIDE_TABLES_LOWER);
 
 #if defined(ENABLE_LZ4_COMPRESSION)
 const format::CompressionType kDefaultCompressionType = format::CompressionType::kLz4;
@@ -251,10 +446,34 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileNameEnvVar, kOptionKeyCaptureFile);
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionThreadsEnvVar, kOptionKeyCaptureCompressionThreads);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionBatchSizeEnvVar, kOptionKeyCaptureCompressionBatchSize);
+    LoadSingleOptionEnvVar(options, kCaptureCompactHandleIdsEnvVar, kOptionKeyCaptureCompactHandleIds);
+    LoadSingleOptionEnvVar(options, kCaptureAlignBlocksEnvVar, kOptionKeyCaptureAlignBlocks);
+    LoadSingleOptionEnvVar(options, kCaptureCompactHeadersEnvVar, kOptionKeyCaptureCompactHeaders);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionBudgetEnvVar, kOptionKeyCaptureCompressionBudget);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionLevelEnvVar, kOptionKeyCaptureCompressionLevel);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionLongEnvVar, kOptionKeyCaptureCompressionLong);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionWorkersEnvVar, kOptionKeyCaptureCompressionWorkers);
+    LoadSingleOptionEnvVar(options, kCaptureCallStatisticsFileEnvVar, kOptionKeyCaptureCallStatisticsFile);
+    LoadSingleOptionEnvVar(options, kCaptureTelemetryPortEnvVar, kOptionKeyCaptureTelemetryPort);
+    LoadSingleOptionEnvVar(options, kCaptureTelemetryIntervalEnvVar, kOptionKeyCaptureTelemetryInterval);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileAsyncWriteEnvVar, kOptionKeyCaptureFileAsyncWrite);
+    LoadSingleOptionEnvVar(options, kCaptureFileMmapEnvVar, kOptionKeyCaptureFileMmap);
+    LoadSingleOptionEnvVar(options, kCaptureFileIoUringEnvVar, kOptionKeyCaptureFileIoUring);
+    LoadSingleOptionEnvVar(options, kCaptureDeduplicateMemoryEnvVar, kOptionKeyCaptureDeduplicateMemory);
+    LoadSingleOptionEnvVar(options, kCaptureFileIndexEnvVar, kOptionKeyCaptureFileIndex);
+    LoadSingleOptionEnvVar(options, kCaptureCommandBufferStreamsEnvVar, kOptionKeyCaptureCommandBufferStreams);
+    LoadSingleOptionEnvVar(options, kCaptureFileThreadSegmentsEnvVar, kOptionKeyCaptureFileThreadSegments);
+    LoadSingleOptionEnvVar(options, kMemoryTrackingHashBlockSizeEnvVar, kOptionKeyMemoryTrackingHashBlockSize);
+    LoadSingleOptionEnvVar(options, kCaptureDeduplicateShadersEnvVar, kOptionKeyCaptureDeduplicateShaders);
+    LoadSingleOptionEnvVar(options, kCaptureCpuTimestampsEnvVar, kOptionKeyCaptureCpuTimestamps);
+    LoadSingleOptionEnvVar(options, kCaptureHandleSideTablesEnvVar, kOptionKeyCaptureHandleSideTables);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
+    LoadSingleOptionEnvVar(options, kLogAsyncWriteEnvVar, kOptionKeyLogAsyncWrite);
     LoadSingleOptionEnvVar(options, kLogBreakOnErrorEnvVar, kOptionKeyLogBreakOnError);
     LoadSingleOptionEnvVar(options, kLogDetailedEnvVar, kOptionKeyLogDetailed);
     LoadSingleOptionEnvVar(options, kLogErrorsToStderrEnvVar, kOptionKeyLogErrorsToStderr);
@@ -272,14 +491,33 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     // Trimming environment variables
     LoadSingleOptionEnvVar(options, kCaptureFramesEnvVar, kOptionKeyCaptureFrames);
     LoadSingleOptionEnvVar(options, kCaptureTriggerEnvVar, kOptionKeyCaptureTrigger);
+    LoadSingleOptionEnvVar(options, kCaptureTrimContentCacheEnvVar, kOptionKeyCaptureTrimContentCache);
+    LoadSingleOptionEnvVar(options, kCaptureTrimOptimizeEnvVar, kOptionKeyCaptureTrimOptimize);
+    LoadSingleOptionEnvVar(options, kCaptureTrimOptimizeBdaEnvVar, kOptionKeyCaptureTrimOptimizeBda);
+    LoadSingleOptionEnvVar(options, kCaptureTrimPipelineCacheEnvVar, kOptionKeyCaptureTrimPipelineCache);
+    LoadSingleOptionEnvVar(options, kCaptureTrimConstantContentEnvVar, kOptionKeyCaptureTrimConstantContent);
+    LoadSingleOptionEnvVar(options, kCaptureTrimDormantEnvVar, kOptionKeyCaptureTrimDormant);
+
+    // Flight recorder environment variables
+    LoadSingleOptionEnvVar(options, kCaptureRecorderFramesEnvVar, kOptionKeyCaptureRecorderFrames);
+    LoadSingleOptionEnvVar(options, kCaptureRecorderSizeEnvVar, kOptionKeyCaptureRecorderSize);
+    LoadSingleOptionEnvVar(options, kCaptureRecorderTriggerEnvVar, kOptionKeyCaptureRecorderTrigger);
+
+    // Capture file segment environment variables
+    LoadSingleOptionEnvVar(options, kCaptureSegmentFramesEnvVar, kOptionKeyCaptureSegmentFrames);
+    LoadSingleOptionEnvVar(options, kCaptureSegmentSizeEnvVar, kOptionKeyCaptureSegmentSize);
 
     // Page guard environment variables
     LoadSingleOptionEnvVar(options, kPageGuardCopyOnMapEnvVar, kOptionKeyPageGuardCopyOnMap);
     LoadSingleOptionEnvVar(options, kPageGuardSeparateReadEnvVar, kOptionKeyPageGuardSeparateRead);
     LoadSingleOptionEnvVar(options, kPageGuardPersistentMemoryEnvVar, kOptionKeyPageGuardPersistentMemory);
     LoadSingleOptionEnvVar(options, kPageGuardAlignBufferSizesEnvVar, kOptionKeyPageGuardAlignBufferSizes);
+    LoadSingleOptionEnvVar(options, kPageGuardSubPageDiffEnvVar, kOptionKeyPageGuardSubPageDiff);
+    LoadSingleOptionEnvVar(options, kPageGuardProcessThreadsEnvVar, kOptionKeyPageGuardProcessThreads);
+    LoadSingleOptionEnvVar(options, kPageGuardHugePagesEnvVar, kOptionKeyPageGuardHugePages);
     LoadSingleOptionEnvVar(options, kPageGuardTrackAhbMemoryEnvVar, kOptionKeyPageGuardTrackAhbMemory);
     LoadSingleOptionEnvVar(options, kPageGuardExternalMemoryEnvVar, kOptionKeyPageGuardExternalMemory);
+    LoadSingleOptionEnvVar(options, kPageGuardAutoExternalMemoryEnvVar, kOptionKeyPageGuardAutoExternalMemory);
 }
 
 void CaptureSettings::LoadOptionsFile(OptionsMap* options)
@@ -312,22 +550,95 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     // Capture file options
     settings->trace_settings_.capture_file_options.compression_type =
         ParseCompressionTypeString(FindOption(options, kOptionKeyCaptureCompressionType), kDefaultCompressionType);
+    settings->trace_settings_.compression_threads = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureCompressionThreads), settings->trace_settings_.compression_threads);
+    settings->trace_settings_.compression_batch_size =
+        ParseUnsignedIntegerString(FindOption(options, kOptionKeyCaptureCompressionBatchSize),
+                                   settings->trace_settings_.compression_batch_size);
+    settings->trace_settings_.compact_headers = ParseBoolString(FindOption(options, kOptionKeyCaptureCompactHeaders),
+                                                                settings->trace_settings_.compact_headers);
+    settings->trace_settings_.capture_file_options.handle_id_encoding =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureCompactHandleIds), false)
+            ? format::HandleIdEncoding::kVarintHandleIds
+            : format::HandleIdEncoding::kFixedHandleIds;
+    settings->trace_settings_.capture_file_options.block_alignment =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureAlignBlocks), false) ? format::kBlockPayloadAlignment : 0;
+    settings->trace_settings_.compression_budget = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureCompressionBudget), settings->trace_settings_.compression_budget);
+    settings->trace_settings_.compression_level = ParseIntegerString(
+        FindOption(options, kOptionKeyCaptureCompressionLevel), settings->trace_settings_.compression_level);
+    settings->trace_settings_.compression_long_distance = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureCompressionLong), settings->trace_settings_.compression_long_distance);
+    settings->trace_settings_.compression_workers = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureCompressionWorkers), settings->trace_settings_.compression_workers);
+    settings->trace_settings_.call_statistics_file =
+        FindOption(options, kOptionKeyCaptureCallStatisticsFile, settings->trace_settings_.call_statistics_file);
+    settings->trace_settings_.telemetry_port = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureTelemetryPort), settings->trace_settings_.telemetry_port);
+    settings->trace_settings_.telemetry_interval = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureTelemetryInterval), settings->trace_settings_.telemetry_interval);
     settings->trace_settings_.capture_file =
         FindOption(options, kOptionKeyCaptureFile, settings->trace_settings_.capture_file);
     settings->trace_settings_.time_stamp_file = ParseBoolString(FindOption(options, kOptionKeyCaptureFileUseTimestamp),
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.file_index =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFileIndex), settings->trace_settings_.file_index);
+    settings->trace_settings_.cpu_timestamps =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureCpuTimestamps), settings->trace_settings_.cpu_timestamps);
+    settings->trace_settings_.handle_side_tables = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureHandleSideTables), settings->trace_settings_.handle_side_tables);
+    settings->trace_settings_.async_file_write = ParseBoolString(FindOption(options, kOptionKeyCaptureFileAsyncWrite),
+                                                                 settings->trace_settings_.async_file_write);
+    settings->trace_settings_.memory_mapped_file =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFileMmap), settings->trace_settings_.memory_mapped_file);
+    settings->trace_settings_.io_uring_file_write = ParseBoolString(FindOption(options, kOptionKeyCaptureFileIoUring),
+                                                                    settings->trace_settings_.io_uring_file_write);
+    settings->trace_settings_.thread_segment_write = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureFileThreadSegments), settings->trace_settings_.thread_segment_write);
+    settings->trace_settings_.deduplicate_memory = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureDeduplicateMemory), settings->trace_settings_.deduplicate_memory);
+    settings->trace_settings_.deduplicate_shaders = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureDeduplicateShaders), settings->trace_settings_.deduplicate_shaders);
+    settings->trace_settings_.command_buffer_streams =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureCommandBufferStreams),
+                        settings->trace_settings_.command_buffer_streams);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
         FindOption(options, kOptionKeyMemoryTrackingMode), settings->trace_settings_.memory_tracking_mode);
+    settings->trace_settings_.memory_tracking_hash_block_size =
+        ParseUnsignedIntegerString(FindOption(options, kOptionKeyMemoryTrackingHashBlockSize),
+                                   settings->trace_settings_.memory_tracking_hash_block_size);
 
     // Trimming options:
     // trim ranges and trim hotkey are exclusive
     // with trim key will be parsed only
     // if trim ranges is empty, else it will be ignored
     ParseTrimRangeString(FindOption(options, kOptionKeyCaptureFrames), &settings->trace_settings_.trim_ranges);
+
+    // Flight recorder options
+    settings->trace_settings_.recorder_frames = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureRecorderFrames), settings->trace_settings_.recorder_frames);
+    settings->trace_settings_.recorder_size = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureRecorderSize), settings->trace_settings_.recorder_size);
+    settings->trace_settings_.recorder_trigger =
+        FindOption(options, kOptionKeyCaptureRecorderTrigger, settings->trace_settings_.recorder_trigger);
+
+    // Capture file segmentation options
+    settings->trace_settings_.segment_frames = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureSegmentFrames), settings->trace_settings_.segment_frames);
+    settings->trace_settings_.segment_size = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureSegmentSize), settings->trace_settings_.segment_size);
+
+    if ((settings->trace_settings_.recorder_frames > 0) && !settings->trace_settings_.trim_ranges.empty())
+    {
+        GFXRECON_LOG_WARNING(
+            "Settings Loader: Ignore trim ranges setting as flight recorder capture has been enabled.");
+        settings->trace_settings_.trim_ranges.clear();
+    }
+
     std::string trim_key_option = FindOption(options, kOptionKeyCaptureTrigger);
     if (!trim_key_option.empty())
     {
@@ -341,6 +652,19 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
         }
     }
 
+    settings->trace_settings_.trim_content_cache = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureTrimContentCache), settings->trace_settings_.trim_content_cache);
+    settings->trace_settings_.trim_optimize =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureTrimOptimize), settings->trace_settings_.trim_optimize);
+    settings->trace_settings_.trim_optimize_bda = ParseBoolString(FindOption(options, kOptionKeyCaptureTrimOptimizeBda),
+                                                                  settings->trace_settings_.trim_optimize_bda);
+    settings->trace_settings_.trim_pipeline_cache = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureTrimPipelineCache), settings->trace_settings_.trim_pipeline_cache);
+    settings->trace_settings_.trim_constant_content = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureTrimConstantContent), settings->trace_settings_.trim_constant_content);
+    settings->trace_settings_.trim_dormant =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureTrimDormant), settings->trace_settings_.trim_dormant);
+
     // Page guard environment variables
     settings->trace_settings_.page_guard_copy_on_map = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardCopyOnMap), settings->trace_settings_.page_guard_copy_on_map);
@@ -352,10 +676,20 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     settings->trace_settings_.page_guard_align_buffer_sizes =
         ParseBoolString(FindOption(options, kOptionKeyPageGuardAlignBufferSizes),
                         settings->trace_settings_.page_guard_align_buffer_sizes);
+    settings->trace_settings_.page_guard_sub_page_diff = ParseBoolString(
+        FindOption(options, kOptionKeyPageGuardSubPageDiff), settings->trace_settings_.page_guard_sub_page_diff);
+    settings->trace_settings_.page_guard_process_threads =
+        ParseUnsignedIntegerString(FindOption(options, kOptionKeyPageGuardProcessThreads),
+                                   settings->trace_settings_.page_guard_process_threads);
+    settings->trace_settings_.page_guard_huge_pages = ParseBoolString(
+        FindOption(options, kOptionKeyPageGuardHugePages), settings->trace_settings_.page_guard_huge_pages);
     settings->trace_settings_.page_guard_track_ahb_memory = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardTrackAhbMemory), settings->trace_settings_.page_guard_track_ahb_memory);
     settings->trace_settings_.page_guard_external_memory = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardExternalMemory), settings->trace_settings_.page_guard_external_memory);
+    settings->trace_settings_.page_guard_auto_external_memory =
+        ParseBoolString(FindOption(options, kOptionKeyPageGuardAutoExternalMemory),
+                        settings->trace_settings_.page_guard_auto_external_memory);
 
     ProcessLogOptions(options, settings);
 }
@@ -367,6 +701,8 @@ void CaptureSettings::ProcessLogOptions(OptionsMap* options, CaptureSettings* se
         ParseBoolString(FindOption(options, kOptionKeyLogAllowIndents), settings->log_settings_.use_indent);
     settings->log_settings_.break_on_error =
         ParseBoolString(FindOption(options, kOptionKeyLogBreakOnError), settings->log_settings_.break_on_error);
+    settings->log_settings_.async_write =
+        ParseBoolString(FindOption(options, kOptionKeyLogAsyncWrite), settings->log_settings_.async_write);
     settings->log_settings_.output_detailed_log_info =
         ParseBoolString(FindOption(options, kOptionKeyLogDetailed), settings->log_settings_.output_detailed_log_info);
     settings->log_settings_.file_name = FindOption(options, kOptionKeyLogFile, settings->log_settings_.file_name);
@@ -431,6 +767,52 @@ bool CaptureSettings::ParseBoolString(const std::string& value_string, bool defa
     return result;
 }
 
+uint32_t CaptureSettings::ParseUnsignedIntegerString(const std::string& value_string, uint32_t default_value)
+{
+    uint32_t result = default_value;
+
+    if (!value_string.empty())
+    {
+        // Check that the value string only contains numbers.
+        if (std::all_of(value_string.begin(), value_string.end(), ::isdigit) &&
+            (value_string.length() <= std::numeric_limits<uint32_t>::digits10))
+        {
+            result = static_cast<uint32_t>(std::stoul(value_string));
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Settings Loader: Ignoring invalid unsigned integer option value \"%s\"",
+                                 value_string.c_str());
+        }
+    }
+
+    return result;
+}
+
+int32_t CaptureSettings::ParseIntegerString(const std::string& value_string, int32_t default_value)
+{
+    int32_t result = default_value;
+
+    if (!value_string.empty())
+    {
+        // Check that the value string only contains numbers, with an optional sign.
+        size_t sign_length = ((value_string[0] == '-') || (value_string[0] == '+')) ? 1 : 0;
+
+        if ((value_string.length() > sign_length) &&
+            std::all_of(value_string.begin() + sign_length, value_string.end(), ::isdigit) &&
+            ((value_string.length() - sign_length) <= std::numeric_limits<int32_t>::digits10))
+        {
+            result = static_cast<int32_t>(std::stol(value_string));
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Settings Loader: Ignoring invalid integer option value \"%s\"", value_string.c_str());
+        }
+    }
+
+    return result;
+}
+
 CaptureSettings::MemoryTrackingMode
 CaptureSettings::ParseMemoryTrackingModeString(const std::string&                  value_string,
                                                CaptureSettings::MemoryTrackingMode default_value)
@@ -441,6 +823,14 @@ CaptureSettings::ParseMemoryTrackingModeString(const std::string&
     {
         result = MemoryTrackingMode::kPageGuard;
     }
+    else if (util::platform::StringCompareNoCase("userfaultfd", value_string.c_str()) == 0)
+    {
+        result = MemoryTrackingMode::kUserfaultfd;
+    }
+    else if (util::platform::StringCompareNoCase("soft_dirty", value_string.c_str()) == 0)
+    {
+        result = MemoryTrackingMode::kSoftDirty;
+    }
     else if (util::platform::StringCompareNoCase("assisted", value_string.c_str()) == 0)
     {
         result = MemoryTrackingMode::kAssisted;
@@ -26,6 +26,7 @@
 #define GFXRECON_ENCODE_CAPTURE_SETTINGS_H
 
 #include "format/format.h"
+#include "format/format_util.h"
 #include "util/logging.h"
 #include "util/page_guard_manager.h"
 
@@ -52,7 +53,16 @@ class CaptureSettings
         // Use guard pages to determine which regions of memory to write on unmap and queue submit.  This mode replaces
         // the mapped memory value returned by the driver with a shadow allocation that the capture layer can monitor
         // to determine which regions of memory have been modified by the application.
-        kPageGuard = 2
+        kPageGuard = 2,
+        // Use the page guard memory tracking infrastructure, detecting writes with userfaultfd write protection instead
+        // of guard pages.  Write faults are delivered to a handler thread instead of a signal handler.  Only available
+        // on Linux; falls back to kPageGuard behavior when userfaultfd write protection is not supported.
+        kUserfaultfd = 3,
+        // Use the page guard memory tracking infrastructure, detecting writes by scanning the soft-dirty page bits
+        // reported by /proc/self/pagemap instead of with guard pages, so that no faults are raised to the capture layer
+        // on application writes.  Only available on Linux; falls back to kPageGuard behavior when soft-dirty bits are
+        // not supported.
+        kSoftDirty = 4
     };
 
     struct TrimRange
@@ -65,22 +75,62 @@ class CaptureSettings
     {
         std::string            capture_file{ kDefaultCaptureFileName };
         format::EnabledOptions capture_file_options;
+        uint32_t               compression_threads{ 0 };
+        uint32_t               compression_batch_size{ 0 }; // Size in KiB, or 0 to compress blocks individually.
+        bool                   compact_headers{ false };    // Compact function call headers in compressed batches.
+        uint32_t               compression_budget{ 0 }; // Percent of time for adaptive compression, or 0 to disable.
+        int32_t                compression_level{ format::kDefaultCompressionLevel };
+        bool                   compression_long_distance{ false }; // Zstandard long distance matching.
+        uint32_t               compression_workers{ 0 };           // Zstandard worker threads for large blocks.
+        std::string            call_statistics_file;       // Per-API call overhead report, or empty to disable.
+        uint32_t               telemetry_port{ 0 };        // Local UDP port for overhead telemetry, or 0 to disable.
+        uint32_t               telemetry_interval{ 1000 }; // Milliseconds between telemetry samples.
         bool                   time_stamp_file{ true };
         bool                   force_flush{ false };
+        bool                   file_index{ true };
+        bool                   async_file_write{ false };
+        bool                   memory_mapped_file{ false };
+        bool                   io_uring_file_write{ false };
+        bool                   thread_segment_write{ false };
+        bool                   deduplicate_memory{ false };
+        bool                   deduplicate_shaders{ false }; // Write shader code and pipeline cache data once.
+        bool                   command_buffer_streams{ false }; // Write command blocks per command buffer recording.
+        bool                   cpu_timestamps{ false };         // Write the CPU time of queue submissions and presents.
+        bool                   handle_side_tables{ false };     // Return driver handles and look up their wrappers.
         MemoryTrackingMode     memory_tracking_mode{ kPageGuard };
+        uint32_t               memory_tracking_hash_block_size{ 0 }; // KiB per hashed block for unassisted, or 0.
         std::vector<TrimRange> trim_ranges;
         std::string            trim_key;
+        bool                   trim_content_cache{ false };
+        bool                   trim_optimize{ false };
+        bool                   trim_optimize_bda{ false }; // Identify buffers accessed through device addresses.
+        bool                   trim_pipeline_cache{ false }; // Write pipeline cache data to state snapshots.
+        bool                   trim_constant_content{ false }; // Write repeated resource content as a pattern.
+        bool                   trim_dormant{ false }; // Track only object state until trimming is first activated.
+        uint32_t               recorder_frames{ 0 };   // Frames kept by the flight recorder, or 0 to disable.
+        uint32_t               recorder_size{ 1024 };  // Size in MiB of flight recorder frame data, or 0 for no limit.
+        std::string            recorder_trigger;       // File that triggers a flight recorder capture.
+        uint32_t               segment_frames{ 0 };    // Frames per capture file segment, or 0 to disable.
+        uint32_t               segment_size{ 0 };      // Size in MiB per capture file segment, or 0 to disable.
         bool                   page_guard_copy_on_map{ util::PageGuardManager::kDefaultEnableCopyOnMap };
         bool                   page_guard_separate_read{ util::PageGuardManager::kDefaultEnableSeparateRead };
         bool                   page_guard_persistent_memory{ false };
         bool                   page_guard_align_buffer_sizes{ false };
+        bool                   page_guard_sub_page_diff{ util::PageGuardManager::kDefaultEnableSubPageDiff };
         bool                   page_guard_track_ahb_memory{ false };
+        uint32_t               page_guard_process_threads{ util::PageGuardManager::kDefaultProcessThreadCount };
+        bool                   page_guard_huge_pages{ util::PageGuardManager::kDefaultEnableHugePages };
 
         // An optimization for the page_guard memory tracking mode that eliminates the need for shadow memory by
         // overriding vkAllocateMemory so that all host visible allocations use the external memory extension with a
         // memory allocation that the capture layer can monitor to determine which regions of memory have been modified
         // by the application.
         bool page_guard_external_memory{ false };
+
+        // Selects external memory for the host visible allocations with memory types that support importing the memory
+        // allocated by the capture layer, and shadow memory for the others.  Ignored when page_guard_external_memory
+        // is enabled.
+        bool page_guard_auto_external_memory{ true };
     };
 
   public:
@@ -117,6 +167,10 @@ class CaptureSettings
 
     static bool ParseBoolString(const std::string& value_string, bool default_value);
 
+    static uint32_t ParseUnsignedIntegerString(const std::string& value_string, uint32_t default_value);
+
+    static int32_t ParseIntegerString(const std::string& value_string, int32_t default_value);
+
     static MemoryTrackingMode ParseMemoryTrackingModeString(const std::string& value_string,
                                                             MemoryTrackingMode default_value);
 
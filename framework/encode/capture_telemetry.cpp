@@ -0,0 +1,235 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/capture_telemetry.h"
+
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#if defined(WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+#if defined(WIN32)
+typedef SOCKET            SocketHandle;
+static const SocketHandle kInvalidSocket = INVALID_SOCKET;
+
+static void CloseSocket(SocketHandle socket)
+{
+    closesocket(socket);
+}
+#else
+typedef int               SocketHandle;
+static const SocketHandle kInvalidSocket = -1;
+
+static void CloseSocket(SocketHandle socket)
+{
+    close(socket);
+}
+#endif
+
+const uint32_t CaptureTelemetry::kDefaultInterval;
+
+CaptureTelemetry::CaptureTelemetry(uint16_t port, uint32_t interval, SampleFunction sample_function) :
+    port_(port), interval_((interval > 0) ? interval : kDefaultInterval), sample_function_(sample_function),
+    socket_(static_cast<uintptr_t>(kInvalidSocket)), bytes_written_(0), uncompressed_bytes_(0), compressed_bytes_(0),
+    frame_(0), shutdown_(false)
+{
+    assert(sample_function_ != nullptr);
+}
+
+CaptureTelemetry::~CaptureTelemetry()
+{
+    Stop();
+}
+
+bool CaptureTelemetry::Start()
+{
+#if defined(WIN32)
+    WSADATA wsa_data;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to initialize Windows Sockets for capture telemetry");
+        return false;
+    }
+#endif
+
+    SocketHandle udp_socket = socket(AF_INET, SOCK_DGRAM, 0);
+
+    if (udp_socket == kInvalidSocket)
+    {
+        GFXRECON_LOG_ERROR("Failed to create the capture telemetry socket");
+#if defined(WIN32)
+        WSACleanup();
+#endif
+        return false;
+    }
+
+    socket_ = static_cast<uintptr_t>(udp_socket);
+    thread_ = std::thread(&CaptureTelemetry::PublishSamples, this);
+
+    GFXRECON_LOG_INFO("Publishing capture telemetry to 127.0.0.1:%u every %u ms", port_, interval_);
+
+    return true;
+}
+
+void CaptureTelemetry::Stop()
+{
+    if (thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shutdown_ = true;
+        }
+
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    if (static_cast<SocketHandle>(socket_) != kInvalidSocket)
+    {
+        CloseSocket(static_cast<SocketHandle>(socket_));
+        socket_ = static_cast<uintptr_t>(kInvalidSocket);
+
+#if defined(WIN32)
+        WSACleanup();
+#endif
+    }
+}
+
+std::unique_ptr<util::Compressor> CaptureTelemetry::WrapCompressor(std::unique_ptr<util::Compressor> compressor,
+                                                                   CaptureTelemetry*                 telemetry)
+{
+    if ((compressor != nullptr) && (telemetry != nullptr))
+    {
+        return std::make_unique<TelemetryCompressor>(std::move(compressor), telemetry);
+    }
+
+    return compressor;
+}
+
+void CaptureTelemetry::PublishSamples()
+{
+    const int64_t start_time          = util::datetime::GetTimestamp();
+    int64_t       previous_time       = start_time;
+    uint64_t      previous_written    = 0;
+    uint64_t      previous_compressed = 0;
+    uint64_t      previous_input      = 0;
+    uint64_t      previous_faults     = 0;
+    uint32_t      previous_frame      = frame_.load(std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!wake_.wait_for(lock, std::chrono::milliseconds(interval_), [this]() { return shutdown_; }))
+    {
+        lock.unlock();
+
+        Sample sample;
+        sample_function_(&sample);
+
+        int64_t  time       = util::datetime::GetTimestamp();
+        uint64_t written    = bytes_written_.load(std::memory_order_relaxed);
+        uint64_t input      = uncompressed_bytes_.load(std::memory_order_relaxed);
+        uint64_t compressed = compressed_bytes_.load(std::memory_order_relaxed);
+        uint32_t frame      = frame_.load(std::memory_order_relaxed);
+        double   seconds    = util::datetime::ConvertTimestampToSeconds(time - previous_time);
+        uint32_t frames     = frame - previous_frame;
+
+        // Rates are computed over the interval since the previous sample.  The compression ratio is 0 when no data was
+        // compressed during the interval, and faults are reported for the interval when no frame ended.
+        double write_rate        = (seconds > 0.0) ? ((written - previous_written) / seconds) : 0.0;
+        double compression_ratio = (compressed > previous_compressed) ? (static_cast<double>(input - previous_input) /
+                                                                         (compressed - previous_compressed))
+                                                                      : 0.0;
+        double faults_per_frame =
+            static_cast<double>(sample.page_guard_faults - previous_faults) / ((frames > 0) ? frames : 1);
+
+        char line[1024];
+        snprintf(line,
+                 sizeof(line),
+                 "{\"time\":%.3f,\"frame\":%u,\"interval_frames\":%u,\"bytes_written\":%" PRIu64
+                 ",\"write_rate\":%.0f,\"writer_queue_bytes\":%" PRIu64 ",\"uncompressed_bytes\":%" PRIu64
+                 ",\"compressed_bytes\":%" PRIu64 ",\"compression_ratio\":%.3f,\"page_guard_faults\":%" PRIu64
+                 ",\"faults_per_frame\":%.1f,\"shadow_memory_bytes\":%" PRIu64 ",\"state_tracker_bytes\":%" PRIu64
+                 "}\n",
+                 util::datetime::ConvertTimestampToSeconds(time - start_time),
+                 frame,
+                 frames,
+                 written,
+                 write_rate,
+                 sample.writer_queue_bytes,
+                 input,
+                 compressed,
+                 compression_ratio,
+                 sample.page_guard_faults,
+                 faults_per_frame,
+                 sample.shadow_memory_bytes,
+                 sample.state_tracker_bytes);
+
+        SendSample(line);
+
+        previous_time       = time;
+        previous_written    = written;
+        previous_input      = input;
+        previous_compressed = compressed;
+        previous_faults     = sample.page_guard_faults;
+        previous_frame      = frame;
+
+        lock.lock();
+    }
+}
+
+void CaptureTelemetry::SendSample(const std::string& line)
+{
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons(port_);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    // Datagrams that are not received because no listener is present are dropped, which is not an error.
+    sendto(static_cast<SocketHandle>(socket_),
+           line.data(),
+           static_cast<int>(line.size()),
+           0,
+           reinterpret_cast<const struct sockaddr*>(&address),
+           sizeof(address));
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
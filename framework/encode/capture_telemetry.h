@@ -0,0 +1,208 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_CAPTURE_TELEMETRY_H
+#define GFXRECON_ENCODE_CAPTURE_TELEMETRY_H
+
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Live capture overhead counters, which a publisher thread samples at a fixed interval and sends to a local UDP port as
+// one line of JSON per sample, for the gfxrecon-telemetry.py tool or any other listener.  Datagrams are sent whether or
+// not a listener is present, so the capture never waits for the tool.
+//
+// Counters that are updated by the file writes and compression of API call data are accumulated by the telemetry
+// object, through the TelemetryOutputStream and TelemetryCompressor wrappers.  Counters that are owned by other
+// components are retrieved with the sample function, which is called from the publisher thread.
+class CaptureTelemetry
+{
+  public:
+    static const uint32_t kDefaultInterval = 1000; // Milliseconds.
+
+    // Counters that are retrieved from other components for each sample.
+    struct Sample
+    {
+        uint64_t writer_queue_bytes{ 0 };  // Data waiting for asynchronous writer or compression threads.
+        uint64_t page_guard_faults{ 0 };   // Total faults handled by the page guard manager.
+        uint64_t shadow_memory_bytes{ 0 }; // Page guard shadow memory.
+        uint64_t state_tracker_bytes{ 0 }; // Create parameters and command data stored by the state tracker.
+    };
+
+    typedef std::function<void(Sample*)> SampleFunction;
+
+  public:
+    // Samples are sent to 127.0.0.1:port.  The publisher thread is started by Start().
+    CaptureTelemetry(uint16_t port, uint32_t interval, SampleFunction sample_function);
+
+    // Stops the publisher thread.
+    ~CaptureTelemetry();
+
+    // Creates the socket and starts the publisher thread.  Returns false if the socket could not be created.
+    bool Start();
+
+    // Stops the publisher thread, after which the sample function is no longer called.
+    void Stop();
+
+    void AddBytesWritten(size_t size) { bytes_written_.fetch_add(size, std::memory_order_relaxed); }
+
+    void AddCompression(size_t uncompressed_size, size_t compressed_size)
+    {
+        uncompressed_bytes_.fetch_add(uncompressed_size, std::memory_order_relaxed);
+        compressed_bytes_.fetch_add(compressed_size, std::memory_order_relaxed);
+    }
+
+    void SetFrame(uint32_t frame) { frame_.store(frame, std::memory_order_relaxed); }
+
+    // Wraps a compressor with a TelemetryCompressor when telemetry is not null.
+    static std::unique_ptr<util::Compressor> WrapCompressor(std::unique_ptr<util::Compressor> compressor,
+                                                            CaptureTelemetry*                 telemetry);
+
+  private:
+    void PublishSamples();
+
+    void SendSample(const std::string& line);
+
+  private:
+    const uint16_t          port_;
+    const uint32_t          interval_;
+    SampleFunction          sample_function_;
+    uintptr_t               socket_;
+    std::atomic<uint64_t>   bytes_written_;
+    std::atomic<uint64_t>   uncompressed_bytes_;
+    std::atomic<uint64_t>   compressed_bytes_;
+    std::atomic<uint32_t>   frame_;
+    bool                    shutdown_;
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::thread             thread_;
+};
+
+// Output stream that adds the size of the data written to its target stream to the telemetry bytes written.
+class TelemetryOutputStream : public util::OutputStream
+{
+  public:
+    TelemetryOutputStream(std::unique_ptr<util::OutputStream> target, CaptureTelemetry* telemetry) :
+        target_(std::move(target)), telemetry_(telemetry)
+    {}
+
+    virtual ~TelemetryOutputStream() override {}
+
+    virtual bool IsValid() override { return target_->IsValid(); }
+
+    virtual void Reset() override { target_->Reset(); }
+
+    virtual size_t Write(const void* data, size_t len) override
+    {
+        size_t written = target_->Write(data, len);
+        telemetry_->AddBytesWritten(written);
+        return written;
+    }
+
+    virtual size_t WriteBuffers(const util::OutputBuffer* buffers, size_t count) override
+    {
+        size_t written = target_->WriteBuffers(buffers, count);
+        telemetry_->AddBytesWritten(written);
+        return written;
+    }
+
+    virtual void Flush() override { target_->Flush(); }
+
+    virtual uint64_t CopyFromFile(FILE* file, uint64_t offset, uint64_t size) override
+    {
+        uint64_t copied = target_->CopyFromFile(file, offset, size);
+        telemetry_->AddBytesWritten(static_cast<size_t>(copied));
+        return copied;
+    }
+
+  private:
+    std::unique_ptr<util::OutputStream> target_;
+    CaptureTelemetry*                   telemetry_;
+};
+
+// Compressor that adds the sizes of the data that it compresses to the telemetry compression counters.  Data that does
+// not compress is counted at its uncompressed size, as it is written without compression.
+class TelemetryCompressor : public util::Compressor
+{
+  public:
+    TelemetryCompressor(std::unique_ptr<util::Compressor> compressor, CaptureTelemetry* telemetry) :
+        compressor_(std::move(compressor)), telemetry_(telemetry)
+    {}
+
+    virtual ~TelemetryCompressor() override {}
+
+    using util::Compressor::Compress;
+    using util::Compressor::Decompress;
+
+    virtual size_t GetMaxCompressedSize(size_t uncompressed_size) const override
+    {
+        return compressor_->GetMaxCompressedSize(uncompressed_size);
+    }
+
+    virtual size_t Compress(const size_t   uncompressed_size,
+                            const uint8_t* uncompressed_data,
+                            const size_t   compressed_capacity,
+                            uint8_t*       compressed_data) override
+    {
+        size_t compressed_size =
+            compressor_->Compress(uncompressed_size, uncompressed_data, compressed_capacity, compressed_data);
+
+        bool compressed = (compressed_size > 0) && (compressed_size < uncompressed_size);
+        telemetry_->AddCompression(uncompressed_size, compressed ? compressed_size : uncompressed_size);
+
+        return compressed_size;
+    }
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   uncompressed_capacity,
+                              uint8_t*       uncompressed_data) override
+    {
+        return compressor_->Decompress(compressed_size, compressed_data, uncompressed_capacity, uncompressed_data);
+    }
+
+    virtual bool SetDictionary(const std::vector<uint8_t>& dictionary) override
+    {
+        return compressor_->SetDictionary(dictionary);
+    }
+
+  private:
+    std::unique_ptr<util::Compressor> compressor_;
+    CaptureTelemetry*                 telemetry_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_CAPTURE_TELEMETRY_H
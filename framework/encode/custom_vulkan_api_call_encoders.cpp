@@ -45,63 +45,63 @@ static const void* UnwrapDescriptorUpdateTemplateInfoHandles(const UpdateTemplat
                                                              const void*               data,
                                                              HandleUnwrapMemory*       unwrap_memory)
 {
-    if (info != nullptr)
+    if ((info != nullptr) && !HandleSideTables::IsEnabled())
     {
         uint8_t* unwrapped_data = unwrap_memory->GetBuffer(info->max_size);
         auto     bytes          = reinterpret_cast<const uint8_t*>(data);
 
         assert((unwrapped_data != nullptr) && (bytes != nullptr));
 
+        // Copy the descriptor data with the merged ranges of the template plan, then replace the handles.  The handles
+        // are read from the original data, so that descriptors which overlap in memory are not unwrapped twice.
+        for (const auto& range : info->copy_ranges)
+        {
+            memcpy(unwrapped_data + range.offset, bytes + range.offset, range.size);
+        }
+
         // Process VkDescriptorImageInfo
-        for (const auto& entry_info : info->image_info)
+        for (const auto& element : info->image_info_elements)
         {
-            for (size_t i = 0; i < entry_info.count; ++i)
+            auto entry           = reinterpret_cast<const VkDescriptorImageInfo*>(bytes + element.offset);
+            auto unwrapped_entry = reinterpret_cast<VkDescriptorImageInfo*>(unwrapped_data + element.offset);
+
+            if ((element.type == VK_DESCRIPTOR_TYPE_SAMPLER) ||
+                (element.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER))
             {
-                size_t offset          = entry_info.offset + (entry_info.stride * i);
-                auto   unwrapped_entry = reinterpret_cast<VkDescriptorImageInfo*>(unwrapped_data + offset);
+                unwrapped_entry->sampler = GetWrappedHandle<VkSampler>(entry->sampler);
+            }
 
-                memcpy(unwrapped_entry, bytes + offset, sizeof(VkDescriptorImageInfo));
-                UnwrapStructHandles(entry_info.type, unwrapped_entry, unwrap_memory);
+            if (element.type != VK_DESCRIPTOR_TYPE_SAMPLER)
+            {
+                unwrapped_entry->imageView = GetWrappedHandle<VkImageView>(entry->imageView);
             }
         }
 
         // Process VkDescriptorBufferInfo
-        for (const auto& entry_info : info->buffer_info)
+        for (size_t offset : info->buffer_info_offsets)
         {
-            for (size_t i = 0; i < entry_info.count; ++i)
-            {
-                size_t offset          = entry_info.offset + (entry_info.stride * i);
-                auto   unwrapped_entry = reinterpret_cast<VkDescriptorBufferInfo*>(unwrapped_data + offset);
+            auto entry           = reinterpret_cast<const VkDescriptorBufferInfo*>(bytes + offset);
+            auto unwrapped_entry = reinterpret_cast<VkDescriptorBufferInfo*>(unwrapped_data + offset);
 
-                memcpy(unwrapped_entry, bytes + offset, sizeof(VkDescriptorBufferInfo));
-                UnwrapStructHandles(unwrapped_entry, unwrap_memory);
-            }
+            unwrapped_entry->buffer = GetWrappedHandle<VkBuffer>(entry->buffer);
         }
 
         // Process VkBufferView
-        for (const auto& entry_info : info->texel_buffer_view)
+        for (size_t offset : info->texel_buffer_view_offsets)
         {
-            for (size_t i = 0; i < entry_info.count; ++i)
-            {
-                size_t offset          = entry_info.offset + (entry_info.stride * i);
-                auto   unwrapped_entry = reinterpret_cast<VkBufferView*>(unwrapped_data + offset);
-                auto   entry           = reinterpret_cast<const VkBufferView*>(bytes + offset);
+            auto entry           = reinterpret_cast<const VkBufferView*>(bytes + offset);
+            auto unwrapped_entry = reinterpret_cast<VkBufferView*>(unwrapped_data + offset);
 
-                *unwrapped_entry = GetWrappedHandle<VkBufferView>(*entry);
-            }
+            *unwrapped_entry = GetWrappedHandle<VkBufferView>(*entry);
         }
 
         // Process VkAccelerationStructureKHR
-        for (const auto& entry_info : info->acceleration_structure_khr)
+        for (size_t offset : info->acceleration_structure_khr_offsets)
         {
-            for (size_t i = 0; i < entry_info.count; ++i)
-            {
-                size_t offset          = entry_info.offset + (entry_info.stride * i);
-                auto   unwrapped_entry = reinterpret_cast<VkAccelerationStructureKHR*>(unwrapped_data + offset);
-                auto   entry           = reinterpret_cast<const VkAccelerationStructureKHR*>(bytes + offset);
+            auto entry           = reinterpret_cast<const VkAccelerationStructureKHR*>(bytes + offset);
+            auto unwrapped_entry = reinterpret_cast<VkAccelerationStructureKHR*>(unwrapped_data + offset);
 
-                *unwrapped_entry = GetWrappedHandle<VkAccelerationStructureKHR>(*entry);
-            }
+            *unwrapped_entry = GetWrappedHandle<VkAccelerationStructureKHR>(*entry);
         }
 
         return unwrapped_data;
@@ -132,39 +132,27 @@ static void EncodeDescriptorUpdateTemplateInfo(TraceManager*             manager
         encoder->EncodeSizeTValue(info->buffer_info_count);
         encoder->EncodeSizeTValue(info->texel_buffer_view_count);
 
-        // Write the individual template update entries, sorted by type, as tightly packed arrays.
+        // Write the individual template update entries, sorted by type, as tightly packed arrays, using the flattened
+        // descriptor offsets of the template plan.
         const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+
         // Process VkDescriptorImageInfo
-        for (const auto& entry_info : info->image_info)
+        for (const auto& element : info->image_info_elements)
         {
-            for (size_t i = 0; i < entry_info.count; ++i)
-            {
-                size_t                       offset = entry_info.offset + (entry_info.stride * i);
-                const VkDescriptorImageInfo* entry  = reinterpret_cast<const VkDescriptorImageInfo*>(bytes + offset);
-                EncodeStruct(encoder, entry_info.type, (*entry));
-            }
+            auto entry = reinterpret_cast<const VkDescriptorImageInfo*>(bytes + element.offset);
+            EncodeStruct(encoder, element.type, (*entry));
         }
 
         // Process VkDescriptorBufferInfo
-        for (const auto& entry_info : info->buffer_info)
+        for (size_t offset : info->buffer_info_offsets)
         {
-            for (size_t i = 0; i < entry_info.count; ++i)
-            {
-                size_t                        offset = entry_info.offset + (entry_info.stride * i);
-                const VkDescriptorBufferInfo* entry  = reinterpret_cast<const VkDescriptorBufferInfo*>(bytes + offset);
-                EncodeStruct(encoder, (*entry));
-            }
+            EncodeStruct(encoder, *reinterpret_cast<const VkDescriptorBufferInfo*>(bytes + offset));
         }
 
         // Process VkBufferView
-        for (const auto& entry_info : info->texel_buffer_view)
+        for (size_t offset : info->texel_buffer_view_offsets)
         {
-            for (size_t i = 0; i < entry_info.count; ++i)
-            {
-                size_t              offset = entry_info.offset + (entry_info.stride * i);
-                const VkBufferView* entry  = reinterpret_cast<const VkBufferView*>(bytes + offset);
-                encoder->EncodeHandleValue(*entry);
-            }
+            encoder->EncodeHandleValue(*reinterpret_cast<const VkBufferView*>(bytes + offset));
         }
 
         // Process VkAccelerationStructureKHR. This data is optional in the capture file, and must come after the
@@ -173,15 +161,10 @@ static void EncodeDescriptorUpdateTemplateInfo(TraceManager*             manager
         {
             encoder->EncodeSizeTValue(info->acceleration_structure_khr_count);
             encoder->EncodeEnumValue(VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR);
-            for (const auto& entry_info : info->acceleration_structure_khr)
+
+            for (size_t offset : info->acceleration_structure_khr_offsets)
             {
-                for (size_t i = 0; i < entry_info.count; ++i)
-                {
-                    size_t                            offset = entry_info.offset + (entry_info.stride * i);
-                    const VkAccelerationStructureKHR* entry =
-                        reinterpret_cast<const VkAccelerationStructureKHR*>(bytes + offset);
-                    encoder->EncodeHandleValue(*entry);
-                }
+                encoder->EncodeHandleValue(*reinterpret_cast<const VkAccelerationStructureKHR*>(bytes + offset));
             }
         }
     }
@@ -37,7 +37,7 @@ static const VkDescriptorImageInfo* UnwrapDescriptorImageInfoStructArrayHandles(
 {
     assert(unwrap_memory != nullptr);
 
-    if ((values != nullptr) && (len > 0))
+    if ((values != nullptr) && (len > 0) && !HandleSideTables::IsEnabled())
     {
         const uint8_t* bytes     = reinterpret_cast<const uint8_t*>(values);
         size_t         num_bytes = len * sizeof(values[0]);
@@ -42,6 +42,20 @@ struct UpdateTemplateEntryInfo
     VkDescriptorType type;
 };
 
+// Offset and type of a single descriptor in the update template data.
+struct UpdateTemplateElement
+{
+    size_t           offset;
+    VkDescriptorType type;
+};
+
+// Range of the update template data that is read by the driver, merged from adjacent descriptors.
+struct UpdateTemplateRange
+{
+    size_t offset;
+    size_t size;
+};
+
 struct UpdateTemplateInfo
 {
     // The counts are the sum of the total descriptorCount for each update template entry type. When written to the
@@ -58,6 +72,15 @@ struct UpdateTemplateInfo
     std::vector<UpdateTemplateEntryInfo> buffer_info;
     std::vector<UpdateTemplateEntryInfo> texel_buffer_view;
     std::vector<UpdateTemplateEntryInfo> acceleration_structure_khr;
+
+    // Plan compiled from the entries when the template is created, with the descriptors of each type flattened in
+    // encoding order and the merged ranges of data to copy when unwrapping handles, so that each template update is
+    // processed with one loop per descriptor type.
+    std::vector<UpdateTemplateElement> image_info_elements;
+    std::vector<size_t>                buffer_info_offsets;
+    std::vector<size_t>                texel_buffer_view_offsets;
+    std::vector<size_t>                acceleration_structure_khr_offsets;
+    std::vector<UpdateTemplateRange>   copy_ranges;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -0,0 +1,117 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/fill_memory_deduplicator.h"
+
+#include "util/hash.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+FillMemoryDeduplicator::FillMemoryDeduplicator(size_t max_entries, size_t max_data_size) :
+    max_entries_(max_entries), max_data_size_(max_data_size), data_size_(0), fill_memory_count_(0)
+{
+    assert(max_entries_ > 0);
+}
+
+FillMemoryDeduplicator::~FillMemoryDeduplicator() {}
+
+bool FillMemoryDeduplicator::ProcessFillMemory(const void* data, size_t size, uint64_t* source_index)
+{
+    assert(source_index != nullptr);
+
+    bool found = false;
+
+    if (size >= kMinDataSize)
+    {
+        uint64_t hash  = util::hash::ContentHash64(data, size);
+        auto     entry = entries_.find(hash);
+
+        if ((entry != entries_.end()) && (entry->second.data.size() == size) &&
+            (std::memcmp(entry->second.data.data(), data, size) == 0))
+        {
+            found           = true;
+            (*source_index) = entry->second.index;
+
+            lru_list_.splice(lru_list_.begin(), lru_list_, entry->second.lru_position);
+        }
+        else
+        {
+            if (entry != entries_.end())
+            {
+                // Hash collision with a different payload; replace the old entry.
+                RemoveEntry(entry);
+            }
+
+            if (size <= max_data_size_)
+            {
+                while (!lru_list_.empty() &&
+                       ((entries_.size() >= max_entries_) || ((data_size_ + size) > max_data_size_)))
+                {
+                    RemoveEntry(entries_.find(lru_list_.back()));
+                }
+
+                auto bytes = static_cast<const uint8_t*>(data);
+
+                lru_list_.push_front(hash);
+
+                Entry& new_entry = entries_[hash];
+
+                new_entry.data.assign(bytes, bytes + size);
+                new_entry.index        = fill_memory_count_;
+                new_entry.lru_position = lru_list_.begin();
+
+                data_size_ += size;
+            }
+        }
+    }
+
+    if (!found)
+    {
+        ++fill_memory_count_;
+    }
+
+    return found;
+}
+
+void FillMemoryDeduplicator::Reset()
+{
+    data_size_         = 0;
+    fill_memory_count_ = 0;
+    entries_.clear();
+    lru_list_.clear();
+}
+
+void FillMemoryDeduplicator::RemoveEntry(EntryMap::iterator entry)
+{
+    assert(entry != entries_.end());
+
+    data_size_ -= entry->second.data.size();
+    lru_list_.erase(entry->second.lru_position);
+    entries_.erase(entry);
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,96 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_FILL_MEMORY_DEDUPLICATOR_H
+#define GFXRECON_ENCODE_FILL_MEMORY_DEDUPLICATOR_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Identifies fill memory command payloads with the same content as the payload of a previous kFillMemoryCommand block.
+// Fill memory commands are identified by their zero-based index, in file order, of the kFillMemoryCommand blocks written
+// to the capture file.  A bounded cache maps payload hash values to a copy of the payload and the index of the most
+// recent command to write it, evicting the least recently used entries when full.  The copy is compared with the data
+// of a matching hash, so that a hash collision is never written as a reference to a different payload.
+//
+// The lock returned by GetMutex() must be held when calling ProcessFillMemory() and while writing the corresponding
+// command to the capture file, so that the command indices match the order that commands are written to the file.
+class FillMemoryDeduplicator
+{
+  public:
+    static const size_t kDefaultMaxEntries  = 65536;
+    static const size_t kDefaultMaxDataSize = 64 * 1024 * 1024; // Total size of the payload copies.
+
+    // Payloads smaller than this are not large enough to benefit from replacing the data with a reference.
+    static const size_t kMinDataSize = 256;
+
+  public:
+    FillMemoryDeduplicator(size_t max_entries = kDefaultMaxEntries, size_t max_data_size = kDefaultMaxDataSize);
+
+    ~FillMemoryDeduplicator();
+
+    std::mutex& GetMutex() { return mutex_; }
+
+    // Returns true and sets source_index to the index of a previous kFillMemoryCommand block with the same content when
+    // one is found.  Otherwise, returns false and records the data as the payload of the next kFillMemoryCommand block,
+    // which the caller must write.
+    bool ProcessFillMemory(const void* data, size_t size, uint64_t* source_index);
+
+    // Clears the cache when starting a new capture file.
+    void Reset();
+
+  private:
+    struct Entry
+    {
+        std::vector<uint8_t>          data;
+        uint64_t                      index;
+        std::list<uint64_t>::iterator lru_position;
+    };
+
+    typedef std::unordered_map<uint64_t, Entry> EntryMap;
+
+  private:
+    void RemoveEntry(EntryMap::iterator entry);
+
+  private:
+    size_t                              max_entries_;
+    size_t                              max_data_size_;
+    size_t                              data_size_; // Total size of the payload copies in the cache.
+    uint64_t                            fill_memory_count_;
+    EntryMap                            entries_;
+    std::list<uint64_t>                 lru_list_; // Hash values ordered from most to least recently used.
+    std::mutex                          mutex_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_FILL_MEMORY_DEDUPLICATOR_H
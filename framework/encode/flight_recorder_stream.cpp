@@ -0,0 +1,122 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/flight_recorder_stream.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+FlightRecorderStream::FlightRecorderStream(uint32_t frame_count, size_t max_size) :
+    frame_count_(frame_count), max_size_(max_size)
+{
+    assert(frame_count_ > 0);
+}
+
+FlightRecorderStream::~FlightRecorderStream() {}
+
+size_t FlightRecorderStream::Write(const void* data, size_t len)
+{
+    util::OutputBuffer buffer = { data, len };
+    return WriteBuffers(&buffer, 1);
+}
+
+size_t FlightRecorderStream::WriteBuffers(const util::OutputBuffer* buffers, size_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    assert(!segments_.empty());
+
+    std::vector<uint8_t>& segment_data = segments_.back().data;
+    size_t                written      = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(buffers[i].data);
+        segment_data.insert(segment_data.end(), bytes, bytes + buffers[i].size);
+        written += buffers[i].size;
+    }
+
+    return written;
+}
+
+void FlightRecorderStream::BeginSegment()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // The previous segment remains available to provide the requested number of frames until the new segment has
+    // recorded them.
+    while (segments_.size() > 1)
+    {
+        segments_.pop_front();
+    }
+
+    segments_.emplace_back();
+}
+
+void FlightRecorderStream::EndSegmentState()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    assert(!segments_.empty());
+
+    Segment& segment   = segments_.back();
+    segment.state_size = segment.data.size();
+}
+
+bool FlightRecorderStream::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    assert(!segments_.empty());
+
+    Segment& segment = segments_.back();
+    ++segment.frame_count;
+
+    return (segment.frame_count >= frame_count_) ||
+           ((max_size_ > 0) && ((segment.data.size() - segment.state_size) > (max_size_ / 2)));
+}
+
+uint32_t FlightRecorderStream::WriteFrames(util::OutputStream* target)
+{
+    assert(target != nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    uint32_t frames_written = 0;
+    bool     write_state    = true;
+
+    for (const auto& segment : segments_)
+    {
+        size_t offset = write_state ? 0 : segment.state_size;
+        target->Write(segment.data.data() + offset, segment.data.size() - offset);
+
+        frames_written += segment.frame_count;
+        write_state = false;
+    }
+
+    return frames_written;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,89 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_FLIGHT_RECORDER_STREAM_H
+#define GFXRECON_ENCODE_FLIGHT_RECORDER_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Output stream that keeps the most recently captured frames in memory, so that they can be written to a capture file
+// on demand.  Data is recorded in segments, where each segment starts with a state snapshot and is followed by the
+// blocks for the frames captured after the snapshot.  A new segment is started when the current segment contains the
+// requested number of frames, or when the frame data for the current segment exceeds half of the size budget, at which
+// point the oldest segment is released.  Segments other than the oldest are written without their state snapshots,
+// so written captures contain between one and two segments of frames.  Data written to the stream must consist of
+// complete blocks.
+class FlightRecorderStream : public util::OutputStream
+{
+  public:
+    // The size budget applies to frame data and does not include state snapshots.  A max_size of 0 disables the budget.
+    FlightRecorderStream(uint32_t frame_count, size_t max_size);
+
+    virtual ~FlightRecorderStream() override;
+
+    virtual bool IsValid() override { return true; }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual size_t WriteBuffers(const util::OutputBuffer* buffers, size_t count) override;
+
+    // Starts a new segment.  The state snapshot for the segment is written to the stream between the BeginSegment()
+    // and EndSegmentState() calls.
+    void BeginSegment();
+
+    void EndSegmentState();
+
+    // Records the end of a frame.  Returns true when a new segment should be started.
+    bool EndFrame();
+
+    // Writes the state snapshot of the oldest segment and the frames of all segments to the target stream.  Returns the
+    // number of frames written.
+    uint32_t WriteFrames(util::OutputStream* target);
+
+  private:
+    struct Segment
+    {
+        std::vector<uint8_t> data;
+        size_t               state_size{ 0 };
+        uint32_t             frame_count{ 0 };
+    };
+
+  private:
+    uint32_t            frame_count_;
+    size_t              max_size_;
+    std::deque<Segment> segments_;
+    std::mutex          mutex_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_FLIGHT_RECORDER_STREAM_H
@@ -0,0 +1,312 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/parallel_compression_stream.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+ParallelCompressionStream::ParallelCompressionStream(std::unique_ptr<util::OutputStream> target,
+                                                     format::CompressionType             compression_type,
+                                                     const format::CompressorOptions&    compressor_options,
+                                                     uint32_t                            thread_count,
+                                                     size_t                              max_pending_size,
+                                                     CaptureTelemetry*                   telemetry) :
+    target_(std::move(target)),
+    compression_type_(compression_type), compressor_options_(compressor_options), max_pending_size_(max_pending_size),
+    telemetry_(telemetry), pending_size_(0), next_sequence_(0), next_write_sequence_(0), shutdown_(false),
+    write_failed_(false)
+{
+    assert(target_ != nullptr);
+    assert(thread_count > 0);
+
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        compress_threads_.emplace_back(&ParallelCompressionStream::CompressBlocks, this);
+    }
+
+    write_thread_ = std::thread(&ParallelCompressionStream::WriteBlocks, this);
+}
+
+ParallelCompressionStream::~ParallelCompressionStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    compress_ready_.notify_all();
+    write_ready_.notify_all();
+
+    for (auto& thread : compress_threads_)
+    {
+        thread.join();
+    }
+
+    write_thread_.join();
+
+    target_->Flush();
+}
+
+size_t ParallelCompressionStream::Write(const void* data, size_t len)
+{
+    util::OutputBuffer buffer = { data, len };
+    return WriteBuffers(&buffer, 1);
+}
+
+size_t ParallelCompressionStream::WriteBuffers(const util::OutputBuffer* buffers, size_t count)
+{
+    size_t len = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        len += buffers[i].size;
+    }
+
+    if (len > 0)
+    {
+        Block block;
+        block.data.reserve(len);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(buffers[i].data);
+            block.data.insert(block.data.end(), bytes, bytes + buffers[i].size);
+        }
+
+        Submit(std::move(block));
+    }
+
+    return len;
+}
+
+void ParallelCompressionStream::Flush()
+{
+    Block block;
+    block.flush = true;
+
+    Submit(std::move(block));
+}
+
+void ParallelCompressionStream::WriteFunctionCall(format::ApiCallId call_id,
+                                                  format::ThreadId  thread_id,
+                                                  const void*       block_data,
+                                                  size_t            block_size)
+{
+    assert(block_size >= sizeof(format::FunctionCallHeader));
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(block_data);
+
+    Block block;
+    block.compress  = true;
+    block.call_id   = call_id;
+    block.thread_id = thread_id;
+    block.data.assign(bytes, bytes + block_size);
+
+    Submit(std::move(block));
+}
+
+size_t ParallelCompressionStream::GetPendingSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_size_;
+}
+
+void ParallelCompressionStream::Submit(Block&& block)
+{
+    size_t block_size = block.data.size();
+    bool   compress   = block.compress;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // Blocks larger than the pending limit are allowed when nothing is pending, to avoid blocking forever.
+        space_available_.wait(
+            lock, [&]() { return (pending_size_ == 0) || ((pending_size_ + block_size) <= max_pending_size_); });
+
+        pending_size_ += block_size;
+
+        block.sequence       = next_sequence_++;
+        block.submitted_size = block_size;
+
+        if (compress)
+        {
+            compress_queue_.emplace_back(std::move(block));
+        }
+        else
+        {
+            // Blocks that do not require compression go directly to the write queue.
+            uint64_t sequence      = block.sequence;
+            write_queue_[sequence] = std::move(block);
+        }
+    }
+
+    if (compress)
+    {
+        compress_ready_.notify_one();
+    }
+    else
+    {
+        write_ready_.notify_one();
+    }
+}
+
+void ParallelCompressionStream::CompressBlocks()
+{
+    std::unique_ptr<util::Compressor> compressor = CaptureTelemetry::WrapCompressor(
+        std::unique_ptr<util::Compressor>(format::CreateCompressor(compression_type_, compressor_options_)),
+        telemetry_);
+    std::vector<uint8_t>              compressed_buffer;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+        compress_ready_.wait(lock, [&]() { return shutdown_ || !compress_queue_.empty(); });
+
+        if (compress_queue_.empty())
+        {
+            break;
+        }
+
+        Block block = std::move(compress_queue_.front());
+        compress_queue_.pop_front();
+
+        lock.unlock();
+
+        BuildFunctionCallBlock(compressor.get(), &block, &compressed_buffer);
+
+        lock.lock();
+
+        uint64_t sequence      = block.sequence;
+        write_queue_[sequence] = std::move(block);
+
+        if (sequence == next_write_sequence_)
+        {
+            write_ready_.notify_one();
+        }
+    }
+}
+
+void ParallelCompressionStream::WriteBlocks()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+        write_ready_.wait(lock, [&]() {
+            return (shutdown_ && (next_write_sequence_ == next_sequence_)) ||
+                   (write_queue_.find(next_write_sequence_) != write_queue_.end());
+        });
+
+        auto entry = write_queue_.find(next_write_sequence_);
+        if (entry == write_queue_.end())
+        {
+            // Shutdown was requested and all submitted blocks have been written.
+            break;
+        }
+
+        Block block = std::move(entry->second);
+        write_queue_.erase(entry);
+
+        lock.unlock();
+
+        if (block.flush)
+        {
+            target_->Flush();
+        }
+        else
+        {
+            size_t written = target_->Write(block.data.data(), block.data.size());
+            if ((written != block.data.size()) && !write_failed_)
+            {
+                // Only report the first failure, as all subsequent writes are likely to fail for the same reason.
+                write_failed_ = true;
+                GFXRECON_LOG_ERROR("Write to capture file failed; capture file will be incomplete");
+            }
+        }
+
+        lock.lock();
+
+        ++next_write_sequence_;
+
+        // The pending size tracks the size of the submitted data, which may differ from the compressed block size.
+        pending_size_ -= block.submitted_size;
+
+        space_available_.notify_all();
+    }
+}
+
+void ParallelCompressionStream::BuildFunctionCallBlock(util::Compressor*     compressor,
+                                                       Block*                block,
+                                                       std::vector<uint8_t>* compressed_buffer)
+{
+    assert((block != nullptr) && (compressed_buffer != nullptr));
+
+    const size_t   uncompressed_header_size = sizeof(format::FunctionCallHeader);
+    const size_t   uncompressed_size        = block->data.size() - uncompressed_header_size;
+    const uint8_t* uncompressed_data        = block->data.data() + uncompressed_header_size;
+    bool           not_compressed           = true;
+
+    if (compressor != nullptr)
+    {
+        size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
+        size_t compressed_size =
+            compressor->Compress(uncompressed_size, uncompressed_data, compressed_buffer, header_size);
+
+        if ((0 < compressed_size) && (compressed_size < uncompressed_size))
+        {
+            auto compressed_header = reinterpret_cast<format::CompressedFunctionCallHeader*>(compressed_buffer->data());
+            compressed_header->block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+            compressed_header->api_call_id       = block->call_id;
+            compressed_header->thread_id         = block->thread_id;
+            compressed_header->uncompressed_size = uncompressed_size;
+            compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
+                                                   sizeof(compressed_header->thread_id) +
+                                                   sizeof(compressed_header->uncompressed_size) + compressed_size;
+
+            // Swap the compressed data into the block, keeping the uncompressed buffer for the next compression.
+            compressed_buffer->resize(header_size + compressed_size);
+            block->data.swap(*compressed_buffer);
+
+            not_compressed = false;
+        }
+    }
+
+    if (not_compressed)
+    {
+        auto uncompressed_header               = reinterpret_cast<format::FunctionCallHeader*>(block->data.data());
+        uncompressed_header->block_header.type = format::BlockType::kFunctionCallBlock;
+        uncompressed_header->api_call_id       = block->call_id;
+        uncompressed_header->thread_id         = block->thread_id;
+        uncompressed_header->block_header.size =
+            sizeof(uncompressed_header->api_call_id) + sizeof(uncompressed_header->thread_id) + uncompressed_size;
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
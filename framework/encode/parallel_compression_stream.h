@@ -0,0 +1,130 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_PARALLEL_COMPRESSION_STREAM_H
+#define GFXRECON_ENCODE_PARALLEL_COMPRESSION_STREAM_H
+
+#include "encode/capture_telemetry.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Output stream that compresses function call blocks on a pool of worker threads.  Every block submitted to the stream
+// is assigned a sequence number, and blocks are written to the target stream by a dedicated writer thread in sequence
+// order, so the file contents match what would have been written by compressing and writing each block inline.
+// Blocks written with Write() are passed through to the target stream without compression.
+class ParallelCompressionStream : public util::OutputStream
+{
+  public:
+    static const size_t kDefaultMaxPendingSize = 64 * 1024 * 1024;
+
+  public:
+    // Each worker thread creates its own compressor for the specified compression type and options.  When telemetry is
+    // not null, the sizes of the compressed blocks are added to its compression counters.
+    ParallelCompressionStream(std::unique_ptr<util::OutputStream> target,
+                              format::CompressionType             compression_type,
+                              const format::CompressorOptions&    compressor_options,
+                              uint32_t                            thread_count,
+                              size_t                              max_pending_size = kDefaultMaxPendingSize,
+                              CaptureTelemetry*                   telemetry        = nullptr);
+
+    // Blocks until all pending blocks have been written to the target stream.
+    virtual ~ParallelCompressionStream() override;
+
+    virtual bool IsValid() override { return (target_ != nullptr) && target_->IsValid(); }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    // Buffers are combined into a single uncompressed block.
+    virtual size_t WriteBuffers(const util::OutputBuffer* buffers, size_t count) override;
+
+    // Requests a flush of the target stream after all previously submitted blocks have been written.
+    virtual void Flush() override;
+
+    // Submit a function call block for compression.  The block data must start with space for an uncompressed
+    // FunctionCallHeader, followed by the encoded parameter data.  The header will be initialized by the worker thread,
+    // which will write a compressed block if compression reduces the size of the parameter data.
+    void WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, const void* block, size_t block_size);
+
+    // Size of the blocks that have been submitted and not yet written to the target stream.
+    size_t GetPendingSize();
+
+  private:
+    struct Block
+    {
+        uint64_t             sequence{ 0 };
+        size_t               submitted_size{ 0 };
+        bool                 compress{ false };
+        bool                 flush{ false };
+        format::ApiCallId    call_id{ format::ApiCallId::ApiCall_Unknown };
+        format::ThreadId     thread_id{ 0 };
+        std::vector<uint8_t> data;
+    };
+
+  private:
+    void Submit(Block&& block);
+
+    void CompressBlocks();
+
+    void WriteBlocks();
+
+    void BuildFunctionCallBlock(util::Compressor* compressor, Block* block, std::vector<uint8_t>* compressed_buffer);
+
+  private:
+    std::unique_ptr<util::OutputStream> target_;
+    format::CompressionType             compression_type_;
+    format::CompressorOptions           compressor_options_;
+    size_t                              max_pending_size_;
+    CaptureTelemetry*                   telemetry_;
+    size_t                              pending_size_;
+    uint64_t                            next_sequence_;
+    uint64_t                            next_write_sequence_;
+    bool                                shutdown_;
+    bool                                write_failed_;
+    std::deque<Block>                   compress_queue_;
+    std::map<uint64_t, Block>           write_queue_;
+    std::mutex                          mutex_;
+    std::condition_variable             compress_ready_;
+    std::condition_variable             write_ready_;
+    std::condition_variable             space_available_;
+    std::vector<std::thread>            compress_threads_;
+    std::thread                         write_thread_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_PARALLEL_COMPRESSION_STREAM_H
@@ -24,10 +24,11 @@
 #ifndef GFXRECON_ENCODE_PARAMETER_ENCODER_H
 #define GFXRECON_ENCODE_PARAMETER_ENCODER_H
 
+#include "encode/blob_deduplicator.h"
 #include "encode/vulkan_handle_wrapper_util.h"
 #include "format/format.h"
 #include "util/defines.h"
-#include "util/output_stream.h"
+#include "util/memory_output_stream.h"
 #include "util/platform.h"
 
 #include "vulkan/vulkan.h"
@@ -40,13 +41,30 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
+// Identifies the structs with an encoded representation that is identical to their host memory, which can be encoded
+// as a single copy.  Specializations are generated for the structs that qualify.
+template <typename T>
+struct IsLayoutEncodable : std::false_type
+{};
+
 class ParameterEncoder
 {
   public:
-    ParameterEncoder(util::OutputStream* stream) : output_stream_(stream) {}
+    // The encoder writes to memory streams through their non-virtual Append() method, which the compiler can inline
+    // into the generated encoders.  The handle ID encoding must match the kHandleIdEncoding option of the file.
+    ParameterEncoder(util::MemoryOutputStream* stream,
+                     format::HandleIdEncoding  handle_id_encoding = format::HandleIdEncoding::kFixedHandleIds) :
+        output_stream_(stream),
+        varint_handle_ids_(handle_id_encoding == format::HandleIdEncoding::kVarintHandleIds),
+        blob_deduplicator_(nullptr)
+    {}
 
     ~ParameterEncoder() {}
 
+    // Arrays encoded with the Encode*BlobArray() methods are replaced by references to the blobs of the deduplicator.
+    // Set nullptr to encode the arrays with the API calls.
+    void SetBlobDeduplicator(BlobDeduplicator* deduplicator) { blob_deduplicator_ = deduplicator; }
+
     // clang-format off
 
     // Values
@@ -62,7 +80,7 @@ class ParameterEncoder
     void EncodeVkDeviceSizeValue(VkDeviceSize value)                                                                  { EncodeValue(static_cast<format::DeviceSizeEncodeType>(value)); }
     void EncodeVkDeviceAddressValue(VkDeviceAddress value)                                                            { EncodeValue(static_cast<format::DeviceSizeEncodeType>(value)); }
     void EncodeSizeTValue(size_t value)                                                                               { EncodeValue(static_cast<format::SizeTEncodeType>(value)); }
-    void EncodeHandleIdValue(format::HandleId value)                                                                  { EncodeValue(static_cast<format::HandleEncodeType>(value)); }
+    void EncodeHandleIdValue(format::HandleId value)                                                                  { EncodeHandleId(value); }
 
     // Encode the address values for pointers to non-Vulkan objects to be used as object IDs.
     void EncodeAddress(const void* value)                                                                             { EncodeValue(reinterpret_cast<format::AddressEncodeType>(value)); }
@@ -89,7 +107,7 @@ class ParameterEncoder
     void EncodeVkSampleMaskPtr(const VkSampleMask* ptr, bool omit_data = false, bool omit_addr = false)               { EncodePointerConverted<format::SampleMaskEncodeType>(ptr, omit_data, omit_addr); }
     void EncodeVkDeviceSizePtr(const VkDeviceSize* ptr, bool omit_data = false, bool omit_addr = false)               { EncodePointerConverted<format::DeviceSizeEncodeType>(ptr, omit_data, omit_addr); }
     void EncodeSizeTPtr(const size_t* ptr, bool omit_data = false, bool omit_addr = false)                            { EncodePointerConverted<format::SizeTEncodeType>(ptr, omit_data, omit_addr); }
-    void EncodeHandleIdPtr(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)               { EncodePointerConverted<format::HandleEncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeHandleIdPtr(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)               { EncodeHandleIdPointer(ptr, omit_data, omit_addr); }
 
     // Treat pointers to non-Vulkan objects as 64-bit object IDs.
     template<typename T>
@@ -115,12 +133,16 @@ class ParameterEncoder
     void EncodeVkDeviceSizeArray(const VkDeviceSize* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeArrayConverted<format::DeviceSizeEncodeType>(arr, len, omit_data, omit_addr); }
     void EncodeVkDeviceAddressArray(const VkDeviceAddress* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeArrayConverted<format::DeviceAddressEncodeType>(arr, len, omit_data, omit_addr); }
     void EncodeSizeTArray(const size_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)              { EncodeArrayConverted<format::SizeTEncodeType>(arr, len, omit_data, omit_addr); }
-    void EncodeHandleIdArray(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeArrayConverted<format::HandleEncodeType>(arr, len, omit_data, omit_addr); }
+    void EncodeHandleIdArray(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeHandleIdArrayData(arr, len, omit_data, omit_addr); }
 
     // Array of bytes.
     void EncodeUInt8Array(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)                { EncodeArray(reinterpret_cast<const uint8_t*>(arr), len, omit_data, omit_addr); }
     void EncodeVoidArray(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)                 { EncodeArray(reinterpret_cast<const uint8_t*>(arr), len, omit_data, omit_addr); }
 
+    // Large arrays of opaque data, such as shader code, that can be replaced by a reference to a deduplicated blob.
+    void EncodeUInt32BlobArray(const uint32_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)       { EncodeBlobArray(arr, len, omit_data, omit_addr); }
+    void EncodeVoidBlobArray(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)             { EncodeBlobArray(reinterpret_cast<const uint8_t*>(arr), len, omit_data, omit_addr); }
+
     template<typename T>
     void EncodeHandleArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                  { EncodeWrappedHandleArray(arr, len, omit_data, omit_addr); }
     template<typename T>
@@ -149,7 +171,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsSingle |
                                   GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
         {
@@ -162,7 +184,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsArray |
                                   GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -176,12 +198,15 @@ class ParameterEncoder
         }
     }
 
+    // Writes the memory of an array of structs with IsLayoutEncodable specializations, following its preamble.
+    void EncodeStructArrayData(const void* arr, size_t size) { output_stream_->Append(arr, size); }
+
     void EncodeStructArray2DPreamble(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)
     {
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsArray2D |
                                   GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -237,7 +262,50 @@ class ParameterEncoder
     template <typename T>
     void EncodeValue(T value)
     {
-        output_stream_->Write(&value, sizeof(T));
+        output_stream_->Append(&value, sizeof(T));
+    }
+
+    void EncodeVarint(uint64_t value)
+    {
+        uint8_t bytes[10];
+        size_t  count = 0;
+
+        while (value >= 0x80)
+        {
+            bytes[count++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+
+        bytes[count++] = static_cast<uint8_t>(value);
+        output_stream_->Append(bytes, count);
+    }
+
+    void EncodeHandleId(format::HandleId value)
+    {
+        if (varint_handle_ids_)
+        {
+            EncodeVarint(value);
+        }
+        else
+        {
+            EncodeValue(static_cast<format::HandleEncodeType>(value));
+        }
+    }
+
+    // Encodes an element of a handle ID array.  Varint handle IDs encode the zigzag difference from the previous
+    // element, which is small for the related objects that are usually passed together.
+    void EncodeHandleIdElement(format::HandleId value, format::HandleId* previous)
+    {
+        if (varint_handle_ids_)
+        {
+            uint64_t delta = value - *previous;
+            EncodeVarint((delta << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63));
+            *previous = value;
+        }
+        else
+        {
+            EncodeValue(static_cast<format::HandleEncodeType>(value));
+        }
     }
 
     template <typename T>
@@ -246,7 +314,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (ptr != nullptr)
         {
@@ -257,7 +325,7 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
-                output_stream_->Write(ptr, sizeof(T));
+                output_stream_->Append(ptr, sizeof(T));
             }
         }
     }
@@ -268,7 +336,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (ptr != nullptr)
         {
@@ -280,7 +348,28 @@ class ParameterEncoder
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
                 DstT converted = TypeCast<DstT>(*ptr);
-                output_stream_->Write(&converted, sizeof(DstT));
+                output_stream_->Append(&converted, sizeof(DstT));
+            }
+        }
+    }
+
+    void EncodeHandleIdPointer(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)
+    {
+        uint32_t pointer_attrib =
+            format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
+
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
+
+        if (ptr != nullptr)
+        {
+            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
+            {
+                EncodeAddress(ptr);
+            }
+
+            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
+            {
+                EncodeHandleId(*ptr);
             }
         }
     }
@@ -291,7 +380,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (ptr != nullptr)
         {
@@ -313,7 +402,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -327,11 +416,37 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
-                output_stream_->Write(arr, len * sizeof(T));
+                output_stream_->Append(arr, len * sizeof(T));
             }
         }
     }
 
+    template <typename T>
+    void EncodeBlobArray(const T* arr, size_t len, bool omit_data, bool omit_addr)
+    {
+        uint64_t blob_id = 0;
+
+        if ((blob_deduplicator_ == nullptr) || omit_data ||
+            !blob_deduplicator_->ProcessBlob(arr, len * sizeof(T), &blob_id))
+        {
+            EncodeArray(arr, len, omit_data, omit_addr);
+            return;
+        }
+
+        uint32_t pointer_attrib = format::PointerAttributes::kIsArray | format::PointerAttributes::kHasBlobId |
+                                  GetPointerAttributeMask(arr, true, omit_addr);
+
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
+
+        if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
+        {
+            EncodeAddress(arr);
+        }
+
+        EncodeSizeTValue(len);
+        EncodeUInt64Value(blob_id);
+    }
+
     // Perform a type conversion for array elements when the original type has a size that is not equal to the target
     // type for conversion.
     template <typename DstT, typename SrcT>
@@ -341,7 +456,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -355,10 +470,12 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
+                output_stream_->Reserve(len * sizeof(DstT));
+
                 for (size_t i = 0; i < len; ++i)
                 {
                     DstT converted = TypeCast<DstT>(arr[i]);
-                    output_stream_->Write(&converted, sizeof(DstT));
+                    output_stream_->Append(&converted, sizeof(DstT));
                 }
             }
         }
@@ -379,7 +496,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -393,9 +510,49 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
+                format::HandleId previous = format::kNullHandleId;
+
+                output_stream_->Reserve(len * sizeof(format::HandleEncodeType));
+
                 for (size_t i = 0; i < len; ++i)
                 {
-                    EncodeHandleValue(arr[i]);
+                    EncodeHandleIdElement(GetWrappedId(arr[i]), &previous);
+                }
+            }
+        }
+    }
+
+    void
+    EncodeHandleIdArrayData(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false)
+    {
+        if (!varint_handle_ids_)
+        {
+            EncodeArrayConverted<format::HandleEncodeType>(arr, len, omit_data, omit_addr);
+            return;
+        }
+
+        uint32_t pointer_attrib =
+            format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
+
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
+
+        if (arr != nullptr)
+        {
+            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
+            {
+                EncodeAddress(arr);
+            }
+
+            // Always write the array size when the pointer is not null.
+            EncodeSizeTValue(len);
+
+            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
+            {
+                format::HandleId previous = format::kNullHandleId;
+
+                for (size_t i = 0; i < len; ++i)
+                {
+                    EncodeHandleIdElement(arr[i], &previous);
                 }
             }
         }
@@ -408,7 +565,7 @@ class ParameterEncoder
         // Outer pointer attributes
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray2D | GetPointerAttributeMask(arr, omit_data, omit_addr);
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -429,7 +586,7 @@ class ParameterEncoder
                     // Inner pointer attributes
                     uint32_t inner_pointer_attrib =
                         format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr[i], omit_data, omit_addr);
-                    output_stream_->Write(&inner_pointer_attrib, sizeof(inner_pointer_attrib));
+                    output_stream_->Append(&inner_pointer_attrib, sizeof(inner_pointer_attrib));
 
                     // Inner array address
                     if ((inner_pointer_attrib & format::PointerAttributes::kHasAddress) ==
@@ -445,7 +602,7 @@ class ParameterEncoder
                     if ((inner_pointer_attrib & format::PointerAttributes::kHasData) ==
                         format::PointerAttributes::kHasData)
                     {
-                        output_stream_->Write(arr[i], size_2d[i] * sizeof(T));
+                        output_stream_->Append(arr[i], size_2d[i] * sizeof(T));
                     }
                 }
             }
@@ -456,17 +613,19 @@ class ParameterEncoder
     typename std::enable_if<sizeof(CharT) == sizeof(EncodeT), void>::type EncodeBasicStringConverted(const CharT* str,
                                                                                                      size_t       len)
     {
-        output_stream_->Write(str, len * sizeof(CharT));
+        output_stream_->Append(str, len * sizeof(CharT));
     }
 
     template <typename CharT, typename EncodeT>
     typename std::enable_if<sizeof(CharT) != sizeof(EncodeT), void>::type EncodeBasicStringConverted(const CharT* str,
                                                                                                      size_t       len)
     {
+        output_stream_->Reserve(len * sizeof(EncodeT));
+
         for (size_t i = 0; i < len; ++i)
         {
             EncodeT converted = TypeCast<EncodeT>(str[i]);
-            output_stream_->Write(&converted, sizeof(EncodeT));
+            output_stream_->Append(&converted, sizeof(EncodeT));
         }
     }
 
@@ -476,7 +635,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             EncodeAttrib | format::PointerAttributes::kIsSingle | GetPointerAttributeMask(str, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (str != nullptr)
         {
@@ -503,7 +662,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             EncodeAttrib | format::PointerAttributes::kIsArray | GetPointerAttributeMask(str, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (str != nullptr)
         {
@@ -526,7 +685,9 @@ class ParameterEncoder
     }
 
   private:
-    util::OutputStream* output_stream_;
+    util::MemoryOutputStream* output_stream_;
+    bool                      varint_handle_ids_;
+    BlobDeduplicator*         blob_deduplicator_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -44,6 +44,22 @@ void EncodeStructPtr(ParameterEncoder* encoder, const T* value, bool omit_data =
     }
 }
 
+template <typename T>
+void EncodeStructArrayElements(ParameterEncoder* encoder, const T* value, size_t len, std::false_type)
+{
+    for (size_t i = 0; i < len; ++i)
+    {
+        EncodeStruct(encoder, value[i]);
+    }
+}
+
+// Structs with an encoded representation that matches their host memory are written with a single copy.
+template <typename T>
+void EncodeStructArrayElements(ParameterEncoder* encoder, const T* value, size_t len, std::true_type)
+{
+    encoder->EncodeStructArrayData(value, len * sizeof(T));
+}
+
 template <typename T>
 void EncodeStructArray(
     ParameterEncoder* encoder, const T* value, size_t len, bool omit_data = false, bool omit_addr = false)
@@ -52,10 +68,7 @@ void EncodeStructArray(
 
     if ((value != nullptr) && (len > 0) && !omit_data)
     {
-        for (size_t i = 0; i < len; ++i)
-        {
-            EncodeStruct(encoder, value[i]);
-        }
+        EncodeStructArrayElements(encoder, value, len, IsLayoutEncodable<T>());
     }
 }
 
@@ -74,10 +87,7 @@ void EncodeStructArray2D(ParameterEncoder* encoder,
         for (size_t i = 0; i < m; ++i)
         {
             encoder->EncodeStructArrayPreamble(value[i], n, omit_data, omit_addr);
-            for (size_t j = 0; j < n; ++j)
-            {
-                EncodeStruct(encoder, value[i][j]);
-            }
+            EncodeStructArrayElements(encoder, value[i], n, IsLayoutEncodable<T>());
         }
     }
 }
@@ -98,10 +108,7 @@ typename std::enable_if<!std::is_integral<SizeT>::value>::type EncodeStructArray
         {
             const size_t inner_len = size_2d[i];
             encoder->EncodeStructArrayPreamble(value[i], inner_len, omit_data, omit_addr);
-            for (size_t j = 0; j < inner_len; ++j)
-            {
-                EncodeStruct(encoder, value[i][j]);
-            }
+            EncodeStructArrayElements(encoder, value[i], inner_len, IsLayoutEncodable<T>());
         }
     }
 }
@@ -26,18 +26,32 @@
 
 #include "encode/trace_manager.h"
 
+#include "encode/trim_file_assembler.h"
 #include "encode/vulkan_handle_wrapper_util.h"
 #include "encode/vulkan_state_writer.h"
 #include "format/format_util.h"
 #include "generated/generated_vulkan_struct_handle_wrappers.h"
 #include "graphics/vulkan_device_util.h"
+#include "util/async_output_stream.h"
 #include "util/compressor.h"
+#include "util/date_time.h"
+#include "util/file_output_stream.h"
 #include "util/file_path.h"
+#include "util/hash.h"
+#include "util/instrumentation.h"
 #include "util/logging.h"
+#include "util/mmap_output_stream.h"
+#include "util/network.h"
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
+#include "util/socket_output_stream.h"
+#include "util/thread_segment_output_stream.h"
+#include "util/uring_output_stream.h"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <map>
 #include <unordered_set>
 
 #if defined(__linux__) && !defined(__ANDROID__)
@@ -54,8 +68,11 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
 // One based frame count.
-const uint32_t kFirstFrame           = 1;
-const size_t   kFileStreamBufferSize = 256 * 1024;
+const uint32_t         kFirstFrame              = 1;
+const size_t           kFileStreamBufferSize    = 256 * 1024;
+const size_t           kSegmentIndexDigits      = 4;
+const format::HandleId kUniqueIdBlockSize       = 4096;
+const size_t           kHardwareBufferBlockSize = 64 * 1024;
 
 std::mutex                                     TraceManager::ThreadData::count_lock_;
 format::ThreadId                               TraceManager::ThreadData::thread_count_ = 0;
@@ -66,14 +83,28 @@ uint32_t                                               TraceManager::instance_co
 std::mutex                                             TraceManager::instance_lock_;
 thread_local std::unique_ptr<TraceManager::ThreadData> TraceManager::thread_data_;
 LayerTable                                             TraceManager::layer_table_;
-util::SharedMutex                                      TraceManager::state_mutex_;
+util::ScalableSharedMutex                              TraceManager::state_mutex_;
 
 std::atomic<format::HandleId> TraceManager::unique_id_counter_{ format::kNullHandleId };
 
-TraceManager::ThreadData::ThreadData() : thread_id_(GetThreadId()), call_id_(format::ApiCallId::ApiCall_Unknown)
+TraceManager::ThreadData::ThreadData() :
+    thread_id_(GetThreadId()), call_id_(format::ApiCallId::ApiCall_Unknown), call_begin_time_(0),
+    unique_id_next_(format::kNullHandleId), unique_id_end_(format::kNullHandleId)
 {
+    // The encoder must use the handle ID encoding of the capture file, which is set when the manager is initialized.
+    format::HandleIdEncoding handle_id_encoding = format::HandleIdEncoding::kFixedHandleIds;
+    if (instance_ != nullptr)
+    {
+        handle_id_encoding = instance_->file_options_.handle_id_encoding;
+    }
+
     parameter_buffer_  = std::make_unique<encode::ParameterBuffer>();
-    parameter_encoder_ = std::make_unique<ParameterEncoder>(parameter_buffer_.get());
+    parameter_encoder_ = std::make_unique<ParameterEncoder>(parameter_buffer_.get(), handle_id_encoding);
+
+    if (instance_ != nullptr)
+    {
+        parameter_encoder_->SetBlobDeduplicator(instance_->blob_deduplicator_.get());
+    }
 }
 
 format::ThreadId TraceManager::ThreadData::GetThreadId()
@@ -97,15 +128,49 @@ format::ThreadId TraceManager::ThreadData::GetThreadId()
     return id;
 }
 
+format::HandleId TraceManager::GetUniqueId()
+{
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    if (thread_data->unique_id_next_ == thread_data->unique_id_end_)
+    {
+        // Reserve a new block of IDs, so that the shared counter is only modified once per block.
+        thread_data->unique_id_next_ = unique_id_counter_.fetch_add(kUniqueIdBlockSize) + 1;
+        thread_data->unique_id_end_  = thread_data->unique_id_next_ + kUniqueIdBlockSize;
+    }
+
+    return thread_data->unique_id_next_++;
+}
+
 TraceManager::TraceManager() :
-    force_file_flush_(false), timestamp_filename_(true),
+    force_file_flush_(false), timestamp_filename_(true), async_file_write_(false), memory_mapped_file_(false),
+    io_uring_file_write_(false), thread_segment_write_(false), compression_threads_(0), compression_stream_(nullptr),
+    async_stream_(nullptr), compression_batch_size_(0), compact_headers_(false), batch_compression_stream_(nullptr),
+    flight_recorder_stream_(nullptr), command_buffer_streams_(false), cpu_timestamps_(false),
     memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard), page_guard_align_buffer_sizes_(false),
-    page_guard_track_ahb_memory_(false), page_guard_memory_mode_(kMemoryModeShadowInternal), trim_enabled_(false),
-    trim_current_range_(0), current_frame_(kFirstFrame), capture_mode_(kModeWrite), previous_hotkey_state_(false)
+    page_guard_track_ahb_memory_(false), page_guard_auto_external_memory_(false),
+    page_guard_memory_mode_(kMemoryModeShadowInternal), memory_hash_block_size_(0), trim_enabled_(false),
+    trim_optimize_(false), trim_optimize_bda_(false), trim_pipeline_cache_(false), trim_constant_content_(false),
+    trim_dormant_(false), unguarded_memory_(false), segment_frames_(0), segment_size_(0), segment_index_(0),
+    segment_first_frame_(0), segment_bytes_(0), file_index_(false), counting_stream_(nullptr), trim_current_range_(0),
+    current_frame_(kFirstFrame), capture_mode_(kModeWrite), previous_hotkey_state_(false)
 {}
 
 TraceManager::~TraceManager()
 {
+    if (telemetry_ != nullptr)
+    {
+        // Stop sampling before the streams and the page guard manager are destroyed.
+        telemetry_->Stop();
+    }
+
+    if (!trim_state_filename_.empty())
+    {
+        // Assemble the trimmed capture file for a trim range that was still active at shutdown.
+        DeactivateTrimming();
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
     {
         util::PageGuardManager::Destroy();
@@ -142,6 +207,8 @@ bool TraceManager::CreateInstance()
         util::Log::Release();
         util::Log::Init(settings.GetLogSettings());
 
+        GFXRECON_INSTRUMENT_INITIALIZE();
+
         // Load all settings with final logging settings active.
         CaptureSettings::LoadSettings(&settings);
 
@@ -194,6 +261,14 @@ void TraceManager::DestroyInstance()
 
         if (instance_count_ == 0)
         {
+            if (instance_->call_statistics_ != nullptr)
+            {
+                instance_->call_statistics_->WriteReport(instance_->call_statistics_file_);
+            }
+
+            // Complete the capture file that is still open with its seek index.
+            instance_->WriteSeekIndex();
+
             delete instance_;
             instance_ = nullptr;
 
@@ -211,7 +286,7 @@ void TraceManager::InitInstance(VkInstance* instance, PFN_vkGetInstanceProcAddr
     CreateWrappedHandle<NoParentWrapper, NoParentWrapper, InstanceWrapper>(
         NoParentWrapper::kHandleValue, NoParentWrapper::kHandleValue, instance, GetUniqueId);
 
-    auto wrapper = reinterpret_cast<InstanceWrapper*>(*instance);
+    auto wrapper = GetWrapper<InstanceWrapper>(*instance);
     LoadInstanceTable(gpa, wrapper->handle, &wrapper->layer_table);
 }
 
@@ -222,7 +297,7 @@ void TraceManager::InitDevice(VkDevice* device, PFN_vkGetDeviceProcAddr gpa)
     CreateWrappedHandle<PhysicalDeviceWrapper, NoParentWrapper, DeviceWrapper>(
         VK_NULL_HANDLE, NoParentWrapper::kHandleValue, device, GetUniqueId);
 
-    auto wrapper = reinterpret_cast<DeviceWrapper*>(*device);
+    auto wrapper = GetWrapper<DeviceWrapper>(*device);
     LoadDeviceTable(gpa, wrapper->handle, &wrapper->layer_table);
 }
 
@@ -230,11 +305,98 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
 {
     bool success = true;
 
-    base_filename_        = base_filename;
-    file_options_         = trace_settings.capture_file_options;
-    timestamp_filename_   = trace_settings.time_stamp_file;
-    memory_tracking_mode_ = trace_settings.memory_tracking_mode;
-    force_file_flush_     = trace_settings.force_flush;
+    base_filename_          = base_filename;
+    file_options_           = trace_settings.capture_file_options;
+    timestamp_filename_     = trace_settings.time_stamp_file;
+    memory_tracking_mode_   = trace_settings.memory_tracking_mode;
+    memory_hash_block_size_ = static_cast<size_t>(trace_settings.memory_tracking_hash_block_size) * 1024;
+    force_file_flush_       = trace_settings.force_flush;
+    async_file_write_       = trace_settings.async_file_write;
+    memory_mapped_file_     = trace_settings.memory_mapped_file;
+    io_uring_file_write_    = trace_settings.io_uring_file_write;
+    compression_threads_    = trace_settings.compression_threads;
+    compression_batch_size_ = trace_settings.compression_batch_size;
+    trim_optimize_          = trace_settings.trim_optimize;
+    trim_optimize_bda_      = trace_settings.trim_optimize && trace_settings.trim_optimize_bda;
+    trim_pipeline_cache_    = trace_settings.trim_pipeline_cache;
+    trim_constant_content_  = trace_settings.trim_constant_content;
+    file_index_             = trace_settings.file_index && !trim_optimize_;
+    cpu_timestamps_         = trace_settings.cpu_timestamps;
+
+    // Selects how handles are wrapped before the first handle is wrapped, which is after the manager is initialized.
+    HandleSideTables::SetEnabled(trace_settings.handle_side_tables);
+
+    if (util::network::IsSocketAddress(base_filename_))
+    {
+        // A single capture stream is sent to the socket in place of a file, so captures that are written to multiple
+        // files, or that are assembled from files after they are written, are not supported.
+        if ((trace_settings.recorder_frames > 0) || !trace_settings.trim_ranges.empty() ||
+            !trace_settings.trim_key.empty() || (trace_settings.segment_frames > 0) ||
+            (trace_settings.segment_size > 0))
+        {
+            GFXRECON_LOG_ERROR("Trimmed, segmented, and flight recorder captures cannot be written to %s",
+                               base_filename_.c_str());
+            capture_mode_ = kModeDisabled;
+            return false;
+        }
+
+        if (memory_mapped_file_ || io_uring_file_write_ || trace_settings.thread_segment_write)
+        {
+            GFXRECON_LOG_WARNING("Memory mapped, io_uring, and thread segment file writes are not supported when "
+                                 "writing to a socket address; ignoring the file write settings");
+        }
+
+        // Sends block while the connection is congested, so they are performed by the compression threads or an
+        // asynchronous writer thread, which only blocks API threads when its buffer is full.
+        timestamp_filename_  = false;
+        memory_mapped_file_  = false;
+        io_uring_file_write_ = false;
+        async_file_write_    = (compression_threads_ == 0);
+    }
+    else if (trace_settings.thread_segment_write)
+    {
+        if (async_file_write_ || memory_mapped_file_ || io_uring_file_write_ || (compression_threads_ > 0))
+        {
+            GFXRECON_LOG_WARNING("Thread segment file writes are not supported with asynchronous, memory mapped, or "
+                                 "io_uring file writes, or with compression threads; ignoring the thread segment "
+                                 "setting");
+        }
+        else
+        {
+            // The file offsets of blocks are not known until the thread segments are merged.
+            thread_segment_write_ = true;
+            file_index_           = false;
+        }
+    }
+
+    if ((file_options_.block_alignment != 0) &&
+        ((file_options_.compression_type != format::CompressionType::kNone) || thread_segment_write_ ||
+         (trace_settings.recorder_frames > 0)))
+    {
+        // Padding is inserted at the file offsets of the blocks, which are not known ahead of compression, thread
+        // segment merging, or the flight recorder writing its frames to the file.
+        GFXRECON_LOG_WARNING("Block alignment is not supported with compression, thread segment file writes, or "
+                             "flight recorder capture; ignoring the block alignment setting");
+        file_options_.block_alignment = 0;
+    }
+
+    compressor_options_.level                  = trace_settings.compression_level;
+    compressor_options_.long_distance_matching = trace_settings.compression_long_distance;
+    compressor_options_.worker_threads         = trace_settings.compression_workers;
+
+    // The userfaultfd and soft-dirty modes use the page guard memory tracking infrastructure, with a different method
+    // for detecting writes to mapped memory.
+    auto write_detection_mode = util::PageGuardManager::kWriteDetectionGuardPage;
+    if (memory_tracking_mode_ == CaptureSettings::kUserfaultfd)
+    {
+        memory_tracking_mode_ = CaptureSettings::kPageGuard;
+        write_detection_mode  = util::PageGuardManager::kWriteDetectionUserfaultfd;
+    }
+    else if (memory_tracking_mode_ == CaptureSettings::kSoftDirty)
+    {
+        memory_tracking_mode_ = CaptureSettings::kPageGuard;
+        write_detection_mode  = util::PageGuardManager::kWriteDetectionSoftDirty;
+    }
 
     if (memory_tracking_mode_ == CaptureSettings::kPageGuard)
     {
@@ -252,6 +414,12 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
         }
 #endif
 
+#if defined(WIN32)
+        // When external memory is not enabled for all host visible allocations, it is selected for the allocations
+        // with memory types that support it, and shadow memory is used for the others.
+        page_guard_auto_external_memory_ = trace_settings.page_guard_auto_external_memory && !use_external_memory;
+#endif
+
         // External memory takes precedence over shadow memory modes.
         if (use_external_memory)
         {
@@ -273,13 +441,91 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
         page_guard_memory_mode_        = kMemoryModeDisabled;
     }
 
-    if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty())
+    if (trace_settings.telemetry_port > 0)
+    {
+        // Created before the capture file and compressor, which report to the telemetry, but only started when the
+        // rest of the capture has been initialized.
+        if (trace_settings.telemetry_port > std::numeric_limits<uint16_t>::max())
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid capture telemetry port %u", trace_settings.telemetry_port);
+        }
+        else
+        {
+            telemetry_ = std::make_unique<CaptureTelemetry>(
+                static_cast<uint16_t>(trace_settings.telemetry_port),
+                trace_settings.telemetry_interval,
+                [this](CaptureTelemetry::Sample* sample) { SampleTelemetry(sample); });
+        }
+    }
+
+    if (trace_settings.recorder_frames > 0)
     {
-        // Use default kModeWrite capture mode.
-        success = CreateCaptureFile(base_filename_);
+        // Record frames to memory instead of a file, with state tracking enabled for the state snapshots that precede
+        // the recorded frames.
+        capture_mode_     = kModeWriteAndTrack;
+        trim_key_         = trace_settings.trim_key;
+        recorder_trigger_ = trace_settings.recorder_trigger;
+
+        if ((compression_threads_ > 0) || (compression_batch_size_ > 0))
+        {
+            GFXRECON_LOG_WARNING("Compression threads and compression batching are not supported with flight recorder "
+                                 "capture; blocks will be compressed individually");
+            compression_threads_    = 0;
+            compression_batch_size_ = 0;
+        }
+
+        size_t recorder_size = static_cast<size_t>(trace_settings.recorder_size) * 1024 * 1024;
+        auto   recorder_stream = std::make_unique<FlightRecorderStream>(trace_settings.recorder_frames, recorder_size);
+
+        // The first segment starts with the application, so it does not need a state snapshot.
+        recorder_stream->BeginSegment();
+        recorder_stream->EndSegmentState();
+
+        flight_recorder_stream_ = recorder_stream.get();
+        file_stream_            = std::move(recorder_stream);
+
+        GFXRECON_LOG_INFO("Recording the last %u frames of graphics API capture to memory",
+                          trace_settings.recorder_frames);
+    }
+    else if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty())
+    {
+        if ((trace_settings.segment_frames > 0) || (trace_settings.segment_size > 0))
+        {
+            // State tracking is required for the state snapshots at the start of each segment.
+            capture_mode_   = kModeWriteAndTrack;
+            segment_frames_ = trace_settings.segment_frames;
+            segment_size_   = static_cast<uint64_t>(trace_settings.segment_size) * 1024 * 1024;
+
+            // The timestamp is applied once, to the name that is shared by all segments and the manifest.
+            segment_base_filename_ =
+                timestamp_filename_ ? util::filepath::GenerateTimestampedFilename(base_filename_) : base_filename_;
+            timestamp_filename_ = false;
+
+            segment_manifest_filename_ = segment_base_filename_;
+            size_t extension_index     = segment_manifest_filename_.rfind(".gfxr");
+            if ((extension_index != std::string::npos) &&
+                ((extension_index + 5) == segment_manifest_filename_.length()))
+            {
+                segment_manifest_filename_.erase(extension_index);
+            }
+            segment_manifest_filename_ += "_segments.txt";
+
+            success = CreateCaptureSegment();
+        }
+        else
+        {
+            // Use default kModeWrite capture mode.
+            success = CreateCaptureFile(base_filename_);
+        }
     }
     else
     {
+        if ((trace_settings.segment_frames > 0) || (trace_settings.segment_size > 0))
+        {
+            GFXRECON_LOG_WARNING("Capture file segmentation is not supported with trimmed captures; ignoring the "
+                                 "capture segment settings");
+        }
+
         // Override default kModeWrite capture mode.
         trim_enabled_ = true;
         trim_ranges_  = trace_settings.trim_ranges;
@@ -325,15 +571,108 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
         {
             capture_mode_ = kModeTrack;
         }
+
+        if (trace_settings.trim_dormant && (capture_mode_ == kModeTrack))
+        {
+            // Until trimming is first activated, track the state of Vulkan objects, but not the commands recorded to
+            // command buffers or the content of mapped memory, which is read when the state snapshot is written.
+            trim_dormant_ = true;
+        }
     }
 
     if (success)
     {
-        compressor_ = std::unique_ptr<util::Compressor>(format::CreateCompressor(file_options_.compression_type));
+        compressor_ = CaptureTelemetry::WrapCompressor(
+            std::unique_ptr<util::Compressor>(
+                format::CreateCompressor(file_options_.compression_type, compressor_options_)),
+            telemetry_.get());
         if ((nullptr == compressor_) && (format::CompressionType::kNone != file_options_.compression_type))
         {
             success = false;
         }
+        else if (compression_batch_size_ > 0)
+        {
+            // Blocks are compressed in batches by the file stream, so they are not compressed individually.
+            compressor_ = nullptr;
+        }
+    }
+
+    if (trace_settings.compact_headers)
+    {
+        if ((compression_batch_size_ > 0) && (file_options_.compression_type != format::CompressionType::kNone))
+        {
+            compact_headers_ = true;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Compact headers are only written with compression batching; ignoring the compact "
+                                 "headers setting");
+        }
+    }
+
+    if (success && (trace_settings.compression_budget > 0))
+    {
+        if ((compression_threads_ > 0) || (compression_batch_size_ > 0))
+        {
+            GFXRECON_LOG_WARNING("Adaptive compression is not supported with compression threads or compression "
+                                 "batching; ignoring the compression budget");
+        }
+        else
+        {
+            // The compression type from the settings is the initial compression type, and is the compression type for
+            // untagged compressed blocks.
+            adaptive_compression_ = AdaptiveCompressionController::Create(trace_settings.compression_budget,
+                                                                          file_options_.compression_type);
+        }
+    }
+
+    if (success && trace_settings.command_buffer_streams)
+    {
+        if ((compression_threads_ > 0) || (adaptive_compression_ != nullptr))
+        {
+            GFXRECON_LOG_WARNING("Command buffer streams are not supported with compression threads or adaptive "
+                                 "compression; ignoring the command buffer streams setting");
+        }
+        else
+        {
+            command_buffer_streams_ = true;
+        }
+    }
+
+    if (success && !trace_settings.call_statistics_file.empty())
+    {
+        call_statistics_      = std::make_unique<ApiCallStatistics>();
+        call_statistics_file_ = trace_settings.call_statistics_file;
+    }
+
+    if (success && trace_settings.deduplicate_memory && (flight_recorder_stream_ != nullptr))
+    {
+        // Fill memory commands refer to earlier blocks by position, which changes when recorded frames are released.
+        GFXRECON_LOG_WARNING("Memory deduplication is not supported with flight recorder capture; ignoring the "
+                             "memory deduplication setting");
+    }
+    else if (success && trace_settings.deduplicate_memory)
+    {
+        fill_memory_deduplicator_       = std::make_unique<FillMemoryDeduplicator>();
+        file_options_.fill_memory_reuse = true;
+    }
+
+    if (success && trace_settings.deduplicate_shaders && (flight_recorder_stream_ != nullptr))
+    {
+        // Recorded frames may refer to blobs that were written to released frames.
+        GFXRECON_LOG_WARNING("Shader deduplication is not supported with flight recorder capture; ignoring the shader "
+                             "deduplication setting");
+    }
+    else if (success && trace_settings.deduplicate_shaders)
+    {
+        // The create parameters stored by the state tracker refer to blobs, which are written again with the state
+        // snapshot for each new capture file, so their data is retained when tracking state.
+        blob_deduplicator_ = std::make_unique<BlobDeduplicator>(
+            [this](uint64_t blob_id, const void* data, size_t size) { WriteSetBlobDataCmd(blob_id, data, size); },
+            ((capture_mode_ & kModeTrack) == kModeTrack));
+
+        // The encoder of the current thread was created before the deduplicator.
+        GetThreadData()->parameter_encoder_->SetBlobDeduplicator(blob_deduplicator_.get());
     }
 
     if (success)
@@ -342,12 +681,33 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
         {
             util::PageGuardManager::Create(trace_settings.page_guard_copy_on_map,
                                            trace_settings.page_guard_separate_read,
-                                           util::PageGuardManager::kDefaultEnableReadWriteSamePage);
+                                           util::PageGuardManager::kDefaultEnableReadWriteSamePage,
+                                           write_detection_mode,
+                                           trace_settings.page_guard_sub_page_diff,
+                                           trace_settings.page_guard_process_threads,
+                                           trace_settings.page_guard_huge_pages);
         }
 
         if ((capture_mode_ & kModeTrack) == kModeTrack)
         {
             state_tracker_ = std::make_unique<VulkanStateTracker>();
+
+            if (trace_settings.trim_content_cache)
+            {
+                trim_content_cache_ = std::make_unique<TrimContentCache>();
+                state_tracker_->SetTrimContentCache(trim_content_cache_.get());
+            }
+        }
+
+        if ((counting_stream_ != nullptr) && ((capture_mode_ & kModeWrite) == kModeWrite))
+        {
+            // The first frame starts after the file header.
+            AddSeekIndexEntry(format::kFrameSeekIndexEntry);
+        }
+
+        if (telemetry_ != nullptr)
+        {
+            telemetry_->Start();
         }
     }
     else
@@ -363,6 +723,11 @@ ParameterEncoder* TraceManager::InitApiCallTrace(format::ApiCallId call_id)
     auto thread_data      = GetThreadData();
     thread_data->call_id_ = call_id;
 
+    if (call_statistics_ != nullptr)
+    {
+        thread_data->call_begin_time_ = static_cast<int64_t>(util::datetime::GetTimestamp());
+    }
+
     // Reset the parameter buffer and reserve space for an uncompressed FunctionCallHeader.
     thread_data->parameter_buffer_->ResetWithHeader(sizeof(format::FunctionCallHeader));
 
@@ -371,6 +736,8 @@ ParameterEncoder* TraceManager::InitApiCallTrace(format::ApiCallId call_id)
 
 void TraceManager::EndApiCallTrace()
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     if ((capture_mode_ & kModeWrite) == kModeWrite)
     {
         auto thread_data = GetThreadData();
@@ -379,50 +746,229 @@ void TraceManager::EndApiCallTrace()
         auto parameter_buffer = thread_data->parameter_buffer_.get();
         assert((parameter_buffer != nullptr) && (thread_data->parameter_encoder_ != nullptr));
 
-        bool   not_compressed    = true;
-        size_t uncompressed_size = parameter_buffer->GetDataSize();
+        int64_t write_begin_time = 0;
+        if (call_statistics_ != nullptr)
+        {
+            write_begin_time = static_cast<int64_t>(util::datetime::GetTimestamp());
+        }
 
-        if (nullptr != compressor_)
+        if (compression_stream_ != nullptr)
         {
-            size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
+            // Compression and header initialization are performed by the compression stream's worker threads.
+            compression_stream_->WriteFunctionCall(thread_data->call_id_,
+                                                   thread_data->thread_id_,
+                                                   parameter_buffer->GetHeaderData(),
+                                                   parameter_buffer->GetHeaderDataSize() +
+                                                       parameter_buffer->GetDataSize());
+
+            if (force_file_flush_)
+            {
+                compression_stream_->Flush();
+            }
+        }
+        else
+        {
+            bool                    not_compressed    = true;
+            size_t                  uncompressed_size = parameter_buffer->GetDataSize();
+            util::Compressor*       compressor        = compressor_.get();
+            format::CompressionType compression_type  = format::CompressionType::kNone;
+            size_t                  adaptive_level    = 0;
+            int64_t                 start_time        = 0;
+
+            if (adaptive_compression_ != nullptr)
+            {
+                adaptive_level   = adaptive_compression_->SelectLevel();
+                compressor       = adaptive_compression_->GetCompressor(adaptive_level);
+                compression_type = adaptive_compression_->GetCompressionType(adaptive_level);
+                start_time       = static_cast<int64_t>(util::datetime::GetTimestamp());
+            }
 
-            if ((0 < compressed_size) && (compressed_size < uncompressed_size))
+            if (nullptr != compressor)
             {
-                auto compressed_header =
-                    reinterpret_cast<format::CompressedFunctionCallHeader*>(thread_data->compressed_buffer_.data());
-                compressed_header->block_header.type = format::BlockType::kCompressedFunctionCallBlock;
-                compressed_header->api_call_id       = thread_data->call_id_;
-                compressed_header->thread_id         = thread_data->thread_id_;
-                compressed_header->uncompressed_size = uncompressed_size;
-                compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
-                                                       sizeof(compressed_header->thread_id) +
-                                                       sizeof(compressed_header->uncompressed_size) + compressed_size;
+                size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
+                size_t compressed_size = compressor->Compress(
+                    uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
 
-                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+                if ((0 < compressed_size) && (compressed_size < uncompressed_size))
+                {
+                    auto compressed_header =
+                        reinterpret_cast<format::CompressedFunctionCallHeader*>(thread_data->compressed_buffer_.data());
+                    compressed_header->block_header.type = format::SetBlockCompressionType(
+                        format::BlockType::kCompressedFunctionCallBlock, compression_type);
+                    compressed_header->api_call_id       = thread_data->call_id_;
+                    compressed_header->thread_id         = thread_data->thread_id_;
+                    compressed_header->uncompressed_size = uncompressed_size;
+                    compressed_header->block_header.size =
+                        sizeof(compressed_header->api_call_id) + sizeof(compressed_header->thread_id) +
+                        sizeof(compressed_header->uncompressed_size) + compressed_size;
+
+                    WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+
+                    not_compressed = false;
+                }
+            }
 
-                not_compressed = false;
+            if (not_compressed)
+            {
+                uint8_t* header_data = parameter_buffer->GetHeaderData();
+                assert((header_data != nullptr) &&
+                       (parameter_buffer->GetHeaderDataSize() == sizeof(format::FunctionCallHeader)));
+
+                auto uncompressed_header               = reinterpret_cast<format::FunctionCallHeader*>(header_data);
+                uncompressed_header->block_header.type = format::BlockType::kFunctionCallBlock;
+                uncompressed_header->api_call_id       = thread_data->call_id_;
+                uncompressed_header->thread_id         = thread_data->thread_id_;
+                uncompressed_header->block_header.size = sizeof(uncompressed_header->api_call_id) +
+                                                         sizeof(uncompressed_header->thread_id) + uncompressed_size;
+
+                WriteToFile(parameter_buffer->GetHeaderData(),
+                            parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+            }
+
+            if (adaptive_compression_ != nullptr)
+            {
+                adaptive_compression_->RecordBlock(adaptive_level,
+                                                   uncompressed_size,
+                                                   start_time,
+                                                   static_cast<int64_t>(util::datetime::GetTimestamp()));
             }
         }
 
-        if (not_compressed)
+        if (call_statistics_ != nullptr)
         {
-            uint8_t* header_data = parameter_buffer->GetHeaderData();
-            assert((header_data != nullptr) &&
-                   (parameter_buffer->GetHeaderDataSize() == sizeof(format::FunctionCallHeader)));
+            RecordCallStatistics(thread_data, parameter_buffer->GetDataSize(), write_begin_time);
+        }
+    }
+}
+
+void TraceManager::AppendCommandBufferCall(VkCommandBuffer command_buffer)
+{
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    auto wrapper          = GetWrapper<CommandBufferWrapper>(command_buffer);
+    auto parameter_buffer = thread_data->parameter_buffer_.get();
+    assert((wrapper != nullptr) && (parameter_buffer != nullptr));
+
+    int64_t write_begin_time = 0;
+    if (call_statistics_ != nullptr)
+    {
+        write_begin_time = static_cast<int64_t>(util::datetime::GetTimestamp());
+    }
+
+    if (thread_data->call_id_ == format::ApiCallId::ApiCall_vkBeginCommandBuffer)
+    {
+        // Blocks remain from a recording that was not ended when the recording was abandoned by resetting or freeing
+        // the command buffer through its pool, or when capture stopped and resumed during the recording.  The
+        // abandoned commands do not affect replay.
+        wrapper->pending_blocks.Reset();
+    }
+
+    uint8_t* header_data = parameter_buffer->GetHeaderData();
+    assert((header_data != nullptr) && (parameter_buffer->GetHeaderDataSize() == sizeof(format::FunctionCallHeader)));
+
+    auto header               = reinterpret_cast<format::FunctionCallHeader*>(header_data);
+    header->block_header.type = format::BlockType::kFunctionCallBlock;
+    header->api_call_id       = thread_data->call_id_;
+    header->thread_id         = thread_data->thread_id_;
+    header->block_header.size =
+        sizeof(header->api_call_id) + sizeof(header->thread_id) + parameter_buffer->GetDataSize();
+
+    wrapper->pending_blocks.Append(header_data,
+                                   parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+
+    if ((thread_data->call_id_ == format::ApiCallId::ApiCall_vkEndCommandBuffer) ||
+        (thread_data->call_id_ == format::ApiCallId::ApiCall_vkResetCommandBuffer))
+    {
+        WriteCommandBufferBlocks(wrapper, thread_data);
+    }
+
+    if (call_statistics_ != nullptr)
+    {
+        RecordCallStatistics(thread_data, parameter_buffer->GetDataSize(), write_begin_time);
+    }
+}
+
+void TraceManager::WriteCommandBufferBlocks(CommandBufferWrapper* wrapper, ThreadData* thread_data)
+{
+    assert((wrapper != nullptr) && (thread_data != nullptr));
+
+    const uint8_t* blocks          = wrapper->pending_blocks.GetData();
+    size_t         blocks_size     = wrapper->pending_blocks.GetDataSize();
+    size_t         header_size     = sizeof(format::CompressedBatchBlockHeader);
+    size_t         compressed_size = 0;
+
+    // Batch blocks are not nested, so the blocks are left for the batch compression stream to compress when it is
+    // active.
+    if ((compressor_ != nullptr) && (batch_compression_stream_ == nullptr))
+    {
+        compressed_size = compressor_->Compress(blocks_size, blocks, &thread_data->compressed_buffer_, header_size);
+    }
+
+    if ((compressed_size > 0) && (compressed_size < blocks_size))
+    {
+        auto batch_header =
+            reinterpret_cast<format::CompressedBatchBlockHeader*>(thread_data->compressed_buffer_.data());
+        batch_header->block_header.type = format::BlockType::kCompressedBatchBlock;
+        batch_header->block_header.size = sizeof(batch_header->uncompressed_size) + compressed_size;
+        batch_header->uncompressed_size = blocks_size;
+
+        WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+    }
+    else
+    {
+        // The blocks are complete function call blocks, which are written with a single file write.
+        WriteToFile(blocks, blocks_size);
+    }
+
+    wrapper->pending_blocks.Reset();
+}
+
+void TraceManager::RecordCallStatistics(ThreadData* thread_data, size_t encode_bytes, int64_t write_begin_time)
+{
+    assert((thread_data != nullptr) && (call_statistics_ != nullptr));
+
+    // Thread counters are created on first use, and are replaced when a new TraceManager instance is created.
+    if ((thread_data->call_statistics_ == nullptr) ||
+        (thread_data->call_statistics_->GetSessionId() != call_statistics_->GetSessionId()))
+    {
+        thread_data->call_statistics_ = call_statistics_->RegisterThread();
+    }
+
+    int64_t write_end_time = static_cast<int64_t>(util::datetime::GetTimestamp());
+
+    thread_data->call_statistics_->Record(thread_data->call_id_,
+                                          encode_bytes,
+                                          write_begin_time - thread_data->call_begin_time_,
+                                          write_end_time - write_begin_time);
+}
+
+void TraceManager::SampleTelemetry(CaptureTelemetry::Sample* sample)
+{
+    assert(sample != nullptr);
 
-            auto uncompressed_header               = reinterpret_cast<format::FunctionCallHeader*>(header_data);
-            uncompressed_header->block_header.type = format::BlockType::kFunctionCallBlock;
-            uncompressed_header->api_call_id       = thread_data->call_id_;
-            uncompressed_header->thread_id         = thread_data->thread_id_;
-            uncompressed_header->block_header.size =
-                sizeof(uncompressed_header->api_call_id) + sizeof(uncompressed_header->thread_id) + uncompressed_size;
+    {
+        // Uses a separate lock from the state lock, which is held while state snapshots are written.
+        std::lock_guard<std::mutex> telemetry_lock(telemetry_stream_lock_);
 
-            WriteToFile(parameter_buffer->GetHeaderData(),
-                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+        if (compression_stream_ != nullptr)
+        {
+            sample->writer_queue_bytes = compression_stream_->GetPendingSize();
+        }
+        else if (async_stream_ != nullptr)
+        {
+            sample->writer_queue_bytes = async_stream_->GetPendingSize();
         }
     }
+
+    auto page_guard_manager = util::PageGuardManager::Get();
+    if (page_guard_manager != nullptr)
+    {
+        sample->page_guard_faults   = page_guard_manager->GetFaultCount();
+        sample->shadow_memory_bytes = page_guard_manager->GetShadowMemorySize();
+    }
+
+    sample->state_tracker_bytes = VulkanStateTracker::GetTrackedDataSize();
 }
 
 bool TraceManager::IsTrimHotkeyPressed()
@@ -450,10 +996,11 @@ void TraceManager::CheckContinueCaptureForWriteMode()
             if (trim_current_range_ >= trim_ranges_.size())
             {
                 // No more frames to capture. Capture can be disabled and resources can be released.
-                trim_enabled_  = false;
-                capture_mode_  = kModeDisabled;
-                state_tracker_ = nullptr;
-                compressor_    = nullptr;
+                trim_enabled_       = false;
+                capture_mode_       = kModeDisabled;
+                state_tracker_      = nullptr;
+                trim_content_cache_ = nullptr;
+                compressor_         = nullptr;
             }
             else if (trim_ranges_[trim_current_range_].first == current_frame_)
             {
@@ -520,10 +1067,31 @@ void TraceManager::CheckStartCaptureForTrackMode()
 
 void TraceManager::EndFrame()
 {
-    if (trim_enabled_)
+    if (((capture_mode_ & kModeWrite) == kModeWrite) && (batch_compression_stream_ != nullptr))
     {
-        ++current_frame_;
+        batch_compression_stream_->FlushBatch();
+    }
+
+    ++current_frame_;
+
+    if (telemetry_ != nullptr)
+    {
+        telemetry_->SetFrame(current_frame_);
+    }
 
+    if (flight_recorder_stream_ != nullptr)
+    {
+        UpdateFlightRecorder();
+    }
+    else if ((segment_frames_ > 0) || (segment_size_ > 0))
+    {
+        if ((capture_mode_ & kModeWrite) == kModeWrite)
+        {
+            CheckContinueCaptureSegment();
+        }
+    }
+    else if (trim_enabled_)
+    {
         if ((capture_mode_ & kModeWrite) == kModeWrite)
         {
             // Currently capturing a frame range.
@@ -537,26 +1105,180 @@ void TraceManager::EndFrame()
             CheckStartCaptureForTrackMode();
         }
     }
+
+    if ((counting_stream_ != nullptr) && ((capture_mode_ & kModeWrite) == kModeWrite))
+    {
+        // Any state snapshot for a new capture file has been written, so the next frame starts at the current offset.
+        AddSeekIndexEntry(format::kFrameSeekIndexEntry);
+    }
 }
 
-std::string TraceManager::CreateTrimFilename(const std::string&                base_filename,
-                                             const CaptureSettings::TrimRange& trim_range)
+void TraceManager::CheckContinueCaptureSegment()
 {
-    assert(trim_range.total > 0);
-
-    std::string range_string = "_";
+    uint32_t segment_frame_count = current_frame_ - segment_first_frame_;
 
-    if (trim_range.total == 1)
+    if (((segment_frames_ > 0) && (segment_frame_count >= segment_frames_)) ||
+        ((segment_size_ > 0) && (segment_bytes_.load(std::memory_order_relaxed) >= segment_size_)))
     {
-        range_string += "frame_";
-        range_string += std::to_string(trim_range.first);
+        // End the current segment, and start the next segment with a state snapshot.
+        DeactivateTrimming();
+
+        if (CreateCaptureSegment())
+        {
+            ActivateTrimming();
+        }
+        else
+        {
+            GFXRECON_LOG_FATAL("Failed to initialize capture for capture segment; capture has been disabled");
+            capture_mode_   = kModeDisabled;
+            segment_frames_ = 0;
+            segment_size_   = 0;
+        }
     }
-    else
+}
+
+bool TraceManager::CreateCaptureSegment()
+{
+    std::string index_string = std::to_string(segment_index_);
+    if (index_string.length() < kSegmentIndexDigits)
     {
-        range_string += "frames_";
-        range_string += std::to_string(trim_range.first);
-        range_string += "_through_";
-        range_string += std::to_string((trim_range.first + trim_range.total) - 1);
+        index_string.insert(0, kSegmentIndexDigits - index_string.length(), '0');
+    }
+
+    bool success =
+        CreateCaptureFile(util::filepath::InsertFilenamePostfix(segment_base_filename_, "_segment_" + index_string));
+
+    if (success)
+    {
+        segment_first_frame_ = current_frame_;
+        segment_bytes_.store(0, std::memory_order_relaxed);
+
+        // The manifest is updated as each segment starts, so that it is complete if the application terminates.
+        FILE*       manifest_file = nullptr;
+        const char* mode          = (segment_index_ == 0) ? "w" : "a";
+
+        if (util::platform::FileOpen(&manifest_file, segment_manifest_filename_.c_str(), mode) == 0)
+        {
+            if (segment_index_ == 0)
+            {
+                util::platform::FilePuts("# First frame and file name of each capture segment\n", manifest_file);
+            }
+
+            std::string entry = std::to_string(segment_first_frame_) + " " + capture_filename_ + "\n";
+            util::platform::FilePuts(entry.c_str(), manifest_file);
+            util::platform::FileClose(manifest_file);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Failed to update capture segment manifest %s", segment_manifest_filename_.c_str());
+        }
+
+        ++segment_index_;
+    }
+
+    return success;
+}
+
+void TraceManager::UpdateFlightRecorder()
+{
+    bool start_segment = flight_recorder_stream_->EndFrame();
+    bool write_capture = !trim_key_.empty() && IsTrimHotkeyPressed();
+    bool triggered     = !recorder_trigger_.empty() && util::filepath::Exists(recorder_trigger_);
+
+    if ((write_capture || triggered) && WriteFlightRecorderCapture() && triggered)
+    {
+        // Remove the trigger file once the capture file has been written, so that each trigger produces a single
+        // capture file.  When the capture file cannot be created, the trigger is retried at the end of the next frame.
+        std::remove(recorder_trigger_.c_str());
+    }
+
+    if (start_segment)
+    {
+        StartFlightRecorderSegment();
+    }
+}
+
+void TraceManager::StartFlightRecorderSegment()
+{
+    auto state_lock = AcquireUniqueStateLock();
+
+    // Each segment begins with a state snapshot, and earlier segments may be discarded.
+    ResetMappedMemoryHashes();
+
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    flight_recorder_stream_->BeginSegment();
+
+    VulkanStateWriter state_writer(file_stream_.get(),
+                                   compressor_.get(),
+                                   file_options_.compression_type,
+                                   compressor_options_,
+                                   thread_data->thread_id_,
+                                   file_options_.handle_id_encoding,
+                                   nullptr,
+                                   trim_content_cache_.get(),
+                                   nullptr,
+                                   trim_pipeline_cache_,
+                                   trim_constant_content_);
+    state_tracker_->WriteState(&state_writer, current_frame_);
+
+    flight_recorder_stream_->EndSegmentState();
+}
+
+bool TraceManager::WriteFlightRecorderCapture()
+{
+    auto state_lock = AcquireUniqueStateLock();
+
+    std::string capture_filename = util::filepath::InsertFilenamePostfix(base_filename_, "_flight_recorder");
+
+    if (timestamp_filename_)
+    {
+        capture_filename = util::filepath::GenerateTimestampedFilename(capture_filename);
+    }
+
+    // Temporarily replace the recorder stream with the capture file, so that the file header is written with the same
+    // functions that write the header for regular capture files.
+    std::unique_ptr<util::OutputStream> recorder_stream = std::move(file_stream_);
+    file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename, kFileStreamBufferSize);
+
+    bool success = file_stream_->IsValid();
+
+    if (success)
+    {
+        WriteFileHeader();
+        uint32_t frame_count = flight_recorder_stream_->WriteFrames(file_stream_.get());
+
+        GFXRECON_LOG_INFO("Wrote %u frames of graphics API capture to %s", frame_count, capture_filename.c_str());
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to create flight recorder capture file %s", capture_filename.c_str());
+    }
+
+    file_stream_ = std::move(recorder_stream);
+
+    return success;
+}
+
+std::string TraceManager::CreateTrimFilename(const std::string&                base_filename,
+                                             const CaptureSettings::TrimRange& trim_range)
+{
+    assert(trim_range.total > 0);
+
+    std::string range_string = "_";
+
+    if (trim_range.total == 1)
+    {
+        range_string += "frame_";
+        range_string += std::to_string(trim_range.first);
+    }
+    else
+    {
+        range_string += "frames_";
+        range_string += std::to_string(trim_range.first);
+        range_string += "_through_";
+        range_string += std::to_string((trim_range.first + trim_range.total) - 1);
     }
 
     return util::filepath::InsertFilenamePostfix(base_filename, range_string);
@@ -574,12 +1296,137 @@ bool TraceManager::CreateCaptureFile(const std::string& base_filename)
         capture_filename = util::filepath::GenerateTimestampedFilename(capture_filename);
     }
 
-    file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename, kFileStreamBufferSize);
+    std::unique_ptr<util::OutputStream> file_stream;
+
+    if (util::network::IsSocketAddress(capture_filename))
+    {
+        file_stream = std::make_unique<util::SocketOutputStream>(capture_filename);
+    }
+    else if (memory_mapped_file_)
+    {
+        file_stream = std::make_unique<util::MmapOutputStream>(capture_filename);
+    }
+    else if (io_uring_file_write_)
+    {
+        file_stream = std::make_unique<util::UringOutputStream>(capture_filename);
+
+        if (!file_stream->IsValid())
+        {
+            GFXRECON_LOG_WARNING("Failed to create io_uring capture file writer; using standard file writes");
+            file_stream = nullptr;
+        }
+    }
+
+    if (file_stream == nullptr)
+    {
+        file_stream = std::make_unique<util::FileOutputStream>(capture_filename, kFileStreamBufferSize);
+
+        if (thread_segment_write_)
+        {
+            // Each thread writes to its own segment file, and the segments are merged when the file is closed.
+            file_stream = std::make_unique<util::ThreadSegmentOutputStream>(std::move(file_stream), capture_filename);
+        }
+    }
+
+    if (telemetry_ != nullptr)
+    {
+        // Count the bytes that are written to the file, after compression.
+        file_stream = std::make_unique<TelemetryOutputStream>(std::move(file_stream), telemetry_.get());
+    }
+
+    {
+        std::lock_guard<std::mutex> telemetry_lock(telemetry_stream_lock_);
+        compression_stream_       = nullptr;
+        async_stream_             = nullptr;
+        batch_compression_stream_ = nullptr;
+        counting_stream_          = nullptr;
+        file_stream_              = std::move(file_stream);
+    }
+
+    seek_index_.clear();
 
     if (file_stream_->IsValid())
     {
+        bool batch_compression =
+            (compression_batch_size_ > 0) && (file_options_.compression_type != format::CompressionType::kNone);
+
+        if ((compression_threads_ > 0) && !batch_compression &&
+            (file_options_.compression_type != format::CompressionType::kNone))
+        {
+            // Compress function call blocks on worker threads, which also perform the file writes.
+            auto compression_stream =
+                std::make_unique<ParallelCompressionStream>(std::move(file_stream_),
+                                                            file_options_.compression_type,
+                                                            compressor_options_,
+                                                            compression_threads_,
+                                                            ParallelCompressionStream::kDefaultMaxPendingSize,
+                                                            telemetry_.get());
+
+            std::lock_guard<std::mutex> telemetry_lock(telemetry_stream_lock_);
+            compression_stream_ = compression_stream.get();
+            file_stream_        = std::move(compression_stream);
+        }
+        else if (async_file_write_)
+        {
+            // Hand the file stream to a writer thread, so that API threads do not block on file I/O.
+            auto async_stream = std::make_unique<util::AsyncOutputStream>(std::move(file_stream_));
+
+            std::lock_guard<std::mutex> telemetry_lock(telemetry_stream_lock_);
+            async_stream_ = async_stream.get();
+            file_stream_  = std::move(async_stream);
+        }
+
+        if (file_index_ && (compression_stream_ == nullptr))
+        {
+            // Blocks are written to the file without changing their size, except for batch compression, which is
+            // applied above the counting stream, so the count of bytes written is the file offset of the next block.
+            auto counting_stream = std::make_unique<util::CountingOutputStream>(std::move(file_stream_));
+            counting_stream_     = counting_stream.get();
+            file_stream_         = std::move(counting_stream);
+        }
+
+        if (fill_memory_deduplicator_ != nullptr)
+        {
+            // Fill memory commands can only refer to commands from the same file.
+            fill_memory_deduplicator_->Reset();
+        }
+
+        if (blob_deduplicator_ != nullptr)
+        {
+            // Blobs must be written again before they are referenced by the new file.
+            blob_deduplicator_->Reset();
+        }
+
         GFXRECON_LOG_INFO("Recording graphics API capture to %s", capture_filename.c_str());
+        capture_filename_ = capture_filename;
         WriteFileHeader();
+
+        if (file_options_.block_alignment != 0)
+        {
+            // Blocks written after the file header are padded to align their payloads at their file offsets.
+            std::vector<format::FileOptionPair> option_list;
+            BuildOptionList(file_options_, &option_list);
+
+            uint64_t header_size = sizeof(format::FileHeader) + (option_list.size() * sizeof(format::FileOptionPair));
+            uint32_t alignment   = file_options_.block_alignment;
+
+            file_stream_ = std::make_unique<BlockAlignmentStream>(std::move(file_stream_), header_size, alignment);
+        }
+
+        if (batch_compression)
+        {
+            // Blocks written after the file header are combined into compressed batches, which are written to the
+            // file at the end of each frame and when the batch size is reached.
+            size_t batch_size   = static_cast<size_t>(compression_batch_size_) * 1024;
+            auto   batch_stream = std::make_unique<BatchCompressionStream>(std::move(file_stream_),
+                                                                         file_options_.compression_type,
+                                                                         compressor_options_,
+                                                                         batch_size,
+                                                                         compact_headers_,
+                                                                         telemetry_.get());
+            batch_compression_stream_ = batch_stream.get();
+            file_stream_              = std::move(batch_stream);
+        }
     }
     else
     {
@@ -596,11 +1443,79 @@ void TraceManager::ActivateTrimming()
 
     capture_mode_ |= kModeWrite;
 
+    if (trim_dormant_)
+    {
+        // Command buffers that were recorded while dormant are tracked from their next reset.  Memory that was mapped
+        // while dormant is not tracked by the page guard manager, so its mapped range is written at queue submission
+        // until it is unmapped.
+        trim_dormant_     = false;
+        unguarded_memory_ = (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard);
+    }
+
+    // The state snapshot writes the content of mapped memory, which replaces the content that was hashed when the
+    // memory was last written.
+    ResetMappedMemoryHashes();
+
     auto thread_data = GetThreadData();
     assert(thread_data != nullptr);
 
-    VulkanStateWriter state_writer(file_stream_.get(), compressor_.get(), thread_data->thread_id_);
+    util::OutputStream*                 state_stream = file_stream_.get();
+    std::unique_ptr<util::OutputStream> deferred_state_stream;
+
+    if (trim_optimize_)
+    {
+        // Write the state snapshot to a separate file, which is combined with the trimmed frames when the trim range
+        // ends, so that the content of the resources that are not referenced by the trimmed frames can be omitted.
+        std::string state_filename = capture_filename_ + ".state";
+
+        deferred_state_stream = std::make_unique<util::FileOutputStream>(state_filename, kFileStreamBufferSize);
+
+        if (deferred_state_stream->IsValid())
+        {
+            state_stream         = deferred_state_stream.get();
+            trim_state_filename_ = state_filename;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Failed to create state snapshot file %s; unreferenced resources will not be omitted "
+                                 "from the trimmed capture file",
+                                 state_filename.c_str());
+        }
+    }
+
+    if (counting_stream_ != nullptr)
+    {
+        AddSeekIndexEntry(format::kStateBeginSeekIndexEntry);
+    }
+
+    VulkanStateWriter state_writer(state_stream,
+                                   compressor_.get(),
+                                   file_options_.compression_type,
+                                   compressor_options_,
+                                   thread_data->thread_id_,
+                                   file_options_.handle_id_encoding,
+                                   fill_memory_deduplicator_.get(),
+                                   trim_content_cache_.get(),
+                                   blob_deduplicator_.get(),
+                                   trim_pipeline_cache_,
+                                   trim_constant_content_);
     state_tracker_->WriteState(&state_writer, current_frame_);
+
+    if (counting_stream_ != nullptr)
+    {
+        if (batch_compression_stream_ != nullptr)
+        {
+            // Start the frame blocks in a new batch, so that the frame offset references a block.
+            batch_compression_stream_->FlushBatch();
+        }
+
+        AddSeekIndexEntry(format::kStateEndSeekIndexEntry);
+    }
+
+    if (!trim_state_filename_.empty())
+    {
+        state_tracker_->BeginReferencedResourceTracking(trim_optimize_bda_);
+    }
 }
 
 void TraceManager::DeactivateTrimming()
@@ -608,7 +1523,83 @@ void TraceManager::DeactivateTrimming()
     auto state_lock = AcquireUniqueStateLock();
 
     capture_mode_ &= ~kModeWrite;
-    file_stream_ = nullptr;
+
+    WriteSeekIndex();
+
+    {
+        std::lock_guard<std::mutex> telemetry_lock(telemetry_stream_lock_);
+        compression_stream_       = nullptr;
+        async_stream_             = nullptr;
+        batch_compression_stream_ = nullptr;
+        counting_stream_          = nullptr;
+        file_stream_              = nullptr;
+    }
+
+    if (!trim_state_filename_.empty())
+    {
+        std::unordered_set<format::HandleId> buffer_ids;
+        std::unordered_set<format::HandleId> image_ids;
+        bool                                 address_access = false;
+
+        // Buffer content is only omitted when all buffer accesses could be identified.
+        state_tracker_->EndReferencedResourceTracking(&buffer_ids, &image_ids, &address_access);
+        TrimFileAssembler::Assemble(capture_filename_, trim_state_filename_, buffer_ids, image_ids, address_access);
+        trim_state_filename_.clear();
+    }
+}
+
+void TraceManager::AddSeekIndexEntry(format::SeekIndexEntryType type)
+{
+    assert(counting_stream_ != nullptr);
+
+    format::SeekIndexEntry entry;
+    entry.offset       = counting_stream_->GetBytesWritten();
+    entry.frame_number = current_frame_;
+    entry.type         = type;
+
+    seek_index_.push_back(entry);
+}
+
+void TraceManager::WriteSeekIndex()
+{
+    if (counting_stream_ == nullptr)
+    {
+        return;
+    }
+
+    if (batch_compression_stream_ != nullptr)
+    {
+        batch_compression_stream_->FlushBatch();
+    }
+
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    // The index blocks are written below any batch compression stream, so that they can be read without decompression.
+    format::SeekIndexCommandHeader index_header;
+    size_t                         entries_size = seek_index_.size() * sizeof(format::SeekIndexEntry);
+    uint64_t                       index_offset = counting_stream_->GetBytesWritten();
+
+    index_header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(index_header) + entries_size;
+    index_header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    index_header.meta_header.meta_data_type    = format::MetaDataType::kSeekIndexCommand;
+    index_header.thread_id                     = thread_data->thread_id_;
+    index_header.entry_count                   = seek_index_.size();
+
+    util::OutputBuffer buffers[] = { { &index_header, sizeof(index_header) }, { seek_index_.data(), entries_size } };
+    counting_stream_->WriteBuffers(buffers, 2);
+
+    format::SeekIndexFooterCommand footer;
+    footer.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(footer);
+    footer.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    footer.meta_header.meta_data_type    = format::MetaDataType::kSeekIndexFooterCommand;
+    footer.index_offset                  = index_offset;
+    footer.fourcc                        = GFXRECON_SEEK_INDEX_FOURCC;
+
+    counting_stream_->Write(&footer, sizeof(footer));
+
+    counting_stream_ = nullptr;
+    seek_index_.clear();
 }
 
 void TraceManager::WriteFileHeader()
@@ -619,8 +1610,8 @@ void TraceManager::WriteFileHeader()
 
     format::FileHeader file_header;
     file_header.fourcc        = GFXRECON_FOURCC;
-    file_header.major_version = 0;
-    file_header.minor_version = 0;
+    file_header.major_version = format::kFileMajorVersion;
+    file_header.minor_version = compact_headers_ ? format::kCompactHeadersFileMinorVersion : format::kFileMinorVersion;
     file_header.num_options   = static_cast<uint32_t>(option_list.size());
 
     CombineAndWriteToFile({ { &file_header, sizeof(file_header) },
@@ -633,6 +1624,23 @@ void TraceManager::BuildOptionList(const format::EnabledOptions&        enabled_
     assert(option_list != nullptr);
 
     option_list->push_back({ format::FileOption::kCompressionType, enabled_options.compression_type });
+
+    // The option is only written for varint handle IDs, so that files with fixed size handle IDs remain readable by
+    // older replay tools.
+    if (enabled_options.handle_id_encoding != format::HandleIdEncoding::kFixedHandleIds)
+    {
+        option_list->push_back({ format::FileOption::kHandleIdEncoding, enabled_options.handle_id_encoding });
+    }
+
+    if (enabled_options.block_alignment != 0)
+    {
+        option_list->push_back({ format::FileOption::kBlockAlignment, enabled_options.block_alignment });
+    }
+
+    if (enabled_options.fill_memory_reuse)
+    {
+        option_list->push_back({ format::FileOption::kFillMemoryReuse, 1 });
+    }
 }
 
 void TraceManager::WriteDisplayMessageCmd(const char* message)
@@ -725,37 +1733,284 @@ void TraceManager::WriteFillMemoryCmd(format::HandleId memory_id,
         size_t                          header_size       = sizeof(format::FillMemoryCommandHeader);
         const uint8_t*                  uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
         size_t                          uncompressed_size = static_cast<size_t>(size);
+        bool                            deduplicated      = false;
+
+        // The deduplicator assigns indices to fill memory commands in the order that they are written to the file, so
+        // the lock is held until the command has been written.
+        std::unique_lock<std::mutex> deduplicator_lock;
+        if (fill_memory_deduplicator_ != nullptr)
+        {
+            uint64_t source_index = 0;
+
+            deduplicator_lock = std::unique_lock<std::mutex>(fill_memory_deduplicator_->GetMutex());
+
+            if (fill_memory_deduplicator_->ProcessFillMemory(uncompressed_data, uncompressed_size, &source_index))
+            {
+                WriteFillMemoryFromPreviousBlockCmd(memory_id, offset, size, source_index);
+                deduplicated = true;
+            }
+        }
+
+        if (!deduplicated)
+        {
+            auto thread_data = GetThreadData();
+            assert(thread_data != nullptr);
+
+            fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+            fill_cmd.meta_header.meta_data_type    = format::MetaDataType::kFillMemoryCommand;
+            fill_cmd.thread_id                     = thread_data->thread_id_;
+            fill_cmd.memory_id                     = memory_id;
+            fill_cmd.memory_offset                 = offset;
+            fill_cmd.memory_size                   = size;
+
+            bool                    not_compressed   = true;
+            util::Compressor*       compressor       = compressor_.get();
+            format::CompressionType compression_type = format::CompressionType::kNone;
+            size_t                  adaptive_level   = 0;
+            int64_t                 start_time       = 0;
+
+            if (adaptive_compression_ != nullptr)
+            {
+                adaptive_level   = adaptive_compression_->SelectLevel();
+                compressor       = adaptive_compression_->GetCompressor(adaptive_level);
+                compression_type = adaptive_compression_->GetCompressionType(adaptive_level);
+                start_time       = static_cast<int64_t>(util::datetime::GetTimestamp());
+            }
+
+            if (compressor != nullptr)
+            {
+                size_t compressed_size = compressor->Compress(
+                    uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
+
+                if ((compressed_size > 0) && (compressed_size < uncompressed_size))
+                {
+                    not_compressed = false;
+
+                    // We don't have a special header for compressed fill commands because the header always includes
+                    // the uncompressed size, so we just change the type to indicate the data is compressed.
+                    fill_cmd.meta_header.block_header.type =
+                        format::SetBlockCompressionType(format::BlockType::kCompressedMetaDataBlock, compression_type);
+
+                    // Calculate size of packet with uncompressed data size.
+                    fill_cmd.meta_header.block_header.size =
+                        format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+
+                    // Copy header to beginning of compressed_buffer_
+                    util::platform::MemoryCopy(
+                        thread_data->compressed_buffer_.data(), header_size, &fill_cmd, header_size);
+
+                    WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+                }
+            }
+
+            if (not_compressed)
+            {
+                // Calculate size of packet with compressed data size.
+                fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + uncompressed_size;
+
+                CombineAndWriteToFile({ { &fill_cmd, header_size }, { uncompressed_data, uncompressed_size } });
+            }
+
+            if (adaptive_compression_ != nullptr)
+            {
+                adaptive_compression_->RecordBlock(adaptive_level,
+                                                   uncompressed_size,
+                                                   start_time,
+                                                   static_cast<int64_t>(util::datetime::GetTimestamp()));
+            }
+        }
+    }
+}
+
+void TraceManager::WriteMappedMemory(DeviceMemoryWrapper* wrapper)
+{
+    assert(wrapper != nullptr);
+
+    VkDeviceSize size = wrapper->mapped_size;
+    if (size == VK_WHOLE_SIZE)
+    {
+        assert(wrapper->mapped_offset <= wrapper->allocation_size);
+        size = wrapper->allocation_size - wrapper->mapped_offset;
+    }
+
+    if ((memory_hash_block_size_ == 0) || ((capture_mode_ & kModeWrite) != kModeWrite))
+    {
+        // Write the entire mapped region.
+        // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
+        WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+        return;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+    size_t         mapped_size = static_cast<size_t>(size);
+    size_t         block_count = (mapped_size + memory_hash_block_size_ - 1) / memory_hash_block_size_;
+    const uint8_t* data        = static_cast<const uint8_t*>(wrapper->mapped_data);
+
+    // All blocks are written when the mapped range has not been written since it was mapped.
+    bool write_all = (wrapper->block_hashes.size() != block_count);
+    if (write_all)
+    {
+        wrapper->block_hashes.resize(block_count);
+    }
+
+    // Consecutive blocks that changed are written with a single fill memory command.
+    size_t run_start = 0;
+    size_t run_size  = 0;
+
+    for (size_t i = 0; i < block_count; ++i)
+    {
+        size_t   offset     = i * memory_hash_block_size_;
+        size_t   block_size = std::min(memory_hash_block_size_, mapped_size - offset);
+        uint64_t hash       = util::hash::ContentHash64(data + offset, block_size);
+
+        if (write_all || (hash != wrapper->block_hashes[i]))
+        {
+            wrapper->block_hashes[i] = hash;
+
+            if (run_size == 0)
+            {
+                run_start = offset;
+            }
+
+            run_size += block_size;
+        }
+        else if (run_size > 0)
+        {
+            WriteFillMemoryCmd(wrapper->handle_id, run_start, run_size, wrapper->mapped_data);
+            run_size = 0;
+        }
+    }
+
+    if (run_size > 0)
+    {
+        WriteFillMemoryCmd(wrapper->handle_id, run_start, run_size, wrapper->mapped_data);
+    }
+}
+
+void TraceManager::ResetMappedMemoryHashes()
+{
+    std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+
+    for (auto wrapper : mapped_memory_)
+    {
+        wrapper->block_hashes.clear();
+    }
+
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    std::lock_guard<std::mutex> ahb_lock(hardware_buffers_lock_);
+
+    for (auto& entry : hardware_buffers_)
+    {
+        entry.second.write_all = true;
+    }
+#endif
+}
+
+void TraceManager::EncodeFillMemoryCmd(format::ThreadId      thread_id,
+                                       format::HandleId      memory_id,
+                                       VkDeviceSize          offset,
+                                       VkDeviceSize          size,
+                                       const void*           data,
+                                       std::vector<uint8_t>* block)
+{
+    assert(block != nullptr);
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+    format::FillMemoryCommandHeader fill_cmd;
+    size_t                          header_size       = sizeof(format::FillMemoryCommandHeader);
+    const uint8_t*                  uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
+    size_t                          uncompressed_size = static_cast<size_t>(size);
+    size_t                          compressed_size   = 0;
+
+    fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    fill_cmd.meta_header.meta_data_type    = format::MetaDataType::kFillMemoryCommand;
+    fill_cmd.thread_id                     = thread_id;
+    fill_cmd.memory_id                     = memory_id;
+    fill_cmd.memory_offset                 = offset;
+    fill_cmd.memory_size                   = size;
+
+    if (compressor_ != nullptr)
+    {
+        compressed_size = compressor_->Compress(uncompressed_size, uncompressed_data, block, header_size);
+    }
+
+    if ((compressed_size > 0) && (compressed_size < uncompressed_size))
+    {
+        fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+
+        block->resize(header_size + compressed_size);
+    }
+    else
+    {
+        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + uncompressed_size;
+
+        block->resize(header_size + uncompressed_size);
+        util::platform::MemoryCopy(
+            block->data() + header_size, uncompressed_size, uncompressed_data, uncompressed_size);
+    }
+
+    util::platform::MemoryCopy(block->data(), header_size, &fill_cmd, header_size);
+}
+
+void TraceManager::WriteFillMemoryFromPreviousBlockCmd(format::HandleId memory_id,
+                                                       VkDeviceSize     offset,
+                                                       VkDeviceSize     size,
+                                                       uint64_t         source_index)
+{
+    if ((capture_mode_ & kModeWrite) == kModeWrite)
+    {
+        format::FillMemoryFromPreviousBlockCommand fill_cmd;
 
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
         fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
-        fill_cmd.meta_header.meta_data_type    = format::MetaDataType::kFillMemoryCommand;
+        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd);
+        fill_cmd.meta_header.meta_data_type    = format::MetaDataType::kFillMemoryFromPreviousBlockCommand;
         fill_cmd.thread_id                     = thread_data->thread_id_;
         fill_cmd.memory_id                     = memory_id;
         fill_cmd.memory_offset                 = offset;
         fill_cmd.memory_size                   = size;
+        fill_cmd.source_index                  = source_index;
 
-        bool not_compressed = true;
+        WriteToFile(&fill_cmd, sizeof(fill_cmd));
+    }
+}
+
+void TraceManager::WriteSetBlobDataCmd(uint64_t blob_id, const void* data, size_t size)
+{
+    if ((capture_mode_ & kModeWrite) == kModeWrite)
+    {
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+
+        format::SetBlobDataCommandHeader blob_cmd;
+        size_t                           header_size    = sizeof(format::SetBlobDataCommandHeader);
+        bool                             not_compressed = true;
+
+        blob_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        blob_cmd.meta_header.meta_data_type    = format::MetaDataType::kSetBlobDataCommand;
+        blob_cmd.thread_id                     = thread_data->thread_id_;
+        blob_cmd.blob_id                       = blob_id;
+        blob_cmd.data_size                     = size;
 
         if (compressor_ != nullptr)
         {
             size_t compressed_size = compressor_->Compress(
-                uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
+                size, static_cast<const uint8_t*>(data), &thread_data->compressed_buffer_, header_size);
 
-            if ((compressed_size > 0) && (compressed_size < uncompressed_size))
+            if ((compressed_size > 0) && (compressed_size < size))
             {
                 not_compressed = false;
 
-                // We don't have a special header for compressed fill commands because the header always includes
-                // the uncompressed size, so we just change the type to indicate the data is compressed.
-                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                // Calculate size of packet with uncompressed data size.
-                fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+                // The header includes the uncompressed size, so only the block type changes for compressed data.
+                blob_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                blob_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(blob_cmd) + compressed_size;
 
-                // Copy header to beginning of compressed_buffer_
-                util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, &fill_cmd, header_size);
+                util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, &blob_cmd, header_size);
 
                 WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
             }
@@ -763,10 +2018,9 @@ void TraceManager::WriteFillMemoryCmd(format::HandleId memory_id,
 
         if (not_compressed)
         {
-            // Calculate size of packet with compressed data size.
-            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + uncompressed_size;
+            blob_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(blob_cmd) + size;
 
-            CombineAndWriteToFile({ { &fill_cmd, header_size }, { uncompressed_data, uncompressed_size } });
+            CombineAndWriteToFile({ { &blob_cmd, header_size }, { data, size } });
         }
     }
 }
@@ -973,6 +2227,25 @@ void TraceManager::WriteSetOpaqueAddressCommand(format::HandleId device_id,
     }
 }
 
+void TraceManager::WriteTimestampCommand()
+{
+    if ((capture_mode_ & kModeWrite) == kModeWrite)
+    {
+        format::TimestampCommand timestamp_cmd;
+
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+
+        timestamp_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        timestamp_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(timestamp_cmd);
+        timestamp_cmd.meta_header.meta_data_type    = format::MetaDataType::kTimestampCommand;
+        timestamp_cmd.thread_id                     = thread_data->thread_id_;
+        timestamp_cmd.timestamp                     = static_cast<uint64_t>(util::datetime::GetTimestamp());
+
+        WriteToFile(&timestamp_cmd, sizeof(timestamp_cmd));
+    }
+}
+
 void TraceManager::WriteSetRayTracingShaderGroupHandlesCommand(format::HandleId device_id,
                                                                format::HandleId pipeline_id,
                                                                size_t           data_size,
@@ -1005,7 +2278,7 @@ void TraceManager::SetDescriptorUpdateTemplateInfo(VkDescriptorUpdateTemplate
 
     if (create_info->descriptorUpdateEntryCount > 0)
     {
-        DescriptorUpdateTemplateWrapper* wrapper = reinterpret_cast<DescriptorUpdateTemplateWrapper*>(update_template);
+        DescriptorUpdateTemplateWrapper* wrapper = GetWrapper<DescriptorUpdateTemplateWrapper>(update_template);
         UpdateTemplateInfo*              info    = &wrapper->info;
 
         for (size_t i = 0; i < create_info->descriptorUpdateEntryCount; ++i)
@@ -1097,6 +2370,76 @@ void TraceManager::SetDescriptorUpdateTemplateInfo(VkDescriptorUpdateTemplate
                 }
             }
         }
+
+        CompileDescriptorUpdateTemplatePlan(info);
+    }
+}
+
+void TraceManager::CompileDescriptorUpdateTemplatePlan(UpdateTemplateInfo* info)
+{
+    assert(info != nullptr);
+
+    std::vector<UpdateTemplateRange> ranges;
+
+    for (const auto& entry_info : info->image_info)
+    {
+        for (size_t i = 0; i < entry_info.count; ++i)
+        {
+            size_t offset = entry_info.offset + (entry_info.stride * i);
+            info->image_info_elements.push_back({ offset, entry_info.type });
+            ranges.push_back({ offset, sizeof(VkDescriptorImageInfo) });
+        }
+    }
+
+    for (const auto& entry_info : info->buffer_info)
+    {
+        for (size_t i = 0; i < entry_info.count; ++i)
+        {
+            size_t offset = entry_info.offset + (entry_info.stride * i);
+            info->buffer_info_offsets.push_back(offset);
+            ranges.push_back({ offset, sizeof(VkDescriptorBufferInfo) });
+        }
+    }
+
+    for (const auto& entry_info : info->texel_buffer_view)
+    {
+        for (size_t i = 0; i < entry_info.count; ++i)
+        {
+            size_t offset = entry_info.offset + (entry_info.stride * i);
+            info->texel_buffer_view_offsets.push_back(offset);
+            ranges.push_back({ offset, sizeof(VkBufferView) });
+        }
+    }
+
+    for (const auto& entry_info : info->acceleration_structure_khr)
+    {
+        for (size_t i = 0; i < entry_info.count; ++i)
+        {
+            size_t offset = entry_info.offset + (entry_info.stride * i);
+            info->acceleration_structure_khr_offsets.push_back(offset);
+            ranges.push_back({ offset, sizeof(VkAccelerationStructureKHR) });
+        }
+    }
+
+    // Merge the descriptors that are adjacent or overlapping in memory, which is the common case of descriptors that
+    // are tightly packed in a struct or array, so that the data is copied with a few large copies.
+    std::sort(ranges.begin(), ranges.end(), [](const UpdateTemplateRange& lhs, const UpdateTemplateRange& rhs) {
+        return lhs.offset < rhs.offset;
+    });
+
+    for (const auto& range : ranges)
+    {
+        if (!info->copy_ranges.empty() &&
+            (range.offset <= (info->copy_ranges.back().offset + info->copy_ranges.back().size)))
+        {
+            auto&  last = info->copy_ranges.back();
+            size_t end  = std::max(last.offset + last.size, range.offset + range.size);
+            last.size   = end - last.offset;
+        }
+        else
+        {
+            info->copy_ranges.push_back(range);
+        }
     }
 }
 
@@ -1109,7 +2452,7 @@ bool TraceManager::GetDescriptorUpdateTemplateInfo(VkDescriptorUpdateTemplate up
 
     if (update_template != VK_NULL_HANDLE)
     {
-        DescriptorUpdateTemplateWrapper* wrapper = reinterpret_cast<DescriptorUpdateTemplateWrapper*>(update_template);
+        DescriptorUpdateTemplateWrapper* wrapper = GetWrapper<DescriptorUpdateTemplateWrapper>(update_template);
 
         (*info) = &wrapper->info;
         found   = true;
@@ -1182,7 +2525,7 @@ VkResult TraceManager::OverrideCreateInstance(const VkInstanceCreateInfo*  pCrea
     if ((result == VK_SUCCESS) && (pCreateInfo->pApplicationInfo != nullptr))
     {
         auto api_version              = pCreateInfo->pApplicationInfo->apiVersion;
-        auto instance_wrapper         = reinterpret_cast<InstanceWrapper*>(*pInstance);
+        auto instance_wrapper         = GetWrapper<InstanceWrapper>(*pInstance);
         instance_wrapper->api_version = api_version;
 
         // Warn when enabled API version is newer than the supported API version.
@@ -1206,15 +2549,17 @@ VkResult TraceManager::OverrideCreateDevice(VkPhysicalDevice             physica
                                             const VkAllocationCallbacks* pAllocator,
                                             VkDevice*                    pDevice)
 {
-    auto                handle_unwrap_memory     = TraceManager::Get()->GetHandleUnwrapMemory();
-    VkPhysicalDevice    physicalDevice_unwrapped = GetWrappedHandle<VkPhysicalDevice>(physicalDevice);
-    VkDeviceCreateInfo* pCreateInfo_unwrapped =
-        const_cast<VkDeviceCreateInfo*>(UnwrapStructPtrHandles(pCreateInfo, handle_unwrap_memory));
+    auto             handle_unwrap_memory     = TraceManager::Get()->GetHandleUnwrapMemory();
+    VkPhysicalDevice physicalDevice_unwrapped = GetWrappedHandle<VkPhysicalDevice>(physicalDevice);
+
+    // The create info is modified, and is always copied, including when the handles are not wrapped.
+    VkDeviceCreateInfo* pCreateInfo_unwrapped = MakeUnwrapStructs(pCreateInfo, 1, handle_unwrap_memory);
+    UnwrapStructHandles(pCreateInfo_unwrapped, handle_unwrap_memory);
 
     assert(pCreateInfo_unwrapped != nullptr);
 
     const InstanceTable* instance_table          = GetInstanceTable(physicalDevice);
-    auto                 physical_device_wrapper = reinterpret_cast<PhysicalDeviceWrapper*>(physicalDevice);
+    auto                 physical_device_wrapper = GetWrapper<PhysicalDeviceWrapper>(physicalDevice);
 
     graphics::VulkanDeviceUtil                device_util;
     graphics::VulkanDevicePropertyFeatureInfo property_feature_info = device_util.EnableRequiredPhysicalDeviceFeatures(
@@ -1229,13 +2574,19 @@ VkResult TraceManager::OverrideCreateDevice(VkPhysicalDevice             physica
     bool has_ext_mem      = false;
     bool has_ext_mem_host = false;
 
+    // External memory is selected per allocation when the device supports host memory import with page alignment.
+    bool import_host_memory = page_guard_auto_external_memory_ &&
+                              SupportsHostMemoryImport(instance_table,
+                                                       physical_device_wrapper->instance_api_version,
+                                                       physicalDevice_unwrapped);
+
     for (size_t i = 0; i < extension_count; ++i)
     {
         auto entry = pCreateInfo_unwrapped->ppEnabledExtensionNames[i];
 
         modified_extensions.push_back(entry);
 
-        if (page_guard_memory_mode_ == kMemoryModeExternal)
+        if ((page_guard_memory_mode_ == kMemoryModeExternal) || import_host_memory)
         {
             if (util::platform::StringCompare(entry, VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME) == 0)
             {
@@ -1269,6 +2620,11 @@ VkResult TraceManager::OverrideCreateDevice(VkPhysicalDevice             physica
             modified_extensions.push_back(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
         }
     }
+    else if (import_host_memory && !has_ext_mem_host)
+    {
+        // The external memory extensions are core with the Vulkan 1.1 devices that are selected for import.
+        modified_extensions.push_back(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
+    }
 
     pCreateInfo_unwrapped->enabledExtensionCount   = static_cast<uint32_t>(modified_extensions.size());
     pCreateInfo_unwrapped->ppEnabledExtensionNames = modified_extensions.data();
@@ -1279,11 +2635,16 @@ VkResult TraceManager::OverrideCreateDevice(VkPhysicalDevice             physica
     {
         assert((pDevice != nullptr) && (*pDevice != VK_NULL_HANDLE));
 
-        auto wrapper = reinterpret_cast<DeviceWrapper*>(*pDevice);
+        auto wrapper = GetWrapper<DeviceWrapper>(*pDevice);
 
         // Track state of physical device properties and features at device creation
         wrapper->property_feature_info = property_feature_info;
 
+        if (import_host_memory)
+        {
+            wrapper->host_memory_import_types = GetHostMemoryImportTypes(wrapper);
+        }
+
         if ((capture_mode_ & kModeTrack) != kModeTrack)
         {
             // The state tracker will set this value when it is enabled. When state tracking is disabled it is set here
@@ -1304,7 +2665,7 @@ VkResult TraceManager::OverrideCreateBuffer(VkDevice                     device,
                                             VkBuffer*                    pBuffer)
 {
     VkResult result           = VK_SUCCESS;
-    auto     device_wrapper   = reinterpret_cast<DeviceWrapper*>(device);
+    auto     device_wrapper   = GetWrapper<DeviceWrapper>(device);
     VkDevice device_unwrapped = device_wrapper->handle;
     auto     device_table     = GetDeviceTable(device);
 
@@ -1360,7 +2721,7 @@ VkResult TraceManager::OverrideCreateBuffer(VkDevice                     device,
             // If the buffer has a device address, write the 'set buffer address' command before writing the API call to
             // create the buffer.  The address will need to be passed to vkCreateBuffer through the pCreateInfo pNext
             // list.
-            auto                      buffer_wrapper = reinterpret_cast<BufferWrapper*>(*pBuffer);
+            auto                      buffer_wrapper = GetWrapper<BufferWrapper>(*pBuffer);
             VkBufferDeviceAddressInfo info           = { VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
             info.pNext                               = nullptr;
             info.buffer                              = buffer_wrapper->handle;
@@ -1393,7 +2754,7 @@ VkResult TraceManager::OverrideCreateAccelerationStructureKHR(VkDevice
                                                               VkAccelerationStructureKHR* pAccelerationStructureKHR)
 {
     auto                                        handle_unwrap_memory = TraceManager::Get()->GetHandleUnwrapMemory();
-    auto                                        device_wrapper       = reinterpret_cast<DeviceWrapper*>(device);
+    auto                                        device_wrapper       = GetWrapper<DeviceWrapper>(device);
     VkDevice                                    device_unwrapped     = device_wrapper->handle;
     const DeviceTable*                          device_table         = GetDeviceTable(device);
     const VkAccelerationStructureCreateInfoKHR* pCreateInfo_unwrapped =
@@ -1419,10 +2780,15 @@ VkResult TraceManager::OverrideCreateAccelerationStructureKHR(VkDevice
         CreateWrappedHandle<DeviceWrapper, NoParentWrapper, AccelerationStructureKHRWrapper>(
             device, NoParentWrapper::kHandleValue, pAccelerationStructureKHR, TraceManager::GetUniqueId);
 
+        if ((capture_mode_ & kModeTrack) == kModeTrack)
+        {
+            state_tracker_->TrackAccelerationStructureKHRBuffer(*pAccelerationStructureKHR, pCreateInfo->buffer);
+        }
+
         if (device_wrapper->property_feature_info.feature_accelerationStructureCaptureReplay)
         {
             AccelerationStructureKHRWrapper* accel_struct_wrapper =
-                reinterpret_cast<AccelerationStructureKHRWrapper*>(*pAccelerationStructureKHR);
+                GetWrapper<AccelerationStructureKHRWrapper>(*pAccelerationStructureKHR);
 
             VkAccelerationStructureDeviceAddressInfoKHR address_info{
                 VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR, nullptr, accel_struct_wrapper->handle
@@ -1453,11 +2819,13 @@ VkResult TraceManager::OverrideAllocateMemory(VkDevice                     devic
     void*                            external_memory = nullptr;
     VkImportMemoryHostPointerInfoEXT import_info;
 
-    auto                  device_wrapper       = reinterpret_cast<DeviceWrapper*>(device);
-    VkDevice              device_unwrapped     = device_wrapper->handle;
-    auto                  handle_unwrap_memory = TraceManager::Get()->GetHandleUnwrapMemory();
-    VkMemoryAllocateInfo* pAllocateInfo_unwrapped =
-        const_cast<VkMemoryAllocateInfo*>(UnwrapStructPtrHandles(pAllocateInfo, handle_unwrap_memory));
+    auto                  device_wrapper          = GetWrapper<DeviceWrapper>(device);
+    VkDevice              device_unwrapped        = device_wrapper->handle;
+    auto                  handle_unwrap_memory    = TraceManager::Get()->GetHandleUnwrapMemory();
+    VkMemoryAllocateInfo* pAllocateInfo_unwrapped = MakeUnwrapStructs(pAllocateInfo, 1, handle_unwrap_memory);
+
+    // The allocate info is modified, and is always copied, including when the handles are not wrapped.
+    UnwrapStructHandles(pAllocateInfo_unwrapped, handle_unwrap_memory);
 
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
     const VkImportAndroidHardwareBufferInfoANDROID* import_ahb_info =
@@ -1489,11 +2857,11 @@ VkResult TraceManager::OverrideAllocateMemory(VkDevice                     devic
         }
     }
 
-    if (page_guard_memory_mode_ == kMemoryModeExternal)
-    {
-        VkMemoryPropertyFlags properties = GetMemoryProperties(device_wrapper, pAllocateInfo->memoryTypeIndex);
+    VkBaseOutStructure* import_parent = nullptr;
 
-        if ((properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    if ((page_guard_memory_mode_ == kMemoryModeExternal) || (device_wrapper->host_memory_import_types != 0))
+    {
+        if (UseExternalMemory(device_wrapper, pAllocateInfo))
         {
             // Use the external memory extension to provide a memory allocation that can be watched directly by the page
             // guard implementation.
@@ -1527,20 +2895,38 @@ VkResult TraceManager::OverrideAllocateMemory(VkDevice                     devic
                     end = end->pNext;
                 }
 
-                end->pNext = reinterpret_cast<VkBaseOutStructure*>(&import_info);
+                end->pNext    = reinterpret_cast<VkBaseOutStructure*>(&import_info);
+                import_parent = end;
             }
         }
     }
 
     result = GetDeviceTable(device)->AllocateMemory(device_unwrapped, pAllocateInfo_unwrapped, pAllocator, pMemory);
 
+    if ((result != VK_SUCCESS) && (import_parent != nullptr) && (page_guard_memory_mode_ != kMemoryModeExternal))
+    {
+        // The memory type was selected for external memory automatically, so fall back to shadow memory when the
+        // driver rejects the import.
+        util::PageGuardManager* manager = util::PageGuardManager::Get();
+        assert(manager != nullptr);
+
+        manager->FreeMemory(external_memory, static_cast<size_t>(pAllocateInfo_unwrapped->allocationSize));
+        external_memory = nullptr;
+
+        import_parent->pNext                    = nullptr;
+        pAllocateInfo_unwrapped->allocationSize = pAllocateInfo->allocationSize;
+
+        result =
+            GetDeviceTable(device)->AllocateMemory(device_unwrapped, pAllocateInfo_unwrapped, pAllocator, pMemory);
+    }
+
     if (result == VK_SUCCESS)
     {
         CreateWrappedHandle<DeviceWrapper, NoParentWrapper, DeviceMemoryWrapper>(
             device, NoParentWrapper::kHandleValue, pMemory, TraceManager::GetUniqueId);
 
         assert(pMemory != nullptr);
-        auto memory_wrapper = reinterpret_cast<DeviceMemoryWrapper*>(*pMemory);
+        auto memory_wrapper = GetWrapper<DeviceMemoryWrapper>(*pMemory);
 
         if (uses_address)
         {
@@ -1662,7 +3048,7 @@ VkResult TraceManager::OverrideCreateRayTracingPipelinesKHR(VkDevice
                                                             const VkAllocationCallbacks*             pAllocator,
                                                             VkPipeline*                              pPipelines)
 {
-    auto                   device_wrapper              = reinterpret_cast<DeviceWrapper*>(device);
+    auto                   device_wrapper              = GetWrapper<DeviceWrapper>(device);
     VkDevice               device_unwrapped            = device_wrapper->handle;
     const DeviceTable*     device_table                = GetDeviceTable(device);
     auto                   handle_unwrap_memory        = TraceManager::Get()->GetHandleUnwrapMemory();
@@ -1708,7 +3094,7 @@ VkResult TraceManager::OverrideCreateRayTracingPipelinesKHR(VkDevice
         {
             for (uint32_t i = 0; i < createInfoCount; ++i)
             {
-                PipelineWrapper* pipeline_wrapper = reinterpret_cast<PipelineWrapper*>(pPipelines[i]);
+                PipelineWrapper* pipeline_wrapper = GetWrapper<PipelineWrapper>(pPipelines[i]);
 
                 uint32_t data_size = device_wrapper->property_feature_info.property_shaderGroupHandleCaptureReplaySize *
                                      pCreateInfos[i].groupCount;
@@ -1738,7 +3124,7 @@ void TraceManager::ProcessEnumeratePhysicalDevices(VkResult          result,
 {
     assert(devices != nullptr);
 
-    auto instance_wrapper = reinterpret_cast<InstanceWrapper*>(instance);
+    auto instance_wrapper = GetWrapper<InstanceWrapper>(instance);
     assert(instance_wrapper != nullptr);
 
     // Write meta-data describing physical device properties on first call to vkEnumeratePhysicalDevices or
@@ -1760,7 +3146,7 @@ void TraceManager::ProcessEnumeratePhysicalDevices(VkResult          result,
                 const InstanceTable* instance_table = GetInstanceTable(physical_device);
                 assert(instance_table != nullptr);
 
-                auto             physical_device_wrapper = reinterpret_cast<PhysicalDeviceWrapper*>(physical_device);
+                auto             physical_device_wrapper = GetWrapper<PhysicalDeviceWrapper>(physical_device);
                 format::HandleId physical_device_id      = physical_device_wrapper->handle_id;
                 VkPhysicalDevice physical_device_handle  = physical_device_wrapper->handle;
                 uint32_t         count                   = 0;
@@ -1792,6 +3178,117 @@ void TraceManager::ProcessEnumeratePhysicalDevices(VkResult          result,
     }
 }
 
+bool TraceManager::SupportsHostMemoryImport(const InstanceTable* instance_table,
+                                            uint32_t             instance_api_version,
+                                            VkPhysicalDevice     physical_device)
+{
+    // The import alignment is retrieved with vkGetPhysicalDeviceProperties2, which is only available to the layer when
+    // it is core, and VK_KHR_external_memory is required by VK_EXT_external_memory_host.
+    if (instance_api_version < VK_MAKE_VERSION(1, 1, 0))
+    {
+        return false;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(physical_device, &properties);
+
+    if (properties.apiVersion < VK_MAKE_VERSION(1, 1, 0))
+    {
+        return false;
+    }
+
+    uint32_t extension_count = 0;
+    instance_table->EnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, nullptr);
+
+    std::vector<VkExtensionProperties> extensions(extension_count);
+    instance_table->EnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, extensions.data());
+
+    auto extension = std::find_if(extensions.begin(), extensions.end(), [](const VkExtensionProperties& entry) {
+        return (util::platform::StringCompare(entry.extensionName, VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME) == 0);
+    });
+
+    if (extension == extensions.end())
+    {
+        return false;
+    }
+
+    VkPhysicalDeviceExternalMemoryHostPropertiesEXT host_properties{
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT, nullptr
+    };
+    VkPhysicalDeviceProperties2 properties2{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, &host_properties };
+    instance_table->GetPhysicalDeviceProperties2(physical_device, &properties2);
+
+    // External memory is allocated by the page guard manager, with page alignment and sizes that are a multiple of the
+    // page size.
+    util::PageGuardManager* manager = util::PageGuardManager::Get();
+    assert(manager != nullptr);
+
+    size_t page_size = manager->GetAlignedSize(1);
+    return (host_properties.minImportedHostPointerAlignment > 0) &&
+           ((page_size % host_properties.minImportedHostPointerAlignment) == 0);
+}
+
+uint32_t TraceManager::GetHostMemoryImportTypes(DeviceWrapper* device_wrapper)
+{
+    util::PageGuardManager* manager = util::PageGuardManager::Get();
+    assert(manager != nullptr);
+
+    // Query the memory types that can import a page of the write watched memory that is used for external memory.
+    uint32_t memory_types = 0;
+    size_t   probe_size   = manager->GetAlignedSize(1);
+    void*    probe        = manager->AllocateMemory(probe_size, true);
+
+    if (probe != nullptr)
+    {
+        VkMemoryHostPointerPropertiesEXT properties{ VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT, nullptr, 0 };
+
+        if (device_wrapper->layer_table.GetMemoryHostPointerPropertiesEXT(
+                device_wrapper->handle, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, probe, &properties) ==
+            VK_SUCCESS)
+        {
+            memory_types = properties.memoryTypeBits;
+        }
+
+        manager->FreeMemory(probe, probe_size);
+    }
+
+    GFXRECON_LOG_DEBUG("Host memory import is supported by memory types 0x%x", memory_types);
+
+    return memory_types;
+}
+
+bool TraceManager::UseExternalMemory(DeviceWrapper* device_wrapper, const VkMemoryAllocateInfo* allocate_info)
+{
+    VkMemoryPropertyFlags properties = GetMemoryProperties(device_wrapper, allocate_info->memoryTypeIndex);
+
+    if ((properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+        return false;
+    }
+    else if (page_guard_memory_mode_ == kMemoryModeExternal)
+    {
+        return true;
+    }
+    else if ((device_wrapper->host_memory_import_types & (1u << allocate_info->memoryTypeIndex)) == 0)
+    {
+        return false;
+    }
+
+    // Dedicated, exported, imported, and device address allocations may not be compatible with host memory import, so
+    // automatic selection only imports memory for allocations without other extension structures.
+    auto next = reinterpret_cast<const VkBaseInStructure*>(allocate_info->pNext);
+    while (next != nullptr)
+    {
+        if (next->sType != VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT)
+        {
+            return false;
+        }
+        next = next->pNext;
+    }
+
+    return true;
+}
+
 VkMemoryPropertyFlags TraceManager::GetMemoryProperties(DeviceWrapper* device_wrapper, uint32_t memory_type_index)
 {
     PhysicalDeviceWrapper*                  physical_device_wrapper = device_wrapper->physical_device;
@@ -1833,9 +3330,11 @@ void TraceManager::ProcessImportAndroidHardwareBuffer(VkDevice         device,
                                                       AHardwareBuffer* hardware_buffer)
 {
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-    auto memory_wrapper = reinterpret_cast<DeviceMemoryWrapper*>(memory);
+    auto memory_wrapper = GetWrapper<DeviceMemoryWrapper>(memory);
     assert((memory_wrapper != nullptr) && (hardware_buffer != nullptr));
 
+    std::lock_guard<std::mutex> lock(hardware_buffers_lock_);
+
     auto entry = hardware_buffers_.find(hardware_buffer);
     if (entry != hardware_buffers_.end())
     {
@@ -1903,19 +3402,13 @@ void TraceManager::ProcessImportAndroidHardwareBuffer(VkDevice         device,
             if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) &&
                 page_guard_track_ahb_memory_)
             {
+                // The buffer content is mostly written by the camera, video decoder, or GPU, which cannot be detected
+                // with page guards.  The content of each block is hashed, and the blocks that changed are written at
+                // queue submission.
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, memory_wrapper->allocation_size);
 
-                util::PageGuardManager* manager = util::PageGuardManager::Get();
-                assert(manager != nullptr);
-
-                manager->AddTrackedMemory(
-                    memory_id,
-                    data,
-                    0,
-                    static_cast<size_t>(memory_wrapper->allocation_size),
-                    util::PageGuardManager::kNullShadowHandle,
-                    false,  // No shadow memory for the imported AHB memory; Track directly with mprotect().
-                    false); // Write watch is not supported for this case.
+                TrackHardwareBufferBlocks(
+                    &ahb_info, plane_info, static_cast<size_t>(memory_wrapper->allocation_size), data);
             }
 
             result = AHardwareBuffer_unlock(hardware_buffer, nullptr);
@@ -1942,17 +3435,11 @@ void TraceManager::ReleaseAndroidHardwareBuffer(AHardwareBuffer* hardware_buffer
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
     assert(hardware_buffer != nullptr);
 
+    std::lock_guard<std::mutex> lock(hardware_buffers_lock_);
+
     auto entry = hardware_buffers_.find(hardware_buffer);
     if ((entry != hardware_buffers_.end()) && (--entry->second.reference_count == 0))
     {
-        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
-        {
-            util::PageGuardManager* manager = util::PageGuardManager::Get();
-            assert(manager != nullptr);
-
-            manager->RemoveTrackedMemory(entry->second.memory_id);
-        }
-
         // There are no more references to the buffer, so we can submit a destroy buffer command.
         WriteDestroyHardwareBufferCmd(entry->first);
         hardware_buffers_.erase(entry);
@@ -1962,6 +3449,135 @@ void TraceManager::ReleaseAndroidHardwareBuffer(AHardwareBuffer* hardware_buffer
 #endif
 }
 
+void TraceManager::TrackHardwareBufferBlocks(HardwareBufferInfo*                                 ahb_info,
+                                             const std::vector<format::HardwareBufferPlaneInfo>& plane_info,
+                                             size_t                                              size,
+                                             const void*                                         data)
+{
+    assert((ahb_info != nullptr) && (data != nullptr));
+
+    // Each plane extends to the start of the next plane, or to the end of the buffer.  The first plane also includes
+    // any data that precedes it.  Without plane info, the buffer is treated as a single plane with an unknown pitch.
+    std::vector<format::HardwareBufferPlaneInfo> planes = plane_info;
+    if (planes.empty())
+    {
+        format::HardwareBufferPlaneInfo plane = {};
+        planes.push_back(plane);
+    }
+
+    std::sort(planes.begin(),
+              planes.end(),
+              [](const format::HardwareBufferPlaneInfo& lhs, const format::HardwareBufferPlaneInfo& rhs) {
+                  return lhs.offset < rhs.offset;
+              });
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    ahb_info->blocks.clear();
+    ahb_info->write_all = false;
+
+    for (size_t i = 0; i < planes.size(); ++i)
+    {
+        size_t begin = (i == 0) ? 0 : static_cast<size_t>(planes[i].offset);
+        size_t end   = ((i + 1) < planes.size()) ? static_cast<size_t>(planes[i + 1].offset) : size;
+        end          = std::min(end, size);
+
+        // Blocks contain whole rows, so that the changed rows of an image are written without their neighbours.
+        size_t block_size = kHardwareBufferBlockSize;
+        size_t row_pitch  = planes[i].row_pitch;
+        if (row_pitch > kHardwareBufferBlockSize)
+        {
+            block_size = row_pitch;
+        }
+        else if (row_pitch > 0)
+        {
+            block_size = (kHardwareBufferBlockSize / row_pitch) * row_pitch;
+        }
+
+        for (size_t offset = begin; offset < end; offset += block_size)
+        {
+            HardwareBufferBlock block;
+            block.offset = offset;
+            block.size   = std::min(block_size, end - offset);
+            block.hash   = util::hash::ContentHash64(bytes + offset, block.size);
+            ahb_info->blocks.push_back(block);
+        }
+    }
+}
+
+void TraceManager::WriteModifiedHardwareBuffers()
+{
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    std::lock_guard<std::mutex> lock(hardware_buffers_lock_);
+
+    for (auto& entry : hardware_buffers_)
+    {
+        HardwareBufferInfo& ahb_info = entry.second;
+        if (ahb_info.blocks.empty())
+        {
+            continue;
+        }
+
+        // The plane layout and blocks from the import are reused, so the buffer does not need to be locked with
+        // AHardwareBuffer_lockPlanes.  The lock is still acquired to synchronize with the producer of the content.
+        void* data   = nullptr;
+        int   result = AHardwareBuffer_lock(entry.first, AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN, -1, nullptr, &data);
+        if (result != 0)
+        {
+            GFXRECON_LOG_ERROR_ONCE(
+                "AHardwareBuffer_lock failed: hardware buffer changes will be omitted from the capture file");
+            continue;
+        }
+
+        assert(data != nullptr);
+
+        const uint8_t* bytes     = static_cast<const uint8_t*>(data);
+        bool           write_all = ahb_info.write_all;
+
+        ahb_info.write_all = false;
+
+        // Consecutive blocks that changed are written with a single fill memory command.
+        size_t run_start = 0;
+        size_t run_size  = 0;
+
+        for (auto& block : ahb_info.blocks)
+        {
+            uint64_t hash    = util::hash::ContentHash64(bytes + block.offset, block.size);
+            bool     changed = write_all || (hash != block.hash);
+
+            if ((run_size > 0) && (!changed || ((run_start + run_size) != block.offset)))
+            {
+                WriteFillMemoryCmd(ahb_info.memory_id, run_start, run_size, data);
+                run_size = 0;
+            }
+
+            if (changed)
+            {
+                block.hash = hash;
+
+                if (run_size == 0)
+                {
+                    run_start = block.offset;
+                }
+
+                run_size += block.size;
+            }
+        }
+
+        if (run_size > 0)
+        {
+            WriteFillMemoryCmd(ahb_info.memory_id, run_start, run_size, data);
+        }
+
+        result = AHardwareBuffer_unlock(entry.first, nullptr);
+        if (result != 0)
+        {
+            GFXRECON_LOG_ERROR("AHardwareBuffer_unlock failed");
+        }
+    }
+#endif
+}
+
 void TraceManager::PostProcess_vkEnumeratePhysicalDevices(VkResult          result,
                                                           VkInstance        instance,
                                                           uint32_t*         pPhysicalDeviceCount,
@@ -2098,7 +3714,7 @@ void TraceManager::PostProcess_vkMapMemory(VkResult         result,
 {
     if ((result == VK_SUCCESS) && (ppData != nullptr))
     {
-        auto wrapper = reinterpret_cast<DeviceMemoryWrapper*>(memory);
+        auto wrapper = GetWrapper<DeviceMemoryWrapper>(memory);
         assert(wrapper != nullptr);
 
         if (wrapper->mapped_data == nullptr)
@@ -2117,13 +3733,24 @@ void TraceManager::PostProcess_vkMapMemory(VkResult         result,
                 wrapper->mapped_size   = size;
             }
 
-            if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard
+            bool use_page_guard = (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard);
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-                // Hardware buffer memory is tracked separately, so VkDeviceMemory mappings should be ignored to avoid
-                // duplicate memory tracking entries.
-                && (wrapper->hardware_buffer == nullptr)
+            // Hardware buffer memory is tracked separately, so VkDeviceMemory mappings should be ignored to avoid
+            // duplicate memory tracking entries.
+            use_page_guard = use_page_guard && (wrapper->hardware_buffer == nullptr);
 #endif
-            )
+
+            if (use_page_guard && trim_dormant_)
+            {
+                // Writes to the mapped memory are not tracked while trimming is dormant.  The memory content is read
+                // when the state snapshot is written, and the mapped range is written at each queue submission after
+                // trimming has been activated.
+                wrapper->unguarded_mapping = true;
+
+                std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+                mapped_memory_.insert(wrapper);
+            }
+            else if (use_page_guard)
             {
                 if (size == VK_WHOLE_SIZE)
                 {
@@ -2142,7 +3769,7 @@ void TraceManager::PostProcess_vkMapMemory(VkResult         result,
                     bool use_shadow_memory = true;
                     bool use_write_watch   = false;
 
-                    if (page_guard_memory_mode_ == kMemoryModeExternal)
+                    if (wrapper->external_allocation != nullptr)
                     {
                         use_shadow_memory = false;
                         use_write_watch   = true;
@@ -2179,7 +3806,8 @@ void TraceManager::PostProcess_vkMapMemory(VkResult         result,
             GFXRECON_LOG_WARNING("VkDeviceMemory object with handle = %" PRIx64 " has been mapped more than once",
                                  memory);
 
-            if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+            if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) &&
+                !wrapper->unguarded_mapping)
             {
                 assert((wrapper->mapped_offset == offset) && (wrapper->mapped_size == size));
 
@@ -2213,7 +3841,7 @@ void TraceManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
 
             for (uint32_t i = 0; i < memoryRangeCount; ++i)
             {
-                auto next_memory_wrapper = reinterpret_cast<const DeviceMemoryWrapper*>(pMemoryRanges[i].memory);
+                auto next_memory_wrapper = GetWrapper<DeviceMemoryWrapper>(pMemoryRanges[i].memory);
 
                 // Currently processing all dirty pages for the mapped memory, so filter multiple ranges from the same
                 // object.
@@ -2238,11 +3866,19 @@ void TraceManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
         }
         else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAssisted)
         {
-            const DeviceMemoryWrapper* current_memory_wrapper = nullptr;
+            struct FlushRange
+            {
+                const DeviceMemoryWrapper* wrapper;
+                VkDeviceSize               begin;
+                VkDeviceSize               end;
+            };
+
+            std::vector<FlushRange> ranges;
+            ranges.reserve(memoryRangeCount);
 
             for (uint32_t i = 0; i < memoryRangeCount; ++i)
             {
-                current_memory_wrapper = reinterpret_cast<const DeviceMemoryWrapper*>(pMemoryRanges[i].memory);
+                auto current_memory_wrapper = GetWrapper<DeviceMemoryWrapper>(pMemoryRanges[i].memory);
 
                 if ((current_memory_wrapper != nullptr) && (current_memory_wrapper->mapped_data != nullptr))
                 {
@@ -2259,9 +3895,33 @@ void TraceManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
                         size = current_memory_wrapper->allocation_size - pMemoryRanges[i].offset;
                     }
 
-                    WriteFillMemoryCmd(
-                        current_memory_wrapper->handle_id, relative_offset, size, current_memory_wrapper->mapped_data);
+                    ranges.push_back({ current_memory_wrapper, relative_offset, relative_offset + size });
+                }
+            }
+
+            // Merge the adjacent and overlapping ranges of each memory object, so that an application that flushes
+            // many small ranges with one call produces one fill memory command per contiguous region.  Ranges are not
+            // deferred to a later call, because replay writes the data when the fill memory command is processed,
+            // and the replayed flush must follow the write.
+            std::sort(ranges.begin(), ranges.end(), [](const FlushRange& lhs, const FlushRange& rhs) {
+                return (lhs.wrapper->handle_id < rhs.wrapper->handle_id) ||
+                       ((lhs.wrapper->handle_id == rhs.wrapper->handle_id) && (lhs.begin < rhs.begin));
+            });
+
+            size_t index = 0;
+            while (index < ranges.size())
+            {
+                FlushRange merged = ranges[index++];
+
+                while ((index < ranges.size()) && (ranges[index].wrapper == merged.wrapper) &&
+                       (ranges[index].begin <= merged.end))
+                {
+                    merged.end = std::max(merged.end, ranges[index].end);
+                    ++index;
                 }
+
+                WriteFillMemoryCmd(
+                    merged.wrapper->handle_id, merged.begin, merged.end - merged.begin, merged.wrapper->mapped_data);
             }
         }
     }
@@ -2269,12 +3929,23 @@ void TraceManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
 
 void TraceManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMemory memory)
 {
-    auto wrapper = reinterpret_cast<DeviceMemoryWrapper*>(memory);
+    auto wrapper = GetWrapper<DeviceMemoryWrapper>(memory);
     assert(wrapper != nullptr);
 
     if (wrapper->mapped_data != nullptr)
     {
-        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+        if (wrapper->unguarded_mapping)
+        {
+            std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+
+            // Write the mapped region, which was mapped while trimming was dormant.
+            WriteMappedMemory(wrapper);
+
+            wrapper->unguarded_mapping = false;
+            wrapper->block_hashes.clear();
+            mapped_memory_.erase(wrapper);
+        }
+        else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -2288,21 +3959,12 @@ void TraceManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMemory memo
         }
         else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
         {
-            VkDeviceSize size = wrapper->mapped_size;
-            if (size == VK_WHOLE_SIZE)
-            {
-                assert(wrapper->mapped_offset <= wrapper->allocation_size);
-                size = wrapper->allocation_size - wrapper->mapped_offset;
-            }
+            std::lock_guard<std::mutex> lock(mapped_memory_lock_);
 
-            // Write the entire mapped region.
-            // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
-            WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+            WriteMappedMemory(wrapper);
 
-            {
-                std::lock_guard<std::mutex> lock(mapped_memory_lock_);
-                mapped_memory_.erase(wrapper);
-            }
+            wrapper->block_hashes.clear();
+            mapped_memory_.erase(wrapper);
         }
 
         if ((capture_mode_ & kModeTrack) == kModeTrack)
@@ -2335,7 +3997,7 @@ void TraceManager::PreProcess_vkFreeMemory(VkDevice                     device,
 
     if (memory != VK_NULL_HANDLE)
     {
-        auto wrapper = reinterpret_cast<DeviceMemoryWrapper*>(memory);
+        auto wrapper = GetWrapper<DeviceMemoryWrapper>(memory);
 
         if (wrapper->mapped_data != nullptr)
         {
@@ -2347,7 +4009,9 @@ void TraceManager::PreProcess_vkFreeMemory(VkDevice                     device,
                 // Remove memory tracking.
                 manager->RemoveTrackedMemory(wrapper->handle_id);
             }
-            else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
+
+            if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted) ||
+                wrapper->unguarded_mapping)
             {
                 std::lock_guard<std::mutex> lock(mapped_memory_lock_);
                 mapped_memory_.erase(wrapper);
@@ -2366,14 +4030,14 @@ void TraceManager::PostProcess_vkFreeMemory(VkDevice                     device,
     if (memory != VK_NULL_HANDLE)
     {
         // Destroy external resources.
-        auto wrapper = reinterpret_cast<DeviceMemoryWrapper*>(memory);
+        auto wrapper = GetWrapper<DeviceMemoryWrapper>(memory);
 
         if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
 
-            if ((page_guard_memory_mode_ == kMemoryModeExternal) && (wrapper->external_allocation != nullptr))
+            if (wrapper->external_allocation != nullptr)
             {
                 size_t external_memory_size = manager->GetAlignedSize(static_cast<size_t>(wrapper->allocation_size));
                 manager->FreeMemory(wrapper->external_allocation, external_memory_size);
@@ -2404,31 +4068,71 @@ void TraceManager::PreProcess_vkQueueSubmit(VkQueue             queue,
     GFXRECON_UNREFERENCED_PARAMETER(pSubmits);
     GFXRECON_UNREFERENCED_PARAMETER(fence);
 
+    // The time is taken before the memory writes, so that it reflects the application's time between calls.
+    if (cpu_timestamps_)
+    {
+        WriteTimestampCommand();
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
     {
         util::PageGuardManager* manager = util::PageGuardManager::Get();
         assert(manager != nullptr);
 
-        manager->ProcessMemoryEntries([this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
-            WriteFillMemoryCmd(memory_id, offset, size, start_address);
-        });
+        // Deduplication and adaptive compression depend on the order that fill memory commands are written, so they
+        // are not supported with parallel processing.
+        if (manager->HasProcessThreads() && ((capture_mode_ & kModeWrite) == kModeWrite) &&
+            (fill_memory_deduplicator_ == nullptr) && (adaptive_compression_ == nullptr))
+        {
+            auto thread_data = GetThreadData();
+            assert(thread_data != nullptr);
+
+            // Fill memory commands are encoded by the page guard manager's worker threads, and are written to the file
+            // by the current thread, ordered by memory ID.  The commands for the modified ranges of a memory object
+            // are encoded in order by a single worker thread.
+            format::ThreadId                                              thread_id = thread_data->thread_id_;
+            std::mutex                                                    blocks_lock;
+            std::map<format::HandleId, std::vector<std::vector<uint8_t>>> blocks;
+
+            manager->ProcessMemoryEntriesParallel(
+                [&](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+                    std::vector<uint8_t> block;
+                    EncodeFillMemoryCmd(thread_id, memory_id, offset, size, start_address, &block);
+
+                    std::lock_guard<std::mutex> lock(blocks_lock);
+                    blocks[memory_id].emplace_back(std::move(block));
+                });
+
+            for (const auto& entry : blocks)
+            {
+                for (const auto& block : entry.second)
+                {
+                    WriteToFile(block.data(), block.size());
+                }
+            }
+        }
+        else
+        {
+            manager->ProcessMemoryEntries([this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+                WriteFillMemoryCmd(memory_id, offset, size, start_address);
+            });
+        }
+
+        if (page_guard_track_ahb_memory_ && ((capture_mode_ & kModeWrite) == kModeWrite))
+        {
+            WriteModifiedHardwareBuffers();
+        }
     }
-    else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
+
+    // Memory that was mapped while trimming was dormant is written in the same way as unassisted memory tracking.
+    if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted) ||
+        (unguarded_memory_ && ((capture_mode_ & kModeWrite) == kModeWrite)))
     {
         std::lock_guard<std::mutex> lock(mapped_memory_lock_);
 
         for (auto wrapper : mapped_memory_)
         {
-            VkDeviceSize size = wrapper->mapped_size;
-            if (size == VK_WHOLE_SIZE)
-            {
-                assert(wrapper->mapped_offset <= wrapper->allocation_size);
-                size = wrapper->allocation_size - wrapper->mapped_offset;
-            }
-
-            // If the memory is mapped, write the entire mapped region.
-            // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
-            WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+            WriteMappedMemory(wrapper);
         }
     }
 }
@@ -2466,7 +4170,7 @@ void TraceManager::PreProcess_vkCreateDescriptorUpdateTemplateKHR(
 
 void TraceManager::PreProcess_vkGetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo)
 {
-    auto device_wrapper = reinterpret_cast<DeviceWrapper*>(device);
+    auto device_wrapper = GetWrapper<DeviceWrapper>(device);
     if (!device_wrapper->property_feature_info.feature_bufferDeviceAddressCaptureReplay)
     {
         GFXRECON_LOG_ERROR_ONCE(
@@ -2479,7 +4183,7 @@ void TraceManager::PreProcess_vkGetBufferDeviceAddress(VkDevice device, const Vk
 void TraceManager::PreProcess_vkGetAccelerationStructureDeviceAddressKHR(
     VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR* pInfo)
 {
-    auto device_wrapper = reinterpret_cast<DeviceWrapper*>(device);
+    auto device_wrapper = GetWrapper<DeviceWrapper>(device);
     if (!device_wrapper->property_feature_info.feature_accelerationStructureCaptureReplay)
     {
         GFXRECON_LOG_WARNING_ONCE(
@@ -2492,7 +4196,7 @@ void TraceManager::PreProcess_vkGetAccelerationStructureDeviceAddressKHR(
 void TraceManager::PreProcess_vkGetRayTracingShaderGroupHandlesKHR(
     VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData)
 {
-    auto device_wrapper = reinterpret_cast<DeviceWrapper*>(device);
+    auto device_wrapper = GetWrapper<DeviceWrapper>(device);
     if (!device_wrapper->property_feature_info.feature_rayTracingPipelineShaderGroupHandleCaptureReplay)
     {
         GFXRECON_LOG_WARNING_ONCE(
@@ -2517,6 +4221,13 @@ void TraceManager::OverrideGetPhysicalDeviceSurfacePresentModesKHR(uint32_t*
 
 void TraceManager::WriteToFile(const void* data, size_t size)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    if (segment_size_ > 0)
+    {
+        segment_bytes_.fetch_add(size, std::memory_order_relaxed);
+    }
+
     file_stream_->Write(data, size);
     if (force_file_flush_)
     {
@@ -2524,5 +4235,27 @@ void TraceManager::WriteToFile(const void* data, size_t size)
     }
 }
 
+void TraceManager::WriteToFile(const util::OutputBuffer* buffers, size_t count)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    if (segment_size_ > 0)
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            size += buffers[i].size;
+        }
+
+        segment_bytes_.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    file_stream_->WriteBuffers(buffers, count);
+    if (force_file_flush_)
+    {
+        file_stream_->Flush();
+    }
+}
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -25,23 +25,36 @@
 #ifndef GFXRECON_ENCODE_TRACE_MANAGER_H
 #define GFXRECON_ENCODE_TRACE_MANAGER_H
 
+#include "encode/adaptive_compression_controller.h"
+#include "encode/api_call_statistics.h"
+#include "encode/batch_compression_stream.h"
+#include "encode/block_alignment_stream.h"
+#include "encode/blob_deduplicator.h"
 #include "encode/capture_settings.h"
+#include "encode/capture_telemetry.h"
 #include "encode/descriptor_update_template_info.h"
+#include "encode/fill_memory_deduplicator.h"
+#include "encode/flight_recorder_stream.h"
+#include "encode/parallel_compression_stream.h"
 #include "encode/parameter_buffer.h"
 #include "encode/parameter_encoder.h"
+#include "encode/trim_content_cache.h"
 #include "encode/vulkan_handle_wrapper_util.h"
 #include "encode/vulkan_handle_wrappers.h"
 #include "encode/vulkan_state_tracker.h"
 #include "format/api_call_id.h"
 #include "format/format.h"
+#include "format/format_util.h"
 #include "format/platform_types.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "generated/generated_vulkan_command_buffer_util.h"
+#include "util/async_output_stream.h"
 #include "util/compressor.h"
+#include "util/counting_output_stream.h"
 #include "util/defines.h"
-#include "util/file_output_stream.h"
 #include "util/keyboard.h"
-#include "util/shared_mutex.h"
+#include "util/output_stream.h"
+#include "util/scalable_shared_mutex.h"
 
 #include "vulkan/vulkan.h"
 
@@ -82,7 +95,9 @@ class TraceManager
 
     static TraceManager* Get() { return instance_; }
 
-    static format::HandleId GetUniqueId() { return ++unique_id_counter_; }
+    // Handle IDs are reserved from the global counter in blocks and handed out from the calling thread's block, so
+    // IDs are unique but are not allocated in creation order across threads.
+    static format::HandleId GetUniqueId();
 
     static const LayerTable* GetLayerTable() { return &layer_table_; }
 
@@ -90,14 +105,14 @@ class TraceManager
 
     void InitDevice(VkDevice* device, PFN_vkGetDeviceProcAddr gpa);
 
-    std::shared_lock<util::SharedMutex> AcquireSharedStateLock()
+    std::shared_lock<util::ScalableSharedMutex> AcquireSharedStateLock()
     {
-        return std::shared_lock<util::SharedMutex>(state_mutex_);
+        return std::shared_lock<util::ScalableSharedMutex>(state_mutex_);
     }
 
-    std::unique_lock<util::SharedMutex> AcquireUniqueStateLock()
+    std::unique_lock<util::ScalableSharedMutex> AcquireUniqueStateLock()
     {
-        return std::move(std::unique_lock<util::SharedMutex>(state_mutex_));
+        return std::move(std::unique_lock<util::ScalableSharedMutex>(state_mutex_));
     }
 
     HandleUnwrapMemory* GetHandleUnwrapMemory()
@@ -118,6 +133,25 @@ class TraceManager
         return nullptr;
     }
 
+    // Command buffer commands are not encoded or tracked while trimming is dormant.  Command buffers that are recorded
+    // while dormant are tracked again from their next vkBeginCommandBuffer after trimming has been activated.
+    ParameterEncoder* BeginTrackedCommandApiCallTrace(VkCommandBuffer command_buffer, format::ApiCallId call_id)
+    {
+        if (trim_dormant_)
+        {
+            if ((call_id == format::ApiCallId::ApiCall_vkBeginCommandBuffer) ||
+                (call_id == format::ApiCallId::ApiCall_vkResetCommandBuffer))
+            {
+                assert(state_tracker_ != nullptr);
+                state_tracker_->TrackDormantCommandBufferReset(command_buffer, call_id);
+            }
+
+            return nullptr;
+        }
+
+        return BeginTrackedApiCallTrace(call_id);
+    }
+
     ParameterEncoder* BeginApiCallTrace(format::ApiCallId call_id)
     {
         if ((capture_mode_ & kModeWrite) == kModeWrite)
@@ -270,7 +304,14 @@ class TraceManager
             state_tracker_->TrackCommand(command_buffer, thread_data->call_id_, thread_data->parameter_buffer_.get());
         }
 
-        EndApiCallTrace();
+        if (command_buffer_streams_ && ((capture_mode_ & kModeWrite) == kModeWrite))
+        {
+            AppendCommandBufferCall(command_buffer);
+        }
+        else
+        {
+            EndApiCallTrace();
+        }
     }
 
     template <typename GetHandlesFunc, typename... GetHandlesArgs>
@@ -287,7 +328,14 @@ class TraceManager
                 command_buffer, thread_data->call_id_, thread_data->parameter_buffer_.get(), func, args...);
         }
 
-        EndApiCallTrace();
+        if (command_buffer_streams_ && ((capture_mode_ & kModeWrite) == kModeWrite))
+        {
+            AppendCommandBufferCall(command_buffer);
+        }
+        else
+        {
+            EndApiCallTrace();
+        }
     }
 
     void EndApiCallTrace();
@@ -298,6 +346,19 @@ class TraceManager
 
     void CheckStartCaptureForTrackMode();
 
+    // Capture file segmentation: starts a new capture file when the current segment reaches its frame or size limit.
+    void CheckContinueCaptureSegment();
+
+    bool CreateCaptureSegment();
+
+    // Flight recorder capture: checks for the capture triggers and starts new recording segments at the end of a frame.
+    void UpdateFlightRecorder();
+
+    void StartFlightRecorderSegment();
+
+    // Returns false when the capture file could not be created.
+    bool WriteFlightRecorderCapture();
+
     bool IsTrimHotkeyPressed();
 
     void WriteDisplayMessageCmd(const char* message);
@@ -492,6 +553,17 @@ class TraceManager
         }
     }
 
+    void PreProcess_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(queue);
+        GFXRECON_UNREFERENCED_PARAMETER(pPresentInfo);
+
+        if (cpu_timestamps_)
+        {
+            WriteTimestampCommand();
+        }
+    }
+
     void PostProcess_vkQueuePresentKHR(VkResult result, VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
     {
         if (((capture_mode_ & kModeTrack) == kModeTrack) && ((result == VK_SUCCESS) || (result == VK_SUBOPTIMAL_KHR)))
@@ -859,6 +931,95 @@ class TraceManager
         // TODO
     }
 
+    void
+    PostProcess_vkCmdBuildAccelerationStructuresKHR(VkCommandBuffer                                    commandBuffer,
+                                                    uint32_t                                           infoCount,
+                                                    const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
+                                                    const VkAccelerationStructureBuildRangeInfoKHR* const*)
+    {
+        if (((capture_mode_ & kModeTrack) == kModeTrack) && trim_optimize_bda_)
+        {
+            assert(state_tracker_ != nullptr);
+            state_tracker_->TrackBuildAccelerationStructuresAddresses(commandBuffer, infoCount, pInfos);
+        }
+    }
+
+    void PostProcess_vkCmdBuildAccelerationStructuresIndirectKHR(
+        VkCommandBuffer                                    commandBuffer,
+        uint32_t                                           infoCount,
+        const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
+        const VkDeviceAddress*                             pIndirectDeviceAddresses,
+        const uint32_t*                                    pIndirectStrides,
+        const uint32_t* const*)
+    {
+        if (((capture_mode_ & kModeTrack) == kModeTrack) && trim_optimize_bda_)
+        {
+            assert(state_tracker_ != nullptr);
+            state_tracker_->TrackBuildAccelerationStructuresAddresses(commandBuffer, infoCount, pInfos);
+
+            if ((pInfos != nullptr) && (pIndirectDeviceAddresses != nullptr) && (pIndirectStrides != nullptr))
+            {
+                for (uint32_t i = 0; i < infoCount; ++i)
+                {
+                    state_tracker_->TrackCommandDeviceAddress(commandBuffer,
+                                                              pIndirectDeviceAddresses[i],
+                                                              static_cast<VkDeviceSize>(pIndirectStrides[i]) *
+                                                                  pInfos[i].geometryCount);
+                }
+            }
+        }
+    }
+
+    void PostProcess_vkCmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer,
+                                                               const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo)
+    {
+        if (((capture_mode_ & kModeTrack) == kModeTrack) && trim_optimize_bda_ && (pInfo != nullptr))
+        {
+            assert(state_tracker_ != nullptr);
+            state_tracker_->TrackCommandDeviceAddress(commandBuffer, pInfo->src.deviceAddress, 0);
+        }
+    }
+
+    void PostProcess_vkCmdTraceRaysKHR(VkCommandBuffer                        commandBuffer,
+                                       const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable,
+                                       const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable,
+                                       const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable,
+                                       const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable,
+                                       uint32_t,
+                                       uint32_t,
+                                       uint32_t)
+    {
+        if (((capture_mode_ & kModeTrack) == kModeTrack) && trim_optimize_bda_)
+        {
+            assert(state_tracker_ != nullptr);
+            state_tracker_->TrackTraceRaysAddresses(commandBuffer,
+                                                    pRaygenShaderBindingTable,
+                                                    pMissShaderBindingTable,
+                                                    pHitShaderBindingTable,
+                                                    pCallableShaderBindingTable);
+        }
+    }
+
+    void PostProcess_vkCmdTraceRaysIndirectKHR(VkCommandBuffer                        commandBuffer,
+                                               const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable,
+                                               const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable,
+                                               VkDeviceAddress                        indirectDeviceAddress)
+    {
+        if (((capture_mode_ & kModeTrack) == kModeTrack) && trim_optimize_bda_)
+        {
+            assert(state_tracker_ != nullptr);
+            state_tracker_->TrackTraceRaysAddresses(commandBuffer,
+                                                    pRaygenShaderBindingTable,
+                                                    pMissShaderBindingTable,
+                                                    pHitShaderBindingTable,
+                                                    pCallableShaderBindingTable);
+            state_tracker_->TrackCommandDeviceAddress(
+                commandBuffer, indirectDeviceAddress, sizeof(VkTraceRaysIndirectCommandKHR));
+        }
+    }
+
     void PostProcess_vkCmdResetQueryPool(VkCommandBuffer commandBuffer,
                                          VkQueryPool     queryPool,
                                          uint32_t        firstQuery,
@@ -961,12 +1122,16 @@ class TraceManager
         std::vector<uint8_t>& GetScratchBuffer() { return scratch_buffer_; }
 
       public:
-        const format::ThreadId                   thread_id_;
-        format::ApiCallId                        call_id_;
-        std::unique_ptr<encode::ParameterBuffer> parameter_buffer_;
-        std::unique_ptr<ParameterEncoder>        parameter_encoder_;
-        std::vector<uint8_t>                     compressed_buffer_;
-        HandleUnwrapMemory                       handle_unwrap_memory_;
+        const format::ThreadId                               thread_id_;
+        format::ApiCallId                                    call_id_;
+        std::unique_ptr<encode::ParameterBuffer>             parameter_buffer_;
+        std::unique_ptr<ParameterEncoder>                    parameter_encoder_;
+        std::vector<uint8_t>                                 compressed_buffer_;
+        HandleUnwrapMemory                                   handle_unwrap_memory_;
+        std::shared_ptr<ApiCallStatistics::ThreadStatistics> call_statistics_;
+        int64_t                                              call_begin_time_;
+        format::HandleId                                     unique_id_next_;
+        format::HandleId                                     unique_id_end_;
 
       private:
         static format::ThreadId GetThreadId();
@@ -981,16 +1146,26 @@ class TraceManager
         std::vector<uint8_t> scratch_buffer_;
     };
 
+    // Range of whole rows of a hardware buffer plane, with the hash of its content when it was last written.
+    struct HardwareBufferBlock
+    {
+        size_t   offset;
+        size_t   size;
+        uint64_t hash;
+    };
+
     struct HardwareBufferInfo
     {
-        format::HandleId      memory_id;
-        std::atomic<uint32_t> reference_count;
+        format::HandleId                 memory_id;
+        std::atomic<uint32_t>            reference_count;
+        std::vector<HardwareBufferBlock> blocks;             // Empty when changes to the content are not tracked.
+        bool                             write_all{ false }; // Write all blocks after a state snapshot.
     };
 
     typedef std::unordered_map<AHardwareBuffer*, HardwareBufferInfo> HardwareBufferMap;
 
   private:
-    ThreadData* GetThreadData()
+    static ThreadData* GetThreadData()
     {
         if (!thread_data_)
         {
@@ -1003,6 +1178,8 @@ class TraceManager
     bool        CreateCaptureFile(const std::string& base_filename);
     void        ActivateTrimming();
     void        DeactivateTrimming();
+    void        AddSeekIndexEntry(format::SeekIndexEntryType type);
+    void        WriteSeekIndex(); // Writes the seek index and footer blocks to the end of the current capture file.
 
     void WriteFileHeader();
     void BuildOptionList(const format::EnabledOptions&        enabled_options,
@@ -1010,12 +1187,47 @@ class TraceManager
 
     ParameterEncoder* InitApiCallTrace(format::ApiCallId call_id);
 
+    void RecordCallStatistics(ThreadData* thread_data, size_t encode_bytes, int64_t write_begin_time);
+
+    // Called from the telemetry thread to sample the queue depth of the capture file writer and the memory overhead
+    // of the capture.
+    void SampleTelemetry(CaptureTelemetry::Sample* sample);
+
+    // Appends the encoded command to the blocks of the command buffer, which are written to the capture file as a
+    // group when the command buffer is ended or reset.
+    void AppendCommandBufferCall(VkCommandBuffer command_buffer);
+
+    void WriteCommandBufferBlocks(CommandBufferWrapper* wrapper, ThreadData* thread_data);
+
     void WriteResizeWindowCmd(format::HandleId surface_id, uint32_t width, uint32_t height);
     void WriteResizeWindowCmd2(format::HandleId              surface_id,
                                uint32_t                      width,
                                uint32_t                      height,
                                VkSurfaceTransformFlagBitsKHR pre_transform);
     void WriteFillMemoryCmd(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size, const void* data);
+
+    // Writes the mapped range of memory that is not tracked by the page guard manager.  With hashed blocks, only the
+    // blocks that changed since they were last written are written.  Must be called with mapped_memory_lock_ held.
+    void WriteMappedMemory(DeviceMemoryWrapper* wrapper);
+
+    // Discards the block hashes of mapped memory and hardware buffers, after a state snapshot that included the memory
+    // content.
+    void ResetMappedMemoryHashes();
+
+    // Encodes a fill memory command into a block that can be written to the file later, compressing the data when
+    // compression reduces its size.  Safe to call concurrently from multiple threads.
+    void EncodeFillMemoryCmd(format::ThreadId      thread_id,
+                             format::HandleId      memory_id,
+                             VkDeviceSize          offset,
+                             VkDeviceSize          size,
+                             const void*           data,
+                             std::vector<uint8_t>* block);
+
+    void WriteFillMemoryFromPreviousBlockCmd(format::HandleId memory_id,
+                                             VkDeviceSize     offset,
+                                             VkDeviceSize     size,
+                                             uint64_t         source_index);
+    void WriteSetBlobDataCmd(uint64_t blob_id, const void* data, size_t size);
     void WriteCreateHardwareBufferCmd(format::HandleId                                    memory_id,
                                       AHardwareBuffer*                                    buffer,
                                       const std::vector<format::HardwareBufferPlaneInfo>& plane_info);
@@ -1026,6 +1238,9 @@ class TraceManager
                                                const VkPhysicalDeviceMemoryProperties& memory_properties);
     void WriteSetOpaqueAddressCommand(format::HandleId device_id, format::HandleId object_id, uint64_t address);
 
+    // Writes the current CPU time, for the queue submission or present call that the thread is starting.
+    void WriteTimestampCommand();
+
     void WriteSetRayTracingShaderGroupHandlesCommand(format::HandleId device_id,
                                                      format::HandleId pipeline_id,
                                                      size_t           data_size,
@@ -1034,6 +1249,9 @@ class TraceManager
     void SetDescriptorUpdateTemplateInfo(VkDescriptorUpdateTemplate                  update_template,
                                          const VkDescriptorUpdateTemplateCreateInfo* create_info);
 
+    // Flattens the entries of the update template info into the per-descriptor encoding and copy plan.
+    static void CompileDescriptorUpdateTemplatePlan(UpdateTemplateInfo* info);
+
     void TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet            set,
                                               VkDescriptorUpdateTemplate update_templat,
                                               const void*                data);
@@ -1041,6 +1259,19 @@ class TraceManager
     void
     ProcessEnumeratePhysicalDevices(VkResult result, VkInstance instance, uint32_t count, VkPhysicalDevice* devices);
 
+    // Returns true when the device supports VK_EXT_external_memory_host with an import alignment that is satisfied by
+    // the page aligned allocations of the page guard manager.
+    bool SupportsHostMemoryImport(const InstanceTable* instance_table,
+                                  uint32_t             instance_api_version,
+                                  VkPhysicalDevice     physical_device);
+
+    // Returns the memory types that can import the write watched memory allocated by the page guard manager.
+    uint32_t GetHostMemoryImportTypes(DeviceWrapper* device_wrapper);
+
+    // Determines if a memory allocation is made from page guard external memory, instead of being tracked with shadow
+    // memory when it is mapped.
+    bool UseExternalMemory(DeviceWrapper* device_wrapper, const VkMemoryAllocateInfo* allocate_info);
+
     VkMemoryPropertyFlags GetMemoryProperties(DeviceWrapper* device_wrapper, uint32_t memory_type_index);
 
     const VkImportAndroidHardwareBufferInfoANDROID*
@@ -1049,24 +1280,33 @@ class TraceManager
     void ProcessImportAndroidHardwareBuffer(VkDevice device, VkDeviceMemory memory, AHardwareBuffer* hardware_buffer);
     void ReleaseAndroidHardwareBuffer(AHardwareBuffer* hardware_buffer);
 
+    // Divides the planes of a hardware buffer into blocks of whole rows, and hashes the content of each block.
+    void TrackHardwareBufferBlocks(HardwareBufferInfo*                                 ahb_info,
+                                   const std::vector<format::HardwareBufferPlaneInfo>& plane_info,
+                                   size_t                                              size,
+                                   const void*                                         data);
+
+    // Writes the blocks of tracked hardware buffers with content that changed since the blocks were last written.
+    void WriteModifiedHardwareBuffers();
+
     void WriteToFile(const void* data, size_t size);
 
+    void WriteToFile(const util::OutputBuffer* buffers, size_t count);
+
     template <size_t N>
     void CombineAndWriteToFile(const std::pair<const void*, size_t> (&buffers)[N])
     {
         static_assert(N != 1, "Use WriteToFile(void*, size) when writing a single buffer.");
 
-        // Combine buffers for a single write.
-        std::vector<uint8_t>& scratch_buffer = GetThreadData()->GetScratchBuffer();
-        scratch_buffer.clear();
+        // Write the buffers as a single block, without copying them to an intermediate buffer.
+        util::OutputBuffer output_buffers[N];
         for (size_t i = 0; i < N; ++i)
         {
-            const uint8_t* const data = reinterpret_cast<const uint8_t*>(buffers[i].first);
-            const size_t         size = buffers[i].second;
-            scratch_buffer.insert(scratch_buffer.end(), data, data + size);
+            output_buffers[i].data = buffers[i].first;
+            output_buffers[i].size = buffers[i].second;
         }
 
-        WriteToFile(scratch_buffer.data(), scratch_buffer.size());
+        WriteToFile(output_buffers, N);
     }
 
   private:
@@ -1076,26 +1316,70 @@ class TraceManager
     static thread_local std::unique_ptr<ThreadData> thread_data_;
     static LayerTable                               layer_table_;
     static std::atomic<format::HandleId>            unique_id_counter_;
-    static util::SharedMutex                        state_mutex_;
+    static util::ScalableSharedMutex                state_mutex_;
     format::EnabledOptions                          file_options_;
-    std::unique_ptr<util::FileOutputStream>         file_stream_;
+    std::unique_ptr<CaptureTelemetry>               telemetry_; // Non-null when publishing telemetry, outlives streams.
+    std::mutex                                      telemetry_stream_lock_; // Guards the streams sampled for telemetry.
+    std::unique_ptr<util::OutputStream>             file_stream_;
     std::string                                     base_filename_;
+    std::string                                     capture_filename_; // Name of the current capture file.
     bool                                            timestamp_filename_;
     bool                                            force_file_flush_;
+    bool                                            async_file_write_;
+    bool                                            memory_mapped_file_;
+    bool                                            io_uring_file_write_;
+    bool                                            thread_segment_write_;
+    uint32_t                                        compression_threads_;
+    ParallelCompressionStream*                      compression_stream_; // Non-null when file_stream_ compresses.
+    util::AsyncOutputStream*                        async_stream_;       // Non-null when file_stream_ is async.
+    uint32_t                                        compression_batch_size_;
+    bool                                            compact_headers_;
+    BatchCompressionStream*                         batch_compression_stream_; // Non-null when file_stream_ batches.
+    FlightRecorderStream*                           flight_recorder_stream_;   // Non-null when recording to memory.
+    std::string                                     recorder_trigger_;
     std::unique_ptr<util::Compressor>               compressor_;
+    format::CompressorOptions                       compressor_options_;
+    std::unique_ptr<AdaptiveCompressionController>  adaptive_compression_; // Non-null when compression is adaptive.
+    std::unique_ptr<ApiCallStatistics>              call_statistics_;      // Non-null when recording call overhead.
+    std::string                                     call_statistics_file_;
+    std::unique_ptr<FillMemoryDeduplicator>         fill_memory_deduplicator_; // Non-null when deduplicating fills.
+    std::unique_ptr<BlobDeduplicator>               blob_deduplicator_;        // Non-null when deduplicating shaders.
+    std::unique_ptr<TrimContentCache>               trim_content_cache_;       // Non-null when caching trim content.
+    bool                                            command_buffer_streams_; // Group command blocks per command buffer.
+    bool                                            cpu_timestamps_;         // Write CPU times of submits and presents.
     CaptureSettings::MemoryTrackingMode             memory_tracking_mode_;
     bool                                            page_guard_align_buffer_sizes_;
     bool                                            page_guard_track_ahb_memory_;
+    bool                                            page_guard_auto_external_memory_; // Select per memory type.
     PageGuardMemoryMode                             page_guard_memory_mode_;
     std::mutex                                      mapped_memory_lock_;
     std::set<DeviceMemoryWrapper*>                  mapped_memory_; // Track mapped memory for unassisted tracking mode.
+    size_t                                          memory_hash_block_size_; // Unassisted block hash size, or 0.
     bool                                            trim_enabled_;
     std::vector<CaptureSettings::TrimRange>         trim_ranges_;
     std::string                                     trim_key_;
+    bool                                            trim_optimize_;
+    bool                                            trim_optimize_bda_; // Resolve device addresses to buffers.
+    bool                                            trim_pipeline_cache_; // Write pipeline cache data to snapshots.
+    bool                                            trim_constant_content_; // Write repeated content as patterns.
+    bool                                            trim_dormant_;     // Only object state is tracked while dormant.
+    bool                                            unguarded_memory_; // Memory was mapped while trimming was dormant.
+    std::string                                     trim_state_filename_; // Non-empty when the state is deferred.
+    uint32_t                                        segment_frames_;      // Frames per capture segment, or 0.
+    uint64_t                                        segment_size_;        // Bytes per capture segment, or 0.
+    uint32_t                                        segment_index_;
+    uint32_t                                        segment_first_frame_;
+    std::atomic<uint64_t>                           segment_bytes_;
+    std::string                                     segment_base_filename_;
+    std::string                                     segment_manifest_filename_;
+    bool                                            file_index_;
+    util::CountingOutputStream*                     counting_stream_; // Non-null when writing a seek index.
+    std::vector<format::SeekIndexEntry>             seek_index_;
     size_t                                          trim_current_range_;
     uint32_t                                        current_frame_;
     std::unique_ptr<VulkanStateTracker>             state_tracker_;
     CaptureMode                                     capture_mode_;
+    std::mutex                                      hardware_buffers_lock_;
     HardwareBufferMap                               hardware_buffers_;
     util::Keyboard                                  keyboard_;
     bool                                            previous_hotkey_state_;
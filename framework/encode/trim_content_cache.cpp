@@ -0,0 +1,90 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/trim_content_cache.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Generations start at one, so that wrappers that have never been tagged are considered clean for every snapshot.
+TrimContentCache::TrimContentCache() : generation_(1), untracked_write_generation_(0) {}
+
+TrimContentCache::~TrimContentCache() {}
+
+const TrimContentCache::Entry*
+TrimContentCache::Find(format::HandleId handle_id, uint32_t aspect, uint64_t dirty_generation)
+{
+    Entry* found = nullptr;
+    auto   entry = entries_.find(EntryKey(handle_id, aspect));
+
+    if ((entry != entries_.end()) && (dirty_generation <= entry->second.generation) &&
+        (GetUntrackedWriteGeneration() <= entry->second.generation))
+    {
+        found            = &entry->second;
+        found->last_used = GetGeneration();
+    }
+
+    return found;
+}
+
+void TrimContentCache::Store(format::HandleId handle_id,
+                             uint32_t         aspect,
+                             size_t           data_size,
+                             bool             compressed,
+                             bool             pattern,
+                             const uint8_t*   data,
+                             size_t           size)
+{
+    assert(data != nullptr);
+
+    Entry& entry     = entries_[EntryKey(handle_id, aspect)];
+    entry.generation = GetGeneration();
+    entry.last_used  = entry.generation;
+    entry.data_size  = data_size;
+    entry.compressed = compressed;
+    entry.pattern    = pattern;
+    entry.data.assign(data, data + size);
+}
+
+void TrimContentCache::EndSnapshot()
+{
+    uint64_t generation = GetGeneration();
+
+    for (auto entry = entries_.begin(); entry != entries_.end();)
+    {
+        if (entry->second.last_used != generation)
+        {
+            entry = entries_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+
+    generation_.store(generation + 1, std::memory_order_relaxed);
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
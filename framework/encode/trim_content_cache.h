@@ -0,0 +1,99 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_TRIM_CONTENT_CACHE_H
+#define GFXRECON_ENCODE_TRIM_CONTENT_CACHE_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Retains the resource content written by a trim state snapshot, so that later snapshots in the same capture session
+// can write the content of resources that have not been modified since the previous snapshot without reading it back
+// from the GPU or compressing it again.
+//
+// Snapshots are numbered by generation.  The state tracker tags buffer and image wrappers with the current generation
+// when they are referenced by a queue submission that may write to them, and tags the cache itself when a submission
+// may write to resources that cannot be identified.  Cached content is valid for a resource as long as neither tag is
+// newer than the generation the content was captured in.  The cache must only be accessed while the state is locked
+// for snapshot writing, except for GetGeneration() and MarkUntrackedWrite().
+class TrimContentCache
+{
+  public:
+    struct Entry
+    {
+        uint64_t             generation{ 0 };     // Generation of the snapshot that captured the content.
+        uint64_t             last_used{ 0 };      // Generation of the last snapshot to write the content.
+        size_t               data_size{ 0 };      // Uncompressed data size.
+        bool                 compressed{ false }; // Content is stored in compressed form.
+        bool                 pattern{ false };    // Content is stored as a pattern that repeats to fill data_size.
+        std::vector<uint8_t> data;
+    };
+
+  public:
+    TrimContentCache();
+
+    ~TrimContentCache();
+
+    uint64_t GetGeneration() const { return generation_.load(std::memory_order_relaxed); }
+
+    uint64_t GetUntrackedWriteGeneration() const { return untracked_write_generation_.load(std::memory_order_relaxed); }
+
+    // Invalidates the content captured by all previous snapshots.
+    void MarkUntrackedWrite() { untracked_write_generation_.store(GetGeneration(), std::memory_order_relaxed); }
+
+    // Returns content for the resource aspect that was captured after the resource was last written, or nullptr.
+    const Entry* Find(format::HandleId handle_id, uint32_t aspect, uint64_t dirty_generation);
+
+    void Store(format::HandleId handle_id,
+               uint32_t         aspect,
+               size_t           data_size,
+               bool             compressed,
+               bool             pattern,
+               const uint8_t*   data,
+               size_t           size);
+
+    // Releases content for resources that were not written by the current snapshot, and starts a new generation.
+    void EndSnapshot();
+
+  private:
+    typedef std::pair<format::HandleId, uint32_t> EntryKey;
+
+  private:
+    std::atomic<uint64_t>     generation_;
+    std::atomic<uint64_t>     untracked_write_generation_;
+    std::map<EntryKey, Entry> entries_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_TRIM_CONTENT_CACHE_H
@@ -0,0 +1,236 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/trim_file_assembler.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+const uint64_t kCopyAll        = UINT64_MAX;
+const size_t   kCopyBufferSize = 1024 * 1024;
+
+bool TrimFileAssembler::Assemble(const std::string&                          capture_filename,
+                                 const std::string&                          state_filename,
+                                 const std::unordered_set<format::HandleId>& buffer_ids,
+                                 const std::unordered_set<format::HandleId>& image_ids,
+                                 bool                                        keep_all_buffers)
+{
+    std::string frames_filename = capture_filename + ".frames";
+
+    if (std::rename(capture_filename.c_str(), frames_filename.c_str()) != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to rename capture file %s for trimmed capture file assembly",
+                           capture_filename.c_str());
+        return false;
+    }
+
+    FILE* frames_file = nullptr;
+    FILE* state_file  = nullptr;
+    FILE* output_file = nullptr;
+    bool  success     = false;
+
+    if ((util::platform::FileOpen(&frames_file, frames_filename.c_str(), "rb") == 0) &&
+        (util::platform::FileOpen(&state_file, state_filename.c_str(), "rb") == 0) &&
+        (util::platform::FileOpen(&output_file, capture_filename.c_str(), "wb") == 0))
+    {
+        success = CopyFileHeader(frames_file, output_file) &&
+                  CopyStateBlocks(state_file, output_file, buffer_ids, image_ids, keep_all_buffers) &&
+                  CopyData(frames_file, output_file, kCopyAll);
+    }
+
+    if (output_file != nullptr)
+    {
+        success = (util::platform::FileClose(output_file) == 0) && success;
+    }
+
+    if (state_file != nullptr)
+    {
+        util::platform::FileClose(state_file);
+    }
+
+    if (frames_file != nullptr)
+    {
+        util::platform::FileClose(frames_file);
+    }
+
+    if (success)
+    {
+        std::remove(frames_filename.c_str());
+        std::remove(state_filename.c_str());
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to assemble trimmed capture file %s; the trimmed frames and state snapshot have "
+                           "been preserved in %s and %s",
+                           capture_filename.c_str(),
+                           frames_filename.c_str(),
+                           state_filename.c_str());
+    }
+
+    return success;
+}
+
+bool TrimFileAssembler::CopyFileHeader(FILE* source, FILE* destination)
+{
+    format::FileHeader file_header;
+
+    if (util::platform::FileRead(&file_header, sizeof(file_header), 1, source) != 1)
+    {
+        return false;
+    }
+
+    if (util::platform::FileWrite(&file_header, sizeof(file_header), 1, destination) != 1)
+    {
+        return false;
+    }
+
+    return CopyData(source, destination, file_header.num_options * sizeof(format::FileOptionPair));
+}
+
+bool TrimFileAssembler::CopyStateBlocks(FILE*                                       source,
+                                        FILE*                                       destination,
+                                        const std::unordered_set<format::HandleId>& buffer_ids,
+                                        const std::unordered_set<format::HandleId>& image_ids,
+                                        bool                                        keep_all_buffers)
+{
+    // The initialization command headers share a common prefix, which is read to identify the resource.  Resource data
+    // may be compressed, but the command headers are always uncompressed.
+    static_assert(offsetof(format::InitBufferCommandHeader, buffer_id) ==
+                      offsetof(format::InitImageCommandHeader, image_id),
+                  "Unexpected resource initialization command header layout");
+
+    const size_t kPrefixSize = offsetof(format::InitBufferCommandHeader, buffer_id) + sizeof(format::HandleId);
+
+    uint8_t  prefix[kPrefixSize];
+    uint64_t omitted_count = 0;
+    uint64_t omitted_size  = 0;
+
+    format::BlockHeader block_header;
+
+    while (util::platform::FileRead(&block_header, sizeof(block_header), 1, source) == 1)
+    {
+        uint64_t prefix_size = std::min<uint64_t>(block_header.size, kPrefixSize - sizeof(block_header));
+        bool     omit        = false;
+
+        memcpy(prefix, &block_header, sizeof(block_header));
+
+        if ((prefix_size > 0) &&
+            (util::platform::FileRead(prefix + sizeof(block_header), static_cast<size_t>(prefix_size), 1, source) != 1))
+        {
+            return false;
+        }
+
+        if ((format::RemoveCompressedBlockBit(block_header.type) == format::kMetaDataBlock) &&
+            (prefix_size == (kPrefixSize - sizeof(block_header))))
+        {
+            format::MetaDataType meta_data_type;
+            format::HandleId     resource_id;
+
+            memcpy(&meta_data_type, prefix + offsetof(format::MetaDataHeader, meta_data_type), sizeof(meta_data_type));
+            memcpy(&resource_id, prefix + offsetof(format::InitBufferCommandHeader, buffer_id), sizeof(resource_id));
+
+            if ((meta_data_type == format::kInitBufferCommand) || (meta_data_type == format::kInitBufferPatternCommand))
+            {
+                omit = !keep_all_buffers && (buffer_ids.find(resource_id) == buffer_ids.end());
+            }
+            else if ((meta_data_type == format::kInitImageCommand) ||
+                     (meta_data_type == format::kInitImagePatternCommand))
+            {
+                omit = (image_ids.find(resource_id) == image_ids.end());
+            }
+        }
+
+        uint64_t remaining_size = block_header.size - prefix_size;
+
+        if (omit)
+        {
+            ++omitted_count;
+            omitted_size += sizeof(block_header) + block_header.size;
+
+            if (!util::platform::FileSeek(source, static_cast<int64_t>(remaining_size), util::platform::FileSeekCurrent))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            size_t write_size = static_cast<size_t>(sizeof(block_header) + prefix_size);
+            if ((util::platform::FileWrite(prefix, write_size, 1, destination) != 1) ||
+                !CopyData(source, destination, remaining_size))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (omitted_count > 0)
+    {
+        GFXRECON_LOG_INFO("Omitted %" PRIu64 " unreferenced resource initialization blocks (%" PRIu64
+                          " bytes) from the trimmed capture file",
+                          omitted_count,
+                          omitted_size);
+    }
+
+    return true;
+}
+
+bool TrimFileAssembler::CopyData(FILE* source, FILE* destination, uint64_t size)
+{
+    std::vector<uint8_t> buffer(static_cast<size_t>(std::min<uint64_t>(size, kCopyBufferSize)));
+
+    while (size > 0)
+    {
+        size_t copy_size = static_cast<size_t>(std::min<uint64_t>(size, buffer.size()));
+        size_t read_size = util::platform::FileRead(buffer.data(), 1, copy_size, source);
+
+        if (read_size == 0)
+        {
+            // Running out of data is only expected when copying to the end of the file.
+            return (size == kCopyAll);
+        }
+
+        if (util::platform::FileWrite(buffer.data(), 1, read_size, destination) != read_size)
+        {
+            return false;
+        }
+
+        if (size != kCopyAll)
+        {
+            size -= read_size;
+        }
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
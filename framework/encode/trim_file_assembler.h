@@ -0,0 +1,67 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_TRIM_FILE_ASSEMBLER_H
+#define GFXRECON_ENCODE_TRIM_FILE_ASSEMBLER_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdio>
+#include <string>
+#include <unordered_set>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Assembles a trimmed capture file from the capture file containing the file header and the trimmed frames, and a
+// separate file containing the state snapshot for the start of the trim range.  The state snapshot is inserted after the
+// file header, omitting the resource initialization blocks for the buffers and images that were not referenced by the
+// trimmed frames.  This produces the same result as running gfxrecon-optimize on the trimmed capture file.
+class TrimFileAssembler
+{
+  public:
+    // When keep_all_buffers is true, only image initialization blocks are omitted.  The state file is deleted after a
+    // successful assembly.
+    static bool Assemble(const std::string&                          capture_filename,
+                         const std::string&                          state_filename,
+                         const std::unordered_set<format::HandleId>& buffer_ids,
+                         const std::unordered_set<format::HandleId>& image_ids,
+                         bool                                        keep_all_buffers);
+
+  private:
+    static bool CopyFileHeader(FILE* source, FILE* destination);
+
+    static bool CopyStateBlocks(FILE*                                       source,
+                                FILE*                                       destination,
+                                const std::unordered_set<format::HandleId>& buffer_ids,
+                                const std::unordered_set<format::HandleId>& image_ids,
+                                bool                                        keep_all_buffers);
+
+    // Copies size bytes, or all remaining bytes when size is UINT64_MAX.
+    static bool CopyData(FILE* source, FILE* destination, uint64_t size);
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_TRIM_FILE_ASSEMBLER_H
@@ -25,6 +25,100 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
+bool HandleSideTables::enabled_ = false;
+
+bool HandleSideTables::SetEnabled(bool enabled)
+{
+    if (enabled && (sizeof(void*) != sizeof(uint64_t)))
+    {
+        GFXRECON_LOG_WARNING("Handle side tables are not supported with 32-bit handles; capture will wrap handles");
+        return false;
+    }
+
+    enabled_ = enabled;
+    return true;
+}
+
+void HandleSideTables::InsertInstanceTable(VkInstance instance, const InstanceTable* table)
+{
+    GetInstanceTables().Insert(reinterpret_cast<uint64_t>(GetDispatchKey(instance)), const_cast<InstanceTable*>(table));
+}
+
+void HandleSideTables::RemoveInstanceTable(VkInstance instance, const InstanceTable* table)
+{
+    GetInstanceTables().Remove(reinterpret_cast<uint64_t>(GetDispatchKey(instance)), const_cast<InstanceTable*>(table));
+}
+
+const InstanceTable* HandleSideTables::FindInstanceTable(const void* handle)
+{
+    return static_cast<const InstanceTable*>(
+        GetInstanceTables().Find(reinterpret_cast<uint64_t>(GetDispatchKey(handle))));
+}
+
+void HandleSideTables::InsertDeviceTable(VkDevice device, const DeviceTable* table)
+{
+    GetDeviceTables().Insert(reinterpret_cast<uint64_t>(GetDispatchKey(device)), const_cast<DeviceTable*>(table));
+}
+
+void HandleSideTables::RemoveDeviceTable(VkDevice device, const DeviceTable* table)
+{
+    GetDeviceTables().Remove(reinterpret_cast<uint64_t>(GetDispatchKey(device)), const_cast<DeviceTable*>(table));
+}
+
+const DeviceTable* HandleSideTables::FindDeviceTable(const void* handle)
+{
+    return static_cast<const DeviceTable*>(GetDeviceTables().Find(reinterpret_cast<uint64_t>(GetDispatchKey(handle))));
+}
+
+HandleSideTables::Table& HandleSideTables::GetInstanceTables()
+{
+    static Table tables;
+    return tables;
+}
+
+HandleSideTables::Table& HandleSideTables::GetDeviceTables()
+{
+    static Table tables;
+    return tables;
+}
+
+void HandleSideTables::Table::Insert(uint64_t key, void* wrapper)
+{
+    Shard&                      shard = shards_[GetShardIndex(key)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto result = shard.wrappers.insert(std::make_pair(key, wrapper));
+    if (!result.second)
+    {
+        // The driver reused a handle value that is still in use, or the object was destroyed without the layer's
+        // knowledge.  The newest object takes the handle.
+        GFXRECON_LOG_WARNING_ONCE("Handle side table entry was replaced for a duplicate driver handle value");
+        result.first->second = wrapper;
+    }
+}
+
+void HandleSideTables::Table::Remove(uint64_t key, void* wrapper)
+{
+    Shard&                      shard = shards_[GetShardIndex(key)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Only remove the entry when it has not been replaced by a newer object with the same handle value.
+    auto entry = shard.wrappers.find(key);
+    if ((entry != shard.wrappers.end()) && (entry->second == wrapper))
+    {
+        shard.wrappers.erase(entry);
+    }
+}
+
+void* HandleSideTables::Table::Find(uint64_t key) const
+{
+    const Shard&                shard = shards_[GetShardIndex(key)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto entry = shard.wrappers.find(key);
+    return (entry != shard.wrappers.end()) ? entry->second : nullptr;
+}
+
 uint64_t GetWrappedHandle(uint64_t object, VkObjectType object_type)
 {
     switch (object_type)
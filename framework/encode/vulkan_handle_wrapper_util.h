@@ -28,9 +28,14 @@
 #include "format/format_util.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/defines.h"
+#include "util/monotonic_allocator.h"
+#include "util/object_pool.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -38,73 +43,178 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 typedef format::HandleId (*PFN_GetHandleId)();
 
-typedef std::vector<uint8_t> HandleUnwrapBuffer;
-
+// Temporary memory for the unwrapped copies of the structures and handle arrays of an API call.  Buffers are allocated
+// from a per-thread monotonic allocator, which acquires its blocks from the thread's memory block pool, and remain
+// valid until the next call to Reset.
 class HandleUnwrapMemory
 {
   public:
-    HandleUnwrapMemory() : current_buffer_(0) {}
+    HandleUnwrapMemory() : allocator_(kBlockSize, kMaxRetainedOversized, true) {}
+
+    uint8_t* GetBuffer(size_t len) { return reinterpret_cast<uint8_t*>(allocator_.AllocateBytes(len)); }
 
-    uint8_t* GetBuffer(size_t len)
+    uint8_t* GetFilledBuffer(const uint8_t* data, size_t len)
     {
-        HandleUnwrapBuffer* next_buffer = nullptr;
-        size_t              next_index  = current_buffer_++;
+        uint8_t* buffer = GetBuffer(len);
 
-        if (next_index < buffers_.size())
+        if (len > 0)
         {
-            next_buffer = &buffers_[next_index];
-
-            if (len > next_buffer->size())
-            {
-                next_buffer->resize(len);
-            }
-        }
-        else
-        {
-            buffers_.emplace_back(len);
-            next_buffer = &buffers_[next_index];
+            std::memcpy(buffer, data, len);
         }
 
-        return next_buffer->data();
+        return buffer;
     }
 
-    uint8_t* GetFilledBuffer(const uint8_t* data, size_t len)
+    void Reset() { allocator_.Clear(false); }
+
+  private:
+    static const size_t kBlockSize{ 16 * 1024 };
+    static const size_t kMaxRetainedOversized{ 2 };
+
+    util::MonotonicAllocator allocator_;
+};
+
+// Tables that map the driver's handles to their wrappers, for the experimental capture mode that returns the driver's
+// handles to the application in place of pointers to the wrappers.  The mode removes the copies that replace wrapped
+// handles with driver handles from the API calls, in exchange for a table lookup for each handle that requires its
+// wrapper.  Wrappers are found by handle value, with a table of hash sharded maps for each handle type, and the
+// dispatch tables of dispatchable handles are found with the loader's dispatch key, which a dispatchable handle
+// shares with its parent instance or device.  The mode requires 64-bit handles, with unique values for the
+// non-dispatchable handles of each type, and must be selected before the first handle is wrapped.
+class HandleSideTables
+{
+  public:
+    static bool IsEnabled() { return enabled_; }
+
+    // Returns false and leaves the mode disabled when handles are not 64-bit.
+    static bool SetEnabled(bool enabled);
+
+    template <typename Wrapper>
+    static void Insert(Wrapper* wrapper)
+    {
+        typedef typename Wrapper::HandleType HandleType;
+        GetTable<HandleType>().Insert(format::ToHandleId(wrapper->handle),
+                                      static_cast<HandleWrapper<HandleType>*>(wrapper));
+    }
+
+    template <typename Wrapper>
+    static void Remove(Wrapper* wrapper)
+    {
+        typedef typename Wrapper::HandleType HandleType;
+        GetTable<HandleType>().Remove(format::ToHandleId(wrapper->handle),
+                                      static_cast<HandleWrapper<HandleType>*>(wrapper));
+    }
+
+    template <typename Wrapper>
+    static Wrapper* Find(typename Wrapper::HandleType handle)
+    {
+        typedef typename Wrapper::HandleType HandleType;
+        return static_cast<Wrapper*>(
+            static_cast<HandleWrapper<HandleType>*>(GetTable<HandleType>().Find(format::ToHandleId(handle))));
+    }
+
+    static void InsertInstanceTable(VkInstance instance, const InstanceTable* table);
+
+    static void RemoveInstanceTable(VkInstance instance, const InstanceTable* table);
+
+    static const InstanceTable* FindInstanceTable(const void* handle);
+
+    static void InsertDeviceTable(VkDevice device, const DeviceTable* table);
+
+    static void RemoveDeviceTable(VkDevice device, const DeviceTable* table);
+
+    static const DeviceTable* FindDeviceTable(const void* handle);
+
+  private:
+    class Table
     {
-        HandleUnwrapBuffer* next_buffer = nullptr;
-        size_t              next_index  = current_buffer_++;
+      public:
+        void Insert(uint64_t key, void* wrapper);
+
+        void Remove(uint64_t key, void* wrapper);
+
+        void* Find(uint64_t key) const;
 
-        if (next_index < buffers_.size())
+      private:
+        static const size_t kShardShift{ 6 };
+        static const size_t kShardCount{ 1 << kShardShift };
+
+        struct Shard
         {
-            next_buffer = &buffers_[next_index];
-            next_buffer->clear();
-            next_buffer->insert(next_buffer->end(), data, data + len);
-        }
-        else
+            mutable std::mutex                  mutex;
+            std::unordered_map<uint64_t, void*> wrappers;
+        };
+
+        // Mixes the low bits of the handle, which are often zero for pointers, into the shard index.
+        static size_t GetShardIndex(uint64_t key)
         {
-            buffers_.emplace_back(data, data + len);
-            next_buffer = &buffers_[next_index];
+            return static_cast<size_t>(((key ^ (key >> 32)) * 0x9E3779B97F4A7C15ull) >> (64 - kShardShift));
         }
 
-        return next_buffer->data();
+      private:
+        Shard shards_[kShardCount];
+    };
+
+    template <typename HandleType>
+    static Table& GetTable()
+    {
+        static Table table;
+        return table;
     }
 
-    void Reset() { current_buffer_ = 0; }
+    // The dispatch key maps are small, with one entry for each instance or device.
+    static Table& GetInstanceTables();
+
+    static Table& GetDeviceTables();
 
   private:
-    size_t                          current_buffer_;
-    std::vector<HandleUnwrapBuffer> buffers_;
+    static bool enabled_;
 };
 
+// Returns the wrapper of a handle that was returned to the application.
+template <typename Wrapper>
+Wrapper* GetWrapper(typename Wrapper::HandleType handle)
+{
+    if (handle == VK_NULL_HANDLE)
+    {
+        return nullptr;
+    }
+    else if (HandleSideTables::IsEnabled())
+    {
+        return HandleSideTables::Find<Wrapper>(handle);
+    }
+
+    return reinterpret_cast<Wrapper*>(handle);
+}
+
+// Returns the handle value that is returned to the application for a wrapper.
+template <typename Wrapper>
+typename Wrapper::HandleType GetApplicationHandle(const Wrapper* wrapper)
+{
+    if (HandleSideTables::IsEnabled())
+    {
+        return wrapper->handle;
+    }
+
+    return reinterpret_cast<typename Wrapper::HandleType>(const_cast<Wrapper*>(wrapper));
+}
+
 template <typename T>
 T GetWrappedHandle(const T& handle)
 {
+    if (HandleSideTables::IsEnabled())
+    {
+        return handle;
+    }
+
     return (handle != VK_NULL_HANDLE) ? reinterpret_cast<HandleWrapper<T>*>(handle)->handle : VK_NULL_HANDLE;
 }
 
 template <typename T>
 format::HandleId GetWrappedId(const T& handle)
 {
-    return (handle != VK_NULL_HANDLE) ? reinterpret_cast<HandleWrapper<T>*>(handle)->handle_id : 0;
+    auto wrapper = GetWrapper<HandleWrapper<T>>(handle);
+    return (wrapper != nullptr) ? wrapper->handle_id : 0;
 }
 
 uint64_t GetWrappedHandle(uint64_t, VkObjectType object_type);
@@ -118,6 +228,11 @@ uint64_t GetWrappedId(uint64_t object, VkDebugReportObjectTypeEXT object_type);
 inline const InstanceTable* GetInstanceTable(VkInstance handle)
 {
     assert(handle != VK_NULL_HANDLE);
+    if (HandleSideTables::IsEnabled())
+    {
+        return HandleSideTables::FindInstanceTable(handle);
+    }
+
     auto wrapper = reinterpret_cast<const InstanceWrapper*>(handle);
     return &wrapper->layer_table;
 }
@@ -125,6 +240,11 @@ inline const InstanceTable* GetInstanceTable(VkInstance handle)
 inline const InstanceTable* GetInstanceTable(VkPhysicalDevice handle)
 {
     assert(handle != VK_NULL_HANDLE);
+    if (HandleSideTables::IsEnabled())
+    {
+        return HandleSideTables::FindInstanceTable(handle);
+    }
+
     auto wrapper = reinterpret_cast<const PhysicalDeviceWrapper*>(handle);
     assert(wrapper->layer_table_ref != nullptr);
     return wrapper->layer_table_ref;
@@ -133,6 +253,11 @@ inline const InstanceTable* GetInstanceTable(VkPhysicalDevice handle)
 inline const DeviceTable* GetDeviceTable(VkDevice handle)
 {
     assert(handle != VK_NULL_HANDLE);
+    if (HandleSideTables::IsEnabled())
+    {
+        return HandleSideTables::FindDeviceTable(handle);
+    }
+
     auto wrapper = reinterpret_cast<const DeviceWrapper*>(handle);
     return &wrapper->layer_table;
 }
@@ -140,6 +265,11 @@ inline const DeviceTable* GetDeviceTable(VkDevice handle)
 inline const DeviceTable* GetDeviceTable(VkQueue handle)
 {
     assert(handle != VK_NULL_HANDLE);
+    if (HandleSideTables::IsEnabled())
+    {
+        return HandleSideTables::FindDeviceTable(handle);
+    }
+
     auto wrapper = reinterpret_cast<const QueueWrapper*>(handle);
     assert(wrapper->layer_table_ref != nullptr);
     return wrapper->layer_table_ref;
@@ -148,11 +278,35 @@ inline const DeviceTable* GetDeviceTable(VkQueue handle)
 inline const DeviceTable* GetDeviceTable(VkCommandBuffer handle)
 {
     assert(handle != VK_NULL_HANDLE);
+    if (HandleSideTables::IsEnabled())
+    {
+        return HandleSideTables::FindDeviceTable(handle);
+    }
+
     auto wrapper = reinterpret_cast<const CommandBufferWrapper*>(handle);
     assert(wrapper->layer_table_ref != nullptr);
     return wrapper->layer_table_ref;
 }
 
+// Wrappers are allocated from per-type object pools, which avoids a system heap allocation for each handle and keeps
+// wrappers of the same type close together in memory.
+template <typename Wrapper>
+Wrapper* AllocateWrapper()
+{
+    return util::ObjectPool<Wrapper>::Create();
+}
+
+template <typename Wrapper>
+void FreeWrapper(Wrapper* wrapper)
+{
+    if (HandleSideTables::IsEnabled())
+    {
+        HandleSideTables::Remove(wrapper);
+    }
+
+    util::ObjectPool<Wrapper>::Destroy(wrapper);
+}
+
 // Wrapper for create wrapper template instantiations that do not make use of all handle parameters.
 struct NoParentWrapper : public HandleWrapper<void*>
 {
@@ -167,11 +321,19 @@ void CreateWrappedDispatchHandle(typename ParentWrapper::HandleType parent,
     assert(handle != nullptr);
     if ((*handle) != VK_NULL_HANDLE)
     {
-        Wrapper* wrapper      = new Wrapper;
+        Wrapper* wrapper      = AllocateWrapper<Wrapper>();
         wrapper->dispatch_key = *reinterpret_cast<void**>(*handle);
         wrapper->handle       = (*handle);
         wrapper->handle_id    = get_id();
 
+        if (HandleSideTables::IsEnabled())
+        {
+            // The driver's handle is returned to the application, and receives its loader dispatch table from the
+            // trampoline function.
+            HandleSideTables::Insert(wrapper);
+            return;
+        }
+
         if (parent != VK_NULL_HANDLE)
         {
             // VkQueue and VkCommandBuffer loader dispatch tables are not assigned until the handles reach the
@@ -192,10 +354,18 @@ void CreateWrappedNonDispatchHandle(typename Wrapper::HandleType* handle, PFN_Ge
     assert(handle != nullptr);
     if ((*handle) != VK_NULL_HANDLE)
     {
-        Wrapper* wrapper   = new Wrapper;
+        Wrapper* wrapper   = AllocateWrapper<Wrapper>();
         wrapper->handle    = (*handle);
         wrapper->handle_id = get_id();
-        (*handle)          = reinterpret_cast<typename Wrapper::HandleType>(wrapper);
+
+        if (HandleSideTables::IsEnabled())
+        {
+            HandleSideTables::Insert(wrapper);
+        }
+        else
+        {
+            (*handle) = reinterpret_cast<typename Wrapper::HandleType>(wrapper);
+        }
     }
 }
 
@@ -216,6 +386,11 @@ inline void CreateWrappedHandle<NoParentWrapper, NoParentWrapper, InstanceWrappe
     PFN_GetHandleId get_id)
 {
     CreateWrappedDispatchHandle<NoParentWrapper, InstanceWrapper>(NoParentWrapper::kHandleValue, handle, get_id);
+
+    if (HandleSideTables::IsEnabled() && ((*handle) != VK_NULL_HANDLE))
+    {
+        HandleSideTables::InsertInstanceTable(*handle, &GetWrapper<InstanceWrapper>(*handle)->layer_table);
+    }
 }
 
 template <>
@@ -228,7 +403,7 @@ inline void CreateWrappedHandle<InstanceWrapper, NoParentWrapper, PhysicalDevice
     assert(parent != VK_NULL_HANDLE);
     assert(handle != nullptr);
 
-    auto parent_wrapper = reinterpret_cast<InstanceWrapper*>(parent);
+    auto parent_wrapper = GetWrapper<InstanceWrapper>(parent);
 
     // Filter duplicate physical device retrieval.
     PhysicalDeviceWrapper* wrapper = nullptr;
@@ -243,13 +418,13 @@ inline void CreateWrappedHandle<InstanceWrapper, NoParentWrapper, PhysicalDevice
 
     if (wrapper != nullptr)
     {
-        (*handle) = reinterpret_cast<VkPhysicalDevice>(wrapper);
+        (*handle) = GetApplicationHandle(wrapper);
     }
     else
     {
         CreateWrappedDispatchHandle<InstanceWrapper, PhysicalDeviceWrapper>(parent, handle, get_id);
 
-        wrapper                  = reinterpret_cast<PhysicalDeviceWrapper*>(*handle);
+        wrapper                  = GetWrapper<PhysicalDeviceWrapper>(*handle);
         wrapper->layer_table_ref = &parent_wrapper->layer_table;
         parent_wrapper->child_physical_devices.push_back(wrapper);
     }
@@ -263,6 +438,11 @@ inline void CreateWrappedHandle<PhysicalDeviceWrapper, NoParentWrapper, DeviceWr
     PFN_GetHandleId get_id)
 {
     CreateWrappedDispatchHandle<PhysicalDeviceWrapper, DeviceWrapper>(VK_NULL_HANDLE, handle, get_id);
+
+    if (HandleSideTables::IsEnabled() && ((*handle) != VK_NULL_HANDLE))
+    {
+        HandleSideTables::InsertDeviceTable(*handle, &GetWrapper<DeviceWrapper>(*handle)->layer_table);
+    }
 }
 
 template <>
@@ -275,7 +455,7 @@ inline void CreateWrappedHandle<DeviceWrapper, NoParentWrapper, QueueWrapper>(
     assert(parent != VK_NULL_HANDLE);
     assert(handle != nullptr);
 
-    auto parent_wrapper = reinterpret_cast<DeviceWrapper*>(parent);
+    auto parent_wrapper = GetWrapper<DeviceWrapper>(parent);
 
     // Filter duplicate physical device retrieval.
     QueueWrapper* wrapper = nullptr;
@@ -290,13 +470,13 @@ inline void CreateWrappedHandle<DeviceWrapper, NoParentWrapper, QueueWrapper>(
 
     if (wrapper != nullptr)
     {
-        (*handle) = reinterpret_cast<VkQueue>(wrapper);
+        (*handle) = GetApplicationHandle(wrapper);
     }
     else
     {
         CreateWrappedDispatchHandle<DeviceWrapper, QueueWrapper>(parent, handle, get_id);
 
-        wrapper                  = reinterpret_cast<QueueWrapper*>(*handle);
+        wrapper                  = GetWrapper<QueueWrapper>(*handle);
         wrapper->layer_table_ref = &parent_wrapper->layer_table;
         parent_wrapper->child_queues.push_back(wrapper);
     }
@@ -315,9 +495,9 @@ inline void CreateWrappedHandle<DeviceWrapper, CommandPoolWrapper, CommandBuffer
 
     // The command pool must keep track of allocated command buffers, whose wrappers will need to be destroyed when the
     // pool is destroyed.
-    auto parent_wrapper    = reinterpret_cast<DeviceWrapper*>(parent);
-    auto co_parent_wrapper = reinterpret_cast<CommandPoolWrapper*>(co_parent);
-    auto wrapper           = reinterpret_cast<CommandBufferWrapper*>(*handle);
+    auto parent_wrapper    = GetWrapper<DeviceWrapper>(parent);
+    auto co_parent_wrapper = GetWrapper<CommandPoolWrapper>(co_parent);
+    auto wrapper           = GetWrapper<CommandBufferWrapper>(*handle);
 
     wrapper->layer_table_ref = &parent_wrapper->layer_table;
     wrapper->parent_pool     = co_parent_wrapper;
@@ -338,8 +518,8 @@ inline void CreateWrappedHandle<DeviceWrapper, DescriptorPoolWrapper, Descriptor
 
     // The descriptor pool must keep track of allocated command buffers, whose wrappers will need to be destroyed when
     // the pool is destroyed.
-    auto parent_wrapper = reinterpret_cast<DescriptorPoolWrapper*>(co_parent);
-    auto wrapper        = reinterpret_cast<DescriptorSetWrapper*>(*handle);
+    auto parent_wrapper = GetWrapper<DescriptorPoolWrapper>(co_parent);
+    auto wrapper        = GetWrapper<DescriptorSetWrapper>(*handle);
 
     parent_wrapper->child_sets.insert(std::make_pair(wrapper->handle_id, wrapper));
     wrapper->parent_pool = parent_wrapper;
@@ -361,7 +541,7 @@ inline void CreateWrappedHandle<PhysicalDeviceWrapper, NoParentWrapper, DisplayK
     if ((*handle) != VK_NULL_HANDLE)
     {
         assert(parent != VK_NULL_HANDLE);
-        auto parent_wrapper = reinterpret_cast<PhysicalDeviceWrapper*>(parent);
+        auto parent_wrapper = GetWrapper<PhysicalDeviceWrapper>(parent);
 
         // Filter duplicate display retrieval.
         DisplayKHRWrapper* wrapper = nullptr;
@@ -376,12 +556,12 @@ inline void CreateWrappedHandle<PhysicalDeviceWrapper, NoParentWrapper, DisplayK
 
         if (wrapper != nullptr)
         {
-            (*handle) = reinterpret_cast<VkDisplayKHR>(wrapper);
+            (*handle) = GetApplicationHandle(wrapper);
         }
         else
         {
             CreateWrappedNonDispatchHandle<DisplayKHRWrapper>(handle, get_id);
-            parent_wrapper->child_displays.push_back(reinterpret_cast<DisplayKHRWrapper*>(*handle));
+            parent_wrapper->child_displays.push_back(GetWrapper<DisplayKHRWrapper>(*handle));
         }
     }
 }
@@ -398,7 +578,7 @@ CreateWrappedHandle<DeviceWrapper, SwapchainKHRWrapper, ImageWrapper>(VkDevice,
     assert(co_parent != VK_NULL_HANDLE);
     assert(handle != nullptr);
 
-    auto parent_wrapper = reinterpret_cast<SwapchainKHRWrapper*>(co_parent);
+    auto parent_wrapper = GetWrapper<SwapchainKHRWrapper>(co_parent);
 
     // Filter duplicate display retrieval.
     ImageWrapper* wrapper = nullptr;
@@ -413,12 +593,12 @@ CreateWrappedHandle<DeviceWrapper, SwapchainKHRWrapper, ImageWrapper>(VkDevice,
 
     if (wrapper != nullptr)
     {
-        (*handle) = reinterpret_cast<VkImage>(wrapper);
+        (*handle) = GetApplicationHandle(wrapper);
     }
     else
     {
         CreateWrappedNonDispatchHandle<ImageWrapper>(handle, get_id);
-        parent_wrapper->child_images.push_back(reinterpret_cast<ImageWrapper*>(*handle));
+        parent_wrapper->child_images.push_back(GetWrapper<ImageWrapper>(*handle));
     }
 }
 
@@ -434,7 +614,7 @@ inline void CreateWrappedHandle<PhysicalDeviceWrapper, DisplayKHRWrapper, Displa
     assert(co_parent != VK_NULL_HANDLE);
     assert(handle != nullptr);
 
-    auto parent_wrapper = reinterpret_cast<DisplayKHRWrapper*>(co_parent);
+    auto parent_wrapper = GetWrapper<DisplayKHRWrapper>(co_parent);
 
     // Display modes can either be retrieved or created; filter duplicate display mode retrieval.
     DisplayModeKHRWrapper* wrapper = nullptr;
@@ -449,12 +629,12 @@ inline void CreateWrappedHandle<PhysicalDeviceWrapper, DisplayKHRWrapper, Displa
 
     if (wrapper != nullptr)
     {
-        (*handle) = reinterpret_cast<VkDisplayModeKHR>(wrapper);
+        (*handle) = GetApplicationHandle(wrapper);
     }
     else
     {
         CreateWrappedNonDispatchHandle<DisplayModeKHRWrapper>(handle, get_id);
-        parent_wrapper->child_display_modes.push_back(reinterpret_cast<DisplayModeKHRWrapper*>(*handle));
+        parent_wrapper->child_display_modes.push_back(GetWrapper<DisplayModeKHRWrapper>(*handle));
     }
 }
 
@@ -477,9 +657,10 @@ void CreateWrappedHandles(typename ParentWrapper::HandleType   parent,
 template <typename Wrapper>
 void DestroyWrappedHandle(typename Wrapper::HandleType handle)
 {
-    if (handle != VK_NULL_HANDLE)
+    auto wrapper = GetWrapper<Wrapper>(handle);
+    if (wrapper != nullptr)
     {
-        delete reinterpret_cast<Wrapper*>(handle);
+        FreeWrapper(wrapper);
     }
 }
 
@@ -488,25 +669,30 @@ inline void DestroyWrappedHandle<InstanceWrapper>(VkInstance handle)
 {
     if (handle != VK_NULL_HANDLE)
     {
-        // Destroy child wrappers.
-        auto wrapper = reinterpret_cast<InstanceWrapper*>(handle);
+        auto wrapper = GetWrapper<InstanceWrapper>(handle);
+
+        if (HandleSideTables::IsEnabled())
+        {
+            HandleSideTables::RemoveInstanceTable(handle, &wrapper->layer_table);
+        }
 
+        // Destroy child wrappers.
         for (auto physical_device_wrapper : wrapper->child_physical_devices)
         {
             for (auto display_wrapper : physical_device_wrapper->child_displays)
             {
                 for (auto display_mode_wrapper : display_wrapper->child_display_modes)
                 {
-                    delete display_mode_wrapper;
+                    FreeWrapper(display_mode_wrapper);
                 }
 
-                delete display_wrapper;
+                FreeWrapper(display_wrapper);
             }
 
-            delete physical_device_wrapper;
+            FreeWrapper(physical_device_wrapper);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -515,15 +701,20 @@ inline void DestroyWrappedHandle<DeviceWrapper>(VkDevice handle)
 {
     if (handle != VK_NULL_HANDLE)
     {
-        // Destroy child wrappers.
-        auto wrapper = reinterpret_cast<DeviceWrapper*>(handle);
+        auto wrapper = GetWrapper<DeviceWrapper>(handle);
 
+        if (HandleSideTables::IsEnabled())
+        {
+            HandleSideTables::RemoveDeviceTable(handle, &wrapper->layer_table);
+        }
+
+        // Destroy child wrappers.
         for (auto queue_wrapper : wrapper->child_queues)
         {
-            delete queue_wrapper;
+            FreeWrapper(queue_wrapper);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -533,10 +724,10 @@ inline void DestroyWrappedHandle<CommandBufferWrapper>(VkCommandBuffer handle)
     if (handle != VK_NULL_HANDLE)
     {
         // Remove from parent list.
-        auto wrapper = reinterpret_cast<CommandBufferWrapper*>(handle);
+        auto wrapper = GetWrapper<CommandBufferWrapper>(handle);
         wrapper->parent_pool->child_buffers.erase(wrapper->handle_id);
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -546,14 +737,14 @@ inline void DestroyWrappedHandle<CommandPoolWrapper>(VkCommandPool handle)
     if (handle != VK_NULL_HANDLE)
     {
         // Destroy child wrappers.
-        auto wrapper = reinterpret_cast<CommandPoolWrapper*>(handle);
+        auto wrapper = GetWrapper<CommandPoolWrapper>(handle);
 
         for (const auto& buffer_wrapper : wrapper->child_buffers)
         {
-            delete buffer_wrapper.second;
+            FreeWrapper(buffer_wrapper.second);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -563,10 +754,10 @@ inline void DestroyWrappedHandle<DescriptorSetWrapper>(VkDescriptorSet handle)
     if (handle != VK_NULL_HANDLE)
     {
         // Remove from parent list.
-        auto wrapper = reinterpret_cast<DescriptorSetWrapper*>(handle);
+        auto wrapper = GetWrapper<DescriptorSetWrapper>(handle);
         wrapper->parent_pool->child_sets.erase(wrapper->handle_id);
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -576,14 +767,14 @@ inline void DestroyWrappedHandle<DescriptorPoolWrapper>(VkDescriptorPool handle)
     if (handle != VK_NULL_HANDLE)
     {
         // Destroy child wrappers.
-        auto wrapper = reinterpret_cast<DescriptorPoolWrapper*>(handle);
+        auto wrapper = GetWrapper<DescriptorPoolWrapper>(handle);
 
         for (const auto& set_wrapper : wrapper->child_sets)
         {
-            delete set_wrapper.second;
+            FreeWrapper(set_wrapper.second);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -593,14 +784,14 @@ inline void DestroyWrappedHandle<SwapchainKHRWrapper>(VkSwapchainKHR handle)
     if (handle != VK_NULL_HANDLE)
     {
         // Destroy child wrappers.
-        auto wrapper = reinterpret_cast<SwapchainKHRWrapper*>(handle);
+        auto wrapper = GetWrapper<SwapchainKHRWrapper>(handle);
 
         for (auto image_wrapper : wrapper->child_images)
         {
-            delete image_wrapper;
+            FreeWrapper(image_wrapper);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -621,10 +812,10 @@ inline void ResetDescriptorPoolWrapper(VkDescriptorPool handle)
     assert(handle != VK_NULL_HANDLE);
 
     // Destroy child wrappers.
-    auto wrapper = reinterpret_cast<DescriptorPoolWrapper*>(handle);
+    auto wrapper = GetWrapper<DescriptorPoolWrapper>(handle);
     for (const auto& set_wrapper : wrapper->child_sets)
     {
-        delete set_wrapper.second;
+        FreeWrapper(set_wrapper.second);
     }
     wrapper->child_sets.clear();
 }
@@ -633,7 +824,7 @@ inline void ResetDescriptorPoolWrapper(VkDescriptorPool handle)
 template <typename Handle>
 const Handle* UnwrapHandles(const Handle* handles, uint32_t len, HandleUnwrapMemory* unwrap_memory)
 {
-    if ((handles != nullptr) && (len > 0))
+    if ((handles != nullptr) && (len > 0) && !HandleSideTables::IsEnabled())
     {
         assert(unwrap_memory != nullptr);
 
@@ -648,7 +839,8 @@ const Handle* UnwrapHandles(const Handle* handles, uint32_t len, HandleUnwrapMem
         return unwrapped_handles;
     }
 
-    // Leave the original memory in place when the pointer is not null, but size is zero.
+    // Leave the original memory in place when the pointer is not null, but size is zero, or when the handles are not
+    // wrapped.
     return handles;
 }
 
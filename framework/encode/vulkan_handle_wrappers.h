@@ -69,7 +69,6 @@ struct HandleWrapper
 
 // clang-format off
 struct ShaderModuleWrapper                  : public HandleWrapper<VkShaderModule> {};
-struct PipelineCacheWrapper                 : public HandleWrapper<VkPipelineCache> {};
 struct SamplerWrapper                       : public HandleWrapper<VkSampler> {};
 struct SamplerYcbcrConversionWrapper        : public HandleWrapper<VkSamplerYcbcrConversion> {};
 struct DebugReportCallbackEXTWrapper        : public HandleWrapper<VkDebugReportCallbackEXT> {};
@@ -138,6 +137,9 @@ struct DeviceWrapper : public HandleWrapper<VkDevice>
 
     // Physical device property & feature state at device creation
     graphics::VulkanDevicePropertyFeatureInfo property_feature_info;
+
+    // Memory types that allocate page guard external memory when external memory is selected automatically.
+    uint32_t host_memory_import_types{ 0 };
 };
 
 struct FenceWrapper : public HandleWrapper<VkFence>
@@ -167,6 +169,14 @@ struct DeviceMemoryWrapper : public HandleWrapper<VkDeviceMemory>
     AHardwareBuffer* hardware_buffer{ nullptr };
     format::HandleId hardware_buffer_memory_id{ format::kNullHandleId };
 
+    // Memory that was mapped while trimming was dormant is not tracked by the page guard manager, so the entire mapped
+    // range is written at queue submission after trimming has been activated.
+    bool unguarded_mapping{ false };
+
+    // Hashes of the blocks of the mapped range that were last written to the capture file, for unassisted memory
+    // tracking with hashed blocks.  Empty when the mapped range has not been written since it was mapped.
+    std::vector<uint64_t> block_hashes;
+
     // State tracking info for memory with device addresses.
     format::HandleId device_id{ format::kNullHandleId };
     VkDeviceAddress  address{ 0 };
@@ -183,6 +193,9 @@ struct BufferWrapper : public HandleWrapper<VkBuffer>
     // State tracking info for buffers with device addresses.
     format::HandleId device_id{ format::kNullHandleId };
     VkDeviceAddress  address{ 0 };
+
+    // Trim content cache generation of the last queue submission that may have written to the buffer.
+    uint64_t dirty_generation{ 0 };
 };
 
 struct ImageWrapper : public HandleWrapper<VkImage>
@@ -199,6 +212,9 @@ struct ImageWrapper : public HandleWrapper<VkImage>
     VkSampleCountFlagBits samples{};
     VkImageTiling         tiling{};
     VkImageLayout         current_layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+
+    // Trim content cache generation of the last queue submission that may have written to the image.
+    uint64_t dirty_generation{ 0 };
 };
 
 struct BufferViewWrapper : public HandleWrapper<VkBufferView>
@@ -236,6 +252,11 @@ struct SemaphoreWrapper : public HandleWrapper<VkSemaphore>
     DeviceWrapper*  device{ nullptr };
 };
 
+struct PipelineCacheWrapper : public HandleWrapper<VkPipelineCache>
+{
+    DeviceWrapper* device{ nullptr };
+};
+
 struct QueryPoolWrapper : public HandleWrapper<VkQueryPool>
 {
     DeviceWrapper*         device{ nullptr };
@@ -251,6 +272,21 @@ struct RenderPassWrapper : public HandleWrapper<VkRenderPass>
     std::vector<VkImageLayout> attachment_final_layouts;
 };
 
+// Image layout transition recorded to a command buffer.
+struct PendingImageLayout
+{
+    ImageWrapper* image{ nullptr };
+    VkImageLayout layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+};
+
+// Query activation or reset recorded to a command buffer.
+struct RecordedQuery
+{
+    QueryPoolWrapper* query_pool{ nullptr };
+    uint32_t          query{ 0 };
+    QueryInfo         info;
+};
+
 struct CommandPoolWrapper;
 struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
 {
@@ -261,25 +297,46 @@ struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
     // when destroyed.
     CommandPoolWrapper* parent_pool{ nullptr };
 
-    // Members for trimming state tracking.
-    VkCommandBufferLevel       level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
-    util::MemoryOutputStream   command_data;
-    std::set<format::HandleId> command_handles[CommandHandleType::NumHandleTypes];
+    // Members for trimming state tracking.  Command data and referenced handle IDs are appended to storage that is
+    // retained when the command buffer is reset, so command buffers that are re-recorded every frame stop allocating
+    // once their storage has grown to fit.  Handle lists may contain duplicates.
+    VkCommandBufferLevel          level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
+    util::MemoryOutputStream      command_data;
+    std::vector<format::HandleId> command_handles[CommandHandleType::NumHandleTypes];
+
+    // Members for command buffer streams.  Encoded command blocks that are written to the capture file as a group when
+    // recording ends.
+    util::MemoryOutputStream pending_blocks;
 
-    // Image layout info tracked for image barriers recorded to the command buffer. To be updated on calls to
+    // Image layout info tracked for image barriers recorded to the command buffer. To be appended on calls to
     // vkCmdPipelineBarrier and vkCmdEndRenderPass and applied to the image wrapper on calls to vkQueueSubmit. To be
     // transferred from secondary command buffers to primary command buffers on calls to vkCmdExecuteCommands.
-    std::unordered_map<ImageWrapper*, VkImageLayout> pending_layouts;
+    //
+    // Entries are appended in recording order, so a later entry for the same image or query replaces an earlier one
+    // when they are applied.  The lists are sorted and deduplicated when recording ends, and their storage is retained
+    // when the command buffer is reset.
+    std::vector<PendingImageLayout> pending_layouts;
 
     // Active query info for queries that have been recorded to this command buffer, which will be transfered to the
     // QueryPoolWrapper as pending queries when the command buffer is submitted to a queue.
-    std::unordered_map<QueryPoolWrapper*, std::unordered_map<uint32_t, QueryInfo>> recorded_queries;
+    std::vector<RecordedQuery> recorded_queries;
 
     // Render pass object tracking for processing image layout transitions. Render pass and framebuffer values
     // for the active render pass instance will be set on calls to vkCmdBeginRenderPass and will be used to update the
     // pending image layout on calls to vkCmdEndRenderPass.
     RenderPassWrapper*  active_render_pass{ nullptr };
     FramebufferWrapper* render_pass_framebuffer{ nullptr };
+
+    // Device address ranges referenced by acceleration structure build and ray tracing commands, which identify the
+    // buffers accessed by the commands for trim optimization.  unknown_address_access is set when a command accesses
+    // memory through addresses that are stored in GPU memory, such as an array of acceleration structure instance
+    // pointers.
+    std::vector<DeviceAddressRange> command_address_ranges;
+    bool                            unknown_address_access{ false };
+
+    // Set when the command buffer was recorded while trimming was dormant, so command_data does not contain the
+    // recorded commands.  Cleared when the command buffer is reset after trimming has been activated.
+    bool dormant_recording{ false };
 };
 
 struct PipelineLayoutWrapper : public HandleWrapper<VkPipelineLayout>
@@ -301,6 +358,10 @@ struct PipelineWrapper : public HandleWrapper<VkPipeline>
     format::HandleId     device_id{ format::kNullHandleId };
     std::vector<uint8_t> shader_group_handle_data;
 
+    // Order of creation, which is needed to create a derivative parent before a derivative child when writing state.
+    // Handle IDs do not reflect creation order for pipelines created by different threads.
+    uint64_t create_sequence{ 0 };
+
     // TODO: Base pipeline
     // TODO: Pipeline cache
 };
@@ -382,6 +443,9 @@ struct SwapchainKHRWrapper : public HandleWrapper<VkSwapchainKHR>
 
 struct AccelerationStructureKHRWrapper : public HandleWrapper<VkAccelerationStructureKHR>
 {
+    // Buffer that provides the storage for the acceleration structure.
+    format::HandleId buffer_id{ format::kNullHandleId };
+
     // State tracking info for buffers with device addresses.
     format::HandleId device_id{ format::kNullHandleId };
     VkDeviceAddress  address{ 0 };
@@ -54,6 +54,14 @@ struct QueryInfo
     uint32_t            queue_family_index{ kInvalidIndex }; // Queue family index for last command buffer submission.
 };
 
+// Range of device addresses referenced by a command, such as acceleration structure geometry data or a shader binding
+// table region.
+struct DeviceAddressRange
+{
+    VkDeviceAddress address{ 0 };
+    VkDeviceSize    size{ 0 };
+};
+
 struct DescriptorBindingInfo
 {
     uint32_t         binding_index{ 0 };
@@ -62,19 +70,31 @@ struct DescriptorBindingInfo
     bool             immutable_samplers{ 0 };
 };
 
+// Descriptor state for the array elements of a binding.  The elements are stored in chunks of kChunkSize, which are
+// allocated when one of their elements is first written, so that large descriptor indexing arrays only store the
+// ranges that the application has written.
 struct DescriptorInfo
 {
-    VkDescriptorType                              type;
-    uint32_t                                      count{ 0 };
-    bool                                          immutable_samplers{ 0 };
-    std::unique_ptr<bool[]>                       written;
-    std::unique_ptr<format::HandleId[]>           handle_ids;  // Image, buffer, or buffer view IDs depending on type.
-    std::unique_ptr<format::HandleId[]>           sampler_ids; // Sampler IDs for image type.
-    std::unique_ptr<VkDescriptorImageInfo[]>      images;
-    std::unique_ptr<VkDescriptorBufferInfo[]>     buffers;
-    std::unique_ptr<VkBufferView[]>               texel_buffer_views;
-    std::unique_ptr<VkAccelerationStructureKHR[]> acceleration_structures;
-    std::unique_ptr<VkDescriptorType[]>           mutable_type;
+    static const uint32_t kChunkShift = 6;
+    static const uint32_t kChunkSize  = 1u << kChunkShift;
+    static const uint32_t kChunkMask  = kChunkSize - 1;
+
+    struct Chunk
+    {
+        uint64_t                                      written{ 0 }; // Bit mask of the written elements.
+        std::unique_ptr<format::HandleId[]>           handle_ids;   // Image, buffer, or buffer view IDs by type.
+        std::unique_ptr<format::HandleId[]>           sampler_ids;  // Sampler IDs for image type.
+        std::unique_ptr<VkDescriptorImageInfo[]>      images;
+        std::unique_ptr<VkDescriptorBufferInfo[]>     buffers;
+        std::unique_ptr<VkBufferView[]>               texel_buffer_views;
+        std::unique_ptr<VkAccelerationStructureKHR[]> acceleration_structures;
+        std::unique_ptr<VkDescriptorType[]>           mutable_type;
+    };
+
+    VkDescriptorType                    type;
+    uint32_t                            count{ 0 };
+    bool                                immutable_samplers{ 0 };
+    std::vector<std::unique_ptr<Chunk>> chunks; // Null for chunks without written elements.
 };
 
 struct CreateDependencyInfo
@@ -30,8 +30,8 @@
 #include "vulkan/vulkan.h"
 
 #include <cassert>
-#include <functional>
 #include <map>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
@@ -126,48 +126,35 @@ class VulkanStateTable
     bool RemoveWrapper(const DeferredOperationKHRWrapper* wrapper)          { return RemoveEntry(wrapper, deferred_operation_khr_map_); }
     bool RemoveWrapper(const PrivateDataSlotEXTWrapper* wrapper)            { return RemoveEntry(wrapper, private_data_slot_ext_map_); }
 
-    void VisitWrappers(std::function<void(const InstanceWrapper*)> visitor) const                      { for (auto entry : instance_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const PhysicalDeviceWrapper*)> visitor) const                { for (auto entry : physical_device_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DeviceWrapper*)> visitor) const                        { for (auto entry : device_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const QueueWrapper*)> visitor) const                         { for (auto entry : queue_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const SemaphoreWrapper*)> visitor) const                     { for (auto entry : semaphore_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const CommandBufferWrapper*)> visitor) const                 { for (auto entry : command_buffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const FenceWrapper*)> visitor) const                         { for (auto entry : fence_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DeviceMemoryWrapper*)> visitor) const                  { for (auto entry : device_memory_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const BufferWrapper*)> visitor) const                        { for (auto entry : buffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const ImageWrapper*)> visitor) const                         { for (auto entry : image_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const EventWrapper*)> visitor) const                         { for (auto entry : event_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const QueryPoolWrapper*)> visitor) const                     { for (auto entry : query_pool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const BufferViewWrapper*)> visitor) const                    { for (auto entry : buffer_view_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const ImageViewWrapper*)> visitor) const                     { for (auto entry : image_view_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const ShaderModuleWrapper*)> visitor) const                  { for (auto entry : shader_module_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const PipelineCacheWrapper*)> visitor) const                 { for (auto entry : pipeline_cache_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const PipelineLayoutWrapper*)> visitor) const                { for (auto entry : pipeline_layout_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const RenderPassWrapper*)> visitor) const                    { for (auto entry : render_pass_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const PipelineWrapper*)> visitor) const                      { for (auto entry : pipeline_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DescriptorSetLayoutWrapper*)> visitor) const           { for (auto entry : descriptor_set_layout_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const SamplerWrapper*)> visitor) const                       { for (auto entry : sampler_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DescriptorPoolWrapper*)> visitor) const                { for (auto entry : descriptor_pool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DescriptorSetWrapper*)> visitor) const                 { for (auto entry : descriptor_set_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const FramebufferWrapper*)> visitor) const                   { for (auto entry : framebuffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const CommandPoolWrapper*)> visitor) const                   { for (auto entry : command_pool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const SamplerYcbcrConversionWrapper*)> visitor) const        { for (auto entry : sampler_ycbcr_conversion_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DescriptorUpdateTemplateWrapper*)> visitor) const      { for (auto entry : descriptor_update_template_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const SurfaceKHRWrapper*)> visitor) const                    { for (auto entry : surface_khr_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const SwapchainKHRWrapper*)> visitor) const                  { for (auto entry : swapchain_khr_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DisplayKHRWrapper*)> visitor) const                    { for (auto entry : display_khr_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DisplayModeKHRWrapper*)> visitor) const                { for (auto entry : display_mode_khr_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DebugReportCallbackEXTWrapper*)> visitor) const        { for (auto entry : debug_report_callback_ext_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const IndirectCommandsLayoutNVWrapper*)> visitor) const      { for (auto entry : indirect_commands_layout_nv_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DebugUtilsMessengerEXTWrapper*)> visitor) const        { for (auto entry : debug_utils_messenger_ext_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const ValidationCacheEXTWrapper*)> visitor) const            { for (auto entry : validation_cache_ext_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const AccelerationStructureKHRWrapper*)> visitor) const      { for (auto entry : acceleration_structure_khr_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const AccelerationStructureNVWrapper*)> visitor) const       { for (auto entry : acceleration_structure_nv_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const PerformanceConfigurationINTELWrapper*)> visitor) const { for (auto entry : performance_configuration_intel_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const DeferredOperationKHRWrapper*)> visitor) const          { for (auto entry : deferred_operation_khr_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(const PrivateDataSlotEXTWrapper*)> visitor) const            { for (auto entry : private_data_slot_ext_map_) { visitor(entry.second); } }
     // clang-format on
 
+    // Calls the visitor for each wrapper of the type accepted by the visitor, in handle ID order.
+    template <typename Visitor>
+    void VisitWrappers(const Visitor& visitor) const
+    {
+        typedef typename VisitorTraits<decltype(&Visitor::operator())>::Wrapper Wrapper;
+        for (const auto& entry : GetMap(static_cast<const Wrapper*>(nullptr)))
+        {
+            visitor(entry.second);
+        }
+    }
+
+    // Retrieves the wrappers of a type in handle ID order, as a contiguous index that can be split into ranges for
+    // concurrent processing.
+    template <typename Wrapper>
+    void GetWrappers(std::vector<const Wrapper*>* wrappers) const
+    {
+        assert(wrappers != nullptr);
+
+        const auto& map = GetMap(static_cast<const Wrapper*>(nullptr));
+        wrappers->clear();
+        wrappers->reserve(map.size());
+        for (const auto& entry : map)
+        {
+            wrappers->push_back(entry.second);
+        }
+    }
+
     //
     // Helper functions for state initialization.
     //
@@ -259,6 +246,59 @@ class VulkanStateTable
     // clang-format off
 
   private:
+    // Deduces the wrapper type from the parameter of a visitor's function call operator.
+    template <typename Function>
+    struct VisitorTraits;
+
+    template <typename Class, typename Result, typename T>
+    struct VisitorTraits<Result (Class::*)(const T*) const>
+    {
+        typedef T Wrapper;
+    };
+
+    // clang-format off
+    const std::map<format::HandleId, InstanceWrapper*>&                      GetMap(const InstanceWrapper*) const                      { return instance_map_; }
+    const std::map<format::HandleId, PhysicalDeviceWrapper*>&                GetMap(const PhysicalDeviceWrapper*) const                { return physical_device_map_; }
+    const std::map<format::HandleId, DeviceWrapper*>&                        GetMap(const DeviceWrapper*) const                        { return device_map_; }
+    const std::map<format::HandleId, QueueWrapper*>&                         GetMap(const QueueWrapper*) const                         { return queue_map_; }
+    const std::map<format::HandleId, SemaphoreWrapper*>&                     GetMap(const SemaphoreWrapper*) const                     { return semaphore_map_; }
+    const std::map<format::HandleId, CommandBufferWrapper*>&                 GetMap(const CommandBufferWrapper*) const                 { return command_buffer_map_; }
+    const std::map<format::HandleId, FenceWrapper*>&                         GetMap(const FenceWrapper*) const                         { return fence_map_; }
+    const std::map<format::HandleId, DeviceMemoryWrapper*>&                  GetMap(const DeviceMemoryWrapper*) const                  { return device_memory_map_; }
+    const std::map<format::HandleId, BufferWrapper*>&                        GetMap(const BufferWrapper*) const                        { return buffer_map_; }
+    const std::map<format::HandleId, ImageWrapper*>&                         GetMap(const ImageWrapper*) const                         { return image_map_; }
+    const std::map<format::HandleId, EventWrapper*>&                         GetMap(const EventWrapper*) const                         { return event_map_; }
+    const std::map<format::HandleId, QueryPoolWrapper*>&                     GetMap(const QueryPoolWrapper*) const                     { return query_pool_map_; }
+    const std::map<format::HandleId, BufferViewWrapper*>&                    GetMap(const BufferViewWrapper*) const                    { return buffer_view_map_; }
+    const std::map<format::HandleId, ImageViewWrapper*>&                     GetMap(const ImageViewWrapper*) const                     { return image_view_map_; }
+    const std::map<format::HandleId, ShaderModuleWrapper*>&                  GetMap(const ShaderModuleWrapper*) const                  { return shader_module_map_; }
+    const std::map<format::HandleId, PipelineCacheWrapper*>&                 GetMap(const PipelineCacheWrapper*) const                 { return pipeline_cache_map_; }
+    const std::map<format::HandleId, PipelineLayoutWrapper*>&                GetMap(const PipelineLayoutWrapper*) const                { return pipeline_layout_map_; }
+    const std::map<format::HandleId, RenderPassWrapper*>&                    GetMap(const RenderPassWrapper*) const                    { return render_pass_map_; }
+    const std::map<format::HandleId, PipelineWrapper*>&                      GetMap(const PipelineWrapper*) const                      { return pipeline_map_; }
+    const std::map<format::HandleId, DescriptorSetLayoutWrapper*>&           GetMap(const DescriptorSetLayoutWrapper*) const           { return descriptor_set_layout_map_; }
+    const std::map<format::HandleId, SamplerWrapper*>&                       GetMap(const SamplerWrapper*) const                       { return sampler_map_; }
+    const std::map<format::HandleId, DescriptorPoolWrapper*>&                GetMap(const DescriptorPoolWrapper*) const                { return descriptor_pool_map_; }
+    const std::map<format::HandleId, DescriptorSetWrapper*>&                 GetMap(const DescriptorSetWrapper*) const                 { return descriptor_set_map_; }
+    const std::map<format::HandleId, FramebufferWrapper*>&                   GetMap(const FramebufferWrapper*) const                   { return framebuffer_map_; }
+    const std::map<format::HandleId, CommandPoolWrapper*>&                   GetMap(const CommandPoolWrapper*) const                   { return command_pool_map_; }
+    const std::map<format::HandleId, SamplerYcbcrConversionWrapper*>&        GetMap(const SamplerYcbcrConversionWrapper*) const        { return sampler_ycbcr_conversion_map_; }
+    const std::map<format::HandleId, DescriptorUpdateTemplateWrapper*>&      GetMap(const DescriptorUpdateTemplateWrapper*) const      { return descriptor_update_template_map_; }
+    const std::map<format::HandleId, SurfaceKHRWrapper*>&                    GetMap(const SurfaceKHRWrapper*) const                    { return surface_khr_map_; }
+    const std::map<format::HandleId, SwapchainKHRWrapper*>&                  GetMap(const SwapchainKHRWrapper*) const                  { return swapchain_khr_map_; }
+    const std::map<format::HandleId, DisplayKHRWrapper*>&                    GetMap(const DisplayKHRWrapper*) const                    { return display_khr_map_; }
+    const std::map<format::HandleId, DisplayModeKHRWrapper*>&                GetMap(const DisplayModeKHRWrapper*) const                { return display_mode_khr_map_; }
+    const std::map<format::HandleId, DebugReportCallbackEXTWrapper*>&        GetMap(const DebugReportCallbackEXTWrapper*) const        { return debug_report_callback_ext_map_; }
+    const std::map<format::HandleId, IndirectCommandsLayoutNVWrapper*>&      GetMap(const IndirectCommandsLayoutNVWrapper*) const      { return indirect_commands_layout_nv_map_; }
+    const std::map<format::HandleId, DebugUtilsMessengerEXTWrapper*>&        GetMap(const DebugUtilsMessengerEXTWrapper*) const        { return debug_utils_messenger_ext_map_; }
+    const std::map<format::HandleId, ValidationCacheEXTWrapper*>&            GetMap(const ValidationCacheEXTWrapper*) const            { return validation_cache_ext_map_; }
+    const std::map<format::HandleId, AccelerationStructureKHRWrapper*>&      GetMap(const AccelerationStructureKHRWrapper*) const      { return acceleration_structure_khr_map_; }
+    const std::map<format::HandleId, AccelerationStructureNVWrapper*>&       GetMap(const AccelerationStructureNVWrapper*) const       { return acceleration_structure_nv_map_; }
+    const std::map<format::HandleId, PerformanceConfigurationINTELWrapper*>& GetMap(const PerformanceConfigurationINTELWrapper*) const { return performance_configuration_intel_map_; }
+    const std::map<format::HandleId, DeferredOperationKHRWrapper*>&          GetMap(const DeferredOperationKHRWrapper*) const          { return deferred_operation_khr_map_; }
+    const std::map<format::HandleId, PrivateDataSlotEXTWrapper*>&            GetMap(const PrivateDataSlotEXTWrapper*) const            { return private_data_slot_ext_map_; }
+    // clang-format on
+
     template <typename T>
     bool InsertEntry(format::HandleId id, T* wrapper, std::map<format::HandleId, T*>& map)
     {
@@ -26,10 +26,40 @@
 #include "graphics/vulkan_util.h"
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
+// Sorts the entries of a command buffer's pending state list by key and removes all but the last recorded entry for
+// each key, which is the entry that takes effect when the list is applied in order.
+template <typename Entry, typename Less>
+static void CompactPendingEntries(std::vector<Entry>* entries, Less less)
+{
+    assert(entries != nullptr);
+
+    if (entries->size() > 1)
+    {
+        std::stable_sort(entries->begin(), entries->end(), less);
+
+        auto output = entries->begin();
+        for (auto entry = entries->begin(); entry != entries->end(); ++entry)
+        {
+            auto next = std::next(entry);
+            if ((next == entries->end()) || less(*entry, *next))
+            {
+                *output++ = *entry;
+            }
+        }
+
+        entries->erase(output, entries->end());
+    }
+}
+
+std::atomic<size_t>   VulkanStateTracker::next_state_table_shard_{ 0 };
+std::atomic<uint64_t> VulkanStateTracker::tracked_data_size_{ 0 };
+
 VulkanStateTracker::VulkanStateTracker() {}
 
 VulkanStateTracker::~VulkanStateTracker() {}
@@ -44,14 +74,7 @@ void VulkanStateTracker::TrackCommandExecution(CommandBufferWrapper*           w
         (call_id == format::ApiCallId::ApiCall_vkResetCommandBuffer))
     {
         // Clear command data on command buffer reset.
-        wrapper->command_data.Reset();
-        wrapper->pending_layouts.clear();
-        wrapper->recorded_queries.clear();
-
-        for (size_t i = 0; i < CommandHandleType::NumHandleTypes; ++i)
-        {
-            wrapper->command_handles[i].clear();
-        }
+        ResetCommandBufferState(wrapper);
     }
 
     if (call_id != format::ApiCallId::ApiCall_vkResetCommandBuffer)
@@ -61,6 +84,22 @@ void VulkanStateTracker::TrackCommandExecution(CommandBufferWrapper*           w
         wrapper->command_data.Write(&size, sizeof(size));
         wrapper->command_data.Write(&call_id, sizeof(call_id));
         wrapper->command_data.Write(parameter_buffer->GetData(), size);
+
+        tracked_data_size_.fetch_add(sizeof(size) + sizeof(call_id) + size, std::memory_order_relaxed);
+    }
+
+    if (call_id == format::ApiCallId::ApiCall_vkEndCommandBuffer)
+    {
+        // Recording is externally synchronized, unlike submission of command buffers that allow simultaneous use.
+        CompactPendingEntries(&wrapper->pending_layouts,
+                              [](const PendingImageLayout& lhs, const PendingImageLayout& rhs) {
+                                  return std::less<const ImageWrapper*>()(lhs.image, rhs.image);
+                              });
+
+        CompactPendingEntries(&wrapper->recorded_queries, [](const RecordedQuery& lhs, const RecordedQuery& rhs) {
+            return std::less<const QueryPoolWrapper*>()(lhs.query_pool, rhs.query_pool) ||
+                   ((lhs.query_pool == rhs.query_pool) && (lhs.query < rhs.query));
+        });
     }
 }
 
@@ -68,18 +107,40 @@ void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool)
 {
     assert(command_pool != VK_NULL_HANDLE);
 
-    auto wrapper = reinterpret_cast<CommandPoolWrapper*>(command_pool);
+    auto wrapper = GetWrapper<CommandPoolWrapper>(command_pool);
 
     for (const auto& entry : wrapper->child_buffers)
     {
-        entry.second->command_data.Reset();
-        entry.second->pending_layouts.clear();
-        entry.second->recorded_queries.clear();
+        ResetCommandBufferState(entry.second);
+    }
+}
 
-        for (size_t i = 0; i < CommandHandleType::NumHandleTypes; ++i)
-        {
-            entry.second->command_handles[i].clear();
-        }
+void VulkanStateTracker::TrackDormantCommandBufferReset(VkCommandBuffer command_buffer, format::ApiCallId call_id)
+{
+    assert(command_buffer != VK_NULL_HANDLE);
+
+    auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
+
+    ResetCommandBufferState(wrapper);
+    wrapper->dormant_recording = (call_id == format::ApiCallId::ApiCall_vkBeginCommandBuffer);
+}
+
+void VulkanStateTracker::ResetCommandBufferState(CommandBufferWrapper* wrapper)
+{
+    assert(wrapper != nullptr);
+
+    tracked_data_size_.fetch_sub(wrapper->command_data.GetDataSize(), std::memory_order_relaxed);
+
+    wrapper->command_data.Reset();
+    wrapper->pending_layouts.clear();
+    wrapper->recorded_queries.clear();
+    wrapper->command_address_ranges.clear();
+    wrapper->unknown_address_access = false;
+    wrapper->dormant_recording      = false;
+
+    for (size_t i = 0; i < CommandHandleType::NumHandleTypes; ++i)
+    {
+        wrapper->command_handles[i].clear();
     }
 }
 
@@ -88,7 +149,7 @@ void VulkanStateTracker::TrackPhysicalDeviceMemoryProperties(VkPhysicalDevice
 {
     assert((physical_device != VK_NULL_HANDLE) && (properties != nullptr));
 
-    auto wrapper = reinterpret_cast<PhysicalDeviceWrapper*>(physical_device);
+    auto wrapper = GetWrapper<PhysicalDeviceWrapper>(physical_device);
 
     wrapper->memory_properties = *properties;
 }
@@ -99,7 +160,7 @@ void VulkanStateTracker::TrackPhysicalDeviceQueueFamilyProperties(VkPhysicalDevi
 {
     assert((physical_device != VK_NULL_HANDLE) && (properties != nullptr));
 
-    auto wrapper                             = reinterpret_cast<PhysicalDeviceWrapper*>(physical_device);
+    auto wrapper                             = GetWrapper<PhysicalDeviceWrapper>(physical_device);
     wrapper->queue_family_properties_call_id = format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties;
     wrapper->queue_family_properties_count   = property_count;
     wrapper->queue_family_properties         = std::make_unique<VkQueueFamilyProperties[]>(property_count);
@@ -113,7 +174,7 @@ void VulkanStateTracker::TrackPhysicalDeviceQueueFamilyProperties2(format::ApiCa
 {
     assert((physical_device != VK_NULL_HANDLE) && (properties != nullptr));
 
-    auto wrapper                             = reinterpret_cast<PhysicalDeviceWrapper*>(physical_device);
+    auto wrapper                             = GetWrapper<PhysicalDeviceWrapper>(physical_device);
     wrapper->queue_family_properties_call_id = call_id;
     wrapper->queue_family_properties_count   = property_count;
     wrapper->queue_family_properties2        = std::make_unique<VkQueueFamilyProperties2[]>(property_count);
@@ -160,7 +221,7 @@ void VulkanStateTracker::TrackPhysicalDeviceSurfaceSupport(VkPhysicalDevice phys
 {
     assert((physical_device != VK_NULL_HANDLE) && (surface != VK_NULL_HANDLE));
 
-    auto  wrapper             = reinterpret_cast<SurfaceKHRWrapper*>(surface);
+    auto  wrapper             = GetWrapper<SurfaceKHRWrapper>(surface);
     auto& entry               = wrapper->surface_support[GetWrappedId(physical_device)];
     entry[queue_family_index] = supported;
 }
@@ -171,7 +232,7 @@ void VulkanStateTracker::TrackPhysicalDeviceSurfaceCapabilities(VkPhysicalDevice
 {
     assert((physical_device != VK_NULL_HANDLE) && (surface != VK_NULL_HANDLE));
 
-    auto wrapper                                                 = reinterpret_cast<SurfaceKHRWrapper*>(surface);
+    auto wrapper                                                 = GetWrapper<SurfaceKHRWrapper>(surface);
     wrapper->surface_capabilities[GetWrappedId(physical_device)] = capabilities;
 }
 
@@ -182,7 +243,7 @@ void VulkanStateTracker::TrackPhysicalDeviceSurfaceFormats(VkPhysicalDevice
 {
     assert((physical_device != VK_NULL_HANDLE) && (surface != VK_NULL_HANDLE) && (formats != nullptr));
 
-    auto  wrapper = reinterpret_cast<SurfaceKHRWrapper*>(surface);
+    auto  wrapper = GetWrapper<SurfaceKHRWrapper>(surface);
     auto& entry   = wrapper->surface_formats[GetWrappedId(physical_device)];
     entry.assign(formats, formats + format_count);
 }
@@ -194,7 +255,7 @@ void VulkanStateTracker::TrackPhysicalDeviceSurfacePresentModes(VkPhysicalDevice
 {
     assert((physical_device != VK_NULL_HANDLE) && (surface != VK_NULL_HANDLE) && (modes != nullptr));
 
-    auto  wrapper = reinterpret_cast<SurfaceKHRWrapper*>(surface);
+    auto  wrapper = GetWrapper<SurfaceKHRWrapper>(surface);
     auto& entry   = wrapper->surface_present_modes[GetWrappedId(physical_device)];
     entry.assign(modes, modes + mode_count);
 }
@@ -203,7 +264,7 @@ void VulkanStateTracker::TrackBufferDeviceAddress(VkDevice device, VkBuffer buff
 {
     assert((device != VK_NULL_HANDLE) && (buffer != VK_NULL_HANDLE));
 
-    auto wrapper       = reinterpret_cast<BufferWrapper*>(buffer);
+    auto wrapper       = GetWrapper<BufferWrapper>(buffer);
     wrapper->device_id = GetWrappedId(device);
     wrapper->address   = address;
 }
@@ -215,8 +276,8 @@ void VulkanStateTracker::TrackBufferMemoryBinding(VkDevice       device,
 {
     assert((device != VK_NULL_HANDLE) && (buffer != VK_NULL_HANDLE) && (memory != VK_NULL_HANDLE));
 
-    auto wrapper            = reinterpret_cast<BufferWrapper*>(buffer);
-    wrapper->bind_device    = reinterpret_cast<DeviceWrapper*>(device);
+    auto wrapper            = GetWrapper<BufferWrapper>(buffer);
+    wrapper->bind_device    = GetWrapper<DeviceWrapper>(device);
     wrapper->bind_memory_id = GetWrappedId(memory);
     wrapper->bind_offset    = memoryOffset;
 }
@@ -228,8 +289,8 @@ void VulkanStateTracker::TrackImageMemoryBinding(VkDevice       device,
 {
     assert((device != VK_NULL_HANDLE) && (image != VK_NULL_HANDLE) && (memory != VK_NULL_HANDLE));
 
-    auto wrapper            = reinterpret_cast<ImageWrapper*>(image);
-    wrapper->bind_device    = reinterpret_cast<DeviceWrapper*>(device);
+    auto wrapper            = GetWrapper<ImageWrapper>(image);
+    wrapper->bind_device    = GetWrapper<DeviceWrapper>(device);
     wrapper->bind_memory_id = GetWrappedId(memory);
     wrapper->bind_offset    = memoryOffset;
 }
@@ -243,8 +304,8 @@ void VulkanStateTracker::TrackMappedMemory(VkDevice         device,
 {
     assert((device != VK_NULL_HANDLE) && (memory != VK_NULL_HANDLE));
 
-    auto wrapper           = reinterpret_cast<DeviceMemoryWrapper*>(memory);
-    wrapper->map_device    = reinterpret_cast<DeviceWrapper*>(device);
+    auto wrapper           = GetWrapper<DeviceMemoryWrapper>(memory);
+    wrapper->map_device    = GetWrapper<DeviceWrapper>(device);
     wrapper->mapped_data   = mapped_data;
     wrapper->mapped_offset = mapped_offset;
     wrapper->mapped_size   = mapped_size;
@@ -255,16 +316,16 @@ void VulkanStateTracker::TrackBeginRenderPass(VkCommandBuffer command_buffer, co
 {
     assert((command_buffer != VK_NULL_HANDLE) && (begin_info != nullptr));
 
-    auto wrapper                     = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
-    wrapper->active_render_pass      = reinterpret_cast<RenderPassWrapper*>(begin_info->renderPass);
-    wrapper->render_pass_framebuffer = reinterpret_cast<FramebufferWrapper*>(begin_info->framebuffer);
+    auto wrapper                     = GetWrapper<CommandBufferWrapper>(command_buffer);
+    wrapper->active_render_pass      = GetWrapper<RenderPassWrapper>(begin_info->renderPass);
+    wrapper->render_pass_framebuffer = GetWrapper<FramebufferWrapper>(begin_info->framebuffer);
 }
 
 void VulkanStateTracker::TrackEndRenderPass(VkCommandBuffer command_buffer)
 {
     assert(command_buffer != VK_NULL_HANDLE);
 
-    auto wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
+    auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
     assert((wrapper->active_render_pass != VK_NULL_HANDLE) && (wrapper->render_pass_framebuffer != VK_NULL_HANDLE));
 
     auto render_pass_wrapper = wrapper->active_render_pass;
@@ -276,8 +337,8 @@ void VulkanStateTracker::TrackEndRenderPass(VkCommandBuffer command_buffer)
 
     for (uint32_t i = 0; i < attachment_count; ++i)
     {
-        wrapper->pending_layouts[framebuffer_wrapper->attachments[i]] =
-            render_pass_wrapper->attachment_final_layouts[i];
+        wrapper->pending_layouts.push_back(
+            { framebuffer_wrapper->attachments[i], render_pass_wrapper->attachment_final_layouts[i] });
     }
 
     // Clear the active render pass state now that the pass has ended.
@@ -291,35 +352,20 @@ void VulkanStateTracker::TrackExecuteCommands(VkCommandBuffer        command_buf
 {
     assert((command_buffer != VK_NULL_HANDLE) && (command_buffers != nullptr));
 
-    auto primary_wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
+    auto primary_wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
 
     for (uint32_t i = 0; i < command_buffer_count; ++i)
     {
-        auto secondary_wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffers[i]);
+        auto secondary_wrapper = GetWrapper<CommandBufferWrapper>(command_buffers[i]);
         assert(secondary_wrapper != nullptr);
 
-        for (const auto& layout_entry : secondary_wrapper->pending_layouts)
-        {
-            primary_wrapper->pending_layouts[layout_entry.first] = layout_entry.second;
-        }
-
-        for (const auto& secondary_query_pool_entry : secondary_wrapper->recorded_queries)
-        {
-            auto& primary_query_pool_info = primary_wrapper->recorded_queries[secondary_query_pool_entry.first];
-
-            for (const auto& secondary_query_entry : secondary_query_pool_entry.second)
-            {
-                auto& primary_query_info  = primary_query_pool_info[secondary_query_entry.first];
-                primary_query_info.active = secondary_query_entry.second.active;
+        primary_wrapper->pending_layouts.insert(primary_wrapper->pending_layouts.end(),
+                                                secondary_wrapper->pending_layouts.begin(),
+                                                secondary_wrapper->pending_layouts.end());
 
-                if (primary_query_info.active)
-                {
-                    primary_query_info.flags              = secondary_query_entry.second.flags;
-                    primary_query_info.query_type_index   = secondary_query_entry.second.query_type_index;
-                    primary_query_info.queue_family_index = secondary_query_entry.second.queue_family_index;
-                }
-            }
-        }
+        primary_wrapper->recorded_queries.insert(primary_wrapper->recorded_queries.end(),
+                                                 secondary_wrapper->recorded_queries.begin(),
+                                                 secondary_wrapper->recorded_queries.end());
     }
 }
 
@@ -331,12 +377,12 @@ void VulkanStateTracker::TrackImageBarriers(VkCommandBuffer             command_
 
     if ((image_barrier_count > 0) && (image_barriers != nullptr))
     {
-        auto wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
+        auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
 
         for (uint32_t i = 0; i < image_barrier_count; ++i)
         {
-            auto image_wrapper                      = reinterpret_cast<ImageWrapper*>(image_barriers[i].image);
-            wrapper->pending_layouts[image_wrapper] = image_barriers[i].newLayout;
+            auto image_wrapper = GetWrapper<ImageWrapper>(image_barriers[i].image);
+            wrapper->pending_layouts.push_back({ image_wrapper, image_barriers[i].newLayout });
         }
     }
 }
@@ -349,12 +395,12 @@ void VulkanStateTracker::TrackImageBarriers2KHR(VkCommandBuffer
 
     if ((image_barrier_count > 0) && (image_barriers != nullptr))
     {
-        auto wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
+        auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
 
         for (uint32_t i = 0; i < image_barrier_count; ++i)
         {
-            auto image_wrapper                      = reinterpret_cast<ImageWrapper*>(image_barriers[i].image);
-            wrapper->pending_layouts[image_wrapper] = image_barriers[i].newLayout;
+            auto image_wrapper = GetWrapper<ImageWrapper>(image_barriers[i].image);
+            wrapper->pending_layouts.push_back({ image_wrapper, image_barriers[i].newLayout });
         }
     }
 }
@@ -370,40 +416,480 @@ void VulkanStateTracker::TrackCommandBufferSubmissions(uint32_t submit_count, co
 
             for (uint32_t cmd = 0; cmd < command_buffer_count; ++cmd)
             {
-                auto command_wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffers[cmd]);
+                auto command_wrapper = GetWrapper<CommandBufferWrapper>(command_buffers[cmd]);
                 assert(command_wrapper != nullptr);
 
-                // Apply pending image layouts.
+                // Apply pending image layouts, in recording order.
                 for (const auto& layout_entry : command_wrapper->pending_layouts)
                 {
-                    auto image_wrapper = reinterpret_cast<ImageWrapper*>(layout_entry.first);
-                    assert(image_wrapper != nullptr);
-
-                    image_wrapper->current_layout = layout_entry.second;
+                    assert(layout_entry.image != nullptr);
+                    layout_entry.image->current_layout = layout_entry.layout;
                 }
 
-                // Apply pending query activations.
-                for (const auto& query_pool_entry : command_wrapper->recorded_queries)
+                // Apply pending query activations, in recording order.
+                for (const auto& query_entry : command_wrapper->recorded_queries)
                 {
-                    auto query_pool_wrapper = query_pool_entry.first;
+                    auto query_pool_wrapper = query_entry.query_pool;
                     assert(query_pool_wrapper != nullptr);
 
-                    for (const auto& query_entry : query_pool_entry.second)
+                    auto& query_info  = query_pool_wrapper->pending_queries[query_entry.query];
+                    query_info.active = query_entry.info.active;
+
+                    if (query_info.active)
                     {
-                        auto& query_info  = query_pool_wrapper->pending_queries[query_entry.first];
-                        query_info.active = query_entry.second.active;
+                        query_info.flags              = query_entry.info.flags;
+                        query_info.query_type_index   = query_entry.info.query_type_index;
+                        query_info.queue_family_index = query_entry.info.queue_family_index;
+                    }
+                }
+
+                if (content_cache_ != nullptr)
+                {
+                    TrackResourceWrites(command_wrapper, content_cache_->GetGeneration());
+                }
+
+                if (track_referenced_resources_)
+                {
+                    TrackReferencedResources(command_wrapper);
+                }
+            }
+        }
+    }
+}
+
+void VulkanStateTracker::GetSubmittedResourceIds(const CommandBufferWrapper*      wrapper,
+                                                 bool                             writable_only,
+                                                 std::vector<format::HandleId>*   buffer_ids,
+                                                 std::vector<format::HandleId>*   image_ids,
+                                                 bool*                            address_access,
+                                                 std::vector<DeviceAddressRange>* address_ranges)
+{
+    assert((wrapper != nullptr) && (buffer_ids != nullptr) && (image_ids != nullptr) && (address_access != nullptr));
+
+    // Image layouts are applied to the wrappers on submit, which includes the attachments of render pass instances.
+    for (const auto& layout_entry : wrapper->pending_layouts)
+    {
+        image_ids->push_back(layout_entry.image->handle_id);
+    }
+
+    std::vector<const CommandBufferWrapper*> command_wrappers{ wrapper };
+
+    // Include the handles referenced by secondary command buffers.
+    const auto& secondary_ids = wrapper->command_handles[CommandHandleType::CommandBufferHandle];
+    if (!secondary_ids.empty())
+    {
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<CommandBufferWrapper>());
+        for (auto secondary_id : secondary_ids)
+        {
+            const CommandBufferWrapper* secondary_wrapper = state_table_.GetCommandBufferWrapper(secondary_id);
+            if (secondary_wrapper != nullptr)
+            {
+                command_wrappers.push_back(secondary_wrapper);
+            }
+        }
+    }
+
+    std::vector<format::HandleId> buffer_view_ids;
+    std::vector<format::HandleId> image_view_ids;
+    std::vector<format::HandleId> descriptor_set_ids;
+
+    for (const auto command_wrapper : command_wrappers)
+    {
+        const auto& handles = command_wrapper->command_handles;
 
-                        if (query_info.active)
+        if (address_ranges != nullptr)
+        {
+            // The buffers that store acceleration structures are identified separately, so only the accesses through
+            // the recorded address ranges need to be attributed to a resource.
+            address_ranges->insert(address_ranges->end(),
+                                   command_wrapper->command_address_ranges.begin(),
+                                   command_wrapper->command_address_ranges.end());
+
+            if (command_wrapper->unknown_address_access ||
+                !handles[CommandHandleType::AccelerationStructureNVHandle].empty())
+            {
+                (*address_access) = true;
+            }
+        }
+        else if (!handles[CommandHandleType::AccelerationStructureKHRHandle].empty() ||
+                 !handles[CommandHandleType::AccelerationStructureNVHandle].empty())
+        {
+            // Accesses through device addresses, such as acceleration structure builds, cannot be attributed to a
+            // resource.
+            (*address_access) = true;
+        }
+
+        buffer_ids->insert(buffer_ids->end(),
+                           handles[CommandHandleType::BufferHandle].begin(),
+                           handles[CommandHandleType::BufferHandle].end());
+        image_ids->insert(image_ids->end(),
+                          handles[CommandHandleType::ImageHandle].begin(),
+                          handles[CommandHandleType::ImageHandle].end());
+        buffer_view_ids.insert(buffer_view_ids.end(),
+                               handles[CommandHandleType::BufferViewHandle].begin(),
+                               handles[CommandHandleType::BufferViewHandle].end());
+        image_view_ids.insert(image_view_ids.end(),
+                              handles[CommandHandleType::ImageViewHandle].begin(),
+                              handles[CommandHandleType::ImageViewHandle].end());
+        descriptor_set_ids.insert(descriptor_set_ids.end(),
+                                  handles[CommandHandleType::DescriptorSetHandle].begin(),
+                                  handles[CommandHandleType::DescriptorSetHandle].end());
+    }
+
+    if (!descriptor_set_ids.empty())
+    {
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<DescriptorSetWrapper>());
+        for (auto descriptor_set_id : descriptor_set_ids)
+        {
+            const DescriptorSetWrapper* set_wrapper = state_table_.GetDescriptorSetWrapper(descriptor_set_id);
+            if (set_wrapper != nullptr)
+            {
+                for (const auto& binding_entry : set_wrapper->bindings)
+                {
+                    const DescriptorInfo& binding = binding_entry.second;
+
+                    // Only the chunks with written elements are allocated.
+                    for (const auto& chunk : binding.chunks)
+                    {
+                        if (chunk == nullptr)
                         {
-                            query_info.flags              = query_entry.second.flags;
-                            query_info.query_type_index   = query_entry.second.query_type_index;
-                            query_info.queue_family_index = query_entry.second.queue_family_index;
+                            continue;
+                        }
+
+                        for (uint32_t i = 0; i < DescriptorInfo::kChunkSize; ++i)
+                        {
+                            VkDescriptorType type = binding.type;
+
+                            if ((chunk->written & (uint64_t{ 1 } << i)) == 0)
+                            {
+                                continue;
+                            }
+
+                            if (type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
+                            {
+                                type = chunk->mutable_type[i];
+                            }
+
+                            // Only storage descriptors can be written by shaders.
+                            switch (type)
+                            {
+                                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                                    if (!writable_only)
+                                    {
+                                        image_view_ids.push_back(chunk->handle_ids[i]);
+                                    }
+                                    break;
+                                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                                    image_view_ids.push_back(chunk->handle_ids[i]);
+                                    break;
+                                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                                    if (!writable_only)
+                                    {
+                                        buffer_ids->push_back(chunk->handle_ids[i]);
+                                    }
+                                    break;
+                                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                                    buffer_ids->push_back(chunk->handle_ids[i]);
+                                    break;
+                                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                                    if (!writable_only)
+                                    {
+                                        buffer_view_ids.push_back(chunk->handle_ids[i]);
+                                    }
+                                    break;
+                                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                                    buffer_view_ids.push_back(chunk->handle_ids[i]);
+                                    break;
+                                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                                    if (!writable_only && (address_ranges == nullptr))
+                                    {
+                                        (*address_access) = true;
+                                    }
+                                    break;
+                                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                                    if (!writable_only)
+                                    {
+                                        (*address_access) = true;
+                                    }
+                                    break;
+                                default:
+                                    break;
+                            }
                         }
                     }
                 }
             }
         }
     }
+
+    if (!buffer_view_ids.empty())
+    {
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<BufferViewWrapper>());
+        for (auto buffer_view_id : buffer_view_ids)
+        {
+            const BufferViewWrapper* view_wrapper = state_table_.GetBufferViewWrapper(buffer_view_id);
+            if (view_wrapper != nullptr)
+            {
+                buffer_ids->push_back(view_wrapper->buffer_id);
+            }
+        }
+    }
+
+    if (!image_view_ids.empty())
+    {
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<ImageViewWrapper>());
+        for (auto image_view_id : image_view_ids)
+        {
+            const ImageViewWrapper* view_wrapper = state_table_.GetImageViewWrapper(image_view_id);
+            if (view_wrapper != nullptr)
+            {
+                image_ids->push_back(view_wrapper->image_id);
+            }
+        }
+    }
+}
+
+void VulkanStateTracker::TrackResourceWrites(const CommandBufferWrapper* wrapper, uint64_t generation)
+{
+    assert((wrapper != nullptr) && (content_cache_ != nullptr));
+
+    std::vector<format::HandleId> buffer_ids;
+    std::vector<format::HandleId> image_ids;
+    bool                          address_access = false;
+
+    GetSubmittedResourceIds(wrapper, true, &buffer_ids, &image_ids, &address_access);
+
+    if (address_access)
+    {
+        content_cache_->MarkUntrackedWrite();
+    }
+
+    if (!buffer_ids.empty())
+    {
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<BufferWrapper>());
+        for (auto buffer_id : buffer_ids)
+        {
+            BufferWrapper* buffer_wrapper = state_table_.GetBufferWrapper(buffer_id);
+            if (buffer_wrapper != nullptr)
+            {
+                buffer_wrapper->dirty_generation = generation;
+            }
+        }
+    }
+
+    if (!image_ids.empty())
+    {
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<ImageWrapper>());
+        for (auto image_id : image_ids)
+        {
+            ImageWrapper* image_wrapper = state_table_.GetImageWrapper(image_id);
+            if (image_wrapper != nullptr)
+            {
+                image_wrapper->dirty_generation = generation;
+            }
+        }
+    }
+}
+
+void VulkanStateTracker::TrackReferencedResources(const CommandBufferWrapper* wrapper)
+{
+    assert(wrapper != nullptr);
+
+    std::vector<format::HandleId>   buffer_ids;
+    std::vector<format::HandleId>   image_ids;
+    std::vector<DeviceAddressRange> address_ranges;
+    bool                            address_access = false;
+
+    GetSubmittedResourceIds(wrapper,
+                            false,
+                            &buffer_ids,
+                            &image_ids,
+                            &address_access,
+                            resolve_device_addresses_ ? &address_ranges : nullptr);
+
+    // Addresses are resolved at submission, while the buffers that contain them are known to exist.
+    if (!address_ranges.empty() && !GetAddressRangeBufferIds(address_ranges, &buffer_ids))
+    {
+        address_access = true;
+    }
+
+    std::lock_guard<std::mutex> lock(referenced_resources_mutex_);
+    referenced_buffer_ids_.insert(buffer_ids.begin(), buffer_ids.end());
+    referenced_image_ids_.insert(image_ids.begin(), image_ids.end());
+    referenced_address_access_ = referenced_address_access_ || address_access;
+}
+
+bool VulkanStateTracker::GetAddressRangeBufferIds(const std::vector<DeviceAddressRange>& address_ranges,
+                                                  std::vector<format::HandleId>*         buffer_ids)
+{
+    assert(buffer_ids != nullptr);
+
+    std::vector<bool> resolved(address_ranges.size(), false);
+
+    std::unique_lock<std::mutex> lock(GetStateTableMutex<BufferWrapper>());
+    state_table_.VisitWrappers([&](const BufferWrapper* wrapper) {
+        if (wrapper->address != 0)
+        {
+            VkDeviceAddress buffer_end = wrapper->address + wrapper->created_size;
+
+            for (size_t i = 0; i < address_ranges.size(); ++i)
+            {
+                const DeviceAddressRange& range     = address_ranges[i];
+                VkDeviceAddress           range_end = range.address + std::max(range.size, VkDeviceSize{ 1 });
+
+                if ((wrapper->address < range_end) && (range.address < buffer_end))
+                {
+                    buffer_ids->push_back(wrapper->handle_id);
+                    resolved[i] = true;
+                }
+            }
+        }
+    });
+
+    return std::find(resolved.begin(), resolved.end(), false) == resolved.end();
+}
+
+void VulkanStateTracker::BeginReferencedResourceTracking(bool resolve_device_addresses)
+{
+    std::lock_guard<std::mutex> lock(referenced_resources_mutex_);
+    referenced_buffer_ids_.clear();
+    referenced_image_ids_.clear();
+    referenced_address_access_  = false;
+    resolve_device_addresses_   = resolve_device_addresses;
+    track_referenced_resources_ = true;
+}
+
+void VulkanStateTracker::EndReferencedResourceTracking(std::unordered_set<format::HandleId>* buffer_ids,
+                                                       std::unordered_set<format::HandleId>* image_ids,
+                                                       bool*                                 address_access)
+{
+    assert((buffer_ids != nullptr) && (image_ids != nullptr) && (address_access != nullptr));
+
+    bool resolve_device_addresses = false;
+
+    {
+        std::lock_guard<std::mutex> lock(referenced_resources_mutex_);
+        track_referenced_resources_ = false;
+        resolve_device_addresses    = resolve_device_addresses_;
+        (*buffer_ids)               = std::move(referenced_buffer_ids_);
+        (*image_ids)                = std::move(referenced_image_ids_);
+        (*address_access)           = referenced_address_access_;
+        referenced_buffer_ids_.clear();
+        referenced_image_ids_.clear();
+    }
+
+    if (resolve_device_addresses)
+    {
+        // Acceleration structures may reference each other through addresses that are stored in GPU memory, so the
+        // content of every acceleration structure is kept.
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<AccelerationStructureKHRWrapper>());
+        state_table_.VisitWrappers([&](const AccelerationStructureKHRWrapper* wrapper) {
+            if (wrapper->buffer_id != format::kNullHandleId)
+            {
+                buffer_ids->insert(wrapper->buffer_id);
+            }
+        });
+
+        return;
+    }
+
+    // Shaders may access any buffer with a device address.
+    std::unique_lock<std::mutex> lock(GetStateTableMutex<BufferWrapper>());
+    state_table_.VisitWrappers([&](const BufferWrapper* wrapper) {
+        if (wrapper->address != 0)
+        {
+            buffer_ids->insert(wrapper->handle_id);
+        }
+    });
+}
+
+std::unique_ptr<DescriptorInfo::Chunk> VulkanStateTracker::CreateDescriptorChunk(VkDescriptorType type)
+{
+    const uint32_t size  = DescriptorInfo::kChunkSize;
+    auto           chunk = std::make_unique<DescriptorInfo::Chunk>();
+
+    chunk->handle_ids = std::make_unique<format::HandleId[]>(size);
+
+    switch (type)
+    {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            chunk->sampler_ids = std::make_unique<format::HandleId[]>(size);
+            chunk->images      = std::make_unique<VkDescriptorImageInfo[]>(size);
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            chunk->buffers = std::make_unique<VkDescriptorBufferInfo[]>(size);
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            chunk->texel_buffer_views = std::make_unique<VkBufferView[]>(size);
+            break;
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            // TODO
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            // TODO
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            chunk->acceleration_structures = std::make_unique<VkAccelerationStructureKHR[]>(size);
+            break;
+        case VK_DESCRIPTOR_TYPE_MUTABLE_VALVE:
+            chunk->sampler_ids             = std::make_unique<format::HandleId[]>(size);
+            chunk->images                  = std::make_unique<VkDescriptorImageInfo[]>(size);
+            chunk->buffers                 = std::make_unique<VkDescriptorBufferInfo[]>(size);
+            chunk->texel_buffer_views      = std::make_unique<VkBufferView[]>(size);
+            chunk->acceleration_structures = std::make_unique<VkAccelerationStructureKHR[]>(size);
+            chunk->mutable_type            = std::make_unique<VkDescriptorType[]>(size);
+            std::fill(chunk->mutable_type.get(), chunk->mutable_type.get() + size, VK_DESCRIPTOR_TYPE_MUTABLE_VALVE);
+            break;
+        default:
+            GFXRECON_LOG_WARNING("Attempting to initialize descriptor state for unrecognized descriptor type");
+            break;
+    }
+
+    return chunk;
+}
+
+template <typename Update>
+void VulkanStateTracker::UpdateDescriptorRange(DescriptorInfo* binding,
+                                               uint32_t        first_element,
+                                               uint32_t        count,
+                                               Update          update)
+{
+    assert(binding != nullptr);
+
+    uint32_t offset = 0;
+
+    while (offset < count)
+    {
+        uint32_t element       = first_element + offset;
+        uint32_t chunk_element = element & DescriptorInfo::kChunkMask;
+        uint32_t update_count  = std::min(count - offset, DescriptorInfo::kChunkSize - chunk_element);
+        auto&    chunk         = binding->chunks[element >> DescriptorInfo::kChunkShift];
+
+        if (chunk == nullptr)
+        {
+            chunk = CreateDescriptorChunk(binding->type);
+        }
+
+        uint64_t mask =
+            (update_count == DescriptorInfo::kChunkSize) ? ~uint64_t{ 0 } : ((uint64_t{ 1 } << update_count) - 1);
+        chunk->written |= (mask << chunk_element);
+
+        update(chunk.get(), chunk_element, offset, update_count);
+
+        offset += update_count;
+    }
 }
 
 void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    write_count,
@@ -419,7 +905,7 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
         for (uint32_t i = 0; i < write_count; ++i)
         {
             const VkWriteDescriptorSet* write   = &writes[i];
-            auto                        wrapper = reinterpret_cast<DescriptorSetWrapper*>(write->dstSet);
+            auto                        wrapper = GetWrapper<DescriptorSetWrapper>(write->dstSet);
             assert(wrapper != nullptr);
 
             // Descriptor update rules specify that a write descriptorCount that is greater than the binding's count
@@ -440,122 +926,128 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
                 // consecutive bindings are being updated.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_dst_array_element));
 
-                bool* written_start = &binding.written[current_dst_array_element];
-                std::fill(written_start, written_start + current_writes, true);
-
-                if (binding.type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
-                {
-                    VkDescriptorType* mutable_type_start = &binding.mutable_type[current_dst_array_element];
-                    std::fill(mutable_type_start, mutable_type_start + current_writes, write->descriptorType);
-                }
-
-                switch (write->descriptorType)
-                {
-                    case VK_DESCRIPTOR_TYPE_SAMPLER:
-                    {
-                        format::HandleId*            dst_sampler_ids = &binding.sampler_ids[current_dst_array_element];
-                        VkDescriptorImageInfo*       dst_info        = &binding.images[current_dst_array_element];
-                        const VkDescriptorImageInfo* src_info        = &write->pImageInfo[current_src_array_element];
+                UpdateDescriptorRange(
+                    &binding,
+                    current_dst_array_element,
+                    current_writes,
+                    [&](DescriptorInfo::Chunk* chunk, uint32_t chunk_element, uint32_t offset, uint32_t update_count) {
+                        uint32_t src_array_element = current_src_array_element + offset;
 
-                        for (uint32_t i = 0; i < current_writes; ++i)
+                        if (binding.type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
                         {
-                            dst_sampler_ids[i] = GetWrappedId(src_info[i].sampler);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                            VkDescriptorType* mutable_type_start = &chunk->mutable_type[chunk_element];
+                            std::fill(mutable_type_start, mutable_type_start + update_count, write->descriptorType);
                         }
-                        break;
-                    }
-                    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-                    {
-                        format::HandleId*            dst_sampler_ids = &binding.sampler_ids[current_dst_array_element];
-                        format::HandleId*            dst_image_ids   = &binding.handle_ids[current_dst_array_element];
-                        VkDescriptorImageInfo*       dst_info        = &binding.images[current_dst_array_element];
-                        const VkDescriptorImageInfo* src_info        = &write->pImageInfo[current_src_array_element];
-
-                        for (uint32_t i = 0; i < current_writes; ++i)
-                        {
-                            dst_sampler_ids[i] = GetWrappedId(src_info[i].sampler);
-                            dst_image_ids[i]   = GetWrappedId(src_info[i].imageView);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
-                        }
-                        break;
-                    }
-                    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-                    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-                    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                    {
-                        format::HandleId*            dst_image_ids = &binding.handle_ids[current_dst_array_element];
-                        VkDescriptorImageInfo*       dst_info      = &binding.images[current_dst_array_element];
-                        const VkDescriptorImageInfo* src_info      = &write->pImageInfo[current_src_array_element];
-
-                        for (uint32_t i = 0; i < current_writes; ++i)
-                        {
-                            dst_image_ids[i] = GetWrappedId(src_info[i].imageView);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
-                        }
-                        break;
-                    }
-                    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                    {
-                        format::HandleId*             dst_buffer_ids = &binding.handle_ids[current_dst_array_element];
-                        VkDescriptorBufferInfo*       dst_info       = &binding.buffers[current_dst_array_element];
-                        const VkDescriptorBufferInfo* src_info       = &write->pBufferInfo[current_src_array_element];
 
-                        for (uint32_t i = 0; i < current_writes; ++i)
+                        switch (write->descriptorType)
                         {
-                            dst_buffer_ids[i] = GetWrappedId(src_info[i].buffer);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
-                        }
-                        break;
-                    }
-                    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-                    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                    {
-                        format::HandleId*   dst_view_ids = &binding.handle_ids[current_dst_array_element];
-                        VkBufferView*       dst_info     = &binding.texel_buffer_views[current_dst_array_element];
-                        const VkBufferView* src_info     = &write->pTexelBufferView[current_src_array_element];
-
-                        for (uint32_t i = 0; i < current_writes; ++i)
-                        {
-                            dst_view_ids[i] = GetWrappedId(src_info[i]);
-                            dst_info[i]     = src_info[i];
-                        }
-                        break;
-                    }
-                    case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
-                        // TODO
-                        break;
-                    case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
-                        // TODO
-                        break;
-                    case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
-                    {
-                        VkWriteDescriptorSetAccelerationStructureKHR* write_accel_struct =
-                            graphics::GetPNextStruct<VkWriteDescriptorSetAccelerationStructureKHR>(
-                                write, VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR);
-
-                        if (write_accel_struct != nullptr)
-                        {
-                            format::HandleId* dst_accel_struct_ids = &binding.handle_ids[current_dst_array_element];
-                            VkAccelerationStructureKHR* dst_accel_struct =
-                                &binding.acceleration_structures[current_dst_array_element];
-                            const VkAccelerationStructureKHR* src_accel_struct =
-                                &write_accel_struct->pAccelerationStructures[current_src_array_element];
-
-                            for (uint32_t i = 0; i < current_writes; ++i)
+                            case VK_DESCRIPTOR_TYPE_SAMPLER:
                             {
-                                dst_accel_struct_ids[i] = GetWrappedId(src_accel_struct[i]);
-                                dst_accel_struct[i]     = src_accel_struct[i];
+                                format::HandleId*            dst_sampler_ids = &chunk->sampler_ids[chunk_element];
+                                VkDescriptorImageInfo*       dst_info        = &chunk->images[chunk_element];
+                                const VkDescriptorImageInfo* src_info        = &write->pImageInfo[src_array_element];
+
+                                for (uint32_t i = 0; i < update_count; ++i)
+                                {
+                                    dst_sampler_ids[i] = GetWrappedId(src_info[i].sampler);
+                                    memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                                }
+                                break;
                             }
+                            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                            {
+                                format::HandleId*            dst_sampler_ids = &chunk->sampler_ids[chunk_element];
+                                format::HandleId*            dst_image_ids   = &chunk->handle_ids[chunk_element];
+                                VkDescriptorImageInfo*       dst_info        = &chunk->images[chunk_element];
+                                const VkDescriptorImageInfo* src_info        = &write->pImageInfo[src_array_element];
+
+                                for (uint32_t i = 0; i < update_count; ++i)
+                                {
+                                    dst_sampler_ids[i] = GetWrappedId(src_info[i].sampler);
+                                    dst_image_ids[i]   = GetWrappedId(src_info[i].imageView);
+                                    memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                                }
+                                break;
+                            }
+                            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                            {
+                                format::HandleId*            dst_image_ids = &chunk->handle_ids[chunk_element];
+                                VkDescriptorImageInfo*       dst_info      = &chunk->images[chunk_element];
+                                const VkDescriptorImageInfo* src_info      = &write->pImageInfo[src_array_element];
+
+                                for (uint32_t i = 0; i < update_count; ++i)
+                                {
+                                    dst_image_ids[i] = GetWrappedId(src_info[i].imageView);
+                                    memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                                }
+                                break;
+                            }
+                            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                            {
+                                format::HandleId*             dst_buffer_ids = &chunk->handle_ids[chunk_element];
+                                VkDescriptorBufferInfo*       dst_info       = &chunk->buffers[chunk_element];
+                                const VkDescriptorBufferInfo* src_info       = &write->pBufferInfo[src_array_element];
+
+                                for (uint32_t i = 0; i < update_count; ++i)
+                                {
+                                    dst_buffer_ids[i] = GetWrappedId(src_info[i].buffer);
+                                    memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                                }
+                                break;
+                            }
+                            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                            {
+                                format::HandleId*   dst_view_ids = &chunk->handle_ids[chunk_element];
+                                VkBufferView*       dst_info     = &chunk->texel_buffer_views[chunk_element];
+                                const VkBufferView* src_info     = &write->pTexelBufferView[src_array_element];
+
+                                for (uint32_t i = 0; i < update_count; ++i)
+                                {
+                                    dst_view_ids[i] = GetWrappedId(src_info[i]);
+                                    dst_info[i]     = src_info[i];
+                                }
+                                break;
+                            }
+                            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+                                // TODO
+                                break;
+                            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                                // TODO
+                                break;
+                            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                            {
+                                VkWriteDescriptorSetAccelerationStructureKHR* write_accel_struct =
+                                    graphics::GetPNextStruct<VkWriteDescriptorSetAccelerationStructureKHR>(
+                                        write, VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR);
+
+                                if (write_accel_struct != nullptr)
+                                {
+                                    format::HandleId* dst_accel_struct_ids = &chunk->handle_ids[chunk_element];
+                                    VkAccelerationStructureKHR* dst_accel_struct =
+                                        &chunk->acceleration_structures[chunk_element];
+                                    const VkAccelerationStructureKHR* src_accel_struct =
+                                        &write_accel_struct->pAccelerationStructures[src_array_element];
+
+                                    for (uint32_t i = 0; i < update_count; ++i)
+                                    {
+                                        dst_accel_struct_ids[i] = GetWrappedId(src_accel_struct[i]);
+                                        dst_accel_struct[i]     = src_accel_struct[i];
+                                    }
+                                }
+                            }
+                            break;
+                            default:
+                                GFXRECON_LOG_WARNING(
+                                    "Attempting to track descriptor state for unrecognized descriptor type");
+                                break;
                         }
-                    }
-                    break;
-                    default:
-                        GFXRECON_LOG_WARNING("Attempting to track descriptor state for unrecognized descriptor type");
-                        break;
-                }
+                    });
 
                 // Check for consecutive update.
                 if (current_count == current_writes)
@@ -578,8 +1070,8 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
         for (uint32_t i = 0; i < copy_count; ++i)
         {
             auto copy        = &copies[i];
-            auto dst_wrapper = reinterpret_cast<DescriptorSetWrapper*>(copy->dstSet);
-            auto src_wrapper = reinterpret_cast<DescriptorSetWrapper*>(copy->srcSet);
+            auto dst_wrapper = GetWrapper<DescriptorSetWrapper>(copy->dstSet);
+            auto src_wrapper = GetWrapper<DescriptorSetWrapper>(copy->srcSet);
             assert((dst_wrapper != nullptr) && (src_wrapper != nullptr));
 
             // Descriptor update rules specify that a write descriptorCount that is greater than the binding's count
@@ -602,47 +1094,53 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
                 uint32_t src_copy_count = src_binding.count - current_src_array_element;
                 uint32_t current_copies = std::min(current_count, std::min(dst_copy_count, src_copy_count));
 
-                bool* written_start = &dst_binding.written[current_dst_array_element];
-                std::fill(written_start, written_start + current_copies, true);
+                // Copy the source elements by destination chunk, propagating the written state of each source
+                // element.  Copies of source elements that were never written leave the destination unwritten.
+                UpdateDescriptorRange(
+                    &dst_binding,
+                    current_dst_array_element,
+                    current_copies,
+                    [&](DescriptorInfo::Chunk* chunk, uint32_t chunk_element, uint32_t offset, uint32_t update_count) {
+                        for (uint32_t i = 0; i < update_count; ++i)
+                        {
+                            uint32_t dst_index   = chunk_element + i;
+                            uint32_t src_element = current_src_array_element + offset + i;
+                            uint32_t src_index   = src_element & DescriptorInfo::kChunkMask;
+                            const DescriptorInfo::Chunk* src_chunk =
+                                src_binding.chunks[src_element >> DescriptorInfo::kChunkShift].get();
 
-                memcpy(&dst_binding.handle_ids[current_dst_array_element],
-                       &src_binding.handle_ids[current_src_array_element],
-                       (sizeof(format::HandleId) * current_copies));
+                            if ((src_chunk == nullptr) || ((src_chunk->written & (uint64_t{ 1 } << src_index)) == 0))
+                            {
+                                chunk->written &= ~(uint64_t{ 1 } << dst_index);
+                                continue;
+                            }
 
-                if (src_binding.images != nullptr)
-                {
-                    memcpy(&dst_binding.sampler_ids[current_dst_array_element],
-                           &src_binding.sampler_ids[current_src_array_element],
-                           (sizeof(format::HandleId) * current_copies));
+                            chunk->handle_ids[dst_index] = src_chunk->handle_ids[src_index];
 
-                    memcpy(&dst_binding.images[current_dst_array_element],
-                           &src_binding.images[current_src_array_element],
-                           (sizeof(VkDescriptorImageInfo) * current_copies));
-                }
-                if (src_binding.buffers != nullptr)
-                {
-                    memcpy(&dst_binding.buffers[current_dst_array_element],
-                           &src_binding.buffers[current_src_array_element],
-                           (sizeof(VkDescriptorBufferInfo) * current_copies));
-                }
-                if (src_binding.acceleration_structures != nullptr)
-                {
-                    memcpy(&dst_binding.acceleration_structures[current_dst_array_element],
-                           &src_binding.acceleration_structures[current_src_array_element],
-                           (sizeof(VkWriteDescriptorSetAccelerationStructureKHR) * current_copies));
-                }
-                if (src_binding.texel_buffer_views != nullptr)
-                {
-                    memcpy(&dst_binding.texel_buffer_views[current_dst_array_element],
-                           &src_binding.texel_buffer_views[current_src_array_element],
-                           (sizeof(VkBufferView) * current_copies));
-                }
-                if (src_binding.mutable_type != nullptr)
-                {
-                    memcpy(&dst_binding.mutable_type[current_dst_array_element],
-                           &src_binding.mutable_type[current_src_array_element],
-                           (sizeof(VkDescriptorType) * current_copies));
-                }
+                            if (src_chunk->images != nullptr)
+                            {
+                                chunk->sampler_ids[dst_index] = src_chunk->sampler_ids[src_index];
+                                chunk->images[dst_index]      = src_chunk->images[src_index];
+                            }
+                            if (src_chunk->buffers != nullptr)
+                            {
+                                chunk->buffers[dst_index] = src_chunk->buffers[src_index];
+                            }
+                            if (src_chunk->acceleration_structures != nullptr)
+                            {
+                                chunk->acceleration_structures[dst_index] =
+                                    src_chunk->acceleration_structures[src_index];
+                            }
+                            if (src_chunk->texel_buffer_views != nullptr)
+                            {
+                                chunk->texel_buffer_views[dst_index] = src_chunk->texel_buffer_views[src_index];
+                            }
+                            if (src_chunk->mutable_type != nullptr)
+                            {
+                                chunk->mutable_type[dst_index] = src_chunk->mutable_type[src_index];
+                            }
+                        }
+                    });
 
                 // Check for consecutive update.
                 if (current_count == current_copies)
@@ -692,7 +1190,7 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
     // exists at state write time by checking for the ID in the active state table.
     if ((template_info != nullptr) && (data != nullptr))
     {
-        auto           wrapper = reinterpret_cast<DescriptorSetWrapper*>(set);
+        auto           wrapper = GetWrapper<DescriptorSetWrapper>(set);
         const uint8_t* bytes   = reinterpret_cast<const uint8_t*>(data);
 
         for (const auto& entry : template_info->image_info)
@@ -708,37 +1206,38 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.images != nullptr);
-
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
-
-                format::HandleId*      dst_sampler_ids = &binding.sampler_ids[current_array_element];
-                format::HandleId*      dst_image_ids   = &binding.handle_ids[current_array_element];
-                VkDescriptorImageInfo* dst_info        = &binding.images[current_array_element];
-                const uint8_t*         src_address     = bytes + current_offset;
-
-                for (uint32_t i = 0; i < current_writes; ++i)
-                {
-                    auto image_info = reinterpret_cast<const VkDescriptorImageInfo*>(src_address);
-                    if ((binding.type == VK_DESCRIPTOR_TYPE_SAMPLER) ||
-                        (binding.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER))
-                    {
-                        dst_sampler_ids[i] = GetWrappedId(image_info->sampler);
-                    }
+                UpdateDescriptorRange(
+                    &binding,
+                    current_array_element,
+                    current_writes,
+                    [&](DescriptorInfo::Chunk* chunk, uint32_t chunk_element, uint32_t offset, uint32_t update_count) {
+                        format::HandleId*      dst_sampler_ids = &chunk->sampler_ids[chunk_element];
+                        format::HandleId*      dst_image_ids   = &chunk->handle_ids[chunk_element];
+                        VkDescriptorImageInfo* dst_info        = &chunk->images[chunk_element];
+                        const uint8_t*         src_address     = bytes + current_offset + (offset * entry.stride);
+
+                        for (uint32_t i = 0; i < update_count; ++i)
+                        {
+                            auto image_info = reinterpret_cast<const VkDescriptorImageInfo*>(src_address);
+                            if ((binding.type == VK_DESCRIPTOR_TYPE_SAMPLER) ||
+                                (binding.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER))
+                            {
+                                dst_sampler_ids[i] = GetWrappedId(image_info->sampler);
+                            }
 
-                    if (binding.type != VK_DESCRIPTOR_TYPE_SAMPLER)
-                    {
-                        dst_image_ids[i] = GetWrappedId(image_info->imageView);
-                    }
+                            if (binding.type != VK_DESCRIPTOR_TYPE_SAMPLER)
+                            {
+                                dst_image_ids[i] = GetWrappedId(image_info->imageView);
+                            }
 
-                    memcpy(&dst_info[i], image_info, sizeof(dst_info[i]));
+                            memcpy(&dst_info[i], image_info, sizeof(dst_info[i]));
 
-                    src_address += entry.stride;
-                }
+                            src_address += entry.stride;
+                        }
+                    });
 
                 // Check for consecutive update.
                 if (current_count == current_writes)
@@ -768,26 +1267,27 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.buffers != nullptr);
-
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
-
-                format::HandleId*       dst_buffer_ids = &binding.handle_ids[current_array_element];
-                VkDescriptorBufferInfo* dst_info       = &binding.buffers[current_array_element];
-                const uint8_t*          src_address    = bytes + current_offset;
+                UpdateDescriptorRange(
+                    &binding,
+                    current_array_element,
+                    current_writes,
+                    [&](DescriptorInfo::Chunk* chunk, uint32_t chunk_element, uint32_t offset, uint32_t update_count) {
+                        format::HandleId*       dst_buffer_ids = &chunk->handle_ids[chunk_element];
+                        VkDescriptorBufferInfo* dst_info       = &chunk->buffers[chunk_element];
+                        const uint8_t*          src_address    = bytes + current_offset + (offset * entry.stride);
 
-                for (uint32_t i = 0; i < current_writes; ++i)
-                {
-                    auto buffer_info  = reinterpret_cast<const VkDescriptorBufferInfo*>(src_address);
-                    dst_buffer_ids[i] = GetWrappedId(buffer_info->buffer);
-                    memcpy(&dst_info[i], buffer_info, sizeof(dst_info[i]));
+                        for (uint32_t i = 0; i < update_count; ++i)
+                        {
+                            auto buffer_info  = reinterpret_cast<const VkDescriptorBufferInfo*>(src_address);
+                            dst_buffer_ids[i] = GetWrappedId(buffer_info->buffer);
+                            memcpy(&dst_info[i], buffer_info, sizeof(dst_info[i]));
 
-                    src_address += entry.stride;
-                }
+                            src_address += entry.stride;
+                        }
+                    });
 
                 // Check for consecutive update.
                 if (current_count == current_writes)
@@ -817,26 +1317,27 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.texel_buffer_views != nullptr);
-
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
-
-                format::HandleId* dst_view_ids = &binding.handle_ids[current_array_element];
-                VkBufferView*     dst_info     = &binding.texel_buffer_views[current_array_element];
-                const uint8_t*    src_address  = bytes + current_offset;
+                UpdateDescriptorRange(
+                    &binding,
+                    current_array_element,
+                    current_writes,
+                    [&](DescriptorInfo::Chunk* chunk, uint32_t chunk_element, uint32_t offset, uint32_t update_count) {
+                        format::HandleId* dst_view_ids = &chunk->handle_ids[chunk_element];
+                        VkBufferView*     dst_info     = &chunk->texel_buffer_views[chunk_element];
+                        const uint8_t*    src_address  = bytes + current_offset + (offset * entry.stride);
 
-                for (uint32_t i = 0; i < current_writes; ++i)
-                {
-                    auto buffer_view = reinterpret_cast<const VkBufferView*>(src_address);
-                    dst_view_ids[i]  = GetWrappedId(*buffer_view);
-                    dst_info[i]      = *buffer_view;
+                        for (uint32_t i = 0; i < update_count; ++i)
+                        {
+                            auto buffer_view = reinterpret_cast<const VkBufferView*>(src_address);
+                            dst_view_ids[i]  = GetWrappedId(*buffer_view);
+                            dst_info[i]      = *buffer_view;
 
-                    src_address += entry.stride;
-                }
+                            src_address += entry.stride;
+                        }
+                    });
 
                 // Check for consecutive update.
                 if (current_count == current_writes)
@@ -866,26 +1367,27 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.acceleration_structures != nullptr);
-
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
-
-                format::HandleId*           dst_view_ids = &binding.handle_ids[current_array_element];
-                VkAccelerationStructureKHR* dst_info     = &binding.acceleration_structures[current_array_element];
-                const uint8_t*              src_address  = bytes + current_offset;
+                UpdateDescriptorRange(
+                    &binding,
+                    current_array_element,
+                    current_writes,
+                    [&](DescriptorInfo::Chunk* chunk, uint32_t chunk_element, uint32_t offset, uint32_t update_count) {
+                        format::HandleId*           dst_view_ids = &chunk->handle_ids[chunk_element];
+                        VkAccelerationStructureKHR* dst_info     = &chunk->acceleration_structures[chunk_element];
+                        const uint8_t*              src_address  = bytes + current_offset + (offset * entry.stride);
 
-                for (uint32_t i = 0; i < current_writes; ++i)
-                {
-                    auto accel_struct = reinterpret_cast<const VkAccelerationStructureKHR*>(src_address);
-                    dst_view_ids[i]   = GetWrappedId(*accel_struct);
-                    dst_info[i]       = *accel_struct;
+                        for (uint32_t i = 0; i < update_count; ++i)
+                        {
+                            auto accel_struct = reinterpret_cast<const VkAccelerationStructureKHR*>(src_address);
+                            dst_view_ids[i]   = GetWrappedId(*accel_struct);
+                            dst_info[i]       = *accel_struct;
 
-                    src_address += entry.stride;
-                }
+                            src_address += entry.stride;
+                        }
+                    });
 
                 // Check for consecutive update.
                 if (current_count == current_writes)
@@ -908,10 +1410,10 @@ void VulkanStateTracker::TrackResetDescriptorPool(VkDescriptorPool descriptor_po
 {
     assert(descriptor_pool != VK_NULL_HANDLE);
 
-    auto wrapper = reinterpret_cast<DescriptorPoolWrapper*>(descriptor_pool);
+    auto wrapper = GetWrapper<DescriptorPoolWrapper>(descriptor_pool);
 
     // Pool reset implicitly frees descriptor sets, so remove all wrappers from the state tracker.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
+    std::unique_lock<std::mutex> lock(GetStateTableMutex<DescriptorSetWrapper>());
     for (const auto& set_entry : wrapper->child_sets)
     {
         state_table_.RemoveWrapper(set_entry.second);
@@ -923,15 +1425,18 @@ void VulkanStateTracker::TrackQueryActivation(
 {
     assert((command_buffer != VK_NULL_HANDLE) && (query_pool != VK_NULL_HANDLE));
 
-    auto                      wrapper              = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
+    auto                      wrapper              = GetWrapper<CommandBufferWrapper>(command_buffer);
     const CommandPoolWrapper* command_pool_wrapper = wrapper->parent_pool;
 
-    auto& query_pool_info         = wrapper->recorded_queries[reinterpret_cast<QueryPoolWrapper*>(query_pool)];
-    auto& query_info              = query_pool_info[query];
-    query_info.active             = true;
-    query_info.flags              = flags;
-    query_info.query_type_index   = index;
-    query_info.queue_family_index = command_pool_wrapper->queue_family_index;
+    RecordedQuery query_entry;
+    query_entry.query_pool              = GetWrapper<QueryPoolWrapper>(query_pool);
+    query_entry.query                   = query;
+    query_entry.info.active             = true;
+    query_entry.info.flags              = flags;
+    query_entry.info.query_type_index   = index;
+    query_entry.info.queue_family_index = command_pool_wrapper->queue_family_index;
+
+    wrapper->recorded_queries.push_back(query_entry);
 }
 
 void VulkanStateTracker::TrackQueryReset(VkCommandBuffer command_buffer,
@@ -941,12 +1446,16 @@ void VulkanStateTracker::TrackQueryReset(VkCommandBuffer command_buffer,
 {
     assert((command_buffer != VK_NULL_HANDLE) && (query_pool != VK_NULL_HANDLE));
 
-    auto  wrapper         = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
-    auto& query_pool_info = wrapper->recorded_queries[reinterpret_cast<QueryPoolWrapper*>(query_pool)];
+    auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
+
+    RecordedQuery query_entry;
+    query_entry.query_pool  = GetWrapper<QueryPoolWrapper>(query_pool);
+    query_entry.info.active = false;
 
     for (uint32_t i = first_query; i < query_count; ++i)
     {
-        query_pool_info[i].active = false;
+        query_entry.query = i;
+        wrapper->recorded_queries.push_back(query_entry);
     }
 }
 
@@ -954,7 +1463,7 @@ void VulkanStateTracker::TrackQueryReset(VkQueryPool query_pool, uint32_t first_
 {
     assert(query_pool != VK_NULL_HANDLE);
 
-    auto wrapper = reinterpret_cast<QueryPoolWrapper*>(query_pool);
+    auto wrapper = GetWrapper<QueryPoolWrapper>(query_pool);
     assert((first_query + query_count) <= wrapper->pending_queries.size());
 
     for (uint32_t i = first_query; i < query_count; ++i)
@@ -967,7 +1476,7 @@ void VulkanStateTracker::TrackSemaphoreSignalState(VkSemaphore signal)
 {
     if (signal != VK_NULL_HANDLE)
     {
-        auto wrapper = reinterpret_cast<SemaphoreWrapper*>(signal);
+        auto wrapper = GetWrapper<SemaphoreWrapper>(signal);
         assert(wrapper != nullptr);
         wrapper->signaled = true;
     }
@@ -984,7 +1493,7 @@ void VulkanStateTracker::TrackSemaphoreSignalState(uint32_t           wait_count
         {
             for (uint32_t i = 0; i < wait_count; ++i)
             {
-                auto wrapper = reinterpret_cast<SemaphoreWrapper*>(waits[i]);
+                auto wrapper = GetWrapper<SemaphoreWrapper>(waits[i]);
                 assert(wrapper != nullptr);
                 wrapper->signaled = false;
             }
@@ -994,7 +1503,7 @@ void VulkanStateTracker::TrackSemaphoreSignalState(uint32_t           wait_count
         {
             for (uint32_t i = 0; i < signal_count; ++i)
             {
-                auto wrapper = reinterpret_cast<SemaphoreWrapper*>(signals[i]);
+                auto wrapper = GetWrapper<SemaphoreWrapper>(signals[i]);
                 assert(wrapper != nullptr);
                 wrapper->signaled = true;
             }
@@ -1005,7 +1514,7 @@ void VulkanStateTracker::TrackSemaphoreSignalState(uint32_t           wait_count
 void VulkanStateTracker::TrackAcquireImage(
     uint32_t image_index, VkSwapchainKHR swapchain, VkSemaphore semaphore, VkFence fence, uint32_t deviceMask)
 {
-    auto wrapper = reinterpret_cast<SwapchainKHRWrapper*>(swapchain);
+    auto wrapper = GetWrapper<SwapchainKHRWrapper>(swapchain);
 
     assert((wrapper != nullptr) && (image_index < wrapper->image_acquired_info.size()));
 
@@ -1024,7 +1533,7 @@ void VulkanStateTracker::TrackPresentedImages(uint32_t              count,
 
     for (uint32_t i = 0; i < count; ++i)
     {
-        auto     wrapper     = reinterpret_cast<SwapchainKHRWrapper*>(swapchains[i]);
+        auto     wrapper     = GetWrapper<SwapchainKHRWrapper>(swapchains[i]);
         uint32_t image_index = image_indices[i];
 
         assert((wrapper != nullptr) && (image_index < wrapper->image_acquired_info.size()));
@@ -1041,7 +1550,7 @@ void VulkanStateTracker::TrackAccelerationStructureKHRDeviceAddress(VkDevice
 {
     assert((device != VK_NULL_HANDLE) && (accel_struct != VK_NULL_HANDLE));
 
-    auto wrapper       = reinterpret_cast<AccelerationStructureKHRWrapper*>(accel_struct);
+    auto wrapper       = GetWrapper<AccelerationStructureKHRWrapper>(accel_struct);
     wrapper->device_id = GetWrappedId(device);
     wrapper->address   = address;
 }
@@ -1050,11 +1559,118 @@ void VulkanStateTracker::TrackDeviceMemoryDeviceAddress(VkDevice device, VkDevic
 {
     assert((device != VK_NULL_HANDLE) && (memory != VK_NULL_HANDLE));
 
-    auto wrapper       = reinterpret_cast<DeviceMemoryWrapper*>(memory);
+    auto wrapper       = GetWrapper<DeviceMemoryWrapper>(memory);
     wrapper->device_id = GetWrappedId(device);
     wrapper->address   = address;
 }
 
+void VulkanStateTracker::TrackAccelerationStructureKHRBuffer(VkAccelerationStructureKHR accel_struct, VkBuffer buffer)
+{
+    assert(accel_struct != VK_NULL_HANDLE);
+
+    auto wrapper       = GetWrapper<AccelerationStructureKHRWrapper>(accel_struct);
+    wrapper->buffer_id = GetWrappedId(buffer);
+}
+
+void VulkanStateTracker::TrackBuildAccelerationStructuresAddresses(
+    VkCommandBuffer command_buffer, uint32_t info_count, const VkAccelerationStructureBuildGeometryInfoKHR* infos)
+{
+    assert(command_buffer != VK_NULL_HANDLE);
+
+    auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
+
+    if (infos == nullptr)
+    {
+        return;
+    }
+
+    // Scratch memory is not read before it is written by the build, so its address is not recorded.
+    for (uint32_t i = 0; i < info_count; ++i)
+    {
+        const VkAccelerationStructureBuildGeometryInfoKHR& info = infos[i];
+
+        for (uint32_t j = 0; j < info.geometryCount; ++j)
+        {
+            const VkAccelerationStructureGeometryKHR* geometry =
+                (info.pGeometries != nullptr) ? &info.pGeometries[j] : info.ppGeometries[j];
+
+            switch (geometry->geometryType)
+            {
+                case VK_GEOMETRY_TYPE_TRIANGLES_KHR:
+                {
+                    const VkAccelerationStructureGeometryTrianglesDataKHR& triangles = geometry->geometry.triangles;
+                    VkDeviceSize vertex_count = static_cast<VkDeviceSize>(triangles.maxVertex) + 1;
+
+                    AddCommandAddressRange(
+                        wrapper, triangles.vertexData.deviceAddress, triangles.vertexStride * vertex_count);
+                    AddCommandAddressRange(
+                        wrapper, triangles.transformData.deviceAddress, sizeof(VkTransformMatrixKHR));
+
+                    if (triangles.indexType != VK_INDEX_TYPE_NONE_KHR)
+                    {
+                        AddCommandAddressRange(wrapper, triangles.indexData.deviceAddress, 0);
+                    }
+                    break;
+                }
+                case VK_GEOMETRY_TYPE_AABBS_KHR:
+                    AddCommandAddressRange(wrapper, geometry->geometry.aabbs.data.deviceAddress, 0);
+                    break;
+                case VK_GEOMETRY_TYPE_INSTANCES_KHR:
+                    AddCommandAddressRange(wrapper, geometry->geometry.instances.data.deviceAddress, 0);
+                    if (geometry->geometry.instances.arrayOfPointers)
+                    {
+                        // The instances are referenced by addresses that are stored in GPU memory.
+                        wrapper->unknown_address_access = true;
+                    }
+                    break;
+                default:
+                    wrapper->unknown_address_access = true;
+                    break;
+            }
+        }
+    }
+}
+
+void VulkanStateTracker::TrackTraceRaysAddresses(VkCommandBuffer                        command_buffer,
+                                                 const VkStridedDeviceAddressRegionKHR* raygen_table,
+                                                 const VkStridedDeviceAddressRegionKHR* miss_table,
+                                                 const VkStridedDeviceAddressRegionKHR* hit_table,
+                                                 const VkStridedDeviceAddressRegionKHR* callable_table)
+{
+    assert(command_buffer != VK_NULL_HANDLE);
+
+    auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
+
+    for (auto table : { raygen_table, miss_table, hit_table, callable_table })
+    {
+        if (table != nullptr)
+        {
+            AddCommandAddressRange(wrapper, table->deviceAddress, table->size);
+        }
+    }
+}
+
+void VulkanStateTracker::TrackCommandDeviceAddress(VkCommandBuffer command_buffer,
+                                                   VkDeviceAddress address,
+                                                   VkDeviceSize    size)
+{
+    assert(command_buffer != VK_NULL_HANDLE);
+
+    AddCommandAddressRange(GetWrapper<CommandBufferWrapper>(command_buffer), address, size);
+}
+
+void VulkanStateTracker::AddCommandAddressRange(CommandBufferWrapper* wrapper,
+                                                VkDeviceAddress       address,
+                                                VkDeviceSize          size)
+{
+    assert(wrapper != nullptr);
+
+    if (address != 0)
+    {
+        wrapper->command_address_ranges.push_back({ address, size });
+    }
+}
+
 void VulkanStateTracker::TrackRayTracingShaderGroupHandles(VkDevice    device,
                                                            VkPipeline  pipeline,
                                                            size_t      data_size,
@@ -1062,12 +1678,25 @@ void VulkanStateTracker::TrackRayTracingShaderGroupHandles(VkDevice    device,
 {
     assert((device != VK_NULL_HANDLE) && (pipeline != VK_NULL_HANDLE));
 
-    auto           wrapper   = reinterpret_cast<PipelineWrapper*>(pipeline);
+    auto           wrapper   = GetWrapper<PipelineWrapper>(pipeline);
     const uint8_t* byte_data = reinterpret_cast<const uint8_t*>(data);
     wrapper->device_id       = GetWrappedId(device);
     wrapper->shader_group_handle_data.assign(byte_data, byte_data + data_size);
 }
 
+CreateParameters VulkanStateTracker::CopyCreateParameters(const util::MemoryOutputStream* create_parameter_buffer)
+{
+    size_t size = create_parameter_buffer->GetDataSize();
+
+    tracked_data_size_.fetch_add(size, std::memory_order_relaxed);
+
+    return CreateParameters(new util::MemoryOutputStream(create_parameter_buffer->GetData(), size),
+                            [size](util::MemoryOutputStream* buffer) {
+                                tracked_data_size_.fetch_sub(size, std::memory_order_relaxed);
+                                delete buffer;
+                            });
+}
+
 void VulkanStateTracker::DestroyState(InstanceWrapper* wrapper)
 {
     assert(wrapper != nullptr);
@@ -1075,20 +1704,20 @@ void VulkanStateTracker::DestroyState(InstanceWrapper* wrapper)
 
     // Physical devices are not explicitly destroyed, so need to be removed from the state tracker when their parent
     // instance is destroyed.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
+    // Each child type is stored in a different state table shard, so the shard locks are acquired individually.
     for (const auto physical_device_entry : wrapper->child_physical_devices)
     {
         for (const auto display_entry : physical_device_entry->child_displays)
         {
             for (const auto display_mode_entry : display_entry->child_display_modes)
             {
-                state_table_.RemoveWrapper(display_mode_entry);
+                RemoveStateTableEntry(display_mode_entry);
             }
 
-            state_table_.RemoveWrapper(display_entry);
+            RemoveStateTableEntry(display_entry);
         }
 
-        state_table_.RemoveWrapper(physical_device_entry);
+        RemoveStateTableEntry(physical_device_entry);
     }
 }
 
@@ -1099,13 +1728,21 @@ void VulkanStateTracker::DestroyState(DeviceWrapper* wrapper)
 
     // Queues are not explicitly destroyed, so need to be removed from the state tracker when their parent device is
     // destroyed.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
+    std::unique_lock<std::mutex> lock(GetStateTableMutex<QueueWrapper>());
     for (const auto& entry : wrapper->child_queues)
     {
         state_table_.RemoveWrapper(entry);
     }
 }
 
+void VulkanStateTracker::DestroyState(CommandBufferWrapper* wrapper)
+{
+    assert(wrapper != nullptr);
+    wrapper->create_parameters = nullptr;
+
+    tracked_data_size_.fetch_sub(wrapper->command_data.GetDataSize(), std::memory_order_relaxed);
+}
+
 void VulkanStateTracker::DestroyState(CommandPoolWrapper* wrapper)
 {
     assert(wrapper != nullptr);
@@ -1113,10 +1750,11 @@ void VulkanStateTracker::DestroyState(CommandPoolWrapper* wrapper)
 
     // Destroying the pool implicitly destroys objects allocated from the pool, which need to be removed from state
     // tracking.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
+    std::unique_lock<std::mutex> lock(GetStateTableMutex<CommandBufferWrapper>());
     for (const auto& entry : wrapper->child_buffers)
     {
         state_table_.RemoveWrapper(entry.second);
+        tracked_data_size_.fetch_sub(entry.second->command_data.GetDataSize(), std::memory_order_relaxed);
     }
 }
 
@@ -1127,7 +1765,7 @@ void VulkanStateTracker::DestroyState(DescriptorPoolWrapper* wrapper)
 
     // Destroying the pool implicitly destroys objects allocated from the pool, which need to be removed from state
     // tracking.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
+    std::unique_lock<std::mutex> lock(GetStateTableMutex<DescriptorSetWrapper>());
     for (const auto& entry : wrapper->child_sets)
     {
         state_table_.RemoveWrapper(entry.second);
@@ -1141,7 +1779,7 @@ void VulkanStateTracker::DestroyState(SwapchainKHRWrapper* wrapper)
 
     // Swapchain images are not explicitly destroyed, so need to be removed from state tracking when the parent
     // swapchain is destroyed.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
+    std::unique_lock<std::mutex> lock(GetStateTableMutex<ImageWrapper>());
     for (auto entry : wrapper->child_images)
     {
         state_table_.RemoveWrapper(entry);
@@ -24,6 +24,7 @@
 #define GFXRECON_ENCODE_VULKAN_STATE_TRACKER_H
 
 #include "encode/descriptor_update_template_info.h"
+#include "encode/trim_content_cache.h"
 #include "encode/vulkan_handle_wrappers.h"
 #include "encode/vulkan_state_table.h"
 #include "encode/vulkan_state_tracker_initializers.h"
@@ -38,9 +39,12 @@
 
 #include "vulkan/vulkan.h"
 
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <mutex>
+#include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
@@ -52,11 +56,37 @@ class VulkanStateTracker
 
     ~VulkanStateTracker();
 
+    // When content_cache is not null, buffers and images that may be written by queue submissions are tagged with the
+    // cache generation, so that state snapshots can reuse cached content for resources that have not been modified.
+    void SetTrimContentCache(TrimContentCache* content_cache) { content_cache_ = content_cache; }
+
+    // Records the buffers and images that are referenced by queue submissions between the begin and end calls.  The
+    // address_access result is set when a submission may have accessed resources through device addresses that
+    // could not be identified, which includes resources referenced by acceleration structures.  Buffers with device
+    // addresses are always included in the buffer results.
+    //
+    // When resolve_device_addresses is true, the device address ranges that are recorded for acceleration structure
+    // builds and ray tracing commands are resolved to the buffers that contain them, and only those buffers and the
+    // buffers that store acceleration structures are included for accesses through device addresses.  Buffers that
+    // are only accessed through addresses that shaders read from GPU memory are not identified.
+    void BeginReferencedResourceTracking(bool resolve_device_addresses);
+
+    void EndReferencedResourceTracking(std::unordered_set<format::HandleId>* buffer_ids,
+                                       std::unordered_set<format::HandleId>* image_ids,
+                                       bool*                                 address_access);
+
     void WriteState(VulkanStateWriter* writer, uint64_t frame_number)
     {
         if (writer != nullptr)
         {
-            std::unique_lock<std::mutex> lock(state_table_mutex_);
+            // Lock every shard of the state table, in shard order, for a consistent snapshot.
+            std::vector<std::unique_lock<std::mutex>> locks;
+            locks.reserve(kStateTableShardCount);
+            for (auto& mutex : state_table_mutexes_)
+            {
+                locks.emplace_back(mutex);
+            }
+
             writer->WriteState(state_table_, frame_number);
         }
     }
@@ -73,19 +103,14 @@ class VulkanStateTracker
 
         if (*new_handle != VK_NULL_HANDLE)
         {
-            auto wrapper = reinterpret_cast<Wrapper*>(*new_handle);
+            auto wrapper = GetWrapper<Wrapper>(*new_handle);
 
             // Adds the handle wrapper to the object state table, filtering for duplicate handle retrieval.
-            std::unique_lock<std::mutex> lock(state_table_mutex_);
+            std::unique_lock<std::mutex> lock(GetStateTableMutex<Wrapper>());
             if (state_table_.InsertWrapper(wrapper->handle_id, wrapper))
             {
                 vulkan_state_tracker::InitializeState<ParentHandle, Wrapper, CreateInfo>(
-                    parent_handle,
-                    wrapper,
-                    create_info,
-                    create_call_id,
-                    std::make_shared<util::MemoryOutputStream>(create_parameter_buffer->GetData(),
-                                                               create_parameter_buffer->GetDataSize()));
+                    parent_handle, wrapper, create_info, create_call_id, CopyCreateParameters(create_parameter_buffer));
             }
         }
     }
@@ -101,15 +126,14 @@ class VulkanStateTracker
         assert(new_handles != nullptr);
         assert(create_parameter_buffer != nullptr);
 
-        CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        CreateParameters create_parameters = CopyCreateParameters(create_parameter_buffer);
 
-        std::unique_lock<std::mutex> lock(state_table_mutex_);
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<Wrapper>());
         for (uint32_t i = 0; i < count; ++i)
         {
             if (new_handles[i] != VK_NULL_HANDLE)
             {
-                auto wrapper = reinterpret_cast<Wrapper*>(new_handles[i]);
+                auto wrapper = GetWrapper<Wrapper>(new_handles[i]);
 
                 // Adds the handle wrapper to the object state table, filtering for duplicate handle retrieval.
                 if (state_table_.InsertWrapper(wrapper->handle_id, wrapper))
@@ -132,8 +156,7 @@ class VulkanStateTracker
     {
         assert(create_parameter_buffer != nullptr);
 
-        CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        CreateParameters create_parameters = CopyCreateParameters(create_parameter_buffer);
 
         {
             AddGroupHandles<ParentHandle, SecondaryHandle, Wrapper, CreateInfo>(
@@ -153,10 +176,9 @@ class VulkanStateTracker
         assert(unwrap_struct_handle != nullptr);
         assert(create_parameter_buffer != nullptr);
 
-        CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        CreateParameters create_parameters = CopyCreateParameters(create_parameter_buffer);
 
-        std::unique_lock<std::mutex> lock(state_table_mutex_);
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<Wrapper>());
         for (uint32_t i = 0; i < count; ++i)
         {
             auto wrapper = unwrap_struct_handle(&handle_structs[i]);
@@ -183,8 +205,7 @@ class VulkanStateTracker
 
         GFXRECON_UNREFERENCED_PARAMETER(unwrap_struct_handle);
 
-        CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        CreateParameters create_parameters = CopyCreateParameters(create_parameter_buffer);
 
         for (uint32_t i = 0; i < count; ++i)
         {
@@ -203,12 +224,12 @@ class VulkanStateTracker
     {
         if (handle != VK_NULL_HANDLE)
         {
-            auto wrapper = reinterpret_cast<Wrapper*>(handle);
+            auto wrapper = GetWrapper<Wrapper>(handle);
 
             // Scope the state table mutex lock because DestroyState also modifies the state table and will attempt to
-            // lock the mutex.
+            // lock the mutex for the shards of any child objects.
             {
-                std::unique_lock<std::mutex> lock(state_table_mutex_);
+                std::unique_lock<std::mutex> lock(GetStateTableMutex<Wrapper>());
                 if (!state_table_.RemoveWrapper(wrapper))
                 {
                     GFXRECON_LOG_WARNING(
@@ -226,7 +247,7 @@ class VulkanStateTracker
     {
         if (command_buffer != VK_NULL_HANDLE)
         {
-            auto wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
+            auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
 
             TrackCommandExecution(wrapper, call_id, parameter_buffer);
         }
@@ -241,7 +262,7 @@ class VulkanStateTracker
     {
         if (command_buffer != VK_NULL_HANDLE)
         {
-            auto wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffer);
+            auto wrapper = GetWrapper<CommandBufferWrapper>(command_buffer);
 
             TrackCommandExecution(wrapper, call_id, parameter_buffer);
             func(wrapper, args...);
@@ -250,6 +271,10 @@ class VulkanStateTracker
 
     void TrackResetCommandPool(VkCommandPool command_pool);
 
+    // Commands are not tracked while trimming is dormant, but the image layout and query info that is tracked for the
+    // command buffer is still reset by vkBeginCommandBuffer and vkResetCommandBuffer.
+    void TrackDormantCommandBufferReset(VkCommandBuffer command_buffer, format::ApiCallId call_id);
+
     void TrackPhysicalDeviceMemoryProperties(VkPhysicalDevice                        physical_device,
                                              const VkPhysicalDeviceMemoryProperties* properties);
 
@@ -355,9 +380,32 @@ class VulkanStateTracker
 
     void TrackDeviceMemoryDeviceAddress(VkDevice device, VkDeviceMemory memory, VkDeviceAddress address);
 
+    void TrackAccelerationStructureKHRBuffer(VkAccelerationStructureKHR accel_struct, VkBuffer buffer);
+
+    // Record the device address ranges that are read by acceleration structure builds and ray tracing commands, for
+    // trim optimization.
+    void TrackBuildAccelerationStructuresAddresses(VkCommandBuffer                                    command_buffer,
+                                                   uint32_t                                           info_count,
+                                                   const VkAccelerationStructureBuildGeometryInfoKHR* infos);
+
+    void TrackTraceRaysAddresses(VkCommandBuffer                        command_buffer,
+                                 const VkStridedDeviceAddressRegionKHR* raygen_table,
+                                 const VkStridedDeviceAddressRegionKHR* miss_table,
+                                 const VkStridedDeviceAddressRegionKHR* hit_table,
+                                 const VkStridedDeviceAddressRegionKHR* callable_table);
+
+    void TrackCommandDeviceAddress(VkCommandBuffer command_buffer, VkDeviceAddress address, VkDeviceSize size);
+
     void TrackRayTracingShaderGroupHandles(VkDevice device, VkPipeline pipeline, size_t data_size, const void* data);
 
+    // Total size of the create parameters and command buffer command data that are stored for state snapshots, which
+    // is the bulk of the memory used by state tracking.
+    static uint64_t GetTrackedDataSize() { return tracked_data_size_.load(std::memory_order_relaxed); }
+
   private:
+    // Copies create parameters to a buffer that is included in the tracked data size until it is released.
+    static CreateParameters CopyCreateParameters(const util::MemoryOutputStream* create_parameter_buffer);
+
     template <typename ParentHandle, typename SecondaryHandle, typename Wrapper, typename CreateInfo>
     void AddGroupHandles(ParentHandle                  parent_handle,
                          SecondaryHandle               secondary_handle,
@@ -370,12 +418,12 @@ class VulkanStateTracker
         assert(new_handles != nullptr);
         assert(create_parameters != nullptr);
 
-        std::unique_lock<std::mutex> lock(state_table_mutex_);
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<Wrapper>());
         for (uint32_t i = 0; i < count; ++i)
         {
             if (new_handles[i] != VK_NULL_HANDLE)
             {
-                auto wrapper = reinterpret_cast<Wrapper*>(new_handles[i]);
+                auto wrapper = GetWrapper<Wrapper>(new_handles[i]);
 
                 // Adds the handle wrapper to the object state table, filtering for duplicate handle retrieval.
                 if (state_table_.InsertWrapper(wrapper->handle_id, wrapper))
@@ -392,15 +440,78 @@ class VulkanStateTracker
                     vulkan_state_tracker::
                         InitializeGroupObjectState<ParentHandle, SecondaryHandle, Wrapper, CreateInfo>(
                             parent_handle, secondary_handle, wrapper, create_info, create_call_id, create_parameters);
+
+                    SetCreateSequence(wrapper);
                 }
             }
         }
     }
 
+    // The state table is sharded by handle type, with a separate mutex for each wrapper type, so that threads
+    // creating and destroying objects of different types do not serialize on a single lock.  Shard indices are
+    // assigned to wrapper types on first use.
+    template <typename Wrapper>
+    std::mutex& GetStateTableMutex()
+    {
+        static const size_t shard = next_state_table_shard_.fetch_add(1) % kStateTableShardCount;
+        return state_table_mutexes_[shard];
+    }
+
+    template <typename Wrapper>
+    void SetCreateSequence(Wrapper* wrapper)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(wrapper);
+    }
+
+    // Called with the pipeline state table shard locked.
+    void SetCreateSequence(PipelineWrapper* wrapper) { wrapper->create_sequence = ++pipeline_create_sequence_; }
+
+    // Removes a single wrapper from the state table, locking only the shard for the wrapper type.
+    template <typename Wrapper>
+    void RemoveStateTableEntry(const Wrapper* wrapper)
+    {
+        std::unique_lock<std::mutex> lock(GetStateTableMutex<Wrapper>());
+        state_table_.RemoveWrapper(wrapper);
+    }
+
+    // Retrieves the IDs of the buffers and images referenced by a submitted command buffer, identified from the handles
+    // referenced by commands, the descriptors of bound descriptor sets, and image layout transitions.  When
+    // writable_only is true, only the descriptors that can be written by shaders are included.  The lists may contain
+    // duplicates.  When address_ranges is not null, the device address ranges recorded for the command buffers are
+    // retrieved instead of setting address_access for acceleration structure references.
+    void GetSubmittedResourceIds(const CommandBufferWrapper*      wrapper,
+                                 bool                             writable_only,
+                                 std::vector<format::HandleId>*   buffer_ids,
+                                 std::vector<format::HandleId>*   image_ids,
+                                 bool*                            address_access,
+                                 std::vector<DeviceAddressRange>* address_ranges = nullptr);
+
+    // Adds the IDs of the buffers with device addresses that overlap the address ranges to buffer_ids.  Returns false
+    // if an address range is not contained by a buffer.
+    bool GetAddressRangeBufferIds(const std::vector<DeviceAddressRange>& address_ranges,
+                                  std::vector<format::HandleId>*         buffer_ids);
+
+    void AddCommandAddressRange(CommandBufferWrapper* wrapper, VkDeviceAddress address, VkDeviceSize size);
+
+    // Tags the buffers and images that may be written by a submitted command buffer with the trim content cache
+    // generation.
+    void TrackResourceWrites(const CommandBufferWrapper* wrapper, uint64_t generation);
+
+    void TrackReferencedResources(const CommandBufferWrapper* wrapper);
+
     void TrackCommandExecution(CommandBufferWrapper*           wrapper,
                                format::ApiCallId               call_id,
                                const util::MemoryOutputStream* parameter_buffer);
 
+    void ResetCommandBufferState(CommandBufferWrapper* wrapper);
+
+    static std::unique_ptr<DescriptorInfo::Chunk> CreateDescriptorChunk(VkDescriptorType type);
+
+    // Marks a range of descriptor array elements as written, allocating their storage chunks, and invokes
+    // update(chunk, chunk_element, range_offset, update_count) for the part of the range stored by each chunk.
+    template <typename Update>
+    static void UpdateDescriptorRange(DescriptorInfo* binding, uint32_t first_element, uint32_t count, Update update);
+
     template <typename Wrapper>
     void DestroyState(Wrapper* wrapper)
     {
@@ -412,6 +523,8 @@ class VulkanStateTracker
 
     void DestroyState(DeviceWrapper* wrapper);
 
+    void DestroyState(CommandBufferWrapper* wrapper);
+
     void DestroyState(CommandPoolWrapper* wrapper);
 
     void DestroyState(DescriptorPoolWrapper* wrapper);
@@ -419,8 +532,23 @@ class VulkanStateTracker
     void DestroyState(SwapchainKHRWrapper* wrapper);
 
   private:
-    std::mutex       state_table_mutex_;
-    VulkanStateTable state_table_;
+    static const size_t kStateTableShardCount = 64;
+
+  private:
+    static std::atomic<size_t>   next_state_table_shard_;
+    static std::atomic<uint64_t> tracked_data_size_; // Static, as wrappers can release their data after the tracker.
+    std::mutex                   state_table_mutexes_[kStateTableShardCount];
+    VulkanStateTable             state_table_;
+    uint64_t                     pipeline_create_sequence_{ 0 };
+    TrimContentCache*            content_cache_{ nullptr };
+
+    // Resources referenced by queue submissions while trim referenced resource tracking is active.
+    std::mutex                           referenced_resources_mutex_;
+    bool                                 track_referenced_resources_{ false };
+    bool                                 referenced_address_access_{ false };
+    bool                                 resolve_device_addresses_{ false };
+    std::unordered_set<format::HandleId> referenced_buffer_ids_;
+    std::unordered_set<format::HandleId> referenced_image_ids_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
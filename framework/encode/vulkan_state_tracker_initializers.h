@@ -108,7 +108,7 @@ inline void InitializeState<VkPhysicalDevice, DeviceWrapper, VkDeviceCreateInfo>
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    wrapper->physical_device = reinterpret_cast<PhysicalDeviceWrapper*>(parent_handle);
+    wrapper->physical_device = GetWrapper<PhysicalDeviceWrapper>(parent_handle);
 }
 
 template <>
@@ -134,7 +134,7 @@ inline void InitializeState<VkDevice, PipelineLayoutWrapper, VkPipelineLayoutCre
     {
         assert(create_info->pSetLayouts[i] != VK_NULL_HANDLE);
 
-        auto layout_wrapper = reinterpret_cast<DescriptorSetLayoutWrapper*>(create_info->pSetLayouts[i]);
+        auto layout_wrapper = GetWrapper<DescriptorSetLayoutWrapper>(create_info->pSetLayouts[i]);
         CreateDependencyInfo info;
         info.handle_id         = layout_wrapper->handle_id;
         info.create_call_id    = layout_wrapper->create_call_id;
@@ -166,6 +166,25 @@ InitializeState<VkDevice, CommandPoolWrapper, VkCommandPoolCreateInfo>(VkDevice
     wrapper->queue_family_index = create_info->queueFamilyIndex;
 }
 
+template <>
+inline void InitializeState<VkDevice, PipelineCacheWrapper, VkPipelineCacheCreateInfo>(
+    VkDevice                         parent_handle,
+    PipelineCacheWrapper*            wrapper,
+    const VkPipelineCacheCreateInfo* create_info,
+    format::ApiCallId                create_call_id,
+    CreateParameters                 create_parameters)
+{
+    assert(wrapper != nullptr);
+    assert(create_parameters != nullptr);
+
+    GFXRECON_UNREFERENCED_PARAMETER(create_info);
+
+    wrapper->create_call_id    = create_call_id;
+    wrapper->create_parameters = std::move(create_parameters);
+
+    wrapper->device = GetWrapper<DeviceWrapper>(parent_handle);
+}
+
 template <>
 inline void InitializeState<VkDevice, QueryPoolWrapper, VkQueryPoolCreateInfo>(VkDevice          parent_handle,
                                                                                QueryPoolWrapper* wrapper,
@@ -180,7 +199,7 @@ inline void InitializeState<VkDevice, QueryPoolWrapper, VkQueryPoolCreateInfo>(V
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    wrapper->device      = reinterpret_cast<DeviceWrapper*>(parent_handle);
+    wrapper->device      = GetWrapper<DeviceWrapper>(parent_handle);
     wrapper->query_type  = create_info->queryType;
     wrapper->query_count = create_info->queryCount;
     wrapper->pending_queries.resize(create_info->queryCount);
@@ -203,7 +222,7 @@ inline void InitializeState<VkDevice, FenceWrapper, VkFenceCreateInfo>(VkDevice
     wrapper->create_parameters = std::move(create_parameters);
 
     wrapper->created_signaled = ((create_info->flags & VK_FENCE_CREATE_SIGNALED_BIT) == VK_FENCE_CREATE_SIGNALED_BIT);
-    wrapper->device           = reinterpret_cast<DeviceWrapper*>(parent_handle);
+    wrapper->device           = GetWrapper<DeviceWrapper>(parent_handle);
 }
 
 template <>
@@ -222,7 +241,7 @@ inline void InitializeState<VkDevice, EventWrapper, VkEventCreateInfo>(VkDevice
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    wrapper->device = reinterpret_cast<DeviceWrapper*>(parent_handle);
+    wrapper->device = GetWrapper<DeviceWrapper>(parent_handle);
 }
 
 template <>
@@ -241,7 +260,7 @@ inline void InitializeState<VkDevice, SemaphoreWrapper, VkSemaphoreCreateInfo>(V
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    wrapper->device = reinterpret_cast<DeviceWrapper*>(parent_handle);
+    wrapper->device = GetWrapper<DeviceWrapper>(parent_handle);
 
     auto next = reinterpret_cast<const VkBaseInStructure*>(create_info->pNext);
     while (next)
@@ -272,7 +291,7 @@ InitializeState<VkDevice, FramebufferWrapper, VkFramebufferCreateInfo>(VkDevice
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    auto render_pass_wrapper = reinterpret_cast<RenderPassWrapper*>(create_info->renderPass);
+    auto render_pass_wrapper = GetWrapper<RenderPassWrapper>(create_info->renderPass);
     assert(render_pass_wrapper != nullptr);
     wrapper->render_pass_id                = render_pass_wrapper->handle_id;
     wrapper->render_pass_create_call_id    = render_pass_wrapper->create_call_id;
@@ -282,7 +301,7 @@ InitializeState<VkDevice, FramebufferWrapper, VkFramebufferCreateInfo>(VkDevice
     {
         for (uint32_t i = 0; i < create_info->attachmentCount; ++i)
         {
-            auto image_view_wrapper = reinterpret_cast<ImageViewWrapper*>(create_info->pAttachments[i]);
+            auto image_view_wrapper = GetWrapper<ImageViewWrapper>(create_info->pAttachments[i]);
             assert(image_view_wrapper != nullptr);
 
             wrapper->image_view_ids.push_back(image_view_wrapper->handle_id);
@@ -340,7 +359,7 @@ inline void InitializeGroupObjectState<VkDevice, VkPipelineCache, PipelineWrappe
 
     for (uint32_t i = 0; i < create_info->stageCount; ++i)
     {
-        auto shader_wrapper = reinterpret_cast<ShaderModuleWrapper*>(create_info->pStages[i].module);
+        auto shader_wrapper = GetWrapper<ShaderModuleWrapper>(create_info->pStages[i].module);
         assert(shader_wrapper != nullptr);
 
         CreateDependencyInfo info;
@@ -351,14 +370,14 @@ inline void InitializeGroupObjectState<VkDevice, VkPipelineCache, PipelineWrappe
         wrapper->shader_module_dependencies.emplace_back(std::move(info));
     }
 
-    auto render_pass_wrapper = reinterpret_cast<RenderPassWrapper*>(create_info->renderPass);
+    auto render_pass_wrapper = GetWrapper<RenderPassWrapper>(create_info->renderPass);
     assert(render_pass_wrapper != nullptr);
 
     wrapper->render_pass_dependency.handle_id         = render_pass_wrapper->handle_id;
     wrapper->render_pass_dependency.create_call_id    = render_pass_wrapper->create_call_id;
     wrapper->render_pass_dependency.create_parameters = render_pass_wrapper->create_parameters;
 
-    auto layout_wrapper = reinterpret_cast<PipelineLayoutWrapper*>(create_info->layout);
+    auto layout_wrapper = GetWrapper<PipelineLayoutWrapper>(create_info->layout);
     assert(layout_wrapper != nullptr);
 
     wrapper->layout_dependency.handle_id         = layout_wrapper->handle_id;
@@ -388,7 +407,7 @@ inline void InitializeGroupObjectState<VkDevice, VkPipelineCache, PipelineWrappe
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    auto shader_wrapper = reinterpret_cast<ShaderModuleWrapper*>(create_info->stage.module);
+    auto shader_wrapper = GetWrapper<ShaderModuleWrapper>(create_info->stage.module);
     assert(shader_wrapper != nullptr);
 
     CreateDependencyInfo info;
@@ -398,7 +417,7 @@ inline void InitializeGroupObjectState<VkDevice, VkPipelineCache, PipelineWrappe
 
     wrapper->shader_module_dependencies.emplace_back(std::move(info));
 
-    auto layout_wrapper = reinterpret_cast<PipelineLayoutWrapper*>(create_info->layout);
+    auto layout_wrapper = GetWrapper<PipelineLayoutWrapper>(create_info->layout);
     assert(layout_wrapper != nullptr);
 
     wrapper->layout_dependency.handle_id         = layout_wrapper->handle_id;
@@ -430,7 +449,7 @@ inline void InitializeGroupObjectState<VkDevice, VkPipelineCache, PipelineWrappe
 
     for (uint32_t i = 0; i < create_info->stageCount; ++i)
     {
-        auto shader_wrapper = reinterpret_cast<ShaderModuleWrapper*>(create_info->pStages[i].module);
+        auto shader_wrapper = GetWrapper<ShaderModuleWrapper>(create_info->pStages[i].module);
         assert(shader_wrapper != nullptr);
 
         CreateDependencyInfo info;
@@ -441,7 +460,7 @@ inline void InitializeGroupObjectState<VkDevice, VkPipelineCache, PipelineWrappe
         wrapper->shader_module_dependencies.emplace_back(std::move(info));
     }
 
-    auto layout_wrapper = reinterpret_cast<PipelineLayoutWrapper*>(create_info->layout);
+    auto layout_wrapper = GetWrapper<PipelineLayoutWrapper>(create_info->layout);
     assert(layout_wrapper != nullptr);
 
     wrapper->layout_dependency.handle_id         = layout_wrapper->handle_id;
@@ -474,7 +493,7 @@ InitializeGroupObjectState<VkDevice, VkDeferredOperationKHR, PipelineWrapper, Vk
 
     for (uint32_t i = 0; i < create_info->stageCount; ++i)
     {
-        auto shader_wrapper = reinterpret_cast<ShaderModuleWrapper*>(create_info->pStages[i].module);
+        auto shader_wrapper = GetWrapper<ShaderModuleWrapper>(create_info->pStages[i].module);
         assert(shader_wrapper != nullptr);
 
         CreateDependencyInfo info;
@@ -485,7 +504,7 @@ InitializeGroupObjectState<VkDevice, VkDeferredOperationKHR, PipelineWrapper, Vk
         wrapper->shader_module_dependencies.emplace_back(std::move(info));
     }
 
-    auto layout_wrapper = reinterpret_cast<PipelineLayoutWrapper*>(create_info->layout);
+    auto layout_wrapper = GetWrapper<PipelineLayoutWrapper>(create_info->layout);
     assert(layout_wrapper != nullptr);
 
     wrapper->layout_dependency.handle_id         = layout_wrapper->handle_id;
@@ -588,8 +607,8 @@ InitializeState<VkDevice, SwapchainKHRWrapper, VkSwapchainCreateInfoKHR>(VkDevic
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    wrapper->device        = reinterpret_cast<DeviceWrapper*>(parent_handle);
-    wrapper->surface       = reinterpret_cast<SurfaceKHRWrapper*>(create_info->surface);
+    wrapper->device        = GetWrapper<DeviceWrapper>(parent_handle);
+    wrapper->surface       = GetWrapper<SurfaceKHRWrapper>(create_info->surface);
     wrapper->format        = create_info->imageFormat;
     wrapper->extent        = { create_info->imageExtent.width, create_info->imageExtent.height, 0 };
     wrapper->pre_transform = create_info->preTransform;
@@ -619,7 +638,7 @@ inline void InitializeGroupObjectState<VkDevice, VkSwapchainKHR, ImageWrapper, v
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    auto swapchain_wrapper = reinterpret_cast<SwapchainKHRWrapper*>(swapchain_handle);
+    auto swapchain_wrapper = GetWrapper<SwapchainKHRWrapper>(swapchain_handle);
     assert(swapchain_wrapper != nullptr);
 
     wrapper->image_type         = VK_IMAGE_TYPE_2D;
@@ -651,7 +670,7 @@ InitializeState<VkDevice, BufferViewWrapper, VkBufferViewCreateInfo>(VkDevice
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    auto buffer        = reinterpret_cast<BufferWrapper*>(create_info->buffer);
+    auto buffer        = GetWrapper<BufferWrapper>(create_info->buffer);
     wrapper->buffer_id = buffer->handle_id;
 }
 
@@ -671,7 +690,7 @@ inline void InitializeState<VkDevice, ImageViewWrapper, VkImageViewCreateInfo>(V
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    auto image        = reinterpret_cast<ImageWrapper*>(create_info->image);
+    auto image        = GetWrapper<ImageWrapper>(create_info->image);
     wrapper->image_id = image->handle_id;
     wrapper->image    = image;
 }
@@ -749,9 +768,9 @@ inline void InitializePoolObjectState(VkDevice                           parent_
     wrapper->create_call_id    = create_call_id;
     wrapper->create_parameters = std::move(create_parameters);
 
-    wrapper->device = reinterpret_cast<DeviceWrapper*>(parent_handle);
+    wrapper->device = GetWrapper<DeviceWrapper>(parent_handle);
 
-    auto layout_wrapper = reinterpret_cast<DescriptorSetLayoutWrapper*>(alloc_info->pSetLayouts[alloc_index]);
+    auto layout_wrapper = GetWrapper<DescriptorSetLayoutWrapper>(alloc_info->pSetLayouts[alloc_index]);
     assert(layout_wrapper != nullptr);
 
     // Add a binding entry for each binding described by the descriptor set layout.
@@ -761,58 +780,9 @@ inline void InitializePoolObjectState(VkDevice                           parent_
         descriptor_info.type               = binding_info.type;
         descriptor_info.count              = binding_info.count;
         descriptor_info.immutable_samplers = binding_info.immutable_samplers;
-        descriptor_info.written            = std::make_unique<bool[]>(binding_info.count);
 
-        std::fill(descriptor_info.written.get(), descriptor_info.written.get() + binding_info.count, false);
-
-        descriptor_info.handle_ids = std::make_unique<format::HandleId[]>(binding_info.count);
-
-        switch (binding_info.type)
-        {
-            case VK_DESCRIPTOR_TYPE_SAMPLER:
-            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                descriptor_info.sampler_ids = std::make_unique<format::HandleId[]>(binding_info.count);
-                descriptor_info.images      = std::make_unique<VkDescriptorImageInfo[]>(binding_info.count);
-                break;
-            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                descriptor_info.buffers = std::make_unique<VkDescriptorBufferInfo[]>(binding_info.count);
-                break;
-            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                descriptor_info.texel_buffer_views = std::make_unique<VkBufferView[]>(binding_info.count);
-                break;
-            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
-                // TODO
-                break;
-            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
-                // TODO
-                break;
-            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
-                descriptor_info.acceleration_structures =
-                    std::make_unique<VkAccelerationStructureKHR[]>(binding_info.count);
-                break;
-            case VK_DESCRIPTOR_TYPE_MUTABLE_VALVE:
-                descriptor_info.sampler_ids        = std::make_unique<format::HandleId[]>(binding_info.count);
-                descriptor_info.images             = std::make_unique<VkDescriptorImageInfo[]>(binding_info.count);
-                descriptor_info.buffers            = std::make_unique<VkDescriptorBufferInfo[]>(binding_info.count);
-                descriptor_info.texel_buffer_views = std::make_unique<VkBufferView[]>(binding_info.count);
-                descriptor_info.acceleration_structures =
-                    std::make_unique<VkAccelerationStructureKHR[]>(binding_info.count);
-                descriptor_info.mutable_type = std::make_unique<VkDescriptorType[]>(binding_info.count);
-                std::fill(descriptor_info.mutable_type.get(),
-                          descriptor_info.mutable_type.get() + binding_info.count,
-                          VK_DESCRIPTOR_TYPE_MUTABLE_VALVE);
-                break;
-            default:
-                GFXRECON_LOG_WARNING("Attempting to initialize descriptor state for unrecognized descriptor type");
-                break;
-        }
+        // Element storage is allocated by chunk when descriptors are written.
+        descriptor_info.chunks.resize((binding_info.count + DescriptorInfo::kChunkMask) >> DescriptorInfo::kChunkShift);
 
         wrapper->bindings.emplace(binding_info.binding_index, std::move(descriptor_info));
     }
@@ -23,12 +23,16 @@
 #include "encode/vulkan_state_writer.h"
 
 #include "encode/struct_pointer_encoder.h"
+#include "encode/vulkan_handle_wrapper_util.h"
 #include "encode/vulkan_state_info.h"
 #include "format/format_util.h"
+#include "util/instrumentation.h"
 #include "util/logging.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <iterator>
 #include <limits>
 #include <unordered_map>
 
@@ -46,6 +50,31 @@ const format::HandleId kTempQueueId         = std::numeric_limits<format::Handle
 const format::HandleId kTempCommandPoolId   = std::numeric_limits<format::HandleId>::max() - 2;
 const format::HandleId kTempCommandBufferId = std::numeric_limits<format::HandleId>::max() - 3;
 
+// Resource memory is copied to the staging buffer in batches of up to this size.
+const VkDeviceSize kStagingBatchSize = 64 * 1024 * 1024;
+
+// Staging copy offsets are aligned to a common multiple of the texel block sizes and the optimal buffer copy offset
+// alignments reported by common implementations.
+const VkDeviceSize kStagingCopyAlignment = 768;
+
+// Object types without creation order dependencies are split into ranges of at least this many objects, which are
+// encoded concurrently.
+const size_t kMinSectionRangeSize = 4096;
+
+// Descriptor writes for multiple descriptor sets are combined into vkUpdateDescriptorSets commands that update up to
+// this many descriptors, beyond which the command is written when the current descriptor set is complete.
+const size_t kDescriptorWriteBatchSize = 16384;
+
+// Resource content is written as a pattern when it repeats a pattern whose size divides this common multiple of the
+// texel block sizes, and is at least the minimum size.  Smaller resources are written in full.
+const size_t kContentPatternPeriod  = 96;
+const size_t kMinContentPatternSize = 4096;
+
+static VkDeviceSize AlignStagingCopySize(VkDeviceSize size)
+{
+    return ((size + kStagingCopyAlignment - 1) / kStagingCopyAlignment) * kStagingCopyAlignment;
+}
+
 static bool IsMemoryCoherent(VkMemoryPropertyFlags property_flags)
 {
     return ((property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
@@ -80,11 +109,23 @@ static bool IsImageReadable(VkMemoryPropertyFlags      property_flags,
                                                    (memory_wrapper->mapped_size == VK_WHOLE_SIZE)))));
 }
 
-VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
-                                     util::Compressor*       compressor,
-                                     format::ThreadId        thread_id) :
+VulkanStateWriter::VulkanStateWriter(util::OutputStream*              output_stream,
+                                     util::Compressor*                compressor,
+                                     format::CompressionType          compression_type,
+                                     const format::CompressorOptions& compressor_options,
+                                     format::ThreadId                 thread_id,
+                                     format::HandleIdEncoding         handle_id_encoding,
+                                     FillMemoryDeduplicator*          fill_memory_deduplicator,
+                                     TrimContentCache*                content_cache,
+                                     BlobDeduplicator*                blob_deduplicator,
+                                     bool                             write_pipeline_cache_data,
+                                     bool                             write_content_patterns) :
     output_stream_(output_stream),
-    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
+    compressor_(compressor), compression_type_(compression_type), compressor_options_(compressor_options),
+    thread_id_(thread_id), handle_id_encoding_(handle_id_encoding), encoder_(&parameter_stream_, handle_id_encoding),
+    fill_memory_deduplicator_(fill_memory_deduplicator), content_cache_(content_cache),
+    blob_deduplicator_(blob_deduplicator), write_pipeline_cache_data_(write_pipeline_cache_data),
+    write_content_patterns_(write_content_patterns)
 {
     assert(output_stream != nullptr);
     assert(compressor != nullptr);
@@ -92,8 +133,87 @@ VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
 
 VulkanStateWriter::~VulkanStateWriter() {}
 
+VulkanStateWriter::DeferredSection::DeferredSection(const VulkanStateWriter*                parent,
+                                                    std::function<void(VulkanStateWriter*)> write_section)
+{
+    assert((parent != nullptr) && write_section);
+
+    // Compressors are not shared between threads, so each section needs its own.
+    if (parent->compressor_ != nullptr)
+    {
+        section_compressor_ = std::unique_ptr<util::Compressor>(
+            format::CreateCompressor(parent->compression_type_, parent->compressor_options_));
+    }
+
+    // Deduplication of fill memory commands is not needed, as fill memory commands are only written for resource
+    // memory state by the parent writer.
+    section_writer_ = std::make_unique<VulkanStateWriter>(&section_stream_,
+                                                          section_compressor_.get(),
+                                                          parent->compression_type_,
+                                                          parent->compressor_options_,
+                                                          parent->thread_id_,
+                                                          parent->handle_id_encoding_,
+                                                          nullptr,
+                                                          nullptr,
+                                                          nullptr,
+                                                          parent->write_pipeline_cache_data_);
+
+    VulkanStateWriter* section_writer = section_writer_.get();
+    thread_ = std::thread([section_writer, write_section]() { write_section(section_writer); });
+}
+
+VulkanStateWriter::DeferredSection::~DeferredSection()
+{
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+void VulkanStateWriter::DeferredSection::Finish(util::OutputStream* output_stream)
+{
+    assert(output_stream != nullptr);
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    output_stream->Write(section_stream_.GetData(), section_stream_.GetDataSize());
+    section_stream_.Reset();
+}
+
+template <typename Wrapper>
+void VulkanStateWriter::StartRangeSections(const VulkanStateTable&            state_table,
+                                           const std::vector<const Wrapper*>& wrappers,
+                                           void (VulkanStateWriter::*write_wrapper)(const VulkanStateTable&,
+                                                                                    const Wrapper*),
+                                           std::vector<std::unique_ptr<DeferredSection>>* sections)
+{
+    assert((write_wrapper != nullptr) && (sections != nullptr));
+
+    size_t thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    size_t range_count  = std::min(thread_count, (wrappers.size() + kMinSectionRangeSize - 1) / kMinSectionRangeSize);
+
+    for (size_t i = 0; i < range_count; ++i)
+    {
+        size_t begin = (wrappers.size() * i) / range_count;
+        size_t end   = (wrappers.size() * (i + 1)) / range_count;
+
+        sections->push_back(std::make_unique<DeferredSection>(
+            this, [&state_table, &wrappers, write_wrapper, begin, end](VulkanStateWriter* writer) {
+                for (size_t j = begin; j < end; ++j)
+                {
+                    (writer->*write_wrapper)(state_table, wrappers[j]);
+                }
+            }));
+    }
+}
+
 void VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t frame_number)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     // clang-format off
 
     format::Marker marker;
@@ -103,6 +223,14 @@ void VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t
     marker.frame_number = frame_number;
     output_stream_->Write(&marker, sizeof(marker));
 
+    // Blobs referenced by the stored create parameters.
+    if (blob_deduplicator_ != nullptr)
+    {
+        blob_deduplicator_->WriteRetainedBlobs([this](uint64_t blob_id, const void* data, size_t size) {
+            WriteSetBlobDataCmd(blob_id, data, size);
+        });
+    }
+
     // Instance, device, and queue creation.
     StandardCreateWrite<InstanceWrapper>(state_table);
     WritePhysicalDeviceState(state_table);
@@ -132,42 +260,81 @@ void VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t
     StandardCreateWrite<ImageWrapper>(state_table);
     WriteDeviceMemoryState(state_table);
 
+    // Sampler Y'CbCr conversions are written before the samplers that reference them, which are encoded by worker
+    // threads.
+    StandardCreateWrite<SamplerYcbcrConversionWrapper>(state_table);
+
+    // The sections that follow resource memory state only encode data from the state table, without accessing the
+    // GPU, so they are encoded by worker threads while resource memory is read back and encoded by this thread.  The
+    // encoded sections are then written to the output stream in dependency order.
+    DeferredSection render_section(this, [&state_table](VulkanStateWriter* writer) {
+        GFXRECON_INSTRUMENT_ZONE("WriteState render objects");
+
+        // Map memory after uploading resource data to buffers and images, which may require mapping resource memory
+        // ranges.
+        writer->WriteMappedMemoryState(state_table);
+
+        // Render object creation.
+        writer->StandardCreateWrite<RenderPassWrapper>(state_table);
+        writer->WriteFramebufferState(state_table);
+        writer->StandardCreateWrite<ShaderModuleWrapper>(state_table);
+        writer->StandardCreateWrite<DescriptorSetLayoutWrapper>(state_table);
+        writer->WritePipelineLayoutState(state_table);
+        writer->WritePipelineCacheState(state_table);
+        writer->WritePipelineState(state_table);
+        writer->StandardCreateWrite<AccelerationStructureKHRWrapper>(state_table);
+        writer->StandardCreateWrite<AccelerationStructureNVWrapper>(state_table);
+    });
+
+    DeferredSection descriptor_section(this, [&state_table](VulkanStateWriter* writer) {
+        GFXRECON_INSTRUMENT_ZONE("WriteState descriptors");
+
+        // Descriptor creation.
+        writer->StandardCreateWrite<DescriptorPoolWrapper>(state_table);
+        writer->StandardCreateWrite<DescriptorUpdateTemplateWrapper>(state_table);
+        writer->WriteDescriptorSetState(state_table);
+    });
+
+    DeferredSection command_section(this, [&state_table](VulkanStateWriter* writer) {
+        GFXRECON_INSTRUMENT_ZONE("WriteState commands");
+
+        // Query object creation.
+        writer->WriteQueryPoolState(state_table);
+        writer->StandardCreateWrite<PerformanceConfigurationINTELWrapper>(state_table);
+
+        // Command creation.
+        writer->StandardCreateWrite<CommandPoolWrapper>(state_table);
+        writer->WriteCommandBufferState(state_table);
+        writer->StandardCreateWrite<IndirectCommandsLayoutNVWrapper>(state_table);  // TODO: If we intend to support this, we need to reserve command space after creation.
+    });
+
+    // Views and samplers do not depend on other objects of the same type, so large tables are split into ranges that
+    // are encoded concurrently.  They are written ahead of the render objects that reference them.
+    std::vector<const BufferViewWrapper*>         buffer_views;
+    std::vector<const ImageViewWrapper*>          image_views;
+    std::vector<const SamplerWrapper*>            samplers;
+    std::vector<std::unique_ptr<DeferredSection>> view_sections;
+
+    state_table.GetWrappers(&buffer_views);
+    state_table.GetWrappers(&image_views);
+    state_table.GetWrappers(&samplers);
+
+    StartRangeSections(state_table, buffer_views, &VulkanStateWriter::WriteBufferViewState, &view_sections);
+    StartRangeSections(state_table, image_views, &VulkanStateWriter::WriteImageViewState, &view_sections);
+    StartRangeSections(state_table, samplers, &VulkanStateWriter::WriteSamplerState, &view_sections);
+
     // Bind memory after buffer/image creation and memory allocation. The buffer/image needs to be created before memory
     // allocation for extensions like dedicated allocation that require a valid buffer/image handle at memory allocation.
     WriteResourceMemoryState(state_table);
 
-    // Map memory after uploading resource data to buffers and images, which may require mapping resource memory ranges.
-    WriteMappedMemoryState(state_table);
-
-    WriteBufferViewState(state_table);
-    WriteImageViewState(state_table);
-    StandardCreateWrite<SamplerWrapper>(state_table);
-    StandardCreateWrite<SamplerYcbcrConversionWrapper>(state_table);
+    for (auto& section : view_sections)
+    {
+        section->Finish(output_stream_);
+    }
 
-    // Render object creation.
-    StandardCreateWrite<RenderPassWrapper>(state_table);
-    WriteFramebufferState(state_table);
-    StandardCreateWrite<ShaderModuleWrapper>(state_table);
-    StandardCreateWrite<DescriptorSetLayoutWrapper>(state_table);
-    WritePipelineLayoutState(state_table);
-    StandardCreateWrite<PipelineCacheWrapper>(state_table);
-    WritePipelineState(state_table);
-    StandardCreateWrite<AccelerationStructureKHRWrapper>(state_table);
-    StandardCreateWrite<AccelerationStructureNVWrapper>(state_table);
-
-    // Descriptor creation.
-    StandardCreateWrite<DescriptorPoolWrapper>(state_table);
-    StandardCreateWrite<DescriptorUpdateTemplateWrapper>(state_table);
-    WriteDescriptorSetState(state_table);
-
-    // Query object creation.
-    WriteQueryPoolState(state_table);
-    StandardCreateWrite<PerformanceConfigurationINTELWrapper>(state_table);
-
-    // Command creation.
-    StandardCreateWrite<CommandPoolWrapper>(state_table);
-    WriteCommandBufferState(state_table);
-    StandardCreateWrite<IndirectCommandsLayoutNVWrapper>(state_table);  // TODO: If we intend to support this, we need to reserve command space after creation.
+    render_section.Finish(output_stream_);
+    descriptor_section.Finish(output_stream_);
+    command_section.Finish(output_stream_);
 
     // Process swapchain image acquire.
     WriteSwapchainImageState(state_table);
@@ -175,6 +342,11 @@ void VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t
     marker.marker_type = format::kEndMarker;
     output_stream_->Write(&marker, sizeof(marker));
 
+    if (content_cache_ != nullptr)
+    {
+        content_cache_->EndSnapshot();
+    }
+
     // clang-format on
 }
 
@@ -244,10 +416,16 @@ void VulkanStateWriter::WriteCommandBufferState(const VulkanStateTable& state_ta
 {
     std::set<util::MemoryOutputStream*>      processed;
     std::vector<const CommandBufferWrapper*> primary;
+    uint32_t                                 dormant_count = 0;
 
     state_table.VisitWrappers([&](const CommandBufferWrapper* wrapper) {
         assert(wrapper != nullptr);
 
+        if (wrapper->dormant_recording)
+        {
+            ++dormant_count;
+        }
+
         // Filter duplicate calls to vkAllocateCommandBuffers for command buffers that were allocated by the same API
         // call and reference the same parameter buffer.
         if (processed.find(wrapper->create_parameters.get()) == processed.end())
@@ -276,6 +454,13 @@ void VulkanStateWriter::WriteCommandBufferState(const VulkanStateTable& state_ta
     {
         WriteCommandBufferCommands(wrapper, state_table);
     }
+
+    if (dormant_count > 0)
+    {
+        GFXRECON_LOG_WARNING("%u command buffers were recorded while trimming was dormant and have not been recorded "
+                             "again; their commands are not included in the state snapshot",
+                             dormant_count);
+    }
 }
 
 void VulkanStateWriter::WriteFenceState(const VulkanStateTable& state_table)
@@ -383,32 +568,38 @@ void VulkanStateWriter::WriteSemaphoreState(const VulkanStateTable& state_table)
     }
 }
 
-void VulkanStateWriter::WriteBufferViewState(const VulkanStateTable& state_table)
+void VulkanStateWriter::WriteBufferViewState(const VulkanStateTable& state_table, const BufferViewWrapper* wrapper)
 {
-    state_table.VisitWrappers([&](const BufferViewWrapper* wrapper) {
-        assert(wrapper != nullptr);
+    assert(wrapper != nullptr);
 
-        // Omit the current buffer view object if the buffer used to create it no longer exists.
-        if (IsBufferValid(wrapper->buffer_id, state_table))
-        {
-            // Write buffer view creation call.
-            WriteFunctionCall(wrapper->create_call_id, wrapper->create_parameters.get());
-        }
-    });
+    // Omit the current buffer view object if the buffer used to create it no longer exists.
+    if (IsBufferValid(wrapper->buffer_id, state_table))
+    {
+        // Write buffer view creation call.
+        WriteFunctionCall(wrapper->create_call_id, wrapper->create_parameters.get());
+    }
 }
 
-void VulkanStateWriter::WriteImageViewState(const VulkanStateTable& state_table)
+void VulkanStateWriter::WriteImageViewState(const VulkanStateTable& state_table, const ImageViewWrapper* wrapper)
 {
-    state_table.VisitWrappers([&](const ImageViewWrapper* wrapper) {
-        assert(wrapper != nullptr);
+    assert(wrapper != nullptr);
 
-        // Omit the current image view object if the image used to create it no longer exists.
-        if (IsImageValid(wrapper->image_id, state_table))
-        {
-            // Write image view creation call.
-            WriteFunctionCall(wrapper->create_call_id, wrapper->create_parameters.get());
-        }
-    });
+    // Omit the current image view object if the image used to create it no longer exists.
+    if (IsImageValid(wrapper->image_id, state_table))
+    {
+        // Write image view creation call.
+        WriteFunctionCall(wrapper->create_call_id, wrapper->create_parameters.get());
+    }
+}
+
+void VulkanStateWriter::WriteSamplerState(const VulkanStateTable& state_table, const SamplerWrapper* wrapper)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(state_table);
+
+    assert(wrapper != nullptr);
+
+    // Samplers are created individually, so there are no duplicate entries that share creation parameters.
+    WriteFunctionCall(wrapper->create_call_id, wrapper->create_parameters.get());
 }
 
 void VulkanStateWriter::WriteFramebufferState(const VulkanStateTable& state_table)
@@ -509,7 +700,7 @@ void VulkanStateWriter::WritePipelineState(const VulkanStateTable& state_table)
 
     // First pass over pipeline table to sort pipelines by type and determine which dependencies need to be created
     // temporarily.
-    state_table.VisitWrappers([&](const PipelineWrapper* wrapper) {
+    auto process_pipeline = [&](const PipelineWrapper* wrapper) {
         assert(wrapper != nullptr);
 
         // Determine type of pipeline.
@@ -625,7 +816,22 @@ void VulkanStateWriter::WritePipelineState(const VulkanStateTable& state_table)
                 WriteFunctionCall(wrapper->layout_dependency.create_call_id, create_parameters);
             }
         }
-    });
+    };
+
+    // The state table is ordered by handle ID, which does not match creation order for pipelines created by different
+    // threads, so pipelines are processed in creation order.
+    std::vector<const PipelineWrapper*> pipeline_wrappers;
+    state_table.VisitWrappers([&](const PipelineWrapper* wrapper) { pipeline_wrappers.push_back(wrapper); });
+    std::sort(pipeline_wrappers.begin(),
+              pipeline_wrappers.end(),
+              [](const PipelineWrapper* lhs, const PipelineWrapper* rhs) {
+                  return lhs->create_sequence < rhs->create_sequence;
+              });
+
+    for (auto wrapper : pipeline_wrappers)
+    {
+        process_pipeline(wrapper);
+    }
 
     // Pipeline object creation.
     for (const auto& entry : graphics_pipelines)
@@ -673,7 +879,8 @@ void VulkanStateWriter::WritePipelineState(const VulkanStateTable& state_table)
 void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_table)
 {
     std::set<util::MemoryOutputStream*> processed;
-    DescriptorSetWrapper                encode_wrapper;
+    DescriptorWriteBatch                batch;
+    format::HandleId                    batch_device_id = format::kNullHandleId;
 
     std::unordered_map<format::HandleId, const util::MemoryOutputStream*> temp_ds_layouts;
 
@@ -709,13 +916,21 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
             processed.insert(wrapper->create_parameters.get());
         }
 
-        // Write descriptor updates. This value will be processed by an EncodeStruct routine that expects all struct
-        // member handles to be wrapped handles (either need a const_cast or copy to temporary wrapper here).
-        encode_wrapper.handle_id = wrapper->handle_id;
+        // The writes of all bindings, and of the descriptor sets that follow from the same device, are batched into
+        // large update commands.
+        format::HandleId device_id = (wrapper->device != nullptr) ? wrapper->device->handle_id : format::kNullHandleId;
+        if (!batch.writes.empty() && (device_id != batch_device_id))
+        {
+            WriteDescriptorUpdateCommand(batch_device_id, &batch);
+        }
+
+        batch_device_id = device_id;
 
+        // Write descriptor updates. This value will be processed by an EncodeStruct routine that expects all struct
+        // member handles to be application handles, which only reads the handle ID of the const wrapper.
         VkWriteDescriptorSet write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
         write.pNext                = nullptr;
-        write.dstSet               = reinterpret_cast<VkDescriptorSet>(&encode_wrapper);
+        write.dstSet               = GetApplicationHandle(wrapper);
 
         for (const auto& binding_entry : wrapper->bindings)
         {
@@ -726,6 +941,22 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
 
             for (uint32_t i = 0; i < binding->count; ++i)
             {
+                // Skip the storage chunks that were never written.
+                if (((i & DescriptorInfo::kChunkMask) == 0) &&
+                    (binding->chunks[i >> DescriptorInfo::kChunkShift] == nullptr))
+                {
+                    if (active)
+                    {
+                        // End of an active descriptor write range.
+                        active                = false;
+                        write.descriptorCount = i - write.dstArrayElement;
+                        AddDescriptorWrite(binding, write, &batch);
+                    }
+
+                    i += DescriptorInfo::kChunkMask;
+                    continue;
+                }
+
                 VkDescriptorType descriptor_type;
                 bool             write_descriptor = CheckDescriptorStatus(binding, i, state_table, &descriptor_type);
 
@@ -743,7 +974,7 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
                         // End of an active descriptor write range.
                         active                = false;
                         write.descriptorCount = i - write.dstArrayElement;
-                        WriteDescriptorUpdateCommand(GetWrappedId(wrapper->device), binding, &write);
+                        AddDescriptorWrite(binding, write, &batch);
                     }
                 }
                 else if (active && (descriptor_type != write.descriptorType))
@@ -751,7 +982,7 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
                     // Mutable descriptor type change within an active write range
                     // End current range
                     write.descriptorCount = i - write.dstArrayElement;
-                    WriteDescriptorUpdateCommand(GetWrappedId(wrapper->device), binding, &write);
+                    AddDescriptorWrite(binding, write, &batch);
                     // Start new range
                     write.descriptorType  = descriptor_type;
                     write.dstArrayElement = i;
@@ -762,11 +993,21 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
             if (active)
             {
                 write.descriptorCount = binding->count - write.dstArrayElement;
-                WriteDescriptorUpdateCommand(GetWrappedId(wrapper->device), binding, &write);
+                AddDescriptorWrite(binding, write, &batch);
             }
         }
+
+        if (batch.descriptor_count >= kDescriptorWriteBatchSize)
+        {
+            WriteDescriptorUpdateCommand(batch_device_id, &batch);
+        }
     });
 
+    if (!batch.writes.empty())
+    {
+        WriteDescriptorUpdateCommand(batch_device_id, &batch);
+    }
+
     // Temporary object destruction.
     for (const auto& entry : temp_ds_layouts)
     {
@@ -774,6 +1015,75 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
     }
 }
 
+void VulkanStateWriter::WritePipelineCacheState(const VulkanStateTable& state_table)
+{
+    std::unordered_map<const DeviceWrapper*, std::vector<VkPipelineCache>> device_caches;
+
+    state_table.VisitWrappers([&](const PipelineCacheWrapper* wrapper) {
+        assert(wrapper != nullptr);
+
+        // Write pipeline cache creation call.
+        WriteFunctionCall(wrapper->create_call_id, wrapper->create_parameters.get());
+
+        if (write_pipeline_cache_data_ && (wrapper->device != nullptr))
+        {
+            device_caches[wrapper->device].push_back(wrapper->handle);
+        }
+    });
+
+    // The caches of a device are merged into a temporary cache, so that the data of pipelines that are shared by
+    // several caches is only written once.
+    for (const auto& device_entry : device_caches)
+    {
+        const DeviceWrapper* device_wrapper = device_entry.first;
+        const DeviceTable*   device_table   = &device_wrapper->layer_table;
+        VkDevice             device         = device_wrapper->handle;
+        const auto&          caches         = device_entry.second;
+
+        VkPipelineCacheCreateInfo create_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+        create_info.pNext                     = nullptr;
+        create_info.flags                     = 0;
+        create_info.initialDataSize           = 0;
+        create_info.pInitialData              = nullptr;
+
+        VkPipelineCache      merged_cache = VK_NULL_HANDLE;
+        size_t               data_size    = 0;
+        std::vector<uint8_t> data;
+        VkResult             result = device_table->CreatePipelineCache(device, &create_info, nullptr, &merged_cache);
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table->MergePipelineCaches(
+                device, merged_cache, static_cast<uint32_t>(caches.size()), caches.data());
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table->GetPipelineCacheData(device, merged_cache, &data_size, nullptr);
+        }
+
+        if ((result == VK_SUCCESS) && (data_size > 0))
+        {
+            data.resize(data_size);
+            result = device_table->GetPipelineCacheData(device, merged_cache, &data_size, data.data());
+        }
+
+        if (merged_cache != VK_NULL_HANDLE)
+        {
+            device_table->DestroyPipelineCache(device, merged_cache, nullptr);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("Failed to retrieve pipeline cache data during state snapshot generation");
+        }
+        else if (data_size > 0)
+        {
+            WriteSetPipelineCacheDataCommand(device_wrapper->handle_id, data_size, data.data());
+        }
+    }
+}
+
 void VulkanStateWriter::WriteQueryPoolState(const VulkanStateTable& state_table)
 {
     std::unordered_map<const DeviceWrapper*, std::vector<const QueryPoolWrapper*>> device_query_pools;
@@ -900,6 +1210,8 @@ void VulkanStateWriter::WriteSwapchainKhrState(const VulkanStateTable& state_tab
 
 void VulkanStateWriter::WriteDeviceMemoryState(const VulkanStateTable& state_table)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
     std::unordered_map<AHardwareBuffer*, const DeviceMemoryWrapper*> hardware_buffers;
 
@@ -936,6 +1248,8 @@ void VulkanStateWriter::WriteDeviceMemoryState(const VulkanStateTable& state_tab
 
 void VulkanStateWriter::WriteBufferState(const VulkanStateTable& state_table)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     state_table.VisitWrappers([&](const BufferWrapper* wrapper) {
         assert(wrapper != nullptr);
 
@@ -1035,16 +1349,13 @@ void VulkanStateWriter::ProcessHardwareBuffer(format::HandleId memory_id,
 
 void VulkanStateWriter::ProcessBufferMemory(const DeviceWrapper*                   device_wrapper,
                                             const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                                            uint32_t                               queue_family_index,
-                                            VkQueue                                queue,
-                                            VkCommandBuffer                        command_buffer,
-                                            VkBuffer                               staging_buffer,
-                                            VkDeviceMemory                         staging_memory,
-                                            bool                                   is_staging_memory_coherent)
+                                            const StagingContext&                  staging)
 {
     assert(device_wrapper != nullptr);
 
-    const DeviceTable* device_table = &device_wrapper->layer_table;
+    const DeviceTable*                     device_table = &device_wrapper->layer_table;
+    std::vector<const BufferSnapshotInfo*> staged_entries;
+    std::vector<VkDeviceSize>              copy_sizes;
 
     for (const auto& snapshot_entry : buffer_snapshot_info)
     {
@@ -1054,417 +1365,804 @@ void VulkanStateWriter::ProcessBufferMemory(const DeviceWrapper*
 
         assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
 
+        if (snapshot_entry.cached_content != nullptr)
+        {
+            const TrimContentCache::Entry* cached_content = snapshot_entry.cached_content;
+            WriteInitBufferBlock(device_wrapper->handle_id,
+                                 buffer_wrapper,
+                                 cached_content->compressed,
+                                 cached_content->pattern,
+                                 cached_content->data.data(),
+                                 cached_content->data.size());
+            continue;
+        }
+
         if (snapshot_entry.need_staging_copy)
         {
-            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-            begin_info.pNext                    = nullptr;
-            begin_info.flags                    = 0;
-            begin_info.pInheritanceInfo         = nullptr;
+            // Buffers that require a staging copy are processed in batches below.
+            staged_entries.push_back(&snapshot_entry);
+            copy_sizes.push_back(buffer_wrapper->created_size);
+            continue;
+        }
+
+        assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-            VkResult result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
+        VkResult result = VK_SUCCESS;
 
+        if (memory_wrapper->mapped_data == nullptr)
+        {
+            void* data = nullptr;
+            result     = device_table->MapMemory(device_wrapper->handle,
+                                             memory_wrapper->handle,
+                                             buffer_wrapper->bind_offset,
+                                             buffer_wrapper->created_size,
+                                             0,
+                                             &data);
             if (result == VK_SUCCESS)
             {
+                bytes = reinterpret_cast<uint8_t*>(data);
+            }
+        }
+        else
+        {
+            bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
+        }
+
+        if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
+        {
+            InvalidateMappedMemoryRange(
+                device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->created_size);
+        }
+
+        WriteInitBufferCommand(device_wrapper->handle_id, buffer_wrapper, bytes);
+
+        if ((bytes != nullptr) && (memory_wrapper->mapped_data == nullptr))
+        {
+            device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
+        }
+    }
+
+    if (!staged_entries.empty())
+    {
+        ProcessStagingBatches(
+            device_wrapper,
+            staging,
+            copy_sizes,
+            [&](size_t index, VkCommandBuffer command_buffer, VkDeviceSize staging_offset) {
                 VkBufferCopy copy_region;
                 copy_region.srcOffset = 0;
-                copy_region.dstOffset = 0;
-                copy_region.size      = buffer_wrapper->created_size;
+                copy_region.dstOffset = staging_offset;
+                copy_region.size      = staged_entries[index]->buffer_wrapper->created_size;
+
+                device_table->CmdCopyBuffer(
+                    command_buffer, staged_entries[index]->buffer_wrapper->handle, staging.buffer, 1, &copy_region);
+            },
+            [&](size_t index, const uint8_t* bytes) {
+                WriteInitBufferCommand(device_wrapper->handle_id, staged_entries[index]->buffer_wrapper, bytes, true);
+            });
+    }
+}
 
-                device_table->CmdCopyBuffer(command_buffer, buffer_wrapper->handle, staging_buffer, 1, &copy_region);
-                device_table->EndCommandBuffer(command_buffer);
+void VulkanStateWriter::ProcessImageMemory(const DeviceWrapper*                  device_wrapper,
+                                           const std::vector<ImageSnapshotInfo>& image_snapshot_info,
+                                           const StagingContext&                 staging,
+                                           const VulkanStateTable&               state_table)
+{
+    assert(device_wrapper != nullptr);
 
-                result = SubmitCommandBuffer(queue, command_buffer, device_table);
-                if (result == VK_SUCCESS)
-                {
-                    void* data = nullptr;
-                    result     = device_table->MapMemory(
-                        device_wrapper->handle, staging_memory, 0, buffer_wrapper->created_size, 0, &data);
-                    if (result == VK_SUCCESS)
-                    {
-                        bytes = reinterpret_cast<uint8_t*>(data);
+    const DeviceTable*                    device_table = &device_wrapper->layer_table;
+    std::vector<const ImageSnapshotInfo*> staged_entries;
+    std::vector<const ImageSnapshotInfo*> multisample_entries;
+    std::vector<VkDeviceSize>             copy_sizes;
 
-                        if (!is_staging_memory_coherent)
-                        {
-                            InvalidateMappedMemoryRange(
-                                device_wrapper, staging_memory, 0, buffer_wrapper->created_size);
-                        }
-                    }
-                }
-            }
-        }
-        else
-        {
-            assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
+    for (const auto& snapshot_entry : image_snapshot_info)
+    {
+        const ImageWrapper*        image_wrapper  = snapshot_entry.image_wrapper;
+        const DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
+        const uint8_t*             bytes          = nullptr;
 
-            VkResult result = VK_SUCCESS;
+        assert((image_wrapper != nullptr) && (memory_wrapper != nullptr));
+
+        if (snapshot_entry.cached_content != nullptr)
+        {
+            const TrimContentCache::Entry* cached_content = snapshot_entry.cached_content;
+            WriteInitImageBlock(device_wrapper->handle_id,
+                                snapshot_entry,
+                                cached_content->compressed,
+                                cached_content->pattern,
+                                cached_content->data.data(),
+                                cached_content->data.size());
+            continue;
+        }
 
-            if (memory_wrapper->mapped_data == nullptr)
+        if (snapshot_entry.need_staging_copy)
+        {
+            // Images that require a staging copy are processed in batches below.  Multisample images are resolved to
+            // a temporary image before the copy, and are processed individually.
+            if (image_wrapper->samples != VK_SAMPLE_COUNT_1_BIT)
             {
-                void* data = nullptr;
-                result     = device_table->MapMemory(device_wrapper->handle,
-                                                 memory_wrapper->handle,
-                                                 buffer_wrapper->bind_offset,
-                                                 buffer_wrapper->created_size,
-                                                 0,
-                                                 &data);
-                if (result == VK_SUCCESS)
-                {
-                    bytes = reinterpret_cast<uint8_t*>(data);
-                }
+                multisample_entries.push_back(&snapshot_entry);
             }
             else
             {
-                bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
+                staged_entries.push_back(&snapshot_entry);
+                copy_sizes.push_back(snapshot_entry.resource_size);
             }
+            continue;
+        }
+
+        assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
+
+        VkResult result = VK_SUCCESS;
 
-            if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
+        if (memory_wrapper->mapped_data == nullptr)
+        {
+            void* data = nullptr;
+            result     = device_table->MapMemory(device_wrapper->handle,
+                                             memory_wrapper->handle,
+                                             image_wrapper->bind_offset,
+                                             snapshot_entry.resource_size,
+                                             0,
+                                             &data);
+            if (result == VK_SUCCESS)
             {
-                InvalidateMappedMemoryRange(
-                    device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->created_size);
+                bytes = reinterpret_cast<uint8_t*>(data);
             }
         }
+        else
+        {
+            bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + image_wrapper->bind_offset;
+        }
 
-        if (bytes != nullptr)
+        if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
         {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
+            InvalidateMappedMemoryRange(
+                device_wrapper, memory_wrapper->handle, image_wrapper->bind_offset, snapshot_entry.resource_size);
+        }
 
-            size_t                          data_size = static_cast<size_t>(buffer_wrapper->created_size);
-            format::InitBufferCommandHeader upload_cmd;
+        WriteInitImageCommand(device_wrapper->handle_id, snapshot_entry, bytes);
 
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_type    = format::kInitBufferCommand;
-            upload_cmd.thread_id                     = thread_id_;
-            upload_cmd.device_id                     = device_wrapper->handle_id;
-            upload_cmd.buffer_id                     = buffer_wrapper->handle_id;
-            upload_cmd.data_size                     = data_size;
+        if ((bytes != nullptr) && (memory_wrapper->mapped_data == nullptr))
+        {
+            device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
+        }
+    }
 
-            if (compressor_ != nullptr)
-            {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+    if (!staged_entries.empty())
+    {
+        ProcessStagingBatches(
+            device_wrapper,
+            staging,
+            copy_sizes,
+            [&](size_t index, VkCommandBuffer command_buffer, VkDeviceSize staging_offset) {
+                RecordImageCopy(device_table,
+                                command_buffer,
+                                *staged_entries[index],
+                                staged_entries[index]->image_wrapper->handle,
+                                staging.buffer,
+                                staging_offset);
+            },
+            [&](size_t index, const uint8_t* bytes) {
+                WriteInitImageCommand(device_wrapper->handle_id, *staged_entries[index], bytes, true);
+            });
+    }
 
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+    for (const auto snapshot_entry : multisample_entries)
+    {
+        const ImageWrapper* image_wrapper  = snapshot_entry->image_wrapper;
+        VkImage             resolve_image  = VK_NULL_HANDLE;
+        VkDeviceMemory      resolve_memory = VK_NULL_HANDLE;
+        VkResult            result         = VK_ERROR_FORMAT_NOT_SUPPORTED;
 
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
-            }
+        // Omit the image data for depth-stencil images with sample count greater than 1.
+        if (snapshot_entry->aspect == VK_IMAGE_ASPECT_COLOR_BIT)
+        {
+            result = ResolveImage(device_wrapper,
+                                  image_wrapper,
+                                  staging.queue,
+                                  staging.command_buffers[0],
+                                  &resolve_image,
+                                  &resolve_memory,
+                                  state_table);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            ProcessStagingBatches(
+                device_wrapper,
+                staging,
+                { snapshot_entry->resource_size },
+                [&](size_t, VkCommandBuffer command_buffer, VkDeviceSize staging_offset) {
+                    RecordImageCopy(
+                        device_table, command_buffer, *snapshot_entry, resolve_image, staging.buffer, staging_offset);
+                },
+                [&](size_t, const uint8_t* bytes) {
+                    WriteInitImageCommand(device_wrapper->handle_id, *snapshot_entry, bytes, true);
+                });
+
+            device_table->DestroyImage(device_wrapper->handle, resolve_image, nullptr);
+            device_table->FreeMemory(device_wrapper->handle, resolve_memory, nullptr);
+        }
+        else
+        {
+            WriteInitImageCommand(device_wrapper->handle_id, *snapshot_entry, nullptr);
+        }
+    }
+}
+
+void VulkanStateWriter::ProcessStagingBatches(const DeviceWrapper*             device_wrapper,
+                                              const StagingContext&            staging,
+                                              const std::vector<VkDeviceSize>& copy_sizes,
+                                              RecordStagingCopyFunc            record_copy,
+                                              WriteStagingDataFunc             write_data)
+{
+    assert(device_wrapper != nullptr);
+
+    const DeviceTable* device_table = &device_wrapper->layer_table;
+
+    if ((staging.mapped_data == nullptr) || (staging.region_count == 0))
+    {
+        GFXRECON_LOG_ERROR("Trimming state snapshot has no staging buffer for resource memory copies");
+
+        for (size_t i = 0; i < copy_sizes.size(); ++i)
+        {
+            write_data(i, nullptr);
+        }
+
+        return;
+    }
+
+    // Assign each resource an offset within a staging region, starting a new batch when the region is full.  Every
+    // resource fits in a region, as regions are at least as large as the largest staging copy.
+    std::vector<VkDeviceSize> offsets(copy_sizes.size());
+    std::vector<size_t>       batch_ends;
+    VkDeviceSize              batch_size = 0;
 
-            // Calculate size of packet with compressed or uncompressed data size.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+    for (size_t i = 0; i < copy_sizes.size(); ++i)
+    {
+        assert(copy_sizes[i] <= staging.region_size);
+
+        if ((batch_size > 0) && ((batch_size + copy_sizes[i]) > staging.region_size))
+        {
+            batch_ends.push_back(i);
+            batch_size = 0;
+        }
+
+        offsets[i] = batch_size;
+        batch_size += AlignStagingCopySize(copy_sizes[i]);
+    }
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(bytes, data_size);
+    batch_ends.push_back(copy_sizes.size());
 
-            if (snapshot_entry.need_staging_copy)
+    std::vector<bool> submitted(batch_ends.size(), false);
+
+    auto submit_batch = [&](size_t batch) {
+        uint32_t        region         = static_cast<uint32_t>(batch % staging.region_count);
+        VkCommandBuffer command_buffer = staging.command_buffers[region];
+        VkDeviceSize    region_offset  = region * staging.region_size;
+        size_t          begin          = (batch == 0) ? 0 : batch_ends[batch - 1];
+
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.pNext                    = nullptr;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        begin_info.pInheritanceInfo         = nullptr;
+
+        VkResult result = device_table->ResetFences(device_wrapper->handle, 1, &staging.fences[region]);
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            for (size_t i = begin; i < batch_ends[batch]; ++i)
             {
-                device_table->UnmapMemory(device_wrapper->handle, staging_memory);
+                record_copy(i, command_buffer, region_offset + offsets[i]);
             }
-            else
+
+            device_table->EndCommandBuffer(command_buffer);
+
+            VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            submit_info.pNext                = nullptr;
+            submit_info.waitSemaphoreCount   = 0;
+            submit_info.pWaitSemaphores      = nullptr;
+            submit_info.pWaitDstStageMask    = nullptr;
+            submit_info.commandBufferCount   = 1;
+            submit_info.pCommandBuffers      = &command_buffer;
+            submit_info.signalSemaphoreCount = 0;
+            submit_info.pSignalSemaphores    = nullptr;
+
+            result = device_table->QueueSubmit(staging.queue, 1, &submit_info, staging.fences[region]);
+        }
+
+        submitted[batch] = (result == VK_SUCCESS);
+    };
+
+    submit_batch(0);
+
+    for (size_t batch = 0; batch < batch_ends.size(); ++batch)
+    {
+        uint32_t     region        = static_cast<uint32_t>(batch % staging.region_count);
+        VkDeviceSize region_offset = region * staging.region_size;
+        size_t       begin         = (batch == 0) ? 0 : batch_ends[batch - 1];
+        bool         copied        = false;
+
+        // Start the copy for the next batch, which uses the other staging region, before writing the current batch.
+        if (((batch + 1) < batch_ends.size()) && (staging.region_count > 1))
+        {
+            submit_batch(batch + 1);
+        }
+
+        if (submitted[batch])
+        {
+            VkResult result = device_table->WaitForFences(
+                device_wrapper->handle, 1, &staging.fences[region], VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+            if (result == VK_SUCCESS)
             {
-                if (memory_wrapper->mapped_data == nullptr)
+                if (!staging.is_coherent)
                 {
-                    device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
+                    InvalidateMappedMemoryRange(device_wrapper, staging.memory, 0, VK_WHOLE_SIZE);
                 }
+
+                copied = true;
             }
         }
-        else
+
+        for (size_t i = begin; i < batch_ends[batch]; ++i)
+        {
+            write_data(i, copied ? (staging.mapped_data + region_offset + offsets[i]) : nullptr);
+        }
+
+        // With a single staging region, the next batch can only be submitted after the current batch has been written.
+        if (((batch + 1) < batch_ends.size()) && (staging.region_count == 1))
         {
-            GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
-                               buffer_wrapper->handle_id);
+            submit_batch(batch + 1);
         }
     }
 }
 
-void VulkanStateWriter::ProcessImageMemory(const DeviceWrapper*                  device_wrapper,
-                                           const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                                           uint32_t                              queue_family_index,
-                                           VkQueue                               queue,
-                                           VkCommandBuffer                       command_buffer,
-                                           VkBuffer                              staging_buffer,
-                                           VkDeviceMemory                        staging_memory,
-                                           bool                                  is_staging_memory_coherent,
-                                           const VulkanStateTable&               state_table)
+void VulkanStateWriter::RecordImageCopy(const DeviceTable*       device_table,
+                                        VkCommandBuffer          command_buffer,
+                                        const ImageSnapshotInfo& snapshot_entry,
+                                        VkImage                  copy_image,
+                                        VkBuffer                 staging_buffer,
+                                        VkDeviceSize             staging_offset)
 {
-    assert(device_wrapper != nullptr);
+    assert(device_table != nullptr);
 
-    const DeviceTable* device_table = &device_wrapper->layer_table;
+    const ImageWrapper*  image_wrapper = snapshot_entry.image_wrapper;
+    VkImageMemoryBarrier memory_barrier;
+    VkImageAspectFlags   transition_aspect = snapshot_entry.aspect;
 
-    for (const auto& snapshot_entry : image_snapshot_info)
+    if ((transition_aspect == VK_IMAGE_ASPECT_DEPTH_BIT) || (transition_aspect == VK_IMAGE_ASPECT_STENCIL_BIT))
     {
-        const ImageWrapper*        image_wrapper  = snapshot_entry.image_wrapper;
-        const DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
-        const uint8_t*             bytes          = nullptr;
+        // Depth and stencil aspects need to be transitioned together, so get full aspect mask for image.
+        transition_aspect = GetFormatAspectMask(image_wrapper->format);
+    }
 
-        assert((image_wrapper != nullptr) && (memory_wrapper != nullptr));
+    // Resolved images are created in the transfer source layout.
+    bool transition_layout = (copy_image == image_wrapper->handle) &&
+                             (image_wrapper->current_layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
 
-        if (snapshot_entry.need_staging_copy)
-        {
-            VkImage        resolve_image  = VK_NULL_HANDLE;
-            VkDeviceMemory resolve_memory = VK_NULL_HANDLE;
-            VkResult       result         = VK_SUCCESS;
+    if (transition_layout)
+    {
+        // Transition image layout to transfer source optimal.
+        memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        memory_barrier.pNext                           = nullptr;
+        memory_barrier.srcAccessMask                   = 0;
+        memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+        memory_barrier.oldLayout                       = image_wrapper->current_layout;
+        memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.image                           = image_wrapper->handle;
+        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+        memory_barrier.subresourceRange.baseMipLevel   = 0;
+        memory_barrier.subresourceRange.levelCount     = image_wrapper->mip_levels;
+        memory_barrier.subresourceRange.baseArrayLayer = 0;
+        memory_barrier.subresourceRange.layerCount     = image_wrapper->array_layers;
+
+        device_table->CmdPipelineBarrier(command_buffer,
+                                         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         1,
+                                         &memory_barrier);
+    }
 
-            if (image_wrapper->samples != VK_SAMPLE_COUNT_1_BIT)
+    // Create one copy region per mip-level.
+    std::vector<VkBufferImageCopy> copy_regions;
+
+    VkBufferImageCopy copy_region;
+    copy_region.bufferRowLength                 = 0; // Request tightly packed data.
+    copy_region.bufferImageHeight               = 0; // Request tightly packed data.
+    copy_region.bufferOffset                    = staging_offset;
+    copy_region.imageOffset.x                   = 0;
+    copy_region.imageOffset.y                   = 0;
+    copy_region.imageOffset.z                   = 0;
+    copy_region.imageSubresource.aspectMask     = snapshot_entry.aspect;
+    copy_region.imageSubresource.baseArrayLayer = 0;
+    copy_region.imageSubresource.layerCount     = image_wrapper->array_layers;
+
+    for (uint32_t i = 0; i < image_wrapper->mip_levels; ++i)
+    {
+        copy_region.imageSubresource.mipLevel = i;
+        copy_region.imageExtent.width         = std::max(1u, (image_wrapper->extent.width >> i));
+        copy_region.imageExtent.height        = std::max(1u, (image_wrapper->extent.height >> i));
+        copy_region.imageExtent.depth         = std::max(1u, (image_wrapper->extent.depth >> i));
+
+        copy_regions.push_back(copy_region);
+        copy_region.bufferOffset += snapshot_entry.level_sizes[i];
+    }
+
+    device_table->CmdCopyImageToBuffer(command_buffer,
+                                       copy_image,
+                                       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                       staging_buffer,
+                                       static_cast<uint32_t>(copy_regions.size()),
+                                       copy_regions.data());
+
+    if (transition_layout && (image_wrapper->current_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+        (image_wrapper->current_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+    {
+        memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        memory_barrier.dstAccessMask = 0;
+        memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        memory_barrier.newLayout     = image_wrapper->current_layout;
+
+        device_table->CmdPipelineBarrier(command_buffer,
+                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                         VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         1,
+                                         &memory_barrier);
+    }
+}
+
+void VulkanStateWriter::FindCachedResourceContent(DeviceResourceTables* resources)
+{
+    assert((resources != nullptr) && (content_cache_ != nullptr));
+
+    // Content can only be reused for resources that are written exclusively through tracked queue submissions.  Host
+    // visible memory may be written through a mapping, buffer device addresses allow untracked shader writes, and
+    // external memory may be written by other APIs.
+    auto is_tracked = [](const DeviceMemoryWrapper* memory_wrapper, VkMemoryPropertyFlags memory_properties) {
+        return ((memory_properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0) &&
+               (memory_wrapper->hardware_buffer == nullptr) && (memory_wrapper->external_allocation == nullptr);
+    };
+
+    std::vector<BufferSnapshotInfo*> buffer_entries;
+    std::vector<ImageSnapshotInfo*>  image_entries;
+
+    for (auto& resource_entry : (*resources))
+    {
+        for (auto& queue_family_entry : resource_entry.second)
+        {
+            for (auto& buffer_entry : queue_family_entry.second.buffers)
             {
-                if (snapshot_entry.aspect == VK_IMAGE_ASPECT_COLOR_BIT)
+                const BufferWrapper* buffer_wrapper = buffer_entry.buffer_wrapper;
+
+                if (buffer_entry.need_staging_copy && (buffer_wrapper->address == 0) &&
+                    is_tracked(buffer_entry.memory_wrapper, buffer_entry.memory_properties))
                 {
-                    result = ResolveImage(device_wrapper,
-                                          image_wrapper,
-                                          queue,
-                                          command_buffer,
-                                          &resolve_image,
-                                          &resolve_memory,
-                                          state_table);
+                    buffer_entry.cached_content =
+                        content_cache_->Find(buffer_wrapper->handle_id, 0, buffer_wrapper->dirty_generation);
                 }
-                else
+
+                buffer_entries.push_back(&buffer_entry);
+            }
+
+            for (auto& image_entry : queue_family_entry.second.images)
+            {
+                const ImageWrapper* image_wrapper = image_entry.image_wrapper;
+
+                if (image_entry.need_staging_copy &&
+                    is_tracked(image_entry.memory_wrapper, image_entry.memory_properties))
                 {
-                    // Omit the image data for depth-stencil images with sample count greater than 1.
-                    result = VK_ERROR_FORMAT_NOT_SUPPORTED;
+                    image_entry.cached_content = content_cache_->Find(
+                        image_wrapper->handle_id, image_entry.aspect, image_wrapper->dirty_generation);
                 }
+
+                image_entries.push_back(&image_entry);
             }
+        }
+    }
 
-            if (result == VK_SUCCESS)
-            {
-                VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-                begin_info.pNext                    = nullptr;
-                begin_info.flags                    = 0;
-                begin_info.pInheritanceInfo         = nullptr;
+    // Resources that alias memory with a modified resource may have been modified through the alias.
+    typedef std::pair<VkDeviceSize, VkDeviceSize>                            MemoryRange;
+    std::unordered_map<const DeviceMemoryWrapper*, std::vector<MemoryRange>> dirty_ranges;
 
-                result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
+    for (const auto buffer_entry : buffer_entries)
+    {
+        if (buffer_entry->cached_content == nullptr)
+        {
+            VkDeviceSize offset = buffer_entry->buffer_wrapper->bind_offset;
+            dirty_ranges[buffer_entry->memory_wrapper].emplace_back(offset, offset + buffer_entry->memory_size);
+        }
+    }
 
-                if (result == VK_SUCCESS)
-                {
-                    VkImage              copy_image = image_wrapper->handle;
-                    VkImageMemoryBarrier memory_barrier;
-                    VkImageAspectFlags   transition_aspect = snapshot_entry.aspect;
+    for (const auto image_entry : image_entries)
+    {
+        if (image_entry->cached_content == nullptr)
+        {
+            VkDeviceSize offset = image_entry->image_wrapper->bind_offset;
+            dirty_ranges[image_entry->memory_wrapper].emplace_back(offset, offset + image_entry->memory_size);
+        }
+    }
 
-                    if ((transition_aspect == VK_IMAGE_ASPECT_DEPTH_BIT) ||
-                        (transition_aspect == VK_IMAGE_ASPECT_STENCIL_BIT))
-                    {
-                        // Depth and stencil aspects need to be transitioned together, so get full aspect
-                        // mask for image.
-                        transition_aspect = GetFormatAspectMask(image_wrapper->format);
-                    }
+    // Sort the ranges for each memory object by offset, replacing the end of each range with the largest end of all
+    // preceding ranges, so that a range overlaps a dirty range when the range preceding its end ends after its start.
+    for (auto& dirty_entry : dirty_ranges)
+    {
+        auto& ranges = dirty_entry.second;
+        std::sort(ranges.begin(), ranges.end());
 
-                    if (image_wrapper->samples != VK_SAMPLE_COUNT_1_BIT)
-                    {
-                        copy_image = resolve_image;
-                    }
-                    else if (image_wrapper->current_layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
-                    {
-                        // Transition image layout to transfer source optimal.
-                        memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-                        memory_barrier.pNext                           = nullptr;
-                        memory_barrier.srcAccessMask                   = 0;
-                        memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
-                        memory_barrier.oldLayout                       = image_wrapper->current_layout;
-                        memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-                        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-                        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-                        memory_barrier.image                           = image_wrapper->handle;
-                        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-                        memory_barrier.subresourceRange.baseMipLevel   = 0;
-                        memory_barrier.subresourceRange.levelCount     = image_wrapper->mip_levels;
-                        memory_barrier.subresourceRange.baseArrayLayer = 0;
-                        memory_barrier.subresourceRange.layerCount     = image_wrapper->array_layers;
-
-                        device_table->CmdPipelineBarrier(command_buffer,
-                                                         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                         0,
-                                                         0,
-                                                         nullptr,
-                                                         0,
-                                                         nullptr,
-                                                         1,
-                                                         &memory_barrier);
-                    }
+        for (size_t i = 1; i < ranges.size(); ++i)
+        {
+            ranges[i].second = std::max(ranges[i].second, ranges[i - 1].second);
+        }
+    }
+
+    auto overlaps_dirty_range = [&dirty_ranges](
+                                    const DeviceMemoryWrapper* memory_wrapper, VkDeviceSize offset, VkDeviceSize size) {
+        bool overlaps = false;
+        auto entry    = dirty_ranges.find(memory_wrapper);
+
+        if (entry != dirty_ranges.end())
+        {
+            const auto& ranges = entry->second;
+            auto        next   = std::lower_bound(
+                ranges.begin(), ranges.end(), offset + size, [](const MemoryRange& range, VkDeviceSize end) {
+                    return range.first < end;
+                });
+
+            overlaps = (next != ranges.begin()) && (std::prev(next)->second > offset);
+        }
+
+        return overlaps;
+    };
+
+    for (auto buffer_entry : buffer_entries)
+    {
+        if ((buffer_entry->cached_content != nullptr) &&
+            overlaps_dirty_range(
+                buffer_entry->memory_wrapper, buffer_entry->buffer_wrapper->bind_offset, buffer_entry->memory_size))
+        {
+            buffer_entry->cached_content = nullptr;
+        }
+    }
+
+    for (auto image_entry : image_entries)
+    {
+        if ((image_entry->cached_content != nullptr) &&
+            overlaps_dirty_range(
+                image_entry->memory_wrapper, image_entry->image_wrapper->bind_offset, image_entry->memory_size))
+        {
+            image_entry->cached_content = nullptr;
+        }
+    }
+}
+
+bool VulkanStateWriter::CompressResourceData(const uint8_t** data, size_t* data_size)
+{
+    assert((data != nullptr) && (data_size != nullptr));
+
+    bool compressed = false;
+
+    if (compressor_ != nullptr)
+    {
+        size_t compressed_size = compressor_->Compress((*data_size), (*data), &compressed_parameter_buffer_, 0);
+
+        if ((compressed_size > 0) && (compressed_size < (*data_size)))
+        {
+            (*data)      = compressed_parameter_buffer_.data();
+            (*data_size) = compressed_size;
+            compressed   = true;
+        }
+    }
 
-                    // Create one copy region per mip-level.
-                    std::vector<VkBufferImageCopy> copy_regions;
-
-                    VkBufferImageCopy copy_region;
-                    copy_region.bufferRowLength                 = 0; // Request tightly packed data.
-                    copy_region.bufferImageHeight               = 0; // Request tightly packed data.
-                    copy_region.bufferOffset                    = 0;
-                    copy_region.imageOffset.x                   = 0;
-                    copy_region.imageOffset.y                   = 0;
-                    copy_region.imageOffset.z                   = 0;
-                    copy_region.imageSubresource.aspectMask     = snapshot_entry.aspect;
-                    copy_region.imageSubresource.baseArrayLayer = 0;
-                    copy_region.imageSubresource.layerCount     = image_wrapper->array_layers;
-
-                    for (uint32_t i = 0; i < image_wrapper->mip_levels; ++i)
-                    {
-                        copy_region.imageSubresource.mipLevel = i;
-                        copy_region.imageExtent.width         = std::max(1u, (image_wrapper->extent.width >> i));
-                        copy_region.imageExtent.height        = std::max(1u, (image_wrapper->extent.height >> i));
-                        copy_region.imageExtent.depth         = std::max(1u, (image_wrapper->extent.depth >> i));
+    return compressed;
+}
 
-                        copy_regions.push_back(copy_region);
-                        copy_region.bufferOffset += snapshot_entry.level_sizes[i];
-                    }
+size_t VulkanStateWriter::GetContentPatternSize(const uint8_t* data, size_t data_size)
+{
+    assert(data != nullptr);
 
-                    device_table->CmdCopyImageToBuffer(command_buffer,
-                                                       copy_image,
-                                                       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                                                       staging_buffer,
-                                                       static_cast<uint32_t>(copy_regions.size()),
-                                                       copy_regions.data());
-
-                    if ((image_wrapper->samples == VK_SAMPLE_COUNT_1_BIT) &&
-                        (image_wrapper->current_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                        (image_wrapper->current_layout != VK_IMAGE_LAYOUT_PREINITIALIZED) &&
-                        (image_wrapper->current_layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL))
-                    {
-                        memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-                        memory_barrier.dstAccessMask = 0;
-                        memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-                        memory_barrier.newLayout     = image_wrapper->current_layout;
-
-                        device_table->CmdPipelineBarrier(command_buffer,
-                                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                         VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                         0,
-                                                         0,
-                                                         nullptr,
-                                                         0,
-                                                         nullptr,
-                                                         1,
-                                                         &memory_barrier);
-                    }
+    // A single pass checks that the data repeats its first kContentPatternPeriod bytes, which covers every pattern
+    // whose size divides the period.
+    if ((data_size < kMinContentPatternSize) ||
+        (memcmp(data, data + kContentPatternPeriod, data_size - kContentPatternPeriod) != 0))
+    {
+        return 0;
+    }
 
-                    device_table->EndCommandBuffer(command_buffer);
+    // The shortest pattern that repeats to form the first period also forms the rest of the data.
+    for (size_t pattern_size = 1; pattern_size < kContentPatternPeriod; ++pattern_size)
+    {
+        if (((kContentPatternPeriod % pattern_size) == 0) &&
+            (memcmp(data, data + pattern_size, kContentPatternPeriod - pattern_size) == 0))
+        {
+            return pattern_size;
+        }
+    }
 
-                    result = SubmitCommandBuffer(queue, command_buffer, device_table);
+    return kContentPatternPeriod;
+}
 
-                    if (result == VK_SUCCESS)
-                    {
-                        void* data = nullptr;
-                        result     = device_table->MapMemory(
-                            device_wrapper->handle, staging_memory, 0, snapshot_entry.resource_size, 0, &data);
+void VulkanStateWriter::WriteInitBufferCommand(format::HandleId     device_id,
+                                               const BufferWrapper* buffer_wrapper,
+                                               const uint8_t*       bytes,
+                                               bool                 cache_content)
+{
+    assert(buffer_wrapper != nullptr);
 
-                        if (result == VK_SUCCESS)
-                        {
-                            bytes = reinterpret_cast<uint8_t*>(data);
+    if (bytes != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
 
-                            if (!is_staging_memory_coherent)
-                            {
-                                InvalidateMappedMemoryRange(
-                                    device_wrapper, staging_memory, 0, snapshot_entry.resource_size);
-                            }
-                        }
-                    }
-                }
+        size_t data_size    = static_cast<size_t>(buffer_wrapper->created_size);
+        size_t pattern_size = write_content_patterns_ ? GetContentPatternSize(bytes, data_size) : 0;
+        bool   pattern      = (pattern_size > 0);
+        bool   compressed   = false;
 
-                if (image_wrapper->samples != VK_SAMPLE_COUNT_1_BIT)
-                {
-                    device_table->DestroyImage(device_wrapper->handle, resolve_image, nullptr);
-                    device_table->FreeMemory(device_wrapper->handle, resolve_memory, nullptr);
-                }
-            }
+        if (pattern)
+        {
+            data_size = pattern_size;
         }
         else
         {
-            assert((memory_wrapper != nullptr) &&
-                   ((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0)));
+            compressed = CompressResourceData(&bytes, &data_size);
+        }
 
-            VkResult result = VK_SUCCESS;
+        if (cache_content && (content_cache_ != nullptr))
+        {
+            content_cache_->Store(buffer_wrapper->handle_id,
+                                  0,
+                                  static_cast<size_t>(buffer_wrapper->created_size),
+                                  compressed,
+                                  pattern,
+                                  bytes,
+                                  data_size);
+        }
 
-            if (memory_wrapper->mapped_data == nullptr)
-            {
-                void* data = nullptr;
-                result     = device_table->MapMemory(device_wrapper->handle,
-                                                 memory_wrapper->handle,
-                                                 image_wrapper->bind_offset,
-                                                 snapshot_entry.resource_size,
-                                                 0,
-                                                 &data);
-                if (result == VK_SUCCESS)
-                {
-                    bytes = reinterpret_cast<uint8_t*>(data);
-                }
-            }
-            else
-            {
-                bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + image_wrapper->bind_offset;
-            }
+        WriteInitBufferBlock(device_id, buffer_wrapper, compressed, pattern, bytes, data_size);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                           buffer_wrapper->handle_id);
+    }
+}
 
-            if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
-            {
-                InvalidateMappedMemoryRange(
-                    device_wrapper, memory_wrapper->handle, image_wrapper->bind_offset, snapshot_entry.resource_size);
-            }
-        }
+void VulkanStateWriter::WriteInitImageCommand(format::HandleId         device_id,
+                                              const ImageSnapshotInfo& snapshot_entry,
+                                              const uint8_t*           bytes,
+                                              bool                     cache_content)
+{
+    const ImageWrapper* image_wrapper = snapshot_entry.image_wrapper;
+    assert(image_wrapper != nullptr);
 
-        format::InitImageCommandHeader upload_cmd;
+    if (bytes != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
 
-        // Packet size without the resource data.
-        upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
-        upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-        upload_cmd.meta_header.meta_data_type    = format::kInitImageCommand;
-        upload_cmd.thread_id                     = thread_id_;
-        upload_cmd.device_id                     = device_wrapper->handle_id;
-        upload_cmd.image_id                      = image_wrapper->handle_id;
-        upload_cmd.aspect                        = snapshot_entry.aspect;
-        upload_cmd.layout                        = image_wrapper->current_layout;
+        size_t data_size    = static_cast<size_t>(snapshot_entry.resource_size);
+        size_t pattern_size = write_content_patterns_ ? GetContentPatternSize(bytes, data_size) : 0;
+        bool   pattern      = (pattern_size > 0);
+        bool   compressed   = false;
 
-        if (bytes != nullptr)
+        if (pattern)
         {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
+            data_size = pattern_size;
+        }
+        else
+        {
+            compressed = CompressResourceData(&bytes, &data_size);
+        }
 
-            size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
+        if (cache_content && (content_cache_ != nullptr))
+        {
+            content_cache_->Store(image_wrapper->handle_id,
+                                  snapshot_entry.aspect,
+                                  static_cast<size_t>(snapshot_entry.resource_size),
+                                  compressed,
+                                  pattern,
+                                  bytes,
+                                  data_size);
+        }
 
-            // Store uncompressed data size in packet.
-            upload_cmd.data_size   = data_size;
-            upload_cmd.level_count = image_wrapper->mip_levels;
+        WriteInitImageBlock(device_id, snapshot_entry, compressed, pattern, bytes, data_size);
+    }
+    else
+    {
+        WriteInitImageBlock(device_id, snapshot_entry, false, false, nullptr, 0);
+    }
+}
 
-            if (compressor_ != nullptr)
-            {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+void VulkanStateWriter::WriteInitBufferBlock(format::HandleId     device_id,
+                                             const BufferWrapper* buffer_wrapper,
+                                             bool                 compressed,
+                                             bool                 pattern,
+                                             const uint8_t*       data,
+                                             size_t               data_size)
+{
+    assert((buffer_wrapper != nullptr) && (data != nullptr));
 
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+    format::InitBufferCommandHeader upload_cmd;
 
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
-            }
+    upload_cmd.meta_header.block_header.type =
+        compressed ? format::BlockType::kCompressedMetaDataBlock : format::BlockType::kMetaDataBlock;
+    upload_cmd.meta_header.meta_data_type = pattern ? format::kInitBufferPatternCommand : format::kInitBufferCommand;
+    upload_cmd.thread_id                  = thread_id_;
+    upload_cmd.device_id                  = device_id;
+    upload_cmd.buffer_id                  = buffer_wrapper->handle_id;
+    upload_cmd.data_size                  = buffer_wrapper->created_size; // Uncompressed data size.
 
-            // Calculate size of packet with compressed or uncompressed data size.
-            assert(!snapshot_entry.level_sizes.empty() &&
-                   (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
-            size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
+    // Calculate size of packet with compressed or uncompressed data size.
+    upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
 
-            upload_cmd.meta_header.block_header.size += levels_size + data_size;
+    util::OutputBuffer buffers[] = { { &upload_cmd, sizeof(upload_cmd) }, { data, data_size } };
+    output_stream_->WriteBuffers(buffers, 2);
+}
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-            output_stream_->Write(bytes, data_size);
+void VulkanStateWriter::WriteInitImageBlock(format::HandleId         device_id,
+                                            const ImageSnapshotInfo& snapshot_entry,
+                                            bool                     compressed,
+                                            bool                     pattern,
+                                            const uint8_t*           data,
+                                            size_t                   data_size)
+{
+    const ImageWrapper* image_wrapper = snapshot_entry.image_wrapper;
+    assert(image_wrapper != nullptr);
+
+    format::InitImageCommandHeader upload_cmd;
+
+    // Packet size without the resource data.
+    upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
+    upload_cmd.meta_header.block_header.type =
+        compressed ? format::BlockType::kCompressedMetaDataBlock : format::BlockType::kMetaDataBlock;
+    upload_cmd.meta_header.meta_data_type = pattern ? format::kInitImagePatternCommand : format::kInitImageCommand;
+    upload_cmd.thread_id                  = thread_id_;
+    upload_cmd.device_id                  = device_id;
+    upload_cmd.image_id                   = image_wrapper->handle_id;
+    upload_cmd.aspect                     = snapshot_entry.aspect;
+    upload_cmd.layout                     = image_wrapper->current_layout;
+
+    if (data != nullptr)
+    {
+        // Store uncompressed data size in packet.
+        upload_cmd.data_size   = snapshot_entry.resource_size;
+        upload_cmd.level_count = image_wrapper->mip_levels;
 
-            if (snapshot_entry.need_staging_copy)
-            {
-                device_table->UnmapMemory(device_wrapper->handle, staging_memory);
-            }
-            else
-            {
-                if (memory_wrapper->mapped_data == nullptr)
-                {
-                    device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
-                }
-            }
-        }
-        else
-        {
-            // Write a packet without resource data; replay must still perform a layout transition at image
-            // initialization.
-            upload_cmd.data_size   = 0;
-            upload_cmd.level_count = 0;
+        // Calculate size of packet with compressed or uncompressed data size.
+        assert(!snapshot_entry.level_sizes.empty() && (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
+        size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-        }
+        upload_cmd.meta_header.block_header.size += levels_size + data_size;
+
+        util::OutputBuffer buffers[] = { { &upload_cmd, sizeof(upload_cmd) },
+                                         { snapshot_entry.level_sizes.data(), levels_size },
+                                         { data, data_size } };
+        output_stream_->WriteBuffers(buffers, 3);
+    }
+    else
+    {
+        // Write a packet without resource data; replay must still perform a layout transition at image
+        // initialization.
+        upload_cmd.data_size   = 0;
+        upload_cmd.level_count = 0;
+
+        output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
     }
 }
 
@@ -1518,6 +2216,7 @@ void VulkanStateWriter::WriteBufferMemoryState(const VulkanStateTable& state_tab
             snapshot_info.buffer_wrapper    = wrapper;
             snapshot_info.memory_wrapper    = memory_wrapper;
             snapshot_info.memory_properties = GetMemoryProperties(device_wrapper, memory_wrapper, state_table);
+            snapshot_info.memory_size       = memory_requirements.size;
             snapshot_info.need_staging_copy = !IsBufferReadable(snapshot_info.memory_properties, memory_wrapper);
 
             if ((*max_resource_size) < wrapper->created_size)
@@ -1606,6 +2305,7 @@ void VulkanStateWriter::WriteImageMemoryState(const VulkanStateTable& state_tabl
                     snapshot_info.image_wrapper     = wrapper;
                     snapshot_info.memory_wrapper    = memory_wrapper;
                     snapshot_info.memory_properties = memory_properties;
+                    snapshot_info.memory_size       = memory_requirements.size;
                     snapshot_info.need_staging_copy = need_staging_copy;
                     snapshot_info.aspect            = aspect;
 
@@ -1685,6 +2385,8 @@ void VulkanStateWriter::WriteImageSubresourceLayouts(const ImageWrapper* image_w
 
 void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_table)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     DeviceResourceTables resources;
     VkDeviceSize         max_resource_size     = 0;
     VkDeviceSize         max_staging_copy_size = 0;
@@ -1692,31 +2394,70 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
     WriteBufferMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
     WriteImageMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
 
+    if (content_cache_ != nullptr)
+    {
+        FindCachedResourceContent(&resources);
+    }
+
     // Write resource memory content.
     for (const auto& resource_entry : resources)
     {
-        const DeviceWrapper*  device_wrapper            = resource_entry.first;
-        VkBuffer              staging_buffer            = VK_NULL_HANDLE;
-        VkDeviceMemory        staging_memory            = VK_NULL_HANDLE;
-        VkMemoryPropertyFlags staging_memory_properties = 0;
-        VkResult              result                    = VK_SUCCESS;
+        const DeviceWrapper* device_wrapper = resource_entry.first;
+        StagingContext       staging;
+        VkResult             result = VK_SUCCESS;
+
+        assert(device_wrapper != nullptr);
+
+        const DeviceTable* device_table = &device_wrapper->layer_table;
+
+        // Size the staging regions for batches of copies, with a second region to overlap the GPU copy for the next
+        // batch with the write of the current batch when all copies do not fit in a single batch.  Resources with
+        // cached content do not need a staging copy.
+        VkDeviceSize total_staging_size = 0;
 
-        if (max_staging_copy_size > 0)
+        for (const auto& queue_family_entry : resource_entry.second)
         {
-            assert(device_wrapper != nullptr);
+            for (const auto& buffer_entry : queue_family_entry.second.buffers)
+            {
+                if (buffer_entry.need_staging_copy && (buffer_entry.cached_content == nullptr))
+                {
+                    total_staging_size += AlignStagingCopySize(buffer_entry.buffer_wrapper->created_size);
+                }
+            }
 
-            result = CreateStagingBuffer(device_wrapper,
-                                         max_staging_copy_size,
-                                         &staging_buffer,
-                                         &staging_memory,
-                                         &staging_memory_properties,
-                                         state_table);
+            for (const auto& image_entry : queue_family_entry.second.images)
+            {
+                if (image_entry.need_staging_copy && (image_entry.cached_content == nullptr))
+                {
+                    total_staging_size += AlignStagingCopySize(image_entry.resource_size);
+                }
+            }
         }
 
-        if (result == VK_SUCCESS)
+        if (total_staging_size > 0)
         {
-            const DeviceTable* device_table = &device_wrapper->layer_table;
+            staging.region_size  = std::max(max_staging_copy_size, std::min(total_staging_size, kStagingBatchSize));
+            staging.region_count = (total_staging_size > staging.region_size) ? 2 : 1;
+
+            result = CreateStagingRegions(device_wrapper, state_table, &staging);
+
+            // When the preferred staging allocation fails, fall back to a single region, and then to a region that only
+            // holds the largest copy.  The copies are then processed in more batches, without overlapping them.
+            if ((result != VK_SUCCESS) && (staging.region_count > 1))
+            {
+                staging.region_count = 1;
+                result               = CreateStagingRegions(device_wrapper, state_table, &staging);
+            }
+
+            if ((result != VK_SUCCESS) && (staging.region_size > max_staging_copy_size))
+            {
+                staging.region_size = max_staging_copy_size;
+                result              = CreateStagingRegions(device_wrapper, state_table, &staging);
+            }
+        }
 
+        if (result == VK_SUCCESS)
+        {
             format::BeginResourceInitCommand begin_cmd;
             begin_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(begin_cmd);
             begin_cmd.meta_header.block_header.type = format::kMetaDataBlock;
@@ -1730,21 +2471,30 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
 
             for (const auto& queue_family_entry : resource_entry.second)
             {
-                uint32_t        queue_family_index = queue_family_entry.first;
-                VkQueue         queue              = VK_NULL_HANDLE;
-                VkCommandPool   command_pool       = VK_NULL_HANDLE;
-                VkCommandBuffer command_buffer     = VK_NULL_HANDLE;
+                uint32_t      queue_family_index = queue_family_entry.first;
+                VkCommandPool command_pool       = VK_NULL_HANDLE;
+                bool          ready              = false;
 
                 command_pool = GetCommandPool(device_wrapper, queue_family_index);
                 if (command_pool != VK_NULL_HANDLE)
                 {
-                    command_buffer = GetCommandBuffer(device_wrapper, command_pool);
+                    ready = true;
+
+                    for (uint32_t i = 0; i < 2; ++i)
+                    {
+                        staging.command_buffers[i] = GetCommandBuffer(device_wrapper, command_pool);
+                        staging.fences[i]          = VK_NULL_HANDLE;
+
+                        if ((staging.command_buffers[i] == VK_NULL_HANDLE) ||
+                            (CreateFence(device_wrapper, &staging.fences[i]) != VK_SUCCESS))
+                        {
+                            ready = false;
+                        }
+                    }
 
-                    if (command_buffer == VK_NULL_HANDLE)
+                    if (!ready)
                     {
                         GFXRECON_LOG_ERROR("Failed to create a command buffer to process trim state");
-                        device_table->DestroyCommandPool(device_wrapper->handle, command_pool, nullptr);
-                        command_pool = VK_NULL_HANDLE;
                     }
                 }
                 else
@@ -1752,29 +2502,23 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
                     GFXRECON_LOG_ERROR("Failed to create a command pool to process trim state");
                 }
 
-                if (command_buffer != VK_NULL_HANDLE)
+                if (ready)
                 {
-                    bool is_staging_memory_coherent = IsMemoryCoherent(staging_memory_properties);
-                    queue                           = GetQueue(device_wrapper, queue_family_index, 0);
-
-                    ProcessBufferMemory(device_wrapper,
-                                        queue_family_entry.second.buffers,
-                                        queue_family_index,
-                                        queue,
-                                        command_buffer,
-                                        staging_buffer,
-                                        staging_memory,
-                                        is_staging_memory_coherent);
-
-                    ProcessImageMemory(device_wrapper,
-                                       queue_family_entry.second.images,
-                                       queue_family_index,
-                                       queue,
-                                       command_buffer,
-                                       staging_buffer,
-                                       staging_memory,
-                                       is_staging_memory_coherent,
-                                       state_table);
+                    staging.queue = GetQueue(device_wrapper, queue_family_index, 0);
+
+                    ProcessBufferMemory(device_wrapper, queue_family_entry.second.buffers, staging);
+                    ProcessImageMemory(device_wrapper, queue_family_entry.second.images, staging, state_table);
+                }
+
+                if (command_pool != VK_NULL_HANDLE)
+                {
+                    for (uint32_t i = 0; i < 2; ++i)
+                    {
+                        if (staging.fences[i] != VK_NULL_HANDLE)
+                        {
+                            device_table->DestroyFence(device_wrapper->handle, staging.fences[i], nullptr);
+                        }
+                    }
 
                     device_table->DestroyCommandPool(device_wrapper->handle, command_pool, nullptr);
                 }
@@ -1789,10 +2533,11 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
 
             output_stream_->Write(&end_cmd, sizeof(end_cmd));
 
-            if (max_staging_copy_size > 0)
+            if (staging.buffer != VK_NULL_HANDLE)
             {
-                device_table->DestroyBuffer(device_wrapper->handle, staging_buffer, nullptr);
-                device_table->FreeMemory(device_wrapper->handle, staging_memory, nullptr);
+                device_table->UnmapMemory(device_wrapper->handle, staging.memory);
+                device_table->DestroyBuffer(device_wrapper->handle, staging.buffer, nullptr);
+                device_table->FreeMemory(device_wrapper->handle, staging.memory, nullptr);
             }
         }
         else
@@ -1829,6 +2574,8 @@ void VulkanStateWriter::WriteMappedMemoryState(const VulkanStateTable& state_tab
 
 void VulkanStateWriter::WriteSwapchainImageState(const VulkanStateTable& state_table)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     state_table.VisitWrappers([&](const SwapchainKHRWrapper* wrapper) {
         assert((wrapper != nullptr) && (wrapper->device != nullptr) &&
                (wrapper->child_images.size() == wrapper->image_acquired_info.size()));
@@ -1863,8 +2610,7 @@ void VulkanStateWriter::WriteSwapchainImageState(const VulkanStateTable& state_t
 
             if (wrapper->image_acquired_info[i].last_presented_queue != VK_NULL_HANDLE)
             {
-                auto queue_wrapper =
-                    reinterpret_cast<const QueueWrapper*>(wrapper->image_acquired_info[i].last_presented_queue);
+                auto queue_wrapper = GetWrapper<QueueWrapper>(wrapper->image_acquired_info[i].last_presented_queue);
                 info.last_presented_queue_id = queue_wrapper->handle_id;
             }
             else
@@ -2077,21 +2823,33 @@ void VulkanStateWriter::WriteCommandProcessingCreateCommands(format::HandleId de
     parameter_stream_.Reset();
 
     // Create the command buffer from the pool. Requires a temporary wrapper for EncodeStructPtr, which expects
-    // struct members to be wrapped handles.
+    // struct members to be application handles.  The wrapper is its own handle, which is entered in the handle side
+    // tables while the struct is encoded when they are enabled.
     CommandPoolWrapper encode_wrapper;
+    encode_wrapper.handle    = reinterpret_cast<VkCommandPool>(&encode_wrapper);
     encode_wrapper.handle_id = command_pool_id;
 
     VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
     alloc_info.pNext                       = nullptr;
-    alloc_info.commandPool                 = reinterpret_cast<VkCommandPool>(&encode_wrapper);
+    alloc_info.commandPool                 = encode_wrapper.handle;
     alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     alloc_info.commandBufferCount          = 1;
 
+    if (HandleSideTables::IsEnabled())
+    {
+        HandleSideTables::Insert(&encode_wrapper);
+    }
+
     encoder_.EncodeHandleIdValue(device_id);
     EncodeStructPtr(&encoder_, &alloc_info);
     encoder_.EncodeHandleIdArray(&command_buffer_id, 1);
     encoder_.EncodeEnumValue(result);
 
+    if (HandleSideTables::IsEnabled())
+    {
+        HandleSideTables::Remove(&encode_wrapper);
+    }
+
     WriteFunctionCall(format::ApiCallId::ApiCall_vkAllocateCommandBuffers, &parameter_stream_);
     parameter_stream_.Reset();
 }
@@ -2197,45 +2955,59 @@ void VulkanStateWriter::WriteCommandBufferCommands(const CommandBufferWrapper* w
     }
 }
 
-void VulkanStateWriter::WriteDescriptorUpdateCommand(format::HandleId      device_id,
-                                                     const DescriptorInfo* binding,
-                                                     VkWriteDescriptorSet* write)
+template <typename T>
+size_t VulkanStateWriter::CopyDescriptorData(const DescriptorInfo*                binding,
+                                             uint32_t                             first_element,
+                                             uint32_t                             count,
+                                             std::unique_ptr<T[]> DescriptorInfo::Chunk::*chunk_data,
+                                             std::vector<T>*                      batch_data)
 {
-    assert((binding != nullptr) && (write != nullptr));
+    size_t data_offset = batch_data->size();
+
+    // The range may span multiple storage chunks, which are not contiguous.
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t    element = first_element + i;
+        const auto& chunk   = binding->chunks[element >> DescriptorInfo::kChunkShift];
+
+        assert(chunk != nullptr);
+        batch_data->push_back(((*chunk).*chunk_data)[element & DescriptorInfo::kChunkMask]);
+    }
+
+    return data_offset;
+}
 
-    const VkCopyDescriptorSet* copy = nullptr;
+void VulkanStateWriter::AddDescriptorWrite(const DescriptorInfo*       binding,
+                                           const VkWriteDescriptorSet& write,
+                                           DescriptorWriteBatch*       batch)
+{
+    assert((binding != nullptr) && (batch != nullptr));
 
-    // write_accel_struct may be used in the pNext chain of the VkWriteDescriptorSet and needs to stay in scope until
-    // after VkWriteDescriptorSet is encoded.
-    VkWriteDescriptorSetAccelerationStructureKHR write_accel_struct;
+    uint32_t first_element = write.dstArrayElement;
+    uint32_t count         = write.descriptorCount;
+    size_t   data_offset   = 0;
 
-    switch (write->descriptorType)
+    switch (write.descriptorType)
     {
         case VK_DESCRIPTOR_TYPE_SAMPLER:
         case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
         case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-            write->pBufferInfo      = nullptr;
-            write->pImageInfo       = &binding->images[write->dstArrayElement];
-            write->pTexelBufferView = nullptr;
-            write->pNext            = nullptr;
+            data_offset =
+                CopyDescriptorData(binding, first_element, count, &DescriptorInfo::Chunk::images, &batch->images);
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-            write->pBufferInfo      = &binding->buffers[write->dstArrayElement];
-            write->pImageInfo       = nullptr;
-            write->pTexelBufferView = nullptr;
-            write->pNext            = nullptr;
+            data_offset =
+                CopyDescriptorData(binding, first_element, count, &DescriptorInfo::Chunk::buffers, &batch->buffers);
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-            write->pBufferInfo      = nullptr;
-            write->pImageInfo       = nullptr;
-            write->pTexelBufferView = &binding->texel_buffer_views[write->dstArrayElement];
-            write->pNext            = nullptr;
+            data_offset = CopyDescriptorData(
+                binding, first_element, count, &DescriptorInfo::Chunk::texel_buffer_views, &batch->texel_buffer_views);
             break;
         case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
             // TODO
@@ -2244,31 +3016,94 @@ void VulkanStateWriter::WriteDescriptorUpdateCommand(format::HandleId      devic
             // TODO
             break;
         case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
-        {
-            write_accel_struct.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
-            write_accel_struct.pNext = nullptr;
-            write_accel_struct.accelerationStructureCount = write->descriptorCount;
-            write_accel_struct.pAccelerationStructures    = &binding->acceleration_structures[write->dstArrayElement];
-
-            write->pBufferInfo      = nullptr;
-            write->pImageInfo       = nullptr;
-            write->pTexelBufferView = nullptr;
-            write->pNext            = &write_accel_struct;
-        }
-        break;
+            data_offset = CopyDescriptorData(binding,
+                                             first_element,
+                                             count,
+                                             &DescriptorInfo::Chunk::acceleration_structures,
+                                             &batch->acceleration_structures);
+            break;
         default:
             GFXRECON_LOG_WARNING("Attempting to initialize descriptor state for unrecognized descriptor type");
+            return;
+    }
+
+    batch->writes.push_back(write);
+    batch->data_offsets.push_back(data_offset);
+    batch->descriptor_count += count;
+}
+
+void VulkanStateWriter::WriteDescriptorUpdateCommand(format::HandleId device_id, DescriptorWriteBatch* batch)
+{
+    assert(batch != nullptr);
+
+    const VkCopyDescriptorSet* copy        = nullptr;
+    uint32_t                   write_count = static_cast<uint32_t>(batch->writes.size());
+
+    // The write_accel_structs entries are used in the pNext chains of the VkWriteDescriptorSet structures, and are
+    // sized before the pointers to them are set.
+    batch->write_accel_structs.resize(write_count);
+
+    for (uint32_t i = 0; i < write_count; ++i)
+    {
+        VkWriteDescriptorSet* write       = &batch->writes[i];
+        size_t                data_offset = batch->data_offsets[i];
+
+        write->pBufferInfo      = nullptr;
+        write->pImageInfo       = nullptr;
+        write->pTexelBufferView = nullptr;
+        write->pNext            = nullptr;
+
+        switch (write->descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                write->pImageInfo = &batch->images[data_offset];
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                write->pBufferInfo = &batch->buffers[data_offset];
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                write->pTexelBufferView = &batch->texel_buffer_views[data_offset];
+                break;
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            {
+                VkWriteDescriptorSetAccelerationStructureKHR* write_accel_struct = &batch->write_accel_structs[i];
+                write_accel_struct->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+                write_accel_struct->pNext = nullptr;
+                write_accel_struct->accelerationStructureCount = write->descriptorCount;
+                write_accel_struct->pAccelerationStructures    = &batch->acceleration_structures[data_offset];
+
+                write->pNext = write_accel_struct;
+            }
             break;
+            default:
+                break;
+        }
     }
 
     encoder_.EncodeHandleIdValue(device_id);
-    encoder_.EncodeUInt32Value(1);
-    EncodeStructArray(&encoder_, write, 1);
+    encoder_.EncodeUInt32Value(write_count);
+    EncodeStructArray(&encoder_, batch->writes.data(), write_count);
     encoder_.EncodeUInt32Value(0);
     EncodeStructArray(&encoder_, copy, 0);
 
     WriteFunctionCall(format::ApiCallId::ApiCall_vkUpdateDescriptorSets, &parameter_stream_);
     parameter_stream_.Reset();
+
+    batch->descriptor_count = 0;
+    batch->writes.clear();
+    batch->data_offsets.clear();
+    batch->images.clear();
+    batch->buffers.clear();
+    batch->texel_buffer_views.clear();
+    batch->acceleration_structures.clear();
 }
 
 void VulkanStateWriter::WriteQueryPoolReset(format::HandleId                            device_id,
@@ -2525,11 +3360,9 @@ void VulkanStateWriter::WriteFunctionCall(format::ApiCallId call_id, util::Memor
         uncompressed_header.block_header.size = packet_size;
     }
 
-    // Write appropriate function call block header.
-    output_stream_->Write(header_pointer, header_size);
-
-    // Write parameter data.
-    output_stream_->Write(data_pointer, data_size);
+    // Write appropriate function call block header and parameter data.
+    util::OutputBuffer buffers[] = { { header_pointer, header_size }, { data_pointer, data_size } };
+    output_stream_->WriteBuffers(buffers, 2);
 }
 
 // TODO: This is the same code used by TraceManager to write command data. It could be moved to a format
@@ -2545,12 +3378,86 @@ void VulkanStateWriter::WriteFillMemoryCmd(format::HandleId memory_id,
     const uint8_t*                  write_address = (static_cast<const uint8_t*>(data) + offset);
     size_t                          write_size    = static_cast<size_t>(size);
 
+    bool                         deduplicated = false;
+    std::unique_lock<std::mutex> deduplicator_lock;
+
+    if (fill_memory_deduplicator_ != nullptr)
+    {
+        uint64_t source_index = 0;
+
+        deduplicator_lock = std::unique_lock<std::mutex>(fill_memory_deduplicator_->GetMutex());
+
+        if (fill_memory_deduplicator_->ProcessFillMemory(write_address, write_size, &source_index))
+        {
+            WriteFillMemoryFromPreviousBlockCmd(memory_id, offset, size, source_index);
+            deduplicated = true;
+        }
+    }
+
+    if (!deduplicated)
+    {
+        fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        fill_cmd.meta_header.meta_data_type    = format::MetaDataType::kFillMemoryCommand;
+        fill_cmd.thread_id                     = thread_id_;
+        fill_cmd.memory_id                     = memory_id;
+        fill_cmd.memory_offset                 = offset;
+        fill_cmd.memory_size                   = size;
+
+        if (compressor_ != nullptr)
+        {
+            size_t compressed_size = compressor_->Compress(write_size, write_address, &compressed_parameter_buffer_, 0);
+
+            if ((compressed_size > 0) && (compressed_size < write_size))
+            {
+                // We don't have a special header for compressed fill commands because the header always includes
+                // the uncompressed size, so we just change the type to indicate the data is compressed.
+                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+                write_address = compressed_parameter_buffer_.data();
+                write_size    = compressed_size;
+            }
+        }
+
+        // Calculate size of packet with compressed or uncompressed data size.
+        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + write_size;
+
+        util::OutputBuffer buffers[] = { { &fill_cmd, sizeof(fill_cmd) }, { write_address, write_size } };
+        output_stream_->WriteBuffers(buffers, 2);
+    }
+}
+
+// TODO: This is the same code used by TraceManager to write command data. It could be moved to a format
+// utility.
+void VulkanStateWriter::WriteFillMemoryFromPreviousBlockCmd(format::HandleId memory_id,
+                                                            VkDeviceSize     offset,
+                                                            VkDeviceSize     size,
+                                                            uint64_t         source_index)
+{
+    format::FillMemoryFromPreviousBlockCommand fill_cmd;
+
     fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
-    fill_cmd.meta_header.meta_data_type    = format::MetaDataType::kFillMemoryCommand;
+    fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd);
+    fill_cmd.meta_header.meta_data_type    = format::MetaDataType::kFillMemoryFromPreviousBlockCommand;
     fill_cmd.thread_id                     = thread_id_;
     fill_cmd.memory_id                     = memory_id;
     fill_cmd.memory_offset                 = offset;
     fill_cmd.memory_size                   = size;
+    fill_cmd.source_index                  = source_index;
+
+    output_stream_->Write(&fill_cmd, sizeof(fill_cmd));
+}
+
+void VulkanStateWriter::WriteSetBlobDataCmd(uint64_t blob_id, const void* data, size_t size)
+{
+    format::SetBlobDataCommandHeader blob_cmd;
+    const uint8_t*                   write_address = static_cast<const uint8_t*>(data);
+    size_t                           write_size    = size;
+
+    blob_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    blob_cmd.meta_header.meta_data_type    = format::MetaDataType::kSetBlobDataCommand;
+    blob_cmd.thread_id                     = thread_id_;
+    blob_cmd.blob_id                       = blob_id;
+    blob_cmd.data_size                     = size;
 
     if (compressor_ != nullptr)
     {
@@ -2558,20 +3465,17 @@ void VulkanStateWriter::WriteFillMemoryCmd(format::HandleId memory_id,
 
         if ((compressed_size > 0) && (compressed_size < write_size))
         {
-            // We don't have a special header for compressed fill commands because the header always includes
-            // the uncompressed size, so we just change the type to indicate the data is compressed.
-            fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            blob_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
 
             write_address = compressed_parameter_buffer_.data();
             write_size    = compressed_size;
         }
     }
 
-    // Calculate size of packet with compressed or uncompressed data size.
-    fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + write_size;
+    blob_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(blob_cmd) + write_size;
 
-    output_stream_->Write(&fill_cmd, sizeof(fill_cmd));
-    output_stream_->Write(write_address, write_size);
+    util::OutputBuffer buffers[] = { { &blob_cmd, sizeof(blob_cmd) }, { write_address, write_size } };
+    output_stream_->WriteBuffers(buffers, 2);
 }
 
 // TODO: This is the same code used by TraceManager to write command data. It could be moved to a format
@@ -2783,8 +3687,25 @@ void VulkanStateWriter::WriteSetRayTracingShaderGroupHandlesCommand(format::Hand
     set_handles_cmd.pipeline_id                   = pipeline_id;
     set_handles_cmd.data_size                     = data_size;
 
-    output_stream_->Write(&set_handles_cmd, sizeof(set_handles_cmd));
-    output_stream_->Write(data, data_size);
+    util::OutputBuffer buffers[] = { { &set_handles_cmd, sizeof(set_handles_cmd) }, { data, data_size } };
+    output_stream_->WriteBuffers(buffers, 2);
+}
+
+void VulkanStateWriter::WriteSetPipelineCacheDataCommand(format::HandleId device_id,
+                                                         size_t           data_size,
+                                                         const void*      data)
+{
+    format::SetPipelineCacheDataCommandHeader set_data_cmd;
+
+    set_data_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    set_data_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(set_data_cmd) + data_size;
+    set_data_cmd.meta_header.meta_data_type    = format::MetaDataType::kSetPipelineCacheDataCommand;
+    set_data_cmd.thread_id                     = thread_id_;
+    set_data_cmd.device_id                     = device_id;
+    set_data_cmd.data_size                     = data_size;
+
+    util::OutputBuffer buffers[] = { { &set_data_cmd, sizeof(set_data_cmd) }, { data, data_size } };
+    output_stream_->WriteBuffers(buffers, 2);
 }
 
 VkMemoryPropertyFlags VulkanStateWriter::GetMemoryProperties(const DeviceWrapper*       device_wrapper,
@@ -2965,6 +3886,24 @@ VulkanStateWriter::SubmitCommandBuffer(VkQueue queue, VkCommandBuffer command_bu
     return device_table->QueueWaitIdle(queue);
 }
 
+VkResult VulkanStateWriter::CreateFence(const DeviceWrapper* device_wrapper, VkFence* fence)
+{
+    assert((device_wrapper != nullptr) && (fence != nullptr));
+
+    VkFenceCreateInfo create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+    create_info.pNext             = nullptr;
+    create_info.flags             = 0;
+
+    VkResult result = device_wrapper->layer_table.CreateFence(device_wrapper->handle, &create_info, nullptr, fence);
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to create a fence for resource memory snapshot");
+    }
+
+    return result;
+}
+
 VkResult VulkanStateWriter::CreateStagingBuffer(const DeviceWrapper*    device_wrapper,
                                                 VkDeviceSize            size,
                                                 VkBuffer*               buffer,
@@ -3043,6 +3982,46 @@ VkResult VulkanStateWriter::CreateStagingBuffer(const DeviceWrapper*    device_w
     return result;
 }
 
+VkResult VulkanStateWriter::CreateStagingRegions(const DeviceWrapper*    device_wrapper,
+                                                 const VulkanStateTable& state_table,
+                                                 StagingContext*         staging)
+{
+    assert((device_wrapper != nullptr) && (staging != nullptr));
+
+    const DeviceTable*    device_table      = &device_wrapper->layer_table;
+    VkBuffer              buffer            = VK_NULL_HANDLE;
+    VkDeviceMemory        memory            = VK_NULL_HANDLE;
+    VkMemoryPropertyFlags memory_properties = 0;
+
+    VkResult result = CreateStagingBuffer(device_wrapper,
+                                          staging->region_size * staging->region_count,
+                                          &buffer,
+                                          &memory,
+                                          &memory_properties,
+                                          state_table);
+
+    if (result == VK_SUCCESS)
+    {
+        void* data = nullptr;
+        result     = device_table->MapMemory(device_wrapper->handle, memory, 0, VK_WHOLE_SIZE, 0, &data);
+
+        if (result == VK_SUCCESS)
+        {
+            staging->buffer      = buffer;
+            staging->memory      = memory;
+            staging->mapped_data = reinterpret_cast<const uint8_t*>(data);
+            staging->is_coherent = IsMemoryCoherent(memory_properties);
+        }
+        else
+        {
+            device_table->DestroyBuffer(device_wrapper->handle, buffer, nullptr);
+            device_table->FreeMemory(device_wrapper->handle, memory, nullptr);
+        }
+    }
+
+    return result;
+}
+
 VkResult VulkanStateWriter::ResolveImage(const DeviceWrapper*    device_wrapper,
                                          const ImageWrapper*     image_wrapper,
                                          VkQueue                 queue,
@@ -3606,33 +4585,35 @@ bool VulkanStateWriter::CheckDescriptorStatus(const DescriptorInfo*   descriptor
                                               const VulkanStateTable& state_table,
                                               VkDescriptorType*       descriptor_type)
 {
-    bool valid = false;
+    bool        valid   = false;
+    const auto& chunk   = descriptor->chunks[index >> DescriptorInfo::kChunkShift];
+    uint32_t    element = index & DescriptorInfo::kChunkMask;
 
     if (descriptor->type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
     {
-        *descriptor_type = descriptor->mutable_type[index];
+        *descriptor_type = (chunk != nullptr) ? chunk->mutable_type[element] : VK_DESCRIPTOR_TYPE_MUTABLE_VALVE;
     }
     else
     {
         *descriptor_type = descriptor->type;
     }
 
-    if (descriptor->written[index])
+    if ((chunk != nullptr) && ((chunk->written & (uint64_t{ 1 } << element)) != 0))
     {
         // Check for handles that may no longer exist, which indicates that this descriptor is stale and should
         // be ignored, as there is no valid handle to write into it.
         switch (*descriptor_type)
         {
             case VK_DESCRIPTOR_TYPE_SAMPLER:
-                if (state_table.GetSamplerWrapper(descriptor->sampler_ids[index]) != nullptr)
+                if (state_table.GetSamplerWrapper(chunk->sampler_ids[element]) != nullptr)
                 {
                     valid = true;
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
                 if ((descriptor->immutable_samplers ||
-                     (state_table.GetSamplerWrapper(descriptor->sampler_ids[index]) != nullptr)) &&
-                    IsImageViewValid(descriptor->handle_ids[index], state_table))
+                     (state_table.GetSamplerWrapper(chunk->sampler_ids[element]) != nullptr)) &&
+                    IsImageViewValid(chunk->handle_ids[element], state_table))
                 {
                     valid = true;
                 }
@@ -3640,7 +4621,7 @@ bool VulkanStateWriter::CheckDescriptorStatus(const DescriptorInfo*   descriptor
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                if (IsImageViewValid(descriptor->handle_ids[index], state_table))
+                if (IsImageViewValid(chunk->handle_ids[element], state_table))
                 {
                     valid = true;
                 }
@@ -3649,14 +4630,14 @@ bool VulkanStateWriter::CheckDescriptorStatus(const DescriptorInfo*   descriptor
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                if (IsBufferValid(descriptor->handle_ids[index], state_table))
+                if (IsBufferValid(chunk->handle_ids[element], state_table))
                 {
                     valid = true;
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                if (IsBufferViewValid(descriptor->handle_ids[index], state_table))
+                if (IsBufferViewValid(chunk->handle_ids[element], state_table))
                 {
                     valid = true;
                 }
@@ -3670,7 +4651,7 @@ bool VulkanStateWriter::CheckDescriptorStatus(const DescriptorInfo*   descriptor
                 GFXRECON_LOG_WARNING("Descriptor type acceleration structure NV is not currently supported");
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
-                if (state_table.GetAccelerationStructureKHRWrapper(descriptor->handle_ids[index]) != nullptr)
+                if (state_table.GetAccelerationStructureKHRWrapper(chunk->handle_ids[element]) != nullptr)
                 {
                     valid = true;
                 }
@@ -23,20 +23,27 @@
 #ifndef GFXRECON_ENCODE_VULKAN_STATE_WRITER_H
 #define GFXRECON_ENCODE_VULKAN_STATE_WRITER_H
 
+#include "encode/blob_deduplicator.h"
+#include "encode/fill_memory_deduplicator.h"
 #include "encode/parameter_encoder.h"
+#include "encode/trim_content_cache.h"
 #include "encode/vulkan_handle_wrappers.h"
 #include "encode/vulkan_state_table.h"
 #include "format/format.h"
+#include "format/format_util.h"
 #include "format/platform_types.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/compressor.h"
 #include "util/defines.h"
-#include "util/file_output_stream.h"
 #include "util/memory_output_stream.h"
+#include "util/output_stream.h"
 
 #include "vulkan/vulkan.h"
 
+#include <functional>
+#include <memory>
 #include <set>
+#include <thread>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -45,7 +52,26 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateWriter
 {
   public:
-    VulkanStateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    // When fill_memory_deduplicator is not null, fill memory commands with the same content as a previous fill memory
+    // command are written as references to the previous command.
+    //
+    // When content_cache is not null, resource content that is copied through a staging buffer is retained by the
+    // cache, and content that was retained by a previous snapshot is written in place of a staging copy for resources
+    // that have not been modified since.
+    //
+    // Sections of the state snapshot that do not access the GPU are encoded by worker threads, which create their own
+    // compressors of the specified compression_type and compressor_options.
+    VulkanStateWriter(util::OutputStream*              output_stream,
+                      util::Compressor*                compressor,
+                      format::CompressionType          compression_type,
+                      const format::CompressorOptions& compressor_options,
+                      format::ThreadId                 thread_id,
+                      format::HandleIdEncoding         handle_id_encoding,
+                      FillMemoryDeduplicator*          fill_memory_deduplicator = nullptr,
+                      TrimContentCache*                content_cache            = nullptr,
+                      BlobDeduplicator*                blob_deduplicator        = nullptr,
+                      bool                             write_pipeline_cache_data = false,
+                      bool                             write_content_patterns    = false);
 
     ~VulkanStateWriter();
 
@@ -56,21 +82,25 @@ class VulkanStateWriter
     // Data structures for processing resource memory snapshots.
     struct BufferSnapshotInfo
     {
-        const BufferWrapper*       buffer_wrapper{ nullptr };
-        const DeviceMemoryWrapper* memory_wrapper{ nullptr };
-        VkMemoryPropertyFlags      memory_properties{};
-        bool                       need_staging_copy{ false };
+        const BufferWrapper*           buffer_wrapper{ nullptr };
+        const DeviceMemoryWrapper*     memory_wrapper{ nullptr };
+        VkMemoryPropertyFlags          memory_properties{};
+        VkDeviceSize                   memory_size{ 0 }; // Size of the memory range bound to the buffer.
+        bool                           need_staging_copy{ false };
+        const TrimContentCache::Entry* cached_content{ nullptr };
     };
 
     struct ImageSnapshotInfo
     {
-        const ImageWrapper*        image_wrapper{ nullptr };
-        const DeviceMemoryWrapper* memory_wrapper{ nullptr };
-        VkMemoryPropertyFlags      memory_properties{};
-        bool                       need_staging_copy{ false };
-        VkImageAspectFlagBits      aspect{};
-        VkDeviceSize               resource_size{ 0 }; // Combined size of all sub-resources.
-        std::vector<uint64_t>      level_sizes;        // Combined size of all layers in a mip level.
+        const ImageWrapper*            image_wrapper{ nullptr };
+        const DeviceMemoryWrapper*     memory_wrapper{ nullptr };
+        VkMemoryPropertyFlags          memory_properties{};
+        VkDeviceSize                   memory_size{ 0 }; // Size of the memory range bound to the image.
+        bool                           need_staging_copy{ false };
+        const TrimContentCache::Entry* cached_content{ nullptr };
+        VkImageAspectFlagBits          aspect{};
+        VkDeviceSize                   resource_size{ 0 }; // Combined size of all sub-resources.
+        std::vector<uint64_t>          level_sizes;        // Combined size of all layers in a mip level.
     };
 
     struct ResourceSnapshotInfo
@@ -79,6 +109,25 @@ class VulkanStateWriter
         std::vector<ImageSnapshotInfo>  images;
     };
 
+    // Staging resources for copying resource memory that is not host readable.  The staging buffer is divided into one
+    // or two regions, each sized for a batch of resource copies.  With two regions, the copy for the next batch runs on
+    // the GPU while the data for the current batch is written.
+    struct StagingContext
+    {
+        VkQueue         queue{ VK_NULL_HANDLE };
+        VkBuffer        buffer{ VK_NULL_HANDLE };
+        VkDeviceMemory  memory{ VK_NULL_HANDLE };
+        const uint8_t*  mapped_data{ nullptr };
+        VkDeviceSize    region_size{ 0 };
+        uint32_t        region_count{ 0 };
+        bool            is_coherent{ false };
+        VkCommandBuffer command_buffers[2]{ VK_NULL_HANDLE, VK_NULL_HANDLE };
+        VkFence         fences[2]{ VK_NULL_HANDLE, VK_NULL_HANDLE };
+    };
+
+    typedef std::function<void(size_t, VkCommandBuffer, VkDeviceSize)> RecordStagingCopyFunc;
+    typedef std::function<void(size_t, const uint8_t*)>                 WriteStagingDataFunc;
+
     typedef std::unordered_map<uint32_t, ResourceSnapshotInfo>                         ResourceSnapshotQueueFamilyTable;
     typedef std::unordered_map<const DeviceWrapper*, ResourceSnapshotQueueFamilyTable> DeviceResourceTables;
 
@@ -94,6 +143,41 @@ class VulkanStateWriter
     typedef std::vector<QueryActivationData>                  QueryActivationList;
     typedef std::unordered_map<uint32_t, QueryActivationList> QueryActivationQueueFamilyTable;
 
+    // Descriptor writes for a single vkUpdateDescriptorSets command, with copies of the descriptor data that they
+    // reference.  The data pointers of the writes are set from data_offsets, the index of the first element of each
+    // write in the array for its descriptor type, when the command is written.
+    struct DescriptorWriteBatch
+    {
+        size_t                                                    descriptor_count{ 0 };
+        std::vector<VkWriteDescriptorSet>                         writes;
+        std::vector<size_t>                                       data_offsets;
+        std::vector<VkDescriptorImageInfo>                        images;
+        std::vector<VkDescriptorBufferInfo>                       buffers;
+        std::vector<VkBufferView>                                 texel_buffer_views;
+        std::vector<VkAccelerationStructureKHR>                   acceleration_structures;
+        std::vector<VkWriteDescriptorSetAccelerationStructureKHR> write_accel_structs;
+    };
+
+    // Encodes a section of the state snapshot to memory on a worker thread, using a writer with its own encoder and
+    // compressor.  Sections are written to the output stream by Finish, so that they can be encoded concurrently and
+    // still be written in dependency order.
+    class DeferredSection
+    {
+      public:
+        DeferredSection(const VulkanStateWriter* parent, std::function<void(VulkanStateWriter*)> write_section);
+
+        ~DeferredSection();
+
+        // Waits for the section to be encoded and writes the encoded data to output_stream.
+        void Finish(util::OutputStream* output_stream);
+
+      private:
+        util::MemoryOutputStream           section_stream_;
+        std::unique_ptr<util::Compressor>  section_compressor_;
+        std::unique_ptr<VulkanStateWriter> section_writer_;
+        std::thread                        thread_;
+    };
+
   private:
     void WritePhysicalDeviceState(const VulkanStateTable& state_table);
 
@@ -107,14 +191,20 @@ class VulkanStateWriter
 
     void WriteSemaphoreState(const VulkanStateTable& state_table);
 
-    void WriteBufferViewState(const VulkanStateTable& state_table);
+    void WriteBufferViewState(const VulkanStateTable& state_table, const BufferViewWrapper* wrapper);
 
-    void WriteImageViewState(const VulkanStateTable& state_table);
+    void WriteImageViewState(const VulkanStateTable& state_table, const ImageViewWrapper* wrapper);
+
+    void WriteSamplerState(const VulkanStateTable& state_table, const SamplerWrapper* wrapper);
 
     void WriteFramebufferState(const VulkanStateTable& state_table);
 
     void WritePipelineLayoutState(const VulkanStateTable& state_table);
 
+    // Writes the pipeline cache creation calls, followed by the merged data of each device's pipeline caches when
+    // pipeline cache data is enabled.
+    void WritePipelineCacheState(const VulkanStateTable& state_table);
+
     void WritePipelineState(const VulkanStateTable& state_table);
 
     void WriteDescriptorSetState(const VulkanStateTable& state_table);
@@ -136,23 +226,67 @@ class VulkanStateWriter
 
     void ProcessBufferMemory(const DeviceWrapper*                   device_wrapper,
                              const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                             uint32_t                               queue_family_index,
-                             VkQueue                                queue,
-                             VkCommandBuffer                        command_buffer,
-                             VkBuffer                               staging_buffer,
-                             VkDeviceMemory                         staging_memory,
-                             bool                                   is_staging_memory_coherent);
+                             const StagingContext&                  staging);
 
     void ProcessImageMemory(const DeviceWrapper*                  device_wrapper,
                             const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                            uint32_t                              queue_family_index,
-                            VkQueue                               queue,
-                            VkCommandBuffer                       command_buffer,
-                            VkBuffer                              staging_buffer,
-                            VkDeviceMemory                        staging_memory,
-                            bool                                  is_staging_memory_coherent,
+                            const StagingContext&                 staging,
                             const VulkanStateTable&               state_table);
 
+    // Copies resources to the staging buffer in batches that fit in a staging region, with one queue submission per
+    // batch.  The record_copy function records the copy for the resource at an index to a command buffer, with the
+    // specified staging buffer offset, and write_data writes the copied data for a resource, or receives nullptr if
+    // the copy failed.
+    void ProcessStagingBatches(const DeviceWrapper*             device_wrapper,
+                               const StagingContext&            staging,
+                               const std::vector<VkDeviceSize>& copy_sizes,
+                               RecordStagingCopyFunc            record_copy,
+                               WriteStagingDataFunc             write_data);
+
+    void RecordImageCopy(const DeviceTable*       device_table,
+                         VkCommandBuffer          command_buffer,
+                         const ImageSnapshotInfo& snapshot_entry,
+                         VkImage                  copy_image,
+                         VkBuffer                 staging_buffer,
+                         VkDeviceSize             staging_offset);
+
+    // Sets the cached content for staged resources that have not been modified since the content was captured.
+    void FindCachedResourceContent(DeviceResourceTables* resources);
+
+    // Compresses resource data for an init command.  Returns true and replaces the data pointer and size with the
+    // compressed data when the data was compressed.
+    bool CompressResourceData(const uint8_t** data, size_t* data_size);
+
+    // Returns the size of the shortest pattern that repeats to form the resource data, or 0 when the data is not
+    // formed by a pattern that is short enough to be written in its place.
+    static size_t GetContentPatternSize(const uint8_t* data, size_t data_size);
+
+    // When cache_content is true, the content written for a staged resource is retained by the content cache.
+    void WriteInitBufferCommand(format::HandleId     device_id,
+                                const BufferWrapper* buffer_wrapper,
+                                const uint8_t*       bytes,
+                                bool                 cache_content = false);
+
+    void WriteInitImageCommand(format::HandleId         device_id,
+                               const ImageSnapshotInfo& snapshot_entry,
+                               const uint8_t*           bytes,
+                               bool                     cache_content = false);
+
+    // When pattern is true, the data is a pattern that repeats to form the resource content.
+    void WriteInitBufferBlock(format::HandleId     device_id,
+                              const BufferWrapper* buffer_wrapper,
+                              bool                 compressed,
+                              bool                 pattern,
+                              const uint8_t*       data,
+                              size_t               data_size);
+
+    void WriteInitImageBlock(format::HandleId         device_id,
+                             const ImageSnapshotInfo& snapshot_entry,
+                             bool                     compressed,
+                             bool                     pattern,
+                             const uint8_t*           data,
+                             size_t                   data_size);
+
     void WriteBufferMemoryState(const VulkanStateTable& state_table,
                                 DeviceResourceTables*   resources,
                                 VkDeviceSize*           max_resource_size,
@@ -224,9 +358,21 @@ class VulkanStateWriter
 
     void WriteCommandBufferCommands(const CommandBufferWrapper* wrapper, const VulkanStateTable& state_table);
 
-    void WriteDescriptorUpdateCommand(format::HandleId      device_id,
-                                      const DescriptorInfo* binding,
-                                      VkWriteDescriptorSet* write);
+    // Appends the data of a range of descriptor array elements to batch_data, returning the index of the first one.
+    template <typename T>
+    static size_t CopyDescriptorData(const DescriptorInfo*                binding,
+                                     uint32_t                             first_element,
+                                     uint32_t                             count,
+                                     std::unique_ptr<T[]> DescriptorInfo::Chunk::*chunk_data,
+                                     std::vector<T>*                      batch_data);
+
+    // Adds a write of a range of written descriptors from a binding to the batch.
+    void AddDescriptorWrite(const DescriptorInfo*       binding,
+                            const VkWriteDescriptorSet& write,
+                            DescriptorWriteBatch*       batch);
+
+    // Writes the batched descriptor writes with one vkUpdateDescriptorSets command and clears the batch.
+    void WriteDescriptorUpdateCommand(format::HandleId device_id, DescriptorWriteBatch* batch);
 
     void WriteQueryPoolReset(format::HandleId                            device_id,
                              const std::vector<const QueryPoolWrapper*>& query_pool_wrappers);
@@ -257,6 +403,13 @@ class VulkanStateWriter
 
     void WriteFillMemoryCmd(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size, const void* data);
 
+    void WriteFillMemoryFromPreviousBlockCmd(format::HandleId memory_id,
+                                             VkDeviceSize     offset,
+                                             VkDeviceSize     size,
+                                             uint64_t         source_index);
+
+    void WriteSetBlobDataCmd(uint64_t blob_id, const void* data, size_t size);
+
     void WriteResizeWindowCmd(format::HandleId surface_id, uint32_t width, uint32_t height);
 
     void WriteResizeWindowCmd2(format::HandleId              surface_id,
@@ -281,6 +434,8 @@ class VulkanStateWriter
                                                      size_t           data_size,
                                                      const void*      data);
 
+    void WriteSetPipelineCacheDataCommand(format::HandleId device_id, size_t data_size, const void* data);
+
     template <typename Wrapper>
     void StandardCreateWrite(const VulkanStateTable& state_table)
     {
@@ -296,6 +451,15 @@ class VulkanStateWriter
         });
     }
 
+    // Splits the wrappers of an object type into contiguous ranges that are encoded concurrently by deferred sections,
+    // for object types with creation calls that do not depend on other objects of the same type.  The wrappers must
+    // remain valid until the sections are finished, which must be done in order.
+    template <typename Wrapper>
+    void StartRangeSections(const VulkanStateTable&            state_table,
+                            const std::vector<const Wrapper*>& wrappers,
+                            void (VulkanStateWriter::*write_wrapper)(const VulkanStateTable&, const Wrapper*),
+                            std::vector<std::unique_ptr<DeferredSection>>* sections);
+
     VkMemoryPropertyFlags GetMemoryProperties(const DeviceWrapper*       device_wrapper,
                                               const DeviceMemoryWrapper* memory_wrapper,
                                               const VulkanStateTable&    state_table);
@@ -322,6 +486,8 @@ class VulkanStateWriter
 
     VkResult SubmitCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer, const DeviceTable* device_table);
 
+    VkResult CreateFence(const DeviceWrapper* device_wrapper, VkFence* fence);
+
     VkResult CreateStagingBuffer(const DeviceWrapper*    device_wrapper,
                                  VkDeviceSize            size,
                                  VkBuffer*               buffer,
@@ -329,6 +495,11 @@ class VulkanStateWriter
                                  VkMemoryPropertyFlags*  memory_property_flags,
                                  const VulkanStateTable& state_table);
 
+    // Creates and maps a staging buffer with the region count and region size of the staging context.
+    VkResult CreateStagingRegions(const DeviceWrapper*    device_wrapper,
+                                  const VulkanStateTable& state_table,
+                                  StagingContext*         staging);
+
     VkResult ResolveImage(const DeviceWrapper*    device_wrapper,
                           const ImageWrapper*     image_wrapper,
                           VkQueue                 queue,
@@ -368,12 +539,20 @@ class VulkanStateWriter
     bool IsFramebufferValid(const FramebufferWrapper* framebuffer_wrapper, const VulkanStateTable& state_table);
 
   private:
-    util::FileOutputStream*  output_stream_;
-    util::Compressor*        compressor_;
-    std::vector<uint8_t>     compressed_parameter_buffer_;
-    format::ThreadId         thread_id_;
-    util::MemoryOutputStream parameter_stream_;
-    ParameterEncoder         encoder_;
+    util::OutputStream*       output_stream_;
+    util::Compressor*         compressor_;
+    format::CompressionType   compression_type_;
+    format::CompressorOptions compressor_options_;
+    std::vector<uint8_t>      compressed_parameter_buffer_;
+    format::ThreadId          thread_id_;
+    format::HandleIdEncoding  handle_id_encoding_;
+    util::MemoryOutputStream  parameter_stream_;
+    ParameterEncoder          encoder_;
+    FillMemoryDeduplicator*   fill_memory_deduplicator_;
+    TrimContentCache*         content_cache_;
+    BlobDeduplicator*         blob_deduplicator_;
+    bool                      write_pipeline_cache_data_;
+    bool                      write_content_patterns_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -33,6 +33,7 @@
 
 #define GFXRECON_FOURCC GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'R')
 #define GFXRECON_FILE_EXTENSION ".gfxr"
+#define GFXRECON_SEEK_INDEX_FOURCC GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'I')
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(format)
@@ -54,9 +55,24 @@ typedef HandleEncodeType HandleId;
 typedef uint64_t         ThreadId;
 
 const uint32_t kCompressedBlockTypeBit    = 0x80000000;
+const uint32_t kBlockCompressionTypeMask  = 0x0f000000; // Per-block CompressionType tag for compressed blocks.
+const uint32_t kBlockCompressionTypeShift = 24;
 const size_t   kUuidSize                  = 16;
 const size_t   kMaxPhysicalDeviceNameSize = 256;
 const HandleId kNullHandleId              = 0;
+const uint32_t kCompactRecordKindBits     = 2;
+
+// Block payload alignment of files written with the kBlockAlignment option.  Payloads of resource initialization and
+// fill memory commands that are at least kLargePayloadSize bytes are aligned to kLargePayloadAlignment, so that they
+// can be read with direct I/O or used in place from a memory mapping of the file.
+const uint32_t kBlockPayloadAlignment = 8;
+const uint32_t kLargePayloadAlignment = 4096;
+const uint64_t kLargePayloadSize      = 64 * 1024;
+
+// File format versions.  Version 0.1 files may contain kCompactBatchBlock blocks.
+const uint32_t kFileMajorVersion               = 0;
+const uint32_t kFileMinorVersion               = 0;
+const uint32_t kCompactHeadersFileMinorVersion = 1;
 
 constexpr uint32_t MakeCompressedBlockType(uint32_t block_type)
 {
@@ -72,8 +88,13 @@ enum BlockType : uint32_t
     kMetaDataBlock               = 3,
     kFunctionCallBlock           = 4,
     kAnnotation                  = 5,
+    kBatchBlock                  = 6, // Container for a sequence of blocks. Only written in compressed form.
+    kCompactBatchBlock           = 7, // Batch block containing compact records.  Only written in compressed form.
+    kPaddingBlock                = 8, // Padding that aligns the payload of the next block.  The block data is ignored.
     kCompressedMetaDataBlock     = MakeCompressedBlockType(kMetaDataBlock),
-    kCompressedFunctionCallBlock = MakeCompressedBlockType(kFunctionCallBlock)
+    kCompressedFunctionCallBlock = MakeCompressedBlockType(kFunctionCallBlock),
+    kCompressedBatchBlock        = MakeCompressedBlockType(kBatchBlock),
+    kCompressedCompactBatchBlock = MakeCompressedBlockType(kCompactBatchBlock)
 };
 
 enum MarkerType : uint32_t
@@ -108,7 +129,24 @@ enum MetaDataType : uint32_t
     kSetDeviceMemoryPropertiesCommand       = 12,
     kResizeWindowCommand2                   = 13,
     kSetOpaqueAddressCommand                = 14,
-    kSetRayTracingShaderGroupHandlesCommand = 15
+    kSetRayTracingShaderGroupHandlesCommand = 15,
+    kFillMemoryFromPreviousBlockCommand     = 16,
+    kSetCompressionDictionaryCommand        = 17,
+    kSeekIndexCommand                       = 18,
+    kSeekIndexFooterCommand                 = 19,
+    kSetBlobDataCommand                     = 20,
+    kSetPipelineCacheDataCommand            = 21,
+    kInitBufferPatternCommand               = 22,
+    kInitImagePatternCommand                = 23,
+    kTimestampCommand                       = 24
+};
+
+enum SeekIndexEntryType : uint32_t
+{
+    kUnknownSeekIndexEntry    = 0,
+    kFrameSeekIndexEntry      = 1, // Start of the blocks for a frame.
+    kStateBeginSeekIndexEntry = 2, // Start of a state snapshot.
+    kStateEndSeekIndexEntry   = 3  // End of a state snapshot.
 };
 
 enum CompressionType : uint32_t
@@ -119,11 +157,34 @@ enum CompressionType : uint32_t
     kZstd = 3
 };
 
+// Kinds of the records contained by a kCompactBatchBlock.  Each record starts with a LEB128 varint holding
+// (value << kCompactRecordKindBits) | kind, and the thread ID is 0 at the start of each batch.
+enum CompactRecordKind : uint32_t
+{
+    kCompactFunctionCall = 0, // Value is the size of the parameter data, which follows a 16-bit ApiFamily_Vulkan call
+                              // ID.  The function call belongs to the thread set by the last thread switch.
+    kCompactThreadSwitch = 1, // Value is the thread ID of the function calls that follow.
+    kCompactBlock        = 2, // Value is 0, and is followed by a complete block with a standard block header.
+};
+
+enum HandleIdEncoding : uint32_t
+{
+    kFixedHandleIds  = 0, // Handle IDs are encoded as 64-bit values.
+    kVarintHandleIds = 1  // Handle IDs are encoded as LEB128 varints.  The elements of handle arrays are encoded as
+                          // zigzag varints of their difference from the previous element, starting from 0.
+};
+
 enum FileOption : uint32_t
 {
     kUnknownFileOption = 0,
     kCompressionType   = 1, // One of the CompressionType values defining the compression algorithm used with parameter
                             // encoding. Default = CompressionType::kNone.
+    kHandleIdEncoding  = 2, // One of the HandleIdEncoding values defining the encoding of handle IDs in API call
+                            // parameter data.  Default = HandleIdEncoding::kFixedHandleIds.
+    kBlockAlignment    = 3, // Alignment in bytes of the block payloads, which follow the fixed size block and command
+                            // headers.  Blocks are preceded by kPaddingBlock blocks as needed.  Default = 0 (packed).
+    kFillMemoryReuse   = 4, // Non-zero when kFillMemoryFromPreviousBlockCommand blocks reuse the data of earlier
+                            // kFillMemoryCommand blocks, which must be read again.  Default = 0.
 };
 
 enum PointerAttributes : uint32_t
@@ -143,6 +204,7 @@ enum PointerAttributes : uint32_t
     // What was encoded
     kHasAddress     = 0x0040, // The address of the pointer was encoded (always comes before data).
     kHasData        = 0x0080, // The data pointed to was encoded.
+    kHasBlobId      = 0x0200, // The ID of a kSetBlobDataCommand blob was encoded in place of the data.
 };
 
 enum ResizeWindowPreTransform : uint32_t
@@ -156,7 +218,10 @@ enum ResizeWindowPreTransform : uint32_t
 
 struct EnabledOptions
 {
-    CompressionType compression_type{ CompressionType::kNone };
+    CompressionType  compression_type{ CompressionType::kNone };
+    HandleIdEncoding handle_id_encoding{ HandleIdEncoding::kFixedHandleIds };
+    uint32_t         block_alignment{ 0 };
+    bool             fill_memory_reuse{ false };
 };
 
 #pragma pack(push)
@@ -204,6 +269,14 @@ struct CompressedFunctionCallHeader
     uint64_t         uncompressed_size;
 };
 
+// Header for a compressed sequence of blocks.  The header is followed by the compressed data, which decompresses to
+// uncompressed_size bytes containing complete blocks.  Batch blocks are not nested.
+struct CompressedBatchBlockHeader
+{
+    BlockHeader block_header;
+    uint64_t    uncompressed_size;
+};
+
 struct MethodCallHeader
 {
     BlockHeader      block_header;
@@ -238,6 +311,27 @@ struct FillMemoryCommandHeader
     uint64_t memory_size;   // Uncompressed size of the data encoded after the header.
 };
 
+// Not a header because this command does not include a variable length data payload.
+// All of the command data is present in the struct.
+struct FillMemoryFromPreviousBlockCommand
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    HandleId         memory_id;
+    uint64_t         memory_offset; // Offset from the start of the mapped pointer, not the start of the memory object.
+    uint64_t         memory_size;   // Size of the data, which must match the memory_size of the source block.
+    uint64_t         source_index;  // Zero-based index, in file order, of the kFillMemoryCommand block containing the
+                                    // data for this command.
+};
+
+// Dictionary to be loaded by the compressor for the file's compression type before any subsequent blocks are
+// decompressed.  The header is followed by dictionary_size bytes of dictionary data.
+struct SetCompressionDictionaryCommandHeader
+{
+    MetaDataHeader meta_header;
+    uint64_t       dictionary_size;
+};
+
 struct DisplayMessageCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -340,6 +434,10 @@ struct EndResourceInitCommand
     format::HandleId device_id;
 };
 
+// The kInitBufferPatternCommand and kInitImagePatternCommand blocks initialize resources whose content repeats a short
+// pattern, such as cleared render targets, with the same headers as kInitBufferCommand and kInitImageCommand.  The
+// data_size field is the size of the content, which is formed by repeating the pattern that follows the header in
+// place of the content.  The pattern size is the remaining size of the block, and the pattern is not compressed.
 struct InitBufferCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -414,6 +512,61 @@ struct SetRayTracingShaderGroupHandlesCommandHeader
     size_t           data_size;
 };
 
+// Pipeline cache data retrieved from the device when a state snapshot was written, for replay to merge into the
+// pipeline caches of the same device before the snapshot pipelines are created.  The header is followed by data_size
+// bytes of data, as returned by vkGetPipelineCacheData.
+struct SetPipelineCacheDataCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    format::HandleId device_id;
+    uint64_t         data_size;
+};
+
+// Index of file offsets, written at the end of the capture file, which is followed by the entries.  Offsets are
+// relative to the start of the file and reference the start of a block.
+struct SeekIndexCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint64_t         entry_count;
+};
+
+struct SeekIndexEntry
+{
+    uint64_t           offset;
+    uint64_t           frame_number;
+    SeekIndexEntryType type;
+};
+
+// Last block of a capture file with a seek index, which can be read from the end of the file to locate the index.
+struct SeekIndexFooterCommand
+{
+    MetaDataHeader meta_header;
+    uint64_t       index_offset;
+    uint32_t       fourcc; // GFXRECON_SEEK_INDEX_FOURCC
+};
+
+// Data, such as shader code, that is referenced by the arrays encoded with the kHasBlobId pointer attribute.  A blob is
+// written before the first block that references it.  The header is followed by data_size bytes of blob data, which
+// may be compressed.
+struct SetBlobDataCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint64_t         blob_id;   // Content hash of the data.
+    uint64_t         data_size; // Uncompressed size of the data encoded after the header.
+};
+
+// Host CPU time at the start of the application's next queue submission or present call from the thread, which is
+// written before the block of the call when CPU timestamps are enabled for capture.
+struct TimestampCommand
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint64_t         timestamp; // Nanoseconds from an unspecified starting point, on a monotonic clock.
+};
+
 #pragma pack(pop)
 
 GFXRECON_END_NAMESPACE(format)
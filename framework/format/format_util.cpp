@@ -25,12 +25,201 @@
 
 #include "util/logging.h"
 #include "util/lz4_compressor.h"
+#include "util/platform.h"
 #include "util/zlib_compressor.h"
 #include "util/zstd_compressor.h"
 
+#include <cassert>
+#include <limits>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(format)
 
+// Size of the function call block data that is replaced by the compact record header.
+const size_t kCallHeaderDataSize = sizeof(FunctionCallHeader::api_call_id) + sizeof(FunctionCallHeader::thread_id);
+
+static void AppendVarint(uint64_t value, std::vector<uint8_t>* output)
+{
+    while (value >= 0x80)
+    {
+        output->push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+
+    output->push_back(static_cast<uint8_t>(value));
+}
+
+static bool ReadVarint(const uint8_t* data, size_t data_size, size_t* offset, uint64_t* value)
+{
+    uint64_t result = 0;
+
+    for (uint32_t shift = 0; (shift < 64) && (*offset < data_size); shift += 7)
+    {
+        uint8_t byte = data[(*offset)++];
+        result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            *value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void AppendBytes(const void* data, size_t data_size, std::vector<uint8_t>* output)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    output->insert(output->end(), bytes, bytes + data_size);
+}
+
+bool EncodeCompactRecords(const uint8_t* blocks, size_t blocks_size, std::vector<uint8_t>* records)
+{
+    assert((blocks != nullptr) && (records != nullptr));
+
+    const uint64_t kMaxRecordValue = std::numeric_limits<uint64_t>::max() >> kCompactRecordKindBits;
+
+    ThreadId thread_id = 0;
+    size_t   offset    = 0;
+
+    records->clear();
+    records->reserve(blocks_size);
+
+    while (offset < blocks_size)
+    {
+        BlockHeader header;
+
+        if ((blocks_size - offset) < sizeof(header))
+        {
+            return false;
+        }
+
+        util::platform::MemoryCopy(&header, sizeof(header), blocks + offset, sizeof(header));
+
+        if (header.size > (blocks_size - offset - sizeof(header)))
+        {
+            return false;
+        }
+
+        const uint8_t* block_data      = blocks + offset + sizeof(header);
+        size_t         block_data_size = static_cast<size_t>(header.size);
+        ApiCallId      call_id         = ApiCallId::ApiCall_Unknown;
+        ThreadId       call_thread_id  = 0;
+
+        if ((header.type == BlockType::kFunctionCallBlock) && (block_data_size >= kCallHeaderDataSize))
+        {
+            util::platform::MemoryCopy(&call_id, sizeof(call_id), block_data, sizeof(call_id));
+            util::platform::MemoryCopy(
+                &call_thread_id, sizeof(call_thread_id), block_data + sizeof(call_id), sizeof(call_thread_id));
+        }
+
+        if (((call_id >> 16) == ApiFamilyId::ApiFamily_Vulkan) && (call_thread_id <= kMaxRecordValue))
+        {
+            if (call_thread_id != thread_id)
+            {
+                AppendVarint((call_thread_id << kCompactRecordKindBits) | kCompactThreadSwitch, records);
+                thread_id = call_thread_id;
+            }
+
+            uint64_t parameter_size = header.size - kCallHeaderDataSize;
+            uint16_t compact_id     = static_cast<uint16_t>(call_id & 0xffff);
+
+            AppendVarint((parameter_size << kCompactRecordKindBits) | kCompactFunctionCall, records);
+            AppendBytes(&compact_id, sizeof(compact_id), records);
+            AppendBytes(block_data + kCallHeaderDataSize, static_cast<size_t>(parameter_size), records);
+        }
+        else
+        {
+            AppendVarint(kCompactBlock, records);
+            AppendBytes(blocks + offset, sizeof(header) + block_data_size, records);
+        }
+
+        offset += sizeof(header) + block_data_size;
+    }
+
+    return true;
+}
+
+bool DecodeCompactRecords(const uint8_t* records, size_t records_size, std::vector<uint8_t>* blocks)
+{
+    assert((records != nullptr) && (blocks != nullptr));
+
+    ThreadId thread_id = 0;
+    size_t   offset    = 0;
+
+    blocks->clear();
+    blocks->reserve(records_size * 2);
+
+    while (offset < records_size)
+    {
+        uint64_t tag = 0;
+
+        if (!ReadVarint(records, records_size, &offset, &tag))
+        {
+            return false;
+        }
+
+        uint64_t value = tag >> kCompactRecordKindBits;
+
+        switch (tag & ((1 << kCompactRecordKindBits) - 1))
+        {
+            case kCompactFunctionCall:
+            {
+                uint16_t compact_id = 0;
+
+                if (((records_size - offset) < sizeof(compact_id)) ||
+                    (value > (records_size - offset - sizeof(compact_id))))
+                {
+                    return false;
+                }
+
+                util::platform::MemoryCopy(&compact_id, sizeof(compact_id), records + offset, sizeof(compact_id));
+                offset += sizeof(compact_id);
+
+                FunctionCallHeader header;
+                header.block_header.size = kCallHeaderDataSize + value;
+                header.block_header.type = BlockType::kFunctionCallBlock;
+                header.api_call_id = static_cast<ApiCallId>(MakeApiCallId(ApiFamilyId::ApiFamily_Vulkan, compact_id));
+                header.thread_id   = thread_id;
+
+                AppendBytes(&header, sizeof(header), blocks);
+                AppendBytes(records + offset, static_cast<size_t>(value), blocks);
+                offset += static_cast<size_t>(value);
+                break;
+            }
+            case kCompactThreadSwitch:
+                thread_id = value;
+                break;
+            case kCompactBlock:
+            {
+                BlockHeader header;
+
+                if ((records_size - offset) < sizeof(header))
+                {
+                    return false;
+                }
+
+                util::platform::MemoryCopy(&header, sizeof(header), records + offset, sizeof(header));
+
+                if (header.size > (records_size - offset - sizeof(header)))
+                {
+                    return false;
+                }
+
+                size_t block_size = sizeof(header) + static_cast<size_t>(header.size);
+                AppendBytes(records + offset, block_size, blocks);
+                offset += block_size;
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
 bool ValidateFileHeader(const FileHeader& header)
 {
     bool valid = true;
@@ -46,29 +235,79 @@ bool ValidateFileHeader(const FileHeader& header)
     return valid;
 }
 
-util::Compressor* CreateCompressor(CompressionType type)
+util::Compressor* CreateCompressor(CompressionType type, const CompressorOptions& options)
 {
     util::Compressor* compressor = nullptr;
 
+    if (options.long_distance_matching && (type != kZstd) && (type != kNone))
+    {
+        GFXRECON_LOG_WARNING("Long distance matching is only supported by Zstandard compression and will be ignored");
+    }
+
+    if ((options.worker_threads > 0) && (type != kZstd) && (type != kNone))
+    {
+        GFXRECON_LOG_WARNING("Compression worker threads are only supported by Zstandard compression and will be "
+                             "ignored");
+    }
+
     switch (type)
     {
         case kLz4:
 #if defined(ENABLE_LZ4_COMPRESSION)
-            compressor = new util::Lz4Compressor();
+            if (options.level < 0)
+            {
+                compressor = new util::Lz4Compressor(-options.level);
+            }
+            else if (options.level >= util::Lz4Compressor::kMinHcLevel)
+            {
+#if defined(ENABLE_LZ4HC_COMPRESSION)
+                // LZ4 HC limits the level to its maximum supported level.
+                compressor = new util::Lz4Compressor(util::Lz4Compressor::kDefaultAcceleration, options.level);
+#else
+                GFXRECON_LOG_WARNING("LZ4 HC compression is disabled; using the default LZ4 compression level");
+                compressor = new util::Lz4Compressor();
+#endif // ENABLE_LZ4HC_COMPRESSION
+            }
+            else
+            {
+                compressor = new util::Lz4Compressor();
+            }
 #else
             GFXRECON_LOG_ERROR("Failed to initialize compression module: LZ4 compression is disabled.");
 #endif // ENABLE_LZ4_COMPRESSION
             break;
         case kZlib:
 #if defined(ENABLE_ZLIB_COMPRESSION)
-            compressor = new util::ZlibCompressor();
+            if ((options.level > 0) && (options.level <= util::ZlibCompressor::kMaxCompressionLevel))
+            {
+                compressor = new util::ZlibCompressor(options.level);
+            }
+            else
+            {
+                if (options.level != kDefaultCompressionLevel)
+                {
+                    GFXRECON_LOG_WARNING("Ignoring invalid zlib compression level %d", options.level);
+                }
+
+                compressor = new util::ZlibCompressor();
+            }
 #else
             GFXRECON_LOG_ERROR("Failed to initialize compression module: zlib compression is disabled.");
 #endif // ENABLE_ZLIB_COMPRESSION
             break;
         case kZstd:
 #if defined(ENABLE_ZSTD_COMPRESSION)
-            compressor = new util::ZstdCompressor();
+            if (options.level != kDefaultCompressionLevel)
+            {
+                compressor =
+                    new util::ZstdCompressor(options.level, options.long_distance_matching, options.worker_threads);
+            }
+            else
+            {
+                compressor = new util::ZstdCompressor(util::ZstdCompressor::kDefaultCompressionLevel,
+                                                      options.long_distance_matching,
+                                                      options.worker_threads);
+            }
 #else
             GFXRECON_LOG_ERROR("Failed to initialize compression module: Zstandard compression is disabled.");
 #endif // ENABLE_ZSTD_COMPRESSION
@@ -103,5 +342,984 @@ std::string GetCompressionTypeName(CompressionType type)
     return "";
 }
 
+const char* GetApiCallName(ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case ApiCall_vkCreateInstance:
+            return "vkCreateInstance";
+        case ApiCall_vkDestroyInstance:
+            return "vkDestroyInstance";
+        case ApiCall_vkEnumeratePhysicalDevices:
+            return "vkEnumeratePhysicalDevices";
+        case ApiCall_vkGetPhysicalDeviceFeatures:
+            return "vkGetPhysicalDeviceFeatures";
+        case ApiCall_vkGetPhysicalDeviceFormatProperties:
+            return "vkGetPhysicalDeviceFormatProperties";
+        case ApiCall_vkGetPhysicalDeviceImageFormatProperties:
+            return "vkGetPhysicalDeviceImageFormatProperties";
+        case ApiCall_vkGetPhysicalDeviceProperties:
+            return "vkGetPhysicalDeviceProperties";
+        case ApiCall_vkGetPhysicalDeviceQueueFamilyProperties:
+            return "vkGetPhysicalDeviceQueueFamilyProperties";
+        case ApiCall_vkGetPhysicalDeviceMemoryProperties:
+            return "vkGetPhysicalDeviceMemoryProperties";
+        case ApiCall_vkGetInstanceProcAddr:
+            return "vkGetInstanceProcAddr";
+        case ApiCall_vkGetDeviceProcAddr:
+            return "vkGetDeviceProcAddr";
+        case ApiCall_vkCreateDevice:
+            return "vkCreateDevice";
+        case ApiCall_vkDestroyDevice:
+            return "vkDestroyDevice";
+        case ApiCall_vkEnumerateInstanceExtensionProperties:
+            return "vkEnumerateInstanceExtensionProperties";
+        case ApiCall_vkEnumerateDeviceExtensionProperties:
+            return "vkEnumerateDeviceExtensionProperties";
+        case ApiCall_vkEnumerateInstanceLayerProperties:
+            return "vkEnumerateInstanceLayerProperties";
+        case ApiCall_vkEnumerateDeviceLayerProperties:
+            return "vkEnumerateDeviceLayerProperties";
+        case ApiCall_vkGetDeviceQueue:
+            return "vkGetDeviceQueue";
+        case ApiCall_vkQueueSubmit:
+            return "vkQueueSubmit";
+        case ApiCall_vkQueueWaitIdle:
+            return "vkQueueWaitIdle";
+        case ApiCall_vkDeviceWaitIdle:
+            return "vkDeviceWaitIdle";
+        case ApiCall_vkAllocateMemory:
+            return "vkAllocateMemory";
+        case ApiCall_vkFreeMemory:
+            return "vkFreeMemory";
+        case ApiCall_vkMapMemory:
+            return "vkMapMemory";
+        case ApiCall_vkUnmapMemory:
+            return "vkUnmapMemory";
+        case ApiCall_vkFlushMappedMemoryRanges:
+            return "vkFlushMappedMemoryRanges";
+        case ApiCall_vkInvalidateMappedMemoryRanges:
+            return "vkInvalidateMappedMemoryRanges";
+        case ApiCall_vkGetDeviceMemoryCommitment:
+            return "vkGetDeviceMemoryCommitment";
+        case ApiCall_vkBindBufferMemory:
+            return "vkBindBufferMemory";
+        case ApiCall_vkBindImageMemory:
+            return "vkBindImageMemory";
+        case ApiCall_vkGetBufferMemoryRequirements:
+            return "vkGetBufferMemoryRequirements";
+        case ApiCall_vkGetImageMemoryRequirements:
+            return "vkGetImageMemoryRequirements";
+        case ApiCall_vkGetImageSparseMemoryRequirements:
+            return "vkGetImageSparseMemoryRequirements";
+        case ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties";
+        case ApiCall_vkQueueBindSparse:
+            return "vkQueueBindSparse";
+        case ApiCall_vkCreateFence:
+            return "vkCreateFence";
+        case ApiCall_vkDestroyFence:
+            return "vkDestroyFence";
+        case ApiCall_vkResetFences:
+            return "vkResetFences";
+        case ApiCall_vkGetFenceStatus:
+            return "vkGetFenceStatus";
+        case ApiCall_vkWaitForFences:
+            return "vkWaitForFences";
+        case ApiCall_vkCreateSemaphore:
+            return "vkCreateSemaphore";
+        case ApiCall_vkDestroySemaphore:
+            return "vkDestroySemaphore";
+        case ApiCall_vkCreateEvent:
+            return "vkCreateEvent";
+        case ApiCall_vkDestroyEvent:
+            return "vkDestroyEvent";
+        case ApiCall_vkGetEventStatus:
+            return "vkGetEventStatus";
+        case ApiCall_vkSetEvent:
+            return "vkSetEvent";
+        case ApiCall_vkResetEvent:
+            return "vkResetEvent";
+        case ApiCall_vkCreateQueryPool:
+            return "vkCreateQueryPool";
+        case ApiCall_vkDestroyQueryPool:
+            return "vkDestroyQueryPool";
+        case ApiCall_vkGetQueryPoolResults:
+            return "vkGetQueryPoolResults";
+        case ApiCall_vkCreateBuffer:
+            return "vkCreateBuffer";
+        case ApiCall_vkDestroyBuffer:
+            return "vkDestroyBuffer";
+        case ApiCall_vkCreateBufferView:
+            return "vkCreateBufferView";
+        case ApiCall_vkDestroyBufferView:
+            return "vkDestroyBufferView";
+        case ApiCall_vkCreateImage:
+            return "vkCreateImage";
+        case ApiCall_vkDestroyImage:
+            return "vkDestroyImage";
+        case ApiCall_vkGetImageSubresourceLayout:
+            return "vkGetImageSubresourceLayout";
+        case ApiCall_vkCreateImageView:
+            return "vkCreateImageView";
+        case ApiCall_vkDestroyImageView:
+            return "vkDestroyImageView";
+        case ApiCall_vkCreateShaderModule:
+            return "vkCreateShaderModule";
+        case ApiCall_vkDestroyShaderModule:
+            return "vkDestroyShaderModule";
+        case ApiCall_vkCreatePipelineCache:
+            return "vkCreatePipelineCache";
+        case ApiCall_vkDestroyPipelineCache:
+            return "vkDestroyPipelineCache";
+        case ApiCall_vkGetPipelineCacheData:
+            return "vkGetPipelineCacheData";
+        case ApiCall_vkMergePipelineCaches:
+            return "vkMergePipelineCaches";
+        case ApiCall_vkCreateGraphicsPipelines:
+            return "vkCreateGraphicsPipelines";
+        case ApiCall_vkCreateComputePipelines:
+            return "vkCreateComputePipelines";
+        case ApiCall_vkDestroyPipeline:
+            return "vkDestroyPipeline";
+        case ApiCall_vkCreatePipelineLayout:
+            return "vkCreatePipelineLayout";
+        case ApiCall_vkDestroyPipelineLayout:
+            return "vkDestroyPipelineLayout";
+        case ApiCall_vkCreateSampler:
+            return "vkCreateSampler";
+        case ApiCall_vkDestroySampler:
+            return "vkDestroySampler";
+        case ApiCall_vkCreateDescriptorSetLayout:
+            return "vkCreateDescriptorSetLayout";
+        case ApiCall_vkDestroyDescriptorSetLayout:
+            return "vkDestroyDescriptorSetLayout";
+        case ApiCall_vkCreateDescriptorPool:
+            return "vkCreateDescriptorPool";
+        case ApiCall_vkDestroyDescriptorPool:
+            return "vkDestroyDescriptorPool";
+        case ApiCall_vkResetDescriptorPool:
+            return "vkResetDescriptorPool";
+        case ApiCall_vkAllocateDescriptorSets:
+            return "vkAllocateDescriptorSets";
+        case ApiCall_vkFreeDescriptorSets:
+            return "vkFreeDescriptorSets";
+        case ApiCall_vkUpdateDescriptorSets:
+            return "vkUpdateDescriptorSets";
+        case ApiCall_vkCreateFramebuffer:
+            return "vkCreateFramebuffer";
+        case ApiCall_vkDestroyFramebuffer:
+            return "vkDestroyFramebuffer";
+        case ApiCall_vkCreateRenderPass:
+            return "vkCreateRenderPass";
+        case ApiCall_vkDestroyRenderPass:
+            return "vkDestroyRenderPass";
+        case ApiCall_vkGetRenderAreaGranularity:
+            return "vkGetRenderAreaGranularity";
+        case ApiCall_vkCreateCommandPool:
+            return "vkCreateCommandPool";
+        case ApiCall_vkDestroyCommandPool:
+            return "vkDestroyCommandPool";
+        case ApiCall_vkResetCommandPool:
+            return "vkResetCommandPool";
+        case ApiCall_vkAllocateCommandBuffers:
+            return "vkAllocateCommandBuffers";
+        case ApiCall_vkFreeCommandBuffers:
+            return "vkFreeCommandBuffers";
+        case ApiCall_vkBeginCommandBuffer:
+            return "vkBeginCommandBuffer";
+        case ApiCall_vkEndCommandBuffer:
+            return "vkEndCommandBuffer";
+        case ApiCall_vkResetCommandBuffer:
+            return "vkResetCommandBuffer";
+        case ApiCall_vkCmdBindPipeline:
+            return "vkCmdBindPipeline";
+        case ApiCall_vkCmdSetViewport:
+            return "vkCmdSetViewport";
+        case ApiCall_vkCmdSetScissor:
+            return "vkCmdSetScissor";
+        case ApiCall_vkCmdSetLineWidth:
+            return "vkCmdSetLineWidth";
+        case ApiCall_vkCmdSetDepthBias:
+            return "vkCmdSetDepthBias";
+        case ApiCall_vkCmdSetBlendConstants:
+            return "vkCmdSetBlendConstants";
+        case ApiCall_vkCmdSetDepthBounds:
+            return "vkCmdSetDepthBounds";
+        case ApiCall_vkCmdSetStencilCompareMask:
+            return "vkCmdSetStencilCompareMask";
+        case ApiCall_vkCmdSetStencilWriteMask:
+            return "vkCmdSetStencilWriteMask";
+        case ApiCall_vkCmdSetStencilReference:
+            return "vkCmdSetStencilReference";
+        case ApiCall_vkCmdBindDescriptorSets:
+            return "vkCmdBindDescriptorSets";
+        case ApiCall_vkCmdBindIndexBuffer:
+            return "vkCmdBindIndexBuffer";
+        case ApiCall_vkCmdBindVertexBuffers:
+            return "vkCmdBindVertexBuffers";
+        case ApiCall_vkCmdDraw:
+            return "vkCmdDraw";
+        case ApiCall_vkCmdDrawIndexed:
+            return "vkCmdDrawIndexed";
+        case ApiCall_vkCmdDrawIndirect:
+            return "vkCmdDrawIndirect";
+        case ApiCall_vkCmdDrawIndexedIndirect:
+            return "vkCmdDrawIndexedIndirect";
+        case ApiCall_vkCmdDispatch:
+            return "vkCmdDispatch";
+        case ApiCall_vkCmdDispatchIndirect:
+            return "vkCmdDispatchIndirect";
+        case ApiCall_vkCmdCopyBuffer:
+            return "vkCmdCopyBuffer";
+        case ApiCall_vkCmdCopyImage:
+            return "vkCmdCopyImage";
+        case ApiCall_vkCmdBlitImage:
+            return "vkCmdBlitImage";
+        case ApiCall_vkCmdCopyBufferToImage:
+            return "vkCmdCopyBufferToImage";
+        case ApiCall_vkCmdCopyImageToBuffer:
+            return "vkCmdCopyImageToBuffer";
+        case ApiCall_vkCmdUpdateBuffer:
+            return "vkCmdUpdateBuffer";
+        case ApiCall_vkCmdFillBuffer:
+            return "vkCmdFillBuffer";
+        case ApiCall_vkCmdClearColorImage:
+            return "vkCmdClearColorImage";
+        case ApiCall_vkCmdClearDepthStencilImage:
+            return "vkCmdClearDepthStencilImage";
+        case ApiCall_vkCmdClearAttachments:
+            return "vkCmdClearAttachments";
+        case ApiCall_vkCmdResolveImage:
+            return "vkCmdResolveImage";
+        case ApiCall_vkCmdSetEvent:
+            return "vkCmdSetEvent";
+        case ApiCall_vkCmdResetEvent:
+            return "vkCmdResetEvent";
+        case ApiCall_vkCmdWaitEvents:
+            return "vkCmdWaitEvents";
+        case ApiCall_vkCmdPipelineBarrier:
+            return "vkCmdPipelineBarrier";
+        case ApiCall_vkCmdBeginQuery:
+            return "vkCmdBeginQuery";
+        case ApiCall_vkCmdEndQuery:
+            return "vkCmdEndQuery";
+        case ApiCall_vkCmdResetQueryPool:
+            return "vkCmdResetQueryPool";
+        case ApiCall_vkCmdWriteTimestamp:
+            return "vkCmdWriteTimestamp";
+        case ApiCall_vkCmdCopyQueryPoolResults:
+            return "vkCmdCopyQueryPoolResults";
+        case ApiCall_vkCmdPushConstants:
+            return "vkCmdPushConstants";
+        case ApiCall_vkCmdBeginRenderPass:
+            return "vkCmdBeginRenderPass";
+        case ApiCall_vkCmdNextSubpass:
+            return "vkCmdNextSubpass";
+        case ApiCall_vkCmdEndRenderPass:
+            return "vkCmdEndRenderPass";
+        case ApiCall_vkCmdExecuteCommands:
+            return "vkCmdExecuteCommands";
+        case ApiCall_vkEnumerateInstanceVersion:
+            return "vkEnumerateInstanceVersion";
+        case ApiCall_vkBindBufferMemory2:
+            return "vkBindBufferMemory2";
+        case ApiCall_vkBindImageMemory2:
+            return "vkBindImageMemory2";
+        case ApiCall_vkGetDeviceGroupPeerMemoryFeatures:
+            return "vkGetDeviceGroupPeerMemoryFeatures";
+        case ApiCall_vkCmdSetDeviceMask:
+            return "vkCmdSetDeviceMask";
+        case ApiCall_vkCmdDispatchBase:
+            return "vkCmdDispatchBase";
+        case ApiCall_vkEnumeratePhysicalDeviceGroups:
+            return "vkEnumeratePhysicalDeviceGroups";
+        case ApiCall_vkGetImageMemoryRequirements2:
+            return "vkGetImageMemoryRequirements2";
+        case ApiCall_vkGetBufferMemoryRequirements2:
+            return "vkGetBufferMemoryRequirements2";
+        case ApiCall_vkGetImageSparseMemoryRequirements2:
+            return "vkGetImageSparseMemoryRequirements2";
+        case ApiCall_vkGetPhysicalDeviceFeatures2:
+            return "vkGetPhysicalDeviceFeatures2";
+        case ApiCall_vkGetPhysicalDeviceProperties2:
+            return "vkGetPhysicalDeviceProperties2";
+        case ApiCall_vkGetPhysicalDeviceFormatProperties2:
+            return "vkGetPhysicalDeviceFormatProperties2";
+        case ApiCall_vkGetPhysicalDeviceImageFormatProperties2:
+            return "vkGetPhysicalDeviceImageFormatProperties2";
+        case ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2:
+            return "vkGetPhysicalDeviceQueueFamilyProperties2";
+        case ApiCall_vkGetPhysicalDeviceMemoryProperties2:
+            return "vkGetPhysicalDeviceMemoryProperties2";
+        case ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties2";
+        case ApiCall_vkTrimCommandPool:
+            return "vkTrimCommandPool";
+        case ApiCall_vkGetDeviceQueue2:
+            return "vkGetDeviceQueue2";
+        case ApiCall_vkCreateSamplerYcbcrConversion:
+            return "vkCreateSamplerYcbcrConversion";
+        case ApiCall_vkDestroySamplerYcbcrConversion:
+            return "vkDestroySamplerYcbcrConversion";
+        case ApiCall_vkCreateDescriptorUpdateTemplate:
+            return "vkCreateDescriptorUpdateTemplate";
+        case ApiCall_vkDestroyDescriptorUpdateTemplate:
+            return "vkDestroyDescriptorUpdateTemplate";
+        case ApiCall_vkUpdateDescriptorSetWithTemplate:
+            return "vkUpdateDescriptorSetWithTemplate";
+        case ApiCall_vkGetPhysicalDeviceExternalBufferProperties:
+            return "vkGetPhysicalDeviceExternalBufferProperties";
+        case ApiCall_vkGetPhysicalDeviceExternalFenceProperties:
+            return "vkGetPhysicalDeviceExternalFenceProperties";
+        case ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties:
+            return "vkGetPhysicalDeviceExternalSemaphoreProperties";
+        case ApiCall_vkGetDescriptorSetLayoutSupport:
+            return "vkGetDescriptorSetLayoutSupport";
+        case ApiCall_vkDestroySurfaceKHR:
+            return "vkDestroySurfaceKHR";
+        case ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR:
+            return "vkGetPhysicalDeviceSurfaceSupportKHR";
+        case ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR:
+            return "vkGetPhysicalDeviceSurfaceCapabilitiesKHR";
+        case ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR:
+            return "vkGetPhysicalDeviceSurfaceFormatsKHR";
+        case ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR:
+            return "vkGetPhysicalDeviceSurfacePresentModesKHR";
+        case ApiCall_vkCreateSwapchainKHR:
+            return "vkCreateSwapchainKHR";
+        case ApiCall_vkDestroySwapchainKHR:
+            return "vkDestroySwapchainKHR";
+        case ApiCall_vkGetSwapchainImagesKHR:
+            return "vkGetSwapchainImagesKHR";
+        case ApiCall_vkAcquireNextImageKHR:
+            return "vkAcquireNextImageKHR";
+        case ApiCall_vkQueuePresentKHR:
+            return "vkQueuePresentKHR";
+        case ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR:
+            return "vkGetDeviceGroupPresentCapabilitiesKHR";
+        case ApiCall_vkGetDeviceGroupSurfacePresentModesKHR:
+            return "vkGetDeviceGroupSurfacePresentModesKHR";
+        case ApiCall_vkGetPhysicalDevicePresentRectanglesKHR:
+            return "vkGetPhysicalDevicePresentRectanglesKHR";
+        case ApiCall_vkAcquireNextImage2KHR:
+            return "vkAcquireNextImage2KHR";
+        case ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR:
+            return "vkGetPhysicalDeviceDisplayPropertiesKHR";
+        case ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR:
+            return "vkGetPhysicalDeviceDisplayPlanePropertiesKHR";
+        case ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR:
+            return "vkGetDisplayPlaneSupportedDisplaysKHR";
+        case ApiCall_vkGetDisplayModePropertiesKHR:
+            return "vkGetDisplayModePropertiesKHR";
+        case ApiCall_vkCreateDisplayModeKHR:
+            return "vkCreateDisplayModeKHR";
+        case ApiCall_vkGetDisplayPlaneCapabilitiesKHR:
+            return "vkGetDisplayPlaneCapabilitiesKHR";
+        case ApiCall_vkCreateDisplayPlaneSurfaceKHR:
+            return "vkCreateDisplayPlaneSurfaceKHR";
+        case ApiCall_vkCreateSharedSwapchainsKHR:
+            return "vkCreateSharedSwapchainsKHR";
+        case ApiCall_vkCreateXlibSurfaceKHR:
+            return "vkCreateXlibSurfaceKHR";
+        case ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR:
+            return "vkGetPhysicalDeviceXlibPresentationSupportKHR";
+        case ApiCall_vkCreateXcbSurfaceKHR:
+            return "vkCreateXcbSurfaceKHR";
+        case ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR:
+            return "vkGetPhysicalDeviceXcbPresentationSupportKHR";
+        case ApiCall_vkCreateWaylandSurfaceKHR:
+            return "vkCreateWaylandSurfaceKHR";
+        case ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR:
+            return "vkGetPhysicalDeviceWaylandPresentationSupportKHR";
+        case ApiCall_vkCreateMirSurfaceKHR:
+            return "vkCreateMirSurfaceKHR";
+        case ApiCall_vkGetPhysicalDeviceMirPresentationSupportKHR:
+            return "vkGetPhysicalDeviceMirPresentationSupportKHR";
+        case ApiCall_vkCreateAndroidSurfaceKHR:
+            return "vkCreateAndroidSurfaceKHR";
+        case ApiCall_vkCreateWin32SurfaceKHR:
+            return "vkCreateWin32SurfaceKHR";
+        case ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR:
+            return "vkGetPhysicalDeviceWin32PresentationSupportKHR";
+        case ApiCall_vkGetPhysicalDeviceFeatures2KHR:
+            return "vkGetPhysicalDeviceFeatures2KHR";
+        case ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            return "vkGetPhysicalDeviceProperties2KHR";
+        case ApiCall_vkGetPhysicalDeviceFormatProperties2KHR:
+            return "vkGetPhysicalDeviceFormatProperties2KHR";
+        case ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR:
+            return "vkGetPhysicalDeviceImageFormatProperties2KHR";
+        case ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
+            return "vkGetPhysicalDeviceQueueFamilyProperties2KHR";
+        case ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
+            return "vkGetPhysicalDeviceMemoryProperties2KHR";
+        case ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties2KHR";
+        case ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR:
+            return "vkGetDeviceGroupPeerMemoryFeaturesKHR";
+        case ApiCall_vkCmdSetDeviceMaskKHR:
+            return "vkCmdSetDeviceMaskKHR";
+        case ApiCall_vkCmdDispatchBaseKHR:
+            return "vkCmdDispatchBaseKHR";
+        case ApiCall_vkTrimCommandPoolKHR:
+            return "vkTrimCommandPoolKHR";
+        case ApiCall_vkEnumeratePhysicalDeviceGroupsKHR:
+            return "vkEnumeratePhysicalDeviceGroupsKHR";
+        case ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR:
+            return "vkGetPhysicalDeviceExternalBufferPropertiesKHR";
+        case ApiCall_vkGetMemoryWin32HandleKHR:
+            return "vkGetMemoryWin32HandleKHR";
+        case ApiCall_vkGetMemoryWin32HandlePropertiesKHR:
+            return "vkGetMemoryWin32HandlePropertiesKHR";
+        case ApiCall_vkGetMemoryFdKHR:
+            return "vkGetMemoryFdKHR";
+        case ApiCall_vkGetMemoryFdPropertiesKHR:
+            return "vkGetMemoryFdPropertiesKHR";
+        case ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR:
+            return "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR";
+        case ApiCall_vkImportSemaphoreWin32HandleKHR:
+            return "vkImportSemaphoreWin32HandleKHR";
+        case ApiCall_vkGetSemaphoreWin32HandleKHR:
+            return "vkGetSemaphoreWin32HandleKHR";
+        case ApiCall_vkImportSemaphoreFdKHR:
+            return "vkImportSemaphoreFdKHR";
+        case ApiCall_vkGetSemaphoreFdKHR:
+            return "vkGetSemaphoreFdKHR";
+        case ApiCall_vkCmdPushDescriptorSetKHR:
+            return "vkCmdPushDescriptorSetKHR";
+        case ApiCall_vkCmdPushDescriptorSetWithTemplateKHR:
+            return "vkCmdPushDescriptorSetWithTemplateKHR";
+        case ApiCall_vkCreateDescriptorUpdateTemplateKHR:
+            return "vkCreateDescriptorUpdateTemplateKHR";
+        case ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
+            return "vkDestroyDescriptorUpdateTemplateKHR";
+        case ApiCall_vkUpdateDescriptorSetWithTemplateKHR:
+            return "vkUpdateDescriptorSetWithTemplateKHR";
+        case ApiCall_vkCreateRenderPass2KHR:
+            return "vkCreateRenderPass2KHR";
+        case ApiCall_vkCmdBeginRenderPass2KHR:
+            return "vkCmdBeginRenderPass2KHR";
+        case ApiCall_vkCmdNextSubpass2KHR:
+            return "vkCmdNextSubpass2KHR";
+        case ApiCall_vkCmdEndRenderPass2KHR:
+            return "vkCmdEndRenderPass2KHR";
+        case ApiCall_vkGetSwapchainStatusKHR:
+            return "vkGetSwapchainStatusKHR";
+        case ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR:
+            return "vkGetPhysicalDeviceExternalFencePropertiesKHR";
+        case ApiCall_vkImportFenceWin32HandleKHR:
+            return "vkImportFenceWin32HandleKHR";
+        case ApiCall_vkGetFenceWin32HandleKHR:
+            return "vkGetFenceWin32HandleKHR";
+        case ApiCall_vkImportFenceFdKHR:
+            return "vkImportFenceFdKHR";
+        case ApiCall_vkGetFenceFdKHR:
+            return "vkGetFenceFdKHR";
+        case ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR:
+            return "vkGetPhysicalDeviceSurfaceCapabilities2KHR";
+        case ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR:
+            return "vkGetPhysicalDeviceSurfaceFormats2KHR";
+        case ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR:
+            return "vkGetPhysicalDeviceDisplayProperties2KHR";
+        case ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR:
+            return "vkGetPhysicalDeviceDisplayPlaneProperties2KHR";
+        case ApiCall_vkGetDisplayModeProperties2KHR:
+            return "vkGetDisplayModeProperties2KHR";
+        case ApiCall_vkGetDisplayPlaneCapabilities2KHR:
+            return "vkGetDisplayPlaneCapabilities2KHR";
+        case ApiCall_vkGetImageMemoryRequirements2KHR:
+            return "vkGetImageMemoryRequirements2KHR";
+        case ApiCall_vkGetBufferMemoryRequirements2KHR:
+            return "vkGetBufferMemoryRequirements2KHR";
+        case ApiCall_vkGetImageSparseMemoryRequirements2KHR:
+            return "vkGetImageSparseMemoryRequirements2KHR";
+        case ApiCall_vkCreateSamplerYcbcrConversionKHR:
+            return "vkCreateSamplerYcbcrConversionKHR";
+        case ApiCall_vkDestroySamplerYcbcrConversionKHR:
+            return "vkDestroySamplerYcbcrConversionKHR";
+        case ApiCall_vkBindBufferMemory2KHR:
+            return "vkBindBufferMemory2KHR";
+        case ApiCall_vkBindImageMemory2KHR:
+            return "vkBindImageMemory2KHR";
+        case ApiCall_vkGetDescriptorSetLayoutSupportKHR:
+            return "vkGetDescriptorSetLayoutSupportKHR";
+        case ApiCall_vkCmdDrawIndirectCountKHR:
+            return "vkCmdDrawIndirectCountKHR";
+        case ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+            return "vkCmdDrawIndexedIndirectCountKHR";
+        case ApiCall_vkCreateDebugReportCallbackEXT:
+            return "vkCreateDebugReportCallbackEXT";
+        case ApiCall_vkDestroyDebugReportCallbackEXT:
+            return "vkDestroyDebugReportCallbackEXT";
+        case ApiCall_vkDebugReportMessageEXT:
+            return "vkDebugReportMessageEXT";
+        case ApiCall_vkDebugMarkerSetObjectTagEXT:
+            return "vkDebugMarkerSetObjectTagEXT";
+        case ApiCall_vkDebugMarkerSetObjectNameEXT:
+            return "vkDebugMarkerSetObjectNameEXT";
+        case ApiCall_vkCmdDebugMarkerBeginEXT:
+            return "vkCmdDebugMarkerBeginEXT";
+        case ApiCall_vkCmdDebugMarkerEndEXT:
+            return "vkCmdDebugMarkerEndEXT";
+        case ApiCall_vkCmdDebugMarkerInsertEXT:
+            return "vkCmdDebugMarkerInsertEXT";
+        case ApiCall_vkCmdDrawIndirectCountAMD:
+            return "vkCmdDrawIndirectCountAMD";
+        case ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+            return "vkCmdDrawIndexedIndirectCountAMD";
+        case ApiCall_vkGetShaderInfoAMD:
+            return "vkGetShaderInfoAMD";
+        case ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV:
+            return "vkGetPhysicalDeviceExternalImageFormatPropertiesNV";
+        case ApiCall_vkGetMemoryWin32HandleNV:
+            return "vkGetMemoryWin32HandleNV";
+        case ApiCall_vkCreateViSurfaceNN:
+            return "vkCreateViSurfaceNN";
+        case ApiCall_vkCmdBeginConditionalRenderingEXT:
+            return "vkCmdBeginConditionalRenderingEXT";
+        case ApiCall_vkCmdEndConditionalRenderingEXT:
+            return "vkCmdEndConditionalRenderingEXT";
+        case ApiCall_vkCmdProcessCommandsNVX:
+            return "vkCmdProcessCommandsNVX";
+        case ApiCall_vkCmdReserveSpaceForCommandsNVX:
+            return "vkCmdReserveSpaceForCommandsNVX";
+        case ApiCall_vkCreateIndirectCommandsLayoutNVX:
+            return "vkCreateIndirectCommandsLayoutNVX";
+        case ApiCall_vkDestroyIndirectCommandsLayoutNVX:
+            return "vkDestroyIndirectCommandsLayoutNVX";
+        case ApiCall_vkCreateObjectTableNVX:
+            return "vkCreateObjectTableNVX";
+        case ApiCall_vkDestroyObjectTableNVX:
+            return "vkDestroyObjectTableNVX";
+        case ApiCall_vkRegisterObjectsNVX:
+            return "vkRegisterObjectsNVX";
+        case ApiCall_vkUnregisterObjectsNVX:
+            return "vkUnregisterObjectsNVX";
+        case ApiCall_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX:
+            return "vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX";
+        case ApiCall_vkCmdSetViewportWScalingNV:
+            return "vkCmdSetViewportWScalingNV";
+        case ApiCall_vkReleaseDisplayEXT:
+            return "vkReleaseDisplayEXT";
+        case ApiCall_vkAcquireXlibDisplayEXT:
+            return "vkAcquireXlibDisplayEXT";
+        case ApiCall_vkGetRandROutputDisplayEXT:
+            return "vkGetRandROutputDisplayEXT";
+        case ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT:
+            return "vkGetPhysicalDeviceSurfaceCapabilities2EXT";
+        case ApiCall_vkDisplayPowerControlEXT:
+            return "vkDisplayPowerControlEXT";
+        case ApiCall_vkRegisterDeviceEventEXT:
+            return "vkRegisterDeviceEventEXT";
+        case ApiCall_vkRegisterDisplayEventEXT:
+            return "vkRegisterDisplayEventEXT";
+        case ApiCall_vkGetSwapchainCounterEXT:
+            return "vkGetSwapchainCounterEXT";
+        case ApiCall_vkGetRefreshCycleDurationGOOGLE:
+            return "vkGetRefreshCycleDurationGOOGLE";
+        case ApiCall_vkGetPastPresentationTimingGOOGLE:
+            return "vkGetPastPresentationTimingGOOGLE";
+        case ApiCall_vkCmdSetDiscardRectangleEXT:
+            return "vkCmdSetDiscardRectangleEXT";
+        case ApiCall_vkSetHdrMetadataEXT:
+            return "vkSetHdrMetadataEXT";
+        case ApiCall_vkCreateIOSSurfaceMVK:
+            return "vkCreateIOSSurfaceMVK";
+        case ApiCall_vkCreateMacOSSurfaceMVK:
+            return "vkCreateMacOSSurfaceMVK";
+        case ApiCall_vkSetDebugUtilsObjectNameEXT:
+            return "vkSetDebugUtilsObjectNameEXT";
+        case ApiCall_vkSetDebugUtilsObjectTagEXT:
+            return "vkSetDebugUtilsObjectTagEXT";
+        case ApiCall_vkQueueBeginDebugUtilsLabelEXT:
+            return "vkQueueBeginDebugUtilsLabelEXT";
+        case ApiCall_vkQueueEndDebugUtilsLabelEXT:
+            return "vkQueueEndDebugUtilsLabelEXT";
+        case ApiCall_vkQueueInsertDebugUtilsLabelEXT:
+            return "vkQueueInsertDebugUtilsLabelEXT";
+        case ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+            return "vkCmdBeginDebugUtilsLabelEXT";
+        case ApiCall_vkCmdEndDebugUtilsLabelEXT:
+            return "vkCmdEndDebugUtilsLabelEXT";
+        case ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+            return "vkCmdInsertDebugUtilsLabelEXT";
+        case ApiCall_vkCreateDebugUtilsMessengerEXT:
+            return "vkCreateDebugUtilsMessengerEXT";
+        case ApiCall_vkDestroyDebugUtilsMessengerEXT:
+            return "vkDestroyDebugUtilsMessengerEXT";
+        case ApiCall_vkSubmitDebugUtilsMessageEXT:
+            return "vkSubmitDebugUtilsMessageEXT";
+        case ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID:
+            return "vkGetAndroidHardwareBufferPropertiesANDROID";
+        case ApiCall_vkGetMemoryAndroidHardwareBufferANDROID:
+            return "vkGetMemoryAndroidHardwareBufferANDROID";
+        case ApiCall_vkCmdSetSampleLocationsEXT:
+            return "vkCmdSetSampleLocationsEXT";
+        case ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT:
+            return "vkGetPhysicalDeviceMultisamplePropertiesEXT";
+        case ApiCall_vkCreateValidationCacheEXT:
+            return "vkCreateValidationCacheEXT";
+        case ApiCall_vkDestroyValidationCacheEXT:
+            return "vkDestroyValidationCacheEXT";
+        case ApiCall_vkMergeValidationCachesEXT:
+            return "vkMergeValidationCachesEXT";
+        case ApiCall_vkGetValidationCacheDataEXT:
+            return "vkGetValidationCacheDataEXT";
+        case ApiCall_vkGetMemoryHostPointerPropertiesEXT:
+            return "vkGetMemoryHostPointerPropertiesEXT";
+        case ApiCall_vkCmdWriteBufferMarkerAMD:
+            return "vkCmdWriteBufferMarkerAMD";
+        case ApiCall_vkCmdBindShadingRateImageNV:
+            return "vkCmdBindShadingRateImageNV";
+        case ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+            return "vkCmdSetViewportShadingRatePaletteNV";
+        case ApiCall_vkCmdSetCoarseSampleOrderNV:
+            return "vkCmdSetCoarseSampleOrderNV";
+        case ApiCall_vkGetImageDrmFormatModifierPropertiesEXT:
+            return "vkGetImageDrmFormatModifierPropertiesEXT";
+        case ApiCall_vkCreateAccelerationStructureNV:
+            return "vkCreateAccelerationStructureNV";
+        case ApiCall_vkDestroyAccelerationStructureNV:
+            return "vkDestroyAccelerationStructureNV";
+        case ApiCall_vkGetAccelerationStructureMemoryRequirementsNV:
+            return "vkGetAccelerationStructureMemoryRequirementsNV";
+        case ApiCall_vkBindAccelerationStructureMemoryNV:
+            return "vkBindAccelerationStructureMemoryNV";
+        case ApiCall_vkCmdBuildAccelerationStructureNV:
+            return "vkCmdBuildAccelerationStructureNV";
+        case ApiCall_vkCmdCopyAccelerationStructureNV:
+            return "vkCmdCopyAccelerationStructureNV";
+        case ApiCall_vkCmdTraceRaysNV:
+            return "vkCmdTraceRaysNV";
+        case ApiCall_vkCreateRayTracingPipelinesNV:
+            return "vkCreateRayTracingPipelinesNV";
+        case ApiCall_vkGetRayTracingShaderGroupHandlesNV:
+            return "vkGetRayTracingShaderGroupHandlesNV";
+        case ApiCall_vkGetAccelerationStructureHandleNV:
+            return "vkGetAccelerationStructureHandleNV";
+        case ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
+            return "vkCmdWriteAccelerationStructuresPropertiesNV";
+        case ApiCall_vkCompileDeferredNV:
+            return "vkCompileDeferredNV";
+        case ApiCall_vkCmdDrawMeshTasksNV:
+            return "vkCmdDrawMeshTasksNV";
+        case ApiCall_vkCmdDrawMeshTasksIndirectNV:
+            return "vkCmdDrawMeshTasksIndirectNV";
+        case ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+            return "vkCmdDrawMeshTasksIndirectCountNV";
+        case ApiCall_vkCmdSetExclusiveScissorNV:
+            return "vkCmdSetExclusiveScissorNV";
+        case ApiCall_vkCmdSetCheckpointNV:
+            return "vkCmdSetCheckpointNV";
+        case ApiCall_vkGetQueueCheckpointDataNV:
+            return "vkGetQueueCheckpointDataNV";
+        case ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
+            return "vkCreateImagePipeSurfaceFUCHSIA";
+        case ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+            return "vkCmdBindTransformFeedbackBuffersEXT";
+        case ApiCall_vkCmdBeginTransformFeedbackEXT:
+            return "vkCmdBeginTransformFeedbackEXT";
+        case ApiCall_vkCmdEndTransformFeedbackEXT:
+            return "vkCmdEndTransformFeedbackEXT";
+        case ApiCall_vkCmdBeginQueryIndexedEXT:
+            return "vkCmdBeginQueryIndexedEXT";
+        case ApiCall_vkCmdEndQueryIndexedEXT:
+            return "vkCmdEndQueryIndexedEXT";
+        case ApiCall_vkCmdDrawIndirectByteCountEXT:
+            return "vkCmdDrawIndirectByteCountEXT";
+        case ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT:
+            return "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT";
+        case ApiCall_vkGetCalibratedTimestampsEXT:
+            return "vkGetCalibratedTimestampsEXT";
+        case ApiCall_vkGetBufferDeviceAddressEXT:
+            return "vkGetBufferDeviceAddressEXT";
+        case ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV:
+            return "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV";
+        case ApiCall_vkGetImageViewHandleNVX:
+            return "vkGetImageViewHandleNVX";
+        case ApiCall_vkCreateMetalSurfaceEXT:
+            return "vkCreateMetalSurfaceEXT";
+        case ApiCall_vkCreateStreamDescriptorSurfaceGGP:
+            return "vkCreateStreamDescriptorSurfaceGGP";
+        case ApiCall_vkSetLocalDimmingAMD:
+            return "vkSetLocalDimmingAMD";
+        case ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV:
+            return "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV";
+        case ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT:
+            return "vkGetPhysicalDeviceSurfacePresentModes2EXT";
+        case ApiCall_vkAcquireFullScreenExclusiveModeEXT:
+            return "vkAcquireFullScreenExclusiveModeEXT";
+        case ApiCall_vkReleaseFullScreenExclusiveModeEXT:
+            return "vkReleaseFullScreenExclusiveModeEXT";
+        case ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT:
+            return "vkGetDeviceGroupSurfacePresentModes2EXT";
+        case ApiCall_vkCreateHeadlessSurfaceEXT:
+            return "vkCreateHeadlessSurfaceEXT";
+        case ApiCall_vkResetQueryPoolEXT:
+            return "vkResetQueryPoolEXT";
+        case ApiCall_vkGetPipelineExecutablePropertiesKHR:
+            return "vkGetPipelineExecutablePropertiesKHR";
+        case ApiCall_vkGetPipelineExecutableStatisticsKHR:
+            return "vkGetPipelineExecutableStatisticsKHR";
+        case ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR:
+            return "vkGetPipelineExecutableInternalRepresentationsKHR";
+        case ApiCall_vkInitializePerformanceApiINTEL:
+            return "vkInitializePerformanceApiINTEL";
+        case ApiCall_vkUninitializePerformanceApiINTEL:
+            return "vkUninitializePerformanceApiINTEL";
+        case ApiCall_vkCmdSetPerformanceMarkerINTEL:
+            return "vkCmdSetPerformanceMarkerINTEL";
+        case ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+            return "vkCmdSetPerformanceStreamMarkerINTEL";
+        case ApiCall_vkCmdSetPerformanceOverrideINTEL:
+            return "vkCmdSetPerformanceOverrideINTEL";
+        case ApiCall_vkAcquirePerformanceConfigurationINTEL:
+            return "vkAcquirePerformanceConfigurationINTEL";
+        case ApiCall_vkReleasePerformanceConfigurationINTEL:
+            return "vkReleasePerformanceConfigurationINTEL";
+        case ApiCall_vkQueueSetPerformanceConfigurationINTEL:
+            return "vkQueueSetPerformanceConfigurationINTEL";
+        case ApiCall_vkGetPerformanceParameterINTEL:
+            return "vkGetPerformanceParameterINTEL";
+        case ApiCall_vkCmdSetLineStippleEXT:
+            return "vkCmdSetLineStippleEXT";
+        case ApiCall_vkGetSemaphoreCounterValueKHR:
+            return "vkGetSemaphoreCounterValueKHR";
+        case ApiCall_vkWaitSemaphoresKHR:
+            return "vkWaitSemaphoresKHR";
+        case ApiCall_vkSignalSemaphoreKHR:
+            return "vkSignalSemaphoreKHR";
+        case ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR:
+            return "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR";
+        case ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR:
+            return "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR";
+        case ApiCall_vkAcquireProfilingLockKHR:
+            return "vkAcquireProfilingLockKHR";
+        case ApiCall_vkReleaseProfilingLockKHR:
+            return "vkReleaseProfilingLockKHR";
+        case ApiCall_vkGetBufferDeviceAddressKHR:
+            return "vkGetBufferDeviceAddressKHR";
+        case ApiCall_vkGetBufferOpaqueCaptureAddressKHR:
+            return "vkGetBufferOpaqueCaptureAddressKHR";
+        case ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR:
+            return "vkGetDeviceMemoryOpaqueCaptureAddressKHR";
+        case ApiCall_vkGetPhysicalDeviceToolPropertiesEXT:
+            return "vkGetPhysicalDeviceToolPropertiesEXT";
+        case ApiCall_vkCmdDrawIndirectCount:
+            return "vkCmdDrawIndirectCount";
+        case ApiCall_vkCmdDrawIndexedIndirectCount:
+            return "vkCmdDrawIndexedIndirectCount";
+        case ApiCall_vkCreateRenderPass2:
+            return "vkCreateRenderPass2";
+        case ApiCall_vkCmdBeginRenderPass2:
+            return "vkCmdBeginRenderPass2";
+        case ApiCall_vkCmdNextSubpass2:
+            return "vkCmdNextSubpass2";
+        case ApiCall_vkCmdEndRenderPass2:
+            return "vkCmdEndRenderPass2";
+        case ApiCall_vkResetQueryPool:
+            return "vkResetQueryPool";
+        case ApiCall_vkGetSemaphoreCounterValue:
+            return "vkGetSemaphoreCounterValue";
+        case ApiCall_vkWaitSemaphores:
+            return "vkWaitSemaphores";
+        case ApiCall_vkSignalSemaphore:
+            return "vkSignalSemaphore";
+        case ApiCall_vkGetBufferDeviceAddress:
+            return "vkGetBufferDeviceAddress";
+        case ApiCall_vkGetBufferOpaqueCaptureAddress:
+            return "vkGetBufferOpaqueCaptureAddress";
+        case ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress:
+            return "vkGetDeviceMemoryOpaqueCaptureAddress";
+        case ApiCall_vkCreateDeferredOperationKHR:
+            return "vkCreateDeferredOperationKHR";
+        case ApiCall_vkDestroyDeferredOperationKHR:
+            return "vkDestroyDeferredOperationKHR";
+        case ApiCall_vkGetDeferredOperationMaxConcurrencyKHR:
+            return "vkGetDeferredOperationMaxConcurrencyKHR";
+        case ApiCall_vkGetDeferredOperationResultKHR:
+            return "vkGetDeferredOperationResultKHR";
+        case ApiCall_vkDeferredOperationJoinKHR:
+            return "vkDeferredOperationJoinKHR";
+        case ApiCall_vkCreateAccelerationStructureKHR:
+            return "vkCreateAccelerationStructureKHR";
+        case ApiCall_vkDestroyAccelerationStructureKHR:
+            return "vkDestroyAccelerationStructureKHR";
+        case ApiCall_vkGetAccelerationStructureMemoryRequirementsKHR:
+            return "vkGetAccelerationStructureMemoryRequirementsKHR";
+        case ApiCall_vkBindAccelerationStructureMemoryKHR:
+            return "vkBindAccelerationStructureMemoryKHR";
+        case ApiCall_vkCmdBuildAccelerationStructuresKHR:
+            return "vkCmdBuildAccelerationStructuresKHR";
+        case ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR:
+            return "vkCmdBuildAccelerationStructuresIndirectKHR";
+        case ApiCall_vkBuildAccelerationStructuresKHR:
+            return "vkBuildAccelerationStructuresKHR";
+        case ApiCall_vkCopyAccelerationStructureKHR:
+            return "vkCopyAccelerationStructureKHR";
+        case ApiCall_vkCopyAccelerationStructureToMemoryKHR:
+            return "vkCopyAccelerationStructureToMemoryKHR";
+        case ApiCall_vkCopyMemoryToAccelerationStructureKHR:
+            return "vkCopyMemoryToAccelerationStructureKHR";
+        case ApiCall_vkWriteAccelerationStructuresPropertiesKHR:
+            return "vkWriteAccelerationStructuresPropertiesKHR";
+        case ApiCall_vkCmdCopyAccelerationStructureKHR:
+            return "vkCmdCopyAccelerationStructureKHR";
+        case ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
+            return "vkCmdCopyAccelerationStructureToMemoryKHR";
+        case ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
+            return "vkCmdCopyMemoryToAccelerationStructureKHR";
+        case ApiCall_vkCmdTraceRaysKHR:
+            return "vkCmdTraceRaysKHR";
+        case ApiCall_vkCreateRayTracingPipelinesKHR:
+            return "vkCreateRayTracingPipelinesKHR";
+        case ApiCall_vkGetRayTracingShaderGroupHandlesKHR:
+            return "vkGetRayTracingShaderGroupHandlesKHR";
+        case ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
+            return "vkCmdWriteAccelerationStructuresPropertiesKHR";
+        case ApiCall_vkGetAccelerationStructureDeviceAddressKHR:
+            return "vkGetAccelerationStructureDeviceAddressKHR";
+        case ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR:
+            return "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR";
+        case ApiCall_vkCmdTraceRaysIndirectKHR:
+            return "vkCmdTraceRaysIndirectKHR";
+        case ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR:
+            return "vkGetDeviceAccelerationStructureCompatibilityKHR";
+        case ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV:
+            return "vkGetGeneratedCommandsMemoryRequirementsNV";
+        case ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+            return "vkCmdPreprocessGeneratedCommandsNV";
+        case ApiCall_vkCmdExecuteGeneratedCommandsNV:
+            return "vkCmdExecuteGeneratedCommandsNV";
+        case ApiCall_vkCmdBindPipelineShaderGroupNV:
+            return "vkCmdBindPipelineShaderGroupNV";
+        case ApiCall_vkCreateIndirectCommandsLayoutNV:
+            return "vkCreateIndirectCommandsLayoutNV";
+        case ApiCall_vkDestroyIndirectCommandsLayoutNV:
+            return "vkDestroyIndirectCommandsLayoutNV";
+        case ApiCall_vkGetImageViewAddressNVX:
+            return "vkGetImageViewAddressNVX";
+        case ApiCall_vkCreatePrivateDataSlotEXT:
+            return "vkCreatePrivateDataSlotEXT";
+        case ApiCall_vkDestroyPrivateDataSlotEXT:
+            return "vkDestroyPrivateDataSlotEXT";
+        case ApiCall_vkSetPrivateDataEXT:
+            return "vkSetPrivateDataEXT";
+        case ApiCall_vkGetPrivateDataEXT:
+            return "vkGetPrivateDataEXT";
+        case ApiCall_vkCmdSetCullModeEXT:
+            return "vkCmdSetCullModeEXT";
+        case ApiCall_vkCmdSetFrontFaceEXT:
+            return "vkCmdSetFrontFaceEXT";
+        case ApiCall_vkCmdSetPrimitiveTopologyEXT:
+            return "vkCmdSetPrimitiveTopologyEXT";
+        case ApiCall_vkCmdSetViewportWithCountEXT:
+            return "vkCmdSetViewportWithCountEXT";
+        case ApiCall_vkCmdSetScissorWithCountEXT:
+            return "vkCmdSetScissorWithCountEXT";
+        case ApiCall_vkCmdBindVertexBuffers2EXT:
+            return "vkCmdBindVertexBuffers2EXT";
+        case ApiCall_vkCmdSetDepthTestEnableEXT:
+            return "vkCmdSetDepthTestEnableEXT";
+        case ApiCall_vkCmdSetDepthWriteEnableEXT:
+            return "vkCmdSetDepthWriteEnableEXT";
+        case ApiCall_vkCmdSetDepthCompareOpEXT:
+            return "vkCmdSetDepthCompareOpEXT";
+        case ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+            return "vkCmdSetDepthBoundsTestEnableEXT";
+        case ApiCall_vkCmdSetStencilTestEnableEXT:
+            return "vkCmdSetStencilTestEnableEXT";
+        case ApiCall_vkCmdSetStencilOpEXT:
+            return "vkCmdSetStencilOpEXT";
+        case ApiCall_vkCreateDirectFBSurfaceEXT:
+            return "vkCreateDirectFBSurfaceEXT";
+        case ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT:
+            return "vkGetPhysicalDeviceDirectFBPresentationSupportEXT";
+        case ApiCall_vkCmdCopyBuffer2KHR:
+            return "vkCmdCopyBuffer2KHR";
+        case ApiCall_vkCmdCopyImage2KHR:
+            return "vkCmdCopyImage2KHR";
+        case ApiCall_vkCmdCopyBufferToImage2KHR:
+            return "vkCmdCopyBufferToImage2KHR";
+        case ApiCall_vkCmdCopyImageToBuffer2KHR:
+            return "vkCmdCopyImageToBuffer2KHR";
+        case ApiCall_vkCmdBlitImage2KHR:
+            return "vkCmdBlitImage2KHR";
+        case ApiCall_vkCmdResolveImage2KHR:
+            return "vkCmdResolveImage2KHR";
+        case ApiCall_vkGetAccelerationStructureBuildSizesKHR:
+            return "vkGetAccelerationStructureBuildSizesKHR";
+        case ApiCall_vkGetRayTracingShaderGroupStackSizeKHR:
+            return "vkGetRayTracingShaderGroupStackSizeKHR";
+        case ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR:
+            return "vkCmdSetRayTracingPipelineStackSizeKHR";
+        case ApiCall_vkGetPhysicalDeviceFragmentShadingRatesKHR:
+            return "vkGetPhysicalDeviceFragmentShadingRatesKHR";
+        case ApiCall_vkCmdSetFragmentShadingRateKHR:
+            return "vkCmdSetFragmentShadingRateKHR";
+        case ApiCall_vkCmdSetFragmentShadingRateEnumNV:
+            return "vkCmdSetFragmentShadingRateEnumNV";
+        case ApiCall_vkAcquireWinrtDisplayNV:
+            return "vkAcquireWinrtDisplayNV";
+        case ApiCall_vkGetWinrtDisplayNV:
+            return "vkGetWinrtDisplayNV";
+        case ApiCall_vkCmdSetEvent2KHR:
+            return "vkCmdSetEvent2KHR";
+        case ApiCall_vkCmdResetEvent2KHR:
+            return "vkCmdResetEvent2KHR";
+        case ApiCall_vkCmdWaitEvents2KHR:
+            return "vkCmdWaitEvents2KHR";
+        case ApiCall_vkCmdPipelineBarrier2KHR:
+            return "vkCmdPipelineBarrier2KHR";
+        case ApiCall_vkCmdWriteTimestamp2KHR:
+            return "vkCmdWriteTimestamp2KHR";
+        case ApiCall_vkQueueSubmit2KHR:
+            return "vkQueueSubmit2KHR";
+        case ApiCall_vkCmdWriteBufferMarker2AMD:
+            return "vkCmdWriteBufferMarker2AMD";
+        case ApiCall_vkGetQueueCheckpointData2NV:
+            return "vkGetQueueCheckpointData2NV";
+        case ApiCall_vkCmdSetVertexInputEXT:
+            return "vkCmdSetVertexInputEXT";
+        case ApiCall_vkGetMemoryZirconHandleFUCHSIA:
+            return "vkGetMemoryZirconHandleFUCHSIA";
+        case ApiCall_vkGetMemoryZirconHandlePropertiesFUCHSIA:
+            return "vkGetMemoryZirconHandlePropertiesFUCHSIA";
+        case ApiCall_vkImportSemaphoreZirconHandleFUCHSIA:
+            return "vkImportSemaphoreZirconHandleFUCHSIA";
+        case ApiCall_vkGetSemaphoreZirconHandleFUCHSIA:
+            return "vkGetSemaphoreZirconHandleFUCHSIA";
+        case ApiCall_vkCmdSetPatchControlPointsEXT:
+            return "vkCmdSetPatchControlPointsEXT";
+        case ApiCall_vkCmdSetRasterizerDiscardEnableEXT:
+            return "vkCmdSetRasterizerDiscardEnableEXT";
+        case ApiCall_vkCmdSetDepthBiasEnableEXT:
+            return "vkCmdSetDepthBiasEnableEXT";
+        case ApiCall_vkCmdSetLogicOpEXT:
+            return "vkCmdSetLogicOpEXT";
+        case ApiCall_vkCmdSetPrimitiveRestartEnableEXT:
+            return "vkCmdSetPrimitiveRestartEnableEXT";
+        case ApiCall_vkCreateScreenSurfaceQNX:
+            return "vkCreateScreenSurfaceQNX";
+        case ApiCall_vkGetPhysicalDeviceScreenPresentationSupportQNX:
+            return "vkGetPhysicalDeviceScreenPresentationSupportQNX";
+        case ApiCall_vkCmdSetColorWriteEnableEXT:
+            return "vkCmdSetColorWriteEnableEXT";
+        case ApiCall_vkAcquireDrmDisplayEXT:
+            return "vkAcquireDrmDisplayEXT";
+        case ApiCall_vkGetDrmDisplayEXT:
+            return "vkGetDrmDisplayEXT";
+        case ApiCall_vkCmdDrawMultiEXT:
+            return "vkCmdDrawMultiEXT";
+        case ApiCall_vkCmdDrawMultiIndexedEXT:
+            return "vkCmdDrawMultiIndexedEXT";
+        default:
+            break;
+    }
+
+    return "Unknown";
+}
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
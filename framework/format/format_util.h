@@ -29,6 +29,7 @@
 #include "util/defines.h"
 
 #include <string>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(format)
@@ -69,9 +70,29 @@ inline BlockType AddCompressedBlockBit(BlockType type)
     return static_cast<BlockType>(type | kCompressedBlockTypeBit);
 }
 
+// Removes both the compressed bit and the block compression type tag.
 inline BlockType RemoveCompressedBlockBit(BlockType type)
 {
-    return static_cast<BlockType>(type & ~kCompressedBlockTypeBit);
+    return static_cast<BlockType>(type & ~(kCompressedBlockTypeBit | kBlockCompressionTypeMask));
+}
+
+// Compressed blocks may be tagged with the type of compression that was applied to the block, which overrides the
+// compression type specified by the file header.  Untagged blocks, which report kNone, use the file's compression type.
+inline CompressionType GetBlockCompressionType(BlockType type)
+{
+    return static_cast<CompressionType>((type & kBlockCompressionTypeMask) >> kBlockCompressionTypeShift);
+}
+
+inline BlockType SetBlockCompressionType(BlockType type, CompressionType compression_type)
+{
+    return static_cast<BlockType>((type & ~kBlockCompressionTypeMask) |
+                                  ((compression_type << kBlockCompressionTypeShift) & kBlockCompressionTypeMask));
+}
+
+inline bool IsCompressedBatchBlock(BlockType type)
+{
+    BlockType base_type = RemoveCompressedBlockBit(type);
+    return IsBlockCompressed(type) && ((base_type == kBatchBlock) || (base_type == kCompactBatchBlock));
 }
 
 // Utilities for file encoding.
@@ -81,14 +102,42 @@ uint64_t GetMetaDataBlockBaseSize(const T& block)
     return (sizeof(block) - sizeof(block.meta_header.block_header));
 }
 
+// Converts a sequence of complete blocks to the records of a kCompactBatchBlock, replacing the block header, call ID,
+// and thread ID of each uncompressed Vulkan function call with a compact header.  Returns false if the data does not
+// consist of complete blocks.
+bool EncodeCompactRecords(const uint8_t* blocks, size_t blocks_size, std::vector<uint8_t>* records);
+
+// Restores the blocks encoded by EncodeCompactRecords().  Returns false if the records are invalid.
+bool DecodeCompactRecords(const uint8_t* records, size_t records_size, std::vector<uint8_t>* blocks);
+
 // Utilities for format validation.
 bool ValidateFileHeader(const FileHeader& header);
 
 // Utilities for object creation.
-util::Compressor* CreateCompressor(CompressionType type);
+const int32_t kDefaultCompressionLevel = 0;
+
+// Compression level settings for CreateCompressor.  The level is interpreted by compression type, with 0 selecting the
+// compressor's default level:
+//   LZ4:       Negative levels select fast compression with an acceleration of -level.  Levels 1 and 2 are the same as
+//              the default, and levels 3 to 12 select the LZ4 HC compressor, for offline compression.
+//   zlib:      1 (fastest) to 9 (best compression).
+//   Zstandard: -5 (fastest) to 19 (best compression).  Zstandard also accepts levels up to 22, which require
+//              significantly more memory for decompression.
+// Zstandard can also compress large blocks with worker threads, which are owned by the compressor and only used for
+// blocks of at least util::ZstdCompressor::kMinWorkerThreadSize bytes.
+struct CompressorOptions
+{
+    int32_t  level{ kDefaultCompressionLevel };
+    bool     long_distance_matching{ false }; // Zstandard only.
+    uint32_t worker_threads{ 0 };             // Zstandard only.
+};
+
+util::Compressor* CreateCompressor(CompressionType type, const CompressorOptions& options = CompressorOptions());
 
 std::string GetCompressionTypeName(CompressionType type);
 
+const char* GetApiCallName(ApiCallId call_id);
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -2796,7 +2796,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
 
     VkResult result = GetDeviceTable(commandBuffer)->BeginCommandBuffer(commandBuffer_unwrapped, pBeginInfo_unwrapped);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkBeginCommandBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkBeginCommandBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2821,7 +2821,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
 
     VkResult result = GetDeviceTable(commandBuffer)->EndCommandBuffer(commandBuffer_unwrapped);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkEndCommandBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkEndCommandBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2846,7 +2846,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
 
     VkResult result = GetDeviceTable(commandBuffer)->ResetCommandBuffer(commandBuffer_unwrapped, flags);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkResetCommandBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkResetCommandBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2869,7 +2869,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindPipeline>::Dispatch(TraceManager::Get(), commandBuffer, pipelineBindPoint, pipeline);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindPipeline);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindPipeline);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2896,7 +2896,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetViewport>::Dispatch(TraceManager::Get(), commandBuffer, firstViewport, viewportCount, pViewports);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewport);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetViewport);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2923,7 +2923,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetScissor>::Dispatch(TraceManager::Get(), commandBuffer, firstScissor, scissorCount, pScissors);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetScissor);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetScissor);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2948,7 +2948,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetLineWidth>::Dispatch(TraceManager::Get(), commandBuffer, lineWidth);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetLineWidth);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetLineWidth);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2973,7 +2973,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDepthBias>::Dispatch(TraceManager::Get(), commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDepthBias);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDepthBias);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -2998,7 +2998,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetBlendConstants>::Dispatch(TraceManager::Get(), commandBuffer, blendConstants);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetBlendConstants);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetBlendConstants);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3022,7 +3022,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDepthBounds>::Dispatch(TraceManager::Get(), commandBuffer, minDepthBounds, maxDepthBounds);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDepthBounds);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDepthBounds);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3047,7 +3047,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask>::Dispatch(TraceManager::Get(), commandBuffer, faceMask, compareMask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3072,7 +3072,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask>::Dispatch(TraceManager::Get(), commandBuffer, faceMask, writeMask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3097,7 +3097,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetStencilReference>::Dispatch(TraceManager::Get(), commandBuffer, faceMask, reference);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetStencilReference);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetStencilReference);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3127,7 +3127,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindDescriptorSets>::Dispatch(TraceManager::Get(), commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindDescriptorSets);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindDescriptorSets);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3161,7 +3161,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindIndexBuffer>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, indexType);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindIndexBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindIndexBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3190,7 +3190,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindVertexBuffers>::Dispatch(TraceManager::Get(), commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindVertexBuffers);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindVertexBuffers);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3221,7 +3221,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDraw>::Dispatch(TraceManager::Get(), commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDraw);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDraw);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3251,7 +3251,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndexed>::Dispatch(TraceManager::Get(), commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndexed);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndexed);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3281,7 +3281,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndirect>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, drawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndirect);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndirect);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3311,7 +3311,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, drawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3340,7 +3340,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDispatch>::Dispatch(TraceManager::Get(), commandBuffer, groupCountX, groupCountY, groupCountZ);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDispatch);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDispatch);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3366,7 +3366,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDispatchIndirect>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDispatchIndirect);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDispatchIndirect);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3394,7 +3394,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyBuffer>::Dispatch(TraceManager::Get(), commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3427,7 +3427,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyImage>::Dispatch(TraceManager::Get(), commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImage);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyImage);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3463,7 +3463,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBlitImage>::Dispatch(TraceManager::Get(), commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBlitImage);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBlitImage);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3498,7 +3498,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyBufferToImage>::Dispatch(TraceManager::Get(), commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBufferToImage);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyBufferToImage);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3531,7 +3531,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer>::Dispatch(TraceManager::Get(), commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3563,7 +3563,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdUpdateBuffer>::Dispatch(TraceManager::Get(), commandBuffer, dstBuffer, dstOffset, dataSize, pData);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdUpdateBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdUpdateBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3593,7 +3593,7 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdFillBuffer>::Dispatch(TraceManager::Get(), commandBuffer, dstBuffer, dstOffset, size, data);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdFillBuffer);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdFillBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3624,7 +3624,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdClearColorImage>::Dispatch(TraceManager::Get(), commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdClearColorImage);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdClearColorImage);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3656,7 +3656,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage>::Dispatch(TraceManager::Get(), commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3687,7 +3687,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdClearAttachments>::Dispatch(TraceManager::Get(), commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdClearAttachments);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdClearAttachments);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3718,7 +3718,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdResolveImage>::Dispatch(TraceManager::Get(), commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdResolveImage);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdResolveImage);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3749,7 +3749,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetEvent>::Dispatch(TraceManager::Get(), commandBuffer, event, stageMask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetEvent);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetEvent);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3775,7 +3775,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdResetEvent>::Dispatch(TraceManager::Get(), commandBuffer, event, stageMask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdResetEvent);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdResetEvent);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3809,7 +3809,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWaitEvents>::Dispatch(TraceManager::Get(), commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWaitEvents);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWaitEvents);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3853,7 +3853,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdPipelineBarrier>::Dispatch(TraceManager::Get(), commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPipelineBarrier);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdPipelineBarrier);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3889,7 +3889,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginQuery>::Dispatch(TraceManager::Get(), commandBuffer, queryPool, query, flags);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginQuery);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginQuery);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3916,7 +3916,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndQuery>::Dispatch(TraceManager::Get(), commandBuffer, queryPool, query);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndQuery);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndQuery);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3943,7 +3943,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdResetQueryPool>::Dispatch(TraceManager::Get(), commandBuffer, queryPool, firstQuery, queryCount);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdResetQueryPool);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdResetQueryPool);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -3971,7 +3971,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWriteTimestamp>::Dispatch(TraceManager::Get(), commandBuffer, pipelineStage, queryPool, query);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWriteTimestamp);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWriteTimestamp);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4003,7 +4003,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults>::Dispatch(TraceManager::Get(), commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4038,7 +4038,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdPushConstants>::Dispatch(TraceManager::Get(), commandBuffer, layout, stageFlags, offset, size, pValues);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPushConstants);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdPushConstants);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4067,7 +4067,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginRenderPass>::Dispatch(TraceManager::Get(), commandBuffer, pRenderPassBegin, contents);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginRenderPass);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginRenderPass);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4093,7 +4093,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdNextSubpass>::Dispatch(TraceManager::Get(), commandBuffer, contents);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdNextSubpass);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdNextSubpass);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4115,7 +4115,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndRenderPass>::Dispatch(TraceManager::Get(), commandBuffer);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndRenderPass);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndRenderPass);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4138,7 +4138,7 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdExecuteCommands>::Dispatch(TraceManager::Get(), commandBuffer, commandBufferCount, pCommandBuffers);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdExecuteCommands);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdExecuteCommands);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4253,7 +4253,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDeviceMask>::Dispatch(TraceManager::Get(), commandBuffer, deviceMask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDeviceMask);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDeviceMask);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4281,7 +4281,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDispatchBase>::Dispatch(TraceManager::Get(), commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDispatchBase);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDispatchBase);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4911,7 +4911,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndirectCount>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndirectCount);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndirectCount);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -4946,7 +4946,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -5018,7 +5018,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginRenderPass2>::Dispatch(TraceManager::Get(), commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginRenderPass2);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginRenderPass2);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -5045,7 +5045,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdNextSubpass2>::Dispatch(TraceManager::Get(), commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdNextSubpass2);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdNextSubpass2);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -5069,7 +5069,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndRenderPass2>::Dispatch(TraceManager::Get(), commandBuffer, pSubpassEndInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndRenderPass2);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndRenderPass2);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -5818,7 +5818,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(
         encoder->EncodeUInt32Ptr(pPropertyCount, omit_output_data);
         EncodeStructArray(encoder, pProperties, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, omit_output_data);
         encoder->EncodeEnumValue(result);
-        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayPropertiesKHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayPropertiesKHR* handle_struct)->DisplayKHRWrapper* { return reinterpret_cast<DisplayKHRWrapper*>(handle_struct->display); });
+        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayPropertiesKHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayPropertiesKHR* handle_struct)->DisplayKHRWrapper* { return GetWrapper<DisplayKHRWrapper>(handle_struct->display); });
     }
 
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR>::Dispatch(TraceManager::Get(), result, physicalDevice, pPropertyCount, pProperties);
@@ -5857,7 +5857,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlanePropertiesKHR(
         encoder->EncodeUInt32Ptr(pPropertyCount, omit_output_data);
         EncodeStructArray(encoder, pProperties, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, omit_output_data);
         encoder->EncodeEnumValue(result);
-        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayPlanePropertiesKHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayPlanePropertiesKHR* handle_struct)->DisplayKHRWrapper* { return reinterpret_cast<DisplayKHRWrapper*>(handle_struct->currentDisplay); });
+        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayPlanePropertiesKHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayPlanePropertiesKHR* handle_struct)->DisplayKHRWrapper* { return GetWrapper<DisplayKHRWrapper>(handle_struct->currentDisplay); });
     }
 
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR>::Dispatch(TraceManager::Get(), result, physicalDevice, pPropertyCount, pProperties);
@@ -5940,7 +5940,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(
         encoder->EncodeUInt32Ptr(pPropertyCount, omit_output_data);
         EncodeStructArray(encoder, pProperties, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, omit_output_data);
         encoder->EncodeEnumValue(result);
-        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayModeKHRWrapper, VkDisplayModePropertiesKHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayModePropertiesKHR* handle_struct)->DisplayModeKHRWrapper* { return reinterpret_cast<DisplayModeKHRWrapper*>(handle_struct->displayMode); });
+        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayModeKHRWrapper, VkDisplayModePropertiesKHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayModePropertiesKHR* handle_struct)->DisplayModeKHRWrapper* { return GetWrapper<DisplayModeKHRWrapper>(handle_struct->displayMode); });
     }
 
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR>::Dispatch(TraceManager::Get(), result, physicalDevice, display, pPropertyCount, pProperties);
@@ -6653,7 +6653,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR>::Dispatch(TraceManager::Get(), commandBuffer, deviceMask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -6681,7 +6681,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR>::Dispatch(TraceManager::Get(), commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -7100,7 +7100,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR>::Dispatch(TraceManager::Get(), commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -7243,7 +7243,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -7270,7 +7270,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -7294,7 +7294,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pSubpassEndInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -7704,7 +7704,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayProperties2KHR(
         encoder->EncodeUInt32Ptr(pPropertyCount, omit_output_data);
         EncodeStructArray(encoder, pProperties, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, omit_output_data);
         encoder->EncodeEnumValue(result);
-        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayProperties2KHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayProperties2KHR* handle_struct)->DisplayKHRWrapper* { return reinterpret_cast<DisplayKHRWrapper*>(handle_struct->displayProperties.display); });
+        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayProperties2KHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayProperties2KHR* handle_struct)->DisplayKHRWrapper* { return GetWrapper<DisplayKHRWrapper>(handle_struct->displayProperties.display); });
     }
 
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR>::Dispatch(TraceManager::Get(), result, physicalDevice, pPropertyCount, pProperties);
@@ -7743,7 +7743,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlaneProperties2KHR(
         encoder->EncodeUInt32Ptr(pPropertyCount, omit_output_data);
         EncodeStructArray(encoder, pProperties, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, omit_output_data);
         encoder->EncodeEnumValue(result);
-        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayPlaneProperties2KHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayPlaneProperties2KHR* handle_struct)->DisplayKHRWrapper* { return reinterpret_cast<DisplayKHRWrapper*>(handle_struct->displayPlaneProperties.currentDisplay); });
+        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayKHRWrapper, VkDisplayPlaneProperties2KHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayPlaneProperties2KHR* handle_struct)->DisplayKHRWrapper* { return GetWrapper<DisplayKHRWrapper>(handle_struct->displayPlaneProperties.currentDisplay); });
     }
 
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR>::Dispatch(TraceManager::Get(), result, physicalDevice, pPropertyCount, pProperties);
@@ -7785,7 +7785,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModeProperties2KHR(
         encoder->EncodeUInt32Ptr(pPropertyCount, omit_output_data);
         EncodeStructArray(encoder, pProperties, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, omit_output_data);
         encoder->EncodeEnumValue(result);
-        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayModeKHRWrapper, VkDisplayModeProperties2KHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayModeProperties2KHR* handle_struct)->DisplayModeKHRWrapper* { return reinterpret_cast<DisplayModeKHRWrapper*>(handle_struct->displayModeProperties.displayMode); });
+        TraceManager::Get()->EndStructGroupCreateApiCallTrace<VkPhysicalDevice, DisplayModeKHRWrapper, VkDisplayModeProperties2KHR>(result, physicalDevice, (pPropertyCount != nullptr) ? (*pPropertyCount) : 0, pProperties, [](VkDisplayModeProperties2KHR* handle_struct)->DisplayModeKHRWrapper* { return GetWrapper<DisplayModeKHRWrapper>(handle_struct->displayModeProperties.displayMode); });
     }
 
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR>::Dispatch(TraceManager::Get(), result, physicalDevice, display, pPropertyCount, pProperties);
@@ -8081,7 +8081,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8116,7 +8116,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8274,7 +8274,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR>::Dispatch(TraceManager::Get(), commandBuffer, pFragmentSize, combinerOps);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8645,7 +8645,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetEvent2KHR>::Dispatch(TraceManager::Get(), commandBuffer, event, pDependencyInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetEvent2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetEvent2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8673,7 +8673,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdResetEvent2KHR>::Dispatch(TraceManager::Get(), commandBuffer, event, stageMask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdResetEvent2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdResetEvent2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8700,7 +8700,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR>::Dispatch(TraceManager::Get(), commandBuffer, eventCount, pEvents, pDependencyInfos);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8728,7 +8728,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pDependencyInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8755,7 +8755,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR>::Dispatch(TraceManager::Get(), commandBuffer, stage, queryPool, query);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8817,7 +8817,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD>::Dispatch(TraceManager::Get(), commandBuffer, stage, dstBuffer, dstOffset, marker);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8869,7 +8869,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pCopyBufferInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8894,7 +8894,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyImage2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pCopyImageInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImage2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyImage2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8919,7 +8919,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pCopyBufferToImageInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8944,7 +8944,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pCopyImageToBufferInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8969,7 +8969,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBlitImage2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pBlitImageInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBlitImage2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBlitImage2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -8994,7 +8994,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdResolveImage2KHR>::Dispatch(TraceManager::Get(), commandBuffer, pResolveImageInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdResolveImage2KHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdResolveImage2KHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9180,7 +9180,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT>::Dispatch(TraceManager::Get(), commandBuffer, pMarkerInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9202,7 +9202,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT>::Dispatch(TraceManager::Get(), commandBuffer);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9224,7 +9224,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT>::Dispatch(TraceManager::Get(), commandBuffer, pMarkerInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9251,7 +9251,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT>::Dispatch(TraceManager::Get(), commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9283,7 +9283,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT>::Dispatch(TraceManager::Get(), commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9314,7 +9314,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT>::Dispatch(TraceManager::Get(), commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9345,7 +9345,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT>::Dispatch(TraceManager::Get(), commandBuffer, queryPool, query, flags, index);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9374,7 +9374,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT>::Dispatch(TraceManager::Get(), commandBuffer, queryPool, query, index);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9405,7 +9405,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT>::Dispatch(TraceManager::Get(), commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9502,7 +9502,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9537,7 +9537,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9771,7 +9771,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT>::Dispatch(TraceManager::Get(), commandBuffer, pConditionalRenderingBegin);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9795,7 +9795,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT>::Dispatch(TraceManager::Get(), commandBuffer);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -9819,7 +9819,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV>::Dispatch(TraceManager::Get(), commandBuffer, firstViewport, viewportCount, pViewportWScalings);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10201,7 +10201,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT>::Dispatch(TraceManager::Get(), commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10460,7 +10460,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT>::Dispatch(TraceManager::Get(), commandBuffer, pLabelInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10482,7 +10482,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT>::Dispatch(TraceManager::Get(), commandBuffer);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10504,7 +10504,7 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT>::Dispatch(TraceManager::Get(), commandBuffer, pLabelInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10693,7 +10693,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT>::Dispatch(TraceManager::Get(), commandBuffer, pSampleLocationsInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10916,7 +10916,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV>::Dispatch(TraceManager::Get(), commandBuffer, imageView, imageLayout);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10943,7 +10943,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV>::Dispatch(TraceManager::Get(), commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -10970,7 +10970,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV>::Dispatch(TraceManager::Get(), commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11130,7 +11130,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV>::Dispatch(TraceManager::Get(), commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11168,7 +11168,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV>::Dispatch(TraceManager::Get(), commandBuffer, dst, src, mode);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11208,7 +11208,7 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdTraceRaysNV>::Dispatch(TraceManager::Get(), commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdTraceRaysNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdTraceRaysNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11419,7 +11419,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV>::Dispatch(TraceManager::Get(), commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11517,7 +11517,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD>::Dispatch(TraceManager::Get(), commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11617,7 +11617,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV>::Dispatch(TraceManager::Get(), commandBuffer, taskCount, firstTask);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11644,7 +11644,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, drawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11676,7 +11676,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV>::Dispatch(TraceManager::Get(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11708,7 +11708,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV>::Dispatch(TraceManager::Get(), commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11733,7 +11733,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetCheckpointNV>::Dispatch(TraceManager::Get(), commandBuffer, pCheckpointMarker);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetCheckpointNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetCheckpointNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11832,7 +11832,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
 
     VkResult result = GetDeviceTable(commandBuffer)->CmdSetPerformanceMarkerINTEL(commandBuffer_unwrapped, pMarkerInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11858,7 +11858,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
 
     VkResult result = GetDeviceTable(commandBuffer)->CmdSetPerformanceStreamMarkerINTEL(commandBuffer_unwrapped, pMarkerInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -11884,7 +11884,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
 
     VkResult result = GetDeviceTable(commandBuffer)->CmdSetPerformanceOverrideINTEL(commandBuffer_unwrapped, pOverrideInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12441,7 +12441,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT>::Dispatch(TraceManager::Get(), commandBuffer, lineStippleFactor, lineStipplePattern);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12493,7 +12493,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetCullModeEXT>::Dispatch(TraceManager::Get(), commandBuffer, cullMode);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetCullModeEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetCullModeEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12516,7 +12516,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT>::Dispatch(TraceManager::Get(), commandBuffer, frontFace);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12539,7 +12539,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT>::Dispatch(TraceManager::Get(), commandBuffer, primitiveTopology);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12563,7 +12563,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT>::Dispatch(TraceManager::Get(), commandBuffer, viewportCount, pViewports);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12588,7 +12588,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT>::Dispatch(TraceManager::Get(), commandBuffer, scissorCount, pScissors);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12617,7 +12617,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT>::Dispatch(TraceManager::Get(), commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12647,7 +12647,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, depthTestEnable);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12670,7 +12670,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, depthWriteEnable);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12693,7 +12693,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT>::Dispatch(TraceManager::Get(), commandBuffer, depthCompareOp);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12716,7 +12716,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, depthBoundsTestEnable);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12739,7 +12739,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, stencilTestEnable);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12766,7 +12766,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT>::Dispatch(TraceManager::Get(), commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12820,7 +12820,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV>::Dispatch(TraceManager::Get(), commandBuffer, pGeneratedCommandsInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12846,7 +12846,7 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV>::Dispatch(TraceManager::Get(), commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -12874,7 +12874,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV>::Dispatch(TraceManager::Get(), commandBuffer, pipelineBindPoint, pipeline, groupIndex);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13176,7 +13176,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV>::Dispatch(TraceManager::Get(), commandBuffer, shadingRate, combinerOps);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13338,7 +13338,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT>::Dispatch(TraceManager::Get(), commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13500,7 +13500,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT>::Dispatch(TraceManager::Get(), commandBuffer, patchControlPoints);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13523,7 +13523,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, rasterizerDiscardEnable);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13546,7 +13546,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, depthBiasEnable);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13569,7 +13569,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT>::Dispatch(TraceManager::Get(), commandBuffer, logicOp);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13592,7 +13592,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, primitiveRestartEnable);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13685,7 +13685,7 @@ VKAPI_ATTR void                                    VKAPI_CALL CmdSetColorWriteEn
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT>::Dispatch(TraceManager::Get(), commandBuffer, attachmentCount, pColorWriteEnables);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13713,7 +13713,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawMultiEXT>::Dispatch(TraceManager::Get(), commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawMultiEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawMultiEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13745,7 +13745,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT>::Dispatch(TraceManager::Get(), commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13837,7 +13837,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR>::Dispatch(TraceManager::Get(), commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -13868,7 +13868,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR>::Dispatch(TraceManager::Get(), commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -14003,7 +14003,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR>::Dispatch(TraceManager::Get(), commandBuffer, pInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -14028,7 +14028,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR>::Dispatch(TraceManager::Get(), commandBuffer, pInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -14053,7 +14053,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR>::Dispatch(TraceManager::Get(), commandBuffer, pInfo);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -14110,7 +14110,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR>::Dispatch(TraceManager::Get(), commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -14202,7 +14202,7 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdTraceRaysKHR>::Dispatch(TraceManager::Get(), commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdTraceRaysKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdTraceRaysKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -14316,7 +14316,7 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR>::Dispatch(TraceManager::Get(), commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
@@ -14374,7 +14374,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR>::Dispatch(TraceManager::Get(), commandBuffer, pipelineStackSize);
 
-    auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR);
+    auto encoder = TraceManager::Get()->BeginTrackedCommandApiCallTrace(commandBuffer, format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(commandBuffer);
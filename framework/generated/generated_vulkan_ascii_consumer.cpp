@@ -41,14 +41,14 @@ void VulkanAsciiConsumer::Process_vkCreateInstance(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkInstance>*           pInstance)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateInstance");
+    WriteLine("vkCreateInstance");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyInstance(
     format::HandleId                            instance,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyInstance");
+    WriteLine("vkDestroyInstance");
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDevices(
@@ -57,14 +57,14 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDevices(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceCount,
     HandlePointerDecoder<VkPhysicalDevice>*     pPhysicalDevices)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDevices");
+    WriteLine("vkEnumeratePhysicalDevices");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFeatures(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures>* pFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFeatures");
+    WriteLine("vkGetPhysicalDeviceFeatures");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties(
@@ -72,7 +72,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties>* pFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFormatProperties");
+    WriteLine("vkGetPhysicalDeviceFormatProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
@@ -85,14 +85,14 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
     VkImageCreateFlags                          flags,
     StructPointerDecoder<Decoded_VkImageFormatProperties>* pImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceImageFormatProperties");
+    WriteLine("vkGetPhysicalDeviceImageFormatProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceProperties");
+    WriteLine("vkGetPhysicalDeviceProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
@@ -100,14 +100,14 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties>* pQueueFamilyProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyProperties");
+    WriteLine("vkGetPhysicalDeviceQueueFamilyProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMemoryProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMemoryProperties");
+    WriteLine("vkGetPhysicalDeviceMemoryProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDevice(
@@ -117,14 +117,14 @@ void VulkanAsciiConsumer::Process_vkCreateDevice(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDevice>*             pDevice)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDevice");
+    WriteLine("vkCreateDevice");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDevice(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDevice");
+    WriteLine("vkDestroyDevice");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceQueue(
@@ -133,7 +133,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceQueue(
     uint32_t                                    queueIndex,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceQueue");
+    WriteLine("vkGetDeviceQueue");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueSubmit(
@@ -143,21 +143,21 @@ void VulkanAsciiConsumer::Process_vkQueueSubmit(
     StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
     format::HandleId                            fence)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueSubmit");
+    WriteLine("vkQueueSubmit");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            queue)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueWaitIdle");
+    WriteLine("vkQueueWaitIdle");
 }
 
 void VulkanAsciiConsumer::Process_vkDeviceWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            device)
 {
-    fprintf(GetFile(), "%s\n", "vkDeviceWaitIdle");
+    WriteLine("vkDeviceWaitIdle");
 }
 
 void VulkanAsciiConsumer::Process_vkAllocateMemory(
@@ -167,7 +167,7 @@ void VulkanAsciiConsumer::Process_vkAllocateMemory(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeviceMemory>*       pMemory)
 {
-    fprintf(GetFile(), "%s\n", "vkAllocateMemory");
+    WriteLine("vkAllocateMemory");
 }
 
 void VulkanAsciiConsumer::Process_vkFreeMemory(
@@ -175,7 +175,7 @@ void VulkanAsciiConsumer::Process_vkFreeMemory(
     format::HandleId                            memory,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkFreeMemory");
+    WriteLine("vkFreeMemory");
 }
 
 void VulkanAsciiConsumer::Process_vkMapMemory(
@@ -187,14 +187,14 @@ void VulkanAsciiConsumer::Process_vkMapMemory(
     VkMemoryMapFlags                            flags,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    fprintf(GetFile(), "%s\n", "vkMapMemory");
+    WriteLine("vkMapMemory");
 }
 
 void VulkanAsciiConsumer::Process_vkUnmapMemory(
     format::HandleId                            device,
     format::HandleId                            memory)
 {
-    fprintf(GetFile(), "%s\n", "vkUnmapMemory");
+    WriteLine("vkUnmapMemory");
 }
 
 void VulkanAsciiConsumer::Process_vkFlushMappedMemoryRanges(
@@ -203,7 +203,7 @@ void VulkanAsciiConsumer::Process_vkFlushMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkFlushMappedMemoryRanges");
+    WriteLine("vkFlushMappedMemoryRanges");
 }
 
 void VulkanAsciiConsumer::Process_vkInvalidateMappedMemoryRanges(
@@ -212,7 +212,7 @@ void VulkanAsciiConsumer::Process_vkInvalidateMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkInvalidateMappedMemoryRanges");
+    WriteLine("vkInvalidateMappedMemoryRanges");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceMemoryCommitment(
@@ -220,7 +220,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceMemoryCommitment(
     format::HandleId                            memory,
     PointerDecoder<VkDeviceSize>*               pCommittedMemoryInBytes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceMemoryCommitment");
+    WriteLine("vkGetDeviceMemoryCommitment");
 }
 
 void VulkanAsciiConsumer::Process_vkBindBufferMemory(
@@ -230,7 +230,7 @@ void VulkanAsciiConsumer::Process_vkBindBufferMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    fprintf(GetFile(), "%s\n", "vkBindBufferMemory");
+    WriteLine("vkBindBufferMemory");
 }
 
 void VulkanAsciiConsumer::Process_vkBindImageMemory(
@@ -240,7 +240,7 @@ void VulkanAsciiConsumer::Process_vkBindImageMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    fprintf(GetFile(), "%s\n", "vkBindImageMemory");
+    WriteLine("vkBindImageMemory");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements(
@@ -248,7 +248,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferMemoryRequirements");
+    WriteLine("vkGetBufferMemoryRequirements");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements(
@@ -256,7 +256,7 @@ void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageMemoryRequirements");
+    WriteLine("vkGetImageMemoryRequirements");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements(
@@ -265,7 +265,7 @@ void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements>* pSparseMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSparseMemoryRequirements");
+    WriteLine("vkGetImageSparseMemoryRequirements");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties(
@@ -278,7 +278,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSparseImageFormatProperties");
+    WriteLine("vkGetPhysicalDeviceSparseImageFormatProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueBindSparse(
@@ -288,7 +288,7 @@ void VulkanAsciiConsumer::Process_vkQueueBindSparse(
     StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
     format::HandleId                            fence)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueBindSparse");
+    WriteLine("vkQueueBindSparse");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateFence(
@@ -298,7 +298,7 @@ void VulkanAsciiConsumer::Process_vkCreateFence(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateFence");
+    WriteLine("vkCreateFence");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyFence(
@@ -306,7 +306,7 @@ void VulkanAsciiConsumer::Process_vkDestroyFence(
     format::HandleId                            fence,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyFence");
+    WriteLine("vkDestroyFence");
 }
 
 void VulkanAsciiConsumer::Process_vkResetFences(
@@ -315,7 +315,7 @@ void VulkanAsciiConsumer::Process_vkResetFences(
     uint32_t                                    fenceCount,
     HandlePointerDecoder<VkFence>*              pFences)
 {
-    fprintf(GetFile(), "%s\n", "vkResetFences");
+    WriteLine("vkResetFences");
 }
 
 void VulkanAsciiConsumer::Process_vkGetFenceStatus(
@@ -323,7 +323,7 @@ void VulkanAsciiConsumer::Process_vkGetFenceStatus(
     format::HandleId                            device,
     format::HandleId                            fence)
 {
-    fprintf(GetFile(), "%s\n", "vkGetFenceStatus");
+    WriteLine("vkGetFenceStatus");
 }
 
 void VulkanAsciiConsumer::Process_vkWaitForFences(
@@ -334,7 +334,7 @@ void VulkanAsciiConsumer::Process_vkWaitForFences(
     VkBool32                                    waitAll,
     uint64_t                                    timeout)
 {
-    fprintf(GetFile(), "%s\n", "vkWaitForFences");
+    WriteLine("vkWaitForFences");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSemaphore(
@@ -344,7 +344,7 @@ void VulkanAsciiConsumer::Process_vkCreateSemaphore(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSemaphore>*          pSemaphore)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSemaphore");
+    WriteLine("vkCreateSemaphore");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySemaphore(
@@ -352,7 +352,7 @@ void VulkanAsciiConsumer::Process_vkDestroySemaphore(
     format::HandleId                            semaphore,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySemaphore");
+    WriteLine("vkDestroySemaphore");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateEvent(
@@ -362,7 +362,7 @@ void VulkanAsciiConsumer::Process_vkCreateEvent(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkEvent>*              pEvent)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateEvent");
+    WriteLine("vkCreateEvent");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyEvent(
@@ -370,7 +370,7 @@ void VulkanAsciiConsumer::Process_vkDestroyEvent(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyEvent");
+    WriteLine("vkDestroyEvent");
 }
 
 void VulkanAsciiConsumer::Process_vkGetEventStatus(
@@ -378,7 +378,7 @@ void VulkanAsciiConsumer::Process_vkGetEventStatus(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    fprintf(GetFile(), "%s\n", "vkGetEventStatus");
+    WriteLine("vkGetEventStatus");
 }
 
 void VulkanAsciiConsumer::Process_vkSetEvent(
@@ -386,7 +386,7 @@ void VulkanAsciiConsumer::Process_vkSetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    fprintf(GetFile(), "%s\n", "vkSetEvent");
+    WriteLine("vkSetEvent");
 }
 
 void VulkanAsciiConsumer::Process_vkResetEvent(
@@ -394,7 +394,7 @@ void VulkanAsciiConsumer::Process_vkResetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    fprintf(GetFile(), "%s\n", "vkResetEvent");
+    WriteLine("vkResetEvent");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateQueryPool(
@@ -404,7 +404,7 @@ void VulkanAsciiConsumer::Process_vkCreateQueryPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkQueryPool>*          pQueryPool)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateQueryPool");
+    WriteLine("vkCreateQueryPool");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyQueryPool(
@@ -412,7 +412,7 @@ void VulkanAsciiConsumer::Process_vkDestroyQueryPool(
     format::HandleId                            queryPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyQueryPool");
+    WriteLine("vkDestroyQueryPool");
 }
 
 void VulkanAsciiConsumer::Process_vkGetQueryPoolResults(
@@ -426,7 +426,7 @@ void VulkanAsciiConsumer::Process_vkGetQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    fprintf(GetFile(), "%s\n", "vkGetQueryPoolResults");
+    WriteLine("vkGetQueryPoolResults");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateBuffer(
@@ -436,7 +436,7 @@ void VulkanAsciiConsumer::Process_vkCreateBuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBuffer>*             pBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateBuffer");
+    WriteLine("vkCreateBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyBuffer(
@@ -444,7 +444,7 @@ void VulkanAsciiConsumer::Process_vkDestroyBuffer(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyBuffer");
+    WriteLine("vkDestroyBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateBufferView(
@@ -454,7 +454,7 @@ void VulkanAsciiConsumer::Process_vkCreateBufferView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBufferView>*         pView)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateBufferView");
+    WriteLine("vkCreateBufferView");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyBufferView(
@@ -462,7 +462,7 @@ void VulkanAsciiConsumer::Process_vkDestroyBufferView(
     format::HandleId                            bufferView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyBufferView");
+    WriteLine("vkDestroyBufferView");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateImage(
@@ -472,7 +472,7 @@ void VulkanAsciiConsumer::Process_vkCreateImage(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImage>*              pImage)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateImage");
+    WriteLine("vkCreateImage");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyImage(
@@ -480,7 +480,7 @@ void VulkanAsciiConsumer::Process_vkDestroyImage(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyImage");
+    WriteLine("vkDestroyImage");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSubresourceLayout(
@@ -489,7 +489,7 @@ void VulkanAsciiConsumer::Process_vkGetImageSubresourceLayout(
     StructPointerDecoder<Decoded_VkImageSubresource>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout>* pLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSubresourceLayout");
+    WriteLine("vkGetImageSubresourceLayout");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateImageView(
@@ -499,7 +499,7 @@ void VulkanAsciiConsumer::Process_vkCreateImageView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImageView>*          pView)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateImageView");
+    WriteLine("vkCreateImageView");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyImageView(
@@ -507,7 +507,7 @@ void VulkanAsciiConsumer::Process_vkDestroyImageView(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyImageView");
+    WriteLine("vkDestroyImageView");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateShaderModule(
@@ -517,7 +517,7 @@ void VulkanAsciiConsumer::Process_vkCreateShaderModule(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkShaderModule>*       pShaderModule)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateShaderModule");
+    WriteLine("vkCreateShaderModule");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyShaderModule(
@@ -525,7 +525,7 @@ void VulkanAsciiConsumer::Process_vkDestroyShaderModule(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyShaderModule");
+    WriteLine("vkDestroyShaderModule");
 }
 
 void VulkanAsciiConsumer::Process_vkCreatePipelineCache(
@@ -535,7 +535,7 @@ void VulkanAsciiConsumer::Process_vkCreatePipelineCache(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipelineCache>*      pPipelineCache)
 {
-    fprintf(GetFile(), "%s\n", "vkCreatePipelineCache");
+    WriteLine("vkCreatePipelineCache");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPipelineCache(
@@ -543,7 +543,7 @@ void VulkanAsciiConsumer::Process_vkDestroyPipelineCache(
     format::HandleId                            pipelineCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPipelineCache");
+    WriteLine("vkDestroyPipelineCache");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineCacheData(
@@ -553,7 +553,7 @@ void VulkanAsciiConsumer::Process_vkGetPipelineCacheData(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineCacheData");
+    WriteLine("vkGetPipelineCacheData");
 }
 
 void VulkanAsciiConsumer::Process_vkMergePipelineCaches(
@@ -563,7 +563,7 @@ void VulkanAsciiConsumer::Process_vkMergePipelineCaches(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkPipelineCache>*      pSrcCaches)
 {
-    fprintf(GetFile(), "%s\n", "vkMergePipelineCaches");
+    WriteLine("vkMergePipelineCaches");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateGraphicsPipelines(
@@ -575,7 +575,7 @@ void VulkanAsciiConsumer::Process_vkCreateGraphicsPipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateGraphicsPipelines");
+    WriteLine("vkCreateGraphicsPipelines");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateComputePipelines(
@@ -587,7 +587,7 @@ void VulkanAsciiConsumer::Process_vkCreateComputePipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateComputePipelines");
+    WriteLine("vkCreateComputePipelines");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPipeline(
@@ -595,7 +595,7 @@ void VulkanAsciiConsumer::Process_vkDestroyPipeline(
     format::HandleId                            pipeline,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPipeline");
+    WriteLine("vkDestroyPipeline");
 }
 
 void VulkanAsciiConsumer::Process_vkCreatePipelineLayout(
@@ -605,7 +605,7 @@ void VulkanAsciiConsumer::Process_vkCreatePipelineLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipelineLayout>*     pPipelineLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCreatePipelineLayout");
+    WriteLine("vkCreatePipelineLayout");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPipelineLayout(
@@ -613,7 +613,7 @@ void VulkanAsciiConsumer::Process_vkDestroyPipelineLayout(
     format::HandleId                            pipelineLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPipelineLayout");
+    WriteLine("vkDestroyPipelineLayout");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSampler(
@@ -623,7 +623,7 @@ void VulkanAsciiConsumer::Process_vkCreateSampler(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSampler>*            pSampler)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSampler");
+    WriteLine("vkCreateSampler");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySampler(
@@ -631,7 +631,7 @@ void VulkanAsciiConsumer::Process_vkDestroySampler(
     format::HandleId                            sampler,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySampler");
+    WriteLine("vkDestroySampler");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorSetLayout(
@@ -641,7 +641,7 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorSetLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorSetLayout>* pSetLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorSetLayout");
+    WriteLine("vkCreateDescriptorSetLayout");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorSetLayout(
@@ -649,7 +649,7 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorSetLayout(
     format::HandleId                            descriptorSetLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorSetLayout");
+    WriteLine("vkDestroyDescriptorSetLayout");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorPool(
@@ -659,7 +659,7 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorPool>*     pDescriptorPool)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorPool");
+    WriteLine("vkCreateDescriptorPool");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorPool(
@@ -667,7 +667,7 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorPool(
     format::HandleId                            descriptorPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorPool");
+    WriteLine("vkDestroyDescriptorPool");
 }
 
 void VulkanAsciiConsumer::Process_vkResetDescriptorPool(
@@ -676,7 +676,7 @@ void VulkanAsciiConsumer::Process_vkResetDescriptorPool(
     format::HandleId                            descriptorPool,
     VkDescriptorPoolResetFlags                  flags)
 {
-    fprintf(GetFile(), "%s\n", "vkResetDescriptorPool");
+    WriteLine("vkResetDescriptorPool");
 }
 
 void VulkanAsciiConsumer::Process_vkAllocateDescriptorSets(
@@ -685,7 +685,7 @@ void VulkanAsciiConsumer::Process_vkAllocateDescriptorSets(
     StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    fprintf(GetFile(), "%s\n", "vkAllocateDescriptorSets");
+    WriteLine("vkAllocateDescriptorSets");
 }
 
 void VulkanAsciiConsumer::Process_vkFreeDescriptorSets(
@@ -695,7 +695,7 @@ void VulkanAsciiConsumer::Process_vkFreeDescriptorSets(
     uint32_t                                    descriptorSetCount,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    fprintf(GetFile(), "%s\n", "vkFreeDescriptorSets");
+    WriteLine("vkFreeDescriptorSets");
 }
 
 void VulkanAsciiConsumer::Process_vkUpdateDescriptorSets(
@@ -705,7 +705,7 @@ void VulkanAsciiConsumer::Process_vkUpdateDescriptorSets(
     uint32_t                                    descriptorCopyCount,
     StructPointerDecoder<Decoded_VkCopyDescriptorSet>* pDescriptorCopies)
 {
-    fprintf(GetFile(), "%s\n", "vkUpdateDescriptorSets");
+    WriteLine("vkUpdateDescriptorSets");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateFramebuffer(
@@ -715,7 +715,7 @@ void VulkanAsciiConsumer::Process_vkCreateFramebuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFramebuffer>*        pFramebuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateFramebuffer");
+    WriteLine("vkCreateFramebuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyFramebuffer(
@@ -723,7 +723,7 @@ void VulkanAsciiConsumer::Process_vkDestroyFramebuffer(
     format::HandleId                            framebuffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyFramebuffer");
+    WriteLine("vkDestroyFramebuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRenderPass(
@@ -733,7 +733,7 @@ void VulkanAsciiConsumer::Process_vkCreateRenderPass(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRenderPass");
+    WriteLine("vkCreateRenderPass");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyRenderPass(
@@ -741,7 +741,7 @@ void VulkanAsciiConsumer::Process_vkDestroyRenderPass(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyRenderPass");
+    WriteLine("vkDestroyRenderPass");
 }
 
 void VulkanAsciiConsumer::Process_vkGetRenderAreaGranularity(
@@ -749,7 +749,7 @@ void VulkanAsciiConsumer::Process_vkGetRenderAreaGranularity(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRenderAreaGranularity");
+    WriteLine("vkGetRenderAreaGranularity");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateCommandPool(
@@ -759,7 +759,7 @@ void VulkanAsciiConsumer::Process_vkCreateCommandPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkCommandPool>*        pCommandPool)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateCommandPool");
+    WriteLine("vkCreateCommandPool");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyCommandPool(
@@ -767,7 +767,7 @@ void VulkanAsciiConsumer::Process_vkDestroyCommandPool(
     format::HandleId                            commandPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyCommandPool");
+    WriteLine("vkDestroyCommandPool");
 }
 
 void VulkanAsciiConsumer::Process_vkResetCommandPool(
@@ -776,7 +776,7 @@ void VulkanAsciiConsumer::Process_vkResetCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolResetFlags                     flags)
 {
-    fprintf(GetFile(), "%s\n", "vkResetCommandPool");
+    WriteLine("vkResetCommandPool");
 }
 
 void VulkanAsciiConsumer::Process_vkAllocateCommandBuffers(
@@ -785,7 +785,7 @@ void VulkanAsciiConsumer::Process_vkAllocateCommandBuffers(
     StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    fprintf(GetFile(), "%s\n", "vkAllocateCommandBuffers");
+    WriteLine("vkAllocateCommandBuffers");
 }
 
 void VulkanAsciiConsumer::Process_vkFreeCommandBuffers(
@@ -794,7 +794,7 @@ void VulkanAsciiConsumer::Process_vkFreeCommandBuffers(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    fprintf(GetFile(), "%s\n", "vkFreeCommandBuffers");
+    WriteLine("vkFreeCommandBuffers");
 }
 
 void VulkanAsciiConsumer::Process_vkBeginCommandBuffer(
@@ -802,14 +802,14 @@ void VulkanAsciiConsumer::Process_vkBeginCommandBuffer(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkBeginCommandBuffer");
+    WriteLine("vkBeginCommandBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkEndCommandBuffer(
     VkResult                                    returnValue,
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkEndCommandBuffer");
+    WriteLine("vkEndCommandBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkResetCommandBuffer(
@@ -817,7 +817,7 @@ void VulkanAsciiConsumer::Process_vkResetCommandBuffer(
     format::HandleId                            commandBuffer,
     VkCommandBufferResetFlags                   flags)
 {
-    fprintf(GetFile(), "%s\n", "vkResetCommandBuffer");
+    WriteLine("vkResetCommandBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindPipeline(
@@ -825,7 +825,7 @@ void VulkanAsciiConsumer::Process_vkCmdBindPipeline(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindPipeline");
+    WriteLine("vkCmdBindPipeline");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewport(
@@ -834,7 +834,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewport(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewport");
+    WriteLine("vkCmdSetViewport");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetScissor(
@@ -843,14 +843,14 @@ void VulkanAsciiConsumer::Process_vkCmdSetScissor(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetScissor");
+    WriteLine("vkCmdSetScissor");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetLineWidth(
     format::HandleId                            commandBuffer,
     float                                       lineWidth)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetLineWidth");
+    WriteLine("vkCmdSetLineWidth");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthBias(
@@ -859,14 +859,14 @@ void VulkanAsciiConsumer::Process_vkCmdSetDepthBias(
     float                                       depthBiasClamp,
     float                                       depthBiasSlopeFactor)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthBias");
+    WriteLine("vkCmdSetDepthBias");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetBlendConstants(
     format::HandleId                            commandBuffer,
     PointerDecoder<float>*                      blendConstants)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetBlendConstants");
+    WriteLine("vkCmdSetBlendConstants");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthBounds(
@@ -874,7 +874,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetDepthBounds(
     float                                       minDepthBounds,
     float                                       maxDepthBounds)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthBounds");
+    WriteLine("vkCmdSetDepthBounds");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilCompareMask(
@@ -882,7 +882,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilCompareMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    compareMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilCompareMask");
+    WriteLine("vkCmdSetStencilCompareMask");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilWriteMask(
@@ -890,7 +890,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilWriteMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    writeMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilWriteMask");
+    WriteLine("vkCmdSetStencilWriteMask");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilReference(
@@ -898,7 +898,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilReference(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    reference)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilReference");
+    WriteLine("vkCmdSetStencilReference");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindDescriptorSets(
@@ -911,7 +911,7 @@ void VulkanAsciiConsumer::Process_vkCmdBindDescriptorSets(
     uint32_t                                    dynamicOffsetCount,
     PointerDecoder<uint32_t>*                   pDynamicOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindDescriptorSets");
+    WriteLine("vkCmdBindDescriptorSets");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindIndexBuffer(
@@ -920,7 +920,7 @@ void VulkanAsciiConsumer::Process_vkCmdBindIndexBuffer(
     VkDeviceSize                                offset,
     VkIndexType                                 indexType)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindIndexBuffer");
+    WriteLine("vkCmdBindIndexBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers(
@@ -930,7 +930,7 @@ void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers(
     HandlePointerDecoder<VkBuffer>*             pBuffers,
     PointerDecoder<VkDeviceSize>*               pOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindVertexBuffers");
+    WriteLine("vkCmdBindVertexBuffers");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDraw(
@@ -940,7 +940,7 @@ void VulkanAsciiConsumer::Process_vkCmdDraw(
     uint32_t                                    firstVertex,
     uint32_t                                    firstInstance)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDraw");
+    WriteLine("vkCmdDraw");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexed(
@@ -951,7 +951,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexed(
     int32_t                                     vertexOffset,
     uint32_t                                    firstInstance)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexed");
+    WriteLine("vkCmdDrawIndexed");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirect(
@@ -961,7 +961,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirect");
+    WriteLine("vkCmdDrawIndirect");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirect(
@@ -971,7 +971,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirect");
+    WriteLine("vkCmdDrawIndexedIndirect");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatch(
@@ -980,7 +980,7 @@ void VulkanAsciiConsumer::Process_vkCmdDispatch(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatch");
+    WriteLine("vkCmdDispatch");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatchIndirect(
@@ -988,7 +988,7 @@ void VulkanAsciiConsumer::Process_vkCmdDispatchIndirect(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatchIndirect");
+    WriteLine("vkCmdDispatchIndirect");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBuffer(
@@ -998,7 +998,7 @@ void VulkanAsciiConsumer::Process_vkCmdCopyBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferCopy>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBuffer");
+    WriteLine("vkCmdCopyBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImage(
@@ -1010,7 +1010,7 @@ void VulkanAsciiConsumer::Process_vkCmdCopyImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageCopy>*  pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImage");
+    WriteLine("vkCmdCopyImage");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBlitImage(
@@ -1023,7 +1023,7 @@ void VulkanAsciiConsumer::Process_vkCmdBlitImage(
     StructPointerDecoder<Decoded_VkImageBlit>*  pRegions,
     VkFilter                                    filter)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBlitImage");
+    WriteLine("vkCmdBlitImage");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBufferToImage(
@@ -1034,7 +1034,7 @@ void VulkanAsciiConsumer::Process_vkCmdCopyBufferToImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBufferToImage");
+    WriteLine("vkCmdCopyBufferToImage");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImageToBuffer(
@@ -1045,7 +1045,7 @@ void VulkanAsciiConsumer::Process_vkCmdCopyImageToBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImageToBuffer");
+    WriteLine("vkCmdCopyImageToBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdUpdateBuffer(
@@ -1055,7 +1055,7 @@ void VulkanAsciiConsumer::Process_vkCmdUpdateBuffer(
     VkDeviceSize                                dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdUpdateBuffer");
+    WriteLine("vkCmdUpdateBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdFillBuffer(
@@ -1065,7 +1065,7 @@ void VulkanAsciiConsumer::Process_vkCmdFillBuffer(
     VkDeviceSize                                size,
     uint32_t                                    data)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdFillBuffer");
+    WriteLine("vkCmdFillBuffer");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdClearColorImage(
@@ -1076,7 +1076,7 @@ void VulkanAsciiConsumer::Process_vkCmdClearColorImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdClearColorImage");
+    WriteLine("vkCmdClearColorImage");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdClearDepthStencilImage(
@@ -1087,7 +1087,7 @@ void VulkanAsciiConsumer::Process_vkCmdClearDepthStencilImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdClearDepthStencilImage");
+    WriteLine("vkCmdClearDepthStencilImage");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdClearAttachments(
@@ -1097,7 +1097,7 @@ void VulkanAsciiConsumer::Process_vkCmdClearAttachments(
     uint32_t                                    rectCount,
     StructPointerDecoder<Decoded_VkClearRect>*  pRects)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdClearAttachments");
+    WriteLine("vkCmdClearAttachments");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResolveImage(
@@ -1109,7 +1109,7 @@ void VulkanAsciiConsumer::Process_vkCmdResolveImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageResolve>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResolveImage");
+    WriteLine("vkCmdResolveImage");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetEvent(
@@ -1117,7 +1117,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetEvent");
+    WriteLine("vkCmdSetEvent");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResetEvent(
@@ -1125,7 +1125,7 @@ void VulkanAsciiConsumer::Process_vkCmdResetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResetEvent");
+    WriteLine("vkCmdResetEvent");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWaitEvents(
@@ -1141,7 +1141,7 @@ void VulkanAsciiConsumer::Process_vkCmdWaitEvents(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWaitEvents");
+    WriteLine("vkCmdWaitEvents");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPipelineBarrier(
@@ -1156,7 +1156,7 @@ void VulkanAsciiConsumer::Process_vkCmdPipelineBarrier(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPipelineBarrier");
+    WriteLine("vkCmdPipelineBarrier");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginQuery(
@@ -1165,7 +1165,7 @@ void VulkanAsciiConsumer::Process_vkCmdBeginQuery(
     uint32_t                                    query,
     VkQueryControlFlags                         flags)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginQuery");
+    WriteLine("vkCmdBeginQuery");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndQuery(
@@ -1173,7 +1173,7 @@ void VulkanAsciiConsumer::Process_vkCmdEndQuery(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndQuery");
+    WriteLine("vkCmdEndQuery");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResetQueryPool(
@@ -1182,7 +1182,7 @@ void VulkanAsciiConsumer::Process_vkCmdResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResetQueryPool");
+    WriteLine("vkCmdResetQueryPool");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteTimestamp(
@@ -1191,7 +1191,7 @@ void VulkanAsciiConsumer::Process_vkCmdWriteTimestamp(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteTimestamp");
+    WriteLine("vkCmdWriteTimestamp");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyQueryPoolResults(
@@ -1204,7 +1204,7 @@ void VulkanAsciiConsumer::Process_vkCmdCopyQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyQueryPoolResults");
+    WriteLine("vkCmdCopyQueryPoolResults");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPushConstants(
@@ -1215,7 +1215,7 @@ void VulkanAsciiConsumer::Process_vkCmdPushConstants(
     uint32_t                                    size,
     PointerDecoder<uint8_t>*                    pValues)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPushConstants");
+    WriteLine("vkCmdPushConstants");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass(
@@ -1223,20 +1223,20 @@ void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     VkSubpassContents                           contents)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginRenderPass");
+    WriteLine("vkCmdBeginRenderPass");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdNextSubpass(
     format::HandleId                            commandBuffer,
     VkSubpassContents                           contents)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdNextSubpass");
+    WriteLine("vkCmdNextSubpass");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndRenderPass(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndRenderPass");
+    WriteLine("vkCmdEndRenderPass");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdExecuteCommands(
@@ -1244,7 +1244,7 @@ void VulkanAsciiConsumer::Process_vkCmdExecuteCommands(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdExecuteCommands");
+    WriteLine("vkCmdExecuteCommands");
 }
 
 void VulkanAsciiConsumer::Process_vkBindBufferMemory2(
@@ -1253,7 +1253,7 @@ void VulkanAsciiConsumer::Process_vkBindBufferMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindBufferMemory2");
+    WriteLine("vkBindBufferMemory2");
 }
 
 void VulkanAsciiConsumer::Process_vkBindImageMemory2(
@@ -1262,7 +1262,7 @@ void VulkanAsciiConsumer::Process_vkBindImageMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindImageMemory2");
+    WriteLine("vkBindImageMemory2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
@@ -1272,14 +1272,14 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupPeerMemoryFeatures");
+    WriteLine("vkGetDeviceGroupPeerMemoryFeatures");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDeviceMask(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDeviceMask");
+    WriteLine("vkCmdSetDeviceMask");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatchBase(
@@ -1291,7 +1291,7 @@ void VulkanAsciiConsumer::Process_vkCmdDispatchBase(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatchBase");
+    WriteLine("vkCmdDispatchBase");
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroups(
@@ -1300,7 +1300,7 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroups(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDeviceGroups");
+    WriteLine("vkEnumeratePhysicalDeviceGroups");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2(
@@ -1308,7 +1308,7 @@ void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageMemoryRequirements2");
+    WriteLine("vkGetImageMemoryRequirements2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2(
@@ -1316,7 +1316,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferMemoryRequirements2");
+    WriteLine("vkGetBufferMemoryRequirements2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2(
@@ -1325,21 +1325,21 @@ void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSparseMemoryRequirements2");
+    WriteLine("vkGetImageSparseMemoryRequirements2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFeatures2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFeatures2");
+    WriteLine("vkGetPhysicalDeviceFeatures2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceProperties2");
+    WriteLine("vkGetPhysicalDeviceProperties2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
@@ -1347,7 +1347,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFormatProperties2");
+    WriteLine("vkGetPhysicalDeviceFormatProperties2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2(
@@ -1356,7 +1356,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2(
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceImageFormatProperties2");
+    WriteLine("vkGetPhysicalDeviceImageFormatProperties2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2(
@@ -1364,14 +1364,14 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyProperties2");
+    WriteLine("vkGetPhysicalDeviceQueueFamilyProperties2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMemoryProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMemoryProperties2");
+    WriteLine("vkGetPhysicalDeviceMemoryProperties2");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2(
@@ -1380,7 +1380,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSparseImageFormatProperties2");
+    WriteLine("vkGetPhysicalDeviceSparseImageFormatProperties2");
 }
 
 void VulkanAsciiConsumer::Process_vkTrimCommandPool(
@@ -1388,7 +1388,7 @@ void VulkanAsciiConsumer::Process_vkTrimCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    fprintf(GetFile(), "%s\n", "vkTrimCommandPool");
+    WriteLine("vkTrimCommandPool");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceQueue2(
@@ -1396,7 +1396,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceQueue2(
     StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceQueue2");
+    WriteLine("vkGetDeviceQueue2");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversion(
@@ -1406,7 +1406,7 @@ void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversion(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSamplerYcbcrConversion");
+    WriteLine("vkCreateSamplerYcbcrConversion");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversion(
@@ -1414,7 +1414,7 @@ void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversion(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySamplerYcbcrConversion");
+    WriteLine("vkDestroySamplerYcbcrConversion");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplate(
@@ -1424,7 +1424,7 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplate(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorUpdateTemplate");
+    WriteLine("vkCreateDescriptorUpdateTemplate");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplate(
@@ -1432,7 +1432,7 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplate(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorUpdateTemplate");
+    WriteLine("vkDestroyDescriptorUpdateTemplate");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferProperties(
@@ -1440,7 +1440,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferProperties(
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalBufferProperties");
+    WriteLine("vkGetPhysicalDeviceExternalBufferProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFenceProperties(
@@ -1448,7 +1448,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFenceProperties(
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalFenceProperties");
+    WriteLine("vkGetPhysicalDeviceExternalFenceProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties(
@@ -1456,7 +1456,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalSemaphoreProperties");
+    WriteLine("vkGetPhysicalDeviceExternalSemaphoreProperties");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupport(
@@ -1464,7 +1464,7 @@ void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupport(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDescriptorSetLayoutSupport");
+    WriteLine("vkGetDescriptorSetLayoutSupport");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCount(
@@ -1476,7 +1476,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectCount");
+    WriteLine("vkCmdDrawIndirectCount");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCount(
@@ -1488,7 +1488,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirectCount");
+    WriteLine("vkCmdDrawIndexedIndirectCount");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRenderPass2(
@@ -1498,7 +1498,7 @@ void VulkanAsciiConsumer::Process_vkCreateRenderPass2(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRenderPass2");
+    WriteLine("vkCreateRenderPass2");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2(
@@ -1506,7 +1506,7 @@ void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginRenderPass2");
+    WriteLine("vkCmdBeginRenderPass2");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdNextSubpass2(
@@ -1514,14 +1514,14 @@ void VulkanAsciiConsumer::Process_vkCmdNextSubpass2(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdNextSubpass2");
+    WriteLine("vkCmdNextSubpass2");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndRenderPass2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndRenderPass2");
+    WriteLine("vkCmdEndRenderPass2");
 }
 
 void VulkanAsciiConsumer::Process_vkResetQueryPool(
@@ -1530,7 +1530,7 @@ void VulkanAsciiConsumer::Process_vkResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    fprintf(GetFile(), "%s\n", "vkResetQueryPool");
+    WriteLine("vkResetQueryPool");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValue(
@@ -1539,7 +1539,7 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValue(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreCounterValue");
+    WriteLine("vkGetSemaphoreCounterValue");
 }
 
 void VulkanAsciiConsumer::Process_vkWaitSemaphores(
@@ -1548,7 +1548,7 @@ void VulkanAsciiConsumer::Process_vkWaitSemaphores(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    fprintf(GetFile(), "%s\n", "vkWaitSemaphores");
+    WriteLine("vkWaitSemaphores");
 }
 
 void VulkanAsciiConsumer::Process_vkSignalSemaphore(
@@ -1556,7 +1556,7 @@ void VulkanAsciiConsumer::Process_vkSignalSemaphore(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSignalSemaphore");
+    WriteLine("vkSignalSemaphore");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddress(
@@ -1564,7 +1564,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferDeviceAddress");
+    WriteLine("vkGetBufferDeviceAddress");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddress(
@@ -1572,7 +1572,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferOpaqueCaptureAddress");
+    WriteLine("vkGetBufferOpaqueCaptureAddress");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
@@ -1580,7 +1580,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceMemoryOpaqueCaptureAddress");
+    WriteLine("vkGetDeviceMemoryOpaqueCaptureAddress");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySurfaceKHR(
@@ -1588,7 +1588,7 @@ void VulkanAsciiConsumer::Process_vkDestroySurfaceKHR(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySurfaceKHR");
+    WriteLine("vkDestroySurfaceKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
@@ -1598,7 +1598,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
     format::HandleId                            surface,
     PointerDecoder<VkBool32>*                   pSupported)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceSupportKHR");
+    WriteLine("vkGetPhysicalDeviceSurfaceSupportKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
@@ -1607,7 +1607,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilitiesKHR>* pSurfaceCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    WriteLine("vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
@@ -1617,7 +1617,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormatKHR>* pSurfaceFormats)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceFormatsKHR");
+    WriteLine("vkGetPhysicalDeviceSurfaceFormatsKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR(
@@ -1627,7 +1627,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR(
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfacePresentModesKHR");
+    WriteLine("vkGetPhysicalDeviceSurfacePresentModesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSwapchainKHR(
@@ -1637,7 +1637,7 @@ void VulkanAsciiConsumer::Process_vkCreateSwapchainKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSwapchainKHR");
+    WriteLine("vkCreateSwapchainKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySwapchainKHR(
@@ -1645,7 +1645,7 @@ void VulkanAsciiConsumer::Process_vkDestroySwapchainKHR(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySwapchainKHR");
+    WriteLine("vkDestroySwapchainKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSwapchainImagesKHR(
@@ -1655,7 +1655,7 @@ void VulkanAsciiConsumer::Process_vkGetSwapchainImagesKHR(
     PointerDecoder<uint32_t>*                   pSwapchainImageCount,
     HandlePointerDecoder<VkImage>*              pSwapchainImages)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSwapchainImagesKHR");
+    WriteLine("vkGetSwapchainImagesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireNextImageKHR(
@@ -1667,7 +1667,7 @@ void VulkanAsciiConsumer::Process_vkAcquireNextImageKHR(
     format::HandleId                            fence,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireNextImageKHR");
+    WriteLine("vkAcquireNextImageKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkQueuePresentKHR(
@@ -1675,7 +1675,7 @@ void VulkanAsciiConsumer::Process_vkQueuePresentKHR(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkQueuePresentKHR");
+    WriteLine("vkQueuePresentKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
@@ -1683,7 +1683,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceGroupPresentCapabilitiesKHR>* pDeviceGroupPresentCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupPresentCapabilitiesKHR");
+    WriteLine("vkGetDeviceGroupPresentCapabilitiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
@@ -1692,7 +1692,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
     format::HandleId                            surface,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupSurfacePresentModesKHR");
+    WriteLine("vkGetDeviceGroupSurfacePresentModesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
@@ -1702,7 +1702,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
     PointerDecoder<uint32_t>*                   pRectCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pRects)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDevicePresentRectanglesKHR");
+    WriteLine("vkGetPhysicalDevicePresentRectanglesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireNextImage2KHR(
@@ -1711,7 +1711,7 @@ void VulkanAsciiConsumer::Process_vkAcquireNextImage2KHR(
     StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireNextImage2KHR");
+    WriteLine("vkAcquireNextImage2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
@@ -1720,7 +1720,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayPropertiesKHR");
+    WriteLine("vkGetPhysicalDeviceDisplayPropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
@@ -1729,7 +1729,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlanePropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+    WriteLine("vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
@@ -1739,7 +1739,7 @@ void VulkanAsciiConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
     PointerDecoder<uint32_t>*                   pDisplayCount,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplays)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayPlaneSupportedDisplaysKHR");
+    WriteLine("vkGetDisplayPlaneSupportedDisplaysKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayModePropertiesKHR(
@@ -1749,7 +1749,7 @@ void VulkanAsciiConsumer::Process_vkGetDisplayModePropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModePropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayModePropertiesKHR");
+    WriteLine("vkGetDisplayModePropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDisplayModeKHR(
@@ -1760,7 +1760,7 @@ void VulkanAsciiConsumer::Process_vkCreateDisplayModeKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDisplayModeKHR>*     pMode)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDisplayModeKHR");
+    WriteLine("vkCreateDisplayModeKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
@@ -1770,7 +1770,7 @@ void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
     uint32_t                                    planeIndex,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilitiesKHR>* pCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayPlaneCapabilitiesKHR");
+    WriteLine("vkGetDisplayPlaneCapabilitiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
@@ -1780,7 +1780,7 @@ void VulkanAsciiConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDisplayPlaneSurfaceKHR");
+    WriteLine("vkCreateDisplayPlaneSurfaceKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSharedSwapchainsKHR(
@@ -1791,7 +1791,7 @@ void VulkanAsciiConsumer::Process_vkCreateSharedSwapchainsKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSharedSwapchainsKHR");
+    WriteLine("vkCreateSharedSwapchainsKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateXlibSurfaceKHR(
@@ -1801,7 +1801,7 @@ void VulkanAsciiConsumer::Process_vkCreateXlibSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateXlibSurfaceKHR");
+    WriteLine("vkCreateXlibSurfaceKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(
@@ -1811,7 +1811,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(
     uint64_t                                    dpy,
     size_t                                      visualID)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+    WriteLine("vkGetPhysicalDeviceXlibPresentationSupportKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateXcbSurfaceKHR(
@@ -1821,7 +1821,7 @@ void VulkanAsciiConsumer::Process_vkCreateXcbSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateXcbSurfaceKHR");
+    WriteLine("vkCreateXcbSurfaceKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(
@@ -1831,7 +1831,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(
     uint64_t                                    connection,
     uint32_t                                    visual_id)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+    WriteLine("vkGetPhysicalDeviceXcbPresentationSupportKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateWaylandSurfaceKHR(
@@ -1841,7 +1841,7 @@ void VulkanAsciiConsumer::Process_vkCreateWaylandSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateWaylandSurfaceKHR");
+    WriteLine("vkCreateWaylandSurfaceKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
@@ -1850,7 +1850,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSupportK
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    display)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+    WriteLine("vkGetPhysicalDeviceWaylandPresentationSupportKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateAndroidSurfaceKHR(
@@ -1860,7 +1860,7 @@ void VulkanAsciiConsumer::Process_vkCreateAndroidSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateAndroidSurfaceKHR");
+    WriteLine("vkCreateAndroidSurfaceKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateWin32SurfaceKHR(
@@ -1870,7 +1870,7 @@ void VulkanAsciiConsumer::Process_vkCreateWin32SurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateWin32SurfaceKHR");
+    WriteLine("vkCreateWin32SurfaceKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWin32PresentationSupportKHR(
@@ -1878,21 +1878,21 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWin32PresentationSupportKHR
     format::HandleId                            physicalDevice,
     uint32_t                                    queueFamilyIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+    WriteLine("vkGetPhysicalDeviceWin32PresentationSupportKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFeatures2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFeatures2KHR");
+    WriteLine("vkGetPhysicalDeviceFeatures2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
@@ -1900,7 +1900,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFormatProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceFormatProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2KHR(
@@ -1909,7 +1909,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2KHR(
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceImageFormatProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceImageFormatProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
@@ -1917,14 +1917,14 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceQueueFamilyProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMemoryProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMemoryProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceMemoryProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
@@ -1933,7 +1933,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
@@ -1943,14 +1943,14 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupPeerMemoryFeaturesKHR");
+    WriteLine("vkGetDeviceGroupPeerMemoryFeaturesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDeviceMaskKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDeviceMaskKHR");
+    WriteLine("vkCmdSetDeviceMaskKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatchBaseKHR(
@@ -1962,7 +1962,7 @@ void VulkanAsciiConsumer::Process_vkCmdDispatchBaseKHR(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatchBaseKHR");
+    WriteLine("vkCmdDispatchBaseKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkTrimCommandPoolKHR(
@@ -1970,7 +1970,7 @@ void VulkanAsciiConsumer::Process_vkTrimCommandPoolKHR(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    fprintf(GetFile(), "%s\n", "vkTrimCommandPoolKHR");
+    WriteLine("vkTrimCommandPoolKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
@@ -1979,7 +1979,7 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDeviceGroupsKHR");
+    WriteLine("vkEnumeratePhysicalDeviceGroupsKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
@@ -1987,7 +1987,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+    WriteLine("vkGetPhysicalDeviceExternalBufferPropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleKHR(
@@ -1996,7 +1996,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleKHR(
     StructPointerDecoder<Decoded_VkMemoryGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryWin32HandleKHR");
+    WriteLine("vkGetMemoryWin32HandleKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
@@ -2006,7 +2006,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
     uint64_t                                    handle,
     StructPointerDecoder<Decoded_VkMemoryWin32HandlePropertiesKHR>* pMemoryWin32HandleProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryWin32HandlePropertiesKHR");
+    WriteLine("vkGetMemoryWin32HandlePropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryFdKHR(
@@ -2015,7 +2015,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryFdKHR(
     StructPointerDecoder<Decoded_VkMemoryGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryFdKHR");
+    WriteLine("vkGetMemoryFdKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryFdPropertiesKHR(
@@ -2025,7 +2025,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryFdPropertiesKHR(
     int                                         fd,
     StructPointerDecoder<Decoded_VkMemoryFdPropertiesKHR>* pMemoryFdProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryFdPropertiesKHR");
+    WriteLine("vkGetMemoryFdPropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
@@ -2033,7 +2033,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+    WriteLine("vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkImportSemaphoreWin32HandleKHR(
@@ -2041,7 +2041,7 @@ void VulkanAsciiConsumer::Process_vkImportSemaphoreWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreWin32HandleInfoKHR>* pImportSemaphoreWin32HandleInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportSemaphoreWin32HandleKHR");
+    WriteLine("vkImportSemaphoreWin32HandleKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreWin32HandleKHR(
@@ -2050,7 +2050,7 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreWin32HandleKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreWin32HandleKHR");
+    WriteLine("vkGetSemaphoreWin32HandleKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkImportSemaphoreFdKHR(
@@ -2058,7 +2058,7 @@ void VulkanAsciiConsumer::Process_vkImportSemaphoreFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreFdInfoKHR>* pImportSemaphoreFdInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportSemaphoreFdKHR");
+    WriteLine("vkImportSemaphoreFdKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreFdKHR(
@@ -2067,7 +2067,7 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreFdKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreFdKHR");
+    WriteLine("vkGetSemaphoreFdKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPushDescriptorSetKHR(
@@ -2078,7 +2078,7 @@ void VulkanAsciiConsumer::Process_vkCmdPushDescriptorSetKHR(
     uint32_t                                    descriptorWriteCount,
     StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPushDescriptorSetKHR");
+    WriteLine("vkCmdPushDescriptorSetKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
@@ -2088,7 +2088,7 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorUpdateTemplateKHR");
+    WriteLine("vkCreateDescriptorUpdateTemplateKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
@@ -2096,7 +2096,7 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorUpdateTemplateKHR");
+    WriteLine("vkDestroyDescriptorUpdateTemplateKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRenderPass2KHR(
@@ -2106,7 +2106,7 @@ void VulkanAsciiConsumer::Process_vkCreateRenderPass2KHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRenderPass2KHR");
+    WriteLine("vkCreateRenderPass2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2KHR(
@@ -2114,7 +2114,7 @@ void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2KHR(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginRenderPass2KHR");
+    WriteLine("vkCmdBeginRenderPass2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdNextSubpass2KHR(
@@ -2122,14 +2122,14 @@ void VulkanAsciiConsumer::Process_vkCmdNextSubpass2KHR(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdNextSubpass2KHR");
+    WriteLine("vkCmdNextSubpass2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndRenderPass2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndRenderPass2KHR");
+    WriteLine("vkCmdEndRenderPass2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSwapchainStatusKHR(
@@ -2137,7 +2137,7 @@ void VulkanAsciiConsumer::Process_vkGetSwapchainStatusKHR(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSwapchainStatusKHR");
+    WriteLine("vkGetSwapchainStatusKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(
@@ -2145,7 +2145,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalFencePropertiesKHR");
+    WriteLine("vkGetPhysicalDeviceExternalFencePropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkImportFenceWin32HandleKHR(
@@ -2153,7 +2153,7 @@ void VulkanAsciiConsumer::Process_vkImportFenceWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceWin32HandleInfoKHR>* pImportFenceWin32HandleInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportFenceWin32HandleKHR");
+    WriteLine("vkImportFenceWin32HandleKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetFenceWin32HandleKHR(
@@ -2162,7 +2162,7 @@ void VulkanAsciiConsumer::Process_vkGetFenceWin32HandleKHR(
     StructPointerDecoder<Decoded_VkFenceGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetFenceWin32HandleKHR");
+    WriteLine("vkGetFenceWin32HandleKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkImportFenceFdKHR(
@@ -2170,7 +2170,7 @@ void VulkanAsciiConsumer::Process_vkImportFenceFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceFdInfoKHR>* pImportFenceFdInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportFenceFdKHR");
+    WriteLine("vkImportFenceFdKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetFenceFdKHR(
@@ -2179,7 +2179,7 @@ void VulkanAsciiConsumer::Process_vkGetFenceFdKHR(
     StructPointerDecoder<Decoded_VkFenceGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    fprintf(GetFile(), "%s\n", "vkGetFenceFdKHR");
+    WriteLine("vkGetFenceFdKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(
@@ -2190,7 +2190,7 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanc
     StructPointerDecoder<Decoded_VkPerformanceCounterKHR>* pCounters,
     StructPointerDecoder<Decoded_VkPerformanceCounterDescriptionKHR>* pCounterDescriptions)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+    WriteLine("vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
@@ -2198,7 +2198,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformanceQuery
     StructPointerDecoder<Decoded_VkQueryPoolPerformanceCreateInfoKHR>* pPerformanceQueryCreateInfo,
     PointerDecoder<uint32_t>*                   pNumPasses)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+    WriteLine("vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireProfilingLockKHR(
@@ -2206,13 +2206,13 @@ void VulkanAsciiConsumer::Process_vkAcquireProfilingLockKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAcquireProfilingLockInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireProfilingLockKHR");
+    WriteLine("vkAcquireProfilingLockKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkReleaseProfilingLockKHR(
     format::HandleId                            device)
 {
-    fprintf(GetFile(), "%s\n", "vkReleaseProfilingLockKHR");
+    WriteLine("vkReleaseProfilingLockKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
@@ -2221,7 +2221,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2KHR>* pSurfaceCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+    WriteLine("vkGetPhysicalDeviceSurfaceCapabilities2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
@@ -2231,7 +2231,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormat2KHR>* pSurfaceFormats)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceFormats2KHR");
+    WriteLine("vkGetPhysicalDeviceSurfaceFormats2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
@@ -2240,7 +2240,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayProperties2KHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceDisplayProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
@@ -2249,7 +2249,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlaneProperties2KHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+    WriteLine("vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayModeProperties2KHR(
@@ -2259,7 +2259,7 @@ void VulkanAsciiConsumer::Process_vkGetDisplayModeProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModeProperties2KHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayModeProperties2KHR");
+    WriteLine("vkGetDisplayModeProperties2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
@@ -2268,7 +2268,7 @@ void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
     StructPointerDecoder<Decoded_VkDisplayPlaneInfo2KHR>* pDisplayPlaneInfo,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilities2KHR>* pCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayPlaneCapabilities2KHR");
+    WriteLine("vkGetDisplayPlaneCapabilities2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2KHR(
@@ -2276,7 +2276,7 @@ void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageMemoryRequirements2KHR");
+    WriteLine("vkGetImageMemoryRequirements2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2KHR(
@@ -2284,7 +2284,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferMemoryRequirements2KHR");
+    WriteLine("vkGetBufferMemoryRequirements2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
@@ -2293,7 +2293,7 @@ void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSparseMemoryRequirements2KHR");
+    WriteLine("vkGetImageSparseMemoryRequirements2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
@@ -2303,7 +2303,7 @@ void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSamplerYcbcrConversionKHR");
+    WriteLine("vkCreateSamplerYcbcrConversionKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
@@ -2311,7 +2311,7 @@ void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySamplerYcbcrConversionKHR");
+    WriteLine("vkDestroySamplerYcbcrConversionKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkBindBufferMemory2KHR(
@@ -2320,7 +2320,7 @@ void VulkanAsciiConsumer::Process_vkBindBufferMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindBufferMemory2KHR");
+    WriteLine("vkBindBufferMemory2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkBindImageMemory2KHR(
@@ -2329,7 +2329,7 @@ void VulkanAsciiConsumer::Process_vkBindImageMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindImageMemory2KHR");
+    WriteLine("vkBindImageMemory2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
@@ -2337,7 +2337,7 @@ void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDescriptorSetLayoutSupportKHR");
+    WriteLine("vkGetDescriptorSetLayoutSupportKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountKHR(
@@ -2349,7 +2349,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectCountKHR");
+    WriteLine("vkCmdDrawIndirectCountKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
@@ -2361,7 +2361,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirectCountKHR");
+    WriteLine("vkCmdDrawIndexedIndirectCountKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValueKHR(
@@ -2370,7 +2370,7 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValueKHR(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreCounterValueKHR");
+    WriteLine("vkGetSemaphoreCounterValueKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkWaitSemaphoresKHR(
@@ -2379,7 +2379,7 @@ void VulkanAsciiConsumer::Process_vkWaitSemaphoresKHR(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    fprintf(GetFile(), "%s\n", "vkWaitSemaphoresKHR");
+    WriteLine("vkWaitSemaphoresKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkSignalSemaphoreKHR(
@@ -2387,7 +2387,7 @@ void VulkanAsciiConsumer::Process_vkSignalSemaphoreKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSignalSemaphoreKHR");
+    WriteLine("vkSignalSemaphoreKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKHR(
@@ -2396,7 +2396,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKHR(
     PointerDecoder<uint32_t>*                   pFragmentShadingRateCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFragmentShadingRateKHR>* pFragmentShadingRates)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFragmentShadingRatesKHR");
+    WriteLine("vkGetPhysicalDeviceFragmentShadingRatesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateKHR(
@@ -2404,7 +2404,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateKHR(
     StructPointerDecoder<Decoded_VkExtent2D>*   pFragmentSize,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetFragmentShadingRateKHR");
+    WriteLine("vkCmdSetFragmentShadingRateKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressKHR(
@@ -2412,7 +2412,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferDeviceAddressKHR");
+    WriteLine("vkGetBufferDeviceAddressKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
@@ -2420,7 +2420,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferOpaqueCaptureAddressKHR");
+    WriteLine("vkGetBufferOpaqueCaptureAddressKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
@@ -2428,7 +2428,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    WriteLine("vkGetDeviceMemoryOpaqueCaptureAddressKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDeferredOperationKHR(
@@ -2437,7 +2437,7 @@ void VulkanAsciiConsumer::Process_vkCreateDeferredOperationKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeferredOperationKHR>* pDeferredOperation)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDeferredOperationKHR");
+    WriteLine("vkCreateDeferredOperationKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDeferredOperationKHR(
@@ -2445,7 +2445,7 @@ void VulkanAsciiConsumer::Process_vkDestroyDeferredOperationKHR(
     format::HandleId                            operation,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDeferredOperationKHR");
+    WriteLine("vkDestroyDeferredOperationKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
@@ -2453,7 +2453,7 @@ void VulkanAsciiConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeferredOperationMaxConcurrencyKHR");
+    WriteLine("vkGetDeferredOperationMaxConcurrencyKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeferredOperationResultKHR(
@@ -2461,7 +2461,7 @@ void VulkanAsciiConsumer::Process_vkGetDeferredOperationResultKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeferredOperationResultKHR");
+    WriteLine("vkGetDeferredOperationResultKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkDeferredOperationJoinKHR(
@@ -2469,7 +2469,7 @@ void VulkanAsciiConsumer::Process_vkDeferredOperationJoinKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    fprintf(GetFile(), "%s\n", "vkDeferredOperationJoinKHR");
+    WriteLine("vkDeferredOperationJoinKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
@@ -2479,7 +2479,7 @@ void VulkanAsciiConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
     PointerDecoder<uint32_t>*                   pExecutableCount,
     StructPointerDecoder<Decoded_VkPipelineExecutablePropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineExecutablePropertiesKHR");
+    WriteLine("vkGetPipelineExecutablePropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
@@ -2489,7 +2489,7 @@ void VulkanAsciiConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
     PointerDecoder<uint32_t>*                   pStatisticCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableStatisticKHR>* pStatistics)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineExecutableStatisticsKHR");
+    WriteLine("vkGetPipelineExecutableStatisticsKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineExecutableInternalRepresentationsKHR(
@@ -2499,7 +2499,7 @@ void VulkanAsciiConsumer::Process_vkGetPipelineExecutableInternalRepresentations
     PointerDecoder<uint32_t>*                   pInternalRepresentationCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableInternalRepresentationKHR>* pInternalRepresentations)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineExecutableInternalRepresentationsKHR");
+    WriteLine("vkGetPipelineExecutableInternalRepresentationsKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetEvent2KHR(
@@ -2507,7 +2507,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetEvent2KHR(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkDependencyInfoKHR>* pDependencyInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetEvent2KHR");
+    WriteLine("vkCmdSetEvent2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResetEvent2KHR(
@@ -2515,7 +2515,7 @@ void VulkanAsciiConsumer::Process_vkCmdResetEvent2KHR(
     format::HandleId                            event,
     VkPipelineStageFlags2KHR                    stageMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResetEvent2KHR");
+    WriteLine("vkCmdResetEvent2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWaitEvents2KHR(
@@ -2524,14 +2524,14 @@ void VulkanAsciiConsumer::Process_vkCmdWaitEvents2KHR(
     HandlePointerDecoder<VkEvent>*              pEvents,
     StructPointerDecoder<Decoded_VkDependencyInfoKHR>* pDependencyInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWaitEvents2KHR");
+    WriteLine("vkCmdWaitEvents2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPipelineBarrier2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDependencyInfoKHR>* pDependencyInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPipelineBarrier2KHR");
+    WriteLine("vkCmdPipelineBarrier2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteTimestamp2KHR(
@@ -2540,7 +2540,7 @@ void VulkanAsciiConsumer::Process_vkCmdWriteTimestamp2KHR(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteTimestamp2KHR");
+    WriteLine("vkCmdWriteTimestamp2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueSubmit2KHR(
@@ -2550,7 +2550,7 @@ void VulkanAsciiConsumer::Process_vkQueueSubmit2KHR(
     StructPointerDecoder<Decoded_VkSubmitInfo2KHR>* pSubmits,
     format::HandleId                            fence)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueSubmit2KHR");
+    WriteLine("vkQueueSubmit2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteBufferMarker2AMD(
@@ -2560,7 +2560,7 @@ void VulkanAsciiConsumer::Process_vkCmdWriteBufferMarker2AMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteBufferMarker2AMD");
+    WriteLine("vkCmdWriteBufferMarker2AMD");
 }
 
 void VulkanAsciiConsumer::Process_vkGetQueueCheckpointData2NV(
@@ -2568,49 +2568,49 @@ void VulkanAsciiConsumer::Process_vkGetQueueCheckpointData2NV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointData2NV>* pCheckpointData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetQueueCheckpointData2NV");
+    WriteLine("vkGetQueueCheckpointData2NV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2KHR>* pCopyBufferInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBuffer2KHR");
+    WriteLine("vkCmdCopyBuffer2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2KHR>* pCopyImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImage2KHR");
+    WriteLine("vkCmdCopyImage2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBufferToImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2KHR>* pCopyBufferToImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBufferToImage2KHR");
+    WriteLine("vkCmdCopyBufferToImage2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImageToBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2KHR>* pCopyImageToBufferInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImageToBuffer2KHR");
+    WriteLine("vkCmdCopyImageToBuffer2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBlitImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2KHR>* pBlitImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBlitImage2KHR");
+    WriteLine("vkCmdBlitImage2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResolveImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2KHR>* pResolveImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResolveImage2KHR");
+    WriteLine("vkCmdResolveImage2KHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDebugReportCallbackEXT(
@@ -2620,7 +2620,7 @@ void VulkanAsciiConsumer::Process_vkCreateDebugReportCallbackEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugReportCallbackEXT>* pCallback)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDebugReportCallbackEXT");
+    WriteLine("vkCreateDebugReportCallbackEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDebugReportCallbackEXT(
@@ -2628,7 +2628,7 @@ void VulkanAsciiConsumer::Process_vkDestroyDebugReportCallbackEXT(
     format::HandleId                            callback,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDebugReportCallbackEXT");
+    WriteLine("vkDestroyDebugReportCallbackEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDebugReportMessageEXT(
@@ -2641,7 +2641,7 @@ void VulkanAsciiConsumer::Process_vkDebugReportMessageEXT(
     StringDecoder*                              pLayerPrefix,
     StringDecoder*                              pMessage)
 {
-    fprintf(GetFile(), "%s\n", "vkDebugReportMessageEXT");
+    WriteLine("vkDebugReportMessageEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectTagEXT(
@@ -2649,7 +2649,7 @@ void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectTagInfoEXT>* pTagInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkDebugMarkerSetObjectTagEXT");
+    WriteLine("vkDebugMarkerSetObjectTagEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectNameEXT(
@@ -2657,27 +2657,27 @@ void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectNameInfoEXT>* pNameInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkDebugMarkerSetObjectNameEXT");
+    WriteLine("vkDebugMarkerSetObjectNameEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDebugMarkerBeginEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDebugMarkerBeginEXT");
+    WriteLine("vkCmdDebugMarkerBeginEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDebugMarkerEndEXT(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDebugMarkerEndEXT");
+    WriteLine("vkCmdDebugMarkerEndEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDebugMarkerInsertEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDebugMarkerInsertEXT");
+    WriteLine("vkCmdDebugMarkerInsertEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
@@ -2688,7 +2688,7 @@ void VulkanAsciiConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
     PointerDecoder<VkDeviceSize>*               pOffsets,
     PointerDecoder<VkDeviceSize>*               pSizes)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindTransformFeedbackBuffersEXT");
+    WriteLine("vkCmdBindTransformFeedbackBuffersEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginTransformFeedbackEXT(
@@ -2698,7 +2698,7 @@ void VulkanAsciiConsumer::Process_vkCmdBeginTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginTransformFeedbackEXT");
+    WriteLine("vkCmdBeginTransformFeedbackEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndTransformFeedbackEXT(
@@ -2708,7 +2708,7 @@ void VulkanAsciiConsumer::Process_vkCmdEndTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndTransformFeedbackEXT");
+    WriteLine("vkCmdEndTransformFeedbackEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginQueryIndexedEXT(
@@ -2718,7 +2718,7 @@ void VulkanAsciiConsumer::Process_vkCmdBeginQueryIndexedEXT(
     VkQueryControlFlags                         flags,
     uint32_t                                    index)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginQueryIndexedEXT");
+    WriteLine("vkCmdBeginQueryIndexedEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndQueryIndexedEXT(
@@ -2727,7 +2727,7 @@ void VulkanAsciiConsumer::Process_vkCmdEndQueryIndexedEXT(
     uint32_t                                    query,
     uint32_t                                    index)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndQueryIndexedEXT");
+    WriteLine("vkCmdEndQueryIndexedEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectByteCountEXT(
@@ -2739,7 +2739,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectByteCountEXT(
     uint32_t                                    counterOffset,
     uint32_t                                    vertexStride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectByteCountEXT");
+    WriteLine("vkCmdDrawIndirectByteCountEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageViewHandleNVX(
@@ -2747,7 +2747,7 @@ void VulkanAsciiConsumer::Process_vkGetImageViewHandleNVX(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImageViewHandleInfoNVX>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageViewHandleNVX");
+    WriteLine("vkGetImageViewHandleNVX");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageViewAddressNVX(
@@ -2756,7 +2756,7 @@ void VulkanAsciiConsumer::Process_vkGetImageViewAddressNVX(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkImageViewAddressPropertiesNVX>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageViewAddressNVX");
+    WriteLine("vkGetImageViewAddressNVX");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountAMD(
@@ -2768,7 +2768,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectCountAMD");
+    WriteLine("vkCmdDrawIndirectCountAMD");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
@@ -2780,7 +2780,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirectCountAMD");
+    WriteLine("vkCmdDrawIndexedIndirectCountAMD");
 }
 
 void VulkanAsciiConsumer::Process_vkGetShaderInfoAMD(
@@ -2792,7 +2792,7 @@ void VulkanAsciiConsumer::Process_vkGetShaderInfoAMD(
     PointerDecoder<size_t>*                     pInfoSize,
     PointerDecoder<uint8_t>*                    pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetShaderInfoAMD");
+    WriteLine("vkGetShaderInfoAMD");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
@@ -2802,7 +2802,7 @@ void VulkanAsciiConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateStreamDescriptorSurfaceGGP");
+    WriteLine("vkCreateStreamDescriptorSurfaceGGP");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
@@ -2816,7 +2816,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalImageFormatProperti
     VkExternalMemoryHandleTypeFlagsNV           externalHandleType,
     StructPointerDecoder<Decoded_VkExternalImageFormatPropertiesNV>* pExternalImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+    WriteLine("vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleNV(
@@ -2826,7 +2826,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleNV(
     VkExternalMemoryHandleTypeFlagsNV           handleType,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryWin32HandleNV");
+    WriteLine("vkGetMemoryWin32HandleNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateViSurfaceNN(
@@ -2836,20 +2836,20 @@ void VulkanAsciiConsumer::Process_vkCreateViSurfaceNN(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateViSurfaceNN");
+    WriteLine("vkCreateViSurfaceNN");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginConditionalRenderingEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkConditionalRenderingBeginInfoEXT>* pConditionalRenderingBegin)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginConditionalRenderingEXT");
+    WriteLine("vkCmdBeginConditionalRenderingEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndConditionalRenderingEXT(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndConditionalRenderingEXT");
+    WriteLine("vkCmdEndConditionalRenderingEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewportWScalingNV(
@@ -2858,7 +2858,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewportWScalingNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportWScalingNV>* pViewportWScalings)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewportWScalingNV");
+    WriteLine("vkCmdSetViewportWScalingNV");
 }
 
 void VulkanAsciiConsumer::Process_vkReleaseDisplayEXT(
@@ -2866,7 +2866,7 @@ void VulkanAsciiConsumer::Process_vkReleaseDisplayEXT(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    fprintf(GetFile(), "%s\n", "vkReleaseDisplayEXT");
+    WriteLine("vkReleaseDisplayEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireXlibDisplayEXT(
@@ -2875,7 +2875,7 @@ void VulkanAsciiConsumer::Process_vkAcquireXlibDisplayEXT(
     uint64_t                                    dpy,
     format::HandleId                            display)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireXlibDisplayEXT");
+    WriteLine("vkAcquireXlibDisplayEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetRandROutputDisplayEXT(
@@ -2885,7 +2885,7 @@ void VulkanAsciiConsumer::Process_vkGetRandROutputDisplayEXT(
     size_t                                      rrOutput,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRandROutputDisplayEXT");
+    WriteLine("vkGetRandROutputDisplayEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
@@ -2894,7 +2894,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2EXT>* pSurfaceCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+    WriteLine("vkGetPhysicalDeviceSurfaceCapabilities2EXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDisplayPowerControlEXT(
@@ -2903,7 +2903,7 @@ void VulkanAsciiConsumer::Process_vkDisplayPowerControlEXT(
     format::HandleId                            display,
     StructPointerDecoder<Decoded_VkDisplayPowerInfoEXT>* pDisplayPowerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkDisplayPowerControlEXT");
+    WriteLine("vkDisplayPowerControlEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkRegisterDeviceEventEXT(
@@ -2913,7 +2913,7 @@ void VulkanAsciiConsumer::Process_vkRegisterDeviceEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    fprintf(GetFile(), "%s\n", "vkRegisterDeviceEventEXT");
+    WriteLine("vkRegisterDeviceEventEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkRegisterDisplayEventEXT(
@@ -2924,7 +2924,7 @@ void VulkanAsciiConsumer::Process_vkRegisterDisplayEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    fprintf(GetFile(), "%s\n", "vkRegisterDisplayEventEXT");
+    WriteLine("vkRegisterDisplayEventEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSwapchainCounterEXT(
@@ -2934,7 +2934,7 @@ void VulkanAsciiConsumer::Process_vkGetSwapchainCounterEXT(
     VkSurfaceCounterFlagBitsEXT                 counter,
     PointerDecoder<uint64_t>*                   pCounterValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSwapchainCounterEXT");
+    WriteLine("vkGetSwapchainCounterEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
@@ -2943,7 +2943,7 @@ void VulkanAsciiConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRefreshCycleDurationGOOGLE");
+    WriteLine("vkGetRefreshCycleDurationGOOGLE");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPastPresentationTimingGOOGLE(
@@ -2953,7 +2953,7 @@ void VulkanAsciiConsumer::Process_vkGetPastPresentationTimingGOOGLE(
     PointerDecoder<uint32_t>*                   pPresentationTimingCount,
     StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPastPresentationTimingGOOGLE");
+    WriteLine("vkGetPastPresentationTimingGOOGLE");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDiscardRectangleEXT(
@@ -2962,7 +2962,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetDiscardRectangleEXT(
     uint32_t                                    discardRectangleCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pDiscardRectangles)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDiscardRectangleEXT");
+    WriteLine("vkCmdSetDiscardRectangleEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkSetHdrMetadataEXT(
@@ -2971,7 +2971,7 @@ void VulkanAsciiConsumer::Process_vkSetHdrMetadataEXT(
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains,
     StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata)
 {
-    fprintf(GetFile(), "%s\n", "vkSetHdrMetadataEXT");
+    WriteLine("vkSetHdrMetadataEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateIOSSurfaceMVK(
@@ -2981,7 +2981,7 @@ void VulkanAsciiConsumer::Process_vkCreateIOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateIOSSurfaceMVK");
+    WriteLine("vkCreateIOSSurfaceMVK");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateMacOSSurfaceMVK(
@@ -2991,7 +2991,7 @@ void VulkanAsciiConsumer::Process_vkCreateMacOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateMacOSSurfaceMVK");
+    WriteLine("vkCreateMacOSSurfaceMVK");
 }
 
 void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectNameEXT(
@@ -2999,7 +2999,7 @@ void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectNameInfoEXT>* pNameInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSetDebugUtilsObjectNameEXT");
+    WriteLine("vkSetDebugUtilsObjectNameEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectTagEXT(
@@ -3007,47 +3007,47 @@ void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectTagInfoEXT>* pTagInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSetDebugUtilsObjectTagEXT");
+    WriteLine("vkSetDebugUtilsObjectTagEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueBeginDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueBeginDebugUtilsLabelEXT");
+    WriteLine("vkQueueBeginDebugUtilsLabelEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueEndDebugUtilsLabelEXT(
     format::HandleId                            queue)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueEndDebugUtilsLabelEXT");
+    WriteLine("vkQueueEndDebugUtilsLabelEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueInsertDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueInsertDebugUtilsLabelEXT");
+    WriteLine("vkQueueInsertDebugUtilsLabelEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginDebugUtilsLabelEXT");
+    WriteLine("vkCmdBeginDebugUtilsLabelEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndDebugUtilsLabelEXT");
+    WriteLine("vkCmdEndDebugUtilsLabelEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdInsertDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdInsertDebugUtilsLabelEXT");
+    WriteLine("vkCmdInsertDebugUtilsLabelEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDebugUtilsMessengerEXT(
@@ -3057,7 +3057,7 @@ void VulkanAsciiConsumer::Process_vkCreateDebugUtilsMessengerEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugUtilsMessengerEXT>* pMessenger)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDebugUtilsMessengerEXT");
+    WriteLine("vkCreateDebugUtilsMessengerEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
@@ -3065,7 +3065,7 @@ void VulkanAsciiConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
     format::HandleId                            messenger,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDebugUtilsMessengerEXT");
+    WriteLine("vkDestroyDebugUtilsMessengerEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkSubmitDebugUtilsMessageEXT(
@@ -3074,7 +3074,7 @@ void VulkanAsciiConsumer::Process_vkSubmitDebugUtilsMessageEXT(
     VkDebugUtilsMessageTypeFlagsEXT             messageTypes,
     StructPointerDecoder<Decoded_VkDebugUtilsMessengerCallbackDataEXT>* pCallbackData)
 {
-    fprintf(GetFile(), "%s\n", "vkSubmitDebugUtilsMessageEXT");
+    WriteLine("vkSubmitDebugUtilsMessageEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDROID(
@@ -3083,7 +3083,7 @@ void VulkanAsciiConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDROID(
     uint64_t                                    buffer,
     StructPointerDecoder<Decoded_VkAndroidHardwareBufferPropertiesANDROID>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAndroidHardwareBufferPropertiesANDROID");
+    WriteLine("vkGetAndroidHardwareBufferPropertiesANDROID");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
@@ -3092,14 +3092,14 @@ void VulkanAsciiConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
     StructPointerDecoder<Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID>* pInfo,
     PointerDecoder<uint64_t, void*>*            pBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryAndroidHardwareBufferANDROID");
+    WriteLine("vkGetMemoryAndroidHardwareBufferANDROID");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetSampleLocationsEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSampleLocationsInfoEXT>* pSampleLocationsInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetSampleLocationsEXT");
+    WriteLine("vkCmdSetSampleLocationsEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(
@@ -3107,7 +3107,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(
     VkSampleCountFlagBits                       samples,
     StructPointerDecoder<Decoded_VkMultisamplePropertiesEXT>* pMultisampleProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+    WriteLine("vkGetPhysicalDeviceMultisamplePropertiesEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
@@ -3116,7 +3116,7 @@ void VulkanAsciiConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkImageDrmFormatModifierPropertiesEXT>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageDrmFormatModifierPropertiesEXT");
+    WriteLine("vkGetImageDrmFormatModifierPropertiesEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateValidationCacheEXT(
@@ -3126,7 +3126,7 @@ void VulkanAsciiConsumer::Process_vkCreateValidationCacheEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkValidationCacheEXT>* pValidationCache)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateValidationCacheEXT");
+    WriteLine("vkCreateValidationCacheEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyValidationCacheEXT(
@@ -3134,7 +3134,7 @@ void VulkanAsciiConsumer::Process_vkDestroyValidationCacheEXT(
     format::HandleId                            validationCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyValidationCacheEXT");
+    WriteLine("vkDestroyValidationCacheEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkMergeValidationCachesEXT(
@@ -3144,7 +3144,7 @@ void VulkanAsciiConsumer::Process_vkMergeValidationCachesEXT(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkValidationCacheEXT>* pSrcCaches)
 {
-    fprintf(GetFile(), "%s\n", "vkMergeValidationCachesEXT");
+    WriteLine("vkMergeValidationCachesEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetValidationCacheDataEXT(
@@ -3154,7 +3154,7 @@ void VulkanAsciiConsumer::Process_vkGetValidationCacheDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetValidationCacheDataEXT");
+    WriteLine("vkGetValidationCacheDataEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindShadingRateImageNV(
@@ -3162,7 +3162,7 @@ void VulkanAsciiConsumer::Process_vkCmdBindShadingRateImageNV(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindShadingRateImageNV");
+    WriteLine("vkCmdBindShadingRateImageNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
@@ -3171,7 +3171,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkShadingRatePaletteNV>* pShadingRatePalettes)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewportShadingRatePaletteNV");
+    WriteLine("vkCmdSetViewportShadingRatePaletteNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetCoarseSampleOrderNV(
@@ -3180,7 +3180,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetCoarseSampleOrderNV(
     uint32_t                                    customSampleOrderCount,
     StructPointerDecoder<Decoded_VkCoarseSampleOrderCustomNV>* pCustomSampleOrders)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetCoarseSampleOrderNV");
+    WriteLine("vkCmdSetCoarseSampleOrderNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureNV(
@@ -3190,7 +3190,7 @@ void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureNV>* pAccelerationStructure)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateAccelerationStructureNV");
+    WriteLine("vkCreateAccelerationStructureNV");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureNV(
@@ -3198,7 +3198,7 @@ void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureNV(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyAccelerationStructureNV");
+    WriteLine("vkDestroyAccelerationStructureNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureMemoryRequirementsNV(
@@ -3206,7 +3206,7 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureMemoryRequirementsNV
     StructPointerDecoder<Decoded_VkAccelerationStructureMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2KHR>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureMemoryRequirementsNV");
+    WriteLine("vkGetAccelerationStructureMemoryRequirementsNV");
 }
 
 void VulkanAsciiConsumer::Process_vkBindAccelerationStructureMemoryNV(
@@ -3215,7 +3215,7 @@ void VulkanAsciiConsumer::Process_vkBindAccelerationStructureMemoryNV(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindAccelerationStructureMemoryInfoNV>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindAccelerationStructureMemoryNV");
+    WriteLine("vkBindAccelerationStructureMemoryNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructureNV(
@@ -3229,7 +3229,7 @@ void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructureNV(
     format::HandleId                            scratch,
     VkDeviceSize                                scratchOffset)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBuildAccelerationStructureNV");
+    WriteLine("vkCmdBuildAccelerationStructureNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureNV(
@@ -3238,7 +3238,7 @@ void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureNV(
     format::HandleId                            src,
     VkCopyAccelerationStructureModeKHR          mode)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyAccelerationStructureNV");
+    WriteLine("vkCmdCopyAccelerationStructureNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdTraceRaysNV(
@@ -3258,7 +3258,7 @@ void VulkanAsciiConsumer::Process_vkCmdTraceRaysNV(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdTraceRaysNV");
+    WriteLine("vkCmdTraceRaysNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesNV(
@@ -3270,7 +3270,7 @@ void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRayTracingPipelinesNV");
+    WriteLine("vkCreateRayTracingPipelinesNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
@@ -3282,7 +3282,7 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingShaderGroupHandlesKHR");
+    WriteLine("vkGetRayTracingShaderGroupHandlesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
@@ -3294,7 +3294,7 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingShaderGroupHandlesNV");
+    WriteLine("vkGetRayTracingShaderGroupHandlesNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureHandleNV(
@@ -3304,7 +3304,7 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureHandleNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureHandleNV");
+    WriteLine("vkGetAccelerationStructureHandleNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesNV(
@@ -3315,7 +3315,7 @@ void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesNV(
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteAccelerationStructuresPropertiesNV");
+    WriteLine("vkCmdWriteAccelerationStructuresPropertiesNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCompileDeferredNV(
@@ -3324,7 +3324,7 @@ void VulkanAsciiConsumer::Process_vkCompileDeferredNV(
     format::HandleId                            pipeline,
     uint32_t                                    shader)
 {
-    fprintf(GetFile(), "%s\n", "vkCompileDeferredNV");
+    WriteLine("vkCompileDeferredNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
@@ -3334,7 +3334,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
     uint64_t                                    pHostPointer,
     StructPointerDecoder<Decoded_VkMemoryHostPointerPropertiesEXT>* pMemoryHostPointerProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryHostPointerPropertiesEXT");
+    WriteLine("vkGetMemoryHostPointerPropertiesEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteBufferMarkerAMD(
@@ -3344,7 +3344,7 @@ void VulkanAsciiConsumer::Process_vkCmdWriteBufferMarkerAMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteBufferMarkerAMD");
+    WriteLine("vkCmdWriteBufferMarkerAMD");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(
@@ -3353,7 +3353,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainEXT>*            pTimeDomains)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+    WriteLine("vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetCalibratedTimestampsEXT(
@@ -3364,7 +3364,7 @@ void VulkanAsciiConsumer::Process_vkGetCalibratedTimestampsEXT(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    fprintf(GetFile(), "%s\n", "vkGetCalibratedTimestampsEXT");
+    WriteLine("vkGetCalibratedTimestampsEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksNV(
@@ -3372,7 +3372,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksNV(
     uint32_t                                    taskCount,
     uint32_t                                    firstTask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMeshTasksNV");
+    WriteLine("vkCmdDrawMeshTasksNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
@@ -3382,7 +3382,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMeshTasksIndirectNV");
+    WriteLine("vkCmdDrawMeshTasksIndirectNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
@@ -3394,7 +3394,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMeshTasksIndirectCountNV");
+    WriteLine("vkCmdDrawMeshTasksIndirectCountNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetExclusiveScissorNV(
@@ -3403,14 +3403,14 @@ void VulkanAsciiConsumer::Process_vkCmdSetExclusiveScissorNV(
     uint32_t                                    exclusiveScissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pExclusiveScissors)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetExclusiveScissorNV");
+    WriteLine("vkCmdSetExclusiveScissorNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetCheckpointNV(
     format::HandleId                            commandBuffer,
     uint64_t                                    pCheckpointMarker)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetCheckpointNV");
+    WriteLine("vkCmdSetCheckpointNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetQueueCheckpointDataNV(
@@ -3418,7 +3418,7 @@ void VulkanAsciiConsumer::Process_vkGetQueueCheckpointDataNV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointDataNV>* pCheckpointData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetQueueCheckpointDataNV");
+    WriteLine("vkGetQueueCheckpointDataNV");
 }
 
 void VulkanAsciiConsumer::Process_vkInitializePerformanceApiINTEL(
@@ -3426,13 +3426,13 @@ void VulkanAsciiConsumer::Process_vkInitializePerformanceApiINTEL(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkInitializePerformanceApiInfoINTEL>* pInitializeInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkInitializePerformanceApiINTEL");
+    WriteLine("vkInitializePerformanceApiINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkUninitializePerformanceApiINTEL(
     format::HandleId                            device)
 {
-    fprintf(GetFile(), "%s\n", "vkUninitializePerformanceApiINTEL");
+    WriteLine("vkUninitializePerformanceApiINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
@@ -3440,7 +3440,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceMarkerInfoINTEL>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPerformanceMarkerINTEL");
+    WriteLine("vkCmdSetPerformanceMarkerINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
@@ -3448,7 +3448,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceStreamMarkerInfoINTEL>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPerformanceStreamMarkerINTEL");
+    WriteLine("vkCmdSetPerformanceStreamMarkerINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
@@ -3456,7 +3456,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceOverrideInfoINTEL>* pOverrideInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPerformanceOverrideINTEL");
+    WriteLine("vkCmdSetPerformanceOverrideINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
@@ -3465,7 +3465,7 @@ void VulkanAsciiConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
     StructPointerDecoder<Decoded_VkPerformanceConfigurationAcquireInfoINTEL>* pAcquireInfo,
     HandlePointerDecoder<VkPerformanceConfigurationINTEL>* pConfiguration)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquirePerformanceConfigurationINTEL");
+    WriteLine("vkAcquirePerformanceConfigurationINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkReleasePerformanceConfigurationINTEL(
@@ -3473,7 +3473,7 @@ void VulkanAsciiConsumer::Process_vkReleasePerformanceConfigurationINTEL(
     format::HandleId                            device,
     format::HandleId                            configuration)
 {
-    fprintf(GetFile(), "%s\n", "vkReleasePerformanceConfigurationINTEL");
+    WriteLine("vkReleasePerformanceConfigurationINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
@@ -3481,7 +3481,7 @@ void VulkanAsciiConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
     format::HandleId                            queue,
     format::HandleId                            configuration)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueSetPerformanceConfigurationINTEL");
+    WriteLine("vkQueueSetPerformanceConfigurationINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPerformanceParameterINTEL(
@@ -3490,7 +3490,7 @@ void VulkanAsciiConsumer::Process_vkGetPerformanceParameterINTEL(
     VkPerformanceParameterTypeINTEL             parameter,
     StructPointerDecoder<Decoded_VkPerformanceValueINTEL>* pValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPerformanceParameterINTEL");
+    WriteLine("vkGetPerformanceParameterINTEL");
 }
 
 void VulkanAsciiConsumer::Process_vkSetLocalDimmingAMD(
@@ -3498,7 +3498,7 @@ void VulkanAsciiConsumer::Process_vkSetLocalDimmingAMD(
     format::HandleId                            swapChain,
     VkBool32                                    localDimmingEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkSetLocalDimmingAMD");
+    WriteLine("vkSetLocalDimmingAMD");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
@@ -3508,7 +3508,7 @@ void VulkanAsciiConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateImagePipeSurfaceFUCHSIA");
+    WriteLine("vkCreateImagePipeSurfaceFUCHSIA");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateMetalSurfaceEXT(
@@ -3518,7 +3518,7 @@ void VulkanAsciiConsumer::Process_vkCreateMetalSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateMetalSurfaceEXT");
+    WriteLine("vkCreateMetalSurfaceEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressEXT(
@@ -3526,7 +3526,7 @@ void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferDeviceAddressEXT");
+    WriteLine("vkGetBufferDeviceAddressEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
@@ -3535,7 +3535,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolPropertiesEXT>* pToolProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceToolPropertiesEXT");
+    WriteLine("vkGetPhysicalDeviceToolPropertiesEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(
@@ -3544,7 +3544,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesNV>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+    WriteLine("vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(
@@ -3553,7 +3553,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMixedSa
     PointerDecoder<uint32_t>*                   pCombinationCount,
     StructPointerDecoder<Decoded_VkFramebufferMixedSamplesCombinationNV>* pCombinations)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+    WriteLine("vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(
@@ -3563,7 +3563,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfacePresentModes2EXT");
+    WriteLine("vkGetPhysicalDeviceSurfacePresentModes2EXT");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
@@ -3571,7 +3571,7 @@ void VulkanAsciiConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireFullScreenExclusiveModeEXT");
+    WriteLine("vkAcquireFullScreenExclusiveModeEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
@@ -3579,7 +3579,7 @@ void VulkanAsciiConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkReleaseFullScreenExclusiveModeEXT");
+    WriteLine("vkReleaseFullScreenExclusiveModeEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
@@ -3588,7 +3588,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupSurfacePresentModes2EXT");
+    WriteLine("vkGetDeviceGroupSurfacePresentModes2EXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateHeadlessSurfaceEXT(
@@ -3598,7 +3598,7 @@ void VulkanAsciiConsumer::Process_vkCreateHeadlessSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateHeadlessSurfaceEXT");
+    WriteLine("vkCreateHeadlessSurfaceEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetLineStippleEXT(
@@ -3606,7 +3606,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetLineStippleEXT(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetLineStippleEXT");
+    WriteLine("vkCmdSetLineStippleEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkResetQueryPoolEXT(
@@ -3615,28 +3615,28 @@ void VulkanAsciiConsumer::Process_vkResetQueryPoolEXT(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    fprintf(GetFile(), "%s\n", "vkResetQueryPoolEXT");
+    WriteLine("vkResetQueryPoolEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetCullModeEXT(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetCullModeEXT");
+    WriteLine("vkCmdSetCullModeEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetFrontFaceEXT(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetFrontFaceEXT");
+    WriteLine("vkCmdSetFrontFaceEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPrimitiveTopologyEXT(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPrimitiveTopologyEXT");
+    WriteLine("vkCmdSetPrimitiveTopologyEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewportWithCountEXT(
@@ -3644,7 +3644,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewportWithCountEXT(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewportWithCountEXT");
+    WriteLine("vkCmdSetViewportWithCountEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetScissorWithCountEXT(
@@ -3652,7 +3652,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetScissorWithCountEXT(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetScissorWithCountEXT");
+    WriteLine("vkCmdSetScissorWithCountEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers2EXT(
@@ -3664,42 +3664,42 @@ void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers2EXT(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindVertexBuffers2EXT");
+    WriteLine("vkCmdBindVertexBuffers2EXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthTestEnableEXT");
+    WriteLine("vkCmdSetDepthTestEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthWriteEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthWriteEnableEXT");
+    WriteLine("vkCmdSetDepthWriteEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthCompareOpEXT(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthCompareOpEXT");
+    WriteLine("vkCmdSetDepthCompareOpEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthBoundsTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthBoundsTestEnableEXT");
+    WriteLine("vkCmdSetDepthBoundsTestEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilTestEnableEXT");
+    WriteLine("vkCmdSetStencilTestEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilOpEXT(
@@ -3710,7 +3710,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilOpEXT(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilOpEXT");
+    WriteLine("vkCmdSetStencilOpEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsNV(
@@ -3718,14 +3718,14 @@ void VulkanAsciiConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsNV(
     StructPointerDecoder<Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetGeneratedCommandsMemoryRequirementsNV");
+    WriteLine("vkGetGeneratedCommandsMemoryRequirementsNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPreprocessGeneratedCommandsNV(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPreprocessGeneratedCommandsNV");
+    WriteLine("vkCmdPreprocessGeneratedCommandsNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
@@ -3733,7 +3733,7 @@ void VulkanAsciiConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
     VkBool32                                    isPreprocessed,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdExecuteGeneratedCommandsNV");
+    WriteLine("vkCmdExecuteGeneratedCommandsNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindPipelineShaderGroupNV(
@@ -3742,7 +3742,7 @@ void VulkanAsciiConsumer::Process_vkCmdBindPipelineShaderGroupNV(
     format::HandleId                            pipeline,
     uint32_t                                    groupIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindPipelineShaderGroupNV");
+    WriteLine("vkCmdBindPipelineShaderGroupNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateIndirectCommandsLayoutNV(
@@ -3752,7 +3752,7 @@ void VulkanAsciiConsumer::Process_vkCreateIndirectCommandsLayoutNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkIndirectCommandsLayoutNV>* pIndirectCommandsLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateIndirectCommandsLayoutNV");
+    WriteLine("vkCreateIndirectCommandsLayoutNV");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
@@ -3760,7 +3760,7 @@ void VulkanAsciiConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
     format::HandleId                            indirectCommandsLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyIndirectCommandsLayoutNV");
+    WriteLine("vkDestroyIndirectCommandsLayoutNV");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireDrmDisplayEXT(
@@ -3769,7 +3769,7 @@ void VulkanAsciiConsumer::Process_vkAcquireDrmDisplayEXT(
     int32_t                                     drmFd,
     format::HandleId                            display)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireDrmDisplayEXT");
+    WriteLine("vkAcquireDrmDisplayEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDrmDisplayEXT(
@@ -3779,7 +3779,7 @@ void VulkanAsciiConsumer::Process_vkGetDrmDisplayEXT(
     uint32_t                                    connectorId,
     HandlePointerDecoder<VkDisplayKHR>*         display)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDrmDisplayEXT");
+    WriteLine("vkGetDrmDisplayEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCreatePrivateDataSlotEXT(
@@ -3789,7 +3789,7 @@ void VulkanAsciiConsumer::Process_vkCreatePrivateDataSlotEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlotEXT>* pPrivateDataSlot)
 {
-    fprintf(GetFile(), "%s\n", "vkCreatePrivateDataSlotEXT");
+    WriteLine("vkCreatePrivateDataSlotEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPrivateDataSlotEXT(
@@ -3797,7 +3797,7 @@ void VulkanAsciiConsumer::Process_vkDestroyPrivateDataSlotEXT(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPrivateDataSlotEXT");
+    WriteLine("vkDestroyPrivateDataSlotEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkSetPrivateDataEXT(
@@ -3808,7 +3808,7 @@ void VulkanAsciiConsumer::Process_vkSetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    fprintf(GetFile(), "%s\n", "vkSetPrivateDataEXT");
+    WriteLine("vkSetPrivateDataEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPrivateDataEXT(
@@ -3818,7 +3818,7 @@ void VulkanAsciiConsumer::Process_vkGetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPrivateDataEXT");
+    WriteLine("vkGetPrivateDataEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
@@ -3826,7 +3826,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
     VkFragmentShadingRateNV                     shadingRate,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetFragmentShadingRateEnumNV");
+    WriteLine("vkCmdSetFragmentShadingRateEnumNV");
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireWinrtDisplayNV(
@@ -3834,7 +3834,7 @@ void VulkanAsciiConsumer::Process_vkAcquireWinrtDisplayNV(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireWinrtDisplayNV");
+    WriteLine("vkAcquireWinrtDisplayNV");
 }
 
 void VulkanAsciiConsumer::Process_vkGetWinrtDisplayNV(
@@ -3843,7 +3843,7 @@ void VulkanAsciiConsumer::Process_vkGetWinrtDisplayNV(
     uint32_t                                    deviceRelativeId,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    fprintf(GetFile(), "%s\n", "vkGetWinrtDisplayNV");
+    WriteLine("vkGetWinrtDisplayNV");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDirectFBSurfaceEXT(
@@ -3853,7 +3853,7 @@ void VulkanAsciiConsumer::Process_vkCreateDirectFBSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDirectFBSurfaceEXT");
+    WriteLine("vkCreateDirectFBSurfaceEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(
@@ -3862,7 +3862,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSupport
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    dfb)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+    WriteLine("vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetVertexInputEXT(
@@ -3872,7 +3872,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetVertexInputEXT(
     uint32_t                                    vertexAttributeDescriptionCount,
     StructPointerDecoder<Decoded_VkVertexInputAttributeDescription2EXT>* pVertexAttributeDescriptions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetVertexInputEXT");
+    WriteLine("vkCmdSetVertexInputEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryZirconHandleFUCHSIA(
@@ -3881,7 +3881,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkMemoryGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryZirconHandleFUCHSIA");
+    WriteLine("vkGetMemoryZirconHandleFUCHSIA");
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(
@@ -3891,7 +3891,7 @@ void VulkanAsciiConsumer::Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(
     uint32_t                                    zirconHandle,
     StructPointerDecoder<Decoded_VkMemoryZirconHandlePropertiesFUCHSIA>* pMemoryZirconHandleProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryZirconHandlePropertiesFUCHSIA");
+    WriteLine("vkGetMemoryZirconHandlePropertiesFUCHSIA");
 }
 
 void VulkanAsciiConsumer::Process_vkImportSemaphoreZirconHandleFUCHSIA(
@@ -3899,7 +3899,7 @@ void VulkanAsciiConsumer::Process_vkImportSemaphoreZirconHandleFUCHSIA(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreZirconHandleInfoFUCHSIA>* pImportSemaphoreZirconHandleInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportSemaphoreZirconHandleFUCHSIA");
+    WriteLine("vkImportSemaphoreZirconHandleFUCHSIA");
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreZirconHandleFUCHSIA(
@@ -3908,42 +3908,42 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkSemaphoreGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreZirconHandleFUCHSIA");
+    WriteLine("vkGetSemaphoreZirconHandleFUCHSIA");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPatchControlPointsEXT(
     format::HandleId                            commandBuffer,
     uint32_t                                    patchControlPoints)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPatchControlPointsEXT");
+    WriteLine("vkCmdSetPatchControlPointsEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetRasterizerDiscardEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    rasterizerDiscardEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetRasterizerDiscardEnableEXT");
+    WriteLine("vkCmdSetRasterizerDiscardEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthBiasEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBiasEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthBiasEnableEXT");
+    WriteLine("vkCmdSetDepthBiasEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetLogicOpEXT(
     format::HandleId                            commandBuffer,
     VkLogicOp                                   logicOp)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetLogicOpEXT");
+    WriteLine("vkCmdSetLogicOpEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPrimitiveRestartEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    primitiveRestartEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPrimitiveRestartEnableEXT");
+    WriteLine("vkCmdSetPrimitiveRestartEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateScreenSurfaceQNX(
@@ -3953,7 +3953,7 @@ void VulkanAsciiConsumer::Process_vkCreateScreenSurfaceQNX(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateScreenSurfaceQNX");
+    WriteLine("vkCreateScreenSurfaceQNX");
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceScreenPresentationSupportQNX(
@@ -3962,7 +3962,7 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceScreenPresentationSupportQN
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    window)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceScreenPresentationSupportQNX");
+    WriteLine("vkGetPhysicalDeviceScreenPresentationSupportQNX");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetColorWriteEnableEXT(
@@ -3970,7 +3970,7 @@ void VulkanAsciiConsumer::Process_vkCmdSetColorWriteEnableEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkBool32>*                   pColorWriteEnables)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetColorWriteEnableEXT");
+    WriteLine("vkCmdSetColorWriteEnableEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMultiEXT(
@@ -3981,7 +3981,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMultiEXT(
     uint32_t                                    firstInstance,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMultiEXT");
+    WriteLine("vkCmdDrawMultiEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMultiIndexedEXT(
@@ -3993,7 +3993,7 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMultiIndexedEXT(
     uint32_t                                    stride,
     PointerDecoder<int32_t>*                    pVertexOffset)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMultiIndexedEXT");
+    WriteLine("vkCmdDrawMultiIndexedEXT");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureKHR(
@@ -4003,7 +4003,7 @@ void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructure)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateAccelerationStructureKHR");
+    WriteLine("vkCreateAccelerationStructureKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureKHR(
@@ -4011,7 +4011,7 @@ void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureKHR(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyAccelerationStructureKHR");
+    WriteLine("vkDestroyAccelerationStructureKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
@@ -4020,7 +4020,7 @@ void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>* ppBuildRangeInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBuildAccelerationStructuresKHR");
+    WriteLine("vkCmdBuildAccelerationStructuresKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresIndirectKHR(
@@ -4031,7 +4031,7 @@ void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresIndirectKHR(
     PointerDecoder<uint32_t>*                   pIndirectStrides,
     PointerDecoder<uint32_t*>*                  ppMaxPrimitiveCounts)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBuildAccelerationStructuresIndirectKHR");
+    WriteLine("vkCmdBuildAccelerationStructuresIndirectKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
@@ -4040,7 +4040,7 @@ void VulkanAsciiConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCopyAccelerationStructureToMemoryKHR");
+    WriteLine("vkCopyAccelerationStructureToMemoryKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
@@ -4049,7 +4049,7 @@ void VulkanAsciiConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCopyMemoryToAccelerationStructureKHR");
+    WriteLine("vkCopyMemoryToAccelerationStructureKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkWriteAccelerationStructuresPropertiesKHR(
@@ -4062,28 +4062,28 @@ void VulkanAsciiConsumer::Process_vkWriteAccelerationStructuresPropertiesKHR(
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    fprintf(GetFile(), "%s\n", "vkWriteAccelerationStructuresPropertiesKHR");
+    WriteLine("vkWriteAccelerationStructuresPropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyAccelerationStructureKHR");
+    WriteLine("vkCmdCopyAccelerationStructureKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureToMemoryKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyAccelerationStructureToMemoryKHR");
+    WriteLine("vkCmdCopyAccelerationStructureToMemoryKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyMemoryToAccelerationStructureKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyMemoryToAccelerationStructureKHR");
+    WriteLine("vkCmdCopyMemoryToAccelerationStructureKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureDeviceAddressKHR(
@@ -4091,7 +4091,7 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureDeviceAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureDeviceAddressKHR");
+    WriteLine("vkGetAccelerationStructureDeviceAddressKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesKHR(
@@ -4102,7 +4102,7 @@ void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesKHR(
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteAccelerationStructuresPropertiesKHR");
+    WriteLine("vkCmdWriteAccelerationStructuresPropertiesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceAccelerationStructureCompatibilityKHR(
@@ -4110,7 +4110,7 @@ void VulkanAsciiConsumer::Process_vkGetDeviceAccelerationStructureCompatibilityK
     StructPointerDecoder<Decoded_VkAccelerationStructureVersionInfoKHR>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceAccelerationStructureCompatibilityKHR");
+    WriteLine("vkGetDeviceAccelerationStructureCompatibilityKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
@@ -4120,7 +4120,7 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
     PointerDecoder<uint32_t>*                   pMaxPrimitiveCounts,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildSizesInfoKHR>* pSizeInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureBuildSizesKHR");
+    WriteLine("vkGetAccelerationStructureBuildSizesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdTraceRaysKHR(
@@ -4133,7 +4133,7 @@ void VulkanAsciiConsumer::Process_vkCmdTraceRaysKHR(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdTraceRaysKHR");
+    WriteLine("vkCmdTraceRaysKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesKHR(
@@ -4146,7 +4146,7 @@ void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRayTracingPipelinesKHR");
+    WriteLine("vkCreateRayTracingPipelinesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(
@@ -4158,7 +4158,7 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHandles
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+    WriteLine("vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdTraceRaysIndirectKHR(
@@ -4169,7 +4169,7 @@ void VulkanAsciiConsumer::Process_vkCmdTraceRaysIndirectKHR(
     StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdTraceRaysIndirectKHR");
+    WriteLine("vkCmdTraceRaysIndirectKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
@@ -4179,14 +4179,14 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
     uint32_t                                    group,
     VkShaderGroupShaderKHR                      groupShader)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingShaderGroupStackSizeKHR");
+    WriteLine("vkGetRayTracingShaderGroupStackSizeKHR");
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetRayTracingPipelineStackSizeKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    pipelineStackSize)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetRayTracingPipelineStackSizeKHR");
+    WriteLine("vkCmdSetRayTracingPipelineStackSizeKHR");
 }
 
 GFXRECON_END_NAMESPACE(decode)
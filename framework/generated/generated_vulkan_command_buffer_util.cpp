@@ -42,8 +42,8 @@ void TrackBeginCommandBufferHandles(CommandBufferWrapper* wrapper, const VkComma
     {
         if (pBeginInfo->pInheritanceInfo != nullptr)
         {
-            wrapper->command_handles[CommandHandleType::RenderPassHandle].insert(GetWrappedId(pBeginInfo->pInheritanceInfo->renderPass));
-            wrapper->command_handles[CommandHandleType::FramebufferHandle].insert(GetWrappedId(pBeginInfo->pInheritanceInfo->framebuffer));
+            wrapper->command_handles[CommandHandleType::RenderPassHandle].push_back(GetWrappedId(pBeginInfo->pInheritanceInfo->renderPass));
+            wrapper->command_handles[CommandHandleType::FramebufferHandle].push_back(GetWrappedId(pBeginInfo->pInheritanceInfo->framebuffer));
         }
     }
 }
@@ -52,20 +52,20 @@ void TrackCmdBindPipelineHandles(CommandBufferWrapper* wrapper, VkPipeline pipel
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::PipelineHandle].insert(GetWrappedId(pipeline));
+    wrapper->command_handles[CommandHandleType::PipelineHandle].push_back(GetWrappedId(pipeline));
 }
 
 void TrackCmdBindDescriptorSetsHandles(CommandBufferWrapper* wrapper, VkPipelineLayout layout, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::PipelineLayoutHandle].insert(GetWrappedId(layout));
+    wrapper->command_handles[CommandHandleType::PipelineLayoutHandle].push_back(GetWrappedId(layout));
 
     if (pDescriptorSets != nullptr)
     {
         for (uint32_t pDescriptorSets_index = 0; pDescriptorSets_index < descriptorSetCount; ++pDescriptorSets_index)
         {
-            wrapper->command_handles[CommandHandleType::DescriptorSetHandle].insert(GetWrappedId(pDescriptorSets[pDescriptorSets_index]));
+            wrapper->command_handles[CommandHandleType::DescriptorSetHandle].push_back(GetWrappedId(pDescriptorSets[pDescriptorSets_index]));
         }
     }
 }
@@ -74,7 +74,7 @@ void TrackCmdBindIndexBufferHandles(CommandBufferWrapper* wrapper, VkBuffer buff
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
 }
 
 void TrackCmdBindVertexBuffersHandles(CommandBufferWrapper* wrapper, uint32_t bindingCount, const VkBuffer* pBuffers)
@@ -85,7 +85,7 @@ void TrackCmdBindVertexBuffersHandles(CommandBufferWrapper* wrapper, uint32_t bi
     {
         for (uint32_t pBuffers_index = 0; pBuffers_index < bindingCount; ++pBuffers_index)
         {
-            wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pBuffers[pBuffers_index]));
+            wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pBuffers[pBuffers_index]));
         }
     }
 }
@@ -94,111 +94,111 @@ void TrackCmdDrawIndirectHandles(CommandBufferWrapper* wrapper, VkBuffer buffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
 }
 
 void TrackCmdDrawIndexedIndirectHandles(CommandBufferWrapper* wrapper, VkBuffer buffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
 }
 
 void TrackCmdDispatchIndirectHandles(CommandBufferWrapper* wrapper, VkBuffer buffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
 }
 
 void TrackCmdCopyBufferHandles(CommandBufferWrapper* wrapper, VkBuffer srcBuffer, VkBuffer dstBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(srcBuffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(dstBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(srcBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(dstBuffer));
 }
 
 void TrackCmdCopyImageHandles(CommandBufferWrapper* wrapper, VkImage srcImage, VkImage dstImage)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(srcImage));
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(dstImage));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(srcImage));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(dstImage));
 }
 
 void TrackCmdBlitImageHandles(CommandBufferWrapper* wrapper, VkImage srcImage, VkImage dstImage)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(srcImage));
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(dstImage));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(srcImage));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(dstImage));
 }
 
 void TrackCmdCopyBufferToImageHandles(CommandBufferWrapper* wrapper, VkBuffer srcBuffer, VkImage dstImage)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(srcBuffer));
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(dstImage));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(srcBuffer));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(dstImage));
 }
 
 void TrackCmdCopyImageToBufferHandles(CommandBufferWrapper* wrapper, VkImage srcImage, VkBuffer dstBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(srcImage));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(dstBuffer));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(srcImage));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(dstBuffer));
 }
 
 void TrackCmdUpdateBufferHandles(CommandBufferWrapper* wrapper, VkBuffer dstBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(dstBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(dstBuffer));
 }
 
 void TrackCmdFillBufferHandles(CommandBufferWrapper* wrapper, VkBuffer dstBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(dstBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(dstBuffer));
 }
 
 void TrackCmdClearColorImageHandles(CommandBufferWrapper* wrapper, VkImage image)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(image));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(image));
 }
 
 void TrackCmdClearDepthStencilImageHandles(CommandBufferWrapper* wrapper, VkImage image)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(image));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(image));
 }
 
 void TrackCmdResolveImageHandles(CommandBufferWrapper* wrapper, VkImage srcImage, VkImage dstImage)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(srcImage));
-    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(dstImage));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(srcImage));
+    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(dstImage));
 }
 
 void TrackCmdSetEventHandles(CommandBufferWrapper* wrapper, VkEvent event)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::EventHandle].insert(GetWrappedId(event));
+    wrapper->command_handles[CommandHandleType::EventHandle].push_back(GetWrappedId(event));
 }
 
 void TrackCmdResetEventHandles(CommandBufferWrapper* wrapper, VkEvent event)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::EventHandle].insert(GetWrappedId(event));
+    wrapper->command_handles[CommandHandleType::EventHandle].push_back(GetWrappedId(event));
 }
 
 void TrackCmdWaitEventsHandles(CommandBufferWrapper* wrapper, uint32_t eventCount, const VkEvent* pEvents, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
@@ -209,7 +209,7 @@ void TrackCmdWaitEventsHandles(CommandBufferWrapper* wrapper, uint32_t eventCoun
     {
         for (uint32_t pEvents_index = 0; pEvents_index < eventCount; ++pEvents_index)
         {
-            wrapper->command_handles[CommandHandleType::EventHandle].insert(GetWrappedId(pEvents[pEvents_index]));
+            wrapper->command_handles[CommandHandleType::EventHandle].push_back(GetWrappedId(pEvents[pEvents_index]));
         }
     }
 
@@ -217,7 +217,7 @@ void TrackCmdWaitEventsHandles(CommandBufferWrapper* wrapper, uint32_t eventCoun
     {
         for (uint32_t pBufferMemoryBarriers_index = 0; pBufferMemoryBarriers_index < bufferMemoryBarrierCount; ++pBufferMemoryBarriers_index)
         {
-            wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
+            wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
         }
     }
 
@@ -225,7 +225,7 @@ void TrackCmdWaitEventsHandles(CommandBufferWrapper* wrapper, uint32_t eventCoun
     {
         for (uint32_t pImageMemoryBarriers_index = 0; pImageMemoryBarriers_index < imageMemoryBarrierCount; ++pImageMemoryBarriers_index)
         {
-            wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pImageMemoryBarriers[pImageMemoryBarriers_index].image));
+            wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pImageMemoryBarriers[pImageMemoryBarriers_index].image));
         }
     }
 }
@@ -238,7 +238,7 @@ void TrackCmdPipelineBarrierHandles(CommandBufferWrapper* wrapper, uint32_t buff
     {
         for (uint32_t pBufferMemoryBarriers_index = 0; pBufferMemoryBarriers_index < bufferMemoryBarrierCount; ++pBufferMemoryBarriers_index)
         {
-            wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
+            wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
         }
     }
 
@@ -246,7 +246,7 @@ void TrackCmdPipelineBarrierHandles(CommandBufferWrapper* wrapper, uint32_t buff
     {
         for (uint32_t pImageMemoryBarriers_index = 0; pImageMemoryBarriers_index < imageMemoryBarrierCount; ++pImageMemoryBarriers_index)
         {
-            wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pImageMemoryBarriers[pImageMemoryBarriers_index].image));
+            wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pImageMemoryBarriers[pImageMemoryBarriers_index].image));
         }
     }
 }
@@ -255,43 +255,43 @@ void TrackCmdBeginQueryHandles(CommandBufferWrapper* wrapper, VkQueryPool queryP
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdEndQueryHandles(CommandBufferWrapper* wrapper, VkQueryPool queryPool)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdResetQueryPoolHandles(CommandBufferWrapper* wrapper, VkQueryPool queryPool)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdWriteTimestampHandles(CommandBufferWrapper* wrapper, VkQueryPool queryPool)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdCopyQueryPoolResultsHandles(CommandBufferWrapper* wrapper, VkQueryPool queryPool, VkBuffer dstBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(dstBuffer));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(dstBuffer));
 }
 
 void TrackCmdPushConstantsHandles(CommandBufferWrapper* wrapper, VkPipelineLayout layout)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::PipelineLayoutHandle].insert(GetWrappedId(layout));
+    wrapper->command_handles[CommandHandleType::PipelineLayoutHandle].push_back(GetWrappedId(layout));
 }
 
 void TrackCmdBeginRenderPassHandles(CommandBufferWrapper* wrapper, const VkRenderPassBeginInfo* pRenderPassBegin)
@@ -314,7 +314,7 @@ void TrackCmdBeginRenderPassHandles(CommandBufferWrapper* wrapper, const VkRende
                     {
                         for (uint32_t pAttachments_index = 0; pAttachments_index < pnext_value->attachmentCount; ++pAttachments_index)
                         {
-                            wrapper->command_handles[CommandHandleType::ImageViewHandle].insert(GetWrappedId(pnext_value->pAttachments[pAttachments_index]));
+                            wrapper->command_handles[CommandHandleType::ImageViewHandle].push_back(GetWrappedId(pnext_value->pAttachments[pAttachments_index]));
                         }
                     }
                     break;
@@ -322,8 +322,8 @@ void TrackCmdBeginRenderPassHandles(CommandBufferWrapper* wrapper, const VkRende
             }
             pnext_header = pnext_header->pNext;
         }
-        wrapper->command_handles[CommandHandleType::RenderPassHandle].insert(GetWrappedId(pRenderPassBegin->renderPass));
-        wrapper->command_handles[CommandHandleType::FramebufferHandle].insert(GetWrappedId(pRenderPassBegin->framebuffer));
+        wrapper->command_handles[CommandHandleType::RenderPassHandle].push_back(GetWrappedId(pRenderPassBegin->renderPass));
+        wrapper->command_handles[CommandHandleType::FramebufferHandle].push_back(GetWrappedId(pRenderPassBegin->framebuffer));
     }
 }
 
@@ -335,7 +335,7 @@ void TrackCmdExecuteCommandsHandles(CommandBufferWrapper* wrapper, uint32_t comm
     {
         for (uint32_t pCommandBuffers_index = 0; pCommandBuffers_index < commandBufferCount; ++pCommandBuffers_index)
         {
-            wrapper->command_handles[CommandHandleType::CommandBufferHandle].insert(GetWrappedId(pCommandBuffers[pCommandBuffers_index]));
+            wrapper->command_handles[CommandHandleType::CommandBufferHandle].push_back(GetWrappedId(pCommandBuffers[pCommandBuffers_index]));
         }
     }
 }
@@ -344,16 +344,16 @@ void TrackCmdDrawIndirectCountHandles(CommandBufferWrapper* wrapper, VkBuffer bu
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(countBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(countBuffer));
 }
 
 void TrackCmdDrawIndexedIndirectCountHandles(CommandBufferWrapper* wrapper, VkBuffer buffer, VkBuffer countBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(countBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(countBuffer));
 }
 
 void TrackCmdBeginRenderPass2Handles(CommandBufferWrapper* wrapper, const VkRenderPassBeginInfo* pRenderPassBegin)
@@ -376,7 +376,7 @@ void TrackCmdBeginRenderPass2Handles(CommandBufferWrapper* wrapper, const VkRend
                     {
                         for (uint32_t pAttachments_index = 0; pAttachments_index < pnext_value->attachmentCount; ++pAttachments_index)
                         {
-                            wrapper->command_handles[CommandHandleType::ImageViewHandle].insert(GetWrappedId(pnext_value->pAttachments[pAttachments_index]));
+                            wrapper->command_handles[CommandHandleType::ImageViewHandle].push_back(GetWrappedId(pnext_value->pAttachments[pAttachments_index]));
                         }
                     }
                     break;
@@ -384,8 +384,8 @@ void TrackCmdBeginRenderPass2Handles(CommandBufferWrapper* wrapper, const VkRend
             }
             pnext_header = pnext_header->pNext;
         }
-        wrapper->command_handles[CommandHandleType::RenderPassHandle].insert(GetWrappedId(pRenderPassBegin->renderPass));
-        wrapper->command_handles[CommandHandleType::FramebufferHandle].insert(GetWrappedId(pRenderPassBegin->framebuffer));
+        wrapper->command_handles[CommandHandleType::RenderPassHandle].push_back(GetWrappedId(pRenderPassBegin->renderPass));
+        wrapper->command_handles[CommandHandleType::FramebufferHandle].push_back(GetWrappedId(pRenderPassBegin->framebuffer));
     }
 }
 
@@ -393,7 +393,7 @@ void TrackCmdPushDescriptorSetKHRHandles(CommandBufferWrapper* wrapper, VkPipeli
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::PipelineLayoutHandle].insert(GetWrappedId(layout));
+    wrapper->command_handles[CommandHandleType::PipelineLayoutHandle].push_back(GetWrappedId(layout));
 
     if (pDescriptorWrites != nullptr)
     {
@@ -413,7 +413,7 @@ void TrackCmdPushDescriptorSetKHRHandles(CommandBufferWrapper* wrapper, VkPipeli
                         {
                             for (uint32_t pAccelerationStructures_index = 0; pAccelerationStructures_index < pnext_value->accelerationStructureCount; ++pAccelerationStructures_index)
                             {
-                                wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pnext_value->pAccelerationStructures[pAccelerationStructures_index]));
+                                wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pnext_value->pAccelerationStructures[pAccelerationStructures_index]));
                             }
                         }
                         break;
@@ -425,7 +425,7 @@ void TrackCmdPushDescriptorSetKHRHandles(CommandBufferWrapper* wrapper, VkPipeli
                         {
                             for (uint32_t pAccelerationStructures_index = 0; pAccelerationStructures_index < pnext_value->accelerationStructureCount; ++pAccelerationStructures_index)
                             {
-                                wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].insert(GetWrappedId(pnext_value->pAccelerationStructures[pAccelerationStructures_index]));
+                                wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].push_back(GetWrappedId(pnext_value->pAccelerationStructures[pAccelerationStructures_index]));
                             }
                         }
                         break;
@@ -433,14 +433,14 @@ void TrackCmdPushDescriptorSetKHRHandles(CommandBufferWrapper* wrapper, VkPipeli
                 }
                 pnext_header = pnext_header->pNext;
             }
-            wrapper->command_handles[CommandHandleType::DescriptorSetHandle].insert(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].dstSet));
+            wrapper->command_handles[CommandHandleType::DescriptorSetHandle].push_back(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].dstSet));
 
             if (pDescriptorWrites[pDescriptorWrites_index].pImageInfo != nullptr)
             {
                 for (uint32_t pImageInfo_index = 0; pImageInfo_index < pDescriptorWrites[pDescriptorWrites_index].descriptorCount; ++pImageInfo_index)
                 {
-                    wrapper->command_handles[CommandHandleType::SamplerHandle].insert(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pImageInfo[pImageInfo_index].sampler));
-                    wrapper->command_handles[CommandHandleType::ImageViewHandle].insert(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pImageInfo[pImageInfo_index].imageView));
+                    wrapper->command_handles[CommandHandleType::SamplerHandle].push_back(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pImageInfo[pImageInfo_index].sampler));
+                    wrapper->command_handles[CommandHandleType::ImageViewHandle].push_back(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pImageInfo[pImageInfo_index].imageView));
                 }
             }
 
@@ -448,7 +448,7 @@ void TrackCmdPushDescriptorSetKHRHandles(CommandBufferWrapper* wrapper, VkPipeli
             {
                 for (uint32_t pBufferInfo_index = 0; pBufferInfo_index < pDescriptorWrites[pDescriptorWrites_index].descriptorCount; ++pBufferInfo_index)
                 {
-                    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pBufferInfo[pBufferInfo_index].buffer));
+                    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pBufferInfo[pBufferInfo_index].buffer));
                 }
             }
 
@@ -456,7 +456,7 @@ void TrackCmdPushDescriptorSetKHRHandles(CommandBufferWrapper* wrapper, VkPipeli
             {
                 for (uint32_t pTexelBufferView_index = 0; pTexelBufferView_index < pDescriptorWrites[pDescriptorWrites_index].descriptorCount; ++pTexelBufferView_index)
                 {
-                    wrapper->command_handles[CommandHandleType::BufferViewHandle].insert(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pTexelBufferView[pTexelBufferView_index]));
+                    wrapper->command_handles[CommandHandleType::BufferViewHandle].push_back(GetWrappedId(pDescriptorWrites[pDescriptorWrites_index].pTexelBufferView[pTexelBufferView_index]));
                 }
             }
         }
@@ -483,7 +483,7 @@ void TrackCmdBeginRenderPass2KHRHandles(CommandBufferWrapper* wrapper, const VkR
                     {
                         for (uint32_t pAttachments_index = 0; pAttachments_index < pnext_value->attachmentCount; ++pAttachments_index)
                         {
-                            wrapper->command_handles[CommandHandleType::ImageViewHandle].insert(GetWrappedId(pnext_value->pAttachments[pAttachments_index]));
+                            wrapper->command_handles[CommandHandleType::ImageViewHandle].push_back(GetWrappedId(pnext_value->pAttachments[pAttachments_index]));
                         }
                     }
                     break;
@@ -491,8 +491,8 @@ void TrackCmdBeginRenderPass2KHRHandles(CommandBufferWrapper* wrapper, const VkR
             }
             pnext_header = pnext_header->pNext;
         }
-        wrapper->command_handles[CommandHandleType::RenderPassHandle].insert(GetWrappedId(pRenderPassBegin->renderPass));
-        wrapper->command_handles[CommandHandleType::FramebufferHandle].insert(GetWrappedId(pRenderPassBegin->framebuffer));
+        wrapper->command_handles[CommandHandleType::RenderPassHandle].push_back(GetWrappedId(pRenderPassBegin->renderPass));
+        wrapper->command_handles[CommandHandleType::FramebufferHandle].push_back(GetWrappedId(pRenderPassBegin->framebuffer));
     }
 }
 
@@ -500,23 +500,23 @@ void TrackCmdDrawIndirectCountKHRHandles(CommandBufferWrapper* wrapper, VkBuffer
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(countBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(countBuffer));
 }
 
 void TrackCmdDrawIndexedIndirectCountKHRHandles(CommandBufferWrapper* wrapper, VkBuffer buffer, VkBuffer countBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(countBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(countBuffer));
 }
 
 void TrackCmdSetEvent2KHRHandles(CommandBufferWrapper* wrapper, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::EventHandle].insert(GetWrappedId(event));
+    wrapper->command_handles[CommandHandleType::EventHandle].push_back(GetWrappedId(event));
 
     if (pDependencyInfo != nullptr)
     {
@@ -524,7 +524,7 @@ void TrackCmdSetEvent2KHRHandles(CommandBufferWrapper* wrapper, VkEvent event, c
         {
             for (uint32_t pBufferMemoryBarriers_index = 0; pBufferMemoryBarriers_index < pDependencyInfo->bufferMemoryBarrierCount; ++pBufferMemoryBarriers_index)
             {
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pDependencyInfo->pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pDependencyInfo->pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
             }
         }
 
@@ -532,7 +532,7 @@ void TrackCmdSetEvent2KHRHandles(CommandBufferWrapper* wrapper, VkEvent event, c
         {
             for (uint32_t pImageMemoryBarriers_index = 0; pImageMemoryBarriers_index < pDependencyInfo->imageMemoryBarrierCount; ++pImageMemoryBarriers_index)
             {
-                wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pDependencyInfo->pImageMemoryBarriers[pImageMemoryBarriers_index].image));
+                wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pDependencyInfo->pImageMemoryBarriers[pImageMemoryBarriers_index].image));
             }
         }
     }
@@ -542,7 +542,7 @@ void TrackCmdResetEvent2KHRHandles(CommandBufferWrapper* wrapper, VkEvent event)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::EventHandle].insert(GetWrappedId(event));
+    wrapper->command_handles[CommandHandleType::EventHandle].push_back(GetWrappedId(event));
 }
 
 void TrackCmdWaitEvents2KHRHandles(CommandBufferWrapper* wrapper, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos)
@@ -553,7 +553,7 @@ void TrackCmdWaitEvents2KHRHandles(CommandBufferWrapper* wrapper, uint32_t event
     {
         for (uint32_t pEvents_index = 0; pEvents_index < eventCount; ++pEvents_index)
         {
-            wrapper->command_handles[CommandHandleType::EventHandle].insert(GetWrappedId(pEvents[pEvents_index]));
+            wrapper->command_handles[CommandHandleType::EventHandle].push_back(GetWrappedId(pEvents[pEvents_index]));
         }
     }
 
@@ -565,7 +565,7 @@ void TrackCmdWaitEvents2KHRHandles(CommandBufferWrapper* wrapper, uint32_t event
             {
                 for (uint32_t pBufferMemoryBarriers_index = 0; pBufferMemoryBarriers_index < pDependencyInfos[pDependencyInfos_index].bufferMemoryBarrierCount; ++pBufferMemoryBarriers_index)
                 {
-                    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pDependencyInfos[pDependencyInfos_index].pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
+                    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pDependencyInfos[pDependencyInfos_index].pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
                 }
             }
 
@@ -573,7 +573,7 @@ void TrackCmdWaitEvents2KHRHandles(CommandBufferWrapper* wrapper, uint32_t event
             {
                 for (uint32_t pImageMemoryBarriers_index = 0; pImageMemoryBarriers_index < pDependencyInfos[pDependencyInfos_index].imageMemoryBarrierCount; ++pImageMemoryBarriers_index)
                 {
-                    wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pDependencyInfos[pDependencyInfos_index].pImageMemoryBarriers[pImageMemoryBarriers_index].image));
+                    wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pDependencyInfos[pDependencyInfos_index].pImageMemoryBarriers[pImageMemoryBarriers_index].image));
                 }
             }
         }
@@ -590,7 +590,7 @@ void TrackCmdPipelineBarrier2KHRHandles(CommandBufferWrapper* wrapper, const VkD
         {
             for (uint32_t pBufferMemoryBarriers_index = 0; pBufferMemoryBarriers_index < pDependencyInfo->bufferMemoryBarrierCount; ++pBufferMemoryBarriers_index)
             {
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pDependencyInfo->pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pDependencyInfo->pBufferMemoryBarriers[pBufferMemoryBarriers_index].buffer));
             }
         }
 
@@ -598,7 +598,7 @@ void TrackCmdPipelineBarrier2KHRHandles(CommandBufferWrapper* wrapper, const VkD
         {
             for (uint32_t pImageMemoryBarriers_index = 0; pImageMemoryBarriers_index < pDependencyInfo->imageMemoryBarrierCount; ++pImageMemoryBarriers_index)
             {
-                wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pDependencyInfo->pImageMemoryBarriers[pImageMemoryBarriers_index].image));
+                wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pDependencyInfo->pImageMemoryBarriers[pImageMemoryBarriers_index].image));
             }
         }
     }
@@ -608,14 +608,14 @@ void TrackCmdWriteTimestamp2KHRHandles(CommandBufferWrapper* wrapper, VkQueryPoo
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdWriteBufferMarker2AMDHandles(CommandBufferWrapper* wrapper, VkBuffer dstBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(dstBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(dstBuffer));
 }
 
 void TrackCmdCopyBuffer2KHRHandles(CommandBufferWrapper* wrapper, const VkCopyBufferInfo2KHR* pCopyBufferInfo)
@@ -624,8 +624,8 @@ void TrackCmdCopyBuffer2KHRHandles(CommandBufferWrapper* wrapper, const VkCopyBu
 
     if (pCopyBufferInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pCopyBufferInfo->srcBuffer));
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pCopyBufferInfo->dstBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pCopyBufferInfo->srcBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pCopyBufferInfo->dstBuffer));
     }
 }
 
@@ -635,8 +635,8 @@ void TrackCmdCopyImage2KHRHandles(CommandBufferWrapper* wrapper, const VkCopyIma
 
     if (pCopyImageInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pCopyImageInfo->srcImage));
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pCopyImageInfo->dstImage));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pCopyImageInfo->srcImage));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pCopyImageInfo->dstImage));
     }
 }
 
@@ -646,8 +646,8 @@ void TrackCmdCopyBufferToImage2KHRHandles(CommandBufferWrapper* wrapper, const V
 
     if (pCopyBufferToImageInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pCopyBufferToImageInfo->srcBuffer));
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pCopyBufferToImageInfo->dstImage));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pCopyBufferToImageInfo->srcBuffer));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pCopyBufferToImageInfo->dstImage));
     }
 }
 
@@ -657,8 +657,8 @@ void TrackCmdCopyImageToBuffer2KHRHandles(CommandBufferWrapper* wrapper, const V
 
     if (pCopyImageToBufferInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pCopyImageToBufferInfo->srcImage));
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pCopyImageToBufferInfo->dstBuffer));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pCopyImageToBufferInfo->srcImage));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pCopyImageToBufferInfo->dstBuffer));
     }
 }
 
@@ -668,8 +668,8 @@ void TrackCmdBlitImage2KHRHandles(CommandBufferWrapper* wrapper, const VkBlitIma
 
     if (pBlitImageInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pBlitImageInfo->srcImage));
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pBlitImageInfo->dstImage));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pBlitImageInfo->srcImage));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pBlitImageInfo->dstImage));
     }
 }
 
@@ -679,8 +679,8 @@ void TrackCmdResolveImage2KHRHandles(CommandBufferWrapper* wrapper, const VkReso
 
     if (pResolveImageInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pResolveImageInfo->srcImage));
-        wrapper->command_handles[CommandHandleType::ImageHandle].insert(GetWrappedId(pResolveImageInfo->dstImage));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pResolveImageInfo->srcImage));
+        wrapper->command_handles[CommandHandleType::ImageHandle].push_back(GetWrappedId(pResolveImageInfo->dstImage));
     }
 }
 
@@ -692,7 +692,7 @@ void TrackCmdBindTransformFeedbackBuffersEXTHandles(CommandBufferWrapper* wrappe
     {
         for (uint32_t pBuffers_index = 0; pBuffers_index < bindingCount; ++pBuffers_index)
         {
-            wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pBuffers[pBuffers_index]));
+            wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pBuffers[pBuffers_index]));
         }
     }
 }
@@ -705,7 +705,7 @@ void TrackCmdBeginTransformFeedbackEXTHandles(CommandBufferWrapper* wrapper, uin
     {
         for (uint32_t pCounterBuffers_index = 0; pCounterBuffers_index < counterBufferCount; ++pCounterBuffers_index)
         {
-            wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pCounterBuffers[pCounterBuffers_index]));
+            wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pCounterBuffers[pCounterBuffers_index]));
         }
     }
 }
@@ -718,7 +718,7 @@ void TrackCmdEndTransformFeedbackEXTHandles(CommandBufferWrapper* wrapper, uint3
     {
         for (uint32_t pCounterBuffers_index = 0; pCounterBuffers_index < counterBufferCount; ++pCounterBuffers_index)
         {
-            wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pCounterBuffers[pCounterBuffers_index]));
+            wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pCounterBuffers[pCounterBuffers_index]));
         }
     }
 }
@@ -727,37 +727,37 @@ void TrackCmdBeginQueryIndexedEXTHandles(CommandBufferWrapper* wrapper, VkQueryP
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdEndQueryIndexedEXTHandles(CommandBufferWrapper* wrapper, VkQueryPool queryPool)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdDrawIndirectByteCountEXTHandles(CommandBufferWrapper* wrapper, VkBuffer counterBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(counterBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(counterBuffer));
 }
 
 void TrackCmdDrawIndirectCountAMDHandles(CommandBufferWrapper* wrapper, VkBuffer buffer, VkBuffer countBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(countBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(countBuffer));
 }
 
 void TrackCmdDrawIndexedIndirectCountAMDHandles(CommandBufferWrapper* wrapper, VkBuffer buffer, VkBuffer countBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(countBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(countBuffer));
 }
 
 void TrackCmdBeginConditionalRenderingEXTHandles(CommandBufferWrapper* wrapper, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin)
@@ -766,7 +766,7 @@ void TrackCmdBeginConditionalRenderingEXTHandles(CommandBufferWrapper* wrapper,
 
     if (pConditionalRenderingBegin != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pConditionalRenderingBegin->buffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pConditionalRenderingBegin->buffer));
     }
 }
 
@@ -774,7 +774,7 @@ void TrackCmdBindShadingRateImageNVHandles(CommandBufferWrapper* wrapper, VkImag
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::ImageViewHandle].insert(GetWrappedId(imageView));
+    wrapper->command_handles[CommandHandleType::ImageViewHandle].push_back(GetWrappedId(imageView));
 }
 
 void TrackCmdBuildAccelerationStructureNVHandles(CommandBufferWrapper* wrapper, const VkAccelerationStructureInfoNV* pInfo, VkBuffer instanceData, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch)
@@ -787,35 +787,35 @@ void TrackCmdBuildAccelerationStructureNVHandles(CommandBufferWrapper* wrapper,
         {
             for (uint32_t pGeometries_index = 0; pGeometries_index < pInfo->geometryCount; ++pGeometries_index)
             {
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.triangles.vertexData));
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.triangles.indexData));
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.triangles.transformData));
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.aabbs.aabbData));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.triangles.vertexData));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.triangles.indexData));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.triangles.transformData));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pInfo->pGeometries[pGeometries_index].geometry.aabbs.aabbData));
             }
         }
     }
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(instanceData));
-    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].insert(GetWrappedId(dst));
-    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].insert(GetWrappedId(src));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(scratch));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(instanceData));
+    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].push_back(GetWrappedId(dst));
+    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].push_back(GetWrappedId(src));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(scratch));
 }
 
 void TrackCmdCopyAccelerationStructureNVHandles(CommandBufferWrapper* wrapper, VkAccelerationStructureNV dst, VkAccelerationStructureNV src)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].insert(GetWrappedId(dst));
-    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].insert(GetWrappedId(src));
+    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].push_back(GetWrappedId(dst));
+    wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].push_back(GetWrappedId(src));
 }
 
 void TrackCmdTraceRaysNVHandles(CommandBufferWrapper* wrapper, VkBuffer raygenShaderBindingTableBuffer, VkBuffer missShaderBindingTableBuffer, VkBuffer hitShaderBindingTableBuffer, VkBuffer callableShaderBindingTableBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(raygenShaderBindingTableBuffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(missShaderBindingTableBuffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(hitShaderBindingTableBuffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(callableShaderBindingTableBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(raygenShaderBindingTableBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(missShaderBindingTableBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(hitShaderBindingTableBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(callableShaderBindingTableBuffer));
 }
 
 void TrackCmdWriteAccelerationStructuresPropertiesNVHandles(CommandBufferWrapper* wrapper, uint32_t accelerationStructureCount, const VkAccelerationStructureNV* pAccelerationStructures, VkQueryPool queryPool)
@@ -826,32 +826,32 @@ void TrackCmdWriteAccelerationStructuresPropertiesNVHandles(CommandBufferWrapper
     {
         for (uint32_t pAccelerationStructures_index = 0; pAccelerationStructures_index < accelerationStructureCount; ++pAccelerationStructures_index)
         {
-            wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].insert(GetWrappedId(pAccelerationStructures[pAccelerationStructures_index]));
+            wrapper->command_handles[CommandHandleType::AccelerationStructureNVHandle].push_back(GetWrappedId(pAccelerationStructures[pAccelerationStructures_index]));
         }
     }
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 void TrackCmdWriteBufferMarkerAMDHandles(CommandBufferWrapper* wrapper, VkBuffer dstBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(dstBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(dstBuffer));
 }
 
 void TrackCmdDrawMeshTasksIndirectNVHandles(CommandBufferWrapper* wrapper, VkBuffer buffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
 }
 
 void TrackCmdDrawMeshTasksIndirectCountNVHandles(CommandBufferWrapper* wrapper, VkBuffer buffer, VkBuffer countBuffer)
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(buffer));
-    wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(countBuffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(buffer));
+    wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(countBuffer));
 }
 
 void TrackCmdBindVertexBuffers2EXTHandles(CommandBufferWrapper* wrapper, uint32_t bindingCount, const VkBuffer* pBuffers)
@@ -862,7 +862,7 @@ void TrackCmdBindVertexBuffers2EXTHandles(CommandBufferWrapper* wrapper, uint32_
     {
         for (uint32_t pBuffers_index = 0; pBuffers_index < bindingCount; ++pBuffers_index)
         {
-            wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pBuffers[pBuffers_index]));
+            wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pBuffers[pBuffers_index]));
         }
     }
 }
@@ -873,19 +873,19 @@ void TrackCmdPreprocessGeneratedCommandsNVHandles(CommandBufferWrapper* wrapper,
 
     if (pGeneratedCommandsInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::PipelineHandle].insert(GetWrappedId(pGeneratedCommandsInfo->pipeline));
-        wrapper->command_handles[CommandHandleType::IndirectCommandsLayoutNVHandle].insert(GetWrappedId(pGeneratedCommandsInfo->indirectCommandsLayout));
+        wrapper->command_handles[CommandHandleType::PipelineHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->pipeline));
+        wrapper->command_handles[CommandHandleType::IndirectCommandsLayoutNVHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->indirectCommandsLayout));
 
         if (pGeneratedCommandsInfo->pStreams != nullptr)
         {
             for (uint32_t pStreams_index = 0; pStreams_index < pGeneratedCommandsInfo->streamCount; ++pStreams_index)
             {
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->pStreams[pStreams_index].buffer));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->pStreams[pStreams_index].buffer));
             }
         }
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->preprocessBuffer));
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->sequencesCountBuffer));
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->sequencesIndexBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->preprocessBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->sequencesCountBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->sequencesIndexBuffer));
     }
 }
 
@@ -895,19 +895,19 @@ void TrackCmdExecuteGeneratedCommandsNVHandles(CommandBufferWrapper* wrapper, co
 
     if (pGeneratedCommandsInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::PipelineHandle].insert(GetWrappedId(pGeneratedCommandsInfo->pipeline));
-        wrapper->command_handles[CommandHandleType::IndirectCommandsLayoutNVHandle].insert(GetWrappedId(pGeneratedCommandsInfo->indirectCommandsLayout));
+        wrapper->command_handles[CommandHandleType::PipelineHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->pipeline));
+        wrapper->command_handles[CommandHandleType::IndirectCommandsLayoutNVHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->indirectCommandsLayout));
 
         if (pGeneratedCommandsInfo->pStreams != nullptr)
         {
             for (uint32_t pStreams_index = 0; pStreams_index < pGeneratedCommandsInfo->streamCount; ++pStreams_index)
             {
-                wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->pStreams[pStreams_index].buffer));
+                wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->pStreams[pStreams_index].buffer));
             }
         }
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->preprocessBuffer));
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->sequencesCountBuffer));
-        wrapper->command_handles[CommandHandleType::BufferHandle].insert(GetWrappedId(pGeneratedCommandsInfo->sequencesIndexBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->preprocessBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->sequencesCountBuffer));
+        wrapper->command_handles[CommandHandleType::BufferHandle].push_back(GetWrappedId(pGeneratedCommandsInfo->sequencesIndexBuffer));
     }
 }
 
@@ -915,7 +915,7 @@ void TrackCmdBindPipelineShaderGroupNVHandles(CommandBufferWrapper* wrapper, VkP
 {
     assert(wrapper != nullptr);
 
-    wrapper->command_handles[CommandHandleType::PipelineHandle].insert(GetWrappedId(pipeline));
+    wrapper->command_handles[CommandHandleType::PipelineHandle].push_back(GetWrappedId(pipeline));
 }
 
 void TrackCmdBuildAccelerationStructuresKHRHandles(CommandBufferWrapper* wrapper, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos)
@@ -926,8 +926,8 @@ void TrackCmdBuildAccelerationStructuresKHRHandles(CommandBufferWrapper* wrapper
     {
         for (uint32_t pInfos_index = 0; pInfos_index < infoCount; ++pInfos_index)
         {
-            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfos[pInfos_index].srcAccelerationStructure));
-            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfos[pInfos_index].dstAccelerationStructure));
+            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfos[pInfos_index].srcAccelerationStructure));
+            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfos[pInfos_index].dstAccelerationStructure));
         }
     }
 }
@@ -940,8 +940,8 @@ void TrackCmdBuildAccelerationStructuresIndirectKHRHandles(CommandBufferWrapper*
     {
         for (uint32_t pInfos_index = 0; pInfos_index < infoCount; ++pInfos_index)
         {
-            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfos[pInfos_index].srcAccelerationStructure));
-            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfos[pInfos_index].dstAccelerationStructure));
+            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfos[pInfos_index].srcAccelerationStructure));
+            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfos[pInfos_index].dstAccelerationStructure));
         }
     }
 }
@@ -952,8 +952,8 @@ void TrackCmdCopyAccelerationStructureKHRHandles(CommandBufferWrapper* wrapper,
 
     if (pInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfo->src));
-        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfo->dst));
+        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfo->src));
+        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfo->dst));
     }
 }
 
@@ -963,7 +963,7 @@ void TrackCmdCopyAccelerationStructureToMemoryKHRHandles(CommandBufferWrapper* w
 
     if (pInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfo->src));
+        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfo->src));
     }
 }
 
@@ -973,7 +973,7 @@ void TrackCmdCopyMemoryToAccelerationStructureKHRHandles(CommandBufferWrapper* w
 
     if (pInfo != nullptr)
     {
-        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pInfo->dst));
+        wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pInfo->dst));
     }
 }
 
@@ -985,10 +985,10 @@ void TrackCmdWriteAccelerationStructuresPropertiesKHRHandles(CommandBufferWrappe
     {
         for (uint32_t pAccelerationStructures_index = 0; pAccelerationStructures_index < accelerationStructureCount; ++pAccelerationStructures_index)
         {
-            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].insert(GetWrappedId(pAccelerationStructures[pAccelerationStructures_index]));
+            wrapper->command_handles[CommandHandleType::AccelerationStructureKHRHandle].push_back(GetWrappedId(pAccelerationStructures[pAccelerationStructures_index]));
         }
     }
-    wrapper->command_handles[CommandHandleType::QueryPoolHandle].insert(GetWrappedId(queryPool));
+    wrapper->command_handles[CommandHandleType::QueryPoolHandle].push_back(GetWrappedId(queryPool));
 }
 
 GFXRECON_END_NAMESPACE(encode)
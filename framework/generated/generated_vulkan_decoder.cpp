@@ -39,6 +39,7 @@
 
 #include "vulkan/vulkan.h"
 
+#include <array>
 #include <cstddef>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -58,10 +59,9 @@ size_t VulkanDecoder::Decode_vkCreateInstance(const uint8_t* parameter_buffer, s
     bytes_read += pInstance.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateInstance(return_value, &pCreateInfo, &pAllocator, &pInstance);
-    }
+    });
 
     return bytes_read;
 }
@@ -76,10 +76,9 @@ size_t VulkanDecoder::Decode_vkDestroyInstance(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &instance);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyInstance(instance, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -98,10 +97,9 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDevices(const uint8_t* parameter
     bytes_read += pPhysicalDevices.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkEnumeratePhysicalDevices(return_value, instance, &pPhysicalDeviceCount, &pPhysicalDevices);
-    }
+    });
 
     return bytes_read;
 }
@@ -116,10 +114,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pFeatures.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceFeatures(physicalDevice, &pFeatures);
-    }
+    });
 
     return bytes_read;
 }
@@ -136,10 +133,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties(const uint8_t*
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &format);
     bytes_read += pFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &pFormatProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -166,10 +162,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties(const uint
     bytes_read += pImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceImageFormatProperties(return_value, physicalDevice, format, type, tiling, usage, flags, &pImageFormatProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -184,10 +179,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceProperties(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceProperties(physicalDevice, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -204,10 +198,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties(const uint
     bytes_read += pQueueFamilyPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueueFamilyProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &pQueueFamilyPropertyCount, &pQueueFamilyProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -222,10 +215,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pMemoryProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceMemoryProperties(physicalDevice, &pMemoryProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -246,10 +238,9 @@ size_t VulkanDecoder::Decode_vkCreateDevice(const uint8_t* parameter_buffer, siz
     bytes_read += pDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDevice(return_value, physicalDevice, &pCreateInfo, &pAllocator, &pDevice);
-    }
+    });
 
     return bytes_read;
 }
@@ -264,10 +255,9 @@ size_t VulkanDecoder::Decode_vkDestroyDevice(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDevice(device, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -286,10 +276,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceQueue(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queueIndex);
     bytes_read += pQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, &pQueue);
-    }
+    });
 
     return bytes_read;
 }
@@ -310,10 +299,9 @@ size_t VulkanDecoder::Decode_vkQueueSubmit(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueSubmit(return_value, queue, submitCount, &pSubmits, fence);
-    }
+    });
 
     return bytes_read;
 }
@@ -328,10 +316,9 @@ size_t VulkanDecoder::Decode_vkQueueWaitIdle(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueWaitIdle(return_value, queue);
-    }
+    });
 
     return bytes_read;
 }
@@ -346,10 +333,9 @@ size_t VulkanDecoder::Decode_vkDeviceWaitIdle(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDeviceWaitIdle(return_value, device);
-    }
+    });
 
     return bytes_read;
 }
@@ -370,10 +356,9 @@ size_t VulkanDecoder::Decode_vkAllocateMemory(const uint8_t* parameter_buffer, s
     bytes_read += pMemory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAllocateMemory(return_value, device, &pAllocateInfo, &pAllocator, &pMemory);
-    }
+    });
 
     return bytes_read;
 }
@@ -390,10 +375,9 @@ size_t VulkanDecoder::Decode_vkFreeMemory(const uint8_t* parameter_buffer, size_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memory);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkFreeMemory(device, memory, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -418,10 +402,9 @@ size_t VulkanDecoder::Decode_vkMapMemory(const uint8_t* parameter_buffer, size_t
     bytes_read += ppData.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkMapMemory(return_value, device, memory, offset, size, flags, &ppData);
-    }
+    });
 
     return bytes_read;
 }
@@ -436,10 +419,9 @@ size_t VulkanDecoder::Decode_vkUnmapMemory(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memory);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkUnmapMemory(device, memory);
-    }
+    });
 
     return bytes_read;
 }
@@ -458,10 +440,9 @@ size_t VulkanDecoder::Decode_vkFlushMappedMemoryRanges(const uint8_t* parameter_
     bytes_read += pMemoryRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkFlushMappedMemoryRanges(return_value, device, memoryRangeCount, &pMemoryRanges);
-    }
+    });
 
     return bytes_read;
 }
@@ -480,10 +461,9 @@ size_t VulkanDecoder::Decode_vkInvalidateMappedMemoryRanges(const uint8_t* param
     bytes_read += pMemoryRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkInvalidateMappedMemoryRanges(return_value, device, memoryRangeCount, &pMemoryRanges);
-    }
+    });
 
     return bytes_read;
 }
@@ -500,10 +480,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceMemoryCommitment(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memory);
     bytes_read += pCommittedMemoryInBytes.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceMemoryCommitment(device, memory, &pCommittedMemoryInBytes);
-    }
+    });
 
     return bytes_read;
 }
@@ -524,10 +503,9 @@ size_t VulkanDecoder::Decode_vkBindBufferMemory(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memoryOffset);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBindBufferMemory(return_value, device, buffer, memory, memoryOffset);
-    }
+    });
 
     return bytes_read;
 }
@@ -548,10 +526,9 @@ size_t VulkanDecoder::Decode_vkBindImageMemory(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memoryOffset);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBindImageMemory(return_value, device, image, memory, memoryOffset);
-    }
+    });
 
     return bytes_read;
 }
@@ -568,10 +545,9 @@ size_t VulkanDecoder::Decode_vkGetBufferMemoryRequirements(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &buffer);
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferMemoryRequirements(device, buffer, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -588,10 +564,9 @@ size_t VulkanDecoder::Decode_vkGetImageMemoryRequirements(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &image);
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageMemoryRequirements(device, image, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -610,10 +585,9 @@ size_t VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements(const uint8_t* p
     bytes_read += pSparseMemoryRequirementCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSparseMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageSparseMemoryRequirements(device, image, &pSparseMemoryRequirementCount, &pSparseMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -640,10 +614,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties(cons
     bytes_read += pPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -664,10 +637,9 @@ size_t VulkanDecoder::Decode_vkQueueBindSparse(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueBindSparse(return_value, queue, bindInfoCount, &pBindInfo, fence);
-    }
+    });
 
     return bytes_read;
 }
@@ -688,10 +660,9 @@ size_t VulkanDecoder::Decode_vkCreateFence(const uint8_t* parameter_buffer, size
     bytes_read += pFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateFence(return_value, device, &pCreateInfo, &pAllocator, &pFence);
-    }
+    });
 
     return bytes_read;
 }
@@ -708,10 +679,9 @@ size_t VulkanDecoder::Decode_vkDestroyFence(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyFence(device, fence, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -730,10 +700,9 @@ size_t VulkanDecoder::Decode_vkResetFences(const uint8_t* parameter_buffer, size
     bytes_read += pFences.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkResetFences(return_value, device, fenceCount, &pFences);
-    }
+    });
 
     return bytes_read;
 }
@@ -750,10 +719,9 @@ size_t VulkanDecoder::Decode_vkGetFenceStatus(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetFenceStatus(return_value, device, fence);
-    }
+    });
 
     return bytes_read;
 }
@@ -776,10 +744,9 @@ size_t VulkanDecoder::Decode_vkWaitForFences(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &timeout);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkWaitForFences(return_value, device, fenceCount, &pFences, waitAll, timeout);
-    }
+    });
 
     return bytes_read;
 }
@@ -800,10 +767,9 @@ size_t VulkanDecoder::Decode_vkCreateSemaphore(const uint8_t* parameter_buffer,
     bytes_read += pSemaphore.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateSemaphore(return_value, device, &pCreateInfo, &pAllocator, &pSemaphore);
-    }
+    });
 
     return bytes_read;
 }
@@ -820,10 +786,9 @@ size_t VulkanDecoder::Decode_vkDestroySemaphore(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &semaphore);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroySemaphore(device, semaphore, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -844,10 +809,9 @@ size_t VulkanDecoder::Decode_vkCreateEvent(const uint8_t* parameter_buffer, size
     bytes_read += pEvent.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateEvent(return_value, device, &pCreateInfo, &pAllocator, &pEvent);
-    }
+    });
 
     return bytes_read;
 }
@@ -864,10 +828,9 @@ size_t VulkanDecoder::Decode_vkDestroyEvent(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyEvent(device, event, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -884,10 +847,9 @@ size_t VulkanDecoder::Decode_vkGetEventStatus(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetEventStatus(return_value, device, event);
-    }
+    });
 
     return bytes_read;
 }
@@ -904,10 +866,9 @@ size_t VulkanDecoder::Decode_vkSetEvent(const uint8_t* parameter_buffer, size_t
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSetEvent(return_value, device, event);
-    }
+    });
 
     return bytes_read;
 }
@@ -924,10 +885,9 @@ size_t VulkanDecoder::Decode_vkResetEvent(const uint8_t* parameter_buffer, size_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkResetEvent(return_value, device, event);
-    }
+    });
 
     return bytes_read;
 }
@@ -948,10 +908,9 @@ size_t VulkanDecoder::Decode_vkCreateQueryPool(const uint8_t* parameter_buffer,
     bytes_read += pQueryPool.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateQueryPool(return_value, device, &pCreateInfo, &pAllocator, &pQueryPool);
-    }
+    });
 
     return bytes_read;
 }
@@ -968,10 +927,9 @@ size_t VulkanDecoder::Decode_vkDestroyQueryPool(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyQueryPool(device, queryPool, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1000,10 +958,9 @@ size_t VulkanDecoder::Decode_vkGetQueryPoolResults(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetQueryPoolResults(return_value, device, queryPool, firstQuery, queryCount, dataSize, &pData, stride, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -1024,10 +981,9 @@ size_t VulkanDecoder::Decode_vkCreateBuffer(const uint8_t* parameter_buffer, siz
     bytes_read += pBuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateBuffer(return_value, device, &pCreateInfo, &pAllocator, &pBuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -1044,10 +1000,9 @@ size_t VulkanDecoder::Decode_vkDestroyBuffer(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &buffer);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyBuffer(device, buffer, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1068,10 +1023,9 @@ size_t VulkanDecoder::Decode_vkCreateBufferView(const uint8_t* parameter_buffer,
     bytes_read += pView.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateBufferView(return_value, device, &pCreateInfo, &pAllocator, &pView);
-    }
+    });
 
     return bytes_read;
 }
@@ -1088,10 +1042,9 @@ size_t VulkanDecoder::Decode_vkDestroyBufferView(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bufferView);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyBufferView(device, bufferView, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1112,10 +1065,9 @@ size_t VulkanDecoder::Decode_vkCreateImage(const uint8_t* parameter_buffer, size
     bytes_read += pImage.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateImage(return_value, device, &pCreateInfo, &pAllocator, &pImage);
-    }
+    });
 
     return bytes_read;
 }
@@ -1132,10 +1084,9 @@ size_t VulkanDecoder::Decode_vkDestroyImage(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &image);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyImage(device, image, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1154,10 +1105,9 @@ size_t VulkanDecoder::Decode_vkGetImageSubresourceLayout(const uint8_t* paramete
     bytes_read += pSubresource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageSubresourceLayout(device, image, &pSubresource, &pLayout);
-    }
+    });
 
     return bytes_read;
 }
@@ -1178,10 +1128,9 @@ size_t VulkanDecoder::Decode_vkCreateImageView(const uint8_t* parameter_buffer,
     bytes_read += pView.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateImageView(return_value, device, &pCreateInfo, &pAllocator, &pView);
-    }
+    });
 
     return bytes_read;
 }
@@ -1198,10 +1147,9 @@ size_t VulkanDecoder::Decode_vkDestroyImageView(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageView);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyImageView(device, imageView, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1222,10 +1170,9 @@ size_t VulkanDecoder::Decode_vkCreateShaderModule(const uint8_t* parameter_buffe
     bytes_read += pShaderModule.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateShaderModule(return_value, device, &pCreateInfo, &pAllocator, &pShaderModule);
-    }
+    });
 
     return bytes_read;
 }
@@ -1242,10 +1189,9 @@ size_t VulkanDecoder::Decode_vkDestroyShaderModule(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &shaderModule);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyShaderModule(device, shaderModule, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1266,10 +1212,9 @@ size_t VulkanDecoder::Decode_vkCreatePipelineCache(const uint8_t* parameter_buff
     bytes_read += pPipelineCache.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreatePipelineCache(return_value, device, &pCreateInfo, &pAllocator, &pPipelineCache);
-    }
+    });
 
     return bytes_read;
 }
@@ -1286,10 +1231,9 @@ size_t VulkanDecoder::Decode_vkDestroyPipelineCache(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineCache);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyPipelineCache(device, pipelineCache, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1310,10 +1254,9 @@ size_t VulkanDecoder::Decode_vkGetPipelineCacheData(const uint8_t* parameter_buf
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPipelineCacheData(return_value, device, pipelineCache, &pDataSize, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -1334,10 +1277,9 @@ size_t VulkanDecoder::Decode_vkMergePipelineCaches(const uint8_t* parameter_buff
     bytes_read += pSrcCaches.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkMergePipelineCaches(return_value, device, dstCache, srcCacheCount, &pSrcCaches);
-    }
+    });
 
     return bytes_read;
 }
@@ -1362,10 +1304,9 @@ size_t VulkanDecoder::Decode_vkCreateGraphicsPipelines(const uint8_t* parameter_
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateGraphicsPipelines(return_value, device, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
-    }
+    });
 
     return bytes_read;
 }
@@ -1390,10 +1331,9 @@ size_t VulkanDecoder::Decode_vkCreateComputePipelines(const uint8_t* parameter_b
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateComputePipelines(return_value, device, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
-    }
+    });
 
     return bytes_read;
 }
@@ -1410,10 +1350,9 @@ size_t VulkanDecoder::Decode_vkDestroyPipeline(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipeline);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyPipeline(device, pipeline, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1434,10 +1373,9 @@ size_t VulkanDecoder::Decode_vkCreatePipelineLayout(const uint8_t* parameter_buf
     bytes_read += pPipelineLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreatePipelineLayout(return_value, device, &pCreateInfo, &pAllocator, &pPipelineLayout);
-    }
+    });
 
     return bytes_read;
 }
@@ -1454,10 +1392,9 @@ size_t VulkanDecoder::Decode_vkDestroyPipelineLayout(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineLayout);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyPipelineLayout(device, pipelineLayout, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1478,10 +1415,9 @@ size_t VulkanDecoder::Decode_vkCreateSampler(const uint8_t* parameter_buffer, si
     bytes_read += pSampler.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateSampler(return_value, device, &pCreateInfo, &pAllocator, &pSampler);
-    }
+    });
 
     return bytes_read;
 }
@@ -1498,10 +1434,9 @@ size_t VulkanDecoder::Decode_vkDestroySampler(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &sampler);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroySampler(device, sampler, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1522,10 +1457,9 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorSetLayout(const uint8_t* paramete
     bytes_read += pSetLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDescriptorSetLayout(return_value, device, &pCreateInfo, &pAllocator, &pSetLayout);
-    }
+    });
 
     return bytes_read;
 }
@@ -1542,10 +1476,9 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorSetLayout(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorSetLayout);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDescriptorSetLayout(device, descriptorSetLayout, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1566,10 +1499,9 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorPool(const uint8_t* parameter_buf
     bytes_read += pDescriptorPool.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDescriptorPool(return_value, device, &pCreateInfo, &pAllocator, &pDescriptorPool);
-    }
+    });
 
     return bytes_read;
 }
@@ -1586,10 +1518,9 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorPool(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorPool);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDescriptorPool(device, descriptorPool, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1608,10 +1539,9 @@ size_t VulkanDecoder::Decode_vkResetDescriptorPool(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkResetDescriptorPool(return_value, device, descriptorPool, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -1630,10 +1560,9 @@ size_t VulkanDecoder::Decode_vkAllocateDescriptorSets(const uint8_t* parameter_b
     bytes_read += pDescriptorSets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAllocateDescriptorSets(return_value, device, &pAllocateInfo, &pDescriptorSets);
-    }
+    });
 
     return bytes_read;
 }
@@ -1654,10 +1583,9 @@ size_t VulkanDecoder::Decode_vkFreeDescriptorSets(const uint8_t* parameter_buffe
     bytes_read += pDescriptorSets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkFreeDescriptorSets(return_value, device, descriptorPool, descriptorSetCount, &pDescriptorSets);
-    }
+    });
 
     return bytes_read;
 }
@@ -1678,10 +1606,9 @@ size_t VulkanDecoder::Decode_vkUpdateDescriptorSets(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorCopyCount);
     bytes_read += pDescriptorCopies.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkUpdateDescriptorSets(device, descriptorWriteCount, &pDescriptorWrites, descriptorCopyCount, &pDescriptorCopies);
-    }
+    });
 
     return bytes_read;
 }
@@ -1702,10 +1629,9 @@ size_t VulkanDecoder::Decode_vkCreateFramebuffer(const uint8_t* parameter_buffer
     bytes_read += pFramebuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateFramebuffer(return_value, device, &pCreateInfo, &pAllocator, &pFramebuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -1722,10 +1648,9 @@ size_t VulkanDecoder::Decode_vkDestroyFramebuffer(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &framebuffer);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyFramebuffer(device, framebuffer, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1746,10 +1671,9 @@ size_t VulkanDecoder::Decode_vkCreateRenderPass(const uint8_t* parameter_buffer,
     bytes_read += pRenderPass.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateRenderPass(return_value, device, &pCreateInfo, &pAllocator, &pRenderPass);
-    }
+    });
 
     return bytes_read;
 }
@@ -1766,10 +1690,9 @@ size_t VulkanDecoder::Decode_vkDestroyRenderPass(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &renderPass);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyRenderPass(device, renderPass, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1786,10 +1709,9 @@ size_t VulkanDecoder::Decode_vkGetRenderAreaGranularity(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &renderPass);
     bytes_read += pGranularity.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetRenderAreaGranularity(device, renderPass, &pGranularity);
-    }
+    });
 
     return bytes_read;
 }
@@ -1810,10 +1732,9 @@ size_t VulkanDecoder::Decode_vkCreateCommandPool(const uint8_t* parameter_buffer
     bytes_read += pCommandPool.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateCommandPool(return_value, device, &pCreateInfo, &pAllocator, &pCommandPool);
-    }
+    });
 
     return bytes_read;
 }
@@ -1830,10 +1751,9 @@ size_t VulkanDecoder::Decode_vkDestroyCommandPool(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandPool);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyCommandPool(device, commandPool, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -1852,10 +1772,9 @@ size_t VulkanDecoder::Decode_vkResetCommandPool(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkResetCommandPool(return_value, device, commandPool, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -1874,10 +1793,9 @@ size_t VulkanDecoder::Decode_vkAllocateCommandBuffers(const uint8_t* parameter_b
     bytes_read += pCommandBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAllocateCommandBuffers(return_value, device, &pAllocateInfo, &pCommandBuffers);
-    }
+    });
 
     return bytes_read;
 }
@@ -1896,10 +1814,9 @@ size_t VulkanDecoder::Decode_vkFreeCommandBuffers(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBufferCount);
     bytes_read += pCommandBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkFreeCommandBuffers(device, commandPool, commandBufferCount, &pCommandBuffers);
-    }
+    });
 
     return bytes_read;
 }
@@ -1916,10 +1833,9 @@ size_t VulkanDecoder::Decode_vkBeginCommandBuffer(const uint8_t* parameter_buffe
     bytes_read += pBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBeginCommandBuffer(return_value, commandBuffer, &pBeginInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -1934,10 +1850,9 @@ size_t VulkanDecoder::Decode_vkEndCommandBuffer(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkEndCommandBuffer(return_value, commandBuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -1954,10 +1869,9 @@ size_t VulkanDecoder::Decode_vkResetCommandBuffer(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkResetCommandBuffer(return_value, commandBuffer, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -1974,10 +1888,9 @@ size_t VulkanDecoder::Decode_vkCmdBindPipeline(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineBindPoint);
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipeline);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
-    }
+    });
 
     return bytes_read;
 }
@@ -1996,10 +1909,9 @@ size_t VulkanDecoder::Decode_vkCmdSetViewport(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pViewports.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, &pViewports);
-    }
+    });
 
     return bytes_read;
 }
@@ -2018,10 +1930,9 @@ size_t VulkanDecoder::Decode_vkCmdSetScissor(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scissorCount);
     bytes_read += pScissors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, &pScissors);
-    }
+    });
 
     return bytes_read;
 }
@@ -2036,10 +1947,9 @@ size_t VulkanDecoder::Decode_vkCmdSetLineWidth(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &lineWidth);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetLineWidth(commandBuffer, lineWidth);
-    }
+    });
 
     return bytes_read;
 }
@@ -2058,10 +1968,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthBias(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthBiasClamp);
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthBiasSlopeFactor);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
-    }
+    });
 
     return bytes_read;
 }
@@ -2076,10 +1985,9 @@ size_t VulkanDecoder::Decode_vkCmdSetBlendConstants(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += blendConstants.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetBlendConstants(commandBuffer, &blendConstants);
-    }
+    });
 
     return bytes_read;
 }
@@ -2096,10 +2004,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthBounds(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &minDepthBounds);
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDepthBounds);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
-    }
+    });
 
     return bytes_read;
 }
@@ -2116,10 +2023,9 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilCompareMask(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &faceMask);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &compareMask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
-    }
+    });
 
     return bytes_read;
 }
@@ -2136,10 +2042,9 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilWriteMask(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &faceMask);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &writeMask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
-    }
+    });
 
     return bytes_read;
 }
@@ -2156,10 +2061,9 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilReference(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &faceMask);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &reference);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetStencilReference(commandBuffer, faceMask, reference);
-    }
+    });
 
     return bytes_read;
 }
@@ -2186,10 +2090,9 @@ size_t VulkanDecoder::Decode_vkCmdBindDescriptorSets(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dynamicOffsetCount);
     bytes_read += pDynamicOffsets.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, &pDescriptorSets, dynamicOffsetCount, &pDynamicOffsets);
-    }
+    });
 
     return bytes_read;
 }
@@ -2208,10 +2111,9 @@ size_t VulkanDecoder::Decode_vkCmdBindIndexBuffer(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &offset);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &indexType);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
-    }
+    });
 
     return bytes_read;
 }
@@ -2232,10 +2134,9 @@ size_t VulkanDecoder::Decode_vkCmdBindVertexBuffers(const uint8_t* parameter_buf
     bytes_read += pBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, &pBuffers, &pOffsets);
-    }
+    });
 
     return bytes_read;
 }
@@ -2256,10 +2157,9 @@ size_t VulkanDecoder::Decode_vkCmdDraw(const uint8_t* parameter_buffer, size_t b
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstVertex);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstInstance);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
-    }
+    });
 
     return bytes_read;
 }
@@ -2282,10 +2182,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexed(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &vertexOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstInstance);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
-    }
+    });
 
     return bytes_read;
 }
@@ -2306,10 +2205,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirect(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &drawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -2330,10 +2228,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirect(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &drawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -2352,10 +2249,9 @@ size_t VulkanDecoder::Decode_vkCmdDispatch(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountY);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountZ);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
-    }
+    });
 
     return bytes_read;
 }
@@ -2372,10 +2268,9 @@ size_t VulkanDecoder::Decode_vkCmdDispatchIndirect(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &buffer);
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &offset);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDispatchIndirect(commandBuffer, buffer, offset);
-    }
+    });
 
     return bytes_read;
 }
@@ -2396,10 +2291,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyBuffer(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, &pRegions);
-    }
+    });
 
     return bytes_read;
 }
@@ -2424,10 +2318,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyImage(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, &pRegions);
-    }
+    });
 
     return bytes_read;
 }
@@ -2454,10 +2347,9 @@ size_t VulkanDecoder::Decode_vkCmdBlitImage(const uint8_t* parameter_buffer, siz
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &filter);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, &pRegions, filter);
-    }
+    });
 
     return bytes_read;
 }
@@ -2480,10 +2372,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyBufferToImage(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, &pRegions);
-    }
+    });
 
     return bytes_read;
 }
@@ -2506,10 +2397,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyImageToBuffer(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, &pRegions);
-    }
+    });
 
     return bytes_read;
 }
@@ -2530,10 +2420,9 @@ size_t VulkanDecoder::Decode_vkCmdUpdateBuffer(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dataSize);
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -2554,10 +2443,9 @@ size_t VulkanDecoder::Decode_vkCmdFillBuffer(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &size);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &data);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
-    }
+    });
 
     return bytes_read;
 }
@@ -2580,10 +2468,9 @@ size_t VulkanDecoder::Decode_vkCmdClearColorImage(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rangeCount);
     bytes_read += pRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdClearColorImage(commandBuffer, image, imageLayout, &pColor, rangeCount, &pRanges);
-    }
+    });
 
     return bytes_read;
 }
@@ -2606,10 +2493,9 @@ size_t VulkanDecoder::Decode_vkCmdClearDepthStencilImage(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rangeCount);
     bytes_read += pRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdClearDepthStencilImage(commandBuffer, image, imageLayout, &pDepthStencil, rangeCount, &pRanges);
-    }
+    });
 
     return bytes_read;
 }
@@ -2630,10 +2516,9 @@ size_t VulkanDecoder::Decode_vkCmdClearAttachments(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rectCount);
     bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdClearAttachments(commandBuffer, attachmentCount, &pAttachments, rectCount, &pRects);
-    }
+    });
 
     return bytes_read;
 }
@@ -2658,10 +2543,9 @@ size_t VulkanDecoder::Decode_vkCmdResolveImage(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, &pRegions);
-    }
+    });
 
     return bytes_read;
 }
@@ -2678,10 +2562,9 @@ size_t VulkanDecoder::Decode_vkCmdSetEvent(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stageMask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetEvent(commandBuffer, event, stageMask);
-    }
+    });
 
     return bytes_read;
 }
@@ -2698,10 +2581,9 @@ size_t VulkanDecoder::Decode_vkCmdResetEvent(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stageMask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdResetEvent(commandBuffer, event, stageMask);
-    }
+    });
 
     return bytes_read;
 }
@@ -2734,10 +2616,9 @@ size_t VulkanDecoder::Decode_vkCmdWaitEvents(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageMemoryBarrierCount);
     bytes_read += pImageMemoryBarriers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWaitEvents(commandBuffer, eventCount, &pEvents, srcStageMask, dstStageMask, memoryBarrierCount, &pMemoryBarriers, bufferMemoryBarrierCount, &pBufferMemoryBarriers, imageMemoryBarrierCount, &pImageMemoryBarriers);
-    }
+    });
 
     return bytes_read;
 }
@@ -2768,10 +2649,9 @@ size_t VulkanDecoder::Decode_vkCmdPipelineBarrier(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageMemoryBarrierCount);
     bytes_read += pImageMemoryBarriers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, &pMemoryBarriers, bufferMemoryBarrierCount, &pBufferMemoryBarriers, imageMemoryBarrierCount, &pImageMemoryBarriers);
-    }
+    });
 
     return bytes_read;
 }
@@ -2790,10 +2670,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginQuery(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginQuery(commandBuffer, queryPool, query, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -2810,10 +2689,9 @@ size_t VulkanDecoder::Decode_vkCmdEndQuery(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndQuery(commandBuffer, queryPool, query);
-    }
+    });
 
     return bytes_read;
 }
@@ -2832,10 +2710,9 @@ size_t VulkanDecoder::Decode_vkCmdResetQueryPool(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryCount);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
-    }
+    });
 
     return bytes_read;
 }
@@ -2854,10 +2731,9 @@ size_t VulkanDecoder::Decode_vkCmdWriteTimestamp(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
-    }
+    });
 
     return bytes_read;
 }
@@ -2884,10 +2760,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyQueryPoolResults(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -2910,10 +2785,9 @@ size_t VulkanDecoder::Decode_vkCmdPushConstants(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &size);
     bytes_read += pValues.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, &pValues);
-    }
+    });
 
     return bytes_read;
 }
@@ -2930,10 +2804,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginRenderPass(const uint8_t* parameter_buffe
     bytes_read += pRenderPassBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &contents);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginRenderPass(commandBuffer, &pRenderPassBegin, contents);
-    }
+    });
 
     return bytes_read;
 }
@@ -2948,10 +2821,9 @@ size_t VulkanDecoder::Decode_vkCmdNextSubpass(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &contents);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdNextSubpass(commandBuffer, contents);
-    }
+    });
 
     return bytes_read;
 }
@@ -2964,10 +2836,9 @@ size_t VulkanDecoder::Decode_vkCmdEndRenderPass(const uint8_t* parameter_buffer,
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndRenderPass(commandBuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -2984,10 +2855,9 @@ size_t VulkanDecoder::Decode_vkCmdExecuteCommands(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBufferCount);
     bytes_read += pCommandBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdExecuteCommands(commandBuffer, commandBufferCount, &pCommandBuffers);
-    }
+    });
 
     return bytes_read;
 }
@@ -3006,10 +2876,9 @@ size_t VulkanDecoder::Decode_vkBindBufferMemory2(const uint8_t* parameter_buffer
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBindBufferMemory2(return_value, device, bindInfoCount, &pBindInfos);
-    }
+    });
 
     return bytes_read;
 }
@@ -3028,10 +2897,9 @@ size_t VulkanDecoder::Decode_vkBindImageMemory2(const uint8_t* parameter_buffer,
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBindImageMemory2(return_value, device, bindInfoCount, &pBindInfos);
-    }
+    });
 
     return bytes_read;
 }
@@ -3052,10 +2920,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeatures(const uint8_t* p
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &remoteDeviceIndex);
     bytes_read += pPeerMemoryFeatures.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, &pPeerMemoryFeatures);
-    }
+    });
 
     return bytes_read;
 }
@@ -3070,10 +2937,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDeviceMask(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &deviceMask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDeviceMask(commandBuffer, deviceMask);
-    }
+    });
 
     return bytes_read;
 }
@@ -3098,10 +2964,9 @@ size_t VulkanDecoder::Decode_vkCmdDispatchBase(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountY);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountZ);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    }
+    });
 
     return bytes_read;
 }
@@ -3120,10 +2985,9 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroups(const uint8_t* para
     bytes_read += pPhysicalDeviceGroupProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkEnumeratePhysicalDeviceGroups(return_value, instance, &pPhysicalDeviceGroupCount, &pPhysicalDeviceGroupProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3140,10 +3004,9 @@ size_t VulkanDecoder::Decode_vkGetImageMemoryRequirements2(const uint8_t* parame
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageMemoryRequirements2(device, &pInfo, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -3160,10 +3023,9 @@ size_t VulkanDecoder::Decode_vkGetBufferMemoryRequirements2(const uint8_t* param
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferMemoryRequirements2(device, &pInfo, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -3182,10 +3044,9 @@ size_t VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2(const uint8_t*
     bytes_read += pSparseMemoryRequirementCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSparseMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageSparseMemoryRequirements2(device, &pInfo, &pSparseMemoryRequirementCount, &pSparseMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -3200,10 +3061,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pFeatures.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceFeatures2(physicalDevice, &pFeatures);
-    }
+    });
 
     return bytes_read;
 }
@@ -3218,10 +3078,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2(const uint8_t* param
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceProperties2(physicalDevice, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3238,10 +3097,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2(const uint8_t*
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &format);
     bytes_read += pFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceFormatProperties2(physicalDevice, format, &pFormatProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3260,10 +3118,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2(const uin
     bytes_read += pImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceImageFormatProperties2(return_value, physicalDevice, &pImageFormatInfo, &pImageFormatProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3280,10 +3137,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2(const uin
     bytes_read += pQueueFamilyPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueueFamilyProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, &pQueueFamilyPropertyCount, &pQueueFamilyProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3298,10 +3154,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pMemoryProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceMemoryProperties2(physicalDevice, &pMemoryProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3320,10 +3175,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2(con
     bytes_read += pPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, &pFormatInfo, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3340,10 +3194,9 @@ size_t VulkanDecoder::Decode_vkTrimCommandPool(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandPool);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkTrimCommandPool(device, commandPool, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -3360,10 +3213,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceQueue2(const uint8_t* parameter_buffer,
     bytes_read += pQueueInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceQueue2(device, &pQueueInfo, &pQueue);
-    }
+    });
 
     return bytes_read;
 }
@@ -3384,10 +3236,9 @@ size_t VulkanDecoder::Decode_vkCreateSamplerYcbcrConversion(const uint8_t* param
     bytes_read += pYcbcrConversion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateSamplerYcbcrConversion(return_value, device, &pCreateInfo, &pAllocator, &pYcbcrConversion);
-    }
+    });
 
     return bytes_read;
 }
@@ -3404,10 +3255,9 @@ size_t VulkanDecoder::Decode_vkDestroySamplerYcbcrConversion(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ycbcrConversion);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroySamplerYcbcrConversion(device, ycbcrConversion, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -3428,10 +3278,9 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplate(const uint8_t* par
     bytes_read += pDescriptorUpdateTemplate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDescriptorUpdateTemplate(return_value, device, &pCreateInfo, &pAllocator, &pDescriptorUpdateTemplate);
-    }
+    });
 
     return bytes_read;
 }
@@ -3448,10 +3297,9 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplate(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -3468,10 +3316,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferProperties(const u
     bytes_read += pExternalBufferInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalBufferProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceExternalBufferProperties(physicalDevice, &pExternalBufferInfo, &pExternalBufferProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3488,10 +3335,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFenceProperties(const ui
     bytes_read += pExternalFenceInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalFenceProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceExternalFenceProperties(physicalDevice, &pExternalFenceInfo, &pExternalFenceProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3508,10 +3354,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphoreProperties(cons
     bytes_read += pExternalSemaphoreInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalSemaphoreProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, &pExternalSemaphoreInfo, &pExternalSemaphoreProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -3528,10 +3373,9 @@ size_t VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupport(const uint8_t* para
     bytes_read += pCreateInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSupport.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDescriptorSetLayoutSupport(device, &pCreateInfo, &pSupport);
-    }
+    });
 
     return bytes_read;
 }
@@ -3556,10 +3400,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectCount(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -3584,10 +3427,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCount(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -3608,10 +3450,9 @@ size_t VulkanDecoder::Decode_vkCreateRenderPass2(const uint8_t* parameter_buffer
     bytes_read += pRenderPass.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateRenderPass2(return_value, device, &pCreateInfo, &pAllocator, &pRenderPass);
-    }
+    });
 
     return bytes_read;
 }
@@ -3628,10 +3469,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginRenderPass2(const uint8_t* parameter_buff
     bytes_read += pRenderPassBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginRenderPass2(commandBuffer, &pRenderPassBegin, &pSubpassBeginInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -3648,10 +3488,9 @@ size_t VulkanDecoder::Decode_vkCmdNextSubpass2(const uint8_t* parameter_buffer,
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdNextSubpass2(commandBuffer, &pSubpassBeginInfo, &pSubpassEndInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -3666,10 +3505,9 @@ size_t VulkanDecoder::Decode_vkCmdEndRenderPass2(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndRenderPass2(commandBuffer, &pSubpassEndInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -3688,10 +3526,9 @@ size_t VulkanDecoder::Decode_vkResetQueryPool(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryCount);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkResetQueryPool(device, queryPool, firstQuery, queryCount);
-    }
+    });
 
     return bytes_read;
 }
@@ -3710,10 +3547,9 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreCounterValue(const uint8_t* parameter
     bytes_read += pValue.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSemaphoreCounterValue(return_value, device, semaphore, &pValue);
-    }
+    });
 
     return bytes_read;
 }
@@ -3732,10 +3568,9 @@ size_t VulkanDecoder::Decode_vkWaitSemaphores(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &timeout);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkWaitSemaphores(return_value, device, &pWaitInfo, timeout);
-    }
+    });
 
     return bytes_read;
 }
@@ -3752,10 +3587,9 @@ size_t VulkanDecoder::Decode_vkSignalSemaphore(const uint8_t* parameter_buffer,
     bytes_read += pSignalInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSignalSemaphore(return_value, device, &pSignalInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -3772,10 +3606,9 @@ size_t VulkanDecoder::Decode_vkGetBufferDeviceAddress(const uint8_t* parameter_b
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferDeviceAddress(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -3792,10 +3625,9 @@ size_t VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddress(const uint8_t* para
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferOpaqueCaptureAddress(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -3812,10 +3644,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddress(const uint8_t
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceMemoryOpaqueCaptureAddress(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -3832,10 +3663,9 @@ size_t VulkanDecoder::Decode_vkDestroySurfaceKHR(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &surface);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroySurfaceKHR(instance, surface, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -3856,10 +3686,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceSupportKHR(const uint8_t*
     bytes_read += pSupported.DecodeVkBool32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfaceSupportKHR(return_value, physicalDevice, queueFamilyIndex, surface, &pSupported);
-    }
+    });
 
     return bytes_read;
 }
@@ -3878,10 +3707,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(const uin
     bytes_read += pSurfaceCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(return_value, physicalDevice, surface, &pSurfaceCapabilities);
-    }
+    });
 
     return bytes_read;
 }
@@ -3902,10 +3730,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormatsKHR(const uint8_t*
     bytes_read += pSurfaceFormats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfaceFormatsKHR(return_value, physicalDevice, surface, &pSurfaceFormatCount, &pSurfaceFormats);
-    }
+    });
 
     return bytes_read;
 }
@@ -3926,10 +3753,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModesKHR(const uin
     bytes_read += pPresentModes.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfacePresentModesKHR(return_value, physicalDevice, surface, &pPresentModeCount, &pPresentModes);
-    }
+    });
 
     return bytes_read;
 }
@@ -3950,10 +3776,9 @@ size_t VulkanDecoder::Decode_vkCreateSwapchainKHR(const uint8_t* parameter_buffe
     bytes_read += pSwapchain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateSwapchainKHR(return_value, device, &pCreateInfo, &pAllocator, &pSwapchain);
-    }
+    });
 
     return bytes_read;
 }
@@ -3970,10 +3795,9 @@ size_t VulkanDecoder::Decode_vkDestroySwapchainKHR(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroySwapchainKHR(device, swapchain, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -3994,10 +3818,9 @@ size_t VulkanDecoder::Decode_vkGetSwapchainImagesKHR(const uint8_t* parameter_bu
     bytes_read += pSwapchainImages.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSwapchainImagesKHR(return_value, device, swapchain, &pSwapchainImageCount, &pSwapchainImages);
-    }
+    });
 
     return bytes_read;
 }
@@ -4022,10 +3845,9 @@ size_t VulkanDecoder::Decode_vkAcquireNextImageKHR(const uint8_t* parameter_buff
     bytes_read += pImageIndex.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquireNextImageKHR(return_value, device, swapchain, timeout, semaphore, fence, &pImageIndex);
-    }
+    });
 
     return bytes_read;
 }
@@ -4042,10 +3864,9 @@ size_t VulkanDecoder::Decode_vkQueuePresentKHR(const uint8_t* parameter_buffer,
     bytes_read += pPresentInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueuePresentKHR(return_value, queue, &pPresentInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -4062,10 +3883,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupPresentCapabilitiesKHR(const uint8_
     bytes_read += pDeviceGroupPresentCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceGroupPresentCapabilitiesKHR(return_value, device, &pDeviceGroupPresentCapabilities);
-    }
+    });
 
     return bytes_read;
 }
@@ -4084,10 +3904,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModesKHR(const uint8_
     bytes_read += pModes.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceGroupSurfacePresentModesKHR(return_value, device, surface, &pModes);
-    }
+    });
 
     return bytes_read;
 }
@@ -4108,10 +3927,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDevicePresentRectanglesKHR(const uint8
     bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDevicePresentRectanglesKHR(return_value, physicalDevice, surface, &pRectCount, &pRects);
-    }
+    });
 
     return bytes_read;
 }
@@ -4130,10 +3948,9 @@ size_t VulkanDecoder::Decode_vkAcquireNextImage2KHR(const uint8_t* parameter_buf
     bytes_read += pImageIndex.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquireNextImage2KHR(return_value, device, &pAcquireInfo, &pImageIndex);
-    }
+    });
 
     return bytes_read;
 }
@@ -4152,10 +3969,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPropertiesKHR(const uint8
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceDisplayPropertiesKHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4174,10 +3990,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(const
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4198,10 +4013,9 @@ size_t VulkanDecoder::Decode_vkGetDisplayPlaneSupportedDisplaysKHR(const uint8_t
     bytes_read += pDisplays.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDisplayPlaneSupportedDisplaysKHR(return_value, physicalDevice, planeIndex, &pDisplayCount, &pDisplays);
-    }
+    });
 
     return bytes_read;
 }
@@ -4222,10 +4036,9 @@ size_t VulkanDecoder::Decode_vkGetDisplayModePropertiesKHR(const uint8_t* parame
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDisplayModePropertiesKHR(return_value, physicalDevice, display, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4248,10 +4061,9 @@ size_t VulkanDecoder::Decode_vkCreateDisplayModeKHR(const uint8_t* parameter_buf
     bytes_read += pMode.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDisplayModeKHR(return_value, physicalDevice, display, &pCreateInfo, &pAllocator, &pMode);
-    }
+    });
 
     return bytes_read;
 }
@@ -4272,10 +4084,9 @@ size_t VulkanDecoder::Decode_vkGetDisplayPlaneCapabilitiesKHR(const uint8_t* par
     bytes_read += pCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDisplayPlaneCapabilitiesKHR(return_value, physicalDevice, mode, planeIndex, &pCapabilities);
-    }
+    });
 
     return bytes_read;
 }
@@ -4296,10 +4107,9 @@ size_t VulkanDecoder::Decode_vkCreateDisplayPlaneSurfaceKHR(const uint8_t* param
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDisplayPlaneSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -4322,10 +4132,9 @@ size_t VulkanDecoder::Decode_vkCreateSharedSwapchainsKHR(const uint8_t* paramete
     bytes_read += pSwapchains.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateSharedSwapchainsKHR(return_value, device, swapchainCount, &pCreateInfos, &pAllocator, &pSwapchains);
-    }
+    });
 
     return bytes_read;
 }
@@ -4346,10 +4155,9 @@ size_t VulkanDecoder::Decode_vkCreateXlibSurfaceKHR(const uint8_t* parameter_buf
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateXlibSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -4370,10 +4178,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceXlibPresentationSupportKHR(const
     bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visualID);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex, dpy, visualID);
-    }
+    });
 
     return bytes_read;
 }
@@ -4394,10 +4201,9 @@ size_t VulkanDecoder::Decode_vkCreateXcbSurfaceKHR(const uint8_t* parameter_buff
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateXcbSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -4418,10 +4224,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceXcbPresentationSupportKHR(const
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visual_id);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex, connection, visual_id);
-    }
+    });
 
     return bytes_read;
 }
@@ -4442,10 +4247,9 @@ size_t VulkanDecoder::Decode_vkCreateWaylandSurfaceKHR(const uint8_t* parameter_
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateWaylandSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -4464,10 +4268,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(co
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceWaylandPresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex, display);
-    }
+    });
 
     return bytes_read;
 }
@@ -4488,10 +4291,9 @@ size_t VulkanDecoder::Decode_vkCreateAndroidSurfaceKHR(const uint8_t* parameter_
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateAndroidSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -4512,10 +4314,9 @@ size_t VulkanDecoder::Decode_vkCreateWin32SurfaceKHR(const uint8_t* parameter_bu
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateWin32SurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -4532,10 +4333,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceWin32PresentationSupportKHR(cons
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queueFamilyIndex);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceWin32PresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex);
-    }
+    });
 
     return bytes_read;
 }
@@ -4550,10 +4350,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2KHR(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pFeatures.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceFeatures2KHR(physicalDevice, &pFeatures);
-    }
+    });
 
     return bytes_read;
 }
@@ -4568,10 +4367,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2KHR(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceProperties2KHR(physicalDevice, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4588,10 +4386,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2KHR(const uint8
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &format);
     bytes_read += pFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, &pFormatProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4610,10 +4407,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2KHR(const
     bytes_read += pImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceImageFormatProperties2KHR(return_value, physicalDevice, &pImageFormatInfo, &pImageFormatProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4630,10 +4426,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2KHR(const
     bytes_read += pQueueFamilyPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueueFamilyProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, &pQueueFamilyPropertyCount, &pQueueFamilyProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4648,10 +4443,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2KHR(const uint8
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pMemoryProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, &pMemoryProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4670,10 +4464,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
     bytes_read += pPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, &pFormatInfo, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4694,10 +4487,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeaturesKHR(const uint8_t
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &remoteDeviceIndex);
     bytes_read += pPeerMemoryFeatures.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, &pPeerMemoryFeatures);
-    }
+    });
 
     return bytes_read;
 }
@@ -4712,10 +4504,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDeviceMaskKHR(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &deviceMask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
-    }
+    });
 
     return bytes_read;
 }
@@ -4740,10 +4531,9 @@ size_t VulkanDecoder::Decode_vkCmdDispatchBaseKHR(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountY);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountZ);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    }
+    });
 
     return bytes_read;
 }
@@ -4760,10 +4550,9 @@ size_t VulkanDecoder::Decode_vkTrimCommandPoolKHR(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandPool);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkTrimCommandPoolKHR(device, commandPool, flags);
-    }
+    });
 
     return bytes_read;
 }
@@ -4782,10 +4571,9 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroupsKHR(const uint8_t* p
     bytes_read += pPhysicalDeviceGroupProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkEnumeratePhysicalDeviceGroupsKHR(return_value, instance, &pPhysicalDeviceGroupCount, &pPhysicalDeviceGroupProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4802,10 +4590,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(cons
     bytes_read += pExternalBufferInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalBufferProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, &pExternalBufferInfo, &pExternalBufferProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4824,10 +4611,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryWin32HandleKHR(const uint8_t* parameter_
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryWin32HandleKHR(return_value, device, &pGetWin32HandleInfo, &pHandle);
-    }
+    });
 
     return bytes_read;
 }
@@ -4848,10 +4634,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryWin32HandlePropertiesKHR(const uint8_t*
     bytes_read += pMemoryWin32HandleProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryWin32HandlePropertiesKHR(return_value, device, handleType, handle, &pMemoryWin32HandleProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4870,10 +4655,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryFdKHR(const uint8_t* parameter_buffer, s
     bytes_read += pFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryFdKHR(return_value, device, &pGetFdInfo, &pFd);
-    }
+    });
 
     return bytes_read;
 }
@@ -4894,10 +4678,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryFdPropertiesKHR(const uint8_t* parameter
     bytes_read += pMemoryFdProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryFdPropertiesKHR(return_value, device, handleType, fd, &pMemoryFdProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4914,10 +4697,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(c
     bytes_read += pExternalSemaphoreInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalSemaphoreProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, &pExternalSemaphoreInfo, &pExternalSemaphoreProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -4934,10 +4716,9 @@ size_t VulkanDecoder::Decode_vkImportSemaphoreWin32HandleKHR(const uint8_t* para
     bytes_read += pImportSemaphoreWin32HandleInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkImportSemaphoreWin32HandleKHR(return_value, device, &pImportSemaphoreWin32HandleInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -4956,10 +4737,9 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreWin32HandleKHR(const uint8_t* paramet
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSemaphoreWin32HandleKHR(return_value, device, &pGetWin32HandleInfo, &pHandle);
-    }
+    });
 
     return bytes_read;
 }
@@ -4976,10 +4756,9 @@ size_t VulkanDecoder::Decode_vkImportSemaphoreFdKHR(const uint8_t* parameter_buf
     bytes_read += pImportSemaphoreFdInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkImportSemaphoreFdKHR(return_value, device, &pImportSemaphoreFdInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -4998,10 +4777,9 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreFdKHR(const uint8_t* parameter_buffer
     bytes_read += pFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSemaphoreFdKHR(return_value, device, &pGetFdInfo, &pFd);
-    }
+    });
 
     return bytes_read;
 }
@@ -5024,10 +4802,9 @@ size_t VulkanDecoder::Decode_vkCmdPushDescriptorSetKHR(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorWriteCount);
     bytes_read += pDescriptorWrites.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, &pDescriptorWrites);
-    }
+    });
 
     return bytes_read;
 }
@@ -5048,10 +4825,9 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplateKHR(const uint8_t*
     bytes_read += pDescriptorUpdateTemplate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDescriptorUpdateTemplateKHR(return_value, device, &pCreateInfo, &pAllocator, &pDescriptorUpdateTemplate);
-    }
+    });
 
     return bytes_read;
 }
@@ -5068,10 +4844,9 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplateKHR(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -5092,10 +4867,9 @@ size_t VulkanDecoder::Decode_vkCreateRenderPass2KHR(const uint8_t* parameter_buf
     bytes_read += pRenderPass.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateRenderPass2KHR(return_value, device, &pCreateInfo, &pAllocator, &pRenderPass);
-    }
+    });
 
     return bytes_read;
 }
@@ -5112,10 +4886,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginRenderPass2KHR(const uint8_t* parameter_b
     bytes_read += pRenderPassBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginRenderPass2KHR(commandBuffer, &pRenderPassBegin, &pSubpassBeginInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5132,10 +4905,9 @@ size_t VulkanDecoder::Decode_vkCmdNextSubpass2KHR(const uint8_t* parameter_buffe
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdNextSubpass2KHR(commandBuffer, &pSubpassBeginInfo, &pSubpassEndInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5150,10 +4922,9 @@ size_t VulkanDecoder::Decode_vkCmdEndRenderPass2KHR(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndRenderPass2KHR(commandBuffer, &pSubpassEndInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5170,10 +4941,9 @@ size_t VulkanDecoder::Decode_vkGetSwapchainStatusKHR(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSwapchainStatusKHR(return_value, device, swapchain);
-    }
+    });
 
     return bytes_read;
 }
@@ -5190,10 +4960,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFencePropertiesKHR(const
     bytes_read += pExternalFenceInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalFenceProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, &pExternalFenceInfo, &pExternalFenceProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -5210,10 +4979,9 @@ size_t VulkanDecoder::Decode_vkImportFenceWin32HandleKHR(const uint8_t* paramete
     bytes_read += pImportFenceWin32HandleInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkImportFenceWin32HandleKHR(return_value, device, &pImportFenceWin32HandleInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5232,10 +5000,9 @@ size_t VulkanDecoder::Decode_vkGetFenceWin32HandleKHR(const uint8_t* parameter_b
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetFenceWin32HandleKHR(return_value, device, &pGetWin32HandleInfo, &pHandle);
-    }
+    });
 
     return bytes_read;
 }
@@ -5252,10 +5019,9 @@ size_t VulkanDecoder::Decode_vkImportFenceFdKHR(const uint8_t* parameter_buffer,
     bytes_read += pImportFenceFdInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkImportFenceFdKHR(return_value, device, &pImportFenceFdInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5274,10 +5040,9 @@ size_t VulkanDecoder::Decode_vkGetFenceFdKHR(const uint8_t* parameter_buffer, si
     bytes_read += pFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetFenceFdKHR(return_value, device, &pGetFdInfo, &pFd);
-    }
+    });
 
     return bytes_read;
 }
@@ -5300,10 +5065,9 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQuer
     bytes_read += pCounterDescriptions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(return_value, physicalDevice, queueFamilyIndex, &pCounterCount, &pCounters, &pCounterDescriptions);
-    }
+    });
 
     return bytes_read;
 }
@@ -5320,10 +5084,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPasse
     bytes_read += pPerformanceQueryCreateInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pNumPasses.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, &pPerformanceQueryCreateInfo, &pNumPasses);
-    }
+    });
 
     return bytes_read;
 }
@@ -5340,10 +5103,9 @@ size_t VulkanDecoder::Decode_vkAcquireProfilingLockKHR(const uint8_t* parameter_
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquireProfilingLockKHR(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5356,10 +5118,9 @@ size_t VulkanDecoder::Decode_vkReleaseProfilingLockKHR(const uint8_t* parameter_
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkReleaseProfilingLockKHR(device);
-    }
+    });
 
     return bytes_read;
 }
@@ -5378,10 +5139,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2KHR(const ui
     bytes_read += pSurfaceCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(return_value, physicalDevice, &pSurfaceInfo, &pSurfaceCapabilities);
-    }
+    });
 
     return bytes_read;
 }
@@ -5402,10 +5162,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormats2KHR(const uint8_t
     bytes_read += pSurfaceFormats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfaceFormats2KHR(return_value, physicalDevice, &pSurfaceInfo, &pSurfaceFormatCount, &pSurfaceFormats);
-    }
+    });
 
     return bytes_read;
 }
@@ -5424,10 +5183,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayProperties2KHR(const uint
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceDisplayProperties2KHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -5446,10 +5204,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(const
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -5470,10 +5227,9 @@ size_t VulkanDecoder::Decode_vkGetDisplayModeProperties2KHR(const uint8_t* param
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDisplayModeProperties2KHR(return_value, physicalDevice, display, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -5492,10 +5248,9 @@ size_t VulkanDecoder::Decode_vkGetDisplayPlaneCapabilities2KHR(const uint8_t* pa
     bytes_read += pCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDisplayPlaneCapabilities2KHR(return_value, physicalDevice, &pDisplayPlaneInfo, &pCapabilities);
-    }
+    });
 
     return bytes_read;
 }
@@ -5512,10 +5267,9 @@ size_t VulkanDecoder::Decode_vkGetImageMemoryRequirements2KHR(const uint8_t* par
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageMemoryRequirements2KHR(device, &pInfo, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -5532,10 +5286,9 @@ size_t VulkanDecoder::Decode_vkGetBufferMemoryRequirements2KHR(const uint8_t* pa
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferMemoryRequirements2KHR(device, &pInfo, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -5554,10 +5307,9 @@ size_t VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2KHR(const uint8_
     bytes_read += pSparseMemoryRequirementCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSparseMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageSparseMemoryRequirements2KHR(device, &pInfo, &pSparseMemoryRequirementCount, &pSparseMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -5578,10 +5330,9 @@ size_t VulkanDecoder::Decode_vkCreateSamplerYcbcrConversionKHR(const uint8_t* pa
     bytes_read += pYcbcrConversion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateSamplerYcbcrConversionKHR(return_value, device, &pCreateInfo, &pAllocator, &pYcbcrConversion);
-    }
+    });
 
     return bytes_read;
 }
@@ -5598,10 +5349,9 @@ size_t VulkanDecoder::Decode_vkDestroySamplerYcbcrConversionKHR(const uint8_t* p
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ycbcrConversion);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -5620,10 +5370,9 @@ size_t VulkanDecoder::Decode_vkBindBufferMemory2KHR(const uint8_t* parameter_buf
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBindBufferMemory2KHR(return_value, device, bindInfoCount, &pBindInfos);
-    }
+    });
 
     return bytes_read;
 }
@@ -5642,10 +5391,9 @@ size_t VulkanDecoder::Decode_vkBindImageMemory2KHR(const uint8_t* parameter_buff
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBindImageMemory2KHR(return_value, device, bindInfoCount, &pBindInfos);
-    }
+    });
 
     return bytes_read;
 }
@@ -5662,10 +5410,9 @@ size_t VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupportKHR(const uint8_t* p
     bytes_read += pCreateInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSupport.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDescriptorSetLayoutSupportKHR(device, &pCreateInfo, &pSupport);
-    }
+    });
 
     return bytes_read;
 }
@@ -5690,10 +5437,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectCountKHR(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -5718,10 +5464,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountKHR(const uint8_t* par
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -5740,10 +5485,9 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreCounterValueKHR(const uint8_t* parame
     bytes_read += pValue.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSemaphoreCounterValueKHR(return_value, device, semaphore, &pValue);
-    }
+    });
 
     return bytes_read;
 }
@@ -5762,10 +5506,9 @@ size_t VulkanDecoder::Decode_vkWaitSemaphoresKHR(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &timeout);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkWaitSemaphoresKHR(return_value, device, &pWaitInfo, timeout);
-    }
+    });
 
     return bytes_read;
 }
@@ -5782,10 +5525,9 @@ size_t VulkanDecoder::Decode_vkSignalSemaphoreKHR(const uint8_t* parameter_buffe
     bytes_read += pSignalInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSignalSemaphoreKHR(return_value, device, &pSignalInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5804,10 +5546,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFragmentShadingRatesKHR(const ui
     bytes_read += pFragmentShadingRates.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceFragmentShadingRatesKHR(return_value, physicalDevice, &pFragmentShadingRateCount, &pFragmentShadingRates);
-    }
+    });
 
     return bytes_read;
 }
@@ -5824,10 +5565,9 @@ size_t VulkanDecoder::Decode_vkCmdSetFragmentShadingRateKHR(const uint8_t* param
     bytes_read += pFragmentSize.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += combinerOps.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetFragmentShadingRateKHR(commandBuffer, &pFragmentSize, &combinerOps);
-    }
+    });
 
     return bytes_read;
 }
@@ -5844,10 +5584,9 @@ size_t VulkanDecoder::Decode_vkGetBufferDeviceAddressKHR(const uint8_t* paramete
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferDeviceAddressKHR(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5864,10 +5603,9 @@ size_t VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddressKHR(const uint8_t* p
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferOpaqueCaptureAddressKHR(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5884,10 +5622,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddressKHR(const uint
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -5906,10 +5643,9 @@ size_t VulkanDecoder::Decode_vkCreateDeferredOperationKHR(const uint8_t* paramet
     bytes_read += pDeferredOperation.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDeferredOperationKHR(return_value, device, &pAllocator, &pDeferredOperation);
-    }
+    });
 
     return bytes_read;
 }
@@ -5926,10 +5662,9 @@ size_t VulkanDecoder::Decode_vkDestroyDeferredOperationKHR(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDeferredOperationKHR(device, operation, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -5946,10 +5681,9 @@ size_t VulkanDecoder::Decode_vkGetDeferredOperationMaxConcurrencyKHR(const uint8
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeferredOperationMaxConcurrencyKHR(return_value, device, operation);
-    }
+    });
 
     return bytes_read;
 }
@@ -5966,10 +5700,9 @@ size_t VulkanDecoder::Decode_vkGetDeferredOperationResultKHR(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeferredOperationResultKHR(return_value, device, operation);
-    }
+    });
 
     return bytes_read;
 }
@@ -5986,10 +5719,9 @@ size_t VulkanDecoder::Decode_vkDeferredOperationJoinKHR(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDeferredOperationJoinKHR(return_value, device, operation);
-    }
+    });
 
     return bytes_read;
 }
@@ -6010,10 +5742,9 @@ size_t VulkanDecoder::Decode_vkGetPipelineExecutablePropertiesKHR(const uint8_t*
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPipelineExecutablePropertiesKHR(return_value, device, &pPipelineInfo, &pExecutableCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -6034,10 +5765,9 @@ size_t VulkanDecoder::Decode_vkGetPipelineExecutableStatisticsKHR(const uint8_t*
     bytes_read += pStatistics.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPipelineExecutableStatisticsKHR(return_value, device, &pExecutableInfo, &pStatisticCount, &pStatistics);
-    }
+    });
 
     return bytes_read;
 }
@@ -6058,10 +5788,9 @@ size_t VulkanDecoder::Decode_vkGetPipelineExecutableInternalRepresentationsKHR(c
     bytes_read += pInternalRepresentations.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPipelineExecutableInternalRepresentationsKHR(return_value, device, &pExecutableInfo, &pInternalRepresentationCount, &pInternalRepresentations);
-    }
+    });
 
     return bytes_read;
 }
@@ -6078,10 +5807,9 @@ size_t VulkanDecoder::Decode_vkCmdSetEvent2KHR(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += pDependencyInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetEvent2KHR(commandBuffer, event, &pDependencyInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6098,10 +5826,9 @@ size_t VulkanDecoder::Decode_vkCmdResetEvent2KHR(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeFlags64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stageMask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdResetEvent2KHR(commandBuffer, event, stageMask);
-    }
+    });
 
     return bytes_read;
 }
@@ -6120,10 +5847,9 @@ size_t VulkanDecoder::Decode_vkCmdWaitEvents2KHR(const uint8_t* parameter_buffer
     bytes_read += pEvents.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pDependencyInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWaitEvents2KHR(commandBuffer, eventCount, &pEvents, &pDependencyInfos);
-    }
+    });
 
     return bytes_read;
 }
@@ -6138,10 +5864,9 @@ size_t VulkanDecoder::Decode_vkCmdPipelineBarrier2KHR(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pDependencyInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdPipelineBarrier2KHR(commandBuffer, &pDependencyInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6160,10 +5885,9 @@ size_t VulkanDecoder::Decode_vkCmdWriteTimestamp2KHR(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
-    }
+    });
 
     return bytes_read;
 }
@@ -6184,10 +5908,9 @@ size_t VulkanDecoder::Decode_vkQueueSubmit2KHR(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueSubmit2KHR(return_value, queue, submitCount, &pSubmits, fence);
-    }
+    });
 
     return bytes_read;
 }
@@ -6208,10 +5931,9 @@ size_t VulkanDecoder::Decode_vkCmdWriteBufferMarker2AMD(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dstOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &marker);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
-    }
+    });
 
     return bytes_read;
 }
@@ -6228,10 +5950,9 @@ size_t VulkanDecoder::Decode_vkGetQueueCheckpointData2NV(const uint8_t* paramete
     bytes_read += pCheckpointDataCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCheckpointData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetQueueCheckpointData2NV(queue, &pCheckpointDataCount, &pCheckpointData);
-    }
+    });
 
     return bytes_read;
 }
@@ -6246,10 +5967,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyBuffer2KHR(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pCopyBufferInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyBuffer2KHR(commandBuffer, &pCopyBufferInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6264,10 +5984,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyImage2KHR(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pCopyImageInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyImage2KHR(commandBuffer, &pCopyImageInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6282,10 +6001,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyBufferToImage2KHR(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pCopyBufferToImageInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyBufferToImage2KHR(commandBuffer, &pCopyBufferToImageInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6300,10 +6018,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyImageToBuffer2KHR(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pCopyImageToBufferInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyImageToBuffer2KHR(commandBuffer, &pCopyImageToBufferInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6318,10 +6035,9 @@ size_t VulkanDecoder::Decode_vkCmdBlitImage2KHR(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pBlitImageInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBlitImage2KHR(commandBuffer, &pBlitImageInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6336,10 +6052,9 @@ size_t VulkanDecoder::Decode_vkCmdResolveImage2KHR(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pResolveImageInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdResolveImage2KHR(commandBuffer, &pResolveImageInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6360,10 +6075,9 @@ size_t VulkanDecoder::Decode_vkCreateDebugReportCallbackEXT(const uint8_t* param
     bytes_read += pCallback.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDebugReportCallbackEXT(return_value, instance, &pCreateInfo, &pAllocator, &pCallback);
-    }
+    });
 
     return bytes_read;
 }
@@ -6380,10 +6094,9 @@ size_t VulkanDecoder::Decode_vkDestroyDebugReportCallbackEXT(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &callback);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDebugReportCallbackEXT(instance, callback, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -6410,10 +6123,9 @@ size_t VulkanDecoder::Decode_vkDebugReportMessageEXT(const uint8_t* parameter_bu
     bytes_read += pLayerPrefix.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMessage.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, &pLayerPrefix, &pMessage);
-    }
+    });
 
     return bytes_read;
 }
@@ -6430,10 +6142,9 @@ size_t VulkanDecoder::Decode_vkDebugMarkerSetObjectTagEXT(const uint8_t* paramet
     bytes_read += pTagInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDebugMarkerSetObjectTagEXT(return_value, device, &pTagInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6450,10 +6161,9 @@ size_t VulkanDecoder::Decode_vkDebugMarkerSetObjectNameEXT(const uint8_t* parame
     bytes_read += pNameInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDebugMarkerSetObjectNameEXT(return_value, device, &pNameInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6468,10 +6178,9 @@ size_t VulkanDecoder::Decode_vkCmdDebugMarkerBeginEXT(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDebugMarkerBeginEXT(commandBuffer, &pMarkerInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6484,10 +6193,9 @@ size_t VulkanDecoder::Decode_vkCmdDebugMarkerEndEXT(const uint8_t* parameter_buf
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDebugMarkerEndEXT(commandBuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -6502,10 +6210,9 @@ size_t VulkanDecoder::Decode_vkCmdDebugMarkerInsertEXT(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDebugMarkerInsertEXT(commandBuffer, &pMarkerInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6528,10 +6235,9 @@ size_t VulkanDecoder::Decode_vkCmdBindTransformFeedbackBuffersEXT(const uint8_t*
     bytes_read += pOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSizes.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, &pBuffers, &pOffsets, &pSizes);
-    }
+    });
 
     return bytes_read;
 }
@@ -6552,10 +6258,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginTransformFeedbackEXT(const uint8_t* param
     bytes_read += pCounterBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCounterBufferOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, &pCounterBuffers, &pCounterBufferOffsets);
-    }
+    });
 
     return bytes_read;
 }
@@ -6576,10 +6281,9 @@ size_t VulkanDecoder::Decode_vkCmdEndTransformFeedbackEXT(const uint8_t* paramet
     bytes_read += pCounterBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCounterBufferOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, &pCounterBuffers, &pCounterBufferOffsets);
-    }
+    });
 
     return bytes_read;
 }
@@ -6600,10 +6304,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginQueryIndexedEXT(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &index);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
-    }
+    });
 
     return bytes_read;
 }
@@ -6622,10 +6325,9 @@ size_t VulkanDecoder::Decode_vkCmdEndQueryIndexedEXT(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &index);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
-    }
+    });
 
     return bytes_read;
 }
@@ -6650,10 +6352,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectByteCountEXT(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &counterOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &vertexStride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
-    }
+    });
 
     return bytes_read;
 }
@@ -6670,10 +6371,9 @@ size_t VulkanDecoder::Decode_vkGetImageViewHandleNVX(const uint8_t* parameter_bu
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageViewHandleNVX(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6692,10 +6392,9 @@ size_t VulkanDecoder::Decode_vkGetImageViewAddressNVX(const uint8_t* parameter_b
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageViewAddressNVX(return_value, device, imageView, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -6720,10 +6419,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectCountAMD(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -6748,10 +6446,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountAMD(const uint8_t* par
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -6776,10 +6473,9 @@ size_t VulkanDecoder::Decode_vkGetShaderInfoAMD(const uint8_t* parameter_buffer,
     bytes_read += pInfo.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetShaderInfoAMD(return_value, device, pipeline, shaderStage, infoType, &pInfoSize, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -6800,10 +6496,9 @@ size_t VulkanDecoder::Decode_vkCreateStreamDescriptorSurfaceGGP(const uint8_t* p
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateStreamDescriptorSurfaceGGP(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -6832,10 +6527,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
     bytes_read += pExternalImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(return_value, physicalDevice, format, type, tiling, usage, flags, externalHandleType, &pExternalImageFormatProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -6856,10 +6550,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryWin32HandleNV(const uint8_t* parameter_b
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryWin32HandleNV(return_value, device, memory, handleType, &pHandle);
-    }
+    });
 
     return bytes_read;
 }
@@ -6880,10 +6573,9 @@ size_t VulkanDecoder::Decode_vkCreateViSurfaceNN(const uint8_t* parameter_buffer
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateViSurfaceNN(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -6898,10 +6590,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginConditionalRenderingEXT(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pConditionalRenderingBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginConditionalRenderingEXT(commandBuffer, &pConditionalRenderingBegin);
-    }
+    });
 
     return bytes_read;
 }
@@ -6914,10 +6605,9 @@ size_t VulkanDecoder::Decode_vkCmdEndConditionalRenderingEXT(const uint8_t* para
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndConditionalRenderingEXT(commandBuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -6936,10 +6626,9 @@ size_t VulkanDecoder::Decode_vkCmdSetViewportWScalingNV(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pViewportWScalings.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, &pViewportWScalings);
-    }
+    });
 
     return bytes_read;
 }
@@ -6956,10 +6645,9 @@ size_t VulkanDecoder::Decode_vkReleaseDisplayEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkReleaseDisplayEXT(return_value, physicalDevice, display);
-    }
+    });
 
     return bytes_read;
 }
@@ -6978,10 +6666,9 @@ size_t VulkanDecoder::Decode_vkAcquireXlibDisplayEXT(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquireXlibDisplayEXT(return_value, physicalDevice, dpy, display);
-    }
+    });
 
     return bytes_read;
 }
@@ -7002,10 +6689,9 @@ size_t VulkanDecoder::Decode_vkGetRandROutputDisplayEXT(const uint8_t* parameter
     bytes_read += pDisplay.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetRandROutputDisplayEXT(return_value, physicalDevice, dpy, rrOutput, &pDisplay);
-    }
+    });
 
     return bytes_read;
 }
@@ -7024,10 +6710,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(const ui
     bytes_read += pSurfaceCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(return_value, physicalDevice, surface, &pSurfaceCapabilities);
-    }
+    });
 
     return bytes_read;
 }
@@ -7046,10 +6731,9 @@ size_t VulkanDecoder::Decode_vkDisplayPowerControlEXT(const uint8_t* parameter_b
     bytes_read += pDisplayPowerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDisplayPowerControlEXT(return_value, device, display, &pDisplayPowerInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7070,10 +6754,9 @@ size_t VulkanDecoder::Decode_vkRegisterDeviceEventEXT(const uint8_t* parameter_b
     bytes_read += pFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkRegisterDeviceEventEXT(return_value, device, &pDeviceEventInfo, &pAllocator, &pFence);
-    }
+    });
 
     return bytes_read;
 }
@@ -7096,10 +6779,9 @@ size_t VulkanDecoder::Decode_vkRegisterDisplayEventEXT(const uint8_t* parameter_
     bytes_read += pFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkRegisterDisplayEventEXT(return_value, device, display, &pDisplayEventInfo, &pAllocator, &pFence);
-    }
+    });
 
     return bytes_read;
 }
@@ -7120,10 +6802,9 @@ size_t VulkanDecoder::Decode_vkGetSwapchainCounterEXT(const uint8_t* parameter_b
     bytes_read += pCounterValue.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSwapchainCounterEXT(return_value, device, swapchain, counter, &pCounterValue);
-    }
+    });
 
     return bytes_read;
 }
@@ -7142,10 +6823,9 @@ size_t VulkanDecoder::Decode_vkGetRefreshCycleDurationGOOGLE(const uint8_t* para
     bytes_read += pDisplayTimingProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetRefreshCycleDurationGOOGLE(return_value, device, swapchain, &pDisplayTimingProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -7166,10 +6846,9 @@ size_t VulkanDecoder::Decode_vkGetPastPresentationTimingGOOGLE(const uint8_t* pa
     bytes_read += pPresentationTimings.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPastPresentationTimingGOOGLE(return_value, device, swapchain, &pPresentationTimingCount, &pPresentationTimings);
-    }
+    });
 
     return bytes_read;
 }
@@ -7188,10 +6867,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDiscardRectangleEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &discardRectangleCount);
     bytes_read += pDiscardRectangles.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, &pDiscardRectangles);
-    }
+    });
 
     return bytes_read;
 }
@@ -7210,10 +6888,9 @@ size_t VulkanDecoder::Decode_vkSetHdrMetadataEXT(const uint8_t* parameter_buffer
     bytes_read += pSwapchains.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMetadata.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSetHdrMetadataEXT(device, swapchainCount, &pSwapchains, &pMetadata);
-    }
+    });
 
     return bytes_read;
 }
@@ -7234,10 +6911,9 @@ size_t VulkanDecoder::Decode_vkCreateIOSSurfaceMVK(const uint8_t* parameter_buff
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateIOSSurfaceMVK(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -7258,10 +6934,9 @@ size_t VulkanDecoder::Decode_vkCreateMacOSSurfaceMVK(const uint8_t* parameter_bu
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateMacOSSurfaceMVK(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -7278,10 +6953,9 @@ size_t VulkanDecoder::Decode_vkSetDebugUtilsObjectNameEXT(const uint8_t* paramet
     bytes_read += pNameInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSetDebugUtilsObjectNameEXT(return_value, device, &pNameInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7298,10 +6972,9 @@ size_t VulkanDecoder::Decode_vkSetDebugUtilsObjectTagEXT(const uint8_t* paramete
     bytes_read += pTagInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSetDebugUtilsObjectTagEXT(return_value, device, &pTagInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7316,10 +6989,9 @@ size_t VulkanDecoder::Decode_vkQueueBeginDebugUtilsLabelEXT(const uint8_t* param
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueBeginDebugUtilsLabelEXT(queue, &pLabelInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7332,10 +7004,9 @@ size_t VulkanDecoder::Decode_vkQueueEndDebugUtilsLabelEXT(const uint8_t* paramet
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueEndDebugUtilsLabelEXT(queue);
-    }
+    });
 
     return bytes_read;
 }
@@ -7350,10 +7021,9 @@ size_t VulkanDecoder::Decode_vkQueueInsertDebugUtilsLabelEXT(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueInsertDebugUtilsLabelEXT(queue, &pLabelInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7368,10 +7038,9 @@ size_t VulkanDecoder::Decode_vkCmdBeginDebugUtilsLabelEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBeginDebugUtilsLabelEXT(commandBuffer, &pLabelInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7384,10 +7053,9 @@ size_t VulkanDecoder::Decode_vkCmdEndDebugUtilsLabelEXT(const uint8_t* parameter
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdEndDebugUtilsLabelEXT(commandBuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -7402,10 +7070,9 @@ size_t VulkanDecoder::Decode_vkCmdInsertDebugUtilsLabelEXT(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdInsertDebugUtilsLabelEXT(commandBuffer, &pLabelInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7426,10 +7093,9 @@ size_t VulkanDecoder::Decode_vkCreateDebugUtilsMessengerEXT(const uint8_t* param
     bytes_read += pMessenger.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDebugUtilsMessengerEXT(return_value, instance, &pCreateInfo, &pAllocator, &pMessenger);
-    }
+    });
 
     return bytes_read;
 }
@@ -7446,10 +7112,9 @@ size_t VulkanDecoder::Decode_vkDestroyDebugUtilsMessengerEXT(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &messenger);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyDebugUtilsMessengerEXT(instance, messenger, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -7468,10 +7133,9 @@ size_t VulkanDecoder::Decode_vkSubmitDebugUtilsMessageEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &messageTypes);
     bytes_read += pCallbackData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, &pCallbackData);
-    }
+    });
 
     return bytes_read;
 }
@@ -7490,10 +7154,9 @@ size_t VulkanDecoder::Decode_vkGetAndroidHardwareBufferPropertiesANDROID(const u
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetAndroidHardwareBufferPropertiesANDROID(return_value, device, buffer, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -7512,10 +7175,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryAndroidHardwareBufferANDROID(const uint8
     bytes_read += pBuffer.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryAndroidHardwareBufferANDROID(return_value, device, &pInfo, &pBuffer);
-    }
+    });
 
     return bytes_read;
 }
@@ -7530,10 +7192,9 @@ size_t VulkanDecoder::Decode_vkCmdSetSampleLocationsEXT(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pSampleLocationsInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetSampleLocationsEXT(commandBuffer, &pSampleLocationsInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -7550,10 +7211,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMultisamplePropertiesEXT(const u
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &samples);
     bytes_read += pMultisampleProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, &pMultisampleProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -7572,10 +7232,9 @@ size_t VulkanDecoder::Decode_vkGetImageDrmFormatModifierPropertiesEXT(const uint
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetImageDrmFormatModifierPropertiesEXT(return_value, device, image, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -7596,10 +7255,9 @@ size_t VulkanDecoder::Decode_vkCreateValidationCacheEXT(const uint8_t* parameter
     bytes_read += pValidationCache.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateValidationCacheEXT(return_value, device, &pCreateInfo, &pAllocator, &pValidationCache);
-    }
+    });
 
     return bytes_read;
 }
@@ -7616,10 +7274,9 @@ size_t VulkanDecoder::Decode_vkDestroyValidationCacheEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &validationCache);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyValidationCacheEXT(device, validationCache, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -7640,10 +7297,9 @@ size_t VulkanDecoder::Decode_vkMergeValidationCachesEXT(const uint8_t* parameter
     bytes_read += pSrcCaches.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkMergeValidationCachesEXT(return_value, device, dstCache, srcCacheCount, &pSrcCaches);
-    }
+    });
 
     return bytes_read;
 }
@@ -7664,10 +7320,9 @@ size_t VulkanDecoder::Decode_vkGetValidationCacheDataEXT(const uint8_t* paramete
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetValidationCacheDataEXT(return_value, device, validationCache, &pDataSize, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -7684,10 +7339,9 @@ size_t VulkanDecoder::Decode_vkCmdBindShadingRateImageNV(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageView);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageLayout);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
-    }
+    });
 
     return bytes_read;
 }
@@ -7706,10 +7360,9 @@ size_t VulkanDecoder::Decode_vkCmdSetViewportShadingRatePaletteNV(const uint8_t*
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pShadingRatePalettes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, &pShadingRatePalettes);
-    }
+    });
 
     return bytes_read;
 }
@@ -7728,10 +7381,9 @@ size_t VulkanDecoder::Decode_vkCmdSetCoarseSampleOrderNV(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &customSampleOrderCount);
     bytes_read += pCustomSampleOrders.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, &pCustomSampleOrders);
-    }
+    });
 
     return bytes_read;
 }
@@ -7752,10 +7404,9 @@ size_t VulkanDecoder::Decode_vkCreateAccelerationStructureNV(const uint8_t* para
     bytes_read += pAccelerationStructure.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateAccelerationStructureNV(return_value, device, &pCreateInfo, &pAllocator, &pAccelerationStructure);
-    }
+    });
 
     return bytes_read;
 }
@@ -7772,10 +7423,9 @@ size_t VulkanDecoder::Decode_vkDestroyAccelerationStructureNV(const uint8_t* par
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &accelerationStructure);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyAccelerationStructureNV(device, accelerationStructure, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -7792,10 +7442,9 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureMemoryRequirementsNV(cons
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetAccelerationStructureMemoryRequirementsNV(device, &pInfo, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -7814,10 +7463,9 @@ size_t VulkanDecoder::Decode_vkBindAccelerationStructureMemoryNV(const uint8_t*
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkBindAccelerationStructureMemoryNV(return_value, device, bindInfoCount, &pBindInfos);
-    }
+    });
 
     return bytes_read;
 }
@@ -7846,10 +7494,9 @@ size_t VulkanDecoder::Decode_vkCmdBuildAccelerationStructureNV(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scratch);
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scratchOffset);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBuildAccelerationStructureNV(commandBuffer, &pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
-    }
+    });
 
     return bytes_read;
 }
@@ -7868,10 +7515,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyAccelerationStructureNV(const uint8_t* par
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &src);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &mode);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
-    }
+    });
 
     return bytes_read;
 }
@@ -7912,10 +7558,9 @@ size_t VulkanDecoder::Decode_vkCmdTraceRaysNV(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &height);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depth);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
-    }
+    });
 
     return bytes_read;
 }
@@ -7940,10 +7585,9 @@ size_t VulkanDecoder::Decode_vkCreateRayTracingPipelinesNV(const uint8_t* parame
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateRayTracingPipelinesNV(return_value, device, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
-    }
+    });
 
     return bytes_read;
 }
@@ -7968,10 +7612,9 @@ size_t VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesKHR(const uint8_t*
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetRayTracingShaderGroupHandlesKHR(return_value, device, pipeline, firstGroup, groupCount, dataSize, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -7996,10 +7639,9 @@ size_t VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesNV(const uint8_t*
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetRayTracingShaderGroupHandlesNV(return_value, device, pipeline, firstGroup, groupCount, dataSize, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -8020,10 +7662,9 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureHandleNV(const uint8_t* p
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetAccelerationStructureHandleNV(return_value, device, accelerationStructure, dataSize, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -8046,10 +7687,9 @@ size_t VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesNV(const
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, &pAccelerationStructures, queryType, queryPool, firstQuery);
-    }
+    });
 
     return bytes_read;
 }
@@ -8068,10 +7708,9 @@ size_t VulkanDecoder::Decode_vkCompileDeferredNV(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &shader);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCompileDeferredNV(return_value, device, pipeline, shader);
-    }
+    });
 
     return bytes_read;
 }
@@ -8092,10 +7731,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryHostPointerPropertiesEXT(const uint8_t*
     bytes_read += pMemoryHostPointerProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryHostPointerPropertiesEXT(return_value, device, handleType, pHostPointer, &pMemoryHostPointerProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -8116,10 +7754,9 @@ size_t VulkanDecoder::Decode_vkCmdWriteBufferMarkerAMD(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dstOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &marker);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
-    }
+    });
 
     return bytes_read;
 }
@@ -8138,10 +7775,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(cons
     bytes_read += pTimeDomains.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(return_value, physicalDevice, &pTimeDomainCount, &pTimeDomains);
-    }
+    });
 
     return bytes_read;
 }
@@ -8164,10 +7800,9 @@ size_t VulkanDecoder::Decode_vkGetCalibratedTimestampsEXT(const uint8_t* paramet
     bytes_read += pMaxDeviation.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetCalibratedTimestampsEXT(return_value, device, timestampCount, &pTimestampInfos, &pTimestamps, &pMaxDeviation);
-    }
+    });
 
     return bytes_read;
 }
@@ -8184,10 +7819,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawMeshTasksNV(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &taskCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstTask);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
-    }
+    });
 
     return bytes_read;
 }
@@ -8208,10 +7842,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectNV(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &drawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -8236,10 +7869,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectCountNV(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -8258,10 +7890,9 @@ size_t VulkanDecoder::Decode_vkCmdSetExclusiveScissorNV(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &exclusiveScissorCount);
     bytes_read += pExclusiveScissors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, &pExclusiveScissors);
-    }
+    });
 
     return bytes_read;
 }
@@ -8276,10 +7907,9 @@ size_t VulkanDecoder::Decode_vkCmdSetCheckpointNV(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCheckpointMarker);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
-    }
+    });
 
     return bytes_read;
 }
@@ -8296,10 +7926,9 @@ size_t VulkanDecoder::Decode_vkGetQueueCheckpointDataNV(const uint8_t* parameter
     bytes_read += pCheckpointDataCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCheckpointData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetQueueCheckpointDataNV(queue, &pCheckpointDataCount, &pCheckpointData);
-    }
+    });
 
     return bytes_read;
 }
@@ -8316,10 +7945,9 @@ size_t VulkanDecoder::Decode_vkInitializePerformanceApiINTEL(const uint8_t* para
     bytes_read += pInitializeInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkInitializePerformanceApiINTEL(return_value, device, &pInitializeInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -8332,10 +7960,9 @@ size_t VulkanDecoder::Decode_vkUninitializePerformanceApiINTEL(const uint8_t* pa
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkUninitializePerformanceApiINTEL(device);
-    }
+    });
 
     return bytes_read;
 }
@@ -8352,10 +7979,9 @@ size_t VulkanDecoder::Decode_vkCmdSetPerformanceMarkerINTEL(const uint8_t* param
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetPerformanceMarkerINTEL(return_value, commandBuffer, &pMarkerInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -8372,10 +7998,9 @@ size_t VulkanDecoder::Decode_vkCmdSetPerformanceStreamMarkerINTEL(const uint8_t*
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetPerformanceStreamMarkerINTEL(return_value, commandBuffer, &pMarkerInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -8392,10 +8017,9 @@ size_t VulkanDecoder::Decode_vkCmdSetPerformanceOverrideINTEL(const uint8_t* par
     bytes_read += pOverrideInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetPerformanceOverrideINTEL(return_value, commandBuffer, &pOverrideInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -8414,10 +8038,9 @@ size_t VulkanDecoder::Decode_vkAcquirePerformanceConfigurationINTEL(const uint8_
     bytes_read += pConfiguration.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquirePerformanceConfigurationINTEL(return_value, device, &pAcquireInfo, &pConfiguration);
-    }
+    });
 
     return bytes_read;
 }
@@ -8434,10 +8057,9 @@ size_t VulkanDecoder::Decode_vkReleasePerformanceConfigurationINTEL(const uint8_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &configuration);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkReleasePerformanceConfigurationINTEL(return_value, device, configuration);
-    }
+    });
 
     return bytes_read;
 }
@@ -8454,10 +8076,9 @@ size_t VulkanDecoder::Decode_vkQueueSetPerformanceConfigurationINTEL(const uint8
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &configuration);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkQueueSetPerformanceConfigurationINTEL(return_value, queue, configuration);
-    }
+    });
 
     return bytes_read;
 }
@@ -8476,10 +8097,9 @@ size_t VulkanDecoder::Decode_vkGetPerformanceParameterINTEL(const uint8_t* param
     bytes_read += pValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPerformanceParameterINTEL(return_value, device, parameter, &pValue);
-    }
+    });
 
     return bytes_read;
 }
@@ -8496,10 +8116,9 @@ size_t VulkanDecoder::Decode_vkSetLocalDimmingAMD(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapChain);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &localDimmingEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -8520,10 +8139,9 @@ size_t VulkanDecoder::Decode_vkCreateImagePipeSurfaceFUCHSIA(const uint8_t* para
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateImagePipeSurfaceFUCHSIA(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -8544,10 +8162,9 @@ size_t VulkanDecoder::Decode_vkCreateMetalSurfaceEXT(const uint8_t* parameter_bu
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateMetalSurfaceEXT(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -8564,10 +8181,9 @@ size_t VulkanDecoder::Decode_vkGetBufferDeviceAddressEXT(const uint8_t* paramete
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetBufferDeviceAddressEXT(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -8586,10 +8202,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceToolPropertiesEXT(const uint8_t*
     bytes_read += pToolProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceToolPropertiesEXT(return_value, physicalDevice, &pToolCount, &pToolProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -8608,10 +8223,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(co
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(return_value, physicalDevice, &pPropertyCount, &pProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -8630,10 +8244,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSupportedFramebufferMixedSamples
     bytes_read += pCombinations.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(return_value, physicalDevice, &pCombinationCount, &pCombinations);
-    }
+    });
 
     return bytes_read;
 }
@@ -8654,10 +8267,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModes2EXT(const ui
     bytes_read += pPresentModes.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(return_value, physicalDevice, &pSurfaceInfo, &pPresentModeCount, &pPresentModes);
-    }
+    });
 
     return bytes_read;
 }
@@ -8674,10 +8286,9 @@ size_t VulkanDecoder::Decode_vkAcquireFullScreenExclusiveModeEXT(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquireFullScreenExclusiveModeEXT(return_value, device, swapchain);
-    }
+    });
 
     return bytes_read;
 }
@@ -8694,10 +8305,9 @@ size_t VulkanDecoder::Decode_vkReleaseFullScreenExclusiveModeEXT(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkReleaseFullScreenExclusiveModeEXT(return_value, device, swapchain);
-    }
+    });
 
     return bytes_read;
 }
@@ -8716,10 +8326,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModes2EXT(const uint8
     bytes_read += pModes.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceGroupSurfacePresentModes2EXT(return_value, device, &pSurfaceInfo, &pModes);
-    }
+    });
 
     return bytes_read;
 }
@@ -8740,10 +8349,9 @@ size_t VulkanDecoder::Decode_vkCreateHeadlessSurfaceEXT(const uint8_t* parameter
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateHeadlessSurfaceEXT(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -8760,10 +8368,9 @@ size_t VulkanDecoder::Decode_vkCmdSetLineStippleEXT(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &lineStippleFactor);
     bytes_read += ValueDecoder::DecodeUInt16Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &lineStipplePattern);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
-    }
+    });
 
     return bytes_read;
 }
@@ -8782,10 +8389,9 @@ size_t VulkanDecoder::Decode_vkResetQueryPoolEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryCount);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
-    }
+    });
 
     return bytes_read;
 }
@@ -8800,10 +8406,9 @@ size_t VulkanDecoder::Decode_vkCmdSetCullModeEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &cullMode);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetCullModeEXT(commandBuffer, cullMode);
-    }
+    });
 
     return bytes_read;
 }
@@ -8818,10 +8423,9 @@ size_t VulkanDecoder::Decode_vkCmdSetFrontFaceEXT(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &frontFace);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetFrontFaceEXT(commandBuffer, frontFace);
-    }
+    });
 
     return bytes_read;
 }
@@ -8836,10 +8440,9 @@ size_t VulkanDecoder::Decode_vkCmdSetPrimitiveTopologyEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &primitiveTopology);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
-    }
+    });
 
     return bytes_read;
 }
@@ -8856,10 +8459,9 @@ size_t VulkanDecoder::Decode_vkCmdSetViewportWithCountEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pViewports.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetViewportWithCountEXT(commandBuffer, viewportCount, &pViewports);
-    }
+    });
 
     return bytes_read;
 }
@@ -8876,10 +8478,9 @@ size_t VulkanDecoder::Decode_vkCmdSetScissorWithCountEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scissorCount);
     bytes_read += pScissors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetScissorWithCountEXT(commandBuffer, scissorCount, &pScissors);
-    }
+    });
 
     return bytes_read;
 }
@@ -8904,10 +8505,9 @@ size_t VulkanDecoder::Decode_vkCmdBindVertexBuffers2EXT(const uint8_t* parameter
     bytes_read += pSizes.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pStrides.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, &pBuffers, &pOffsets, &pSizes, &pStrides);
-    }
+    });
 
     return bytes_read;
 }
@@ -8922,10 +8522,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthTestEnableEXT(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthTestEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -8940,10 +8539,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthWriteEnableEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthWriteEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -8958,10 +8556,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthCompareOpEXT(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthCompareOp);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
-    }
+    });
 
     return bytes_read;
 }
@@ -8976,10 +8573,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthBoundsTestEnableEXT(const uint8_t* par
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthBoundsTestEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -8994,10 +8590,9 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilTestEnableEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stencilTestEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -9020,10 +8615,9 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilOpEXT(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthFailOp);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &compareOp);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
-    }
+    });
 
     return bytes_read;
 }
@@ -9040,10 +8634,9 @@ size_t VulkanDecoder::Decode_vkGetGeneratedCommandsMemoryRequirementsNV(const ui
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetGeneratedCommandsMemoryRequirementsNV(device, &pInfo, &pMemoryRequirements);
-    }
+    });
 
     return bytes_read;
 }
@@ -9058,10 +8651,9 @@ size_t VulkanDecoder::Decode_vkCmdPreprocessGeneratedCommandsNV(const uint8_t* p
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pGeneratedCommandsInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdPreprocessGeneratedCommandsNV(commandBuffer, &pGeneratedCommandsInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9078,10 +8670,9 @@ size_t VulkanDecoder::Decode_vkCmdExecuteGeneratedCommandsNV(const uint8_t* para
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &isPreprocessed);
     bytes_read += pGeneratedCommandsInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, &pGeneratedCommandsInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9100,10 +8691,9 @@ size_t VulkanDecoder::Decode_vkCmdBindPipelineShaderGroupNV(const uint8_t* param
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipeline);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupIndex);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
-    }
+    });
 
     return bytes_read;
 }
@@ -9124,10 +8714,9 @@ size_t VulkanDecoder::Decode_vkCreateIndirectCommandsLayoutNV(const uint8_t* par
     bytes_read += pIndirectCommandsLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateIndirectCommandsLayoutNV(return_value, device, &pCreateInfo, &pAllocator, &pIndirectCommandsLayout);
-    }
+    });
 
     return bytes_read;
 }
@@ -9144,10 +8733,9 @@ size_t VulkanDecoder::Decode_vkDestroyIndirectCommandsLayoutNV(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &indirectCommandsLayout);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -9166,10 +8754,9 @@ size_t VulkanDecoder::Decode_vkAcquireDrmDisplayEXT(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquireDrmDisplayEXT(return_value, physicalDevice, drmFd, display);
-    }
+    });
 
     return bytes_read;
 }
@@ -9190,10 +8777,9 @@ size_t VulkanDecoder::Decode_vkGetDrmDisplayEXT(const uint8_t* parameter_buffer,
     bytes_read += display.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDrmDisplayEXT(return_value, physicalDevice, drmFd, connectorId, &display);
-    }
+    });
 
     return bytes_read;
 }
@@ -9214,10 +8800,9 @@ size_t VulkanDecoder::Decode_vkCreatePrivateDataSlotEXT(const uint8_t* parameter
     bytes_read += pPrivateDataSlot.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreatePrivateDataSlotEXT(return_value, device, &pCreateInfo, &pAllocator, &pPrivateDataSlot);
-    }
+    });
 
     return bytes_read;
 }
@@ -9234,10 +8819,9 @@ size_t VulkanDecoder::Decode_vkDestroyPrivateDataSlotEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &privateDataSlot);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyPrivateDataSlotEXT(device, privateDataSlot, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -9260,10 +8844,9 @@ size_t VulkanDecoder::Decode_vkSetPrivateDataEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &data);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkSetPrivateDataEXT(return_value, device, objectType, objectHandle, privateDataSlot, data);
-    }
+    });
 
     return bytes_read;
 }
@@ -9284,10 +8867,9 @@ size_t VulkanDecoder::Decode_vkGetPrivateDataEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &privateDataSlot);
     bytes_read += pData.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -9304,10 +8886,9 @@ size_t VulkanDecoder::Decode_vkCmdSetFragmentShadingRateEnumNV(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &shadingRate);
     bytes_read += combinerOps.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, &combinerOps);
-    }
+    });
 
     return bytes_read;
 }
@@ -9324,10 +8905,9 @@ size_t VulkanDecoder::Decode_vkAcquireWinrtDisplayNV(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkAcquireWinrtDisplayNV(return_value, physicalDevice, display);
-    }
+    });
 
     return bytes_read;
 }
@@ -9346,10 +8926,9 @@ size_t VulkanDecoder::Decode_vkGetWinrtDisplayNV(const uint8_t* parameter_buffer
     bytes_read += pDisplay.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetWinrtDisplayNV(return_value, physicalDevice, deviceRelativeId, &pDisplay);
-    }
+    });
 
     return bytes_read;
 }
@@ -9370,10 +8949,9 @@ size_t VulkanDecoder::Decode_vkCreateDirectFBSurfaceEXT(const uint8_t* parameter
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateDirectFBSurfaceEXT(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -9392,10 +8970,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(c
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dfb);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(return_value, physicalDevice, queueFamilyIndex, dfb);
-    }
+    });
 
     return bytes_read;
 }
@@ -9416,10 +8993,9 @@ size_t VulkanDecoder::Decode_vkCmdSetVertexInputEXT(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &vertexAttributeDescriptionCount);
     bytes_read += pVertexAttributeDescriptions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, &pVertexBindingDescriptions, vertexAttributeDescriptionCount, &pVertexAttributeDescriptions);
-    }
+    });
 
     return bytes_read;
 }
@@ -9438,10 +9014,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryZirconHandleFUCHSIA(const uint8_t* param
     bytes_read += pZirconHandle.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryZirconHandleFUCHSIA(return_value, device, &pGetZirconHandleInfo, &pZirconHandle);
-    }
+    });
 
     return bytes_read;
 }
@@ -9462,10 +9037,9 @@ size_t VulkanDecoder::Decode_vkGetMemoryZirconHandlePropertiesFUCHSIA(const uint
     bytes_read += pMemoryZirconHandleProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(return_value, device, handleType, zirconHandle, &pMemoryZirconHandleProperties);
-    }
+    });
 
     return bytes_read;
 }
@@ -9482,10 +9056,9 @@ size_t VulkanDecoder::Decode_vkImportSemaphoreZirconHandleFUCHSIA(const uint8_t*
     bytes_read += pImportSemaphoreZirconHandleInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkImportSemaphoreZirconHandleFUCHSIA(return_value, device, &pImportSemaphoreZirconHandleInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9504,10 +9077,9 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreZirconHandleFUCHSIA(const uint8_t* pa
     bytes_read += pZirconHandle.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetSemaphoreZirconHandleFUCHSIA(return_value, device, &pGetZirconHandleInfo, &pZirconHandle);
-    }
+    });
 
     return bytes_read;
 }
@@ -9522,10 +9094,9 @@ size_t VulkanDecoder::Decode_vkCmdSetPatchControlPointsEXT(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &patchControlPoints);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
-    }
+    });
 
     return bytes_read;
 }
@@ -9540,10 +9111,9 @@ size_t VulkanDecoder::Decode_vkCmdSetRasterizerDiscardEnableEXT(const uint8_t* p
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rasterizerDiscardEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -9558,10 +9128,9 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthBiasEnableEXT(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthBiasEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -9576,10 +9145,9 @@ size_t VulkanDecoder::Decode_vkCmdSetLogicOpEXT(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &logicOp);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetLogicOpEXT(commandBuffer, logicOp);
-    }
+    });
 
     return bytes_read;
 }
@@ -9594,10 +9162,9 @@ size_t VulkanDecoder::Decode_vkCmdSetPrimitiveRestartEnableEXT(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &primitiveRestartEnable);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
-    }
+    });
 
     return bytes_read;
 }
@@ -9618,10 +9185,9 @@ size_t VulkanDecoder::Decode_vkCreateScreenSurfaceQNX(const uint8_t* parameter_b
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateScreenSurfaceQNX(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
-    }
+    });
 
     return bytes_read;
 }
@@ -9640,10 +9206,9 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceScreenPresentationSupportQNX(con
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &window);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetPhysicalDeviceScreenPresentationSupportQNX(return_value, physicalDevice, queueFamilyIndex, window);
-    }
+    });
 
     return bytes_read;
 }
@@ -9660,10 +9225,9 @@ size_t VulkanDecoder::Decode_vkCmdSetColorWriteEnableEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &attachmentCount);
     bytes_read += pColorWriteEnables.DecodeVkBool32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, &pColorWriteEnables);
-    }
+    });
 
     return bytes_read;
 }
@@ -9686,10 +9250,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawMultiEXT(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstInstance);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawMultiEXT(commandBuffer, drawCount, &pVertexInfo, instanceCount, firstInstance, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -9714,10 +9277,9 @@ size_t VulkanDecoder::Decode_vkCmdDrawMultiIndexedEXT(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
     bytes_read += pVertexOffset.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdDrawMultiIndexedEXT(commandBuffer, drawCount, &pIndexInfo, instanceCount, firstInstance, stride, &pVertexOffset);
-    }
+    });
 
     return bytes_read;
 }
@@ -9738,10 +9300,9 @@ size_t VulkanDecoder::Decode_vkCreateAccelerationStructureKHR(const uint8_t* par
     bytes_read += pAccelerationStructure.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateAccelerationStructureKHR(return_value, device, &pCreateInfo, &pAllocator, &pAccelerationStructure);
-    }
+    });
 
     return bytes_read;
 }
@@ -9758,10 +9319,9 @@ size_t VulkanDecoder::Decode_vkDestroyAccelerationStructureKHR(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &accelerationStructure);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkDestroyAccelerationStructureKHR(device, accelerationStructure, &pAllocator);
-    }
+    });
 
     return bytes_read;
 }
@@ -9780,10 +9340,9 @@ size_t VulkanDecoder::Decode_vkCmdBuildAccelerationStructuresKHR(const uint8_t*
     bytes_read += pInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ppBuildRangeInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, &pInfos, &ppBuildRangeInfos);
-    }
+    });
 
     return bytes_read;
 }
@@ -9806,10 +9365,9 @@ size_t VulkanDecoder::Decode_vkCmdBuildAccelerationStructuresIndirectKHR(const u
     bytes_read += pIndirectStrides.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ppMaxPrimitiveCounts.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, &pInfos, &pIndirectDeviceAddresses, &pIndirectStrides, &ppMaxPrimitiveCounts);
-    }
+    });
 
     return bytes_read;
 }
@@ -9828,10 +9386,9 @@ size_t VulkanDecoder::Decode_vkCopyAccelerationStructureToMemoryKHR(const uint8_
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCopyAccelerationStructureToMemoryKHR(return_value, device, deferredOperation, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9850,10 +9407,9 @@ size_t VulkanDecoder::Decode_vkCopyMemoryToAccelerationStructureKHR(const uint8_
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCopyMemoryToAccelerationStructureKHR(return_value, device, deferredOperation, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9880,10 +9436,9 @@ size_t VulkanDecoder::Decode_vkWriteAccelerationStructuresPropertiesKHR(const ui
     bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkWriteAccelerationStructuresPropertiesKHR(return_value, device, accelerationStructureCount, &pAccelerationStructures, queryType, dataSize, &pData, stride);
-    }
+    });
 
     return bytes_read;
 }
@@ -9898,10 +9453,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyAccelerationStructureKHR(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyAccelerationStructureKHR(commandBuffer, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9916,10 +9470,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyAccelerationStructureToMemoryKHR(const uin
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9934,10 +9487,9 @@ size_t VulkanDecoder::Decode_vkCmdCopyMemoryToAccelerationStructureKHR(const uin
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9954,10 +9506,9 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureDeviceAddressKHR(const ui
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetAccelerationStructureDeviceAddressKHR(return_value, device, &pInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -9980,10 +9531,9 @@ size_t VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesKHR(const
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, &pAccelerationStructures, queryType, queryPool, firstQuery);
-    }
+    });
 
     return bytes_read;
 }
@@ -10000,10 +9550,9 @@ size_t VulkanDecoder::Decode_vkGetDeviceAccelerationStructureCompatibilityKHR(co
     bytes_read += pVersionInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCompatibility.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetDeviceAccelerationStructureCompatibilityKHR(device, &pVersionInfo, &pCompatibility);
-    }
+    });
 
     return bytes_read;
 }
@@ -10024,10 +9573,9 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureBuildSizesKHR(const uint8
     bytes_read += pMaxPrimitiveCounts.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSizeInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetAccelerationStructureBuildSizesKHR(device, buildType, &pBuildInfo, &pMaxPrimitiveCounts, &pSizeInfo);
-    }
+    });
 
     return bytes_read;
 }
@@ -10054,10 +9602,9 @@ size_t VulkanDecoder::Decode_vkCmdTraceRaysKHR(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &height);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depth);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdTraceRaysKHR(commandBuffer, &pRaygenShaderBindingTable, &pMissShaderBindingTable, &pHitShaderBindingTable, &pCallableShaderBindingTable, width, height, depth);
-    }
+    });
 
     return bytes_read;
 }
@@ -10084,10 +9631,9 @@ size_t VulkanDecoder::Decode_vkCreateRayTracingPipelinesKHR(const uint8_t* param
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCreateRayTracingPipelinesKHR(return_value, device, deferredOperation, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
-    }
+    });
 
     return bytes_read;
 }
@@ -10112,10 +9658,9 @@ size_t VulkanDecoder::Decode_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(c
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(return_value, device, pipeline, firstGroup, groupCount, dataSize, &pData);
-    }
+    });
 
     return bytes_read;
 }
@@ -10138,10 +9683,9 @@ size_t VulkanDecoder::Decode_vkCmdTraceRaysIndirectKHR(const uint8_t* parameter_
     bytes_read += pCallableShaderBindingTable.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &indirectDeviceAddress);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdTraceRaysIndirectKHR(commandBuffer, &pRaygenShaderBindingTable, &pMissShaderBindingTable, &pHitShaderBindingTable, &pCallableShaderBindingTable, indirectDeviceAddress);
-    }
+    });
 
     return bytes_read;
 }
@@ -10162,10 +9706,9 @@ size_t VulkanDecoder::Decode_vkGetRayTracingShaderGroupStackSizeKHR(const uint8_
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupShader);
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkGetRayTracingShaderGroupStackSizeKHR(return_value, device, pipeline, group, groupShader);
-    }
+    });
 
     return bytes_read;
 }
@@ -10180,12 +9723,941 @@ size_t VulkanDecoder::Decode_vkCmdSetRayTracingPipelineStackSizeKHR(const uint8_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineStackSize);
 
-    for (auto consumer : GetConsumers())
-    {
+    DispatchCommandBufferCall([=](VulkanConsumer* consumer) mutable {
         consumer->Process_vkCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
-    }
-
-    return bytes_read;
+    });
+
+    return bytes_read;
+}
+
+const VulkanDecoder::DecodeFunction* VulkanDecoder::GetDecodeFunctions()
+{
+    static const std::array<DecodeFunction, kDecodeFunctionCount> decode_functions = []() {
+        std::array<DecodeFunction, kDecodeFunctionCount> functions{};
+
+        functions[format::ApiCallId::ApiCall_vkCreateInstance - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateInstance;
+        functions[format::ApiCallId::ApiCall_vkDestroyInstance - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyInstance;
+        functions[format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkEnumeratePhysicalDevices;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceProperties;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties;
+        functions[format::ApiCallId::ApiCall_vkCreateDevice - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDevice;
+        functions[format::ApiCallId::ApiCall_vkDestroyDevice - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDevice;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceQueue - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceQueue;
+        functions[format::ApiCallId::ApiCall_vkQueueSubmit - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueSubmit;
+        functions[format::ApiCallId::ApiCall_vkQueueWaitIdle - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueWaitIdle;
+        functions[format::ApiCallId::ApiCall_vkDeviceWaitIdle - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDeviceWaitIdle;
+        functions[format::ApiCallId::ApiCall_vkAllocateMemory - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAllocateMemory;
+        functions[format::ApiCallId::ApiCall_vkFreeMemory - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkFreeMemory;
+        functions[format::ApiCallId::ApiCall_vkMapMemory - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkMapMemory;
+        functions[format::ApiCallId::ApiCall_vkUnmapMemory - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkUnmapMemory;
+        functions[format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkFlushMappedMemoryRanges;
+        functions[format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkInvalidateMappedMemoryRanges;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceMemoryCommitment - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceMemoryCommitment;
+        functions[format::ApiCallId::ApiCall_vkBindBufferMemory - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBindBufferMemory;
+        functions[format::ApiCallId::ApiCall_vkBindImageMemory - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBindImageMemory;
+        functions[format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferMemoryRequirements;
+        functions[format::ApiCallId::ApiCall_vkGetImageMemoryRequirements - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageMemoryRequirements;
+        functions[format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties;
+        functions[format::ApiCallId::ApiCall_vkQueueBindSparse - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueBindSparse;
+        functions[format::ApiCallId::ApiCall_vkCreateFence - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateFence;
+        functions[format::ApiCallId::ApiCall_vkDestroyFence - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyFence;
+        functions[format::ApiCallId::ApiCall_vkResetFences - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkResetFences;
+        functions[format::ApiCallId::ApiCall_vkGetFenceStatus - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetFenceStatus;
+        functions[format::ApiCallId::ApiCall_vkWaitForFences - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkWaitForFences;
+        functions[format::ApiCallId::ApiCall_vkCreateSemaphore - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateSemaphore;
+        functions[format::ApiCallId::ApiCall_vkDestroySemaphore - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroySemaphore;
+        functions[format::ApiCallId::ApiCall_vkCreateEvent - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateEvent;
+        functions[format::ApiCallId::ApiCall_vkDestroyEvent - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyEvent;
+        functions[format::ApiCallId::ApiCall_vkGetEventStatus - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetEventStatus;
+        functions[format::ApiCallId::ApiCall_vkSetEvent - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSetEvent;
+        functions[format::ApiCallId::ApiCall_vkResetEvent - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkResetEvent;
+        functions[format::ApiCallId::ApiCall_vkCreateQueryPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateQueryPool;
+        functions[format::ApiCallId::ApiCall_vkDestroyQueryPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyQueryPool;
+        functions[format::ApiCallId::ApiCall_vkGetQueryPoolResults - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetQueryPoolResults;
+        functions[format::ApiCallId::ApiCall_vkCreateBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateBuffer;
+        functions[format::ApiCallId::ApiCall_vkDestroyBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyBuffer;
+        functions[format::ApiCallId::ApiCall_vkCreateBufferView - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateBufferView;
+        functions[format::ApiCallId::ApiCall_vkDestroyBufferView - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyBufferView;
+        functions[format::ApiCallId::ApiCall_vkCreateImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateImage;
+        functions[format::ApiCallId::ApiCall_vkDestroyImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyImage;
+        functions[format::ApiCallId::ApiCall_vkGetImageSubresourceLayout - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageSubresourceLayout;
+        functions[format::ApiCallId::ApiCall_vkCreateImageView - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateImageView;
+        functions[format::ApiCallId::ApiCall_vkDestroyImageView - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyImageView;
+        functions[format::ApiCallId::ApiCall_vkCreateShaderModule - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateShaderModule;
+        functions[format::ApiCallId::ApiCall_vkDestroyShaderModule - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyShaderModule;
+        functions[format::ApiCallId::ApiCall_vkCreatePipelineCache - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreatePipelineCache;
+        functions[format::ApiCallId::ApiCall_vkDestroyPipelineCache - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyPipelineCache;
+        functions[format::ApiCallId::ApiCall_vkGetPipelineCacheData - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPipelineCacheData;
+        functions[format::ApiCallId::ApiCall_vkMergePipelineCaches - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkMergePipelineCaches;
+        functions[format::ApiCallId::ApiCall_vkCreateGraphicsPipelines - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateGraphicsPipelines;
+        functions[format::ApiCallId::ApiCall_vkCreateComputePipelines - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateComputePipelines;
+        functions[format::ApiCallId::ApiCall_vkDestroyPipeline - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyPipeline;
+        functions[format::ApiCallId::ApiCall_vkCreatePipelineLayout - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreatePipelineLayout;
+        functions[format::ApiCallId::ApiCall_vkDestroyPipelineLayout - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyPipelineLayout;
+        functions[format::ApiCallId::ApiCall_vkCreateSampler - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateSampler;
+        functions[format::ApiCallId::ApiCall_vkDestroySampler - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroySampler;
+        functions[format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDescriptorSetLayout;
+        functions[format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDescriptorSetLayout;
+        functions[format::ApiCallId::ApiCall_vkCreateDescriptorPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDescriptorPool;
+        functions[format::ApiCallId::ApiCall_vkDestroyDescriptorPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDescriptorPool;
+        functions[format::ApiCallId::ApiCall_vkResetDescriptorPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkResetDescriptorPool;
+        functions[format::ApiCallId::ApiCall_vkAllocateDescriptorSets - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAllocateDescriptorSets;
+        functions[format::ApiCallId::ApiCall_vkFreeDescriptorSets - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkFreeDescriptorSets;
+        functions[format::ApiCallId::ApiCall_vkUpdateDescriptorSets - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkUpdateDescriptorSets;
+        functions[format::ApiCallId::ApiCall_vkCreateFramebuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateFramebuffer;
+        functions[format::ApiCallId::ApiCall_vkDestroyFramebuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyFramebuffer;
+        functions[format::ApiCallId::ApiCall_vkCreateRenderPass - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateRenderPass;
+        functions[format::ApiCallId::ApiCall_vkDestroyRenderPass - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyRenderPass;
+        functions[format::ApiCallId::ApiCall_vkGetRenderAreaGranularity - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetRenderAreaGranularity;
+        functions[format::ApiCallId::ApiCall_vkCreateCommandPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateCommandPool;
+        functions[format::ApiCallId::ApiCall_vkDestroyCommandPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyCommandPool;
+        functions[format::ApiCallId::ApiCall_vkResetCommandPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkResetCommandPool;
+        functions[format::ApiCallId::ApiCall_vkAllocateCommandBuffers - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAllocateCommandBuffers;
+        functions[format::ApiCallId::ApiCall_vkFreeCommandBuffers - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkFreeCommandBuffers;
+        functions[format::ApiCallId::ApiCall_vkBeginCommandBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBeginCommandBuffer;
+        functions[format::ApiCallId::ApiCall_vkEndCommandBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkEndCommandBuffer;
+        functions[format::ApiCallId::ApiCall_vkResetCommandBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkResetCommandBuffer;
+        functions[format::ApiCallId::ApiCall_vkCmdBindPipeline - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindPipeline;
+        functions[format::ApiCallId::ApiCall_vkCmdSetViewport - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetViewport;
+        functions[format::ApiCallId::ApiCall_vkCmdSetScissor - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetScissor;
+        functions[format::ApiCallId::ApiCall_vkCmdSetLineWidth - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetLineWidth;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDepthBias - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDepthBias;
+        functions[format::ApiCallId::ApiCall_vkCmdSetBlendConstants - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetBlendConstants;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDepthBounds - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDepthBounds;
+        functions[format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetStencilCompareMask;
+        functions[format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetStencilWriteMask;
+        functions[format::ApiCallId::ApiCall_vkCmdSetStencilReference - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetStencilReference;
+        functions[format::ApiCallId::ApiCall_vkCmdBindDescriptorSets - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindDescriptorSets;
+        functions[format::ApiCallId::ApiCall_vkCmdBindIndexBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindIndexBuffer;
+        functions[format::ApiCallId::ApiCall_vkCmdBindVertexBuffers - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindVertexBuffers;
+        functions[format::ApiCallId::ApiCall_vkCmdDraw - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDraw;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndexed - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndexed;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndirect - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndirect;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndexedIndirect;
+        functions[format::ApiCallId::ApiCall_vkCmdDispatch - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDispatch;
+        functions[format::ApiCallId::ApiCall_vkCmdDispatchIndirect - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDispatchIndirect;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyBuffer;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyImage;
+        functions[format::ApiCallId::ApiCall_vkCmdBlitImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBlitImage;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyBufferToImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyBufferToImage;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyImageToBuffer;
+        functions[format::ApiCallId::ApiCall_vkCmdUpdateBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdUpdateBuffer;
+        functions[format::ApiCallId::ApiCall_vkCmdFillBuffer - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdFillBuffer;
+        functions[format::ApiCallId::ApiCall_vkCmdClearColorImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdClearColorImage;
+        functions[format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdClearDepthStencilImage;
+        functions[format::ApiCallId::ApiCall_vkCmdClearAttachments - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdClearAttachments;
+        functions[format::ApiCallId::ApiCall_vkCmdResolveImage - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdResolveImage;
+        functions[format::ApiCallId::ApiCall_vkCmdSetEvent - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetEvent;
+        functions[format::ApiCallId::ApiCall_vkCmdResetEvent - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdResetEvent;
+        functions[format::ApiCallId::ApiCall_vkCmdWaitEvents - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWaitEvents;
+        functions[format::ApiCallId::ApiCall_vkCmdPipelineBarrier - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdPipelineBarrier;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginQuery - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginQuery;
+        functions[format::ApiCallId::ApiCall_vkCmdEndQuery - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndQuery;
+        functions[format::ApiCallId::ApiCall_vkCmdResetQueryPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdResetQueryPool;
+        functions[format::ApiCallId::ApiCall_vkCmdWriteTimestamp - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWriteTimestamp;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyQueryPoolResults;
+        functions[format::ApiCallId::ApiCall_vkCmdPushConstants - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdPushConstants;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginRenderPass - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginRenderPass;
+        functions[format::ApiCallId::ApiCall_vkCmdNextSubpass - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdNextSubpass;
+        functions[format::ApiCallId::ApiCall_vkCmdEndRenderPass - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndRenderPass;
+        functions[format::ApiCallId::ApiCall_vkCmdExecuteCommands - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdExecuteCommands;
+        functions[format::ApiCallId::ApiCall_vkBindBufferMemory2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBindBufferMemory2;
+        functions[format::ApiCallId::ApiCall_vkBindImageMemory2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBindImageMemory2;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeatures - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeatures;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDeviceMask - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDeviceMask;
+        functions[format::ApiCallId::ApiCall_vkCmdDispatchBase - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDispatchBase;
+        functions[format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroups;
+        functions[format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageMemoryRequirements2;
+        functions[format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferMemoryRequirements2;
+        functions[format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2;
+        functions[format::ApiCallId::ApiCall_vkTrimCommandPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkTrimCommandPool;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceQueue2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceQueue2;
+        functions[format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateSamplerYcbcrConversion;
+        functions[format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroySamplerYcbcrConversion;
+        functions[format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplate;
+        functions[format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplate;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferProperties;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFenceProperties;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphoreProperties;
+        functions[format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupport;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndirectCount - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndirectCount;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCount;
+        functions[format::ApiCallId::ApiCall_vkCreateRenderPass2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateRenderPass2;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginRenderPass2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginRenderPass2;
+        functions[format::ApiCallId::ApiCall_vkCmdNextSubpass2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdNextSubpass2;
+        functions[format::ApiCallId::ApiCall_vkCmdEndRenderPass2 - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndRenderPass2;
+        functions[format::ApiCallId::ApiCall_vkResetQueryPool - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkResetQueryPool;
+        functions[format::ApiCallId::ApiCall_vkGetSemaphoreCounterValue - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSemaphoreCounterValue;
+        functions[format::ApiCallId::ApiCall_vkWaitSemaphores - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkWaitSemaphores;
+        functions[format::ApiCallId::ApiCall_vkSignalSemaphore - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSignalSemaphore;
+        functions[format::ApiCallId::ApiCall_vkGetBufferDeviceAddress - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferDeviceAddress;
+        functions[format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddress;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddress;
+        functions[format::ApiCallId::ApiCall_vkDestroySurfaceKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroySurfaceKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceSupportKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormatsKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModesKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateSwapchainKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateSwapchainKHR;
+        functions[format::ApiCallId::ApiCall_vkDestroySwapchainKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroySwapchainKHR;
+        functions[format::ApiCallId::ApiCall_vkGetSwapchainImagesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSwapchainImagesKHR;
+        functions[format::ApiCallId::ApiCall_vkAcquireNextImageKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquireNextImageKHR;
+        functions[format::ApiCallId::ApiCall_vkQueuePresentKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueuePresentKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceGroupPresentCapabilitiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDevicePresentRectanglesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDevicePresentRectanglesKHR;
+        functions[format::ApiCallId::ApiCall_vkAcquireNextImage2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquireNextImage2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDisplayPlaneSupportedDisplaysKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDisplayModePropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateDisplayModeKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDisplayModeKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilitiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDisplayPlaneCapabilitiesKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDisplayPlaneSurfaceKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateSharedSwapchainsKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateXlibSurfaceKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceXlibPresentationSupportKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateXcbSurfaceKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceXcbPresentationSupportKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateWaylandSurfaceKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateAndroidSurfaceKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateWin32SurfaceKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceWin32PresentationSupportKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeaturesKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDeviceMaskKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDispatchBaseKHR;
+        functions[format::ApiCallId::ApiCall_vkTrimCommandPoolKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkTrimCommandPoolKHR;
+        functions[format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroupsKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryWin32HandleKHR;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryWin32HandlePropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryWin32HandlePropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryFdKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryFdKHR;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryFdPropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryFdPropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkImportSemaphoreWin32HandleKHR;
+        functions[format::ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSemaphoreWin32HandleKHR;
+        functions[format::ApiCallId::ApiCall_vkImportSemaphoreFdKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkImportSemaphoreFdKHR;
+        functions[format::ApiCallId::ApiCall_vkGetSemaphoreFdKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSemaphoreFdKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdPushDescriptorSetKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplateKHR;
+        functions[format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplateKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateRenderPass2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateRenderPass2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginRenderPass2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdNextSubpass2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndRenderPass2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetSwapchainStatusKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSwapchainStatusKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFencePropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkImportFenceWin32HandleKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkImportFenceWin32HandleKHR;
+        functions[format::ApiCallId::ApiCall_vkGetFenceWin32HandleKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetFenceWin32HandleKHR;
+        functions[format::ApiCallId::ApiCall_vkImportFenceFdKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkImportFenceFdKHR;
+        functions[format::ApiCallId::ApiCall_vkGetFenceFdKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetFenceFdKHR;
+        functions[format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+        functions[format::ApiCallId::ApiCall_vkAcquireProfilingLockKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquireProfilingLockKHR;
+        functions[format::ApiCallId::ApiCall_vkReleaseProfilingLockKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkReleaseProfilingLockKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormats2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDisplayModeProperties2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDisplayPlaneCapabilities2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageMemoryRequirements2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferMemoryRequirements2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2KHR;
+        functions[format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateSamplerYcbcrConversionKHR;
+        functions[format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroySamplerYcbcrConversionKHR;
+        functions[format::ApiCallId::ApiCall_vkBindBufferMemory2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBindBufferMemory2KHR;
+        functions[format::ApiCallId::ApiCall_vkBindImageMemory2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBindImageMemory2KHR;
+        functions[format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupportKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndirectCountKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountKHR;
+        functions[format::ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSemaphoreCounterValueKHR;
+        functions[format::ApiCallId::ApiCall_vkWaitSemaphoresKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkWaitSemaphoresKHR;
+        functions[format::ApiCallId::ApiCall_vkSignalSemaphoreKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSignalSemaphoreKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceFragmentShadingRatesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceFragmentShadingRatesKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetFragmentShadingRateKHR;
+        functions[format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferDeviceAddressKHR;
+        functions[format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddressKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDeferredOperationKHR;
+        functions[format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDeferredOperationKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDeferredOperationMaxConcurrencyKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeferredOperationMaxConcurrencyKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDeferredOperationResultKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeferredOperationResultKHR;
+        functions[format::ApiCallId::ApiCall_vkDeferredOperationJoinKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDeferredOperationJoinKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPipelineExecutablePropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPipelineExecutableStatisticsKHR;
+        functions[format::ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPipelineExecutableInternalRepresentationsKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdSetEvent2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetEvent2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdResetEvent2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdResetEvent2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWaitEvents2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdPipelineBarrier2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWriteTimestamp2KHR;
+        functions[format::ApiCallId::ApiCall_vkQueueSubmit2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueSubmit2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWriteBufferMarker2AMD;
+        functions[format::ApiCallId::ApiCall_vkGetQueueCheckpointData2NV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetQueueCheckpointData2NV;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyBuffer2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyImage2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyImage2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyBufferToImage2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyImageToBuffer2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdBlitImage2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBlitImage2KHR;
+        functions[format::ApiCallId::ApiCall_vkCmdResolveImage2KHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdResolveImage2KHR;
+        functions[format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDebugReportCallbackEXT;
+        functions[format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDebugReportCallbackEXT;
+        functions[format::ApiCallId::ApiCall_vkDebugReportMessageEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDebugReportMessageEXT;
+        functions[format::ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDebugMarkerSetObjectTagEXT;
+        functions[format::ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDebugMarkerSetObjectNameEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDebugMarkerBeginEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDebugMarkerEndEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDebugMarkerInsertEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindTransformFeedbackBuffersEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginTransformFeedbackEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndTransformFeedbackEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginQueryIndexedEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndQueryIndexedEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndirectByteCountEXT;
+        functions[format::ApiCallId::ApiCall_vkGetImageViewHandleNVX - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageViewHandleNVX;
+        functions[format::ApiCallId::ApiCall_vkGetImageViewAddressNVX - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageViewAddressNVX;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndirectCountAMD;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountAMD;
+        functions[format::ApiCallId::ApiCall_vkGetShaderInfoAMD - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetShaderInfoAMD;
+        functions[format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateStreamDescriptorSurfaceGGP;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryWin32HandleNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryWin32HandleNV;
+        functions[format::ApiCallId::ApiCall_vkCreateViSurfaceNN - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateViSurfaceNN;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginConditionalRenderingEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndConditionalRenderingEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetViewportWScalingNV;
+        functions[format::ApiCallId::ApiCall_vkReleaseDisplayEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkReleaseDisplayEXT;
+        functions[format::ApiCallId::ApiCall_vkAcquireXlibDisplayEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquireXlibDisplayEXT;
+        functions[format::ApiCallId::ApiCall_vkGetRandROutputDisplayEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetRandROutputDisplayEXT;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2EXT;
+        functions[format::ApiCallId::ApiCall_vkDisplayPowerControlEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDisplayPowerControlEXT;
+        functions[format::ApiCallId::ApiCall_vkRegisterDeviceEventEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkRegisterDeviceEventEXT;
+        functions[format::ApiCallId::ApiCall_vkRegisterDisplayEventEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkRegisterDisplayEventEXT;
+        functions[format::ApiCallId::ApiCall_vkGetSwapchainCounterEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSwapchainCounterEXT;
+        functions[format::ApiCallId::ApiCall_vkGetRefreshCycleDurationGOOGLE - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetRefreshCycleDurationGOOGLE;
+        functions[format::ApiCallId::ApiCall_vkGetPastPresentationTimingGOOGLE - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPastPresentationTimingGOOGLE;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDiscardRectangleEXT;
+        functions[format::ApiCallId::ApiCall_vkSetHdrMetadataEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSetHdrMetadataEXT;
+        functions[format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateIOSSurfaceMVK;
+        functions[format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateMacOSSurfaceMVK;
+        functions[format::ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSetDebugUtilsObjectNameEXT;
+        functions[format::ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSetDebugUtilsObjectTagEXT;
+        functions[format::ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueBeginDebugUtilsLabelEXT;
+        functions[format::ApiCallId::ApiCall_vkQueueEndDebugUtilsLabelEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueEndDebugUtilsLabelEXT;
+        functions[format::ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueInsertDebugUtilsLabelEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBeginDebugUtilsLabelEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdEndDebugUtilsLabelEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdInsertDebugUtilsLabelEXT;
+        functions[format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDebugUtilsMessengerEXT;
+        functions[format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyDebugUtilsMessengerEXT;
+        functions[format::ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSubmitDebugUtilsMessageEXT;
+        functions[format::ApiCallId::ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetAndroidHardwareBufferPropertiesANDROID;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryAndroidHardwareBufferANDROID;
+        functions[format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetSampleLocationsEXT;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceMultisamplePropertiesEXT;
+        functions[format::ApiCallId::ApiCall_vkGetImageDrmFormatModifierPropertiesEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetImageDrmFormatModifierPropertiesEXT;
+        functions[format::ApiCallId::ApiCall_vkCreateValidationCacheEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateValidationCacheEXT;
+        functions[format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyValidationCacheEXT;
+        functions[format::ApiCallId::ApiCall_vkMergeValidationCachesEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkMergeValidationCachesEXT;
+        functions[format::ApiCallId::ApiCall_vkGetValidationCacheDataEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetValidationCacheDataEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindShadingRateImageNV;
+        functions[format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetViewportShadingRatePaletteNV;
+        functions[format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetCoarseSampleOrderNV;
+        functions[format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateAccelerationStructureNV;
+        functions[format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyAccelerationStructureNV;
+        functions[format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetAccelerationStructureMemoryRequirementsNV;
+        functions[format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkBindAccelerationStructureMemoryNV;
+        functions[format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBuildAccelerationStructureNV;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyAccelerationStructureNV;
+        functions[format::ApiCallId::ApiCall_vkCmdTraceRaysNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdTraceRaysNV;
+        functions[format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateRayTracingPipelinesNV;
+        functions[format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesNV;
+        functions[format::ApiCallId::ApiCall_vkGetAccelerationStructureHandleNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetAccelerationStructureHandleNV;
+        functions[format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesNV;
+        functions[format::ApiCallId::ApiCall_vkCompileDeferredNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCompileDeferredNV;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryHostPointerPropertiesEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryHostPointerPropertiesEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWriteBufferMarkerAMD;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+        functions[format::ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetCalibratedTimestampsEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawMeshTasksNV;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectNV;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectCountNV;
+        functions[format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetExclusiveScissorNV;
+        functions[format::ApiCallId::ApiCall_vkCmdSetCheckpointNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetCheckpointNV;
+        functions[format::ApiCallId::ApiCall_vkGetQueueCheckpointDataNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetQueueCheckpointDataNV;
+        functions[format::ApiCallId::ApiCall_vkInitializePerformanceApiINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkInitializePerformanceApiINTEL;
+        functions[format::ApiCallId::ApiCall_vkUninitializePerformanceApiINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkUninitializePerformanceApiINTEL;
+        functions[format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetPerformanceMarkerINTEL;
+        functions[format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetPerformanceStreamMarkerINTEL;
+        functions[format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetPerformanceOverrideINTEL;
+        functions[format::ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquirePerformanceConfigurationINTEL;
+        functions[format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkReleasePerformanceConfigurationINTEL;
+        functions[format::ApiCallId::ApiCall_vkQueueSetPerformanceConfigurationINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkQueueSetPerformanceConfigurationINTEL;
+        functions[format::ApiCallId::ApiCall_vkGetPerformanceParameterINTEL - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPerformanceParameterINTEL;
+        functions[format::ApiCallId::ApiCall_vkSetLocalDimmingAMD - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSetLocalDimmingAMD;
+        functions[format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateImagePipeSurfaceFUCHSIA;
+        functions[format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateMetalSurfaceEXT;
+        functions[format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetBufferDeviceAddressEXT;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolPropertiesEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceToolPropertiesEXT;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModes2EXT;
+        functions[format::ApiCallId::ApiCall_vkAcquireFullScreenExclusiveModeEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquireFullScreenExclusiveModeEXT;
+        functions[format::ApiCallId::ApiCall_vkReleaseFullScreenExclusiveModeEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkReleaseFullScreenExclusiveModeEXT;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModes2EXT;
+        functions[format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateHeadlessSurfaceEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetLineStippleEXT;
+        functions[format::ApiCallId::ApiCall_vkResetQueryPoolEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkResetQueryPoolEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetCullModeEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetCullModeEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetFrontFaceEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetPrimitiveTopologyEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetViewportWithCountEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetScissorWithCountEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindVertexBuffers2EXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDepthTestEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDepthWriteEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDepthCompareOpEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDepthBoundsTestEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetStencilTestEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetStencilOpEXT;
+        functions[format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetGeneratedCommandsMemoryRequirementsNV;
+        functions[format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdPreprocessGeneratedCommandsNV;
+        functions[format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdExecuteGeneratedCommandsNV;
+        functions[format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBindPipelineShaderGroupNV;
+        functions[format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateIndirectCommandsLayoutNV;
+        functions[format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyIndirectCommandsLayoutNV;
+        functions[format::ApiCallId::ApiCall_vkAcquireDrmDisplayEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquireDrmDisplayEXT;
+        functions[format::ApiCallId::ApiCall_vkGetDrmDisplayEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDrmDisplayEXT;
+        functions[format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreatePrivateDataSlotEXT;
+        functions[format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyPrivateDataSlotEXT;
+        functions[format::ApiCallId::ApiCall_vkSetPrivateDataEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkSetPrivateDataEXT;
+        functions[format::ApiCallId::ApiCall_vkGetPrivateDataEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPrivateDataEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetFragmentShadingRateEnumNV;
+        functions[format::ApiCallId::ApiCall_vkAcquireWinrtDisplayNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkAcquireWinrtDisplayNV;
+        functions[format::ApiCallId::ApiCall_vkGetWinrtDisplayNV - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetWinrtDisplayNV;
+        functions[format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateDirectFBSurfaceEXT;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceDirectFBPresentationSupportEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetVertexInputEXT;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryZirconHandleFUCHSIA - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryZirconHandleFUCHSIA;
+        functions[format::ApiCallId::ApiCall_vkGetMemoryZirconHandlePropertiesFUCHSIA - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetMemoryZirconHandlePropertiesFUCHSIA;
+        functions[format::ApiCallId::ApiCall_vkImportSemaphoreZirconHandleFUCHSIA - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkImportSemaphoreZirconHandleFUCHSIA;
+        functions[format::ApiCallId::ApiCall_vkGetSemaphoreZirconHandleFUCHSIA - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetSemaphoreZirconHandleFUCHSIA;
+        functions[format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetPatchControlPointsEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetRasterizerDiscardEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetDepthBiasEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetLogicOpEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetPrimitiveRestartEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCreateScreenSurfaceQNX - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateScreenSurfaceQNX;
+        functions[format::ApiCallId::ApiCall_vkGetPhysicalDeviceScreenPresentationSupportQNX - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetPhysicalDeviceScreenPresentationSupportQNX;
+        functions[format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetColorWriteEnableEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawMultiEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawMultiEXT;
+        functions[format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdDrawMultiIndexedEXT;
+        functions[format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateAccelerationStructureKHR;
+        functions[format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkDestroyAccelerationStructureKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBuildAccelerationStructuresKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdBuildAccelerationStructuresIndirectKHR;
+        functions[format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCopyAccelerationStructureToMemoryKHR;
+        functions[format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCopyMemoryToAccelerationStructureKHR;
+        functions[format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkWriteAccelerationStructuresPropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyAccelerationStructureKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyAccelerationStructureToMemoryKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdCopyMemoryToAccelerationStructureKHR;
+        functions[format::ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetAccelerationStructureDeviceAddressKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetDeviceAccelerationStructureCompatibilityKHR;
+        functions[format::ApiCallId::ApiCall_vkGetAccelerationStructureBuildSizesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetAccelerationStructureBuildSizesKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdTraceRaysKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdTraceRaysKHR;
+        functions[format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCreateRayTracingPipelinesKHR;
+        functions[format::ApiCallId::ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdTraceRaysIndirectKHR;
+        functions[format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupStackSizeKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkGetRayTracingShaderGroupStackSizeKHR;
+        functions[format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR - kFirstDecodeFunction] =
+            &VulkanDecoder::Decode_vkCmdSetRayTracingPipelineStackSizeKHR;
+
+        return functions;
+    }();
+
+    return decode_functions.data();
 }
 
 void VulkanDecoder::DecodeFunctionCall(format::ApiCallId             call_id,
@@ -10193,1388 +10665,33 @@ void VulkanDecoder::DecodeFunctionCall(format::ApiCallId             call_id,
                                        const uint8_t*                parameter_buffer,
                                        size_t                        buffer_size)
 {
-    switch(call_id)
+    // Call IDs that precede the Vulkan range wrap around to large values, failing the table size check.
+    uint32_t index = call_id - kFirstDecodeFunction;
+
+    if (IsFastForwarding() && SkipFastForwardCall(call_id, parameter_buffer, buffer_size))
+    {
+        return;
+    }
+
+    if (IsReusingCommandBuffers() && SkipReusedCommandBufferCall(call_id, call_info, parameter_buffer, buffer_size))
+    {
+        return;
+    }
+
+    BeginCallProfile(call_id);
+
+    if ((index < kDecodeFunctionCount) && (decode_functions_[index] != nullptr))
+    {
+        size_t bytes_read = (this->*decode_functions_[index])(parameter_buffer, buffer_size);
+
+        if (IsValidatingCallSizes() && (bytes_read != buffer_size))
+        {
+            ReportInvalidCallSize(call_id, bytes_read, buffer_size);
+        }
+    }
+    else
     {
-    default:
         VulkanDecoderBase::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateInstance:
-        Decode_vkCreateInstance(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyInstance:
-        Decode_vkDestroyInstance(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices:
-        Decode_vkEnumeratePhysicalDevices(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures:
-        Decode_vkGetPhysicalDeviceFeatures(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties:
-        Decode_vkGetPhysicalDeviceFormatProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties:
-        Decode_vkGetPhysicalDeviceImageFormatProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
-        Decode_vkGetPhysicalDeviceProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties:
-        Decode_vkGetPhysicalDeviceQueueFamilyProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties:
-        Decode_vkGetPhysicalDeviceMemoryProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDevice:
-        Decode_vkCreateDevice(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDevice:
-        Decode_vkDestroyDevice(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceQueue:
-        Decode_vkGetDeviceQueue(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueSubmit:
-        Decode_vkQueueSubmit(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueWaitIdle:
-        Decode_vkQueueWaitIdle(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDeviceWaitIdle:
-        Decode_vkDeviceWaitIdle(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAllocateMemory:
-        Decode_vkAllocateMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFreeMemory:
-        Decode_vkFreeMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkMapMemory:
-        Decode_vkMapMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkUnmapMemory:
-        Decode_vkUnmapMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges:
-        Decode_vkFlushMappedMemoryRanges(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges:
-        Decode_vkInvalidateMappedMemoryRanges(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceMemoryCommitment:
-        Decode_vkGetDeviceMemoryCommitment(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindBufferMemory:
-        Decode_vkBindBufferMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindImageMemory:
-        Decode_vkBindImageMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements:
-        Decode_vkGetBufferMemoryRequirements(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements:
-        Decode_vkGetImageMemoryRequirements(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements:
-        Decode_vkGetImageSparseMemoryRequirements(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties:
-        Decode_vkGetPhysicalDeviceSparseImageFormatProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueBindSparse:
-        Decode_vkQueueBindSparse(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateFence:
-        Decode_vkCreateFence(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyFence:
-        Decode_vkDestroyFence(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetFences:
-        Decode_vkResetFences(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetFenceStatus:
-        Decode_vkGetFenceStatus(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWaitForFences:
-        Decode_vkWaitForFences(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSemaphore:
-        Decode_vkCreateSemaphore(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySemaphore:
-        Decode_vkDestroySemaphore(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateEvent:
-        Decode_vkCreateEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyEvent:
-        Decode_vkDestroyEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetEventStatus:
-        Decode_vkGetEventStatus(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetEvent:
-        Decode_vkSetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetEvent:
-        Decode_vkResetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateQueryPool:
-        Decode_vkCreateQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyQueryPool:
-        Decode_vkDestroyQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetQueryPoolResults:
-        Decode_vkGetQueryPoolResults(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateBuffer:
-        Decode_vkCreateBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyBuffer:
-        Decode_vkDestroyBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateBufferView:
-        Decode_vkCreateBufferView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyBufferView:
-        Decode_vkDestroyBufferView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateImage:
-        Decode_vkCreateImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyImage:
-        Decode_vkDestroyImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSubresourceLayout:
-        Decode_vkGetImageSubresourceLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateImageView:
-        Decode_vkCreateImageView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyImageView:
-        Decode_vkDestroyImageView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateShaderModule:
-        Decode_vkCreateShaderModule(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyShaderModule:
-        Decode_vkDestroyShaderModule(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreatePipelineCache:
-        Decode_vkCreatePipelineCache(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
-        Decode_vkDestroyPipelineCache(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineCacheData:
-        Decode_vkGetPipelineCacheData(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkMergePipelineCaches:
-        Decode_vkMergePipelineCaches(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
-        Decode_vkCreateGraphicsPipelines(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateComputePipelines:
-        Decode_vkCreateComputePipelines(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPipeline:
-        Decode_vkDestroyPipeline(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
-        Decode_vkCreatePipelineLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
-        Decode_vkDestroyPipelineLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSampler:
-        Decode_vkCreateSampler(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySampler:
-        Decode_vkDestroySampler(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
-        Decode_vkCreateDescriptorSetLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
-        Decode_vkDestroyDescriptorSetLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorPool:
-        Decode_vkCreateDescriptorPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorPool:
-        Decode_vkDestroyDescriptorPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetDescriptorPool:
-        Decode_vkResetDescriptorPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAllocateDescriptorSets:
-        Decode_vkAllocateDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFreeDescriptorSets:
-        Decode_vkFreeDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkUpdateDescriptorSets:
-        Decode_vkUpdateDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateFramebuffer:
-        Decode_vkCreateFramebuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
-        Decode_vkDestroyFramebuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRenderPass:
-        Decode_vkCreateRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyRenderPass:
-        Decode_vkDestroyRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRenderAreaGranularity:
-        Decode_vkGetRenderAreaGranularity(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateCommandPool:
-        Decode_vkCreateCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyCommandPool:
-        Decode_vkDestroyCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetCommandPool:
-        Decode_vkResetCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAllocateCommandBuffers:
-        Decode_vkAllocateCommandBuffers(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
-        Decode_vkFreeCommandBuffers(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
-        Decode_vkBeginCommandBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEndCommandBuffer:
-        Decode_vkEndCommandBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetCommandBuffer:
-        Decode_vkResetCommandBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindPipeline:
-        Decode_vkCmdBindPipeline(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewport:
-        Decode_vkCmdSetViewport(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetScissor:
-        Decode_vkCmdSetScissor(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
-        Decode_vkCmdSetLineWidth(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
-        Decode_vkCmdSetDepthBias(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
-        Decode_vkCmdSetBlendConstants(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
-        Decode_vkCmdSetDepthBounds(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
-        Decode_vkCmdSetStencilCompareMask(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
-        Decode_vkCmdSetStencilWriteMask(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
-        Decode_vkCmdSetStencilReference(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
-        Decode_vkCmdBindDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
-        Decode_vkCmdBindIndexBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
-        Decode_vkCmdBindVertexBuffers(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDraw:
-        Decode_vkCmdDraw(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
-        Decode_vkCmdDrawIndexed(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
-        Decode_vkCmdDrawIndirect(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
-        Decode_vkCmdDrawIndexedIndirect(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatch:
-        Decode_vkCmdDispatch(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
-        Decode_vkCmdDispatchIndirect(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
-        Decode_vkCmdCopyBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyImage:
-        Decode_vkCmdCopyImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBlitImage:
-        Decode_vkCmdBlitImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
-        Decode_vkCmdCopyBufferToImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
-        Decode_vkCmdCopyImageToBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
-        Decode_vkCmdUpdateBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdFillBuffer:
-        Decode_vkCmdFillBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdClearColorImage:
-        Decode_vkCmdClearColorImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
-        Decode_vkCmdClearDepthStencilImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdClearAttachments:
-        Decode_vkCmdClearAttachments(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResolveImage:
-        Decode_vkCmdResolveImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetEvent:
-        Decode_vkCmdSetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResetEvent:
-        Decode_vkCmdResetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWaitEvents:
-        Decode_vkCmdWaitEvents(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
-        Decode_vkCmdPipelineBarrier(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginQuery:
-        Decode_vkCmdBeginQuery(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndQuery:
-        Decode_vkCmdEndQuery(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
-        Decode_vkCmdResetQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
-        Decode_vkCmdWriteTimestamp(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
-        Decode_vkCmdCopyQueryPoolResults(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPushConstants:
-        Decode_vkCmdPushConstants(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginRenderPass:
-        Decode_vkCmdBeginRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdNextSubpass:
-        Decode_vkCmdNextSubpass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
-        Decode_vkCmdEndRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdExecuteCommands:
-        Decode_vkCmdExecuteCommands(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindBufferMemory2:
-        Decode_vkBindBufferMemory2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindImageMemory2:
-        Decode_vkBindImageMemory2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeatures:
-        Decode_vkGetDeviceGroupPeerMemoryFeatures(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
-        Decode_vkCmdSetDeviceMask(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatchBase:
-        Decode_vkCmdDispatchBase(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups:
-        Decode_vkEnumeratePhysicalDeviceGroups(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2:
-        Decode_vkGetImageMemoryRequirements2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2:
-        Decode_vkGetBufferMemoryRequirements2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2:
-        Decode_vkGetImageSparseMemoryRequirements2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2:
-        Decode_vkGetPhysicalDeviceFeatures2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
-        Decode_vkGetPhysicalDeviceProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2:
-        Decode_vkGetPhysicalDeviceFormatProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2:
-        Decode_vkGetPhysicalDeviceImageFormatProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2:
-        Decode_vkGetPhysicalDeviceQueueFamilyProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2:
-        Decode_vkGetPhysicalDeviceMemoryProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2:
-        Decode_vkGetPhysicalDeviceSparseImageFormatProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkTrimCommandPool:
-        Decode_vkTrimCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceQueue2:
-        Decode_vkGetDeviceQueue2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
-        Decode_vkCreateSamplerYcbcrConversion(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
-        Decode_vkDestroySamplerYcbcrConversion(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
-        Decode_vkCreateDescriptorUpdateTemplate(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
-        Decode_vkDestroyDescriptorUpdateTemplate(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties:
-        Decode_vkGetPhysicalDeviceExternalBufferProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties:
-        Decode_vkGetPhysicalDeviceExternalFenceProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties:
-        Decode_vkGetPhysicalDeviceExternalSemaphoreProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport:
-        Decode_vkGetDescriptorSetLayoutSupport(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
-        Decode_vkCmdDrawIndirectCount(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
-        Decode_vkCmdDrawIndexedIndirectCount(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRenderPass2:
-        Decode_vkCreateRenderPass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2:
-        Decode_vkCmdBeginRenderPass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
-        Decode_vkCmdNextSubpass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
-        Decode_vkCmdEndRenderPass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetQueryPool:
-        Decode_vkResetQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreCounterValue:
-        Decode_vkGetSemaphoreCounterValue(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWaitSemaphores:
-        Decode_vkWaitSemaphores(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSignalSemaphore:
-        Decode_vkSignalSemaphore(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferDeviceAddress:
-        Decode_vkGetBufferDeviceAddress(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress:
-        Decode_vkGetBufferOpaqueCaptureAddress(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress:
-        Decode_vkGetDeviceMemoryOpaqueCaptureAddress(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySurfaceKHR:
-        Decode_vkDestroySurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR:
-        Decode_vkGetPhysicalDeviceSurfaceSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR:
-        Decode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR:
-        Decode_vkGetPhysicalDeviceSurfaceFormatsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR:
-        Decode_vkGetPhysicalDeviceSurfacePresentModesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSwapchainKHR:
-        Decode_vkCreateSwapchainKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySwapchainKHR:
-        Decode_vkDestroySwapchainKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSwapchainImagesKHR:
-        Decode_vkGetSwapchainImagesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireNextImageKHR:
-        Decode_vkAcquireNextImageKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueuePresentKHR:
-        Decode_vkQueuePresentKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR:
-        Decode_vkGetDeviceGroupPresentCapabilitiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModesKHR:
-        Decode_vkGetDeviceGroupSurfacePresentModesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDevicePresentRectanglesKHR:
-        Decode_vkGetPhysicalDevicePresentRectanglesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireNextImage2KHR:
-        Decode_vkAcquireNextImage2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR:
-        Decode_vkGetPhysicalDeviceDisplayPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR:
-        Decode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR:
-        Decode_vkGetDisplayPlaneSupportedDisplaysKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR:
-        Decode_vkGetDisplayModePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDisplayModeKHR:
-        Decode_vkCreateDisplayModeKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilitiesKHR:
-        Decode_vkGetDisplayPlaneCapabilitiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR:
-        Decode_vkCreateDisplayPlaneSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR:
-        Decode_vkCreateSharedSwapchainsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR:
-        Decode_vkCreateXlibSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceXlibPresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR:
-        Decode_vkCreateXcbSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceXcbPresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR:
-        Decode_vkCreateWaylandSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR:
-        Decode_vkCreateAndroidSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR:
-        Decode_vkCreateWin32SurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceWin32PresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR:
-        Decode_vkGetPhysicalDeviceFeatures2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
-        Decode_vkGetPhysicalDeviceProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR:
-        Decode_vkGetPhysicalDeviceFormatProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR:
-        Decode_vkGetPhysicalDeviceImageFormatProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
-        Decode_vkGetPhysicalDeviceQueueFamilyProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
-        Decode_vkGetPhysicalDeviceMemoryProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
-        Decode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR:
-        Decode_vkGetDeviceGroupPeerMemoryFeaturesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
-        Decode_vkCmdSetDeviceMaskKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
-        Decode_vkCmdDispatchBaseKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkTrimCommandPoolKHR:
-        Decode_vkTrimCommandPoolKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR:
-        Decode_vkEnumeratePhysicalDeviceGroupsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR:
-        Decode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR:
-        Decode_vkGetMemoryWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryWin32HandlePropertiesKHR:
-        Decode_vkGetMemoryWin32HandlePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryFdKHR:
-        Decode_vkGetMemoryFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryFdPropertiesKHR:
-        Decode_vkGetMemoryFdPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR:
-        Decode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR:
-        Decode_vkImportSemaphoreWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR:
-        Decode_vkGetSemaphoreWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportSemaphoreFdKHR:
-        Decode_vkImportSemaphoreFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreFdKHR:
-        Decode_vkGetSemaphoreFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
-        Decode_vkCmdPushDescriptorSetKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
-        Decode_vkCreateDescriptorUpdateTemplateKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
-        Decode_vkDestroyDescriptorUpdateTemplateKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
-        Decode_vkCreateRenderPass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
-        Decode_vkCmdBeginRenderPass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
-        Decode_vkCmdNextSubpass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
-        Decode_vkCmdEndRenderPass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSwapchainStatusKHR:
-        Decode_vkGetSwapchainStatusKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR:
-        Decode_vkGetPhysicalDeviceExternalFencePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportFenceWin32HandleKHR:
-        Decode_vkImportFenceWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetFenceWin32HandleKHR:
-        Decode_vkGetFenceWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportFenceFdKHR:
-        Decode_vkImportFenceFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetFenceFdKHR:
-        Decode_vkGetFenceFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR:
-        Decode_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR:
-        Decode_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireProfilingLockKHR:
-        Decode_vkAcquireProfilingLockKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleaseProfilingLockKHR:
-        Decode_vkReleaseProfilingLockKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR:
-        Decode_vkGetPhysicalDeviceSurfaceCapabilities2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR:
-        Decode_vkGetPhysicalDeviceSurfaceFormats2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR:
-        Decode_vkGetPhysicalDeviceDisplayProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR:
-        Decode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR:
-        Decode_vkGetDisplayModeProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR:
-        Decode_vkGetDisplayPlaneCapabilities2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR:
-        Decode_vkGetImageMemoryRequirements2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR:
-        Decode_vkGetBufferMemoryRequirements2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR:
-        Decode_vkGetImageSparseMemoryRequirements2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
-        Decode_vkCreateSamplerYcbcrConversionKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
-        Decode_vkDestroySamplerYcbcrConversionKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindBufferMemory2KHR:
-        Decode_vkBindBufferMemory2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindImageMemory2KHR:
-        Decode_vkBindImageMemory2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR:
-        Decode_vkGetDescriptorSetLayoutSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
-        Decode_vkCmdDrawIndirectCountKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
-        Decode_vkCmdDrawIndexedIndirectCountKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR:
-        Decode_vkGetSemaphoreCounterValueKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWaitSemaphoresKHR:
-        Decode_vkWaitSemaphoresKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSignalSemaphoreKHR:
-        Decode_vkSignalSemaphoreKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFragmentShadingRatesKHR:
-        Decode_vkGetPhysicalDeviceFragmentShadingRatesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR:
-        Decode_vkCmdSetFragmentShadingRateKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR:
-        Decode_vkGetBufferDeviceAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR:
-        Decode_vkGetBufferOpaqueCaptureAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR:
-        Decode_vkGetDeviceMemoryOpaqueCaptureAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR:
-        Decode_vkCreateDeferredOperationKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR:
-        Decode_vkDestroyDeferredOperationKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeferredOperationMaxConcurrencyKHR:
-        Decode_vkGetDeferredOperationMaxConcurrencyKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeferredOperationResultKHR:
-        Decode_vkGetDeferredOperationResultKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDeferredOperationJoinKHR:
-        Decode_vkDeferredOperationJoinKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR:
-        Decode_vkGetPipelineExecutablePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR:
-        Decode_vkGetPipelineExecutableStatisticsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR:
-        Decode_vkGetPipelineExecutableInternalRepresentationsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetEvent2KHR:
-        Decode_vkCmdSetEvent2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResetEvent2KHR:
-        Decode_vkCmdResetEvent2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR:
-        Decode_vkCmdWaitEvents2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR:
-        Decode_vkCmdPipelineBarrier2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR:
-        Decode_vkCmdWriteTimestamp2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueSubmit2KHR:
-        Decode_vkQueueSubmit2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD:
-        Decode_vkCmdWriteBufferMarker2AMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetQueueCheckpointData2NV:
-        Decode_vkGetQueueCheckpointData2NV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR:
-        Decode_vkCmdCopyBuffer2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyImage2KHR:
-        Decode_vkCmdCopyImage2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR:
-        Decode_vkCmdCopyBufferToImage2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR:
-        Decode_vkCmdCopyImageToBuffer2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBlitImage2KHR:
-        Decode_vkCmdBlitImage2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResolveImage2KHR:
-        Decode_vkCmdResolveImage2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT:
-        Decode_vkCreateDebugReportCallbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT:
-        Decode_vkDestroyDebugReportCallbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDebugReportMessageEXT:
-        Decode_vkDebugReportMessageEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT:
-        Decode_vkDebugMarkerSetObjectTagEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT:
-        Decode_vkDebugMarkerSetObjectNameEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
-        Decode_vkCmdDebugMarkerBeginEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
-        Decode_vkCmdDebugMarkerEndEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
-        Decode_vkCmdDebugMarkerInsertEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
-        Decode_vkCmdBindTransformFeedbackBuffersEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
-        Decode_vkCmdBeginTransformFeedbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
-        Decode_vkCmdEndTransformFeedbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
-        Decode_vkCmdBeginQueryIndexedEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
-        Decode_vkCmdEndQueryIndexedEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
-        Decode_vkCmdDrawIndirectByteCountEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageViewHandleNVX:
-        Decode_vkGetImageViewHandleNVX(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageViewAddressNVX:
-        Decode_vkGetImageViewAddressNVX(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
-        Decode_vkCmdDrawIndirectCountAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
-        Decode_vkCmdDrawIndexedIndirectCountAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetShaderInfoAMD:
-        Decode_vkGetShaderInfoAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP:
-        Decode_vkCreateStreamDescriptorSurfaceGGP(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV:
-        Decode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryWin32HandleNV:
-        Decode_vkGetMemoryWin32HandleNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateViSurfaceNN:
-        Decode_vkCreateViSurfaceNN(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
-        Decode_vkCmdBeginConditionalRenderingEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
-        Decode_vkCmdEndConditionalRenderingEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
-        Decode_vkCmdSetViewportWScalingNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleaseDisplayEXT:
-        Decode_vkReleaseDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireXlibDisplayEXT:
-        Decode_vkAcquireXlibDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRandROutputDisplayEXT:
-        Decode_vkGetRandROutputDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT:
-        Decode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDisplayPowerControlEXT:
-        Decode_vkDisplayPowerControlEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkRegisterDeviceEventEXT:
-        Decode_vkRegisterDeviceEventEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkRegisterDisplayEventEXT:
-        Decode_vkRegisterDisplayEventEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSwapchainCounterEXT:
-        Decode_vkGetSwapchainCounterEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRefreshCycleDurationGOOGLE:
-        Decode_vkGetRefreshCycleDurationGOOGLE(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPastPresentationTimingGOOGLE:
-        Decode_vkGetPastPresentationTimingGOOGLE(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
-        Decode_vkCmdSetDiscardRectangleEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetHdrMetadataEXT:
-        Decode_vkSetHdrMetadataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK:
-        Decode_vkCreateIOSSurfaceMVK(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK:
-        Decode_vkCreateMacOSSurfaceMVK(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT:
-        Decode_vkSetDebugUtilsObjectNameEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT:
-        Decode_vkSetDebugUtilsObjectTagEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT:
-        Decode_vkQueueBeginDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueEndDebugUtilsLabelEXT:
-        Decode_vkQueueEndDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT:
-        Decode_vkQueueInsertDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
-        Decode_vkCmdBeginDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
-        Decode_vkCmdEndDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
-        Decode_vkCmdInsertDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT:
-        Decode_vkCreateDebugUtilsMessengerEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT:
-        Decode_vkDestroyDebugUtilsMessengerEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT:
-        Decode_vkSubmitDebugUtilsMessageEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID:
-        Decode_vkGetAndroidHardwareBufferPropertiesANDROID(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID:
-        Decode_vkGetMemoryAndroidHardwareBufferANDROID(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
-        Decode_vkCmdSetSampleLocationsEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT:
-        Decode_vkGetPhysicalDeviceMultisamplePropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageDrmFormatModifierPropertiesEXT:
-        Decode_vkGetImageDrmFormatModifierPropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateValidationCacheEXT:
-        Decode_vkCreateValidationCacheEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT:
-        Decode_vkDestroyValidationCacheEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkMergeValidationCachesEXT:
-        Decode_vkMergeValidationCachesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetValidationCacheDataEXT:
-        Decode_vkGetValidationCacheDataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
-        Decode_vkCmdBindShadingRateImageNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
-        Decode_vkCmdSetViewportShadingRatePaletteNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
-        Decode_vkCmdSetCoarseSampleOrderNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV:
-        Decode_vkCreateAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV:
-        Decode_vkDestroyAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV:
-        Decode_vkGetAccelerationStructureMemoryRequirementsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV:
-        Decode_vkBindAccelerationStructureMemoryNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
-        Decode_vkCmdBuildAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
-        Decode_vkCmdCopyAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
-        Decode_vkCmdTraceRaysNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV:
-        Decode_vkCreateRayTracingPipelinesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesKHR:
-        Decode_vkGetRayTracingShaderGroupHandlesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesNV:
-        Decode_vkGetRayTracingShaderGroupHandlesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureHandleNV:
-        Decode_vkGetAccelerationStructureHandleNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
-        Decode_vkCmdWriteAccelerationStructuresPropertiesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCompileDeferredNV:
-        Decode_vkCompileDeferredNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryHostPointerPropertiesEXT:
-        Decode_vkGetMemoryHostPointerPropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
-        Decode_vkCmdWriteBufferMarkerAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT:
-        Decode_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT:
-        Decode_vkGetCalibratedTimestampsEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
-        Decode_vkCmdDrawMeshTasksNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
-        Decode_vkCmdDrawMeshTasksIndirectNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
-        Decode_vkCmdDrawMeshTasksIndirectCountNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
-        Decode_vkCmdSetExclusiveScissorNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
-        Decode_vkCmdSetCheckpointNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetQueueCheckpointDataNV:
-        Decode_vkGetQueueCheckpointDataNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkInitializePerformanceApiINTEL:
-        Decode_vkInitializePerformanceApiINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkUninitializePerformanceApiINTEL:
-        Decode_vkUninitializePerformanceApiINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
-        Decode_vkCmdSetPerformanceMarkerINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
-        Decode_vkCmdSetPerformanceStreamMarkerINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
-        Decode_vkCmdSetPerformanceOverrideINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL:
-        Decode_vkAcquirePerformanceConfigurationINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL:
-        Decode_vkReleasePerformanceConfigurationINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueSetPerformanceConfigurationINTEL:
-        Decode_vkQueueSetPerformanceConfigurationINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPerformanceParameterINTEL:
-        Decode_vkGetPerformanceParameterINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetLocalDimmingAMD:
-        Decode_vkSetLocalDimmingAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
-        Decode_vkCreateImagePipeSurfaceFUCHSIA(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT:
-        Decode_vkCreateMetalSurfaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT:
-        Decode_vkGetBufferDeviceAddressEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolPropertiesEXT:
-        Decode_vkGetPhysicalDeviceToolPropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV:
-        Decode_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV:
-        Decode_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT:
-        Decode_vkGetPhysicalDeviceSurfacePresentModes2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireFullScreenExclusiveModeEXT:
-        Decode_vkAcquireFullScreenExclusiveModeEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleaseFullScreenExclusiveModeEXT:
-        Decode_vkReleaseFullScreenExclusiveModeEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT:
-        Decode_vkGetDeviceGroupSurfacePresentModes2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT:
-        Decode_vkCreateHeadlessSurfaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
-        Decode_vkCmdSetLineStippleEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetQueryPoolEXT:
-        Decode_vkResetQueryPoolEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
-        Decode_vkCmdSetCullModeEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
-        Decode_vkCmdSetFrontFaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
-        Decode_vkCmdSetPrimitiveTopologyEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
-        Decode_vkCmdSetViewportWithCountEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
-        Decode_vkCmdSetScissorWithCountEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
-        Decode_vkCmdBindVertexBuffers2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
-        Decode_vkCmdSetDepthTestEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
-        Decode_vkCmdSetDepthWriteEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
-        Decode_vkCmdSetDepthCompareOpEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
-        Decode_vkCmdSetDepthBoundsTestEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
-        Decode_vkCmdSetStencilTestEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
-        Decode_vkCmdSetStencilOpEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV:
-        Decode_vkGetGeneratedCommandsMemoryRequirementsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
-        Decode_vkCmdPreprocessGeneratedCommandsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
-        Decode_vkCmdExecuteGeneratedCommandsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
-        Decode_vkCmdBindPipelineShaderGroupNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV:
-        Decode_vkCreateIndirectCommandsLayoutNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV:
-        Decode_vkDestroyIndirectCommandsLayoutNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireDrmDisplayEXT:
-        Decode_vkAcquireDrmDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDrmDisplayEXT:
-        Decode_vkGetDrmDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT:
-        Decode_vkCreatePrivateDataSlotEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT:
-        Decode_vkDestroyPrivateDataSlotEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetPrivateDataEXT:
-        Decode_vkSetPrivateDataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPrivateDataEXT:
-        Decode_vkGetPrivateDataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV:
-        Decode_vkCmdSetFragmentShadingRateEnumNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireWinrtDisplayNV:
-        Decode_vkAcquireWinrtDisplayNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetWinrtDisplayNV:
-        Decode_vkGetWinrtDisplayNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT:
-        Decode_vkCreateDirectFBSurfaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT:
-        Decode_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT:
-        Decode_vkCmdSetVertexInputEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryZirconHandleFUCHSIA:
-        Decode_vkGetMemoryZirconHandleFUCHSIA(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryZirconHandlePropertiesFUCHSIA:
-        Decode_vkGetMemoryZirconHandlePropertiesFUCHSIA(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportSemaphoreZirconHandleFUCHSIA:
-        Decode_vkImportSemaphoreZirconHandleFUCHSIA(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreZirconHandleFUCHSIA:
-        Decode_vkGetSemaphoreZirconHandleFUCHSIA(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT:
-        Decode_vkCmdSetPatchControlPointsEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT:
-        Decode_vkCmdSetRasterizerDiscardEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT:
-        Decode_vkCmdSetDepthBiasEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT:
-        Decode_vkCmdSetLogicOpEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT:
-        Decode_vkCmdSetPrimitiveRestartEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateScreenSurfaceQNX:
-        Decode_vkCreateScreenSurfaceQNX(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceScreenPresentationSupportQNX:
-        Decode_vkGetPhysicalDeviceScreenPresentationSupportQNX(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT:
-        Decode_vkCmdSetColorWriteEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMultiEXT:
-        Decode_vkCmdDrawMultiEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT:
-        Decode_vkCmdDrawMultiIndexedEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR:
-        Decode_vkCreateAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR:
-        Decode_vkDestroyAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR:
-        Decode_vkCmdBuildAccelerationStructuresKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR:
-        Decode_vkCmdBuildAccelerationStructuresIndirectKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR:
-        Decode_vkCopyAccelerationStructureToMemoryKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR:
-        Decode_vkCopyMemoryToAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR:
-        Decode_vkWriteAccelerationStructuresPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
-        Decode_vkCmdCopyAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
-        Decode_vkCmdCopyAccelerationStructureToMemoryKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
-        Decode_vkCmdCopyMemoryToAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR:
-        Decode_vkGetAccelerationStructureDeviceAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
-        Decode_vkCmdWriteAccelerationStructuresPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR:
-        Decode_vkGetDeviceAccelerationStructureCompatibilityKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureBuildSizesKHR:
-        Decode_vkGetAccelerationStructureBuildSizesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
-        Decode_vkCmdTraceRaysKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
-        Decode_vkCreateRayTracingPipelinesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR:
-        Decode_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
-        Decode_vkCmdTraceRaysIndirectKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupStackSizeKHR:
-        Decode_vkGetRayTracingShaderGroupStackSizeKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR:
-        Decode_vkCmdSetRayTracingPipelineStackSizeKHR(parameter_buffer, buffer_size);
-        break;
     }
 }
 
@@ -40,7 +40,7 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class VulkanDecoder : public VulkanDecoderBase
 {
   public:
-    VulkanDecoder() { }
+    VulkanDecoder() : decode_functions_(GetDecodeFunctions()) { }
 
     virtual ~VulkanDecoder() override { }
 
@@ -49,6 +49,16 @@ class VulkanDecoder : public VulkanDecoderBase
                                     const uint8_t*                parameter_buffer,
                                     size_t                        buffer_size) override;
 
+  private:
+    typedef size_t (VulkanDecoder::*DecodeFunction)(const uint8_t* parameter_buffer, size_t buffer_size);
+
+    static const uint32_t kFirstDecodeFunction = format::ApiCallId::ApiCall_vkCreateInstance;
+    static const uint32_t kDecodeFunctionCount = format::ApiCallId::ApiCall_VulkanLast - kFirstDecodeFunction;
+
+    // Returns a table of decode functions indexed by (call_id - kFirstDecodeFunction), with null entries for the API
+    // calls that are decoded by VulkanDecoderBase.
+    static const DecodeFunction* GetDecodeFunctions();
+
   private:
     size_t Decode_vkCreateInstance(const uint8_t* parameter_buffer, size_t buffer_size);
 
@@ -967,6 +977,9 @@ class VulkanDecoder : public VulkanDecoderBase
     size_t Decode_vkGetRayTracingShaderGroupStackSizeKHR(const uint8_t* parameter_buffer, size_t buffer_size);
 
     size_t Decode_vkCmdSetRayTracingPipelineStackSizeKHR(const uint8_t* parameter_buffer, size_t buffer_size);
+
+  private:
+    const DecodeFunction* decode_functions_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -34,10 +34,17 @@
 #include "vulkan/vulkan.h"
 
 #include <cstdint>
+#include <type_traits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Identifies decoded struct types with an encoded layout that matches the host layout of the Vulkan struct, which
+// allows arrays of the struct to be decoded with a single copy of the encoded data.
+template <typename T>
+struct IsLayoutCompatible : std::false_type
+{};
+
 struct Decoded_VkExtent2D;
 struct Decoded_VkExtent3D;
 struct Decoded_VkOffset2D;
@@ -1582,6 +1589,202 @@ struct Decoded_VkPhysicalDeviceRayQueryFeaturesKHR;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceRayQueryFeaturesKHR* wrapper);
 
+template <>
+struct IsLayoutCompatible<Decoded_VkExtent2D> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkExtent3D> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkOffset2D> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkOffset3D> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkRect2D> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDispatchIndirectCommand> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDrawIndexedIndirectCommand> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDrawIndirectCommand> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkImageSubresourceRange> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkFormatProperties> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkImageFormatProperties> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkMemoryType> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkPhysicalDeviceFeatures> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkPhysicalDeviceSparseProperties> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkQueueFamilyProperties> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkImageSubresource> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSparseImageFormatProperties> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSparseImageMemoryRequirements> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSubresourceLayout> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkComponentMapping> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkVertexInputBindingDescription> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkVertexInputAttributeDescription> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkViewport> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkStencilOpState> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkPipelineColorBlendAttachmentState> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkPushConstantRange> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDescriptorPoolSize> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkAttachmentDescription> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkAttachmentReference> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSubpassDependency> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkBufferCopy> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkImageSubresourceLayers> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkBufferImageCopy> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkClearDepthStencilValue> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkClearRect> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkImageCopy> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkImageResolve> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkInputAttachmentAspectReference> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkExternalMemoryProperties> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkConformanceVersion> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSurfaceCapabilitiesKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSurfaceFormatKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDisplayModeParametersKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDisplayPlaneCapabilitiesKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkRectLayerKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkViewportWScalingNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkRefreshCycleDurationGOOGLE> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkViewportSwizzleNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkXYColorEXT> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSampleLocationEXT> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDrmFormatModifierPropertiesEXT> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkCoarseSampleLocationNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkAabbPositionsKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkVertexInputBindingDivisorDescriptionEXT> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkDrawMeshTasksIndirectCommandNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkBindShaderGroupIndirectCommandNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkBindIndexBufferIndirectCommandNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkBindVertexBufferIndirectCommandNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSetStateFlagsIndirectCommandNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkSRTDataNV> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkMultiDrawInfoEXT> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkMultiDrawIndexedInfoEXT> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkAccelerationStructureBuildRangeInfoKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkStridedDeviceAddressRegionKHR> : std::true_type
+{};
+template <>
+struct IsLayoutCompatible<Decoded_VkTraceRaysIndirectCommandKHR> : std::true_type
+{};
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
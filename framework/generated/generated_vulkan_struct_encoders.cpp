@@ -668,7 +668,7 @@ void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleCreateInfo& val
     EncodePNextStruct(encoder, value.pNext);
     encoder->EncodeFlagsValue(value.flags);
     encoder->EncodeSizeTValue(value.codeSize);
-    encoder->EncodeUInt32Array(value.pCode, value.codeSize / 4);
+    encoder->EncodeUInt32BlobArray(value.pCode, value.codeSize / 4);
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCacheCreateInfo& value)
@@ -677,7 +677,7 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCacheCreateInfo& va
     EncodePNextStruct(encoder, value.pNext);
     encoder->EncodeFlagsValue(value.flags);
     encoder->EncodeSizeTValue(value.initialDataSize);
-    encoder->EncodeVoidArray(value.pInitialData, value.initialDataSize);
+    encoder->EncodeVoidBlobArray(value.pInitialData, value.initialDataSize);
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSpecializationMapEntry& value)
@@ -146,6 +146,44 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassBeginInfo& value);
 
+template <> struct IsLayoutEncodable<VkExtent2D> : std::true_type {};
+template <> struct IsLayoutEncodable<VkExtent3D> : std::true_type {};
+template <> struct IsLayoutEncodable<VkOffset2D> : std::true_type {};
+template <> struct IsLayoutEncodable<VkOffset3D> : std::true_type {};
+template <> struct IsLayoutEncodable<VkRect2D> : std::true_type {};
+template <> struct IsLayoutEncodable<VkDispatchIndirectCommand> : std::true_type {};
+template <> struct IsLayoutEncodable<VkDrawIndexedIndirectCommand> : std::true_type {};
+template <> struct IsLayoutEncodable<VkDrawIndirectCommand> : std::true_type {};
+template <> struct IsLayoutEncodable<VkImageSubresourceRange> : std::true_type {};
+template <> struct IsLayoutEncodable<VkFormatProperties> : std::true_type {};
+template <> struct IsLayoutEncodable<VkImageFormatProperties> : std::true_type {};
+template <> struct IsLayoutEncodable<VkMemoryType> : std::true_type {};
+template <> struct IsLayoutEncodable<VkPhysicalDeviceFeatures> : std::true_type {};
+template <> struct IsLayoutEncodable<VkPhysicalDeviceSparseProperties> : std::true_type {};
+template <> struct IsLayoutEncodable<VkQueueFamilyProperties> : std::true_type {};
+template <> struct IsLayoutEncodable<VkImageSubresource> : std::true_type {};
+template <> struct IsLayoutEncodable<VkSparseImageFormatProperties> : std::true_type {};
+template <> struct IsLayoutEncodable<VkSparseImageMemoryRequirements> : std::true_type {};
+template <> struct IsLayoutEncodable<VkSubresourceLayout> : std::true_type {};
+template <> struct IsLayoutEncodable<VkComponentMapping> : std::true_type {};
+template <> struct IsLayoutEncodable<VkVertexInputBindingDescription> : std::true_type {};
+template <> struct IsLayoutEncodable<VkVertexInputAttributeDescription> : std::true_type {};
+template <> struct IsLayoutEncodable<VkViewport> : std::true_type {};
+template <> struct IsLayoutEncodable<VkStencilOpState> : std::true_type {};
+template <> struct IsLayoutEncodable<VkPipelineColorBlendAttachmentState> : std::true_type {};
+template <> struct IsLayoutEncodable<VkPushConstantRange> : std::true_type {};
+template <> struct IsLayoutEncodable<VkDescriptorPoolSize> : std::true_type {};
+template <> struct IsLayoutEncodable<VkAttachmentDescription> : std::true_type {};
+template <> struct IsLayoutEncodable<VkAttachmentReference> : std::true_type {};
+template <> struct IsLayoutEncodable<VkSubpassDependency> : std::true_type {};
+template <> struct IsLayoutEncodable<VkBufferCopy> : std::true_type {};
+template <> struct IsLayoutEncodable<VkImageSubresourceLayers> : std::true_type {};
+template <> struct IsLayoutEncodable<VkBufferImageCopy> : std::true_type {};
+template <> struct IsLayoutEncodable<VkClearDepthStencilValue> : std::true_type {};
+template <> struct IsLayoutEncodable<VkClearRect> : std::true_type {};
+template <> struct IsLayoutEncodable<VkImageCopy> : std::true_type {};
+template <> struct IsLayoutEncodable<VkImageResolve> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupProperties& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkBindBufferMemoryInfo& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemoryInfo& value);
@@ -215,6 +253,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMaintenance3P
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutSupport& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDrawParametersFeatures& value);
 
+template <> struct IsLayoutEncodable<VkInputAttachmentAspectReference> : std::true_type {};
+template <> struct IsLayoutEncodable<VkExternalMemoryProperties> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Features& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Properties& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan12Features& value);
@@ -267,9 +308,14 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferOpaqueCaptureAddressC
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryOpaqueCaptureAddressAllocateInfo& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryOpaqueCaptureAddressInfo& value);
 
+template <> struct IsLayoutEncodable<VkConformanceVersion> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormatKHR& value);
 
+template <> struct IsLayoutEncodable<VkSurfaceCapabilitiesKHR> : std::true_type {};
+template <> struct IsLayoutEncodable<VkSurfaceFormatKHR> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSwapchainCreateInfoKHR& value);
@@ -287,6 +333,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlanePropertiesKHR&
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPropertiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplaySurfaceCreateInfoKHR& value);
 
+template <> struct IsLayoutEncodable<VkDisplayModeParametersKHR> : std::true_type {};
+template <> struct IsLayoutEncodable<VkDisplayPlaneCapabilitiesKHR> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPresentInfoKHR& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkXlibSurfaceCreateInfoKHR& value);
@@ -324,6 +373,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRectLayerKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionsKHR& value);
 
+template <> struct IsLayoutEncodable<VkRectLayerKHR> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSharedPresentSurfaceCapabilitiesKHR& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceWin32HandleInfoKHR& value);
@@ -458,6 +509,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceCon
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportWScalingNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportWScalingStateCreateInfoNV& value);
 
+template <> struct IsLayoutEncodable<VkViewportWScalingNV> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2EXT& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPowerInfoEXT& value);
@@ -470,11 +523,15 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPastPresentationTimingGOOGL
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimeGOOGLE& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimesInfoGOOGLE& value);
 
+template <> struct IsLayoutEncodable<VkRefreshCycleDurationGOOGLE> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportSwizzleNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportSwizzleStateCreateInfoNV& value);
 
+template <> struct IsLayoutEncodable<VkViewportSwizzleNV> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiscardRectanglePropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDiscardRectangleStateCreateInfoEXT& value);
 
@@ -487,6 +544,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationDepthC
 void EncodeStruct(ParameterEncoder* encoder, const VkXYColorEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkHdrMetadataEXT& value);
 
+template <> struct IsLayoutEncodable<VkXYColorEXT> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkIOSSurfaceCreateInfoMVK& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkMacOSSurfaceCreateInfoMVK& value);
@@ -518,6 +577,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineSampleLocationsStat
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSampleLocationsPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMultisamplePropertiesEXT& value);
 
+template <> struct IsLayoutEncodable<VkSampleLocationEXT> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAdvancedStateCreateInfoEXT& value);
@@ -536,6 +597,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierListC
 void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierExplicitCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierPropertiesEXT& value);
 
+template <> struct IsLayoutEncodable<VkDrmFormatModifierPropertiesEXT> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationCacheCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleValidationCacheCreateInfoEXT& value);
 
@@ -547,6 +610,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleLocationNV& val
 void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleOrderCustomNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& value);
 
+template <> struct IsLayoutEncodable<VkCoarseSampleLocationNV> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkGeometryTrianglesNV& value);
@@ -563,6 +628,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkTransformMatrixKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAabbPositionsKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInstanceKHR& value);
 
+template <> struct IsLayoutEncodable<VkAabbPositionsKHR> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& value);
 
@@ -588,6 +655,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDivisorDe
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputDivisorStateCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& value);
 
+template <> struct IsLayoutEncodable<VkVertexInputBindingDivisorDescriptionEXT> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentFrameTokenGGP& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCreationFeedbackEXT& value);
@@ -599,6 +668,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderFea
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandNV& value);
 
+template <> struct IsLayoutEncodable<VkDrawMeshTasksIndirectCommandNV> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageFootprintFeaturesNV& value);
@@ -703,6 +774,11 @@ void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsLayoutCreat
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsMemoryRequirementsInfoNV& value);
 
+template <> struct IsLayoutEncodable<VkBindShaderGroupIndirectCommandNV> : std::true_type {};
+template <> struct IsLayoutEncodable<VkBindIndexBufferIndirectCommandNV> : std::true_type {};
+template <> struct IsLayoutEncodable<VkBindVertexBufferIndirectCommandNV> : std::true_type {};
+template <> struct IsLayoutEncodable<VkSetStateFlagsIndirectCommandNV> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInheritedViewportScissorFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceViewportScissorInfoNV& value);
 
@@ -743,6 +819,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSRTDataNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureSRTMotionInstanceNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& value);
 
+template <> struct IsLayoutEncodable<VkSRTDataNV> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& value);
@@ -788,6 +866,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiDrawProp
 void EncodeStruct(ParameterEncoder* encoder, const VkMultiDrawInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMultiDrawIndexedInfoEXT& value);
 
+template <> struct IsLayoutEncodable<VkMultiDrawInfoEXT> : std::true_type {};
+template <> struct IsLayoutEncodable<VkMultiDrawIndexedInfoEXT> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildRangeInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryTrianglesDataKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryAabbsDataKHR& value);
@@ -804,6 +885,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyMemoryToAccelerationStr
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyAccelerationStructureInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildSizesInfoKHR& value);
 
+template <> struct IsLayoutEncodable<VkAccelerationStructureBuildRangeInfoKHR> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineInterfaceCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoKHR& value);
@@ -812,6 +895,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPip
 void EncodeStruct(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR& value);
 
+template <> struct IsLayoutEncodable<VkStridedDeviceAddressRegionKHR> : std::true_type {};
+template <> struct IsLayoutEncodable<VkTraceRaysIndirectCommandKHR> : std::true_type {};
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayQueryFeaturesKHR& value);
 
 GFXRECON_END_NAMESPACE(encode)
@@ -378,6 +378,11 @@ T* MakeUnwrapStructs(const T* values, size_t len, HandleUnwrapMemory* unwrap_mem
 template <typename T>
 const T* UnwrapStructPtrHandles(const T* value, HandleUnwrapMemory* unwrap_memory)
 {
+    if (HandleSideTables::IsEnabled())
+    {
+        return value;
+    }
+
     T* unwrapped_struct = nullptr;
 
     if (value != nullptr)
@@ -392,7 +397,7 @@ const T* UnwrapStructPtrHandles(const T* value, HandleUnwrapMemory* unwrap_memor
 template <typename T>
 const T* UnwrapStructArrayHandles(const T* values, size_t len, HandleUnwrapMemory* unwrap_memory)
 {
-    if ((values != nullptr) && (len > 0))
+    if ((values != nullptr) && (len > 0) && !HandleSideTables::IsEnabled())
     {
         auto unwrapped_structs = MakeUnwrapStructs(values, len, unwrap_memory);
 
@@ -404,7 +409,8 @@ const T* UnwrapStructArrayHandles(const T* values, size_t len, HandleUnwrapMemor
         return unwrapped_structs;
     }
 
-    // Leave the original memory in place when the pointer is not null, but size is zero.
+    // Leave the original memory in place when the pointer is not null, but size is zero, or when the handles are not
+    // wrapped.
     return values;
 }
 
@@ -53,14 +53,27 @@ class DecodePNextStructGenerator(BaseGenerator):
         # Map to store VkStructureType enum values.
         self.sTypeValues = dict()
 
+        # Maps of struct names to the encoded size of structs that contain only fixed size members, with separate maps
+        # for structs with and without a pNext member.  The pNext struct sizes exclude the sType and pNext members.
+        # Preserved across features so that structs can reference structs from earlier features.
+        self.fixedEncodedSizes = dict()
+        self.pNextFixedEncodedSizes = dict()
+
+        # Encoded sizes of the scalar types, from the format::*EncodeType definitions.
+        self.scalarEncodedSizes = { 'float' : 4, 'int' : 4, 'int32_t' : 4, 'uint32_t' : 4, 'VkBool32' : 4,
+                                    'VkSampleMask' : 4, 'int64_t' : 8, 'uint64_t' : 8, 'VkDeviceSize' : 8,
+                                    'VkDeviceAddress' : 8, 'size_t' : 8, 'uint16_t' : 2, 'uint8_t' : 1 }
+
     # Method override
     def beginFile(self, genOpts):
         BaseGenerator.beginFile(self, genOpts)
 
         write('#include "decode/custom_vulkan_struct_decoders.h"', file=self.outFile)
         write('#include "decode/decode_allocator.h"', file=self.outFile)
+        write('#include "decode/pnext_lazy_node.h"', file=self.outFile)
         write('#include "decode/pnext_node.h"', file=self.outFile)
         write('#include "decode/pnext_typed_node.h"', file=self.outFile)
+        write('#include "decode/value_decoder.h"', file=self.outFile)
         write('#include "generated/generated_vulkan_struct_decoders.h"', file=self.outFile)
         write('#include "util/logging.h"', file=self.outFile)
         self.newline()
@@ -75,6 +88,8 @@ class DecodePNextStructGenerator(BaseGenerator):
         self.newline()
         write('    size_t bytes_read = 0;', file=self.outFile)
         write('    uint32_t attrib = 0;', file=self.outFile)
+        write('    // The encoded sizes of the lazily decoded structs count handle IDs with their fixed size encoding.', file=self.outFile)
+        write('    bool lazy_decoding = PNextNode::IsLazyDecodingEnabled() && !ValueDecoder::IsVarintHandleIds();', file=self.outFile)
         self.newline()
         write('    if ((parameter_buffer != nullptr) && (buffer_size >= sizeof(attrib)))', file=self.outFile)
         write('    {', file=self.outFile)
@@ -130,6 +145,14 @@ class DecodePNextStructGenerator(BaseGenerator):
     # Method override
     def genStruct(self, typeinfo, typename, alias):
         if not alias:
+            values = self.makeValueInfo(typeinfo.elem.findall('.//member'))
+            size = self.getFixedEncodedSize(values)
+            if size is not None:
+                if [value for value in values if value.name == 'pNext']:
+                    self.pNextFixedEncodedSizes[typename] = size
+                else:
+                    self.fixedEncodedSizes[typename] = size
+
             # Only process struct types that specify a 'structextends' tag, which indicates the struct can be used in a pNext chain.
             parentStructs = typeinfo.elem.get('structextends')
             if parentStructs:
@@ -149,7 +172,48 @@ class DecodePNextStructGenerator(BaseGenerator):
     def generateFeature(self):
         for struct in self.sTypeValues:
             write('            case {}:'.format(self.sTypeValues[struct]), file=self.outFile)
-            write('                (*pNext) = DecodeAllocator::Allocate<PNextTypedNode<Decoded_{}>>();'.format(struct), file=self.outFile)
+            if struct in self.pNextFixedEncodedSizes:
+                # The encoded size of the struct can be determined without decoding it, so decoding may be deferred.
+                write('                if (lazy_decoding)', file=self.outFile)
+                write('                {', file=self.outFile)
+                write('                    (*pNext) = DecodeAllocator::Allocate<PNextLazyNode<Decoded_{}, {}>>();'.format(struct, self.pNextFixedEncodedSizes[struct]), file=self.outFile)
+                write('                }', file=self.outFile)
+                write('                else', file=self.outFile)
+                write('                {', file=self.outFile)
+                write('                    (*pNext) = DecodeAllocator::Allocate<PNextTypedNode<Decoded_{}>>();'.format(struct), file=self.outFile)
+                write('                }', file=self.outFile)
+            else:
+                write('                (*pNext) = DecodeAllocator::Allocate<PNextTypedNode<Decoded_{}>>();'.format(struct), file=self.outFile)
             write('                bytes_read = (*pNext)->Decode(parameter_buffer, buffer_size);'.format(struct), file=self.outFile)
             write('                break;', file=self.outFile)
         self.sTypeValues = dict()
+
+    #
+    # Determines the encoded size of a struct with members that are all encoded with a fixed size, which excludes
+    # pointers, arrays, unions, and bitfields.  The sType and pNext members are not included in the size, as the pNext
+    # chain is decoded separately.  Returns None for structs with variable size members.  Handle IDs are counted with
+    # their fixed size encoding, so the sizes do not apply to files that encode handle IDs as varints.
+    def getFixedEncodedSize(self, values):
+        size = 0
+
+        for value in values:
+            if value.name in ['sType', 'pNext']:
+                continue
+
+            if value.isPointer or value.isArray or value.bitfieldWidth or value.platformBaseType:
+                return None
+
+            if value.baseType in self.fixedEncodedSizes:
+                size += self.fixedEncodedSizes[value.baseType]
+            elif self.isHandle(value.baseType):
+                size += 8
+            elif self.isEnum(value.baseType):
+                size += 4
+            elif self.isFlags(value.baseType):
+                size += 8 if self.flagsTypes[value.baseType] == 'VkFlags64' else 4
+            elif value.baseType in self.scalarEncodedSizes:
+                size += self.scalarEncodedSizes[value.baseType]
+            else:
+                return None
+
+        return size
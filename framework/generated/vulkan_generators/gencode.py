@@ -97,6 +97,7 @@ defaultBlacklists = 'blacklists.json'
 defaultPlatformTypes = 'platform_types.json'
 defaultReplayOverrides = 'replay_overrides.json'
 defaultCaptureOverrides = 'capture_overrides.json'
+defaultCompactStructs = 'compact_structs.json'
 
 # Returns a directory of [ generator function, generator options ] indexed
 # by specified short names. The generator options incorporate the following
@@ -115,6 +116,7 @@ def makeGenOpts(args):
     platformTypes = os.path.join(args.configs, defaultPlatformTypes)
     replayOverrides = os.path.join(args.configs, defaultReplayOverrides)
     captureOverrides = os.path.join(args.configs, defaultCaptureOverrides)
+    compactStructs = os.path.join(args.configs, defaultCompactStructs)
 
     # Copyright text prefixing all headers (list of strings).
     prefixStrings = [
@@ -185,6 +187,7 @@ def makeGenOpts(args):
           VulkanStructDecodersBodyGeneratorOptions(
             filename          = 'generated_vulkan_struct_decoders.cpp',
             directory         = directory,
+            compactStructs    = compactStructs,
             blacklists        = blacklists,
             platformTypes     = platformTypes,
             prefixText        = prefixStrings + vkPrefixStrings,
@@ -101,5 +101,5 @@ class VulkanAsciiConsumerBodyGenerator(BaseGenerator):
     #
     # Return VulkanAsciiConsumer class member function definition.
     def makeConsumerFuncBody(self, returnType, name, values):
-        body = '    fprintf(GetFile(), "%s\\n", "' + name + '");\n'
+        body = '    WriteLine("' + name + '");\n'
         return body
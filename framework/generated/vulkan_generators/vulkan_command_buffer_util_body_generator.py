@@ -177,7 +177,7 @@ class VulkanCommandBufferUtilBodyGenerator(BaseGenerator):
             elif value.isPointer:
                 valueName = '(*{})'.format(valueName)
 
-            body += indent + 'wrapper->command_handles[CommandHandleType::{}].insert(GetWrappedId({}));\n'.format(typeEnumValue, valueName)
+            body += indent + 'wrapper->command_handles[CommandHandleType::{}].push_back(GetWrappedId({}));\n'.format(typeEnumValue, valueName)
 
         elif self.isStruct(value.baseType) and (value.baseType in self.structsWithHandles):
             if value.isArray:
@@ -71,6 +71,7 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
         self.newline()
         write('#include "vulkan/vulkan.h"', file=self.outFile)
         self.newline()
+        write('#include <array>', file=self.outFile)
         write('#include <cstddef>', file=self.outFile)
         self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
@@ -79,7 +80,10 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
     # Method override
     def endFile(self):
         self.newline()
-        # Generate the VulkanDecoder::DecodeFunctionCall method for all of the commands processed by the generator.
+        # Generate the VulkanDecoder decode function table and DecodeFunctionCall method for all of the commands processed
+        # by the generator.
+        self.generateDecodeTable()
+        self.newline()
         self.generateDecodeCases()
         self.newline()
         write('GFXRECON_END_NAMESPACE(decode)', file=self.outFile)
@@ -156,10 +160,12 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
         if returnType and returnType != 'void':
             arglist = ', '.join(['return_value', arglist])
 
-        body += '    for (auto consumer : GetConsumers())\n'
-        body += '    {\n'
+        # The parameter decoders are captured by value, so that the call can be recorded for later execution.
+        # Command buffer recording calls may be executed concurrently with the calls of other captured threads.
+        dispatch = 'DispatchCommandBufferCall' if name.startswith('vkCmd') else 'DispatchCall'
+        body += '    {}([=](VulkanConsumer* consumer) mutable {{\n'.format(dispatch)
         body += '        consumer->Process_{}({});\n'.format(name, arglist)
-        body += '    }\n'
+        body += '    });\n'
 
         return body
 
@@ -211,6 +217,27 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
 
         return body
 
+    #
+    # Generate the VulkanDecoder::GetDecodeFunctions method.
+    def generateDecodeTable(self):
+        write('const VulkanDecoder::DecodeFunction* VulkanDecoder::GetDecodeFunctions()', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    static const std::array<DecodeFunction, kDecodeFunctionCount> decode_functions = []() {', file=self.outFile)
+        write('        std::array<DecodeFunction, kDecodeFunctionCount> functions{};', file=self.outFile)
+        write('', file=self.outFile)
+
+        for cmd in self.cmdNames:
+            cmddef = '        functions[format::ApiCallId::ApiCall_{} - kFirstDecodeFunction] =\n'.format(cmd)
+            cmddef += '            &VulkanDecoder::Decode_{};'.format(cmd)
+            write(cmddef, file=self.outFile)
+
+        write('', file=self.outFile)
+        write('        return functions;', file=self.outFile)
+        write('    }();', file=self.outFile)
+        write('', file=self.outFile)
+        write('    return decode_functions.data();', file=self.outFile)
+        write('}', file=self.outFile)
+
     #
     # Generate the VulkanDecoder::DecodeFunctionCall method.
     def generateDecodeCases(self):
@@ -219,17 +246,32 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
         write('                                       const uint8_t*                parameter_buffer,', file=self.outFile)
         write('                                       size_t                        buffer_size)', file=self.outFile)
         write('{', file=self.outFile)
-        write('    switch(call_id)', file=self.outFile)
+        write('    // Call IDs that precede the Vulkan range wrap around to large values, failing the table size check.', file=self.outFile)
+        write('    uint32_t index = call_id - kFirstDecodeFunction;', file=self.outFile)
+        write('', file=self.outFile)
+        write('    if (IsFastForwarding() && SkipFastForwardCall(call_id, parameter_buffer, buffer_size))', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        return;', file=self.outFile)
+        write('    }', file=self.outFile)
+        write('', file=self.outFile)
+        write('    if (IsReusingCommandBuffers() && SkipReusedCommandBufferCall(call_id, call_info, parameter_buffer, buffer_size))', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        return;', file=self.outFile)
+        write('    }', file=self.outFile)
+        write('', file=self.outFile)
+        write('    BeginCallProfile(call_id);', file=self.outFile)
+        write('', file=self.outFile)
+        write('    if ((index < kDecodeFunctionCount) && (decode_functions_[index] != nullptr))', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        size_t bytes_read = (this->*decode_functions_[index])(parameter_buffer, buffer_size);', file=self.outFile)
+        write('', file=self.outFile)
+        write('        if (IsValidatingCallSizes() && (bytes_read != buffer_size))', file=self.outFile)
+        write('        {', file=self.outFile)
+        write('            ReportInvalidCallSize(call_id, bytes_read, buffer_size);', file=self.outFile)
+        write('        }', file=self.outFile)
+        write('    }', file=self.outFile)
+        write('    else', file=self.outFile)
         write('    {', file=self.outFile)
-        write('    default:', file=self.outFile)
         write('        VulkanDecoderBase::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);', file=self.outFile)
-        write('        break;', file=self.outFile)
-
-        for cmd in self.cmdNames:
-            cmddef = '    case format::ApiCallId::ApiCall_{}:\n'.format(cmd)
-            cmddef += '        Decode_{}(parameter_buffer, buffer_size);\n'.format(cmd)
-            cmddef += '        break;'
-            write(cmddef, file=self.outFile)
-
         write('    }', file=self.outFile)
         write('}\n', file=self.outFile)
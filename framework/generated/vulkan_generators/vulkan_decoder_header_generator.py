@@ -66,16 +66,26 @@ class VulkanDecoderHeaderGenerator(BaseGenerator):
         write('class VulkanDecoder : public VulkanDecoderBase', file=self.outFile)
         write('{', file=self.outFile)
         write('  public:', file=self.outFile)
-        write('    VulkanDecoder() { }\n', file=self.outFile)
+        write('    VulkanDecoder() : decode_functions_(GetDecodeFunctions()) { }\n', file=self.outFile)
         write('    virtual ~VulkanDecoder() override { }\n', file=self.outFile)
         write('    virtual void DecodeFunctionCall(format::ApiCallId             call_id,', file=self.outFile)
         write('                                    const ApiCallInfo&            call_info,', file=self.outFile)
         write('                                    const uint8_t*                parameter_buffer,', file=self.outFile)
         write('                                    size_t                        buffer_size) override;\n', file=self.outFile)
+        write('  private:', file=self.outFile)
+        write('    typedef size_t (VulkanDecoder::*DecodeFunction)(const uint8_t* parameter_buffer, size_t buffer_size);\n', file=self.outFile)
+        write('    static const uint32_t kFirstDecodeFunction = format::ApiCallId::ApiCall_vkCreateInstance;', file=self.outFile)
+        write('    static const uint32_t kDecodeFunctionCount = format::ApiCallId::ApiCall_VulkanLast - kFirstDecodeFunction;\n', file=self.outFile)
+        write('    // Returns a table of decode functions indexed by (call_id - kFirstDecodeFunction), with null entries for the API', file=self.outFile)
+        write('    // calls that are decoded by VulkanDecoderBase.', file=self.outFile)
+        write('    static const DecodeFunction* GetDecodeFunctions();\n', file=self.outFile)
         write('  private:', end='', file=self.outFile)
 
     # Method override
     def endFile(self):
+        self.newline()
+        write('  private:', file=self.outFile)
+        write('    const DecodeFunction* decode_functions_;', file=self.outFile)
         write('};', file=self.outFile)
         self.newline()
         write('GFXRECON_END_NAMESPACE(decode)', file=self.outFile)
@@ -177,7 +177,7 @@ class VulkanReplayConsumerBodyGenerator(BaseGenerator):
         if isOverride:
             if name in ['vkCreateInstance', 'vkCreateDevice']:
                 callExpr = '{}(returnValue, {})'.format(self.REPLAY_OVERRIDES[name], arglist)
-            elif returnType == 'VkResult':
+            elif returnType in ['VkResult', 'VkDeviceAddress']:
                 # Override functions receive the decoded return value in addition to parameters.
                 callExpr = '{}({}, returnValue, {})'.format(self.REPLAY_OVERRIDES[name], dispatchfunc, arglist)
             else:
@@ -255,6 +255,12 @@ class VulkanReplayConsumerBodyGenerator(BaseGenerator):
         preexpr = []    # Variable declarations for handle mappings, temporary output allocations, and input pointers.
         postexpr = []   # Expressions to add new handles to the handle map and delete temporary allocations.
 
+        # Commands that are recorded to command buffers map the other handles that they reference through the command
+        # buffer's cache of recently referenced object infos.
+        commandInfoCache = None
+        if name.startswith('vkCmd') and values[0].baseType == 'VkCommandBuffer' and any(self.isHandle(value.baseType) for value in values[1:]):
+            commandInfoCache = 'in_commandBuffer' if isOverride else 'in_commandBuffer_info'
+
         for value in values:
             if value.isPointer or value.isArray:
                 fullType = value.fullType if not value.platformFullType else value.platformFullType
@@ -331,7 +337,10 @@ class VulkanReplayConsumerBodyGenerator(BaseGenerator):
                             expr += 'GetAllocationCallbacks({});'.format(value.name)
                     elif self.isHandle(value.baseType):
                         # We received an array of 64-bit integer IDs from the decoder.
-                        expr += 'MapHandles<{type}Info>({}, {}, &VulkanObjectInfoTable::Get{type}Info);'.format(value.name, lengthName, type=value.baseType[2:])
+                        if commandInfoCache:
+                            expr += 'MapCommandHandles<{type}Info>({}, {}, {}, &VulkanObjectInfoTable::Get{type}Info);'.format(commandInfoCache, value.name, lengthName, type=value.baseType[2:])
+                        else:
+                            expr += 'MapHandles<{type}Info>({}, {}, &VulkanObjectInfoTable::Get{type}Info);'.format(value.name, lengthName, type=value.baseType[2:])
                     else:
                         if needTempValue:
                             expr += '{}->GetPointer();'.format(value.name)
@@ -365,12 +374,12 @@ class VulkanReplayConsumerBodyGenerator(BaseGenerator):
                                 else:
                                     postexpr.append('AddHandles<{basetype}Info>({}, {paramname}->GetPointer(), {paramname}->GetLength(), {}, {}, &VulkanObjectInfoTable::Add{basetype}Info);'.format(self.getParentId(value, values), argName, lengthName, paramname=value.name, basetype=value.baseType[2:]))
                             else:
-                                preexpr.append('std::vector<{}Info> handle_info({});'.format(value.baseType[2:], lengthName))
+                                preexpr.append('{}Info* handle_info = DecodeAllocator::Allocate<{}Info>({});'.format(value.baseType[2:], value.baseType[2:], lengthName))
                                 expr = 'for (size_t i = 0; i < {}; ++i) {{ {}->SetConsumerData(i, &handle_info[i]); }}'.format(lengthName, value.name);
                                 if self.isPoolAllocation(name):
-                                    postexpr.append('AddPoolHandles<{pooltype}Info, {basetype}Info>({}, handle_mapping::GetPoolId({}->GetMetaStructPointer()), {paramname}->GetPointer(), {paramname}->GetLength(), {paramname}->GetHandlePointer(), {}, std::move(handle_info), &VulkanObjectInfoTable::Get{pooltype}Info, &VulkanObjectInfoTable::Add{basetype}Info);'.format(self.getParentId(value, values), values[1].name, lengthName, paramname=value.name, basetype=value.baseType[2:], pooltype=self.POOL_OBJECT_ASSOCIATIONS[value.baseType][2:]))
+                                    postexpr.append('AddPoolHandles<{pooltype}Info, {basetype}Info>({}, handle_mapping::GetPoolId({}->GetMetaStructPointer()), {paramname}->GetPointer(), {paramname}->GetLength(), {paramname}->GetHandlePointer(), {}, handle_info, &VulkanObjectInfoTable::Get{pooltype}Info, &VulkanObjectInfoTable::Add{basetype}Info);'.format(self.getParentId(value, values), values[1].name, lengthName, paramname=value.name, basetype=value.baseType[2:], pooltype=self.POOL_OBJECT_ASSOCIATIONS[value.baseType][2:]))
                                 else:
-                                    postexpr.append('AddHandles<{basetype}Info>({}, {paramname}->GetPointer(), {paramname}->GetLength(), {paramname}->GetHandlePointer(), {}, std::move(handle_info), &VulkanObjectInfoTable::Add{basetype}Info);'.format(self.getParentId(value, values), lengthName, paramname=value.name, basetype=value.baseType[2:]))
+                                    postexpr.append('AddHandles<{basetype}Info>({}, {paramname}->GetPointer(), {paramname}->GetLength(), {paramname}->GetHandlePointer(), {}, handle_info, &VulkanObjectInfoTable::Add{basetype}Info);'.format(self.getParentId(value, values), lengthName, paramname=value.name, basetype=value.baseType[2:]))
 
                         elif self.isStruct(value.baseType):
                             # Generate the expression to allocate the output array.
@@ -458,11 +467,20 @@ class VulkanReplayConsumerBodyGenerator(BaseGenerator):
                 args.append(argName)
                 if isOverride:
                     # We use auto in case the compiler can determine if the value should be const or non-const based on the override function signature.
-                    expr = 'auto {} = GetObjectInfoTable().Get{}Info({});'.format(argName, value.baseType[2:], value.name)
+                    if commandInfoCache and (value is not values[0]):
+                        expr = 'auto {} = GetCommandObjectInfo<{type}Info>({}, {}, &VulkanObjectInfoTable::Get{type}Info);'.format(argName, commandInfoCache, value.name, type=value.baseType[2:])
+                    else:
+                        expr = 'auto {} = GetObjectInfoTable().Get{}Info({});'.format(argName, value.baseType[2:], value.name)
                     preexpr.append(expr)
                 else:
                     expr = '{} {} = '.format(value.fullType, argName)
-                    expr += 'MapHandle<{type}Info>({}, &VulkanObjectInfoTable::Get{type}Info);'.format(value.name, type=value.baseType[2:])
+                    if commandInfoCache and (value is values[0]):
+                        preexpr.append('CommandBufferInfo* {} = GetObjectInfoTable().GetCommandBufferInfo({});'.format(commandInfoCache, value.name))
+                        expr += 'MapHandle<CommandBufferInfo>({}, {});'.format(value.name, commandInfoCache)
+                    elif commandInfoCache:
+                        expr += 'MapCommandHandle<{type}Info>({}, {}, &VulkanObjectInfoTable::Get{type}Info);'.format(commandInfoCache, value.name, type=value.baseType[2:])
+                    else:
+                        expr += 'MapHandle<{type}Info>({}, &VulkanObjectInfoTable::Get{type}Info);'.format(value.name, type=value.baseType[2:])
                     preexpr.append(expr)
 
                     # If surface was not created, need to automatically ignore for non-overrides queries
@@ -27,6 +27,7 @@ from base_generator import *
 class VulkanStructDecodersBodyGeneratorOptions(BaseGeneratorOptions):
     """Options for generating C++ functions for Vulkan struct decoding"""
     def __init__(self,
+                 compactStructs = None,     # Path to JSON file configuring table driven decoding of cold structs.
                  blacklists = None,         # Path to JSON file listing apicalls and structs to ignore.
                  platformTypes = None,      # Path to JSON file listing platform (WIN32, X11, etc.) defined types.
                  filename = None,
@@ -37,11 +38,34 @@ class VulkanStructDecodersBodyGeneratorOptions(BaseGeneratorOptions):
         BaseGeneratorOptions.__init__(self, blacklists, platformTypes,
                                       filename, directory, prefixText,
                                       protectFile, protectFeature)
+        self.compactStructs = compactStructs
 
 # VulkanStructDecodersBodyGenerator - subclass of BaseGenerator.
 # Generates C++ functions for decoding Vulkan API structures.
 class VulkanStructDecodersBodyGenerator(BaseGenerator):
     """Generate C++ functions for Vulkan struct decoding"""
+
+    # Field types of the compact decoding tables for the encoded type names of struct members.
+    COMPACT_FIELD_TYPES = {
+        'UInt8'           : 'kUInt8',
+        'UInt16'          : 'kUInt16',
+        'Int32'           : 'kInt32',
+        'UInt32'          : 'kUInt32',
+        'Int64'           : 'kInt64',
+        'UInt64'          : 'kUInt64',
+        'Float'           : 'kFloat',
+        'VkBool32'        : 'kVkBool32',
+        'VkSampleMask'    : 'kVkSampleMask',
+        'VkDeviceSize'    : 'kVkDeviceSize',
+        'VkDeviceAddress' : 'kVkDeviceAddress',
+        'SizeT'           : 'kSizeT',
+        'Enum'            : 'kEnum',
+        'Flags'           : 'kFlags',
+        'Flags64'         : 'kFlags64',
+        'Handle'          : 'kHandleId',
+        'FunctionPtr'     : 'kAddress'
+    }
+
     def __init__(self,
                  errFile = sys.stderr,
                  warnFile = sys.stderr,
@@ -50,16 +74,28 @@ class VulkanStructDecodersBodyGenerator(BaseGenerator):
                                processCmds=False, processStructs=True, featureBreak=True,
                                errFile=errFile, warnFile=warnFile, diagFile=diagFile)
 
+        # When enabled, structs that are not in the hot list and only have scalar members are decoded from a field
+        # table by DecodeStructFields(), instead of with an unrolled decoder function.
+        self.compactStructs = False
+        self.hotStructs = set()
+
     # Method override
     def beginFile(self, genOpts):
         BaseGenerator.beginFile(self, genOpts)
 
+        if genOpts.compactStructs:
+            self.__loadCompactStructs(genOpts.compactStructs)
+
         write('#include "generated/generated_vulkan_struct_decoders.h"', file=self.outFile)
         self.newline()
         write('#include "decode/custom_vulkan_struct_decoders.h"', file=self.outFile)
         write('#include "decode/decode_allocator.h"', file=self.outFile)
+        if self.compactStructs:
+            write('#include "decode/struct_field_decoder.h"', file=self.outFile)
         self.newline()
         write('#include <cassert>', file=self.outFile)
+        if self.compactStructs:
+            write('#include <cstddef>', file=self.outFile)
         self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
         write('GFXRECON_BEGIN_NAMESPACE(decode)', file=self.outFile)
@@ -88,6 +124,17 @@ class VulkanStructDecodersBodyGenerator(BaseGenerator):
         first = True
         for struct in self.getFilteredStructNames():
             body = '' if first else '\n'
+
+            fields = None
+            if self.compactStructs and not struct in self.hotStructs:
+                fields = self.makeFieldTable(struct, self.featureStructMembers[struct])
+
+            if fields:
+                body += self.makeCompactDecodeStruct(struct, fields)
+                write(body, file=self.outFile)
+                first = False
+                continue
+
             body += 'size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_{}* wrapper)\n'.format(struct)
             body += '{\n'
             body += '    assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));\n'
@@ -103,6 +150,60 @@ class VulkanStructDecodersBodyGenerator(BaseGenerator):
             write(body, file=self.outFile)
             first = False
 
+    #
+    # Generate the field table entries for a struct that can be decoded by DecodeStructFields(), or None when the struct
+    # has members that require a generated decoder.
+    def makeFieldTable(self, name, values):
+        fields = []
+
+        for value in values:
+            valueOffset = 'offsetof({}, {})'.format(name, value.name)
+            valueSize = 'sizeof({}::{})'.format(name, value.name)
+            wrapperOffset = '0'
+
+            if 'pNext' in value.name:
+                fieldType = 'kPNext'
+                wrapperOffset = 'offsetof(Decoded_{}, {})'.format(name, value.name)
+            elif value.isPointer or value.isArray or value.bitfieldWidth:
+                return None
+            elif self.isGenericStructHandleValue(name, value.name):
+                return None
+            else:
+                typeName = self.makeInvocationTypeName(value.baseType)
+                if self.isStruct(typeName) or not typeName in self.COMPACT_FIELD_TYPES:
+                    return None
+
+                fieldType = self.COMPACT_FIELD_TYPES[typeName]
+                if typeName in ['Handle', 'FunctionPtr']:
+                    wrapperOffset = 'offsetof(Decoded_{}, {})'.format(name, value.name)
+
+            fields.append('    {{ FieldType::{}, {}, {}, {} }},\n'.format(fieldType, valueOffset, valueSize, wrapperOffset))
+
+        return fields
+
+    #
+    # Generate a struct decoder function that decodes the struct from its field table.
+    def makeCompactDecodeStruct(self, name, fields):
+        tableName = 'k{}Fields'.format(name[2:] if name.startswith('Vk') else name)
+
+        body = 'static const StructField {}[] = {{\n'.format(tableName)
+        body += ''.join(fields)
+        body += '};\n'
+        body += '\n'
+        body += 'size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_{}* wrapper)\n'.format(name)
+        body += '{\n'
+        body += '    assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));\n'
+        body += '\n'
+        body += '    return DecodeStructFields(buffer, buffer_size, wrapper->decoded_value, wrapper, {table}, (sizeof({table}) / sizeof({table}[0])));\n'.format(table=tableName)
+        body += '}'
+
+        return body
+
+    def __loadCompactStructs(self, filename):
+        config = json.loads(open(filename, 'r').read())
+        self.compactStructs = config['enabled']
+        self.hotStructs = set(config['hot_structs'])
+
     #
     # Generate C++ code for the decoder method body.
     def makeDecodeStructBody(self, name, values):
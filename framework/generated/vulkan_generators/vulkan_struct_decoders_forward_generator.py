@@ -50,6 +50,15 @@ class VulkanStructDecodersForwardGenerator(BaseGenerator):
                                processCmds=False, processStructs=True, featureBreak=True,
                                errFile=errFile, warnFile=warnFile, diagFile=diagFile)
 
+        # Map of struct names to a (size, alignment) tuple for structs with an encoded layout that matches the host
+        # layout.  Preserved across features so that structs can reference structs from earlier features.
+        self.layoutCompatibleStructs = dict()
+
+        # Sizes for the scalar types that are encoded with the same size as the host type.
+        self.layoutCompatibleTypeSizes = { 'float' : 4, 'int' : 4, 'int32_t' : 4, 'uint32_t' : 4, 'VkBool32' : 4,
+                                           'VkSampleMask' : 4, 'int64_t' : 8, 'uint64_t' : 8, 'VkDeviceSize' : 8,
+                                           'VkDeviceAddress' : 8, 'uint16_t' : 2, 'uint8_t' : 1 }
+
     # Method override
     def beginFile(self, genOpts):
         BaseGenerator.beginFile(self, genOpts)
@@ -59,12 +68,28 @@ class VulkanStructDecodersForwardGenerator(BaseGenerator):
         write('#include "vulkan/vulkan.h"', file=self.outFile)
         self.newline()
         write('#include <cstdint>', file=self.outFile)
+        write('#include <type_traits>', file=self.outFile)
         self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
         write('GFXRECON_BEGIN_NAMESPACE(decode)', file=self.outFile)
+        self.newline()
+        write('// Identifies decoded struct types with an encoded layout that matches the host layout of the Vulkan struct, which', file=self.outFile)
+        write('// allows arrays of the struct to be decoded with a single copy of the encoded data.', file=self.outFile)
+        write('template <typename T>', file=self.outFile)
+        write('struct IsLayoutCompatible : std::false_type', file=self.outFile)
+        write('{};', file=self.outFile)
+
+        self.layoutCompatibleStructs = dict()
 
     # Method override
     def endFile(self):
+        if self.layoutCompatibleStructs:
+            self.newline()
+            for struct in self.layoutCompatibleStructs:
+                write('template <>', file=self.outFile)
+                write('struct IsLayoutCompatible<Decoded_{}> : std::true_type'.format(struct), file=self.outFile)
+                write('{};', file=self.outFile)
+
         self.newline()
         write('GFXRECON_END_NAMESPACE(decode)', file=self.outFile)
         write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
@@ -89,3 +114,44 @@ class VulkanStructDecodersForwardGenerator(BaseGenerator):
 
         for struct in self.getFilteredStructNames():
             write('size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_{}* wrapper);'.format(struct), file=self.outFile)
+
+        for struct in self.getFilteredStructNames():
+            layout = self.getLayoutCompatibleStructLayout(self.featureStructMembers[struct])
+            if layout:
+                self.layoutCompatibleStructs[struct] = layout
+
+    #
+    # Determines if a struct is encoded with a layout that matches the host layout, which requires all members to be
+    # scalars or structs that are encoded with their host size, with no padding between members.  Returns a (size,
+    # alignment) tuple for a compatible struct or None for an incompatible struct.
+    def getLayoutCompatibleStructLayout(self, values):
+        offset = 0
+        structAlignment = 1
+
+        for value in values:
+            if value.isPointer or value.isArray or value.bitfieldWidth or value.platformBaseType:
+                return None
+
+            if value.baseType in self.layoutCompatibleStructs:
+                size, alignment = self.layoutCompatibleStructs[value.baseType]
+            elif self.isEnum(value.baseType):
+                size = alignment = 4
+            elif self.isFlags(value.baseType):
+                size = alignment = 8 if self.flagsTypes[value.baseType] == 'VkFlags64' else 4
+            elif value.baseType in self.layoutCompatibleTypeSizes:
+                size = alignment = self.layoutCompatibleTypeSizes[value.baseType]
+            else:
+                return None
+
+            # Padding before the member.
+            if (offset % alignment) != 0:
+                return None
+
+            offset += size
+            structAlignment = max(structAlignment, alignment)
+
+        # Trailing padding.
+        if (offset == 0) or ((offset % structAlignment) != 0):
+            return None
+
+        return (offset, structAlignment)
@@ -42,6 +42,12 @@ class VulkanStructEncodersBodyGeneratorOptions(BaseGeneratorOptions):
 # Generates C++ functions for encoding Vulkan API structures.
 class VulkanStructEncodersBodyGenerator(BaseGenerator):
     """Generate C++ functions for Vulkan struct encoding"""
+    # Struct members with large opaque contents that are encoded as references to deduplicated blobs when enabled.
+    BLOB_MEMBERS = {
+        'VkShaderModuleCreateInfo' : 'pCode',
+        'VkPipelineCacheCreateInfo' : 'pInitialData'
+    }
+
     def __init__(self,
                  errFile = sys.stderr,
                  warnFile = sys.stderr,
@@ -108,6 +114,8 @@ class VulkanStructEncodersBodyGenerator(BaseGenerator):
                 body += '    EncodePNextStruct(encoder, {});\n'.format(prefix + value.name)
             else:
                 methodCall = self.makeEncoderMethodCall(name, value, values, prefix)
+                if self.BLOB_MEMBERS.get(name) == value.name:
+                    methodCall = methodCall.replace('Array(', 'BlobArray(', 1)
                 body += '    {};\n'.format(methodCall)
 
         return body
@@ -42,6 +42,13 @@ class VulkanStructEncodersHeaderGeneratorOptions(BaseGeneratorOptions):
 # Generates C++ type and function declarations for encoding Vulkan API structures.
 class VulkanStructEncodersHeaderGenerator(BaseGenerator):
     """Generate C++ function declarations for Vulkan struct encoding"""
+
+    # Sizes of the member value types that are encoded with the same size and representation as the host type.
+    LAYOUT_ENCODABLE_TYPE_SIZES = {
+        'UInt8' : 1, 'UInt16' : 2, 'Int32' : 4, 'UInt32' : 4, 'Float' : 4, 'VkBool32' : 4, 'VkSampleMask' : 4,
+        'Enum' : 4, 'Flags' : 4, 'Int64' : 8, 'UInt64' : 8, 'Flags64' : 8, 'VkDeviceSize' : 8, 'VkDeviceAddress' : 8
+    }
+
     def __init__(self,
                  errFile = sys.stderr,
                  warnFile = sys.stderr,
@@ -50,6 +57,9 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
                                processCmds=False, processStructs=True, featureBreak=True,
                                errFile=errFile, warnFile=warnFile, diagFile=diagFile)
 
+        # Size and alignment of the structs that can be encoded as a copy of their host memory, keyed by struct name.
+        self.layoutEncodableStructs = dict()
+
     # Method override
     def beginFile(self, genOpts):
         BaseGenerator.beginFile(self, genOpts)
@@ -86,5 +96,46 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
     #
     # Performs C++ code generation for the feature.
     def generateFeature(self):
+        layoutEncodable = []
         for struct in self.getFilteredStructNames():
             write('void EncodeStruct(ParameterEncoder* encoder, const {}& value);'.format(struct), file=self.outFile)
+            if self.checkLayoutEncodable(struct, self.featureStructMembers[struct]):
+                layoutEncodable.append(struct)
+
+        if layoutEncodable:
+            self.newline()
+            for struct in layoutEncodable:
+                write('template <> struct IsLayoutEncodable<{}> : std::true_type {{}};'.format(struct), file=self.outFile)
+
+    #
+    # Determines if the encoded representation of a struct is identical to its host memory, which is the case for
+    # structs with no pointer, array, handle, or size_t members, and no padding between or after the members.
+    def checkLayoutEncodable(self, struct, values):
+        offset = 0
+        alignment = 1
+        for value in values:
+            if value.isPointer or value.isArray or value.bitfieldWidth:
+                return False
+            if self.isGenericStructHandleValue(struct, value.name):
+                return False
+
+            typeName = self.makeInvocationTypeName(value.baseType)
+            if typeName in self.layoutEncodableStructs:
+                size, valueAlignment = self.layoutEncodableStructs[typeName]
+            elif typeName in self.LAYOUT_ENCODABLE_TYPE_SIZES:
+                size = self.LAYOUT_ENCODABLE_TYPE_SIZES[typeName]
+                valueAlignment = size
+            else:
+                return False
+
+            if offset % valueAlignment != 0:
+                return False
+
+            offset += size
+            alignment = max(alignment, valueAlignment)
+
+        if (offset == 0) or (offset % alignment != 0):
+            return False
+
+        self.layoutEncodableStructs[struct] = (offset, alignment)
+        return True
@@ -103,6 +103,11 @@ class VulkanStructHandleWrappersHeaderGenerator(BaseGenerator):
         write('template <typename T>', file=self.outFile)
         write('const T* UnwrapStructPtrHandles(const T* value, HandleUnwrapMemory* unwrap_memory)', file=self.outFile)
         write('{', file=self.outFile)
+        write('    if (HandleSideTables::IsEnabled())', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        return value;', file=self.outFile)
+        write('    }', file=self.outFile)
+        self.newline()
         write('    T* unwrapped_struct = nullptr;', file=self.outFile)
         self.newline()
         write('    if (value != nullptr)', file=self.outFile)
@@ -117,7 +122,7 @@ class VulkanStructHandleWrappersHeaderGenerator(BaseGenerator):
         write('template <typename T>', file=self.outFile)
         write('const T* UnwrapStructArrayHandles(const T* values, size_t len, HandleUnwrapMemory* unwrap_memory)', file=self.outFile)
         write('{', file=self.outFile)
-        write('    if ((values != nullptr) && (len > 0))', file=self.outFile)
+        write('    if ((values != nullptr) && (len > 0) && !HandleSideTables::IsEnabled())', file=self.outFile)
         write('    {', file=self.outFile)
         write('        auto unwrapped_structs = MakeUnwrapStructs(values, len, unwrap_memory);', file=self.outFile)
         self.newline()
@@ -129,7 +134,8 @@ class VulkanStructHandleWrappersHeaderGenerator(BaseGenerator):
         write('        return unwrapped_structs;', file=self.outFile)
         write('    }', file=self.outFile)
         self.newline()
-        write('    // Leave the original memory in place when the pointer is not null, but size is zero.', file=self.outFile)
+        write('    // Leave the original memory in place when the pointer is not null, but size is zero, or when the handles are not', file=self.outFile)
+        write('    // wrapped.', file=self.outFile)
         write('    return values;', file=self.outFile)
         write('}', file=self.outFile)
         self.newline()
@@ -0,0 +1,296 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "graphics/frame_timing_report.h"
+
+#include "util/date_time.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <inttypes.h>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+const char kCsvExtension[] = ".csv";
+
+FrameTimingReport::FrameTimingReport(const std::string& filename, uint32_t first_frame, uint32_t last_frame) :
+    filename_(filename), write_csv_(false), first_frame_(first_frame), last_frame_(last_frame)
+{
+    const size_t extension_length = sizeof(kCsvExtension) - 1;
+
+    if ((filename_.length() >= extension_length) &&
+        (util::platform::StringCompareNoCase(filename_.c_str() + (filename_.length() - extension_length),
+                                             kCsvExtension) == 0))
+    {
+        write_csv_ = true;
+    }
+}
+
+void FrameTimingReport::AddFrame(uint64_t frame_number, int64_t cpu_time, int64_t present_interval)
+{
+    assert(frames_.empty() || (frames_.back().frame_number < frame_number));
+
+    FrameTiming timing;
+    timing.frame_number                  = frame_number;
+    timing.cpu_milliseconds              = util::datetime::ConvertTimestampToMilliseconds(cpu_time);
+    timing.present_interval_milliseconds = util::datetime::ConvertTimestampToMilliseconds(present_interval);
+
+    frames_.push_back(timing);
+}
+
+void FrameTimingReport::AddGpuTime(uint64_t frame_number, double gpu_milliseconds)
+{
+    FrameTiming* timing = FindFrame(frame_number);
+
+    if (timing != nullptr)
+    {
+        timing->gpu_milliseconds += gpu_milliseconds;
+    }
+}
+
+void FrameTimingReport::SetGpuTimeUnavailable(uint64_t frame_number)
+{
+    FrameTiming* timing = FindFrame(frame_number);
+
+    if (timing != nullptr)
+    {
+        timing->gpu_time_unavailable = true;
+    }
+}
+
+bool FrameTimingReport::Write() const
+{
+    std::vector<double> cpu_times;
+    std::vector<double> present_intervals;
+    std::vector<double> gpu_times;
+
+    for (const auto& timing : frames_)
+    {
+        cpu_times.push_back(timing.cpu_milliseconds);
+
+        // The first replayed frame does not have a previous present.
+        if (timing.present_interval_milliseconds > 0.0)
+        {
+            present_intervals.push_back(timing.present_interval_milliseconds);
+        }
+
+        if (!timing.gpu_time_unavailable)
+        {
+            gpu_times.push_back(timing.gpu_milliseconds);
+        }
+    }
+
+    Statistics cpu     = GetStatistics(std::move(cpu_times));
+    Statistics present = GetStatistics(std::move(present_intervals));
+    Statistics gpu     = GetStatistics(std::move(gpu_times));
+
+    GFXRECON_WRITE_CONSOLE("Frame timing for %" PRIu64 " frames (milliseconds):",
+                           static_cast<uint64_t>(frames_.size()));
+    GFXRECON_WRITE_CONSOLE("  %-17s %10s %10s %10s %10s %10s %10s", "", "min", "mean", "p50", "p95", "p99", "max");
+
+    const std::pair<const char*, const Statistics*> rows[] = { { "CPU", &cpu },
+                                                               { "GPU", &gpu },
+                                                               { "Present interval", &present } };
+
+    for (const auto& row : rows)
+    {
+        const Statistics* stats = row.second;
+
+        if (stats->count > 0)
+        {
+            GFXRECON_WRITE_CONSOLE("  %-17s %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f",
+                                   row.first,
+                                   stats->min,
+                                   stats->mean,
+                                   stats->p50,
+                                   stats->p95,
+                                   stats->p99,
+                                   stats->max);
+        }
+    }
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename_.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open frame timing report file %s", filename_.c_str());
+        return false;
+    }
+
+    bool success = write_csv_ ? WriteCsv(file) : WriteJson(file, cpu, present, gpu);
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write frame timing report file %s", filename_.c_str());
+    }
+
+    return success;
+}
+
+FrameTimingReport::FrameTiming* FrameTimingReport::FindFrame(uint64_t frame_number)
+{
+    auto entry = std::lower_bound(
+        frames_.begin(), frames_.end(), frame_number, [](const FrameTiming& timing, uint64_t frame_number) {
+            return timing.frame_number < frame_number;
+        });
+
+    if ((entry != frames_.end()) && (entry->frame_number == frame_number))
+    {
+        return &(*entry);
+    }
+
+    return nullptr;
+}
+
+FrameTimingReport::Statistics FrameTimingReport::GetStatistics(std::vector<double> values)
+{
+    Statistics stats;
+
+    if (!values.empty())
+    {
+        std::sort(values.begin(), values.end());
+
+        double total = 0.0;
+        for (double value : values)
+        {
+            total += value;
+        }
+
+        // Nearest-rank percentiles.
+        auto percentile = [&values](double rank) {
+            size_t index = static_cast<size_t>(std::ceil((rank / 100.0) * values.size()));
+            return values[(index > 0) ? (index - 1) : 0];
+        };
+
+        stats.count = values.size();
+        stats.min   = values.front();
+        stats.mean  = total / values.size();
+        stats.p50   = percentile(50.0);
+        stats.p95   = percentile(95.0);
+        stats.p99   = percentile(99.0);
+        stats.max   = values.back();
+    }
+
+    return stats;
+}
+
+bool FrameTimingReport::WriteJson(FILE*             file,
+                                  const Statistics& cpu,
+                                  const Statistics& present,
+                                  const Statistics& gpu) const
+{
+    bool success = (fprintf(file, "{\n  \"frames\": [") >= 0);
+
+    for (size_t i = 0; success && (i < frames_.size()); ++i)
+    {
+        const FrameTiming& timing = frames_[i];
+
+        success = (fprintf(file,
+                           "%s\n    { \"frame\": %" PRIu64 ", \"cpu_ms\": %.6f, \"present_interval_ms\": ",
+                           (i > 0) ? "," : "",
+                           timing.frame_number,
+                           timing.cpu_milliseconds) >= 0);
+
+        if (success && (timing.present_interval_milliseconds > 0.0))
+        {
+            success = (fprintf(file, "%.6f", timing.present_interval_milliseconds) >= 0);
+        }
+        else if (success)
+        {
+            success = (fprintf(file, "null") >= 0);
+        }
+
+        if (success && !timing.gpu_time_unavailable)
+        {
+            success = (fprintf(file, ", \"gpu_ms\": %.6f }", timing.gpu_milliseconds) >= 0);
+        }
+        else if (success)
+        {
+            success = (fprintf(file, ", \"gpu_ms\": null }") >= 0);
+        }
+    }
+
+    success = success && (fprintf(file, "\n  ],\n  \"summary\": {") >= 0);
+
+    const std::pair<const char*, const Statistics*> rows[] = { { "cpu_ms", &cpu },
+                                                               { "gpu_ms", &gpu },
+                                                               { "present_interval_ms", &present } };
+
+    for (size_t i = 0; success && (i < 3); ++i)
+    {
+        const Statistics* stats = rows[i].second;
+
+        success = (fprintf(file,
+                           "%s\n    \"%s\": { \"count\": %" PRIu64 ", \"min\": %.6f, \"mean\": %.6f, \"p50\": %.6f, "
+                           "\"p95\": %.6f, \"p99\": %.6f, \"max\": %.6f }",
+                           (i > 0) ? "," : "",
+                           rows[i].first,
+                           static_cast<uint64_t>(stats->count),
+                           stats->min,
+                           stats->mean,
+                           stats->p50,
+                           stats->p95,
+                           stats->p99,
+                           stats->max) >= 0);
+    }
+
+    return success && (fprintf(file, "\n  }\n}\n") >= 0);
+}
+
+bool FrameTimingReport::WriteCsv(FILE* file) const
+{
+    bool success = (fprintf(file, "frame,cpu_ms,present_interval_ms,gpu_ms\n") >= 0);
+
+    for (size_t i = 0; success && (i < frames_.size()); ++i)
+    {
+        const FrameTiming& timing = frames_[i];
+
+        success = (fprintf(file, "%" PRIu64 ",%.6f,", timing.frame_number, timing.cpu_milliseconds) >= 0);
+
+        if (success && (timing.present_interval_milliseconds > 0.0))
+        {
+            success = (fprintf(file, "%.6f", timing.present_interval_milliseconds) >= 0);
+        }
+
+        if (success && !timing.gpu_time_unavailable)
+        {
+            success = (fprintf(file, ",%.6f\n", timing.gpu_milliseconds) >= 0);
+        }
+        else if (success)
+        {
+            success = (fprintf(file, ",\n") >= 0);
+        }
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
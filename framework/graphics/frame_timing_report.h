@@ -0,0 +1,104 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_GRAPHICS_FRAME_TIMING_REPORT_H
+#define GFXRECON_GRAPHICS_FRAME_TIMING_REPORT_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+// Collects the CPU time, GPU time, and present-to-present interval of each replayed frame, and writes the values with
+// their percentile statistics to a JSON or CSV file.
+class FrameTimingReport
+{
+  public:
+    // The file is written as CSV when the file name has a .csv extension, and as JSON otherwise.  Only frames
+    // first_frame through last_frame are reported.
+    FrameTimingReport(const std::string& filename, uint32_t first_frame, uint32_t last_frame);
+
+    bool IsReportFrame(uint64_t frame_number) const
+    {
+        return (frame_number >= first_frame_) && (frame_number <= last_frame_);
+    }
+
+    // Times are timestamp differences from util::datetime.  The present interval is zero for the first frame.
+    void AddFrame(uint64_t frame_number, int64_t cpu_time, int64_t present_interval);
+
+    // Adds GPU time, which may be reported by multiple devices, to a frame that has already been added.
+    void AddGpuTime(uint64_t frame_number, double gpu_milliseconds);
+
+    // Marks the GPU time of a frame as unavailable, because some of its submissions could not be timed.
+    void SetGpuTimeUnavailable(uint64_t frame_number);
+
+    // Writes the report file and logs the percentile statistics.
+    bool Write() const;
+
+  private:
+    struct FrameTiming
+    {
+        uint64_t frame_number{ 0 };
+        double   cpu_milliseconds{ 0.0 };
+        double   present_interval_milliseconds{ 0.0 };
+        double   gpu_milliseconds{ 0.0 };
+        bool     gpu_time_unavailable{ false };
+    };
+
+    struct Statistics
+    {
+        size_t count{ 0 };
+        double min{ 0.0 };
+        double mean{ 0.0 };
+        double p50{ 0.0 };
+        double p95{ 0.0 };
+        double p99{ 0.0 };
+        double max{ 0.0 };
+    };
+
+  private:
+    FrameTiming* FindFrame(uint64_t frame_number);
+
+    static Statistics GetStatistics(std::vector<double> values);
+
+    bool WriteJson(FILE* file, const Statistics& cpu, const Statistics& present, const Statistics& gpu) const;
+
+    bool WriteCsv(FILE* file) const;
+
+  private:
+    std::string              filename_;
+    bool                     write_csv_;
+    uint32_t                 first_frame_;
+    uint32_t                 last_frame_;
+    std::vector<FrameTiming> frames_;
+};
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_GRAPHICS_FRAME_TIMING_REPORT_H
@@ -0,0 +1,370 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "graphics/memory_usage_report.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <inttypes.h>
+
+#if defined(WIN32)
+#include <psapi.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+const char   kMemoryCsvExtension[] = ".csv";
+const double kBytesPerMebibyte     = 1024.0 * 1024.0;
+
+// Retrieves the resident set size of the process and its peak from the operating system, or zero for both when they
+// are not available.
+static void GetResidentSize(uint64_t* resident_size, uint64_t* peak_resident_size)
+{
+    assert((resident_size != nullptr) && (peak_resident_size != nullptr));
+
+    (*resident_size)      = 0;
+    (*peak_resident_size) = 0;
+
+#if defined(WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        (*resident_size)      = counters.WorkingSetSize;
+        (*peak_resident_size) = counters.PeakWorkingSetSize;
+    }
+#elif defined(__linux__)
+    FILE* status = nullptr;
+
+    if ((util::platform::FileOpen(&status, "/proc/self/status", "r") == 0) && (status != nullptr))
+    {
+        char line[256];
+
+        // The sizes are reported in kilobytes.
+        while (fgets(line, sizeof(line), status) != nullptr)
+        {
+            unsigned long long size = 0;
+
+            if (sscanf(line, "VmRSS: %llu", &size) == 1)
+            {
+                (*resident_size) = static_cast<uint64_t>(size) * 1024;
+            }
+            else if (sscanf(line, "VmHWM: %llu", &size) == 1)
+            {
+                (*peak_resident_size) = static_cast<uint64_t>(size) * 1024;
+            }
+        }
+
+        util::platform::FileClose(status);
+    }
+#endif
+}
+
+MemoryUsageReport::MemoryUsageReport(const std::string& filename, uint32_t interval_frames) :
+    filename_(filename), file_(nullptr), write_csv_(false), interval_frames_(std::max(interval_frames, 1u)),
+    first_frame_(0), last_frame_(0)
+{
+    const size_t extension_length = sizeof(kMemoryCsvExtension) - 1;
+
+    if ((filename_.length() >= extension_length) &&
+        (util::platform::StringCompareNoCase(filename_.c_str() + (filename_.length() - extension_length),
+                                             kMemoryCsvExtension) == 0))
+    {
+        write_csv_ = true;
+    }
+
+    int32_t result = util::platform::FileOpen(&file_, filename_.c_str(), "w");
+
+    if ((result != 0) || (file_ == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open memory usage report file %s", filename_.c_str());
+        file_ = nullptr;
+    }
+    else if (write_csv_ && (fprintf(file_, "first_frame,last_frame,source,current_bytes,peak_bytes\n") < 0))
+    {
+        GFXRECON_LOG_ERROR("Failed to write memory usage report file %s", filename_.c_str());
+        util::platform::FileClose(file_);
+        file_ = nullptr;
+    }
+}
+
+MemoryUsageReport::~MemoryUsageReport()
+{
+    Flush();
+
+    if (file_ != nullptr)
+    {
+        util::platform::FileClose(file_);
+    }
+}
+
+void MemoryUsageReport::SetHostUsage(HostCategory category, uint64_t size)
+{
+    assert(category < kHostCategoryCount);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    SetUsage(&host_usage_[category], size);
+}
+
+void MemoryUsageReport::SetDeviceUsage(uint64_t device_id, const std::vector<uint64_t>& heap_usage)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<Usage>& device_usage = device_usage_[device_id];
+
+    if (device_usage.size() < heap_usage.size())
+    {
+        device_usage.resize(heap_usage.size());
+    }
+
+    for (size_t i = 0; i < heap_usage.size(); ++i)
+    {
+        SetUsage(&device_usage[i], heap_usage[i]);
+    }
+}
+
+void MemoryUsageReport::ClearDeviceUsage(uint64_t device_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto entry = device_usage_.find(device_id);
+
+    if (entry != device_usage_.end())
+    {
+        for (auto& usage : entry->second)
+        {
+            usage.current = 0;
+        }
+    }
+}
+
+void MemoryUsageReport::EndFrame(uint64_t frame_number)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (last_frame_ == 0)
+    {
+        first_frame_ = frame_number;
+    }
+
+    last_frame_ = frame_number;
+
+    if ((last_frame_ - first_frame_ + 1) >= interval_frames_)
+    {
+        WriteRange();
+    }
+}
+
+void MemoryUsageReport::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (last_frame_ != 0)
+    {
+        WriteRange();
+    }
+}
+
+void MemoryUsageReport::SetUsage(Usage* usage, uint64_t size)
+{
+    assert(usage != nullptr);
+
+    usage->current = size;
+    usage->peak    = std::max(usage->peak, size);
+}
+
+const char* MemoryUsageReport::GetCategoryName(HostCategory category)
+{
+    switch (category)
+    {
+        case kDecodeBuffers:
+            return "decode_buffers";
+        case kObjectInfoTables:
+            return "object_info_tables";
+        case kHostCopies:
+            return "host_copies";
+        case kScreenshotBuffers:
+            return "screenshot_buffers";
+        default:
+            return "unknown";
+    }
+}
+
+void MemoryUsageReport::WriteRange()
+{
+    uint64_t resident_size      = 0;
+    uint64_t peak_resident_size = 0;
+
+    GetResidentSize(&resident_size, &peak_resident_size);
+
+    GFXRECON_LOG_INFO("Memory usage for frames %" PRIu64 "-%" PRIu64 " (MiB, current/peak): decode buffers %.1f/%.1f, "
+                      "object info tables %.1f/%.1f, host copies %.1f/%.1f, screenshot buffers %.1f/%.1f, resident "
+                      "%.1f/%.1f",
+                      first_frame_,
+                      last_frame_,
+                      host_usage_[kDecodeBuffers].current / kBytesPerMebibyte,
+                      host_usage_[kDecodeBuffers].peak / kBytesPerMebibyte,
+                      host_usage_[kObjectInfoTables].current / kBytesPerMebibyte,
+                      host_usage_[kObjectInfoTables].peak / kBytesPerMebibyte,
+                      host_usage_[kHostCopies].current / kBytesPerMebibyte,
+                      host_usage_[kHostCopies].peak / kBytesPerMebibyte,
+                      host_usage_[kScreenshotBuffers].current / kBytesPerMebibyte,
+                      host_usage_[kScreenshotBuffers].peak / kBytesPerMebibyte,
+                      resident_size / kBytesPerMebibyte,
+                      peak_resident_size / kBytesPerMebibyte);
+
+    for (const auto& entry : device_usage_)
+    {
+        for (size_t i = 0; i < entry.second.size(); ++i)
+        {
+            GFXRECON_LOG_INFO("  Device %" PRIu64 " heap %" PRIu64 " (MiB, current/peak): %.1f/%.1f",
+                              entry.first,
+                              static_cast<uint64_t>(i),
+                              entry.second[i].current / kBytesPerMebibyte,
+                              entry.second[i].peak / kBytesPerMebibyte);
+        }
+    }
+
+    if (file_ != nullptr)
+    {
+        bool success = write_csv_ ? WriteCsv(resident_size, peak_resident_size)
+                                  : WriteJson(resident_size, peak_resident_size);
+
+        // The file is flushed for each range, so that it is complete when the process is terminated.
+        if (!success || (util::platform::FileFlush(file_) != 0))
+        {
+            GFXRECON_LOG_ERROR("Failed to write memory usage report file %s", filename_.c_str());
+            util::platform::FileClose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    // The peaks of the next range start from the current usage.
+    for (auto& usage : host_usage_)
+    {
+        usage.peak = usage.current;
+    }
+
+    for (auto& entry : device_usage_)
+    {
+        for (auto& usage : entry.second)
+        {
+            usage.peak = usage.current;
+        }
+    }
+
+    last_frame_ = 0;
+}
+
+bool MemoryUsageReport::WriteJson(uint64_t resident_size, uint64_t peak_resident_size)
+{
+    bool success = (fprintf(file_,
+                            "{ \"first_frame\": %" PRIu64 ", \"last_frame\": %" PRIu64 ", \"host\": {",
+                            first_frame_,
+                            last_frame_) >= 0);
+
+    for (uint32_t i = 0; success && (i < kHostCategoryCount); ++i)
+    {
+        success = (fprintf(file_,
+                           "%s \"%s\": { \"current\": %" PRIu64 ", \"peak\": %" PRIu64 " }",
+                           (i > 0) ? "," : "",
+                           GetCategoryName(static_cast<HostCategory>(i)),
+                           host_usage_[i].current,
+                           host_usage_[i].peak) >= 0);
+    }
+
+    success = success && (fprintf(file_,
+                                  " }, \"process\": { \"resident\": %" PRIu64 ", \"peak_resident\": %" PRIu64
+                                  " }, \"devices\": [",
+                                  resident_size,
+                                  peak_resident_size) >= 0);
+
+    for (auto entry = device_usage_.begin(); success && (entry != device_usage_.end()); ++entry)
+    {
+        success = (fprintf(file_,
+                           "%s { \"device\": %" PRIu64 ", \"heaps\": [",
+                           (entry != device_usage_.begin()) ? "," : "",
+                           entry->first) >= 0);
+
+        for (size_t i = 0; success && (i < entry->second.size()); ++i)
+        {
+            success = (fprintf(file_,
+                               "%s { \"heap\": %" PRIu64 ", \"current\": %" PRIu64 ", \"peak\": %" PRIu64 " }",
+                               (i > 0) ? "," : "",
+                               static_cast<uint64_t>(i),
+                               entry->second[i].current,
+                               entry->second[i].peak) >= 0);
+        }
+
+        success = success && (fprintf(file_, " ] }") >= 0);
+    }
+
+    return success && (fprintf(file_, " ] }\n") >= 0);
+}
+
+bool MemoryUsageReport::WriteCsv(uint64_t resident_size, uint64_t peak_resident_size)
+{
+    bool success = true;
+
+    for (uint32_t i = 0; success && (i < kHostCategoryCount); ++i)
+    {
+        success = (fprintf(file_,
+                           "%" PRIu64 ",%" PRIu64 ",%s,%" PRIu64 ",%" PRIu64 "\n",
+                           first_frame_,
+                           last_frame_,
+                           GetCategoryName(static_cast<HostCategory>(i)),
+                           host_usage_[i].current,
+                           host_usage_[i].peak) >= 0);
+    }
+
+    success = success && (fprintf(file_,
+                                  "%" PRIu64 ",%" PRIu64 ",process_resident,%" PRIu64 ",%" PRIu64 "\n",
+                                  first_frame_,
+                                  last_frame_,
+                                  resident_size,
+                                  peak_resident_size) >= 0);
+
+    for (auto entry = device_usage_.begin(); success && (entry != device_usage_.end()); ++entry)
+    {
+        for (size_t i = 0; success && (i < entry->second.size()); ++i)
+        {
+            success = (fprintf(file_,
+                               "%" PRIu64 ",%" PRIu64 ",device_%" PRIu64 "_heap_%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+                               first_frame_,
+                               last_frame_,
+                               entry->first,
+                               static_cast<uint64_t>(i),
+                               entry->second[i].current,
+                               entry->second[i].peak) >= 0);
+        }
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,114 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_GRAPHICS_MEMORY_USAGE_REPORT_H
+#define GFXRECON_GRAPHICS_MEMORY_USAGE_REPORT_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+// Tracks the host memory that replay uses for its own data, and the device memory that the replay resource allocators
+// allocate from each memory heap, and reports the current and peak usage for each range of interval_frames frames.
+// Peaks are the largest of the values that were set during the range.  The process resident set size is reported
+// with the peak resident set size from the operating system, where available.  Each range is logged and appended to
+// the report file when it ends, so that the file covers the ranges that completed before an out of memory failure.
+class MemoryUsageReport
+{
+  public:
+    enum HostCategory : uint32_t
+    {
+        kDecodeBuffers = 0, // Block read, decompression, and prefetch buffers of the file processor.
+        kObjectInfoTables,  // Replay object info tables.
+        kHostCopies,        // Copies of mapped memory content kept by the resource allocators.
+        kScreenshotBuffers, // Host visible buffers that screenshots are copied to.
+        kHostCategoryCount
+    };
+
+  public:
+    // The file is written as CSV when the file name has a .csv extension, and as JSON lines, with one object for each
+    // frame range, otherwise.
+    MemoryUsageReport(const std::string& filename, uint32_t interval_frames);
+
+    ~MemoryUsageReport();
+
+    // Sets the current usage of a category.  May be called from any thread.
+    void SetHostUsage(HostCategory category, uint64_t size);
+
+    // Sets the current usage of each memory heap of a device.
+    void SetDeviceUsage(uint64_t device_id, const std::vector<uint64_t>& heap_usage);
+
+    // Sets the usage of a destroyed device to zero.
+    void ClearDeviceUsage(uint64_t device_id);
+
+    // Ends a frame, reporting the frame range when the frame is the last frame of a range.
+    void EndFrame(uint64_t frame_number);
+
+    // Reports the frames that ended after the last complete range.
+    void Flush();
+
+  private:
+    struct Usage
+    {
+        uint64_t current{ 0 };
+        uint64_t peak{ 0 };
+    };
+
+    typedef std::map<uint64_t, std::vector<Usage>> DeviceUsageMap;
+
+  private:
+    static void SetUsage(Usage* usage, uint64_t size);
+
+    static const char* GetCategoryName(HostCategory category);
+
+    // Must be called with the mutex locked.
+    void WriteRange();
+
+    bool WriteJson(uint64_t resident_size, uint64_t peak_resident_size);
+
+    bool WriteCsv(uint64_t resident_size, uint64_t peak_resident_size);
+
+  private:
+    std::string    filename_;
+    FILE*          file_;
+    bool           write_csv_;
+    uint32_t       interval_frames_;
+    uint64_t       first_frame_; // First frame of the range in progress.
+    uint64_t       last_frame_;  // Last frame that has ended, or 0 when no frames of the range have ended.
+    Usage          host_usage_[kHostCategoryCount];
+    DeviceUsageMap device_usage_;
+    std::mutex     mutex_;
+};
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_GRAPHICS_MEMORY_USAGE_REPORT_H
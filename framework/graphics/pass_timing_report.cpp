@@ -0,0 +1,278 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "graphics/pass_timing_report.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <inttypes.h>
+#include <map>
+#include <utility>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+const char   kPassCsvExtension[] = ".csv";
+const size_t kLoggedSummaryCount = 10;
+
+PassTimingReport::PassTimingReport(const std::string& filename, uint32_t first_frame, uint32_t last_frame) :
+    filename_(filename), write_csv_(false), first_frame_(first_frame), last_frame_(last_frame)
+{
+    const size_t extension_length = sizeof(kPassCsvExtension) - 1;
+
+    if ((filename_.length() >= extension_length) &&
+        (util::platform::StringCompareNoCase(filename_.c_str() + (filename_.length() - extension_length),
+                                             kPassCsvExtension) == 0))
+    {
+        write_csv_ = true;
+    }
+}
+
+void PassTimingReport::AddPass(const PassTiming& timing)
+{
+    if (IsReportFrame(timing.frame_number))
+    {
+        passes_.push_back(timing);
+    }
+}
+
+void PassTimingReport::SetFrameIncomplete(uint64_t frame_number)
+{
+    if (IsReportFrame(frame_number) && !IsFrameIncomplete(frame_number))
+    {
+        incomplete_frames_.push_back(frame_number);
+    }
+}
+
+bool PassTimingReport::Write() const
+{
+    // Passes are added when their results are read, which may be out of frame order for multiple devices.
+    std::vector<PassTiming> passes = passes_;
+    std::stable_sort(passes.begin(), passes.end(), [](const PassTiming& lhs, const PassTiming& rhs) {
+        return lhs.frame_number < rhs.frame_number;
+    });
+
+    std::vector<PassSummary> summaries = GetSummaries(passes);
+
+    GFXRECON_WRITE_CONSOLE("Pass timing for %" PRIu64 " passes (milliseconds):", static_cast<uint64_t>(passes.size()));
+    GFXRECON_WRITE_CONSOLE("  %-14s %14s %6s %14s %8s %10s %10s %10s %10s",
+                           "type",
+                           "command buffer",
+                           "pass",
+                           "render pass",
+                           "count",
+                           "min",
+                           "mean",
+                           "max",
+                           "total");
+
+    for (size_t i = 0; (i < summaries.size()) && (i < kLoggedSummaryCount); ++i)
+    {
+        const PassSummary& summary = summaries[i];
+
+        GFXRECON_WRITE_CONSOLE("  %-14s %14" PRIu64 " %6u %14" PRIu64 " %8" PRIu64 " %10.3f %10.3f %10.3f %10.3f",
+                               GetTypeName(summary.type),
+                               summary.command_buffer_id,
+                               summary.pass_index,
+                               summary.render_pass_id,
+                               static_cast<uint64_t>(summary.count),
+                               summary.min,
+                               summary.total / summary.count,
+                               summary.max,
+                               summary.total);
+    }
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename_.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open pass timing report file %s", filename_.c_str());
+        return false;
+    }
+
+    bool success = write_csv_ ? WriteCsv(file, passes) : WriteJson(file, passes, summaries);
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write pass timing report file %s", filename_.c_str());
+    }
+
+    return success;
+}
+
+std::vector<PassTimingReport::PassSummary> PassTimingReport::GetSummaries(const std::vector<PassTiming>& passes)
+{
+    std::map<std::pair<uint64_t, uint32_t>, PassSummary> summary_map;
+
+    for (const auto& timing : passes)
+    {
+        PassSummary& summary = summary_map[std::make_pair(timing.command_buffer_id, timing.pass_index)];
+
+        // A command buffer that is recorded again may have a different pass at the same index, which is reported by
+        // the summary of the first pass.
+        if (summary.count == 0)
+        {
+            summary.command_buffer_id = timing.command_buffer_id;
+            summary.pass_index        = timing.pass_index;
+            summary.type              = timing.type;
+            summary.render_pass_id    = timing.render_pass_id;
+            summary.min               = timing.gpu_milliseconds;
+            summary.max               = timing.gpu_milliseconds;
+        }
+        else
+        {
+            summary.min = std::min(summary.min, timing.gpu_milliseconds);
+            summary.max = std::max(summary.max, timing.gpu_milliseconds);
+        }
+
+        summary.total += timing.gpu_milliseconds;
+        ++summary.count;
+    }
+
+    std::vector<PassSummary> summaries;
+    summaries.reserve(summary_map.size());
+
+    for (const auto& entry : summary_map)
+    {
+        summaries.push_back(entry.second);
+    }
+
+    std::stable_sort(summaries.begin(), summaries.end(), [](const PassSummary& lhs, const PassSummary& rhs) {
+        return lhs.total > rhs.total;
+    });
+
+    return summaries;
+}
+
+const char* PassTimingReport::GetTypeName(PassType type)
+{
+    return (type == kDispatchGroup) ? "dispatch_group" : "render_pass";
+}
+
+bool PassTimingReport::IsFrameIncomplete(uint64_t frame_number) const
+{
+    return std::find(incomplete_frames_.begin(), incomplete_frames_.end(), frame_number) != incomplete_frames_.end();
+}
+
+bool PassTimingReport::WriteJson(FILE*                           file,
+                                 const std::vector<PassTiming>&  passes,
+                                 const std::vector<PassSummary>& summaries) const
+{
+    bool success = (fprintf(file, "{\n  \"frames\": [") >= 0);
+
+    // Frames are written in order, including the incomplete frames without any timed passes.
+    std::vector<uint64_t> frames = incomplete_frames_;
+
+    for (const auto& timing : passes)
+    {
+        if (frames.empty() || (frames.back() != timing.frame_number))
+        {
+            frames.push_back(timing.frame_number);
+        }
+    }
+
+    std::sort(frames.begin(), frames.end());
+    frames.erase(std::unique(frames.begin(), frames.end()), frames.end());
+
+    auto pass = passes.begin();
+
+    for (size_t i = 0; success && (i < frames.size()); ++i)
+    {
+        success = (fprintf(file,
+                           "%s\n    { \"frame\": %" PRIu64 ", \"complete\": %s, \"passes\": [",
+                           (i > 0) ? "," : "",
+                           frames[i],
+                           IsFrameIncomplete(frames[i]) ? "false" : "true") >= 0);
+
+        for (bool first = true; success && (pass != passes.end()) && (pass->frame_number == frames[i]); ++pass)
+        {
+            success = (fprintf(file,
+                               "%s\n      { \"command_buffer\": %" PRIu64 ", \"pass\": %u, \"type\": \"%s\", "
+                               "\"render_pass\": %" PRIu64 ", \"framebuffer\": %" PRIu64 ", \"gpu_ms\": %.6f }",
+                               first ? "" : ",",
+                               pass->command_buffer_id,
+                               pass->pass_index,
+                               GetTypeName(pass->type),
+                               pass->render_pass_id,
+                               pass->framebuffer_id,
+                               pass->gpu_milliseconds) >= 0);
+            first = false;
+        }
+
+        success = success && (fprintf(file, "\n    ] }") >= 0);
+    }
+
+    success = success && (fprintf(file, "\n  ],\n  \"summary\": [") >= 0);
+
+    for (size_t i = 0; success && (i < summaries.size()); ++i)
+    {
+        const PassSummary& summary = summaries[i];
+
+        success = (fprintf(file,
+                           "%s\n    { \"command_buffer\": %" PRIu64 ", \"pass\": %u, \"type\": \"%s\", "
+                           "\"render_pass\": %" PRIu64 ", \"count\": %" PRIu64
+                           ", \"min\": %.6f, \"mean\": %.6f, \"max\": %.6f, \"total\": %.6f }",
+                           (i > 0) ? "," : "",
+                           summary.command_buffer_id,
+                           summary.pass_index,
+                           GetTypeName(summary.type),
+                           summary.render_pass_id,
+                           static_cast<uint64_t>(summary.count),
+                           summary.min,
+                           summary.total / summary.count,
+                           summary.max,
+                           summary.total) >= 0);
+    }
+
+    return success && (fprintf(file, "\n  ]\n}\n") >= 0);
+}
+
+bool PassTimingReport::WriteCsv(FILE* file, const std::vector<PassTiming>& passes) const
+{
+    bool success = (fprintf(file, "frame,command_buffer,pass,type,render_pass,framebuffer,gpu_ms\n") >= 0);
+
+    for (size_t i = 0; success && (i < passes.size()); ++i)
+    {
+        const PassTiming& timing = passes[i];
+
+        success = (fprintf(file,
+                           "%" PRIu64 ",%" PRIu64 ",%u,%s,%" PRIu64 ",%" PRIu64 ",%.6f\n",
+                           timing.frame_number,
+                           timing.command_buffer_id,
+                           timing.pass_index,
+                           GetTypeName(timing.type),
+                           timing.render_pass_id,
+                           timing.framebuffer_id,
+                           timing.gpu_milliseconds) >= 0);
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,117 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_GRAPHICS_PASS_TIMING_REPORT_H
+#define GFXRECON_GRAPHICS_PASS_TIMING_REPORT_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+// Collects the GPU time of the render passes and dispatch groups of each replayed frame, keyed by the capture IDs of
+// their command buffers and render passes, and writes the times with per-pass statistics to a JSON or CSV file.
+class PassTimingReport
+{
+  public:
+    enum PassType : uint32_t
+    {
+        kRenderPass    = 0,
+        kDispatchGroup = 1
+    };
+
+    struct PassTiming
+    {
+        uint64_t frame_number{ 0 };
+        uint64_t command_buffer_id{ 0 };
+        uint32_t pass_index{ 0 }; // Index of the pass in the commands recorded to the command buffer.
+        PassType type{ kRenderPass };
+        uint64_t render_pass_id{ 0 }; // Zero for dispatch groups.
+        uint64_t framebuffer_id{ 0 }; // Zero for dispatch groups.
+        double   gpu_milliseconds{ 0.0 };
+    };
+
+  public:
+    // The file is written as CSV when the file name has a .csv extension, and as JSON otherwise.  Only frames
+    // first_frame through last_frame are reported.
+    PassTimingReport(const std::string& filename, uint32_t first_frame, uint32_t last_frame);
+
+    uint32_t GetLastFrame() const { return last_frame_; }
+
+    bool IsReportFrame(uint64_t frame_number) const
+    {
+        return (frame_number >= first_frame_) && (frame_number <= last_frame_);
+    }
+
+    // Passes may be added in any order, as their results become available.
+    void AddPass(const PassTiming& timing);
+
+    // Marks a frame as incomplete, because some of its passes could not be timed.
+    void SetFrameIncomplete(uint64_t frame_number);
+
+    // Writes the report file and logs the passes with the highest total GPU time.
+    bool Write() const;
+
+  private:
+    struct PassSummary
+    {
+        uint64_t command_buffer_id{ 0 };
+        uint32_t pass_index{ 0 };
+        PassType type{ kRenderPass };
+        uint64_t render_pass_id{ 0 };
+        size_t   count{ 0 };
+        double   min{ 0.0 };
+        double   max{ 0.0 };
+        double   total{ 0.0 };
+    };
+
+  private:
+    // Returns the summaries of the passes that share a command buffer and pass index, sorted by decreasing total time.
+    static std::vector<PassSummary> GetSummaries(const std::vector<PassTiming>& passes);
+
+    static const char* GetTypeName(PassType type);
+
+    bool IsFrameIncomplete(uint64_t frame_number) const;
+
+    bool WriteJson(FILE* file, const std::vector<PassTiming>& passes, const std::vector<PassSummary>& summaries) const;
+
+    bool WriteCsv(FILE* file, const std::vector<PassTiming>& passes) const;
+
+  private:
+    std::string             filename_;
+    bool                    write_csv_;
+    uint32_t                first_frame_;
+    uint32_t                last_frame_;
+    std::vector<PassTiming> passes_;
+    std::vector<uint64_t>   incomplete_frames_;
+};
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_GRAPHICS_PASS_TIMING_REPORT_H
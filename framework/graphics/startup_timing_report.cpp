@@ -0,0 +1,184 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "graphics/startup_timing_report.h"
+
+#include "util/date_time.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cstdio>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+// JSON member names of the phases, in Phase order.
+const char* const kPhaseNames[StartupTimingReport::kPhaseCount] = { "initialize_loader",
+                                                                    "file_processor_initialize",
+                                                                    "realign_pre_pass",
+                                                                    "create_instance",
+                                                                    "create_device",
+                                                                    "state_resource_initialization",
+                                                                    "state_pipeline_creation" };
+
+StartupTimingReport::ScopedPhase::ScopedPhase(StartupTimingReport* report, Phase phase) :
+    report_(report), phase_(phase), start_time_(0)
+{
+    if (report_ != nullptr)
+    {
+        start_time_ = util::datetime::GetTimestamp();
+    }
+}
+
+StartupTimingReport::ScopedPhase::~ScopedPhase()
+{
+    if (report_ != nullptr)
+    {
+        report_->AddPhaseTime(phase_, util::datetime::DiffTimestamps(start_time_, util::datetime::GetTimestamp()));
+    }
+}
+
+StartupTimingReport::StartupTimingReport(const std::string& filename) :
+    filename_(filename), start_time_(util::datetime::GetTimestamp()), phase_times_{}, state_load_start_time_(0),
+    state_load_phase_times_{}, state_load_time_(0), state_object_creation_time_(0), first_present_time_(0)
+{}
+
+void StartupTimingReport::AddPhaseTime(Phase phase, int64_t time)
+{
+    assert(phase < kPhaseCount);
+    phase_times_[phase] += time;
+}
+
+void StartupTimingReport::BeginStateLoad()
+{
+    state_load_start_time_ = util::datetime::GetTimestamp();
+
+    for (uint32_t i = 0; i < kPhaseCount; ++i)
+    {
+        state_load_phase_times_[i] = phase_times_[i];
+    }
+}
+
+void StartupTimingReport::EndStateLoad()
+{
+    if (state_load_start_time_ == 0)
+    {
+        return;
+    }
+
+    int64_t region_time = util::datetime::DiffTimestamps(state_load_start_time_, util::datetime::GetTimestamp());
+    int64_t phases_time = 0;
+
+    for (uint32_t i = 0; i < kPhaseCount; ++i)
+    {
+        phases_time += phase_times_[i] - state_load_phase_times_[i];
+    }
+
+    state_load_time_ += region_time;
+    state_object_creation_time_ += (region_time > phases_time) ? (region_time - phases_time) : 0;
+    state_load_start_time_ = 0;
+}
+
+void StartupTimingReport::SetFirstPresent()
+{
+    if (first_present_time_ == 0)
+    {
+        first_present_time_ = util::datetime::GetTimestamp();
+    }
+}
+
+bool StartupTimingReport::Write() const
+{
+    double first_present = 0.0;
+
+    if (first_present_time_ != 0)
+    {
+        first_present = util::datetime::ConvertTimestampToMilliseconds(
+            util::datetime::DiffTimestamps(start_time_, first_present_time_));
+    }
+
+    GFXRECON_WRITE_CONSOLE("Startup timing (milliseconds):");
+
+    for (uint32_t i = 0; i < kPhaseCount; ++i)
+    {
+        GFXRECON_WRITE_CONSOLE(
+            "  %-30s %10.3f", kPhaseNames[i], util::datetime::ConvertTimestampToMilliseconds(phase_times_[i]));
+    }
+
+    GFXRECON_WRITE_CONSOLE(
+        "  %-30s %10.3f", "state_load", util::datetime::ConvertTimestampToMilliseconds(state_load_time_));
+    GFXRECON_WRITE_CONSOLE("  %-30s %10.3f",
+                           "state_object_creation",
+                           util::datetime::ConvertTimestampToMilliseconds(state_object_creation_time_));
+
+    if (first_present_time_ != 0)
+    {
+        GFXRECON_WRITE_CONSOLE("  %-30s %10.3f", "first_present", first_present);
+    }
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename_.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open startup timing report file %s", filename_.c_str());
+        return false;
+    }
+
+    bool success = (fprintf(file, "{\n  \"phases_ms\": {") >= 0);
+
+    for (uint32_t i = 0; success && (i < kPhaseCount); ++i)
+    {
+        success = (fprintf(file,
+                           "\n    \"%s\": %.6f,",
+                           kPhaseNames[i],
+                           util::datetime::ConvertTimestampToMilliseconds(phase_times_[i])) >= 0);
+    }
+
+    success = success && (fprintf(file,
+                                  "\n    \"state_load\": %.6f,\n    \"state_object_creation\": %.6f\n  },",
+                                  util::datetime::ConvertTimestampToMilliseconds(state_load_time_),
+                                  util::datetime::ConvertTimestampToMilliseconds(state_object_creation_time_)) >= 0);
+
+    if (success && (first_present_time_ != 0))
+    {
+        success = (fprintf(file, "\n  \"first_present_ms\": %.6f\n}\n", first_present) >= 0);
+    }
+    else if (success)
+    {
+        success = (fprintf(file, "\n  \"first_present_ms\": null\n}\n") >= 0);
+    }
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write startup timing report file %s", filename_.c_str());
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,101 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_GRAPHICS_STARTUP_TIMING_REPORT_H
+#define GFXRECON_GRAPHICS_STARTUP_TIMING_REPORT_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+// Collects the wall time of the phases of replay startup, from the creation of the report to the first present, and
+// writes them to a JSON file.
+class StartupTimingReport
+{
+  public:
+    enum Phase : uint32_t
+    {
+        kInitializeLoader = 0,
+        kFileProcessorInitialize,
+        kRealignPrePass,
+        kCreateInstance,
+        kCreateDevice,
+        kStateResourceInitialization, // Memory fills and resource initialization commands of the state snapshot.
+        kStatePipelineCreation,       // Pipeline creation calls of the state snapshot.
+        kPhaseCount
+    };
+
+    // Adds the time from its construction to its destruction to a phase of a report, which may be null.
+    class ScopedPhase
+    {
+      public:
+        ScopedPhase(StartupTimingReport* report, Phase phase);
+
+        ~ScopedPhase();
+
+      private:
+        StartupTimingReport* report_;
+        Phase                phase_;
+        int64_t              start_time_;
+    };
+
+  public:
+    // Replay startup is timed from the construction of the report.
+    StartupTimingReport(const std::string& filename);
+
+    // Times are timestamp differences from util::datetime.
+    void AddPhaseTime(Phase phase, int64_t time);
+
+    // Begins and ends the state snapshot region of a trimmed capture file.  The object creation time of the region is
+    // the time that is not spent in the phases that were timed within it.
+    void BeginStateLoad();
+
+    void EndStateLoad();
+
+    bool HasFirstPresent() const { return first_present_time_ != 0; }
+
+    // Records the time to the first present, and ignores the presents that follow it.
+    void SetFirstPresent();
+
+    // Writes the report file and logs the phase times.
+    bool Write() const;
+
+  private:
+    std::string filename_;
+    int64_t     start_time_;
+    int64_t     phase_times_[kPhaseCount];
+    int64_t     state_load_start_time_;
+    int64_t     state_load_phase_times_[kPhaseCount]; // Phase times at the start of the state snapshot region.
+    int64_t     state_load_time_;
+    int64_t     state_object_creation_time_;
+    int64_t     first_present_time_;
+};
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_GRAPHICS_STARTUP_TIMING_REPORT_H
@@ -25,8 +25,12 @@
 
 #include "util/logging.h"
 
+#include <cassert>
+#include <cerrno>
 #include <cinttypes>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <sstream>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -291,5 +295,28 @@ const std::string& ArgumentParser::GetArgumentValue(const std::string& argument)
     return empty_string;
 }
 
+bool ParseUnsignedInteger(const std::string& value, uint32_t* result)
+{
+    assert(result != nullptr);
+
+    if (value.empty() || (value.find_first_not_of("0123456789") != std::string::npos))
+    {
+        return false;
+    }
+
+    char* end = nullptr;
+    errno     = 0;
+
+    unsigned long long parsed = std::strtoull(value.c_str(), &end, 10);
+
+    if ((errno != 0) || (*end != '\0') || (parsed > std::numeric_limits<uint32_t>::max()))
+    {
+        return false;
+    }
+
+    (*result) = static_cast<uint32_t>(parsed);
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
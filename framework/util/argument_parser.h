@@ -26,6 +26,7 @@
 
 #include "util/defines.h"
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -70,6 +71,11 @@ class ArgumentParser
     std::vector<std::string>                  positional_arguments_present_;
 };
 
+// Parses a decimal argument value that fits in 32 bits.  Unlike std::stoi and std::strtoul, rejects values that are not
+// numbers, have a sign or trailing characters, or are out of range, without throwing.  The result is not modified when
+// the value is invalid.
+bool ParseUnsignedInteger(const std::string& value, uint32_t* result);
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -0,0 +1,205 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/async_output_stream.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+AsyncOutputStream::AsyncOutputStream(std::unique_ptr<OutputStream> target, size_t buffer_size) :
+    target_(std::move(target)), ring_buffer_(buffer_size), shutdown_(false), write_failed_(false),
+    writer_waiting_(false)
+{
+    assert(target_ != nullptr);
+
+    writer_thread_ = std::thread(&AsyncOutputStream::ProcessRecords, this);
+}
+
+AsyncOutputStream::~AsyncOutputStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        shutdown_ = true;
+    }
+
+    writer_wake_.notify_one();
+
+    if (writer_thread_.joinable())
+    {
+        writer_thread_.join();
+    }
+
+    target_->Flush();
+}
+
+size_t AsyncOutputStream::Write(const void* data, size_t len)
+{
+    OutputBuffer buffer = { data, len };
+    return WriteBuffers(&buffer, 1);
+}
+
+size_t AsyncOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    size_t len = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        len += buffers[i].size;
+    }
+
+    if (len > 0)
+    {
+        if (len <= ring_buffer_.GetMaxRecordSize())
+        {
+            Submit(kDataRecord, buffers, count, len);
+        }
+        else
+        {
+            // The write is too large for the ring buffer, so the ring buffer record references a copy of the data.
+            auto copy = new std::vector<uint8_t>;
+            copy->reserve(len);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(buffers[i].data);
+                copy->insert(copy->end(), bytes, bytes + buffers[i].size);
+            }
+
+            OutputBuffer reference = { &copy, sizeof(copy) };
+            Submit(kIndirectRecord, &reference, 1, reference.size);
+        }
+    }
+
+    return len;
+}
+
+void AsyncOutputStream::Flush()
+{
+    Submit(kFlushRecord, nullptr, 0, 0);
+}
+
+void AsyncOutputStream::Submit(uint32_t record_type, const OutputBuffer* buffers, size_t count, size_t len)
+{
+    uint8_t* record_data = nullptr;
+
+    while ((record_data = ring_buffer_.Reserve(len)) == nullptr)
+    {
+        // The ring buffer is full, so wait for the writer thread to release space.
+        std::this_thread::yield();
+    }
+
+    uint8_t* dst = record_data;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (buffers[i].size > 0)
+        {
+            memcpy(dst, buffers[i].data, buffers[i].size);
+            dst += buffers[i].size;
+        }
+    }
+
+    ring_buffer_.Commit(record_data, record_type);
+
+    // Pairs with the fence in ProcessRecords(), to ensure that either the writer sees the committed record before
+    // waiting, or this thread sees that the writer is waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (writer_waiting_.load(std::memory_order_relaxed))
+    {
+        // Acquiring the mutex ensures that the writer thread is blocked on the condition variable, and not between
+        // its last check of the ring buffer and the wait, before it is notified.
+        {
+            std::lock_guard<std::mutex> lock(writer_mutex_);
+        }
+
+        writer_wake_.notify_one();
+    }
+}
+
+void AsyncOutputStream::ProcessRecords()
+{
+    MpscRingBuffer::Record record;
+
+    for (;;)
+    {
+        if (ring_buffer_.Peek(&record))
+        {
+            if (record.type == kFlushRecord)
+            {
+                target_->Flush();
+            }
+            else if (record.type == kIndirectRecord)
+            {
+                std::vector<uint8_t>* copy = nullptr;
+                memcpy(&copy, record.data, sizeof(copy));
+
+                WriteToTarget(copy->data(), copy->size());
+
+                delete copy;
+            }
+            else
+            {
+                WriteToTarget(record.data, record.size);
+            }
+
+            ring_buffer_.Pop();
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(writer_mutex_);
+
+            writer_waiting_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Shutdown is only requested after all writes have completed, so an empty ring buffer at shutdown means
+            // that all data has been written.
+            writer_wake_.wait(lock,
+                              [&]() { return ring_buffer_.Peek(&record) || (shutdown_ && ring_buffer_.IsEmpty()); });
+
+            writer_waiting_.store(false, std::memory_order_relaxed);
+
+            if (shutdown_ && ring_buffer_.IsEmpty())
+            {
+                break;
+            }
+        }
+    }
+}
+
+void AsyncOutputStream::WriteToTarget(const uint8_t* data, size_t len)
+{
+    size_t written = target_->Write(data, len);
+    if ((written != len) && !write_failed_)
+    {
+        // Only report the first failure, as all subsequent writes are likely to fail for the same reason.
+        write_failed_ = true;
+        GFXRECON_LOG_ERROR("Asynchronous write to capture file failed; capture file will be incomplete");
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,102 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_ASYNC_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_ASYNC_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/mpsc_ring_buffer.h"
+#include "util/output_stream.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that forwards writes to a target stream from a dedicated writer thread.  Data passed to Write() is
+// copied to a lock-free ring buffer, so calling threads do not contend with each other or wait for file I/O unless the
+// buffer is full.  Data is written to the target stream in the order that space was reserved by Write(), across all
+// threads.
+class AsyncOutputStream : public OutputStream
+{
+  public:
+    static const size_t kDefaultBufferSize = 16 * 1024 * 1024;
+
+  public:
+    // buffer_size is the capacity of the ring buffer, and the maximum number of bytes that can be pending before
+    // Write() blocks.  Writes that are too large for the ring buffer are copied to a separate allocation.
+    AsyncOutputStream(std::unique_ptr<OutputStream> target, size_t buffer_size = kDefaultBufferSize);
+
+    // Blocks until all pending data has been written to the target stream.
+    virtual ~AsyncOutputStream() override;
+
+    virtual bool IsValid() override { return (target_ != nullptr) && target_->IsValid(); }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    // Buffers are copied directly to a single ring buffer record.
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count) override;
+
+    // Requests a flush of the target stream, which the writer thread performs after writing all data queued before
+    // the request.  Does not wait for the flush to complete.
+    virtual void Flush() override;
+
+    // Bytes queued in the ring buffer that the writer thread has not written to the target stream, excluding the data
+    // of writes that were too large for the ring buffer.  May be called from any thread.
+    size_t GetPendingSize() const { return ring_buffer_.GetUsedSize(); }
+
+  private:
+    enum RecordType : uint32_t
+    {
+        kDataRecord     = 0,
+        kFlushRecord    = 1,
+        kIndirectRecord = 2 // Record data is a pointer to a heap allocated std::vector<uint8_t>.
+    };
+
+  private:
+    void Submit(uint32_t record_type, const OutputBuffer* buffers, size_t count, size_t len);
+
+    void ProcessRecords();
+
+    void WriteToTarget(const uint8_t* data, size_t len);
+
+  private:
+    std::unique_ptr<OutputStream> target_;
+    MpscRingBuffer                ring_buffer_;
+    bool                          shutdown_;
+    bool                          write_failed_;
+    std::atomic<bool>             writer_waiting_;
+    std::mutex                    writer_mutex_;
+    std::condition_variable       writer_wake_;
+    std::thread                   writer_thread_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_ASYNC_OUTPUT_STREAM_H
@@ -40,16 +40,74 @@ class Compressor
 
     virtual ~Compressor() {}
 
+    // Returns the worst case size of the compressed data for uncompressed_size bytes of input.  A compressed_data
+    // buffer of this size is large enough for any call to Compress.
+    virtual size_t GetMaxCompressedSize(size_t uncompressed_size) const = 0;
+
+    // Compresses into a caller provided buffer, without allocating memory.  Returns the size of the compressed data,
+    // or 0 if compression failed or the compressed data did not fit in compressed_capacity bytes.
+    virtual size_t Compress(const size_t   uncompressed_size,
+                            const uint8_t* uncompressed_data,
+                            const size_t   compressed_capacity,
+                            uint8_t*       compressed_data) = 0;
+
+    // Decompresses into a caller provided buffer of uncompressed_capacity bytes, without allocating memory.  Returns
+    // the size of the decompressed data, or 0 if decompression failed.
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   uncompressed_capacity,
+                              uint8_t*       uncompressed_data) = 0;
+
     // If needed, compressed_data will be resized to fit the compressed data + compressed_data_offset.
-    virtual size_t Compress(const size_t          uncompressed_size,
-                            const uint8_t*        uncompressed_data,
-                            std::vector<uint8_t>* compressed_data,
-                            size_t                compressed_data_offset) = 0;
-
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) = 0;
+    size_t Compress(const size_t          uncompressed_size,
+                    const uint8_t*        uncompressed_data,
+                    std::vector<uint8_t>* compressed_data,
+                    size_t                compressed_data_offset)
+    {
+        if (nullptr == compressed_data)
+        {
+            return 0;
+        }
+
+        size_t max_compressed_size = GetMaxCompressedSize(uncompressed_size);
+
+        if ((compressed_data_offset + max_compressed_size) > compressed_data->size())
+        {
+            compressed_data->resize(compressed_data_offset + max_compressed_size);
+        }
+
+        return Compress(uncompressed_size,
+                        uncompressed_data,
+                        compressed_data->size() - compressed_data_offset,
+                        compressed_data->data() + compressed_data_offset);
+    }
+
+    // If needed, uncompressed_data will be resized to fit expected_uncompressed_size bytes.
+    size_t Decompress(const size_t          compressed_size,
+                      const uint8_t*        compressed_data,
+                      const size_t          expected_uncompressed_size,
+                      std::vector<uint8_t>* uncompressed_data)
+    {
+        if (nullptr == uncompressed_data)
+        {
+            return 0;
+        }
+
+        if (expected_uncompressed_size > uncompressed_data->size())
+        {
+            uncompressed_data->resize(expected_uncompressed_size);
+        }
+
+        return Decompress(compressed_size, compressed_data, expected_uncompressed_size, uncompressed_data->data());
+    }
+
+    // Set a dictionary to use for all subsequent compression and decompression operations.  Returns false if the
+    // compressor does not support dictionaries or the dictionary could not be loaded.
+    virtual bool SetDictionary(const std::vector<uint8_t>& dictionary)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary);
+        return false;
+    }
 };
 
 GFXRECON_END_NAMESPACE(util)
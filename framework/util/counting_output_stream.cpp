@@ -0,0 +1,64 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/counting_output_stream.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+CountingOutputStream::CountingOutputStream(std::unique_ptr<OutputStream> target) :
+    target_(std::move(target)), bytes_written_(0)
+{
+    assert(target_ != nullptr);
+}
+
+CountingOutputStream::~CountingOutputStream() {}
+
+void CountingOutputStream::Reset()
+{
+    target_->Reset();
+    bytes_written_.store(0, std::memory_order_release);
+}
+
+size_t CountingOutputStream::Write(const void* data, size_t len)
+{
+    size_t written = target_->Write(data, len);
+    bytes_written_.fetch_add(written, std::memory_order_acq_rel);
+    return written;
+}
+
+size_t CountingOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    size_t written = target_->WriteBuffers(buffers, count);
+    bytes_written_.fetch_add(written, std::memory_order_acq_rel);
+    return written;
+}
+
+void CountingOutputStream::Flush()
+{
+    target_->Flush();
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
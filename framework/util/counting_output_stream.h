@@ -0,0 +1,65 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_COUNTING_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_COUNTING_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that counts the bytes written to the target stream.  When the target stream writes data to a file
+// without changing its size, the count is the file offset for the next write.
+class CountingOutputStream : public OutputStream
+{
+  public:
+    CountingOutputStream(std::unique_ptr<OutputStream> target);
+
+    virtual ~CountingOutputStream() override;
+
+    virtual bool IsValid() override { return (target_ != nullptr) && target_->IsValid(); }
+
+    virtual void Reset() override;
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count) override;
+
+    virtual void Flush() override;
+
+    uint64_t GetBytesWritten() const { return bytes_written_.load(std::memory_order_acquire); }
+
+  private:
+    std::unique_ptr<OutputStream> target_;
+    std::atomic<uint64_t>         bytes_written_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_COUNTING_OUTPUT_STREAM_H
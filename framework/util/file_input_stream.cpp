@@ -0,0 +1,108 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/file_input_stream.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+FileInputStream::FileInputStream(const std::string& filename) : file_(nullptr), own_file_(true), seekable_(false)
+{
+    int32_t result = platform::FileOpen(&file_, filename.c_str(), "rb");
+
+    if (file_ != nullptr)
+    {
+        CheckSeekable();
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("fopen(%s, rb) failed (errno = %d)", filename.c_str(), result);
+    }
+}
+
+FileInputStream::FileInputStream(FILE* file, bool owned) : file_(file), own_file_(owned), seekable_(false)
+{
+    if (file_ != nullptr)
+    {
+        CheckSeekable();
+    }
+}
+
+FileInputStream::~FileInputStream()
+{
+    if ((file_ != nullptr) && own_file_)
+    {
+        platform::FileClose(file_);
+    }
+}
+
+std::unique_ptr<FileInputStream> FileInputStream::OpenStandardInput()
+{
+    if (!platform::SetFileBinaryMode(stdin))
+    {
+        GFXRECON_LOG_WARNING("Failed to set standard input to binary mode");
+    }
+
+    return std::make_unique<FileInputStream>(stdin, false);
+}
+
+size_t FileInputStream::Read(void* data, size_t len)
+{
+    return platform::FileRead(data, 1, len, file_);
+}
+
+bool FileInputStream::Skip(size_t len)
+{
+    if (seekable_)
+    {
+        return platform::FileSeek(file_, static_cast<int64_t>(len), platform::FileSeekCurrent);
+    }
+
+    return InputStream::Skip(len);
+}
+
+bool FileInputStream::Seek(uint64_t offset)
+{
+    return seekable_ && platform::FileSeek(file_, static_cast<int64_t>(offset), platform::FileSeekSet);
+}
+
+bool FileInputStream::IsEof() const
+{
+    return (feof(file_) != 0);
+}
+
+bool FileInputStream::HasError() const
+{
+    return (ferror(file_) != 0);
+}
+
+void FileInputStream::CheckSeekable()
+{
+    // Seeking to the current position fails for pipes and terminals.
+    seekable_ = (platform::FileTell(file_) >= 0) && platform::FileSeek(file_, 0, platform::FileSeekCurrent);
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
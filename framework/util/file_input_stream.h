@@ -0,0 +1,76 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_FILE_INPUT_STREAM_H
+#define GFXRECON_UTIL_FILE_INPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/input_stream.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Input stream that reads from a C stdio stream.  The stream is seekable when the underlying file supports seeking,
+// which is not the case when reading from a pipe.
+class FileInputStream : public InputStream
+{
+  public:
+    FileInputStream(const std::string& filename);
+
+    FileInputStream(FILE* file, bool owned = false);
+
+    virtual ~FileInputStream() override;
+
+    // Reads from the process's standard input, which is switched to binary mode.
+    static std::unique_ptr<FileInputStream> OpenStandardInput();
+
+    virtual bool IsValid() override { return (file_ != nullptr); }
+
+    virtual size_t Read(void* data, size_t len) override;
+
+    virtual bool Skip(size_t len) override;
+
+    virtual bool IsSeekable() const override { return seekable_; }
+
+    virtual bool Seek(uint64_t offset) override;
+
+    virtual bool IsEof() const override;
+
+    virtual bool HasError() const override;
+
+  private:
+    void CheckSeekable();
+
+  private:
+    FILE* file_;
+    bool  own_file_;
+    bool  seekable_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_FILE_INPUT_STREAM_H
@@ -59,10 +59,36 @@ FileOutputStream::~FileOutputStream()
     }
 }
 
+std::unique_ptr<FileOutputStream> FileOutputStream::OpenStandardOutput()
+{
+    if (!platform::SetFileBinaryMode(stdout))
+    {
+        GFXRECON_LOG_WARNING("Failed to set standard output to binary mode");
+    }
+
+    return std::make_unique<FileOutputStream>(stdout, false);
+}
+
 size_t FileOutputStream::Write(const void* data, size_t len)
 {
     return platform::FileWrite(data, 1, len, file_);
 }
 
+size_t FileOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    size_t written = 0;
+
+    platform::FileLock(file_);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        written += platform::FileWriteNoLock(buffers[i].data, 1, buffers[i].size, file_);
+    }
+
+    platform::FileUnlock(file_);
+
+    return written;
+}
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -29,6 +29,7 @@
 #include "util/platform.h"
 
 #include <cstdio>
+#include <memory>
 #include <string>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -44,12 +45,23 @@ class FileOutputStream : public OutputStream
 
     virtual ~FileOutputStream() override;
 
+    // Writes to the process's standard output, which is switched to binary mode.
+    static std::unique_ptr<FileOutputStream> OpenStandardOutput();
+
     virtual bool IsValid() override { return (file_ != nullptr); }
 
     virtual size_t Write(const void* data, size_t len) override;
 
+    // Holds the file lock while writing the buffers, so that each buffer is written directly from its source memory.
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count) override;
+
     virtual void Flush() override { platform::FileFlush(file_); }
 
+    virtual uint64_t CopyFromFile(FILE* file, uint64_t offset, uint64_t size) override
+    {
+        return platform::FileCopyRange(file_, file, offset, size);
+    }
+
   private:
     FILE* file_;
     bool  own_file_;
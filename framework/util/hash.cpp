@@ -23,6 +23,17 @@
 
 #include "util/hash.h"
 
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_HASH_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GFXRECON_HASH_NEON
+#endif
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 GFXRECON_BEGIN_NAMESPACE(hash)
@@ -40,6 +51,474 @@ uint32_t CheckSum(const uint32_t* code, size_t code_size)
     return sum;
 }
 
+static const uint64_t kPrime64_1 = 0x9e3779b185ebca87ull;
+static const uint64_t kPrime64_2 = 0xc2b2ae3d27d4eb4full;
+static const uint64_t kPrime64_3 = 0x165667b19e3779f9ull;
+static const uint64_t kPrime64_4 = 0x85ebca77c2b2ae63ull;
+static const uint64_t kPrime64_5 = 0x27d4eb2f165667c5ull;
+
+static uint64_t RotateLeft(uint64_t value, uint32_t count)
+{
+    return (value << count) | (value >> (64 - count));
+}
+
+static uint64_t Read64(const uint8_t* data)
+{
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static uint32_t Read32(const uint8_t* data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static uint64_t Round(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * kPrime64_2;
+    accumulator = RotateLeft(accumulator, 31);
+    return accumulator * kPrime64_1;
+}
+
+static uint64_t MergeRound(uint64_t accumulator, uint64_t value)
+{
+    accumulator ^= Round(0, value);
+    return accumulator * kPrime64_1 + kPrime64_4;
+}
+
+uint64_t Hash64(const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const uint8_t* end   = bytes + size;
+    uint64_t       hash  = 0;
+
+    if (size >= 32)
+    {
+        const uint8_t* limit = end - 32;
+        uint64_t       v1    = seed + kPrime64_1 + kPrime64_2;
+        uint64_t       v2    = seed + kPrime64_2;
+        uint64_t       v3    = seed;
+        uint64_t       v4    = seed - kPrime64_1;
+
+        do
+        {
+            v1 = Round(v1, Read64(bytes));
+            v2 = Round(v2, Read64(bytes + 8));
+            v3 = Round(v3, Read64(bytes + 16));
+            v4 = Round(v4, Read64(bytes + 24));
+            bytes += 32;
+        } while (bytes <= limit);
+
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = MergeRound(hash, v1);
+        hash = MergeRound(hash, v2);
+        hash = MergeRound(hash, v3);
+        hash = MergeRound(hash, v4);
+    }
+    else
+    {
+        hash = seed + kPrime64_5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while ((bytes + 8) <= end)
+    {
+        hash ^= Round(0, Read64(bytes));
+        hash = RotateLeft(hash, 27) * kPrime64_1 + kPrime64_4;
+        bytes += 8;
+    }
+
+    if ((bytes + 4) <= end)
+    {
+        hash ^= static_cast<uint64_t>(Read32(bytes)) * kPrime64_1;
+        hash = RotateLeft(hash, 23) * kPrime64_2 + kPrime64_3;
+        bytes += 4;
+    }
+
+    while (bytes < end)
+    {
+        hash ^= static_cast<uint64_t>(*bytes) * kPrime64_5;
+        hash = RotateLeft(hash, 11) * kPrime64_1;
+        ++bytes;
+    }
+
+    hash ^= hash >> 33;
+    hash *= kPrime64_2;
+    hash ^= hash >> 29;
+    hash *= kPrime64_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+static const uint32_t kPrime32_1 = 0x9e3779b1u;
+static const uint32_t kPrime32_2 = 0x85ebca77u;
+static const uint32_t kPrime32_3 = 0xc2b2ae3du;
+
+// Default secret of the XXH3 algorithm.
+static const uint8_t kDefaultSecret[] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+static uint64_t Multiply128Fold64(uint64_t lhs, uint64_t rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t lo_lo = (lhs & 0xffffffffull) * (rhs & 0xffffffffull);
+    uint64_t hi_lo = (lhs >> 32) * (rhs & 0xffffffffull);
+    uint64_t lo_hi = (lhs & 0xffffffffull) * (rhs >> 32);
+    uint64_t hi_hi = (lhs >> 32) * (rhs >> 32);
+    uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffull) + lo_hi;
+    uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+    uint64_t lower = (cross << 32) | (lo_lo & 0xffffffffull);
+    return lower ^ upper;
+#endif
+}
+
+static uint64_t Avalanche3(uint64_t hash)
+{
+    hash ^= hash >> 37;
+    hash *= 0x165667919e3779f9ull;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// Adds count consecutive 64 byte stripes to the eight accumulators, where the secret for each stripe is offset by eight
+// bytes from the secret for the previous stripe.
+static void AccumulateStripes(uint64_t* accumulators, const uint8_t* data, size_t count, const uint8_t* secret)
+{
+#if defined(GFXRECON_HASH_SSE2)
+    __m128i* accumulator_ptr = reinterpret_cast<__m128i*>(accumulators);
+    __m128i  accumulator[4];
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        accumulator[i] = _mm_loadu_si128(accumulator_ptr + i);
+    }
+
+    for (size_t stripe = 0; stripe < count; ++stripe)
+    {
+        const __m128i* data_ptr = reinterpret_cast<const __m128i*>(data + (stripe * 64));
+        const __m128i* key_ptr  = reinterpret_cast<const __m128i*>(secret + (stripe * 8));
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            __m128i data_vec    = _mm_loadu_si128(data_ptr + i);
+            __m128i data_key    = _mm_xor_si128(data_vec, _mm_loadu_si128(key_ptr + i));
+            __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+            __m128i product     = _mm_mul_epu32(data_key, data_key_hi);
+            __m128i data_swap   = _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+
+            accumulator[i] = _mm_add_epi64(accumulator[i], data_swap);
+            accumulator[i] = _mm_add_epi64(accumulator[i], product);
+        }
+    }
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        _mm_storeu_si128(accumulator_ptr + i, accumulator[i]);
+    }
+#elif defined(GFXRECON_HASH_NEON)
+    uint64x2_t accumulator[4];
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        accumulator[i] = vld1q_u64(accumulators + (i * 2));
+    }
+
+    for (size_t stripe = 0; stripe < count; ++stripe)
+    {
+        const uint8_t* data_ptr = data + (stripe * 64);
+        const uint8_t* key_ptr  = secret + (stripe * 8);
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            uint64x2_t data_vec    = vreinterpretq_u64_u8(vld1q_u8(data_ptr + (i * 16)));
+            uint64x2_t key_vec     = vreinterpretq_u64_u8(vld1q_u8(key_ptr + (i * 16)));
+            uint64x2_t data_key    = veorq_u64(data_vec, key_vec);
+            uint32x2_t data_key_lo = vmovn_u64(data_key);
+            uint32x2_t data_key_hi = vshrn_n_u64(data_key, 32);
+            uint64x2_t data_swap   = vextq_u64(data_vec, data_vec, 1);
+
+            accumulator[i] = vaddq_u64(accumulator[i], data_swap);
+            accumulator[i] = vmlal_u32(accumulator[i], data_key_lo, data_key_hi);
+        }
+    }
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        vst1q_u64(accumulators + (i * 2), accumulator[i]);
+    }
+#else
+    for (size_t stripe = 0; stripe < count; ++stripe)
+    {
+        const uint8_t* data_ptr = data + (stripe * 64);
+        const uint8_t* key_ptr  = secret + (stripe * 8);
+
+        for (size_t i = 0; i < 8; ++i)
+        {
+            uint64_t data_val = Read64(data_ptr + (i * 8));
+            uint64_t data_key = data_val ^ Read64(key_ptr + (i * 8));
+
+            accumulators[i ^ 1] += data_val;
+            accumulators[i] += (data_key & 0xffffffffull) * (data_key >> 32);
+        }
+    }
+#endif
+}
+
+// Mixes the accumulators at the end of a block of stripes.
+static void ScrambleAccumulators(uint64_t* accumulators, const uint8_t* secret)
+{
+#if defined(GFXRECON_HASH_SSE2)
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(kPrime32_1));
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        __m128i accumulator = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+        __m128i key_vec     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+
+        accumulator = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+        accumulator = _mm_xor_si128(accumulator, key_vec);
+
+        __m128i accumulator_hi = _mm_shuffle_epi32(accumulator, _MM_SHUFFLE(0, 3, 0, 1));
+        __m128i product_lo     = _mm_mul_epu32(accumulator, prime);
+        __m128i product_hi     = _mm_mul_epu32(accumulator_hi, prime);
+
+        accumulator = _mm_add_epi64(product_lo, _mm_slli_epi64(product_hi, 32));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators) + i, accumulator);
+    }
+#elif defined(GFXRECON_HASH_NEON)
+    const uint32x2_t prime = vdup_n_u32(kPrime32_1);
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        uint64x2_t accumulator = vld1q_u64(accumulators + (i * 2));
+        uint64x2_t key_vec     = vreinterpretq_u64_u8(vld1q_u8(secret + (i * 16)));
+
+        accumulator = veorq_u64(accumulator, vshrq_n_u64(accumulator, 47));
+        accumulator = veorq_u64(accumulator, key_vec);
+
+        uint32x2_t accumulator_lo = vmovn_u64(accumulator);
+        uint32x2_t accumulator_hi = vshrn_n_u64(accumulator, 32);
+        uint64x2_t product_hi     = vshlq_n_u64(vmull_u32(accumulator_hi, prime), 32);
+
+        accumulator = vmlal_u32(product_hi, accumulator_lo, prime);
+        vst1q_u64(accumulators + (i * 2), accumulator);
+    }
+#else
+    for (size_t i = 0; i < 8; ++i)
+    {
+        uint64_t accumulator = accumulators[i];
+        accumulator ^= accumulator >> 47;
+        accumulator ^= Read64(secret + (i * 8));
+        accumulators[i] = accumulator * kPrime32_1;
+    }
+#endif
+}
+
+void ContentHasher::Reset(uint64_t seed)
+{
+    static_assert(sizeof(kDefaultSecret) == kSecretSize, "Unexpected secret size");
+
+    seed_          = seed;
+    total_size_    = 0;
+    block_stripes_ = 0;
+    buffered_size_ = 0;
+
+    accumulators_[0] = kPrime32_3;
+    accumulators_[1] = kPrime64_1;
+    accumulators_[2] = kPrime64_2;
+    accumulators_[3] = kPrime64_3;
+    accumulators_[4] = kPrime64_4;
+    accumulators_[5] = kPrime32_2;
+    accumulators_[6] = kPrime64_5;
+    accumulators_[7] = kPrime32_1;
+
+    // Derive the secret from the seed, as is done by XXH3.
+    for (size_t i = 0; i < kSecretSize; i += 16)
+    {
+        uint64_t lo = Read64(kDefaultSecret + i) + seed;
+        uint64_t hi = Read64(kDefaultSecret + i + 8) - seed;
+        memcpy(secret_ + i, &lo, sizeof(lo));
+        memcpy(secret_ + i + 8, &hi, sizeof(hi));
+    }
+}
+
+void ContentHasher::Update(const void* data, size_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    total_size_ += size;
+
+    if ((buffered_size_ + size) <= kBufferSize)
+    {
+        // Buffered data is only consumed when more data follows it, as the last stripe is processed by the digest.
+        if (size > 0)
+        {
+            memcpy(buffer_ + buffered_size_, bytes, size);
+            buffered_size_ += size;
+        }
+        return;
+    }
+
+    if (buffered_size_ > 0)
+    {
+        size_t fill_size = kBufferSize - buffered_size_;
+        memcpy(buffer_ + buffered_size_, bytes, fill_size);
+        bytes += fill_size;
+        size -= fill_size;
+
+        ConsumeStripes(accumulators_, &block_stripes_, buffer_, kBufferSize / kStripeSize);
+        memcpy(last_stripe_, buffer_ + kBufferSize - kStripeSize, kStripeSize);
+        buffered_size_ = 0;
+    }
+
+    if (size > kStripeSize)
+    {
+        // Consume the stripes directly from the input, leaving at least one byte for the buffer.
+        size_t stripe_count = (size - 1) / kStripeSize;
+        size_t stripe_bytes = stripe_count * kStripeSize;
+
+        ConsumeStripes(accumulators_, &block_stripes_, bytes, stripe_count);
+        memcpy(last_stripe_, bytes + stripe_bytes - kStripeSize, kStripeSize);
+        bytes += stripe_bytes;
+        size -= stripe_bytes;
+    }
+
+    memcpy(buffer_, bytes, size);
+    buffered_size_ = size;
+}
+
+uint64_t ContentHasher::Digest64() const
+{
+    if (total_size_ < kMinStripeHashSize)
+    {
+        // All of the data is still buffered.
+        return Hash64(buffer_, buffered_size_, seed_);
+    }
+
+    uint64_t accumulators[kAccumulatorSize];
+    FinalizeAccumulators(accumulators);
+
+    return MergeAccumulators(accumulators, 11, total_size_ * kPrime64_1);
+}
+
+Hash128 ContentHasher::Digest128() const
+{
+    Hash128 hash;
+
+    if (total_size_ < kMinStripeHashSize)
+    {
+        hash.low  = Hash64(buffer_, buffered_size_, seed_);
+        hash.high = Hash64(buffer_, buffered_size_, seed_ ^ kPrime64_2);
+    }
+    else
+    {
+        uint64_t accumulators[kAccumulatorSize];
+        FinalizeAccumulators(accumulators);
+
+        hash.low  = MergeAccumulators(accumulators, 11, total_size_ * kPrime64_1);
+        hash.high = MergeAccumulators(accumulators, kSecretSize - kStripeSize - 11, ~(total_size_ * kPrime64_2));
+    }
+
+    return hash;
+}
+
+void ContentHasher::ConsumeStripes(uint64_t*      accumulators,
+                                   size_t*        block_stripes,
+                                   const uint8_t* data,
+                                   size_t         count) const
+{
+    while (count > 0)
+    {
+        // Accumulate the stripes up to the end of the current block, which is followed by a scramble.
+        size_t block_count = std::min(count, kStripesPerBlock - (*block_stripes));
+
+        AccumulateStripes(accumulators, data, block_count, secret_ + ((*block_stripes) * 8));
+
+        data += block_count * kStripeSize;
+        count -= block_count;
+        (*block_stripes) += block_count;
+
+        if ((*block_stripes) == kStripesPerBlock)
+        {
+            ScrambleAccumulators(accumulators, secret_ + kSecretSize - kStripeSize);
+            (*block_stripes) = 0;
+        }
+    }
+}
+
+void ContentHasher::FinalizeAccumulators(uint64_t* accumulators) const
+{
+    memcpy(accumulators, accumulators_, sizeof(accumulators_));
+
+    size_t         block_stripes = block_stripes_;
+    const uint8_t* last_stripe   = nullptr;
+    uint8_t        combined_stripe[kStripeSize];
+
+    if (buffered_size_ >= kStripeSize)
+    {
+        ConsumeStripes(accumulators, &block_stripes, buffer_, (buffered_size_ - 1) / kStripeSize);
+        last_stripe = buffer_ + buffered_size_ - kStripeSize;
+    }
+    else
+    {
+        // The last stripe overlaps the previously consumed data.
+        size_t previous_size = kStripeSize - buffered_size_;
+        memcpy(combined_stripe, last_stripe_ + buffered_size_, previous_size);
+        memcpy(combined_stripe + previous_size, buffer_, buffered_size_);
+        last_stripe = combined_stripe;
+    }
+
+    AccumulateStripes(accumulators, last_stripe, 1, secret_ + kSecretSize - kStripeSize - 7);
+}
+
+uint64_t ContentHasher::MergeAccumulators(const uint64_t* accumulators, size_t secret_offset, uint64_t start) const
+{
+    uint64_t       result = start;
+    const uint8_t* secret = secret_ + secret_offset;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        result += Multiply128Fold64(accumulators[i * 2] ^ Read64(secret + (i * 16)),
+                                    accumulators[(i * 2) + 1] ^ Read64(secret + (i * 16) + 8));
+    }
+
+    return Avalanche3(result);
+}
+
+uint64_t ContentHash64(const void* data, size_t size, uint64_t seed)
+{
+    ContentHasher hasher(seed);
+    hasher.Update(data, size);
+    return hasher.Digest64();
+}
+
+Hash128 ContentHash128(const void* data, size_t size, uint64_t seed)
+{
+    ContentHasher hasher(seed);
+    hasher.Update(data, size);
+    return hasher.Digest128();
+}
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -27,6 +27,7 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
@@ -34,6 +35,68 @@ GFXRECON_BEGIN_NAMESPACE(hash)
 
 uint32_t CheckSum(const uint32_t* code, size_t code_size);
 
+// 64-bit hash of arbitrary data, computed with the XXH64 algorithm.  Suitable for identifying large data payloads with
+// identical content.
+uint64_t Hash64(const void* data, size_t size, uint64_t seed = 0);
+
+struct Hash128
+{
+    uint64_t low{ 0 };
+    uint64_t high{ 0 };
+
+    bool operator==(const Hash128& other) const { return (low == other.low) && (high == other.high); }
+    bool operator!=(const Hash128& other) const { return !(*this == other); }
+};
+
+// Incremental 64-bit and 128-bit content hash, for identifying large data payloads at memory bandwidth speeds.  Data of
+// kMinStripeHashSize bytes or more is hashed with the XXH3 stripe accumulation, which processes 64 byte stripes with
+// eight independent lanes and uses SSE2 or NEON instructions when available.  Smaller data is hashed with XXH64.  The
+// result does not depend on how the data is split between calls to Update, and matches ContentHash64/ContentHash128.
+class ContentHasher
+{
+  public:
+    static const size_t kMinStripeHashSize = 240;
+
+  public:
+    ContentHasher(uint64_t seed = 0) { Reset(seed); }
+
+    void Reset(uint64_t seed = 0);
+
+    void Update(const void* data, size_t size);
+
+    uint64_t Digest64() const;
+
+    Hash128 Digest128() const;
+
+  private:
+    static const size_t kStripeSize      = 64;
+    static const size_t kSecretSize      = 192;
+    static const size_t kAccumulatorSize = 8;
+    static const size_t kStripesPerBlock = (kSecretSize - kStripeSize) / 8;
+    static const size_t kBufferSize      = 4 * kStripeSize;
+
+  private:
+    void ConsumeStripes(uint64_t* accumulators, size_t* block_stripes, const uint8_t* data, size_t count) const;
+
+    void FinalizeAccumulators(uint64_t* accumulators) const;
+
+    uint64_t MergeAccumulators(const uint64_t* accumulators, size_t secret_offset, uint64_t start) const;
+
+  private:
+    uint64_t seed_;
+    uint64_t total_size_;
+    uint64_t accumulators_[kAccumulatorSize];
+    size_t   block_stripes_;                   // Number of stripes consumed from the current block.
+    size_t   buffered_size_;                   // Number of bytes in buffer_.
+    uint8_t  buffer_[kBufferSize];             // Data that has not been consumed.
+    uint8_t  last_stripe_[kStripeSize];        // Last stripe of the most recently consumed data.
+    uint8_t  secret_[kSecretSize];             // Default secret, adjusted for the seed.
+};
+
+uint64_t ContentHash64(const void* data, size_t size, uint64_t seed = 0);
+
+Hash128 ContentHash128(const void* data, size_t size, uint64_t seed = 0);
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,199 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/huge_page_buffer.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <new>
+
+#if defined(WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+const size_t kHugePageSize = 2 * 1024 * 1024;
+
+static size_t AlignSize(size_t size, size_t alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+HugePageBuffer::HugePageBuffer() : mode_(kModeNone), data_(nullptr), size_(0), capacity_(0), mapped_(false) {}
+
+HugePageBuffer::~HugePageBuffer()
+{
+    Free();
+}
+
+void HugePageBuffer::SetMode(Mode mode)
+{
+    Reset();
+    mode_ = mode;
+}
+
+void HugePageBuffer::Resize(size_t size)
+{
+    if (size > capacity_)
+    {
+        size_t   capacity = 0;
+        bool     mapped   = false;
+        uint8_t* data     = Allocate(size, &capacity, &mapped);
+
+        if (size_ > 0)
+        {
+            util::platform::MemoryCopy(data, capacity, data_, size_);
+        }
+
+        Free();
+
+        data_     = data;
+        capacity_ = capacity;
+        mapped_   = mapped;
+    }
+
+    size_ = size;
+}
+
+void HugePageBuffer::Reset()
+{
+    Free();
+
+    data_     = nullptr;
+    size_     = 0;
+    capacity_ = 0;
+    mapped_   = false;
+}
+
+uint8_t* HugePageBuffer::Allocate(size_t size, size_t* capacity, bool* mapped)
+{
+    assert((capacity != nullptr) && (mapped != nullptr));
+
+    if ((mode_ != kModeNone) && (size >= kHugePageSize))
+    {
+#if defined(__linux__)
+        size_t aligned_size = AlignSize(size, kHugePageSize);
+
+        if (mode_ == kModeExplicit)
+        {
+            void* memory =
+                mmap(nullptr, aligned_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+            if (memory != MAP_FAILED)
+            {
+                (*capacity) = aligned_size;
+                (*mapped)   = true;
+                return static_cast<uint8_t*>(memory);
+            }
+
+            GFXRECON_LOG_WARNING_ONCE("Failed to allocate memory from the huge page pool, which can be reserved with "
+                                      "/proc/sys/vm/nr_hugepages; using transparent huge pages");
+        }
+
+        // Map an extra huge page and trim the mapping to a huge page aligned range, which the kernel can back with huge
+        // pages.
+        void* memory =
+            mmap(nullptr, aligned_size + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (memory != MAP_FAILED)
+        {
+            uintptr_t address         = reinterpret_cast<uintptr_t>(memory);
+            uintptr_t aligned_address = AlignSize(address, kHugePageSize);
+            size_t    head_size       = aligned_address - address;
+
+            if (head_size > 0)
+            {
+                munmap(memory, head_size);
+            }
+
+            munmap(reinterpret_cast<void*>(aligned_address + aligned_size), kHugePageSize - head_size);
+
+            if (madvise(reinterpret_cast<void*>(aligned_address), aligned_size, MADV_HUGEPAGE) != 0)
+            {
+                GFXRECON_LOG_WARNING_ONCE("Transparent huge pages are not available for decode buffers");
+            }
+
+            (*capacity) = aligned_size;
+            (*mapped)   = true;
+            return reinterpret_cast<uint8_t*>(aligned_address);
+        }
+#elif defined(WIN32)
+        // Windows only provides explicit large pages, which require the SeLockMemoryPrivilege privilege.
+        SIZE_T large_page_size = GetLargePageMinimum();
+
+        if (large_page_size > 0)
+        {
+            size_t large_size = AlignSize(size, large_page_size);
+            void*  memory =
+                VirtualAlloc(nullptr, large_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+
+            if (memory != nullptr)
+            {
+                (*capacity) = large_size;
+                (*mapped)   = true;
+                return static_cast<uint8_t*>(memory);
+            }
+        }
+
+        GFXRECON_LOG_WARNING_ONCE("Failed to allocate large pages for decode buffers; the process may need the "
+                                  "\"Lock pages in memory\" privilege");
+#else
+        GFXRECON_LOG_WARNING_ONCE("Huge pages are not supported for decode buffers on this platform");
+#endif
+    }
+
+    (*capacity) = size;
+    (*mapped)   = false;
+    return new uint8_t[size];
+}
+
+void HugePageBuffer::Free()
+{
+    if (data_ != nullptr)
+    {
+        if (!mapped_)
+        {
+            delete[] data_;
+        }
+        else
+        {
+#if defined(__linux__)
+            munmap(data_, capacity_);
+#elif defined(WIN32)
+            VirtualFree(data_, 0, MEM_RELEASE);
+#endif
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
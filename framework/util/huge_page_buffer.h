@@ -0,0 +1,93 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_HUGE_PAGE_BUFFER_H
+#define GFXRECON_UTIL_HUGE_PAGE_BUFFER_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Growable byte buffer for large block data, which can be backed by 2 MiB huge pages to reduce the TLB misses of
+// decompressing and copying hundreds of megabytes of data.  The memory is retained when the buffer shrinks, so the
+// pages are reused by the blocks that follow.  Buffers smaller than a huge page are allocated from the heap.
+class HugePageBuffer
+{
+  public:
+    enum Mode : uint32_t
+    {
+        kModeNone = 0,    // Heap memory.
+        kModeTransparent, // Memory that is aligned to huge pages and advised for transparent huge pages.
+        kModeExplicit     // Memory from the reserved huge page pool, falling back to transparent huge pages.
+    };
+
+  public:
+    HugePageBuffer();
+
+    ~HugePageBuffer();
+
+    HugePageBuffer(const HugePageBuffer&) = delete;
+
+    HugePageBuffer& operator=(const HugePageBuffer&) = delete;
+
+    // Frees the buffer memory, so that the next allocation uses the mode.
+    void SetMode(Mode mode);
+
+    Mode GetMode() const { return mode_; }
+
+    uint8_t* GetData() { return data_; }
+
+    const uint8_t* GetData() const { return data_; }
+
+    size_t GetSize() const { return size_; }
+
+    // Returns the size of the memory that is retained by the buffer.
+    size_t GetCapacity() const { return capacity_; }
+
+    // Sets the size of the buffer, preserving the contents up to the smaller of the old and new sizes.
+    void Resize(size_t size);
+
+    // Frees the buffer memory.
+    void Reset();
+
+  private:
+    uint8_t* Allocate(size_t size, size_t* capacity, bool* mapped);
+
+    void Free();
+
+  private:
+    Mode     mode_;
+    uint8_t* data_;
+    size_t   size_;
+    size_t   capacity_;
+    bool     mapped_; // The memory was mapped with huge page alignment, and was not allocated from the heap.
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_HUGE_PAGE_BUFFER_H
@@ -24,6 +24,15 @@
 
 #include "platform.h"
 
+#ifdef ENABLE_ZLIB_COMPRESSION
+#include "zlib.h"
+#endif // ENABLE_ZLIB_COMPRESSION
+
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <vector>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 GFXRECON_BEGIN_NAMESPACE(imagewriter)
@@ -89,6 +98,376 @@ bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height,
     return success;
 }
 
+const uint32_t kRgbBpp = 3; // PNG and QOI images are written as 24-bit RGB data.
+
+const uint8_t kPngSignature[]      = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+const uint8_t kPngBitDepth         = 8;
+const uint8_t kPngColorTypeRgb     = 2;
+const int     kPngCompressionLevel = 6;
+const size_t  kPngFilterTypeCount  = 5;
+
+const uint8_t  kQoiChannels       = 3;
+const uint8_t  kQoiColorSpaceSrgb = 0;
+const uint8_t  kQoiOpIndex        = 0x00;
+const uint8_t  kQoiOpDiff         = 0x40;
+const uint8_t  kQoiOpLuma         = 0x80;
+const uint8_t  kQoiOpRun          = 0xc0;
+const uint8_t  kQoiOpRgb          = 0xfe;
+const uint8_t  kQoiMaxRun         = 62;
+const uint8_t  kQoiEndMarker[]    = { 0, 0, 0, 0, 0, 0, 0, 1 };
+const size_t   kQoiIndexSize      = 64;
+const uint32_t kQoiOpaqueBlack    = 0xff000000;
+
+static void AppendUint32BigEndian(std::vector<uint8_t>* buffer, uint32_t value)
+{
+    buffer->push_back(static_cast<uint8_t>(value >> 24));
+    buffer->push_back(static_cast<uint8_t>(value >> 16));
+    buffer->push_back(static_cast<uint8_t>(value >> 8));
+    buffer->push_back(static_cast<uint8_t>(value));
+}
+
+static bool WriteFileData(const std::string& filename, const std::vector<uint8_t>& file_data)
+{
+    bool  success = false;
+    FILE* file    = nullptr;
+
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "wb");
+    if ((result == 0) && (file != nullptr))
+    {
+        util::platform::FileWrite(file_data.data(), 1, file_data.size(), file);
+
+        if (!ferror(file))
+        {
+            success = true;
+        }
+
+        util::platform::FileClose(file);
+    }
+
+    return success;
+}
+
+#ifdef ENABLE_ZLIB_COMPRESSION
+
+// Converts a row of 32-bit BGRA pixels to 24-bit RGB pixels.
+static void ConvertBgraRowToRgb(const uint8_t* bgra, uint32_t width, uint8_t* rgb)
+{
+    for (uint32_t i = 0; i < width; ++i)
+    {
+        rgb[0] = bgra[2];
+        rgb[1] = bgra[1];
+        rgb[2] = bgra[0];
+
+        bgra += kBmpBpp;
+        rgb += kRgbBpp;
+    }
+}
+
+static uint8_t PaethPredictor(uint8_t left, uint8_t up, uint8_t up_left)
+{
+    int32_t estimate         = static_cast<int32_t>(left) + static_cast<int32_t>(up) - static_cast<int32_t>(up_left);
+    int32_t left_distance    = std::abs(estimate - static_cast<int32_t>(left));
+    int32_t up_distance      = std::abs(estimate - static_cast<int32_t>(up));
+    int32_t up_left_distance = std::abs(estimate - static_cast<int32_t>(up_left));
+
+    if ((left_distance <= up_distance) && (left_distance <= up_left_distance))
+    {
+        return left;
+    }
+    else if (up_distance <= up_left_distance)
+    {
+        return up;
+    }
+
+    return up_left;
+}
+
+// Applies a PNG filter to a row of RGB pixels, writing the filter type followed by the filtered bytes to filtered.
+// Returns the sum of the absolute values of the filtered bytes, which is used to select a filter for the row.
+static uint64_t FilterPngRow(
+    uint8_t filter_type, const uint8_t* row, const uint8_t* previous_row, size_t row_size, uint8_t* filtered)
+{
+    uint64_t sum = 0;
+
+    filtered[0] = filter_type;
+
+    for (size_t i = 0; i < row_size; ++i)
+    {
+        uint8_t left    = (i >= kRgbBpp) ? row[i - kRgbBpp] : 0;
+        uint8_t up      = (previous_row != nullptr) ? previous_row[i] : 0;
+        uint8_t up_left = ((previous_row != nullptr) && (i >= kRgbBpp)) ? previous_row[i - kRgbBpp] : 0;
+        uint8_t value   = row[i];
+
+        switch (filter_type)
+        {
+            case 1:
+                value -= left;
+                break;
+            case 2:
+                value -= up;
+                break;
+            case 3:
+                value -= static_cast<uint8_t>((static_cast<uint32_t>(left) + static_cast<uint32_t>(up)) / 2);
+                break;
+            case 4:
+                value -= PaethPredictor(left, up, up_left);
+                break;
+            default:
+                break;
+        }
+
+        filtered[i + 1] = value;
+        sum += static_cast<uint64_t>(std::abs(static_cast<int32_t>(static_cast<int8_t>(value))));
+    }
+
+    return sum;
+}
+
+static void AppendPngChunk(std::vector<uint8_t>* buffer, const char* type, const uint8_t* data, size_t size)
+{
+    AppendUint32BigEndian(buffer, static_cast<uint32_t>(size));
+
+    size_t type_offset = buffer->size();
+    buffer->insert(buffer->end(), type, type + 4);
+
+    if (size > 0)
+    {
+        buffer->insert(buffer->end(), data, data + size);
+    }
+
+    // The CRC covers the chunk type and data.
+    uLong crc = crc32(0, Z_NULL, 0);
+    crc       = crc32(crc, buffer->data() + type_offset, static_cast<uInt>(size + 4));
+    AppendUint32BigEndian(buffer, static_cast<uint32_t>(crc));
+}
+
+bool IsPngSupported()
+{
+    return true;
+}
+
+bool WritePngImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
+{
+    bool     success    = false;
+    uint32_t row_pitch  = width * kBmpBpp;
+    uint64_t image_size = static_cast<uint64_t>(height) * row_pitch;
+
+    if ((width == 0) || (height == 0) || (image_size > data_size))
+    {
+        return false;
+    }
+
+    z_stream stream;
+    stream.zalloc = Z_NULL;
+    stream.zfree  = Z_NULL;
+    stream.opaque = Z_NULL;
+
+    if (deflateInit(&stream, kPngCompressionLevel) != Z_OK)
+    {
+        return false;
+    }
+
+    size_t               row_size = static_cast<size_t>(width) * kRgbBpp;
+    std::vector<uint8_t> rows[2]  = { std::vector<uint8_t>(row_size), std::vector<uint8_t>(row_size) };
+    std::vector<uint8_t> filtered[kPngFilterTypeCount];
+    std::vector<uint8_t> compressed(deflateBound(&stream, static_cast<uLong>((row_size + 1) * height)));
+    auto                 bytes  = reinterpret_cast<const uint8_t*>(data);
+    int                  status = Z_OK;
+
+    for (auto& filtered_row : filtered)
+    {
+        filtered_row.resize(row_size + 1);
+    }
+
+    stream.next_out  = compressed.data();
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    for (uint32_t y = 0; (y < height) && (status == Z_OK); ++y)
+    {
+        uint8_t*       row          = rows[y % 2].data();
+        const uint8_t* previous_row = (y > 0) ? rows[(y + 1) % 2].data() : nullptr;
+
+        ConvertBgraRowToRgb(&bytes[static_cast<size_t>(y) * row_pitch], width, row);
+
+        // Select the filter with the smallest sum of absolute differences for the row.
+        size_t   best_filter = 0;
+        uint64_t best_sum    = std::numeric_limits<uint64_t>::max();
+
+        for (size_t filter_type = 0; filter_type < kPngFilterTypeCount; ++filter_type)
+        {
+            uint64_t sum = FilterPngRow(
+                static_cast<uint8_t>(filter_type), row, previous_row, row_size, filtered[filter_type].data());
+
+            if (sum < best_sum)
+            {
+                best_filter = filter_type;
+                best_sum    = sum;
+            }
+        }
+
+        stream.next_in  = filtered[best_filter].data();
+        stream.avail_in = static_cast<uInt>(row_size + 1);
+
+        status = deflate(&stream, (y == (height - 1)) ? Z_FINISH : Z_NO_FLUSH);
+
+        if (status == Z_STREAM_END)
+        {
+            success = true;
+        }
+    }
+
+    size_t compressed_size = compressed.size() - stream.avail_out;
+    deflateEnd(&stream);
+
+    if (success)
+    {
+        uint8_t header[13];
+        header[0]  = static_cast<uint8_t>(width >> 24);
+        header[1]  = static_cast<uint8_t>(width >> 16);
+        header[2]  = static_cast<uint8_t>(width >> 8);
+        header[3]  = static_cast<uint8_t>(width);
+        header[4]  = static_cast<uint8_t>(height >> 24);
+        header[5]  = static_cast<uint8_t>(height >> 16);
+        header[6]  = static_cast<uint8_t>(height >> 8);
+        header[7]  = static_cast<uint8_t>(height);
+        header[8]  = kPngBitDepth;
+        header[9]  = kPngColorTypeRgb;
+        header[10] = 0; // Deflate compression.
+        header[11] = 0; // Adaptive filtering.
+        header[12] = 0; // No interlacing.
+
+        std::vector<uint8_t> file_data(std::begin(kPngSignature), std::end(kPngSignature));
+        file_data.reserve(compressed_size + 64);
+
+        AppendPngChunk(&file_data, "IHDR", header, sizeof(header));
+        AppendPngChunk(&file_data, "IDAT", compressed.data(), compressed_size);
+        AppendPngChunk(&file_data, "IEND", nullptr, 0);
+
+        success = WriteFileData(filename, file_data);
+    }
+
+    return success;
+}
+
+#else
+
+bool IsPngSupported()
+{
+    return false;
+}
+
+bool WritePngImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(filename);
+    GFXRECON_UNREFERENCED_PARAMETER(width);
+    GFXRECON_UNREFERENCED_PARAMETER(height);
+    GFXRECON_UNREFERENCED_PARAMETER(data_size);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+    return false;
+}
+
+#endif // ENABLE_ZLIB_COMPRESSION
+
+bool WriteQoiImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
+{
+    uint32_t row_pitch  = width * kBmpBpp;
+    uint64_t image_size = static_cast<uint64_t>(height) * row_pitch;
+
+    if ((width == 0) || (height == 0) || (image_size > data_size))
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> file_data;
+    file_data.reserve(static_cast<size_t>(width) * height + 64);
+
+    file_data.push_back('q');
+    file_data.push_back('o');
+    file_data.push_back('i');
+    file_data.push_back('f');
+    AppendUint32BigEndian(&file_data, width);
+    AppendUint32BigEndian(&file_data, height);
+    file_data.push_back(kQoiChannels);
+    file_data.push_back(kQoiColorSpaceSrgb);
+
+    // Pixels are packed as 0xAARRGGBB, with an alpha value of 255, so that they never match the zero initialized
+    // entries of the index, which have an alpha value of 0.
+    uint32_t index[kQoiIndexSize] = {};
+    uint32_t previous             = kQoiOpaqueBlack;
+    uint8_t  run                  = 0;
+    auto     bytes                = reinterpret_cast<const uint8_t*>(data);
+    uint64_t pixel_count          = static_cast<uint64_t>(width) * height;
+
+    for (uint64_t i = 0; i < pixel_count; ++i)
+    {
+        const uint8_t* bgra  = &bytes[i * kBmpBpp];
+        uint8_t        r     = bgra[2];
+        uint8_t        g     = bgra[1];
+        uint8_t        b     = bgra[0];
+        uint32_t       pixel = kQoiOpaqueBlack | (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) | b;
+
+        if (pixel == previous)
+        {
+            ++run;
+
+            if ((run == kQoiMaxRun) || (i == (pixel_count - 1)))
+            {
+                file_data.push_back(kQoiOpRun | (run - 1));
+                run = 0;
+            }
+        }
+        else
+        {
+            if (run > 0)
+            {
+                file_data.push_back(kQoiOpRun | (run - 1));
+                run = 0;
+            }
+
+            size_t hash = (r * 3 + g * 5 + b * 7 + 255 * 11) % kQoiIndexSize;
+
+            if (index[hash] == pixel)
+            {
+                file_data.push_back(kQoiOpIndex | static_cast<uint8_t>(hash));
+            }
+            else
+            {
+                index[hash] = pixel;
+
+                int8_t dr    = static_cast<int8_t>(r - static_cast<uint8_t>(previous >> 16));
+                int8_t dg    = static_cast<int8_t>(g - static_cast<uint8_t>(previous >> 8));
+                int8_t db    = static_cast<int8_t>(b - static_cast<uint8_t>(previous));
+                int8_t dr_dg = static_cast<int8_t>(dr - dg);
+                int8_t db_dg = static_cast<int8_t>(db - dg);
+
+                if ((dr >= -2) && (dr <= 1) && (dg >= -2) && (dg <= 1) && (db >= -2) && (db <= 1))
+                {
+                    file_data.push_back(kQoiOpDiff |
+                                        static_cast<uint8_t>(((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+                }
+                else if ((dg >= -32) && (dg <= 31) && (dr_dg >= -8) && (dr_dg <= 7) && (db_dg >= -8) && (db_dg <= 7))
+                {
+                    file_data.push_back(kQoiOpLuma | static_cast<uint8_t>(dg + 32));
+                    file_data.push_back(static_cast<uint8_t>(((dr_dg + 8) << 4) | (db_dg + 8)));
+                }
+                else
+                {
+                    file_data.push_back(kQoiOpRgb);
+                    file_data.push_back(r);
+                    file_data.push_back(g);
+                    file_data.push_back(b);
+                }
+            }
+        }
+
+        previous = pixel;
+    }
+
+    file_data.insert(file_data.end(), std::begin(kQoiEndMarker), std::end(kQoiEndMarker));
+
+    return WriteFileData(filename, file_data);
+}
+
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -62,6 +62,16 @@ struct BmpInfoHeader
 
 bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data);
 
+// Returns true when PNG images can be written, which requires zlib support.
+bool IsPngSupported();
+
+// Writes 32-bit BGRA image data as an 8-bit RGB PNG image, discarding the alpha channel.
+bool WritePngImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data);
+
+// Writes 32-bit BGRA image data as an RGB QOI image, discarding the alpha channel.  QOI is a lossless format that
+// encodes several times faster than PNG, with somewhat larger files.
+bool WriteQoiImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data);
+
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
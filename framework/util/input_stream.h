@@ -0,0 +1,95 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_INPUT_STREAM_H
+#define GFXRECON_UTIL_INPUT_STREAM_H
+
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Sequential source of capture file data.  Streams that are not seekable, such as pipes and network connections, can
+// only be read forward.
+class InputStream
+{
+  public:
+    virtual ~InputStream() {}
+
+    virtual bool IsValid() { return false; }
+
+    // Reads len bytes, blocking until the data is available.  Returns fewer than len bytes when the end of the stream
+    // is reached or an error occurs.
+    virtual size_t Read(void* data, size_t len) = 0;
+
+    // Reads at least one byte and up to len bytes, returning as soon as some data is available instead of waiting for
+    // len bytes.  Returns 0 when the end of the stream is reached or an error occurs.
+    virtual size_t ReadAvailable(void* data, size_t len) { return Read(data, len); }
+
+    // Discards len bytes.  Returns false when fewer than len bytes could be discarded.
+    virtual bool Skip(size_t len)
+    {
+        uint8_t buffer[4096];
+
+        while (len > 0)
+        {
+            size_t read_size = std::min(len, sizeof(buffer));
+
+            if (Read(buffer, read_size) != read_size)
+            {
+                return false;
+            }
+
+            len -= read_size;
+        }
+
+        return true;
+    }
+
+    virtual bool IsSeekable() const { return false; }
+
+    // Moves the read position to the specified offset from the start of the stream.  Only supported by seekable
+    // streams.
+    virtual bool Seek(uint64_t offset)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(offset);
+        return false;
+    }
+
+    // Causes a read that is blocked waiting for data on another thread to return, for streams that support it.  All
+    // subsequent reads fail.
+    virtual void Interrupt() {}
+
+    // Returns true when a read has been attempted past the end of the stream.
+    virtual bool IsEof() const = 0;
+
+    virtual bool HasError() const = 0;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_INPUT_STREAM_H
@@ -0,0 +1,75 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_INSTRUMENTATION_H
+#define GFXRECON_UTIL_INSTRUMENTATION_H
+
+#include "util/defines.h"
+
+// Timeline instrumentation of the capture and replay hot paths.  The zone macros mark the scope that contains them as a
+// named span on the timeline of the selected profiler backend, which is chosen with the INSTRUMENTATION CMake option:
+//   - GFXRECON_ENABLE_TRACY: Zones are reported to a connected Tracy profiler.
+//   - GFXRECON_ENABLE_PERFETTO: Zones are reported as track events to the Perfetto system tracing service.
+// Without a backend, the macros expand to nothing and have no cost.
+//
+// GFXRECON_INSTRUMENT_ZONE(name)   Zone with a string literal name.
+// GFXRECON_INSTRUMENT_FUNCTION()   Zone named for the containing function.
+// GFXRECON_INSTRUMENT_INITIALIZE() Connects to the backend.  Called once by the capture layer and replay tools before
+//                                  any zones are entered.
+
+#if defined(GFXRECON_ENABLE_TRACY)
+
+#include "tracy/Tracy.hpp"
+
+#define GFXRECON_INSTRUMENT_ZONE(name) ZoneScopedN(name)
+#define GFXRECON_INSTRUMENT_FUNCTION() ZoneScoped
+#define GFXRECON_INSTRUMENT_INITIALIZE()
+
+#elif defined(GFXRECON_ENABLE_PERFETTO)
+
+#include "perfetto.h"
+
+PERFETTO_DEFINE_CATEGORIES(perfetto::Category("gfxrecon").SetDescription("GFXReconstruct capture and replay"));
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(instrumentation)
+
+void Initialize();
+
+GFXRECON_END_NAMESPACE(instrumentation)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#define GFXRECON_INSTRUMENT_ZONE(name) TRACE_EVENT("gfxrecon", name)
+#define GFXRECON_INSTRUMENT_FUNCTION() TRACE_EVENT("gfxrecon", perfetto::StaticString{ __func__ })
+#define GFXRECON_INSTRUMENT_INITIALIZE() gfxrecon::util::instrumentation::Initialize()
+
+#else
+
+#define GFXRECON_INSTRUMENT_ZONE(name)
+#define GFXRECON_INSTRUMENT_FUNCTION()
+#define GFXRECON_INSTRUMENT_INITIALIZE()
+
+#endif
+
+#endif // GFXRECON_UTIL_INSTRUMENTATION_H
@@ -23,10 +23,18 @@
 
 #include "util/logging.h"
 
+#include "util/mpsc_ring_buffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
+#include <condition_variable>
 #include <string>
 #include <cstring>
 #include <cstdio>
+#include <mutex>
+#include <thread>
 
 #if defined(__ANDROID__)
 #include <android/log.h>
@@ -35,7 +43,293 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-Log::Settings Log::settings_;
+// Formats and writes log messages from a background thread.  Messages are copied to a lock-free ring buffer by the
+// logging threads, so that they do not wait for console or file I/O, or for each other.  Consecutive identical messages
+// are coalesced by the writer thread, which writes the first message and then a count of the repeats.
+class Log::AsyncWriter
+{
+  public:
+    AsyncWriter();
+
+    // Blocks until all pending messages have been written.
+    ~AsyncWriter();
+
+    void Submit(Severity           severity,
+                const char*        file,
+                const char*        function,
+                const char*        line,
+                uint32_t           indent,
+                const std::string& message);
+
+    // Blocks until all messages submitted before the call have been written.
+    void WaitForIdle();
+
+  private:
+    enum RecordType : uint32_t
+    {
+        kMessageRecord = 0,
+        kIdleRecord    = 1 // Record data is a pointer to a std::atomic_bool that is set when the record is processed.
+    };
+
+    struct MessageHeader
+    {
+        uint32_t severity;
+        uint32_t indent;
+        uint32_t file_size;
+        uint32_t function_size;
+        uint32_t line_size;
+        uint32_t message_size;
+    };
+
+  private:
+    uint8_t* Reserve(size_t size);
+
+    void Commit(uint8_t* record_data, uint32_t record_type);
+
+    void ProcessRecords();
+
+    void WriteRecord(const uint8_t* data);
+
+    void WriteRepeatCount();
+
+  private:
+    static const size_t   kBufferSize        = 1024 * 1024;
+    static const uint32_t kRepeatReportDelay = 1000; // Milliseconds before a pending repeat count is written.
+
+    MpscRingBuffer          ring_buffer_;
+    bool                    shutdown_;
+    std::atomic<bool>       writer_waiting_;
+    std::mutex              writer_mutex_;
+    std::condition_variable writer_wake_;
+    std::thread             writer_thread_;
+
+    // Last message written, for coalescing repeated messages.  Only accessed by the writer thread.
+    Severity    last_severity_;
+    uint32_t    last_indent_;
+    std::string last_file_;
+    std::string last_function_;
+    std::string last_line_;
+    std::string last_message_;
+    uint64_t    repeat_count_;
+};
+
+const size_t   Log::AsyncWriter::kBufferSize;
+const uint32_t Log::AsyncWriter::kRepeatReportDelay;
+
+Log::AsyncWriter::AsyncWriter() :
+    ring_buffer_(kBufferSize), shutdown_(false), writer_waiting_(false), last_severity_(kAlwaysOutputSeverity),
+    last_indent_(0), repeat_count_(0)
+{
+    writer_thread_ = std::thread(&AsyncWriter::ProcessRecords, this);
+}
+
+Log::AsyncWriter::~AsyncWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        shutdown_ = true;
+    }
+
+    writer_wake_.notify_one();
+
+    if (writer_thread_.joinable())
+    {
+        writer_thread_.join();
+    }
+
+    WriteRepeatCount();
+}
+
+void Log::AsyncWriter::Submit(Severity           severity,
+                              const char*        file,
+                              const char*        function,
+                              const char*        line,
+                              uint32_t           indent,
+                              const std::string& message)
+{
+    MessageHeader header;
+    header.severity      = severity;
+    header.indent        = indent;
+    header.file_size     = 0;
+    header.function_size = 0;
+    header.line_size     = 0;
+
+    // The file, function, and line strings are only referenced by the detailed message prefix.
+    if (settings_.output_detailed_log_info)
+    {
+        header.file_size     = static_cast<uint32_t>(strlen(file));
+        header.function_size = static_cast<uint32_t>(strlen(function));
+        header.line_size     = static_cast<uint32_t>(strlen(line));
+    }
+
+    // Each string is stored with its null terminator.  Messages that are too large for the ring buffer are truncated.
+    size_t detail_size  = header.file_size + header.function_size + header.line_size + 3;
+    size_t max_message  = ring_buffer_.GetMaxRecordSize() - sizeof(header) - detail_size - 1;
+    header.message_size = static_cast<uint32_t>(std::min(message.size(), max_message));
+
+    uint8_t* record_data = Reserve(sizeof(header) + detail_size + header.message_size + 1);
+    uint8_t* dst         = record_data;
+
+    memcpy(dst, &header, sizeof(header));
+    dst += sizeof(header);
+
+    const char* strings[] = { file, function, line };
+    uint32_t    sizes[]   = { header.file_size, header.function_size, header.line_size };
+    for (size_t i = 0; i < 3; ++i)
+    {
+        memcpy(dst, strings[i], sizes[i]);
+        dst += sizes[i];
+        *(dst++) = '\0';
+    }
+
+    memcpy(dst, message.data(), header.message_size);
+    dst[header.message_size] = '\0';
+
+    Commit(record_data, kMessageRecord);
+}
+
+void Log::AsyncWriter::WaitForIdle()
+{
+    std::atomic_bool idle{ false };
+    std::atomic_bool* idle_ptr = &idle;
+
+    uint8_t* record_data = Reserve(sizeof(idle_ptr));
+    memcpy(record_data, &idle_ptr, sizeof(idle_ptr));
+    Commit(record_data, kIdleRecord);
+
+    while (!idle.load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+uint8_t* Log::AsyncWriter::Reserve(size_t size)
+{
+    uint8_t* record_data = nullptr;
+
+    while ((record_data = ring_buffer_.Reserve(size)) == nullptr)
+    {
+        // The ring buffer is full, so wait for the writer thread to release space.
+        std::this_thread::yield();
+    }
+
+    return record_data;
+}
+
+void Log::AsyncWriter::Commit(uint8_t* record_data, uint32_t record_type)
+{
+    ring_buffer_.Commit(record_data, record_type);
+
+    // Pairs with the fence in ProcessRecords(), to ensure that either the writer sees the committed record before
+    // waiting, or this thread sees that the writer is waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (writer_waiting_.load(std::memory_order_relaxed))
+    {
+        {
+            std::lock_guard<std::mutex> lock(writer_mutex_);
+        }
+
+        writer_wake_.notify_one();
+    }
+}
+
+void Log::AsyncWriter::ProcessRecords()
+{
+    MpscRingBuffer::Record record;
+
+    for (;;)
+    {
+        if (ring_buffer_.Peek(&record))
+        {
+            if (record.type == kIdleRecord)
+            {
+                std::atomic_bool* idle = nullptr;
+                memcpy(&idle, record.data, sizeof(idle));
+
+                WriteRepeatCount();
+                idle->store(true, std::memory_order_release);
+            }
+            else
+            {
+                WriteRecord(record.data);
+            }
+
+            ring_buffer_.Pop();
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(writer_mutex_);
+
+            writer_waiting_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            auto ready = [&]() { return ring_buffer_.Peek(&record) || (shutdown_ && ring_buffer_.IsEmpty()); };
+
+            if (repeat_count_ == 0)
+            {
+                writer_wake_.wait(lock, ready);
+            }
+            else if (!writer_wake_.wait_for(lock, std::chrono::milliseconds(kRepeatReportDelay), ready))
+            {
+                // Report repeated messages that have not been followed by a different message for a while.
+                WriteRepeatCount();
+            }
+
+            writer_waiting_.store(false, std::memory_order_relaxed);
+
+            if (shutdown_ && ring_buffer_.IsEmpty())
+            {
+                break;
+            }
+        }
+    }
+}
+
+void Log::AsyncWriter::WriteRecord(const uint8_t* data)
+{
+    MessageHeader header;
+    memcpy(&header, data, sizeof(header));
+
+    const char* file     = reinterpret_cast<const char*>(data + sizeof(header));
+    const char* function = file + header.file_size + 1;
+    const char* line     = function + header.function_size + 1;
+    const char* message  = line + header.line_size + 1;
+    Severity    severity = static_cast<Severity>(header.severity);
+
+    if ((severity == last_severity_) && (header.indent == last_indent_) &&
+        (last_message_.compare(0, std::string::npos, message, header.message_size) == 0))
+    {
+        ++repeat_count_;
+    }
+    else
+    {
+        WriteRepeatCount();
+
+        last_severity_ = severity;
+        last_indent_   = header.indent;
+        last_file_.assign(file, header.file_size);
+        last_function_.assign(function, header.function_size);
+        last_line_.assign(line, header.line_size);
+        last_message_.assign(message, header.message_size);
+
+        WriteMessage(severity, file, function, line, header.indent, last_message_);
+    }
+}
+
+void Log::AsyncWriter::WriteRepeatCount()
+{
+    if (repeat_count_ > 0)
+    {
+        std::string message = "Last message repeated " + std::to_string(repeat_count_) + " times";
+        WriteMessage(
+            last_severity_, last_file_.c_str(), last_function_.c_str(), last_line_.c_str(), last_indent_, message);
+        repeat_count_ = 0;
+    }
+}
+
+Log::Settings     Log::settings_;
+Log::AsyncWriter* Log::async_writer_ = nullptr;
 
 std::string Log::ConvertFormatVaListToString(const std::string& format_string, va_list& var_args)
 {
@@ -72,6 +366,8 @@ void Log::Init(Severity    min_severity,
                bool        output_to_os_debug_string,
                bool        use_indent)
 {
+    StopAsyncWriter();
+
     settings_.min_severity = min_severity;
     if ((log_file_name != nullptr) && (strlen(log_file_name) > 0))
     {
@@ -106,6 +402,9 @@ void Log::Init(Severity    min_severity,
 
 void Log::Init(const util::Log::Settings& settings)
 {
+    // The writer thread reads the settings, so it is stopped before they are replaced.
+    StopAsyncWriter();
+
     settings_ = settings;
     if (!settings.file_name.empty())
     {
@@ -127,10 +426,17 @@ void Log::Init(const util::Log::Settings& settings)
             }
         }
     }
+
+    if (settings_.async_write)
+    {
+        async_writer_ = new AsyncWriter();
+    }
 }
 
 void Log::Release()
 {
+    StopAsyncWriter();
+
     if (settings_.write_to_file && settings_.leave_file_open)
     {
         platform::FileClose(settings_.file_pointer);
@@ -139,13 +445,60 @@ void Log::Release()
     }
 }
 
+void Log::StopAsyncWriter()
+{
+    if (async_writer_ != nullptr)
+    {
+        delete async_writer_;
+        async_writer_ = nullptr;
+    }
+}
+
 void Log::LogMessage(
     Log::Severity severity, const char* file, const char* function, const char* line, const char* message, ...)
+{
+    va_list valist;
+    va_start(valist, message);
+    std::string generated_string = ConvertFormatVaListToString(message, valist);
+    va_end(valist);
+
+    uint32_t indent = settings_.use_indent ? settings_.indent : 0;
+
+    if (async_writer_ != nullptr)
+    {
+        async_writer_->Submit(severity, file, function, line, indent, generated_string);
+
+        // Errors and console output are written before returning, so that they are not lost if the application
+        // terminates, and are not reordered with other output.
+        if (severity >= kErrorSeverity)
+        {
+            async_writer_->WaitForIdle();
+        }
+    }
+    else
+    {
+        WriteMessage(severity, file, function, line, indent, generated_string);
+    }
+
+    // Break on error if necessary, failing message should be this one
+    // (also the last one written).
+    if ((kAlwaysOutputSeverity > severity) && (kErrorSeverity <= severity) && settings_.break_on_error)
+    {
+        platform::TriggerDebugBreak();
+    }
+}
+
+void Log::WriteMessage(Severity           severity,
+                       const char*        file,
+                       const char*        function,
+                       const char*        line,
+                       uint32_t           indent,
+                       const std::string& generated_string)
 {
     bool  opened_file      = false;
-    bool  write_indent     = settings_.use_indent && (settings_.indent > 0);
+    bool  write_indent     = (indent > 0);
     bool  message_written  = false;
-    bool  output_to_stderr = false;
+    bool  output_to_stderr = settings_.output_all_to_stderr;
     FILE* log_file_ptr;
 
     // Log message prefix
@@ -179,11 +532,6 @@ void Log::LogMessage(
         prefix += " - ";
     }
 
-    va_list valist;
-    va_start(valist, message);
-    std::string generated_string = ConvertFormatVaListToString(message, valist);
-    va_end(valist);
-
     for (uint32_t output_target = 0; output_target < 2; ++output_target)
     {
         bool write_prefix_and_indents = (severity != kAlwaysOutputSeverity);
@@ -243,7 +591,7 @@ void Log::LogMessage(
             output_message = prefix;
             if (write_indent)
             {
-                for (uint32_t iii = 0; iii < settings_.indent; ++iii)
+                for (uint32_t iii = 0; iii < indent; ++iii)
                 {
                     output_message += settings_.indent_spaces;
                 }
@@ -306,13 +654,6 @@ void Log::LogMessage(
             }
         }
     }
-
-    // Break on error if necessary, failing message should be this one
-    // (also the last one written).
-    if ((kAlwaysOutputSeverity > severity) && (kErrorSeverity <= severity) && settings_.break_on_error)
-    {
-        platform::TriggerDebugBreak();
-    }
 }
 
 GFXRECON_END_NAMESPACE(util)
@@ -55,6 +55,7 @@ class Log
         uint32_t    indent{ 0 };                       // Number of indents to shift this message
         std::string indent_spaces{ "    " };           // String of spaces used for each indent
         bool        break_on_error{ false };           // If an error occurs, force a break
+        bool        async_write{ false };              // Format and write messages from a background thread
 
         // File settings
         bool        write_to_file{ false };  // Write info to a file
@@ -66,6 +67,7 @@ class Log
         // Console settings
         bool write_to_console{ true };           // Write info out to the console
         bool output_errors_to_stderr{ true };    // Output errors to stderr versus stdout
+        bool output_all_to_stderr{ false };      // Output all messages to stderr, when stdout carries file data
         bool output_to_os_debug_string{ false }; // Windows-specific output messages to OutputDebugString
     };
 
@@ -104,6 +106,12 @@ class Log
         }
     }
 
+    // Writes all console messages to stderr, for tools that write their output file to stdout.
+    static void SetOutputAllToStderr(bool output_all_to_stderr)
+    {
+        settings_.output_all_to_stderr = output_all_to_stderr;
+    }
+
     static bool WillOutputMessage(Severity severity)
     {
         // We're always going to output something at "kAlwaysOutputSeverity", so check other cases.
@@ -181,10 +189,23 @@ class Log
         return parse_success;
     }
 
+  private:
+    class AsyncWriter;
+
   private:
     static std::string ConvertFormatVaListToString(const std::string& format_string, va_list& var_args);
 
-    static Settings settings_;
+    static void WriteMessage(Severity           severity,
+                             const char*        file,
+                             const char*        function,
+                             const char*        line,
+                             uint32_t           indent,
+                             const std::string& generated_string);
+
+    static void StopAsyncWriter();
+
+    static Settings     settings_;
+    static AsyncWriter* async_writer_;
 };
 
 #ifdef GFXRECON_ENABLE_COMMAND_TRACE
@@ -25,18 +25,31 @@
 
 #include "util/lz4_compressor.h"
 
+#include "util/instrumentation.h"
 #include "util/logging.h"
 
 #include "lz4.h"
+#if defined(ENABLE_LZ4HC_COMPRESSION)
+#include "lz4hc.h"
+#endif
+
+#include <algorithm>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
-                               const uint8_t*        uncompressed_data,
-                               std::vector<uint8_t>* compressed_data,
-                               size_t                compressed_data_offset)
+size_t Lz4Compressor::GetMaxCompressedSize(size_t uncompressed_size) const
+{
+    return LZ4_COMPRESSBOUND(uncompressed_size);
+}
+
+size_t Lz4Compressor::Compress(const size_t   uncompressed_size,
+                               const uint8_t* uncompressed_data,
+                               const size_t   compressed_capacity,
+                               uint8_t*       compressed_data)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     size_t data_size = 0;
 
     if (nullptr == compressed_data)
@@ -44,19 +57,31 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
         return 0;
     }
 
-    size_t lz4_compressed_size = LZ4_COMPRESSBOUND(uncompressed_size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(int32_t, uncompressed_size);
+
+    // LZ4 fails when the output does not fit, so a capacity larger than the bound can be clamped without effect.
+    size_t capacity = std::min(compressed_capacity, GetMaxCompressedSize(uncompressed_size));
+
+    int compressed_size_generated = 0;
 
-    if ((compressed_data_offset + lz4_compressed_size) > compressed_data->size())
+#if defined(ENABLE_LZ4HC_COMPRESSION)
+    if (hc_level_ > 0)
     {
-        compressed_data->resize(compressed_data_offset + lz4_compressed_size);
+        compressed_size_generated = LZ4_compress_HC(reinterpret_cast<const char*>(uncompressed_data),
+                                                    reinterpret_cast<char*>(compressed_data),
+                                                    static_cast<const int32_t>(uncompressed_size),
+                                                    static_cast<int32_t>(capacity),
+                                                    hc_level_);
+    }
+    else
+#endif
+    {
+        compressed_size_generated = LZ4_compress_fast(reinterpret_cast<const char*>(uncompressed_data),
+                                                      reinterpret_cast<char*>(compressed_data),
+                                                      static_cast<const int32_t>(uncompressed_size),
+                                                      static_cast<int32_t>(capacity),
+                                                      acceleration_);
     }
-
-    int compressed_size_generated =
-        LZ4_compress_fast(reinterpret_cast<const char*>(uncompressed_data),
-                          reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                          static_cast<const int32_t>(uncompressed_size),
-                          static_cast<int32_t>(lz4_compressed_size),
-                          1);
 
     if (compressed_size_generated > 0)
     {
@@ -66,11 +91,13 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t Lz4Compressor::Decompress(const size_t                compressed_size,
-                                 const std::vector<uint8_t>& compressed_data,
-                                 const size_t                expected_uncompressed_size,
-                                 std::vector<uint8_t>*       uncompressed_data)
+size_t Lz4Compressor::Decompress(const size_t   compressed_size,
+                                 const uint8_t* compressed_data,
+                                 const size_t   uncompressed_capacity,
+                                 uint8_t*       uncompressed_data)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     size_t data_size = 0;
 
     if (nullptr == uncompressed_data)
@@ -78,10 +105,13 @@ size_t Lz4Compressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data.data()),
-                                                          reinterpret_cast<char*>(uncompressed_data->data()),
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(int32_t, compressed_size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(int32_t, uncompressed_capacity);
+
+    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data),
+                                                          reinterpret_cast<char*>(uncompressed_data),
                                                           static_cast<int32_t>(compressed_size),
-                                                          static_cast<int32_t>(expected_uncompressed_size));
+                                                          static_cast<int32_t>(uncompressed_capacity));
 
     if (uncompressed_size_generated > 0)
     {
@@ -32,19 +32,37 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class Lz4Compressor : public Compressor
 {
   public:
-    Lz4Compressor() {}
+    static const int kDefaultAcceleration = 1;
+    static const int kMinHcLevel          = 3;
+
+  public:
+    // Higher acceleration values compress faster, with a lower compression ratio.  A non-zero hc_level selects the
+    // LZ4 HC compressor, which is much slower but produces a higher compression ratio with the same fast
+    // decompression, for offline compression.  LZ4 HC requires ENABLE_LZ4HC_COMPRESSION.
+    Lz4Compressor(int acceleration = kDefaultAcceleration, int hc_level = 0) :
+        acceleration_(acceleration), hc_level_(hc_level)
+    {}
 
     virtual ~Lz4Compressor() override {}
 
-    virtual size_t Compress(const size_t          uncompressed_size,
-                            const uint8_t*        uncompressed_data,
-                            std::vector<uint8_t>* compressed_data,
-                            size_t                compressed_data_offset) override;
+    using Compressor::Compress;
+    using Compressor::Decompress;
+
+    virtual size_t GetMaxCompressedSize(size_t uncompressed_size) const override;
+
+    virtual size_t Compress(const size_t   uncompressed_size,
+                            const uint8_t* uncompressed_data,
+                            const size_t   compressed_capacity,
+                            uint8_t*       compressed_data) override;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   uncompressed_capacity,
+                              uint8_t*       uncompressed_data) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+  private:
+    int acceleration_;
+    int hc_level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -0,0 +1,214 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/mapped_file.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+MappedFile::MappedFile() :
+    data_(nullptr), size_(0),
+#if defined(WIN32)
+    file_handle_(INVALID_HANDLE_VALUE), mapping_handle_(nullptr)
+#else
+    file_descriptor_(-1)
+#endif
+{}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+#if defined(WIN32)
+bool MappedFile::Open(const std::string& filename)
+{
+    Close();
+
+    file_handle_ = CreateFileA(filename.c_str(),
+                               GENERIC_READ,
+                               FILE_SHARE_READ,
+                               nullptr,
+                               OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                               nullptr);
+
+    if (file_handle_ == INVALID_HANDLE_VALUE)
+    {
+        GFXRECON_LOG_ERROR("CreateFile(%s) failed (error = %u)", filename.c_str(), GetLastError());
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle_, &file_size) || (file_size.QuadPart <= 0) ||
+        (static_cast<uint64_t>(file_size.QuadPart) > std::numeric_limits<size_t>::max()))
+    {
+        GFXRECON_LOG_WARNING("File %s cannot be memory mapped due to its size", filename.c_str());
+        Close();
+        return false;
+    }
+
+    mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping_handle_ != nullptr)
+    {
+        data_ = reinterpret_cast<const uint8_t*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+    }
+
+    if (data_ == nullptr)
+    {
+        GFXRECON_LOG_WARNING("Failed to memory map file %s (error = %u)", filename.c_str(), GetLastError());
+        Close();
+        return false;
+    }
+
+    size_ = static_cast<size_t>(file_size.QuadPart);
+
+    return true;
+}
+
+void MappedFile::Release(size_t offset, size_t size)
+{
+    // The pages of a read-only file view are not committed memory, and are trimmed from the working set by the memory
+    // manager as needed.
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+}
+
+void MappedFile::Close()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+    }
+
+    if (mapping_handle_ != nullptr)
+    {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+
+    if (file_handle_ != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(file_handle_);
+        file_handle_ = INVALID_HANDLE_VALUE;
+    }
+
+    size_ = 0;
+}
+#else
+bool MappedFile::Open(const std::string& filename)
+{
+    Close();
+
+    file_descriptor_ = open(filename.c_str(), O_RDONLY);
+
+    if (file_descriptor_ == -1)
+    {
+        GFXRECON_LOG_ERROR("open(%s) failed (errno = %d)", filename.c_str(), errno);
+        return false;
+    }
+
+    struct stat file_stat;
+    if ((fstat(file_descriptor_, &file_stat) != 0) || (file_stat.st_size <= 0) ||
+        (static_cast<uint64_t>(file_stat.st_size) > std::numeric_limits<size_t>::max()))
+    {
+        GFXRECON_LOG_WARNING("File %s cannot be memory mapped due to its size", filename.c_str());
+        Close();
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(file_stat.st_size);
+    void*  data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor_, 0);
+
+    if (data == MAP_FAILED)
+    {
+        GFXRECON_LOG_WARNING("Failed to memory map file %s (errno = %d)", filename.c_str(), errno);
+        Close();
+        return false;
+    }
+
+    // File blocks are processed in order, so request aggressive read-ahead.
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    data_ = reinterpret_cast<const uint8_t*>(data);
+    size_ = size;
+
+    return true;
+}
+
+void MappedFile::Release(size_t offset, size_t size)
+{
+    if ((data_ != nullptr) && (offset < size_))
+    {
+        static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+        // The mapping starts on a page boundary, and only the pages that are entirely within the range are released.
+        size_t begin = ((offset + page_size - 1) / page_size) * page_size;
+        size_t end   = (std::min(size, size_ - offset) + offset) / page_size * page_size;
+
+        if (begin < end)
+        {
+            madvise(const_cast<uint8_t*>(data_) + begin, end - begin, MADV_DONTNEED);
+        }
+    }
+}
+
+void MappedFile::Close()
+{
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(data_), size_);
+        data_ = nullptr;
+    }
+
+    if (file_descriptor_ != -1)
+    {
+        close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+
+    size_ = 0;
+}
+#endif
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
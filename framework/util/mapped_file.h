@@ -0,0 +1,74 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MAPPED_FILE_H
+#define GFXRECON_UTIL_MAPPED_FILE_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Read-only memory mapping of an entire file.  The file contents are accessed directly through the mapped region,
+// leaving paging of the file data to the operating system.
+class MappedFile
+{
+  public:
+    MappedFile();
+
+    ~MappedFile();
+
+    // Maps the file, replacing any existing mapping.  Fails for empty files and for files that do not fit in the
+    // process address space.
+    bool Open(const std::string& filename);
+
+    void Close();
+
+    bool IsOpen() const { return (data_ != nullptr); }
+
+    const uint8_t* GetData() const { return data_; }
+
+    size_t GetSize() const { return size_; }
+
+    // Releases the physical pages of a range of the file that has been processed.  The range remains mapped, and its
+    // data is read from the file again if it is accessed after it is released.
+    void Release(size_t offset, size_t size);
+
+  private:
+    const uint8_t* data_;
+    size_t         size_;
+#if defined(WIN32)
+    void* file_handle_;
+    void* mapping_handle_;
+#else
+    int file_descriptor_;
+#endif
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MAPPED_FILE_H
@@ -0,0 +1,161 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_block_pool.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+thread_local bool MemoryBlockPool::destroyed_ = false;
+
+MemoryBlockPool::~MemoryBlockPool()
+{
+    destroyed_ = true;
+    FreeBlocks();
+}
+
+size_t MemoryBlockPool::GetSizeClass(size_t size)
+{
+    if (size <= kMinSizeClass)
+    {
+        return kMinSizeClass;
+    }
+
+    // Round up to the next multiple of one eighth of the smallest power of two that is greater than or equal to size,
+    // which limits the unused space of a block to less than a quarter of its size.
+    size_t power = kMinSizeClass;
+    while (power < size)
+    {
+        power <<= 1;
+    }
+
+    size_t step = power >> 3;
+    return ((size + step - 1) / step) * step;
+}
+
+std::unique_ptr<unsigned char[]> MemoryBlockPool::Acquire(size_t size, size_t* block_size)
+{
+    assert(block_size != nullptr);
+
+    size_t           size_class = GetSizeClass(size);
+    MemoryBlockPool* pool       = GetThreadInstance();
+
+    (*block_size) = size_class;
+
+    if (pool != nullptr)
+    {
+        ++pool->statistics_.acquire_count;
+
+        auto entry = pool->free_blocks_.find(size_class);
+        if (entry != pool->free_blocks_.end())
+        {
+            std::unique_ptr<unsigned char[]> block = std::move(entry->second.back());
+            entry->second.pop_back();
+
+            if (entry->second.empty())
+            {
+                pool->free_blocks_.erase(entry);
+            }
+
+            ++pool->statistics_.reuse_count;
+            pool->statistics_.retained_size -= size_class;
+
+            return block;
+        }
+    }
+
+    return std::unique_ptr<unsigned char[]>(new unsigned char[size_class]);
+}
+
+void MemoryBlockPool::Release(std::unique_ptr<unsigned char[]> block, size_t block_size)
+{
+    MemoryBlockPool* pool = GetThreadInstance();
+    if ((pool != nullptr) && (block != nullptr))
+    {
+        pool->ReleaseBlock(std::move(block), block_size);
+    }
+
+    // Otherwise, the block is freed when it goes out of scope.
+}
+
+void MemoryBlockPool::Trim()
+{
+    MemoryBlockPool* pool = GetThreadInstance();
+    if (pool != nullptr)
+    {
+        pool->FreeBlocks();
+    }
+}
+
+bool MemoryBlockPool::GetStatistics(Statistics* statistics)
+{
+    assert(statistics != nullptr);
+
+    MemoryBlockPool* pool = GetThreadInstance();
+    if (pool != nullptr)
+    {
+        *statistics = pool->statistics_;
+        return true;
+    }
+
+    return false;
+}
+
+MemoryBlockPool* MemoryBlockPool::GetThreadInstance()
+{
+    if (destroyed_)
+    {
+        return nullptr;
+    }
+
+    static thread_local MemoryBlockPool pool;
+    return &pool;
+}
+
+void MemoryBlockPool::ReleaseBlock(std::unique_ptr<unsigned char[]> block, size_t block_size)
+{
+    assert(block_size == GetSizeClass(block_size));
+
+    ++statistics_.release_count;
+
+    if ((statistics_.retained_size + block_size) <= kMaxRetainedSize)
+    {
+        free_blocks_[block_size].emplace_back(std::move(block));
+
+        statistics_.retained_size += block_size;
+        if (statistics_.retained_size > statistics_.max_retained_size)
+        {
+            statistics_.max_retained_size = statistics_.retained_size;
+        }
+    }
+}
+
+void MemoryBlockPool::FreeBlocks()
+{
+    free_blocks_.clear();
+    statistics_.retained_size = 0;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
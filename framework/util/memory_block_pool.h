@@ -0,0 +1,99 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MEMORY_BLOCK_POOL_H
+#define GFXRECON_UTIL_MEMORY_BLOCK_POOL_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Recycles system memory blocks that are released by allocators, such as MonotonicAllocator, so that blocks freed by
+// one allocator instance can be reused by the next instance without returning to the system heap.  Each thread has its
+// own pool, so Acquire and Release do not lock.  Blocks are rounded up to size classes, with eight classes for each
+// power of two, and free blocks are kept in a list per size class.  A block may be released by a different thread than
+// the one that acquired it, in which case it is recycled by the releasing thread.
+class MemoryBlockPool
+{
+  public:
+    struct Statistics
+    {
+        uint64_t acquire_count{ 0 };     // Number of blocks acquired from the pool.
+        uint64_t reuse_count{ 0 };       // Number of acquired blocks that were recycled from a free list.
+        uint64_t release_count{ 0 };     // Number of blocks released to the pool.
+        size_t   retained_size{ 0 };     // Size of the free blocks currently held by the pool.
+        size_t   max_retained_size{ 0 }; // Largest size of the free blocks held by the pool.
+    };
+
+  public:
+    // Returns the size class for an allocation of size bytes, which is the actual size of the blocks acquired for it.
+    static size_t GetSizeClass(size_t size);
+
+    // Returns a block of GetSizeClass(size) bytes from the calling thread's pool, allocating it from the system heap
+    // when the size class has no free blocks.  The size of the block is written to block_size.
+    static std::unique_ptr<unsigned char[]> Acquire(size_t size, size_t* block_size);
+
+    // Returns a block to the calling thread's pool, where block_size is the size written by Acquire.  The block is
+    // freed when the pool would exceed its retained size limit, or when the thread's pool has been destroyed.
+    static void Release(std::unique_ptr<unsigned char[]> block, size_t block_size);
+
+    // Frees all of the free blocks held by the calling thread's pool.
+    static void Trim();
+
+    // Returns the statistics of the calling thread's pool, or false if the thread has no pool.
+    static bool GetStatistics(Statistics* statistics);
+
+  private:
+    MemoryBlockPool() {}
+
+    ~MemoryBlockPool();
+
+    static MemoryBlockPool* GetThreadInstance();
+
+    void ReleaseBlock(std::unique_ptr<unsigned char[]> block, size_t block_size);
+
+    void FreeBlocks();
+
+  private:
+    typedef std::vector<std::unique_ptr<unsigned char[]>> BlockList;
+
+    static const size_t kMinSizeClass{ 256 };
+    static const size_t kMaxRetainedSize{ 32 * 1024 * 1024 };
+
+    // Set when the thread's pool is destroyed at thread exit, for allocators that are destroyed after the pool.
+    static thread_local bool destroyed_;
+
+    std::map<size_t, BlockList> free_blocks_; // Free lists, keyed by size class.
+    Statistics                  statistics_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MEMORY_BLOCK_POOL_H
@@ -0,0 +1,131 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_diff.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_MEMORY_DIFF_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GFXRECON_MEMORY_DIFF_NEON
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+static_assert(kMemoryDiffBlockSize == 64, "Block comparison functions expect a 64 byte block size");
+
+static bool IsBlockEqual(const uint8_t* current, const uint8_t* previous)
+{
+#if defined(__AVX2__)
+    __m256i diff0 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current)),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(previous)));
+    __m256i diff1 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current + 32)),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(previous + 32)));
+    __m256i diff  = _mm256_or_si256(diff0, diff1);
+    return _mm256_testz_si256(diff, diff) != 0;
+#elif defined(GFXRECON_MEMORY_DIFF_SSE2)
+    __m128i equal = _mm_set1_epi8(-1);
+
+    for (size_t i = 0; i < kMemoryDiffBlockSize; i += 16)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + i));
+        equal     = _mm_and_si128(equal, _mm_cmpeq_epi8(a, b));
+    }
+
+    return _mm_movemask_epi8(equal) == 0xffff;
+#elif defined(GFXRECON_MEMORY_DIFF_NEON)
+    uint8x16_t diff = vdupq_n_u8(0);
+
+    for (size_t i = 0; i < kMemoryDiffBlockSize; i += 16)
+    {
+        diff = vorrq_u8(diff, veorq_u8(vld1q_u8(current + i), vld1q_u8(previous + i)));
+    }
+
+    return vmaxvq_u8(diff) == 0;
+#else
+    uint64_t diff = 0;
+
+    for (size_t i = 0; i < kMemoryDiffBlockSize; i += sizeof(uint64_t))
+    {
+        uint64_t a = 0;
+        uint64_t b = 0;
+        memcpy(&a, current + i, sizeof(a));
+        memcpy(&b, previous + i, sizeof(b));
+        diff |= a ^ b;
+    }
+
+    return diff == 0;
+#endif
+}
+
+void DiffMemory(const void* current, const void* previous, size_t size, const MemoryDiffFunc& handle_modified)
+{
+    const uint8_t* current_bytes  = static_cast<const uint8_t*>(current);
+    const uint8_t* previous_bytes = static_cast<const uint8_t*>(previous);
+    size_t         full_size      = size - (size % kMemoryDiffBlockSize);
+    size_t         range_start    = 0;
+    bool           active_range   = false;
+
+    for (size_t offset = 0; offset < size; offset += kMemoryDiffBlockSize)
+    {
+        bool equal = false;
+
+        if (offset < full_size)
+        {
+            equal = IsBlockEqual(current_bytes + offset, previous_bytes + offset);
+        }
+        else
+        {
+            equal = (memcmp(current_bytes + offset, previous_bytes + offset, size - offset) == 0);
+        }
+
+        if (!equal)
+        {
+            if (!active_range)
+            {
+                active_range = true;
+                range_start  = offset;
+            }
+        }
+        else if (active_range)
+        {
+            active_range = false;
+            handle_modified(range_start, offset - range_start);
+        }
+    }
+
+    if (active_range)
+    {
+        handle_modified(range_start, size - range_start);
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
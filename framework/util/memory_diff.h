@@ -0,0 +1,49 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MEMORY_DIFF_H
+#define GFXRECON_UTIL_MEMORY_DIFF_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <functional>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Granularity of the comparison performed by DiffMemory.
+const size_t kMemoryDiffBlockSize = 64;
+
+// Callback for processing modified memory.  The function parameters are the offset from the start of the compared
+// memory to the start of the modified range, and the size of the modified range.
+typedef std::function<void(size_t, size_t)> MemoryDiffFunc;
+
+// Compares two memory ranges in blocks of kMemoryDiffBlockSize bytes, invoking the callback once for each run of
+// consecutive blocks with different content.  The last block may be a partial block when size is not a multiple of the
+// block size.  Blocks are compared with SSE2/AVX2 or NEON instructions when available.
+void DiffMemory(const void* current, const void* previous, size_t size, const MemoryDiffFunc& handle_modified);
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MEMORY_DIFF_H
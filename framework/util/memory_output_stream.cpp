@@ -48,8 +48,7 @@ MemoryOutputStream::~MemoryOutputStream() {}
 
 size_t MemoryOutputStream::Write(const void* data, size_t len)
 {
-    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
-    buffer_.insert(buffer_.end(), bytes, bytes + len);
+    Append(data, len);
 
     return len;
 }
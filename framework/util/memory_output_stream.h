@@ -27,6 +27,7 @@
 #include "util/defines.h"
 #include "util/output_stream.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
@@ -53,6 +54,24 @@ class MemoryOutputStream : public OutputStream
 
     virtual size_t Write(const void* data, size_t len) override;
 
+    // Non-virtual form of Write(), which can be inlined by encoders that write many small values to the stream.
+    void Append(const void* data, size_t len)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + len);
+    }
+
+    // Ensures that len bytes can be appended without reallocating the buffer, preserving its geometric growth.
+    void Reserve(size_t len)
+    {
+        size_t required = buffer_.size() + len;
+
+        if (required > buffer_.capacity())
+        {
+            buffer_.reserve(std::max(required, buffer_.capacity() * 2));
+        }
+    }
+
     virtual const uint8_t* GetData() const { return buffer_.data(); }
 
     virtual size_t GetDataSize() const { return buffer_.size(); }
@@ -0,0 +1,293 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/mmap_output_stream.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#if defined(WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Windows requires view offsets to be a multiple of the 64 KiB allocation granularity, which is also a multiple of the
+// page size on all supported POSIX platforms.
+const size_t kChunkAlignment = 64 * 1024;
+
+MmapOutputStream::MmapOutputStream(const std::string& filename, size_t chunk_size) :
+    chunk_size_(((std::max(chunk_size, kChunkAlignment) + kChunkAlignment - 1) / kChunkAlignment) * kChunkAlignment),
+    data_size_(0), view_offset_(0), view_(nullptr),
+#if defined(WIN32)
+    file_handle_(INVALID_HANDLE_VALUE), mapping_handle_(nullptr)
+#else
+    file_descriptor_(-1)
+#endif
+{
+    if (OpenFile(filename))
+    {
+        if (!MapChunk(0))
+        {
+            CloseFile();
+        }
+    }
+}
+
+MmapOutputStream::~MmapOutputStream()
+{
+    CloseFile();
+}
+
+size_t MmapOutputStream::Write(const void* data, size_t len)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return CopyToView(data, len);
+}
+
+size_t MmapOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    size_t written = 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        written += CopyToView(buffers[i].data, buffers[i].size);
+    }
+
+    return written;
+}
+
+void MmapOutputStream::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (view_ != nullptr)
+    {
+#if defined(WIN32)
+        FlushViewOfFile(view_, static_cast<SIZE_T>(data_size_ - view_offset_));
+#else
+        msync(view_, static_cast<size_t>(data_size_ - view_offset_), MS_ASYNC);
+#endif
+    }
+}
+
+size_t MmapOutputStream::CopyToView(const void* data, size_t len)
+{
+    const uint8_t* bytes   = reinterpret_cast<const uint8_t*>(data);
+    size_t         written = 0;
+
+    while ((written < len) && (view_ != nullptr))
+    {
+        size_t view_position = static_cast<size_t>(data_size_ - view_offset_);
+
+        if (view_position == chunk_size_)
+        {
+            // The current chunk is full; extend the file and map the next chunk.
+            MapChunk(view_offset_ + chunk_size_);
+        }
+        else
+        {
+            size_t copy_size = std::min(len - written, chunk_size_ - view_position);
+
+            util::platform::MemoryCopy(view_ + view_position, copy_size, bytes + written, copy_size);
+
+            data_size_ += copy_size;
+            written += copy_size;
+        }
+    }
+
+    return written;
+}
+
+#if defined(WIN32)
+bool MmapOutputStream::OpenFile(const std::string& filename)
+{
+    file_handle_ = CreateFileA(filename.c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ,
+                               nullptr,
+                               CREATE_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+
+    if (file_handle_ == INVALID_HANDLE_VALUE)
+    {
+        GFXRECON_LOG_ERROR("CreateFile(%s) failed (error = %u)", filename.c_str(), GetLastError());
+        return false;
+    }
+
+    return true;
+}
+
+void MmapOutputStream::CloseFile()
+{
+    UnmapChunk();
+
+    if (file_handle_ != INVALID_HANDLE_VALUE)
+    {
+        // Remove the unused space from the end of the last chunk.
+        LARGE_INTEGER file_size;
+        file_size.QuadPart = static_cast<LONGLONG>(data_size_);
+
+        if (!SetFilePointerEx(file_handle_, file_size, nullptr, FILE_BEGIN) || !SetEndOfFile(file_handle_))
+        {
+            GFXRECON_LOG_ERROR("Failed to set the final capture file size (error = %u)", GetLastError());
+        }
+
+        CloseHandle(file_handle_);
+        file_handle_ = INVALID_HANDLE_VALUE;
+    }
+}
+
+bool MmapOutputStream::MapChunk(uint64_t offset)
+{
+    UnmapChunk();
+
+    // Creating a mapping larger than the file extends the file to the size of the mapping.
+    uint64_t file_size = offset + chunk_size_;
+
+    mapping_handle_ = CreateFileMappingA(file_handle_,
+                                         nullptr,
+                                         PAGE_READWRITE,
+                                         static_cast<DWORD>(file_size >> 32),
+                                         static_cast<DWORD>(file_size & 0xffffffff),
+                                         nullptr);
+
+    if (mapping_handle_ != nullptr)
+    {
+        view_ = reinterpret_cast<uint8_t*>(MapViewOfFile(mapping_handle_,
+                                                         FILE_MAP_WRITE,
+                                                         static_cast<DWORD>(offset >> 32),
+                                                         static_cast<DWORD>(offset & 0xffffffff),
+                                                         chunk_size_));
+    }
+
+    if (view_ != nullptr)
+    {
+        view_offset_ = offset;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to map capture file region at offset %" PRIu64 " (error = %u)",
+                           offset,
+                           GetLastError());
+    }
+
+    return (view_ != nullptr);
+}
+
+void MmapOutputStream::UnmapChunk()
+{
+    if (view_ != nullptr)
+    {
+        UnmapViewOfFile(view_);
+        view_ = nullptr;
+    }
+
+    if (mapping_handle_ != nullptr)
+    {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+}
+#else
+bool MmapOutputStream::OpenFile(const std::string& filename)
+{
+    file_descriptor_ = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+    if (file_descriptor_ < 0)
+    {
+        GFXRECON_LOG_ERROR("open(%s) failed (errno = %d)", filename.c_str(), errno);
+        return false;
+    }
+
+    return true;
+}
+
+void MmapOutputStream::CloseFile()
+{
+    UnmapChunk();
+
+    if (file_descriptor_ >= 0)
+    {
+        // Remove the unused space from the end of the last chunk.
+        if (ftruncate(file_descriptor_, static_cast<off_t>(data_size_)) != 0)
+        {
+            GFXRECON_LOG_ERROR("Failed to set the final capture file size (errno = %d)", errno);
+        }
+
+        close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+}
+
+bool MmapOutputStream::MapChunk(uint64_t offset)
+{
+    UnmapChunk();
+
+    if (ftruncate(file_descriptor_, static_cast<off_t>(offset + chunk_size_)) == 0)
+    {
+        void* view = mmap(
+            nullptr, chunk_size_, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor_, static_cast<off_t>(offset));
+
+        if (view != MAP_FAILED)
+        {
+            view_        = reinterpret_cast<uint8_t*>(view);
+            view_offset_ = offset;
+        }
+    }
+
+    if (view_ == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to map capture file region at offset %" PRIu64 " (errno = %d)", offset, errno);
+    }
+
+    return (view_ != nullptr);
+}
+
+void MmapOutputStream::UnmapChunk()
+{
+    if (view_ != nullptr)
+    {
+        munmap(view_, chunk_size_);
+        view_ = nullptr;
+    }
+}
+#endif
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,88 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MMAP_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_MMAP_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that writes to a memory mapped file.  The file is extended and mapped one chunk at a time, and data
+// passed to Write() is copied directly to the mapped region, leaving write back to the operating system's page cache.
+// The file is truncated to the size of the written data when the stream is destroyed; if the process terminates
+// without destroying the stream, the file may contain zero filled space after the last write.
+class MmapOutputStream : public OutputStream
+{
+  public:
+    static const size_t kDefaultChunkSize = 64 * 1024 * 1024;
+
+  public:
+    // The chunk size is rounded up to a multiple of 64 KiB to satisfy mapping alignment requirements.
+    MmapOutputStream(const std::string& filename, size_t chunk_size = kDefaultChunkSize);
+
+    virtual ~MmapOutputStream() override;
+
+    virtual bool IsValid() override { return (view_ != nullptr); }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count) override;
+
+    // Initiates write back of the mapped data to the file, without waiting for it to complete.
+    virtual void Flush() override;
+
+  private:
+    bool OpenFile(const std::string& filename);
+
+    void CloseFile();
+
+    bool MapChunk(uint64_t offset);
+
+    void UnmapChunk();
+
+    size_t CopyToView(const void* data, size_t len);
+
+  private:
+    size_t     chunk_size_;
+    uint64_t   data_size_;
+    uint64_t   view_offset_;
+    uint8_t*   view_;
+    std::mutex mutex_;
+#if defined(WIN32)
+    void* file_handle_;
+    void* mapping_handle_;
+#else
+    int file_descriptor_;
+#endif
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MMAP_OUTPUT_STREAM_H
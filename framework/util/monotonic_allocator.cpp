@@ -23,9 +23,19 @@
 
 #include "util/monotonic_allocator.h"
 
+#include "util/memory_block_pool.h"
+
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+MonotonicAllocator::MonotonicAllocator(size_t block_size, size_t max_retained_oversized, bool use_block_pool) :
+    block_size_(use_block_pool ? MemoryBlockPool::GetSizeClass(block_size) : block_size),
+    max_retained_oversized_(max_retained_oversized), use_block_pool_(use_block_pool), current_block_(0),
+    current_block_free_bytes_(block_size_), allocated_bytes_(0)
+{}
+
 void MonotonicAllocator::Clear(bool free_system_memory)
 {
     // Call destructors of allocated objects
@@ -38,14 +48,36 @@ void MonotonicAllocator::Clear(bool free_system_memory)
     // Free memory blocks
     if (free_system_memory)
     {
+        for (auto& block : memory_blocks_)
+        {
+            FreeSystemMemory(std::move(block), block_size_);
+        }
         memory_blocks_.clear();
+
+        for (auto& allocation : retained_allocations_)
+        {
+            FreeSystemMemory(std::move(allocation.data), allocation.size);
+        }
+        retained_allocations_.clear();
     }
 
     // Free oversized allocations
-    oversized_allocations_.clear();
+    if (free_system_memory || (max_retained_oversized_ == 0))
+    {
+        for (auto& allocation : oversized_allocations_)
+        {
+            FreeSystemMemory(std::move(allocation.data), allocation.size);
+        }
+        oversized_allocations_.clear();
+    }
+    else
+    {
+        RetainOversizedAllocations();
+    }
 
     current_block_            = 0;
     current_block_free_bytes_ = block_size_;
+    allocated_bytes_          = 0;
 }
 
 void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
@@ -59,6 +91,12 @@ void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
         return nullptr;
     }
 
+    allocated_bytes_ += object_bytes;
+    if (allocated_bytes_ > statistics_.high_water_mark)
+    {
+        statistics_.high_water_mark = allocated_bytes_;
+    }
+
     if (object_bytes <= block_size_)
     {
         // Try to allocate to an existing block
@@ -75,20 +113,118 @@ void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
 
         if (result == nullptr)
         {
-            memory_blocks_.emplace_back(new unsigned char[block_size_]);
+            size_t allocated_size = 0;
+            memory_blocks_.emplace_back(AllocateSystemMemory(block_size_, &allocated_size));
+            assert(allocated_size == block_size_);
             result = AllocateToBlock(object_bytes, alignment_bytes);
         }
     }
     else
     {
-        // Custom allocation
-        oversized_allocations_.emplace_back(new unsigned char[object_bytes]);
-        result = oversized_allocations_.back().get();
+        result = AllocateOversized(object_bytes);
     }
 
     return result;
 }
 
+void* MonotonicAllocator::AllocateOversized(size_t object_bytes)
+{
+    // Reuse the smallest retained allocation that is large enough for the request.
+    auto retained = std::lower_bound(retained_allocations_.begin(),
+                                     retained_allocations_.end(),
+                                     object_bytes,
+                                     [](const OversizedAllocation& allocation, size_t size) {
+                                         return allocation.size < size;
+                                     });
+
+    if (retained != retained_allocations_.end())
+    {
+        oversized_allocations_.emplace_back(std::move(*retained));
+        retained_allocations_.erase(retained);
+    }
+    else
+    {
+        // Custom allocation
+        size_t allocated_size = 0;
+        auto   data           = AllocateSystemMemory(object_bytes, &allocated_size);
+        oversized_allocations_.push_back({ std::move(data), allocated_size });
+    }
+
+    return oversized_allocations_.back().data.get();
+}
+
+void MonotonicAllocator::RetainOversizedAllocations()
+{
+    for (auto& allocation : oversized_allocations_)
+    {
+        retained_allocations_.emplace_back(std::move(allocation));
+    }
+    oversized_allocations_.clear();
+
+    std::sort(retained_allocations_.begin(),
+              retained_allocations_.end(),
+              [](const OversizedAllocation& lhs, const OversizedAllocation& rhs) { return lhs.size < rhs.size; });
+
+    // Only the largest allocations are kept.
+    if (retained_allocations_.size() > max_retained_oversized_)
+    {
+        auto end = retained_allocations_.begin() + (retained_allocations_.size() - max_retained_oversized_);
+
+        for (auto allocation = retained_allocations_.begin(); allocation != end; ++allocation)
+        {
+            FreeSystemMemory(std::move(allocation->data), allocation->size);
+        }
+
+        retained_allocations_.erase(retained_allocations_.begin(), end);
+    }
+}
+
+void MonotonicAllocator::UpdateSystemMemorySize(size_t allocated_size, size_t freed_size)
+{
+    if (allocated_size > 0)
+    {
+        ++statistics_.system_allocation_count;
+    }
+
+    statistics_.system_memory_size = statistics_.system_memory_size + allocated_size - freed_size;
+
+    if (statistics_.system_memory_size > statistics_.max_system_memory_size)
+    {
+        statistics_.max_system_memory_size = statistics_.system_memory_size;
+    }
+}
+
+std::unique_ptr<unsigned char[]> MonotonicAllocator::AllocateSystemMemory(size_t size, size_t* allocated_size)
+{
+    assert(allocated_size != nullptr);
+
+    std::unique_ptr<unsigned char[]> memory;
+
+    if (use_block_pool_)
+    {
+        memory = MemoryBlockPool::Acquire(size, allocated_size);
+    }
+    else
+    {
+        memory.reset(new unsigned char[size]);
+        (*allocated_size) = size;
+    }
+
+    UpdateSystemMemorySize(*allocated_size, 0);
+
+    return memory;
+}
+
+void MonotonicAllocator::FreeSystemMemory(std::unique_ptr<unsigned char[]> memory, size_t size)
+{
+    UpdateSystemMemorySize(0, size);
+
+    if (use_block_pool_)
+    {
+        MemoryBlockPool::Release(std::move(memory), size);
+    }
+}
+
 void* MonotonicAllocator::AllocateToBlock(size_t object_bytes, size_t alignment_bytes)
 {
     void* block_ptr =
@@ -26,7 +26,10 @@
 
 #include "util/defines.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -35,13 +38,23 @@ GFXRECON_BEGIN_NAMESPACE(util)
 // An allocator that manages and allocates from a pool of system memory blocks
 class MonotonicAllocator
 {
+  public:
+    struct Statistics
+    {
+        size_t   high_water_mark{ 0 };         // Largest number of bytes allocated between calls to Clear.
+        size_t   system_memory_size{ 0 };      // Size of the system memory currently held by the allocator.
+        size_t   max_system_memory_size{ 0 };  // Largest size of the system memory held by the allocator.
+        uint64_t system_allocation_count{ 0 }; // Number of system memory blocks acquired, including recycled blocks.
+    };
+
   public:
     // block_size is the size of the individual memory blocks allocated. The number of blocks increases as needed to
     // fit requested allocations, and blocks are freed using an appropriate call to Clear or upon destruction of this
-    // MonotonicAllocator
-    MonotonicAllocator(size_t block_size) :
-        block_size_(block_size), current_block_(0), current_block_free_bytes_(block_size)
-    {}
+    // MonotonicAllocator. When system memory is not freed by Clear, up to max_retained_oversized of the largest
+    // oversized allocations are kept for reuse by later oversized allocations. When use_block_pool is true, blocks and
+    // oversized allocations are acquired from and freed to the calling thread's MemoryBlockPool, and block_size is
+    // rounded up to a pool size class.
+    MonotonicAllocator(size_t block_size, size_t max_retained_oversized = 0, bool use_block_pool = false);
 
     ~MonotonicAllocator() { Clear(true); }
 
@@ -69,14 +82,37 @@ class MonotonicAllocator
         return result;
     }
 
+    // Allocates memory for a single object of type T and constructs it with the specified arguments. The object is
+    // destroyed by the next call to Clear.
+    template <typename T, typename... Args>
+    T* Construct(Args&&... args)
+    {
+        T* result = reinterpret_cast<T*>(Allocate(sizeof(T), alignof(T)));
+        assert(result != nullptr);
+        if (result != nullptr)
+        {
+            new (result) T(std::forward<Args>(args)...);
+            if (!std::is_trivially_destructible<T>())
+            {
+                destructors_.push_back({ result, [](const void* x) { static_cast<const T*>(x)->~T(); } });
+            }
+        }
+        return result;
+    }
+
+    // Allocates size bytes of uninitialized memory with the specified alignment. The memory is valid until the next
+    // call to Clear.
+    void* AllocateBytes(size_t size, size_t alignment = alignof(std::max_align_t)) { return Allocate(size, alignment); }
+
     // "Frees" all previously allocated objects. Depending on free_system_memory, system memory blocks are either
     // reused for new calls to Allocate or freed and re-created as needed. Oversized allocations are freed from system
-    // memory
+    // memory, unless they are retained for reuse.
     void Clear(bool free_system_memory);
 
-  private:
-    void* Allocate(size_t object_bytes, size_t alignment_bytes);
-    void* AllocateToBlock(size_t object_bytes, size_t alignment_bytes);
+    const Statistics& GetStatistics() const { return statistics_; }
+
+    // Returns the number of bytes allocated since the last call to Clear.
+    size_t GetAllocatedSize() const { return allocated_bytes_; }
 
   private:
     struct Destructor
@@ -85,13 +121,34 @@ class MonotonicAllocator
         void (*destroy)(const void*);
     };
 
+    struct OversizedAllocation
+    {
+        std::unique_ptr<unsigned char[]> data;
+        size_t                           size;
+    };
+
+  private:
+    void* Allocate(size_t object_bytes, size_t alignment_bytes);
+    void* AllocateToBlock(size_t object_bytes, size_t alignment_bytes);
+    void* AllocateOversized(size_t object_bytes);
+    void  RetainOversizedAllocations();
+    void  UpdateSystemMemorySize(size_t allocated_size, size_t freed_size);
+
+    std::unique_ptr<unsigned char[]> AllocateSystemMemory(size_t size, size_t* allocated_size);
+    void                             FreeSystemMemory(std::unique_ptr<unsigned char[]> memory, size_t size);
+
   private:
     std::vector<std::unique_ptr<unsigned char[]>> memory_blocks_;
-    std::vector<std::unique_ptr<unsigned char[]>> oversized_allocations_;
+    std::vector<OversizedAllocation>              oversized_allocations_;
+    std::vector<OversizedAllocation>              retained_allocations_; // Sorted by increasing size.
     std::vector<Destructor>                       destructors_;
     const size_t                                  block_size_;
+    const size_t                                  max_retained_oversized_;
+    const bool                                    use_block_pool_;
     size_t                                        current_block_;
     size_t                                        current_block_free_bytes_;
+    size_t                                        allocated_bytes_; // Bytes allocated since the last call to Clear.
+    Statistics                                    statistics_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -0,0 +1,193 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/mpsc_ring_buffer.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Record headers are accessed through std::atomic<uint64_t> pointers into the uint64_t storage array.
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "Unexpected std::atomic<uint64_t> size");
+
+const size_t kMinCapacity = 4096;
+
+MpscRingBuffer::MpscRingBuffer(size_t capacity) :
+    capacity_(kMinCapacity), mask_(0), write_position_(0), read_position_(0)
+{
+    while (capacity_ < capacity)
+    {
+        capacity_ <<= 1;
+    }
+
+    mask_ = capacity_ - 1;
+
+    // Storage is zero initialized, as the consumer identifies records by a non-zero committed header.
+    storage_ = std::make_unique<uint64_t[]>(capacity_ / sizeof(uint64_t));
+}
+
+MpscRingBuffer::~MpscRingBuffer() {}
+
+uint8_t* MpscRingBuffer::Reserve(size_t size)
+{
+    uint8_t* record_data = nullptr;
+
+    if (size <= GetMaxRecordSize())
+    {
+        size_t   record_size = GetRecordSize(size);
+        uint64_t position    = write_position_.load(std::memory_order_relaxed);
+        size_t   padding     = 0;
+        bool     reserved    = false;
+
+        do
+        {
+            // Records are not split across the end of the buffer.  When the record does not fit in the space remaining
+            // before the end of the buffer, that space is reserved as padding and the record starts at the beginning.
+            size_t contiguous = capacity_ - static_cast<size_t>(position & mask_);
+            padding           = (record_size > contiguous) ? contiguous : 0;
+
+            uint64_t end = position + padding + record_size;
+            if ((end - read_position_.load(std::memory_order_acquire)) > capacity_)
+            {
+                break;
+            }
+
+            reserved = write_position_.compare_exchange_weak(
+                position, end, std::memory_order_relaxed, std::memory_order_relaxed);
+        } while (!reserved);
+
+        if (reserved)
+        {
+            if (padding > 0)
+            {
+                GetHeader(position)->store(kCommittedBit | kPaddingBit | (padding - kHeaderSize),
+                                           std::memory_order_release);
+                position += padding;
+            }
+
+            // The size is stored now, and the committed bit is set by Commit().
+            std::atomic<uint64_t>* header = GetHeader(position);
+            header->store(size, std::memory_order_relaxed);
+
+            record_data = reinterpret_cast<uint8_t*>(header) + kHeaderSize;
+        }
+    }
+
+    return record_data;
+}
+
+void MpscRingBuffer::Commit(uint8_t* record_data, uint32_t record_type)
+{
+    assert(record_data != nullptr);
+    assert(record_type <= kMaxRecordType);
+
+    std::atomic<uint64_t>* header = reinterpret_cast<std::atomic<uint64_t>*>(record_data - kHeaderSize);
+    uint64_t               value  = header->load(std::memory_order_relaxed);
+
+    header->store(value | kCommittedBit | (static_cast<uint64_t>(record_type) << kTypeShift),
+                  std::memory_order_release);
+}
+
+bool MpscRingBuffer::Peek(Record* record)
+{
+    assert(record != nullptr);
+
+    bool found = false;
+
+    for (;;)
+    {
+        uint64_t               position = read_position_.load(std::memory_order_relaxed);
+        std::atomic<uint64_t>* header   = GetHeader(position);
+        uint64_t               value    = header->load(std::memory_order_acquire);
+
+        if ((value & kCommittedBit) == 0)
+        {
+            break;
+        }
+
+        size_t size = static_cast<size_t>(value & kSizeMask);
+
+        if ((value & kPaddingBit) != 0)
+        {
+            // Padding contents were never written by a producer, so only the header needs to be cleared.
+            header->store(0, std::memory_order_relaxed);
+            read_position_.store(position + GetRecordSize(size), std::memory_order_release);
+        }
+        else
+        {
+            record->data = reinterpret_cast<const uint8_t*>(header) + kHeaderSize;
+            record->size = size;
+            record->type = static_cast<uint32_t>((value >> kTypeShift) & kMaxRecordType);
+            found        = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void MpscRingBuffer::Pop()
+{
+    uint64_t               position = read_position_.load(std::memory_order_relaxed);
+    std::atomic<uint64_t>* header   = GetHeader(position);
+    uint64_t               value    = header->load(std::memory_order_relaxed);
+    size_t                 size     = static_cast<size_t>(value & kSizeMask);
+    size_t                 length   = GetRecordSize(size);
+
+    assert((value & kCommittedBit) != 0);
+
+    // Future record headers may be placed anywhere within the released space, so the entire record is cleared before
+    // it is made available to producers.
+    header->store(0, std::memory_order_relaxed);
+    memset(reinterpret_cast<uint8_t*>(header) + kHeaderSize, 0, length - kHeaderSize);
+
+    read_position_.store(position + length, std::memory_order_release);
+}
+
+bool MpscRingBuffer::IsEmpty() const
+{
+    return read_position_.load(std::memory_order_acquire) == write_position_.load(std::memory_order_acquire);
+}
+
+size_t MpscRingBuffer::GetUsedSize() const
+{
+    // The read position is loaded first, so that it can not pass the write position that is loaded after it.
+    uint64_t read_position  = read_position_.load(std::memory_order_acquire);
+    uint64_t write_position = write_position_.load(std::memory_order_acquire);
+    return static_cast<size_t>(write_position - read_position);
+}
+
+std::atomic<uint64_t>* MpscRingBuffer::GetHeader(uint64_t position) const
+{
+    return reinterpret_cast<std::atomic<uint64_t>*>(storage_.get() + ((position & mask_) / sizeof(uint64_t)));
+}
+
+size_t MpscRingBuffer::GetRecordSize(size_t payload_size)
+{
+    // Records are padded to keep headers 8-byte aligned.
+    return (kHeaderSize + payload_size + (sizeof(uint64_t) - 1)) & ~(sizeof(uint64_t) - 1);
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
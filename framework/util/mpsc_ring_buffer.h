@@ -0,0 +1,113 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MPSC_RING_BUFFER_H
+#define GFXRECON_UTIL_MPSC_RING_BUFFER_H
+
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Lock-free, multi-producer single-consumer ring buffer of variable sized records.
+//
+// Producers call Reserve() to claim space for a record, copy the record data to the returned pointer, and then call
+// Commit().  Space is claimed with a single compare-and-swap, so producers never block each other while copying data.
+// The consumer calls Peek() to retrieve the oldest record, which is available once it has been committed, and Pop() to
+// release its space.  Records are retrieved in the order that space was reserved.
+class MpscRingBuffer
+{
+  public:
+    struct Record
+    {
+        const uint8_t* data{ nullptr };
+        size_t         size{ 0 };
+        uint32_t       type{ 0 };
+    };
+
+    static const uint32_t kMaxRecordType = 0xffff;
+
+  public:
+    // The capacity is rounded up to a power of two.
+    MpscRingBuffer(size_t capacity);
+
+    ~MpscRingBuffer();
+
+    size_t GetCapacity() const { return capacity_; }
+
+    // Largest record that can be reserved.  Records are stored contiguously, so the limit is half of the capacity to
+    // ensure that a record can always be reserved after wrapping around the end of the buffer.
+    size_t GetMaxRecordSize() const { return (capacity_ / 2) - kHeaderSize; }
+
+    // Producer interface.  Returns a pointer to size bytes of record storage, or nullptr if there is not enough free
+    // space.  The record becomes visible to the consumer when Commit() is called with the returned pointer.
+    uint8_t* Reserve(size_t size);
+
+    void Commit(uint8_t* record_data, uint32_t record_type);
+
+    // Consumer interface.  Only one thread may call these functions.  Peek() returns false if the oldest record has not
+    // been committed.  Pop() releases the record that was returned by the last successful call to Peek().
+    bool Peek(Record* record);
+
+    void Pop();
+
+    bool IsEmpty() const;
+
+    // Bytes of record storage that have been reserved and not yet released, including record headers and padding.  May
+    // be called from any thread.
+    size_t GetUsedSize() const;
+
+  private:
+    static const size_t   kHeaderSize    = sizeof(uint64_t);
+    static const uint64_t kCommittedBit  = 1ull << 63;
+    static const uint64_t kPaddingBit    = 1ull << 62;
+    static const uint64_t kSizeMask      = 0xffffffffull;
+    static const uint32_t kTypeShift     = 32;
+    static const size_t   kCacheLineSize = 64;
+
+  private:
+    std::atomic<uint64_t>* GetHeader(uint64_t position) const;
+
+    static size_t GetRecordSize(size_t payload_size);
+
+  private:
+    size_t                      capacity_;
+    uint64_t                    mask_;
+    std::unique_ptr<uint64_t[]> storage_;
+
+    // Keep the producer and consumer positions on separate cache lines.
+    uint8_t               padding0_[kCacheLineSize];
+    std::atomic<uint64_t> write_position_;
+    uint8_t               padding1_[kCacheLineSize];
+    std::atomic<uint64_t> read_position_;
+    uint8_t               padding2_[kCacheLineSize];
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MPSC_RING_BUFFER_H
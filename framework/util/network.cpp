@@ -0,0 +1,215 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/network.h"
+
+#include "util/logging.h"
+
+#if defined(WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <errno.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(network)
+
+#if defined(WIN32)
+typedef SOCKET            SocketHandle;
+static const SocketHandle kInvalidHandle = INVALID_SOCKET;
+#else
+typedef int               SocketHandle;
+static const SocketHandle kInvalidHandle = -1;
+#endif
+
+const char      kAddressPrefix[] = "tcp://";
+const uintptr_t kInvalidSocket   = static_cast<uintptr_t>(kInvalidHandle);
+
+bool Initialize()
+{
+#if defined(WIN32)
+    WSADATA wsa_data;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to initialize Windows Sockets");
+        return false;
+    }
+#endif
+    return true;
+}
+
+void Terminate()
+{
+#if defined(WIN32)
+    WSACleanup();
+#endif
+}
+
+bool IsSocketAddress(const std::string& name)
+{
+    return (name.compare(0, strlen(kAddressPrefix), kAddressPrefix) == 0);
+}
+
+bool ParseAddress(const std::string& address, std::string* host, std::string* port)
+{
+    assert((host != nullptr) && (port != nullptr));
+
+    std::string location = IsSocketAddress(address) ? address.substr(strlen(kAddressPrefix)) : address;
+    size_t      colon    = location.rfind(':');
+
+    if ((colon == std::string::npos) || (colon == (location.length() - 1)))
+    {
+        GFXRECON_LOG_ERROR("Invalid socket address %s; expected tcp://host:port or tcp://:port", address.c_str());
+        return false;
+    }
+
+    (*host) = location.substr(0, colon);
+    (*port) = location.substr(colon + 1);
+
+    // Strip the brackets from IPv6 addresses.
+    if ((host->length() > 1) && (host->front() == '[') && (host->back() == ']'))
+    {
+        (*host) = host->substr(1, host->length() - 2);
+    }
+
+    return true;
+}
+
+uintptr_t Connect(const std::string& host, const std::string& port)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo* addresses = nullptr;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to resolve socket address %s:%s", host.c_str(), port.c_str());
+        return kInvalidSocket;
+    }
+
+    SocketHandle connection = kInvalidHandle;
+
+    for (auto entry = addresses; (entry != nullptr) && (connection == kInvalidHandle); entry = entry->ai_next)
+    {
+        connection = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+
+        if ((connection != kInvalidHandle) &&
+            (connect(connection, entry->ai_addr, static_cast<int>(entry->ai_addrlen)) != 0))
+        {
+            Close(static_cast<uintptr_t>(connection));
+            connection = kInvalidHandle;
+        }
+    }
+
+    freeaddrinfo(addresses);
+
+    if (connection == kInvalidHandle)
+    {
+        GFXRECON_LOG_ERROR("Failed to connect to %s:%s", host.c_str(), port.c_str());
+    }
+
+    return static_cast<uintptr_t>(connection);
+}
+
+uintptr_t Accept(const std::string& port)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = AI_PASSIVE;
+
+    struct addrinfo* addresses = nullptr;
+    if (getaddrinfo(nullptr, port.c_str(), &hints, &addresses) != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to resolve socket port %s", port.c_str());
+        return kInvalidSocket;
+    }
+
+    SocketHandle listener = socket(addresses->ai_family, addresses->ai_socktype, addresses->ai_protocol);
+
+    if (listener != kInvalidHandle)
+    {
+        int reuse = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+        if ((bind(listener, addresses->ai_addr, static_cast<int>(addresses->ai_addrlen)) != 0) ||
+            (listen(listener, 1) != 0))
+        {
+            Close(static_cast<uintptr_t>(listener));
+            listener = kInvalidHandle;
+        }
+    }
+
+    freeaddrinfo(addresses);
+
+    if (listener == kInvalidHandle)
+    {
+        GFXRECON_LOG_ERROR("Failed to listen for connections on port %s", port.c_str());
+        return kInvalidSocket;
+    }
+
+    GFXRECON_LOG_INFO("Waiting for a connection on port %s", port.c_str());
+
+    SocketHandle connection = accept(listener, nullptr, nullptr);
+    Close(static_cast<uintptr_t>(listener));
+
+    if (connection == kInvalidHandle)
+    {
+        GFXRECON_LOG_ERROR("Failed to accept a connection on port %s", port.c_str());
+    }
+
+    return static_cast<uintptr_t>(connection);
+}
+
+void Close(uintptr_t socket)
+{
+#if defined(WIN32)
+    closesocket(static_cast<SocketHandle>(socket));
+#else
+    close(static_cast<SocketHandle>(socket));
+#endif
+}
+
+bool IsInterrupted()
+{
+#if defined(WIN32)
+    return (WSAGetLastError() == WSAEINTR);
+#else
+    return (errno == EINTR);
+#endif
+}
+
+GFXRECON_END_NAMESPACE(network)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
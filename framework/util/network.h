@@ -0,0 +1,68 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_NETWORK_H
+#define GFXRECON_UTIL_NETWORK_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(network)
+
+// TCP connection helpers shared by the socket streams.  Sockets are stored as uintptr_t values, which can hold both
+// POSIX file descriptors and Windows SOCKET handles.
+
+extern const char      kAddressPrefix[];
+extern const uintptr_t kInvalidSocket;
+
+// Initializes Windows Sockets.  Each successful call must be matched by a call to Terminate().
+bool Initialize();
+
+void Terminate();
+
+// Returns true for names of the form "tcp://host:port" or "tcp://:port".
+bool IsSocketAddress(const std::string& name);
+
+// Splits a socket address into its host and port, removing the brackets from IPv6 hosts.  The host is empty when the
+// address specifies a port to listen on.
+bool ParseAddress(const std::string& address, std::string* host, std::string* port);
+
+// Connects to a server, returning kInvalidSocket on failure.
+uintptr_t Connect(const std::string& host, const std::string& port);
+
+// Listens on the port and accepts a single connection, returning kInvalidSocket on failure.
+uintptr_t Accept(const std::string& port);
+
+void Close(uintptr_t socket);
+
+// Returns true when the last failed socket call was interrupted by a signal and can be retried.
+bool IsInterrupted();
+
+GFXRECON_END_NAMESPACE(network)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_NETWORK_H
@@ -0,0 +1,214 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_OBJECT_POOL_H
+#define GFXRECON_UTIL_OBJECT_POOL_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Allocates objects of type T from slabs of contiguous storage that are shared by all threads.  Each thread keeps a
+// small free list of object slots so that most Create and Destroy calls do not need to lock the pool.  Slots are moved
+// between the thread free lists and the shared free list in batches.  Slab memory is only released when the process
+// exits.
+template <typename T>
+class ObjectPool
+{
+  public:
+    template <typename... Args>
+    static T* Create(Args&&... args)
+    {
+        void* storage = GetThreadCache().Acquire();
+        return new (storage) T(std::forward<Args>(args)...);
+    }
+
+    static void Destroy(T* object)
+    {
+        if (object != nullptr)
+        {
+            object->~T();
+            GetThreadCache().Release(reinterpret_cast<Slot*>(object));
+        }
+    }
+
+  private:
+    static const size_t kSlabSlotCount = 256; // Number of objects allocated from the system heap at a time.
+    static const size_t kBatchSize     = 32;  // Number of slots moved between the thread and shared free lists.
+    static const size_t kMaxCacheSize  = 64;  // Number of free slots a thread may hold before returning a batch.
+
+    union Slot
+    {
+        Slot*                                                      next;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    class SharedPool
+    {
+      public:
+        // Returns a list of up to count free slots and the number of slots in the list.
+        Slot* AcquireBatch(size_t count, size_t* acquired)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (free_list_ == nullptr)
+            {
+                AllocateSlab();
+            }
+
+            Slot*  head  = free_list_;
+            Slot*  tail  = free_list_;
+            size_t total = 1;
+
+            while ((total < count) && (tail->next != nullptr))
+            {
+                tail = tail->next;
+                ++total;
+            }
+
+            free_list_  = tail->next;
+            tail->next  = nullptr;
+            (*acquired) = total;
+
+            return head;
+        }
+
+        void ReleaseBatch(Slot* head, Slot* tail)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tail->next = free_list_;
+            free_list_ = head;
+        }
+
+      private:
+        void AllocateSlab()
+        {
+            std::unique_ptr<Slot[]> slab = std::make_unique<Slot[]>(kSlabSlotCount);
+
+            // Link the slots in address order, so that objects created in sequence are adjacent in memory.
+            for (size_t i = 0; i < (kSlabSlotCount - 1); ++i)
+            {
+                slab[i].next = &slab[i + 1];
+            }
+
+            slab[kSlabSlotCount - 1].next = free_list_;
+            free_list_                    = &slab[0];
+
+            slabs_.emplace_back(std::move(slab));
+        }
+
+      private:
+        std::mutex                           mutex_;
+        Slot*                                free_list_{ nullptr };
+        std::vector<std::unique_ptr<Slot[]>> slabs_;
+    };
+
+    class ThreadCache
+    {
+      public:
+        // Reference the shared pool on construction to ensure that it is destroyed after the thread caches.
+        ThreadCache() : shared_pool_(GetSharedPool()) {}
+
+        ~ThreadCache()
+        {
+            if (free_list_ != nullptr)
+            {
+                Slot* tail = free_list_;
+                while (tail->next != nullptr)
+                {
+                    tail = tail->next;
+                }
+
+                shared_pool_.ReleaseBatch(free_list_, tail);
+            }
+        }
+
+        void* Acquire()
+        {
+            if (free_list_ == nullptr)
+            {
+                free_list_ = shared_pool_.AcquireBatch(kBatchSize, &count_);
+            }
+
+            Slot* slot = free_list_;
+            free_list_ = slot->next;
+            --count_;
+
+            return &slot->storage;
+        }
+
+        void Release(Slot* slot)
+        {
+            slot->next = free_list_;
+            free_list_ = slot;
+            ++count_;
+
+            if (count_ > kMaxCacheSize)
+            {
+                // Return the most recently released slots to the shared pool, keeping the rest for reuse.
+                Slot* head = free_list_;
+                Slot* tail = free_list_;
+                for (size_t i = 1; i < kBatchSize; ++i)
+                {
+                    tail = tail->next;
+                }
+
+                free_list_ = tail->next;
+                count_ -= kBatchSize;
+
+                shared_pool_.ReleaseBatch(head, tail);
+            }
+        }
+
+      private:
+        SharedPool& shared_pool_;
+        Slot*       free_list_{ nullptr };
+        size_t      count_{ 0 };
+    };
+
+  private:
+    static SharedPool& GetSharedPool()
+    {
+        static SharedPool shared_pool;
+        return shared_pool;
+    }
+
+    static ThreadCache& GetThreadCache()
+    {
+        static thread_local ThreadCache thread_cache;
+        return thread_cache;
+    }
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_OBJECT_POOL_H
@@ -27,10 +27,19 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Buffer descriptor for gathered writes.
+struct OutputBuffer
+{
+    const void* data;
+    size_t      size;
+};
+
 class OutputStream
 {
   public:
@@ -42,7 +51,30 @@ class OutputStream
 
     virtual size_t Write(const void* data, size_t len) = 0;
 
+    // Writes a sequence of buffers, without first combining them into a single buffer.  Streams that can be written by
+    // multiple threads must ensure that the buffers are written contiguously, without interleaving data from other
+    // writes.  Returns the total number of bytes written.
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count)
+    {
+        size_t written = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            written += Write(buffers[i].data, buffers[i].size);
+        }
+        return written;
+    }
+
     virtual void Flush() {}
+
+    // Appends a range of a file to the stream without reading it into a user space buffer, when supported by the
+    // stream.  Returns the number of bytes copied, which is less than size when the caller must write the remainder.
+    virtual uint64_t CopyFromFile(FILE* file, uint64_t offset, uint64_t size)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(file);
+        GFXRECON_UNREFERENCED_PARAMETER(offset);
+        GFXRECON_UNREFERENCED_PARAMETER(size);
+        return 0;
+    }
 };
 
 GFXRECON_END_NAMESPACE(util)
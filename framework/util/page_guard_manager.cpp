@@ -24,11 +24,16 @@
 
 #include "util/page_guard_manager.h"
 
+#include "util/instrumentation.h"
 #include "util/logging.h"
+#include "util/memory_diff.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cstdlib>
+#include <cstring>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
@@ -103,6 +108,23 @@ static LONG WINAPI PageGuardExceptionHandler(PEXCEPTION_POINTERS exception_point
 #include <sys/mman.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <fcntl.h>
+
+// Soft-dirty flag for entries read from /proc/self/pagemap.
+const uint64_t kPagemapSoftDirtyBit = 1ull << 55;
+#endif
+
+#if defined(GFXRECON_ENABLE_USERFAULTFD)
+#include <linux/userfaultfd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+const size_t kUserfaultfdMessageCount = 64;
+#endif
+
 const uint32_t kGuardReadWriteProtect = PROT_NONE;
 const uint32_t kGuardReadOnlyProtect  = PROT_READ;
 const uint32_t kGuardNoProtect        = PROT_READ | PROT_WRITE;
@@ -186,36 +208,113 @@ static void PageGuardExceptionHandler(int id, siginfo_t* info, void* data)
 }
 #endif
 
-PageGuardManager* PageGuardManager::instance_ = nullptr;
+PageGuardManager*   PageGuardManager::instance_          = nullptr;
+thread_local size_t PageGuardManager::last_memory_range_ = 0;
 
 PageGuardManager::PageGuardManager() :
     exception_handler_(nullptr), exception_handler_count_(0), system_page_size_(GetSystemPageSize()),
     system_page_pot_shift_(GetSystemPagePotShift()), enable_copy_on_map_(kDefaultEnableCopyOnMap),
-    enable_separate_read_(kDefaultEnableSeparateRead), enable_read_write_same_page_(kDefaultEnableReadWriteSamePage)
+    enable_separate_read_(kDefaultEnableSeparateRead), enable_sub_page_diff_(kDefaultEnableSubPageDiff),
+    userfaultfd_(-1), userfaultfd_wake_(-1), pagemap_fd_(-1), clear_refs_fd_(-1), huge_page_size_(0),
+    next_process_entry_(0), pending_process_entries_(0), process_function_(nullptr), process_shutdown_(false),
+    enable_read_write_same_page_(kDefaultEnableReadWriteSamePage)
 {}
 
-PageGuardManager::PageGuardManager(bool enable_copy_on_map,
-                                   bool enable_separate_read,
-                                   bool expect_read_write_same_page) :
+PageGuardManager::PageGuardManager(bool               enable_copy_on_map,
+                                   bool               enable_separate_read,
+                                   bool               expect_read_write_same_page,
+                                   WriteDetectionMode write_detection_mode,
+                                   bool               enable_sub_page_diff,
+                                   uint32_t           process_thread_count,
+                                   bool               enable_huge_pages) :
     exception_handler_(nullptr),
     exception_handler_count_(0), system_page_size_(GetSystemPageSize()),
     system_page_pot_shift_(GetSystemPagePotShift()), enable_copy_on_map_(enable_copy_on_map),
-    enable_separate_read_(enable_separate_read), enable_read_write_same_page_(expect_read_write_same_page)
-{}
+    enable_separate_read_(enable_separate_read), enable_sub_page_diff_(enable_sub_page_diff), userfaultfd_(-1),
+    userfaultfd_wake_(-1), pagemap_fd_(-1), clear_refs_fd_(-1), huge_page_size_(0), next_process_entry_(0),
+    pending_process_entries_(0), process_function_(nullptr), process_shutdown_(false),
+    enable_read_write_same_page_(expect_read_write_same_page)
+{
+    if (write_detection_mode == kWriteDetectionUserfaultfd)
+    {
+        if (!InitializeUserfaultfd())
+        {
+            GFXRECON_LOG_WARNING("PageGuardManager failed to initialize userfaultfd write protection; falling back to "
+                                 "guard pages for memory tracking");
+        }
+    }
+    else if (write_detection_mode == kWriteDetectionSoftDirty)
+    {
+        if (!InitializeSoftDirty())
+        {
+            GFXRECON_LOG_WARNING("PageGuardManager failed to initialize soft-dirty page tracking; falling back to "
+                                 "guard pages for memory tracking");
+        }
+    }
+
+    if (enable_huge_pages)
+    {
+        if (pagemap_fd_ != -1)
+        {
+            GFXRECON_LOG_WARNING("PageGuardManager huge pages are not supported with soft-dirty page tracking; using "
+                                 "system pages for shadow memory");
+        }
+        else if (!InitializeHugePages())
+        {
+            GFXRECON_LOG_WARNING("PageGuardManager failed to enable huge pages; falling back to system pages for "
+                                 "shadow memory");
+        }
+    }
+
+    for (uint32_t i = 0; i < process_thread_count; ++i)
+    {
+        process_threads_.emplace_back(&PageGuardManager::ProcessEntriesThread, this);
+    }
+}
 
 PageGuardManager::~PageGuardManager()
 {
+    if (!process_threads_.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(process_lock_);
+            process_shutdown_ = true;
+        }
+
+        process_ready_.notify_all();
+
+        for (auto& thread : process_threads_)
+        {
+            thread.join();
+        }
+    }
+
+    DestroyUserfaultfd();
+    DestroySoftDirty();
+
     if (exception_handler_ != nullptr)
     {
         ClearExceptionHandler(exception_handler_);
     }
 }
 
-void PageGuardManager::Create(bool enable_copy_on_map, bool enable_separate_read, bool expect_read_write_same_page)
+void PageGuardManager::Create(bool               enable_copy_on_map,
+                              bool               enable_separate_read,
+                              bool               expect_read_write_same_page,
+                              WriteDetectionMode write_detection_mode,
+                              bool               enable_sub_page_diff,
+                              uint32_t           process_thread_count,
+                              bool               enable_huge_pages)
 {
     if (instance_ == nullptr)
     {
-        instance_ = new PageGuardManager(enable_copy_on_map, enable_separate_read, expect_read_write_same_page);
+        instance_ = new PageGuardManager(enable_copy_on_map,
+                                         enable_separate_read,
+                                         expect_read_write_same_page,
+                                         write_detection_mode,
+                                         enable_sub_page_diff,
+                                         process_thread_count,
+                                         enable_huge_pages);
     }
     else
     {
@@ -321,6 +420,112 @@ void PageGuardManager::FreeMemory(void* memory, size_t aligned_size)
 #endif
 }
 
+bool PageGuardManager::InitializeHugePages()
+{
+#if defined(__linux__)
+    // Only transparent huge pages are used, as the protection of explicit huge pages cannot be changed for individual
+    // system pages.  Shadow memory is advised with MADV_HUGEPAGE, so both the "always" and "madvise" modes apply.
+    char enabled[128]  = {};
+    char size_text[32] = {};
+    int  enabled_fd    = open("/sys/kernel/mm/transparent_hugepage/enabled", O_RDONLY | O_CLOEXEC);
+    int  size_fd       = open("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", O_RDONLY | O_CLOEXEC);
+
+    if ((enabled_fd != -1) && (size_fd != -1) && (read(enabled_fd, enabled, sizeof(enabled) - 1) > 0) &&
+        (read(size_fd, size_text, sizeof(size_text) - 1) > 0))
+    {
+        size_t huge_page_size = static_cast<size_t>(strtoull(size_text, nullptr, 10));
+
+        if ((strstr(enabled, "[never]") == nullptr) && (huge_page_size > system_page_size_) &&
+            ((huge_page_size & (huge_page_size - 1)) == 0))
+        {
+            huge_page_size_ = huge_page_size;
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("PageGuardManager transparent huge pages are disabled by the current kernel");
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("PageGuardManager failed to read the transparent huge page settings of the current kernel");
+    }
+
+    if (enabled_fd != -1)
+    {
+        close(enabled_fd);
+    }
+
+    if (size_fd != -1)
+    {
+        close(size_fd);
+    }
+#else
+    GFXRECON_LOG_ERROR("PageGuardManager huge page shadow memory is not supported by the current platform");
+#endif
+
+    return (huge_page_size_ != 0);
+}
+
+void* PageGuardManager::AllocateShadowMemory(size_t aligned_size)
+{
+#if defined(__linux__)
+    if ((huge_page_size_ != 0) && (aligned_size >= huge_page_size_))
+    {
+        // Reserve enough space to align the start of the allocation to a huge page boundary, then release the space
+        // before and after the aligned range, so that the allocation can be released by FreeMemory().
+        size_t reserve_size = aligned_size + huge_page_size_;
+        void*  reserved = mmap(nullptr, reserve_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (reserved != MAP_FAILED)
+        {
+            uintptr_t start     = reinterpret_cast<uintptr_t>(reserved);
+            uintptr_t aligned   = (start + huge_page_size_ - 1) & ~(static_cast<uintptr_t>(huge_page_size_) - 1);
+            size_t    head_size = aligned - start;
+            size_t    tail_size = reserve_size - head_size - aligned_size;
+            void*     memory    = reinterpret_cast<void*>(aligned);
+
+            if (head_size > 0)
+            {
+                munmap(reserved, head_size);
+            }
+
+            if (tail_size > 0)
+            {
+                munmap(static_cast<uint8_t*>(memory) + aligned_size, tail_size);
+            }
+
+            // Huge pages are a hint.  The kernel uses system pages when huge pages are unavailable, and splits huge
+            // pages where the protection of individual system pages is changed for write detection.
+            if (madvise(memory, aligned_size, MADV_HUGEPAGE) != 0)
+            {
+                GFXRECON_LOG_DEBUG("PageGuardManager failed to enable huge pages for shadow memory with size = "
+                                   "%" PRIuPTR " (errno = %d)",
+                                   aligned_size,
+                                   errno);
+            }
+
+            shadow_memory_size_.fetch_add(aligned_size, std::memory_order_relaxed);
+            return memory;
+        }
+    }
+#endif
+
+    void* memory = AllocateMemory(aligned_size, false);
+
+    if (memory != nullptr)
+    {
+        shadow_memory_size_.fetch_add(aligned_size, std::memory_order_relaxed);
+    }
+
+    return memory;
+}
+
+void PageGuardManager::FreeShadowMemory(void* memory, size_t aligned_size)
+{
+    shadow_memory_size_.fetch_sub(aligned_size, std::memory_order_relaxed);
+    FreeMemory(memory, aligned_size);
+}
+
 void PageGuardManager::AddExceptionHandler()
 {
     if (exception_handler_ == nullptr)
@@ -442,22 +647,64 @@ bool PageGuardManager::FindMemory(void* address, MemoryInfo** watched_memory_inf
 {
     assert((address != nullptr) && (watched_memory_info != nullptr));
 
-    bool found = false;
-    for (auto entry = memory_info_.begin(); entry != memory_info_.end(); ++entry)
+    // The range from the thread's last lookup is checked first.  The index may be from a different set of ranges, but
+    // any range that it refers to is valid.
+    if (last_memory_range_ < memory_ranges_.size())
     {
-        MemoryInfo* memory_info = &(entry->second);
+        const MemoryRange& range = memory_ranges_[last_memory_range_];
 
-        if ((address >= memory_info->start_address) && (address < memory_info->end_address))
+        if ((address >= range.start_address) && (address < range.end_address))
         {
-            found                  = true;
-            (*watched_memory_info) = memory_info;
-            break;
+            (*watched_memory_info) = range.memory_info;
+            return true;
         }
     }
 
+    bool found = false;
+    auto range = FindMemoryRange(address);
+
+    if ((range != memory_ranges_.end()) && (address >= range->start_address))
+    {
+        found                  = true;
+        (*watched_memory_info) = range->memory_info;
+        last_memory_range_     = range - memory_ranges_.begin();
+    }
+
     return found;
 }
 
+void PageGuardManager::AddMemoryRange(MemoryInfo* memory_info)
+{
+    assert(memory_info != nullptr);
+
+    auto range = FindMemoryRange(memory_info->start_address);
+
+    assert((range == memory_ranges_.end()) || (range->start_address >= memory_info->end_address));
+
+    memory_ranges_.insert(range, { memory_info->start_address, memory_info->end_address, memory_info });
+}
+
+void PageGuardManager::RemoveMemoryRange(const MemoryInfo* memory_info)
+{
+    assert(memory_info != nullptr);
+
+    auto range = FindMemoryRange(memory_info->start_address);
+
+    if ((range != memory_ranges_.end()) && (range->memory_info == memory_info))
+    {
+        memory_ranges_.erase(range);
+    }
+}
+
+PageGuardManager::MemoryRangeList::const_iterator PageGuardManager::FindMemoryRange(const void* address) const
+{
+    // Tracked ranges do not overlap, so the ranges are sorted by both start and end address.
+    return std::upper_bound(memory_ranges_.begin(),
+                            memory_ranges_.end(),
+                            address,
+                            [](const void* value, const MemoryRange& range) { return value < range.end_address; });
+}
+
 bool PageGuardManager::SetMemoryProtection(void* protect_address, size_t protect_size, uint32_t protect_mask)
 {
     bool success = true;
@@ -535,6 +782,438 @@ void PageGuardManager::LoadActiveWriteStates(MemoryInfo* memory_info)
 #endif
 }
 
+bool PageGuardManager::InitializeUserfaultfd()
+{
+    bool success = false;
+
+#if defined(GFXRECON_ENABLE_USERFAULTFD)
+    userfaultfd_ = static_cast<int>(syscall(__NR_userfaultfd, O_CLOEXEC | O_NONBLOCK));
+
+    if ((userfaultfd_ == -1) && (errno == EPERM))
+    {
+        // Unprivileged processes may be limited to handling faults raised from user mode when the
+        // vm.unprivileged_userfaultfd sysctl is disabled.
+        userfaultfd_ = static_cast<int>(syscall(__NR_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+    }
+
+    if (userfaultfd_ != -1)
+    {
+        struct uffdio_api api = {};
+        api.api               = UFFD_API;
+        api.features          = UFFD_FEATURE_PAGEFAULT_FLAG_WP;
+
+        if ((ioctl(userfaultfd_, UFFDIO_API, &api) == 0) && ((api.features & UFFD_FEATURE_PAGEFAULT_FLAG_WP) != 0))
+        {
+            userfaultfd_wake_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+            if (userfaultfd_wake_ != -1)
+            {
+                userfaultfd_thread_ = std::thread(&PageGuardManager::ProcessUserfaultfdEvents, this);
+                success             = true;
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("PageGuardManager failed to enable userfaultfd write protection support (errno = %d)",
+                               errno);
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("PageGuardManager failed to create userfaultfd object (errno = %d)", errno);
+    }
+
+    if (!success)
+    {
+        DestroyUserfaultfd();
+    }
+#else
+    GFXRECON_LOG_ERROR("PageGuardManager userfaultfd write protection is not supported by the current platform");
+#endif
+
+    return success;
+}
+
+void PageGuardManager::DestroyUserfaultfd()
+{
+#if defined(GFXRECON_ENABLE_USERFAULTFD)
+    if (userfaultfd_thread_.joinable())
+    {
+        uint64_t value = 1;
+        if (write(userfaultfd_wake_, &value, sizeof(value)) == sizeof(value))
+        {
+            userfaultfd_thread_.join();
+        }
+        else
+        {
+            userfaultfd_thread_.detach();
+        }
+    }
+
+    if (userfaultfd_wake_ != -1)
+    {
+        close(userfaultfd_wake_);
+        userfaultfd_wake_ = -1;
+    }
+
+    if (userfaultfd_ != -1)
+    {
+        // Closing the userfaultfd object releases any remaining write protection and wakes blocked threads.
+        close(userfaultfd_);
+        userfaultfd_ = -1;
+    }
+#endif
+}
+
+bool PageGuardManager::RegisterUserfaultfd(void* address, size_t size)
+{
+    bool success = false;
+
+#if defined(GFXRECON_ENABLE_USERFAULTFD)
+    struct uffdio_register range = {};
+    range.range.start            = reinterpret_cast<uintptr_t>(address);
+    range.range.len              = GetAlignedSize(size);
+    range.mode                   = UFFDIO_REGISTER_MODE_WP;
+
+    if (ioctl(userfaultfd_, UFFDIO_REGISTER, &range) == 0)
+    {
+        if ((range.ioctls & (static_cast<uint64_t>(1) << _UFFDIO_WRITEPROTECT)) != 0)
+        {
+            success = true;
+        }
+        else
+        {
+            UnregisterUserfaultfd(address, size);
+        }
+    }
+
+    if (!success)
+    {
+        // Write protection is only supported for some memory types, such as anonymous memory.  This is not treated as
+        // an error, as the memory will be tracked with guard pages.
+        GFXRECON_LOG_DEBUG("PageGuardManager could not register memory region [start address = %p, size = %" PRIuPTR
+                           "] for userfaultfd write protection (errno = %d)",
+                           address,
+                           size,
+                           errno);
+    }
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+#endif
+
+    return success;
+}
+
+void PageGuardManager::UnregisterUserfaultfd(void* address, size_t size)
+{
+#if defined(GFXRECON_ENABLE_USERFAULTFD)
+    struct uffdio_range range = {};
+    range.start               = reinterpret_cast<uintptr_t>(address);
+    range.len                 = GetAlignedSize(size);
+
+    if (ioctl(userfaultfd_, UFFDIO_UNREGISTER, &range) == -1)
+    {
+        GFXRECON_LOG_ERROR("PageGuardManager failed to unregister memory region [start address = %p, size = %" PRIuPTR
+                           "] from userfaultfd (errno = %d)",
+                           address,
+                           size,
+                           errno);
+    }
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+#endif
+}
+
+bool PageGuardManager::SetUserfaultfdWriteProtection(void* address, size_t size, bool enable)
+{
+    bool success = true;
+
+#if defined(GFXRECON_ENABLE_USERFAULTFD)
+    // Removing write protection also wakes any thread that is blocked on a write fault for the range.
+    struct uffdio_writeprotect protect = {};
+    protect.range.start                = reinterpret_cast<uintptr_t>(address);
+    protect.range.len                  = GetAlignedSize(size);
+    protect.mode                       = enable ? UFFDIO_WRITEPROTECT_MODE_WP : 0;
+
+    if (ioctl(userfaultfd_, UFFDIO_WRITEPROTECT, &protect) == -1)
+    {
+        success = false;
+
+        GFXRECON_LOG_ERROR("PageGuardManager failed to %s userfaultfd write protection for memory region [start "
+                           "address = %p, size = %" PRIuPTR "] (errno = %d)",
+                           enable ? "enable" : "disable",
+                           address,
+                           size,
+                           errno);
+    }
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    GFXRECON_UNREFERENCED_PARAMETER(enable);
+#endif
+
+    return success;
+}
+
+void PageGuardManager::ProcessUserfaultfdEvents()
+{
+#if defined(GFXRECON_ENABLE_USERFAULTFD)
+    struct pollfd fds[2] = { { userfaultfd_, POLLIN, 0 }, { userfaultfd_wake_, POLLIN, 0 } };
+    struct uffd_msg messages[kUserfaultfdMessageCount];
+
+    for (;;)
+    {
+        if (poll(fds, 2, -1) == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            GFXRECON_LOG_ERROR("PageGuardManager userfaultfd handler thread failed to poll for events (errno = %d)",
+                               errno);
+            break;
+        }
+
+        if ((fds[0].revents & POLLIN) != 0)
+        {
+            ssize_t result = read(userfaultfd_, messages, sizeof(messages));
+
+            if (result > 0)
+            {
+                size_t count = static_cast<size_t>(result) / sizeof(messages[0]);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const struct uffd_msg& message = messages[i];
+
+                    if ((message.event == UFFD_EVENT_PAGEFAULT) &&
+                        ((message.arg.pagefault.flags & UFFD_PAGEFAULT_FLAG_WP) != 0))
+                    {
+                        HandleUserfaultfdWrite(reinterpret_cast<void*>(message.arg.pagefault.address));
+                    }
+                }
+            }
+            else if ((result == -1) && (errno != EAGAIN) && (errno != EINTR))
+            {
+                GFXRECON_LOG_ERROR("PageGuardManager userfaultfd handler thread failed to read events (errno = %d)",
+                                   errno);
+                break;
+            }
+        }
+        else if ((fds[1].revents != 0) || ((fds[0].revents & (POLLERR | POLLHUP)) != 0))
+        {
+            // Pending write faults are processed before the wake event is checked, so threads are not left blocked.
+            break;
+        }
+    }
+#endif
+}
+
+void PageGuardManager::HandleUserfaultfdWrite(void* address)
+{
+    void* page_address = AlignToPageStart(address);
+
+    std::shared_lock<std::shared_timed_mutex> lock(tracked_memory_lock_);
+
+    // The fault address is aligned to the start of the page, which may precede the start address of the tracked range,
+    // so the range is checked with its page aligned start address.
+    auto range = FindMemoryRange(page_address);
+
+    if ((range != memory_ranges_.end()) && range->memory_info->use_userfaultfd &&
+        (page_address >= range->memory_info->aligned_address))
+    {
+        MemoryInfo*                 memory_info = range->memory_info;
+        std::lock_guard<std::mutex> memory_lock(memory_info->lock);
+
+        size_t      page_index =
+            (static_cast<uint8_t*>(page_address) - static_cast<uint8_t*>(memory_info->aligned_address)) >>
+            system_page_pot_shift_;
+
+        memory_info->is_modified = true;
+        memory_info->status_tracker.SetActiveWriteBlock(page_index, true);
+
+        fault_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // The page is made writable and the faulting thread is woken, even if the memory is no longer tracked.
+    SetUserfaultfdWriteProtection(page_address, system_page_size_, false);
+}
+
+bool PageGuardManager::InitializeSoftDirty()
+{
+    bool success = false;
+
+#if defined(__linux__)
+    pagemap_fd_    = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    clear_refs_fd_ = open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+
+    if ((pagemap_fd_ != -1) && (clear_refs_fd_ != -1))
+    {
+        // Clearing soft-dirty bits succeeds without effect when the kernel was built without CONFIG_MEM_SOFT_DIRTY, so
+        // check that a write to a clean page is reported.
+        auto page = static_cast<uint8_t*>(AllocateMemory(system_page_size_, false));
+
+        if (page != nullptr)
+        {
+            page[0] = 1;
+
+            if (ClearSoftDirty() && ReadPagemapEntries(page, 1) && ((pagemap_entries_[0] & kPagemapSoftDirtyBit) == 0))
+            {
+                page[0] = 2;
+
+                success = ReadPagemapEntries(page, 1) && ((pagemap_entries_[0] & kPagemapSoftDirtyBit) != 0);
+            }
+
+            FreeMemory(page, system_page_size_);
+
+            if (!success)
+            {
+                GFXRECON_LOG_ERROR("PageGuardManager soft-dirty page bits are not supported by the current kernel");
+            }
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("PageGuardManager failed to open the /proc/self/pagemap and /proc/self/clear_refs files "
+                           "(errno = %d)",
+                           errno);
+    }
+
+    if (!success)
+    {
+        DestroySoftDirty();
+    }
+#else
+    GFXRECON_LOG_ERROR("PageGuardManager soft-dirty page tracking is not supported by the current platform");
+#endif
+
+    return success;
+}
+
+void PageGuardManager::DestroySoftDirty()
+{
+#if defined(__linux__)
+    if (pagemap_fd_ != -1)
+    {
+        close(pagemap_fd_);
+        pagemap_fd_ = -1;
+    }
+
+    if (clear_refs_fd_ != -1)
+    {
+        close(clear_refs_fd_);
+        clear_refs_fd_ = -1;
+    }
+#endif
+}
+
+bool PageGuardManager::ClearSoftDirty()
+{
+    bool success = false;
+
+#if defined(__linux__)
+    // Writing "4" to clear_refs clears the soft-dirty bits for all pages of the process.
+    if (pwrite(clear_refs_fd_, "4", 1, 0) == 1)
+    {
+        success = true;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("PageGuardManager failed to clear soft-dirty page bits (errno = %d)", errno);
+    }
+#endif
+
+    return success;
+}
+
+bool PageGuardManager::ReadPagemapEntries(const void* address, size_t page_count)
+{
+    bool success = false;
+
+#if defined(__linux__)
+    if (pagemap_entries_.size() < page_count)
+    {
+        pagemap_entries_.resize(page_count);
+    }
+
+    // The pagemap file contains one 64-bit entry for each virtual page of the process.
+    auto   destination = reinterpret_cast<uint8_t*>(pagemap_entries_.data());
+    size_t remaining   = page_count * sizeof(uint64_t);
+    off_t  offset =
+        static_cast<off_t>((reinterpret_cast<uintptr_t>(address) >> system_page_pot_shift_) * sizeof(uint64_t));
+
+    while (remaining > 0)
+    {
+        ssize_t result = pread(pagemap_fd_, destination, remaining, offset);
+
+        if (result > 0)
+        {
+            destination += result;
+            remaining -= result;
+            offset += result;
+        }
+        else if ((result == 0) || (errno != EINTR))
+        {
+            break;
+        }
+    }
+
+    success = (remaining == 0);
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+    GFXRECON_UNREFERENCED_PARAMETER(page_count);
+#endif
+
+    return success;
+}
+
+void PageGuardManager::LoadSoftDirtyStates(MemoryInfo* memory_info)
+{
+    assert((memory_info != nullptr) && memory_info->use_soft_dirty);
+
+    if (ReadPagemapEntries(memory_info->aligned_address, memory_info->total_pages))
+    {
+        for (size_t i = 0; i < memory_info->total_pages; ++i)
+        {
+            if ((pagemap_entries_[i] & kPagemapSoftDirtyBit) != 0)
+            {
+                memory_info->is_modified = true;
+                memory_info->status_tracker.SetActiveWriteBlock(i, true);
+            }
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("PageGuardManager failed to read soft-dirty page bits for memory region [start address = "
+                           "%p, size = %" PRIuPTR "] (errno = %d)",
+                           memory_info->aligned_address,
+                           memory_info->mapped_range,
+                           errno);
+    }
+}
+
+bool PageGuardManager::LoadAllSoftDirtyStates()
+{
+    bool found = false;
+
+    // Soft-dirty bits can only be cleared for the entire process, so the modified page state for all of the tracked
+    // memory is loaded before the bits are cleared.
+    for (auto entry = memory_info_.begin(); entry != memory_info_.end(); ++entry)
+    {
+        if (entry->second.use_soft_dirty)
+        {
+            std::lock_guard<std::mutex> memory_lock(entry->second.lock);
+            LoadSoftDirtyStates(&entry->second);
+            found = true;
+        }
+    }
+
+    return found;
+}
+
 void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
                                     MemoryInfo*               memory_info,
                                     const ModifiedMemoryFunc& handle_modified)
@@ -623,7 +1302,14 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
         // Page guard was disabled when these pages were accessed.  We enable it now for write, to
         // trap any writes made to the memory while we are performing the copy from shadow memory
         // to mapped memory.
-        SetMemoryProtection(guard_address, guard_range, kGuardReadOnlyProtect);
+        if (memory_info->use_userfaultfd)
+        {
+            SetUserfaultfdWriteProtection(guard_address, guard_range, true);
+        }
+        else if (!memory_info->use_soft_dirty)
+        {
+            SetMemoryProtection(guard_address, guard_range, kGuardReadOnlyProtect);
+        }
 
         // Copy from shadow memory to the original mapped memory.
         if (start_index == 0)
@@ -641,14 +1327,33 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
 
         // The shadow memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
-        handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
+        if (memory_info->reference_memory != nullptr)
+        {
+            ProcessModifiedBlocks(
+                memory_id, memory_info, start_index, end_index, page_offset, page_range, handle_modified);
+        }
+        else
+        {
+            handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
+        }
 
-        // Reset page guard to detect both read and write accesses when using shadow memory.
-        SetMemoryProtection(guard_address, guard_range, kGuardReadWriteProtect);
+        // Reset page guard to detect both read and write accesses when using shadow memory.  Userfaultfd only
+        // detects write access, and write protection was already restored for the range.  Soft-dirty tracking does
+        // not protect memory.
+        if (!memory_info->use_userfaultfd && !memory_info->use_soft_dirty)
+        {
+            SetMemoryProtection(guard_address, guard_range, kGuardReadWriteProtect);
+        }
     }
     else
     {
-        if (!memory_info->use_write_watch)
+        if (memory_info->use_userfaultfd)
+        {
+            void* guard_address = static_cast<uint8_t*>(memory_info->aligned_address) + page_offset;
+
+            SetUserfaultfdWriteProtection(guard_address, page_range, true);
+        }
+        else if (!memory_info->use_write_watch)
         {
             void* guard_address = static_cast<uint8_t*>(memory_info->aligned_address) + page_offset;
 
@@ -676,11 +1381,102 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
     }
 }
 
+void PageGuardManager::ProcessModifiedBlocks(uint64_t                  memory_id,
+                                             MemoryInfo*               memory_info,
+                                             size_t                    start_index,
+                                             size_t                    end_index,
+                                             size_t                    offset,
+                                             size_t                    size,
+                                             const ModifiedMemoryFunc& handle_modified)
+{
+    assert((memory_info != nullptr) && (memory_info->shadow_memory != nullptr) &&
+           (memory_info->reference_memory != nullptr));
+
+    const uint8_t* shadow_memory    = static_cast<const uint8_t*>(memory_info->shadow_memory);
+    const uint8_t* reference_memory = static_cast<const uint8_t*>(memory_info->reference_memory);
+    size_t         end_offset       = offset + size;
+    size_t         range_offset     = 0;
+    size_t         range_size       = 0;
+
+    // Adjacent modified blocks are concatenated to handle as large a range as possible with a single modified memory
+    // handler invocation.
+    auto add_range = [&](size_t block_offset, size_t block_size) {
+        if ((range_size > 0) && ((range_offset + range_size) == block_offset))
+        {
+            range_size += block_size;
+        }
+        else
+        {
+            if (range_size > 0)
+            {
+                handle_modified(memory_id, memory_info->shadow_memory, range_offset, range_size);
+            }
+
+            range_offset = block_offset;
+            range_size   = block_size;
+        }
+    };
+
+    size_t page_index = start_index;
+    while (page_index < end_index)
+    {
+        // Find the span of pages that either all have or all do not have reference content.
+        bool   loaded         = memory_info->reference_loaded[page_index];
+        size_t span_end_index = page_index + 1;
+
+        while ((span_end_index < end_index) && (memory_info->reference_loaded[span_end_index] == loaded))
+        {
+            ++span_end_index;
+        }
+
+        // Offsets are relative to the shadow memory pointer, which follows the aligned address by aligned_offset.
+        size_t span_start = offset;
+        size_t span_end   = end_offset;
+
+        if (page_index != start_index)
+        {
+            span_start = (page_index << system_page_pot_shift_) - memory_info->aligned_offset;
+        }
+
+        if (span_end_index != end_index)
+        {
+            span_end = (span_end_index << system_page_pot_shift_) - memory_info->aligned_offset;
+        }
+
+        if (loaded)
+        {
+            DiffMemory(shadow_memory + span_start,
+                       reference_memory + span_start,
+                       span_end - span_start,
+                       [&](size_t diff_offset, size_t diff_size) { add_range(span_start + diff_offset, diff_size); });
+        }
+        else
+        {
+            // The content of the page has not been reported since the memory was added for tracking.
+            add_range(span_start, span_end - span_start);
+
+            for (size_t i = page_index; i < span_end_index; ++i)
+            {
+                memory_info->reference_loaded[i] = true;
+            }
+        }
+
+        page_index = span_end_index;
+    }
+
+    if (range_size > 0)
+    {
+        handle_modified(memory_id, memory_info->shadow_memory, range_offset, range_size);
+    }
+
+    MemoryCopy(static_cast<uint8_t*>(memory_info->reference_memory) + offset, shadow_memory + offset, size);
+}
+
 bool PageGuardManager::GetTrackedMemory(uint64_t memory_id, void** memory)
 {
     assert(memory != nullptr);
 
-    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+    std::shared_lock<std::shared_timed_mutex> lock(tracked_memory_lock_);
 
     auto entry = memory_info_.find(memory_id);
     if (entry != memory_info_.end())
@@ -730,7 +1526,7 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
         if (shadow_memory_handle == kNullShadowHandle)
         {
             shadow_size   = GetAlignedSize(mapped_range);
-            shadow_memory = AllocateMemory(shadow_size, false);
+            shadow_memory = AllocateShadowMemory(shadow_size);
 
             if (shadow_memory != nullptr)
             {
@@ -828,17 +1624,47 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
             }
         }
 
-        bool        success       = true;
-        const void* start_address = mapped_memory;
+        bool        success         = true;
+        bool        use_userfaultfd = false;
+        bool        use_soft_dirty  = false;
+        const void* start_address   = mapped_memory;
 
         if (use_shadow_memory)
         {
             start_address = shadow_memory;
         }
 
-        std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+        std::lock_guard<std::shared_timed_mutex> lock(tracked_memory_lock_);
+
+        // Userfaultfd only detects write access, so it is not used with shadow memory that requires read access to
+        // trigger a copy from the mapped memory.  Content is always copied to persistent shadow memory on first map.
+        if (!use_write_watch && (userfaultfd_ != -1) &&
+            (!use_shadow_memory || enable_copy_on_map_ || (shadow_memory_info != nullptr)))
+        {
+            if (RegisterUserfaultfd(aligned_address, guard_range))
+            {
+                use_userfaultfd = SetUserfaultfdWriteProtection(aligned_address, guard_range, true);
+
+                if (!use_userfaultfd)
+                {
+                    UnregisterUserfaultfd(aligned_address, guard_range);
+                }
+            }
+        }
+
+        // Soft-dirty tracking has the same read access restriction as userfaultfd, and is only used for shadow memory,
+        // which is known to be anonymous memory.  The soft-dirty bits are cleared to discard the writes made by the
+        // copy to shadow memory, after the modified page state for the memory that is currently tracked is loaded.
+        if (!use_write_watch && (pagemap_fd_ != -1) && use_shadow_memory &&
+            (enable_copy_on_map_ || (shadow_memory_info != nullptr)))
+        {
+            std::lock_guard<std::mutex> soft_dirty_lock(soft_dirty_lock_);
+
+            LoadAllSoftDirtyStates();
+            use_soft_dirty = ClearSoftDirty();
+        }
 
-        if (!use_write_watch)
+        if (!use_write_watch && !use_userfaultfd && !use_soft_dirty)
         {
             AddExceptionHandler();
 
@@ -873,11 +1699,18 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                                                            start_address,
                                                            static_cast<const uint8_t*>(start_address) + mapped_range,
                                                            use_write_watch,
+                                                           use_userfaultfd,
+                                                           use_soft_dirty,
                                                            shadow_memory_handle == kNullShadowHandle));
 
             if (!entry.second)
             {
-                if (!use_write_watch)
+                if (use_userfaultfd)
+                {
+                    SetUserfaultfdWriteProtection(aligned_address, guard_range, false);
+                    UnregisterUserfaultfd(aligned_address, guard_range);
+                }
+                else if (!use_write_watch && !use_soft_dirty)
                 {
                     RemoveExceptionHandler();
                     SetMemoryProtection(aligned_address, guard_range, kGuardNoProtect);
@@ -890,12 +1723,32 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                     // caller.
                     if (shadow_memory_handle == kNullShadowHandle)
                     {
-                        FreeMemory(shadow_memory, shadow_size);
+                        FreeShadowMemory(shadow_memory, shadow_size);
                     }
 
                     shadow_memory = nullptr;
                 }
             }
+            else
+            {
+                MemoryInfo& memory_info = entry.first->second;
+
+                AddMemoryRange(&memory_info);
+
+                if (enable_sub_page_diff_ && (shadow_memory != nullptr))
+                {
+                    // The reference memory is populated as modified pages are reported, so its content is not
+                    // initialized.
+                    memory_info.reference_size   = GetAlignedSize(mapped_range);
+                    memory_info.reference_memory = AllocateMemory(memory_info.reference_size, false);
+
+                    if (memory_info.reference_memory != nullptr)
+                    {
+                        shadow_memory_size_.fetch_add(memory_info.reference_size, std::memory_order_relaxed);
+                    }
+                    memory_info.reference_loaded.assign(total_pages, false);
+                }
+            }
         }
     }
 
@@ -904,25 +1757,38 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
 
 void PageGuardManager::RemoveTrackedMemory(uint64_t memory_id)
 {
-    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+    std::lock_guard<std::shared_timed_mutex> lock(tracked_memory_lock_);
 
     auto entry = memory_info_.find(memory_id);
     if (entry != memory_info_.end())
     {
         const MemoryInfo& memory_info = entry->second;
 
-        if (!memory_info.use_write_watch)
+        if (memory_info.use_userfaultfd)
+        {
+            size_t guard_range = memory_info.mapped_range + memory_info.aligned_offset;
+
+            SetUserfaultfdWriteProtection(memory_info.aligned_address, guard_range, false);
+            UnregisterUserfaultfd(memory_info.aligned_address, guard_range);
+        }
+        else if (!memory_info.use_write_watch && !memory_info.use_soft_dirty)
         {
             RemoveExceptionHandler();
             SetMemoryProtection(
                 memory_info.aligned_address, memory_info.mapped_range + memory_info.aligned_offset, kGuardNoProtect);
         }
 
+        if (memory_info.reference_memory != nullptr)
+        {
+            FreeShadowMemory(memory_info.reference_memory, memory_info.reference_size);
+        }
+
         if ((memory_info.shadow_memory != nullptr) && memory_info.own_shadow_memory)
         {
-            FreeMemory(memory_info.shadow_memory, memory_info.shadow_range);
+            FreeShadowMemory(memory_info.shadow_memory, memory_info.shadow_range);
         }
 
+        RemoveMemoryRange(&memory_info);
         memory_info_.erase(entry);
     }
 }
@@ -931,7 +1797,7 @@ uintptr_t PageGuardManager::AllocatePersistentShadowMemory(size_t size)
 {
     ShadowMemoryInfo* info          = nullptr;
     size_t            shadow_size   = GetAlignedSize(size);
-    void*             shadow_memory = AllocateMemory(shadow_size, false);
+    void*             shadow_memory = AllocateShadowMemory(shadow_size);
 
     if (shadow_memory != nullptr)
     {
@@ -950,14 +1816,14 @@ void PageGuardManager::FreePersistentShadowMemory(uintptr_t shadow_memory_handle
 
     if (info != nullptr)
     {
-        FreeMemory(info->memory, info->size);
+        FreeShadowMemory(info->memory, info->size);
         delete info;
     }
 }
 
 void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemoryFunc& handle_modified)
 {
-    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+    std::shared_lock<std::shared_timed_mutex> lock(tracked_memory_lock_);
 
     auto entry = memory_info_.find(memory_id);
 
@@ -965,6 +1831,18 @@ void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemo
     {
         auto memory_info = &entry->second;
 
+        if (memory_info->use_soft_dirty)
+        {
+            std::lock_guard<std::mutex> soft_dirty_lock(soft_dirty_lock_);
+
+            if (LoadAllSoftDirtyStates())
+            {
+                ClearSoftDirty();
+            }
+        }
+
+        std::lock_guard<std::mutex> memory_lock(memory_info->lock);
+
         if (memory_info->use_write_watch)
         {
             // Active memory tracking with VirtualProtect()/mprotect() is only applied to shadow memory.
@@ -981,11 +1859,26 @@ void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemo
 
 void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified)
 {
-    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    std::shared_lock<std::shared_timed_mutex> lock(tracked_memory_lock_);
+
+    // Load the soft-dirty state for all entries with a single scan, clearing the soft-dirty bits before any of the
+    // modified memory is copied.
+    if (pagemap_fd_ != -1)
+    {
+        std::lock_guard<std::mutex> soft_dirty_lock(soft_dirty_lock_);
+
+        if (LoadAllSoftDirtyStates())
+        {
+            ClearSoftDirty();
+        }
+    }
 
     for (auto entry = memory_info_.begin(); entry != memory_info_.end(); ++entry)
     {
-        auto memory_info = &entry->second;
+        auto                        memory_info = &entry->second;
+        std::lock_guard<std::mutex> memory_lock(memory_info->lock);
 
         if (memory_info->use_write_watch)
         {
@@ -1001,11 +1894,116 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
     }
 }
 
+void PageGuardManager::ProcessMemoryEntriesParallel(const ModifiedMemoryFunc& handle_modified)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
+    if (process_threads_.empty())
+    {
+        ProcessMemoryEntries(handle_modified);
+        return;
+    }
+
+    std::shared_lock<std::shared_timed_mutex> lock(tracked_memory_lock_);
+
+    // Calls share the work queue, so they are processed one at a time.
+    std::lock_guard<std::mutex> entries_lock(process_entries_lock_);
+
+    // Load the soft-dirty state for all entries with a single scan, clearing the soft-dirty bits before any of the
+    // modified memory is copied.
+    if (pagemap_fd_ != -1)
+    {
+        std::lock_guard<std::mutex> soft_dirty_lock(soft_dirty_lock_);
+
+        if (LoadAllSoftDirtyStates())
+        {
+            ClearSoftDirty();
+        }
+    }
+
+    std::unique_lock<std::mutex> process_lock(process_lock_);
+
+    assert(process_entries_.empty() && (pending_process_entries_ == 0));
+
+    for (auto entry = memory_info_.begin(); entry != memory_info_.end(); ++entry)
+    {
+        auto                        memory_info = &entry->second;
+        std::lock_guard<std::mutex> memory_lock(memory_info->lock);
+
+        if (memory_info->use_write_watch)
+        {
+            // Active memory tracking with VirtualProtect()/mprotect() is only applied to shadow memory.
+            // When not using shadow memory, we need to query for active write status.
+            LoadActiveWriteStates(memory_info);
+        }
+
+        if (memory_info->is_modified)
+        {
+            process_entries_.emplace_back(entry->first, memory_info);
+        }
+    }
+
+    if (!process_entries_.empty())
+    {
+        next_process_entry_      = 0;
+        pending_process_entries_ = process_entries_.size();
+        process_function_        = &handle_modified;
+
+        process_ready_.notify_all();
+
+        // The calling thread processes entries with the worker threads, and then waits for the entries that are still
+        // being processed by the worker threads.
+        ProcessQueuedEntries(&process_lock);
+        process_complete_.wait(process_lock, [this]() { return pending_process_entries_ == 0; });
+
+        process_entries_.clear();
+        process_function_ = nullptr;
+    }
+}
+
+void PageGuardManager::ProcessEntriesThread()
+{
+    std::unique_lock<std::mutex> lock(process_lock_);
+
+    while (!process_shutdown_)
+    {
+        ProcessQueuedEntries(&lock);
+
+        process_ready_.wait(
+            lock, [this]() { return process_shutdown_ || (next_process_entry_ < process_entries_.size()); });
+    }
+}
+
+void PageGuardManager::ProcessQueuedEntries(std::unique_lock<std::mutex>* lock)
+{
+    assert((lock != nullptr) && lock->owns_lock());
+
+    while (next_process_entry_ < process_entries_.size())
+    {
+        auto entry = process_entries_[next_process_entry_++];
+
+        // Entries are independent, so they are processed without holding the queue lock.
+        lock->unlock();
+
+        {
+            std::lock_guard<std::mutex> memory_lock(entry.second->lock);
+            ProcessEntry(entry.first, entry.second, *process_function_);
+        }
+
+        lock->lock();
+
+        if (--pending_process_entries_ == 0)
+        {
+            process_complete_.notify_all();
+        }
+    }
+}
+
 bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bool clear_guard)
 {
     MemoryInfo* memory_info = nullptr;
 
-    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+    std::shared_lock<std::shared_timed_mutex> lock(tracked_memory_lock_);
 
     bool found = FindMemory(address, &memory_info);
     if (found)
@@ -1013,8 +2011,12 @@ bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bo
         assert((memory_info != nullptr) && (memory_info->aligned_address != nullptr));
         assert(reinterpret_cast<uintptr_t>(address) >= reinterpret_cast<uintptr_t>(memory_info->aligned_address));
 
+        std::lock_guard<std::mutex> memory_lock(memory_info->lock);
+
         memory_info->is_modified = true;
 
+        fault_count_.fetch_add(1, std::memory_order_relaxed);
+
         // Get the offset from the start of the first protected memory page to the current address.
         size_t start_offset = static_cast<uint8_t*>(address) - static_cast<uint8_t*>(memory_info->aligned_address);
 
@@ -28,11 +28,15 @@
 #include "util/defines.h"
 #include "util/page_status_tracker.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -45,9 +49,29 @@ class PageGuardManager
     static const bool kDefaultEnableCopyOnMap         = true;
     static const bool kDefaultEnableSeparateRead      = true;
     static const bool kDefaultEnableReadWriteSamePage = true;
+    static const bool kDefaultEnableSubPageDiff       = false;
+    static const bool kDefaultEnableHugePages         = false;
+
+    static const uint32_t kDefaultProcessThreadCount = 0;
 
     static const uintptr_t kNullShadowHandle = 0;
 
+    enum WriteDetectionMode
+    {
+        // Detect modifications with guard pages, trapping the first access to each protected page with a signal handler
+        // or vectored exception handler.
+        kWriteDetectionGuardPage = 0,
+        // Detect modifications with userfaultfd write protection, where write faults are delivered to a dedicated
+        // handler thread.  Only available on Linux 5.7 and newer, and only applies to anonymous memory, which includes
+        // the shadow memory allocations.  Falls back to guard pages when unavailable.
+        kWriteDetectionUserfaultfd = 1,
+        // Detect modifications by scanning the soft-dirty bits reported by /proc/self/pagemap, which are cleared
+        // through /proc/self/clear_refs, with no faults raised to the capture layer on application writes.  Only
+        // available on Linux kernels built with CONFIG_MEM_SOFT_DIRTY, and only applies to shadow memory.  Falls back
+        // to guard pages when unavailable.
+        kWriteDetectionSoftDirty = 2
+    };
+
   public:
     // Callback for processing modified memory.  The function parameters are the ID of the modified memory object,
     // a pointer to the start of the modified memory range, the offset from the initial mapped memory pointer to
@@ -55,7 +79,24 @@ class PageGuardManager
     typedef std::function<void(uint64_t, void*, size_t, size_t)> ModifiedMemoryFunc;
 
   public:
-    static void Create(bool enable_copy_on_map, bool enable_separate_read, bool expect_read_write_same_page);
+    // When enable_sub_page_diff is true, a copy of the shadow memory content that was last reported as modified is
+    // retained, and only the kMemoryDiffBlockSize byte blocks of a modified page that differ from the retained copy
+    // are reported.  The first write to a page after the memory is added for tracking reports the entire page.
+    //
+    // When process_thread_count is greater than zero, a pool of worker threads is created for
+    // ProcessMemoryEntriesParallel().
+    //
+    // When enable_huge_pages is true, shadow memory allocations that are at least the size of a transparent huge page
+    // are aligned to the huge page size and advised to use huge pages.  Memory protection and write detection are still
+    // applied to individual system pages.  Ignored when transparent huge pages are not available or when soft-dirty
+    // write detection is in use, as soft-dirty bits would be reported for entire huge pages.
+    static void Create(bool               enable_copy_on_map,
+                       bool               enable_separate_read,
+                       bool               expect_read_write_same_page,
+                       WriteDetectionMode write_detection_mode = kWriteDetectionGuardPage,
+                       bool               enable_sub_page_diff = kDefaultEnableSubPageDiff,
+                       uint32_t           process_thread_count = kDefaultProcessThreadCount,
+                       bool               enable_huge_pages    = kDefaultEnableHugePages);
 
     static void Destroy();
 
@@ -91,6 +132,14 @@ class PageGuardManager
 
     void ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified);
 
+    // Processes the modified memory entries on the calling thread and the process worker threads, copying from shadow
+    // memory and resetting memory protection for different entries in parallel.  The handle_modified function is
+    // called concurrently for different entries, and is called from a single thread, in order, for the modified ranges
+    // of an entry.  Equivalent to ProcessMemoryEntries() when the manager has no process worker threads.
+    void ProcessMemoryEntriesParallel(const ModifiedMemoryFunc& handle_modified);
+
+    bool HasProcessThreads() const { return !process_threads_.empty(); }
+
     bool HandleGuardPageViolation(void* address, bool is_write, bool clear_guard);
 
     size_t GetAlignedSize(size_t size) const;
@@ -104,10 +153,22 @@ class PageGuardManager
 
     void FreePersistentShadowMemory(uintptr_t shadow_memory_handle);
 
+    // Number of write and read faults that have been handled for tracked memory, for capture overhead reporting.
+    uint64_t GetFaultCount() const { return fault_count_.load(std::memory_order_relaxed); }
+
+    // Total size of the shadow and sub-page reference memory allocated by the manager.
+    uint64_t GetShadowMemorySize() const { return shadow_memory_size_.load(std::memory_order_relaxed); }
+
   protected:
     PageGuardManager();
 
-    PageGuardManager(bool enable_copy_on_map, bool enable_separate_read, bool expect_read_write_same_page);
+    PageGuardManager(bool               enable_copy_on_map,
+                     bool               enable_separate_read,
+                     bool               expect_read_write_same_page,
+                     WriteDetectionMode write_detection_mode,
+                     bool               enable_sub_page_diff,
+                     uint32_t           process_thread_count,
+                     bool               enable_huge_pages);
 
     ~PageGuardManager();
 
@@ -125,11 +186,14 @@ class PageGuardManager
                    const void* sa,
                    const void* ea,
                    bool        ww,
+                   bool        uf,
+                   bool        sd,
                    bool        os) :
             status_tracker(tp),
             mapped_memory(mm), mapped_range(mr), shadow_memory(sm), shadow_range(sr), aligned_address(aa),
             aligned_offset(ao), total_pages(tp), last_segment_size(lss), start_address(sa), end_address(ea),
-            use_write_watch(ww), is_modified(false), own_shadow_memory(os)
+            use_write_watch(ww), use_userfaultfd(uf), use_soft_dirty(sd), is_modified(false), own_shadow_memory(os),
+            reference_memory(nullptr), reference_size(0)
         {
 #if defined(WIN32)
             if (shadow_memory == nullptr)
@@ -139,6 +203,9 @@ class PageGuardManager
 #endif
         }
 
+        // Protects the page status and modification state of the entry, which are updated by fault handling and reset
+        // when the entry is processed.
+        std::mutex        lock;
         PageStatusTracker status_tracker;
 
         void*  mapped_memory;  // Pointer to mapped memory to be tracked.
@@ -154,9 +221,16 @@ class PageGuardManager
         const void* start_address;     // Start address for the protected memory region.
         const void* end_address;       // Address immediately after the end of the protected memory region.
         bool        use_write_watch;
+        bool        use_userfaultfd;   // Writes are detected with userfaultfd write protection instead of guard pages.
+        bool        use_soft_dirty;    // Writes are detected by scanning soft-dirty page bits instead of guard pages.
         bool        is_modified;
         bool        own_shadow_memory;
 
+        // Copy of the shadow memory content that was last reported as modified, for sub-page diffing.
+        void*             reference_memory;
+        size_t            reference_size;
+        std::vector<bool> reference_loaded; // Tracks which pages of the reference memory contain reported content.
+
 #if defined(WIN32)
         // Memory for retrieving modified pages with GetWriteWatch.
         std::unique_ptr<void*[]> modified_addresses;
@@ -176,7 +250,16 @@ class PageGuardManager
         std::vector<bool> page_loaded;       // Tracks which pages have been loaded.
     };
 
+    // Address range of a tracked memory entry, for address lookup with a binary search.
+    struct MemoryRange
+    {
+        const void* start_address;
+        const void* end_address;
+        MemoryInfo* memory_info;
+    };
+
     typedef std::unordered_map<uint64_t, MemoryInfo> MemoryInfoMap;
+    typedef std::vector<MemoryRange>                 MemoryRangeList;
 
   private:
     size_t GetSystemPageSize() const;
@@ -189,6 +272,13 @@ class PageGuardManager
     size_t GetMemorySegmentSize(const MemoryInfo* memory_info, size_t page_index) const;
     void   MemoryCopy(void* destination, const void* source, size_t size);
     bool   FindMemory(void* address, MemoryInfo** watched_memory_info);
+    void   AddMemoryRange(MemoryInfo* memory_info);
+    void   RemoveMemoryRange(const MemoryInfo* memory_info);
+
+    // Returns the first range that ends after the address, which is the range containing the address when it is
+    // tracked.
+    MemoryRangeList::const_iterator FindMemoryRange(const void* address) const;
+
     bool   SetMemoryProtection(void* protect_address, size_t protect_size, uint32_t protect_mask);
     void   LoadActiveWriteStates(MemoryInfo* memory_info);
     void   ProcessEntry(uint64_t memory_id, MemoryInfo* memory_info, const ModifiedMemoryFunc& handle_modified);
@@ -197,6 +287,13 @@ class PageGuardManager
                               size_t                    start_index,
                               size_t                    end_index,
                               const ModifiedMemoryFunc& handle_modified);
+    void   ProcessModifiedBlocks(uint64_t                  memory_id,
+                                 MemoryInfo*               memory_info,
+                                 size_t                    start_index,
+                                 size_t                    end_index,
+                                 size_t                    offset,
+                                 size_t                    size,
+                                 const ModifiedMemoryFunc& handle_modified);
 
     size_t GetOffsetFromPageStart(void* address) const
     {
@@ -208,19 +305,74 @@ class PageGuardManager
         return static_cast<uint8_t*>(address) - GetOffsetFromPageStart(address);
     }
 
+    bool InitializeUserfaultfd();
+    void DestroyUserfaultfd();
+    bool RegisterUserfaultfd(void* address, size_t size);
+    void UnregisterUserfaultfd(void* address, size_t size);
+    bool SetUserfaultfdWriteProtection(void* address, size_t size, bool enable);
+    void ProcessUserfaultfdEvents();
+    void HandleUserfaultfdWrite(void* address);
+
+    void ProcessEntriesThread();
+    void ProcessQueuedEntries(std::unique_lock<std::mutex>* lock);
+
+    bool  InitializeHugePages();
+    void* AllocateShadowMemory(size_t aligned_size);
+    void  FreeShadowMemory(void* memory, size_t aligned_size);
+
+    bool InitializeSoftDirty();
+    void DestroySoftDirty();
+    bool ClearSoftDirty();
+    bool ReadPagemapEntries(const void* address, size_t page_count);
+    void LoadSoftDirtyStates(MemoryInfo* memory_info);
+    bool LoadAllSoftDirtyStates();
+
   private:
     static PageGuardManager* instance_;
     MemoryInfoMap            memory_info_;
-    std::mutex               tracked_memory_lock_;
+    MemoryRangeList          memory_ranges_; // Address ranges of the entries in memory_info_, sorted by address.
+
+    // Exclusive ownership is required to add or remove entries, and shared ownership is sufficient to find entries and
+    // to process them with the entry's lock.
+    std::shared_timed_mutex tracked_memory_lock_;
+    std::mutex              soft_dirty_lock_; // Serializes the process-wide soft-dirty scans and clears.
+
     void*                    exception_handler_;
     uint32_t                 exception_handler_count_;
     const size_t             system_page_size_;
     const size_t             system_page_pot_shift_;
     const bool               enable_copy_on_map_;
     const bool               enable_separate_read_;
+    const bool               enable_sub_page_diff_;
+    int                      userfaultfd_;        // Userfaultfd file descriptor, or -1 when not in use.
+    int                      userfaultfd_wake_;   // Event file descriptor used to stop the handler thread.
+    std::thread              userfaultfd_thread_; // Thread that receives write faults for userfaultfd tracked memory.
+    int                      pagemap_fd_;         // File descriptor for /proc/self/pagemap, or -1 when not in use.
+    int                      clear_refs_fd_;      // File descriptor for /proc/self/clear_refs, or -1 when not in use.
+    std::vector<uint64_t>    pagemap_entries_;    // Storage for pagemap entries read from pagemap_fd_.
+    size_t                   huge_page_size_;     // Transparent huge page size for shadow memory, or 0 when not in use.
+
+    // Worker threads and work queue for ProcessMemoryEntriesParallel().
+    std::mutex                                    process_entries_lock_;
+    std::vector<std::thread>                      process_threads_;
+    std::mutex                                    process_lock_;
+    std::condition_variable                       process_ready_;
+    std::condition_variable                       process_complete_;
+    std::vector<std::pair<uint64_t, MemoryInfo*>> process_entries_;
+    size_t                                        next_process_entry_;
+    size_t                                        pending_process_entries_;
+    const ModifiedMemoryFunc*                     process_function_;
+    bool                                          process_shutdown_;
 
     // Only applies to WIN32 builds and Linux/Android builds with PAGE_GUARD_ENABLE_UCONTEXT_WRITE_DETECTION defined.
     const bool enable_read_write_same_page_;
+
+    std::atomic<uint64_t> fault_count_{ 0 };
+    std::atomic<uint64_t> shadow_memory_size_{ 0 };
+
+    // Index in memory_ranges_ of the range that was found by the last address lookup of the thread, which is checked
+    // before searching, as consecutive faults from a thread are likely to be for the same memory.
+    static thread_local size_t last_memory_range_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -26,6 +26,7 @@
 
 #include "util/defines.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -41,6 +42,8 @@
 #endif
 #include <windows.h>
 #include <direct.h>
+#include <fcntl.h>
+#include <io.h>
 #else // WIN32
 #include <dlfcn.h>
 #include <errno.h>
@@ -50,6 +53,9 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <signal.h>
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
 #endif // WIN32
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -125,6 +131,12 @@ inline std::string GetEnv(const char* name)
     return std::string("");
 }
 
+// Sets an environment variable of the current process, or removes it when value is null.
+inline bool SetEnv(const char* name, const char* value)
+{
+    return SetEnvironmentVariableA(name, value) != FALSE;
+}
+
 inline int32_t MemoryCopy(void* destination, size_t destination_size, const void* source, size_t source_size)
 {
     return memcpy_s(destination, destination_size, source, source_size);
@@ -181,6 +193,21 @@ inline bool FileSeek(FILE* stream, int64_t offset, FileSeekOrigin origin)
     return (result == 0);
 }
 
+// Switches a stream that was opened in text mode, such as stdin or stdout, to binary mode.
+inline bool SetFileBinaryMode(FILE* stream)
+{
+    return (_setmode(_fileno(stream), _O_BINARY) != -1);
+}
+
+inline uint64_t FileCopyRange(FILE* destination, FILE* source, uint64_t source_offset, uint64_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(destination);
+    GFXRECON_UNREFERENCED_PARAMETER(source);
+    GFXRECON_UNREFERENCED_PARAMETER(source_offset);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    return 0;
+}
+
 inline size_t FileWriteNoLock(const void* buffer, size_t element_size, size_t element_count, FILE* stream)
 {
     return _fwrite_nolock(buffer, element_size, element_count, stream);
@@ -191,6 +218,16 @@ inline size_t FileReadNoLock(void* buffer, size_t element_size, size_t element_c
     return _fread_nolock(buffer, element_size, element_count, stream);
 }
 
+inline void FileLock(FILE* stream)
+{
+    _lock_file(stream);
+}
+
+inline void FileUnlock(FILE* stream)
+{
+    _unlock_file(stream);
+}
+
 inline int32_t FileVprintf(FILE* stream, const char* format, va_list vlist)
 {
     return vfprintf_s(stream, format, vlist);
@@ -282,6 +319,18 @@ inline std::string GetEnv(const char* name)
     return env_value;
 }
 
+// Sets an environment variable of the current process, or removes it when value is null.  Android system properties
+// are not changed.
+inline bool SetEnv(const char* name, const char* value)
+{
+    if (value != nullptr)
+    {
+        return setenv(name, value, 1) == 0;
+    }
+
+    return unsetenv(name) == 0;
+}
+
 inline int32_t MemoryCopy(void* destination, size_t destination_size, const void* source, size_t source_size)
 {
     if (source_size > destination_size)
@@ -379,6 +428,95 @@ inline bool FileSeek(FILE* stream, int64_t offset, FileSeekOrigin origin)
     return (result == 0);
 }
 
+inline bool SetFileBinaryMode(FILE* stream)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(stream);
+    return true;
+}
+
+// Copies a range of the source file to the current position of the destination file within the kernel, without
+// reading it into a user space buffer.  The position of the source file is not changed.  copy_file_range() shares the
+// data extents when the file system supports reflinks, and sendfile() is used when the files are on different file
+// systems of a kernel that does not support cross file system copies.  Returns the number of bytes copied, which is
+// less than size at the end of the source file, when the files do not support kernel copies, or when an error
+// occurred; the caller copies the remainder.
+inline uint64_t FileCopyRange(FILE* destination, FILE* source, uint64_t source_offset, uint64_t size)
+{
+    uint64_t copied = 0;
+
+#if defined(__linux__)
+    if (fflush(destination) != 0)
+    {
+        return 0;
+    }
+
+    int   destination_fd     = fileno(destination);
+    int   source_fd          = fileno(source);
+    off_t destination_offset = ftello(destination);
+    off_t input_offset       = static_cast<off_t>(source_offset);
+    bool  use_sendfile       = false;
+
+    if (destination_offset < 0)
+    {
+        return 0;
+    }
+
+    while (copied < size)
+    {
+        size_t  chunk_size = static_cast<size_t>(std::min<uint64_t>(size - copied, 1u << 30));
+        ssize_t result     = -1;
+
+#if defined(__NR_copy_file_range)
+        if (!use_sendfile)
+        {
+            result = syscall(
+                __NR_copy_file_range, source_fd, &input_offset, destination_fd, &destination_offset, chunk_size, 0);
+
+            if ((result < 0) && ((errno == ENOSYS) || (errno == EXDEV) || (errno == EINVAL) || (errno == EOPNOTSUPP)))
+            {
+                use_sendfile = true;
+            }
+        }
+#else
+        use_sendfile = true;
+#endif
+
+        if (use_sendfile)
+        {
+            // sendfile() writes at the position of the destination file descriptor.
+            if (lseek(destination_fd, destination_offset, SEEK_SET) != destination_offset)
+            {
+                break;
+            }
+
+            result = sendfile(destination_fd, source_fd, &input_offset, chunk_size);
+
+            if (result > 0)
+            {
+                destination_offset += result;
+            }
+        }
+
+        if (result <= 0)
+        {
+            break;
+        }
+
+        copied += static_cast<uint64_t>(result);
+    }
+
+    // Move the stream past the copied data, which also discards its state for the previous file position.
+    fseeko(destination, destination_offset, SEEK_SET);
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(destination);
+    GFXRECON_UNREFERENCED_PARAMETER(source);
+    GFXRECON_UNREFERENCED_PARAMETER(source_offset);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+#endif
+
+    return copied;
+}
+
 inline size_t FileWriteNoLock(const void* buffer, size_t element_size, size_t element_count, FILE* stream)
 {
 #if defined(__ANDROID__) && (__ANDROID_API__ < 28)
@@ -397,6 +535,16 @@ inline size_t FileReadNoLock(void* buffer, size_t element_size, size_t element_c
 #endif
 }
 
+inline void FileLock(FILE* stream)
+{
+    flockfile(stream);
+}
+
+inline void FileUnlock(FILE* stream)
+{
+    funlockfile(stream);
+}
+
 inline int32_t FileVprintf(FILE* stream, const char* format, va_list vlist)
 {
     return vfprintf(stream, format, vlist);
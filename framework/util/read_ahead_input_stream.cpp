@@ -0,0 +1,197 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/read_ahead_input_stream.h"
+
+#include "util/platform.h"
+#include "util/thread_placement.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+const size_t ReadAheadInputStream::kDefaultBufferSize;
+
+ReadAheadInputStream::ReadAheadInputStream(std::unique_ptr<InputStream> source, size_t buffer_size) :
+    source_(std::move(source)), buffer_(std::max(buffer_size, static_cast<size_t>(1))), read_offset_(0),
+    buffered_size_(0), source_done_(false), source_error_(false), shutdown_(false), eof_(false), error_(false)
+{
+    if ((source_ != nullptr) && source_->IsValid())
+    {
+        reader_thread_ = std::thread(&ReadAheadInputStream::ReadSource, this);
+    }
+    else
+    {
+        source_done_ = true;
+    }
+}
+
+ReadAheadInputStream::~ReadAheadInputStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    space_available_.notify_one();
+
+    if (reader_thread_.joinable())
+    {
+        // The reader thread may be waiting for data from the source.
+        source_->Interrupt();
+        reader_thread_.join();
+    }
+}
+
+size_t ReadAheadInputStream::Read(void* data, size_t len)
+{
+    size_t bytes_read = 0;
+
+    while (bytes_read < len)
+    {
+        size_t result = Consume(reinterpret_cast<uint8_t*>(data) + bytes_read, len - bytes_read);
+
+        if (result == 0)
+        {
+            break;
+        }
+
+        bytes_read += result;
+    }
+
+    return bytes_read;
+}
+
+size_t ReadAheadInputStream::ReadAvailable(void* data, size_t len)
+{
+    return Consume(reinterpret_cast<uint8_t*>(data), len);
+}
+
+bool ReadAheadInputStream::Skip(size_t len)
+{
+    while (len > 0)
+    {
+        size_t result = Consume(nullptr, len);
+
+        if (result == 0)
+        {
+            return false;
+        }
+
+        len -= result;
+    }
+
+    return true;
+}
+
+void ReadAheadInputStream::ReadSource()
+{
+    thread_placement::ApplyThreadRole(thread_placement::kIoThread);
+
+    const size_t capacity = buffer_.size();
+
+    for (;;)
+    {
+        size_t write_offset = 0;
+        size_t write_size   = 0;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            space_available_.wait(lock, [this, capacity]() { return (buffered_size_ < capacity) || shutdown_; });
+
+            if (shutdown_)
+            {
+                break;
+            }
+
+            // Fill the contiguous free space that follows the buffered data.
+            write_offset = (read_offset_ + buffered_size_) % capacity;
+            write_size   = (write_offset < read_offset_) ? (read_offset_ - write_offset) : (capacity - write_offset);
+        }
+
+        // The free space is only accessed by the reader thread, so the source is read without holding the lock.
+        size_t bytes_read = source_->ReadAvailable(buffer_.data() + write_offset, write_size);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (bytes_read > 0)
+            {
+                buffered_size_ += bytes_read;
+            }
+            else
+            {
+                source_done_  = true;
+                source_error_ = source_->HasError();
+            }
+        }
+
+        data_available_.notify_one();
+
+        if (bytes_read == 0)
+        {
+            break;
+        }
+    }
+}
+
+size_t ReadAheadInputStream::Consume(uint8_t* data, size_t len)
+{
+    const size_t capacity  = buffer_.size();
+    size_t       read_size = 0;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        data_available_.wait(lock, [this]() { return (buffered_size_ > 0) || source_done_; });
+
+        if (buffered_size_ == 0)
+        {
+            // Match the behavior of a short fread(), which sets the end of file or error indicator.
+            eof_   = true;
+            error_ = source_error_;
+            return 0;
+        }
+
+        read_size = std::min(std::min(len, buffered_size_), capacity - read_offset_);
+    }
+
+    // The buffered data is only accessed by the calling thread, so it is copied without holding the lock.
+    if (data != nullptr)
+    {
+        platform::MemoryCopy(data, len, buffer_.data() + read_offset_, read_size);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        read_offset_ = (read_offset_ + read_size) % capacity;
+        buffered_size_ -= read_size;
+    }
+
+    space_available_.notify_one();
+
+    return read_size;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
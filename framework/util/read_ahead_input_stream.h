@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_READ_AHEAD_INPUT_STREAM_H
+#define GFXRECON_UTIL_READ_AHEAD_INPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/input_stream.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Input stream that reads ahead of the caller from a source stream with a dedicated reader thread, so that data that
+// arrives from a pipe or network connection while the caller is busy is buffered instead of stalling the sender.  The
+// buffered data is returned in order.  The stream is not seekable.
+class ReadAheadInputStream : public InputStream
+{
+  public:
+    static const size_t kDefaultBufferSize = 64 * 1024 * 1024;
+
+  public:
+    // buffer_size is the capacity of the ring buffer, which is the maximum number of bytes read ahead of the caller.
+    ReadAheadInputStream(std::unique_ptr<InputStream> source, size_t buffer_size = kDefaultBufferSize);
+
+    // Interrupts the source stream and waits for the reader thread to stop.  When the source stream does not support
+    // Interrupt(), a pending read of the source must complete before the reader thread can stop.
+    virtual ~ReadAheadInputStream() override;
+
+    virtual bool IsValid() override { return (source_ != nullptr) && source_->IsValid(); }
+
+    virtual size_t Read(void* data, size_t len) override;
+
+    virtual size_t ReadAvailable(void* data, size_t len) override;
+
+    virtual bool Skip(size_t len) override;
+
+    virtual bool IsEof() const override { return eof_; }
+
+    virtual bool HasError() const override { return error_; }
+
+  private:
+    void ReadSource();
+
+    // Copies up to len bytes of buffered data to data, or discards the data when data is nullptr, waiting for the
+    // reader thread when no data is buffered.  Returns 0 when the source stream has been exhausted.
+    size_t Consume(uint8_t* data, size_t len);
+
+  private:
+    std::unique_ptr<InputStream> source_;
+    std::vector<uint8_t>         buffer_;
+    size_t                       read_offset_;  // Offset of the first buffered byte.
+    size_t                       buffered_size_;
+    bool                         source_done_;  // The reader thread reached the end of the source stream.
+    bool                         source_error_; // The source stream reported an error.
+    bool                         shutdown_;
+    bool                         eof_;
+    bool                         error_;
+    std::mutex                   mutex_;
+    std::condition_variable      data_available_;
+    std::condition_variable      space_available_;
+    std::thread                  reader_thread_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_READ_AHEAD_INPUT_STREAM_H
@@ -0,0 +1,119 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/scalable_shared_mutex.h"
+
+#include <cassert>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+std::atomic_size_t                            ScalableSharedMutex::next_slot_{ 0 };
+thread_local ScalableSharedMutex::ThreadState ScalableSharedMutex::thread_state_;
+
+void ScalableSharedMutex::lock()
+{
+    writer_mutex_.lock();
+
+    // Indicate to readers the writer is waiting.
+    writer_active_.store(true);
+
+    // Wait for the readers of all slots, other than the read locks held by this thread.
+    uint32_t own_count = GetThreadReadCount();
+    for (;;)
+    {
+        uint32_t count = 0;
+        for (const auto& slot : reader_slots_)
+        {
+            count += slot.count.load();
+        }
+
+        if (count <= own_count)
+        {
+            break;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+void ScalableSharedMutex::unlock()
+{
+    writer_active_.store(false);
+    writer_mutex_.unlock();
+}
+
+void ScalableSharedMutex::lock_shared()
+{
+    ThreadState& state = thread_state_;
+
+    if (state.slot == kReaderSlotCount)
+    {
+        state.slot = next_slot_.fetch_add(1, std::memory_order_relaxed) % kReaderSlotCount;
+    }
+
+    std::atomic<uint32_t>& slot_count = reader_slots_[state.slot].count;
+    slot_count.fetch_add(1);
+
+    // A thread that already holds a read lock continues, as the waiting writer also waits for that lock.
+    if (writer_active_.load() && (GetThreadReadCount() == 0))
+    {
+        slot_count.fetch_sub(1);
+
+        writer_mutex_.lock();
+        slot_count.fetch_add(1);
+        writer_mutex_.unlock();
+    }
+
+    if (state.read_count == 0)
+    {
+        state.read_mutex = this;
+    }
+
+    if (state.read_mutex == this)
+    {
+        ++state.read_count;
+    }
+}
+
+void ScalableSharedMutex::unlock_shared()
+{
+    ThreadState& state = thread_state_;
+    assert(state.slot < kReaderSlotCount);
+
+    if ((state.read_mutex == this) && (state.read_count > 0))
+    {
+        --state.read_count;
+    }
+
+    reader_slots_[state.slot].count.fetch_sub(1);
+}
+
+uint32_t ScalableSharedMutex::GetThreadReadCount() const
+{
+    const ThreadState& state = thread_state_;
+    return (state.read_mutex == this) ? state.read_count : 0;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
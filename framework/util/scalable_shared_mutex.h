@@ -0,0 +1,92 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_SCALABLE_SHARED_MUTEX_H
+#define GFXRECON_UTIL_SCALABLE_SHARED_MUTEX_H
+
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// A shared (reader/writer) mutex with distributed reader counts, for mutexes that are locked shared by many threads at
+// a high rate.  Each thread is assigned one of kReaderSlotCount reader slots, which are kept on separate cache lines,
+// so that readers on different cores do not write to the same counter.  A writer acquires the writer mutex, announces
+// itself to new readers, and then scans the reader slots until all existing readers have released the mutex.  Readers
+// that arrive while a writer is active wait on the writer mutex.
+//
+// As with SharedMutex, a thread's read lock can be promoted to a write lock, and a thread that holds a read lock can
+// lock shared again while a writer is waiting.  Both are supported for one ScalableSharedMutex at a time per thread.
+// The mutex is over-aligned and is intended for static or member storage, not for allocation with new.
+class ScalableSharedMutex
+{
+  public:
+    ScalableSharedMutex() : writer_active_(false) {}
+
+    void lock();
+    void unlock();
+
+    void lock_shared();
+    void unlock_shared();
+
+  private:
+    // Not copyable or movable
+    ScalableSharedMutex(const ScalableSharedMutex&) = delete;
+    ScalableSharedMutex& operator=(const ScalableSharedMutex&) = delete;
+
+    // Returns the number of read locks the calling thread holds on this mutex.
+    uint32_t GetThreadReadCount() const;
+
+  private:
+    static const size_t kReaderSlotCount{ 64 };
+    static const size_t kCacheLineSize{ 64 };
+
+    struct alignas(kCacheLineSize) ReaderSlot
+    {
+        std::atomic<uint32_t> count{ 0 };
+    };
+
+    struct ThreadState
+    {
+        size_t                     slot{ kReaderSlotCount };  // Assigned by the thread's first call to lock_shared.
+        const ScalableSharedMutex* read_mutex{ nullptr }; // Mutex that read_count applies to.
+        uint32_t                   read_count{ 0 };
+    };
+
+    static std::atomic_size_t       next_slot_;
+    static thread_local ThreadState thread_state_;
+
+  private:
+    ReaderSlot       reader_slots_[kReaderSlotCount];
+    std::mutex       writer_mutex_;
+    std::atomic_bool writer_active_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SCALABLE_SHARED_MUTEX_H
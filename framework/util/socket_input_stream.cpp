@@ -0,0 +1,137 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/socket_input_stream.h"
+
+#include "util/logging.h"
+#include "util/network.h"
+
+#if defined(WIN32)
+#include <winsock2.h>
+#else
+#include <sys/socket.h>
+#include <sys/types.h>
+#endif
+
+#include <algorithm>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+#if defined(WIN32)
+typedef SOCKET SocketHandle;
+#else
+typedef int SocketHandle;
+#endif
+
+SocketInputStream::SocketInputStream(const std::string& address) :
+    socket_(network::kInvalidSocket), valid_(false), eof_(false), error_(false)
+{
+    std::string host;
+    std::string port;
+
+    if (network::Initialize() && network::ParseAddress(address, &host, &port))
+    {
+        socket_ = host.empty() ? network::Accept(port) : network::Connect(host, port);
+        valid_  = (socket_ != network::kInvalidSocket);
+    }
+}
+
+SocketInputStream::~SocketInputStream()
+{
+    if (valid_)
+    {
+        network::Close(socket_);
+    }
+
+    network::Terminate();
+}
+
+bool SocketInputStream::IsSocketAddress(const std::string& name)
+{
+    return network::IsSocketAddress(name);
+}
+
+size_t SocketInputStream::Read(void* data, size_t len)
+{
+    size_t bytes_read = 0;
+
+    while (bytes_read < len)
+    {
+        size_t result = Receive(reinterpret_cast<uint8_t*>(data) + bytes_read, len - bytes_read);
+
+        if (result == 0)
+        {
+            break;
+        }
+
+        bytes_read += result;
+    }
+
+    return bytes_read;
+}
+
+size_t SocketInputStream::ReadAvailable(void* data, size_t len)
+{
+    return Receive(data, len);
+}
+
+void SocketInputStream::Interrupt()
+{
+    if (valid_)
+    {
+#if defined(WIN32)
+        shutdown(static_cast<SocketHandle>(socket_), SD_RECEIVE);
+#else
+        shutdown(static_cast<SocketHandle>(socket_), SHUT_RD);
+#endif
+    }
+}
+
+size_t SocketInputStream::Receive(void* data, size_t len)
+{
+    while (valid_ && !eof_ && !error_ && (len > 0))
+    {
+        int  request_size = static_cast<int>(std::min(len, static_cast<size_t>(INT32_MAX)));
+        auto result       = recv(static_cast<SocketHandle>(socket_), reinterpret_cast<char*>(data), request_size, 0);
+
+        if (result > 0)
+        {
+            return static_cast<size_t>(result);
+        }
+        else if (result == 0)
+        {
+            // The sender closed the connection.
+            eof_ = true;
+        }
+        else if (!network::IsInterrupted())
+        {
+            GFXRECON_LOG_ERROR("Failed to receive data from socket");
+            error_ = true;
+        }
+    }
+
+    return 0;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,73 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_SOCKET_INPUT_STREAM_H
+#define GFXRECON_UTIL_SOCKET_INPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/input_stream.h"
+
+#include <cstdint>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Input stream that reads from a TCP connection.  Addresses have the form "tcp://host:port", which connects to a
+// server that sends the data, or "tcp://:port", which listens on the port and accepts a single connection from a
+// client that sends the data.
+class SocketInputStream : public InputStream
+{
+  public:
+    SocketInputStream(const std::string& address);
+
+    virtual ~SocketInputStream() override;
+
+    static bool IsSocketAddress(const std::string& name);
+
+    virtual bool IsValid() override { return valid_; }
+
+    virtual size_t Read(void* data, size_t len) override;
+
+    virtual size_t ReadAvailable(void* data, size_t len) override;
+
+    virtual void Interrupt() override;
+
+    virtual bool IsEof() const override { return eof_; }
+
+    virtual bool HasError() const override { return error_; }
+
+  private:
+    // Performs a single receive, retrying when interrupted by a signal.
+    size_t Receive(void* data, size_t len);
+
+  private:
+    uintptr_t socket_;
+    bool      valid_;
+    bool      eof_;
+    bool      error_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SOCKET_INPUT_STREAM_H
@@ -0,0 +1,192 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/socket_output_stream.h"
+
+#include "util/logging.h"
+#include "util/network.h"
+
+#if defined(WIN32)
+#include <winsock2.h>
+#else
+#include <sys/socket.h>
+#include <sys/types.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+#if defined(WIN32)
+typedef SOCKET SocketHandle;
+static const int kSendFlags = 0;
+#elif defined(MSG_NOSIGNAL)
+typedef int SocketHandle;
+static const int kSendFlags = MSG_NOSIGNAL; // Report a closed connection as an error instead of raising SIGPIPE.
+#else
+typedef int SocketHandle;
+static const int kSendFlags = 0;
+#endif
+
+const size_t SocketOutputStream::kDefaultBufferSize;
+const int    SocketOutputStream::kDefaultSendBufferSize;
+
+SocketOutputStream::SocketOutputStream(const std::string& address, size_t buffer_size) :
+    socket_(network::kInvalidSocket), valid_(false), buffer_(buffer_size), buffer_used_(0)
+{
+    std::string host;
+    std::string port;
+
+    if (network::Initialize() && network::ParseAddress(address, &host, &port))
+    {
+        socket_ = host.empty() ? network::Accept(port) : network::Connect(host, port);
+        valid_  = (socket_ != network::kInvalidSocket);
+    }
+
+    if (valid_)
+    {
+        // A large send buffer lets the connection absorb bursts of capture data, such as state snapshots, without
+        // blocking the writer.  The request is a hint, which the system may reduce.
+        int send_buffer_size = kDefaultSendBufferSize;
+        setsockopt(static_cast<SocketHandle>(socket_),
+                   SOL_SOCKET,
+                   SO_SNDBUF,
+                   reinterpret_cast<const char*>(&send_buffer_size),
+                   sizeof(send_buffer_size));
+
+#if defined(SO_NOSIGPIPE)
+        int no_sigpipe = 1;
+        setsockopt(static_cast<SocketHandle>(socket_),
+                   SOL_SOCKET,
+                   SO_NOSIGPIPE,
+                   reinterpret_cast<const char*>(&no_sigpipe),
+                   sizeof(no_sigpipe));
+#endif
+    }
+}
+
+SocketOutputStream::~SocketOutputStream()
+{
+    if (valid_)
+    {
+        FlushUnlocked();
+    }
+
+    if (socket_ != network::kInvalidSocket)
+    {
+        network::Close(socket_);
+    }
+
+    network::Terminate();
+}
+
+size_t SocketOutputStream::Write(const void* data, size_t len)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return WriteUnlocked(data, len);
+}
+
+size_t SocketOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        written += WriteUnlocked(buffers[i].data, buffers[i].size);
+    }
+
+    return written;
+}
+
+void SocketOutputStream::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    FlushUnlocked();
+}
+
+size_t SocketOutputStream::WriteUnlocked(const void* data, size_t len)
+{
+    if (!valid_)
+    {
+        return 0;
+    }
+
+    if ((buffer_used_ + len) > buffer_.size())
+    {
+        FlushUnlocked();
+
+        if (len >= buffer_.size())
+        {
+            // Data that would fill the buffer is sent directly.
+            return Send(data, len) ? len : 0;
+        }
+    }
+
+    memcpy(buffer_.data() + buffer_used_, data, len);
+    buffer_used_ += len;
+
+    return len;
+}
+
+void SocketOutputStream::FlushUnlocked()
+{
+    if (valid_ && (buffer_used_ > 0))
+    {
+        Send(buffer_.data(), buffer_used_);
+    }
+
+    buffer_used_ = 0;
+}
+
+bool SocketOutputStream::Send(const void* data, size_t len)
+{
+    const char* bytes = reinterpret_cast<const char*>(data);
+
+    while (valid_ && (len > 0))
+    {
+        int  request_size = static_cast<int>(std::min(len, static_cast<size_t>(INT32_MAX)));
+        auto result       = send(static_cast<SocketHandle>(socket_), bytes, request_size, kSendFlags);
+
+        if (result > 0)
+        {
+            bytes += result;
+            len -= static_cast<size_t>(result);
+        }
+        else if ((result < 0) && network::IsInterrupted())
+        {
+            continue;
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to send capture data to socket; the remaining capture data will be discarded");
+            valid_ = false;
+        }
+    }
+
+    return valid_;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,85 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_SOCKET_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_SOCKET_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that sends data over a TCP connection, for capture devices without the storage space or write speed
+// for capture files.  Addresses have the form "tcp://host:port", which connects to a receiver that is listening on the
+// host, or "tcp://:port", which listens on the port and accepts a single connection from a receiver, such as a host
+// connected through an adb port forward.
+//
+// Small writes are combined in a buffer, which is sent when full, and sends block while the socket send buffer is full,
+// so writers are throttled to the rate of the connection.  Writers that must not block should write through an
+// AsyncOutputStream.  When the connection fails, the remaining data is discarded.
+class SocketOutputStream : public OutputStream
+{
+  public:
+    static const size_t kDefaultBufferSize     = 1024 * 1024;
+    static const int    kDefaultSendBufferSize = 8 * 1024 * 1024;
+
+  public:
+    SocketOutputStream(const std::string& address, size_t buffer_size = kDefaultBufferSize);
+
+    // Sends the buffered data and closes the connection.
+    virtual ~SocketOutputStream() override;
+
+    virtual bool IsValid() override { return valid_; }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    // Holds the stream lock while writing the buffers, so that they are sent contiguously.
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count) override;
+
+    virtual void Flush() override;
+
+  private:
+    size_t WriteUnlocked(const void* data, size_t len);
+
+    void FlushUnlocked();
+
+    // Sends all of the data, retrying when interrupted by a signal.  Returns false when the connection has failed.
+    bool Send(const void* data, size_t len);
+
+  private:
+    uintptr_t            socket_;
+    bool                 valid_;
+    std::mutex           mutex_;
+    std::vector<uint8_t> buffer_;
+    size_t               buffer_used_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SOCKET_OUTPUT_STREAM_H
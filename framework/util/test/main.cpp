@@ -25,3 +25,177 @@
 
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
+
+#include "util/argument_parser.h"
+#include "util/hash.h"
+#include "util/image_writer.h"
+#include "util/read_ahead_input_stream.h"
+#include "util/thread_placement.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+// Source stream that returns data in small pieces, as a pipe or network connection would.
+class ChunkedInputStream : public gfxrecon::util::InputStream
+{
+  public:
+    ChunkedInputStream(const std::vector<uint8_t>& data, size_t chunk_size) :
+        data_(data), chunk_size_(chunk_size), offset_(0)
+    {}
+
+    virtual bool IsValid() override { return true; }
+
+    virtual size_t Read(void* data, size_t len) override
+    {
+        size_t read_size = std::min(len, data_.size() - offset_);
+        memcpy(data, data_.data() + offset_, read_size);
+        offset_ += read_size;
+        return read_size;
+    }
+
+    virtual size_t ReadAvailable(void* data, size_t len) override { return Read(data, std::min(len, chunk_size_)); }
+
+    virtual bool IsEof() const override { return offset_ == data_.size(); }
+
+    virtual bool HasError() const override { return false; }
+
+  private:
+    std::vector<uint8_t> data_;
+    size_t               chunk_size_;
+    size_t               offset_;
+};
+
+} // namespace
+
+TEST_CASE("read ahead stream returns source data in order", "[input_stream]")
+{
+    std::vector<uint8_t> data(10000);
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    // Use a buffer that is smaller than the data to exercise wrap around of the ring buffer.
+    gfxrecon::util::ReadAheadInputStream stream(std::make_unique<ChunkedInputStream>(data, 333), 1024);
+    REQUIRE(stream.IsValid());
+    REQUIRE(!stream.IsSeekable());
+
+    std::vector<uint8_t> result(data.size());
+    REQUIRE(stream.Read(result.data(), 100) == 100);
+    REQUIRE(stream.Skip(2900));
+    REQUIRE(stream.Read(result.data() + 3000, 7000) == 7000);
+    REQUIRE(std::equal(data.begin(), data.begin() + 100, result.begin()));
+    REQUIRE(std::equal(data.begin() + 3000, data.end(), result.begin() + 3000));
+    REQUIRE(!stream.IsEof());
+
+    // Reads past the end of the source stream are short and mark the end of the stream.
+    uint8_t extra = 0;
+    REQUIRE(stream.Read(&extra, 1) == 0);
+    REQUIRE(stream.IsEof());
+    REQUIRE(!stream.HasError());
+}
+
+TEST_CASE("QOI image writer encodes runs and color differences", "[image_writer]")
+{
+    // A 3x1 BGRA image with a black pixel, followed by two pixels that differ by one in each color channel.
+    const uint8_t     pixels[]  = { 0, 0, 0, 255, 1, 1, 1, 255, 1, 1, 1, 255 };
+    const std::string file_name = "image_writer_test.qoi";
+
+    REQUIRE(gfxrecon::util::imagewriter::WriteQoiImage(file_name, 3, 1, sizeof(pixels), pixels));
+
+    std::vector<uint8_t> file_data(64);
+    FILE*                file = fopen(file_name.c_str(), "rb");
+    REQUIRE(file != nullptr);
+    file_data.resize(fread(file_data.data(), 1, file_data.size(), file));
+    fclose(file);
+    std::remove(file_name.c_str());
+
+    // Header, a run of one pixel matching the initial black pixel, a difference of +1 for each channel, a run of one
+    // pixel, and the end marker.
+    const std::vector<uint8_t> expected = { 'q', 'o', 'i', 'f', 0, 0, 0, 3, 0, 0, 0, 1, 3, 0, 0xc0, 0x7f,
+                                            0xc0, 0, 0, 0, 0, 0, 0, 0, 1 };
+    REQUIRE(file_data == expected);
+}
+
+TEST_CASE("content hash does not depend on how data is split between updates", "[hash]")
+{
+    std::vector<uint8_t> data(5000);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 131) ^ (i >> 7));
+    }
+
+    // Sizes on either side of the small input, stripe, buffer, and block boundaries.
+    for (size_t size : { 0, 1, 63, 239, 240, 256, 257, 1024, 1025, 5000 })
+    {
+        uint64_t                      expected64  = gfxrecon::util::hash::ContentHash64(data.data(), size);
+        gfxrecon::util::hash::Hash128 expected128 = gfxrecon::util::hash::ContentHash128(data.data(), size);
+
+        for (size_t chunk_size : { 1, 7, 64, 300 })
+        {
+            gfxrecon::util::hash::ContentHasher hasher;
+            for (size_t offset = 0; offset < size; offset += chunk_size)
+            {
+                hasher.Update(data.data() + offset, std::min(chunk_size, size - offset));
+            }
+
+            REQUIRE(hasher.Digest64() == expected64);
+            REQUIRE(hasher.Digest128() == expected128);
+        }
+    }
+
+    // A single changed byte changes the hash.
+    uint64_t original = gfxrecon::util::hash::ContentHash64(data.data(), data.size());
+    data[2500] ^= 1;
+    REQUIRE(gfxrecon::util::hash::ContentHash64(data.data(), data.size()) != original);
+}
+
+TEST_CASE("thread placement parses role core and priority lists", "[thread_placement]")
+{
+    using namespace gfxrecon::util::thread_placement;
+
+    Placement placement;
+    REQUIRE(ParseAffinity("replay=2,decode=3,io=4,worker=5-7,9", &placement));
+    REQUIRE(placement.size() == kThreadRoleCount);
+    REQUIRE(placement[kReplayThread].cores == std::vector<uint32_t>{ 2 });
+    REQUIRE(placement[kDecodeThread].cores == std::vector<uint32_t>{ 3 });
+    REQUIRE(placement[kIoThread].cores == std::vector<uint32_t>{ 4 });
+    REQUIRE(placement[kWorkerThread].cores == std::vector<uint32_t>{ 5, 6, 7, 9 });
+
+    REQUIRE(ParsePriority("high", &placement));
+    REQUIRE(placement[kIoThread].priority == kPriorityHigh);
+    REQUIRE(ParsePriority("worker=low", &placement));
+    REQUIRE(placement[kWorkerThread].priority == kPriorityLow);
+    REQUIRE(placement[kReplayThread].priority == kPriorityHigh);
+
+    Placement invalid;
+    REQUIRE(!ParseAffinity("2,replay=3", &invalid));
+    REQUIRE(!ParseAffinity("render=1", &invalid));
+    REQUIRE(!ParseAffinity("replay=4-2", &invalid));
+    REQUIRE(!ParsePriority("replay=urgent", &invalid));
+}
+
+TEST_CASE("unsigned integer argument values are parsed without exceptions", "[argument_parser]")
+{
+    uint32_t value = 7;
+
+    REQUIRE(gfxrecon::util::ParseUnsignedInteger("0", &value));
+    REQUIRE(value == 0);
+    REQUIRE(gfxrecon::util::ParseUnsignedInteger("4294967295", &value));
+    REQUIRE(value == 4294967295u);
+
+    value = 7;
+
+    for (const char* invalid : { "", "-1", "+2", " 3", "4x", "4294967296", "99999999999999999999999" })
+    {
+        REQUIRE_FALSE(gfxrecon::util::ParseUnsignedInteger(invalid, &value));
+        REQUIRE(value == 7);
+    }
+}
@@ -0,0 +1,527 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/thread_placement.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <mutex>
+
+#if defined(WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(thread_placement)
+
+const char* const kRoleNames[kThreadRoleCount] = { "replay", "decode", "io", "worker" };
+
+#if defined(__linux__)
+// Nice values of the thread priorities, where lower values have higher priority.
+const int kNiceValues[] = { 0, 10, 0, -10 };
+#endif
+
+// Physical processor core, with its logical processors.
+struct CoreInfo
+{
+    std::vector<uint32_t> logical_cores;
+    uint64_t              performance{ 0 }; // Relative performance, for processors with cores of different types.
+    int64_t               cache_id{ -1 };   // Last level cache that the core shares with other cores.
+};
+
+static std::mutex placement_mutex;
+static Placement  configured_placement;
+
+static bool ParseRole(const std::string& name, ThreadRole* role)
+{
+    for (uint32_t i = 0; i < kThreadRoleCount; ++i)
+    {
+        if (name == kRoleNames[i])
+        {
+            (*role) = static_cast<ThreadRole>(i);
+            return true;
+        }
+    }
+
+    GFXRECON_LOG_WARNING("Unrecognized thread role \"%s\"", name.c_str());
+    return false;
+}
+
+static bool ParseNumber(const std::string& value, uint32_t* number)
+{
+    if (value.empty() || (value.find_first_not_of("0123456789") != std::string::npos))
+    {
+        return false;
+    }
+
+    (*number) = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+    return true;
+}
+
+// Parses a core number or a range of core numbers, such as "5-7".
+static bool ParseCores(const std::string& value, std::vector<uint32_t>* cores)
+{
+    uint32_t first = 0;
+    uint32_t last  = 0;
+    size_t   dash  = value.find('-');
+
+    if (dash == std::string::npos)
+    {
+        if (!ParseNumber(value, &first))
+        {
+            return false;
+        }
+
+        last = first;
+    }
+    else if (!ParseNumber(value.substr(0, dash), &first) || !ParseNumber(value.substr(dash + 1), &last) ||
+             (last < first))
+    {
+        return false;
+    }
+
+    for (uint32_t core = first; core <= last; ++core)
+    {
+        cores->push_back(core);
+    }
+
+    return true;
+}
+
+static bool ParsePriorityValue(const std::string& value, ThreadPriority* priority)
+{
+    if (value == "low")
+    {
+        (*priority) = kPriorityLow;
+    }
+    else if (value == "normal")
+    {
+        (*priority) = kPriorityNormal;
+    }
+    else if (value == "high")
+    {
+        (*priority) = kPriorityHigh;
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Unrecognized thread priority \"%s\"", value.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+static std::vector<std::string> SplitList(const std::string& value)
+{
+    std::vector<std::string> items;
+    size_t                   start = 0;
+
+    while (start <= value.length())
+    {
+        size_t end = value.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = value.length();
+        }
+
+        items.push_back(value.substr(start, end - start));
+        start = end + 1;
+    }
+
+    return items;
+}
+
+bool ParseAffinity(const std::string& value, Placement* placement)
+{
+    assert(placement != nullptr);
+
+    placement->resize(kThreadRoleCount);
+
+    ThreadRole role     = kThreadRoleCount;
+    bool       have_role = false;
+
+    for (const auto& item : SplitList(value))
+    {
+        std::string cores  = item;
+        size_t      equals = item.find('=');
+
+        if (equals != std::string::npos)
+        {
+            if (!ParseRole(item.substr(0, equals), &role))
+            {
+                return false;
+            }
+
+            have_role = true;
+            cores     = item.substr(equals + 1);
+        }
+
+        if (!have_role || !ParseCores(cores, &(*placement)[role].cores))
+        {
+            GFXRECON_LOG_WARNING("Invalid thread core assignment \"%s\"", item.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ParsePriority(const std::string& value, Placement* placement)
+{
+    assert(placement != nullptr);
+
+    placement->resize(kThreadRoleCount);
+
+    if (value.find('=') == std::string::npos)
+    {
+        ThreadPriority priority = kPriorityDefault;
+
+        if (!ParsePriorityValue(value, &priority))
+        {
+            return false;
+        }
+
+        for (auto& role_placement : (*placement))
+        {
+            role_placement.priority = priority;
+        }
+
+        return true;
+    }
+
+    for (const auto& item : SplitList(value))
+    {
+        ThreadRole role   = kThreadRoleCount;
+        size_t     equals = item.find('=');
+
+        if ((equals == std::string::npos) || !ParseRole(item.substr(0, equals), &role) ||
+            !ParsePriorityValue(item.substr(equals + 1), &(*placement)[role].priority))
+        {
+            GFXRECON_LOG_WARNING("Invalid thread priority assignment \"%s\"", item.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#if defined(__linux__)
+template <typename T>
+static bool ReadSystemValue(const std::string& path, T* value)
+{
+    std::ifstream stream(path);
+    return static_cast<bool>(stream >> (*value));
+}
+
+static bool GetProcessorCores(std::vector<CoreInfo>* cores)
+{
+    const std::string cpu_dir = "/sys/devices/system/cpu/";
+
+    std::string online;
+    if (!ReadSystemValue(cpu_dir + "online", &online))
+    {
+        return false;
+    }
+
+    std::vector<uint32_t> logical_cores;
+    for (const auto& item : SplitList(online))
+    {
+        if (!ParseCores(item, &logical_cores))
+        {
+            return false;
+        }
+    }
+
+    // Logical processors are grouped into physical cores by their package and core IDs.
+    std::vector<std::pair<int64_t, int64_t>> core_ids;
+
+    for (uint32_t logical_core : logical_cores)
+    {
+        std::string dir        = cpu_dir + "cpu" + std::to_string(logical_core) + "/";
+        int64_t     package_id = 0;
+        int64_t     core_id    = logical_core;
+        uint64_t    capacity   = 0;
+        int64_t     cache_id   = 0;
+
+        ReadSystemValue(dir + "topology/physical_package_id", &package_id);
+        ReadSystemValue(dir + "topology/core_id", &core_id);
+
+        // The scheduler capacity of the cores of big.LITTLE processors is preferred to their maximum frequency.
+        if (!ReadSystemValue(dir + "cpu_capacity", &capacity))
+        {
+            ReadSystemValue(dir + "cpufreq/cpuinfo_max_freq", &capacity);
+        }
+
+        // The L3 cache is shared by a core complex, and cores without an L3 cache are grouped by cluster.
+        if (!ReadSystemValue(dir + "cache/index3/id", &cache_id) &&
+            !ReadSystemValue(dir + "topology/cluster_id", &cache_id))
+        {
+            cache_id = package_id;
+        }
+
+        auto core_key = std::make_pair(package_id, core_id);
+        auto entry    = std::find(core_ids.begin(), core_ids.end(), core_key);
+
+        if (entry == core_ids.end())
+        {
+            CoreInfo core;
+            core.performance = capacity;
+            core.cache_id    = (package_id << 32) | cache_id;
+            core.logical_cores.push_back(logical_core);
+
+            core_ids.push_back(core_key);
+            cores->push_back(core);
+        }
+        else
+        {
+            (*cores)[entry - core_ids.begin()].logical_cores.push_back(logical_core);
+        }
+    }
+
+    return !cores->empty();
+}
+#elif defined(WIN32)
+static bool GetProcessorCores(std::vector<CoreInfo>* cores)
+{
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+
+    std::vector<uint8_t> buffer(length);
+    if ((length == 0) ||
+        !GetLogicalProcessorInformationEx(
+            RelationAll, reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data()), &length))
+    {
+        return false;
+    }
+
+    // Thread affinity is limited to the logical processors of the first processor group.
+    std::vector<KAFFINITY> cache_masks;
+
+    for (DWORD offset = 0; offset < length;)
+    {
+        auto info = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+
+        if ((info->Relationship == RelationProcessorCore) && (info->Processor.GroupMask[0].Group == 0))
+        {
+            CoreInfo core;
+            core.performance = info->Processor.EfficiencyClass;
+
+            for (uint32_t i = 0; i < sizeof(KAFFINITY) * 8; ++i)
+            {
+                if ((info->Processor.GroupMask[0].Mask & (static_cast<KAFFINITY>(1) << i)) != 0)
+                {
+                    core.logical_cores.push_back(i);
+                }
+            }
+
+            cores->push_back(core);
+        }
+        else if ((info->Relationship == RelationCache) && (info->Cache.Level == 3) &&
+                 (info->Cache.GroupMask.Group == 0))
+        {
+            cache_masks.push_back(info->Cache.GroupMask.Mask);
+        }
+
+        offset += info->Size;
+    }
+
+    for (auto& core : (*cores))
+    {
+        for (size_t i = 0; i < cache_masks.size(); ++i)
+        {
+            if ((cache_masks[i] & (static_cast<KAFFINITY>(1) << core.logical_cores[0])) != 0)
+            {
+                core.cache_id = static_cast<int64_t>(i);
+                break;
+            }
+        }
+    }
+
+    return !cores->empty();
+}
+#else
+static bool GetProcessorCores(std::vector<CoreInfo>* cores)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(cores);
+    return false;
+}
+#endif
+
+bool GetAutomaticAffinity(Placement* placement)
+{
+    assert(placement != nullptr);
+
+    std::vector<CoreInfo> cores;
+
+    if (!GetProcessorCores(&cores) || (cores.size() < 2))
+    {
+        return false;
+    }
+
+    std::stable_sort(cores.begin(), cores.end(), [](const CoreInfo& lhs, const CoreInfo& rhs) {
+        return lhs.performance > rhs.performance;
+    });
+
+    // Keep the cores that share a cache with the fastest core ahead of the others, so that the replay, decode, and I/O
+    // threads exchange data through the same cache.
+    int64_t replay_cache_id = cores[0].cache_id;
+    std::stable_partition(cores.begin(), cores.end(), [replay_cache_id](const CoreInfo& core) {
+        return core.cache_id == replay_cache_id;
+    });
+
+    // The replay, decode, and I/O threads receive their own core while at least one core remains for the workers, and
+    // share the worker cores otherwise.
+    size_t dedicated_count = std::min(static_cast<size_t>(kWorkerThread), cores.size() - 1);
+
+    placement->clear();
+    placement->resize(kThreadRoleCount);
+
+    for (size_t i = dedicated_count; i < cores.size(); ++i)
+    {
+        auto& worker_cores = (*placement)[kWorkerThread].cores;
+        worker_cores.insert(worker_cores.end(), cores[i].logical_cores.begin(), cores[i].logical_cores.end());
+    }
+
+    for (uint32_t role = 0; role < kWorkerThread; ++role)
+    {
+        (*placement)[role].cores =
+            (role < dedicated_count) ? cores[role].logical_cores : (*placement)[kWorkerThread].cores;
+    }
+
+    return true;
+}
+
+void Configure(const Placement& placement)
+{
+    std::lock_guard<std::mutex> lock(placement_mutex);
+    configured_placement = placement;
+
+    for (size_t role = 0; role < configured_placement.size(); ++role)
+    {
+        std::string cores;
+        for (uint32_t core : configured_placement[role].cores)
+        {
+            cores += (cores.empty() ? "" : ",") + std::to_string(core);
+        }
+
+        if (!cores.empty())
+        {
+            GFXRECON_LOG_INFO("Assigned %s threads to cores %s", kRoleNames[role], cores.c_str());
+        }
+    }
+}
+
+void ApplyThreadRole(ThreadRole role)
+{
+    RolePlacement role_placement;
+
+    {
+        std::lock_guard<std::mutex> lock(placement_mutex);
+        if (role < configured_placement.size())
+        {
+            role_placement = configured_placement[role];
+        }
+    }
+
+    if (!role_placement.cores.empty())
+    {
+#if defined(__linux__)
+        cpu_set_t core_set;
+        CPU_ZERO(&core_set);
+
+        for (uint32_t core : role_placement.cores)
+        {
+            if (core < CPU_SETSIZE)
+            {
+                CPU_SET(core, &core_set);
+            }
+        }
+
+        if (sched_setaffinity(0, sizeof(core_set), &core_set) != 0)
+        {
+            GFXRECON_LOG_WARNING("Failed to set the processor affinity of a %s thread", kRoleNames[role]);
+        }
+#elif defined(WIN32)
+        DWORD_PTR mask = 0;
+
+        for (uint32_t core : role_placement.cores)
+        {
+            if (core < sizeof(DWORD_PTR) * 8)
+            {
+                mask |= static_cast<DWORD_PTR>(1) << core;
+            }
+        }
+
+        if ((mask == 0) || (SetThreadAffinityMask(GetCurrentThread(), mask) == 0))
+        {
+            GFXRECON_LOG_WARNING("Failed to set the processor affinity of a %s thread", kRoleNames[role]);
+        }
+#else
+        GFXRECON_LOG_WARNING_ONCE("Thread processor affinity is not supported on this platform");
+#endif
+    }
+
+    if (role_placement.priority != kPriorityDefault)
+    {
+#if defined(__linux__)
+        // Linux and Android schedule threads with per-thread nice values.
+        id_t thread_id = static_cast<id_t>(syscall(SYS_gettid));
+
+        if (setpriority(PRIO_PROCESS, thread_id, kNiceValues[role_placement.priority]) != 0)
+        {
+            GFXRECON_LOG_WARNING("Failed to set the priority of a %s thread; raising thread priority may require "
+                                 "elevated privileges",
+                                 kRoleNames[role]);
+        }
+#elif defined(WIN32)
+        const int kWin32Priorities[] = { THREAD_PRIORITY_NORMAL,
+                                         THREAD_PRIORITY_BELOW_NORMAL,
+                                         THREAD_PRIORITY_NORMAL,
+                                         THREAD_PRIORITY_HIGHEST };
+
+        if (!SetThreadPriority(GetCurrentThread(), kWin32Priorities[role_placement.priority]))
+        {
+            GFXRECON_LOG_WARNING("Failed to set the priority of a %s thread", kRoleNames[role]);
+        }
+#else
+        GFXRECON_LOG_WARNING_ONCE("Thread priority is not supported on this platform");
+#endif
+    }
+}
+
+GFXRECON_END_NAMESPACE(thread_placement)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,87 @@
+
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_THREAD_PLACEMENT_H
+#define GFXRECON_UTIL_THREAD_PLACEMENT_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(thread_placement)
+
+// The threads of replay are grouped by role, and the threads of a role share the same processor cores and priority.
+enum ThreadRole : uint32_t
+{
+    kReplayThread = 0, // Thread that processes the decoded API calls.
+    kDecodeThread,     // Decode and block decompression threads.
+    kIoThread,         // File read-ahead and prefetch threads.
+    kWorkerThread,     // Pipeline creation and command buffer replay worker threads.
+    kThreadRoleCount
+};
+
+enum ThreadPriority : uint32_t
+{
+    kPriorityDefault = 0, // The priority is not changed.
+    kPriorityLow,
+    kPriorityNormal,
+    kPriorityHigh
+};
+
+struct RolePlacement
+{
+    std::vector<uint32_t> cores; // Logical processors that the threads can run on, or empty for any processor.
+    ThreadPriority        priority{ kPriorityDefault };
+};
+
+typedef std::vector<RolePlacement> Placement;
+
+// Parses a list of role core assignments, such as "replay=2,decode=3,io=4,worker=5-7,9", into the cores of each role.
+// Core numbers that follow a role assignment without a role name are added to that role.
+bool ParseAffinity(const std::string& value, Placement* placement);
+
+// Parses a list of role priorities, such as "replay=high,decode=high", or a single priority for all roles.  Priorities
+// are "low", "normal", and "high".
+bool ParsePriority(const std::string& value, Placement* placement);
+
+// Assigns cores to each role from the processor topology: the replay, decode, and I/O threads each receive their own
+// physical core, preferring the fastest cores of big.LITTLE and hybrid processors, and cores that share a last level
+// cache with the replay thread.  The worker threads receive the cores that remain.  Returns false when the topology
+// is unavailable.
+bool GetAutomaticAffinity(Placement* placement);
+
+// Sets the placement that is applied to threads by ApplyThreadRole().
+void Configure(const Placement& placement);
+
+// Applies the configured cores and priority of a role to the calling thread.
+void ApplyThreadRole(ThreadRole role);
+
+GFXRECON_END_NAMESPACE(thread_placement)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_THREAD_PLACEMENT_H
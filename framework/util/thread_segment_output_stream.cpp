@@ -0,0 +1,212 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/thread_segment_output_stream.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <utility>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Segment files are buffered with large buffers, because each segment is only written by a single thread.
+const size_t kSegmentBufferSize = 4 * 1024 * 1024;
+
+std::atomic<uint64_t> ThreadSegmentOutputStream::next_stream_id_{ 1 };
+
+// The segment of the calling thread for the stream identified by thread_stream_id_.  A thread's segment pointer is
+// replaced on the first write to a new stream.
+thread_local uint64_t                             ThreadSegmentOutputStream::thread_stream_id_ = 0;
+thread_local ThreadSegmentOutputStream::Segment* ThreadSegmentOutputStream::thread_segment_   = nullptr;
+
+ThreadSegmentOutputStream::ThreadSegmentOutputStream(std::unique_ptr<OutputStream> target,
+                                                     const std::string&            filename) :
+    target_(std::move(target)),
+    filename_(filename), stream_id_(next_stream_id_.fetch_add(1)), next_sequence_(0), write_failed_(false)
+{
+    assert(target_ != nullptr);
+}
+
+ThreadSegmentOutputStream::~ThreadSegmentOutputStream()
+{
+    MergeSegments();
+    target_->Flush();
+}
+
+size_t ThreadSegmentOutputStream::Write(const void* data, size_t len)
+{
+    OutputBuffer buffer = { data, len };
+    return WriteBuffers(&buffer, 1);
+}
+
+size_t ThreadSegmentOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    RecordHeader header;
+    header.size = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        header.size += buffers[i].size;
+    }
+
+    if (header.size == 0)
+    {
+        return 0;
+    }
+
+    Segment* segment = GetSegment();
+    if (segment == nullptr)
+    {
+        return 0;
+    }
+
+    // The only state shared by the writing threads is the sequence counter.
+    header.sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
+
+    bool success = (platform::FileWrite(&header, sizeof(header), 1, segment->file) == 1);
+
+    for (size_t i = 0; success && (i < count); ++i)
+    {
+        if (buffers[i].size > 0)
+        {
+            success = (platform::FileWrite(buffers[i].data, buffers[i].size, 1, segment->file) == 1);
+        }
+    }
+
+    if (!success)
+    {
+        write_failed_ = true;
+        return 0;
+    }
+
+    return static_cast<size_t>(header.size);
+}
+
+void ThreadSegmentOutputStream::Flush()
+{
+    std::lock_guard<std::mutex> lock(segments_mutex_);
+
+    for (const auto& segment : segments_)
+    {
+        platform::FileFlush(segment->file);
+    }
+}
+
+ThreadSegmentOutputStream::Segment* ThreadSegmentOutputStream::GetSegment()
+{
+    if (thread_stream_id_ != stream_id_)
+    {
+        std::lock_guard<std::mutex> lock(segments_mutex_);
+
+        auto segment      = std::make_unique<Segment>();
+        segment->filename = filename_ + ".thread" + std::to_string(segments_.size());
+
+        // Segments are read back for the merge, so they are opened for both writing and reading.
+        if (platform::FileOpen(&segment->file, segment->filename.c_str(), "w+b") != 0)
+        {
+            GFXRECON_LOG_ERROR("Failed to create capture file thread segment %s", segment->filename.c_str());
+            write_failed_ = true;
+            return nullptr;
+        }
+
+        setvbuf(segment->file, nullptr, _IOFBF, kSegmentBufferSize);
+
+        thread_stream_id_ = stream_id_;
+        thread_segment_   = segment.get();
+        segments_.emplace_back(std::move(segment));
+    }
+
+    return thread_segment_;
+}
+
+void ThreadSegmentOutputStream::MergeSegments()
+{
+    // Pending records, ordered by sequence number, with the index of the segment containing the record.
+    typedef std::pair<uint64_t, size_t> PendingRecord;
+    std::priority_queue<PendingRecord, std::vector<PendingRecord>, std::greater<PendingRecord>> pending_records;
+
+    std::vector<uint64_t> record_sizes(segments_.size(), 0);
+    std::vector<uint8_t>  record_data;
+
+    auto read_header = [&](size_t index) {
+        RecordHeader header;
+        if (platform::FileRead(&header, sizeof(header), 1, segments_[index]->file) == 1)
+        {
+            record_sizes[index] = header.size;
+            pending_records.emplace(header.sequence, index);
+        }
+    };
+
+    for (size_t i = 0; i < segments_.size(); ++i)
+    {
+        platform::FileFlush(segments_[i]->file);
+        platform::FileSeek(segments_[i]->file, 0, platform::FileSeekSet);
+        read_header(i);
+    }
+
+    uint64_t expected_sequence = 0;
+
+    while (!pending_records.empty())
+    {
+        PendingRecord record = pending_records.top();
+        pending_records.pop();
+
+        if (record.first != expected_sequence)
+        {
+            // A record is missing when a segment write failed, and the data that follows it cannot be decoded.
+            GFXRECON_LOG_ERROR("Capture file thread segments are incomplete; the capture file is truncated");
+            break;
+        }
+
+        size_t index = record.second;
+        record_data.resize(static_cast<size_t>(record_sizes[index]));
+
+        if (platform::FileRead(record_data.data(), record_data.size(), 1, segments_[index]->file) != 1)
+        {
+            GFXRECON_LOG_ERROR("Failed to read capture file thread segment %s; the capture file is truncated",
+                               segments_[index]->filename.c_str());
+            break;
+        }
+
+        target_->Write(record_data.data(), record_data.size());
+
+        ++expected_sequence;
+        read_header(index);
+    }
+
+    for (const auto& segment : segments_)
+    {
+        platform::FileClose(segment->file);
+        std::remove(segment->filename.c_str());
+    }
+
+    segments_.clear();
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
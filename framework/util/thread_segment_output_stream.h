@@ -0,0 +1,98 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_THREAD_SEGMENT_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_THREAD_SEGMENT_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that writes the data from each thread to a separate segment file, so that threads do not share a lock
+// or a write position.  Each write is recorded in the calling thread's segment with a sequence number from a global
+// counter.  The segments are merged into the target stream in sequence order when the stream is destroyed, which
+// produces the same data as writing to the target stream directly.  Data that is written with a single call to Write()
+// or WriteBuffers() is kept contiguous.
+class ThreadSegmentOutputStream : public OutputStream
+{
+  public:
+    // Segment files are created next to the file named by filename, and are removed after they have been merged.
+    ThreadSegmentOutputStream(std::unique_ptr<OutputStream> target, const std::string& filename);
+
+    // Merges the segments into the target stream.
+    virtual ~ThreadSegmentOutputStream() override;
+
+    virtual bool IsValid() override { return (target_ != nullptr) && target_->IsValid() && !write_failed_; }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count) override;
+
+    // Flushes the segment files.  Data is not written to the target stream until the segments are merged.
+    virtual void Flush() override;
+
+  private:
+    struct RecordHeader
+    {
+        uint64_t sequence;
+        uint64_t size;
+    };
+
+    struct Segment
+    {
+        std::string filename;
+        FILE*       file{ nullptr };
+    };
+
+  private:
+    Segment* GetSegment();
+
+    void MergeSegments();
+
+  private:
+    std::unique_ptr<OutputStream>         target_;
+    std::string                           filename_;
+    uint64_t                              stream_id_;
+    std::atomic<uint64_t>                 next_sequence_;
+    std::atomic<bool>                     write_failed_;
+    std::mutex                            segments_mutex_;
+    std::vector<std::unique_ptr<Segment>> segments_;
+
+    static std::atomic<uint64_t> next_stream_id_;
+    static thread_local uint64_t thread_stream_id_;
+    static thread_local Segment* thread_segment_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_THREAD_SEGMENT_OUTPUT_STREAM_H
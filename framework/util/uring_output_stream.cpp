@@ -0,0 +1,439 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/uring_output_stream.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#if defined(GFXRECON_ENABLE_IO_URING)
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+const uint32_t kNoBuffer = std::numeric_limits<uint32_t>::max();
+
+#if defined(GFXRECON_ENABLE_IO_URING)
+
+// The io_uring system calls do not have libc wrappers.
+static int IoUringSetup(uint32_t entries, io_uring_params* params)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int IoUringEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+static int IoUringRegister(int ring_fd, uint32_t opcode, const void* arg, uint32_t nr_args)
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+static uint32_t LoadAcquire(const uint32_t* value)
+{
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static void StoreRelease(uint32_t* value, uint32_t new_value)
+{
+    __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+}
+
+UringOutputStream::UringOutputStream(const std::string& filename, uint32_t queue_depth, size_t buffer_size) :
+    file_descriptor_(-1), ring_descriptor_(-1), registered_buffers_(false), write_failed_(false),
+    buffer_size_(buffer_size), file_offset_(0), in_flight_(0), current_buffer_(kNoBuffer)
+{
+    assert((queue_depth > 0) && (buffer_size > 0));
+
+    if (CreateRing(queue_depth))
+    {
+        buffer_memory_ = std::make_unique<uint8_t[]>(queue_depth * buffer_size);
+        buffers_.resize(queue_depth);
+
+        std::vector<iovec> iovecs(queue_depth);
+        for (uint32_t i = 0; i < queue_depth; ++i)
+        {
+            buffers_[i].data   = buffer_memory_.get() + (i * buffer_size);
+            iovecs[i].iov_base = buffers_[i].data;
+            iovecs[i].iov_len  = buffer_size;
+
+            // Reverse order, so that buffers are acquired from the start of the allocation.
+            free_buffers_.push_back(queue_depth - i - 1);
+        }
+
+        // Registration can fail when the buffers exceed the locked memory limit, in which case unregistered writes
+        // are used.
+        registered_buffers_ =
+            (IoUringRegister(ring_descriptor_, IORING_REGISTER_BUFFERS, iovecs.data(), queue_depth) == 0);
+        if (!registered_buffers_)
+        {
+            GFXRECON_LOG_WARNING("Failed to register io_uring buffers (errno = %d); using unregistered writes", errno);
+        }
+
+        file_descriptor_ =
+            open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (file_descriptor_ < 0)
+        {
+            GFXRECON_LOG_ERROR("open(%s) failed (errno = %d)", filename.c_str(), errno);
+        }
+    }
+}
+
+UringOutputStream::~UringOutputStream()
+{
+    if (IsValid())
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        SubmitCurrentBuffer();
+
+        while (in_flight_ > 0)
+        {
+            WaitForCompletion();
+        }
+    }
+
+    DestroyRing();
+
+    if (file_descriptor_ >= 0)
+    {
+        close(file_descriptor_);
+    }
+}
+
+size_t UringOutputStream::Write(const void* data, size_t len)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return CopyToBuffer(data, len);
+}
+
+size_t UringOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    size_t written = 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        written += CopyToBuffer(buffers[i].data, buffers[i].size);
+    }
+
+    return written;
+}
+
+void UringOutputStream::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    SubmitCurrentBuffer();
+}
+
+bool UringOutputStream::CreateRing(uint32_t queue_depth)
+{
+    io_uring_params params = {};
+
+    ring_descriptor_ = IoUringSetup(queue_depth, &params);
+    if (ring_descriptor_ < 0)
+    {
+        GFXRECON_LOG_WARNING("io_uring is not available (errno = %d)", errno);
+        return false;
+    }
+
+    ring_.sq_ring_size = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+    ring_.cq_ring_size = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+    ring_.sqes_size    = params.sq_entries * sizeof(io_uring_sqe);
+
+    ring_.sq_ring = mmap(nullptr,
+                         ring_.sq_ring_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE,
+                         ring_descriptor_,
+                         IORING_OFF_SQ_RING);
+    ring_.cq_ring = mmap(nullptr,
+                         ring_.cq_ring_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE,
+                         ring_descriptor_,
+                         IORING_OFF_CQ_RING);
+    ring_.sqes    = mmap(
+        nullptr, ring_.sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_descriptor_, IORING_OFF_SQES);
+
+    if ((ring_.sq_ring == MAP_FAILED) || (ring_.cq_ring == MAP_FAILED) || (ring_.sqes == MAP_FAILED))
+    {
+        GFXRECON_LOG_WARNING("Failed to map io_uring queues (errno = %d)", errno);
+        DestroyRing();
+        return false;
+    }
+
+    uint8_t* sq_ring = reinterpret_cast<uint8_t*>(ring_.sq_ring);
+    uint8_t* cq_ring = reinterpret_cast<uint8_t*>(ring_.cq_ring);
+
+    ring_.sq_head  = reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.head);
+    ring_.sq_tail  = reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.tail);
+    ring_.sq_mask  = reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.ring_mask);
+    ring_.sq_array = reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.array);
+    ring_.cq_head  = reinterpret_cast<uint32_t*>(cq_ring + params.cq_off.head);
+    ring_.cq_tail  = reinterpret_cast<uint32_t*>(cq_ring + params.cq_off.tail);
+    ring_.cq_mask  = reinterpret_cast<uint32_t*>(cq_ring + params.cq_off.ring_mask);
+    ring_.cqes     = cq_ring + params.cq_off.cqes;
+
+    return true;
+}
+
+void UringOutputStream::DestroyRing()
+{
+    if ((ring_.sqes != nullptr) && (ring_.sqes != MAP_FAILED))
+    {
+        munmap(ring_.sqes, ring_.sqes_size);
+    }
+
+    if ((ring_.cq_ring != nullptr) && (ring_.cq_ring != MAP_FAILED))
+    {
+        munmap(ring_.cq_ring, ring_.cq_ring_size);
+    }
+
+    if ((ring_.sq_ring != nullptr) && (ring_.sq_ring != MAP_FAILED))
+    {
+        munmap(ring_.sq_ring, ring_.sq_ring_size);
+    }
+
+    ring_ = Ring{};
+
+    if (ring_descriptor_ >= 0)
+    {
+        close(ring_descriptor_);
+        ring_descriptor_ = -1;
+    }
+}
+
+size_t UringOutputStream::CopyToBuffer(const void* data, size_t len)
+{
+    const uint8_t* bytes   = reinterpret_cast<const uint8_t*>(data);
+    size_t         written = 0;
+
+    while ((written < len) && !write_failed_ && ((current_buffer_ != kNoBuffer) || AcquireBuffer()))
+    {
+        Buffer& buffer    = buffers_[current_buffer_];
+        size_t  copy_size = std::min(len - written, buffer_size_ - buffer.size);
+
+        util::platform::MemoryCopy(buffer.data + buffer.size, copy_size, bytes + written, copy_size);
+
+        buffer.size += copy_size;
+        written += copy_size;
+
+        if (buffer.size == buffer_size_)
+        {
+            SubmitCurrentBuffer();
+        }
+    }
+
+    return write_failed_ ? 0 : written;
+}
+
+void UringOutputStream::SubmitCurrentBuffer()
+{
+    if ((current_buffer_ != kNoBuffer) && (buffers_[current_buffer_].size > 0))
+    {
+        Buffer& buffer     = buffers_[current_buffer_];
+        buffer.file_offset = file_offset_;
+        buffer.written     = 0;
+        file_offset_ += buffer.size;
+
+        SubmitWrite(current_buffer_);
+
+        current_buffer_ = kNoBuffer;
+    }
+}
+
+void UringOutputStream::SubmitWrite(uint32_t buffer_index)
+{
+    const Buffer& buffer = buffers_[buffer_index];
+
+    // Only this thread produces submissions, and the kernel consumes them before io_uring_enter() returns, so there
+    // is always space in the submission queue for the queue_depth writes that can be in flight.
+    uint32_t      tail  = *ring_.sq_tail;
+    uint32_t      index = tail & *ring_.sq_mask;
+    io_uring_sqe* sqe   = reinterpret_cast<io_uring_sqe*>(ring_.sqes) + index;
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode    = registered_buffers_ ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    sqe->fd        = file_descriptor_;
+    sqe->addr      = reinterpret_cast<uint64_t>(buffer.data + buffer.written);
+    sqe->len       = static_cast<uint32_t>(buffer.size - buffer.written);
+    sqe->off       = buffer.file_offset + buffer.written;
+    sqe->user_data = buffer_index;
+
+    if (registered_buffers_)
+    {
+        sqe->buf_index = static_cast<uint16_t>(buffer_index);
+    }
+
+    ring_.sq_array[index] = index;
+    StoreRelease(ring_.sq_tail, tail + 1);
+
+    int result = IoUringEnter(ring_descriptor_, 1, 0, 0);
+    if (result < 0)
+    {
+        GFXRECON_LOG_ERROR("io_uring write submission failed (errno = %d)", errno);
+        write_failed_ = true;
+        free_buffers_.push_back(buffer_index);
+    }
+    else
+    {
+        ++in_flight_;
+    }
+}
+
+void UringOutputStream::WaitForCompletion()
+{
+    uint32_t head = *ring_.cq_head;
+
+    while (head == LoadAcquire(ring_.cq_tail))
+    {
+        if ((IoUringEnter(ring_descriptor_, 0, 1, IORING_ENTER_GETEVENTS) < 0) && (errno != EINTR))
+        {
+            GFXRECON_LOG_ERROR("Failed to wait for io_uring write completion (errno = %d)", errno);
+            write_failed_ = true;
+            in_flight_    = 0;
+            return;
+        }
+    }
+
+    const io_uring_cqe* cqe          = reinterpret_cast<const io_uring_cqe*>(ring_.cqes) + (head & *ring_.cq_mask);
+    uint32_t            buffer_index = static_cast<uint32_t>(cqe->user_data);
+    int32_t             result       = cqe->res;
+
+    StoreRelease(ring_.cq_head, head + 1);
+    --in_flight_;
+
+    Buffer& buffer = buffers_[buffer_index];
+
+    if ((result == -EINTR) || (result == -EAGAIN))
+    {
+        SubmitWrite(buffer_index);
+    }
+    else if (result < 0)
+    {
+        if (!write_failed_)
+        {
+            GFXRECON_LOG_ERROR("io_uring write failed (errno = %d); output file will be incomplete", -result);
+            write_failed_ = true;
+        }
+
+        free_buffers_.push_back(buffer_index);
+    }
+    else if (result == 0)
+    {
+        if (!write_failed_)
+        {
+            GFXRECON_LOG_ERROR("io_uring write made no progress; output file will be incomplete");
+            write_failed_ = true;
+        }
+
+        free_buffers_.push_back(buffer_index);
+    }
+    else
+    {
+        buffer.written += static_cast<size_t>(result);
+
+        if (buffer.written < buffer.size)
+        {
+            // Short write; submit the remaining data.
+            SubmitWrite(buffer_index);
+        }
+        else
+        {
+            buffer.size    = 0;
+            buffer.written = 0;
+            free_buffers_.push_back(buffer_index);
+        }
+    }
+}
+
+bool UringOutputStream::AcquireBuffer()
+{
+    while (free_buffers_.empty() && (in_flight_ > 0))
+    {
+        WaitForCompletion();
+    }
+
+    if (!free_buffers_.empty())
+    {
+        current_buffer_ = free_buffers_.back();
+        free_buffers_.pop_back();
+
+        buffers_[current_buffer_].size    = 0;
+        buffers_[current_buffer_].written = 0;
+    }
+
+    return (current_buffer_ != kNoBuffer);
+}
+
+#else // GFXRECON_ENABLE_IO_URING
+
+UringOutputStream::UringOutputStream(const std::string& filename, uint32_t queue_depth, size_t buffer_size) :
+    file_descriptor_(-1), ring_descriptor_(-1), registered_buffers_(false), write_failed_(false),
+    buffer_size_(buffer_size), file_offset_(0), in_flight_(0), current_buffer_(kNoBuffer)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(filename);
+    GFXRECON_UNREFERENCED_PARAMETER(queue_depth);
+
+    GFXRECON_LOG_WARNING("io_uring output was requested, but is not supported by this build");
+}
+
+UringOutputStream::~UringOutputStream() {}
+
+size_t UringOutputStream::Write(const void* data, size_t len)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+    GFXRECON_UNREFERENCED_PARAMETER(len);
+    return 0;
+}
+
+size_t UringOutputStream::WriteBuffers(const OutputBuffer* buffers, size_t count)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(buffers);
+    GFXRECON_UNREFERENCED_PARAMETER(count);
+    return 0;
+}
+
+void UringOutputStream::Flush() {}
+
+#endif // GFXRECON_ENABLE_IO_URING
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
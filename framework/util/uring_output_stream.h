@@ -0,0 +1,128 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_URING_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_URING_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that writes a file with the Linux io_uring interface.  Data passed to Write() is copied to one of a
+// set of buffers that are registered with the kernel, and full buffers are submitted as asynchronous writes at their
+// file offset, so several writes can be in flight while the caller continues to produce data.  The stream is only
+// available when built with GFXRECON_ENABLE_IO_URING; IsValid() returns false if io_uring is not supported by the
+// build or the running kernel, and callers are expected to fall back to FileOutputStream.
+class UringOutputStream : public OutputStream
+{
+  public:
+    static const uint32_t kDefaultQueueDepth = 8;
+    static const size_t   kDefaultBufferSize = 1024 * 1024;
+
+  public:
+    UringOutputStream(const std::string& filename,
+                      uint32_t           queue_depth = kDefaultQueueDepth,
+                      size_t             buffer_size = kDefaultBufferSize);
+
+    // Blocks until all submitted writes have completed.
+    virtual ~UringOutputStream() override;
+
+    virtual bool IsValid() override { return (file_descriptor_ >= 0) && (ring_descriptor_ >= 0); }
+
+    // Returns 0 after a previously submitted write has failed.
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual size_t WriteBuffers(const OutputBuffer* buffers, size_t count) override;
+
+    // Submits the partially filled buffer, without waiting for the write to complete.
+    virtual void Flush() override;
+
+  private:
+    struct Buffer
+    {
+        uint8_t* data{ nullptr };
+        uint64_t file_offset{ 0 };
+        size_t   size{ 0 };
+        size_t   written{ 0 };
+    };
+
+    struct Ring
+    {
+        void*     sq_ring{ nullptr };
+        size_t    sq_ring_size{ 0 };
+        void*     cq_ring{ nullptr };
+        size_t    cq_ring_size{ 0 };
+        void*     sqes{ nullptr };
+        size_t    sqes_size{ 0 };
+        uint32_t* sq_head{ nullptr };
+        uint32_t* sq_tail{ nullptr };
+        uint32_t* sq_mask{ nullptr };
+        uint32_t* sq_array{ nullptr };
+        uint32_t* cq_head{ nullptr };
+        uint32_t* cq_tail{ nullptr };
+        uint32_t* cq_mask{ nullptr };
+        void*     cqes{ nullptr };
+    };
+
+  private:
+    bool CreateRing(uint32_t queue_depth);
+
+    void DestroyRing();
+
+    size_t CopyToBuffer(const void* data, size_t len);
+
+    void SubmitCurrentBuffer();
+
+    void SubmitWrite(uint32_t buffer_index);
+
+    void WaitForCompletion();
+
+    bool AcquireBuffer();
+
+  private:
+    int                        file_descriptor_;
+    int                        ring_descriptor_;
+    bool                       registered_buffers_;
+    bool                       write_failed_;
+    size_t                     buffer_size_;
+    uint64_t                   file_offset_;
+    uint32_t                   in_flight_;
+    uint32_t                   current_buffer_;
+    Ring                       ring_;
+    std::unique_ptr<uint8_t[]> buffer_memory_;
+    std::vector<Buffer>        buffers_;
+    std::vector<uint32_t>      free_buffers_;
+    std::mutex                 mutex_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_URING_OUTPUT_STREAM_H
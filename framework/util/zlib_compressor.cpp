@@ -25,16 +25,26 @@
 
 #include "util/zlib_compressor.h"
 
+#include "util/instrumentation.h"
+
 #include "zlib.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
-                                const uint8_t*        uncompressed_data,
-                                std::vector<uint8_t>* compressed_data,
-                                size_t                compressed_data_offset)
+size_t ZlibCompressor::GetMaxCompressedSize(size_t uncompressed_size) const
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uLong, uncompressed_size);
+    return compressBound(static_cast<uLong>(uncompressed_size));
+}
+
+size_t ZlibCompressor::Compress(const size_t   uncompressed_size,
+                                const uint8_t* uncompressed_data,
+                                const size_t   compressed_capacity,
+                                uint8_t*       compressed_data)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     size_t copy_size = 0;
 
     if (nullptr == compressed_data)
@@ -42,11 +52,6 @@ size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
         return 0;
     }
 
-    if (compressed_data->size() < (compressed_data_offset + uncompressed_size))
-    {
-        compressed_data->resize(compressed_data_offset + uncompressed_size);
-    }
-
     z_stream compress_stream = {};
     compress_stream.zalloc   = Z_NULL;
     compress_stream.zfree    = Z_NULL;
@@ -56,26 +61,32 @@ size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
     compress_stream.avail_in = static_cast<uInt>(uncompressed_size);
     compress_stream.next_in  = const_cast<Bytef*>(uncompressed_data);
 
-    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_data->size());
-    compress_stream.avail_out = static_cast<uInt>(compressed_data->size());
-    compress_stream.next_out  = compressed_data->data() + compressed_data_offset;
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_capacity);
+    compress_stream.avail_out = static_cast<uInt>(compressed_capacity);
+    compress_stream.next_out  = compressed_data;
 
-    // Perform the compression (deflate the data).
-    deflateInit(&compress_stream, Z_BEST_COMPRESSION);
-    deflate(&compress_stream, Z_FINISH);
+    // Perform the compression (deflate the data).  The stream is only complete if all of the compressed data fit in
+    // the output buffer.
+    deflateInit(&compress_stream, compression_level_);
+    int result = deflate(&compress_stream, Z_FINISH);
     deflateEnd(&compress_stream);
 
-    // Determine the size of data from the stream
-    copy_size = compress_stream.total_out;
+    if (result == Z_STREAM_END)
+    {
+        // Determine the size of data from the stream
+        copy_size = compress_stream.total_out;
+    }
 
     return copy_size;
 }
 
-size_t ZlibCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZlibCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   uncompressed_capacity,
+                                  uint8_t*       uncompressed_data)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     size_t copy_size = 0;
 
     if (nullptr == uncompressed_data)
@@ -90,11 +101,11 @@ size_t ZlibCompressor::Decompress(const size_t                compressed_size,
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_size);
     decompress_stream.avail_in = static_cast<uInt>(compressed_size);
-    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data.data());
+    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data);
 
-    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, expected_uncompressed_size);
-    decompress_stream.avail_out = static_cast<uInt>(expected_uncompressed_size);
-    decompress_stream.next_out  = uncompressed_data->data();
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, uncompressed_capacity);
+    decompress_stream.avail_out = static_cast<uInt>(uncompressed_capacity);
+    decompress_stream.next_out  = uncompressed_data;
 
     // Perform the decompression (inflate the data).
     inflateInit(&decompress_stream);
@@ -32,19 +32,31 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class ZlibCompressor : public Compressor
 {
   public:
-    ZlibCompressor() {}
+    static const int kDefaultCompressionLevel = 9;
+    static const int kMaxCompressionLevel     = 9;
+
+  public:
+    ZlibCompressor(int compression_level = kDefaultCompressionLevel) : compression_level_(compression_level) {}
 
     virtual ~ZlibCompressor() override {}
 
-    virtual size_t Compress(const size_t          uncompressed_size,
-                            const uint8_t*        uncompressed_data,
-                            std::vector<uint8_t>* compressed_data,
-                            size_t                compressed_data_offset) override;
+    using Compressor::Compress;
+    using Compressor::Decompress;
+
+    virtual size_t GetMaxCompressedSize(size_t uncompressed_size) const override;
+
+    virtual size_t Compress(const size_t   uncompressed_size,
+                            const uint8_t* uncompressed_data,
+                            const size_t   compressed_capacity,
+                            uint8_t*       compressed_data) override;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   uncompressed_capacity,
+                              uint8_t*       uncompressed_data) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+  private:
+    int compression_level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
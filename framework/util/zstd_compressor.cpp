@@ -24,20 +24,75 @@
 
 #include "util/zstd_compressor.h"
 
+#include "util/instrumentation.h"
 #include "util/logging.h"
 
+#include "zdict.h"
 #include "zstd.h"
+#include "zstd_errors.h"
 
+#include <cassert>
 #include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
-                                const uint8_t*        uncompressed_data,
-                                std::vector<uint8_t>* compressed_data,
-                                size_t                compressed_data_offset)
+ZstdCompressor::ZstdCompressor(int compression_level, bool long_distance_matching, uint32_t worker_threads) :
+    compression_level_(compression_level), long_distance_matching_(long_distance_matching), worker_threads_(0),
+    decompress_context_(nullptr), compress_dictionary_(nullptr), decompress_dictionary_(nullptr)
 {
+    // Long distance matching and worker threads are only available through the advanced API.  Create the first pooled
+    // contexts now, to check that the parameters are supported.
+    if (long_distance_matching_)
+    {
+        ZSTD_CCtx_s* context = AcquireCompressContext(false);
+
+        if (context != nullptr)
+        {
+            ReleaseCompressContext(context, false);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Failed to enable Zstandard long distance matching");
+            long_distance_matching_ = false;
+        }
+    }
+
+    if (worker_threads > 0)
+    {
+        worker_threads_      = worker_threads;
+        ZSTD_CCtx_s* context = AcquireCompressContext(true);
+
+        if (context != nullptr)
+        {
+            ReleaseCompressContext(context, true);
+        }
+        else
+        {
+            // The worker thread parameter is rejected when the library was built without multithreading support.
+            GFXRECON_LOG_WARNING("Failed to enable Zstandard compression worker threads");
+            worker_threads_ = 0;
+        }
+    }
+}
+
+ZstdCompressor::~ZstdCompressor()
+{
+    DestroyDictionary();
+}
+
+size_t ZstdCompressor::GetMaxCompressedSize(size_t uncompressed_size) const
+{
+    return ZSTD_compressBound(uncompressed_size);
+}
+
+size_t ZstdCompressor::Compress(const size_t   uncompressed_size,
+                                const uint8_t* uncompressed_data,
+                                const size_t   compressed_capacity,
+                                uint8_t*       compressed_data)
+{
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     size_t data_size = 0;
 
     if (nullptr == compressed_data)
@@ -45,37 +100,59 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
         return 0;
     }
 
-    size_t zstd_compressed_size = ZSTD_compressBound(uncompressed_size);
+    size_t compressed_size_generated = 0;
+
+    bool use_worker_threads = (worker_threads_ > 0) && (uncompressed_size >= kMinWorkerThreadSize);
 
-    if ((compressed_data_offset + zstd_compressed_size) > compressed_data->size())
+    if (use_worker_threads || long_distance_matching_ || (compress_dictionary_ != nullptr))
     {
-        compressed_data->resize(compressed_data_offset + zstd_compressed_size);
-    }
+        // The context references the dictionary and the compression parameters.
+        ZSTD_CCtx_s* context = AcquireCompressContext(use_worker_threads);
 
-    size_t compressed_size_generated =
-        ZSTD_compress(reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                      zstd_compressed_size,
-                      reinterpret_cast<const char*>(uncompressed_data),
-                      uncompressed_size,
-                      1);
+        if (context == nullptr)
+        {
+            GFXRECON_LOG_ERROR("Failed to create a Zstandard compression context");
+            return 0;
+        }
+
+        compressed_size_generated = ZSTD_compress2(context,
+                                                   reinterpret_cast<char*>(compressed_data),
+                                                   compressed_capacity,
+                                                   reinterpret_cast<const char*>(uncompressed_data),
+                                                   uncompressed_size);
+
+        ReleaseCompressContext(context, use_worker_threads);
+    }
+    else
+    {
+        compressed_size_generated =
+            ZSTD_compress(reinterpret_cast<char*>(compressed_data),
+                          compressed_capacity,
+                          reinterpret_cast<const char*>(uncompressed_data),
+                          uncompressed_size,
+                          compression_level_);
+    }
 
     if (!ZSTD_isError(compressed_size_generated))
     {
         data_size = compressed_size_generated;
     }
-    else
+    else if (ZSTD_getErrorCode(compressed_size_generated) != ZSTD_error_dstSize_tooSmall)
     {
+        // Running out of space in a caller provided buffer is expected when the data is not compressible.
         GFXRECON_LOG_ERROR("Zstandard compression failed with error %" PRIdPTR, compressed_size_generated);
     }
 
     return data_size;
 }
 
-size_t ZstdCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZstdCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   uncompressed_capacity,
+                                  uint8_t*       uncompressed_data)
 {
+    GFXRECON_INSTRUMENT_FUNCTION();
+
     size_t data_size = 0;
 
     if (nullptr == uncompressed_data)
@@ -83,10 +160,24 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data->data()),
-                                                         expected_uncompressed_size,
-                                                         reinterpret_cast<const char*>(compressed_data.data()),
-                                                         compressed_size);
+    size_t uncompressed_size_generated = 0;
+
+    if (decompress_dictionary_ != nullptr)
+    {
+        uncompressed_size_generated = ZSTD_decompress_usingDDict(decompress_context_,
+                                                                 reinterpret_cast<char*>(uncompressed_data),
+                                                                 uncompressed_capacity,
+                                                                 reinterpret_cast<const char*>(compressed_data),
+                                                                 compressed_size,
+                                                                 decompress_dictionary_);
+    }
+    else
+    {
+        uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data),
+                                                      uncompressed_capacity,
+                                                      reinterpret_cast<const char*>(compressed_data),
+                                                      compressed_size);
+    }
 
     if (!ZSTD_isError(uncompressed_size_generated))
     {
@@ -100,6 +191,153 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
     return data_size;
 }
 
+bool ZstdCompressor::SetDictionary(const std::vector<uint8_t>& dictionary)
+{
+    bool success = false;
+
+    DestroyDictionary();
+
+    if (!dictionary.empty())
+    {
+        decompress_context_    = ZSTD_createDCtx();
+        compress_dictionary_   = ZSTD_createCDict(dictionary.data(), dictionary.size(), compression_level_);
+        decompress_dictionary_ = ZSTD_createDDict(dictionary.data(), dictionary.size());
+
+        if ((decompress_context_ != nullptr) && (compress_dictionary_ != nullptr) &&
+            (decompress_dictionary_ != nullptr))
+        {
+            // Compression contexts are created with a reference to the dictionary when they are first needed.
+            success = true;
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to load Zstandard compression dictionary");
+            DestroyDictionary();
+        }
+    }
+
+    return success;
+}
+
+bool ZstdCompressor::TrainDictionary(const std::vector<uint8_t>& sample_data,
+                                     const std::vector<size_t>&  sample_sizes,
+                                     size_t                      max_dictionary_size,
+                                     std::vector<uint8_t>*       dictionary)
+{
+    assert(dictionary != nullptr);
+
+    bool success = false;
+
+    dictionary->resize(max_dictionary_size);
+
+    size_t dictionary_size = ZDICT_trainFromBuffer(dictionary->data(),
+                                                   max_dictionary_size,
+                                                   sample_data.data(),
+                                                   sample_sizes.data(),
+                                                   static_cast<unsigned>(sample_sizes.size()));
+
+    if (!ZDICT_isError(dictionary_size))
+    {
+        dictionary->resize(dictionary_size);
+        success = true;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Zstandard dictionary training failed with error: %s", ZDICT_getErrorName(dictionary_size));
+        dictionary->clear();
+    }
+
+    return success;
+}
+
+ZSTD_CCtx_s* ZstdCompressor::AcquireCompressContext(bool use_worker_threads)
+{
+    {
+        std::lock_guard<std::mutex> lock(context_mutex_);
+
+        auto& contexts = use_worker_threads ? worker_compress_contexts_ : compress_contexts_;
+        if (!contexts.empty())
+        {
+            ZSTD_CCtx_s* context = contexts.back();
+            contexts.pop_back();
+            return context;
+        }
+    }
+
+    // Parameters set on a context apply to all subsequent compression operations with the context.
+    ZSTD_CCtx_s* context = ZSTD_createCCtx();
+
+    if ((context != nullptr) &&
+        (ZSTD_isError(ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, compression_level_)) ||
+         (long_distance_matching_ &&
+          ZSTD_isError(ZSTD_CCtx_setParameter(context, ZSTD_c_enableLongDistanceMatching, 1))) ||
+         (use_worker_threads &&
+          ZSTD_isError(ZSTD_CCtx_setParameter(context, ZSTD_c_nbWorkers, static_cast<int>(worker_threads_)))) ||
+         ((compress_dictionary_ != nullptr) && ZSTD_isError(ZSTD_CCtx_refCDict(context, compress_dictionary_)))))
+    {
+        ZSTD_freeCCtx(context);
+        context = nullptr;
+    }
+
+    return context;
+}
+
+void ZstdCompressor::ReleaseCompressContext(ZSTD_CCtx_s* context, bool use_worker_threads)
+{
+    std::lock_guard<std::mutex> lock(context_mutex_);
+
+    if (use_worker_threads)
+    {
+        worker_compress_contexts_.push_back(context);
+    }
+    else
+    {
+        compress_contexts_.push_back(context);
+    }
+}
+
+void ZstdCompressor::DestroyCompressContexts()
+{
+    std::lock_guard<std::mutex> lock(context_mutex_);
+
+    for (ZSTD_CCtx_s* context : compress_contexts_)
+    {
+        ZSTD_freeCCtx(context);
+    }
+
+    for (ZSTD_CCtx_s* context : worker_compress_contexts_)
+    {
+        ZSTD_freeCCtx(context);
+    }
+
+    compress_contexts_.clear();
+    worker_compress_contexts_.clear();
+}
+
+void ZstdCompressor::DestroyDictionary()
+{
+    // Pooled contexts may reference the dictionary.
+    DestroyCompressContexts();
+
+    if (compress_dictionary_ != nullptr)
+    {
+        ZSTD_freeCDict(compress_dictionary_);
+        compress_dictionary_ = nullptr;
+    }
+
+    if (decompress_dictionary_ != nullptr)
+    {
+        ZSTD_freeDDict(decompress_dictionary_);
+        decompress_dictionary_ = nullptr;
+    }
+
+    if (decompress_context_ != nullptr)
+    {
+        ZSTD_freeDCtx(decompress_context_);
+        decompress_context_ = nullptr;
+    }
+}
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -25,25 +25,83 @@
 
 #include "util/compressor.h"
 
+#include <mutex>
+#include <vector>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
 class ZstdCompressor : public Compressor
 {
   public:
-    ZstdCompressor() {}
+    static const int    kDefaultCompressionLevel = 1;
+    static const size_t kMinWorkerThreadSize     = 8 * 1024 * 1024;
+
+  public:
+    // Negative compression levels trade compression ratio for speed.  Long distance matching improves the compression
+    // ratio of large inputs with repeated data that is far apart, at the cost of memory and speed, for archival.
+    // When worker_threads is non-zero, inputs of at least kMinWorkerThreadSize bytes are split into jobs that are
+    // compressed by that many worker threads, which are owned by the compression context.  The output is a single
+    // frame, which is decompressed as usual.
+    ZstdCompressor(int      compression_level      = kDefaultCompressionLevel,
+                   bool     long_distance_matching = false,
+                   uint32_t worker_threads         = 0);
+
+    virtual ~ZstdCompressor() override;
+
+    using Compressor::Compress;
+    using Compressor::Decompress;
+
+    virtual size_t GetMaxCompressedSize(size_t uncompressed_size) const override;
+
+    virtual size_t Compress(const size_t   uncompressed_size,
+                            const uint8_t* uncompressed_data,
+                            const size_t   compressed_capacity,
+                            uint8_t*       compressed_data) override;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   uncompressed_capacity,
+                              uint8_t*       uncompressed_data) override;
+
+    // A decompression context is created for the dictionary, so a compressor with a dictionary must not be used for
+    // decompression by multiple threads concurrently.  Must not be called concurrently with compression.
+    virtual bool SetDictionary(const std::vector<uint8_t>& dictionary) override;
+
+    // Train a dictionary of up to max_dictionary_size bytes from a set of samples, which are stored contiguously in
+    // sample_data with the size of each sample stored in sample_sizes.
+    static bool TrainDictionary(const std::vector<uint8_t>& sample_data,
+                                const std::vector<size_t>&  sample_sizes,
+                                size_t                      max_dictionary_size,
+                                std::vector<uint8_t>*       dictionary);
+
+  private:
+    // Returns a context for the advanced compression API, configured with the compression parameters and dictionary.
+    // Contexts are pooled, so that the compressor can be used by multiple threads concurrently.
+    // Contexts for large inputs are pooled separately, with the worker thread parameter set.
+    ZSTD_CCtx_s* AcquireCompressContext(bool use_worker_threads);
+
+    void ReleaseCompressContext(ZSTD_CCtx_s* context, bool use_worker_threads);
 
-    virtual ~ZstdCompressor() override {}
+    void DestroyCompressContexts();
 
-    virtual size_t Compress(const size_t          uncompressed_size,
-                            const uint8_t*        uncompressed_data,
-                            std::vector<uint8_t>* compressed_data,
-                            size_t                compressed_data_offset) override;
+    void DestroyDictionary();
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+  private:
+    int                       compression_level_;
+    bool                      long_distance_matching_;
+    uint32_t                  worker_threads_;
+    std::mutex                context_mutex_;
+    std::vector<ZSTD_CCtx_s*> compress_contexts_;
+    std::vector<ZSTD_CCtx_s*> worker_compress_contexts_;
+    ZSTD_DCtx_s*              decompress_context_;
+    ZSTD_CDict_s*             compress_dictionary_;
+    ZSTD_DDict_s*             decompress_dictionary_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -33,6 +33,7 @@
 
 #include "vulkan/vk_layer.h"
 
+#include <atomic>
 #include <cstring>
 #include <mutex>
 #include <string>
@@ -81,21 +82,80 @@ static const VkLayerDeviceCreateInfo* get_device_chain_info(const VkDeviceCreate
     return chain_info;
 }
 
+// Instances are stored for use with vkCreateDevice, keyed by dispatch key.  Instances are created rarely and looked up
+// from any thread, so they are stored in a small open-addressed table that is read without locking.  Writers are
+// serialized by instance_handles_lock, and publish an entry by storing its key after its instance.  Entries are never
+// removed, as a destroyed instance's dispatch key is only reused by a new instance, which replaces the entry's value.
+// Instances that do not fit in the table are stored in a map that is accessed with the lock held.
+const size_t kInstanceHandleTableSize = 64;
+
+struct InstanceHandleEntry
+{
+    std::atomic<const void*> key;
+    std::atomic<VkInstance>  instance;
+};
+
+static InstanceHandleEntry                         instance_handle_table[kInstanceHandleTableSize];
 static std::mutex                                  instance_handles_lock;
-static std::unordered_map<const void*, VkInstance> instance_handles;
+static std::unordered_map<const void*, VkInstance> instance_handles_overflow;
+
+static size_t get_instance_handle_slot(const void* key)
+{
+    // Dispatch keys are pointers to loader allocations, so the low bits are discarded by the hash.
+    return (reinterpret_cast<uintptr_t>(key) >> 4) % kInstanceHandleTableSize;
+}
 
 static void add_instance_handle(VkInstance instance)
 {
-    // Store the instance for use with vkCreateDevice.
+    const void*                 key  = encode::GetDispatchKey(instance);
+    size_t                      slot = get_instance_handle_slot(key);
     std::lock_guard<std::mutex> lock(instance_handles_lock);
-    instance_handles[encode::GetDispatchKey(instance)] = instance;
+
+    for (size_t i = 0; i < kInstanceHandleTableSize; ++i)
+    {
+        InstanceHandleEntry& entry     = instance_handle_table[(slot + i) % kInstanceHandleTableSize];
+        const void*          entry_key = entry.key.load(std::memory_order_relaxed);
+
+        if (entry_key == key)
+        {
+            entry.instance.store(instance, std::memory_order_release);
+            return;
+        }
+        else if (entry_key == nullptr)
+        {
+            entry.instance.store(instance, std::memory_order_relaxed);
+            entry.key.store(key, std::memory_order_release);
+            return;
+        }
+    }
+
+    instance_handles_overflow[key] = instance;
 }
 
 static VkInstance get_instance_handle(const void* handle)
 {
+    const void* key  = encode::GetDispatchKey(handle);
+    size_t      slot = get_instance_handle_slot(key);
+
+    for (size_t i = 0; i < kInstanceHandleTableSize; ++i)
+    {
+        const InstanceHandleEntry& entry     = instance_handle_table[(slot + i) % kInstanceHandleTableSize];
+        const void*                entry_key = entry.key.load(std::memory_order_acquire);
+
+        if (entry_key == key)
+        {
+            return entry.instance.load(std::memory_order_acquire);
+        }
+        else if (entry_key == nullptr)
+        {
+            // Entries are filled in probe order and never removed, so the instance is not in the table.
+            return VK_NULL_HANDLE;
+        }
+    }
+
     std::lock_guard<std::mutex> lock(instance_handles_lock);
-    auto                        entry = instance_handles.find(encode::GetDispatchKey(handle));
-    return (entry != instance_handles.end()) ? entry->second : VK_NULL_HANDLE;
+    auto                        entry = instance_handles_overflow.find(key);
+    return (entry != instance_handles_overflow.end()) ? entry->second : VK_NULL_HANDLE;
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL dispatch_CreateInstance(const VkInstanceCreateInfo*  pCreateInfo,
@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2021 LunarG, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+'''
+GFXReconstruct performance regression test script
+
+Replays each capture file of a directory with gfxrecon-replay, and processes
+it with gfxrecon-bench, then compares the measured times with the baselines
+that were stored for the capture file.  A measurement regresses when it
+exceeds its baseline by more than the tolerance.  The measurements and the
+result of each comparison are written to a JSON summary file.
+'''
+
+import argparse
+import json
+import os
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+# Extension of the capture files that are measured
+CAPTURE_FILE_EXTENSION = '.gfxr'
+
+# Name of the baseline file in the baseline directory
+BASELINE_FILE_NAME = 'perf_baselines.json'
+
+# Frame timing report statistics that are compared with the baselines
+REPLAY_METRICS = [
+    ('cpu_ms', 'mean'),
+    ('cpu_ms', 'p95'),
+    ('gpu_ms', 'mean'),
+]
+
+# gfxrecon-bench passes that are compared with the baselines
+BENCH_PASSES = ['read', 'decode', 'read_and_decode', 'encode']
+
+REPLAY_MODES = ['headless', 'virtual-swapchain']
+
+
+class PerfTestError(Exception):
+    '''
+    Raised when a capture file cannot be measured
+    '''
+
+
+def parse_args():
+    '''
+    Parse command line arguments
+    '''
+    arg_parser = argparse.ArgumentParser(
+        description='gfxreconstruct performance regression test script')
+    arg_parser.add_argument(
+        '--replay', required=True, help='Path to gfxrecon-replay')
+    arg_parser.add_argument(
+        '--bench', required=True, help='Path to gfxrecon-bench')
+    arg_parser.add_argument(
+        '--trace-dir', required=True,
+        help='Directory of the capture files to measure')
+    arg_parser.add_argument(
+        '--baseline-dir', default=None,
+        help='Directory of the {} file (default: the trace '
+        'directory)'.format(BASELINE_FILE_NAME))
+    arg_parser.add_argument(
+        '--tolerance', type=float, default=10.0,
+        help='Percentage by which a measurement may exceed its baseline '
+        '(default: 10)')
+    arg_parser.add_argument(
+        '--runs', type=int, default=1,
+        help='Number of times that each capture file is measured, reporting '
+        'the median of the runs (default: 1)')
+    arg_parser.add_argument(
+        '--replay-mode', choices=REPLAY_MODES, default=REPLAY_MODES[0],
+        help='Replay with the headless WSI platform, or with a virtual '
+        'swapchain (default: {})'.format(REPLAY_MODES[0]))
+    arg_parser.add_argument(
+        '--replay-args', default='',
+        help='Additional arguments for gfxrecon-replay')
+    arg_parser.add_argument(
+        '--summary', default='perf_test_summary.json',
+        help='Path of the JSON summary file '
+        '(default: perf_test_summary.json)')
+    arg_parser.add_argument(
+        '--update-baselines', action='store_true',
+        help='Store the measurements as the new baselines instead of '
+        'comparing them')
+    return arg_parser.parse_args()
+
+
+def run_tool(tool_args):
+    '''
+    Run a tool, returning its wall time in seconds
+
+    If the tool fails an error is thrown.
+    '''
+    start = time.perf_counter()
+    try:
+        result = subprocess.run(
+            tool_args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+            universal_newlines=True)
+    except OSError as error:
+        raise PerfTestError('Failed to run {}: {}'.format(
+            ' '.join(tool_args), error))
+    seconds = time.perf_counter() - start
+    if 0 != result.returncode:
+        output = result.stdout.strip().splitlines()
+        raise PerfTestError('{} failed with exit code {}: {}'.format(
+            ' '.join(tool_args), result.returncode,
+            output[-1] if output else ''))
+    return seconds
+
+
+def read_report(report_file):
+    '''
+    Read a JSON report file written by a tool
+    '''
+    try:
+        with open(report_file, 'r') as report:
+            return json.load(report)
+    except (OSError, ValueError) as error:
+        raise PerfTestError('Failed to read report {}: {}'.format(
+            report_file, error))
+
+
+def measure_replay(args, capture_file, report_dir):
+    '''
+    Replay a capture file, returning the measurements of its frame timing
+    report
+    '''
+    report_file = os.path.join(report_dir, 'timing_report.json')
+    replay_args = [args.replay, '--timing-report', report_file]
+    if 'headless' == args.replay_mode:
+        replay_args.extend(['--wsi', 'headless'])
+    else:
+        replay_args.append('--virtual-swapchain')
+    replay_args.extend(shlex.split(args.replay_args))
+    replay_args.append(capture_file)
+
+    metrics = {'replay_seconds': run_tool(replay_args)}
+    summary = read_report(report_file).get('summary', {})
+    for value_name, statistic in REPLAY_METRICS:
+        values = summary.get(value_name)
+        # GPU times are not reported by devices without timestamp queries.
+        if values and values.get('count', 0) > 0:
+            metrics['replay_{}_{}'.format(value_name, statistic)] = \
+                values[statistic]
+    return metrics
+
+
+def measure_bench(args, capture_file, report_dir):
+    '''
+    Process a capture file with gfxrecon-bench, returning the time of each
+    pass
+
+    The codec pass is skipped by sampling no data, as its time does not
+    depend on the processing code of the tools.
+    '''
+    report_file = os.path.join(report_dir, 'bench_report.json')
+    run_tool([args.bench, '--sample-size', '0', '--report', report_file,
+              capture_file])
+
+    passes = read_report(report_file).get('passes', {})
+    metrics = {}
+    for pass_name in BENCH_PASSES:
+        if pass_name in passes:
+            metrics['bench_{}_seconds'.format(pass_name)] = \
+                passes[pass_name]['seconds']
+    return metrics
+
+
+def measure(args, capture_file):
+    '''
+    Measure a capture file, returning the median of each measurement over
+    the runs
+    '''
+    runs = []
+    for _ in range(max(args.runs, 1)):
+        with tempfile.TemporaryDirectory() as report_dir:
+            metrics = measure_replay(args, capture_file, report_dir)
+            metrics.update(measure_bench(args, capture_file, report_dir))
+            runs.append(metrics)
+    return {name: statistics.median([run[name] for run in runs if name in run])
+            for name in runs[0]}
+
+
+def compare(metrics, baselines, tolerance):
+    '''
+    Compare measurements with their baselines, returning the result of each
+    comparison and the status of the capture file
+    '''
+    results = {}
+    status = 'passed'
+    for name, value in sorted(metrics.items()):
+        result = {'value': value}
+        baseline = baselines.get(name)
+        if baseline is None:
+            result['status'] = 'no_baseline'
+        else:
+            change = ((value - baseline) / baseline * 100.0) \
+                if baseline > 0.0 else 0.0
+            result['baseline'] = baseline
+            result['change_percent'] = change
+            if change > tolerance:
+                result['status'] = 'regressed'
+                status = 'regressed'
+            elif change < -tolerance:
+                result['status'] = 'improved'
+            else:
+                result['status'] = 'passed'
+        results[name] = result
+    if not baselines and 'passed' == status:
+        status = 'no_baseline'
+    return results, status
+
+
+def load_baselines(baseline_file):
+    '''
+    Load the baselines of each capture file, or no baselines if the file does
+    not exist
+    '''
+    if not os.path.isfile(baseline_file):
+        return {}
+    with open(baseline_file, 'r') as baselines:
+        return json.load(baselines)
+
+
+def write_json(path, data):
+    '''
+    Write data to a JSON file
+    '''
+    with open(path, 'w') as json_file:
+        json.dump(data, json_file, indent=2, sort_keys=True)
+        json_file.write('\n')
+
+
+# Main entry point
+if '__main__' == __name__:
+    args = parse_args()
+    baseline_dir = args.baseline_dir if args.baseline_dir else args.trace_dir
+    baseline_file = os.path.join(baseline_dir, BASELINE_FILE_NAME)
+    baselines = load_baselines(baseline_file)
+    capture_files = sorted(
+        name for name in os.listdir(args.trace_dir)
+        if name.endswith(CAPTURE_FILE_EXTENSION))
+
+    summary = {
+        'tolerance_percent': args.tolerance,
+        'replay_mode': args.replay_mode,
+        'runs': max(args.runs, 1),
+        'traces': [],
+    }
+    passed = True
+    for capture_file in capture_files:
+        trace = {'trace': capture_file}
+        try:
+            metrics = measure(
+                args, os.path.join(args.trace_dir, capture_file))
+        except PerfTestError as error:
+            trace['status'] = 'failed'
+            trace['error'] = str(error)
+            passed = False
+        else:
+            if args.update_baselines:
+                baselines[capture_file] = metrics
+            trace['metrics'], trace['status'] = compare(
+                metrics, baselines.get(capture_file, {}), args.tolerance)
+            if 'regressed' == trace['status']:
+                passed = False
+        print('{}: {}'.format(capture_file, trace['status']))
+        summary['traces'].append(trace)
+
+    summary['passed'] = passed
+    write_json(args.summary, summary)
+    if args.update_baselines:
+        write_json(baseline_file, baselines)
+    sys.exit(0 if passed else 1)
@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "bench_decoders.h"
+
+#include "util/date_time.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+BlockSampleDecoder::BlockSampleDecoder(size_t max_sample_data_size) :
+    max_sample_data_size_(max_sample_data_size), call_count_(0), call_data_size_(0)
+{}
+
+BlockSampleDecoder::~BlockSampleDecoder() {}
+
+void BlockSampleDecoder::DecodeFunctionCall(format::ApiCallId          call_id,
+                                            const decode::ApiCallInfo& call_info,
+                                            const uint8_t*             parameter_buffer,
+                                            size_t                     buffer_size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(call_id);
+    GFXRECON_UNREFERENCED_PARAMETER(call_info);
+
+    ++call_count_;
+    call_data_size_ += buffer_size;
+
+    AddSample(kSampleFunctionCall, parameter_buffer, buffer_size);
+}
+
+void BlockSampleDecoder::DispatchFillMemoryCommand(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+    GFXRECON_UNREFERENCED_PARAMETER(memory_id);
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+
+    AddSample(kSampleFillMemory, data, size);
+}
+
+void BlockSampleDecoder::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                                   format::HandleId device_id,
+                                                   format::HandleId buffer_id,
+                                                   uint64_t         data_size,
+                                                   const uint8_t*   data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+    GFXRECON_UNREFERENCED_PARAMETER(device_id);
+    GFXRECON_UNREFERENCED_PARAMETER(buffer_id);
+
+    AddSample(kSampleInitBuffer, data, data_size);
+}
+
+void BlockSampleDecoder::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                                  format::HandleId             device_id,
+                                                  format::HandleId             image_id,
+                                                  uint64_t                     data_size,
+                                                  uint32_t                     aspect,
+                                                  uint32_t                     layout,
+                                                  const std::vector<uint64_t>& level_sizes,
+                                                  const uint8_t*               data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+    GFXRECON_UNREFERENCED_PARAMETER(device_id);
+    GFXRECON_UNREFERENCED_PARAMETER(image_id);
+    GFXRECON_UNREFERENCED_PARAMETER(aspect);
+    GFXRECON_UNREFERENCED_PARAMETER(layout);
+    GFXRECON_UNREFERENCED_PARAMETER(level_sizes);
+
+    AddSample(kSampleInitImage, data, data_size);
+}
+
+void BlockSampleDecoder::AddSample(SampleType type, const uint8_t* data, uint64_t size)
+{
+    Samples& samples = samples_[type];
+
+    if ((data != nullptr) && (size > 0) && ((samples.data.size() + size) <= max_sample_data_size_))
+    {
+        samples.data.insert(samples.data.end(), data, data + size);
+        samples.sizes.push_back(static_cast<size_t>(size));
+    }
+}
+
+TimedVulkanDecoder::TimedVulkanDecoder() : call_count_(0), call_data_size_(0), decode_time_(0) {}
+
+TimedVulkanDecoder::~TimedVulkanDecoder() {}
+
+void TimedVulkanDecoder::DecodeFunctionCall(format::ApiCallId          call_id,
+                                            const decode::ApiCallInfo& call_info,
+                                            const uint8_t*             parameter_buffer,
+                                            size_t                     buffer_size)
+{
+    int64_t start = util::datetime::GetTimestamp();
+
+    VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+
+    decode_time_ += util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+    ++call_count_;
+    call_data_size_ += buffer_size;
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
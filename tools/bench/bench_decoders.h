@@ -0,0 +1,130 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_BENCH_DECODERS_H
+#define GFXRECON_BENCH_DECODERS_H
+
+#include "decode/vulkan_decoder_base.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Receives the uncompressed data of function call, fill memory, and resource initialization blocks without decoding
+// it, so that the file can be read without the cost of decoding.  Collects the data of each block type as samples for
+// the codec benchmarks.
+class BlockSampleDecoder : public decode::VulkanDecoderBase
+{
+  public:
+    enum SampleType
+    {
+        kSampleFunctionCall = 0,
+        kSampleFillMemory   = 1,
+        kSampleInitBuffer   = 2,
+        kSampleInitImage    = 3,
+        kSampleTypeCount
+    };
+
+    struct Samples
+    {
+        std::vector<uint8_t> data;
+        std::vector<size_t>  sizes;
+    };
+
+  public:
+    // Sample collection stops for each block type when the total size of its samples reaches max_sample_data_size.
+    BlockSampleDecoder(size_t max_sample_data_size);
+
+    virtual ~BlockSampleDecoder() override;
+
+    virtual void DecodeFunctionCall(format::ApiCallId          call_id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             parameter_buffer,
+                                    size_t                     buffer_size) override;
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override;
+
+    uint64_t GetCallCount() const { return call_count_; }
+
+    uint64_t GetCallDataSize() const { return call_data_size_; }
+
+    const Samples& GetSamples(SampleType type) const { return samples_[type]; }
+
+  private:
+    void AddSample(SampleType type, const uint8_t* data, uint64_t size);
+
+  private:
+    size_t   max_sample_data_size_;
+    uint64_t call_count_;
+    uint64_t call_data_size_;
+    Samples  samples_[kSampleTypeCount];
+};
+
+// Decodes function calls with the generated Vulkan decoder, measuring the time spent decoding the calls.  The time
+// includes the time spent by the consumers that the decoded calls are passed to.
+class TimedVulkanDecoder : public decode::VulkanDecoder
+{
+  public:
+    TimedVulkanDecoder();
+
+    virtual ~TimedVulkanDecoder() override;
+
+    virtual void DecodeFunctionCall(format::ApiCallId          call_id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             parameter_buffer,
+                                    size_t                     buffer_size) override;
+
+    uint64_t GetCallCount() const { return call_count_; }
+
+    uint64_t GetCallDataSize() const { return call_data_size_; }
+
+    // Returns the total decode time in nanoseconds.
+    int64_t GetDecodeTime() const { return decode_time_; }
+
+  private:
+    uint64_t call_count_;
+    uint64_t call_data_size_;
+    int64_t  decode_time_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_BENCH_DECODERS_H
@@ -0,0 +1,234 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "codec_benchmark.h"
+
+#include "format/format_util.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#if defined(ENABLE_LZ4_COMPRESSION)
+#include "util/lz4_compressor.h"
+#endif
+#if defined(ENABLE_ZLIB_COMPRESSION)
+#include "util/zlib_compressor.h"
+#endif
+#if defined(ENABLE_ZSTD_COMPRESSION)
+#include "util/zstd_compressor.h"
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+const double kBytesPerMiB = 1024.0 * 1024.0;
+
+static const char* GetSampleTypeName(BlockSampleDecoder::SampleType sample_type)
+{
+    switch (sample_type)
+    {
+        case BlockSampleDecoder::kSampleFunctionCall:
+            return "function call";
+        case BlockSampleDecoder::kSampleFillMemory:
+            return "fill memory";
+        case BlockSampleDecoder::kSampleInitBuffer:
+            return "init buffer";
+        case BlockSampleDecoder::kSampleInitImage:
+            return "init image";
+        default:
+            break;
+    }
+
+    return "unknown";
+}
+
+static double GetThroughput(size_t size, int64_t time)
+{
+    double seconds = util::datetime::ConvertTimestampToSeconds(time);
+    return (seconds > 0.0) ? (static_cast<double>(size) / kBytesPerMiB / seconds) : 0.0;
+}
+
+CodecBenchmark::CodecBenchmark(const BlockSampleDecoder* sample_decoder) : sample_decoder_(sample_decoder) {}
+
+CodecBenchmark::~CodecBenchmark() {}
+
+void CodecBenchmark::Run()
+{
+    std::vector<Codec> codecs = GetCodecs();
+
+    GFXRECON_WRITE_CONSOLE("Codec (* marks the compression level used by the capture layer):");
+    GFXRECON_WRITE_CONSOLE("  %-13s %-9s %5s %10s %6s %17s %19s",
+                           "Block type",
+                           "Format",
+                           "Level",
+                           "Data (MiB)",
+                           "Ratio",
+                           "Compress (MiB/s)",
+                           "Decompress (MiB/s)");
+
+    for (int i = 0; i < BlockSampleDecoder::kSampleTypeCount; ++i)
+    {
+        auto sample_type = static_cast<BlockSampleDecoder::SampleType>(i);
+
+        if (!sample_decoder_->GetSamples(sample_type).sizes.empty())
+        {
+            for (const auto& codec : codecs)
+            {
+                RunCodec(sample_type, codec);
+            }
+        }
+    }
+}
+
+std::vector<CodecBenchmark::Codec> CodecBenchmark::GetCodecs()
+{
+    std::vector<Codec> codecs;
+
+#if defined(ENABLE_LZ4_COMPRESSION)
+    codecs.push_back({ format::CompressionType::kLz4, util::Lz4Compressor::kDefaultAcceleration, true });
+    codecs.push_back({ format::CompressionType::kLz4, 8, false });
+#endif
+#if defined(ENABLE_ZLIB_COMPRESSION)
+    codecs.push_back({ format::CompressionType::kZlib, 1, false });
+    codecs.push_back({ format::CompressionType::kZlib, 6, false });
+    codecs.push_back({ format::CompressionType::kZlib, util::ZlibCompressor::kDefaultCompressionLevel, true });
+#endif
+#if defined(ENABLE_ZSTD_COMPRESSION)
+    codecs.push_back({ format::CompressionType::kZstd, util::ZstdCompressor::kDefaultCompressionLevel, true });
+    codecs.push_back({ format::CompressionType::kZstd, 3, false });
+    codecs.push_back({ format::CompressionType::kZstd, 9, false });
+#endif
+
+    return codecs;
+}
+
+util::Compressor* CodecBenchmark::CreateCompressor(const Codec& codec)
+{
+    switch (codec.compression_type)
+    {
+#if defined(ENABLE_LZ4_COMPRESSION)
+        case format::CompressionType::kLz4:
+            return new util::Lz4Compressor(codec.level);
+#endif
+#if defined(ENABLE_ZLIB_COMPRESSION)
+        case format::CompressionType::kZlib:
+            return new util::ZlibCompressor(codec.level);
+#endif
+#if defined(ENABLE_ZSTD_COMPRESSION)
+        case format::CompressionType::kZstd:
+            return new util::ZstdCompressor(codec.level);
+#endif
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
+void CodecBenchmark::RunCodec(BlockSampleDecoder::SampleType sample_type, const Codec& codec)
+{
+    std::unique_ptr<util::Compressor> compressor(CreateCompressor(codec));
+
+    if (compressor == nullptr)
+    {
+        return;
+    }
+
+    const auto&          samples = sample_decoder_->GetSamples(sample_type);
+    std::vector<uint8_t> compressed_data;
+    std::vector<size_t>  compressed_sizes;
+    std::vector<uint8_t> uncompressed_data(*std::max_element(samples.sizes.begin(), samples.sizes.end()));
+    size_t               output_size = 0;
+    size_t               offset      = 0;
+
+    compressed_sizes.reserve(samples.sizes.size());
+
+    int64_t start = util::datetime::GetTimestamp();
+
+    for (auto sample_size : samples.sizes)
+    {
+        size_t compressed_offset = compressed_data.size();
+        size_t compressed_size =
+            compressor->Compress(sample_size, samples.data.data() + offset, &compressed_data, compressed_offset);
+
+        // Samples that do not compress to a smaller size are stored uncompressed by the capture layer.
+        if (compressed_size >= sample_size)
+        {
+            compressed_size = 0;
+        }
+
+        compressed_data.resize(compressed_offset + compressed_size);
+        compressed_sizes.push_back(compressed_size);
+        output_size += (compressed_size > 0) ? compressed_size : sample_size;
+        offset += sample_size;
+    }
+
+    int64_t compress_time = util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+
+    size_t compressed_offset = 0;
+    bool   success           = true;
+
+    start = util::datetime::GetTimestamp();
+
+    for (size_t i = 0; i < samples.sizes.size(); ++i)
+    {
+        if ((compressed_sizes[i] > 0) &&
+            (compressor->Decompress(compressed_sizes[i],
+                                    compressed_data.data() + compressed_offset,
+                                    samples.sizes[i],
+                                    &uncompressed_data) != samples.sizes[i]))
+        {
+            success = false;
+        }
+
+        compressed_offset += compressed_sizes[i];
+    }
+
+    int64_t decompress_time = util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+
+    std::string level = std::to_string(codec.level);
+
+    if (codec.capture_level)
+    {
+        level += "*";
+    }
+
+    GFXRECON_WRITE_CONSOLE("  %-13s %-9s %5s %10.1f %6.2f %17.1f %19.1f",
+                           GetSampleTypeName(sample_type),
+                           format::GetCompressionTypeName(codec.compression_type).c_str(),
+                           level.c_str(),
+                           static_cast<double>(samples.data.size()) / kBytesPerMiB,
+                           static_cast<double>(samples.data.size()) / output_size,
+                           GetThroughput(samples.data.size(), compress_time),
+                           GetThroughput(samples.data.size(), decompress_time));
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Decompressed %s data does not match the size of the data that was compressed with %s",
+                           GetSampleTypeName(sample_type),
+                           format::GetCompressionTypeName(codec.compression_type).c_str());
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,70 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_CODEC_BENCHMARK_H
+#define GFXRECON_CODEC_BENCHMARK_H
+
+#include "bench_decoders.h"
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Compresses and decompresses the block data samples of each block type with each compression format that is enabled
+// for the build, at several compression levels.  Each sample is compressed separately, as the capture layer compresses
+// each block of the file.
+class CodecBenchmark
+{
+  public:
+    CodecBenchmark(const BlockSampleDecoder* sample_decoder);
+
+    ~CodecBenchmark();
+
+    void Run();
+
+  private:
+    struct Codec
+    {
+        format::CompressionType compression_type;
+        int                     level;         // Acceleration factor for LZ4, where higher values compress faster.
+        bool                    capture_level; // The level used by the capture layer.
+    };
+
+  private:
+    static std::vector<Codec> GetCodecs();
+
+    // Returns nullptr if the compression type is not enabled for the build.
+    static util::Compressor* CreateCompressor(const Codec& codec);
+
+    void RunCodec(BlockSampleDecoder::SampleType sample_type, const Codec& codec);
+
+  private:
+    const BlockSampleDecoder* sample_decoder_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_CODEC_BENCHMARK_H
@@ -0,0 +1,527 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "project_version.h"
+#include "bench_decoders.h"
+#include "codec_benchmark.h"
+#include "page_guard_benchmark.h"
+#include "vulkan_reencode_consumer.h"
+#include "workload_benchmark.h"
+
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/argument_parser.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include "vulkan/vulkan_core.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+const char kHelpShortOption[] = "-h";
+const char kHelpLongOption[]  = "--help";
+const char kVersionOption[]   = "--version";
+const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kPageGuardOption[] = "--page-guard";
+const char kWorkloadOption[]  = "--workload";
+
+const char kSampleSizeArgument[]        = "--sample-size";
+const char kThreadsArgument[]           = "--threads";
+const char kIterationsArgument[]        = "--iterations";
+const char kFramesArgument[]            = "--frames";
+const char kDrawsArgument[]             = "--draws";
+const char kDescriptorUpdatesArgument[] = "--descriptor-updates";
+const char kChurnArgument[]             = "--churn";
+const char kWriteSizeArgument[]         = "--write-size";
+const char kWritePatternArgument[]      = "--write-pattern";
+const char kReportArgument[]            = "--report";
+
+const char kOptions[] = "-h|--help,--version,--no-debug-popup,--page-guard,--workload";
+const char kArguments[] =
+    "--sample-size,--threads,--iterations,--frames,--draws,--descriptor-updates,--churn,--write-size,--write-pattern,"
+    "--report";
+
+const size_t   kDefaultSampleSize     = 64;
+const uint32_t kDefaultMaxThreadCount = 4;
+const uint32_t kDefaultIterationCount = 3;
+const double kBytesPerMiB       = 1024.0 * 1024.0;
+
+// Measurements of a pass over the capture file, for the report file.
+struct PassResult
+{
+    const char* name;
+    int64_t     time;
+    uint64_t    data_size;
+    uint64_t    call_count;
+};
+
+static void PrintUsage(const char* exe_name)
+{
+    gfxrecon::WorkloadBenchmark::Workload workload;
+    std::string                           app_name = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - Measure the processing throughput of GFXReconstruct capture files.\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--sample-size <MiB>] [--report <file>] <file>",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] --page-guard [--threads <N>] [--iterations <N>]",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] --workload [--threads <N>] [--frames <N>] [--draws <N>]",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t[--descriptor-updates <N>] [--churn <N>] [--write-size <MiB>]");
+    GFXRECON_WRITE_CONSOLE("\t\t[--write-pattern <pattern>]\n");
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --sample-size <MiB>\tThe amount of data from the file, for each block type, that is");
+    GFXRECON_WRITE_CONSOLE("        \t\tcompressed and decompressed with each supported compression");
+    GFXRECON_WRITE_CONSOLE("        \t\tformat and level (default: %" PRIuPTR ").", kDefaultSampleSize);
+    GFXRECON_WRITE_CONSOLE("  --report <file>\tWrite the time, data size, and API call count of the read,");
+    GFXRECON_WRITE_CONSOLE("        \t\tdecode, and encode passes over the capture file to the");
+    GFXRECON_WRITE_CONSOLE("        \t\tspecified file as JSON.");
+    GFXRECON_WRITE_CONSOLE("  --page-guard\t\tMeasure the page guard memory tracking of the capture layer,");
+    GFXRECON_WRITE_CONSOLE("        \t\tinstead of processing a capture file, for combinations of");
+    GFXRECON_WRITE_CONSOLE("        \t\tallocation size and count, thread count, write pattern, and");
+    GFXRECON_WRITE_CONSOLE("        \t\tshadow memory mode.");
+    GFXRECON_WRITE_CONSOLE("  --workload\t\tMeasure the frame time of a synthetic Vulkan workload without");
+    GFXRECON_WRITE_CONSOLE("        \t\tthe capture layer, and with the capture layer for combinations");
+    GFXRECON_WRITE_CONSOLE("        \t\tof capture settings, instead of processing a capture file.");
+    GFXRECON_WRITE_CONSOLE("  --threads <N>\t\tThe number of threads that write to the tracked memory in the");
+    GFXRECON_WRITE_CONSOLE("        \t\tmulti-threaded page guard measurements, or that record command");
+    GFXRECON_WRITE_CONSOLE("        \t\tbuffers in the workload (default: %u).", kDefaultMaxThreadCount);
+    GFXRECON_WRITE_CONSOLE("  --iterations <N>\tThe number of times that the tracked memory is written and");
+    GFXRECON_WRITE_CONSOLE("        \t\tprocessed in each page guard measurement (default: %u).",
+                           kDefaultIterationCount);
+    GFXRECON_WRITE_CONSOLE("  --frames <N>\t\tThe number of workload frames that are measured for each");
+    GFXRECON_WRITE_CONSOLE("        \t\tconfiguration (default: %u).", workload.frame_count);
+    GFXRECON_WRITE_CONSOLE("  --draws <N>\t\tThe number of draws recorded by each thread per workload frame");
+    GFXRECON_WRITE_CONSOLE("        \t\t(default: %u).", workload.draw_count);
+    GFXRECON_WRITE_CONSOLE("  --descriptor-updates <N>");
+    GFXRECON_WRITE_CONSOLE("        \t\tThe number of descriptor sets updated per workload frame");
+    GFXRECON_WRITE_CONSOLE("        \t\t(default: %u).", workload.descriptor_update_count);
+    GFXRECON_WRITE_CONSOLE("  --churn <N>\t\tThe number of buffers created and destroyed per workload frame");
+    GFXRECON_WRITE_CONSOLE("        \t\t(default: %u).", workload.churn_count);
+    GFXRECON_WRITE_CONSOLE("  --write-size <MiB>\tThe size of the mapped memory written per workload frame");
+    GFXRECON_WRITE_CONSOLE("        \t\t(default: %" PRIuPTR ").", workload.write_size / (1024 * 1024));
+    GFXRECON_WRITE_CONSOLE("  --write-pattern <pattern>");
+    GFXRECON_WRITE_CONSOLE("        \t\tThe pattern of the mapped memory writes, which is sequential,");
+    GFXRECON_WRITE_CONSOLE("        \t\tfor writes that fill each page, strided, for one write to every");
+    GFXRECON_WRITE_CONSOLE("        \t\tfourth page, or random, for one write to every page in random");
+    GFXRECON_WRITE_CONSOLE("        \t\torder (default: sequential).");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static gfxrecon::format::CompressionType
+GetCompressionType(const std::vector<gfxrecon::format::FileOptionPair>& file_options)
+{
+    gfxrecon::format::CompressionType compression_type = gfxrecon::format::CompressionType::kNone;
+
+    for (const auto& option : file_options)
+    {
+        if (option.key == gfxrecon::format::FileOption::kCompressionType)
+        {
+            compression_type = static_cast<gfxrecon::format::CompressionType>(option.value);
+        }
+    }
+
+    return compression_type;
+}
+
+static void PrintThroughput(const char* label, uint64_t size, int64_t time)
+{
+    double seconds = gfxrecon::util::datetime::ConvertTimestampToSeconds(time);
+    double mib     = static_cast<double>(size) / kBytesPerMiB;
+
+    GFXRECON_WRITE_CONSOLE("  %s: %.1f MiB in %.3f s (%.1f MiB/s)",
+                           label,
+                           mib,
+                           seconds,
+                           (seconds > 0.0) ? (mib / seconds) : 0.0);
+}
+
+static void PrintCallRate(uint64_t call_count, int64_t time)
+{
+    double seconds = gfxrecon::util::datetime::ConvertTimestampToSeconds(time);
+
+    GFXRECON_WRITE_CONSOLE("  API calls: %" PRIu64 " (%.0f calls/s)",
+                           call_count,
+                           (seconds > 0.0) ? (static_cast<double>(call_count) / seconds) : 0.0);
+}
+
+static bool WriteReport(const std::string& filename, const std::vector<PassResult>& results)
+{
+    FILE*   file   = nullptr;
+    int32_t result = gfxrecon::util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open report file %s", filename.c_str());
+        return false;
+    }
+
+    bool success = (fprintf(file, "{\n  \"passes\": {") >= 0);
+
+    for (size_t i = 0; success && (i < results.size()); ++i)
+    {
+        const PassResult& pass    = results[i];
+        double            seconds = gfxrecon::util::datetime::ConvertTimestampToSeconds(pass.time);
+        double            mib     = static_cast<double>(pass.data_size) / kBytesPerMiB;
+
+        success = (fprintf(file,
+                           "%s\n    \"%s\": { \"seconds\": %.6f, \"data_mib\": %.6f, \"mib_per_second\": %.6f, "
+                           "\"call_count\": %" PRIu64 ", \"calls_per_second\": %.6f }",
+                           (i > 0) ? "," : "",
+                           pass.name,
+                           seconds,
+                           mib,
+                           (seconds > 0.0) ? (mib / seconds) : 0.0,
+                           pass.call_count,
+                           (seconds > 0.0) ? (static_cast<double>(pass.call_count) / seconds) : 0.0) >= 0);
+    }
+
+    success = success && (fprintf(file, "\n  }\n}\n") >= 0);
+
+    gfxrecon::util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write report file %s", filename.c_str());
+    }
+
+    return success;
+}
+
+// Processes the file with the specified decoder, setting time to the processing time in nanoseconds.
+static bool ProcessFile(const std::string&               filename,
+                        gfxrecon::decode::ApiDecoder*    decoder,
+                        gfxrecon::decode::FileProcessor* file_processor,
+                        int64_t*                         time)
+{
+    if (!file_processor->Initialize(filename))
+    {
+        return false;
+    }
+
+    file_processor->AddDecoder(decoder);
+
+    int64_t start = gfxrecon::util::datetime::GetTimestamp();
+    file_processor->ProcessAllFrames();
+    *time = gfxrecon::util::datetime::DiffTimestamps(start, gfxrecon::util::datetime::GetTimestamp());
+
+    if (file_processor->GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+        return false;
+    }
+
+    return true;
+}
+
+// Reads the blocks of the file without decoding them.  Compressed blocks are decompressed, with the compression format
+// that the file was written with.
+static bool BenchmarkRead(const std::string&            filename,
+                          gfxrecon::BlockSampleDecoder* sample_decoder,
+                          std::vector<PassResult>*      results)
+{
+    gfxrecon::decode::FileProcessor file_processor;
+    int64_t                         time = 0;
+
+    if (!ProcessFile(filename, sample_decoder, &file_processor, &time))
+    {
+        return false;
+    }
+
+    auto compression_type = GetCompressionType(file_processor.GetFileOptions());
+
+    GFXRECON_WRITE_CONSOLE("Read (compression format %s):",
+                           gfxrecon::format::GetCompressionTypeName(compression_type).c_str());
+    PrintThroughput("File data", file_processor.GetNumBytesRead(), time);
+    PrintThroughput("API call data", sample_decoder->GetCallDataSize(), time);
+    PrintCallRate(sample_decoder->GetCallCount(), time);
+
+    results->push_back({ "read", time, file_processor.GetNumBytesRead(), sample_decoder->GetCallCount() });
+
+    return true;
+}
+
+// Decodes the API calls of the file, passing them to a consumer that does nothing.
+static bool BenchmarkDecode(const std::string& filename, std::vector<PassResult>* results)
+{
+    gfxrecon::decode::FileProcessor  file_processor;
+    gfxrecon::TimedVulkanDecoder     decoder;
+    gfxrecon::decode::VulkanConsumer null_consumer;
+    int64_t                          time = 0;
+
+    decoder.AddConsumer(&null_consumer);
+
+    if (!ProcessFile(filename, &decoder, &file_processor, &time))
+    {
+        return false;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Decode:");
+    PrintThroughput("API call data", decoder.GetCallDataSize(), decoder.GetDecodeTime());
+    PrintCallRate(decoder.GetCallCount(), decoder.GetDecodeTime());
+    PrintThroughput("Read and decode", file_processor.GetNumBytesRead(), time);
+
+    results->push_back({ "decode", decoder.GetDecodeTime(), decoder.GetCallDataSize(), decoder.GetCallCount() });
+    results->push_back({ "read_and_decode", time, file_processor.GetNumBytesRead(), decoder.GetCallCount() });
+
+    return true;
+}
+
+// Decodes the API calls of the file, and encodes the parameters of the calls again.
+static bool BenchmarkEncode(const std::string& filename, std::vector<PassResult>* results)
+{
+    gfxrecon::decode::FileProcessor  file_processor;
+    gfxrecon::decode::VulkanDecoder  decoder;
+    gfxrecon::VulkanReencodeConsumer reencode_consumer;
+    int64_t                          time = 0;
+
+    decoder.AddConsumer(&reencode_consumer);
+
+    if (!ProcessFile(filename, &decoder, &file_processor, &time))
+    {
+        return false;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Encode:");
+    PrintThroughput("Encoded data", reencode_consumer.GetEncodedSize(), reencode_consumer.GetEncodeTime());
+    PrintCallRate(reencode_consumer.GetCallCount(), reencode_consumer.GetEncodeTime());
+
+    results->push_back({ "encode",
+                         reencode_consumer.GetEncodeTime(),
+                         reencode_consumer.GetEncodedSize(),
+                         reencode_consumer.GetCallCount() });
+
+    return true;
+}
+
+// The stages are measured with separate passes over the file, so that the time of each stage can be compared between
+// versions without the cost of the other stages.  When a report file is specified, the measurements of the read,
+// decode, and encode passes are also written to it.
+static bool BenchmarkFile(const std::string& filename, size_t sample_size, const std::string& report_filename)
+{
+    gfxrecon::BlockSampleDecoder sample_decoder(sample_size * 1024 * 1024);
+    std::vector<PassResult>      results;
+
+    if (!BenchmarkRead(filename, &sample_decoder, &results))
+    {
+        return false;
+    }
+
+    gfxrecon::CodecBenchmark codec_benchmark(&sample_decoder);
+    codec_benchmark.Run();
+
+    if (!BenchmarkDecode(filename, &results) || !BenchmarkEncode(filename, &results))
+    {
+        return false;
+    }
+
+    return report_filename.empty() || WriteReport(report_filename, results);
+}
+
+static void BenchmarkPageGuard(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t           thread_count    = kDefaultMaxThreadCount;
+    uint32_t           iteration_count = kDefaultIterationCount;
+    const std::string& thread_value    = arg_parser.GetArgumentValue(kThreadsArgument);
+    const std::string& iteration_value = arg_parser.GetArgumentValue(kIterationsArgument);
+
+    if (!thread_value.empty())
+    {
+        thread_count = static_cast<uint32_t>(std::strtoul(thread_value.c_str(), nullptr, 10));
+    }
+
+    if (!iteration_value.empty())
+    {
+        iteration_count = static_cast<uint32_t>(std::strtoul(iteration_value.c_str(), nullptr, 10));
+    }
+
+    gfxrecon::PageGuardBenchmark page_guard_benchmark(std::max(thread_count, 1u), std::max(iteration_count, 1u));
+    page_guard_benchmark.Run();
+}
+
+static void ParseCount(const gfxrecon::util::ArgumentParser& arg_parser, const char* argument, uint32_t* count)
+{
+    const std::string& value = arg_parser.GetArgumentValue(argument);
+
+    if (!value.empty())
+    {
+        *count = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+    }
+}
+
+static bool BenchmarkWorkload(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    gfxrecon::WorkloadBenchmark::Workload workload;
+    const std::string&                    write_size_value    = arg_parser.GetArgumentValue(kWriteSizeArgument);
+    const std::string&                    write_pattern_value = arg_parser.GetArgumentValue(kWritePatternArgument);
+
+    workload.thread_count = kDefaultMaxThreadCount;
+
+    ParseCount(arg_parser, kThreadsArgument, &workload.thread_count);
+    ParseCount(arg_parser, kFramesArgument, &workload.frame_count);
+    ParseCount(arg_parser, kDrawsArgument, &workload.draw_count);
+    ParseCount(arg_parser, kDescriptorUpdatesArgument, &workload.descriptor_update_count);
+    ParseCount(arg_parser, kChurnArgument, &workload.churn_count);
+
+    if (!write_size_value.empty())
+    {
+        workload.write_size = static_cast<size_t>(std::strtoull(write_size_value.c_str(), nullptr, 10)) * 1024 * 1024;
+    }
+
+    if (!write_pattern_value.empty() &&
+        !gfxrecon::WorkloadBenchmark::ParseWritePattern(write_pattern_value, &workload.write_pattern))
+    {
+        GFXRECON_LOG_ERROR("Unrecognized write pattern %s", write_pattern_value.c_str());
+        return false;
+    }
+
+    workload.thread_count = std::max(workload.thread_count, 1u);
+    workload.frame_count  = std::max(workload.frame_count, 1u);
+
+    gfxrecon::WorkloadBenchmark workload_benchmark(workload);
+    workload_benchmark.Run();
+
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    int return_code = 0;
+
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() ||
+             (arg_parser.GetPositionalArgumentsCount() !=
+              ((arg_parser.IsOptionSet(kPageGuardOption) || arg_parser.IsOptionSet(kWorkloadOption)) ? 0 : 1)))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    if (arg_parser.IsOptionSet(kPageGuardOption))
+    {
+        BenchmarkPageGuard(arg_parser);
+    }
+    else if (arg_parser.IsOptionSet(kWorkloadOption))
+    {
+        if (!BenchmarkWorkload(arg_parser))
+        {
+            return_code = -1;
+        }
+    }
+    else
+    {
+        size_t             sample_size  = kDefaultSampleSize;
+        const std::string& sample_value = arg_parser.GetArgumentValue(kSampleSizeArgument);
+
+        if (!sample_value.empty())
+        {
+            sample_size = static_cast<size_t>(std::strtoull(sample_value.c_str(), nullptr, 10));
+        }
+
+        const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
+
+        if (!BenchmarkFile(positional_arguments[0], sample_size, arg_parser.GetArgumentValue(kReportArgument)))
+        {
+            return_code = -1;
+        }
+    }
+
+    gfxrecon::util::Log::Release();
+
+    return return_code;
+}
@@ -0,0 +1,322 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "page_guard_benchmark.h"
+
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+const size_t   kAllocationSizes[]  = { 64 * 1024, 1024 * 1024, 16 * 1024 * 1024 };
+const size_t   kAllocationCounts[] = { 1, 16, 256 };
+const size_t   kMaxTotalSize       = 256 * 1024 * 1024; // Combinations of size and count above this are skipped.
+const size_t   kStridePages        = 4;
+const uint32_t kRandomSeed         = 1;
+
+// Write watch is only supported on Windows, where the capture layer uses it for external memory.
+#if defined(WIN32)
+const bool kUseWriteWatch = true;
+#else
+const bool kUseWriteWatch = false;
+#endif
+
+static const char* GetMemoryModeName(PageGuardBenchmark::MemoryMode mode)
+{
+    switch (mode)
+    {
+        case PageGuardBenchmark::kMemoryModeShadowInternal:
+            return "shadow-internal";
+        case PageGuardBenchmark::kMemoryModeShadowPersistent:
+            return "shadow-persistent";
+        case PageGuardBenchmark::kMemoryModeExternal:
+            return "external";
+        default:
+            break;
+    }
+
+    return "unknown";
+}
+
+static const char* GetWritePatternName(PageGuardBenchmark::WritePattern pattern)
+{
+    switch (pattern)
+    {
+        case PageGuardBenchmark::kWritePatternSequential:
+            return "sequential";
+        case PageGuardBenchmark::kWritePatternStrided:
+            return "strided";
+        case PageGuardBenchmark::kWritePatternRandom:
+            return "random";
+        default:
+            break;
+    }
+
+    return "unknown";
+}
+
+static std::string GetSizeString(size_t size)
+{
+    if ((size % (1024 * 1024)) == 0)
+    {
+        return std::to_string(size / (1024 * 1024)) + " MiB";
+    }
+
+    return std::to_string(size / 1024) + " KiB";
+}
+
+PageGuardBenchmark::PageGuardBenchmark(uint32_t max_thread_count, uint32_t iteration_count) :
+    manager_(nullptr), page_size_(0), max_thread_count_(max_thread_count), iteration_count_(iteration_count)
+{
+    util::PageGuardManager::Create(util::PageGuardManager::kDefaultEnableCopyOnMap,
+                                   util::PageGuardManager::kDefaultEnableSeparateRead,
+                                   util::PageGuardManager::kDefaultEnableReadWriteSamePage);
+
+    manager_   = util::PageGuardManager::Get();
+    page_size_ = manager_->GetAlignedSize(1);
+}
+
+PageGuardBenchmark::~PageGuardBenchmark()
+{
+    util::PageGuardManager::Destroy();
+}
+
+void PageGuardBenchmark::Run()
+{
+    const MemoryMode   modes[]    = { kMemoryModeShadowInternal, kMemoryModeShadowPersistent, kMemoryModeExternal };
+    const WritePattern patterns[] = { kWritePatternSequential, kWritePatternStrided, kWritePatternRandom };
+
+    std::vector<uint32_t> thread_counts = { 1 };
+
+    if (max_thread_count_ > 1)
+    {
+        thread_counts.push_back(max_thread_count_);
+    }
+
+    GFXRECON_WRITE_CONSOLE("Page guard (%u iterations, page size %" PRIuPTR "):", iteration_count_, page_size_);
+    GFXRECON_WRITE_CONSOLE("  %-17s %-10s %8s %5s %7s %10s %15s %12s %11s",
+                           "Memory mode",
+                           "Pattern",
+                           "Size",
+                           "Count",
+                           "Threads",
+                           "Add (us)",
+                           "Write (ns/page)",
+                           "Process (ms)",
+                           "Remove (us)");
+
+    for (auto mode : modes)
+    {
+        for (auto pattern : patterns)
+        {
+            for (auto allocation_size : kAllocationSizes)
+            {
+                for (auto allocation_count : kAllocationCounts)
+                {
+                    if ((allocation_size * allocation_count) <= kMaxTotalSize)
+                    {
+                        for (auto thread_count : thread_counts)
+                        {
+                            RunConfiguration(mode, pattern, allocation_size, allocation_count, thread_count);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PageGuardBenchmark::RunConfiguration(
+    MemoryMode mode, WritePattern pattern, size_t allocation_size, size_t allocation_count, uint32_t thread_count)
+{
+    size_t                  aligned_size      = manager_->GetAlignedSize(allocation_size);
+    bool                    use_shadow_memory = (mode != kMemoryModeExternal);
+    bool                    use_write_watch   = (mode == kMemoryModeExternal) && kUseWriteWatch;
+    std::vector<Allocation> allocations(allocation_count);
+
+    for (auto& allocation : allocations)
+    {
+        allocation.mapped_memory = manager_->AllocateMemory(aligned_size, use_write_watch);
+
+        if (allocation.mapped_memory == nullptr)
+        {
+            for (const auto& allocated : allocations)
+            {
+                if (allocated.mapped_memory != nullptr)
+                {
+                    manager_->FreeMemory(allocated.mapped_memory, aligned_size);
+                }
+            }
+
+            return;
+        }
+    }
+
+    // Persistent shadow memory is allocated when the memory is first mapped, as the capture layer does.
+    int64_t start = util::datetime::GetTimestamp();
+
+    for (size_t i = 0; i < allocations.size(); ++i)
+    {
+        auto& allocation = allocations[i];
+
+        if (mode == kMemoryModeShadowPersistent)
+        {
+            allocation.shadow_memory_handle = manager_->AllocatePersistentShadowMemory(allocation_size);
+        }
+
+        allocation.tracked_memory = manager_->AddTrackedMemory(i,
+                                                               allocation.mapped_memory,
+                                                               0,
+                                                               allocation_size,
+                                                               allocation.shadow_memory_handle,
+                                                               use_shadow_memory,
+                                                               use_write_watch);
+    }
+
+    int64_t add_time = util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+
+    std::vector<size_t> page_offsets = GetPageOffsets(pattern, allocation_size);
+    size_t              write_size   = (pattern == kWritePatternSequential) ? page_size_ : sizeof(uint32_t);
+    int64_t             write_time   = 0;
+    int64_t             process_time = 0;
+
+    for (uint32_t iteration = 0; iteration < iteration_count_; ++iteration)
+    {
+        // The write time includes the creation of the writer threads, which is small compared to the fault handling.
+        start = util::datetime::GetTimestamp();
+
+        if (thread_count == 1)
+        {
+            WritePages(allocations, page_offsets, write_size, 0, 1);
+        }
+        else
+        {
+            std::vector<std::thread> threads;
+
+            for (uint32_t i = 0; i < thread_count; ++i)
+            {
+                threads.emplace_back(&PageGuardBenchmark::WritePages,
+                                     this,
+                                     std::cref(allocations),
+                                     std::cref(page_offsets),
+                                     write_size,
+                                     i,
+                                     thread_count);
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        write_time += util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+
+        start = util::datetime::GetTimestamp();
+        manager_->ProcessMemoryEntries([](uint64_t, void*, size_t, size_t) {});
+        process_time += util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+    }
+
+    start = util::datetime::GetTimestamp();
+
+    for (size_t i = 0; i < allocations.size(); ++i)
+    {
+        manager_->RemoveTrackedMemory(i);
+
+        if (allocations[i].shadow_memory_handle != util::PageGuardManager::kNullShadowHandle)
+        {
+            manager_->FreePersistentShadowMemory(allocations[i].shadow_memory_handle);
+        }
+    }
+
+    int64_t remove_time = util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+
+    for (const auto& allocation : allocations)
+    {
+        manager_->FreeMemory(allocation.mapped_memory, aligned_size);
+    }
+
+    double page_writes = static_cast<double>(iteration_count_) * allocation_count * page_offsets.size();
+
+    GFXRECON_WRITE_CONSOLE("  %-17s %-10s %8s %5" PRIuPTR " %7u %10.1f %15.1f %12.3f %11.1f",
+                           GetMemoryModeName(mode),
+                           GetWritePatternName(pattern),
+                           GetSizeString(allocation_size).c_str(),
+                           allocation_count,
+                           thread_count,
+                           static_cast<double>(add_time) / allocation_count / 1000.0,
+                           (page_writes > 0.0) ? (static_cast<double>(write_time) / page_writes) : 0.0,
+                           util::datetime::ConvertTimestampToMilliseconds(process_time) / iteration_count_,
+                           static_cast<double>(remove_time) / allocation_count / 1000.0);
+}
+
+std::vector<size_t> PageGuardBenchmark::GetPageOffsets(WritePattern pattern, size_t allocation_size) const
+{
+    std::vector<size_t> page_offsets;
+    size_t              page_count = (allocation_size + page_size_ - 1) / page_size_;
+    size_t              page_step  = (pattern == kWritePatternStrided) ? kStridePages : 1;
+
+    for (size_t i = 0; i < page_count; i += page_step)
+    {
+        page_offsets.push_back(i * page_size_);
+    }
+
+    if (pattern == kWritePatternRandom)
+    {
+        // A fixed seed writes the pages in the same order for every run.
+        std::mt19937 random_engine(kRandomSeed);
+        std::shuffle(page_offsets.begin(), page_offsets.end(), random_engine);
+    }
+
+    return page_offsets;
+}
+
+void PageGuardBenchmark::WritePages(const std::vector<Allocation>& allocations,
+                                    const std::vector<size_t>&     page_offsets,
+                                    size_t                         write_size,
+                                    uint32_t                       thread_index,
+                                    uint32_t                       thread_count)
+{
+    // Each thread writes a contiguous range of the page offsets in each allocation.
+    size_t begin = (page_offsets.size() * thread_index) / thread_count;
+    size_t end   = (page_offsets.size() * (thread_index + 1)) / thread_count;
+
+    for (const auto& allocation : allocations)
+    {
+        uint8_t* memory = static_cast<uint8_t*>(allocation.tracked_memory);
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            memset(memory + page_offsets[i], static_cast<int>(i), write_size);
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,92 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_PAGE_GUARD_BENCHMARK_H
+#define GFXRECON_PAGE_GUARD_BENCHMARK_H
+
+#include "util/defines.h"
+#include "util/page_guard_manager.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Measures the cost of tracking mapped memory with the page guard manager, for combinations of allocation size,
+// allocation count, writer thread count, write pattern, and the shadow memory modes used by the capture layer.  Each
+// combination adds the allocations for tracking, then repeats the writes and the processing of the modified pages for
+// the specified number of iterations before removing the allocations from tracking.
+class PageGuardBenchmark
+{
+  public:
+    enum MemoryMode
+    {
+        kMemoryModeShadowInternal,   // Shadow memory allocated by the page guard manager.
+        kMemoryModeShadowPersistent, // Shadow memory allocated once, before the memory is added for tracking.
+        kMemoryModeExternal          // Memory tracked directly, without shadow memory.
+    };
+
+    enum WritePattern
+    {
+        kWritePatternSequential, // Every page is written completely, in address order.
+        kWritePatternStrided,    // One value is written to every kStridePages page, in address order.
+        kWritePatternRandom      // One value is written to every page, in random order.
+    };
+
+  public:
+    PageGuardBenchmark(uint32_t max_thread_count, uint32_t iteration_count);
+
+    ~PageGuardBenchmark();
+
+    void Run();
+
+  private:
+    struct Allocation
+    {
+        void*     mapped_memory{ nullptr };
+        void*     tracked_memory{ nullptr };
+        uintptr_t shadow_memory_handle{ util::PageGuardManager::kNullShadowHandle };
+    };
+
+    void RunConfiguration(
+        MemoryMode mode, WritePattern pattern, size_t allocation_size, size_t allocation_count, uint32_t thread_count);
+
+    // Returns the offsets of the pages to write, in the order that they are written.
+    std::vector<size_t> GetPageOffsets(WritePattern pattern, size_t allocation_size) const;
+
+    void WritePages(const std::vector<Allocation>& allocations,
+                    const std::vector<size_t>&     page_offsets,
+                    size_t                         write_size,
+                    uint32_t                       thread_index,
+                    uint32_t                       thread_count);
+
+  private:
+    util::PageGuardManager* manager_;
+    size_t                  page_size_;
+    uint32_t                max_thread_count_;
+    uint32_t                iteration_count_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_PAGE_GUARD_BENCHMARK_H
@@ -0,0 +1,333 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "vulkan_reencode_consumer.h"
+
+#include "encode/struct_pointer_encoder.h"
+#include "util/date_time.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+VulkanReencodeConsumer::VulkanReencodeConsumer() :
+    encoder_(&parameter_buffer_), call_count_(0), encoded_size_(0), encode_time_(0)
+{}
+
+VulkanReencodeConsumer::~VulkanReencodeConsumer() {}
+
+int64_t VulkanReencodeConsumer::BeginCall()
+{
+    parameter_buffer_.Reset();
+    return util::datetime::GetTimestamp();
+}
+
+void VulkanReencodeConsumer::EndCall(int64_t start)
+{
+    encode_time_ += util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp());
+    encoded_size_ += parameter_buffer_.GetDataSize();
+    ++call_count_;
+}
+
+void VulkanReencodeConsumer::Process_vkAllocateMemory(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkMemoryAllocateInfo>*  pAllocateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkDeviceMemory>*                        pMemory)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pAllocateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pMemory->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkQueueSubmit(
+    VkResult                                                    returnValue,
+    format::HandleId                                            queue,
+    uint32_t                                                    submitCount,
+    decode::StructPointerDecoder<decode::Decoded_VkSubmitInfo>* pSubmits,
+    format::HandleId                                            fence)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(queue);
+    encoder_.EncodeUInt32Value(submitCount);
+    encode::EncodeStructArray(&encoder_, pSubmits->GetPointer(), submitCount);
+    encoder_.EncodeHandleIdValue(fence);
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateBuffer(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkBufferCreateInfo>*    pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkBuffer>*                              pBuffer)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pBuffer->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateImage(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkImageCreateInfo>*     pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkImage>*                               pImage)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pImage->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateImageView(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkImageViewCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkImageView>*                           pView)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pView->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateShaderModule(
+    VkResult                                                                returnValue,
+    format::HandleId                                                        device,
+    decode::StructPointerDecoder<decode::Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*    pAllocator,
+    decode::HandlePointerDecoder<VkShaderModule>*                           pShaderModule)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pShaderModule->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateGraphicsPipelines(
+    VkResult                                                                    returnValue,
+    format::HandleId                                                            device,
+    format::HandleId                                                            pipelineCache,
+    uint32_t                                                                    createInfoCount,
+    decode::StructPointerDecoder<decode::Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*        pAllocator,
+    decode::HandlePointerDecoder<VkPipeline>*                                   pPipelines)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encoder_.EncodeHandleIdValue(pipelineCache);
+    encoder_.EncodeUInt32Value(createInfoCount);
+    encode::EncodeStructArray(&encoder_, pCreateInfos->GetPointer(), createInfoCount);
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdArray(pPipelines->GetPointer(), createInfoCount);
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateComputePipelines(
+    VkResult                                                                   returnValue,
+    format::HandleId                                                           device,
+    format::HandleId                                                           pipelineCache,
+    uint32_t                                                                   createInfoCount,
+    decode::StructPointerDecoder<decode::Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*       pAllocator,
+    decode::HandlePointerDecoder<VkPipeline>*                                  pPipelines)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encoder_.EncodeHandleIdValue(pipelineCache);
+    encoder_.EncodeUInt32Value(createInfoCount);
+    encode::EncodeStructArray(&encoder_, pCreateInfos->GetPointer(), createInfoCount);
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdArray(pPipelines->GetPointer(), createInfoCount);
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateSampler(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkSamplerCreateInfo>*   pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkSampler>*                             pSampler)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pSampler->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateDescriptorSetLayout(
+    VkResult                                                                       returnValue,
+    format::HandleId                                                               device,
+    decode::StructPointerDecoder<decode::Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*           pAllocator,
+    decode::HandlePointerDecoder<VkDescriptorSetLayout>*                           pSetLayout)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pSetLayout->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkUpdateDescriptorSets(
+    format::HandleId                                                    device,
+    uint32_t                                                            descriptorWriteCount,
+    decode::StructPointerDecoder<decode::Decoded_VkWriteDescriptorSet>* pDescriptorWrites,
+    uint32_t                                                            descriptorCopyCount,
+    decode::StructPointerDecoder<decode::Decoded_VkCopyDescriptorSet>*  pDescriptorCopies)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encoder_.EncodeUInt32Value(descriptorWriteCount);
+    encode::EncodeStructArray(&encoder_, pDescriptorWrites->GetPointer(), descriptorWriteCount);
+    encoder_.EncodeUInt32Value(descriptorCopyCount);
+    encode::EncodeStructArray(&encoder_, pDescriptorCopies->GetPointer(), descriptorCopyCount);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateFramebuffer(
+    VkResult                                                               returnValue,
+    format::HandleId                                                       device,
+    decode::StructPointerDecoder<decode::Decoded_VkFramebufferCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*   pAllocator,
+    decode::HandlePointerDecoder<VkFramebuffer>*                           pFramebuffer)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pFramebuffer->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCreateRenderPass(
+    VkResult                                                              returnValue,
+    format::HandleId                                                      device,
+    decode::StructPointerDecoder<decode::Decoded_VkRenderPassCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*  pAllocator,
+    decode::HandlePointerDecoder<VkRenderPass>*                           pRenderPass)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(device);
+    encode::EncodeStructPtr(&encoder_, pCreateInfo->GetPointer());
+    encode::EncodeStructPtr(&encoder_, pAllocator->GetPointer());
+    encoder_.EncodeHandleIdPtr(pRenderPass->GetPointer());
+    encoder_.EncodeEnumValue(returnValue);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCmdPipelineBarrier(
+    format::HandleId                                                     commandBuffer,
+    VkPipelineStageFlags                                                 srcStageMask,
+    VkPipelineStageFlags                                                 dstStageMask,
+    VkDependencyFlags                                                    dependencyFlags,
+    uint32_t                                                             memoryBarrierCount,
+    decode::StructPointerDecoder<decode::Decoded_VkMemoryBarrier>*       pMemoryBarriers,
+    uint32_t                                                             bufferMemoryBarrierCount,
+    decode::StructPointerDecoder<decode::Decoded_VkBufferMemoryBarrier>* pBufferMemoryBarriers,
+    uint32_t                                                             imageMemoryBarrierCount,
+    decode::StructPointerDecoder<decode::Decoded_VkImageMemoryBarrier>*  pImageMemoryBarriers)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(commandBuffer);
+    encoder_.EncodeFlagsValue(srcStageMask);
+    encoder_.EncodeFlagsValue(dstStageMask);
+    encoder_.EncodeFlagsValue(dependencyFlags);
+    encoder_.EncodeUInt32Value(memoryBarrierCount);
+    encode::EncodeStructArray(&encoder_, pMemoryBarriers->GetPointer(), memoryBarrierCount);
+    encoder_.EncodeUInt32Value(bufferMemoryBarrierCount);
+    encode::EncodeStructArray(&encoder_, pBufferMemoryBarriers->GetPointer(), bufferMemoryBarrierCount);
+    encoder_.EncodeUInt32Value(imageMemoryBarrierCount);
+    encode::EncodeStructArray(&encoder_, pImageMemoryBarriers->GetPointer(), imageMemoryBarrierCount);
+
+    EndCall(start);
+}
+
+void VulkanReencodeConsumer::Process_vkCmdBeginRenderPass(
+    format::HandleId                                                     commandBuffer,
+    decode::StructPointerDecoder<decode::Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+    VkSubpassContents                                                    contents)
+{
+    int64_t start = BeginCall();
+
+    encoder_.EncodeHandleIdValue(commandBuffer);
+    encode::EncodeStructPtr(&encoder_, pRenderPassBegin->GetPointer());
+    encoder_.EncodeEnumValue(contents);
+
+    EndCall(start);
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,182 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_VULKAN_REENCODE_CONSUMER_H
+#define GFXRECON_VULKAN_REENCODE_CONSUMER_H
+
+#include "encode/parameter_buffer.h"
+#include "encode/parameter_encoder.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Encodes the decoded parameters of API calls again, with the parameter encoder and struct encoders that are used by
+// the capture layer, measuring the time spent encoding.  Only the calls with the largest and most deeply nested
+// structures are encoded.  Handles in the structures have been decoded as null handles, so they are encoded as null
+// handle IDs, while the handle parameters of the calls are encoded with their captured IDs.
+class VulkanReencodeConsumer : public decode::VulkanConsumer
+{
+  public:
+    VulkanReencodeConsumer();
+
+    virtual ~VulkanReencodeConsumer() override;
+
+    uint64_t GetCallCount() const { return call_count_; }
+
+    uint64_t GetEncodedSize() const { return encoded_size_; }
+
+    // Returns the total encode time in nanoseconds.
+    int64_t GetEncodeTime() const { return encode_time_; }
+
+    virtual void Process_vkAllocateMemory(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkMemoryAllocateInfo>*  pAllocateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkDeviceMemory>*                        pMemory) override;
+
+    virtual void Process_vkQueueSubmit(
+        VkResult                                                    returnValue,
+        format::HandleId                                            queue,
+        uint32_t                                                    submitCount,
+        decode::StructPointerDecoder<decode::Decoded_VkSubmitInfo>* pSubmits,
+        format::HandleId                                            fence) override;
+
+    virtual void Process_vkCreateBuffer(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkBufferCreateInfo>*    pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkBuffer>*                              pBuffer) override;
+
+    virtual void Process_vkCreateImage(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkImageCreateInfo>*     pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkImage>*                               pImage) override;
+
+    virtual void Process_vkCreateImageView(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkImageViewCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkImageView>*                           pView) override;
+
+    virtual void Process_vkCreateShaderModule(
+        VkResult                                                                returnValue,
+        format::HandleId                                                        device,
+        decode::StructPointerDecoder<decode::Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*    pAllocator,
+        decode::HandlePointerDecoder<VkShaderModule>*                           pShaderModule) override;
+
+    virtual void Process_vkCreateGraphicsPipelines(
+        VkResult                                                                    returnValue,
+        format::HandleId                                                            device,
+        format::HandleId                                                            pipelineCache,
+        uint32_t                                                                    createInfoCount,
+        decode::StructPointerDecoder<decode::Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*        pAllocator,
+        decode::HandlePointerDecoder<VkPipeline>*                                   pPipelines) override;
+
+    virtual void Process_vkCreateComputePipelines(
+        VkResult                                                                   returnValue,
+        format::HandleId                                                           device,
+        format::HandleId                                                           pipelineCache,
+        uint32_t                                                                   createInfoCount,
+        decode::StructPointerDecoder<decode::Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*       pAllocator,
+        decode::HandlePointerDecoder<VkPipeline>*                                  pPipelines) override;
+
+    virtual void Process_vkCreateSampler(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkSamplerCreateInfo>*   pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkSampler>*                             pSampler) override;
+
+    virtual void Process_vkCreateDescriptorSetLayout(
+        VkResult                                                                       returnValue,
+        format::HandleId                                                               device,
+        decode::StructPointerDecoder<decode::Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*           pAllocator,
+        decode::HandlePointerDecoder<VkDescriptorSetLayout>*                           pSetLayout) override;
+
+    virtual void Process_vkUpdateDescriptorSets(
+        format::HandleId                                                    device,
+        uint32_t                                                            descriptorWriteCount,
+        decode::StructPointerDecoder<decode::Decoded_VkWriteDescriptorSet>* pDescriptorWrites,
+        uint32_t                                                            descriptorCopyCount,
+        decode::StructPointerDecoder<decode::Decoded_VkCopyDescriptorSet>*  pDescriptorCopies) override;
+
+    virtual void Process_vkCreateFramebuffer(
+        VkResult                                                               returnValue,
+        format::HandleId                                                       device,
+        decode::StructPointerDecoder<decode::Decoded_VkFramebufferCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*   pAllocator,
+        decode::HandlePointerDecoder<VkFramebuffer>*                           pFramebuffer) override;
+
+    virtual void Process_vkCreateRenderPass(
+        VkResult                                                              returnValue,
+        format::HandleId                                                      device,
+        decode::StructPointerDecoder<decode::Decoded_VkRenderPassCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*  pAllocator,
+        decode::HandlePointerDecoder<VkRenderPass>*                           pRenderPass) override;
+
+    virtual void Process_vkCmdPipelineBarrier(
+        format::HandleId                                                     commandBuffer,
+        VkPipelineStageFlags                                                 srcStageMask,
+        VkPipelineStageFlags                                                 dstStageMask,
+        VkDependencyFlags                                                    dependencyFlags,
+        uint32_t                                                             memoryBarrierCount,
+        decode::StructPointerDecoder<decode::Decoded_VkMemoryBarrier>*       pMemoryBarriers,
+        uint32_t                                                             bufferMemoryBarrierCount,
+        decode::StructPointerDecoder<decode::Decoded_VkBufferMemoryBarrier>* pBufferMemoryBarriers,
+        uint32_t                                                             imageMemoryBarrierCount,
+        decode::StructPointerDecoder<decode::Decoded_VkImageMemoryBarrier>*  pImageMemoryBarriers) override;
+
+    virtual void Process_vkCmdBeginRenderPass(
+        format::HandleId                                                     commandBuffer,
+        decode::StructPointerDecoder<decode::Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+        VkSubpassContents                                                    contents) override;
+
+  private:
+    int64_t BeginCall();
+
+    void EndCall(int64_t start);
+
+  private:
+    encode::ParameterBuffer  parameter_buffer_;
+    encode::ParameterEncoder encoder_;
+    uint64_t                 call_count_;
+    uint64_t                 encoded_size_;
+    int64_t                  encode_time_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_VULKAN_REENCODE_CONSUMER_H
@@ -0,0 +1,1553 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "workload_benchmark.h"
+#include "workload_shaders.h"
+
+#include "decode/vulkan_enum_util.h"
+#include "decode/vulkan_feature_util.h"
+#include "format/format.h"
+#include "graphics/vulkan_util.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+const char         kLayerName[]         = "VK_LAYER_LUNARG_gfxreconstruct";
+const char         kSettingPrefix[]     = "GFXRECON_";
+const char         kCaptureFileName[]   = "gfxrecon_workload_benchmark" GFXRECON_FILE_EXTENSION;
+const uint32_t     kWarmUpFrameCount    = 10;
+const uint32_t     kRenderTargetWidth   = 256;
+const uint32_t     kRenderTargetHeight  = 256;
+const uint32_t     kDescriptorSetCount  = 256;
+const VkDeviceSize kUniformRangeSize    = 256; // The largest minUniformBufferOffsetAlignment allowed by the spec.
+const VkDeviceSize kChurnBufferSize     = 64 * 1024;
+const uint32_t     kPushConstantCount   = 4;
+const size_t       kWritePageSize       = 4096; // The smallest page size that is tracked by the page guard manager.
+const size_t       kStridePages         = 4;
+const uint32_t     kRandomSeed          = 1;
+const double       kBytesPerMiB         = 1024.0 * 1024.0;
+const uint64_t     kNoTimeout           = std::numeric_limits<uint64_t>::max();
+
+static const char* GetWritePatternName(WorkloadBenchmark::WritePattern pattern)
+{
+    switch (pattern)
+    {
+        case WorkloadBenchmark::kWritePatternSequential:
+            return "sequential";
+        case WorkloadBenchmark::kWritePatternStrided:
+            return "strided";
+        case WorkloadBenchmark::kWritePatternRandom:
+            return "random";
+        default:
+            break;
+    }
+
+    return "unknown";
+}
+
+static bool CheckResult(VkResult result, const char* call)
+{
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("%s failed with %s", call, decode::enumutil::GetResultValueString(result));
+        return false;
+    }
+
+    return true;
+}
+
+// Returns the size of the capture file written by the capture layer in MiB, or a negative value when the file was not
+// written, and deletes the file.
+static double RemoveCaptureFile()
+{
+    double size = -1.0;
+    FILE*  file = nullptr;
+
+    if ((util::platform::FileOpen(&file, kCaptureFileName, "rb") == 0) && (file != nullptr))
+    {
+        if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+        {
+            size = static_cast<double>(util::platform::FileTell(file)) / kBytesPerMiB;
+        }
+
+        util::platform::FileClose(file);
+        std::remove(kCaptureFileName);
+    }
+
+    return size;
+}
+
+WorkloadBenchmark::WorkloadBenchmark(const Workload& workload) :
+    workload_(workload), loader_handle_(nullptr), get_instance_proc_addr_(nullptr),
+#if defined(VK_USE_PLATFORM_HEADLESS)
+    window_(nullptr),
+#endif
+    instance_(VK_NULL_HANDLE), instance_table_{}, physical_device_(VK_NULL_HANDLE), memory_properties_{},
+    device_(VK_NULL_HANDLE), device_table_{}, queue_family_index_(0), queue_(VK_NULL_HANDLE), surface_(VK_NULL_HANDLE),
+    swapchain_(VK_NULL_HANDLE), color_format_(VK_FORMAT_R8G8B8A8_UNORM),
+    extent_{ kRenderTargetWidth, kRenderTargetHeight }, offscreen_image_(VK_NULL_HANDLE),
+    offscreen_memory_(VK_NULL_HANDLE), acquire_semaphore_(VK_NULL_HANDLE), fence_(VK_NULL_HANDLE),
+    render_pass_(VK_NULL_HANDLE), descriptor_set_layout_(VK_NULL_HANDLE), pipeline_layout_(VK_NULL_HANDLE),
+    shader_module_(VK_NULL_HANDLE), pipeline_(VK_NULL_HANDLE), descriptor_pool_(VK_NULL_HANDLE), mapped_data_(nullptr),
+    command_pool_(VK_NULL_HANDLE), command_buffer_(VK_NULL_HANDLE), image_index_(0), record_serial_(0),
+    complete_count_(0), record_error_(false), exit_threads_(false)
+{
+    loader_handle_ = graphics::InitializeLoader();
+
+    if (loader_handle_ != nullptr)
+    {
+        get_instance_proc_addr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
+            util::platform::GetProcAddress(loader_handle_, "vkGetInstanceProcAddr"));
+    }
+
+#if defined(VK_USE_PLATFORM_HEADLESS)
+    // Frames are only presented when the headless surface is supported, and are otherwise rendered to an image.
+    application_ = std::make_unique<application::HeadlessApplication>("gfxrecon-bench");
+
+    if (application_->Initialize(nullptr))
+    {
+        window_factory_ = std::make_unique<application::HeadlessWindowFactory>(application_.get());
+        window_         = window_factory_->Create(0, 0, kRenderTargetWidth, kRenderTargetHeight);
+    }
+    else
+    {
+        application_.reset();
+    }
+#endif
+
+    size_t page_count = (workload_.write_size + kWritePageSize - 1) / kWritePageSize;
+    size_t page_step  = (workload_.write_pattern == kWritePatternStrided) ? kStridePages : 1;
+
+    for (size_t i = 0; i < page_count; i += page_step)
+    {
+        write_offsets_.push_back(i * kWritePageSize);
+    }
+
+    if (workload_.write_pattern == kWritePatternRandom)
+    {
+        // A fixed seed writes the pages in the same order for every run.
+        std::mt19937 random_engine(kRandomSeed);
+        std::shuffle(write_offsets_.begin(), write_offsets_.end(), random_engine);
+    }
+}
+
+WorkloadBenchmark::~WorkloadBenchmark()
+{
+    DestroyObjects();
+
+#if defined(VK_USE_PLATFORM_HEADLESS)
+    if (window_factory_ != nullptr)
+    {
+        window_factory_->Destroy(window_);
+    }
+#endif
+
+    if (loader_handle_ != nullptr)
+    {
+        graphics::ReleaseLoader(loader_handle_);
+    }
+}
+
+bool WorkloadBenchmark::ParseWritePattern(const std::string& value, WritePattern* pattern)
+{
+    assert(pattern != nullptr);
+
+    const WritePattern patterns[] = { kWritePatternSequential, kWritePatternStrided, kWritePatternRandom };
+
+    for (auto entry : patterns)
+    {
+        if (util::platform::StringCompareNoCase(GetWritePatternName(entry), value.c_str()) == 0)
+        {
+            *pattern = entry;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WorkloadBenchmark::Run()
+{
+    if (get_instance_proc_addr_ == nullptr)
+    {
+        GFXRECON_WRITE_CONSOLE("Failed to load the Vulkan loader");
+        return;
+    }
+
+    // The trimmed configuration starts its frame range after the last frame, to measure state tracking without writes.
+    std::string trim_frame = std::to_string(kWarmUpFrameCount + workload_.frame_count + 1);
+
+    const std::vector<Configuration> configurations = {
+        { "no layer", false, {} },
+        { "default", true, {} },
+        { "uncompressed", true, { { "CAPTURE_COMPRESSION_TYPE", "NONE" } } },
+        { "zstd", true, { { "CAPTURE_COMPRESSION_TYPE", "ZSTD" } } },
+        { "async write", true, { { "CAPTURE_FILE_ASYNC_WRITE", "true" } } },
+        { "assisted", true, { { "MEMORY_TRACKING_MODE", "assisted" } } },
+        { "unassisted", true, { { "MEMORY_TRACKING_MODE", "unassisted" } } },
+        { "trim pending", true, { { "CAPTURE_FRAMES", trim_frame } } }
+    };
+
+    bool        layer_available = IsLayerAvailable();
+    const char* render_target   = "offscreen";
+
+#if defined(VK_USE_PLATFORM_HEADLESS)
+    if (window_ != nullptr)
+    {
+        render_target = "presented";
+    }
+#endif
+
+    GFXRECON_WRITE_CONSOLE("Workload (%u threads, %u draws per thread, %u descriptor updates, %u buffers created, "
+                           "%.1f MiB of %s writes per frame, %u frames, %s):",
+                           workload_.thread_count,
+                           workload_.draw_count,
+                           workload_.descriptor_update_count,
+                           workload_.churn_count,
+                           static_cast<double>(workload_.write_size) / kBytesPerMiB,
+                           GetWritePatternName(workload_.write_pattern),
+                           workload_.frame_count,
+                           render_target);
+
+    if (!layer_available)
+    {
+        GFXRECON_WRITE_CONSOLE("  The %s layer was not found, so the workload is only measured without it.",
+                               kLayerName);
+        GFXRECON_WRITE_CONSOLE("  Add the directory of the layer manifest file to VK_ADD_LAYER_PATH to measure it.");
+    }
+    else if (util::platform::GetEnv("VK_INSTANCE_LAYERS").find(kLayerName) != std::string::npos)
+    {
+        GFXRECON_WRITE_CONSOLE("  VK_INSTANCE_LAYERS enables the layer for all configurations, including no layer.");
+    }
+
+    GFXRECON_WRITE_CONSOLE("  %-14s %10s %12s %9s %9s %11s",
+                           "Configuration",
+                           "Mean (ms)",
+                           "Median (ms)",
+                           "P95 (ms)",
+                           "Overhead",
+                           "File (MiB)");
+
+    double baseline = 0.0;
+
+    // A capture file left by an interrupted run is removed, so that it is not reported for the first configuration.
+    RemoveCaptureFile();
+
+    for (const auto& configuration : configurations)
+    {
+        if (configuration.enable_layer && !layer_available)
+        {
+            continue;
+        }
+
+        std::vector<int64_t> frame_times;
+
+        bool   success   = RunConfiguration(configuration, &frame_times);
+        double file_size = RemoveCaptureFile();
+
+        if (!success || frame_times.empty())
+        {
+            GFXRECON_WRITE_CONSOLE("  %-14s failed", configuration.name);
+            continue;
+        }
+
+        std::sort(frame_times.begin(), frame_times.end());
+
+        size_t  count     = frame_times.size();
+        size_t  p95_index = std::min(count - 1, (count * 95) / 100);
+        int64_t total     = std::accumulate(frame_times.begin(), frame_times.end(), int64_t{ 0 });
+        double  mean      = util::datetime::ConvertTimestampToMilliseconds(total) / count;
+        double  median    = util::datetime::ConvertTimestampToMilliseconds(frame_times[count / 2]);
+        double  p95       = util::datetime::ConvertTimestampToMilliseconds(frame_times[p95_index]);
+
+        if (!configuration.enable_layer)
+        {
+            baseline = mean;
+        }
+
+        char overhead[32] = "-";
+        char file[32]     = "-";
+
+        if (configuration.enable_layer && (baseline > 0.0))
+        {
+            snprintf(overhead, sizeof(overhead), "%+.1f%%", ((mean / baseline) - 1.0) * 100.0);
+        }
+
+        if (file_size >= 0.0)
+        {
+            snprintf(file, sizeof(file), "%.1f", file_size);
+        }
+
+        GFXRECON_WRITE_CONSOLE(
+            "  %-14s %10.3f %12.3f %9.3f %9s %11s", configuration.name, mean, median, p95, overhead, file);
+    }
+}
+
+bool WorkloadBenchmark::IsLayerAvailable() const
+{
+    auto enumerate_layers = reinterpret_cast<PFN_vkEnumerateInstanceLayerProperties>(
+        get_instance_proc_addr_(nullptr, "vkEnumerateInstanceLayerProperties"));
+    uint32_t                       count = 0;
+    std::vector<VkLayerProperties> properties;
+
+    if ((enumerate_layers != nullptr) && (enumerate_layers(&count, nullptr) == VK_SUCCESS) && (count > 0))
+    {
+        properties.resize(count);
+
+        if (enumerate_layers(&count, properties.data()) >= VK_SUCCESS)
+        {
+            properties.resize(count);
+        }
+        else
+        {
+            properties.clear();
+        }
+    }
+
+    for (const auto& layer : properties)
+    {
+        if (util::platform::StringCompare(layer.layerName, kLayerName) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool WorkloadBenchmark::RunConfiguration(const Configuration& configuration, std::vector<int64_t>* frame_times)
+{
+    assert(frame_times != nullptr);
+
+    // The capture layer reads its settings when the first instance is created, and releases its state when the last
+    // instance is destroyed, so each configuration is measured with a new instance.
+    std::vector<Setting> settings = { { "CAPTURE_FILE", kCaptureFileName },
+                                      { "CAPTURE_FILE_TIMESTAMP", "false" },
+                                      { "LOG_LEVEL", "warning" } };
+    std::vector<Setting> previous_settings;
+
+    settings.insert(settings.end(), configuration.settings.begin(), configuration.settings.end());
+    ApplySettings(settings, &previous_settings);
+
+    bool success = CreateInstance(configuration.enable_layer) && CreateDevice() && CreateRenderTarget() &&
+                   CreatePipeline() && CreateDescriptorSets() && CreateMappedMemory() && CreateCommandBuffers();
+
+    uint32_t total_frame_count = kWarmUpFrameCount + workload_.frame_count;
+
+    for (uint32_t i = 0; success && (i < total_frame_count); ++i)
+    {
+        int64_t start = util::datetime::GetTimestamp();
+
+        success = RunFrame(i);
+
+        if (i >= kWarmUpFrameCount)
+        {
+            frame_times->push_back(util::datetime::DiffTimestamps(start, util::datetime::GetTimestamp()));
+        }
+    }
+
+    DestroyObjects();
+    RestoreSettings(previous_settings);
+
+    return success;
+}
+
+void WorkloadBenchmark::ApplySettings(const std::vector<Setting>& settings, std::vector<Setting>* previous_settings)
+{
+    assert(previous_settings != nullptr);
+
+    for (const auto& setting : settings)
+    {
+        std::string name = std::string(kSettingPrefix) + setting.name;
+
+        previous_settings->push_back({ setting.name, util::platform::GetEnv(name.c_str()) });
+        util::platform::SetEnv(name.c_str(), setting.value.c_str());
+    }
+}
+
+void WorkloadBenchmark::RestoreSettings(const std::vector<Setting>& previous_settings)
+{
+    // Restored in reverse order, so that a setting that was applied twice gets its original value.
+    for (auto setting = previous_settings.rbegin(); setting != previous_settings.rend(); ++setting)
+    {
+        std::string name = std::string(kSettingPrefix) + setting->name;
+
+        util::platform::SetEnv(name.c_str(), setting->value.empty() ? nullptr : setting->value.c_str());
+    }
+}
+
+bool WorkloadBenchmark::CreateInstance(bool enable_layer)
+{
+    std::vector<const char*> layers;
+    std::vector<const char*> extensions;
+
+    if (enable_layer)
+    {
+        layers.push_back(kLayerName);
+    }
+
+#if defined(VK_USE_PLATFORM_HEADLESS)
+    if (window_ != nullptr)
+    {
+        extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+        extensions.push_back(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
+    }
+#endif
+
+    VkApplicationInfo app_info  = { VK_STRUCTURE_TYPE_APPLICATION_INFO };
+    app_info.pApplicationName   = "gfxrecon-bench workload";
+    app_info.applicationVersion = 1;
+    app_info.apiVersion         = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo create_info    = { VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+    create_info.pApplicationInfo        = &app_info;
+    create_info.enabledLayerCount       = static_cast<uint32_t>(layers.size());
+    create_info.ppEnabledLayerNames     = layers.data();
+    create_info.enabledExtensionCount   = static_cast<uint32_t>(extensions.size());
+    create_info.ppEnabledExtensionNames = extensions.data();
+
+    auto create_instance =
+        reinterpret_cast<PFN_vkCreateInstance>(get_instance_proc_addr_(nullptr, "vkCreateInstance"));
+
+    if ((create_instance == nullptr) ||
+        !CheckResult(create_instance(&create_info, nullptr, &instance_), "vkCreateInstance"))
+    {
+        instance_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    encode::LoadInstanceTable(get_instance_proc_addr_, instance_, &instance_table_);
+
+#if defined(VK_USE_PLATFORM_HEADLESS)
+    if ((window_ != nullptr) &&
+        !CheckResult(window_->CreateSurface(&instance_table_, instance_, 0, &surface_), "vkCreateHeadlessSurfaceEXT"))
+    {
+        surface_ = VK_NULL_HANDLE;
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+bool WorkloadBenchmark::CreateDevice()
+{
+    uint32_t device_count = 0;
+
+    if (!CheckResult(instance_table_.EnumeratePhysicalDevices(instance_, &device_count, nullptr),
+                     "vkEnumeratePhysicalDevices") ||
+        (device_count == 0))
+    {
+        return false;
+    }
+
+    // The first device is used, as it is by most applications.
+    std::vector<VkPhysicalDevice> physical_devices(device_count);
+    VkResult result = instance_table_.EnumeratePhysicalDevices(instance_, &device_count, physical_devices.data());
+
+    if ((result != VK_SUCCESS) && (result != VK_INCOMPLETE))
+    {
+        return CheckResult(result, "vkEnumeratePhysicalDevices");
+    }
+
+    physical_device_ = physical_devices[0];
+    instance_table_.GetPhysicalDeviceMemoryProperties(physical_device_, &memory_properties_);
+
+    uint32_t family_count = 0;
+    instance_table_.GetPhysicalDeviceQueueFamilyProperties(physical_device_, &family_count, nullptr);
+
+    std::vector<VkQueueFamilyProperties> families(family_count);
+    instance_table_.GetPhysicalDeviceQueueFamilyProperties(physical_device_, &family_count, families.data());
+
+    bool found_family = false;
+
+    for (uint32_t i = 0; (i < family_count) && !found_family; ++i)
+    {
+        VkBool32 present_support = VK_TRUE;
+
+        if (surface_ != VK_NULL_HANDLE)
+        {
+            instance_table_.GetPhysicalDeviceSurfaceSupportKHR(physical_device_, i, surface_, &present_support);
+        }
+
+        if (((families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0) && (present_support == VK_TRUE))
+        {
+            queue_family_index_ = i;
+            found_family        = true;
+        }
+    }
+
+    if (!found_family)
+    {
+        GFXRECON_LOG_ERROR("The physical device does not have a graphics queue that can present to the surface");
+        return false;
+    }
+
+    std::vector<const char*> extensions;
+
+    if (surface_ != VK_NULL_HANDLE)
+    {
+        std::vector<VkExtensionProperties> properties;
+
+        decode::feature_util::GetDeviceExtensions(
+            physical_device_, instance_table_.EnumerateDeviceExtensionProperties, &properties);
+
+        if (!decode::feature_util::IsSupportedExtension(properties, VK_KHR_SWAPCHAIN_EXTENSION_NAME))
+        {
+            GFXRECON_LOG_ERROR("The physical device does not support %s", VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+            return false;
+        }
+
+        extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
+
+    float                   priority   = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+    queue_info.queueFamilyIndex        = queue_family_index_;
+    queue_info.queueCount              = 1;
+    queue_info.pQueuePriorities        = &priority;
+
+    VkDeviceCreateInfo create_info      = { VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+    create_info.queueCreateInfoCount    = 1;
+    create_info.pQueueCreateInfos       = &queue_info;
+    create_info.enabledExtensionCount   = static_cast<uint32_t>(extensions.size());
+    create_info.ppEnabledExtensionNames = extensions.data();
+
+    // vkCreateDevice is not part of the instance table.
+    auto create_device = reinterpret_cast<PFN_vkCreateDevice>(get_instance_proc_addr_(instance_, "vkCreateDevice"));
+
+    if ((create_device == nullptr) ||
+        !CheckResult(create_device(physical_device_, &create_info, nullptr, &device_), "vkCreateDevice"))
+    {
+        device_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    auto get_device_proc_addr =
+        reinterpret_cast<PFN_vkGetDeviceProcAddr>(get_instance_proc_addr_(instance_, "vkGetDeviceProcAddr"));
+
+    encode::LoadDeviceTable(get_device_proc_addr, device_, &device_table_);
+    device_table_.GetDeviceQueue(device_, queue_family_index_, 0, &queue_);
+
+    return true;
+}
+
+bool WorkloadBenchmark::CreateSwapchain()
+{
+    VkSurfaceCapabilitiesKHR capabilities;
+    uint32_t                 format_count = 0;
+
+    if (!CheckResult(
+            instance_table_.GetPhysicalDeviceSurfaceCapabilitiesKHR(physical_device_, surface_, &capabilities),
+            "vkGetPhysicalDeviceSurfaceCapabilitiesKHR") ||
+        !CheckResult(
+            instance_table_.GetPhysicalDeviceSurfaceFormatsKHR(physical_device_, surface_, &format_count, nullptr),
+            "vkGetPhysicalDeviceSurfaceFormatsKHR") ||
+        (format_count == 0))
+    {
+        return false;
+    }
+
+    std::vector<VkSurfaceFormatKHR> formats(format_count);
+    instance_table_.GetPhysicalDeviceSurfaceFormatsKHR(physical_device_, surface_, &format_count, formats.data());
+
+    if (formats[0].format != VK_FORMAT_UNDEFINED)
+    {
+        color_format_ = formats[0].format;
+    }
+
+    // The headless surface does not have a current extent, so the swapchain uses the size of the offscreen image.
+    if (capabilities.currentExtent.width != std::numeric_limits<uint32_t>::max())
+    {
+        extent_ = capabilities.currentExtent;
+    }
+
+    uint32_t image_count = capabilities.minImageCount + 1;
+
+    if (capabilities.maxImageCount > 0)
+    {
+        image_count = std::min(image_count, capabilities.maxImageCount);
+    }
+
+    // Selects the lowest composite alpha mode that is supported.
+    auto composite_alpha = static_cast<VkCompositeAlphaFlagBitsKHR>(capabilities.supportedCompositeAlpha &
+                                                                    (~capabilities.supportedCompositeAlpha + 1));
+
+    VkSwapchainCreateInfoKHR create_info = { VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR };
+    create_info.surface                  = surface_;
+    create_info.minImageCount            = image_count;
+    create_info.imageFormat              = color_format_;
+    create_info.imageColorSpace          = formats[0].colorSpace;
+    create_info.imageExtent              = extent_;
+    create_info.imageArrayLayers         = 1;
+    create_info.imageUsage               = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    create_info.imageSharingMode         = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.preTransform             = capabilities.currentTransform;
+    create_info.compositeAlpha           = composite_alpha;
+    create_info.presentMode              = VK_PRESENT_MODE_FIFO_KHR;
+    create_info.clipped                  = VK_TRUE;
+
+    if (!CheckResult(device_table_.CreateSwapchainKHR(device_, &create_info, nullptr, &swapchain_),
+                     "vkCreateSwapchainKHR"))
+    {
+        swapchain_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    if (!CheckResult(device_table_.GetSwapchainImagesKHR(device_, swapchain_, &image_count, nullptr),
+                     "vkGetSwapchainImagesKHR"))
+    {
+        return false;
+    }
+
+    images_.resize(image_count);
+
+    return CheckResult(device_table_.GetSwapchainImagesKHR(device_, swapchain_, &image_count, images_.data()),
+                       "vkGetSwapchainImagesKHR");
+}
+
+bool WorkloadBenchmark::CreateRenderTarget()
+{
+    if (surface_ != VK_NULL_HANDLE)
+    {
+        if (!CreateSwapchain())
+        {
+            return false;
+        }
+    }
+    else
+    {
+        VkImageCreateInfo create_info = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+        create_info.imageType         = VK_IMAGE_TYPE_2D;
+        create_info.format            = color_format_;
+        create_info.extent            = { extent_.width, extent_.height, 1 };
+        create_info.mipLevels         = 1;
+        create_info.arrayLayers       = 1;
+        create_info.samples           = VK_SAMPLE_COUNT_1_BIT;
+        create_info.tiling            = VK_IMAGE_TILING_OPTIMAL;
+        create_info.usage             = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        create_info.sharingMode       = VK_SHARING_MODE_EXCLUSIVE;
+        create_info.initialLayout     = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        if (!CheckResult(device_table_.CreateImage(device_, &create_info, nullptr, &offscreen_image_), "vkCreateImage"))
+        {
+            offscreen_image_ = VK_NULL_HANDLE;
+            return false;
+        }
+
+        VkMemoryRequirements requirements;
+        device_table_.GetImageMemoryRequirements(device_, offscreen_image_, &requirements);
+
+        VkMemoryAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        allocate_info.allocationSize       = requirements.size;
+        allocate_info.memoryTypeIndex      = GetMemoryTypeIndex(requirements.memoryTypeBits, 0);
+
+        if (!CheckResult(device_table_.AllocateMemory(device_, &allocate_info, nullptr, &offscreen_memory_),
+                         "vkAllocateMemory"))
+        {
+            offscreen_memory_ = VK_NULL_HANDLE;
+            return false;
+        }
+
+        if (!CheckResult(device_table_.BindImageMemory(device_, offscreen_image_, offscreen_memory_, 0),
+                         "vkBindImageMemory"))
+        {
+            return false;
+        }
+
+        images_.push_back(offscreen_image_);
+    }
+
+    VkAttachmentDescription attachment = {};
+    attachment.format                  = color_format_;
+    attachment.samples                 = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp                  = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachment.storeOp                 = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp           = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp          = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout           = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout             = (swapchain_ != VK_NULL_HANDLE) ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+                                                                        : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference color_reference = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments    = &color_reference;
+
+    // Orders the layout transition after the wait for the acquired swapchain image, and after the previous frame.
+    VkSubpassDependency dependency = {};
+    dependency.srcSubpass          = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass          = 0;
+    dependency.srcStageMask        = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstStageMask        = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.srcAccessMask       = 0;
+    dependency.dstAccessMask       = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+    VkRenderPassCreateInfo render_pass_info = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
+    render_pass_info.attachmentCount        = 1;
+    render_pass_info.pAttachments           = &attachment;
+    render_pass_info.subpassCount           = 1;
+    render_pass_info.pSubpasses             = &subpass;
+    render_pass_info.dependencyCount        = 1;
+    render_pass_info.pDependencies          = &dependency;
+
+    if (!CheckResult(device_table_.CreateRenderPass(device_, &render_pass_info, nullptr, &render_pass_),
+                     "vkCreateRenderPass"))
+    {
+        render_pass_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    for (auto image : images_)
+    {
+        VkImageViewCreateInfo view_info = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+        view_info.image                 = image;
+        view_info.viewType              = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format                = color_format_;
+        view_info.subresourceRange      = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        VkImageView view = VK_NULL_HANDLE;
+
+        if (!CheckResult(device_table_.CreateImageView(device_, &view_info, nullptr, &view), "vkCreateImageView"))
+        {
+            return false;
+        }
+
+        image_views_.push_back(view);
+
+        VkFramebufferCreateInfo framebuffer_info = { VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+        framebuffer_info.renderPass              = render_pass_;
+        framebuffer_info.attachmentCount         = 1;
+        framebuffer_info.pAttachments            = &view;
+        framebuffer_info.width                   = extent_.width;
+        framebuffer_info.height                  = extent_.height;
+        framebuffer_info.layers                  = 1;
+
+        VkFramebuffer framebuffer = VK_NULL_HANDLE;
+
+        if (!CheckResult(device_table_.CreateFramebuffer(device_, &framebuffer_info, nullptr, &framebuffer),
+                         "vkCreateFramebuffer"))
+        {
+            return false;
+        }
+
+        framebuffers_.push_back(framebuffer);
+    }
+
+    VkSemaphoreCreateInfo semaphore_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+    VkFenceCreateInfo     fence_info     = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+
+    if (swapchain_ != VK_NULL_HANDLE)
+    {
+        if (!CheckResult(device_table_.CreateSemaphore(device_, &semaphore_info, nullptr, &acquire_semaphore_),
+                         "vkCreateSemaphore"))
+        {
+            acquire_semaphore_ = VK_NULL_HANDLE;
+            return false;
+        }
+
+        // Each image has its own semaphore for presentation, which is waited for before the image is acquired again.
+        for (size_t i = 0; i < images_.size(); ++i)
+        {
+            VkSemaphore semaphore = VK_NULL_HANDLE;
+
+            if (!CheckResult(device_table_.CreateSemaphore(device_, &semaphore_info, nullptr, &semaphore),
+                             "vkCreateSemaphore"))
+            {
+                return false;
+            }
+
+            present_semaphores_.push_back(semaphore);
+        }
+    }
+
+    if (!CheckResult(device_table_.CreateFence(device_, &fence_info, nullptr, &fence_), "vkCreateFence"))
+    {
+        fence_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    return true;
+}
+
+bool WorkloadBenchmark::CreatePipeline()
+{
+    VkDescriptorSetLayoutBinding binding = {};
+    binding.binding                      = 0;
+    binding.descriptorType               = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    binding.descriptorCount              = 1;
+    binding.stageFlags                   = VK_SHADER_STAGE_VERTEX_BIT;
+
+    VkDescriptorSetLayoutCreateInfo set_layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    set_layout_info.bindingCount                    = 1;
+    set_layout_info.pBindings                       = &binding;
+
+    if (!CheckResult(
+            device_table_.CreateDescriptorSetLayout(device_, &set_layout_info, nullptr, &descriptor_set_layout_),
+            "vkCreateDescriptorSetLayout"))
+    {
+        descriptor_set_layout_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkPushConstantRange push_constant_range = { VK_SHADER_STAGE_VERTEX_BIT, 0, kPushConstantCount * sizeof(uint32_t) };
+
+    VkPipelineLayoutCreateInfo layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+    layout_info.setLayoutCount             = 1;
+    layout_info.pSetLayouts                = &descriptor_set_layout_;
+    layout_info.pushConstantRangeCount     = 1;
+    layout_info.pPushConstantRanges        = &push_constant_range;
+
+    if (!CheckResult(device_table_.CreatePipelineLayout(device_, &layout_info, nullptr, &pipeline_layout_),
+                     "vkCreatePipelineLayout"))
+    {
+        pipeline_layout_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkShaderModuleCreateInfo module_info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+    module_info.codeSize                 = sizeof(g_WorkloadVertexShader);
+    module_info.pCode                    = reinterpret_cast<const uint32_t*>(g_WorkloadVertexShader);
+
+    if (!CheckResult(device_table_.CreateShaderModule(device_, &module_info, nullptr, &shader_module_),
+                     "vkCreateShaderModule"))
+    {
+        shader_module_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkPipelineShaderStageCreateInfo stage_info = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO };
+    stage_info.stage                           = VK_SHADER_STAGE_VERTEX_BIT;
+    stage_info.module                          = shader_module_;
+    stage_info.pName                           = "main";
+
+    VkPipelineVertexInputStateCreateInfo vertex_input_info = {
+        VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO
+    };
+
+    VkPipelineInputAssemblyStateCreateInfo input_assembly_info = {
+        VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO
+    };
+    input_assembly_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    // Primitives are discarded before rasterization, so the viewport, multisample, and blend states are not needed.
+    VkPipelineRasterizationStateCreateInfo rasterization_info = {
+        VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO
+    };
+    rasterization_info.rasterizerDiscardEnable = VK_TRUE;
+    rasterization_info.polygonMode             = VK_POLYGON_MODE_FILL;
+    rasterization_info.cullMode                = VK_CULL_MODE_NONE;
+    rasterization_info.frontFace               = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterization_info.lineWidth               = 1.0f;
+
+    VkGraphicsPipelineCreateInfo pipeline_info = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
+    pipeline_info.stageCount                   = 1;
+    pipeline_info.pStages                      = &stage_info;
+    pipeline_info.pVertexInputState            = &vertex_input_info;
+    pipeline_info.pInputAssemblyState          = &input_assembly_info;
+    pipeline_info.pRasterizationState          = &rasterization_info;
+    pipeline_info.layout                       = pipeline_layout_;
+    pipeline_info.renderPass                   = render_pass_;
+    pipeline_info.subpass                      = 0;
+
+    if (!CheckResult(
+            device_table_.CreateGraphicsPipelines(device_, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline_),
+            "vkCreateGraphicsPipelines"))
+    {
+        pipeline_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    return true;
+}
+
+bool WorkloadBenchmark::CreateDescriptorSets()
+{
+    if (!CreateBuffer(kUniformRangeSize * kDescriptorSetCount, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, 0, &uniform_buffer_))
+    {
+        return false;
+    }
+
+    VkDescriptorPoolSize pool_size = { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kDescriptorSetCount };
+
+    VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+    pool_info.maxSets                    = kDescriptorSetCount;
+    pool_info.poolSizeCount              = 1;
+    pool_info.pPoolSizes                 = &pool_size;
+
+    if (!CheckResult(device_table_.CreateDescriptorPool(device_, &pool_info, nullptr, &descriptor_pool_),
+                     "vkCreateDescriptorPool"))
+    {
+        descriptor_pool_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    std::vector<VkDescriptorSetLayout> layouts(kDescriptorSetCount, descriptor_set_layout_);
+
+    VkDescriptorSetAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+    allocate_info.descriptorPool              = descriptor_pool_;
+    allocate_info.descriptorSetCount          = kDescriptorSetCount;
+    allocate_info.pSetLayouts                 = layouts.data();
+
+    descriptor_sets_.resize(kDescriptorSetCount, VK_NULL_HANDLE);
+
+    if (!CheckResult(device_table_.AllocateDescriptorSets(device_, &allocate_info, descriptor_sets_.data()),
+                     "vkAllocateDescriptorSets"))
+    {
+        descriptor_sets_.clear();
+        return false;
+    }
+
+    // Every set is written before the first frame, which binds all of the sets.
+    uint32_t update_count = std::max(workload_.descriptor_update_count, kDescriptorSetCount);
+
+    descriptor_buffer_infos_.resize(update_count);
+    descriptor_writes_.resize(update_count);
+
+    for (uint32_t i = 0; i < update_count; ++i)
+    {
+        descriptor_buffer_infos_[i] = { uniform_buffer_.buffer, 0, kUniformRangeSize };
+
+        VkWriteDescriptorSet& write = descriptor_writes_[i];
+        write                       = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+        write.dstBinding            = 0;
+        write.descriptorCount       = 1;
+        write.descriptorType        = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        write.pBufferInfo           = &descriptor_buffer_infos_[i];
+    }
+
+    for (uint32_t i = 0; i < kDescriptorSetCount; ++i)
+    {
+        descriptor_writes_[i].dstSet       = descriptor_sets_[i];
+        descriptor_buffer_infos_[i].offset = i * kUniformRangeSize;
+    }
+
+    device_table_.UpdateDescriptorSets(device_, kDescriptorSetCount, descriptor_writes_.data(), 0, nullptr);
+
+    return true;
+}
+
+bool WorkloadBenchmark::CreateMappedMemory()
+{
+    if (workload_.write_size == 0)
+    {
+        return true;
+    }
+
+    if (!CreateBuffer(workload_.write_size,
+                      VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      &mapped_buffer_))
+    {
+        return false;
+    }
+
+    // The memory remains mapped, as it is by most applications that write to it every frame.
+    void* data = nullptr;
+
+    if (!CheckResult(device_table_.MapMemory(device_, mapped_buffer_.memory, 0, VK_WHOLE_SIZE, 0, &data),
+                     "vkMapMemory"))
+    {
+        return false;
+    }
+
+    mapped_data_ = static_cast<uint8_t*>(data);
+
+    return true;
+}
+
+bool WorkloadBenchmark::CreateCommandBuffers()
+{
+    VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool_info.queueFamilyIndex        = queue_family_index_;
+
+    VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+    allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount          = 1;
+
+    if (!CheckResult(device_table_.CreateCommandPool(device_, &pool_info, nullptr, &command_pool_),
+                     "vkCreateCommandPool"))
+    {
+        command_pool_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    allocate_info.commandPool = command_pool_;
+
+    if (!CheckResult(device_table_.AllocateCommandBuffers(device_, &allocate_info, &command_buffer_),
+                     "vkAllocateCommandBuffers"))
+    {
+        command_buffer_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    // Each recording thread has its own command pool, which is reset by the thread before it records each frame.
+    recording_threads_ = std::vector<RecordingThread>(workload_.thread_count);
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+
+    for (auto& recording_thread : recording_threads_)
+    {
+        if (!CheckResult(device_table_.CreateCommandPool(device_, &pool_info, nullptr, &recording_thread.command_pool),
+                         "vkCreateCommandPool"))
+        {
+            recording_thread.command_pool = VK_NULL_HANDLE;
+            return false;
+        }
+
+        allocate_info.commandPool = recording_thread.command_pool;
+
+        if (!CheckResult(
+                device_table_.AllocateCommandBuffers(device_, &allocate_info, &recording_thread.command_buffer),
+                "vkAllocateCommandBuffers"))
+        {
+            recording_thread.command_buffer = VK_NULL_HANDLE;
+            return false;
+        }
+
+        secondary_command_buffers_.push_back(recording_thread.command_buffer);
+    }
+
+    // The threads are kept for all frames, as they are by applications, so that the capture layer does not create
+    // per-thread state for new threads each frame.
+    record_serial_  = 0;
+    complete_count_ = 0;
+    record_error_   = false;
+    exit_threads_   = false;
+
+    for (uint32_t i = 0; i < workload_.thread_count; ++i)
+    {
+        recording_threads_[i].thread = std::thread(&WorkloadBenchmark::RecordingThreadMain, this, i);
+    }
+
+    churn_buffers_.resize(workload_.churn_count);
+
+    return true;
+}
+
+void WorkloadBenchmark::DestroyObjects()
+{
+    StopRecordingThreads();
+
+    if (device_ != VK_NULL_HANDLE)
+    {
+        device_table_.DeviceWaitIdle(device_);
+
+        for (auto& recording_thread : recording_threads_)
+        {
+            if (recording_thread.command_pool != VK_NULL_HANDLE)
+            {
+                device_table_.DestroyCommandPool(device_, recording_thread.command_pool, nullptr);
+            }
+        }
+
+        if (command_pool_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyCommandPool(device_, command_pool_, nullptr);
+        }
+
+        for (auto& buffer : churn_buffers_)
+        {
+            DestroyBuffer(&buffer);
+        }
+
+        if (mapped_data_ != nullptr)
+        {
+            device_table_.UnmapMemory(device_, mapped_buffer_.memory);
+        }
+
+        DestroyBuffer(&mapped_buffer_);
+
+        if (descriptor_pool_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyDescriptorPool(device_, descriptor_pool_, nullptr);
+        }
+
+        DestroyBuffer(&uniform_buffer_);
+
+        if (pipeline_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyPipeline(device_, pipeline_, nullptr);
+        }
+
+        if (shader_module_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyShaderModule(device_, shader_module_, nullptr);
+        }
+
+        if (pipeline_layout_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyPipelineLayout(device_, pipeline_layout_, nullptr);
+        }
+
+        if (descriptor_set_layout_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyDescriptorSetLayout(device_, descriptor_set_layout_, nullptr);
+        }
+
+        if (fence_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyFence(device_, fence_, nullptr);
+        }
+
+        if (acquire_semaphore_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroySemaphore(device_, acquire_semaphore_, nullptr);
+        }
+
+        for (auto semaphore : present_semaphores_)
+        {
+            device_table_.DestroySemaphore(device_, semaphore, nullptr);
+        }
+
+        for (auto framebuffer : framebuffers_)
+        {
+            device_table_.DestroyFramebuffer(device_, framebuffer, nullptr);
+        }
+
+        for (auto view : image_views_)
+        {
+            device_table_.DestroyImageView(device_, view, nullptr);
+        }
+
+        if (render_pass_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyRenderPass(device_, render_pass_, nullptr);
+        }
+
+        if (offscreen_image_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyImage(device_, offscreen_image_, nullptr);
+        }
+
+        if (offscreen_memory_ != VK_NULL_HANDLE)
+        {
+            device_table_.FreeMemory(device_, offscreen_memory_, nullptr);
+        }
+
+        if (swapchain_ != VK_NULL_HANDLE)
+        {
+            device_table_.DestroySwapchainKHR(device_, swapchain_, nullptr);
+        }
+
+        device_table_.DestroyDevice(device_, nullptr);
+    }
+
+    if (instance_ != VK_NULL_HANDLE)
+    {
+#if defined(VK_USE_PLATFORM_HEADLESS)
+        if (surface_ != VK_NULL_HANDLE)
+        {
+            window_->DestroySurface(&instance_table_, instance_, surface_);
+        }
+#endif
+
+        instance_table_.DestroyInstance(instance_, nullptr);
+    }
+
+    recording_threads_.clear();
+    secondary_command_buffers_.clear();
+    churn_buffers_.clear();
+    descriptor_sets_.clear();
+    descriptor_buffer_infos_.clear();
+    descriptor_writes_.clear();
+    framebuffers_.clear();
+    image_views_.clear();
+    present_semaphores_.clear();
+    images_.clear();
+
+    instance_              = VK_NULL_HANDLE;
+    physical_device_       = VK_NULL_HANDLE;
+    device_                = VK_NULL_HANDLE;
+    queue_                 = VK_NULL_HANDLE;
+    surface_               = VK_NULL_HANDLE;
+    swapchain_             = VK_NULL_HANDLE;
+    offscreen_image_       = VK_NULL_HANDLE;
+    offscreen_memory_      = VK_NULL_HANDLE;
+    acquire_semaphore_     = VK_NULL_HANDLE;
+    fence_                 = VK_NULL_HANDLE;
+    render_pass_           = VK_NULL_HANDLE;
+    descriptor_set_layout_ = VK_NULL_HANDLE;
+    pipeline_layout_       = VK_NULL_HANDLE;
+    shader_module_         = VK_NULL_HANDLE;
+    pipeline_              = VK_NULL_HANDLE;
+    descriptor_pool_       = VK_NULL_HANDLE;
+    mapped_data_           = nullptr;
+    command_pool_          = VK_NULL_HANDLE;
+    command_buffer_        = VK_NULL_HANDLE;
+    extent_                = { kRenderTargetWidth, kRenderTargetHeight };
+    color_format_          = VK_FORMAT_R8G8B8A8_UNORM;
+}
+
+bool WorkloadBenchmark::CreateBuffer(VkDeviceSize          size,
+                                     VkBufferUsageFlags    usage,
+                                     VkMemoryPropertyFlags properties,
+                                     Buffer*               buffer)
+{
+    assert(buffer != nullptr);
+
+    VkBufferCreateInfo create_info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.size               = size;
+    create_info.usage              = usage;
+    create_info.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (!CheckResult(device_table_.CreateBuffer(device_, &create_info, nullptr, &buffer->buffer), "vkCreateBuffer"))
+    {
+        buffer->buffer = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkMemoryRequirements requirements;
+    device_table_.GetBufferMemoryRequirements(device_, buffer->buffer, &requirements);
+
+    VkMemoryAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+    allocate_info.allocationSize       = requirements.size;
+    allocate_info.memoryTypeIndex      = GetMemoryTypeIndex(requirements.memoryTypeBits, properties);
+
+    if (allocate_info.memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+    {
+        GFXRECON_LOG_ERROR("The physical device does not have a memory type with properties 0x%x", properties);
+        return false;
+    }
+
+    if (!CheckResult(device_table_.AllocateMemory(device_, &allocate_info, nullptr, &buffer->memory),
+                     "vkAllocateMemory"))
+    {
+        buffer->memory = VK_NULL_HANDLE;
+        return false;
+    }
+
+    return CheckResult(device_table_.BindBufferMemory(device_, buffer->buffer, buffer->memory, 0),
+                       "vkBindBufferMemory");
+}
+
+void WorkloadBenchmark::DestroyBuffer(Buffer* buffer)
+{
+    assert(buffer != nullptr);
+
+    if (buffer->buffer != VK_NULL_HANDLE)
+    {
+        device_table_.DestroyBuffer(device_, buffer->buffer, nullptr);
+        buffer->buffer = VK_NULL_HANDLE;
+    }
+
+    if (buffer->memory != VK_NULL_HANDLE)
+    {
+        device_table_.FreeMemory(device_, buffer->memory, nullptr);
+        buffer->memory = VK_NULL_HANDLE;
+    }
+}
+
+uint32_t WorkloadBenchmark::GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags properties) const
+{
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i)
+    {
+        if (((type_bits & (1u << i)) != 0) &&
+            ((memory_properties_.memoryTypes[i].propertyFlags & properties) == properties))
+        {
+            return i;
+        }
+    }
+
+    return std::numeric_limits<uint32_t>::max();
+}
+
+bool WorkloadBenchmark::RunFrame(uint32_t frame_index)
+{
+    if (swapchain_ != VK_NULL_HANDLE)
+    {
+        VkResult result = device_table_.AcquireNextImageKHR(
+            device_, swapchain_, kNoTimeout, acquire_semaphore_, VK_NULL_HANDLE, &image_index_);
+
+        if ((result != VK_SUBOPTIMAL_KHR) && !CheckResult(result, "vkAcquireNextImageKHR"))
+        {
+            return false;
+        }
+    }
+
+    UpdateDescriptorSets(frame_index);
+
+    for (auto& buffer : churn_buffers_)
+    {
+        if (!CreateBuffer(kChurnBufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, 0, &buffer))
+        {
+            return false;
+        }
+    }
+
+    if (mapped_data_ != nullptr)
+    {
+        WriteMappedMemory(frame_index);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(thread_mutex_);
+        complete_count_ = 0;
+        ++record_serial_;
+    }
+
+    record_condition_.notify_all();
+
+    {
+        std::unique_lock<std::mutex> lock(thread_mutex_);
+        complete_condition_.wait(lock, [this]() { return complete_count_ == recording_threads_.size(); });
+
+        if (record_error_)
+        {
+            return false;
+        }
+    }
+
+    VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    VkClearValue clear_value = {};
+
+    VkRenderPassBeginInfo render_pass_begin = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+    render_pass_begin.renderPass            = render_pass_;
+    render_pass_begin.framebuffer           = framebuffers_[image_index_];
+    render_pass_begin.renderArea            = { { 0, 0 }, extent_ };
+    render_pass_begin.clearValueCount       = 1;
+    render_pass_begin.pClearValues          = &clear_value;
+
+    device_table_.ResetCommandPool(device_, command_pool_, 0);
+
+    if (!CheckResult(device_table_.BeginCommandBuffer(command_buffer_, &begin_info), "vkBeginCommandBuffer"))
+    {
+        return false;
+    }
+
+    device_table_.CmdBeginRenderPass(
+        command_buffer_, &render_pass_begin, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+    if (!secondary_command_buffers_.empty())
+    {
+        device_table_.CmdExecuteCommands(command_buffer_,
+                                         static_cast<uint32_t>(secondary_command_buffers_.size()),
+                                         secondary_command_buffers_.data());
+    }
+
+    device_table_.CmdEndRenderPass(command_buffer_);
+
+    if (!CheckResult(device_table_.EndCommandBuffer(command_buffer_), "vkEndCommandBuffer"))
+    {
+        return false;
+    }
+
+    VkPipelineStageFlags wait_stage  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSubmitInfo         submit_info = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit_info.commandBufferCount   = 1;
+    submit_info.pCommandBuffers      = &command_buffer_;
+
+    if (swapchain_ != VK_NULL_HANDLE)
+    {
+        submit_info.waitSemaphoreCount   = 1;
+        submit_info.pWaitSemaphores      = &acquire_semaphore_;
+        submit_info.pWaitDstStageMask    = &wait_stage;
+        submit_info.signalSemaphoreCount = 1;
+        submit_info.pSignalSemaphores    = &present_semaphores_[image_index_];
+    }
+
+    if (!CheckResult(device_table_.QueueSubmit(queue_, 1, &submit_info, fence_), "vkQueueSubmit"))
+    {
+        return false;
+    }
+
+    if (swapchain_ != VK_NULL_HANDLE)
+    {
+        VkPresentInfoKHR present_info   = { VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
+        present_info.waitSemaphoreCount = 1;
+        present_info.pWaitSemaphores    = &present_semaphores_[image_index_];
+        present_info.swapchainCount     = 1;
+        present_info.pSwapchains        = &swapchain_;
+        present_info.pImageIndices      = &image_index_;
+
+        VkResult result = device_table_.QueuePresentKHR(queue_, &present_info);
+
+        if ((result != VK_SUBOPTIMAL_KHR) && !CheckResult(result, "vkQueuePresentKHR"))
+        {
+            return false;
+        }
+    }
+
+    // Only one frame is in flight, so that the frame time includes the work that the capture layer does for the
+    // submission, and the resources of the frame can be reused by the next frame.
+    if (!CheckResult(device_table_.WaitForFences(device_, 1, &fence_, VK_TRUE, kNoTimeout), "vkWaitForFences") ||
+        !CheckResult(device_table_.ResetFences(device_, 1, &fence_), "vkResetFences"))
+    {
+        return false;
+    }
+
+    for (auto& buffer : churn_buffers_)
+    {
+        DestroyBuffer(&buffer);
+    }
+
+    return true;
+}
+
+void WorkloadBenchmark::UpdateDescriptorSets(uint32_t frame_index)
+{
+    uint32_t update_count = workload_.descriptor_update_count;
+
+    if (update_count > 0)
+    {
+        // The updates rotate through the descriptor sets and the ranges of the uniform buffer.
+        for (uint32_t i = 0; i < update_count; ++i)
+        {
+            uint32_t update = (frame_index * update_count) + i;
+
+            descriptor_writes_[i].dstSet       = descriptor_sets_[update % kDescriptorSetCount];
+            descriptor_buffer_infos_[i].offset = ((update + frame_index) % kDescriptorSetCount) * kUniformRangeSize;
+        }
+
+        device_table_.UpdateDescriptorSets(device_, update_count, descriptor_writes_.data(), 0, nullptr);
+    }
+}
+
+void WorkloadBenchmark::WriteMappedMemory(uint32_t frame_index)
+{
+    int    value      = static_cast<int>(frame_index & 0xff);
+    size_t write_size = (workload_.write_pattern == kWritePatternSequential) ? kWritePageSize : sizeof(uint32_t);
+
+    for (auto offset : write_offsets_)
+    {
+        memset(mapped_data_ + offset, value, std::min(write_size, workload_.write_size - offset));
+    }
+
+    // The memory is coherent, but is flushed for the assisted memory tracking mode of the capture layer.
+    VkMappedMemoryRange range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+    range.memory              = mapped_buffer_.memory;
+    range.offset              = 0;
+    range.size                = VK_WHOLE_SIZE;
+
+    device_table_.FlushMappedMemoryRanges(device_, 1, &range);
+}
+
+void WorkloadBenchmark::RecordingThreadMain(uint32_t thread_index)
+{
+    uint64_t serial = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(thread_mutex_);
+            record_condition_.wait(lock, [this, serial]() { return exit_threads_ || (record_serial_ != serial); });
+
+            if (exit_threads_)
+            {
+                return;
+            }
+
+            serial = record_serial_;
+        }
+
+        bool success = RecordSecondaryCommands(thread_index);
+
+        {
+            std::lock_guard<std::mutex> lock(thread_mutex_);
+            record_error_ = record_error_ || !success;
+            ++complete_count_;
+        }
+
+        complete_condition_.notify_one();
+    }
+}
+
+bool WorkloadBenchmark::RecordSecondaryCommands(uint32_t thread_index)
+{
+    const RecordingThread& recording_thread = recording_threads_[thread_index];
+    VkCommandBuffer        command_buffer   = recording_thread.command_buffer;
+
+    VkCommandBufferInheritanceInfo inheritance_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
+    inheritance_info.renderPass                     = render_pass_;
+    inheritance_info.subpass                        = 0;
+    inheritance_info.framebuffer                    = framebuffers_[image_index_];
+
+    VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    begin_info.pInheritanceInfo = &inheritance_info;
+
+    device_table_.ResetCommandPool(device_, recording_thread.command_pool, 0);
+
+    if (!CheckResult(device_table_.BeginCommandBuffer(command_buffer, &begin_info), "vkBeginCommandBuffer"))
+    {
+        return false;
+    }
+
+    device_table_.CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_);
+
+    uint32_t push_constants[kPushConstantCount] = { thread_index, 0, 0, 0 };
+
+    // Each draw binds a descriptor set and updates the push constants, as draws of different objects do.
+    for (uint32_t i = 0; i < workload_.draw_count; ++i)
+    {
+        uint32_t set_index = ((thread_index * workload_.draw_count) + i) % kDescriptorSetCount;
+
+        push_constants[1] = i;
+
+        device_table_.CmdBindDescriptorSets(command_buffer,
+                                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                            pipeline_layout_,
+                                            0,
+                                            1,
+                                            &descriptor_sets_[set_index],
+                                            0,
+                                            nullptr);
+        device_table_.CmdPushConstants(
+            command_buffer, pipeline_layout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push_constants), push_constants);
+        device_table_.CmdDraw(command_buffer, 3, 1, 0, 0);
+    }
+
+    return CheckResult(device_table_.EndCommandBuffer(command_buffer), "vkEndCommandBuffer");
+}
+
+void WorkloadBenchmark::StopRecordingThreads()
+{
+    {
+        std::lock_guard<std::mutex> lock(thread_mutex_);
+        exit_threads_ = true;
+    }
+
+    record_condition_.notify_all();
+
+    for (auto& recording_thread : recording_threads_)
+    {
+        if (recording_thread.thread.joinable())
+        {
+            recording_thread.thread.join();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
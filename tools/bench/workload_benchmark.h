@@ -0,0 +1,220 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_WORKLOAD_BENCHMARK_H
+#define GFXRECON_WORKLOAD_BENCHMARK_H
+
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+#include "util/platform.h"
+
+#if defined(VK_USE_PLATFORM_HEADLESS)
+#include "application/headless_application.h"
+#include "application/headless_window.h"
+#endif
+
+#include "vulkan/vulkan.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Measures the frame time of a synthetic Vulkan workload without the capture layer, and with the capture layer for
+// combinations of capture settings, so that capture overhead can be compared between GFXReconstruct versions.  Each
+// frame updates descriptor sets, writes mapped memory, creates and destroys buffers, records secondary command buffers
+// with draws from multiple threads, and submits them.  When the headless surface extension is available, the frames
+// are presented to a swapchain, which the capture layer uses to count frames.  The draws are discarded before
+// rasterization, so the frame time is dominated by the CPU cost of the API calls that the capture layer intercepts.
+class WorkloadBenchmark
+{
+  public:
+    enum WritePattern
+    {
+        kWritePatternSequential, // Every page is written completely, in address order.
+        kWritePatternStrided,    // One value is written to every kStridePages page, in address order.
+        kWritePatternRandom      // One value is written to every page, in random order.
+    };
+
+    struct Workload
+    {
+        uint32_t     thread_count{ 4 };              // Threads that record secondary command buffers.
+        uint32_t     frame_count{ 300 };             // Measured frames, following the warm up frames.
+        uint32_t     draw_count{ 1000 };             // Draws recorded by each thread per frame.
+        uint32_t     descriptor_update_count{ 256 }; // Descriptor sets updated per frame.
+        uint32_t     churn_count{ 16 };              // Buffers created and destroyed per frame.
+        size_t       write_size{ 16 * 1024 * 1024 }; // Size of the mapped memory written per frame.
+        WritePattern write_pattern{ kWritePatternSequential };
+    };
+
+  public:
+    WorkloadBenchmark(const Workload& workload);
+
+    ~WorkloadBenchmark();
+
+    void Run();
+
+    static bool ParseWritePattern(const std::string& value, WritePattern* pattern);
+
+  private:
+    struct Setting
+    {
+        const char* name; // Capture setting environment variable name, without the prefix.
+        std::string value;
+    };
+
+    struct Configuration
+    {
+        const char*          name;
+        bool                 enable_layer;
+        std::vector<Setting> settings;
+    };
+
+    struct Buffer
+    {
+        VkBuffer       buffer{ VK_NULL_HANDLE };
+        VkDeviceMemory memory{ VK_NULL_HANDLE };
+    };
+
+    struct RecordingThread
+    {
+        VkCommandPool   command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer command_buffer{ VK_NULL_HANDLE };
+        std::thread     thread;
+    };
+
+  private:
+    bool IsLayerAvailable() const;
+
+    // Runs the workload with the settings of the configuration, and returns the measured frame times in nanoseconds.
+    bool RunConfiguration(const Configuration& configuration, std::vector<int64_t>* frame_times);
+
+    // Sets the capture setting environment variables, saving their previous values in previous_settings.
+    void ApplySettings(const std::vector<Setting>& settings, std::vector<Setting>* previous_settings);
+
+    void RestoreSettings(const std::vector<Setting>& previous_settings);
+
+    bool CreateInstance(bool enable_layer);
+
+    bool CreateDevice();
+
+    bool CreateSwapchain();
+
+    bool CreateRenderTarget();
+
+    bool CreatePipeline();
+
+    bool CreateDescriptorSets();
+
+    bool CreateMappedMemory();
+
+    bool CreateCommandBuffers();
+
+    void DestroyObjects();
+
+    bool CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, Buffer* buffer);
+
+    void DestroyBuffer(Buffer* buffer);
+
+    uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags properties) const;
+
+    bool RunFrame(uint32_t frame_index);
+
+    void UpdateDescriptorSets(uint32_t frame_index);
+
+    void WriteMappedMemory(uint32_t frame_index);
+
+    void RecordingThreadMain(uint32_t thread_index);
+
+    bool RecordSecondaryCommands(uint32_t thread_index);
+
+    void StopRecordingThreads();
+
+  private:
+    Workload                      workload_;
+    util::platform::LibraryHandle loader_handle_;
+    PFN_vkGetInstanceProcAddr     get_instance_proc_addr_;
+    std::vector<size_t>           write_offsets_;
+
+#if defined(VK_USE_PLATFORM_HEADLESS)
+    std::unique_ptr<application::HeadlessApplication>   application_;
+    std::unique_ptr<application::HeadlessWindowFactory> window_factory_;
+    decode::Window*                                     window_;
+#endif
+
+    VkInstance                          instance_;
+    encode::InstanceTable               instance_table_;
+    VkPhysicalDevice                    physical_device_;
+    VkPhysicalDeviceMemoryProperties    memory_properties_;
+    VkDevice                            device_;
+    encode::DeviceTable                 device_table_;
+    uint32_t                            queue_family_index_;
+    VkQueue                             queue_;
+    VkSurfaceKHR                        surface_;
+    VkSwapchainKHR                      swapchain_;
+    VkFormat                            color_format_;
+    VkExtent2D                          extent_;
+    VkImage                             offscreen_image_;
+    VkDeviceMemory                      offscreen_memory_;
+    std::vector<VkImage>                images_;
+    std::vector<VkImageView>            image_views_;
+    std::vector<VkFramebuffer>          framebuffers_;
+    std::vector<VkSemaphore>            present_semaphores_;
+    VkSemaphore                         acquire_semaphore_;
+    VkFence                             fence_;
+    VkRenderPass                        render_pass_;
+    VkDescriptorSetLayout               descriptor_set_layout_;
+    VkPipelineLayout                    pipeline_layout_;
+    VkShaderModule                      shader_module_;
+    VkPipeline                          pipeline_;
+    VkDescriptorPool                    descriptor_pool_;
+    std::vector<VkDescriptorSet>        descriptor_sets_;
+    std::vector<VkDescriptorBufferInfo> descriptor_buffer_infos_;
+    std::vector<VkWriteDescriptorSet>   descriptor_writes_;
+    Buffer                              uniform_buffer_;
+    Buffer                              mapped_buffer_;
+    uint8_t*                            mapped_data_;
+    std::vector<Buffer>                 churn_buffers_;
+    VkCommandPool                       command_pool_;
+    VkCommandBuffer                     command_buffer_;
+    std::vector<RecordingThread>        recording_threads_;
+    std::vector<VkCommandBuffer>        secondary_command_buffers_;
+    uint32_t                            image_index_;
+
+    std::mutex              thread_mutex_;
+    std::condition_variable record_condition_;
+    std::condition_variable complete_condition_;
+    uint64_t                record_serial_;
+    uint32_t                complete_count_;
+    bool                    record_error_;
+    bool                    exit_threads_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_WORKLOAD_BENCHMARK_H
@@ -50,7 +50,7 @@ def UsageMsg():
            '                           [--log-file <file>]' + os.linesep)
     if sys.platform == 'win32':
         msg += '                           [--log-debugview]' + os.linesep
-    msg += '                           [--memory-tracking-mode {page_guard,assisted,unassisted}]' + os.linesep
+    msg += '                           [--memory-tracking-mode {page_guard,userfaultfd,soft_dirty,assisted,unassisted}]' + os.linesep
     msg += '                           <program> [<programArgs>]'
     return msg
 
@@ -89,7 +89,7 @@ def ParseArgs():
     triggerKeyChoices = ['F1','F2','F3','F4','F5','F6','F7','F8','F9','F10','F11','F12','TAB','CTRL']
     compressionTypeChoices = ['LZ4','ZLIB','ZSTD','NONE']
     logLevelChoices = ['debug','info','warn','error','fatal']
-    memoryTrackingModeChoices = ['page_guard','assisted','unassisted']
+    memoryTrackingModeChoices = ['page_guard','userfaultfd','soft_dirty','assisted','unassisted']
 
     parser = argparse.ArgumentParser(prog=os.path.basename(sys.argv[0]), description='Create a capture of a Vulkan program.', usage=UsageMsg(), allow_abbrev=False, formatter_class=SmartFormatter)
 
@@ -108,6 +108,10 @@ def ParseArgs():
     parser.add_argument('--memory-tracking-mode', dest='memoryTrackingMode', choices=memoryTrackingModeChoices , help=
                         'R|Method to use to track changes to memory mapped objects:' + os.linesep +
                         '   page_guard: use pageguard to track changes (default)' + os.linesep +
+                        '   userfaultfd: use userfaultfd write protection to track' + os.linesep +
+                        '      changes (Linux only)' + os.linesep +
+                        '   soft_dirty: scan soft-dirty page bits to track changes' + os.linesep +
+                        '      (Linux only)' + os.linesep +
                         '   assisted: application will call vkFlushMappedMemoryRanges' + os.linesep +
                         '      for memory to be written to the capture file' + os.linesep +
                         '   unassisted: all mapped memory will be written to the' + os.linesep +
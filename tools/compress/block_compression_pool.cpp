@@ -0,0 +1,153 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "block_compression_pool.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+BlockCompressionPool::BlockCompressionPool(std::vector<std::unique_ptr<util::Compressor>>&& compressors) :
+    compressors_(std::move(compressors)), submitted_size_(0), shutdown_(false)
+{
+    for (const auto& compressor : compressors_)
+    {
+        assert(compressor != nullptr);
+        worker_threads_.emplace_back(&BlockCompressionPool::CompressBlocks, this, compressor.get());
+    }
+}
+
+BlockCompressionPool::~BlockCompressionPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    pending_block_available_.notify_all();
+
+    for (auto& worker_thread : worker_threads_)
+    {
+        worker_thread.join();
+    }
+}
+
+BlockCompressionPool::Block* BlockCompressionPool::AcquireBlock()
+{
+    // Only the submitting thread allocates and frees blocks.
+    if (free_blocks_.empty())
+    {
+        blocks_.emplace_back();
+        return &blocks_.back();
+    }
+
+    Block* block = free_blocks_.back();
+    free_blocks_.pop_back();
+    return block;
+}
+
+void BlockCompressionPool::Submit(Block* block)
+{
+    assert(block != nullptr);
+
+    block->compressed_size = 0;
+    block->pending         = true;
+
+    submitted_blocks_.push_back(block);
+    submitted_size_ += block->data_size;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_blocks_.push_back(block);
+    }
+
+    pending_block_available_.notify_one();
+}
+
+BlockCompressionPool::Block* BlockCompressionPool::GetCompletedBlock(bool wait)
+{
+    if (submitted_blocks_.empty())
+    {
+        return nullptr;
+    }
+
+    Block* block = submitted_blocks_.front();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if (wait)
+        {
+            block_completed_.wait(lock, [block]() { return !block->pending; });
+        }
+        else if (block->pending)
+        {
+            return nullptr;
+        }
+    }
+
+    submitted_blocks_.pop_front();
+    submitted_size_ -= block->data_size;
+
+    return block;
+}
+
+void BlockCompressionPool::ReleaseBlock(Block* block)
+{
+    assert((block != nullptr) && !block->pending);
+    free_blocks_.push_back(block);
+}
+
+void BlockCompressionPool::CompressBlocks(util::Compressor* compressor)
+{
+    for (;;)
+    {
+        Block* block = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            pending_block_available_.wait(lock, [this]() { return shutdown_ || !pending_blocks_.empty(); });
+
+            if (shutdown_)
+            {
+                break;
+            }
+
+            block = pending_blocks_.front();
+            pending_blocks_.pop_front();
+        }
+
+        size_t compressed_size = compressor->Compress(block->data_size, block->data.data(), &block->compressed_data, 0);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            // The payload is written uncompressed when compression does not reduce its size.
+            block->compressed_size = (compressed_size < block->data_size) ? compressed_size : 0;
+            block->pending         = false;
+        }
+
+        block_completed_.notify_one();
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,103 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_BLOCK_COMPRESSION_POOL_H
+#define GFXRECON_BLOCK_COMPRESSION_POOL_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Compresses the payloads of output file blocks with a pool of worker threads.  Blocks are submitted in file order and
+// are returned in the same order when their payloads have been compressed, so that they can be written to the output
+// file in order by the submitting thread.
+class BlockCompressionPool
+{
+  public:
+    // A block is written as the block header, followed by the prefix and the payload.  The compressed prefix and block
+    // type replace the uncompressed prefix and block type when compression reduces the size of the payload.
+    struct Block
+    {
+        format::BlockType    type{ format::BlockType::kUnknownBlock };
+        format::BlockType    compressed_type{ format::BlockType::kUnknownBlock };
+        std::vector<uint8_t> prefix;
+        std::vector<uint8_t> compressed_prefix;
+        std::vector<uint8_t> data;
+        size_t               data_size{ 0 };
+        std::vector<uint8_t> compressed_data;
+        size_t               compressed_size{ 0 }; // Zero when the payload is written uncompressed.
+        bool                 pending{ false };
+    };
+
+  public:
+    // Each worker thread compresses with its own compressor, because compressors are not thread safe.
+    BlockCompressionPool(std::vector<std::unique_ptr<util::Compressor>>&& compressors);
+
+    ~BlockCompressionPool();
+
+    // Returns an unused block.  Blocks are reused after they are released, so their buffers retain their capacity.
+    Block* AcquireBlock();
+
+    void Submit(Block* block);
+
+    // Returns the oldest submitted block, or nullptr if no blocks have been submitted.  When wait is false, nullptr is
+    // also returned if the block is still being compressed.  The block must be returned with ReleaseBlock() after it
+    // has been written.
+    Block* GetCompletedBlock(bool wait);
+
+    void ReleaseBlock(Block* block);
+
+    size_t GetSubmittedCount() const { return submitted_blocks_.size(); }
+
+    // Total payload size of the submitted blocks.
+    size_t GetSubmittedSize() const { return submitted_size_; }
+
+  private:
+    void CompressBlocks(util::Compressor* compressor);
+
+  private:
+    std::vector<std::unique_ptr<util::Compressor>> compressors_;
+    std::deque<Block>                              blocks_;
+    std::vector<Block*>                            free_blocks_;
+    std::deque<Block*>                             submitted_blocks_; // Accessed only by the submitting thread.
+    size_t                                         submitted_size_;
+    std::deque<Block*>                             pending_blocks_;
+    bool                                           shutdown_;
+    std::mutex                                     mutex_;
+    std::condition_variable                        pending_block_available_;
+    std::condition_variable                        block_completed_;
+    std::vector<std::thread>                       worker_threads_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_BLOCK_COMPRESSION_POOL_H
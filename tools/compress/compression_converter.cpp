@@ -28,11 +28,23 @@
 
 #include <cassert>
 #include <numeric>
+#include <utility>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+// Limits for the blocks held by the compression pool, which are written when a limit is reached.
+const size_t kMaxPooledBlocksPerThread = 4;
+const size_t kMaxPooledSize            = 256 * 1024 * 1024;
+
+// Returns the data of a block header struct that follows the BlockHeader.
+template <typename T>
+static const uint8_t* GetBlockPrefix(const T& header)
+{
+    return reinterpret_cast<const uint8_t*>(&header) + sizeof(format::BlockHeader);
+}
+
 CompressionConverter::CompressionConverter() :
-    decompressing_(true), target_compression_type_(format::CompressionType::kNone)
+    decompressing_(true), target_compression_type_(format::CompressionType::kNone), compression_threads_(0)
 {}
 
 CompressionConverter::~CompressionConverter() {}
@@ -41,7 +53,38 @@ bool CompressionConverter::Initialize(const std::string&      input_filename,
                                       const std::string&      output_filename,
                                       format::CompressionType target_compression_type)
 {
-    bool success = CreateCompressor(target_compression_type, &target_compressor_);
+    bool success = CreateCompressor(target_compression_type, &target_compressor_, target_compressor_options_);
+
+    if (success && !target_dictionary_.empty())
+    {
+        if ((target_compressor_ == nullptr) || !target_compressor_->SetDictionary(target_dictionary_))
+        {
+            GFXRECON_LOG_ERROR("The target compression type does not support compression dictionaries");
+            success = false;
+        }
+    }
+
+    if (success && (compression_threads_ > 0) && (target_compressor_ != nullptr))
+    {
+        std::vector<std::unique_ptr<util::Compressor>> compressors(compression_threads_);
+
+        for (auto& compressor : compressors)
+        {
+            success = CreateCompressor(target_compression_type, &compressor, target_compressor_options_) &&
+                      (target_dictionary_.empty() || compressor->SetDictionary(target_dictionary_));
+
+            if (!success)
+            {
+                GFXRECON_LOG_ERROR("Failed to create the compressors for the compression threads");
+                break;
+            }
+        }
+
+        if (success)
+        {
+            compression_pool_ = std::make_unique<BlockCompressionPool>(std::move(compressors));
+        }
+    }
 
     if (success)
     {
@@ -68,7 +111,15 @@ bool CompressionConverter::WriteFileHeader(const format::FileHeader&
         }
     }
 
-    return FileTransformer::WriteFileHeader(header, output_options);
+    bool success = FileTransformer::WriteFileHeader(header, output_options);
+
+    if (success && !decompressing_ && !target_dictionary_.empty())
+    {
+        // The dictionary must precede all of the blocks that were compressed with it.
+        success = WriteCompressionDictionary(target_dictionary_);
+    }
+
+    return success;
 }
 
 bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
@@ -153,6 +204,16 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     {
         return WriteInitImageMetaData(block_header, meta_type);
     }
+    else if (meta_type == format::MetaDataType::kSetBlobDataCommand)
+    {
+        return WriteBlobDataMetaData(block_header, meta_type);
+    }
+    else if (meta_type == format::MetaDataType::kSetCompressionDictionaryCommand)
+    {
+        // The source dictionary is only needed to decompress the source blocks, which are recompressed with the target
+        // compression type, so it is not copied to the new file.
+        return ReadCompressionDictionary(block_header);
+    }
     else
     {
         // The current block should not be compressed.  If it is compressed, it is most likely a new block type that is
@@ -164,89 +225,53 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
             return false;
         }
 
-        return FileTransformer::ProcessMetaData(block_header, meta_type);
+        return WriteDeferredBlocks() && FileTransformer::ProcessMetaData(block_header, meta_type);
     }
 }
 
-bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size)
+bool CompressionConverter::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
 {
-    bool        write_uncompressed = decompressing_;
-    const auto& buffer             = GetParameterBuffer();
+    return WriteDeferredBlocks() && FileTransformer::ProcessStateMarker(block_header, marker_type);
+}
 
-    if (!write_uncompressed)
+bool CompressionConverter::WriteDeferredBlocks()
+{
+    if (compression_pool_ != nullptr)
     {
-        assert(target_compressor_ != nullptr);
-
-        // Compress the buffer with the new compression format and write to the new file.
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t packet_size       = 0;
-        size_t compressed_size   = target_compressor_->Compress(buffer_size, buffer.data(), &compressed_buffer, 0);
+        BlockCompressionPool::Block* block = nullptr;
 
-        if (0 < compressed_size && compressed_size < buffer_size)
+        while ((block = compression_pool_->GetCompletedBlock(true)) != nullptr)
         {
-            format::CompressedFunctionCallHeader compressed_func_call_header = {};
-            compressed_func_call_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
-            compressed_func_call_header.api_call_id       = call_id;
-            compressed_func_call_header.thread_id         = thread_id;
-            compressed_func_call_header.uncompressed_size = buffer_size;
-
-            packet_size += sizeof(compressed_func_call_header.api_call_id) +
-                           sizeof(compressed_func_call_header.thread_id) +
-                           sizeof(compressed_func_call_header.uncompressed_size) + compressed_size;
-
-            compressed_func_call_header.block_header.size = packet_size;
-
-            if (!WriteBytes(&compressed_func_call_header, sizeof(compressed_func_call_header)))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockHeader,
-                                      "Failed to write compressed function call block header");
-                return false;
-            }
-
-            if (!WriteBytes(compressed_buffer.data(), compressed_size))
+            if (!WritePooledBlock(block))
             {
-                HandleBlockWriteError(kErrorWritingCompressedBlockData,
-                                      "Failed to write compressed function call block data");
                 return false;
             }
         }
-        else
-        {
-            // It's bigger compressed than uncompressed, so write the uncompressed data.
-            write_uncompressed = true;
-        }
-    }
-
-    if (write_uncompressed)
-    {
-        // Buffer is currently not compressed; it was decompressed prior to this call.
-        format::FunctionCallHeader func_call_header = {};
-        size_t                     packet_size      = 0;
-
-        func_call_header.block_header.type = format::BlockType::kFunctionCallBlock;
-        func_call_header.api_call_id       = call_id;
-        func_call_header.thread_id         = thread_id;
-
-        packet_size += sizeof(func_call_header.api_call_id) + sizeof(func_call_header.thread_id) + buffer_size;
-
-        func_call_header.block_header.size = packet_size;
-
-        if (!WriteBytes(&func_call_header, sizeof(func_call_header)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write function call block header");
-            return false;
-        }
-
-        if (!WriteBytes(buffer.data(), buffer_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write function call block data");
-            return false;
-        }
     }
 
     return true;
 }
 
+bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size)
+{
+    format::FunctionCallHeader func_call_header = {};
+    func_call_header.api_call_id                = call_id;
+    func_call_header.thread_id                  = thread_id;
+
+    format::CompressedFunctionCallHeader compressed_func_call_header = {};
+    compressed_func_call_header.api_call_id                          = call_id;
+    compressed_func_call_header.thread_id                            = thread_id;
+    compressed_func_call_header.uncompressed_size                    = buffer_size;
+
+    return WriteBlock(format::BlockType::kFunctionCallBlock,
+                      GetBlockPrefix(func_call_header),
+                      sizeof(func_call_header) - sizeof(func_call_header.block_header),
+                      format::BlockType::kCompressedFunctionCallBlock,
+                      GetBlockPrefix(compressed_func_call_header),
+                      sizeof(compressed_func_call_header) - sizeof(compressed_func_call_header.block_header),
+                      buffer_size);
+}
+
 bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& block_header,
                                                    format::MetaDataType       meta_type)
 {
@@ -288,44 +313,17 @@ bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& bl
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
-        fill_cmd.meta_header.meta_data_type    = meta_type;
-
-        if (!decompressing_)
-        {
-            assert(target_compressor_ != nullptr);
-
-            auto&  compressed_buffer = GetCompressedParameterBuffer();
-            size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
-
-            if ((compressed_size > 0) && (compressed_size < data_size))
-            {
-                // We don't have a special header for compressed fill commands because the header always includes
-                // the uncompressed size, so we just change the type to indicate the data is compressed.
-                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                data_address = compressed_buffer.data();
-                data_size    = compressed_size;
-            }
-        }
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + data_size;
-
-        if (!WriteBytes(&fill_cmd, sizeof(fill_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory meta-data block");
-            return false;
-        }
+        fill_cmd.meta_header.meta_data_type = meta_type;
+
+        // We don't have a special header for compressed fill commands because the header always includes the
+        // uncompressed size, so we just change the type to indicate the data is compressed.
+        return WriteBlock(format::BlockType::kMetaDataBlock,
+                          GetBlockPrefix(fill_cmd),
+                          format::GetMetaDataBlockBaseSize(fill_cmd),
+                          format::BlockType::kCompressedMetaDataBlock,
+                          GetBlockPrefix(fill_cmd),
+                          format::GetMetaDataBlockBaseSize(fill_cmd),
+                          data_size);
     }
     else
     {
@@ -377,50 +375,75 @@ bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& bl
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
+        init_cmd.meta_header.meta_data_type = meta_type;
 
-        init_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-        init_cmd.meta_header.meta_data_type    = meta_type;
+        return WriteBlock(format::BlockType::kMetaDataBlock,
+                          GetBlockPrefix(init_cmd),
+                          format::GetMetaDataBlockBaseSize(init_cmd),
+                          format::BlockType::kCompressedMetaDataBlock,
+                          GetBlockPrefix(init_cmd),
+                          format::GetMetaDataBlockBaseSize(init_cmd),
+                          data_size);
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init buffer meta-data block header");
+        return false;
+    }
 
-        if (!decompressing_)
-        {
-            assert(target_compressor_ != nullptr);
+    return true;
+}
 
-            auto&  compressed_buffer = GetCompressedParameterBuffer();
-            size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
+bool CompressionConverter::WriteBlobDataMetaData(const format::BlockHeader& block_header,
+                                                 format::MetaDataType       meta_type)
+{
+    assert(meta_type == format::MetaDataType::kSetBlobDataCommand);
 
-            if ((compressed_size > 0) && (compressed_size < data_size))
-            {
-                init_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+    format::SetBlobDataCommandHeader blob_cmd;
 
-                data_address = compressed_buffer.data();
-                data_size    = compressed_size;
-            }
-        }
+    bool success = ReadBytes(&blob_cmd.thread_id, sizeof(blob_cmd.thread_id));
+    success      = success && ReadBytes(&blob_cmd.blob_id, sizeof(blob_cmd.blob_id));
+    success      = success && ReadBytes(&blob_cmd.data_size, sizeof(blob_cmd.data_size));
 
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd) + data_size;
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read blob data meta-data block header");
+        return false;
+    }
 
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init buffer meta-data block header");
-            return false;
-        }
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, blob_cmd.data_size);
+
+    size_t data_size = static_cast<size_t>(blob_cmd.data_size);
 
-        if (!WriteBytes(data_address, data_size))
+    if (format::IsBlockCompressed(block_header.type))
+    {
+        size_t uncompressed_size = 0;
+        size_t compressed_size   = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(blob_cmd));
+
+        if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init buffer meta-data block");
+            HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read blob data meta-data block");
             return false;
         }
+
+        assert(uncompressed_size == data_size);
     }
-    else
+    else if (!ReadParameterBuffer(data_size))
     {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init buffer meta-data block header");
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read blob data meta-data block");
         return false;
     }
 
-    return true;
+    blob_cmd.meta_header.meta_data_type = meta_type;
+
+    // The header includes the uncompressed size, so only the block type changes for compressed data.
+    return WriteBlock(format::BlockType::kMetaDataBlock,
+                      GetBlockPrefix(blob_cmd),
+                      format::GetMetaDataBlockBaseSize(blob_cmd),
+                      format::BlockType::kCompressedMetaDataBlock,
+                      GetBlockPrefix(blob_cmd),
+                      format::GetMetaDataBlockBaseSize(blob_cmd),
+                      data_size);
 }
 
 bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& block_header,
@@ -449,17 +472,16 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
 
     if (success)
     {
-        // Packet size without the resource data.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd);
-        init_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-        init_cmd.meta_header.meta_data_type    = meta_type;
+        init_cmd.meta_header.meta_data_type = meta_type;
+
+        size_t data_size = 0;
 
         if (init_cmd.data_size > 0)
         {
             assert(init_cmd.data_size == std::accumulate(level_sizes.begin(), level_sizes.end(), 0ull));
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, init_cmd.data_size);
 
-            size_t data_size = static_cast<size_t>(init_cmd.data_size);
+            data_size = static_cast<size_t>(init_cmd.data_size);
 
             if (format::IsBlockCompressed(block_header.type))
             {
@@ -483,72 +505,169 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
                     return false;
                 }
             }
+        }
+        else
+        {
+            // Write a packet without resource data; replay must still perform a layout transition at image
+            // initialization.
+            init_cmd.data_size   = 0;
+            init_cmd.level_count = 0;
+            levels_size          = 0;
+        }
+
+        // The level sizes precede the resource data.
+        const uint8_t*       header_data = GetBlockPrefix(init_cmd);
+        std::vector<uint8_t> prefix(header_data, header_data + format::GetMetaDataBlockBaseSize(init_cmd));
+        prefix.insert(prefix.end(),
+                      reinterpret_cast<const uint8_t*>(level_sizes.data()),
+                      reinterpret_cast<const uint8_t*>(level_sizes.data()) + levels_size);
+
+        return WriteBlock(format::BlockType::kMetaDataBlock,
+                          prefix.data(),
+                          prefix.size(),
+                          format::BlockType::kCompressedMetaDataBlock,
+                          prefix.data(),
+                          prefix.size(),
+                          data_size);
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init image meta-data block header");
+        return false;
+    }
+
+    return true;
+}
 
-            const auto&    buffer       = GetParameterBuffer();
-            const uint8_t* data_address = buffer.data();
+bool CompressionConverter::WriteBlock(format::BlockType type,
+                                      const void*       prefix,
+                                      size_t            prefix_size,
+                                      format::BlockType compressed_type,
+                                      const void*       compressed_prefix,
+                                      size_t            compressed_prefix_size,
+                                      size_t            data_size)
+{
+    auto& buffer = GetParameterBuffer();
 
-            init_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            init_cmd.meta_header.meta_data_type    = meta_type;
+    if (decompressing_ || (data_size == 0))
+    {
+        return WriteDeferredBlocks() && WriteBlockData(type, prefix, prefix_size, buffer.data(), data_size);
+    }
 
-            if (!decompressing_)
+    if (compression_pool_ != nullptr)
+    {
+        // Write the oldest blocks when the pool holds too much data, waiting for them to be compressed.
+        while ((compression_pool_->GetSubmittedCount() >= (kMaxPooledBlocksPerThread * compression_threads_)) ||
+               (compression_pool_->GetSubmittedSize() >= kMaxPooledSize))
+        {
+            if (!WritePooledBlock(compression_pool_->GetCompletedBlock(true)))
             {
-                assert(target_compressor_ != nullptr);
+                return false;
+            }
+        }
 
-                auto&  compressed_buffer = GetCompressedParameterBuffer();
-                size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
+        BlockCompressionPool::Block* block = compression_pool_->AcquireBlock();
 
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    init_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+        block->type            = type;
+        block->compressed_type = compressed_type;
+        block->prefix.assign(static_cast<const uint8_t*>(prefix), static_cast<const uint8_t*>(prefix) + prefix_size);
+        block->compressed_prefix.assign(static_cast<const uint8_t*>(compressed_prefix),
+                                        static_cast<const uint8_t*>(compressed_prefix) + compressed_prefix_size);
 
-                    data_address = compressed_buffer.data();
-                    data_size    = compressed_size;
-                }
-            }
+        // The pool takes the parameter buffer, and the block's old data buffer is reused for the next block.
+        std::swap(block->data, buffer);
+        block->data_size = data_size;
 
-            // Calculate size of packet with compressed or uncompressed data size.
-            init_cmd.meta_header.block_header.size =
-                format::GetMetaDataBlockBaseSize(init_cmd) + levels_size + data_size;
+        compression_pool_->Submit(block);
 
-            if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
+        // Write the blocks that have already been compressed, without waiting for the rest.
+        while ((block = compression_pool_->GetCompletedBlock(false)) != nullptr)
+        {
+            if (!WritePooledBlock(block))
             {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
                 return false;
             }
+        }
 
-            if (!WriteBytes(level_sizes.data(), levels_size))
-            {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block");
-                return false;
-            }
+        return true;
+    }
 
-            if (!WriteBytes(data_address, data_size))
-            {
-                HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init image meta-data block");
-                return false;
-            }
+    assert(target_compressor_ != nullptr);
+
+    auto&  compressed_buffer = GetCompressedParameterBuffer();
+    size_t compressed_size   = target_compressor_->Compress(data_size, buffer.data(), &compressed_buffer, 0);
+
+    if ((compressed_size > 0) && (compressed_size < data_size))
+    {
+        return WriteBlockData(
+            compressed_type, compressed_prefix, compressed_prefix_size, compressed_buffer.data(), compressed_size);
+    }
+
+    // It's bigger compressed than uncompressed, so write the uncompressed data.
+    return WriteBlockData(type, prefix, prefix_size, buffer.data(), data_size);
+}
+
+bool CompressionConverter::WriteBlockData(
+    format::BlockType type, const void* prefix, size_t prefix_size, const void* data, size_t data_size)
+{
+    format::BlockHeader block_header;
+    block_header.size = prefix_size + data_size;
+    block_header.type = type;
+
+    if (!WriteBytes(&block_header, sizeof(block_header)) || !WriteBytes(prefix, prefix_size))
+    {
+        if (format::IsBlockCompressed(type))
+        {
+            HandleBlockWriteError(kErrorWritingCompressedBlockHeader, "Failed to write compressed block header");
         }
         else
         {
-            // Write a packet without resource data; replay must still perform a layout transition at image
-            // initialization.
-            init_cmd.data_size   = 0;
-            init_cmd.level_count = 0;
-
-            if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-            {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
-                return false;
-            }
+            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write block header");
         }
+
+        return false;
     }
-    else
+
+    if ((data_size > 0) && !WriteBytes(data, data_size))
     {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init image meta-data block header");
+        if (format::IsBlockCompressed(type))
+        {
+            HandleBlockWriteError(kErrorWritingCompressedBlockData, "Failed to write compressed block data");
+        }
+        else
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write block data");
+        }
+
         return false;
     }
 
     return true;
 }
 
+bool CompressionConverter::WritePooledBlock(BlockCompressionPool::Block* block)
+{
+    assert(block != nullptr);
+
+    bool success = false;
+
+    if (block->compressed_size > 0)
+    {
+        success = WriteBlockData(block->compressed_type,
+                                 block->compressed_prefix.data(),
+                                 block->compressed_prefix.size(),
+                                 block->compressed_data.data(),
+                                 block->compressed_size);
+    }
+    else
+    {
+        success = WriteBlockData(
+            block->type, block->prefix.data(), block->prefix.size(), block->data.data(), block->data_size);
+    }
+
+    compression_pool_->ReleaseBlock(block);
+
+    return success;
+}
+
 GFXRECON_END_NAMESPACE(gfxrecon)
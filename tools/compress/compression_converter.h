@@ -24,12 +24,16 @@
 #ifndef GFXRECON_COMPRESSION_CONVERTER_H
 #define GFXRECON_COMPRESSION_CONVERTER_H
 
+#include "block_compression_pool.h"
+
 #include "decode/file_transformer.h"
 #include "format/format.h"
+#include "format/format_util.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
 #include <memory>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
@@ -40,6 +44,16 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual ~CompressionConverter() override;
 
+    // Compress the output file with the specified dictionary.  Must be set before Initialize() is called.
+    void SetCompressionDictionary(const std::vector<uint8_t>& dictionary) { target_dictionary_ = dictionary; }
+
+    // When non-zero, the payloads of the output blocks are compressed concurrently by a pool of worker threads, and the
+    // blocks are written in file order.  Must be set before Initialize() is called.
+    void SetCompressionThreads(uint32_t compression_threads) { compression_threads_ = compression_threads; }
+
+    // Compression level settings for the output file.  Must be set before Initialize() is called.
+    void SetCompressorOptions(const format::CompressorOptions& options) { target_compressor_options_ = options; }
+
     bool Initialize(const std::string&      input_filename,
                     const std::string&      output_filename,
                     format::CompressionType target_compression_type);
@@ -52,6 +66,10 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type) override;
 
+    virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type) override;
+
+    virtual bool WriteDeferredBlocks() override;
+
   private:
     bool WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size);
 
@@ -61,10 +79,32 @@ class CompressionConverter : public decode::FileTransformer
 
     bool WriteInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
 
+    bool WriteBlobDataMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
+
+    // Writes a block with the payload from the parameter buffer, compressed with the target compression type when that
+    // reduces its size.  The prefix is the block data that precedes the payload, which depends on whether the payload
+    // is compressed.  When compression threads are enabled, the block is written after its payload is compressed.
+    bool WriteBlock(format::BlockType type,
+                    const void*       prefix,
+                    size_t            prefix_size,
+                    format::BlockType compressed_type,
+                    const void*       compressed_prefix,
+                    size_t            compressed_prefix_size,
+                    size_t            data_size);
+
+    bool WriteBlockData(
+        format::BlockType type, const void* prefix, size_t prefix_size, const void* data, size_t data_size);
+
+    bool WritePooledBlock(BlockCompressionPool::Block* block);
+
   private:
-    bool                              decompressing_;
-    format::CompressionType           target_compression_type_;
-    std::unique_ptr<util::Compressor> target_compressor_;
+    bool                                  decompressing_;
+    format::CompressionType               target_compression_type_;
+    std::unique_ptr<util::Compressor>     target_compressor_;
+    format::CompressorOptions             target_compressor_options_;
+    std::vector<uint8_t>                  target_dictionary_;
+    uint32_t                              compression_threads_;
+    std::unique_ptr<BlockCompressionPool> compression_pool_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,48 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "dictionary_sample_decoder.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+DictionarySampleDecoder::DictionarySampleDecoder(size_t max_sample_data_size) :
+    max_sample_data_size_(max_sample_data_size)
+{}
+
+DictionarySampleDecoder::~DictionarySampleDecoder() {}
+
+void DictionarySampleDecoder::DecodeFunctionCall(format::ApiCallId          call_id,
+                                                 const decode::ApiCallInfo& call_info,
+                                                 const uint8_t*             parameter_buffer,
+                                                 size_t                     buffer_size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(call_id);
+    GFXRECON_UNREFERENCED_PARAMETER(call_info);
+
+    if ((buffer_size > 0) && ((sample_data_.size() + buffer_size) <= max_sample_data_size_))
+    {
+        sample_data_.insert(sample_data_.end(), parameter_buffer, parameter_buffer + buffer_size);
+        sample_sizes_.push_back(buffer_size);
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
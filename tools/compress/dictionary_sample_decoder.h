@@ -0,0 +1,61 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DICTIONARY_SAMPLE_DECODER_H
+#define GFXRECON_DICTIONARY_SAMPLE_DECODER_H
+
+#include "decode/vulkan_decoder_base.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Collects the uncompressed parameter data of function call blocks, to be used as samples for compression dictionary
+// training.
+class DictionarySampleDecoder : public decode::VulkanDecoderBase
+{
+  public:
+    // Sample collection stops when the total size of the collected samples reaches max_sample_data_size.
+    DictionarySampleDecoder(size_t max_sample_data_size);
+
+    virtual ~DictionarySampleDecoder() override;
+
+    virtual void DecodeFunctionCall(format::ApiCallId          call_id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             parameter_buffer,
+                                    size_t                     buffer_size) override;
+
+    const std::vector<uint8_t>& GetSampleData() const { return sample_data_; }
+
+    const std::vector<size_t>& GetSampleSizes() const { return sample_sizes_; }
+
+  private:
+    size_t               max_sample_data_size_;
+    std::vector<uint8_t> sample_data_;
+    std::vector<size_t>  sample_sizes_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DICTIONARY_SAMPLE_DECODER_H
@@ -23,24 +23,40 @@
 
 #include "project_version.h"
 #include "compression_converter.h"
+#include "dictionary_sample_decoder.h"
 
 #include "decode/file_processor.h"
 #include "format/format.h"
+#include "format/format_util.h"
 #include "util/argument_parser.h"
 #include "util/compressor.h"
 #include "util/logging.h"
 
+#if defined(ENABLE_ZSTD_COMPRESSION)
+#include "util/zstd_compressor.h"
+#endif
+
 #include "vulkan/vulkan_core.h"
 
 #include <cassert>
 #include <cstdlib>
+#include <thread>
 
 const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
 const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kIoUringOption[]   = "--io-uring";
+const char kLongOption[]      = "--long";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kDictionarySizeArgument[]       = "--dictionary-size";
+const char kDecompressionThreadsArgument[] = "--decompression-threads";
+const char kThreadsArgument[]              = "--threads";
+const char kLevelArgument[]                = "--level";
+const char kWorkersArgument[]              = "--workers";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--io-uring,--long";
+const char kArguments[] = "--dictionary-size,--decompression-threads,--threads,--level,--workers";
 
 const char kArgNone[]    = "NONE";
 const char kArgLz4[]     = "LZ4";
@@ -48,6 +64,9 @@ const char kArgZlib[]    = "ZLIB";
 const char kArgZstd[]    = "ZSTD";
 const char kArgUnknown[] = "<Unknown>";
 
+// Limit the amount of sample data collected for dictionary training to a multiple of the dictionary size.
+const size_t kDictionarySampleRatio = 100;
+
 static void PrintUsage(const char* exe_name)
 {
     std::string app_name     = exe_name;
@@ -58,11 +77,17 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to compress/decompress GFXReconstruct capture files.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input_file> <output_file> <compression_format>\n",
-                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE(
+        "  %s [-h | --help] [--version] [--io-uring] [--level <N>] [--long] [--workers <N>] "
+        "[--dictionary-size <bytes>] [--decompression-threads <N>] [--threads <N>] <input_file> <output_file> "
+        "<compression_format>\n",
+        app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
-    GFXRECON_WRITE_CONSOLE("  <input_file>\t\tPath to the input file to process.");
-    GFXRECON_WRITE_CONSOLE("  <output_file>\t\tPath to the output file to generate.");
+    GFXRECON_WRITE_CONSOLE("  <input_file>\t\tPath to the input file to process, or - to read the file from");
+    GFXRECON_WRITE_CONSOLE("                      \tstandard input.");
+    GFXRECON_WRITE_CONSOLE("  <output_file>\t\tPath to the output file to generate, or - to write the file to");
+    GFXRECON_WRITE_CONSOLE("                      \tstandard output.  Messages are then written to standard");
+    GFXRECON_WRITE_CONSOLE("                      \terror.");
     GFXRECON_WRITE_CONSOLE("  <compression_format>\tCompression format to apply to the output file.");
     GFXRECON_WRITE_CONSOLE("                      \tOptions are: ");
 #if defined(ENABLE_LZ4_COMPRESSION)
@@ -78,6 +103,35 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --io-uring\t\tWrite the output file with io_uring (Linux only).");
+    GFXRECON_WRITE_CONSOLE("  --level <N>\t\tCompression level of the output file, where 0 selects the default");
+    GFXRECON_WRITE_CONSOLE("        \t\tlevel of the compression format.  LZ4 levels below 0 select faster");
+    GFXRECON_WRITE_CONSOLE("        \t\tcompression with an acceleration of -N, and levels 3 to 12 select");
+    GFXRECON_WRITE_CONSOLE("        \t\tthe LZ4 HC compressor.  ZLIB levels are 1 to 9.  ZSTD levels are");
+    GFXRECON_WRITE_CONSOLE("        \t\t-5 (fastest) to 19 (best compression).");
+#if defined(ENABLE_ZSTD_COMPRESSION)
+    GFXRECON_WRITE_CONSOLE("  --long\t\tEnable long distance matching, which improves compression of");
+    GFXRECON_WRITE_CONSOLE("        \t\tlarge files with data that repeats across frames, at the cost of");
+    GFXRECON_WRITE_CONSOLE("        \t\tmemory and speed.  Requires the ZSTD compression format.");
+    GFXRECON_WRITE_CONSOLE("  --workers <N>\t\tCompress each block of 8 MiB or more with N worker threads, so");
+    GFXRECON_WRITE_CONSOLE("        \t\tthat large buffer and image data uses all cores.  Only applies to");
+    GFXRECON_WRITE_CONSOLE("        \t\tthe ZSTD compression format.  Default is the number of hardware");
+    GFXRECON_WRITE_CONSOLE("        \t\tthreads, and 0 disables worker threads.");
+#endif
+    GFXRECON_WRITE_CONSOLE("  --decompression-threads <N>");
+    GFXRECON_WRITE_CONSOLE("        \t\tRead the input file ahead of processing from a separate thread and");
+    GFXRECON_WRITE_CONSOLE("        \t\tdecompress up to N of its blocks concurrently, using a pool of N");
+    GFXRECON_WRITE_CONSOLE("        \t\tworker threads.");
+    GFXRECON_WRITE_CONSOLE("  --threads <N>\t\tCompress the blocks of the output file concurrently, using a");
+    GFXRECON_WRITE_CONSOLE("        \t\tpool of N worker threads.  The blocks are written in file order.");
+    GFXRECON_WRITE_CONSOLE("        \t\tAlso sets --decompression-threads to N, unless it is specified.");
+#if defined(ENABLE_ZSTD_COMPRESSION)
+    GFXRECON_WRITE_CONSOLE("  --dictionary-size <bytes>");
+    GFXRECON_WRITE_CONSOLE("        \t\tTrain a compression dictionary of up to the specified size from the");
+    GFXRECON_WRITE_CONSOLE("        \t\tAPI call data of the input file and use it to compress the output");
+    GFXRECON_WRITE_CONSOLE("        \t\tfile.  Requires the ZSTD compression format, and cannot be used");
+    GFXRECON_WRITE_CONSOLE("        \t\twhen the input file is read from standard input.");
+#endif
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -139,13 +193,52 @@ static std::string GetCompressionTypeName(uint32_t type)
     return kArgUnknown;
 }
 
+static bool TrainCompressionDictionary(const std::string&    input_filename,
+                                       size_t                dictionary_size,
+                                       uint32_t              decompression_threads,
+                                       std::vector<uint8_t>* dictionary)
+{
+    bool success = false;
+
+#if defined(ENABLE_ZSTD_COMPRESSION)
+    gfxrecon::decode::FileProcessor   file_processor;
+    gfxrecon::DictionarySampleDecoder decoder(dictionary_size * kDictionarySampleRatio);
+
+    file_processor.SetDecompressionThreads(decompression_threads);
+
+    if (file_processor.Initialize(input_filename))
+    {
+        file_processor.AddDecoder(&decoder);
+        file_processor.ProcessAllFrames();
+
+        if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+        {
+            GFXRECON_LOG_ERROR("Failed to read samples for dictionary training from %s", input_filename.c_str());
+        }
+        else
+        {
+            success = gfxrecon::util::ZstdCompressor::TrainDictionary(
+                decoder.GetSampleData(), decoder.GetSampleSizes(), dictionary_size, dictionary);
+        }
+    }
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(input_filename);
+    GFXRECON_UNREFERENCED_PARAMETER(dictionary_size);
+    GFXRECON_UNREFERENCED_PARAMETER(decompression_threads);
+    GFXRECON_UNREFERENCED_PARAMETER(dictionary);
+    GFXRECON_LOG_ERROR("Compression dictionaries require ZSTD compression support");
+#endif
+
+    return success;
+}
+
 int main(int argc, const char** argv)
 {
     int return_code = 0;
 
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -173,6 +266,11 @@ int main(int argc, const char** argv)
     std::string                     output_filename        = positional_arguments[1];
     std::string                     dst_compression_string = positional_arguments[2];
 
+    if (output_filename == "-")
+    {
+        gfxrecon::util::Log::SetOutputAllToStderr(true);
+    }
+
     gfxrecon::format::CompressionType compression_type = gfxrecon::format::kNone;
 
     if (gfxrecon::util::platform::StringCompareNoCase(kArgNone, dst_compression_string.c_str()) != 0)
@@ -200,6 +298,100 @@ int main(int argc, const char** argv)
 
     gfxrecon::CompressionConverter file_converter;
 
+    file_converter.SetUseIoUring(arg_parser.IsOptionSet(kIoUringOption));
+
+    gfxrecon::format::CompressorOptions compressor_options;
+    const std::string&                  level_string = arg_parser.GetArgumentValue(kLevelArgument);
+    if (!level_string.empty())
+    {
+        compressor_options.level = static_cast<int32_t>(std::strtol(level_string.c_str(), nullptr, 10));
+    }
+
+    if (arg_parser.IsOptionSet(kLongOption))
+    {
+        if (compression_type != gfxrecon::format::CompressionType::kZstd)
+        {
+            GFXRECON_LOG_ERROR("Long distance matching is only supported by the ZSTD compression format");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        compressor_options.long_distance_matching = true;
+    }
+
+    if (compression_type == gfxrecon::format::CompressionType::kZstd)
+    {
+        // Large blocks, such as the buffer and image data of a trimmed capture's state snapshot, are split into jobs
+        // for zstd worker threads, which would otherwise compress each block on a single core.
+        const std::string& workers_string = arg_parser.GetArgumentValue(kWorkersArgument);
+        if (!workers_string.empty())
+        {
+            compressor_options.worker_threads =
+                static_cast<uint32_t>(std::strtoul(workers_string.c_str(), nullptr, 10));
+        }
+        else
+        {
+            compressor_options.worker_threads = std::thread::hardware_concurrency();
+        }
+    }
+
+    file_converter.SetCompressorOptions(compressor_options);
+
+    uint32_t           threads        = 0;
+    const std::string& threads_string = arg_parser.GetArgumentValue(kThreadsArgument);
+    if (!threads_string.empty())
+    {
+        threads = static_cast<uint32_t>(std::strtoul(threads_string.c_str(), nullptr, 10));
+        file_converter.SetCompressionThreads(threads);
+    }
+
+    uint32_t           decompression_threads        = threads;
+    const std::string& decompression_threads_string = arg_parser.GetArgumentValue(kDecompressionThreadsArgument);
+    if (!decompression_threads_string.empty() &&
+        !gfxrecon::util::ParseUnsignedInteger(decompression_threads_string, &decompression_threads))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid decompression thread count \"%s\"",
+                             decompression_threads_string.c_str());
+    }
+
+    file_converter.SetDecompressionThreads(decompression_threads);
+
+    uint32_t           dictionary_size        = 0;
+    const std::string& dictionary_size_string = arg_parser.GetArgumentValue(kDictionarySizeArgument);
+    if (!dictionary_size_string.empty() &&
+        (!gfxrecon::util::ParseUnsignedInteger(dictionary_size_string, &dictionary_size) || (dictionary_size == 0)))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid dictionary size \"%s\"", dictionary_size_string.c_str());
+    }
+
+    if (dictionary_size > 0)
+    {
+        std::vector<uint8_t> dictionary;
+
+        if (compression_type != gfxrecon::format::CompressionType::kZstd)
+        {
+            GFXRECON_LOG_ERROR("Compression dictionaries are only supported by the ZSTD compression format");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+        else if (input_filename == "-")
+        {
+            // Training reads the input file once before it is converted.
+            GFXRECON_LOG_ERROR("Compression dictionaries cannot be trained from standard input");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+        else if (!TrainCompressionDictionary(input_filename, dictionary_size, decompression_threads, &dictionary))
+        {
+            GFXRECON_LOG_ERROR("Failed to create a compression dictionary from %s", input_filename.c_str());
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        GFXRECON_WRITE_CONSOLE("Trained a %" PRIuPTR " byte compression dictionary", dictionary.size());
+        file_converter.SetCompressionDictionary(dictionary);
+    }
+
     if (file_converter.Initialize(input_filename, output_filename, compression_type))
     {
         if (file_converter.Process())
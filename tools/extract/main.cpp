@@ -23,6 +23,8 @@
 #include "project_version.h"
 
 #include "decode/file_processor.h"
+#include "decode/frame_range_util.h"
+#include "decode/pnext_node.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_consumer.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -33,17 +35,31 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
 #include <cstdlib>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 const char kHelpShortOption[]   = "-h";
 const char kHelpLongOption[]    = "--help";
 const char kVersionOption[]     = "--version";
 const char kDirectoryArgument[] = "--dir";
+const char kFramesArgument[]    = "--frames";
+const char kThreadsArgument[]   = "--threads";
 const char kNoDebugPopup[]      = "--no-debug-popup";
 
 const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
-const char kArguments[] = "--dir";
+const char kArguments[] = "--dir,--frames,--threads";
+
+const char kManifestFileName[] = "manifest.txt";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -55,7 +71,8 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Extract shaders from a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--dir <dir>] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--dir <dir>] [--frames <range>] [--threads <N>] <file>\n",
+                           app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("Optional arguments:");
@@ -63,9 +80,16 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
     GFXRECON_WRITE_CONSOLE("  --dir <dir>\t\tPlace extracted shaders into directory <dir>. Otherwise");
     GFXRECON_WRITE_CONSOLE("             \t\tuse <file>.shaders in working directory. Create directory");
-    GFXRECON_WRITE_CONSOLE("             \t\tif necessary. Each shader is placed in individual file");
-    GFXRECON_WRITE_CONSOLE("             \t\tnamed sh<handle_id> where handle_id is handle id of the");
-    GFXRECON_WRITE_CONSOLE("             \t\tCreateShaderModule call. See gfxrecon-replay --replace-shaders.");
+    GFXRECON_WRITE_CONSOLE("             \t\tif necessary. Each unique shader is placed in an individual");
+    GFXRECON_WRITE_CONSOLE("             \t\tfile named sh<checksum>, where checksum is the checksum of");
+    GFXRECON_WRITE_CONSOLE("             \t\tthe shader code. See gfxrecon-replay --replace-shaders. The");
+    GFXRECON_WRITE_CONSOLE("             \t\tfile %s lists the file written for the handle id", kManifestFileName);
+    GFXRECON_WRITE_CONSOLE("             \t\tof each CreateShaderModule call.");
+    GFXRECON_WRITE_CONSOLE("  --frames <range>\tOnly process frames <first>[-<last>], where frames are");
+    GFXRECON_WRITE_CONSOLE("                \t\tnumbered from 1.  Frames before <first> are skipped with");
+    GFXRECON_WRITE_CONSOLE("                \t\tthe capture file seek index, when it is present.");
+    GFXRECON_WRITE_CONSOLE("  --threads <N>\t\tSplit the frames between N decode threads.  Requires the");
+    GFXRECON_WRITE_CONSOLE("             \t\tcapture file seek index.  Default is 1.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -108,10 +132,128 @@ static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::
     return false;
 }
 
+// Shader modules that have been extracted, shared by the consumers of all decode threads.  Modules with identical code
+// are written once, to a file named with the checksum that gfxrecon-replay --replace-shaders uses to find replacement
+// shaders.
+class ShaderModuleTable
+{
+  public:
+    ShaderModuleTable(const std::string& extract_dir) : extract_dir_(extract_dir) {}
+
+    void AddShaderModule(uint64_t handle_id, const uint32_t* code, size_t code_size)
+    {
+        uint64_t    hash       = gfxrecon::util::hash::Hash64(code, code_size);
+        bool        write_file = false;
+        std::string file_name;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto entry = files_.find(hash);
+            if (entry != files_.end())
+            {
+                file_name = entry->second;
+            }
+            else
+            {
+                uint32_t check_sum = gfxrecon::util::hash::CheckSum(code, code_size);
+
+                file_name  = "sh" + std::to_string(check_sum);
+                write_file = true;
+
+                if (!check_sums_.insert(check_sum).second)
+                {
+                    // Different code with the same checksum cannot be distinguished by gfxrecon-replay.
+                    file_name += "_" + std::to_string(hash);
+                    GFXRECON_LOG_WARNING("Shader module %" PRIu64 " has the same checksum as a different module, "
+                                         "writing it to %s",
+                                         handle_id,
+                                         file_name.c_str());
+                }
+
+                files_.emplace(hash, file_name);
+            }
+
+            manifest_[handle_id] = file_name;
+        }
+
+        if (write_file)
+        {
+            WriteFile(file_name, code, code_size);
+        }
+    }
+
+    // Writes the handle id of each shader module with the name of the file containing its code.
+    bool WriteManifest() const
+    {
+        std::string file_path = gfxrecon::util::filepath::Join(extract_dir_, kManifestFileName);
+        FILE*       fp        = nullptr;
+        int32_t     result    = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "w");
+
+        if (result != 0)
+        {
+            GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", kManifestFileName);
+            return false;
+        }
+
+        bool success = true;
+        for (const auto& entry : manifest_)
+        {
+            std::string line = std::to_string(entry.first) + " " + entry.second + "\n";
+            if (gfxrecon::util::platform::FilePuts(line.c_str(), fp) < 0)
+            {
+                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", kManifestFileName);
+                success = false;
+                break;
+            }
+        }
+
+        gfxrecon::util::platform::FileClose(fp);
+
+        return success;
+    }
+
+    size_t GetShaderModuleCount() const { return manifest_.size(); }
+
+    size_t GetFileCount() const { return files_.size(); }
+
+  private:
+    void WriteFile(const std::string& file_name, const uint32_t* code, size_t code_size)
+    {
+        std::string file_path = gfxrecon::util::filepath::Join(extract_dir_, file_name);
+        FILE*       fp        = nullptr;
+        int32_t     result    = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "wb");
+
+        if (result == 0)
+        {
+            size_t written_size = gfxrecon::util::platform::FileWrite(code, sizeof(char), code_size, fp);
+            if (written_size != code_size)
+            {
+                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", file_name.c_str());
+            }
+            gfxrecon::util::platform::FileClose(fp);
+        }
+        else
+        {
+            GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", file_name.c_str());
+        }
+    }
+
+  private:
+    std::string                               extract_dir_;
+    std::mutex                                mutex_;
+    std::unordered_map<uint64_t, std::string> files_;
+    std::unordered_set<uint32_t>              check_sums_;
+    std::map<uint64_t, std::string>           manifest_;
+};
+
 class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
 {
   public:
-    VulkanExtractConsumer(std::string& extract_dir) : extract_dir_(extract_dir) {}
+    VulkanExtractConsumer(ShaderModuleTable* shader_modules) : shader_modules_(shader_modules)
+    {
+        assert(shader_modules != nullptr);
+    }
 
     virtual void Process_vkCreateShaderModule(
         VkResult                                                                                    returnValue,
@@ -123,34 +265,51 @@ class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
         if ((returnValue >= 0) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pShaderModule != nullptr) &&
             !pShaderModule->IsNull())
         {
-            const uint32_t* orig_code = pCreateInfo->GetPointer()->pCode;
-            size_t          orig_size = pCreateInfo->GetPointer()->codeSize;
-            uint64_t        handle_id = *pShaderModule->GetPointer();
-            std::string     file_name = "sh" + std::to_string(handle_id);
-            std::string     file_path = gfxrecon::util::filepath::Join(extract_dir_, file_name);
-
-            FILE*   fp     = nullptr;
-            int32_t result = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "wb");
-            if (result == 0)
-            {
-                size_t written_size = gfxrecon::util::platform::FileWrite(orig_code, sizeof(char), orig_size, fp);
-                if (written_size != orig_size)
-                {
-                    GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", file_name.c_str());
-                }
-                gfxrecon::util::platform::FileClose(fp);
-            }
-            else
-            {
-                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", file_name.c_str());
-            }
+            shader_modules_->AddShaderModule(
+                *pShaderModule->GetPointer(), pCreateInfo->GetPointer()->pCode, pCreateInfo->GetPointer()->codeSize);
         }
     }
 
   private:
-    std::string extract_dir_;
+    ShaderModuleTable* shader_modules_;
 };
 
+// Decodes only vkCreateShaderModule, so that the file processor can skip the parameter data of the other calls without
+// decompressing it.
+class VulkanExtractDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    virtual bool SupportsApiCall(gfxrecon::format::ApiCallId call_id) override
+    {
+        return (call_id == gfxrecon::format::ApiCallId::ApiCall_vkCreateShaderModule);
+    }
+};
+
+static bool ExtractFrames(gfxrecon::decode::FileProcessor* file_processor,
+                          ShaderModuleTable*               shader_modules,
+                          uint32_t                         first_frame,
+                          uint32_t                         last_frame)
+{
+    assert((file_processor != nullptr) && (shader_modules != nullptr));
+
+    VulkanExtractDecoder  decoder;
+    VulkanExtractConsumer extract_consumer(shader_modules);
+
+    decoder.AddConsumer(&extract_consumer);
+
+    gfxrecon::decode::SkipToFrame(file_processor, first_frame);
+
+    file_processor->AddDecoder(&decoder);
+
+    while ((file_processor->GetCurrentFrameNumber() < last_frame) && file_processor->ProcessNextFrame())
+    {
+    }
+
+    file_processor->RemoveDecoder(&decoder);
+
+    return (file_processor->GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+}
+
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
@@ -217,24 +376,96 @@ int main(int argc, const char** argv)
             }
         }
 
-        gfxrecon::decode::VulkanDecoder decoder;
-        VulkanExtractConsumer           extract_consumer(extract_dir);
+        ShaderModuleTable shader_modules(extract_dir);
 
-        decoder.AddConsumer(&extract_consumer);
+        // The extract consumer does not access pNext structs, which can be skipped without decoding them.
+        gfxrecon::decode::PNextNode::SetLazyDecoding(true);
 
-        file_processor.AddDecoder(&decoder);
-        file_processor.ProcessAllFrames();
+        uint32_t first_frame = 1;
+        uint32_t last_frame  = std::numeric_limits<uint32_t>::max();
+        gfxrecon::decode::ParseFrameRange(arg_parser.GetArgumentValue(kFramesArgument), &first_frame, &last_frame);
+
+        uint32_t           threads        = 1;
+        const std::string& threads_string = arg_parser.GetArgumentValue(kThreadsArgument);
+        if (!threads_string.empty())
+        {
+            threads = std::max(1u, static_cast<uint32_t>(std::strtoul(threads_string.c_str(), nullptr, 10)));
+        }
 
-        if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+        // Split the frames into contiguous ranges that are processed by separate file processors, which use the seek
+        // index to skip to the first frame of their range.  The last range extends to the end of the requested range,
+        // to include any blocks that follow the last frame delimiter.
+        uint32_t frame_count = 0;
+        if ((threads > 1) && file_processor.GetIndexedFrameCount(&frame_count) && (frame_count >= first_frame))
+        {
+            uint32_t range_count = std::min(last_frame, frame_count) - first_frame + 1;
+            threads              = std::min(threads, range_count);
+        }
+        else
+        {
+            threads = 1;
+        }
+
+        bool success = true;
+
+        if (threads == 1)
+        {
+            success = ExtractFrames(&file_processor, &shader_modules, first_frame, last_frame);
+        }
+        else
+        {
+            uint32_t          range_count = std::min(last_frame, frame_count) - first_frame + 1;
+            uint32_t          range_size  = (range_count + threads - 1) / threads;
+            std::vector<char> thread_success;
+
+            // Rounding up the range size can leave the last threads without frames.
+            threads = (range_count + range_size - 1) / range_size;
+            thread_success.resize(threads, 0);
+
+            std::vector<std::thread> workers;
+            for (uint32_t i = 1; i < threads; ++i)
+            {
+                uint32_t range_first = first_frame + (i * range_size);
+                uint32_t range_last  = (i == (threads - 1)) ? last_frame : (range_first + range_size - 1);
+
+                workers.emplace_back([&, i, range_first, range_last]() {
+                    gfxrecon::decode::FileProcessor range_processor;
+                    thread_success[i] =
+                        range_processor.Initialize(input_filename) &&
+                        ExtractFrames(&range_processor, &shader_modules, range_first, range_last);
+                });
+            }
+
+            thread_success[0] =
+                ExtractFrames(&file_processor, &shader_modules, first_frame, first_frame + range_size - 1);
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+
+            success = std::all_of(thread_success.begin(), thread_success.end(), [](char value) { return value != 0; });
+        }
+
+        if (!success)
         {
             GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
             gfxrecon::util::Log::Release();
             exit(-1);
         }
-        else if (file_processor.GetCurrentFrameNumber() == 0)
+
+        shader_modules.WriteManifest();
+
+        if (file_processor.GetCurrentFrameNumber() == 0)
         {
             GFXRECON_WRITE_CONSOLE("File did not contain any frames");
         }
+        else
+        {
+            GFXRECON_WRITE_CONSOLE("Extracted %" PRIuPTR " shader modules to %" PRIuPTR " files",
+                                   shader_modules.GetShaderModuleCount(),
+                                   shader_modules.GetFileCount());
+        }
     }
 
     gfxrecon::util::Log::Release();
@@ -24,7 +24,7 @@
 # Utility for invoking gfxrecon commands
 # Usage:
 #
-#     gfxrecon.py [capture|compress|extract|info|optimize|replay] [<args>]
+#     gfxrecon.py [capture|compress|extract|info|optimize|receive|replay|telemetry|trim] [<args>]
 #
 #         args is a command-specific argument list
 
@@ -44,7 +44,10 @@ valid_commands = [
     'extract',
     'info',
     'optimize',
-    'replay'
+    'receive',
+    'replay',
+    'telemetry',
+    'trim'
 ]
 
 def IsWindows():
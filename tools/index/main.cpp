@@ -0,0 +1,199 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "project_version.h"
+
+#include "decode/seek_index.h"
+#include "format/format.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan_core.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+const char kHelpShortOption[] = "-h";
+const char kHelpLongOption[]  = "--help";
+const char kVersionOption[]   = "--version";
+const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kSidecarOption[]   = "--sidecar";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--sidecar";
+const char kArguments[] = "";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - Add a frame seek index to GFXReconstruct capture files that were written without",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("one.\n");
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--sidecar] <file> [<file> ...]\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be indexed.");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --sidecar\t\tWrite the index to <file>.idx instead of appending it to");
+    GFXRECON_WRITE_CONSOLE("        \t\tthe capture file, which is not modified.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool IndexFile(const std::string& filename, bool sidecar)
+{
+    std::vector<gfxrecon::format::SeekIndexEntry> entries;
+
+    if (gfxrecon::decode::ReadSeekIndex(filename, &entries))
+    {
+        GFXRECON_WRITE_CONSOLE("Capture file %s already has a seek index", filename.c_str());
+        return true;
+    }
+
+    if (!gfxrecon::decode::BuildSeekIndex(filename, &entries))
+    {
+        GFXRECON_WRITE_CONSOLE("Capture file %s could not be indexed.", filename.c_str());
+        return false;
+    }
+
+    std::string index_filename = filename;
+
+    if (sidecar)
+    {
+        // Replace an index file that could not be read.
+        index_filename = gfxrecon::decode::GetSeekIndexFilename(filename);
+        std::remove(index_filename.c_str());
+    }
+
+    if (!gfxrecon::decode::WriteSeekIndex(index_filename, entries))
+    {
+        return false;
+    }
+
+    uint32_t frame_count = 0;
+
+    for (const auto& entry : entries)
+    {
+        if (entry.type == gfxrecon::format::kFrameSeekIndexEntry)
+        {
+            ++frame_count;
+        }
+    }
+
+    // The index has an entry for the start of each frame and for the end of the last frame.
+    GFXRECON_WRITE_CONSOLE("Wrote a seek index for %u frames to %s",
+                           (frame_count > 0) ? (frame_count - 1) : 0,
+                           index_filename.c_str());
+
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    int return_code = 0;
+
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() < 1))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    bool sidecar = arg_parser.IsOptionSet(kSidecarOption);
+
+    // Each file is indexed independently, so that a file that cannot be indexed does not stop the others.
+    for (const auto& filename : arg_parser.GetPositionalArguments())
+    {
+        if (!IndexFile(filename, sidecar))
+        {
+            return_code = -1;
+        }
+    }
+
+    gfxrecon::util::Log::Release();
+
+    return return_code;
+}
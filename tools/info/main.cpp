@@ -23,28 +23,44 @@
 #include "project_version.h"
 
 #include "decode/file_processor.h"
+#include "decode/frame_range_util.h"
+#include "decode/pnext_node.h"
+#include "decode/value_decoder.h"
 #include "format/format.h"
 #include "format/format_util.h"
 #include "generated/generated_vulkan_consumer.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "util/argument_parser.h"
+#include "util/date_time.h"
 #include "util/logging.h"
+#include "util/platform.h"
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
+#include <cstdio>
 #include <cstdlib>
 #include <limits>
+#include <map>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
+const char kFramesArgument[]  = "--frames";
 const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kFastOption[]      = "--fast";
+const char kValidateOption[]  = "--validate";
+const char kFrameCsvArgument[] = "--frame-csv";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--fast,--validate";
+const char kArguments[] = "--frames,--frame-csv";
 
 const char kUnrecognizedFormatString[] = "<unrecognized-format>";
 
@@ -58,12 +74,33 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Print statistics for a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--frames <range>] [--fast] [--validate]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("                [--frame-csv <file>] <file>\n");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --frames <range>\tOnly process frames <first>[-<last>], where frames are");
+    GFXRECON_WRITE_CONSOLE("                \t\tnumbered from 1.  Frames before <first> are skipped with");
+    GFXRECON_WRITE_CONSOLE("                \t\tthe capture file seek index, when it is present.");
+    GFXRECON_WRITE_CONSOLE("  --fast\t\tOnly decode the API calls that provide the application and");
+    GFXRECON_WRITE_CONSOLE("        \t\tdevice info, skipping the data of the other calls without");
+    GFXRECON_WRITE_CONSOLE("        \t\tdecompressing it.  When the capture file has a seek index and");
+    GFXRECON_WRITE_CONSOLE("        \t\tno frame range is specified, only the blocks that precede the");
+    GFXRECON_WRITE_CONSOLE("        \t\tfirst frame delimiter are read, and the frame count is taken");
+    GFXRECON_WRITE_CONSOLE("        \t\tfrom the index.  Memory allocation and pipeline info is not");
+    GFXRECON_WRITE_CONSOLE("        \t\treported.");
+    GFXRECON_WRITE_CONSOLE("  --validate\t\tCheck that the parameter data of each API call is");
+    GFXRECON_WRITE_CONSOLE("            \t\tcompletely read by its decoder, reporting calls with");
+    GFXRECON_WRITE_CONSOLE("            \t\ttruncated or trailing data.  The tool exits with an error");
+    GFXRECON_WRITE_CONSOLE("            \t\twhen the file is not valid.  Files that pass validation can");
+    GFXRECON_WRITE_CONSOLE("            \t\tbe replayed by builds with the TRUSTED_DECODE option.");
+    GFXRECON_WRITE_CONSOLE("  --frame-csv <file>\tWrite the cost profile of each processed frame to a CSV");
+    GFXRECON_WRITE_CONSOLE("                   \t\tfile, with the number and size of its API call and fill");
+    GFXRECON_WRITE_CONSOLE("                   \t\tmemory blocks, its recorded draws and dispatches, and its");
+    GFXRECON_WRITE_CONSOLE("                   \t\tpipeline creations and memory allocations.  Cannot be");
+    GFXRECON_WRITE_CONSOLE("                   \t\tcombined with --fast.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -131,6 +168,47 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
     uint64_t           GetAllocationCount() const { return allocation_count_; }
     uint64_t           GetMinAllocationSize() const { return min_allocation_size_; }
     uint64_t           GetMaxAllocationSize() const { return max_allocation_size_; }
+    uint64_t           GetPeakAllocatedSize() const { return peak_allocated_size_; }
+    uint64_t           GetPeakBufferSize() const { return buffer_usage_.peak; }
+    uint64_t           GetPeakImageSize() const { return image_usage_.peak; }
+    uint64_t           GetPeakFrameAllocatedSize() const { return peak_frame_allocated_size_; }
+    uint64_t           GetPeakFrameFreedSize() const { return peak_frame_freed_size_; }
+    uint64_t           GetTimestampCount() const { return timestamp_count_; }
+    uint64_t           GetTimedFrameCount() const { return timed_frame_count_; }
+    uint64_t           GetTotalFrameCpuTime() const { return total_frame_cpu_time_; }
+    uint64_t           GetMaxFrameCpuTime() const { return max_frame_cpu_time_; }
+    uint32_t           GetMaxFrameCpuTimeFrame() const { return max_frame_cpu_time_frame_; }
+    uint64_t           GetMaxCpuGap() const { return max_cpu_gap_; }
+    uint32_t           GetMaxCpuGapFrame() const { return max_cpu_gap_frame_; }
+
+    // Sets the number of the first frame that is processed, for the frame numbers of the CPU timing info.
+    void SetFirstFrame(uint32_t first_frame) { first_frame_ = first_frame; }
+
+    // Peak allocated memory, by physical device and memory heap index.
+    const std::map<std::pair<gfxrecon::format::HandleId, uint32_t>, uint64_t>& GetPeakHeapSizes() const
+    {
+        return peak_heap_sizes_;
+    }
+
+    // Returns the size and flags of a memory heap, or false if the memory properties of the physical device were not
+    // captured.
+    bool GetHeapInfo(gfxrecon::format::HandleId physical_device_id,
+                     uint32_t                   heap_index,
+                     uint64_t*                  size,
+                     uint32_t*                  flags) const
+    {
+        assert((size != nullptr) && (flags != nullptr));
+
+        auto entry = memory_properties_.find(physical_device_id);
+        if ((entry != memory_properties_.end()) && (heap_index < entry->second.heaps.size()))
+        {
+            (*size)  = entry->second.heaps[heap_index].size;
+            (*flags) = entry->second.heaps[heap_index].flags;
+            return true;
+        }
+
+        return false;
+    }
 
     const std::set<gfxrecon::format::HandleId>& GetInstantiatedDevices() const { return used_physical_devices_; }
     const VkPhysicalDeviceProperties*           GetDeviceProperties(gfxrecon::format::HandleId id) const
@@ -214,16 +292,70 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
         }
     }
 
+    virtual void ProcessSetDeviceMemoryPropertiesCommand(
+        gfxrecon::format::HandleId                             physical_device_id,
+        const std::vector<gfxrecon::format::DeviceMemoryType>& memory_types,
+        const std::vector<gfxrecon::format::DeviceMemoryHeap>& memory_heaps) override
+    {
+        auto& memory_properties = memory_properties_[physical_device_id];
+
+        memory_properties.type_heaps.clear();
+        memory_properties.heaps = memory_heaps;
+
+        for (const auto& memory_type : memory_types)
+        {
+            memory_properties.type_heaps.push_back(memory_type.heap_index);
+        }
+    }
+
+    virtual void Process_vkGetPhysicalDeviceMemoryProperties(
+        gfxrecon::format::HandleId physicalDevice,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkPhysicalDeviceMemoryProperties>*
+            pMemoryProperties) override
+    {
+        if ((pMemoryProperties != nullptr) && !pMemoryProperties->IsNull())
+        {
+            AddMemoryProperties(physicalDevice, pMemoryProperties->GetPointer());
+        }
+    }
+
+    virtual void Process_vkGetPhysicalDeviceMemoryProperties2(
+        gfxrecon::format::HandleId physicalDevice,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkPhysicalDeviceMemoryProperties2>*
+            pMemoryProperties) override
+    {
+        if ((pMemoryProperties != nullptr) && !pMemoryProperties->IsNull())
+        {
+            AddMemoryProperties(physicalDevice, &pMemoryProperties->GetPointer()->memoryProperties);
+        }
+    }
+
+    virtual void Process_vkGetPhysicalDeviceMemoryProperties2KHR(
+        gfxrecon::format::HandleId physicalDevice,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkPhysicalDeviceMemoryProperties2>*
+            pMemoryProperties) override
+    {
+        if ((pMemoryProperties != nullptr) && !pMemoryProperties->IsNull())
+        {
+            AddMemoryProperties(physicalDevice, &pMemoryProperties->GetPointer()->memoryProperties);
+        }
+    }
+
     virtual void
     Process_vkCreateDevice(VkResult                   returnValue,
                            gfxrecon::format::HandleId physicalDevice,
                            gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkDeviceCreateInfo>*,
                            gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-                           gfxrecon::decode::HandlePointerDecoder<VkDevice>*) override
+                           gfxrecon::decode::HandlePointerDecoder<VkDevice>* pDevice) override
     {
         if (returnValue >= 0)
         {
             used_physical_devices_.insert(physicalDevice);
+
+            if ((pDevice != nullptr) && !pDevice->IsNull())
+            {
+                device_physical_devices_[*pDevice->GetPointer()] = physicalDevice;
+            }
         }
     }
 
@@ -381,11 +513,11 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
     }
 
     virtual void Process_vkAllocateMemory(
-        VkResult returnValue,
-        gfxrecon::format::HandleId,
+        VkResult                   returnValue,
+        gfxrecon::format::HandleId device,
         gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryAllocateInfo>* pAllocateInfo,
         gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-        gfxrecon::decode::HandlePointerDecoder<VkDeviceMemory>*) override
+        gfxrecon::decode::HandlePointerDecoder<VkDeviceMemory>* pMemory) override
     {
         assert(pAllocateInfo != nullptr);
 
@@ -406,7 +538,410 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
                 {
                     max_allocation_size_ = allocate_info->allocationSize;
                 }
+
+                if ((pMemory != nullptr) && !pMemory->IsNull())
+                {
+                    AddMemory(device, *pMemory->GetPointer(), allocate_info);
+                }
+            }
+        }
+    }
+
+    virtual void
+    Process_vkFreeMemory(gfxrecon::format::HandleId,
+                         gfxrecon::format::HandleId memory,
+                         gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*)
+        override
+    {
+        auto entry = memory_allocations_.find(memory);
+        if (entry != memory_allocations_.end())
+        {
+            const MemoryAllocation& allocation = entry->second;
+
+            allocated_size_ -= allocation.size;
+            frame_freed_size_ += allocation.size;
+
+            if (allocation.heap_index != kUnknownHeapIndex)
+            {
+                heap_sizes_[std::make_pair(allocation.physical_device_id, allocation.heap_index)] -= allocation.size;
+            }
+
+            memory_allocations_.erase(entry);
+        }
+    }
+
+    virtual void Process_vkCreateBuffer(
+        VkResult returnValue,
+        gfxrecon::format::HandleId,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBufferCreateInfo>* pCreateInfo,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
+        gfxrecon::decode::HandlePointerDecoder<VkBuffer>* pBuffer) override
+    {
+        if ((returnValue >= 0) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pBuffer != nullptr) &&
+            !pBuffer->IsNull())
+        {
+            // The buffer size is replaced by the memory requirements of the buffer, when they are queried.
+            buffer_usage_.resources[*pBuffer->GetPointer()].size = pCreateInfo->GetPointer()->size;
+        }
+    }
+
+    virtual void
+    Process_vkDestroyBuffer(gfxrecon::format::HandleId,
+                            gfxrecon::format::HandleId buffer,
+                            gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*)
+        override
+    {
+        RemoveResource(&buffer_usage_, buffer);
+    }
+
+    virtual void
+    Process_vkCreateImage(VkResult returnValue,
+                          gfxrecon::format::HandleId,
+                          gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkImageCreateInfo>*,
+                          gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
+                          gfxrecon::decode::HandlePointerDecoder<VkImage>* pImage) override
+    {
+        if ((returnValue >= 0) && (pImage != nullptr) && !pImage->IsNull())
+        {
+            // The image size is only known from the memory requirements of the image.
+            image_usage_.resources[*pImage->GetPointer()].size = 0;
+        }
+    }
+
+    virtual void
+    Process_vkDestroyImage(gfxrecon::format::HandleId,
+                           gfxrecon::format::HandleId image,
+                           gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*)
+        override
+    {
+        RemoveResource(&image_usage_, image);
+    }
+
+    virtual void Process_vkGetBufferMemoryRequirements(
+        gfxrecon::format::HandleId,
+        gfxrecon::format::HandleId                                                              buffer,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryRequirements>* pMemoryRequirements)
+        override
+    {
+        if ((pMemoryRequirements != nullptr) && !pMemoryRequirements->IsNull())
+        {
+            SetResourceSize(&buffer_usage_, buffer, pMemoryRequirements->GetPointer()->size);
+        }
+    }
+
+    virtual void Process_vkGetBufferMemoryRequirements2(
+        gfxrecon::format::HandleId,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+        override
+    {
+        if ((pInfo != nullptr) && !pInfo->IsNull() && (pMemoryRequirements != nullptr) &&
+            !pMemoryRequirements->IsNull())
+        {
+            SetResourceSize(&buffer_usage_,
+                            pInfo->GetMetaStructPointer()->buffer,
+                            pMemoryRequirements->GetPointer()->memoryRequirements.size);
+        }
+    }
+
+    virtual void Process_vkGetBufferMemoryRequirements2KHR(
+        gfxrecon::format::HandleId                                                                         device,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+        override
+    {
+        Process_vkGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    }
+
+    virtual void Process_vkGetImageMemoryRequirements(
+        gfxrecon::format::HandleId,
+        gfxrecon::format::HandleId                                                              image,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryRequirements>* pMemoryRequirements)
+        override
+    {
+        if ((pMemoryRequirements != nullptr) && !pMemoryRequirements->IsNull())
+        {
+            SetResourceSize(&image_usage_, image, pMemoryRequirements->GetPointer()->size);
+        }
+    }
+
+    virtual void Process_vkGetImageMemoryRequirements2(
+        gfxrecon::format::HandleId,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+        override
+    {
+        if ((pInfo != nullptr) && !pInfo->IsNull() && (pMemoryRequirements != nullptr) &&
+            !pMemoryRequirements->IsNull())
+        {
+            SetResourceSize(&image_usage_,
+                            pInfo->GetMetaStructPointer()->image,
+                            pMemoryRequirements->GetPointer()->memoryRequirements.size);
+        }
+    }
+
+    virtual void Process_vkGetImageMemoryRequirements2KHR(
+        gfxrecon::format::HandleId                                                                        device,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+        override
+    {
+        Process_vkGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    }
+
+    virtual void Process_vkBindBufferMemory(VkResult returnValue,
+                                            gfxrecon::format::HandleId,
+                                            gfxrecon::format::HandleId buffer,
+                                            gfxrecon::format::HandleId,
+                                            VkDeviceSize) override
+    {
+        if (returnValue >= 0)
+        {
+            BindResource(&buffer_usage_, buffer);
+        }
+    }
+
+    virtual void Process_vkBindBufferMemory2(
+        VkResult returnValue,
+        gfxrecon::format::HandleId,
+        uint32_t                                                                                  bindInfoCount,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBindBufferMemoryInfo>* pBindInfos) override
+    {
+        if ((returnValue >= 0) && (pBindInfos != nullptr) && !pBindInfos->IsNull())
+        {
+            auto bind_infos = pBindInfos->GetMetaStructPointer();
+            for (uint32_t i = 0; i < bindInfoCount; ++i)
+            {
+                BindResource(&buffer_usage_, bind_infos[i].buffer);
+            }
+        }
+    }
+
+    virtual void Process_vkBindBufferMemory2KHR(
+        VkResult                   returnValue,
+        gfxrecon::format::HandleId device,
+        uint32_t                   bindInfoCount,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBindBufferMemoryInfo>* pBindInfos) override
+    {
+        Process_vkBindBufferMemory2(returnValue, device, bindInfoCount, pBindInfos);
+    }
+
+    virtual void Process_vkBindImageMemory(VkResult returnValue,
+                                           gfxrecon::format::HandleId,
+                                           gfxrecon::format::HandleId image,
+                                           gfxrecon::format::HandleId,
+                                           VkDeviceSize) override
+    {
+        if (returnValue >= 0)
+        {
+            BindResource(&image_usage_, image);
+        }
+    }
+
+    virtual void Process_vkBindImageMemory2(
+        VkResult returnValue,
+        gfxrecon::format::HandleId,
+        uint32_t                                                                                 bindInfoCount,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBindImageMemoryInfo>* pBindInfos) override
+    {
+        if ((returnValue >= 0) && (pBindInfos != nullptr) && !pBindInfos->IsNull())
+        {
+            auto bind_infos = pBindInfos->GetMetaStructPointer();
+            for (uint32_t i = 0; i < bindInfoCount; ++i)
+            {
+                BindResource(&image_usage_, bind_infos[i].image);
+            }
+        }
+    }
+
+    virtual void Process_vkBindImageMemory2KHR(
+        VkResult                   returnValue,
+        gfxrecon::format::HandleId device,
+        uint32_t                   bindInfoCount,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkBindImageMemoryInfo>* pBindInfos) override
+    {
+        Process_vkBindImageMemory2(returnValue, device, bindInfoCount, pBindInfos);
+    }
+
+    virtual void Process_vkQueuePresentKHR(
+        VkResult,
+        gfxrecon::format::HandleId,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkPresentInfoKHR>*) override
+    {
+        // The allocation churn of a frame is the memory that is allocated and freed between two presents.
+        if ((frame_allocated_size_ + frame_freed_size_) > (peak_frame_allocated_size_ + peak_frame_freed_size_))
+        {
+            peak_frame_allocated_size_ = frame_allocated_size_;
+            peak_frame_freed_size_     = frame_freed_size_;
+        }
+
+        frame_allocated_size_ = 0;
+        frame_freed_size_     = 0;
+
+        // The CPU time of a frame is the time between the timestamps of two presents.  The timestamp that precedes
+        // the present block is the start of the present call.
+        if (frame_timestamp_valid_ && (last_timestamp_ >= frame_start_timestamp_))
+        {
+            uint64_t frame_time = last_timestamp_ - frame_start_timestamp_;
+
+            total_frame_cpu_time_ += frame_time;
+            ++timed_frame_count_;
+
+            if (frame_time > max_frame_cpu_time_)
+            {
+                max_frame_cpu_time_       = frame_time;
+                max_frame_cpu_time_frame_ = GetCurrentFrame();
+            }
+        }
+
+        frame_timestamp_valid_ = (timestamp_count_ > 0);
+        frame_start_timestamp_ = last_timestamp_;
+
+        ++present_count_;
+    }
+
+    virtual void ProcessTimestampCommand(uint64_t timestamp) override
+    {
+        // The gap between consecutive timestamps is the CPU time that the application spent between its queue
+        // submissions and presents.
+        if ((timestamp_count_ > 0) && (timestamp >= last_timestamp_) && ((timestamp - last_timestamp_) > max_cpu_gap_))
+        {
+            max_cpu_gap_       = timestamp - last_timestamp_;
+            max_cpu_gap_frame_ = GetCurrentFrame();
+        }
+
+        last_timestamp_ = timestamp;
+        ++timestamp_count_;
+    }
+
+    virtual void ProcessStateEndMarker(uint64_t frame_number) override
+    {
+        // The allocations of the state snapshot are not included in the allocation churn of the first frame.
+        frame_allocated_size_ = 0;
+        frame_freed_size_     = 0;
+    }
+
+  private:
+    static const uint32_t kUnknownHeapIndex = std::numeric_limits<uint32_t>::max();
+
+    uint32_t GetCurrentFrame() const { return first_frame_ + static_cast<uint32_t>(present_count_); }
+
+    struct MemoryProperties
+    {
+        std::vector<uint32_t>                           type_heaps;
+        std::vector<gfxrecon::format::DeviceMemoryHeap> heaps;
+    };
+
+    struct MemoryAllocation
+    {
+        gfxrecon::format::HandleId physical_device_id;
+        uint32_t                   heap_index;
+        uint64_t                   size;
+    };
+
+    struct Resource
+    {
+        uint64_t size{ 0 };
+        bool     bound{ false };
+    };
+
+    // Tracks the memory requirements of the buffers or images that are bound to memory.
+    struct ResourceUsage
+    {
+        std::unordered_map<gfxrecon::format::HandleId, Resource> resources;
+        uint64_t                                                 bound_size{ 0 };
+        uint64_t                                                 peak{ 0 };
+    };
+
+  private:
+    void AddMemoryProperties(gfxrecon::format::HandleId              physical_device_id,
+                             const VkPhysicalDeviceMemoryProperties* properties)
+    {
+        auto& memory_properties = memory_properties_[physical_device_id];
+
+        memory_properties.type_heaps.clear();
+        memory_properties.heaps.clear();
+
+        for (uint32_t i = 0; i < properties->memoryTypeCount; ++i)
+        {
+            memory_properties.type_heaps.push_back(properties->memoryTypes[i].heapIndex);
+        }
+
+        for (uint32_t i = 0; i < properties->memoryHeapCount; ++i)
+        {
+            memory_properties.heaps.push_back({ properties->memoryHeaps[i].size, properties->memoryHeaps[i].flags });
+        }
+    }
+
+    void AddMemory(gfxrecon::format::HandleId device_id,
+                   gfxrecon::format::HandleId memory_id,
+                   const VkMemoryAllocateInfo* allocate_info)
+    {
+        MemoryAllocation allocation{ gfxrecon::format::kNullHandleId,
+                                     kUnknownHeapIndex,
+                                     allocate_info->allocationSize };
+
+        auto device_entry = device_physical_devices_.find(device_id);
+        if (device_entry != device_physical_devices_.end())
+        {
+            allocation.physical_device_id = device_entry->second;
+
+            auto properties_entry = memory_properties_.find(allocation.physical_device_id);
+            if ((properties_entry != memory_properties_.end()) &&
+                (allocate_info->memoryTypeIndex < properties_entry->second.type_heaps.size()))
+            {
+                allocation.heap_index = properties_entry->second.type_heaps[allocate_info->memoryTypeIndex];
+            }
+        }
+
+        allocated_size_ += allocation.size;
+        frame_allocated_size_ += allocation.size;
+        peak_allocated_size_ = std::max(peak_allocated_size_, allocated_size_);
+
+        if (allocation.heap_index != kUnknownHeapIndex)
+        {
+            auto  heap      = std::make_pair(allocation.physical_device_id, allocation.heap_index);
+            auto& heap_size = heap_sizes_[heap];
+            auto& heap_peak = peak_heap_sizes_[heap];
+
+            heap_size += allocation.size;
+            heap_peak = std::max(heap_peak, heap_size);
+        }
+
+        memory_allocations_[memory_id] = allocation;
+    }
+
+    void SetResourceSize(ResourceUsage* usage, gfxrecon::format::HandleId resource_id, uint64_t size)
+    {
+        auto entry = usage->resources.find(resource_id);
+        if ((entry != usage->resources.end()) && !entry->second.bound)
+        {
+            entry->second.size = size;
+        }
+    }
+
+    void BindResource(ResourceUsage* usage, gfxrecon::format::HandleId resource_id)
+    {
+        auto entry = usage->resources.find(resource_id);
+        if ((entry != usage->resources.end()) && !entry->second.bound)
+        {
+            entry->second.bound = true;
+            usage->bound_size += entry->second.size;
+            usage->peak = std::max(usage->peak, usage->bound_size);
+        }
+    }
+
+    void RemoveResource(ResourceUsage* usage, gfxrecon::format::HandleId resource_id)
+    {
+        auto entry = usage->resources.find(resource_id);
+        if (entry != usage->resources.end())
+        {
+            if (entry->second.bound)
+            {
+                usage->bound_size -= entry->second.size;
             }
+
+            usage->resources.erase(entry);
         }
     }
 
@@ -436,13 +971,173 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
     uint64_t allocation_count_{ 0 };
     uint64_t min_allocation_size_{ std::numeric_limits<uint64_t>::max() };
     uint64_t max_allocation_size_{ 0 };
+
+    // Live memory allocation info.
+    std::unordered_map<gfxrecon::format::HandleId, gfxrecon::format::HandleId> device_physical_devices_;
+    std::unordered_map<gfxrecon::format::HandleId, MemoryProperties>           memory_properties_;
+    std::unordered_map<gfxrecon::format::HandleId, MemoryAllocation>           memory_allocations_;
+    std::map<std::pair<gfxrecon::format::HandleId, uint32_t>, uint64_t>        heap_sizes_;
+    std::map<std::pair<gfxrecon::format::HandleId, uint32_t>, uint64_t>        peak_heap_sizes_;
+    uint64_t                                                                   allocated_size_{ 0 };
+    uint64_t                                                                   peak_allocated_size_{ 0 };
+    ResourceUsage                                                              buffer_usage_;
+    ResourceUsage                                                              image_usage_;
+
+    // Per-frame allocation churn.
+    uint64_t frame_allocated_size_{ 0 };
+    uint64_t frame_freed_size_{ 0 };
+    uint64_t peak_frame_allocated_size_{ 0 };
+    uint64_t peak_frame_freed_size_{ 0 };
+
+    // Capture CPU timestamps, in nanoseconds.
+    uint32_t first_frame_{ 1 };
+    uint64_t present_count_{ 0 };
+    uint64_t timestamp_count_{ 0 };
+    uint64_t last_timestamp_{ 0 };
+    uint64_t frame_start_timestamp_{ 0 };
+    bool     frame_timestamp_valid_{ false };
+    uint64_t timed_frame_count_{ 0 };
+    uint64_t total_frame_cpu_time_{ 0 };
+    uint64_t max_frame_cpu_time_{ 0 };
+    uint32_t max_frame_cpu_time_frame_{ 0 };
+    uint64_t max_cpu_gap_{ 0 };
+    uint32_t max_cpu_gap_frame_{ 0 };
+};
+
+// Decodes only the API calls that provide the application and device info, so that the file processor can skip the
+// parameter data of the other calls without decompressing it.  Frames are counted by the file processor.
+class VulkanInfoScanDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    virtual bool SupportsApiCall(gfxrecon::format::ApiCallId call_id) override
+    {
+        return (call_id == gfxrecon::format::ApiCallId::ApiCall_vkCreateInstance) ||
+               (call_id == gfxrecon::format::ApiCallId::ApiCall_vkCreateDevice) ||
+               (call_id == gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties) ||
+               (call_id == gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2) ||
+               (call_id == gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR);
+    }
 };
 
+// Counts the API call and fill memory blocks that are decoded, with the size of their uncompressed data, for the
+// per-frame cost profile.
+class VulkanBlockStatsDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    uint64_t GetCallCount() const { return call_count_; }
+    uint64_t GetCallSize() const { return call_size_; }
+    uint64_t GetFillMemoryCount() const { return fill_memory_count_; }
+    uint64_t GetFillMemorySize() const { return fill_memory_size_; }
+
+    virtual void DecodeFunctionCall(gfxrecon::format::ApiCallId          call_id,
+                                    const gfxrecon::decode::ApiCallInfo& call_info,
+                                    const uint8_t*                       parameter_buffer,
+                                    size_t                               buffer_size) override
+    {
+        ++call_count_;
+        call_size_ += buffer_size;
+
+        VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+    }
+
+    virtual void DispatchFillMemoryCommand(gfxrecon::format::ThreadId thread_id,
+                                           uint64_t                   memory_id,
+                                           uint64_t                   offset,
+                                           uint64_t                   size,
+                                           const uint8_t*             data) override
+    {
+        ++fill_memory_count_;
+        fill_memory_size_ += size;
+
+        VulkanDecoder::DispatchFillMemoryCommand(thread_id, memory_id, offset, size, data);
+    }
+
+  private:
+    uint64_t call_count_{ 0 };
+    uint64_t call_size_{ 0 };
+    uint64_t fill_memory_count_{ 0 };
+    uint64_t fill_memory_size_{ 0 };
+};
+
+// Running totals that are sampled at the end of each frame, for the per-frame cost profile.
+struct FrameTotals
+{
+    uint64_t blocks{ 0 };
+    uint64_t file_bytes{ 0 };
+    uint64_t calls{ 0 };
+    uint64_t call_bytes{ 0 };
+    uint64_t fills{ 0 };
+    uint64_t fill_bytes{ 0 };
+    uint64_t draws{ 0 };
+    uint64_t dispatches{ 0 };
+    uint64_t pipelines{ 0 };
+    uint64_t allocations{ 0 };
+    uint64_t timed_frames{ 0 };
+    uint64_t cpu_time{ 0 };
+};
+
+static FrameTotals GetFrameTotals(const gfxrecon::decode::FileProcessor& file_processor,
+                                  const VulkanBlockStatsDecoder&         decoder,
+                                  const VulkanStatsConsumer&             stats_consumer)
+{
+    FrameTotals totals;
+    totals.blocks       = file_processor.GetBlockCount();
+    totals.file_bytes   = file_processor.GetNumBytesRead();
+    totals.calls        = decoder.GetCallCount();
+    totals.call_bytes   = decoder.GetCallSize();
+    totals.fills        = decoder.GetFillMemoryCount();
+    totals.fill_bytes   = decoder.GetFillMemorySize();
+    totals.draws        = stats_consumer.GetDrawCount();
+    totals.dispatches   = stats_consumer.GetDispatchCount();
+    totals.pipelines    = stats_consumer.GetGraphicsPipelineCount() + stats_consumer.GetComputePipelineCount();
+    totals.allocations  = stats_consumer.GetAllocationCount();
+    totals.timed_frames = stats_consumer.GetTimedFrameCount();
+    totals.cpu_time     = stats_consumer.GetTotalFrameCpuTime();
+    return totals;
+}
+
+static bool WriteFrameCsvHeader(FILE* file)
+{
+    return (fprintf(file,
+                    "frame,blocks,file_bytes,call_blocks,call_bytes,fill_memory_blocks,fill_memory_bytes,draws,"
+                    "dispatches,pipelines,allocations,cpu_ms\n") >= 0);
+}
+
+// Writes the difference between the totals at the start and end of a frame.  The CPU time is only written for frames
+// with capture CPU timestamps.
+static bool WriteFrameCsvRow(FILE* file, uint32_t frame_number, const FrameTotals& start, const FrameTotals& end)
+{
+    bool success = (fprintf(file,
+                            "%u,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                            ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",",
+                            frame_number,
+                            end.blocks - start.blocks,
+                            end.file_bytes - start.file_bytes,
+                            end.calls - start.calls,
+                            end.call_bytes - start.call_bytes,
+                            end.fills - start.fills,
+                            end.fill_bytes - start.fill_bytes,
+                            end.draws - start.draws,
+                            end.dispatches - start.dispatches,
+                            end.pipelines - start.pipelines,
+                            end.allocations - start.allocations) >= 0);
+
+    if (success && (end.timed_frames > start.timed_frames))
+    {
+        success = (fprintf(file,
+                           "%.3f",
+                           gfxrecon::util::datetime::ConvertTimestampToMilliseconds(
+                               static_cast<int64_t>(end.cpu_time - start.cpu_time))) >= 0);
+    }
+
+    return success && (fprintf(file, "\n") >= 0);
+}
+
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -465,21 +1160,124 @@ int main(int argc, const char** argv)
 #endif
     }
 
+    bool validate = arg_parser.IsOptionSet(kValidateOption);
+
+    if (validate && gfxrecon::decode::kTrustedDecode)
+    {
+        GFXRECON_LOG_ERROR("The --validate option is not available in builds with the TRUSTED_DECODE option, which do "
+                           "not check for truncated data");
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    std::string frame_csv_filename = arg_parser.GetArgumentValue(kFrameCsvArgument);
+
+    if (!frame_csv_filename.empty() && arg_parser.IsOptionSet(kFastOption))
+    {
+        GFXRECON_LOG_ERROR("The --frame-csv option cannot be combined with the --fast option, which does not "
+                           "decode the API calls that are counted");
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
     const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
     std::string                     input_filename       = positional_arguments[0];
 
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder decoder;
-        VulkanStatsConsumer             stats_consumer;
+        bool                             fast_scan = !validate && arg_parser.IsOptionSet(kFastOption);
+        VulkanBlockStatsDecoder          full_decoder;
+        VulkanInfoScanDecoder            scan_decoder;
+        gfxrecon::decode::VulkanDecoder& decoder =
+            fast_scan ? static_cast<gfxrecon::decode::VulkanDecoder&>(scan_decoder) : full_decoder;
+        VulkanStatsConsumer              stats_consumer;
 
         decoder.AddConsumer(&stats_consumer);
+        decoder.SetValidateCallSizes(validate);
+
+        // The stats consumer does not access pNext structs, which can be skipped without decoding them unless the
+        // file is being validated.
+        gfxrecon::decode::PNextNode::SetLazyDecoding(!validate);
+
+        uint32_t first_frame = 1;
+        uint32_t last_frame  = std::numeric_limits<uint32_t>::max();
+        gfxrecon::decode::ParseFrameRange(arg_parser.GetArgumentValue(kFramesArgument), &first_frame, &last_frame);
+        stats_consumer.SetFirstFrame(first_frame);
 
         file_processor.AddDecoder(&decoder);
-        file_processor.ProcessAllFrames();
 
-        if ((file_processor.GetCurrentFrameNumber() > 0) &&
+        if (first_frame > 1)
+        {
+            // Report the state snapshot of trimmed files, which contains the application and device info, before
+            // skipping to the requested frames.
+            file_processor.ProcessStateSnapshot();
+            file_processor.RemoveDecoder(&decoder);
+            gfxrecon::decode::SkipToFrame(&file_processor, first_frame);
+            file_processor.AddDecoder(&decoder);
+        }
+
+        uint32_t indexed_frame_count = 0;
+
+        if (fast_scan && (first_frame == 1) && (last_frame == std::numeric_limits<uint32_t>::max()) &&
+            file_processor.GetIndexedFrameCount(&indexed_frame_count))
+        {
+            // The application and device info is expected to be captured before the first frame delimiter, or in the
+            // state snapshot of a trimmed file, so the rest of the file is not read.
+            file_processor.ProcessNextFrame();
+            last_frame = indexed_frame_count;
+        }
+        else if (!frame_csv_filename.empty())
+        {
+            FILE*   csv_file = nullptr;
+            int32_t result   = gfxrecon::util::platform::FileOpen(&csv_file, frame_csv_filename.c_str(), "w");
+            bool    success  = (result == 0) && WriteFrameCsvHeader(csv_file);
+
+            if (result != 0)
+            {
+                GFXRECON_LOG_ERROR("Failed to open frame CSV file %s", frame_csv_filename.c_str());
+            }
+
+            FrameTotals start        = GetFrameTotals(file_processor, full_decoder, stats_consumer);
+            uint32_t    start_number = file_processor.GetCurrentFrameNumber();
+
+            while ((file_processor.GetCurrentFrameNumber() < last_frame) && file_processor.ProcessNextFrame())
+            {
+                // Rows are only written for frames that end with a frame delimiter, so the blocks that follow the last
+                // frame are not included.
+                uint32_t end_number = file_processor.GetCurrentFrameNumber();
+                if (end_number != start_number)
+                {
+                    FrameTotals end = GetFrameTotals(file_processor, full_decoder, stats_consumer);
+
+                    if (success && !WriteFrameCsvRow(csv_file, start_number + 1, start, end))
+                    {
+                        GFXRECON_LOG_ERROR("Failed to write frame CSV file %s", frame_csv_filename.c_str());
+                        success = false;
+                    }
+
+                    start        = end;
+                    start_number = end_number;
+                }
+            }
+
+            if (csv_file != nullptr)
+            {
+                gfxrecon::util::platform::FileClose(csv_file);
+            }
+
+            last_frame = file_processor.GetCurrentFrameNumber();
+        }
+        else
+        {
+            while ((file_processor.GetCurrentFrameNumber() < last_frame) && file_processor.ProcessNextFrame())
+            {
+            }
+
+            last_frame = file_processor.GetCurrentFrameNumber();
+        }
+
+        if ((last_frame > 0) &&
             (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
         {
             GFXRECON_WRITE_CONSOLE("File info:");
@@ -509,9 +1307,14 @@ int main(int argc, const char** argv)
 
             // Frame counts.
             uint32_t trim_start_frame = stats_consumer.GetTrimmedStartFrame();
-            uint32_t frame_count      = file_processor.GetCurrentFrameNumber();
+            uint32_t frame_count      = last_frame;
 
-            if (trim_start_frame == 0)
+            if (first_frame > 1)
+            {
+                // Only the requested frames were processed.
+                GFXRECON_WRITE_CONSOLE("\tProcessed frames: %u-%u", first_frame, frame_count);
+            }
+            else if (trim_start_frame == 0)
             {
                 // Not a trimmed file.
                 GFXRECON_WRITE_CONSOLE("\tTotal frames: %u", frame_count);
@@ -561,14 +1364,72 @@ int main(int argc, const char** argv)
                 }
             }
 
-            GFXRECON_WRITE_CONSOLE("\nDevice memory allocation info:");
-            GFXRECON_WRITE_CONSOLE("\tTotal allocations: %" PRIu64, stats_consumer.GetAllocationCount());
-            GFXRECON_WRITE_CONSOLE("\tMin allocation size: %" PRIu64, stats_consumer.GetMinAllocationSize());
-            GFXRECON_WRITE_CONSOLE("\tMax allocation size: %" PRIu64, stats_consumer.GetMaxAllocationSize());
+            // The calls that provide the memory and pipeline info are not decoded by the fast scan.
+            if (!fast_scan)
+            {
+                GFXRECON_WRITE_CONSOLE("\nDevice memory allocation info:");
+                GFXRECON_WRITE_CONSOLE("\tTotal allocations: %" PRIu64, stats_consumer.GetAllocationCount());
+                GFXRECON_WRITE_CONSOLE("\tMin allocation size: %" PRIu64, stats_consumer.GetMinAllocationSize());
+                GFXRECON_WRITE_CONSOLE("\tMax allocation size: %" PRIu64, stats_consumer.GetMaxAllocationSize());
+                GFXRECON_WRITE_CONSOLE("\tPeak allocated memory: %" PRIu64, stats_consumer.GetPeakAllocatedSize());
+
+                for (const auto& entry : stats_consumer.GetPeakHeapSizes())
+                {
+                    uint64_t heap_size  = 0;
+                    uint32_t heap_flags = 0;
+                    if (stats_consumer.GetHeapInfo(entry.first.first, entry.first.second, &heap_size, &heap_flags))
+                    {
+                        std::string heap_type =
+                            ((heap_flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0) ? "device local" : "host";
+
+                        // Identify the device when the heaps of more than one device are reported.
+                        auto properties = stats_consumer.GetDeviceProperties(entry.first.first);
+                        if ((properties != nullptr) && (stats_consumer.GetInstantiatedDevices().size() > 1))
+                        {
+                            heap_type = heap_type + ", " + properties->deviceName;
+                        }
+
+                        GFXRECON_WRITE_CONSOLE("\tPeak allocated memory for heap %u (%s): %" PRIu64 " of %" PRIu64,
+                                               entry.first.second,
+                                               heap_type.c_str(),
+                                               entry.second,
+                                               heap_size);
+                    }
+                }
+
+                GFXRECON_WRITE_CONSOLE("\tPeak bound buffer memory: %" PRIu64, stats_consumer.GetPeakBufferSize());
+                GFXRECON_WRITE_CONSOLE("\tPeak bound image memory: %" PRIu64, stats_consumer.GetPeakImageSize());
+                GFXRECON_WRITE_CONSOLE("\tPeak per-frame allocation churn: %" PRIu64 " allocated, %" PRIu64 " freed",
+                                       stats_consumer.GetPeakFrameAllocatedSize(),
+                                       stats_consumer.GetPeakFrameFreedSize());
+
+                GFXRECON_WRITE_CONSOLE("\nPipeline info:");
+                GFXRECON_WRITE_CONSOLE("\tTotal graphics pipelines: %" PRIu64,
+                                       stats_consumer.GetGraphicsPipelineCount());
+                GFXRECON_WRITE_CONSOLE("\tTotal compute pipelines: %" PRIu64,
+                                       stats_consumer.GetComputePipelineCount());
+
+                // Timestamps are only written when the capture_cpu_timestamps setting is enabled.
+                if (stats_consumer.GetTimedFrameCount() > 0)
+                {
+                    uint64_t timed_frames = stats_consumer.GetTimedFrameCount();
 
-            GFXRECON_WRITE_CONSOLE("\nPipeline info:");
-            GFXRECON_WRITE_CONSOLE("\tTotal graphics pipelines: %" PRIu64, stats_consumer.GetGraphicsPipelineCount());
-            GFXRECON_WRITE_CONSOLE("\tTotal compute pipelines: %" PRIu64, stats_consumer.GetComputePipelineCount());
+                    GFXRECON_WRITE_CONSOLE("\nCapture CPU timing info:");
+                    GFXRECON_WRITE_CONSOLE("\tTimed frames: %" PRIu64, timed_frames);
+                    GFXRECON_WRITE_CONSOLE(
+                        "\tAverage frame CPU time: %.3f ms",
+                        gfxrecon::util::datetime::ConvertTimestampToMilliseconds(
+                            static_cast<int64_t>(stats_consumer.GetTotalFrameCpuTime() / timed_frames)));
+                    GFXRECON_WRITE_CONSOLE("\tLongest frame CPU time: %.3f ms (frame %u)",
+                                           gfxrecon::util::datetime::ConvertTimestampToMilliseconds(
+                                               static_cast<int64_t>(stats_consumer.GetMaxFrameCpuTime())),
+                                           stats_consumer.GetMaxFrameCpuTimeFrame());
+                    GFXRECON_WRITE_CONSOLE("\tLongest CPU gap between submissions: %.3f ms (frame %u)",
+                                           gfxrecon::util::datetime::ConvertTimestampToMilliseconds(
+                                               static_cast<int64_t>(stats_consumer.GetMaxCpuGap())),
+                                           stats_consumer.GetMaxCpuGapFrame());
+                }
+            }
 
             // TODO: This is the number of recorded draw calls, which will not reflect the number of draw calls executed
             // when recorded once to a command buffer that is submitted/replayed more than once.
@@ -586,6 +1447,21 @@ int main(int argc, const char** argv)
         {
             GFXRECON_WRITE_CONSOLE("File did not contain any frames");
         }
+
+        if (validate)
+        {
+            uint64_t invalid_call_count = decoder.GetInvalidCallCount();
+
+            if (invalid_call_count != 0)
+            {
+                GFXRECON_WRITE_CONSOLE("\nValidation failed: %" PRIu64 " API calls with invalid parameter data",
+                                       invalid_call_count);
+                gfxrecon::util::Log::Release();
+                exit(-1);
+            }
+
+            GFXRECON_WRITE_CONSOLE("\nValidation passed");
+        }
     }
 
     gfxrecon::util::Log::Release();
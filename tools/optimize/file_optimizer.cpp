@@ -22,32 +22,233 @@
 
 #include "file_optimizer.h"
 
+#include "decode/decode_allocator.h"
 #include "format/format_util.h"
+#include "util/compressor.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+const uint64_t kCopyAll        = UINT64_MAX;
+const size_t   kCopyBufferSize = 1024 * 1024;
+
+static bool CopyData(FILE* source, FILE* destination, uint64_t size)
+{
+    // Copy as much of the data as possible within the kernel, which stops at the end of the source file.  Any data
+    // that it does not copy is copied through the buffer.
+    int64_t position = util::platform::FileTell(source);
+
+    if (position >= 0)
+    {
+        uint64_t copied = util::platform::FileCopyRange(destination, source, static_cast<uint64_t>(position), size);
+
+        if (copied > 0)
+        {
+            if (!util::platform::FileSeek(
+                    source, position + static_cast<int64_t>(copied), util::platform::FileSeekSet))
+            {
+                return false;
+            }
+
+            if (size != kCopyAll)
+            {
+                size -= copied;
+            }
+        }
+    }
+
+    std::vector<uint8_t> buffer(kCopyBufferSize);
+
+    while (size > 0)
+    {
+        size_t read_size  = static_cast<size_t>(std::min<uint64_t>(size, buffer.size()));
+        size_t bytes_read = util::platform::FileRead(buffer.data(), 1, read_size, source);
+
+        if (bytes_read == 0)
+        {
+            // Running out of data is only expected when copying to the end of the file.
+            return (size == kCopyAll) && !ferror(source);
+        }
+
+        if (util::platform::FileWrite(buffer.data(), 1, bytes_read, destination) != bytes_read)
+        {
+            return false;
+        }
+
+        if (size != kCopyAll)
+        {
+            size -= bytes_read;
+        }
+    }
+
+    return true;
+}
+
 FileOptimizer::FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids) :
-    unreferenced_ids_(unreferenced_ids)
+    unreferenced_ids_(unreferenced_ids), decoder_(nullptr), frame_count_(0), fill_analyzer_(nullptr), fill_index_(0),
+    data_blocks_written_(0)
 {}
 
 FileOptimizer::FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids) :
-    unreferenced_ids_(std::move(unreferenced_ids))
+    unreferenced_ids_(std::move(unreferenced_ids)), decoder_(nullptr), frame_count_(0), fill_analyzer_(nullptr),
+    fill_index_(0), data_blocks_written_(0)
 {}
 
+FileOptimizer::FileOptimizer(decode::ApiDecoder* decoder) :
+    decoder_(decoder), frame_count_(0), fill_analyzer_(nullptr), fill_index_(0), data_blocks_written_(0)
+{
+    assert(decoder != nullptr);
+}
+
+bool FileOptimizer::RemoveUnreferencedBlocks(const std::string&                          provisional_filename,
+                                             const std::string&                          output_filename,
+                                             const std::vector<InitDataBlock>&           init_data_blocks,
+                                             const std::unordered_set<format::HandleId>& unreferenced_ids,
+                                             uint64_t*                                   bytes_written)
+{
+    assert(bytes_written != nullptr);
+
+    FILE* provisional_file = nullptr;
+    FILE* output_file      = nullptr;
+    bool  stream_output    = (output_filename == "-");
+    bool  success          = false;
+
+    if (stream_output)
+    {
+        output_file = stdout;
+
+        if (!util::platform::SetFileBinaryMode(output_file))
+        {
+            GFXRECON_LOG_WARNING("Failed to set standard output to binary mode");
+        }
+    }
+
+    if ((util::platform::FileOpen(&provisional_file, provisional_filename.c_str(), "rb") == 0) &&
+        (stream_output || (util::platform::FileOpen(&output_file, output_filename.c_str(), "wb") == 0)))
+    {
+        uint64_t offset       = 0;
+        uint64_t omitted_size = 0;
+
+        success = true;
+
+        // The blocks were recorded in file order.
+        for (const auto& block : init_data_blocks)
+        {
+            if (unreferenced_ids.find(block.resource_id) != unreferenced_ids.end())
+            {
+                assert(block.offset >= offset);
+
+                success = CopyData(provisional_file, output_file, block.offset - offset) &&
+                          util::platform::FileSeek(
+                              provisional_file, static_cast<int64_t>(block.size), util::platform::FileSeekCurrent);
+
+                if (!success)
+                {
+                    break;
+                }
+
+                offset = block.offset + block.size;
+                omitted_size += block.size;
+            }
+        }
+
+        success = success && CopyData(provisional_file, output_file, kCopyAll);
+
+        if (success)
+        {
+            // The position of standard output is not known when it is a pipe.
+            *bytes_written = static_cast<uint64_t>(util::platform::FileTell(provisional_file)) - omitted_size;
+            GFXRECON_LOG_DEBUG("Omitted %" PRIu64 " bytes of resource initialization data", omitted_size);
+        }
+    }
+
+    if (stream_output)
+    {
+        success = (util::platform::FileFlush(output_file) == 0) && success;
+    }
+    else if (output_file != nullptr)
+    {
+        success = (util::platform::FileClose(output_file) == 0) && success;
+    }
+
+    if (provisional_file != nullptr)
+    {
+        util::platform::FileClose(provisional_file);
+    }
+
+    return success;
+}
+
+bool FileOptimizer::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
+{
+    if (decoder_ == nullptr)
+    {
+        return FileTransformer::ProcessFunctionCall(block_header, call_id);
+    }
+
+    // Read the block data so that it can be decoded, then write it to the output file unchanged.
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+    size_t data_size = static_cast<size_t>(block_header.size) - sizeof(call_id);
+
+    if (!ReadParameterBuffer(data_size))
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read function call block data");
+        return false;
+    }
+
+    const uint8_t* data = GetParameterBuffer().data();
+
+    if (!WriteBlockHeader(block_header))
+    {
+        return false;
+    }
+
+    if (!WriteBytes(&call_id, sizeof(call_id)) || !WriteBytes(data, data_size))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write function call block data");
+        return false;
+    }
+
+    if (call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR)
+    {
+        ++frame_count_;
+    }
+
+    if (decoder_->SupportsApiCall(call_id))
+    {
+        return DecodeFunctionCall(block_header, call_id, data, data_size);
+    }
+
+    return true;
+}
+
 bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
 {
-    if (meta_type == format::MetaDataType::kInitBufferCommand)
+    if ((meta_type == format::MetaDataType::kInitBufferCommand) ||
+        (meta_type == format::MetaDataType::kInitBufferPatternCommand))
     {
         return FilterInitBufferMetaData(block_header, meta_type);
     }
-    else if (meta_type == format::MetaDataType::kInitImageCommand)
+    else if ((meta_type == format::MetaDataType::kInitImageCommand) ||
+             (meta_type == format::MetaDataType::kInitImagePatternCommand))
     {
         return FilterInitImageMetaData(block_header, meta_type);
     }
+    else if ((fill_analyzer_ != nullptr) && (meta_type == format::MetaDataType::kFillMemoryCommand))
+    {
+        return FilterFillMemoryMetaData(block_header, meta_type);
+    }
+    else if ((fill_analyzer_ != nullptr) && (meta_type == format::MetaDataType::kFillMemoryFromPreviousBlockCommand))
+    {
+        return FilterFillMemoryFromPreviousBlockMetaData(block_header, meta_type);
+    }
     else
     {
         // Copy the meta data block, if it was not filtered.
@@ -55,9 +256,106 @@ bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, for
     }
 }
 
+bool FileOptimizer::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
+{
+    if (!FileTransformer::ProcessStateMarker(block_header, marker_type))
+    {
+        return false;
+    }
+
+    if (decoder_ != nullptr)
+    {
+        // The consumers only need to know where the state snapshot begins and ends, so the frame number is not
+        // forwarded.
+        if (marker_type == format::kBeginMarker)
+        {
+            decoder_->DispatchStateBeginMarker(0);
+        }
+        else if (marker_type == format::kEndMarker)
+        {
+            decoder_->DispatchStateEndMarker(0);
+        }
+    }
+
+    return true;
+}
+
+bool FileOptimizer::DecodeFunctionCall(const format::BlockHeader& block_header,
+                                       format::ApiCallId          call_id,
+                                       const uint8_t*             data,
+                                       size_t                     data_size)
+{
+    decode::ApiCallInfo call_info = {};
+
+    if (data_size < sizeof(call_info.thread_id))
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read function call block header");
+        return false;
+    }
+
+    memcpy(&call_info.thread_id, data, sizeof(call_info.thread_id));
+
+    const uint8_t* parameter_data = data + sizeof(call_info.thread_id);
+    size_t         parameter_size = data_size - sizeof(call_info.thread_id);
+
+    if (format::IsBlockCompressed(block_header.type))
+    {
+        uint64_t          uncompressed_size = 0;
+        util::Compressor* compressor        = GetBlockCompressor(block_header.type);
+
+        if ((compressor == nullptr) || (parameter_size < sizeof(uncompressed_size)))
+        {
+            HandleBlockReadError(kErrorReadingCompressedBlockHeader,
+                                 "Failed to read compressed function call block header");
+            return false;
+        }
+
+        memcpy(&uncompressed_size, parameter_data, sizeof(uncompressed_size));
+        parameter_data += sizeof(uncompressed_size);
+        parameter_size -= sizeof(uncompressed_size);
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+        size_t expected_size = static_cast<size_t>(uncompressed_size);
+
+        if (decode_buffer_.size() < expected_size)
+        {
+            decode_buffer_.resize(expected_size);
+        }
+
+        if (compressor->Decompress(parameter_size, parameter_data, expected_size, &decode_buffer_) != expected_size)
+        {
+            HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                 "Failed to read compressed function call block data");
+            return false;
+        }
+
+        parameter_data = decode_buffer_.data();
+        parameter_size = expected_size;
+    }
+
+    // The handle IDs of the call are decoded with the encoding of the input file.
+    decode_context_.SetHandleIdEncoding(GetEnabledOptions().handle_id_encoding);
+    decode::DecodeContext::Scope context_scope(&decode_context_);
+
+    decode::DecodeAllocator::Begin();
+    decoder_->DecodeFunctionCall(call_id, call_info, parameter_data, parameter_size);
+    decode::DecodeAllocator::End();
+
+    return true;
+}
+
+void FileOptimizer::AddInitDataBlock(uint64_t offset, format::HandleId resource_id)
+{
+    if (decoder_ != nullptr)
+    {
+        init_data_blocks_.push_back({ offset, GetNumBytesWritten() - offset, resource_id });
+    }
+}
+
 bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
 {
-    assert(meta_type == format::MetaDataType::kInitBufferCommand);
+    assert((meta_type == format::MetaDataType::kInitBufferCommand) ||
+           (meta_type == format::MetaDataType::kInitBufferPatternCommand));
 
     format::InitBufferCommandHeader header;
 
@@ -83,6 +381,7 @@ bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_he
         else
         {
             // Copy the block from the input file to the output file.
+            uint64_t block_offset             = GetNumBytesWritten();
             header.meta_header.block_header   = block_header;
             header.meta_header.meta_data_type = meta_type;
 
@@ -98,6 +397,8 @@ bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_he
                 HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy init buffer data meta-data block data");
                 return false;
             }
+
+            AddInitDataBlock(block_offset, header.buffer_id);
         }
     }
     else
@@ -111,7 +412,8 @@ bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_he
 
 bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
 {
-    assert(meta_type == format::MetaDataType::kInitImageCommand);
+    assert((meta_type == format::MetaDataType::kInitImageCommand) ||
+           (meta_type == format::MetaDataType::kInitImagePatternCommand));
 
     format::InitImageCommandHeader header;
     std::vector<uint64_t>          level_sizes;
@@ -141,6 +443,7 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
         else
         {
             // Copy the block from the input file to the output file.
+            uint64_t block_offset             = GetNumBytesWritten();
             header.meta_header.block_header   = block_header;
             header.meta_header.meta_data_type = meta_type;
 
@@ -156,6 +459,8 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
                 HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy init image data meta-data block data");
                 return false;
             }
+
+            AddInitDataBlock(block_offset, header.image_id);
         }
     }
     else
@@ -167,4 +472,194 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
     return true;
 }
 
+bool FileOptimizer::FilterFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+{
+    assert(meta_type == format::MetaDataType::kFillMemoryCommand);
+
+    format::FillMemoryCommandHeader header;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+    success      = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+    success      = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        return false;
+    }
+
+    // Total number of bytes remaining to be read for the current block.
+    uint64_t unread_bytes = block_header.size - (sizeof(header) - sizeof(block_header));
+    uint64_t used_offset  = 0;
+    uint64_t used_size    = 0;
+
+    FillMemoryAnalyzer::FillAction action = fill_analyzer_->GetFillAction(fill_index_++, &used_offset, &used_size);
+
+    if (action == FillMemoryAnalyzer::FillAction::kRemove)
+    {
+        // Blocks that reuse the data are never removed, so the removed block does not need a valid output index.
+        data_block_indices_.push_back(data_blocks_written_);
+
+        if (!SkipBytes(unread_bytes))
+        {
+            HandleBlockReadError(kErrorSeekingFile, "Failed to skip fill memory meta-data block data");
+            return false;
+        }
+
+        return true;
+    }
+
+    data_block_indices_.push_back(data_blocks_written_++);
+
+    header.meta_header.block_header   = block_header;
+    header.meta_header.meta_data_type = meta_type;
+
+    if (action == FillMemoryAnalyzer::FillAction::kKeep)
+    {
+        if (!WriteBytes(&header, sizeof(header)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
+            return false;
+        }
+
+        if (!CopyBytes(unread_bytes))
+        {
+            HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy fill memory meta-data block data");
+            return false;
+        }
+
+        return true;
+    }
+
+    // Write only the part of the data that is used.
+    assert((used_offset >= header.memory_offset) &&
+           ((used_offset + used_size) <= (header.memory_offset + header.memory_size)));
+
+    uint64_t skip_begin = used_offset - header.memory_offset;
+    uint64_t skip_end   = header.memory_size - skip_begin - used_size;
+
+    header.memory_offset = used_offset;
+    header.memory_size   = used_size;
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, used_size);
+
+    if (!format::IsBlockCompressed(block_header.type))
+    {
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + used_size;
+
+        if (!WriteBytes(&header, sizeof(header)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
+            return false;
+        }
+
+        if (!SkipBytes(skip_begin) || !CopyBytes(used_size) || !SkipBytes(skip_end))
+        {
+            HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy fill memory meta-data block data");
+            return false;
+        }
+
+        return true;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, unread_bytes);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, skip_begin + used_size + skip_end);
+
+    size_t uncompressed_size = 0;
+    size_t expected_size     = static_cast<size_t>(skip_begin + used_size + skip_end);
+
+    if (!ReadCompressedParameterBuffer(static_cast<size_t>(unread_bytes), expected_size, &uncompressed_size) ||
+        (uncompressed_size != expected_size))
+    {
+        HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read fill memory meta-data block data");
+        return false;
+    }
+
+    const uint8_t*        used_data       = GetParameterBuffer().data() + skip_begin;
+    std::vector<uint8_t>& compressed_data = GetCompressedParameterBuffer();
+    util::Compressor*     compressor      = GetBlockCompressor(block_header.type);
+    size_t                compressed_size = 0;
+
+    if (compressor != nullptr)
+    {
+        compressed_size = compressor->Compress(static_cast<size_t>(used_size), used_data, &compressed_data, 0);
+    }
+
+    if ((compressed_size > 0) && (compressed_size < used_size))
+    {
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + compressed_size;
+        used_data                            = compressed_data.data();
+    }
+    else
+    {
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + used_size;
+        compressed_size                      = static_cast<size_t>(used_size);
+    }
+
+    if (!WriteBytes(&header, sizeof(header)))
+    {
+        HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
+        return false;
+    }
+
+    if (!WriteBytes(used_data, compressed_size))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory meta-data block data");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileOptimizer::FilterFillMemoryFromPreviousBlockMetaData(const format::BlockHeader& block_header,
+                                                              format::MetaDataType       meta_type)
+{
+    assert(meta_type == format::MetaDataType::kFillMemoryFromPreviousBlockCommand);
+
+    format::FillMemoryFromPreviousBlockCommand command;
+
+    bool success = ReadBytes(&command.thread_id, sizeof(command.thread_id));
+    success      = success && ReadBytes(&command.memory_id, sizeof(command.memory_id));
+    success      = success && ReadBytes(&command.memory_offset, sizeof(command.memory_offset));
+    success      = success && ReadBytes(&command.memory_size, sizeof(command.memory_size));
+    success      = success && ReadBytes(&command.source_index, sizeof(command.source_index));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader,
+                             "Failed to read fill memory from previous block meta-data block");
+        return false;
+    }
+
+    uint64_t used_offset = 0;
+    uint64_t used_size   = 0;
+
+    // The command has no data to truncate, so it is either kept whole or removed.
+    if (fill_analyzer_->GetFillAction(fill_index_++, &used_offset, &used_size) ==
+        FillMemoryAnalyzer::FillAction::kRemove)
+    {
+        return true;
+    }
+
+    // Blocks that store data may have been removed ahead of the source block.
+    if (command.source_index < data_block_indices_.size())
+    {
+        command.source_index = data_block_indices_[command.source_index];
+    }
+
+    command.meta_header.block_header   = block_header;
+    command.meta_header.meta_data_type = meta_type;
+
+    if (!WriteBytes(&command, sizeof(command)))
+    {
+        HandleBlockWriteError(kErrorWritingBlockHeader,
+                              "Failed to write fill memory from previous block meta-data block");
+        return false;
+    }
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(gfxrecon)
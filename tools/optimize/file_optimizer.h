@@ -23,30 +23,93 @@
 #ifndef GFXRECON_FILE_OPTIMIZER_H
 #define GFXRECON_FILE_OPTIMIZER_H
 
+#include "decode/api_decoder.h"
+#include "decode/decode_context.h"
 #include "decode/file_transformer.h"
+#include "fill_memory_analyzer.h"
+#include "format/format.h"
 #include "util/defines.h"
 
+#include <cstdint>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
 class FileOptimizer : public decode::FileTransformer
 {
+  public:
+    // Location of a resource initialization block in the output file.
+    struct InitDataBlock
+    {
+        uint64_t         offset;
+        uint64_t         size;
+        format::HandleId resource_id;
+    };
+
   public:
     FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids);
 
     FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids);
 
+    // Single pass mode, where the unreferenced resources are not known until the file has been processed.  The function
+    // calls and state markers are passed to the decoder as the file is copied, so that its consumers can determine the
+    // referenced resources.  All resource initialization blocks are copied, and their locations are recorded so that
+    // the unreferenced blocks can be removed by RemoveUnreferencedBlocks().
+    FileOptimizer(decode::ApiDecoder* decoder);
+
+    // Removes or truncates the fill memory blocks with data that is overwritten before it is used, as determined by the
+    // analyzer from an earlier pass over the input file.
+    void SetFillMemoryAnalyzer(const FillMemoryAnalyzer* fill_analyzer) { fill_analyzer_ = fill_analyzer; }
+
+    const std::vector<InitDataBlock>& GetInitDataBlocks() const { return init_data_blocks_; }
+
+    uint64_t GetFrameCount() const { return frame_count_; }
+
+    // Copies a file that was written in single pass mode to a new file, or to standard output when the output filename
+    // is "-", omitting the initialization blocks of the unreferenced resources.
+    static bool RemoveUnreferencedBlocks(const std::string&                          provisional_filename,
+                                         const std::string&                          output_filename,
+                                         const std::vector<InitDataBlock>&           init_data_blocks,
+                                         const std::unordered_set<format::HandleId>& unreferenced_ids,
+                                         uint64_t*                                   bytes_written);
+
   protected:
+    virtual bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id) override;
+
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type) override;
 
+    virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type) override;
+
   private:
+    bool DecodeFunctionCall(const format::BlockHeader& block_header,
+                            format::ApiCallId          call_id,
+                            const uint8_t*             data,
+                            size_t                     data_size);
+
     bool FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
 
     bool FilterInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
 
+    bool FilterFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
+
+    bool FilterFillMemoryFromPreviousBlockMetaData(const format::BlockHeader& block_header,
+                                                   format::MetaDataType       meta_type);
+
+    void AddInitDataBlock(uint64_t offset, format::HandleId resource_id);
+
   private:
     std::unordered_set<format::HandleId> unreferenced_ids_;
+    decode::ApiDecoder*                  decoder_;
+    decode::DecodeContext                decode_context_;
+    std::vector<uint8_t>                 decode_buffer_;
+    std::vector<InitDataBlock>           init_data_blocks_;
+    uint64_t                             frame_count_;
+    const FillMemoryAnalyzer*            fill_analyzer_;
+    uint64_t                             fill_index_;
+    std::vector<uint64_t>                data_block_indices_; // Output index of each input kFillMemoryCommand block.
+    uint64_t                             data_blocks_written_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,296 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "fill_memory_analyzer.h"
+
+#include "format/format_util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include <unordered_set>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Calls that do not read the contents of device memory, and cannot allow previously submitted work to read it.  Command
+// buffer recording calls are identified by name.
+static const std::unordered_set<format::ApiCallId> kNoMemoryReadCalls = {
+    format::ApiCallId::ApiCall_vkMapMemory,
+    format::ApiCallId::ApiCall_vkUnmapMemory,
+    format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges,
+    format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges,
+    format::ApiCallId::ApiCall_vkAllocateMemory,
+    format::ApiCallId::ApiCall_vkFreeMemory,
+    format::ApiCallId::ApiCall_vkBindBufferMemory,
+    format::ApiCallId::ApiCall_vkBindBufferMemory2,
+    format::ApiCallId::ApiCall_vkBindBufferMemory2KHR,
+    format::ApiCallId::ApiCall_vkBindImageMemory,
+    format::ApiCallId::ApiCall_vkBindImageMemory2,
+    format::ApiCallId::ApiCall_vkBindImageMemory2KHR,
+    format::ApiCallId::ApiCall_vkCreateBuffer,
+    format::ApiCallId::ApiCall_vkDestroyBuffer,
+    format::ApiCallId::ApiCall_vkCreateBufferView,
+    format::ApiCallId::ApiCall_vkDestroyBufferView,
+    format::ApiCallId::ApiCall_vkCreateImageView,
+    format::ApiCallId::ApiCall_vkDestroyImageView,
+    format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements,
+    format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2,
+    format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR,
+    format::ApiCallId::ApiCall_vkGetImageMemoryRequirements,
+    format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2,
+    format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR,
+    format::ApiCallId::ApiCall_vkGetBufferDeviceAddress,
+    format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR,
+    format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT,
+    format::ApiCallId::ApiCall_vkAllocateCommandBuffers,
+    format::ApiCallId::ApiCall_vkFreeCommandBuffers,
+    format::ApiCallId::ApiCall_vkResetCommandPool,
+    format::ApiCallId::ApiCall_vkBeginCommandBuffer,
+    format::ApiCallId::ApiCall_vkEndCommandBuffer,
+    format::ApiCallId::ApiCall_vkResetCommandBuffer,
+    format::ApiCallId::ApiCall_vkAllocateDescriptorSets,
+    format::ApiCallId::ApiCall_vkFreeDescriptorSets,
+    format::ApiCallId::ApiCall_vkResetDescriptorPool,
+    format::ApiCallId::ApiCall_vkUpdateDescriptorSets,
+    format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplate,
+    format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplateKHR,
+    format::ApiCallId::ApiCall_vkWaitForFences,
+    format::ApiCallId::ApiCall_vkGetFenceStatus,
+    format::ApiCallId::ApiCall_vkResetFences,
+    format::ApiCallId::ApiCall_vkWaitSemaphores,
+    format::ApiCallId::ApiCall_vkWaitSemaphoresKHR,
+    format::ApiCallId::ApiCall_vkGetSemaphoreCounterValue,
+    format::ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR,
+    format::ApiCallId::ApiCall_vkGetEventStatus,
+    format::ApiCallId::ApiCall_vkQueueWaitIdle,
+    format::ApiCallId::ApiCall_vkDeviceWaitIdle,
+    format::ApiCallId::ApiCall_vkGetQueryPoolResults,
+    format::ApiCallId::ApiCall_vkResetQueryPool,
+    format::ApiCallId::ApiCall_vkResetQueryPoolEXT,
+    format::ApiCallId::ApiCall_vkAcquireNextImageKHR,
+    format::ApiCallId::ApiCall_vkAcquireNextImage2KHR
+};
+
+FillMemoryAnalyzer::FillMemoryAnalyzer() : next_from_previous_(false), unused_fill_size_(0) {}
+
+void FillMemoryAnalyzer::Finalize()
+{
+    EndFillLiveness();
+
+    unused_fill_size_ = 0;
+
+    for (const auto& fill : fills_)
+    {
+        if (!fill.keep)
+        {
+            uint64_t used_size = fill.used_end - fill.used_begin;
+
+            if (used_size == 0)
+            {
+                unused_fill_size_ += fill.size;
+            }
+            else if (!fill.from_previous)
+            {
+                unused_fill_size_ += fill.size - used_size;
+            }
+        }
+    }
+}
+
+void FillMemoryAnalyzer::WriteResults(decode::AnalysisCache::Writer* writer) const
+{
+    assert(writer != nullptr);
+
+    writer->WriteVector(fills_);
+    writer->Write(unused_fill_size_);
+}
+
+bool FillMemoryAnalyzer::ReadResults(decode::AnalysisCache::Reader* reader)
+{
+    assert(reader != nullptr);
+
+    return reader->ReadVector(&fills_) && reader->Read(&unused_fill_size_);
+}
+
+FillMemoryAnalyzer::FillAction
+FillMemoryAnalyzer::GetFillAction(uint64_t fill_index, uint64_t* offset, uint64_t* size) const
+{
+    assert((offset != nullptr) && (size != nullptr));
+
+    if (fill_index >= fills_.size())
+    {
+        return FillAction::kKeep;
+    }
+
+    const FillInfo& fill = fills_[fill_index];
+
+    if (fill.keep || (fill.size == 0))
+    {
+        return FillAction::kKeep;
+    }
+    else if (fill.used_begin == fill.used_end)
+    {
+        return FillAction::kRemove;
+    }
+    else if (fill.from_previous || ((fill.used_begin == fill.offset) && (fill.used_end == (fill.offset + fill.size))))
+    {
+        return FillAction::kKeep;
+    }
+
+    *offset = fill.used_begin;
+    *size   = fill.used_end - fill.used_begin;
+
+    return FillAction::kTruncate;
+}
+
+void FillMemoryAnalyzer::DecodeFunctionCall(format::ApiCallId          call_id,
+                                            const decode::ApiCallInfo& call_info,
+                                            const uint8_t*             buffer,
+                                            size_t                     buffer_size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(call_info);
+    GFXRECON_UNREFERENCED_PARAMETER(buffer);
+    GFXRECON_UNREFERENCED_PARAMETER(buffer_size);
+
+    if (MayReadMemory(call_id))
+    {
+        EndFillLiveness();
+    }
+}
+
+void FillMemoryAnalyzer::DispatchFillMemoryCommand(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    uint64_t fill_index = fills_.size();
+
+    FillInfo fill;
+    fill.offset        = offset;
+    fill.size          = size;
+    fill.from_previous = next_from_previous_;
+    fills_.push_back(fill);
+
+    if (!next_from_previous_)
+    {
+        data_block_fills_.push_back(fill_index);
+    }
+
+    next_from_previous_ = false;
+
+    if (size == 0)
+    {
+        return;
+    }
+
+    // Replace the parts of the pending ranges that are overwritten by the new fill.
+    PendingRanges& ranges = pending_ranges_[memory_id];
+    uint64_t       end    = offset + size;
+
+    auto range = ranges.upper_bound(offset);
+    if (range != ranges.begin())
+    {
+        auto previous = std::prev(range);
+        if (previous->second.end > offset)
+        {
+            range = previous;
+        }
+    }
+
+    while ((range != ranges.end()) && (range->first < end))
+    {
+        uint64_t     range_begin = range->first;
+        PendingRange pending     = range->second;
+
+        range = ranges.erase(range);
+
+        if (range_begin < offset)
+        {
+            ranges.emplace(range_begin, PendingRange{ offset, pending.fill_index });
+        }
+
+        if (pending.end > end)
+        {
+            range = ranges.emplace(end, PendingRange{ pending.end, pending.fill_index }).first;
+            break;
+        }
+    }
+
+    ranges.emplace(offset, PendingRange{ end, fill_index });
+}
+
+void FillMemoryAnalyzer::DispatchFillMemoryFromPreviousBlockCommand(format::ThreadId thread_id, uint64_t source_index)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    // The block that stores the data must be kept whole, even if its own fill is overwritten.
+    if (source_index < data_block_fills_.size())
+    {
+        fills_[data_block_fills_[source_index]].keep = true;
+    }
+
+    next_from_previous_ = true;
+}
+
+bool FillMemoryAnalyzer::MayReadMemory(format::ApiCallId call_id)
+{
+    auto entry = may_read_memory_.find(call_id);
+
+    if (entry == may_read_memory_.end())
+    {
+        // Recorded commands read memory when they are submitted, not when they are recorded.
+        bool may_read = (kNoMemoryReadCalls.find(call_id) == kNoMemoryReadCalls.end()) &&
+                        (strncmp(format::GetApiCallName(call_id), "vkCmd", 5) != 0);
+
+        entry = may_read_memory_.emplace(call_id, may_read).first;
+    }
+
+    return entry->second;
+}
+
+void FillMemoryAnalyzer::EndFillLiveness()
+{
+    for (const auto& memory_entry : pending_ranges_)
+    {
+        for (const auto& range_entry : memory_entry.second)
+        {
+            FillInfo& fill = fills_[range_entry.second.fill_index];
+
+            if (fill.used_begin == fill.used_end)
+            {
+                fill.used_begin = range_entry.first;
+                fill.used_end   = range_entry.second.end;
+            }
+            else
+            {
+                fill.used_begin = std::min(fill.used_begin, range_entry.first);
+                fill.used_end   = std::max(fill.used_end, range_entry.second.end);
+            }
+        }
+    }
+
+    pending_ranges_.clear();
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,250 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_FILL_MEMORY_ANALYZER_H
+#define GFXRECON_FILL_MEMORY_ANALYZER_H
+
+#include "decode/analysis_cache.h"
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Finds the fill memory command data that is overwritten by later fill memory commands before it can be used.  Fill
+// memory data is considered used by the first call after it that may read memory, such as a queue submission.  Calls
+// that are known not to read memory, including all command buffer recording calls, do not end the liveness of the
+// data.  The fill memory commands are identified by their index among the file's fill memory blocks, including the
+// blocks that reuse the data of an earlier block.
+class FillMemoryAnalyzer : public decode::ApiDecoder
+{
+  public:
+    enum class FillAction
+    {
+        kKeep,
+        kRemove,
+        kTruncate
+    };
+
+  public:
+    FillMemoryAnalyzer();
+
+    // Ends the liveness of the fill memory data that has not been used by the end of the file.  Must be called after
+    // the file has been processed, before GetFillAction() is called.
+    void Finalize();
+
+    // Gets the action for a fill memory block.  For kTruncate, the range of the fill that is used is returned through
+    // offset and size.
+    FillAction GetFillAction(uint64_t fill_index, uint64_t* offset, uint64_t* size) const;
+
+    // Number of bytes of fill memory data that can be removed.
+    uint64_t GetUnusedFillSize() const { return unused_fill_size_; }
+
+    // Stores the results of a finalized analysis, which can be loaded in place of processing the same file again.
+    void WriteResults(decode::AnalysisCache::Writer* writer) const;
+
+    bool ReadResults(decode::AnalysisCache::Reader* reader);
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override { return true; }
+
+    // The analysis only depends on the order of the calls that the analyzer receives, which is the same from the decode
+    // thread, so the calls are analyzed as they are decoded instead of being recorded for the processing thread.
+    virtual bool SetCallRecorder(decode::DecodedCallRecorder* recorder) override { return true; }
+
+    virtual void DecodeFunctionCall(format::ApiCallId          call_id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             buffer,
+                                    size_t                     buffer_size) override;
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override {}
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override {}
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override {}
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
+
+    virtual void DispatchFillMemoryFromPreviousBlockCommand(format::ThreadId thread_id, uint64_t source_index) override;
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override
+    {}
+
+    virtual void DispatchResizeWindowCommand2(format::ThreadId thread_id,
+                                              format::HandleId surface_id,
+                                              uint32_t         width,
+                                              uint32_t         height,
+                                              uint32_t         pre_transform) override
+    {}
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint32_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override
+    {
+        EndFillLiveness();
+    }
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override
+    {
+        EndFillLiveness();
+    }
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override
+    {}
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override
+    {}
+
+    virtual void DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
+                                                 format::HandleId device_id,
+                                                 format::HandleId buffer_id,
+                                                 uint64_t         address) override
+    {}
+
+    virtual void DispatchSetRayTracingShaderGroupHandlesCommand(format::ThreadId thread_id,
+                                                                format::HandleId device_id,
+                                                                format::HandleId buffer_id,
+                                                                size_t           data_size,
+                                                                const uint8_t*   data) override
+    {}
+
+    virtual void DispatchSetPipelineCacheDataCommand(format::ThreadId thread_id,
+                                                     format::HandleId device_id,
+                                                     size_t           data_size,
+                                                     const uint8_t*   data) override
+    {}
+
+    virtual void DispatchTimestampCommand(format::ThreadId thread_id, uint64_t timestamp) override {}
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override
+    {
+        EndFillLiveness();
+    }
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override
+    {
+        EndFillLiveness();
+    }
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override
+    {
+        EndFillLiveness();
+    }
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override
+    {
+        EndFillLiveness();
+    }
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override
+    {
+        EndFillLiveness();
+    }
+
+  private:
+    struct FillInfo
+    {
+        uint64_t offset{ 0 };
+        uint64_t size{ 0 };
+        uint64_t used_begin{ 0 }; // Range of the fill that is used, which is empty when used_begin == used_end.
+        uint64_t used_end{ 0 };
+        bool     keep{ false };          // The data is needed by a later block that reuses it.
+        bool     from_previous{ false }; // The data is stored by an earlier block, so the fill cannot be truncated.
+    };
+
+    // Fill memory data that has been written since the last call that may read memory, keyed by the start of the
+    // range, and identified by the index of the fill that wrote it.
+    struct PendingRange
+    {
+        uint64_t end;
+        uint64_t fill_index;
+    };
+
+    typedef std::map<uint64_t, PendingRange> PendingRanges;
+
+  private:
+    bool MayReadMemory(format::ApiCallId call_id);
+
+    // Marks the pending fill memory data as used.
+    void EndFillLiveness();
+
+  private:
+    std::vector<FillInfo>                       fills_;
+    std::vector<uint64_t>                       data_block_fills_; // Fill index for each block that stores data.
+    bool                                        next_from_previous_;
+    std::unordered_map<uint64_t, PendingRanges> pending_ranges_;
+    std::unordered_map<format::ApiCallId, bool> may_read_memory_;
+    uint64_t                                    unused_fill_size_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FILL_MEMORY_ANALYZER_H
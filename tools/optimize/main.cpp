@@ -22,7 +22,9 @@
 
 #include "project_version.h"
 #include "file_optimizer.h"
+#include "fill_memory_analyzer.h"
 
+#include "decode/analysis_cache.h"
 #include "decode/file_processor.h"
 #include "format/format.h"
 #include "format/format_util.h"
@@ -34,6 +36,8 @@
 #include "vulkan/vulkan.h"
 
 #include <cassert>
+#include <cstdio>
+#include <cstdlib>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
@@ -43,8 +47,18 @@ const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
 const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kIoUringOption[]   = "--io-uring";
+const char kSinglePass[]      = "--single-pass";
+const char kNoAnalysisCache[] = "--no-analysis-cache";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kDecompressionThreadsArgument[] = "--decompression-threads";
+const char kAnalysisThreadsArgument[]      = "--analysis-threads";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--io-uring,--single-pass,--no-analysis-cache";
+const char kArguments[] = "--decompression-threads,--analysis-threads";
+
+// Name of the file written by single pass mode when the output file is written to standard output.
+const char kStandardOutputProvisionalFilename[] = "gfxrecon-optimize-stdout.partial";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -58,13 +72,43 @@ static void PrintUsage(const char* exe_name)
         "\n%s - Remove unused resource initialization data from trimmed GFXReconstruct capture files.\n",
         app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input-file> <output-file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s\t[-h | --help] [--version] [--io-uring] [--single-pass]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--no-analysis-cache] [--decompression-threads <N>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--analysis-threads <N>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t<input-file> <output-file>\n");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
-    GFXRECON_WRITE_CONSOLE("  <input-file>\t\tThe trimmed GFXReconstruct capture file to be processed.");
-    GFXRECON_WRITE_CONSOLE("  <output-file>\t\tThe name of the new GFXReconstruct capture file to be created.");
+    GFXRECON_WRITE_CONSOLE("  <input-file>\t\tThe trimmed GFXReconstruct capture file to be processed, or -");
+    GFXRECON_WRITE_CONSOLE("        \t\tto read the file from standard input, which implies");
+    GFXRECON_WRITE_CONSOLE("        \t\t--single-pass and --no-analysis-cache.");
+    GFXRECON_WRITE_CONSOLE("  <output-file>\t\tThe name of the new GFXReconstruct capture file to be created, or");
+    GFXRECON_WRITE_CONSOLE("        \t\t- to write the file to standard output.  Messages are then");
+    GFXRECON_WRITE_CONSOLE("        \t\twritten to standard error, and the file is written even when");
+    GFXRECON_WRITE_CONSOLE("        \t\tnothing is removed.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --io-uring\t\tWrite the output file with io_uring (Linux only).");
+    GFXRECON_WRITE_CONSOLE("  --single-pass\t\tRead and decompress the input file once, instead of once to");
+    GFXRECON_WRITE_CONSOLE("        \t\tfind the unused resources and again to write the output file.");
+    GFXRECON_WRITE_CONSOLE("        \t\tAll blocks are written to <output-file>.partial, which is");
+    GFXRECON_WRITE_CONSOLE("        \t\tcopied to <output-file> without the unused initialization");
+    GFXRECON_WRITE_CONSOLE("        \t\tdata and then deleted.  Requires free disk space for both");
+    GFXRECON_WRITE_CONSOLE("        \t\tfiles.  When <output-file> is -, the blocks are written to");
+    GFXRECON_WRITE_CONSOLE("        \t\t%s in the current directory.", kStandardOutputProvisionalFilename);
+    GFXRECON_WRITE_CONSOLE("  --no-analysis-cache\tDo not read or write <input-file>.meta, which stores the");
+    GFXRECON_WRITE_CONSOLE("        \t\tunused resources and memory data found by a previous run, so");
+    GFXRECON_WRITE_CONSOLE("        \t\tthat the input file is only scanned when it has changed.");
+    GFXRECON_WRITE_CONSOLE("  --decompression-threads <N>");
+    GFXRECON_WRITE_CONSOLE("        \t\tRead the input file ahead of processing from a separate thread and");
+    GFXRECON_WRITE_CONSOLE("        \t\tdecompress up to N of its blocks concurrently, using a pool of N");
+    GFXRECON_WRITE_CONSOLE("        \t\tworker threads.");
+    GFXRECON_WRITE_CONSOLE("  --analysis-threads <N>");
+    GFXRECON_WRITE_CONSOLE("        \t\tDecode the input file from a separate thread while finding the");
+    GFXRECON_WRITE_CONSOLE("        \t\tunused resources, and process the command buffer recordings of");
+    GFXRECON_WRITE_CONSOLE("        \t\teach captured thread from one of N worker threads.  All other");
+    GFXRECON_WRITE_CONSOLE("        \t\tAPI calls, including descriptor updates and queue submissions,");
+    GFXRECON_WRITE_CONSOLE("        \t\tare processed in file order after the workers finish.  Not used");
+    GFXRECON_WRITE_CONSOLE("        \t\twith --single-pass.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -116,12 +160,70 @@ static std::string GetVersionString(uint32_t api_version)
     return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
 }
 
+// Loads the unreferenced resources and unused fill memory data that a previous run found for the input file.
+static bool ReadCachedAnalysis(const std::string&                              input_filename,
+                               std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids,
+                               gfxrecon::FillMemoryAnalyzer*                   fill_analyzer)
+{
+    assert((unreferenced_ids != nullptr) && (fill_analyzer != nullptr));
+
+    gfxrecon::decode::AnalysisCache cache;
+
+    if (cache.Initialize(input_filename))
+    {
+        auto section = cache.GetSection(gfxrecon::decode::AnalysisCache::kUnreferencedResourcesSection);
+        if (section != nullptr)
+        {
+            gfxrecon::decode::AnalysisCache::Reader reader(*section);
+            std::vector<gfxrecon::format::HandleId> ids;
+
+            if (reader.ReadVector(&ids) && fill_analyzer->ReadResults(&reader) && reader.IsComplete())
+            {
+                unreferenced_ids->insert(ids.begin(), ids.end());
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+static void WriteCachedAnalysis(const std::string&                                    input_filename,
+                                const std::unordered_set<gfxrecon::format::HandleId>& unreferenced_ids,
+                                const gfxrecon::FillMemoryAnalyzer&                   fill_analyzer)
+{
+    gfxrecon::decode::AnalysisCache cache;
+
+    if (cache.Initialize(input_filename))
+    {
+        gfxrecon::decode::AnalysisCache::Writer writer;
+        writer.WriteVector(std::vector<gfxrecon::format::HandleId>(unreferenced_ids.begin(), unreferenced_ids.end()));
+        fill_analyzer.WriteResults(&writer);
+
+        cache.SetSection(gfxrecon::decode::AnalysisCache::kUnreferencedResourcesSection, std::move(writer.GetData()));
+        cache.Write();
+    }
+}
+
 void GetUnreferencedResources(const std::string&                              input_filename,
-                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids)
+                              uint32_t                                        decompression_threads,
+                              uint32_t                                        analysis_threads,
+                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids,
+                              gfxrecon::FillMemoryAnalyzer*                   fill_analyzer)
 {
-    assert(unreferenced_ids != nullptr);
+    assert((unreferenced_ids != nullptr) && (fill_analyzer != nullptr));
 
     gfxrecon::decode::FileProcessor file_processor;
+    file_processor.SetDecompressionThreads(decompression_threads);
+
+    if (analysis_threads > 0)
+    {
+        // The references that command buffers record are only merged into the used resources when the command buffers
+        // are submitted, so the recordings of different captured threads can be processed concurrently.
+        file_processor.SetUseDecodeThread(true);
+        file_processor.SetCommandBufferThreads(analysis_threads);
+    }
+
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::VulkanDecoder                    decoder;
@@ -130,6 +232,7 @@ void GetUnreferencedResources(const std::string&                              in
         decoder.AddConsumer(&resref_consumer);
 
         file_processor.AddDecoder(&decoder);
+        file_processor.AddDecoder(fill_analyzer);
         file_processor.ProcessAllFrames();
 
         if ((file_processor.GetCurrentFrameNumber() > 0) &&
@@ -137,6 +240,11 @@ void GetUnreferencedResources(const std::string&                              in
         {
             // Get the list of resources that were included in a command buffer submission during replay.
             resref_consumer.GetReferencedResourceIds(nullptr, unreferenced_ids);
+            GFXRECON_LOG_INFO("Resource reference analysis used up to %" PRIu64 " bytes of memory",
+                              static_cast<uint64_t>(resref_consumer.GetMemoryHighWaterMark()));
+
+            // Get the fill memory data that is overwritten before it is used.
+            fill_analyzer->Finalize();
         }
         else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
@@ -155,9 +263,16 @@ void GetUnreferencedResources(const std::string&                              in
 
 void FilterUnreferencedResources(const std::string&                               input_filename,
                                  const std::string&                               output_filename,
-                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids)
+                                 bool                                             use_io_uring,
+                                 uint32_t                                         decompression_threads,
+                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids,
+                                 const gfxrecon::FillMemoryAnalyzer*              fill_analyzer)
 {
     gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids));
+    file_processor.SetFillMemoryAnalyzer(fill_analyzer);
+    file_processor.SetUseIoUring(use_io_uring);
+    file_processor.SetDecompressionThreads(decompression_threads);
+
     if (file_processor.Initialize(input_filename, output_filename))
     {
         file_processor.Process();
@@ -175,11 +290,99 @@ void FilterUnreferencedResources(const std::string&
     }
 }
 
+void OptimizeSinglePass(const std::string& input_filename,
+                        const std::string& output_filename,
+                        bool               use_io_uring,
+                        uint32_t           decompression_threads)
+{
+    // Write all blocks to a provisional file while determining the referenced resources, then copy the provisional file
+    // without the initialization data of the unreferenced resources.
+    bool        stream_output        = (output_filename == "-");
+    std::string provisional_filename =
+        stream_output ? std::string(kStandardOutputProvisionalFilename) : (output_filename + ".partial");
+
+    gfxrecon::decode::VulkanDecoder                    decoder;
+    gfxrecon::decode::VulkanReferencedResourceConsumer resref_consumer;
+
+    decoder.AddConsumer(&resref_consumer);
+
+    std::vector<gfxrecon::FileOptimizer::InitDataBlock> init_data_blocks;
+    uint64_t                                            frame_count = 0;
+    uint64_t                                            bytes_read  = 0;
+
+    {
+        gfxrecon::FileOptimizer file_processor(&decoder);
+        file_processor.SetUseIoUring(use_io_uring);
+        file_processor.SetDecompressionThreads(decompression_threads);
+
+        if (!file_processor.Initialize(input_filename, provisional_filename))
+        {
+            return;
+        }
+
+        if (!file_processor.Process())
+        {
+            GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+            std::remove(provisional_filename.c_str());
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        init_data_blocks = file_processor.GetInitDataBlocks();
+        frame_count      = file_processor.GetFrameCount();
+        bytes_read       = file_processor.GetNumBytesRead();
+    }
+
+    std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
+
+    if (frame_count > 0)
+    {
+        // Get the list of resources that were included in a command buffer submission during replay.
+        resref_consumer.GetReferencedResourceIds(nullptr, &unreferenced_ids);
+        GFXRECON_LOG_INFO("Resource reference analysis used up to %" PRIu64 " bytes of memory",
+                          static_cast<uint64_t>(resref_consumer.GetMemoryHighWaterMark()));
+    }
+    else
+    {
+        GFXRECON_WRITE_CONSOLE("File did not contain any frames");
+        std::remove(provisional_filename.c_str());
+        return;
+    }
+
+    if (unreferenced_ids.empty() && !stream_output)
+    {
+        GFXRECON_WRITE_CONSOLE("No unused resources detected.  A new file will not be created.");
+        std::remove(provisional_filename.c_str());
+        return;
+    }
+
+    // Standard output is written even when nothing is removed, as the next command of a pipeline expects the file.
+    GFXRECON_WRITE_CONSOLE("Writing optimized file, removing initialization data for %" PRIu64 " unused resources.",
+                           unreferenced_ids.size());
+
+    uint64_t bytes_written = 0;
+    bool     success       = gfxrecon::FileOptimizer::RemoveUnreferencedBlocks(
+        provisional_filename, output_filename, init_data_blocks, unreferenced_ids, &bytes_written);
+
+    std::remove(provisional_filename.c_str());
+
+    if (!success)
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    GFXRECON_WRITE_CONSOLE("Resource filtering complete.");
+    GFXRECON_WRITE_CONSOLE("\tOriginal file size: %" PRIu64 " bytes", bytes_read);
+    GFXRECON_WRITE_CONSOLE("\tOptimized file size: %" PRIu64 " bytes", bytes_written);
+}
+
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -207,22 +410,79 @@ int main(int argc, const char** argv)
         const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
         std::string                     input_filename       = positional_arguments[0];
         std::string                     output_filename      = positional_arguments[1];
+        bool                            stream_input         = (input_filename == "-");
+        bool                            stream_output        = (output_filename == "-");
 
-        GFXRECON_WRITE_CONSOLE("Scanning %s for unreferenced resources.", input_filename.c_str());
+        if (stream_output)
+        {
+            gfxrecon::util::Log::SetOutputAllToStderr(true);
+        }
+
+        uint32_t           decompression_threads        = 0;
+        const std::string& decompression_threads_string = arg_parser.GetArgumentValue(kDecompressionThreadsArgument);
+        if (!decompression_threads_string.empty() &&
+            !gfxrecon::util::ParseUnsignedInteger(decompression_threads_string, &decompression_threads))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid decompression thread count \"%s\"",
+                                 decompression_threads_string.c_str());
+        }
+
+        uint32_t           analysis_threads        = 0;
+        const std::string& analysis_threads_string = arg_parser.GetArgumentValue(kAnalysisThreadsArgument);
+        if (!analysis_threads_string.empty())
+        {
+            analysis_threads = static_cast<uint32_t>(std::strtoul(analysis_threads_string.c_str(), nullptr, 10));
+        }
+
+        // Standard input can only be read once, and has no file name for the analysis cache.
+        bool use_analysis_cache = !arg_parser.IsOptionSet(kNoAnalysisCache) && !stream_input;
         std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
-        GetUnreferencedResources(input_filename, &unreferenced_ids);
+        gfxrecon::FillMemoryAnalyzer                   fill_analyzer;
+
+        if (use_analysis_cache && ReadCachedAnalysis(input_filename, &unreferenced_ids, &fill_analyzer))
+        {
+            // The file only needs to be read once to write the output, so the single pass mode is not needed.
+            GFXRECON_WRITE_CONSOLE("Using the unreferenced resources found by a previous scan of %s.",
+                                   input_filename.c_str());
+        }
+        else if (arg_parser.IsOptionSet(kSinglePass) || stream_input)
+        {
+            GFXRECON_WRITE_CONSOLE("Copying %s and scanning for unreferenced resources.", input_filename.c_str());
+            OptimizeSinglePass(
+                input_filename, output_filename, arg_parser.IsOptionSet(kIoUringOption), decompression_threads);
+
+            gfxrecon::util::Log::Release();
+            return 0;
+        }
+        else
+        {
+            GFXRECON_WRITE_CONSOLE("Scanning %s for unreferenced resources.", input_filename.c_str());
+            GetUnreferencedResources(
+                input_filename, decompression_threads, analysis_threads, &unreferenced_ids, &fill_analyzer);
+
+            if (use_analysis_cache)
+            {
+                WriteCachedAnalysis(input_filename, unreferenced_ids, fill_analyzer);
+            }
+        }
 
-        if (!unreferenced_ids.empty())
+        if (!unreferenced_ids.empty() || (fill_analyzer.GetUnusedFillSize() > 0) || stream_output)
         {
-            // Filter unreferenced ids.
+            // Filter unreferenced ids and overwritten fill memory data.
             GFXRECON_WRITE_CONSOLE("Writing optimized file, removing initialization data for %" PRIu64
-                                   " unused resources.",
-                                   unreferenced_ids.size());
-            FilterUnreferencedResources(input_filename, output_filename, std::move(unreferenced_ids));
+                                   " unused resources and %" PRIu64 " bytes of overwritten memory data.",
+                                   unreferenced_ids.size(),
+                                   fill_analyzer.GetUnusedFillSize());
+            FilterUnreferencedResources(input_filename,
+                                        output_filename,
+                                        arg_parser.IsOptionSet(kIoUringOption),
+                                        decompression_threads,
+                                        std::move(unreferenced_ids),
+                                        &fill_analyzer);
         }
         else
         {
-            GFXRECON_WRITE_CONSOLE("No unused resources detected.  A new file will not be created.",
+            GFXRECON_WRITE_CONSOLE("No unused resources or memory data detected.  A new file will not be created.",
                                    input_filename.c_str());
         }
     }
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 LunarG, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+#
+# Utility for receiving a capture file that the capture layer streams over TCP when the capture
+# file name is a socket address of the form tcp://host:port or tcp://:port.
+
+
+import argparse
+import socket
+import sys
+import time
+
+
+RECEIVE_BUFFER_SIZE = 8 * 1024 * 1024
+CHUNK_SIZE = 1024 * 1024
+
+
+def CreateArgParser():
+    parser = argparse.ArgumentParser(description='Receive a capture file that is streamed from the GFXReconstruct capture layer.')
+    mode = parser.add_mutually_exclusive_group(required=True)
+    mode.add_argument('-l', '--listen', dest='listen', metavar='PORT', type=int,
+                      help='Listen on PORT for the capture layer to connect, when the capture file is set to tcp://<host>:PORT')
+    mode.add_argument('-c', '--connect', dest='connect', metavar='HOST:PORT',
+                      help='Connect to the capture layer, when the capture file is set to tcp://:PORT.  For Android devices connected with adb, forward the port with "adb forward tcp:PORT tcp:PORT" and connect to localhost:PORT')
+    parser.add_argument('file', help='Capture file to write')
+    return parser
+
+
+def Connect(address):
+    host, _, port = address.rpartition(':')
+    host = host.strip('[]')
+    if not host or not port.isdigit():
+        print('Error: Invalid address {}; expected HOST:PORT'.format(address))
+        sys.exit(1)
+
+    # The capture layer may not be listening yet, so retry until it starts.
+    while True:
+        try:
+            return socket.create_connection((host, int(port)))
+        except OSError:
+            time.sleep(0.5)
+
+
+def Accept(port):
+    listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    listener.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, RECEIVE_BUFFER_SIZE)
+    listener.bind(('', port))
+    listener.listen(1)
+    print('Waiting for a connection on port {}'.format(port))
+    connection, _ = listener.accept()
+    listener.close()
+    return connection
+
+
+if __name__ == '__main__':
+    args = CreateArgParser().parse_args()
+
+    try:
+        if args.listen is not None:
+            connection = Accept(args.listen)
+        else:
+            print('Connecting to {}'.format(args.connect))
+            connection = Connect(args.connect)
+    except (OSError, KeyboardInterrupt) as e:
+        print('Error: Failed to connect: {}'.format(e))
+        sys.exit(1)
+
+    connection.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, RECEIVE_BUFFER_SIZE)
+    print('Receiving capture data to {}'.format(args.file))
+
+    total = 0
+    start = time.time()
+    with open(args.file, 'wb', buffering=CHUNK_SIZE) as output:
+        buffer = bytearray(CHUNK_SIZE)
+        view = memoryview(buffer)
+        try:
+            while True:
+                received = connection.recv_into(buffer)
+                if received == 0:
+                    break
+                output.write(view[:received])
+                total += received
+        except KeyboardInterrupt:
+            print('Interrupted; the capture file is incomplete')
+        except OSError as e:
+            print('Error: Connection failed: {}; the capture file is incomplete'.format(e))
+
+    connection.close()
+
+    elapsed = max(time.time() - start, 0.001)
+    print('Received {} bytes in {:.1f} s ({:.1f} MiB/s)'.format(total, elapsed, total / elapsed / (1024 * 1024)))
@@ -25,13 +25,16 @@
 
 #include "application/android_application.h"
 #include "application/android_window.h"
+#include "decode/api_call_profiler.h"
 #include "decode/file_processor.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_decoder.h"
+#include "generated/generated_vulkan_referenced_resource_consumer.h"
 #include "generated/generated_vulkan_replay_consumer.h"
 #include "util/argument_parser.h"
+#include "util/instrumentation.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
@@ -60,6 +63,8 @@ void android_main(struct android_app* app)
 {
     gfxrecon::util::Log::Init();
 
+    GFXRECON_INSTRUMENT_INITIALIZE();
+
     // Keep screen on while window is active.
     ANativeActivity_setWindowFlags(app->activity, AWINDOW_FLAG_KEEP_SCREEN_ON, 0);
 
@@ -85,6 +90,8 @@ void android_main(struct android_app* app)
     {
         std::string filename = kDefaultCaptureFile;
 
+        ConfigureThreadPlacement(arg_parser);
+
         if (arg_parser.GetPositionalArgumentsCount() == 1)
         {
             const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
@@ -97,6 +104,26 @@ void android_main(struct android_app* app)
             std::unique_ptr<gfxrecon::application::AndroidApplication> application;
             std::unique_ptr<gfxrecon::decode::WindowFactory>           window_factory;
 
+            uint32_t replay_threads = GetReplayThreads(arg_parser);
+
+            file_processor.SetUseMappedFile(arg_parser.IsOptionSet(kMappedFileOption));
+            file_processor.SetUsePrefetchThread(arg_parser.IsOptionSet(kPrefetchOption));
+            file_processor.SetDecompressionThreads(GetDecompressionThreads(arg_parser));
+            file_processor.SetHugePageMode(GetHugePageMode(arg_parser));
+
+            uint32_t preload_first_frame = 0;
+            uint32_t preload_last_frame  = 0;
+            size_t   max_preload_size    = 0;
+
+            if (GetPreloadFrames(arg_parser, &preload_first_frame, &preload_last_frame, &max_preload_size))
+            {
+                file_processor.SetPreloadFrames(preload_first_frame, preload_last_frame, max_preload_size);
+            }
+
+            file_processor.SetUseDecodeThread(arg_parser.IsOptionSet(kDecodeThreadOption) || (replay_threads > 0));
+            file_processor.SetCommandBufferThreads(replay_threads);
+            file_processor.SetDeferResourceInitData(arg_parser.IsOptionSet(kLazyResourceInitOption));
+
             if (!file_processor.Initialize(filename))
             {
                 GFXRECON_WRITE_CONSOLE("Failed to load file %s.", filename.c_str());
@@ -115,17 +142,67 @@ void android_main(struct android_app* app)
                 }
                 else
                 {
+                    gfxrecon::decode::ApiCallProfiler              call_profiler;
                     gfxrecon::decode::VulkanTrackedObjectInfoTable tracked_object_info_table;
-                    gfxrecon::decode::VulkanReplayConsumer         replay_consumer(
-                        window_factory.get(), GetReplayOptions(arg_parser, filename, &tracked_object_info_table));
-                    gfxrecon::decode::VulkanDecoder decoder;
+
+                    auto replay_options = GetReplayOptions(arg_parser, filename, &tracked_object_info_table);
+
+                    file_processor.SetMemoryUsageReport(replay_options.memory_report.get());
+
+                    gfxrecon::decode::VulkanReplayConsumer replay_consumer(window_factory.get(), replay_options);
+                    gfxrecon::decode::VulkanDecoder        decoder;
+
+                    // Reports the resources that are first used by each submission, for --lazy-resource-init.
+                    gfxrecon::decode::VulkanReferencedResourceConsumer first_use_tracker;
 
                     replay_consumer.SetFatalErrorHandler(
                         [](const char* message) { throw std::runtime_error(message); });
 
+                    if (!replay_options.lazy_resource_init_file.empty())
+                    {
+                        // The tracker precedes the replay consumer, so that the resources that a submission uses for
+                        // the first time are initialized before the submission is replayed.
+                        first_use_tracker.SetFirstUseCallback(
+                            [&replay_consumer](const std::vector<gfxrecon::format::HandleId>& ids) {
+                                replay_consumer.LoadDeferredInitData(ids);
+                            });
+
+                        decoder.AddConsumer(&first_use_tracker);
+                    }
+
                     decoder.AddConsumer(&replay_consumer);
                     file_processor.AddDecoder(&decoder);
                     application->SetPauseFrame(GetPauseFrame(arg_parser));
+                    decoder.SetFastForwardFrame(GetFastForwardFrame(arg_parser));
+                    decoder.SetReuseCommandBuffers(arg_parser.IsOptionSet(kReuseCommandBuffersOption));
+                    decoder.SetForwardBlockIndices(replay_options.debug_label_blocks);
+                    decoder.SetForwardCallIds(replay_options.batch_submits);
+
+                    if (arg_parser.IsOptionSet(kProfileCallsOption))
+                    {
+                        decoder.SetProfiler(&call_profiler);
+                    }
+
+                    uint32_t loop_first_frame = 0;
+                    uint32_t loop_last_frame  = 0;
+                    uint32_t loop_count       = 0;
+
+                    if (GetFrameLoop(arg_parser, &loop_first_frame, &loop_last_frame, &loop_count))
+                    {
+                        gfxrecon::application::Application::FrameLoopCallbacks loop_callbacks;
+                        loop_callbacks.save_state = [&replay_consumer]() {
+                            return replay_consumer.SaveFrameLoopState();
+                        };
+                        loop_callbacks.restore_state = [&replay_consumer]() {
+                            return replay_consumer.RestoreFrameLoopState();
+                        };
+                        loop_callbacks.wait_idle = [&replay_consumer]() {
+                            replay_consumer.WaitForDevicesIdle();
+                        };
+
+                        application->SetFrameLoop(loop_first_frame, loop_last_frame, loop_count, loop_callbacks);
+                        application->SetFrameLoopProgram(arg_parser.IsOptionSet(kLoopProgramOption));
+                    }
 
                     // Warn if the capture layer is active.
                     CheckActiveLayers(kLayerProperty);
@@ -136,6 +213,14 @@ void android_main(struct android_app* app)
 
                     app->userData = application.get();
                     application->Run();
+
+                    // The decoder is destroyed before the file processor.
+                    file_processor.StopDecodeThread();
+
+                    if (arg_parser.IsOptionSet(kProfileCallsOption))
+                    {
+                        call_profiler.WriteReport();
+                    }
                 }
             }
         }
@@ -24,15 +24,21 @@
 #include "replay_settings.h"
 
 #include "application/application.h"
+#include "decode/api_call_profiler.h"
 #include "decode/file_processor.h"
 #include "decode/vulkan_replay_options.h"
+#include "decode/vulkan_retained_objects.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
+#include "generated/generated_vulkan_referenced_resource_consumer.h"
 #include "generated/generated_vulkan_replay_consumer.h"
 #include "graphics/fps_info.h"
+#include "graphics/startup_timing_report.h"
 #include "util/argument_parser.h"
+#include "util/instrumentation.h"
 #include "util/logging.h"
 
+#include <cstdlib>
 #include <exception>
 #include <memory>
 #include <stdexcept>
@@ -89,6 +95,196 @@ void WaitForExit() {}
 
 const char kLayerEnvVar[] = "VK_INSTANCE_LAYERS";
 
+// Replays a capture file with the platform specific application, returning the process exit code for the replay.
+static int ReplayCaptureFile(const gfxrecon::util::ArgumentParser&                          arg_parser,
+                             const std::string&                                             filename,
+                             gfxrecon::application::Application*                            application,
+                             gfxrecon::decode::WindowFactory*                               window_factory,
+                             const std::shared_ptr<gfxrecon::decode::VulkanRetainedObjects>& retained_objects)
+{
+    std::shared_ptr<gfxrecon::graphics::StartupTimingReport> startup_report;
+
+    const auto& startup_report_file = arg_parser.GetArgumentValue(kStartupReportArgument);
+
+    if (!startup_report_file.empty())
+    {
+        startup_report = std::make_shared<gfxrecon::graphics::StartupTimingReport>(startup_report_file);
+    }
+
+    gfxrecon::decode::FileProcessor file_processor;
+
+    uint32_t replay_threads = GetReplayThreads(arg_parser);
+
+    file_processor.SetUseMappedFile(arg_parser.IsOptionSet(kMappedFileOption));
+    file_processor.SetUsePrefetchThread(arg_parser.IsOptionSet(kPrefetchOption));
+    file_processor.SetDecompressionThreads(GetDecompressionThreads(arg_parser));
+    file_processor.SetHugePageMode(GetHugePageMode(arg_parser));
+
+    uint32_t preload_first_frame = 0;
+    uint32_t preload_last_frame  = 0;
+    size_t   max_preload_size    = 0;
+
+    if (GetPreloadFrames(arg_parser, &preload_first_frame, &preload_last_frame, &max_preload_size))
+    {
+        file_processor.SetPreloadFrames(preload_first_frame, preload_last_frame, max_preload_size);
+    }
+
+    file_processor.SetUseDecodeThread(arg_parser.IsOptionSet(kDecodeThreadOption) || (replay_threads > 0));
+    file_processor.SetCommandBufferThreads(replay_threads);
+    file_processor.SetDeferResourceInitData(arg_parser.IsOptionSet(kLazyResourceInitOption));
+
+    {
+        gfxrecon::graphics::StartupTimingReport::ScopedPhase phase(
+            startup_report.get(), gfxrecon::graphics::StartupTimingReport::kFileProcessorInitialize);
+
+        if (!file_processor.Initialize(filename))
+        {
+            return -1;
+        }
+    }
+
+    int                                            return_code = 0;
+    gfxrecon::graphics::FpsInfo                    fps_info;
+    gfxrecon::decode::ApiCallProfiler              call_profiler;
+    gfxrecon::decode::VulkanTrackedObjectInfoTable tracked_object_info_table;
+
+    auto replay_options = GetReplayOptions(arg_parser, filename, &tracked_object_info_table, startup_report);
+
+    replay_options.retained_objects = retained_objects;
+
+    file_processor.SetMemoryUsageReport(replay_options.memory_report.get());
+
+    // The objects of each capture file in a playlist are destroyed, so that they can be retained for reuse.
+    if (retained_objects != nullptr)
+    {
+        replay_options.fast_exit = false;
+    }
+
+    // Each device of the --gpus list is replayed by its own consumer, which receives every call decoded from the file.
+    std::vector<std::unique_ptr<gfxrecon::decode::VulkanReplayConsumer>> replay_consumers;
+    std::vector<int32_t>                                                 replay_gpus;
+    gfxrecon::decode::VulkanDecoder                                      decoder;
+    gfxrecon::decode::VulkanReferencedResourceConsumer                   first_use_tracker;
+
+    if (GetReplayGpus(arg_parser, &replay_gpus))
+    {
+        for (int32_t gpu_index : replay_gpus)
+        {
+            replay_consumers.push_back(std::make_unique<gfxrecon::decode::VulkanReplayConsumer>(
+                window_factory, GetDeviceReplayOptions(replay_options, gpu_index)));
+        }
+    }
+    else
+    {
+        replay_consumers.push_back(
+            std::make_unique<gfxrecon::decode::VulkanReplayConsumer>(window_factory, replay_options));
+    }
+
+    if (!replay_options.lazy_resource_init_file.empty())
+    {
+        // The tracker precedes the replay consumers, so that the resources that a submission uses for the first time
+        // are initialized before the submission is replayed.
+        first_use_tracker.SetFirstUseCallback([&replay_consumers](const std::vector<gfxrecon::format::HandleId>& ids) {
+            for (const auto& replay_consumer : replay_consumers)
+            {
+                replay_consumer->LoadDeferredInitData(ids);
+            }
+        });
+
+        decoder.AddConsumer(&first_use_tracker);
+    }
+
+    for (const auto& replay_consumer : replay_consumers)
+    {
+        replay_consumer->SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
+        decoder.AddConsumer(replay_consumer.get());
+    }
+
+    // Each call is replayed by the consumers in turn, so the devices advance through the frames together and the frame
+    // rate is only reported once.
+    replay_consumers.front()->SetFpsInfo(&fps_info);
+
+    file_processor.AddDecoder(&decoder);
+    application->SetFileProcessor(&file_processor);
+    application->SetPauseFrame(GetPauseFrame(arg_parser));
+    decoder.SetFastForwardFrame(GetFastForwardFrame(arg_parser));
+    decoder.SetReuseCommandBuffers(arg_parser.IsOptionSet(kReuseCommandBuffersOption));
+    decoder.SetForwardBlockIndices(replay_options.debug_label_blocks);
+    decoder.SetForwardCallIds(replay_options.batch_submits);
+
+    if (arg_parser.IsOptionSet(kProfileCallsOption))
+    {
+        decoder.SetProfiler(&call_profiler);
+    }
+
+    uint32_t loop_first_frame = 0;
+    uint32_t loop_last_frame  = 0;
+    uint32_t loop_count       = 0;
+
+    if (GetFrameLoop(arg_parser, &loop_first_frame, &loop_last_frame, &loop_count))
+    {
+        gfxrecon::application::Application::FrameLoopCallbacks loop_callbacks;
+        loop_callbacks.save_state = [&replay_consumers]() {
+            bool success = true;
+            for (const auto& replay_consumer : replay_consumers)
+            {
+                success = replay_consumer->SaveFrameLoopState() && success;
+            }
+            return success;
+        };
+        loop_callbacks.restore_state = [&replay_consumers]() {
+            bool success = true;
+            for (const auto& replay_consumer : replay_consumers)
+            {
+                success = replay_consumer->RestoreFrameLoopState() && success;
+            }
+            return success;
+        };
+        loop_callbacks.wait_idle = [&replay_consumers]() {
+            for (const auto& replay_consumer : replay_consumers)
+            {
+                replay_consumer->WaitForDevicesIdle();
+            }
+        };
+
+        application->SetFrameLoop(loop_first_frame, loop_last_frame, loop_count, loop_callbacks);
+        application->SetFrameLoopProgram(arg_parser.IsOptionSet(kLoopProgramOption));
+    }
+
+    // Warn if the capture layer is active.
+    CheckActiveLayers(gfxrecon::util::platform::GetEnv(kLayerEnvVar));
+
+    fps_info.Begin();
+
+    application->Run();
+
+    // The decoder is destroyed before the file processor.
+    file_processor.StopDecodeThread();
+    application->SetFileProcessor(nullptr);
+
+    if (arg_parser.IsOptionSet(kProfileCallsOption))
+    {
+        call_profiler.WriteReport();
+    }
+
+    if ((file_processor.GetCurrentFrameNumber() > 0) &&
+        (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
+    {
+        fps_info.EndAndLog(file_processor.GetCurrentFrameNumber());
+    }
+    else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred during replay");
+        return_code = -1;
+    }
+    else
+    {
+        GFXRECON_WRITE_CONSOLE("File did not contain any frames");
+    }
+
+    return return_code;
+}
+
 int main(int argc, const char** argv)
 {
     int return_code = 0;
@@ -120,30 +316,39 @@ int main(int argc, const char** argv)
     gfxrecon::util::Log::Release();
     gfxrecon::util::Log::Init(log_settings);
 
+    GFXRECON_INSTRUMENT_INITIALIZE();
+
+    ConfigureThreadPlacement(arg_parser);
+
     try
     {
         const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
-        std::string                     filename             = positional_arguments[0];
+        std::vector<std::string>        filenames;
 
-        gfxrecon::decode::FileProcessor                     file_processor;
         std::unique_ptr<gfxrecon::application::Application> application;
         std::unique_ptr<gfxrecon::decode::WindowFactory>    window_factory;
 
-        if (!file_processor.Initialize(filename))
+        if (!arg_parser.IsOptionSet(kPlaylistOption))
+        {
+            filenames.push_back(positional_arguments[0]);
+        }
+        else if (!GetPlaylistFiles(positional_arguments[0], &filenames))
         {
             return_code = -1;
         }
-        else
+
+        if (!filenames.empty())
         {
             auto wsi_platform = GetWsiPlatform(arg_parser);
 
-            // Setup platform specific application and window factory.
+            // Setup platform specific application and window factory.  The application replays frames from the file
+            // processor of each capture file.
 #if defined(WIN32)
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
             if (wsi_platform == WsiPlatform::kWin32 || (wsi_platform == WsiPlatform::kAuto && !application))
             {
                 auto win32_application = std::make_unique<gfxrecon::application::Win32Application>(kApplicationName);
-                if (win32_application->Initialize(&file_processor))
+                if (win32_application->Initialize(nullptr))
                 {
                     window_factory =
                         std::make_unique<gfxrecon::application::Win32WindowFactory>(win32_application.get());
@@ -157,7 +362,7 @@ int main(int argc, const char** argv)
             {
                 auto wayland_application =
                     std::make_unique<gfxrecon::application::WaylandApplication>(kApplicationName);
-                if (wayland_application->Initialize(&file_processor))
+                if (wayland_application->Initialize(nullptr))
                 {
                     window_factory =
                         std::make_unique<gfxrecon::application::WaylandWindowFactory>(wayland_application.get());
@@ -169,7 +374,7 @@ int main(int argc, const char** argv)
             if (wsi_platform == WsiPlatform::kXcb || (wsi_platform == WsiPlatform::kAuto && !application))
             {
                 auto xcb_application = std::make_unique<gfxrecon::application::XcbApplication>(kApplicationName);
-                if (xcb_application->Initialize(&file_processor))
+                if (xcb_application->Initialize(nullptr))
                 {
                     window_factory = std::make_unique<gfxrecon::application::XcbWindowFactory>(xcb_application.get());
                     application    = std::move(xcb_application);
@@ -180,7 +385,7 @@ int main(int argc, const char** argv)
             if (wsi_platform == WsiPlatform::kXlib || (wsi_platform == WsiPlatform::kAuto && !application))
             {
                 auto xlib_application = std::make_unique<gfxrecon::application::XlibApplication>(kApplicationName);
-                if (xlib_application->Initialize(&file_processor))
+                if (xlib_application->Initialize(nullptr))
                 {
                     window_factory = std::make_unique<gfxrecon::application::XlibWindowFactory>(xlib_application.get());
                     application    = std::move(xlib_application);
@@ -193,7 +398,7 @@ int main(int argc, const char** argv)
             {
                 auto headless_application =
                     std::make_unique<gfxrecon::application::HeadlessApplication>(kApplicationName);
-                if (headless_application->Initialize(&file_processor))
+                if (headless_application->Initialize(nullptr))
                 {
                     window_factory =
                         std::make_unique<gfxrecon::application::HeadlessWindowFactory>(headless_application.get());
@@ -209,41 +414,46 @@ int main(int argc, const char** argv)
                     "Vulkan platform extensions have been enabled.");
                 return_code = -1;
             }
-            else
+            else if (filenames.size() == 1)
             {
-                gfxrecon::graphics::FpsInfo                    fps_info;
-                gfxrecon::decode::VulkanTrackedObjectInfoTable tracked_object_info_table;
-                gfxrecon::decode::VulkanReplayConsumer         replay_consumer(
-                    window_factory.get(), GetReplayOptions(arg_parser, filename, &tracked_object_info_table));
-                gfxrecon::decode::VulkanDecoder decoder;
+                return_code =
+                    ReplayCaptureFile(arg_parser, filenames[0], application.get(), window_factory.get(), nullptr);
 
-                replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
-                replay_consumer.SetFpsInfo(&fps_info);
-
-                decoder.AddConsumer(&replay_consumer);
-                file_processor.AddDecoder(&decoder);
-                application->SetPauseFrame(GetPauseFrame(arg_parser));
-
-                // Warn if the capture layer is active.
-                CheckActiveLayers(gfxrecon::util::platform::GetEnv(kLayerEnvVar));
-
-                fps_info.Begin();
-
-                application->Run();
-
-                if ((file_processor.GetCurrentFrameNumber() > 0) &&
-                    (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
-                {
-                    fps_info.EndAndLog(file_processor.GetCurrentFrameNumber());
-                }
-                else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+                if (arg_parser.IsOptionSet(kFastExitOption))
                 {
-                    GFXRECON_WRITE_CONSOLE("A failure has occurred during replay");
-                    return_code = -1;
+                    // Exit without destroying the application and its windows, which are still in use by the
+                    // swapchains that replay left alive.
+                    WaitForExit();
+                    gfxrecon::util::Log::Release();
+                    std::exit(return_code);
                 }
-                else
+            }
+            else
+            {
+                // The instances and devices that are destroyed by each capture file are retained for reuse by the
+                // following capture files, and are destroyed after the last capture file has been replayed.
+                auto retained_objects = std::make_shared<gfxrecon::decode::VulkanRetainedObjects>();
+
+                for (const auto& filename : filenames)
                 {
-                    GFXRECON_WRITE_CONSOLE("File did not contain any frames");
+                    GFXRECON_WRITE_CONSOLE("Replaying %s", filename.c_str());
+
+                    try
+                    {
+                        if (ReplayCaptureFile(
+                                arg_parser, filename, application.get(), window_factory.get(), retained_objects) != 0)
+                        {
+                            return_code = -1;
+                        }
+                    }
+                    catch (std::runtime_error error)
+                    {
+                        // Fatal errors stop the replay of the current capture file, and replay continues with the next.
+                        GFXRECON_WRITE_CONSOLE("Replay of %s has encountered a fatal error: %s",
+                                               filename.c_str(),
+                                               error.what());
+                        return_code = -1;
+                    }
                 }
             }
         }
@@ -22,8 +22,10 @@
 
 #include "project_version.h"
 
+#include "decode/analysis_cache.h"
 #include "decode/file_processor.h"
 #include "decode/vulkan_default_allocator.h"
+#include "decode/vulkan_pipeline_prescan_consumer.h"
 #include "decode/vulkan_realign_allocator.h"
 #include "decode/vulkan_rebind_allocator.h"
 #include "decode/vulkan_remap_allocator.h"
@@ -32,12 +34,20 @@
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "util/argument_parser.h"
+#include "util/file_path.h"
+#include "util/huge_page_buffer.h"
+#include "util/image_writer.h"
 #include "util/logging.h"
 #include "util/platform.h"
+#include "util/socket_input_stream.h"
+#include "util/thread_placement.h"
 
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
+#include <cctype>
 #include <cstdlib>
+#include <fstream>
 #include <limits>
 #include <sstream>
 #include <string>
@@ -55,8 +65,10 @@ const char kVersionOption[]                    = "--version";
 const char kLogLevelArgument[]                 = "--log-level";
 const char kLogFileArgument[]                  = "--log-file";
 const char kLogDebugView[]                     = "--log-debugview";
+const char kLogAsyncOption[]                   = "--log-async";
 const char kNoDebugPopup[]                     = "--no-debug-popup";
 const char kOverrideGpuArgument[]              = "--gpu";
+const char kReplayGpusArgument[]               = "--gpus";
 const char kPausedOption[]                     = "--paused";
 const char kPauseFrameArgument[]               = "--pause-frame";
 const char kSkipFailedAllocationShortOption[]  = "--sfa";
@@ -65,21 +77,84 @@ const char kOmitPipelineCacheDataShortOption[] = "--opcd";
 const char kOmitPipelineCacheDataLongOption[]  = "--omit-pipeline-cache-data";
 const char kWsiArgument[]                      = "--wsi";
 const char kSurfaceIndexArgument[]             = "--surface-index";
+const char kVirtualSwapchainOption[]           = "--virtual-swapchain";
+const char kPresentModeArgument[]              = "--present-mode";
 const char kMemoryPortabilityShortOption[]     = "-m";
 const char kMemoryPortabilityLongOption[]      = "--memory-translation";
+const char kRebindPoolAlgorithmArgument[]      = "--rebind-pool-algorithm";
+const char kRebindBlockSizeArgument[]          = "--rebind-block-size";
+const char kDeviceMemoryBudgetArgument[]       = "--device-memory-budget";
 const char kSyncOption[]                       = "--sync";
+const char kMaxSubmitsInFlightArgument[]       = "--max-submits-in-flight";
+const char kMaxFramesInFlightArgument[]        = "--max-frames-in-flight";
+const char kCollapsePollingOption[]            = "--collapse-polling";
+const char kBatchSubmitsOption[]               = "--batch-submits";
+const char kRecyclePoolsOption[]               = "--recycle-pools";
+const char kPaceCpuTimestampsOption[]          = "--pace-cpu-timestamps";
+const char kSkipRedundantDescriptorsOption[]   = "--skip-redundant-descriptor-updates";
+const char kMappedFileOption[]                 = "--mmap";
+const char kPersistentMappingOption[]          = "--persistent-mapping";
+const char kPrefetchOption[]                   = "--prefetch";
+const char kPreloadOption[]                    = "--preload";
+const char kPreloadFramesArgument[]            = "--preload-frames";
+const char kPreloadLimitArgument[]             = "--preload-limit";
+const char kDecompressionThreadsArgument[]     = "--decompression-threads";
+const char kDecodeThreadOption[]               = "--decode-thread";
+const char kReplayThreadsArgument[]            = "--replay-threads";
+const char kPipelineThreadsArgument[]          = "--pipeline-threads";
+const char kPipelineCacheDirArgument[]         = "--pipeline-cache";
+const char kPipelineWarmUpArgument[]           = "--pipeline-warm-up";
 const char kRemoveUnsupportedOption[]          = "--remove-unsupported";
+const char kRemapDeviceAddressesOption[]       = "--remap-device-addresses";
 const char kShaderReplaceArgument[]            = "--replace-shaders";
 const char kScreenshotAllOption[]              = "--screenshot-all";
 const char kScreenshotRangeArgument[]          = "--screenshots";
 const char kScreenshotFormatArgument[]         = "--screenshot-format";
 const char kScreenshotDirArgument[]            = "--screenshot-dir";
 const char kScreenshotFilePrefixArgument[]     = "--screenshot-prefix";
-
-const char kOptions[] = "-h|--help,--version,--log-debugview,--no-debug-popup,--paused,--sync,--sfa|--skip-failed-"
-                        "allocations,--opcd|--omit-pipeline-cache-data,--remove-unsupported,--screenshot-all";
-const char kArguments[] = "--log-level,--log-file,--gpu,--pause-frame,--wsi,--surface-index,-m|--memory-translation,--"
-                          "replace-shaders,--screenshots,--screenshot-format,--screenshot-dir,--screenshot-prefix";
+const char kScreenshotDownscaleArgument[]      = "--screenshot-downscale";
+const char kScreenshotHashOnlyOption[]         = "--screenshot-hash-only";
+const char kFastForwardArgument[]              = "--fast-forward";
+const char kReuseCommandBuffersOption[]        = "--reuse-command-buffers";
+const char kLoopFramesArgument[]               = "--loop-frames";
+const char kLoopCountArgument[]                = "--loop-count";
+const char kLoopProgramOption[]                = "--loop-program";
+const char kTimingReportArgument[]             = "--timing-report";
+const char kTimingReportFramesArgument[]       = "--timing-report-frames";
+const char kPassTimingReportArgument[]         = "--pass-timing-report";
+const char kPassTimingFramesArgument[]         = "--pass-timing-frames";
+const char kStartupReportArgument[]            = "--startup-report";
+const char kMemoryReportArgument[]             = "--memory-report";
+const char kMemoryReportIntervalArgument[]     = "--memory-report-interval";
+const char kProfileCallsOption[]               = "--profile-calls";
+const char kNoAnalysisCacheOption[]            = "--no-analysis-cache";
+const char kAccelStructCacheOption[]           = "--accel-struct-cache";
+const char kLazyResourceInitOption[]           = "--lazy-resource-init";
+const char kPlaylistOption[]                   = "--playlist";
+const char kFastExitOption[]                   = "--fast-exit";
+const char kDebugLabelsOption[]                = "--debug-labels";
+const char kDebugLabelBlocksOption[]           = "--debug-label-blocks";
+const char kThreadAffinityArgument[]           = "--thread-affinity";
+const char kThreadPriorityArgument[]           = "--thread-priority";
+const char kHugePagesArgument[]                = "--huge-pages";
+
+const char kOptions[] = "-h|--help,--version,--log-debugview,--log-async,--no-debug-popup,--paused,--sync,--sfa|--"
+                        "skip-failed-allocations,--opcd|--omit-pipeline-cache-data,--remove-unsupported,--screenshot-"
+                        "all,--mmap,--prefetch,--decode-thread,--collapse-polling,--persistent-mapping,--profile-calls,"
+                        "--virtual-swapchain,--screenshot-hash-only,--skip-redundant-descriptor-updates,--reuse-"
+                        "command-buffers,--preload,--remap-device-addresses,--no-analysis-cache,--accel-struct-cache,--"
+                        "lazy-resource-init,--playlist,--fast-exit,--debug-labels,--debug-label-blocks,--pace-cpu-"
+                        "timestamps,--batch-submits,--recycle-pools,--loop-program";
+const char kArguments[] = "--log-level,--log-file,--gpu,--gpus,--pause-frame,--wsi,--surface-index,-m|--memory-"
+                          "translation,--replace-shaders,--screenshots,--screenshot-format,--screenshot-dir,--"
+                          "screenshot-prefix,--"
+                          "decompression-threads,--replay-threads,--pipeline-threads,--pipeline-cache,--"
+                          "pipeline-warm-up,--rebind-pool-algorithm,--rebind-block-size,--"
+                          "device-memory-budget,--loop-frames,--loop-count,--timing-report,--timing-report-frames,--"
+                          "screenshot-downscale,--fast-forward,--max-submits-in-flight,--max-frames-in-"
+                          "flight,--preload-frames,--preload-limit,--startup-report,--thread-affinity,--"
+                          "thread-priority,--huge-pages,--pass-timing-report,--pass-timing-frames,--memory-report,--"
+                          "memory-report-interval,--present-mode";
 
 enum class WsiPlatform
 {
@@ -103,7 +178,19 @@ const char kMemoryTranslationRemap[]   = "remap";
 const char kMemoryTranslationRealign[] = "realign";
 const char kMemoryTranslationRebind[]  = "rebind";
 
+const char kPoolAlgorithmDefault[] = "default";
+const char kPoolAlgorithmLinear[]  = "linear";
+const char kPoolAlgorithmBuddy[]   = "buddy";
+
 const char kScreenshotFormatBmp[] = "bmp";
+const char kScreenshotFormatPng[] = "png";
+const char kScreenshotFormatQoi[] = "qoi";
+
+const char kPresentModeImmediate[] = "immediate";
+const char kPresentModeMailbox[]   = "mailbox";
+
+const uint32_t kDefaultLoopCount        = 10;
+const uint32_t kDefaultPreloadLimitMiB = 2048;
 
 #if defined(__ANDROID__)
 const char kDefaultScreenshotDir[] = "/sdcard";
@@ -168,42 +255,93 @@ static gfxrecon::decode::VulkanResourceAllocator* CreateRemapAllocator()
         "Try replay with the '-m rebind' option to enable advanced memory translation.");
 }
 
-static gfxrecon::decode::VulkanResourceAllocator* CreateRebindAllocator()
+static gfxrecon::decode::VulkanResourceAllocator*
+CreateRebindAllocator(const gfxrecon::decode::VulkanRebindAllocator::PoolSettings& pool_settings,
+                      VkDeviceSize                                                 device_memory_budget)
 {
-    return new gfxrecon::decode::VulkanRebindAllocator();
+    auto allocator = new gfxrecon::decode::VulkanRebindAllocator(pool_settings);
+    allocator->SetDeviceMemoryBudget(device_memory_budget);
+    return allocator;
+}
+
+// Loads the resource tracking results of a previous run, which are only valid for the same replay physical devices.
+static bool ReadCachedRealignLayout(const gfxrecon::decode::AnalysisCache&          cache,
+                                    uint64_t                                        device_signature,
+                                    gfxrecon::decode::VulkanTrackedObjectInfoTable* tracked_object_info_table)
+{
+    auto section = cache.GetSection(gfxrecon::decode::AnalysisCache::kRealignMemoryLayoutSection);
+    if (section != nullptr)
+    {
+        gfxrecon::decode::AnalysisCache::Reader reader(*section);
+        uint64_t                                cached_signature = 0;
+
+        return reader.Read(&cached_signature) && (cached_signature == device_signature) &&
+               tracked_object_info_table->ReadRealignLayout(&reader);
+    }
+
+    return false;
 }
 
 static gfxrecon::decode::CreateResourceAllocator
 InitRealignAllocatorCreateFunc(const std::string&                              filename,
                                const gfxrecon::decode::ReplayOptions&          replay_options,
+                               bool                                            use_analysis_cache,
                                gfxrecon::decode::VulkanTrackedObjectInfoTable* tracked_object_info_table)
 {
-    // Enable first pass of replay to generate resource tracking information.
-    GFXRECON_WRITE_CONSOLE("First pass of replay resource tracking for realign memory portability mode. This may take "
-                           "some time. Please wait...");
-
-    gfxrecon::decode::FileProcessor file_processor_resource_tracking;
-    gfxrecon::decode::VulkanDecoder decoder;
-
     auto resource_tracking_consumer =
         new gfxrecon::decode::VulkanResourceTrackingConsumer(replay_options, tracked_object_info_table);
 
-    if (file_processor_resource_tracking.Initialize(filename))
+    gfxrecon::decode::AnalysisCache cache;
+    uint64_t                        device_signature = 0;
+
+    if (use_analysis_cache && cache.Initialize(filename))
     {
-        decoder.AddConsumer(resource_tracking_consumer);
-        file_processor_resource_tracking.AddDecoder(&decoder);
-        file_processor_resource_tracking.ProcessAllFrames();
-        file_processor_resource_tracking.RemoveDecoder(&decoder);
-        decoder.RemoveConsumer(resource_tracking_consumer);
+        device_signature = resource_tracking_consumer->GetPhysicalDeviceSignature();
     }
 
-    // Sort the bound resources according to the binding offsets.
-    resource_tracking_consumer->SortMemoriesBoundResourcesByOffset();
+    if ((device_signature != 0) && ReadCachedRealignLayout(cache, device_signature, tracked_object_info_table))
+    {
+        GFXRECON_WRITE_CONSOLE("Using the realign memory portability resource tracking results from %s.",
+                               gfxrecon::decode::AnalysisCache::GetCacheFilename(filename).c_str());
+    }
+    else
+    {
+        // Enable first pass of replay to generate resource tracking information.
+        GFXRECON_WRITE_CONSOLE("First pass of replay resource tracking for realign memory portability mode. This may "
+                               "take some time. Please wait...");
+
+        gfxrecon::decode::FileProcessor file_processor_resource_tracking;
+        gfxrecon::decode::VulkanDecoder decoder;
+
+        if (file_processor_resource_tracking.Initialize(filename))
+        {
+            decoder.AddConsumer(resource_tracking_consumer);
+            file_processor_resource_tracking.AddDecoder(&decoder);
+            file_processor_resource_tracking.ProcessAllFrames();
+            file_processor_resource_tracking.RemoveDecoder(&decoder);
+            decoder.RemoveConsumer(resource_tracking_consumer);
+        }
+
+        // Sort the bound resources according to the binding offsets.
+        resource_tracking_consumer->SortMemoriesBoundResourcesByOffset();
 
-    // calculate the replay binding offset of the bound resources and replay memory allocation size
-    resource_tracking_consumer->CalculateReplayBindingOffsetAndMemoryAllocationSize();
+        // calculate the replay binding offset of the bound resources and replay memory allocation size
+        resource_tracking_consumer->CalculateReplayBindingOffsetAndMemoryAllocationSize();
 
-    GFXRECON_WRITE_CONSOLE("First pass of replay resource tracking done.");
+        GFXRECON_WRITE_CONSOLE("First pass of replay resource tracking done.");
+
+        if ((device_signature != 0) &&
+            (file_processor_resource_tracking.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
+        {
+            gfxrecon::decode::AnalysisCache::Writer writer;
+            writer.Write(device_signature);
+            tracked_object_info_table->WriteRealignLayout(&writer);
+
+            cache.SetSection(gfxrecon::decode::AnalysisCache::kRealignMemoryLayoutSection,
+                             std::move(writer.GetData()));
+            cache.Write();
+        }
+    }
 
     return [tracked_object_info_table]() -> gfxrecon::decode::VulkanResourceAllocator* {
         return new gfxrecon::decode::VulkanRealignAllocator(
@@ -228,6 +366,395 @@ static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
     return pause_frame;
 }
 
+static uint32_t GetFastForwardFrame(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    fast_forward_frame = 0;
+    const auto& value              = arg_parser.GetArgumentValue(kFastForwardArgument);
+
+    if (!value.empty())
+    {
+        int frame_number = std::stoi(value);
+
+        if (frame_number > 0)
+        {
+            fast_forward_frame = static_cast<uint32_t>(frame_number);
+
+            if (fast_forward_frame > 1)
+            {
+                GFXRECON_LOG_WARNING("Fast forwarding to frame %u drops the draw, dispatch, and trace rays commands of "
+                                     "the preceding frames; render targets and storage buffers that they write are "
+                                     "left unwritten",
+                                     fast_forward_frame);
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid fast forward frame \"%s\"", value.c_str());
+        }
+    }
+
+    return fast_forward_frame;
+}
+
+// Returns true if preloading was requested, with the frame range to preload and the preload size limit in bytes.  A
+// last frame of 0 preloads to the end of the file.
+static bool GetPreloadFrames(const gfxrecon::util::ArgumentParser& arg_parser,
+                             uint32_t*                             first_frame,
+                             uint32_t*                             last_frame,
+                             size_t*                               max_size)
+{
+    const auto& frames = arg_parser.GetArgumentValue(kPreloadFramesArgument);
+
+    (*first_frame) = 0;
+    (*last_frame)  = 0;
+    (*max_size)    = static_cast<size_t>(kDefaultPreloadLimitMiB) * 1024 * 1024;
+
+    if (!frames.empty())
+    {
+        size_t      separator = frames.find('-');
+        std::string first     = frames.substr(0, separator);
+        std::string last      = (separator != std::string::npos) ? frames.substr(separator + 1) : first;
+
+        if (first.empty() || last.empty() || (first.find_first_not_of("0123456789") != std::string::npos) ||
+            (last.find_first_not_of("0123456789") != std::string::npos) || (std::stoi(first) <= 0) ||
+            (std::stoi(first) > std::stoi(last)))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid preload frame range \"%s\"", frames.c_str());
+        }
+        else
+        {
+            (*first_frame) = std::stoi(first);
+            (*last_frame)  = std::stoi(last);
+        }
+    }
+    else if (arg_parser.IsOptionSet(kPreloadOption))
+    {
+        (*first_frame) = 1;
+    }
+
+    const auto& limit = arg_parser.GetArgumentValue(kPreloadLimitArgument);
+
+    if (!limit.empty())
+    {
+        int size = std::stoi(limit);
+
+        // The limit is specified in MiB, and cannot exceed the address space.
+        if ((size <= 0) || (static_cast<uint64_t>(size) > (std::numeric_limits<size_t>::max() >> 20)))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid preload size limit \"%s\"", limit.c_str());
+        }
+        else
+        {
+            (*max_size) = static_cast<size_t>(size) * 1024 * 1024;
+        }
+    }
+
+    return ((*first_frame) > 0);
+}
+
+// Returns true if a valid frame range was specified for looping.
+// Gets the zero-based physical device indices of the --gpus list, for replay on each of the devices from a single pass
+// over the capture file.
+static bool GetReplayGpus(const gfxrecon::util::ArgumentParser& arg_parser, std::vector<int32_t>* gpu_indices)
+{
+    const auto& value = arg_parser.GetArgumentValue(kReplayGpusArgument);
+
+    if (value.empty())
+    {
+        return false;
+    }
+
+    std::vector<int32_t> indices;
+    std::istringstream   stream(value);
+    std::string          index;
+
+    while (std::getline(stream, index, ','))
+    {
+        if (index.empty() || (index.find_first_not_of("0123456789") != std::string::npos))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid GPU list \"%s\"", value.c_str());
+            return false;
+        }
+
+        int32_t gpu_index = std::stoi(index);
+
+        if (std::find(indices.begin(), indices.end(), gpu_index) == indices.end())
+        {
+            indices.push_back(gpu_index);
+        }
+    }
+
+    if (indices.empty())
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid GPU list \"%s\"", value.c_str());
+        return false;
+    }
+
+    if (gfxrecon::util::platform::StringCompareNoCase(
+            kMemoryTranslationRealign, arg_parser.GetArgumentValue(kMemoryPortabilityShortOption).c_str()) == 0)
+    {
+        // The realign allocator uses the memory layout of a resource tracking pass that is specific to one device.
+        GFXRECON_LOG_WARNING("Ignoring %s, which cannot be combined with the %s memory translation mode",
+                             kReplayGpusArgument,
+                             kMemoryTranslationRealign);
+        return false;
+    }
+
+    if (!arg_parser.GetArgumentValue(kOverrideGpuArgument).empty())
+    {
+        GFXRECON_LOG_WARNING("Ignoring %s, which is replaced by %s", kOverrideGpuArgument, kReplayGpusArgument);
+    }
+
+    (*gpu_indices) = std::move(indices);
+
+    return true;
+}
+
+static bool GetFrameLoop(const gfxrecon::util::ArgumentParser& arg_parser,
+                         uint32_t*                             first_frame,
+                         uint32_t*                             last_frame,
+                         uint32_t*                             loop_count)
+{
+    const auto& value = arg_parser.GetArgumentValue(kLoopFramesArgument);
+
+    if (value.empty())
+    {
+        return false;
+    }
+
+    size_t      separator = value.find('-');
+    std::string first     = value.substr(0, separator);
+    std::string last      = (separator != std::string::npos) ? value.substr(separator + 1) : first;
+
+    if (first.empty() || last.empty() || (first.find_first_not_of("0123456789") != std::string::npos) ||
+        (last.find_first_not_of("0123456789") != std::string::npos) || (std::stoi(first) <= 0) ||
+        (std::stoi(first) > std::stoi(last)))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid loop frame range \"%s\"", value.c_str());
+        return false;
+    }
+
+    if (arg_parser.IsOptionSet(kDecodeThreadOption) || !arg_parser.GetArgumentValue(kReplayThreadsArgument).empty())
+    {
+        // The read position cannot be moved back to the start of the range once the decode thread has started.
+        GFXRECON_LOG_WARNING("Ignoring %s, which cannot be combined with %s or %s",
+                             kLoopFramesArgument,
+                             kDecodeThreadOption,
+                             kReplayThreadsArgument);
+        return false;
+    }
+
+    if (gfxrecon::util::platform::StringCompareNoCase(
+            kMemoryTranslationRebind, arg_parser.GetArgumentValue(kMemoryPortabilityShortOption).c_str()) == 0)
+    {
+        // Memory contents are saved through buffers that alias the replay memory allocations, which the rebind
+        // allocator does not create.
+        GFXRECON_LOG_WARNING("Ignoring %s, which cannot be combined with the %s memory translation mode",
+                             kLoopFramesArgument,
+                             kMemoryTranslationRebind);
+        return false;
+    }
+
+    (*first_frame) = std::stoi(first);
+    (*last_frame)  = std::stoi(last);
+    (*loop_count)  = kDefaultLoopCount;
+
+    const auto& count = arg_parser.GetArgumentValue(kLoopCountArgument);
+
+    if (!count.empty())
+    {
+        int value_count = std::stoi(count);
+
+        if (value_count > 0)
+        {
+            (*loop_count) = static_cast<uint32_t>(value_count);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid loop count \"%s\"", count.c_str());
+        }
+    }
+
+    return true;
+}
+
+static void GetTimingReportFrames(const gfxrecon::util::ArgumentParser& arg_parser,
+                                  const char*                           argument,
+                                  uint32_t*                             first_frame,
+                                  uint32_t*                             last_frame)
+{
+    const auto& value = arg_parser.GetArgumentValue(argument);
+
+    if (value.empty())
+    {
+        return;
+    }
+
+    size_t      separator = value.find('-');
+    std::string first     = value.substr(0, separator);
+    std::string last      = (separator != std::string::npos) ? value.substr(separator + 1) : first;
+
+    if (first.empty() || last.empty() || (first.find_first_not_of("0123456789") != std::string::npos) ||
+        (last.find_first_not_of("0123456789") != std::string::npos) || (std::stoi(first) <= 0) ||
+        (std::stoi(first) > std::stoi(last)))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid %s frame range \"%s\"", argument, value.c_str());
+        return;
+    }
+
+    (*first_frame) = std::stoi(first);
+    (*last_frame)  = std::stoi(last);
+}
+
+static uint32_t GetMemoryReportInterval(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    interval = 100;
+    const auto& value    = arg_parser.GetArgumentValue(kMemoryReportIntervalArgument);
+
+    if (!value.empty())
+    {
+        if ((value.find_first_not_of("0123456789") == std::string::npos) && (std::stoi(value) > 0))
+        {
+            interval = static_cast<uint32_t>(std::stoi(value));
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid memory report interval \"%s\"", value.c_str());
+        }
+    }
+
+    return interval;
+}
+
+// Parses a decimal integer that is greater than 0 and fits in 32 bits.  The result is not modified when the value is
+// invalid.
+static bool ParsePositiveInteger(const std::string& value, uint32_t* result)
+{
+    uint32_t parsed = 0;
+
+    if (!gfxrecon::util::ParseUnsignedInteger(value, &parsed) || (parsed == 0))
+    {
+        return false;
+    }
+
+    (*result) = parsed;
+    return true;
+}
+
+static uint32_t GetDecompressionThreads(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    decompression_threads = 0;
+    const auto& value                 = arg_parser.GetArgumentValue(kDecompressionThreadsArgument);
+
+    if (!value.empty())
+    {
+        if (!ParsePositiveInteger(value, &decompression_threads))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid decompression thread count \"%s\"", value.c_str());
+        }
+    }
+
+    return decompression_threads;
+}
+
+static gfxrecon::util::HugePageBuffer::Mode GetHugePageMode(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    gfxrecon::util::HugePageBuffer::Mode mode  = gfxrecon::util::HugePageBuffer::kModeNone;
+    const auto&                          value = arg_parser.GetArgumentValue(kHugePagesArgument);
+
+    if (!value.empty())
+    {
+        if (gfxrecon::util::platform::StringCompareNoCase("transparent", value.c_str()) == 0)
+        {
+            mode = gfxrecon::util::HugePageBuffer::kModeTransparent;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase("explicit", value.c_str()) == 0)
+        {
+            mode = gfxrecon::util::HugePageBuffer::kModeExplicit;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase("none", value.c_str()) != 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring unrecognized --huge-pages value \"%s\"", value.c_str());
+        }
+    }
+
+    return mode;
+}
+
+static uint32_t GetReplayThreads(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    replay_threads = 0;
+    const auto& value          = arg_parser.GetArgumentValue(kReplayThreadsArgument);
+
+    if (!value.empty())
+    {
+        if (!ParsePositiveInteger(value, &replay_threads))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid replay thread count \"%s\"", value.c_str());
+        }
+    }
+
+    return replay_threads;
+}
+
+static uint32_t GetInFlightLimit(const gfxrecon::util::ArgumentParser& arg_parser, const char* argument)
+{
+    uint32_t    limit = 0;
+    const auto& value = arg_parser.GetArgumentValue(argument);
+
+    if (!value.empty())
+    {
+        int count = std::stoi(value);
+
+        if (count <= 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid %s value \"%s\"", argument, value.c_str());
+        }
+        else if (arg_parser.IsOptionSet(kSyncOption))
+        {
+            GFXRECON_LOG_WARNING("Ignoring %s, which has no effect with %s", argument, kSyncOption);
+        }
+        else
+        {
+            limit = static_cast<uint32_t>(count);
+        }
+    }
+
+    return limit;
+}
+
+static uint32_t GetPipelineThreads(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    pipeline_threads = 0;
+    const auto& value            = arg_parser.GetArgumentValue(kPipelineThreadsArgument);
+
+    if (!value.empty())
+    {
+        int thread_count = std::stoi(value);
+
+        if (thread_count <= 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid pipeline thread count \"%s\"", value.c_str());
+        }
+        else if (arg_parser.IsOptionSet(kDecodeThreadOption) ||
+                 !arg_parser.GetArgumentValue(kReplayThreadsArgument).empty())
+        {
+            // Pipelines are created from the decoded parameters of the creation call, which are not retained past the
+            // end of a decode thread batch.
+            GFXRECON_LOG_WARNING("Ignoring %s, which cannot be combined with %s or %s",
+                                 kPipelineThreadsArgument,
+                                 kDecodeThreadOption,
+                                 kReplayThreadsArgument);
+        }
+        else
+        {
+            pipeline_threads = static_cast<uint32_t>(thread_count);
+        }
+    }
+
+    return pipeline_threads;
+}
+
 static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     WsiPlatform wsi_platform = WsiPlatform::kAuto;
@@ -334,6 +861,7 @@ static void GetLogSettings(const gfxrecon::util::ArgumentParser& arg_parser,
     log_settings.min_severity              = log_level;
     log_settings.file_name                 = arg_parser.GetArgumentValue(kLogFileArgument);
     log_settings.output_to_os_debug_string = arg_parser.IsOptionSet(kLogDebugView);
+    log_settings.async_write               = arg_parser.IsOptionSet(kLogAsyncOption);
 }
 
 static gfxrecon::decode::ScreenshotFormat GetScreenshotFormat(const gfxrecon::util::ArgumentParser& arg_parser)
@@ -347,6 +875,22 @@ static gfxrecon::decode::ScreenshotFormat GetScreenshotFormat(const gfxrecon::ut
         {
             format = gfxrecon::decode::ScreenshotFormat::kBmp;
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatPng, value.c_str()) == 0)
+        {
+            if (gfxrecon::util::imagewriter::IsPngSupported())
+            {
+                format = gfxrecon::decode::ScreenshotFormat::kPng;
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Ignoring screenshot format option \"%s\", which requires zlib support",
+                                     value.c_str());
+            }
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatQoi, value.c_str()) == 0)
+        {
+            format = gfxrecon::decode::ScreenshotFormat::kQoi;
+        }
         else
         {
             GFXRECON_LOG_WARNING("Ignoring unrecognized screenshot format option \"%s\"", value.c_str());
@@ -356,6 +900,52 @@ static gfxrecon::decode::ScreenshotFormat GetScreenshotFormat(const gfxrecon::ut
     return format;
 }
 
+static gfxrecon::decode::PresentModeOverride GetPresentModeOverride(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    gfxrecon::decode::PresentModeOverride present_mode = gfxrecon::decode::PresentModeOverride::kNone;
+    const auto&                           value        = arg_parser.GetArgumentValue(kPresentModeArgument);
+
+    if (!value.empty())
+    {
+        if (gfxrecon::util::platform::StringCompareNoCase(kPresentModeImmediate, value.c_str()) == 0)
+        {
+            present_mode = gfxrecon::decode::PresentModeOverride::kImmediate;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kPresentModeMailbox, value.c_str()) == 0)
+        {
+            present_mode = gfxrecon::decode::PresentModeOverride::kMailbox;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring unrecognized present mode option \"%s\"", value.c_str());
+        }
+    }
+
+    return present_mode;
+}
+
+static uint32_t GetScreenshotDownscale(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    downscale = 1;
+    const auto& value     = arg_parser.GetArgumentValue(kScreenshotDownscaleArgument);
+
+    if (!value.empty())
+    {
+        int divisor = std::stoi(value);
+
+        if (divisor > 0)
+        {
+            downscale = static_cast<uint32_t>(divisor);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid screenshot downscale factor \"%s\"", value.c_str());
+        }
+    }
+
+    return downscale;
+}
+
 static std::string GetScreenshotDir(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     const auto& value = arg_parser.GetArgumentValue(kScreenshotDirArgument);
@@ -502,6 +1092,70 @@ GetScreenshotRanges(const gfxrecon::util::ArgumentParser& arg_parser)
     return ranges;
 }
 
+static gfxrecon::decode::VulkanRebindAllocator::PoolSettings
+GetRebindPoolSettings(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    gfxrecon::decode::VulkanRebindAllocator::PoolSettings pool_settings;
+
+    const auto& algorithm = arg_parser.GetArgumentValue(kRebindPoolAlgorithmArgument);
+    if (!algorithm.empty())
+    {
+        if (gfxrecon::util::platform::StringCompareNoCase(kPoolAlgorithmLinear, algorithm.c_str()) == 0)
+        {
+            pool_settings.algorithm = gfxrecon::decode::VulkanRebindAllocator::PoolAlgorithm::kLinear;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kPoolAlgorithmBuddy, algorithm.c_str()) == 0)
+        {
+            pool_settings.algorithm = gfxrecon::decode::VulkanRebindAllocator::PoolAlgorithm::kBuddy;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kPoolAlgorithmDefault, algorithm.c_str()) != 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring unrecognized memory pool algorithm \"%s\"", algorithm.c_str());
+        }
+    }
+
+    const auto& block_size = arg_parser.GetArgumentValue(kRebindBlockSizeArgument);
+    if (!block_size.empty())
+    {
+        int size = std::stoi(block_size);
+
+        if (size <= 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid memory block size \"%s\"", block_size.c_str());
+        }
+        else
+        {
+            // The block size is specified in MiB.
+            pool_settings.block_size = static_cast<VkDeviceSize>(size) * 1024 * 1024;
+        }
+    }
+
+    return pool_settings;
+}
+
+static VkDeviceSize GetDeviceMemoryBudget(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    VkDeviceSize budget = 0;
+
+    const auto& value = arg_parser.GetArgumentValue(kDeviceMemoryBudgetArgument);
+    if (!value.empty())
+    {
+        int size = std::stoi(value);
+
+        if (size <= 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid device memory budget \"%s\"", value.c_str());
+        }
+        else
+        {
+            // The budget is specified in MiB.
+            budget = static_cast<VkDeviceSize>(size) * 1024 * 1024;
+        }
+    }
+
+    return budget;
+}
+
 static gfxrecon::decode::CreateResourceAllocator
 GetCreateResourceAllocatorFunc(const gfxrecon::util::ArgumentParser&           arg_parser,
                                const std::string&                              filename,
@@ -515,7 +1169,9 @@ GetCreateResourceAllocatorFunc(const gfxrecon::util::ArgumentParser&           a
     {
         if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRebind, value.c_str()) == 0)
         {
-            func = CreateRebindAllocator;
+            auto pool_settings = GetRebindPoolSettings(arg_parser);
+            auto budget        = GetDeviceMemoryBudget(arg_parser);
+            func               = [pool_settings, budget]() { return CreateRebindAllocator(pool_settings, budget); };
         }
         else if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRemap, value.c_str()) == 0)
         {
@@ -523,7 +1179,11 @@ GetCreateResourceAllocatorFunc(const gfxrecon::util::ArgumentParser&           a
         }
         else if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRealign, value.c_str()) == 0)
         {
-            func = InitRealignAllocatorCreateFunc(filename, replay_options, tracked_object_info_table);
+            gfxrecon::graphics::StartupTimingReport::ScopedPhase phase(
+                replay_options.startup_report.get(), gfxrecon::graphics::StartupTimingReport::kRealignPrePass);
+
+            func = InitRealignAllocatorCreateFunc(
+                filename, replay_options, !arg_parser.IsOptionSet(kNoAnalysisCacheOption), tracked_object_info_table);
         }
         else if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationNone, value.c_str()) != 0)
         {
@@ -531,15 +1191,138 @@ GetCreateResourceAllocatorFunc(const gfxrecon::util::ArgumentParser&           a
         }
     }
 
+    if ((gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRebind, value.c_str()) != 0) &&
+        (!arg_parser.GetArgumentValue(kRebindPoolAlgorithmArgument).empty() ||
+         !arg_parser.GetArgumentValue(kRebindBlockSizeArgument).empty() ||
+         !arg_parser.GetArgumentValue(kDeviceMemoryBudgetArgument).empty()))
+    {
+        GFXRECON_LOG_WARNING("Ignoring %s, %s, and %s, which only apply to the %s memory translation mode",
+                             kRebindPoolAlgorithmArgument,
+                             kRebindBlockSizeArgument,
+                             kDeviceMemoryBudgetArgument,
+                             kMemoryTranslationRebind);
+    }
+
+    // The rebind allocator never maps memory for the capture file's vkMapMemory calls, so only the allocators derived
+    // from VulkanDefaultAllocator need to be configured for persistent mapping.
+    if (arg_parser.IsOptionSet(kPersistentMappingOption) &&
+        (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRebind, value.c_str()) != 0))
+    {
+        func = [func]() -> gfxrecon::decode::VulkanResourceAllocator* {
+            auto allocator = static_cast<gfxrecon::decode::VulkanDefaultAllocator*>(func());
+            allocator->SetPersistentMapping(true);
+            return allocator;
+        };
+    }
+
     return func;
 }
 
+static std::string GetPipelineCacheFilePrefix(const gfxrecon::util::ArgumentParser& arg_parser,
+                                              const std::string&                    filename)
+{
+    const auto& dir = arg_parser.GetArgumentValue(kPipelineCacheDirArgument);
+
+    if (dir.empty())
+    {
+        return "";
+    }
+
+    // Name the cache files after the capture file, so that each capture has its own pipeline cache.
+    std::string name      = filename;
+    size_t      separator = name.find_last_of("/\\");
+    if (separator != std::string::npos)
+    {
+        name = name.substr(separator + 1);
+    }
+
+    size_t extension = name.find_last_of('.');
+    if ((extension != std::string::npos) && (extension > 0))
+    {
+        name = name.substr(0, extension);
+    }
+
+    for (auto& c : name)
+    {
+        if (!isalnum(static_cast<unsigned char>(c)) && (c != '-') && (c != '_'))
+        {
+            c = '_';
+        }
+    }
+
+    return gfxrecon::util::filepath::Join(dir, name);
+}
+
+static std::shared_ptr<gfxrecon::decode::PrescannedPipelineData>
+GetWarmUpPipelines(const gfxrecon::util::ArgumentParser& arg_parser, const std::string& filename)
+{
+    const auto& value = arg_parser.GetArgumentValue(kPipelineWarmUpArgument);
+
+    if (value.empty())
+    {
+        return nullptr;
+    }
+
+    int frame_count = std::stoi(value);
+
+    if (frame_count <= 0)
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid pipeline warm-up frame count \"%s\"", value.c_str());
+        return nullptr;
+    }
+    else if ((filename == "-") || gfxrecon::util::SocketInputStream::IsSocketAddress(filename))
+    {
+        GFXRECON_LOG_WARNING("Ignoring %s, which requires a capture file that can be read twice",
+                             kPipelineWarmUpArgument);
+        return nullptr;
+    }
+    else if (!arg_parser.GetArgumentValue(kShaderReplaceArgument).empty())
+    {
+        GFXRECON_LOG_WARNING("Ignoring %s, which cannot be combined with %s",
+                             kPipelineWarmUpArgument,
+                             kShaderReplaceArgument);
+        return nullptr;
+    }
+
+    // Pre-scan the capture file for the pipeline creation calls of the warm-up frames.
+    GFXRECON_WRITE_CONSOLE("Pre-scanning the first %d frame(s) for pipeline creation. Please wait...", frame_count);
+
+    gfxrecon::decode::FileProcessor                 file_processor;
+    gfxrecon::decode::VulkanDecoder                 decoder;
+    gfxrecon::decode::VulkanPipelinePrescanConsumer prescan_consumer;
+
+    if (file_processor.Initialize(filename))
+    {
+        decoder.AddConsumer(&prescan_consumer);
+        file_processor.AddDecoder(&decoder);
+
+        while ((file_processor.GetCurrentFrameNumber() < static_cast<uint32_t>(frame_count)) &&
+               file_processor.ProcessNextFrame())
+        {
+        }
+
+        file_processor.RemoveDecoder(&decoder);
+        decoder.RemoveConsumer(&prescan_consumer);
+    }
+
+    auto data = prescan_consumer.GetData();
+
+    GFXRECON_WRITE_CONSOLE("Pre-scan found %" PRIu64 " shader module(s) and %" PRIu64 " pipeline creation call(s).",
+                           static_cast<uint64_t>(data->shader_modules.size()),
+                           static_cast<uint64_t>(data->pipelines.size()));
+
+    return data;
+}
+
 static gfxrecon::decode::ReplayOptions
-GetReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parser,
-                 const std::string&                              filename,
-                 gfxrecon::decode::VulkanTrackedObjectInfoTable* tracked_object_info_table)
+GetReplayOptions(const gfxrecon::util::ArgumentParser&                           arg_parser,
+                 const std::string&                                              filename,
+                 gfxrecon::decode::VulkanTrackedObjectInfoTable*                 tracked_object_info_table,
+                 const std::shared_ptr<gfxrecon::graphics::StartupTimingReport>& startup_report = nullptr)
 {
     gfxrecon::decode::ReplayOptions replay_options;
+    replay_options.startup_report = startup_report;
+
     const auto&                     override_gpu = arg_parser.GetArgumentValue(kOverrideGpuArgument);
 
     if (!override_gpu.empty())
@@ -552,11 +1335,76 @@ GetReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parser,
         replay_options.sync_queue_submissions = true;
     }
 
+    replay_options.max_submits_in_flight = GetInFlightLimit(arg_parser, kMaxSubmitsInFlightArgument);
+    replay_options.max_frames_in_flight  = GetInFlightLimit(arg_parser, kMaxFramesInFlightArgument);
+
+    if (arg_parser.IsOptionSet(kCollapsePollingOption))
+    {
+        replay_options.collapse_polling = true;
+    }
+
+    if (arg_parser.IsOptionSet(kBatchSubmitsOption))
+    {
+        if (replay_options.sync_queue_submissions)
+        {
+            GFXRECON_LOG_WARNING("Ignoring %s, which cannot be combined with %s", kBatchSubmitsOption, kSyncOption);
+        }
+        else
+        {
+            replay_options.batch_submits = true;
+        }
+    }
+
+    if (arg_parser.IsOptionSet(kRecyclePoolsOption))
+    {
+        replay_options.recycle_pools = true;
+    }
+
+    if (arg_parser.IsOptionSet(kPaceCpuTimestampsOption))
+    {
+        replay_options.cpu_timestamp_pacing = true;
+    }
+
+    if (arg_parser.IsOptionSet(kSkipRedundantDescriptorsOption))
+    {
+        replay_options.skip_redundant_descriptor_updates = true;
+    }
+
     if (arg_parser.IsOptionSet(kRemoveUnsupportedOption))
     {
         replay_options.remove_unsupported_features = true;
     }
 
+    if (arg_parser.IsOptionSet(kRemapDeviceAddressesOption))
+    {
+        replay_options.remap_device_addresses = true;
+    }
+
+    if (arg_parser.IsOptionSet(kAccelStructCacheOption))
+    {
+        replay_options.accel_struct_cache_capture_file = filename;
+    }
+
+    if (arg_parser.IsOptionSet(kLazyResourceInitOption))
+    {
+        replay_options.lazy_resource_init_file = filename;
+    }
+
+    if (arg_parser.IsOptionSet(kFastExitOption))
+    {
+        replay_options.fast_exit = true;
+    }
+
+    if (arg_parser.IsOptionSet(kDebugLabelBlocksOption))
+    {
+        replay_options.debug_labels       = true;
+        replay_options.debug_label_blocks = true;
+    }
+    else if (arg_parser.IsOptionSet(kDebugLabelsOption))
+    {
+        replay_options.debug_labels = true;
+    }
+
     if (arg_parser.IsOptionSet(kSkipFailedAllocationLongOption) ||
         arg_parser.IsOptionSet(kSkipFailedAllocationShortOption))
     {
@@ -569,14 +1417,25 @@ GetReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parser,
         replay_options.omit_pipeline_cache_data = true;
     }
 
-    replay_options.replace_dir = arg_parser.GetArgumentValue(kShaderReplaceArgument);
+    replay_options.replace_dir                = arg_parser.GetArgumentValue(kShaderReplaceArgument);
+    replay_options.pipeline_creation_threads  = GetPipelineThreads(arg_parser);
+    replay_options.pipeline_cache_file_prefix = GetPipelineCacheFilePrefix(arg_parser, filename);
+    replay_options.warm_up_pipelines          = GetWarmUpPipelines(arg_parser, filename);
     replay_options.create_resource_allocator =
         GetCreateResourceAllocatorFunc(arg_parser, filename, replay_options, tracked_object_info_table);
 
+    // The rebind allocator translates each memory fill to the resources bound to the memory, so merge consecutive fills
+    // to reduce the number of translations.
+    const auto& memory_translation = arg_parser.GetArgumentValue(kMemoryPortabilityShortOption);
+    replay_options.coalesce_memory_fills =
+        (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRebind, memory_translation.c_str()) == 0);
+
     replay_options.screenshot_ranges      = GetScreenshotRanges(arg_parser);
     replay_options.screenshot_format      = GetScreenshotFormat(arg_parser);
     replay_options.screenshot_dir         = GetScreenshotDir(arg_parser);
     replay_options.screenshot_file_prefix = arg_parser.GetArgumentValue(kScreenshotFilePrefixArgument);
+    replay_options.screenshot_downscale   = GetScreenshotDownscale(arg_parser);
+    replay_options.screenshot_hash_only   = arg_parser.IsOptionSet(kScreenshotHashOnlyOption);
 
     std::string surface_index = arg_parser.GetArgumentValue(kSurfaceIndexArgument);
     if (!surface_index.empty())
@@ -584,9 +1443,165 @@ GetReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parser,
         replay_options.surface_index = std::stoi(surface_index);
     }
 
+    if (arg_parser.IsOptionSet(kVirtualSwapchainOption))
+    {
+        replay_options.virtual_swapchain = true;
+    }
+
+    replay_options.present_mode_override = GetPresentModeOverride(arg_parser);
+    if ((replay_options.present_mode_override != gfxrecon::decode::PresentModeOverride::kNone) &&
+        replay_options.virtual_swapchain)
+    {
+        GFXRECON_LOG_WARNING("Ignoring %s, which cannot be combined with %s",
+                             kPresentModeArgument,
+                             kVirtualSwapchainOption);
+        replay_options.present_mode_override = gfxrecon::decode::PresentModeOverride::kNone;
+    }
+
+    replay_options.timing_report_file = arg_parser.GetArgumentValue(kTimingReportArgument);
+    if (!replay_options.timing_report_file.empty())
+    {
+        GetTimingReportFrames(arg_parser,
+                              kTimingReportFramesArgument,
+                              &replay_options.timing_report_first_frame,
+                              &replay_options.timing_report_last_frame);
+    }
+
+    replay_options.pass_timing_report_file = arg_parser.GetArgumentValue(kPassTimingReportArgument);
+    if (!replay_options.pass_timing_report_file.empty())
+    {
+        GetTimingReportFrames(arg_parser,
+                              kPassTimingFramesArgument,
+                              &replay_options.pass_timing_first_frame,
+                              &replay_options.pass_timing_last_frame);
+    }
+
+    const auto& memory_report_file = arg_parser.GetArgumentValue(kMemoryReportArgument);
+    if (!memory_report_file.empty())
+    {
+        replay_options.memory_report = std::make_shared<gfxrecon::graphics::MemoryUsageReport>(
+            memory_report_file, GetMemoryReportInterval(arg_parser));
+    }
+
     return replay_options;
 }
 
+// Gets the options for the replay consumer of one of the --gpus devices, which writes its reports, screenshots, and
+// pipeline caches to files with a _gpu<index> postfix.
+static gfxrecon::decode::ReplayOptions GetDeviceReplayOptions(const gfxrecon::decode::ReplayOptions& replay_options,
+                                                              int32_t                                gpu_index)
+{
+    gfxrecon::decode::ReplayOptions device_options = replay_options;
+    std::string                     postfix        = "_gpu" + std::to_string(gpu_index);
+
+    device_options.override_gpu_index = gpu_index;
+
+    if (device_options.screenshot_file_prefix.empty())
+    {
+        device_options.screenshot_file_prefix = gfxrecon::decode::kDefaultScreenshotFilePrefix;
+    }
+
+    device_options.screenshot_file_prefix += postfix;
+
+    if (!device_options.pipeline_cache_file_prefix.empty())
+    {
+        device_options.pipeline_cache_file_prefix += postfix;
+    }
+
+    if (!device_options.timing_report_file.empty())
+    {
+        device_options.timing_report_file =
+            gfxrecon::util::filepath::InsertFilenamePostfix(device_options.timing_report_file, postfix);
+    }
+
+    if (!device_options.pass_timing_report_file.empty())
+    {
+        device_options.pass_timing_report_file =
+            gfxrecon::util::filepath::InsertFilenamePostfix(device_options.pass_timing_report_file, postfix);
+    }
+
+    return device_options;
+}
+
+// Assigns the replay threads to processor cores and sets their priority, and applies the settings of the replay thread
+// to the calling thread.
+static void ConfigureThreadPlacement(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const auto& affinity = arg_parser.GetArgumentValue(kThreadAffinityArgument);
+    const auto& priority = arg_parser.GetArgumentValue(kThreadPriorityArgument);
+
+    if (affinity.empty() && priority.empty())
+    {
+        return;
+    }
+
+    gfxrecon::util::thread_placement::Placement placement;
+
+    if (gfxrecon::util::platform::StringCompareNoCase("auto", affinity.c_str()) == 0)
+    {
+        if (!gfxrecon::util::thread_placement::GetAutomaticAffinity(&placement))
+        {
+            GFXRECON_LOG_WARNING("Ignoring --thread-affinity auto; the processor topology is unavailable or does not "
+                                 "have multiple cores");
+        }
+    }
+    else if (!affinity.empty() && !gfxrecon::util::thread_placement::ParseAffinity(affinity, &placement))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid --thread-affinity value \"%s\"", affinity.c_str());
+        placement.clear();
+    }
+
+    if (!priority.empty())
+    {
+        auto priority_placement = placement;
+
+        if (gfxrecon::util::thread_placement::ParsePriority(priority, &priority_placement))
+        {
+            placement = priority_placement;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid --thread-priority value \"%s\"", priority.c_str());
+        }
+    }
+
+    gfxrecon::util::thread_placement::Configure(placement);
+    gfxrecon::util::thread_placement::ApplyThreadRole(gfxrecon::util::thread_placement::kReplayThread);
+}
+
+// Reads the capture files to replay from a --playlist file, which lists one file per line.  Empty lines and lines
+// that start with # are skipped.
+static bool GetPlaylistFiles(const std::string& playlist, std::vector<std::string>* filenames)
+{
+    std::ifstream stream(playlist);
+
+    if (!stream)
+    {
+        GFXRECON_LOG_ERROR("Failed to open playlist file %s", playlist.c_str());
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        // Trim surrounding whitespace, including the carriage returns of files with Windows line endings.
+        size_t first = line.find_first_not_of(" \t\r");
+        if ((first != std::string::npos) && (line[first] != '#'))
+        {
+            size_t last = line.find_last_not_of(" \t\r");
+            filenames->push_back(line.substr(first, last - first + 1));
+        }
+    }
+
+    if (filenames->empty())
+    {
+        GFXRECON_LOG_ERROR("Playlist file %s does not list any capture files", playlist.c_str());
+        return false;
+    }
+
+    return true;
+}
+
 static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
 {
     if (arg_parser.IsOptionSet(kVersionOption))
@@ -625,25 +1640,58 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to replay GFXReconstruct capture files.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
     GFXRECON_WRITE_CONSOLE("  %s\t[-h | --help] [--version] [--gpu <index>]", app_name.c_str());
+#if !defined(__ANDROID__)
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--gpus <index,...>]");
+#endif
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pause-frame <N>] [--paused] [--sync] [--screenshot-all]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--max-submits-in-flight <N>] [--max-frames-in-flight <N>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--fast-forward <N>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshots <N1(-N2),...>] [--screenshot-format <format>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-dir <dir>] [--screenshot-prefix <file-prefix>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-downscale <N>] [--screenshot-hash-only]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sfa | --skip-failed-allocations] [--replace-shaders <dir>]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--opcd | --omit-pipeline-cache-data] [--wsi <platform>]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--surface-index <N>] [--remove-unsupported]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--opcd | --omit-pipeline-cache-data] [--pipeline-cache <dir>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--wsi <platform>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--surface-index <N>] [--virtual-swapchain]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--present-mode <mode>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--remove-unsupported] [--mmap] [--prefetch]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--remap-device-addresses] [--accel-struct-cache]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--lazy-resource-init]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--preload | --preload-frames <first-last>] [--preload-limit <MiB>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--decompression-threads <N>] [--decode-thread]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--replay-threads <N>] [--pipeline-threads <N>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--pipeline-warm-up <N>] [--collapse-polling]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--persistent-mapping] [--skip-redundant-descriptor-updates]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--reuse-command-buffers] [--pace-cpu-timestamps]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--batch-submits] [--recycle-pools]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[-m <mode> | --memory-translation <mode>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--rebind-pool-algorithm <algorithm>] [--rebind-block-size <MiB>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--device-memory-budget <MiB>] [--no-analysis-cache]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--loop-frames <first-last>] [--loop-count <N>] [--loop-program]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--timing-report <file>] [--timing-report-frames <first-last>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--pass-timing-report <file>] [--pass-timing-frames <first-last>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--startup-report <file>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--memory-report <file>] [--memory-report-interval <N>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--thread-affinity <auto|assignments>] [--thread-priority <priorities>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--huge-pages <mode>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--profile-calls] [--playlist] [--fast-exit]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--debug-labels] [--debug-label-blocks]");
 #if defined(WIN32)
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>] [--log-debugview]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>] [--log-async] [--log-debugview]");
 #if defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--no-debug-popup]");
 #endif
 #else
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>] [--log-async]");
 #endif
     GFXRECON_WRITE_CONSOLE("\t\t\t<file>\n");
 
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tPath to the capture file to replay.");
+    GFXRECON_WRITE_CONSOLE("          \t\tUse - to read the capture from standard input, tcp://<host>:<port>");
+    GFXRECON_WRITE_CONSOLE("          \t\tto connect to a capture server, or tcp://:<port> to wait for a");
+    GFXRECON_WRITE_CONSOLE("          \t\tconnection on the specified port.  Files that were captured");
+    GFXRECON_WRITE_CONSOLE("          \t\twith memory deduplication must be read from disk.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
@@ -651,6 +1699,8 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tdebug, info, warning, error, and fatal. Default is info.");
     GFXRECON_WRITE_CONSOLE("  --log-file <file>\tWrite log messages to a file at the specified path.")
     GFXRECON_WRITE_CONSOLE("          \t\tDefault is: Empty string (file logging disabled).");
+    GFXRECON_WRITE_CONSOLE("  --log-async\t\tFormat and write log messages from a background thread,");
+    GFXRECON_WRITE_CONSOLE("          \t\tcoalescing consecutive identical messages.");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("  --log-debugview\tLog messages with OutputDebugStringA.");
 #endif
@@ -659,9 +1709,143 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\treturned by vkEnumeratePhysicalDevices.  Replay may fail");
     GFXRECON_WRITE_CONSOLE("          \t\tif the specified device is not compatible with the");
     GFXRECON_WRITE_CONSOLE("          \t\toriginal capture devices.");
+#if !defined(__ANDROID__)
+    GFXRECON_WRITE_CONSOLE("  --gpus <index,...>\tReplay on each of the specified devices at the same time,");
+    GFXRECON_WRITE_CONSOLE("          \t\tdecoding the capture file once for all of the devices.");
+    GFXRECON_WRITE_CONSOLE("          \t\tTiming reports, screenshots, and pipeline caches are");
+    GFXRECON_WRITE_CONSOLE("          \t\twritten for each device, with a _gpu<index> postfix.");
+    GFXRECON_WRITE_CONSOLE("          \t\tReplaces --gpu, and cannot be combined with the realign");
+    GFXRECON_WRITE_CONSOLE("          \t\tmemory translation mode.");
+#endif
     GFXRECON_WRITE_CONSOLE("  --pause-frame <N>\tPause after replaying frame number N.");
     GFXRECON_WRITE_CONSOLE("  --paused\t\tPause after replaying the first frame (same");
     GFXRECON_WRITE_CONSOLE("          \t\tas --pause-frame 1).");
+    GFXRECON_WRITE_CONSOLE("  --fast-forward <N>");
+    GFXRECON_WRITE_CONSOLE("          \t\tDrop the draw, dispatch, and trace rays commands that");
+    GFXRECON_WRITE_CONSOLE("          \t\tare recorded before frame N, to reach frame N faster.");
+    GFXRECON_WRITE_CONSOLE("          \t\tResource creation, uploads, copies, and descriptor");
+    GFXRECON_WRITE_CONSOLE("          \t\tupdates are still replayed, and frames are still");
+    GFXRECON_WRITE_CONSOLE("          \t\tpresented.  Render targets, storage images, and storage");
+    GFXRECON_WRITE_CONSOLE("          \t\tbuffers that are written by the dropped commands are");
+    GFXRECON_WRITE_CONSOLE("          \t\tleft unwritten, so frames that read them after frame N");
+    GFXRECON_WRITE_CONSOLE("          \t\tmay render incorrectly.  A warning is logged when a");
+    GFXRECON_WRITE_CONSOLE("          \t\tcommand buffer with dropped commands is submitted again");
+    GFXRECON_WRITE_CONSOLE("          \t\twithout being re-recorded after frame N begins.");
+    GFXRECON_WRITE_CONSOLE("  --loop-frames <first-last>");
+    GFXRECON_WRITE_CONSOLE("          \t\tReplay the specified frame range repeatedly and report the");
+    GFXRECON_WRITE_CONSOLE("          \t\ttime of each repeat, then stop replay.  The contents of");
+    GFXRECON_WRITE_CONSOLE("          \t\tdevice memory are saved before the range is first replayed");
+    GFXRECON_WRITE_CONSOLE("          \t\tand restored with GPU copies before each repeat.  Objects");
+    GFXRECON_WRITE_CONSOLE("          \t\tthat are created or destroyed within the range are not");
+    GFXRECON_WRITE_CONSOLE("          \t\trestored.  Frame 1 can only be looped for trimmed capture");
+    GFXRECON_WRITE_CONSOLE("          \t\tfiles with a seek index.  Cannot be combined with");
+    GFXRECON_WRITE_CONSOLE("          \t\t--decode-thread, --replay-threads, or the rebind memory");
+    GFXRECON_WRITE_CONSOLE("          \t\ttranslation mode.");
+    GFXRECON_WRITE_CONSOLE("  --loop-count <N>\tNumber of times to replay the --loop-frames range.");
+    GFXRECON_WRITE_CONSOLE("                  \tDefault is %u.", kDefaultLoopCount);
+    GFXRECON_WRITE_CONSOLE("  --loop-program\tKeep the decoded API calls of the first replay of the");
+    GFXRECON_WRITE_CONSOLE("          \t\t--loop-frames range in memory and replay the following");
+    GFXRECON_WRITE_CONSOLE("          \t\trepeats from them, so that the capture file is not read");
+    GFXRECON_WRITE_CONSOLE("          \t\tand decoded again for each repeat.");
+    GFXRECON_WRITE_CONSOLE("  --timing-report <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite the CPU time, GPU time, and present-to-present");
+    GFXRECON_WRITE_CONSOLE("          \t\tinterval of each frame, with min, mean, p50, p95, p99,");
+    GFXRECON_WRITE_CONSOLE("          \t\tand max statistics, to the specified file.  The file is");
+    GFXRECON_WRITE_CONSOLE("          \t\twritten as CSV when its name ends with .csv, and as");
+    GFXRECON_WRITE_CONSOLE("          \t\tJSON otherwise.  GPU time is measured with timestamp");
+    GFXRECON_WRITE_CONSOLE("          \t\tqueries around each vkQueueSubmit call.");
+    GFXRECON_WRITE_CONSOLE("  --timing-report-frames <first-last>");
+    GFXRECON_WRITE_CONSOLE("          \t\tOnly report the specified range of frames, numbered");
+    GFXRECON_WRITE_CONSOLE("          \t\tfrom 1 for the first replayed frame.  Default is all");
+    GFXRECON_WRITE_CONSOLE("          \t\tframes.");
+    GFXRECON_WRITE_CONSOLE("  --pass-timing-report <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite the GPU time of each render pass and dispatch group");
+    GFXRECON_WRITE_CONSOLE("          \t\tof each frame, keyed by the capture IDs of its command");
+    GFXRECON_WRITE_CONSOLE("          \t\tbuffer and render pass, with per-pass statistics, to the");
+    GFXRECON_WRITE_CONSOLE("          \t\tspecified file.  The file is written as CSV when its name");
+    GFXRECON_WRITE_CONSOLE("          \t\tends with .csv, and as JSON otherwise.  Replay writes");
+    GFXRECON_WRITE_CONSOLE("          \t\ttimestamps before and after each pass of the primary");
+    GFXRECON_WRITE_CONSOLE("          \t\tcommand buffers.  A dispatch group spans the commands");
+    GFXRECON_WRITE_CONSOLE("          \t\tfrom a dispatch to the next render pass or the end of");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe command buffer.");
+    GFXRECON_WRITE_CONSOLE("  --pass-timing-frames <first-last>");
+    GFXRECON_WRITE_CONSOLE("          \t\tOnly time the passes of the specified range of frames,");
+    GFXRECON_WRITE_CONSOLE("          \t\tnumbered from 1 for the first replayed frame.  Command");
+    GFXRECON_WRITE_CONSOLE("          \t\tbuffers that are recorded after the range are not");
+    GFXRECON_WRITE_CONSOLE("          \t\tinstrumented.  Default is all frames.");
+    GFXRECON_WRITE_CONSOLE("  --startup-report <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite the wall time of the replay startup phases to the");
+    GFXRECON_WRITE_CONSOLE("          \t\tspecified file as JSON.  The phases are loader");
+    GFXRECON_WRITE_CONSOLE("          \t\tinitialization, file processor initialization, the");
+    GFXRECON_WRITE_CONSOLE("          \t\trealign allocator pre-pass, instance and device creation,");
+    GFXRECON_WRITE_CONSOLE("          \t\tand the loading of the trimmed state, which is split into");
+    GFXRECON_WRITE_CONSOLE("          \t\tobject creation, resource initialization, and pipeline");
+    GFXRECON_WRITE_CONSOLE("          \t\tcreation.  The time to the first present is also reported.");
+    GFXRECON_WRITE_CONSOLE("  --memory-report <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tLog the current and peak memory usage of replay for each");
+    GFXRECON_WRITE_CONSOLE("          \t\trange of frames, and append it to the specified file.  The");
+    GFXRECON_WRITE_CONSOLE("          \t\thost memory of the decode buffers, object info tables,");
+    GFXRECON_WRITE_CONSOLE("          \t\tallocator copies of mapped memory, and screenshot buffers");
+    GFXRECON_WRITE_CONSOLE("          \t\tis reported with the process resident size and the device");
+    GFXRECON_WRITE_CONSOLE("          \t\tmemory allocated from each heap of each device.  The file");
+    GFXRECON_WRITE_CONSOLE("          \t\tis written as CSV when its name ends with .csv, and as");
+    GFXRECON_WRITE_CONSOLE("          \t\tJSON lines otherwise.  It is flushed after each range, so");
+    GFXRECON_WRITE_CONSOLE("          \t\tthat it is kept when replay runs out of memory.");
+    GFXRECON_WRITE_CONSOLE("  --memory-report-interval <N>");
+    GFXRECON_WRITE_CONSOLE("          \t\tNumber of frames in each range of the memory report.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault is 100.");
+    GFXRECON_WRITE_CONSOLE("  --profile-calls\tMeasure the CPU time that replay spends decoding and");
+    GFXRECON_WRITE_CONSOLE("          \t\tprocessing each API call, and write a table of the calls");
+    GFXRECON_WRITE_CONSOLE("          \t\tsorted by total time when replay finishes.  Processing");
+    GFXRECON_WRITE_CONSOLE("          \t\ttime includes handle mapping, replay logic, and the");
+    GFXRECON_WRITE_CONSOLE("          \t\tdriver call.");
+    GFXRECON_WRITE_CONSOLE("  --playlist\t\tTreat <file> as a text file that lists the capture files");
+    GFXRECON_WRITE_CONSOLE("          \t\tto replay, one per line, and replay them in order in one");
+    GFXRECON_WRITE_CONSOLE("          \t\tprocess.  Empty lines and lines starting with # are");
+    GFXRECON_WRITE_CONSOLE("          \t\tskipped.  Instances and devices that are destroyed by a");
+    GFXRECON_WRITE_CONSOLE("          \t\tcapture file are kept, and reused by later capture files");
+    GFXRECON_WRITE_CONSOLE("          \t\tthat create them with the same parameters.");
+    GFXRECON_WRITE_CONSOLE("  --thread-affinity <auto|assignments>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRestrict the replay threads to processor cores.  Threads");
+    GFXRECON_WRITE_CONSOLE("          \t\thave the roles replay, decode (decode and decompression),");
+    GFXRECON_WRITE_CONSOLE("          \t\tio (file read-ahead and prefetch), and worker (pipeline");
+    GFXRECON_WRITE_CONSOLE("          \t\tcreation and command buffer replay).  Cores are assigned");
+    GFXRECON_WRITE_CONSOLE("          \t\tto roles with a list such as replay=2,decode=3,io=4,worker=5-7,9.");
+    GFXRECON_WRITE_CONSOLE("          \t\tWith auto, the replay, decode, and io threads each run on");
+    GFXRECON_WRITE_CONSOLE("          \t\ttheir own physical core, preferring the fastest cores and");
+    GFXRECON_WRITE_CONSOLE("          \t\tcores that share a cache, and the workers use the rest.");
+    GFXRECON_WRITE_CONSOLE("  --thread-priority <priorities>");
+    GFXRECON_WRITE_CONSOLE("          \t\tSet the priority of the replay threads to low, normal, or");
+    GFXRECON_WRITE_CONSOLE("          \t\thigh, for all roles or for each role with a list such as");
+    GFXRECON_WRITE_CONSOLE("          \t\treplay=high,decode=high.  Raising priority may require");
+    GFXRECON_WRITE_CONSOLE("          \t\televated privileges.");
+    GFXRECON_WRITE_CONSOLE("  --huge-pages <mode>");
+    GFXRECON_WRITE_CONSOLE("          \t\tBack the capture file read and decompression buffers that");
+    GFXRECON_WRITE_CONSOLE("          \t\tare 2 MiB or larger with huge pages, to reduce TLB misses");
+    GFXRECON_WRITE_CONSOLE("          \t\twhen decoding large blocks.  Available modes are:");
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\tUse regular pages (default).", "none");
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\tAdvise the kernel to use transparent huge", "transparent");
+    GFXRECON_WRITE_CONSOLE("          \t\t       \t\tpages (Linux and Android).");
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\tAllocate from the reserved huge page pool", "explicit");
+    GFXRECON_WRITE_CONSOLE("          \t\t       \t\ton Linux, or with large pages on Windows, which");
+    GFXRECON_WRITE_CONSOLE("          \t\t       \t\trequires the Lock Pages in Memory privilege.");
+    GFXRECON_WRITE_CONSOLE("          \t\t       \t\tFalls back to transparent huge pages or");
+    GFXRECON_WRITE_CONSOLE("          \t\t       \t\tregular pages when allocation fails.");
+    GFXRECON_WRITE_CONSOLE("  --fast-exit\t\tWhen replay ends, wait for the devices to become idle,");
+    GFXRECON_WRITE_CONSOLE("          \t\twrite the screenshots, reports, and pipeline caches, and");
+    GFXRECON_WRITE_CONSOLE("          \t\texit without destroying the objects that are still alive.");
+    GFXRECON_WRITE_CONSOLE("          \t\tObjects that the capture file leaked are only reported");
+    GFXRECON_WRITE_CONSOLE("          \t\twhen this option is not specified.  Ignored with");
+    GFXRECON_WRITE_CONSOLE("          \t\t--playlist.");
+    GFXRECON_WRITE_CONSOLE("  --debug-labels\tInsert VK_EXT_debug_utils labels for external GPU");
+    GFXRECON_WRITE_CONSOLE("          \t\tprofilers, naming each queue submission with its frame");
+    GFXRECON_WRITE_CONSOLE("          \t\tand submission index, and each command buffer recording");
+    GFXRECON_WRITE_CONSOLE("          \t\twith the command buffer's capture ID.");
+    GFXRECON_WRITE_CONSOLE("  --debug-label-blocks");
+    GFXRECON_WRITE_CONSOLE("          \t\tSame as --debug-labels, with the index of the capture");
+    GFXRECON_WRITE_CONSOLE("          \t\tfile block of the submission or begin command added to");
+    GFXRECON_WRITE_CONSOLE("          \t\teach label.  Blocks are counted from the first block that");
+    GFXRECON_WRITE_CONSOLE("          \t\treplay processes.");
     GFXRECON_WRITE_CONSOLE("  --screenshot-all");
     GFXRECON_WRITE_CONSOLE("          \t\tGenerate screenshots for all frames.  When this");
     GFXRECON_WRITE_CONSOLE("          \t\toption is specified, --screenshots is ignored.");
@@ -680,6 +1864,12 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tAvailable formats are:");
     GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tBitmap file format.  This is the default format.",
                            kScreenshotFormatBmp);
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tPNG file format, without alpha.  Requires zlib support.",
+                           kScreenshotFormatPng);
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tQOI file format, without alpha.  Encodes faster than PNG,",
+                           kScreenshotFormatQoi);
+    GFXRECON_WRITE_CONSOLE("          \t\t       \t\twith larger files.");
+    GFXRECON_WRITE_CONSOLE("          \t\tPNG and QOI files are encoded by background threads.");
     GFXRECON_WRITE_CONSOLE("  --screenshot-dir <dir>");
     GFXRECON_WRITE_CONSOLE("          \t\tDirectory to write screenshots.  Default is the current");
     GFXRECON_WRITE_CONSOLE("          \t\tworking directory.");
@@ -687,25 +1877,158 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tPrefix to apply to the screenshot file name.  Default is ");
     GFXRECON_WRITE_CONSOLE("          \t\t\"screenshot\", producing file names similar to");
     GFXRECON_WRITE_CONSOLE("          \t\t\"screenshot_frame_8049.bmp\".");
+    GFXRECON_WRITE_CONSOLE("  --screenshot-downscale <N>");
+    GFXRECON_WRITE_CONSOLE("          \t\tDivide the screenshot width and height by N.  The image");
+    GFXRECON_WRITE_CONSOLE("          \t\tis scaled on the GPU before it is read back.  Default is 1.");
+    GFXRECON_WRITE_CONSOLE("  --screenshot-hash-only");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite a 64-bit hash of each screenshot to the file");
+    GFXRECON_WRITE_CONSOLE("          \t\t<dir>/<file-prefix>_hashes.txt instead of writing image");
+    GFXRECON_WRITE_CONSOLE("          \t\tfiles.  Each line holds a screenshot name and its hash.");
     GFXRECON_WRITE_CONSOLE("  --sfa\t\t\tSkip vkAllocateMemory, vkAllocateCommandBuffers, and");
     GFXRECON_WRITE_CONSOLE("       \t\t\tvkAllocateDescriptorSets calls that failed during");
     GFXRECON_WRITE_CONSOLE("       \t\t\tcapture (same as --skip-failed-allocations).");
     GFXRECON_WRITE_CONSOLE("  --replace-shaders <dir> Replace the shader code in each CreateShaderModule");
-    GFXRECON_WRITE_CONSOLE("       \t\t\twith the contents of the file <dir>/sh<handle_id> if found, where");
-    GFXRECON_WRITE_CONSOLE("       \t\t\t<handle_id> is the handle id of the CreateShaderModule call.");
+    GFXRECON_WRITE_CONSOLE("       \t\t\twith the contents of the file <dir>/sh<checksum> if found, where");
+    GFXRECON_WRITE_CONSOLE("       \t\t\t<checksum> is the checksum of the original shader code.");
     GFXRECON_WRITE_CONSOLE("       \t\t\tSee gfxrecon-extract.");
     GFXRECON_WRITE_CONSOLE("  --opcd\t\tOmit pipeline cache data from calls to");
     GFXRECON_WRITE_CONSOLE("        \t\tvkCreatePipelineCache and skip calls to");
     GFXRECON_WRITE_CONSOLE("        \t\tvkGetPipelineCacheData (same as");
     GFXRECON_WRITE_CONSOLE("        \t\t--omit-pipeline-cache-data).");
+    GFXRECON_WRITE_CONSOLE("  --pipeline-cache <dir>");
+    GFXRECON_WRITE_CONSOLE("        \t\tKeep a pipeline cache for each capture file and replay");
+    GFXRECON_WRITE_CONSOLE("        \t\tdevice in <dir>, which is used by all pipeline creation");
+    GFXRECON_WRITE_CONSOLE("        \t\tcalls and saved when the device is destroyed, so that");
+    GFXRECON_WRITE_CONSOLE("        \t\trepeated replays do not recompile the same pipelines.");
+    GFXRECON_WRITE_CONSOLE("        \t\tCache files are specific to the device and driver.");
     GFXRECON_WRITE_CONSOLE("  --wsi <platform>\tForce replay to use the specified wsi platform.");
     GFXRECON_WRITE_CONSOLE("                  \tAvailable platforms are: %s", GetWsiArgString().c_str());
     GFXRECON_WRITE_CONSOLE("  --surface-index <N>\tRestrict rendering to the Nth surface object created.");
     GFXRECON_WRITE_CONSOLE("                  \tUsed with captures that include multiple surfaces.  Default");
     GFXRECON_WRITE_CONSOLE("                  \tis -1 (render to all surfaces).");
+    GFXRECON_WRITE_CONSOLE("  --virtual-swapchain\tBack each swapchain with offscreen images that are never");
+    GFXRECON_WRITE_CONSOLE("                     \tpresented, so that replay speed is not limited by the");
+    GFXRECON_WRITE_CONSOLE("                     \tpresentation engine or display timing.  Acquire and");
+    GFXRECON_WRITE_CONSOLE("                     \tpresent calls are emulated, and screenshots are taken");
+    GFXRECON_WRITE_CONSOLE("                     \tfrom the offscreen images.  Windows and surfaces are");
+    GFXRECON_WRITE_CONSOLE("                     \tstill created.");
+    GFXRECON_WRITE_CONSOLE("  --present-mode <mode>\tPresent swapchain images with an unlocked present mode,");
+    GFXRECON_WRITE_CONSOLE("                       \tso that replay speed is not limited by vertical blank.");
+    GFXRECON_WRITE_CONSOLE("                       \tAvailable modes are: %s, %s.  The other mode is used",
+                           kPresentModeImmediate,
+                           kPresentModeMailbox);
+    GFXRECON_WRITE_CONSOLE("                       \twhen the surface does not support the requested mode.");
+    GFXRECON_WRITE_CONSOLE("                       \tRendering targets offscreen images that are copied to");
+    GFXRECON_WRITE_CONSOLE("                       \tthe presented image, so that the captured swapchain");
+    GFXRECON_WRITE_CONSOLE("                       \timage indices remain valid.");
     GFXRECON_WRITE_CONSOLE("  --sync\t\tSynchronize after each queue submission with vkQueueWaitIdle.");
+    GFXRECON_WRITE_CONSOLE("  --max-submits-in-flight <N>");
+    GFXRECON_WRITE_CONSOLE("            \t\tWait before each queue submission until fewer than N");
+    GFXRECON_WRITE_CONSOLE("            \t\tearlier submissions to the same queue are executing.");
+    GFXRECON_WRITE_CONSOLE("            \t\tCompletion is tracked with a timeline semaphore per");
+    GFXRECON_WRITE_CONSOLE("            \t\tqueue, which requires timeline semaphore support.");
+    GFXRECON_WRITE_CONSOLE("  --max-frames-in-flight <N>");
+    GFXRECON_WRITE_CONSOLE("            \t\tWait after each present until the submissions of all but");
+    GFXRECON_WRITE_CONSOLE("            \t\tthe last N-1 frames have completed, bounding the GPU queue");
+    GFXRECON_WRITE_CONSOLE("            \t\tdepth without the full serialization of --sync.");
+    GFXRECON_WRITE_CONSOLE("  --collapse-polling\tSkip vkGetFenceStatus, vkWaitForFences, and");
+    GFXRECON_WRITE_CONSOLE("                    \tvkGetQueryPoolResults calls that were not satisfied");
+    GFXRECON_WRITE_CONSOLE("                    \tduring capture or that replay has already satisfied,");
+    GFXRECON_WRITE_CONSOLE("                    \twaiting only once for the call that found the fences");
+    GFXRECON_WRITE_CONSOLE("                    \tsignaled or the query results available.");
+    GFXRECON_WRITE_CONSOLE("  --batch-submits\tMerge consecutive vkQueueSubmit calls to the same queue");
+    GFXRECON_WRITE_CONSOLE("                \tinto one call with multiple submit infos.  The merged");
+    GFXRECON_WRITE_CONSOLE("                \tsubmissions are submitted before any other call, such as");
+    GFXRECON_WRITE_CONSOLE("                \ta fence wait, a submission to another queue, or a present,");
+    GFXRECON_WRITE_CONSOLE("                \tand submissions that replay modifies are not merged.");
+    GFXRECON_WRITE_CONSOLE("  --recycle-pools\tKeep descriptor pools and command pools that are destroyed,");
+    GFXRECON_WRITE_CONSOLE("                \tafter resetting them, and reuse them in place of creating");
+    GFXRECON_WRITE_CONSOLE("                \tpools with the same create parameters.");
+    GFXRECON_WRITE_CONSOLE("  --pace-cpu-timestamps");
+    GFXRECON_WRITE_CONSOLE("            \t\tWait before each queue submission and present until at");
+    GFXRECON_WRITE_CONSOLE("            \t\tleast the CPU time that the application spent since its");
+    GFXRECON_WRITE_CONSOLE("            \t\tprevious submission or present has passed, for captures");
+    GFXRECON_WRITE_CONSOLE("            \t\tmade with CPU timestamps enabled.  Replay that is slower");
+    GFXRECON_WRITE_CONSOLE("            \t\tthan the application is not accelerated.");
+    GFXRECON_WRITE_CONSOLE("  --skip-redundant-descriptor-updates");
+    GFXRECON_WRITE_CONSOLE("            \t\tSkip descriptor writes and descriptor update template");
+    GFXRECON_WRITE_CONSOLE("            \t\tupdates that would not change the contents of the");
+    GFXRECON_WRITE_CONSOLE("            \t\tdescriptor set, by caching the last contents written to");
+    GFXRECON_WRITE_CONSOLE("            \t\teach descriptor.");
+    GFXRECON_WRITE_CONSOLE("  --reuse-command-buffers");
+    GFXRECON_WRITE_CONSOLE("            \t\tSkip recordings of command buffers whose encoded commands");
+    GFXRECON_WRITE_CONSOLE("            \t\tmatch the previous recording of the command buffer,");
+    GFXRECON_WRITE_CONSOLE("            \t\tsubmitting the commands that were already recorded.");
+    GFXRECON_WRITE_CONSOLE("            \t\tCommand buffers begun with the one time submit flag, and");
+    GFXRECON_WRITE_CONSOLE("            \t\trecordings that bind updated descriptor sets or execute");
+    GFXRECON_WRITE_CONSOLE("            \t\tre-recorded secondary command buffers, are recorded again.");
+    GFXRECON_WRITE_CONSOLE("  --persistent-mapping\tMap host visible memory once when it is allocated, keeping");
+    GFXRECON_WRITE_CONSOLE("                      \tit mapped until it is freed, so that the capture file's");
+    GFXRECON_WRITE_CONSOLE("                      \tvkMapMemory and vkUnmapMemory calls do not call the driver.");
+    GFXRECON_WRITE_CONSOLE("                      \tThe rebind memory translation mode always behaves this way.");
     GFXRECON_WRITE_CONSOLE("  --remove-unsupported\tRemove unsupported extensions and features from instance");
     GFXRECON_WRITE_CONSOLE("                      \tand device creation parameters.");
+    GFXRECON_WRITE_CONSOLE("  --remap-device-addresses");
+    GFXRECON_WRITE_CONSOLE("                      \tTranslate the buffer and acceleration structure device");
+    GFXRECON_WRITE_CONSOLE("                      \taddresses that were captured to the addresses of the replay");
+    GFXRECON_WRITE_CONSOLE("                      \tdevice, for devices that do not support capture replay of");
+    GFXRECON_WRITE_CONSOLE("                      \tdevice addresses.  Addresses of acceleration structure");
+    GFXRECON_WRITE_CONSOLE("                      \tbuild parameters, trace rays shader binding tables, and");
+    GFXRECON_WRITE_CONSOLE("                      \tacceleration structure instances are translated, and the");
+    GFXRECON_WRITE_CONSOLE("                      \tshader group handles of shader binding tables are replaced");
+    GFXRECON_WRITE_CONSOLE("                      \tby the handles retrieved at replay.");
+    GFXRECON_WRITE_CONSOLE("  --accel-struct-cache\tStore the bottom level acceleration structures that are");
+    GFXRECON_WRITE_CONSOLE("                      \tbuilt by replay in <file>.blas, and load them from it");
+    GFXRECON_WRITE_CONSOLE("                      \tinstead of building them in later replays of <file> on");
+    GFXRECON_WRITE_CONSOLE("                      \tthe same device and driver.");
+    GFXRECON_WRITE_CONSOLE("  --lazy-resource-init\tDefer the upload of the buffer and image contents of a");
+    GFXRECON_WRITE_CONSOLE("                      \ttrimmed capture file's state snapshot until a queue");
+    GFXRECON_WRITE_CONSOLE("                      \tsubmission first references the resource, reading the");
+    GFXRECON_WRITE_CONSOLE("                      \tcontents from the file at that time.  Contents that are");
+    GFXRECON_WRITE_CONSOLE("                      \tnever referenced are never read or uploaded.");
+    GFXRECON_WRITE_CONSOLE("  --mmap\t\tRead the capture file through a memory mapping, passing");
+    GFXRECON_WRITE_CONSOLE("        \t\tblock data to the decoders without copying it.");
+    GFXRECON_WRITE_CONSOLE("  --prefetch\t\tRead and decompress capture file blocks ahead of replay");
+    GFXRECON_WRITE_CONSOLE("            \t\tfrom a separate thread.");
+    GFXRECON_WRITE_CONSOLE("  --preload\t\tRead and decompress all capture file blocks into memory");
+    GFXRECON_WRITE_CONSOLE("           \t\tbefore replay starts, so that replay timing does not");
+    GFXRECON_WRITE_CONSOLE("           \t\tdepend on disk I/O or the page cache.  Implies --prefetch.");
+    GFXRECON_WRITE_CONSOLE("  --preload-frames <first-last>");
+    GFXRECON_WRITE_CONSOLE("            \t\tRead and decompress the blocks of the specified frame");
+    GFXRECON_WRITE_CONSOLE("            \t\trange into memory when replay reaches the first frame of");
+    GFXRECON_WRITE_CONSOLE("            \t\tthe range.  The end of the range is found with the seek");
+    GFXRECON_WRITE_CONSOLE("            \t\tindex, and files without an index are preloaded up to");
+    GFXRECON_WRITE_CONSOLE("            \t\tthe size limit.  Implies --prefetch.");
+    GFXRECON_WRITE_CONSOLE("  --preload-limit <MiB>");
+    GFXRECON_WRITE_CONSOLE("            \t\tStop preloading when the preloaded blocks reach the");
+    GFXRECON_WRITE_CONSOLE("            \t\tspecified size, and read the remaining blocks ahead of");
+    GFXRECON_WRITE_CONSOLE("            \t\treplay as with --prefetch.  Default is %u.", kDefaultPreloadLimitMiB);
+    GFXRECON_WRITE_CONSOLE("  --decompression-threads <N>");
+    GFXRECON_WRITE_CONSOLE("            \t\tDecompress up to N capture file blocks concurrently, using");
+    GFXRECON_WRITE_CONSOLE("            \t\ta pool of N worker threads.  Blocks are still replayed in");
+    GFXRECON_WRITE_CONSOLE("            \t\tfile order.  Implies --prefetch.");
+    GFXRECON_WRITE_CONSOLE("  --decode-thread\tRead the capture file and decode API calls ahead of");
+    GFXRECON_WRITE_CONSOLE("                 \treplay from a separate thread, so that the replay thread");
+    GFXRECON_WRITE_CONSOLE("                 \tonly maps handles and calls Vulkan.");
+    GFXRECON_WRITE_CONSOLE("  --replay-threads <N>");
+    GFXRECON_WRITE_CONSOLE("            \t\tRecord the command buffers of each captured thread from");
+    GFXRECON_WRITE_CONSOLE("            \t\tone of N replay worker threads, so that command buffers");
+    GFXRECON_WRITE_CONSOLE("            \t\tthat were recorded in parallel are also replayed in");
+    GFXRECON_WRITE_CONSOLE("            \t\tparallel.  All other API calls are replayed in file order");
+    GFXRECON_WRITE_CONSOLE("            \t\tafter the workers finish.  Implies --decode-thread.");
+    GFXRECON_WRITE_CONSOLE("  --pipeline-threads <N>");
+    GFXRECON_WRITE_CONSOLE("            \t\tCreate graphics and compute pipelines from a pool of N");
+    GFXRECON_WRITE_CONSOLE("            \t\tworker threads, so that replay continues while pipelines");
+    GFXRECON_WRITE_CONSOLE("            \t\tare compiled.  Replay waits for a pipeline when it is");
+    GFXRECON_WRITE_CONSOLE("            \t\tfirst used.  Cannot be combined with --decode-thread or");
+    GFXRECON_WRITE_CONSOLE("            \t\t--replay-threads.");
+    GFXRECON_WRITE_CONSOLE("  --pipeline-warm-up <N>");
+    GFXRECON_WRITE_CONSOLE("            \t\tPre-scan the first N frames of the capture file and");
+    GFXRECON_WRITE_CONSOLE("            \t\tcreate their shader modules and graphics and compute");
+    GFXRECON_WRITE_CONSOLE("            \t\tpipelines from worker threads as soon as the objects");
+    GFXRECON_WRITE_CONSOLE("            \t\tthat they use exist, so that the pipeline creation calls");
+    GFXRECON_WRITE_CONSOLE("            \t\tof those frames use the pipelines that were already");
+    GFXRECON_WRITE_CONSOLE("            \t\tcreated.  Pipelines are started at each present.");
     GFXRECON_WRITE_CONSOLE("  -m <mode>\t\tEnable memory translation for replay on GPUs with memory");
     GFXRECON_WRITE_CONSOLE("          \t\ttypes that are not compatible with the capture GPU's");
     GFXRECON_WRITE_CONSOLE("          \t\tmemory types.  Available modes are:");
@@ -723,6 +2046,28 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\t         \tto different allocations with different");
     GFXRECON_WRITE_CONSOLE("          \t\t         \toffsets.  Uses VMA to manage allocations");
     GFXRECON_WRITE_CONSOLE("          \t\t         \tand suballocations.");
+    GFXRECON_WRITE_CONSOLE("  --rebind-pool-algorithm <algorithm>");
+    GFXRECON_WRITE_CONSOLE("          \t\tAllocation algorithm for the %s memory", kMemoryTranslationRebind);
+    GFXRECON_WRITE_CONSOLE("          \t\ttranslation mode.  Available algorithms are:");
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\tVMA default pools (default).", kPoolAlgorithmDefault);
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\tCustom pool for each memory type, using", kPoolAlgorithmLinear);
+    GFXRECON_WRITE_CONSOLE("          \t\t         \tVMA's linear algorithm.");
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\tCustom pool for each memory type, using", kPoolAlgorithmBuddy);
+    GFXRECON_WRITE_CONSOLE("          \t\t         \tVMA's buddy algorithm, which reduces");
+    GFXRECON_WRITE_CONSOLE("          \t\t         \tfragmentation from resource churn.");
+    GFXRECON_WRITE_CONSOLE("  --rebind-block-size <MiB>");
+    GFXRECON_WRITE_CONSOLE("          \t\tSize of the device memory blocks that the %s", kMemoryTranslationRebind);
+    GFXRECON_WRITE_CONSOLE("          \t\tmemory translation mode suballocates resources from.");
+    GFXRECON_WRITE_CONSOLE("  --device-memory-budget <MiB>");
+    GFXRECON_WRITE_CONSOLE("          \t\tLimit device local memory usage with the %s", kMemoryTranslationRebind);
+    GFXRECON_WRITE_CONSOLE("          \t\tmemory translation mode.  Resources that would exceed the");
+    GFXRECON_WRITE_CONSOLE("          \t\tbudget are allocated from host memory accessible to the");
+    GFXRECON_WRITE_CONSOLE("          \t\tdevice.");
+    GFXRECON_WRITE_CONSOLE("  --no-analysis-cache\tDo not read or write <file>.meta, which stores the results");
+    GFXRECON_WRITE_CONSOLE("          \t\tof the first replay pass of the %s memory",
+                           kMemoryTranslationRealign);
+    GFXRECON_WRITE_CONSOLE("          \t\ttranslation mode so that later replays on the same");
+    GFXRECON_WRITE_CONSOLE("          \t\tdevices skip it.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("       \t\t\tdisplayed when abort() is called (Windows debug only).");
@@ -0,0 +1,126 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "file_splitter.h"
+
+#include "util/file_path.h"
+#include "util/logging.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+FileSplitter::FileSplitter(const std::string& output_filename, uint32_t frames_per_file) :
+    output_filename_(output_filename), frames_per_file_(frames_per_file), range_complete_(false)
+{
+    assert(frames_per_file > 0);
+
+    output_files_.push_back({ GetRangeFilename(output_filename, 1, frames_per_file), 1, 0 });
+}
+
+std::string FileSplitter::GetRangeFilename(const std::string& output_filename,
+                                           uint32_t           first_frame,
+                                           uint32_t           last_frame)
+{
+    std::string range_string = "_";
+
+    if (last_frame <= first_frame)
+    {
+        range_string += "frame_";
+        range_string += std::to_string(first_frame);
+    }
+    else
+    {
+        range_string += "frames_";
+        range_string += std::to_string(first_frame);
+        range_string += "_through_";
+        range_string += std::to_string(last_frame);
+    }
+
+    return util::filepath::InsertFilenamePostfix(output_filename, range_string);
+}
+
+bool FileSplitter::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
+{
+    if (!StartPendingRange() || !FileTransformer::ProcessFunctionCall(block_header, call_id))
+    {
+        return false;
+    }
+
+    if (call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR)
+    {
+        OutputFile& output_file = output_files_.back();
+
+        ++output_file.frame_count;
+
+        if (output_file.frame_count == frames_per_file_)
+        {
+            range_complete_ = true;
+        }
+    }
+
+    return true;
+}
+
+bool FileSplitter::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+{
+    // The seek index at the end of the input file is not copied, and does not start a new range.
+    if ((meta_type != format::MetaDataType::kSeekIndexCommand) &&
+        (meta_type != format::MetaDataType::kSeekIndexFooterCommand) && !StartPendingRange())
+    {
+        return false;
+    }
+
+    return FileTransformer::ProcessMetaData(block_header, meta_type);
+}
+
+bool FileSplitter::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
+{
+    return StartPendingRange() && FileTransformer::ProcessStateMarker(block_header, marker_type);
+}
+
+bool FileSplitter::StartPendingRange()
+{
+    if (!range_complete_)
+    {
+        return true;
+    }
+
+    range_complete_ = false;
+
+    uint32_t    first_frame = output_files_.back().first_frame + frames_per_file_;
+    std::string filename    = GetRangeFilename(output_filename_, first_frame, first_frame + frames_per_file_ - 1);
+
+    output_files_.push_back({ filename, first_frame, 0 });
+
+    if (!OpenOutputFile(filename))
+    {
+        return false;
+    }
+
+    // Compressed blocks that follow may depend on the dictionary, which was written to the previous output file.
+    const std::vector<uint8_t>& dictionary = GetCompressionDictionary();
+
+    return dictionary.empty() || WriteCompressionDictionary(dictionary);
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
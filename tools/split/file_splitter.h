@@ -0,0 +1,81 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_FILE_SPLITTER_H
+#define GFXRECON_FILE_SPLITTER_H
+
+#include "decode/file_transformer.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Copies a capture file to a sequence of output files that each contain a range of frames.  Each output file starts
+// with the file header and options of the input file, followed by the input file's compression dictionary when it has
+// one.  The state snapshot of a trimmed capture file is written to the first output file.  Blocks that follow the last
+// frame delimiter of a range are written to the next output file, which is only created when there is such a block.
+class FileSplitter : public decode::FileTransformer
+{
+  public:
+    struct OutputFile
+    {
+        std::string filename;
+        uint32_t    first_frame;
+        uint32_t    frame_count; // Number of frame delimiters in the file.
+    };
+
+  public:
+    // The output file for the first range must be passed to Initialize(), and should be named with
+    // GetRangeFilename(output_filename, 1, frames_per_file).
+    FileSplitter(const std::string& output_filename, uint32_t frames_per_file);
+
+    // Returns the output filename for a range of frames, numbered from 1.
+    static std::string GetRangeFilename(const std::string& output_filename, uint32_t first_frame, uint32_t last_frame);
+
+    // Output files, in frame order.  The last file is named for a full range of frames, and may contain fewer frames.
+    const std::vector<OutputFile>& GetOutputFiles() const { return output_files_; }
+
+  protected:
+    virtual bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id) override;
+
+    virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type) override;
+
+    virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type) override;
+
+  private:
+    // Opens the output file for the next range when the current range is complete.
+    bool StartPendingRange();
+
+  private:
+    std::string             output_filename_;
+    uint32_t                frames_per_file_;
+    std::vector<OutputFile> output_files_;
+    bool                    range_complete_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FILE_SPLITTER_H
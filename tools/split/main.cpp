@@ -0,0 +1,282 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "project_version.h"
+#include "file_splitter.h"
+
+#include "decode/file_transformer.h"
+#include "format/format.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan_core.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+const char kHelpShortOption[] = "-h";
+const char kHelpLongOption[]  = "--help";
+const char kVersionOption[]   = "--version";
+const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kMergeOption[]     = "--merge";
+
+const char kFramesPerFileArgument[] = "--frames-per-file";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--merge";
+const char kArguments[] = "--frames-per-file";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - Split GFXReconstruct capture files into frame ranges, or merge them.\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] --frames-per-file <N> <input-file> <output-file>",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] --merge <output-file> <input-file> [<input-file> ...]\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <input-file>\t\tThe GFXReconstruct capture file to be split, or one of the");
+    GFXRECON_WRITE_CONSOLE("              \t\tcapture files to be merged, in order.");
+    GFXRECON_WRITE_CONSOLE("  <output-file>\t\tThe name of the merged capture file, or the name of the split");
+    GFXRECON_WRITE_CONSOLE("               \t\tcapture files, which receive a frame range suffix.");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --frames-per-file <N>\tWrite N frames to each output file.  The state snapshot of a");
+    GFXRECON_WRITE_CONSOLE("        \t\ttrimmed capture file is written to the first output file.");
+    GFXRECON_WRITE_CONSOLE("  --merge\t\tConcatenate the blocks of the input files, which must use the");
+    GFXRECON_WRITE_CONSOLE("        \t\tsame compression format, into a single capture file.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static uint32_t GetCompressionType(const std::vector<gfxrecon::format::FileOptionPair>& file_options)
+{
+    uint32_t compression_type = gfxrecon::format::CompressionType::kNone;
+
+    for (const auto& option : file_options)
+    {
+        if (option.key == gfxrecon::format::FileOption::kCompressionType)
+        {
+            compression_type = option.value;
+        }
+    }
+
+    return compression_type;
+}
+
+static bool SplitFile(const std::string& input_filename, const std::string& output_filename, uint32_t frames_per_file)
+{
+    std::vector<gfxrecon::FileSplitter::OutputFile> output_files;
+
+    {
+        gfxrecon::FileSplitter file_splitter(output_filename, frames_per_file);
+
+        if (!file_splitter.Initialize(input_filename, file_splitter.GetOutputFiles().front().filename) ||
+            !file_splitter.Process())
+        {
+            GFXRECON_WRITE_CONSOLE("Capture file %s could not be split.", input_filename.c_str());
+            return false;
+        }
+
+        // The last output file is closed when the splitter is destroyed.
+        output_files = file_splitter.GetOutputFiles();
+    }
+
+    // Name the last file for the frames that it contains, which can be fewer than the frames per file.
+    auto&    last_file  = output_files.back();
+    uint32_t last_frame = last_file.first_frame + last_file.frame_count - 1;
+
+    if (last_file.frame_count < frames_per_file)
+    {
+        std::string filename =
+            gfxrecon::FileSplitter::GetRangeFilename(output_filename, last_file.first_frame, last_frame);
+
+        if (std::rename(last_file.filename.c_str(), filename.c_str()) != 0)
+        {
+            GFXRECON_LOG_ERROR("Failed to rename %s to %s", last_file.filename.c_str(), filename.c_str());
+            return false;
+        }
+
+        last_file.filename = filename;
+    }
+
+    for (const auto& output_file : output_files)
+    {
+        GFXRECON_WRITE_CONSOLE("Wrote %u frames to %s", output_file.frame_count, output_file.filename.c_str());
+    }
+
+    return true;
+}
+
+static bool MergeFiles(const std::vector<std::string>& input_filenames, const std::string& output_filename)
+{
+    assert(!input_filenames.empty());
+
+    uint32_t compression_type = gfxrecon::format::CompressionType::kNone;
+
+    for (size_t i = 0; i < input_filenames.size(); ++i)
+    {
+        // The blocks of each input file are copied to the output file, without the file header of the files that follow
+        // the first.  Seek indices are not copied, because their offsets do not apply to the merged file.
+        gfxrecon::decode::FileTransformer file_transformer;
+
+        file_transformer.SetAppendOutput(i > 0);
+
+        if (!file_transformer.Initialize(input_filenames[i], output_filename))
+        {
+            return false;
+        }
+
+        if (i == 0)
+        {
+            compression_type = GetCompressionType(file_transformer.GetFileOptions());
+        }
+        else if (GetCompressionType(file_transformer.GetFileOptions()) != compression_type)
+        {
+            GFXRECON_LOG_ERROR("Capture file %s does not use the same compression format as %s",
+                               input_filenames[i].c_str(),
+                               input_filenames[0].c_str());
+            return false;
+        }
+
+        if (!file_transformer.Process())
+        {
+            GFXRECON_WRITE_CONSOLE("Capture file %s could not be merged.", input_filenames[i].c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    int return_code = 0;
+
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    bool merge = arg_parser.IsOptionSet(kMergeOption);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (merge && (arg_parser.GetPositionalArgumentsCount() < 2)) ||
+             (!merge && ((arg_parser.GetPositionalArgumentsCount() != 2) ||
+                         arg_parser.GetArgumentValue(kFramesPerFileArgument).empty())))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
+
+    if (merge)
+    {
+        std::vector<std::string> input_filenames(positional_arguments.begin() + 1, positional_arguments.end());
+
+        if (!MergeFiles(input_filenames, positional_arguments[0]))
+        {
+            return_code = -1;
+        }
+    }
+    else
+    {
+        const std::string& frames_string   = arg_parser.GetArgumentValue(kFramesPerFileArgument);
+        uint32_t           frames_per_file = static_cast<uint32_t>(std::strtoul(frames_string.c_str(), nullptr, 10));
+
+        if (frames_per_file == 0)
+        {
+            GFXRECON_LOG_ERROR("Invalid frames per file \"%s\"", frames_string.c_str());
+            return_code = -1;
+        }
+        else if (!SplitFile(positional_arguments[0], positional_arguments[1], frames_per_file))
+        {
+            return_code = -1;
+        }
+    }
+
+    gfxrecon::util::Log::Release();
+
+    return return_code;
+}
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 LunarG, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+#
+# Utility for displaying the capture overhead telemetry that the capture layer publishes when
+# GFXRECON_CAPTURE_TELEMETRY_PORT is set.
+
+
+import argparse
+import json
+import socket
+import sys
+
+
+DEFAULT_PORT = 27060
+
+
+def CreateArgParser():
+    parser = argparse.ArgumentParser(description='Display live capture overhead telemetry from the GFXReconstruct capture layer.')
+    parser.add_argument('-p', '--port', dest='port', type=int, default=DEFAULT_PORT,
+                        help='Local UDP port that the capture layer publishes to, specified by GFXRECON_CAPTURE_TELEMETRY_PORT (default {})'.format(DEFAULT_PORT))
+    parser.add_argument('--json', dest='json', action='store_true', default=False,
+                        help='Print the samples as received, one JSON object per line')
+    return parser
+
+
+def FormatBytes(value):
+    if value < 1024:
+        return '{:d} B'.format(int(value))
+    for unit in ['KiB', 'MiB', 'GiB']:
+        value /= 1024.0
+        if value < 1024.0 or unit == 'GiB':
+            return '{:.1f} {}'.format(value, unit)
+
+
+COLUMNS = [
+    ('Frame', 8, lambda s: '{:d}'.format(s['frame'])),
+    ('Write rate', 12, lambda s: FormatBytes(s['write_rate']) + '/s'),
+    ('Written', 11, lambda s: FormatBytes(s['bytes_written'])),
+    ('Queued', 11, lambda s: FormatBytes(s['writer_queue_bytes'])),
+    ('Ratio', 6, lambda s: '{:.2f}'.format(s['compression_ratio'])),
+    ('Faults/frame', 12, lambda s: '{:.1f}'.format(s['faults_per_frame'])),
+    ('Shadow mem', 11, lambda s: FormatBytes(s['shadow_memory_bytes'])),
+    ('Tracked state', 13, lambda s: FormatBytes(s['state_tracker_bytes'])),
+]
+
+
+def PrintHeader():
+    print('  '.join(name.rjust(width) for name, width, _ in COLUMNS))
+
+
+def PrintSample(sample):
+    print('  '.join(format_value(sample).rjust(width) for _, width, format_value in COLUMNS))
+
+
+if __name__ == '__main__':
+    args = CreateArgParser().parse_args()
+
+    try:
+        sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        sock.bind(('127.0.0.1', args.port))
+    except OSError as e:
+        print('Error: Cannot listen on 127.0.0.1:{}: {}'.format(args.port, e))
+        sys.exit(1)
+
+    print('Listening for capture telemetry on 127.0.0.1:{}'.format(args.port))
+
+    lines = 0
+    try:
+        while True:
+            data, _ = sock.recvfrom(4096)
+            try:
+                sample = json.loads(data.decode('utf-8'))
+            except ValueError:
+                continue
+
+            if args.json:
+                print(json.dumps(sample))
+            else:
+                if (lines % 20) == 0:
+                    PrintHeader()
+                PrintSample(sample)
+                lines += 1
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        sock.close()
@@ -24,6 +24,8 @@
 #include "project_version.h"
 
 #include "decode/file_processor.h"
+#include "decode/frame_range_util.h"
+#include "decode/pnext_node.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_ascii_consumer.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -32,14 +34,26 @@
 
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
 #include <cstdlib>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
 
 const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
+const char kFramesArgument[]  = "--frames";
+const char kThreadsArgument[] = "--threads";
 const char kNoDebugPopup[]    = "--no-debug-popup";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--frames,--threads";
+
+const size_t kCopyBufferSize = 1024 * 1024;
 
 static void PrintUsage(const char* exe_name)
 {
@@ -51,13 +65,21 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to convert GFXReconstruct capture files to text.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--frames <range>] [--threads <N>] <file>\n",
+                           app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tPath to the GFXReconstruct capture file to be converted");
     GFXRECON_WRITE_CONSOLE("        \t\tto text.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --frames <range>\tOnly process frames <first>[-<last>], where frames are");
+    GFXRECON_WRITE_CONSOLE("                \t\tnumbered from 1.  Frames before <first> are skipped with");
+    GFXRECON_WRITE_CONSOLE("                \t\tthe capture file seek index, when it is present.");
+    GFXRECON_WRITE_CONSOLE("  --threads <N>\t\tSplit the frames between N threads, which convert");
+    GFXRECON_WRITE_CONSOLE("               \t\ttheir frames to separate files that are concatenated");
+    GFXRECON_WRITE_CONSOLE("               \t\tin order.  Requires the capture file seek index.");
+    GFXRECON_WRITE_CONSOLE("               \t\tDefault is 1.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -100,11 +122,69 @@ static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::
     return false;
 }
 
+static bool ConvertFrames(gfxrecon::decode::FileProcessor* file_processor,
+                          const std::string&               output_filename,
+                          uint32_t                         first_frame,
+                          uint32_t                         last_frame)
+{
+    assert(file_processor != nullptr);
+
+    gfxrecon::decode::VulkanDecoder       decoder;
+    gfxrecon::decode::VulkanAsciiConsumer ascii_consumer;
+
+    if (!ascii_consumer.Initialize(output_filename))
+    {
+        GFXRECON_LOG_ERROR("Failed to open output file %s", output_filename.c_str());
+        return false;
+    }
+
+    decoder.AddConsumer(&ascii_consumer);
+
+    gfxrecon::decode::SkipToFrame(file_processor, first_frame);
+
+    file_processor->AddDecoder(&decoder);
+
+    while ((file_processor->GetCurrentFrameNumber() < last_frame) && file_processor->ProcessNextFrame())
+    {
+    }
+
+    file_processor->RemoveDecoder(&decoder);
+
+    return (file_processor->GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+}
+
+static bool AppendFile(const std::string& source_filename, FILE* destination)
+{
+    FILE* source = nullptr;
+    if (gfxrecon::util::platform::FileOpen(&source, source_filename.c_str(), "rb") != 0)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(kCopyBufferSize);
+    bool                 success = true;
+
+    while (success)
+    {
+        size_t read_size = gfxrecon::util::platform::FileReadNoLock(buffer.data(), 1, buffer.size(), source);
+        if (read_size == 0)
+        {
+            break;
+        }
+
+        success = (gfxrecon::util::platform::FileWriteNoLock(buffer.data(), 1, read_size, destination) == read_size);
+    }
+
+    gfxrecon::util::platform::FileClose(source);
+
+    return success;
+}
+
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -141,14 +221,104 @@ int main(int argc, const char** argv)
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder       decoder;
-        gfxrecon::decode::VulkanAsciiConsumer ascii_consumer;
+        // The ASCII consumer does not access pNext structs, which can be skipped without decoding them.
+        gfxrecon::decode::PNextNode::SetLazyDecoding(true);
+
+        uint32_t first_frame = 1;
+        uint32_t last_frame  = std::numeric_limits<uint32_t>::max();
+        gfxrecon::decode::ParseFrameRange(arg_parser.GetArgumentValue(kFramesArgument), &first_frame, &last_frame);
+
+        uint32_t           threads        = 1;
+        const std::string& threads_string = arg_parser.GetArgumentValue(kThreadsArgument);
+        if (!threads_string.empty())
+        {
+            threads = std::max(1u, static_cast<uint32_t>(std::strtoul(threads_string.c_str(), nullptr, 10)));
+        }
+
+        uint32_t frame_count = 0;
+        uint32_t range_count = 0;
+        if ((threads > 1) && file_processor.GetIndexedFrameCount(&frame_count) && (frame_count >= first_frame))
+        {
+            range_count = std::min(last_frame, frame_count) - first_frame + 1;
+            threads     = std::min(threads, range_count);
+        }
+        else
+        {
+            threads = 1;
+        }
+
+        bool success = true;
+
+        if (threads == 1)
+        {
+            success = ConvertFrames(&file_processor, output_filename, first_frame, last_frame);
+        }
+        else
+        {
+            // Split the frames into contiguous ranges that are converted by separate file processors, which use the
+            // seek index to skip to the first frame of their range, and write to separate files.  The last range
+            // extends to the end of the requested range, to include any blocks that follow the last frame delimiter.
+            uint32_t range_size = (range_count + threads - 1) / threads;
+
+            // Rounding up the range size can leave the last threads without frames.
+            threads = (range_count + range_size - 1) / range_size;
+
+            std::vector<std::string> range_filenames(threads, output_filename);
+            std::vector<char>        thread_success(threads, 0);
+            std::vector<std::thread> workers;
+
+            for (uint32_t i = 1; i < threads; ++i)
+            {
+                uint32_t range_first = first_frame + (i * range_size);
+                uint32_t range_last  = (i == (threads - 1)) ? last_frame : (range_first + range_size - 1);
+
+                range_filenames[i] += "." + std::to_string(i);
+
+                workers.emplace_back([&, i, range_first, range_last]() {
+                    gfxrecon::decode::FileProcessor range_processor;
+                    thread_success[i] = range_processor.Initialize(input_filename) &&
+                                        ConvertFrames(&range_processor, range_filenames[i], range_first, range_last);
+                });
+            }
+
+            thread_success[0] =
+                ConvertFrames(&file_processor, range_filenames[0], first_frame, first_frame + range_size - 1);
 
-        ascii_consumer.Initialize(output_filename);
-        decoder.AddConsumer(&ascii_consumer);
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
 
-        file_processor.AddDecoder(&decoder);
-        file_processor.ProcessAllFrames();
+            success = std::all_of(thread_success.begin(), thread_success.end(), [](char value) { return value != 0; });
+
+            // Append the output of the other ranges to the output of the first range.
+            FILE* output_file = nullptr;
+            if (success && (gfxrecon::util::platform::FileOpen(&output_file, output_filename.c_str(), "ab") == 0))
+            {
+                for (uint32_t i = 1; (i < threads) && success; ++i)
+                {
+                    success = AppendFile(range_filenames[i], output_file);
+                }
+
+                success = (gfxrecon::util::platform::FileClose(output_file) == 0) && success;
+            }
+            else
+            {
+                success = false;
+            }
+
+            for (uint32_t i = 1; i < threads; ++i)
+            {
+                std::remove(range_filenames[i].c_str());
+            }
+        }
+
+        if (!success)
+        {
+            GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
     }
 
     gfxrecon::util::Log::Release();
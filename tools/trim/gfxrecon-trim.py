@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020 LunarG, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+#
+# Utility for creating trimmed capture files from a full capture file.
+#
+# The capture file is replayed by gfxrecon-replay with the capture layer
+# active and the capture layer's frame ranges set to the frames to keep.  The
+# capture layer tracks the Vulkan state of the replay, and writes a state
+# snapshot followed by the calls of each frame range, reading the contents of
+# buffers and images back from the replay device.  The application that was
+# captured is not needed.
+
+
+import argparse
+import os
+import shutil
+import sys
+import subprocess
+
+
+######################
+# Define a usage message.
+def UsageMsg():
+    msg = ('gfxrecon-trim.py [-h]' + os.linesep +
+           '                        -f frames' + os.linesep +
+           '                        [-o outputFile]' + os.linesep +
+           '                        [--compression-type {LZ4,ZLIB,ZSTD,NONE}]' + os.linesep +
+           '                        [--optimize]' + os.linesep +
+           '                        [--optimize-bda]' + os.linesep +
+           '                        [--pipeline-cache]' + os.linesep +
+           '                        [--constant-content]' + os.linesep +
+           '                        [--fast-forward]' + os.linesep +
+           '                        [--replay replayCommand]' + os.linesep +
+           '                        [--log-level {debug,info,warn,error,fatal}]' + os.linesep +
+           '                        [--log-file <file>]' + os.linesep +
+           '                        <inputFile> [<replayArgs>]')
+    return msg
+
+
+######################
+# Print error message and exit with non-zero status
+def PrintErrorAndExit(msg):
+    print(os.path.basename(__file__) + ' error: ' + msg)
+    sys.exit(1)
+
+
+######################
+# Set an environment variable to a given value or remove it from the environment if None
+def SetEnvVar(name, value):
+    if value is not None:
+        os.environ[name] = value
+    elif name in os.environ:
+        del os.environ[name]
+
+
+######################
+# Parse arguments
+def ParseArgs():
+
+    compressionTypeChoices = ['LZ4','ZLIB','ZSTD','NONE']
+    logLevelChoices = ['debug','info','warn','error','fatal']
+
+    parser = argparse.ArgumentParser(prog=os.path.basename(sys.argv[0]), description='Create trimmed capture files from a full capture file by replaying it with the capture layer active.', usage=UsageMsg(), allow_abbrev=False)
+
+    parser.add_argument('-f', '--frames', dest='frames', metavar='<frames>', required=True, help='Frame ranges to keep, in the format of the GFXRECON_CAPTURE_FRAMES capture option (for example 100-110,500-510).  A trimmed capture file is written for each range')
+    parser.add_argument('-o', '--output-file', dest='outputFile', metavar='<outputFile>', help='Name of the trimmed capture file, which receives a frame range suffix from the capture layer.  Default is the input file name with a _trim suffix')
+    parser.add_argument('--compression-type', dest='compressionType', choices=compressionTypeChoices, help='Specify the type of compression to use in the trimmed capture file, default is LZ4')
+    parser.add_argument('--optimize', dest='optimize', action='store_const', const='true', help='Omit the content of buffers and images that are not referenced by the trimmed frames from the state snapshot (same as GFXRECON_CAPTURE_TRIM_OPTIMIZE)')
+    parser.add_argument('--optimize-bda', dest='optimizeBda', action='store_const', const='true', help='With --optimize, also omit the content of buffers with device addresses that are not referenced by the acceleration structure builds and shader binding tables of the trimmed frames (same as GFXRECON_CAPTURE_TRIM_OPTIMIZE_BDA)')
+    parser.add_argument('--pipeline-cache', dest='pipelineCache', action='store_const', const='true', help='Write the pipeline cache data of each device to the state snapshot, for replay to use when the pipelines of the snapshot are created (same as GFXRECON_CAPTURE_TRIM_PIPELINE_CACHE)')
+    parser.add_argument('--constant-content', dest='constantContent', action='store_const', const='true', help='Write the content of buffers and images that repeats a short pattern, such as cleared render targets, as the pattern instead of the full content (same as GFXRECON_CAPTURE_TRIM_CONSTANT_CONTENT)')
+    parser.add_argument('--fast-forward', dest='fastForward', action='store_true', default=False, help='Drop the draw, dispatch, and trace rays commands that precede the first frame range during replay (gfxrecon-replay --fast-forward).  Images and buffers that are written by the dropped commands and are not rewritten before the range begins have the wrong contents in the state snapshot')
+    parser.add_argument('--replay', dest='replay', metavar='<replayCommand>', help='Path to the gfxrecon-replay executable, default is to search the current directory, PATH, and the build directory of this script')
+    parser.add_argument('--log-level', dest='logLevel', choices=logLevelChoices, help='Specify highest level message to log for the capture layer, default is info')
+    parser.add_argument('--log-file', dest='logFile', metavar='<logFile>', help='Write capture layer log messages to a file at the specified path')
+
+    parser.add_argument('inputFile', metavar='<inputFile>', help='Capture file to trim')
+    parser.add_argument('replayArgs', metavar='<replayArgs>', nargs=argparse.REMAINDER, help='Additional gfxrecon-replay arguments, such as --gpu or -m')
+
+    return parser
+
+
+######################
+# Get the command that runs gfxrecon-replay
+def GetReplayCommand(args):
+    if args.replay is not None:
+        return shutil.which(os.path.expanduser(args.replay))
+
+    if sys.platform == 'win32':
+        replayExe = 'gfxrecon-replay.exe'
+    else:
+        replayExe = 'gfxrecon-replay'
+
+    # Search the current directory and PATH
+    replay = shutil.which(replayExe, path=os.curdir + os.pathsep + os.environ.get('PATH', ''))
+    if replay is not None:
+        return replay
+
+    # Search the build directory, where the replay tool is in <scriptdir>/../replay
+    scriptdir = os.path.dirname(os.path.realpath(__file__))
+    if sys.platform == 'win32':
+        for buildtype in ['Debug', 'Release', 'RelWithDebInfo', 'MinSizeRel']:
+            replay = shutil.which(os.path.join(scriptdir, '..', 'replay', buildtype, replayExe))
+            if replay is not None:
+                return replay
+        return None
+
+    return shutil.which(os.path.join(scriptdir, '..', 'replay', replayExe))
+
+
+######################
+# Get the first frame of the frame ranges, or None if the ranges cannot be parsed
+def GetFirstFrame(frames):
+    try:
+        return min(int(frameRange.split('-')[0]) for frameRange in frames.split(','))
+    except ValueError:
+        return None
+
+
+######################
+# Do validation on arguments
+def ValidateArgs(args):
+
+    if not os.path.isfile(args.inputFile):
+        PrintErrorAndExit('Input file ' + args.inputFile + ' does not exist')
+
+    if GetReplayCommand(args) is None:
+        PrintErrorAndExit('Cannot find gfxrecon-replay to execute')
+
+    if (args.optimizeBda is not None) and (args.optimize is None):
+        PrintErrorAndExit('--optimize-bda requires --optimize')
+
+    if args.fastForward and (GetFirstFrame(args.frames) is None):
+        PrintErrorAndExit('Cannot determine the first frame of ' + args.frames + ' for --fast-forward')
+
+    # Verify outputFile directory exists and is a valid directory.
+    if args.outputFile is not None:
+        outputFileDir = os.path.dirname(os.path.abspath(args.outputFile))
+        if (not os.path.isdir(outputFileDir)):
+            PrintErrorAndExit('Output file directory ' + outputFileDir + ' does not exist')
+
+
+######################
+# Set env variables for capture layer
+def SetEnvVars(args):
+
+    # Set VK_INSTANCE_LAYERS
+    # If gfxr layer is not already in VK_INSTANCE_LAYER, append gfxr layer to VK_INSTANCE_LAYERS
+    if os.getenv('VK_INSTANCE_LAYERS') is None:
+        os.environ['VK_INSTANCE_LAYERS'] = 'VK_LAYER_LUNARG_gfxreconstruct'
+    elif (not ('VK_LAYER_LUNARG_gfxreconstruct' in os.getenv('VK_INSTANCE_LAYERS'))):
+        os.environ['VK_INSTANCE_LAYERS'] = os.environ['VK_INSTANCE_LAYERS'] + os.pathsep + 'VK_LAYER_LUNARG_gfxreconstruct'
+
+    outputFile = args.outputFile
+    if outputFile is None:
+        outputFile = os.path.splitext(args.inputFile)[0] + '_trim.gfxr'
+
+    # Set GFXRECON_* capture options
+    # The capture layer will validate these options and generate errors as needed
+    SetEnvVar('GFXRECON_CAPTURE_FILE', os.path.abspath(outputFile))
+    SetEnvVar('GFXRECON_CAPTURE_FRAMES', args.frames)
+    SetEnvVar('GFXRECON_CAPTURE_FILE_TIMESTAMP', 'false')
+    SetEnvVar('GFXRECON_CAPTURE_TRIGGER', None)
+    SetEnvVar('GFXRECON_CAPTURE_COMPRESSION_TYPE', args.compressionType)
+    if args.compressionType == 'ZSTD':
+        # The state snapshot is written while replay is paused, so its large
+        # buffer and image blocks can be compressed with all cores
+        SetEnvVar('GFXRECON_CAPTURE_COMPRESSION_WORKERS', str(os.cpu_count() or 1))
+    else:
+        SetEnvVar('GFXRECON_CAPTURE_COMPRESSION_WORKERS', None)
+    SetEnvVar('GFXRECON_CAPTURE_TRIM_OPTIMIZE', args.optimize)
+    SetEnvVar('GFXRECON_CAPTURE_TRIM_OPTIMIZE_BDA', args.optimizeBda)
+    SetEnvVar('GFXRECON_CAPTURE_TRIM_PIPELINE_CACHE', args.pipelineCache)
+    SetEnvVar('GFXRECON_CAPTURE_TRIM_CONSTANT_CONTENT', args.constantContent)
+    SetEnvVar('GFXRECON_LOG_LEVEL', args.logLevel)
+    SetEnvVar('GFXRECON_LOG_FILE', args.logFile)
+
+
+######################
+# Get the gfxrecon-replay command line
+def GetReplayArgs(args):
+    replayArgs = [GetReplayCommand(args)]
+
+    if args.fastForward:
+        replayArgs += ['--fast-forward', str(GetFirstFrame(args.frames))]
+
+    return replayArgs + args.replayArgs + [args.inputFile]
+
+
+if __name__ == '__main__':
+
+    # We don't support running under Cygwin Python
+    if sys.platform == 'cygwin':
+        PrintErrorAndExit("Cygwin Python not supported")
+
+    # Get and validate args
+    parser = ParseArgs()
+    args = parser.parse_args()
+    ValidateArgs(args)
+
+    # Set up environment
+    SetEnvVars(args)
+
+    # Replay the capture file and exit with the exit status of the replay tool
+    replayArgs = GetReplayArgs(args)
+    print('Executing', ' '.join(replayArgs))
+    result = subprocess.run(replayArgs)
+    sys.exit(result.returncode)